@@ -123,6 +123,10 @@ LOCAL_SRC_FILES := \
  $(SPATIALITE_PATH)/src/spatialite/virtualbbox.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualdbf.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualelementary.c \
+ $(SPATIALITE_PATH)/src/spatialite/virtualgrid.c \
+ $(SPATIALITE_PATH)/src/spatialite/virtualdelaunay.c \
+ $(SPATIALITE_PATH)/src/spatialite/virtualcolumnar.c \
+ $(SPATIALITE_PATH)/src/spatialite/worker_threads.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualfdo.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualgpkg.c \
  $(SPATIALITE_PATH)/src/spatialite/virtualnetwork.c \
@@ -118,6 +118,49 @@ static pthread_mutex_t gaia_cache_semaphore = PTHREAD_MUTEX_INITIALIZER;
 
 #define GAIA_CONN_RESERVED	(char *)1
 
+/* GLOBAL connection pool occupancy */
+static volatile int splite_pool_used = 0;
+static volatile int splite_pool_peak = 0;
+
+static int
+splite_atomic_add (volatile int *value, int delta)
+{
+/* atomically adding DELTA; returns the updated value */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return InterlockedExchangeAdd ((volatile LONG *) value, delta) + delta;
+#else
+    return __sync_add_and_fetch (value, delta);
+#endif
+}
+
+static int
+splite_atomic_cas (volatile int *value, int expected, int desired)
+{
+/* atomic compare-and-swap; returns TRUE on success */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return InterlockedCompareExchange ((volatile LONG *) value, desired,
+				       expected) == expected;
+#else
+    return __sync_bool_compare_and_swap (value, expected, desired);
+#endif
+}
+
+static void
+splite_pool_acquired (void)
+{
+/* updating the pool occupancy after allocating a connection */
+    int peak;
+    int used = splite_atomic_add (&splite_pool_used, 1);
+    while (1)
+      {
+	  peak = splite_pool_peak;
+	  if (used <= peak)
+	      break;
+	  if (splite_atomic_cas (&splite_pool_peak, peak, used))
+	      break;
+      }
+}
+
 #ifdef PROJ_NEW			/* supporting new PROJ.6 */
 static void
 gaia_proj_log_funct (void *data, int level, const char *err_msg)
@@ -329,22 +372,63 @@ geos_warning_r (int pool_index, const char *fmt, va_list ap)
 
 #include "cache_aux_2.h"
 
+/*
+/ the free slots of the pool are chained into a LIFO list (next_free)
+/ whose head is a 64 bit word: the low 32 bits contain the index of the
+/ first free slot (-1 when the pool is full) and the high 32 bits contain
+/ a counter incremented by every change, thus preventing ABA races
+*/
+static volatile sqlite3_uint64 splite_pool_free_head = 0;
+
+static int
+splite_atomic_cas64 (volatile sqlite3_uint64 * value, sqlite3_uint64 expected,
+		     sqlite3_uint64 desired)
+{
+/* atomic 64 bit compare-and-swap; returns TRUE on success */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return (sqlite3_uint64)
+	InterlockedCompareExchange64 ((volatile LONGLONG *) value,
+				      (LONGLONG) desired,
+				      (LONGLONG) expected) == expected;
+#else
+    return __sync_bool_compare_and_swap (value, expected, desired);
+#endif
+}
+
+static sqlite3_uint64
+splite_pool_head (void)
+{
+/* atomically reading the free list head */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return (sqlite3_uint64)
+	InterlockedCompareExchange64 ((volatile LONGLONG *)
+				      &splite_pool_free_head, 0, 0);
+#else
+    return __sync_val_compare_and_swap (&splite_pool_free_head, 0, 0);
+#endif
+}
+
 static int
 find_free_connection ()
 {
+/* popping the first free slot - lock-free, O(1) */
+    sqlite3_uint64 head;
+    sqlite3_uint64 new_head;
     int i;
-    for (i = 0; i < SPATIALITE_MAX_CONNECTIONS; i++)
+    while (1)
       {
-	  struct splite_connection *p = &(splite_connection_pool[i]);
-	  if (p->conn_ptr == NULL)
+	  head = splite_pool_head ();
+	  i = (int) (unsigned int) (head & 0xffffffff);
+	  if (i < 0 || i >= SPATIALITE_MAX_CONNECTIONS)
+	      return -1;
+	  new_head = (((head >> 32) + 1) << 32) |
+	      (unsigned int) (splite_connection_pool[i].next_free);
+	  if (splite_atomic_cas64 (&splite_pool_free_head, head, new_head))
 	    {
-		p->conn_ptr = GAIA_CONN_RESERVED;
+		splite_connection_pool[i].conn_ptr = GAIA_CONN_RESERVED;
 		return i;
 	    }
       }
-    spatialite_e ("ERROR: Too many connections: max %d\n",
-		  SPATIALITE_MAX_CONNECTIONS);
-    return -1;
 }
 
 static void
@@ -358,9 +442,22 @@ confirm (int i, void *cache)
 static void
 invalidate (int i)
 {
-/* definitely releasing the slot */
-    struct splite_connection *p = &(splite_connection_pool[i]);
+/* definitely releasing the slot - lock-free, O(1) */
+    sqlite3_uint64 head;
+    sqlite3_uint64 new_head;
+    struct splite_connection *p;
+    if (i < 0 || i >= SPATIALITE_MAX_CONNECTIONS)
+	return;
+    p = &(splite_connection_pool[i]);
     p->conn_ptr = NULL;
+    while (1)
+      {
+	  head = splite_pool_head ();
+	  p->next_free = (int) (unsigned int) (head & 0xffffffff);
+	  new_head = (((head >> 32) + 1) << 32) | (unsigned int) i;
+	  if (splite_atomic_cas64 (&splite_pool_free_head, head, new_head))
+	      break;
+      }
 }
 #endif /* END obsolete partially thread-safe mode */
 
@@ -373,6 +470,7 @@ init_splite_internal_cache (struct splite_internal_cache *cache)
     const char *tinyPoint;
     struct splite_geos_cache_item *p;
     struct splite_xmlSchema_cache_item *p_xmlSchema;
+    struct splite_sqlproc_cache_item *p_sqlProc;
     if (cache == NULL)
 	return;
 
@@ -398,6 +496,20 @@ init_splite_internal_cache (struct splite_internal_cache *cache)
     cache->SqlProcLog = NULL;
     cache->SqlProcContinue = 1;
     cache->SqlProcRetValue = gaia_alloc_variant ();
+    for (i = 0; i < MAX_SQLPROC_CACHE; i++)
+      {
+	  /* initializing the SQL Procedures cache */
+	  p_sqlProc = &(cache->sqlProcCache[i]);
+	  p_sqlProc->last_access = 0;
+	  p_sqlProc->blob = NULL;
+	  p_sqlProc->blob_sz = 0;
+	  p_sqlProc->compiled = NULL;
+	  p_sqlProc->executions = 0;
+	  p_sqlProc->n_stats = 0;
+	  p_sqlProc->stats = NULL;
+      }
+    cache->sqlProcCacheClock = 0;
+    cache->sqlProcCacheActive = -1;
     cache->pool_index = -1;
     cache->gaia_proj_error_msg = NULL;
     cache->gaia_geos_error_msg = NULL;
@@ -480,37 +592,54 @@ spatialite_alloc_reentrant ()
 /* 
  * allocating and initializing an empty internal cache 
  * fully reentrant (thread-safe) version requiring GEOS >= 3.5.0
+ *
+ * the GEOS, PROJ and RTTOPO contexts will be created later,
+ * on first usage (see splite_get_geos_handle() and alike)
 */
     struct splite_internal_cache *cache = NULL;
-#ifdef PROJ_NEW			/* supporting new PROJ.6 */
-    int proj_set_ext_var = 0;
-    char *proj_db = NULL;
-    const char *proj_db_path = NULL;
-#ifdef _WIN32
-    char *win_prefix = NULL;
-#endif
-#endif
 
 /* attempting to implicitly initialize the library */
     spatialite_initialize ();
 
     cache = malloc (sizeof (struct splite_internal_cache));
     if (cache == NULL)
-	goto done;
+	return NULL;
     init_splite_internal_cache (cache);
-
-/* initializing GEOS and PROJ.4 handles */
+    splite_pool_acquired ();
+    return cache;
+}
+#endif /* end GEOS_REENTRANT */
 
 #ifndef OMIT_GEOS		/* initializing GEOS */
+static void
+create_geos_handle (struct splite_internal_cache *cache)
+{
+/* creating the per-connection GEOS context */
+#ifdef GEOS_REENTRANT		/* reentrant (thread-safe) initialization */
     cache->GEOS_handle = GEOS_init_r ();
     GEOSContext_setNoticeMessageHandler_r (cache->GEOS_handle,
 					   conn_geos_warning, cache);
     GEOSContext_setErrorMessageHandler_r (cache->GEOS_handle, conn_geos_error,
 					  cache);
+#else /* end GEOS_REENTRANT */
+    cache->GEOS_handle = initGEOS_r (cache->geos_warning, cache->geos_error);
+#endif
+}
 #endif /* end GEOS  */
 
 #ifndef OMIT_PROJ		/* initializing the PROJ.4 context */
+static void
+create_proj_handle (struct splite_internal_cache *cache)
+{
+/* creating the per-connection PROJ context */
 #ifdef PROJ_NEW			/* supporting new PROJ.6 */
+    int proj_set_ext_var = 0;
+    char *proj_db = NULL;
+    const char *proj_db_path = NULL;
+#ifdef _WIN32
+    char *win_prefix = NULL;
+#endif
+
     cache->PROJ_handle = proj_context_create ();
     proj_log_func (cache->PROJ_handle, cache, gaia_proj_log_funct);	/* installing an error handler routine */
     if (getenv ("PROJ_LIB") != NULL)
@@ -607,18 +736,64 @@ spatialite_alloc_reentrant ()
 #else /* supporting old PROJ.4 */
     cache->PROJ_handle = pj_ctx_alloc ();
 #endif
+}
 #endif /* end PROJ.4  */
 
 #ifdef ENABLE_RTTOPO		/* initializing the RTTOPO context */
+static void
+create_rttopo_handle (struct splite_internal_cache *cache)
+{
+/* creating the per-connection RTTOPO context */
     cache->RTTOPO_handle = rtgeom_init (NULL, NULL, NULL);
     rtgeom_set_error_logger (cache->RTTOPO_handle, conn_rttopo_error, cache);
     rtgeom_set_notice_logger (cache->RTTOPO_handle, conn_rttopo_warning, cache);
+}
 #endif /* end RTTOPO */
 
-  done:
-    return cache;
+SPATIALITE_PRIVATE void *
+splite_get_geos_handle (const void *p_cache)
+{
+/* returning the GEOS context - lazily created on first usage */
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return NULL;
+#ifndef OMIT_GEOS
+    if (cache->GEOS_handle == NULL)
+	create_geos_handle (cache);
+#endif
+    return cache->GEOS_handle;
+}
+
+SPATIALITE_PRIVATE void *
+splite_get_proj_handle (const void *p_cache)
+{
+/* returning the PROJ context - lazily created on first usage */
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return NULL;
+#ifndef OMIT_PROJ
+    if (cache->PROJ_handle == NULL)
+	create_proj_handle (cache);
+#endif
+    return cache->PROJ_handle;
+}
+
+SPATIALITE_PRIVATE void *
+splite_get_rttopo_handle (const void *p_cache)
+{
+/* returning the RTTOPO context - lazily created on first usage */
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    if (cache == NULL)
+	return NULL;
+#ifdef ENABLE_RTTOPO
+    if (cache->RTTOPO_handle == NULL)
+	create_rttopo_handle (cache);
+#endif
+    return cache->RTTOPO_handle;
 }
-#endif /* end GEOS_REENTRANT */
 
 SPATIALITE_DECLARE void *
 spatialite_alloc_connection ()
@@ -634,39 +809,33 @@ spatialite_alloc_connection ()
 /* attempting to implicitly initialize the library */
     spatialite_initialize ();
 
-/* locking the semaphore */
-    splite_cache_semaphore_lock ();
+    cache = malloc (sizeof (struct splite_internal_cache));
+    if (cache == NULL)
+	return NULL;
+    init_splite_internal_cache (cache);
+    splite_pool_acquired ();
 
     pool_index = find_free_connection ();
-
     if (pool_index < 0)
-	goto done;
-
-    cache = malloc (sizeof (struct splite_internal_cache));
-    if (cache == NULL)
       {
-	  invalidate (pool_index);
-	  goto done;
+	  /* the pool is full: falling back to the global GEOS handlers */
+	  spatialite_e
+	      ("WARNING: Too many connections (max %d): GEOS messages will not be reported per-connection\n",
+	       SPATIALITE_MAX_CONNECTIONS);
+#ifndef OMIT_GEOS
+	  cache->geos_warning = geos_warning;
+	  cache->geos_error = geos_error;
+#endif
       }
-    init_splite_internal_cache (cache);
-    cache->pool_index = pool_index;
-    confirm (pool_index, cache);
+    else
+      {
+	  cache->pool_index = pool_index;
+	  confirm (pool_index, cache);
 
 #include "cache_aux_3.h"
+      }
 
-/* initializing GEOS and PROJ.4 handles */
-
-#ifndef OMIT_GEOS		/* initializing GEOS */
-    cache->GEOS_handle = initGEOS_r (cache->geos_warning, cache->geos_error);
-#endif /* end GEOS  */
-
-#ifndef OMIT_PROJ		/* initializing the PROJ.4 context */
-    cache->PROJ_handle = pj_ctx_alloc ();
-#endif /* end PROJ.4  */
-
-  done:
-/* unlocking the semaphore */
-    splite_cache_semaphore_unlock ();
+/* GEOS and PROJ.4 handles will be created on first usage */
     return cache;
 #endif
 }
@@ -839,6 +1008,8 @@ free_internal_cache (struct splite_internal_cache *cache)
 {
 /* freeing an internal cache */
     struct splite_geos_cache_item *p;
+    struct splite_sqlproc_cache_item *p_sqlProc;
+    int i_sqlProc;
 #ifndef OMIT_GEOS
     GEOSContextHandle_t handle = NULL;
 #endif
@@ -857,6 +1028,12 @@ free_internal_cache (struct splite_internal_cache *cache)
     if (cache->SqlProcRetValue != NULL)
 	gaia_free_variant (cache->SqlProcRetValue);
     cache->SqlProcRetValue = NULL;
+    for (i_sqlProc = 0; i_sqlProc < MAX_SQLPROC_CACHE; i_sqlProc++)
+      {
+	  /* freeing the SQL Procedures cache */
+	  p_sqlProc = &(cache->sqlProcCache[i_sqlProc]);
+	  free_internal_cache_sqlproc (p_sqlProc);
+      }
 
 #ifndef OMIT_GEOS
     handle = cache->GEOS_handle;
@@ -968,6 +1145,7 @@ free_internal_cache (struct splite_internal_cache *cache)
 /* releasing the connection pool object */
     invalidate (cache->pool_index);
 #endif /* end GEOS_REENTRANT */
+    splite_atomic_add (&splite_pool_used, -1);
 
 /* freeing the cache itself */
     free (cache);
@@ -1328,6 +1506,24 @@ spatialite_shutdown (void)
     gaia_already_initialized = 0;
 }
 
+SPATIALITE_DECLARE void
+spatialite_connection_pool_stats (int *used, int *peak, int *capacity)
+{
+/* reporting the occupancy of the connection pool */
+    if (used != NULL)
+	*used = splite_pool_used;
+    if (peak != NULL)
+	*peak = splite_pool_peak;
+    if (capacity != NULL)
+      {
+#ifdef GEOS_REENTRANT		/* reentrant: no upper limit at all */
+	  *capacity = -1;
+#else
+	  *capacity = SPATIALITE_MAX_CONNECTIONS;
+#endif
+      }
+}
+
 SPATIALITE_DECLARE void
 spatialite_set_silent_mode (const void *p_cache)
 {
@@ -1535,7 +1731,7 @@ gaiaGetCurrentProjContext (const void *p_cache)
       {
 	  if (cache->magic1 == SPATIALITE_CACHE_MAGIC1
 	      && cache->magic2 == SPATIALITE_CACHE_MAGIC2)
-	      return cache->PROJ_handle;
+	      return splite_get_proj_handle (cache);
       }
     return NULL;
 }
@@ -574,578 +574,19912 @@ geos_error_63 (const char *fmt, ...)
     va_end (ap);
 }
 
+static void
+geos_error_64 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (64, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_65 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (65, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_66 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (66, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_67 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (67, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_68 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (68, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_69 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (69, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_70 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (70, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_71 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (71, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_72 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (72, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_73 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (73, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_74 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (74, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_75 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (75, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_76 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (76, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_77 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (77, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_78 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (78, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_79 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (79, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_80 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (80, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_81 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (81, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_82 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (82, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_83 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (83, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_84 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (84, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_85 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (85, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_86 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (86, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_87 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (87, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_88 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (88, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_89 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (89, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_90 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (90, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_91 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (91, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_92 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (92, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_93 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (93, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_94 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (94, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_95 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (95, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_96 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (96, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_97 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (97, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_98 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (98, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_99 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (99, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_100 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (100, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_101 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (101, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_102 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (102, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_103 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (103, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_104 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (104, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_105 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (105, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_106 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (106, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_107 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (107, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_108 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (108, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_109 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (109, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_110 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (110, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_111 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (111, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_112 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (112, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_113 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (113, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_114 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (114, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_115 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (115, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_116 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (116, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_117 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (117, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_118 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (118, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_119 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (119, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_120 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (120, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_121 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (121, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_122 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (122, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_123 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (123, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_124 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (124, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_125 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (125, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_126 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (126, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_127 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (127, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_128 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (128, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_129 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (129, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_130 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (130, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_131 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (131, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_132 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (132, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_133 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (133, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_134 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (134, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_135 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (135, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_136 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (136, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_137 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (137, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_138 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (138, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_139 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (139, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_140 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (140, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_141 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (141, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_142 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (142, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_143 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (143, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_144 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (144, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_145 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (145, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_146 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (146, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_147 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (147, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_148 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (148, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_149 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (149, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_150 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (150, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_151 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (151, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_152 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (152, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_153 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (153, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_154 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (154, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_155 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (155, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_156 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (156, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_157 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (157, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_158 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (158, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_159 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (159, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_160 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (160, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_161 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (161, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_162 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (162, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_163 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (163, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_164 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (164, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_165 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (165, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_166 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (166, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_167 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (167, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_168 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (168, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_169 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (169, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_170 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (170, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_171 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (171, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_172 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (172, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_173 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (173, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_174 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (174, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_175 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (175, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_176 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (176, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_177 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (177, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_178 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (178, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_179 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (179, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_180 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (180, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_181 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (181, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_182 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (182, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_183 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (183, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_184 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (184, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_185 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (185, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_186 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (186, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_187 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (187, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_188 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (188, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_189 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (189, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_190 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (190, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_191 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (191, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_192 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (192, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_193 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (193, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_194 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (194, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_195 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (195, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_196 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (196, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_197 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (197, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_198 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (198, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_199 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (199, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_200 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (200, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_201 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (201, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_202 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (202, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_203 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (203, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_204 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (204, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_205 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (205, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_206 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (206, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_207 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (207, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_208 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (208, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_209 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (209, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_210 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (210, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_211 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (211, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_212 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (212, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_213 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (213, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_214 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (214, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_215 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (215, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_216 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (216, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_217 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (217, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_218 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (218, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_219 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (219, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_220 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (220, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_221 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (221, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_222 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (222, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_223 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (223, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_224 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (224, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_225 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (225, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_226 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (226, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_227 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (227, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_228 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (228, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_229 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (229, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_230 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (230, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_231 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (231, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_232 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (232, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_233 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (233, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_234 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (234, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_235 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (235, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_236 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (236, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_237 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (237, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_238 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (238, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_239 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (239, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_240 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (240, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_241 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (241, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_242 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (242, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_243 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (243, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_244 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (244, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_245 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (245, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_246 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (246, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_247 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (247, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_248 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (248, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_249 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (249, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_250 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (250, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_251 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (251, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_252 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (252, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_253 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (253, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_254 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (254, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_255 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (255, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_256 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (256, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_257 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (257, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_258 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (258, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_259 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (259, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_260 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (260, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_261 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (261, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_262 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (262, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_263 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (263, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_264 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (264, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_265 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (265, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_266 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (266, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_267 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (267, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_268 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (268, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_269 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (269, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_270 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (270, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_271 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (271, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_272 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (272, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_273 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (273, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_274 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (274, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_275 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (275, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_276 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (276, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_277 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (277, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_278 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (278, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_279 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (279, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_280 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (280, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_281 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (281, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_282 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (282, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_283 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (283, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_284 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (284, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_285 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (285, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_286 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (286, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_287 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (287, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_288 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (288, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_289 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (289, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_290 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (290, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_291 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (291, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_292 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (292, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_293 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (293, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_294 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (294, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_295 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (295, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_296 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (296, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_297 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (297, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_298 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (298, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_299 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (299, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_300 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (300, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_301 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (301, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_302 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (302, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_303 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (303, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_304 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (304, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_305 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (305, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_306 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (306, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_307 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (307, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_308 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (308, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_309 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (309, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_310 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (310, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_311 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (311, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_312 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (312, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_313 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (313, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_314 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (314, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_315 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (315, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_316 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (316, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_317 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (317, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_318 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (318, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_319 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (319, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_320 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (320, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_321 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (321, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_322 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (322, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_323 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (323, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_324 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (324, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_325 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (325, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_326 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (326, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_327 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (327, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_328 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (328, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_329 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (329, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_330 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (330, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_331 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (331, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_332 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (332, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_333 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (333, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_334 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (334, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_335 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (335, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_336 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (336, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_337 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (337, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_338 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (338, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_339 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (339, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_340 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (340, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_341 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (341, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_342 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (342, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_343 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (343, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_344 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (344, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_345 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (345, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_346 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (346, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_347 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (347, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_348 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (348, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_349 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (349, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_350 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (350, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_351 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (351, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_352 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (352, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_353 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (353, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_354 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (354, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_355 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (355, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_356 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (356, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_357 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (357, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_358 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (358, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_359 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (359, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_360 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (360, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_361 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (361, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_362 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (362, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_363 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (363, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_364 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (364, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_365 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (365, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_366 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (366, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_367 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (367, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_368 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (368, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_369 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (369, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_370 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (370, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_371 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (371, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_372 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (372, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_373 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (373, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_374 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (374, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_375 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (375, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_376 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (376, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_377 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (377, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_378 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (378, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_379 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (379, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_380 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (380, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_381 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (381, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_382 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (382, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_383 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (383, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_384 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (384, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_385 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (385, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_386 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (386, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_387 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (387, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_388 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (388, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_389 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (389, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_390 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (390, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_391 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (391, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_392 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (392, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_393 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (393, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_394 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (394, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_395 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (395, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_396 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (396, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_397 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (397, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_398 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (398, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_399 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (399, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_400 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (400, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_401 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (401, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_402 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (402, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_403 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (403, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_404 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (404, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_405 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (405, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_406 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (406, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_407 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (407, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_408 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (408, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_409 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (409, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_410 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (410, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_411 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (411, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_412 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (412, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_413 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (413, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_414 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (414, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_415 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (415, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_416 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (416, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_417 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (417, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_418 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (418, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_419 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (419, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_420 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (420, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_421 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (421, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_422 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (422, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_423 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (423, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_424 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (424, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_425 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (425, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_426 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (426, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_427 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (427, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_428 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (428, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_429 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (429, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_430 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (430, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_431 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (431, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_432 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (432, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_433 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (433, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_434 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (434, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_435 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (435, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_436 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (436, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_437 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (437, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_438 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (438, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_439 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (439, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_440 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (440, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_441 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (441, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_442 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (442, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_443 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (443, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_444 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (444, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_445 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (445, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_446 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (446, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_447 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (447, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_448 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (448, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_449 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (449, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_450 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (450, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_451 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (451, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_452 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (452, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_453 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (453, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_454 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (454, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_455 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (455, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_456 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (456, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_457 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (457, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_458 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (458, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_459 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (459, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_460 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (460, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_461 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (461, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_462 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (462, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_463 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (463, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_464 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (464, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_465 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (465, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_466 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (466, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_467 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (467, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_468 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (468, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_469 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (469, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_470 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (470, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_471 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (471, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_472 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (472, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_473 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (473, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_474 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (474, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_475 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (475, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_476 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (476, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_477 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (477, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_478 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (478, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_479 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (479, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_480 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (480, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_481 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (481, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_482 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (482, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_483 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (483, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_484 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (484, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_485 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (485, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_486 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (486, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_487 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (487, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_488 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (488, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_489 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (489, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_490 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (490, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_491 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (491, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_492 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (492, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_493 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (493, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_494 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (494, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_495 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (495, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_496 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (496, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_497 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (497, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_498 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (498, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_499 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (499, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_500 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (500, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_501 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (501, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_502 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (502, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_503 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (503, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_504 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (504, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_505 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (505, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_506 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (506, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_507 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (507, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_508 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (508, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_509 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (509, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_510 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (510, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_511 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (511, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_512 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (512, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_513 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (513, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_514 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (514, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_515 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (515, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_516 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (516, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_517 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (517, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_518 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (518, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_519 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (519, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_520 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (520, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_521 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (521, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_522 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (522, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_523 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (523, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_524 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (524, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_525 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (525, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_526 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (526, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_527 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (527, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_528 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (528, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_529 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (529, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_530 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (530, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_531 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (531, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_532 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (532, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_533 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (533, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_534 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (534, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_535 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (535, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_536 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (536, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_537 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (537, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_538 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (538, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_539 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (539, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_540 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (540, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_541 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (541, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_542 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (542, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_543 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (543, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_544 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (544, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_545 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (545, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_546 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (546, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_547 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (547, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_548 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (548, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_549 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (549, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_550 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (550, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_551 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (551, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_552 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (552, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_553 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (553, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_554 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (554, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_555 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (555, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_556 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (556, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_557 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (557, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_558 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (558, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_559 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (559, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_560 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (560, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_561 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (561, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_562 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (562, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_563 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (563, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_564 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (564, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_565 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (565, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_566 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (566, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_567 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (567, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_568 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (568, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_569 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (569, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_570 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (570, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_571 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (571, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_572 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (572, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_573 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (573, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_574 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (574, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_575 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (575, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_576 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (576, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_577 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (577, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_578 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (578, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_579 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (579, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_580 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (580, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_581 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (581, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_582 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (582, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_583 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (583, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_584 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (584, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_585 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (585, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_586 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (586, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_587 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (587, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_588 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (588, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_589 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (589, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_590 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (590, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_591 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (591, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_592 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (592, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_593 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (593, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_594 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (594, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_595 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (595, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_596 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (596, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_597 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (597, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_598 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (598, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_599 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (599, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_600 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (600, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_601 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (601, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_602 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (602, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_603 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (603, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_604 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (604, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_605 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (605, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_606 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (606, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_607 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (607, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_608 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (608, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_609 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (609, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_610 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (610, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_611 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (611, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_612 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (612, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_613 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (613, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_614 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (614, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_615 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (615, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_616 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (616, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_617 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (617, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_618 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (618, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_619 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (619, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_620 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (620, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_621 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (621, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_622 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (622, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_623 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (623, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_624 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (624, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_625 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (625, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_626 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (626, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_627 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (627, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_628 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (628, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_629 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (629, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_630 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (630, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_631 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (631, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_632 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (632, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_633 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (633, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_634 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (634, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_635 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (635, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_636 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (636, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_637 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (637, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_638 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (638, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_639 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (639, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_640 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (640, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_641 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (641, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_642 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (642, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_643 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (643, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_644 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (644, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_645 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (645, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_646 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (646, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_647 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (647, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_648 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (648, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_649 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (649, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_650 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (650, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_651 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (651, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_652 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (652, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_653 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (653, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_654 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (654, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_655 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (655, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_656 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (656, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_657 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (657, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_658 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (658, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_659 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (659, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_660 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (660, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_661 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (661, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_662 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (662, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_663 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (663, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_664 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (664, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_665 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (665, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_666 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (666, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_667 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (667, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_668 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (668, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_669 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (669, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_670 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (670, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_671 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (671, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_672 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (672, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_673 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (673, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_674 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (674, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_675 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (675, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_676 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (676, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_677 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (677, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_678 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (678, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_679 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (679, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_680 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (680, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_681 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (681, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_682 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (682, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_683 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (683, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_684 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (684, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_685 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (685, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_686 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (686, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_687 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (687, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_688 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (688, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_689 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (689, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_690 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (690, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_691 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (691, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_692 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (692, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_693 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (693, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_694 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (694, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_695 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (695, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_696 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (696, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_697 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (697, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_698 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (698, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_699 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (699, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_700 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (700, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_701 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (701, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_702 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (702, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_703 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (703, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_704 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (704, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_705 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (705, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_706 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (706, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_707 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (707, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_708 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (708, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_709 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (709, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_710 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (710, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_711 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (711, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_712 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (712, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_713 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (713, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_714 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (714, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_715 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (715, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_716 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (716, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_717 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (717, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_718 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (718, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_719 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (719, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_720 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (720, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_721 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (721, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_722 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (722, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_723 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (723, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_724 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (724, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_725 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (725, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_726 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (726, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_727 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (727, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_728 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (728, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_729 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (729, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_730 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (730, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_731 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (731, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_732 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (732, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_733 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (733, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_734 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (734, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_735 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (735, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_736 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (736, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_737 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (737, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_738 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (738, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_739 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (739, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_740 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (740, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_741 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (741, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_742 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (742, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_743 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (743, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_744 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (744, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_745 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (745, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_746 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (746, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_747 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (747, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_748 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (748, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_749 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (749, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_750 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (750, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_751 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (751, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_752 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (752, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_753 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (753, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_754 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (754, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_755 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (755, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_756 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (756, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_757 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (757, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_758 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (758, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_759 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (759, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_760 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (760, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_761 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (761, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_762 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (762, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_763 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (763, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_764 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (764, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_765 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (765, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_766 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (766, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_767 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (767, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_768 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (768, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_769 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (769, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_770 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (770, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_771 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (771, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_772 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (772, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_773 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (773, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_774 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (774, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_775 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (775, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_776 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (776, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_777 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (777, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_778 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (778, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_779 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (779, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_780 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (780, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_781 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (781, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_782 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (782, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_783 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (783, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_784 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (784, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_785 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (785, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_786 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (786, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_787 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (787, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_788 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (788, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_789 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (789, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_790 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (790, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_791 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (791, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_792 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (792, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_793 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (793, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_794 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (794, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_795 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (795, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_796 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (796, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_797 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (797, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_798 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (798, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_799 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (799, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_800 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (800, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_801 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (801, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_802 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (802, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_803 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (803, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_804 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (804, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_805 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (805, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_806 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (806, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_807 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (807, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_808 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (808, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_809 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (809, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_810 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (810, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_811 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (811, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_812 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (812, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_813 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (813, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_814 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (814, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_815 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (815, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_816 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (816, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_817 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (817, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_818 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (818, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_819 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (819, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_820 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (820, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_821 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (821, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_822 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (822, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_823 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (823, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_824 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (824, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_825 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (825, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_826 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (826, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_827 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (827, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_828 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (828, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_829 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (829, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_830 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (830, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_831 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (831, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_832 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (832, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_833 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (833, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_834 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (834, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_835 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (835, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_836 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (836, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_837 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (837, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_838 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (838, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_839 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (839, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_840 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (840, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_841 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (841, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_842 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (842, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_843 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (843, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_844 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (844, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_845 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (845, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_846 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (846, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_847 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (847, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_848 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (848, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_849 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (849, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_850 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (850, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_851 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (851, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_852 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (852, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_853 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (853, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_854 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (854, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_855 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (855, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_856 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (856, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_857 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (857, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_858 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (858, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_859 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (859, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_860 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (860, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_861 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (861, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_862 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (862, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_863 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (863, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_864 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (864, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_865 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (865, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_866 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (866, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_867 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (867, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_868 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (868, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_869 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (869, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_870 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (870, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_871 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (871, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_872 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (872, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_873 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (873, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_874 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (874, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_875 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (875, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_876 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (876, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_877 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (877, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_878 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (878, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_879 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (879, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_880 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (880, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_881 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (881, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_882 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (882, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_883 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (883, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_884 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (884, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_885 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (885, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_886 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (886, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_887 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (887, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_888 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (888, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_889 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (889, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_890 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (890, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_891 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (891, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_892 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (892, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_893 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (893, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_894 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (894, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_895 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (895, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_896 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (896, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_897 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (897, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_898 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (898, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_899 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (899, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_900 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (900, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_901 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (901, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_902 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (902, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_903 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (903, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_904 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (904, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_905 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (905, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_906 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (906, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_907 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (907, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_908 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (908, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_909 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (909, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_910 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (910, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_911 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (911, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_912 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (912, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_913 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (913, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_914 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (914, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_915 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (915, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_916 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (916, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_917 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (917, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_918 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (918, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_919 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (919, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_920 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (920, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_921 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (921, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_922 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (922, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_923 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (923, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_924 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (924, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_925 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (925, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_926 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (926, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_927 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (927, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_928 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (928, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_929 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (929, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_930 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (930, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_931 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (931, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_932 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (932, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_933 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (933, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_934 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (934, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_935 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (935, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_936 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (936, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_937 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (937, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_938 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (938, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_939 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (939, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_940 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (940, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_941 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (941, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_942 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (942, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_943 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (943, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_944 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (944, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_945 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (945, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_946 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (946, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_947 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (947, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_948 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (948, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_949 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (949, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_950 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (950, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_951 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (951, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_952 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (952, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_953 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (953, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_954 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (954, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_955 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (955, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_956 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (956, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_957 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (957, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_958 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (958, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_959 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (959, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_960 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (960, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_961 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (961, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_962 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (962, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_963 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (963, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_964 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (964, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_965 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (965, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_966 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (966, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_967 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (967, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_968 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (968, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_969 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (969, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_970 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (970, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_971 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (971, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_972 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (972, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_973 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (973, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_974 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (974, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_975 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (975, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_976 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (976, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_977 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (977, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_978 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (978, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_979 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (979, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_980 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (980, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_981 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (981, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_982 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (982, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_983 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (983, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_984 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (984, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_985 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (985, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_986 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (986, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_987 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (987, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_988 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (988, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_989 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (989, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_990 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (990, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_991 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (991, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_992 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (992, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_993 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (993, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_994 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (994, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_995 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (995, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_996 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (996, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_997 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (997, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_998 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (998, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_999 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (999, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1000 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1000, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1001 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1001, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1002 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1002, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1003 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1003, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1004 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1004, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1005 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1005, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1006 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1006, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1007 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1007, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1008 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1008, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1009 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1009, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1010 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1010, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1011 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1011, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1012 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1012, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1013 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1013, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1014 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1014, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1015 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1015, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1016 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1016, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1017 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1017, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1018 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1018, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1019 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1019, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1020 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1020, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1021 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1021, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1022 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1022, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_error_1023 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_error_r (1023, fmt, ap);
+    va_end (ap);
+}
+
 static void
 geos_warning_0 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (0, fmt, ap);
+    geos_warning_r (0, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_2 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (2, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_3 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (3, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_4 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (4, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_5 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (5, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_6 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (6, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_7 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (7, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_8 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (8, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_9 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (9, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_10 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (10, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_11 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (11, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_12 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (12, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_13 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (13, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_14 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (14, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_15 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (15, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_16 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (16, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_17 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (17, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_18 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (18, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_19 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (19, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_20 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (20, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_21 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (21, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_22 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (22, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_23 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (23, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_24 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (24, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_25 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (25, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_26 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (26, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_27 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (27, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_28 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (28, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_29 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (29, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_30 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (30, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_31 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (31, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_32 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (32, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_33 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (33, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_34 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (34, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_35 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (35, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_36 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (36, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_37 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (37, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_38 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (38, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_39 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (39, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_40 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (40, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_41 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (41, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_42 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (42, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_43 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (43, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_44 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (44, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_45 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (45, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_46 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (46, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_47 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (47, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_48 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (48, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_49 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (49, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_50 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (50, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_51 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (51, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_52 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (52, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_53 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (53, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_54 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (54, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_55 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (55, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_56 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (56, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_57 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (57, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_58 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (58, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_59 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (59, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_60 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (60, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_61 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (61, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_62 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (62, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_63 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (63, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_64 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (64, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_65 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (65, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_66 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (66, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_67 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (67, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_68 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (68, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_69 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (69, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_70 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (70, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_71 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (71, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_72 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (72, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_73 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (73, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_74 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (74, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_75 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (75, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_76 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (76, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_77 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (77, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_78 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (78, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_79 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (79, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_80 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (80, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_81 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (81, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_82 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (82, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_83 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (83, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_84 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (84, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_85 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (85, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_86 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (86, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_87 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (87, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_88 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (88, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_89 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (89, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_90 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (90, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_91 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (91, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_92 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (92, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_93 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (93, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_94 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (94, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_95 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (95, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_96 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (96, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_97 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (97, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_98 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (98, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_99 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (99, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_100 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (100, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_101 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (101, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_102 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (102, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_103 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (103, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_104 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (104, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_105 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (105, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_106 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (106, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_107 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (107, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_108 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (108, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_109 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (109, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_110 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (110, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_111 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (111, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_112 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (112, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_113 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (113, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_114 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (114, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_115 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (115, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_116 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (116, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_117 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (117, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_118 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (118, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_119 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (119, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_120 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (120, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_121 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (121, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_122 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (122, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_123 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (123, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_124 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (124, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_125 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (125, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_126 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (126, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_127 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (127, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_128 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (128, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_129 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (129, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_130 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (130, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_131 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (131, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_132 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (132, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_133 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (133, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_134 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (134, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_135 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (135, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_136 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (136, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_137 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (137, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_138 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (138, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_139 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (139, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_140 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (140, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_141 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (141, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_142 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (142, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_143 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (143, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_144 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (144, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_145 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (145, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_146 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (146, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_147 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (147, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_148 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (148, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_149 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (149, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_150 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (150, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_151 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (151, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_152 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (152, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_153 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (153, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_154 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (154, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_155 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (155, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_156 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (156, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_157 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (157, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_158 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (158, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_159 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (159, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_160 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (160, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_161 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (161, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_162 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (162, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_163 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (163, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_164 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (164, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_165 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (165, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_166 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (166, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_167 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (167, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_168 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (168, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_169 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (169, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_170 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (170, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_171 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (171, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_172 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (172, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_173 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (173, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_174 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (174, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_175 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (175, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_176 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (176, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_177 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (177, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_178 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (178, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_179 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (179, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_180 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (180, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_181 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (181, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_182 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (182, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_183 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (183, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_184 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (184, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_185 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (185, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_186 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (186, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_187 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (187, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_188 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (188, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_189 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (189, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_190 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (190, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_191 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (191, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_192 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (192, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_193 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (193, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_194 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (194, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_195 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (195, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_196 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (196, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_197 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (197, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_198 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (198, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_199 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (199, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_200 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (200, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_201 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (201, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_202 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (202, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_203 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (203, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_204 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (204, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_205 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (205, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_206 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (206, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_207 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (207, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_208 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (208, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_209 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (209, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_210 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (210, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_211 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (211, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_212 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (212, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_213 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (213, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_214 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (214, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_215 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (215, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_216 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (216, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_217 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (217, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_218 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (218, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_219 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (219, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_220 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (220, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_221 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (221, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_222 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (222, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_223 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (223, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_224 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (224, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_225 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (225, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_226 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (226, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_227 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (227, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_228 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (228, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_229 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (229, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_230 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (230, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_231 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (231, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_232 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (232, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_233 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (233, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_234 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (234, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_235 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (235, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_236 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (236, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_237 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (237, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_238 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (238, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_239 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (239, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_240 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (240, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_241 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (241, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_242 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (242, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_243 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (243, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_244 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (244, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_245 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (245, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_246 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (246, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_247 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (247, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_248 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (248, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_249 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (249, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_250 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (250, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_251 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (251, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_252 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (252, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_253 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (253, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_254 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (254, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_255 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (255, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_256 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (256, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_257 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (257, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_258 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (258, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_259 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (259, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_260 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (260, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_261 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (261, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_262 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (262, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_263 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (263, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_264 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (264, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_265 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (265, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_266 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (266, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_267 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (267, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_268 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (268, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_269 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (269, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_270 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (270, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_271 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (271, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_272 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (272, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_273 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (273, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_274 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (274, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_275 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (275, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_276 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (276, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_277 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (277, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_278 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (278, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_279 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (279, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_280 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (280, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_281 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (281, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_282 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (282, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_283 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (283, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_284 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (284, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_285 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (285, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_286 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (286, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_287 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (287, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_288 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (288, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_289 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (289, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_290 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (290, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_291 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (291, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_292 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (292, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_293 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (293, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_294 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (294, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_295 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (295, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_296 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (296, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_297 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (297, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_298 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (298, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_299 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (299, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_300 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (300, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_301 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (301, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_302 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (302, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_303 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (303, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_304 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (304, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_305 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (305, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_306 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (306, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_307 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (307, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_308 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (308, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_309 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (309, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_310 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (310, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_311 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (311, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_312 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (312, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_313 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (313, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_314 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (314, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_315 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (315, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_316 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (316, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_317 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (317, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_318 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (318, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_319 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (319, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_320 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (320, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_321 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (321, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_322 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (322, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_323 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (323, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_324 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (324, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_325 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (325, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_326 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (326, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_327 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (327, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_328 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (328, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_329 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (329, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_330 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (330, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_331 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (331, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_332 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (332, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_333 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (333, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_334 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (334, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_335 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (335, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_336 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (336, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_337 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (337, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_338 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (338, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_339 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (339, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_340 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (340, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_341 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (341, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_342 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (342, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_343 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (343, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_344 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (344, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_345 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (345, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_346 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (346, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_347 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (347, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_348 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (348, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_349 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (349, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_350 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (350, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_351 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (351, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_352 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (352, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_353 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (353, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_354 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (354, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_355 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (355, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_356 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (356, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_357 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (357, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_358 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (358, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_359 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (359, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_360 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (360, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_361 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (361, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_362 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (362, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_363 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (363, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_364 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (364, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_365 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (365, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_366 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (366, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_367 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (367, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_368 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (368, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_369 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (369, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_370 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (370, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_371 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (371, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_372 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (372, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_373 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (373, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_374 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (374, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_375 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (375, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_376 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (376, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_377 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (377, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_378 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (378, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_379 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (379, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_380 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (380, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_381 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (381, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_382 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (382, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_383 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (383, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_384 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (384, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_385 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (385, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_386 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (386, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_387 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (387, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_388 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (388, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_389 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (389, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_390 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (390, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_391 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (391, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_392 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (392, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_393 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (393, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_394 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (394, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_395 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (395, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_396 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (396, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_397 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (397, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_398 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (398, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_399 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (399, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_400 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (400, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_401 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (401, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_402 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (402, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_403 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (403, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_404 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (404, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_405 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (405, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_406 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (406, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_407 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (407, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_408 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (408, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_409 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (409, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_410 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (410, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_411 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (411, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_412 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (412, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_413 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (413, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_414 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (414, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_415 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (415, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_416 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (416, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_417 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (417, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_418 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (418, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_419 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (419, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_420 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (420, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_421 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (421, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_422 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (422, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_423 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (423, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_424 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (424, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_425 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (425, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_426 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (426, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_427 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (427, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_428 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (428, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_429 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (429, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_430 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (430, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_431 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (431, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_432 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (432, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_433 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (433, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_434 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (434, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_435 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (435, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_436 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (436, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_437 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (437, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_438 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (438, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_439 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (439, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_440 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (440, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_441 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (441, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_442 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (442, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_443 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (443, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_444 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (444, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_445 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (445, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_446 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (446, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_447 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (447, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_448 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (448, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_449 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (449, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_450 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (450, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_451 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (451, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_452 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (452, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_453 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (453, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_454 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (454, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_455 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (455, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_456 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (456, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_457 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (457, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_458 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (458, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_459 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (459, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_460 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (460, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_461 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (461, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_462 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (462, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_463 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (463, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_464 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (464, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_465 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (465, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_466 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (466, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_467 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (467, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_468 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (468, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_469 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (469, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_470 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (470, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_471 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (471, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_472 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (472, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_473 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (473, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_474 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (474, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_475 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (475, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_476 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (476, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_477 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (477, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_478 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (478, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_479 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (479, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_480 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (480, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_481 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (481, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_482 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (482, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_483 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (483, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_484 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (484, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_485 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (485, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_486 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (486, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_487 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (487, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_488 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (488, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_489 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (489, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_490 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (490, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_491 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (491, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_492 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (492, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_493 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (493, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_494 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (494, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_495 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (495, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_496 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (496, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_497 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (497, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_498 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (498, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_499 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (499, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_500 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (500, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_501 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (501, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_502 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (502, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_503 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (503, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_504 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (504, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_505 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (505, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_506 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (506, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_507 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (507, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_508 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (508, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_509 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (509, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_510 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (510, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_511 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (511, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_512 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (512, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_513 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (513, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_514 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (514, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_515 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (515, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_516 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (516, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_517 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (517, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_518 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (518, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_519 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (519, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_520 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (520, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_521 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (521, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_522 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (522, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_523 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (523, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_524 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (524, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_525 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (525, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_526 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (526, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_527 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (527, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_528 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (528, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_529 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (529, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_530 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (530, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_531 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (531, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_532 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (532, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_533 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (533, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_534 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (534, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_535 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (535, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_536 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (536, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_537 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (537, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_538 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (538, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_539 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (539, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_540 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (540, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_541 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (541, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_542 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (542, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_543 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (543, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_544 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (544, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_545 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (545, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_546 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (546, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_547 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (547, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_548 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (548, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_549 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (549, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_550 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (550, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_551 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (551, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_552 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (552, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_553 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (553, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_554 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (554, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_555 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (555, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_556 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (556, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_557 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (557, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_558 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (558, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_559 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (559, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_560 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (560, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_561 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (561, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_562 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (562, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_563 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (563, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_564 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (564, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_565 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (565, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_566 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (566, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_567 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (567, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_568 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (568, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_569 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (569, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_570 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (570, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_571 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (571, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_572 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (572, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_573 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (573, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_574 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (574, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_575 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (575, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_576 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (576, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_577 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (577, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_578 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (578, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_579 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (579, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_580 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (580, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_581 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (581, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_582 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (582, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_583 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (583, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_584 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (584, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_585 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (585, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_586 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (586, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_587 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (587, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_588 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (588, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_589 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (589, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_590 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (590, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_591 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (591, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_592 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (592, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_593 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (593, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_594 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (594, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_595 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (595, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_596 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (596, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_597 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (597, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_598 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (598, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_599 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (599, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_600 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (600, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_601 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (601, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_602 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (602, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_603 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (603, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_604 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (604, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_605 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (605, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_606 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (606, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_607 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (607, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_608 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (608, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_609 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (609, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_610 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (610, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_611 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (611, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_612 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (612, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_613 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (613, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_614 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (614, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_615 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (615, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_616 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (616, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_617 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (617, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_618 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (618, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_619 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (619, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_620 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (620, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_621 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (621, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_622 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (622, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_623 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (623, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_624 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (624, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_625 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (625, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_626 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (626, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_627 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (627, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_628 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (628, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_629 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (629, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_630 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (630, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_631 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (631, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_632 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (632, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_633 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (633, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_634 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (634, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_635 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (635, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_636 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (636, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_637 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (637, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_638 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (638, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_639 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (639, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_640 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (640, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_641 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (641, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_642 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (642, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_643 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (643, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_644 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (644, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_645 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (645, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_646 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (646, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_647 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (647, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_648 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (648, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_649 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (649, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_650 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (650, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_651 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (651, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_652 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (652, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_653 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (653, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_654 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (654, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_655 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (655, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_656 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (656, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_657 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (657, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_658 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (658, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_659 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (659, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_660 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (660, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_661 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (661, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_662 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (662, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_663 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (663, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_664 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (664, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_665 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (665, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_666 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (666, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_667 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (667, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_668 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (668, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_669 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (669, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_670 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (670, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_671 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (671, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_672 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (672, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_673 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (673, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_674 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (674, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_675 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (675, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_676 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (676, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_677 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (677, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_678 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (678, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_679 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (679, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_680 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (680, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_681 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (681, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_682 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (682, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_683 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (683, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_684 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (684, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_685 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (685, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_686 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (686, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_687 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (687, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_688 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (688, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_689 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (689, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_690 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (690, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_691 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (691, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_692 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (692, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_693 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (693, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_694 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (694, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_695 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (695, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_696 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (696, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_697 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (697, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_698 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (698, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_699 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (699, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_700 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (700, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_701 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (701, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_702 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (702, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_703 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (703, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_704 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (704, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_705 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (705, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_706 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (706, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_707 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (707, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_708 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (708, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_709 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (709, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_710 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (710, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_711 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (711, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_712 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (712, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_713 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (713, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_714 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (714, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_715 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (715, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_716 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (716, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_717 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (717, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_718 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (718, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_719 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (719, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_720 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (720, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_721 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (721, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_722 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (722, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_723 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (723, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_724 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (724, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_725 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (725, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_726 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (726, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_727 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (727, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_728 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (728, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_729 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (729, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_730 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (730, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_731 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (731, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_732 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (732, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_733 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (733, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_734 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (734, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_735 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (735, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_736 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (736, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_737 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (737, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_738 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (738, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_739 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (739, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_740 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (740, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_741 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (741, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_742 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (742, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_743 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (743, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_744 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (744, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_745 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (745, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_746 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (746, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_747 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (747, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_748 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (748, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_749 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (749, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_750 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (750, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_751 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (751, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_752 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (752, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_753 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (753, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_754 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (754, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_755 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (755, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_756 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (756, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_757 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (757, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_758 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (758, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_759 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (759, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_760 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (760, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_761 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (761, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_762 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (762, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_763 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (763, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_764 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (764, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_765 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (765, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_766 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (766, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_767 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (767, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_768 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (768, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_769 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (769, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_770 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (770, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_771 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (771, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_772 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (772, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_773 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (773, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_774 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (774, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_775 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (775, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_776 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (776, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_777 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (777, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_778 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (778, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_779 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (779, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_780 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (780, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_781 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (781, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_782 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (782, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_783 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (783, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_784 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (784, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_785 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (785, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_786 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (786, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_787 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (787, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_788 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (788, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_789 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (789, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_790 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (790, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_791 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (791, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_792 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (792, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_793 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (793, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_794 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (794, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_795 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (795, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_796 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (796, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_797 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (797, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_798 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (798, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_799 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (799, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_800 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (800, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_801 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (801, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_802 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (802, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_803 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (803, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_804 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (804, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_805 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (805, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_806 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (806, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_807 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (807, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_808 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (808, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_809 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (809, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_810 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (810, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_811 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (811, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_812 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (812, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_813 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (813, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_814 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (814, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_815 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (815, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_816 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (816, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_817 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (817, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_818 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (818, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_819 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (819, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_820 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (820, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_821 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (821, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_822 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (822, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_823 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (823, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_824 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (824, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_825 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (825, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_826 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (826, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_827 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (827, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_828 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (828, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_829 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (829, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_830 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (830, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_831 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (831, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_832 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (832, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_833 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (833, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_834 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (834, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_835 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (835, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_836 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (836, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_837 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (837, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_838 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (838, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_839 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (839, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_840 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (840, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_841 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (841, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_842 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (842, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_843 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (843, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_844 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (844, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_845 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (845, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_846 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (846, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_847 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (847, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_848 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (848, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_849 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (849, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_850 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (850, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_851 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (851, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_852 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (852, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_853 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (853, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_854 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (854, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_855 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (855, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_856 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (856, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_857 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (857, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_858 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (858, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_859 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (859, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_860 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (860, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_861 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (861, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_862 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (862, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_863 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (863, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_864 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (864, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_865 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (865, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_866 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (866, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_867 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (867, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_868 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (868, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_869 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (869, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_870 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (870, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_871 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (871, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_872 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (872, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_873 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (873, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_874 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (874, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_875 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (875, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_876 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (876, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_877 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (877, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_878 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (878, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_879 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (879, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_880 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (880, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_881 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (881, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_882 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (882, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_883 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (883, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_884 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (884, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_885 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (885, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_886 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (886, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_887 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (887, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_888 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (888, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_889 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (889, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_890 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (890, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_891 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (891, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_892 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (892, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_893 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (893, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_894 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (894, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_895 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (895, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_896 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (896, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_897 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (897, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_898 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (898, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_899 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (899, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_900 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (900, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_901 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (901, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_902 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (902, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_903 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (903, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_904 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (904, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_905 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (905, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_906 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (906, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_907 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (907, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_908 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (908, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_909 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (909, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_910 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (910, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_911 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (911, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_912 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (912, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_913 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (913, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_914 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (914, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_915 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (915, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_916 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (916, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_917 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (917, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_918 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (918, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_919 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (919, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_920 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (920, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_921 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (921, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_922 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (922, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_923 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (923, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_924 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (924, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_925 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (925, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_926 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (926, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_927 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (927, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_928 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (928, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_929 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (929, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_930 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (930, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_931 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (931, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_932 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (932, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_933 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (933, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_934 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (934, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_935 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (935, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_936 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (936, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_937 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (937, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_938 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (938, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_939 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (939, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_940 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (940, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_941 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (941, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_942 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (942, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_1 (const char *fmt, ...)
+geos_warning_943 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (1, fmt, ap);
+    geos_warning_r (943, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_2 (const char *fmt, ...)
+geos_warning_944 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (2, fmt, ap);
+    geos_warning_r (944, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_3 (const char *fmt, ...)
+geos_warning_945 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (3, fmt, ap);
+    geos_warning_r (945, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_4 (const char *fmt, ...)
+geos_warning_946 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (4, fmt, ap);
+    geos_warning_r (946, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_5 (const char *fmt, ...)
+geos_warning_947 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (5, fmt, ap);
+    geos_warning_r (947, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_6 (const char *fmt, ...)
+geos_warning_948 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (6, fmt, ap);
+    geos_warning_r (948, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_7 (const char *fmt, ...)
+geos_warning_949 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (7, fmt, ap);
+    geos_warning_r (949, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_8 (const char *fmt, ...)
+geos_warning_950 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (8, fmt, ap);
+    geos_warning_r (950, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_9 (const char *fmt, ...)
+geos_warning_951 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (9, fmt, ap);
+    geos_warning_r (951, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_10 (const char *fmt, ...)
+geos_warning_952 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (10, fmt, ap);
+    geos_warning_r (952, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_11 (const char *fmt, ...)
+geos_warning_953 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (11, fmt, ap);
+    geos_warning_r (953, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_12 (const char *fmt, ...)
+geos_warning_954 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (12, fmt, ap);
+    geos_warning_r (954, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_13 (const char *fmt, ...)
+geos_warning_955 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (13, fmt, ap);
+    geos_warning_r (955, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_14 (const char *fmt, ...)
+geos_warning_956 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (14, fmt, ap);
+    geos_warning_r (956, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_15 (const char *fmt, ...)
+geos_warning_957 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (15, fmt, ap);
+    geos_warning_r (957, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_16 (const char *fmt, ...)
+geos_warning_958 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (16, fmt, ap);
+    geos_warning_r (958, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_17 (const char *fmt, ...)
+geos_warning_959 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (17, fmt, ap);
+    geos_warning_r (959, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_18 (const char *fmt, ...)
+geos_warning_960 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (18, fmt, ap);
+    geos_warning_r (960, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_19 (const char *fmt, ...)
+geos_warning_961 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (19, fmt, ap);
+    geos_warning_r (961, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_20 (const char *fmt, ...)
+geos_warning_962 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (20, fmt, ap);
+    geos_warning_r (962, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_21 (const char *fmt, ...)
+geos_warning_963 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (21, fmt, ap);
+    geos_warning_r (963, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_22 (const char *fmt, ...)
+geos_warning_964 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (22, fmt, ap);
+    geos_warning_r (964, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_23 (const char *fmt, ...)
+geos_warning_965 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (23, fmt, ap);
+    geos_warning_r (965, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_24 (const char *fmt, ...)
+geos_warning_966 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (24, fmt, ap);
+    geos_warning_r (966, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_25 (const char *fmt, ...)
+geos_warning_967 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (25, fmt, ap);
+    geos_warning_r (967, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_26 (const char *fmt, ...)
+geos_warning_968 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (26, fmt, ap);
+    geos_warning_r (968, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_27 (const char *fmt, ...)
+geos_warning_969 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (27, fmt, ap);
+    geos_warning_r (969, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_28 (const char *fmt, ...)
+geos_warning_970 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (28, fmt, ap);
+    geos_warning_r (970, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_29 (const char *fmt, ...)
+geos_warning_971 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (29, fmt, ap);
+    geos_warning_r (971, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_30 (const char *fmt, ...)
+geos_warning_972 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (30, fmt, ap);
+    geos_warning_r (972, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_31 (const char *fmt, ...)
+geos_warning_973 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (31, fmt, ap);
+    geos_warning_r (973, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_32 (const char *fmt, ...)
+geos_warning_974 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (32, fmt, ap);
+    geos_warning_r (974, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_33 (const char *fmt, ...)
+geos_warning_975 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (33, fmt, ap);
+    geos_warning_r (975, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_34 (const char *fmt, ...)
+geos_warning_976 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (34, fmt, ap);
+    geos_warning_r (976, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_35 (const char *fmt, ...)
+geos_warning_977 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (35, fmt, ap);
+    geos_warning_r (977, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_36 (const char *fmt, ...)
+geos_warning_978 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (36, fmt, ap);
+    geos_warning_r (978, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_37 (const char *fmt, ...)
+geos_warning_979 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (37, fmt, ap);
+    geos_warning_r (979, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_38 (const char *fmt, ...)
+geos_warning_980 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (38, fmt, ap);
+    geos_warning_r (980, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_39 (const char *fmt, ...)
+geos_warning_981 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (39, fmt, ap);
+    geos_warning_r (981, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_40 (const char *fmt, ...)
+geos_warning_982 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (40, fmt, ap);
+    geos_warning_r (982, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_41 (const char *fmt, ...)
+geos_warning_983 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (41, fmt, ap);
+    geos_warning_r (983, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_42 (const char *fmt, ...)
+geos_warning_984 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (42, fmt, ap);
+    geos_warning_r (984, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_43 (const char *fmt, ...)
+geos_warning_985 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (43, fmt, ap);
+    geos_warning_r (985, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_44 (const char *fmt, ...)
+geos_warning_986 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (44, fmt, ap);
+    geos_warning_r (986, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_45 (const char *fmt, ...)
+geos_warning_987 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (45, fmt, ap);
+    geos_warning_r (987, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_46 (const char *fmt, ...)
+geos_warning_988 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (46, fmt, ap);
+    geos_warning_r (988, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_47 (const char *fmt, ...)
+geos_warning_989 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (47, fmt, ap);
+    geos_warning_r (989, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_48 (const char *fmt, ...)
+geos_warning_990 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (48, fmt, ap);
+    geos_warning_r (990, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_49 (const char *fmt, ...)
+geos_warning_991 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (49, fmt, ap);
+    geos_warning_r (991, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_50 (const char *fmt, ...)
+geos_warning_992 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (50, fmt, ap);
+    geos_warning_r (992, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_51 (const char *fmt, ...)
+geos_warning_993 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (51, fmt, ap);
+    geos_warning_r (993, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_52 (const char *fmt, ...)
+geos_warning_994 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (52, fmt, ap);
+    geos_warning_r (994, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_53 (const char *fmt, ...)
+geos_warning_995 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (53, fmt, ap);
+    geos_warning_r (995, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_54 (const char *fmt, ...)
+geos_warning_996 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (54, fmt, ap);
+    geos_warning_r (996, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_55 (const char *fmt, ...)
+geos_warning_997 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (55, fmt, ap);
+    geos_warning_r (997, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_56 (const char *fmt, ...)
+geos_warning_998 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (56, fmt, ap);
+    geos_warning_r (998, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_57 (const char *fmt, ...)
+geos_warning_999 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (57, fmt, ap);
+    geos_warning_r (999, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_58 (const char *fmt, ...)
+geos_warning_1000 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (58, fmt, ap);
+    geos_warning_r (1000, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_59 (const char *fmt, ...)
+geos_warning_1001 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (59, fmt, ap);
+    geos_warning_r (1001, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_60 (const char *fmt, ...)
+geos_warning_1002 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (60, fmt, ap);
+    geos_warning_r (1002, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_61 (const char *fmt, ...)
+geos_warning_1003 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (61, fmt, ap);
+    geos_warning_r (1003, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_62 (const char *fmt, ...)
+geos_warning_1004 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (62, fmt, ap);
+    geos_warning_r (1004, fmt, ap);
     va_end (ap);
 }
 
 static void
-geos_warning_63 (const char *fmt, ...)
+geos_warning_1005 (const char *fmt, ...)
 {
     va_list ap;
     va_start (ap, fmt);
-    geos_warning_r (63, fmt, ap);
+    geos_warning_r (1005, fmt, ap);
     va_end (ap);
 }
+
+static void
+geos_warning_1006 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1006, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1007 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1007, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1008 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1008, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1009 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1009, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1010 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1010, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1011 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1011, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1012 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1012, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1013 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1013, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1014 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1014, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1015 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1015, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1016 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1016, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1017 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1017, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1018 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1018, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1019 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1019, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1020 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1020, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1021 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1021, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1022 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1022, fmt, ap);
+    va_end (ap);
+}
+
+static void
+geos_warning_1023 (const char *fmt, ...)
+{
+    va_list ap;
+    va_start (ap, fmt);
+    geos_warning_r (1023, fmt, ap);
+    va_end (ap);
+}
+
+static void (*const geos_error_handlers[]) (const char *fmt, ...) = {
+    geos_error_0,
+    geos_error_1,
+    geos_error_2,
+    geos_error_3,
+    geos_error_4,
+    geos_error_5,
+    geos_error_6,
+    geos_error_7,
+    geos_error_8,
+    geos_error_9,
+    geos_error_10,
+    geos_error_11,
+    geos_error_12,
+    geos_error_13,
+    geos_error_14,
+    geos_error_15,
+    geos_error_16,
+    geos_error_17,
+    geos_error_18,
+    geos_error_19,
+    geos_error_20,
+    geos_error_21,
+    geos_error_22,
+    geos_error_23,
+    geos_error_24,
+    geos_error_25,
+    geos_error_26,
+    geos_error_27,
+    geos_error_28,
+    geos_error_29,
+    geos_error_30,
+    geos_error_31,
+    geos_error_32,
+    geos_error_33,
+    geos_error_34,
+    geos_error_35,
+    geos_error_36,
+    geos_error_37,
+    geos_error_38,
+    geos_error_39,
+    geos_error_40,
+    geos_error_41,
+    geos_error_42,
+    geos_error_43,
+    geos_error_44,
+    geos_error_45,
+    geos_error_46,
+    geos_error_47,
+    geos_error_48,
+    geos_error_49,
+    geos_error_50,
+    geos_error_51,
+    geos_error_52,
+    geos_error_53,
+    geos_error_54,
+    geos_error_55,
+    geos_error_56,
+    geos_error_57,
+    geos_error_58,
+    geos_error_59,
+    geos_error_60,
+    geos_error_61,
+    geos_error_62,
+    geos_error_63,
+    geos_error_64,
+    geos_error_65,
+    geos_error_66,
+    geos_error_67,
+    geos_error_68,
+    geos_error_69,
+    geos_error_70,
+    geos_error_71,
+    geos_error_72,
+    geos_error_73,
+    geos_error_74,
+    geos_error_75,
+    geos_error_76,
+    geos_error_77,
+    geos_error_78,
+    geos_error_79,
+    geos_error_80,
+    geos_error_81,
+    geos_error_82,
+    geos_error_83,
+    geos_error_84,
+    geos_error_85,
+    geos_error_86,
+    geos_error_87,
+    geos_error_88,
+    geos_error_89,
+    geos_error_90,
+    geos_error_91,
+    geos_error_92,
+    geos_error_93,
+    geos_error_94,
+    geos_error_95,
+    geos_error_96,
+    geos_error_97,
+    geos_error_98,
+    geos_error_99,
+    geos_error_100,
+    geos_error_101,
+    geos_error_102,
+    geos_error_103,
+    geos_error_104,
+    geos_error_105,
+    geos_error_106,
+    geos_error_107,
+    geos_error_108,
+    geos_error_109,
+    geos_error_110,
+    geos_error_111,
+    geos_error_112,
+    geos_error_113,
+    geos_error_114,
+    geos_error_115,
+    geos_error_116,
+    geos_error_117,
+    geos_error_118,
+    geos_error_119,
+    geos_error_120,
+    geos_error_121,
+    geos_error_122,
+    geos_error_123,
+    geos_error_124,
+    geos_error_125,
+    geos_error_126,
+    geos_error_127,
+    geos_error_128,
+    geos_error_129,
+    geos_error_130,
+    geos_error_131,
+    geos_error_132,
+    geos_error_133,
+    geos_error_134,
+    geos_error_135,
+    geos_error_136,
+    geos_error_137,
+    geos_error_138,
+    geos_error_139,
+    geos_error_140,
+    geos_error_141,
+    geos_error_142,
+    geos_error_143,
+    geos_error_144,
+    geos_error_145,
+    geos_error_146,
+    geos_error_147,
+    geos_error_148,
+    geos_error_149,
+    geos_error_150,
+    geos_error_151,
+    geos_error_152,
+    geos_error_153,
+    geos_error_154,
+    geos_error_155,
+    geos_error_156,
+    geos_error_157,
+    geos_error_158,
+    geos_error_159,
+    geos_error_160,
+    geos_error_161,
+    geos_error_162,
+    geos_error_163,
+    geos_error_164,
+    geos_error_165,
+    geos_error_166,
+    geos_error_167,
+    geos_error_168,
+    geos_error_169,
+    geos_error_170,
+    geos_error_171,
+    geos_error_172,
+    geos_error_173,
+    geos_error_174,
+    geos_error_175,
+    geos_error_176,
+    geos_error_177,
+    geos_error_178,
+    geos_error_179,
+    geos_error_180,
+    geos_error_181,
+    geos_error_182,
+    geos_error_183,
+    geos_error_184,
+    geos_error_185,
+    geos_error_186,
+    geos_error_187,
+    geos_error_188,
+    geos_error_189,
+    geos_error_190,
+    geos_error_191,
+    geos_error_192,
+    geos_error_193,
+    geos_error_194,
+    geos_error_195,
+    geos_error_196,
+    geos_error_197,
+    geos_error_198,
+    geos_error_199,
+    geos_error_200,
+    geos_error_201,
+    geos_error_202,
+    geos_error_203,
+    geos_error_204,
+    geos_error_205,
+    geos_error_206,
+    geos_error_207,
+    geos_error_208,
+    geos_error_209,
+    geos_error_210,
+    geos_error_211,
+    geos_error_212,
+    geos_error_213,
+    geos_error_214,
+    geos_error_215,
+    geos_error_216,
+    geos_error_217,
+    geos_error_218,
+    geos_error_219,
+    geos_error_220,
+    geos_error_221,
+    geos_error_222,
+    geos_error_223,
+    geos_error_224,
+    geos_error_225,
+    geos_error_226,
+    geos_error_227,
+    geos_error_228,
+    geos_error_229,
+    geos_error_230,
+    geos_error_231,
+    geos_error_232,
+    geos_error_233,
+    geos_error_234,
+    geos_error_235,
+    geos_error_236,
+    geos_error_237,
+    geos_error_238,
+    geos_error_239,
+    geos_error_240,
+    geos_error_241,
+    geos_error_242,
+    geos_error_243,
+    geos_error_244,
+    geos_error_245,
+    geos_error_246,
+    geos_error_247,
+    geos_error_248,
+    geos_error_249,
+    geos_error_250,
+    geos_error_251,
+    geos_error_252,
+    geos_error_253,
+    geos_error_254,
+    geos_error_255,
+    geos_error_256,
+    geos_error_257,
+    geos_error_258,
+    geos_error_259,
+    geos_error_260,
+    geos_error_261,
+    geos_error_262,
+    geos_error_263,
+    geos_error_264,
+    geos_error_265,
+    geos_error_266,
+    geos_error_267,
+    geos_error_268,
+    geos_error_269,
+    geos_error_270,
+    geos_error_271,
+    geos_error_272,
+    geos_error_273,
+    geos_error_274,
+    geos_error_275,
+    geos_error_276,
+    geos_error_277,
+    geos_error_278,
+    geos_error_279,
+    geos_error_280,
+    geos_error_281,
+    geos_error_282,
+    geos_error_283,
+    geos_error_284,
+    geos_error_285,
+    geos_error_286,
+    geos_error_287,
+    geos_error_288,
+    geos_error_289,
+    geos_error_290,
+    geos_error_291,
+    geos_error_292,
+    geos_error_293,
+    geos_error_294,
+    geos_error_295,
+    geos_error_296,
+    geos_error_297,
+    geos_error_298,
+    geos_error_299,
+    geos_error_300,
+    geos_error_301,
+    geos_error_302,
+    geos_error_303,
+    geos_error_304,
+    geos_error_305,
+    geos_error_306,
+    geos_error_307,
+    geos_error_308,
+    geos_error_309,
+    geos_error_310,
+    geos_error_311,
+    geos_error_312,
+    geos_error_313,
+    geos_error_314,
+    geos_error_315,
+    geos_error_316,
+    geos_error_317,
+    geos_error_318,
+    geos_error_319,
+    geos_error_320,
+    geos_error_321,
+    geos_error_322,
+    geos_error_323,
+    geos_error_324,
+    geos_error_325,
+    geos_error_326,
+    geos_error_327,
+    geos_error_328,
+    geos_error_329,
+    geos_error_330,
+    geos_error_331,
+    geos_error_332,
+    geos_error_333,
+    geos_error_334,
+    geos_error_335,
+    geos_error_336,
+    geos_error_337,
+    geos_error_338,
+    geos_error_339,
+    geos_error_340,
+    geos_error_341,
+    geos_error_342,
+    geos_error_343,
+    geos_error_344,
+    geos_error_345,
+    geos_error_346,
+    geos_error_347,
+    geos_error_348,
+    geos_error_349,
+    geos_error_350,
+    geos_error_351,
+    geos_error_352,
+    geos_error_353,
+    geos_error_354,
+    geos_error_355,
+    geos_error_356,
+    geos_error_357,
+    geos_error_358,
+    geos_error_359,
+    geos_error_360,
+    geos_error_361,
+    geos_error_362,
+    geos_error_363,
+    geos_error_364,
+    geos_error_365,
+    geos_error_366,
+    geos_error_367,
+    geos_error_368,
+    geos_error_369,
+    geos_error_370,
+    geos_error_371,
+    geos_error_372,
+    geos_error_373,
+    geos_error_374,
+    geos_error_375,
+    geos_error_376,
+    geos_error_377,
+    geos_error_378,
+    geos_error_379,
+    geos_error_380,
+    geos_error_381,
+    geos_error_382,
+    geos_error_383,
+    geos_error_384,
+    geos_error_385,
+    geos_error_386,
+    geos_error_387,
+    geos_error_388,
+    geos_error_389,
+    geos_error_390,
+    geos_error_391,
+    geos_error_392,
+    geos_error_393,
+    geos_error_394,
+    geos_error_395,
+    geos_error_396,
+    geos_error_397,
+    geos_error_398,
+    geos_error_399,
+    geos_error_400,
+    geos_error_401,
+    geos_error_402,
+    geos_error_403,
+    geos_error_404,
+    geos_error_405,
+    geos_error_406,
+    geos_error_407,
+    geos_error_408,
+    geos_error_409,
+    geos_error_410,
+    geos_error_411,
+    geos_error_412,
+    geos_error_413,
+    geos_error_414,
+    geos_error_415,
+    geos_error_416,
+    geos_error_417,
+    geos_error_418,
+    geos_error_419,
+    geos_error_420,
+    geos_error_421,
+    geos_error_422,
+    geos_error_423,
+    geos_error_424,
+    geos_error_425,
+    geos_error_426,
+    geos_error_427,
+    geos_error_428,
+    geos_error_429,
+    geos_error_430,
+    geos_error_431,
+    geos_error_432,
+    geos_error_433,
+    geos_error_434,
+    geos_error_435,
+    geos_error_436,
+    geos_error_437,
+    geos_error_438,
+    geos_error_439,
+    geos_error_440,
+    geos_error_441,
+    geos_error_442,
+    geos_error_443,
+    geos_error_444,
+    geos_error_445,
+    geos_error_446,
+    geos_error_447,
+    geos_error_448,
+    geos_error_449,
+    geos_error_450,
+    geos_error_451,
+    geos_error_452,
+    geos_error_453,
+    geos_error_454,
+    geos_error_455,
+    geos_error_456,
+    geos_error_457,
+    geos_error_458,
+    geos_error_459,
+    geos_error_460,
+    geos_error_461,
+    geos_error_462,
+    geos_error_463,
+    geos_error_464,
+    geos_error_465,
+    geos_error_466,
+    geos_error_467,
+    geos_error_468,
+    geos_error_469,
+    geos_error_470,
+    geos_error_471,
+    geos_error_472,
+    geos_error_473,
+    geos_error_474,
+    geos_error_475,
+    geos_error_476,
+    geos_error_477,
+    geos_error_478,
+    geos_error_479,
+    geos_error_480,
+    geos_error_481,
+    geos_error_482,
+    geos_error_483,
+    geos_error_484,
+    geos_error_485,
+    geos_error_486,
+    geos_error_487,
+    geos_error_488,
+    geos_error_489,
+    geos_error_490,
+    geos_error_491,
+    geos_error_492,
+    geos_error_493,
+    geos_error_494,
+    geos_error_495,
+    geos_error_496,
+    geos_error_497,
+    geos_error_498,
+    geos_error_499,
+    geos_error_500,
+    geos_error_501,
+    geos_error_502,
+    geos_error_503,
+    geos_error_504,
+    geos_error_505,
+    geos_error_506,
+    geos_error_507,
+    geos_error_508,
+    geos_error_509,
+    geos_error_510,
+    geos_error_511,
+    geos_error_512,
+    geos_error_513,
+    geos_error_514,
+    geos_error_515,
+    geos_error_516,
+    geos_error_517,
+    geos_error_518,
+    geos_error_519,
+    geos_error_520,
+    geos_error_521,
+    geos_error_522,
+    geos_error_523,
+    geos_error_524,
+    geos_error_525,
+    geos_error_526,
+    geos_error_527,
+    geos_error_528,
+    geos_error_529,
+    geos_error_530,
+    geos_error_531,
+    geos_error_532,
+    geos_error_533,
+    geos_error_534,
+    geos_error_535,
+    geos_error_536,
+    geos_error_537,
+    geos_error_538,
+    geos_error_539,
+    geos_error_540,
+    geos_error_541,
+    geos_error_542,
+    geos_error_543,
+    geos_error_544,
+    geos_error_545,
+    geos_error_546,
+    geos_error_547,
+    geos_error_548,
+    geos_error_549,
+    geos_error_550,
+    geos_error_551,
+    geos_error_552,
+    geos_error_553,
+    geos_error_554,
+    geos_error_555,
+    geos_error_556,
+    geos_error_557,
+    geos_error_558,
+    geos_error_559,
+    geos_error_560,
+    geos_error_561,
+    geos_error_562,
+    geos_error_563,
+    geos_error_564,
+    geos_error_565,
+    geos_error_566,
+    geos_error_567,
+    geos_error_568,
+    geos_error_569,
+    geos_error_570,
+    geos_error_571,
+    geos_error_572,
+    geos_error_573,
+    geos_error_574,
+    geos_error_575,
+    geos_error_576,
+    geos_error_577,
+    geos_error_578,
+    geos_error_579,
+    geos_error_580,
+    geos_error_581,
+    geos_error_582,
+    geos_error_583,
+    geos_error_584,
+    geos_error_585,
+    geos_error_586,
+    geos_error_587,
+    geos_error_588,
+    geos_error_589,
+    geos_error_590,
+    geos_error_591,
+    geos_error_592,
+    geos_error_593,
+    geos_error_594,
+    geos_error_595,
+    geos_error_596,
+    geos_error_597,
+    geos_error_598,
+    geos_error_599,
+    geos_error_600,
+    geos_error_601,
+    geos_error_602,
+    geos_error_603,
+    geos_error_604,
+    geos_error_605,
+    geos_error_606,
+    geos_error_607,
+    geos_error_608,
+    geos_error_609,
+    geos_error_610,
+    geos_error_611,
+    geos_error_612,
+    geos_error_613,
+    geos_error_614,
+    geos_error_615,
+    geos_error_616,
+    geos_error_617,
+    geos_error_618,
+    geos_error_619,
+    geos_error_620,
+    geos_error_621,
+    geos_error_622,
+    geos_error_623,
+    geos_error_624,
+    geos_error_625,
+    geos_error_626,
+    geos_error_627,
+    geos_error_628,
+    geos_error_629,
+    geos_error_630,
+    geos_error_631,
+    geos_error_632,
+    geos_error_633,
+    geos_error_634,
+    geos_error_635,
+    geos_error_636,
+    geos_error_637,
+    geos_error_638,
+    geos_error_639,
+    geos_error_640,
+    geos_error_641,
+    geos_error_642,
+    geos_error_643,
+    geos_error_644,
+    geos_error_645,
+    geos_error_646,
+    geos_error_647,
+    geos_error_648,
+    geos_error_649,
+    geos_error_650,
+    geos_error_651,
+    geos_error_652,
+    geos_error_653,
+    geos_error_654,
+    geos_error_655,
+    geos_error_656,
+    geos_error_657,
+    geos_error_658,
+    geos_error_659,
+    geos_error_660,
+    geos_error_661,
+    geos_error_662,
+    geos_error_663,
+    geos_error_664,
+    geos_error_665,
+    geos_error_666,
+    geos_error_667,
+    geos_error_668,
+    geos_error_669,
+    geos_error_670,
+    geos_error_671,
+    geos_error_672,
+    geos_error_673,
+    geos_error_674,
+    geos_error_675,
+    geos_error_676,
+    geos_error_677,
+    geos_error_678,
+    geos_error_679,
+    geos_error_680,
+    geos_error_681,
+    geos_error_682,
+    geos_error_683,
+    geos_error_684,
+    geos_error_685,
+    geos_error_686,
+    geos_error_687,
+    geos_error_688,
+    geos_error_689,
+    geos_error_690,
+    geos_error_691,
+    geos_error_692,
+    geos_error_693,
+    geos_error_694,
+    geos_error_695,
+    geos_error_696,
+    geos_error_697,
+    geos_error_698,
+    geos_error_699,
+    geos_error_700,
+    geos_error_701,
+    geos_error_702,
+    geos_error_703,
+    geos_error_704,
+    geos_error_705,
+    geos_error_706,
+    geos_error_707,
+    geos_error_708,
+    geos_error_709,
+    geos_error_710,
+    geos_error_711,
+    geos_error_712,
+    geos_error_713,
+    geos_error_714,
+    geos_error_715,
+    geos_error_716,
+    geos_error_717,
+    geos_error_718,
+    geos_error_719,
+    geos_error_720,
+    geos_error_721,
+    geos_error_722,
+    geos_error_723,
+    geos_error_724,
+    geos_error_725,
+    geos_error_726,
+    geos_error_727,
+    geos_error_728,
+    geos_error_729,
+    geos_error_730,
+    geos_error_731,
+    geos_error_732,
+    geos_error_733,
+    geos_error_734,
+    geos_error_735,
+    geos_error_736,
+    geos_error_737,
+    geos_error_738,
+    geos_error_739,
+    geos_error_740,
+    geos_error_741,
+    geos_error_742,
+    geos_error_743,
+    geos_error_744,
+    geos_error_745,
+    geos_error_746,
+    geos_error_747,
+    geos_error_748,
+    geos_error_749,
+    geos_error_750,
+    geos_error_751,
+    geos_error_752,
+    geos_error_753,
+    geos_error_754,
+    geos_error_755,
+    geos_error_756,
+    geos_error_757,
+    geos_error_758,
+    geos_error_759,
+    geos_error_760,
+    geos_error_761,
+    geos_error_762,
+    geos_error_763,
+    geos_error_764,
+    geos_error_765,
+    geos_error_766,
+    geos_error_767,
+    geos_error_768,
+    geos_error_769,
+    geos_error_770,
+    geos_error_771,
+    geos_error_772,
+    geos_error_773,
+    geos_error_774,
+    geos_error_775,
+    geos_error_776,
+    geos_error_777,
+    geos_error_778,
+    geos_error_779,
+    geos_error_780,
+    geos_error_781,
+    geos_error_782,
+    geos_error_783,
+    geos_error_784,
+    geos_error_785,
+    geos_error_786,
+    geos_error_787,
+    geos_error_788,
+    geos_error_789,
+    geos_error_790,
+    geos_error_791,
+    geos_error_792,
+    geos_error_793,
+    geos_error_794,
+    geos_error_795,
+    geos_error_796,
+    geos_error_797,
+    geos_error_798,
+    geos_error_799,
+    geos_error_800,
+    geos_error_801,
+    geos_error_802,
+    geos_error_803,
+    geos_error_804,
+    geos_error_805,
+    geos_error_806,
+    geos_error_807,
+    geos_error_808,
+    geos_error_809,
+    geos_error_810,
+    geos_error_811,
+    geos_error_812,
+    geos_error_813,
+    geos_error_814,
+    geos_error_815,
+    geos_error_816,
+    geos_error_817,
+    geos_error_818,
+    geos_error_819,
+    geos_error_820,
+    geos_error_821,
+    geos_error_822,
+    geos_error_823,
+    geos_error_824,
+    geos_error_825,
+    geos_error_826,
+    geos_error_827,
+    geos_error_828,
+    geos_error_829,
+    geos_error_830,
+    geos_error_831,
+    geos_error_832,
+    geos_error_833,
+    geos_error_834,
+    geos_error_835,
+    geos_error_836,
+    geos_error_837,
+    geos_error_838,
+    geos_error_839,
+    geos_error_840,
+    geos_error_841,
+    geos_error_842,
+    geos_error_843,
+    geos_error_844,
+    geos_error_845,
+    geos_error_846,
+    geos_error_847,
+    geos_error_848,
+    geos_error_849,
+    geos_error_850,
+    geos_error_851,
+    geos_error_852,
+    geos_error_853,
+    geos_error_854,
+    geos_error_855,
+    geos_error_856,
+    geos_error_857,
+    geos_error_858,
+    geos_error_859,
+    geos_error_860,
+    geos_error_861,
+    geos_error_862,
+    geos_error_863,
+    geos_error_864,
+    geos_error_865,
+    geos_error_866,
+    geos_error_867,
+    geos_error_868,
+    geos_error_869,
+    geos_error_870,
+    geos_error_871,
+    geos_error_872,
+    geos_error_873,
+    geos_error_874,
+    geos_error_875,
+    geos_error_876,
+    geos_error_877,
+    geos_error_878,
+    geos_error_879,
+    geos_error_880,
+    geos_error_881,
+    geos_error_882,
+    geos_error_883,
+    geos_error_884,
+    geos_error_885,
+    geos_error_886,
+    geos_error_887,
+    geos_error_888,
+    geos_error_889,
+    geos_error_890,
+    geos_error_891,
+    geos_error_892,
+    geos_error_893,
+    geos_error_894,
+    geos_error_895,
+    geos_error_896,
+    geos_error_897,
+    geos_error_898,
+    geos_error_899,
+    geos_error_900,
+    geos_error_901,
+    geos_error_902,
+    geos_error_903,
+    geos_error_904,
+    geos_error_905,
+    geos_error_906,
+    geos_error_907,
+    geos_error_908,
+    geos_error_909,
+    geos_error_910,
+    geos_error_911,
+    geos_error_912,
+    geos_error_913,
+    geos_error_914,
+    geos_error_915,
+    geos_error_916,
+    geos_error_917,
+    geos_error_918,
+    geos_error_919,
+    geos_error_920,
+    geos_error_921,
+    geos_error_922,
+    geos_error_923,
+    geos_error_924,
+    geos_error_925,
+    geos_error_926,
+    geos_error_927,
+    geos_error_928,
+    geos_error_929,
+    geos_error_930,
+    geos_error_931,
+    geos_error_932,
+    geos_error_933,
+    geos_error_934,
+    geos_error_935,
+    geos_error_936,
+    geos_error_937,
+    geos_error_938,
+    geos_error_939,
+    geos_error_940,
+    geos_error_941,
+    geos_error_942,
+    geos_error_943,
+    geos_error_944,
+    geos_error_945,
+    geos_error_946,
+    geos_error_947,
+    geos_error_948,
+    geos_error_949,
+    geos_error_950,
+    geos_error_951,
+    geos_error_952,
+    geos_error_953,
+    geos_error_954,
+    geos_error_955,
+    geos_error_956,
+    geos_error_957,
+    geos_error_958,
+    geos_error_959,
+    geos_error_960,
+    geos_error_961,
+    geos_error_962,
+    geos_error_963,
+    geos_error_964,
+    geos_error_965,
+    geos_error_966,
+    geos_error_967,
+    geos_error_968,
+    geos_error_969,
+    geos_error_970,
+    geos_error_971,
+    geos_error_972,
+    geos_error_973,
+    geos_error_974,
+    geos_error_975,
+    geos_error_976,
+    geos_error_977,
+    geos_error_978,
+    geos_error_979,
+    geos_error_980,
+    geos_error_981,
+    geos_error_982,
+    geos_error_983,
+    geos_error_984,
+    geos_error_985,
+    geos_error_986,
+    geos_error_987,
+    geos_error_988,
+    geos_error_989,
+    geos_error_990,
+    geos_error_991,
+    geos_error_992,
+    geos_error_993,
+    geos_error_994,
+    geos_error_995,
+    geos_error_996,
+    geos_error_997,
+    geos_error_998,
+    geos_error_999,
+    geos_error_1000,
+    geos_error_1001,
+    geos_error_1002,
+    geos_error_1003,
+    geos_error_1004,
+    geos_error_1005,
+    geos_error_1006,
+    geos_error_1007,
+    geos_error_1008,
+    geos_error_1009,
+    geos_error_1010,
+    geos_error_1011,
+    geos_error_1012,
+    geos_error_1013,
+    geos_error_1014,
+    geos_error_1015,
+    geos_error_1016,
+    geos_error_1017,
+    geos_error_1018,
+    geos_error_1019,
+    geos_error_1020,
+    geos_error_1021,
+    geos_error_1022,
+    geos_error_1023
+};
+
+static void (*const geos_warning_handlers[]) (const char *fmt, ...) = {
+    geos_warning_0,
+    geos_warning_1,
+    geos_warning_2,
+    geos_warning_3,
+    geos_warning_4,
+    geos_warning_5,
+    geos_warning_6,
+    geos_warning_7,
+    geos_warning_8,
+    geos_warning_9,
+    geos_warning_10,
+    geos_warning_11,
+    geos_warning_12,
+    geos_warning_13,
+    geos_warning_14,
+    geos_warning_15,
+    geos_warning_16,
+    geos_warning_17,
+    geos_warning_18,
+    geos_warning_19,
+    geos_warning_20,
+    geos_warning_21,
+    geos_warning_22,
+    geos_warning_23,
+    geos_warning_24,
+    geos_warning_25,
+    geos_warning_26,
+    geos_warning_27,
+    geos_warning_28,
+    geos_warning_29,
+    geos_warning_30,
+    geos_warning_31,
+    geos_warning_32,
+    geos_warning_33,
+    geos_warning_34,
+    geos_warning_35,
+    geos_warning_36,
+    geos_warning_37,
+    geos_warning_38,
+    geos_warning_39,
+    geos_warning_40,
+    geos_warning_41,
+    geos_warning_42,
+    geos_warning_43,
+    geos_warning_44,
+    geos_warning_45,
+    geos_warning_46,
+    geos_warning_47,
+    geos_warning_48,
+    geos_warning_49,
+    geos_warning_50,
+    geos_warning_51,
+    geos_warning_52,
+    geos_warning_53,
+    geos_warning_54,
+    geos_warning_55,
+    geos_warning_56,
+    geos_warning_57,
+    geos_warning_58,
+    geos_warning_59,
+    geos_warning_60,
+    geos_warning_61,
+    geos_warning_62,
+    geos_warning_63,
+    geos_warning_64,
+    geos_warning_65,
+    geos_warning_66,
+    geos_warning_67,
+    geos_warning_68,
+    geos_warning_69,
+    geos_warning_70,
+    geos_warning_71,
+    geos_warning_72,
+    geos_warning_73,
+    geos_warning_74,
+    geos_warning_75,
+    geos_warning_76,
+    geos_warning_77,
+    geos_warning_78,
+    geos_warning_79,
+    geos_warning_80,
+    geos_warning_81,
+    geos_warning_82,
+    geos_warning_83,
+    geos_warning_84,
+    geos_warning_85,
+    geos_warning_86,
+    geos_warning_87,
+    geos_warning_88,
+    geos_warning_89,
+    geos_warning_90,
+    geos_warning_91,
+    geos_warning_92,
+    geos_warning_93,
+    geos_warning_94,
+    geos_warning_95,
+    geos_warning_96,
+    geos_warning_97,
+    geos_warning_98,
+    geos_warning_99,
+    geos_warning_100,
+    geos_warning_101,
+    geos_warning_102,
+    geos_warning_103,
+    geos_warning_104,
+    geos_warning_105,
+    geos_warning_106,
+    geos_warning_107,
+    geos_warning_108,
+    geos_warning_109,
+    geos_warning_110,
+    geos_warning_111,
+    geos_warning_112,
+    geos_warning_113,
+    geos_warning_114,
+    geos_warning_115,
+    geos_warning_116,
+    geos_warning_117,
+    geos_warning_118,
+    geos_warning_119,
+    geos_warning_120,
+    geos_warning_121,
+    geos_warning_122,
+    geos_warning_123,
+    geos_warning_124,
+    geos_warning_125,
+    geos_warning_126,
+    geos_warning_127,
+    geos_warning_128,
+    geos_warning_129,
+    geos_warning_130,
+    geos_warning_131,
+    geos_warning_132,
+    geos_warning_133,
+    geos_warning_134,
+    geos_warning_135,
+    geos_warning_136,
+    geos_warning_137,
+    geos_warning_138,
+    geos_warning_139,
+    geos_warning_140,
+    geos_warning_141,
+    geos_warning_142,
+    geos_warning_143,
+    geos_warning_144,
+    geos_warning_145,
+    geos_warning_146,
+    geos_warning_147,
+    geos_warning_148,
+    geos_warning_149,
+    geos_warning_150,
+    geos_warning_151,
+    geos_warning_152,
+    geos_warning_153,
+    geos_warning_154,
+    geos_warning_155,
+    geos_warning_156,
+    geos_warning_157,
+    geos_warning_158,
+    geos_warning_159,
+    geos_warning_160,
+    geos_warning_161,
+    geos_warning_162,
+    geos_warning_163,
+    geos_warning_164,
+    geos_warning_165,
+    geos_warning_166,
+    geos_warning_167,
+    geos_warning_168,
+    geos_warning_169,
+    geos_warning_170,
+    geos_warning_171,
+    geos_warning_172,
+    geos_warning_173,
+    geos_warning_174,
+    geos_warning_175,
+    geos_warning_176,
+    geos_warning_177,
+    geos_warning_178,
+    geos_warning_179,
+    geos_warning_180,
+    geos_warning_181,
+    geos_warning_182,
+    geos_warning_183,
+    geos_warning_184,
+    geos_warning_185,
+    geos_warning_186,
+    geos_warning_187,
+    geos_warning_188,
+    geos_warning_189,
+    geos_warning_190,
+    geos_warning_191,
+    geos_warning_192,
+    geos_warning_193,
+    geos_warning_194,
+    geos_warning_195,
+    geos_warning_196,
+    geos_warning_197,
+    geos_warning_198,
+    geos_warning_199,
+    geos_warning_200,
+    geos_warning_201,
+    geos_warning_202,
+    geos_warning_203,
+    geos_warning_204,
+    geos_warning_205,
+    geos_warning_206,
+    geos_warning_207,
+    geos_warning_208,
+    geos_warning_209,
+    geos_warning_210,
+    geos_warning_211,
+    geos_warning_212,
+    geos_warning_213,
+    geos_warning_214,
+    geos_warning_215,
+    geos_warning_216,
+    geos_warning_217,
+    geos_warning_218,
+    geos_warning_219,
+    geos_warning_220,
+    geos_warning_221,
+    geos_warning_222,
+    geos_warning_223,
+    geos_warning_224,
+    geos_warning_225,
+    geos_warning_226,
+    geos_warning_227,
+    geos_warning_228,
+    geos_warning_229,
+    geos_warning_230,
+    geos_warning_231,
+    geos_warning_232,
+    geos_warning_233,
+    geos_warning_234,
+    geos_warning_235,
+    geos_warning_236,
+    geos_warning_237,
+    geos_warning_238,
+    geos_warning_239,
+    geos_warning_240,
+    geos_warning_241,
+    geos_warning_242,
+    geos_warning_243,
+    geos_warning_244,
+    geos_warning_245,
+    geos_warning_246,
+    geos_warning_247,
+    geos_warning_248,
+    geos_warning_249,
+    geos_warning_250,
+    geos_warning_251,
+    geos_warning_252,
+    geos_warning_253,
+    geos_warning_254,
+    geos_warning_255,
+    geos_warning_256,
+    geos_warning_257,
+    geos_warning_258,
+    geos_warning_259,
+    geos_warning_260,
+    geos_warning_261,
+    geos_warning_262,
+    geos_warning_263,
+    geos_warning_264,
+    geos_warning_265,
+    geos_warning_266,
+    geos_warning_267,
+    geos_warning_268,
+    geos_warning_269,
+    geos_warning_270,
+    geos_warning_271,
+    geos_warning_272,
+    geos_warning_273,
+    geos_warning_274,
+    geos_warning_275,
+    geos_warning_276,
+    geos_warning_277,
+    geos_warning_278,
+    geos_warning_279,
+    geos_warning_280,
+    geos_warning_281,
+    geos_warning_282,
+    geos_warning_283,
+    geos_warning_284,
+    geos_warning_285,
+    geos_warning_286,
+    geos_warning_287,
+    geos_warning_288,
+    geos_warning_289,
+    geos_warning_290,
+    geos_warning_291,
+    geos_warning_292,
+    geos_warning_293,
+    geos_warning_294,
+    geos_warning_295,
+    geos_warning_296,
+    geos_warning_297,
+    geos_warning_298,
+    geos_warning_299,
+    geos_warning_300,
+    geos_warning_301,
+    geos_warning_302,
+    geos_warning_303,
+    geos_warning_304,
+    geos_warning_305,
+    geos_warning_306,
+    geos_warning_307,
+    geos_warning_308,
+    geos_warning_309,
+    geos_warning_310,
+    geos_warning_311,
+    geos_warning_312,
+    geos_warning_313,
+    geos_warning_314,
+    geos_warning_315,
+    geos_warning_316,
+    geos_warning_317,
+    geos_warning_318,
+    geos_warning_319,
+    geos_warning_320,
+    geos_warning_321,
+    geos_warning_322,
+    geos_warning_323,
+    geos_warning_324,
+    geos_warning_325,
+    geos_warning_326,
+    geos_warning_327,
+    geos_warning_328,
+    geos_warning_329,
+    geos_warning_330,
+    geos_warning_331,
+    geos_warning_332,
+    geos_warning_333,
+    geos_warning_334,
+    geos_warning_335,
+    geos_warning_336,
+    geos_warning_337,
+    geos_warning_338,
+    geos_warning_339,
+    geos_warning_340,
+    geos_warning_341,
+    geos_warning_342,
+    geos_warning_343,
+    geos_warning_344,
+    geos_warning_345,
+    geos_warning_346,
+    geos_warning_347,
+    geos_warning_348,
+    geos_warning_349,
+    geos_warning_350,
+    geos_warning_351,
+    geos_warning_352,
+    geos_warning_353,
+    geos_warning_354,
+    geos_warning_355,
+    geos_warning_356,
+    geos_warning_357,
+    geos_warning_358,
+    geos_warning_359,
+    geos_warning_360,
+    geos_warning_361,
+    geos_warning_362,
+    geos_warning_363,
+    geos_warning_364,
+    geos_warning_365,
+    geos_warning_366,
+    geos_warning_367,
+    geos_warning_368,
+    geos_warning_369,
+    geos_warning_370,
+    geos_warning_371,
+    geos_warning_372,
+    geos_warning_373,
+    geos_warning_374,
+    geos_warning_375,
+    geos_warning_376,
+    geos_warning_377,
+    geos_warning_378,
+    geos_warning_379,
+    geos_warning_380,
+    geos_warning_381,
+    geos_warning_382,
+    geos_warning_383,
+    geos_warning_384,
+    geos_warning_385,
+    geos_warning_386,
+    geos_warning_387,
+    geos_warning_388,
+    geos_warning_389,
+    geos_warning_390,
+    geos_warning_391,
+    geos_warning_392,
+    geos_warning_393,
+    geos_warning_394,
+    geos_warning_395,
+    geos_warning_396,
+    geos_warning_397,
+    geos_warning_398,
+    geos_warning_399,
+    geos_warning_400,
+    geos_warning_401,
+    geos_warning_402,
+    geos_warning_403,
+    geos_warning_404,
+    geos_warning_405,
+    geos_warning_406,
+    geos_warning_407,
+    geos_warning_408,
+    geos_warning_409,
+    geos_warning_410,
+    geos_warning_411,
+    geos_warning_412,
+    geos_warning_413,
+    geos_warning_414,
+    geos_warning_415,
+    geos_warning_416,
+    geos_warning_417,
+    geos_warning_418,
+    geos_warning_419,
+    geos_warning_420,
+    geos_warning_421,
+    geos_warning_422,
+    geos_warning_423,
+    geos_warning_424,
+    geos_warning_425,
+    geos_warning_426,
+    geos_warning_427,
+    geos_warning_428,
+    geos_warning_429,
+    geos_warning_430,
+    geos_warning_431,
+    geos_warning_432,
+    geos_warning_433,
+    geos_warning_434,
+    geos_warning_435,
+    geos_warning_436,
+    geos_warning_437,
+    geos_warning_438,
+    geos_warning_439,
+    geos_warning_440,
+    geos_warning_441,
+    geos_warning_442,
+    geos_warning_443,
+    geos_warning_444,
+    geos_warning_445,
+    geos_warning_446,
+    geos_warning_447,
+    geos_warning_448,
+    geos_warning_449,
+    geos_warning_450,
+    geos_warning_451,
+    geos_warning_452,
+    geos_warning_453,
+    geos_warning_454,
+    geos_warning_455,
+    geos_warning_456,
+    geos_warning_457,
+    geos_warning_458,
+    geos_warning_459,
+    geos_warning_460,
+    geos_warning_461,
+    geos_warning_462,
+    geos_warning_463,
+    geos_warning_464,
+    geos_warning_465,
+    geos_warning_466,
+    geos_warning_467,
+    geos_warning_468,
+    geos_warning_469,
+    geos_warning_470,
+    geos_warning_471,
+    geos_warning_472,
+    geos_warning_473,
+    geos_warning_474,
+    geos_warning_475,
+    geos_warning_476,
+    geos_warning_477,
+    geos_warning_478,
+    geos_warning_479,
+    geos_warning_480,
+    geos_warning_481,
+    geos_warning_482,
+    geos_warning_483,
+    geos_warning_484,
+    geos_warning_485,
+    geos_warning_486,
+    geos_warning_487,
+    geos_warning_488,
+    geos_warning_489,
+    geos_warning_490,
+    geos_warning_491,
+    geos_warning_492,
+    geos_warning_493,
+    geos_warning_494,
+    geos_warning_495,
+    geos_warning_496,
+    geos_warning_497,
+    geos_warning_498,
+    geos_warning_499,
+    geos_warning_500,
+    geos_warning_501,
+    geos_warning_502,
+    geos_warning_503,
+    geos_warning_504,
+    geos_warning_505,
+    geos_warning_506,
+    geos_warning_507,
+    geos_warning_508,
+    geos_warning_509,
+    geos_warning_510,
+    geos_warning_511,
+    geos_warning_512,
+    geos_warning_513,
+    geos_warning_514,
+    geos_warning_515,
+    geos_warning_516,
+    geos_warning_517,
+    geos_warning_518,
+    geos_warning_519,
+    geos_warning_520,
+    geos_warning_521,
+    geos_warning_522,
+    geos_warning_523,
+    geos_warning_524,
+    geos_warning_525,
+    geos_warning_526,
+    geos_warning_527,
+    geos_warning_528,
+    geos_warning_529,
+    geos_warning_530,
+    geos_warning_531,
+    geos_warning_532,
+    geos_warning_533,
+    geos_warning_534,
+    geos_warning_535,
+    geos_warning_536,
+    geos_warning_537,
+    geos_warning_538,
+    geos_warning_539,
+    geos_warning_540,
+    geos_warning_541,
+    geos_warning_542,
+    geos_warning_543,
+    geos_warning_544,
+    geos_warning_545,
+    geos_warning_546,
+    geos_warning_547,
+    geos_warning_548,
+    geos_warning_549,
+    geos_warning_550,
+    geos_warning_551,
+    geos_warning_552,
+    geos_warning_553,
+    geos_warning_554,
+    geos_warning_555,
+    geos_warning_556,
+    geos_warning_557,
+    geos_warning_558,
+    geos_warning_559,
+    geos_warning_560,
+    geos_warning_561,
+    geos_warning_562,
+    geos_warning_563,
+    geos_warning_564,
+    geos_warning_565,
+    geos_warning_566,
+    geos_warning_567,
+    geos_warning_568,
+    geos_warning_569,
+    geos_warning_570,
+    geos_warning_571,
+    geos_warning_572,
+    geos_warning_573,
+    geos_warning_574,
+    geos_warning_575,
+    geos_warning_576,
+    geos_warning_577,
+    geos_warning_578,
+    geos_warning_579,
+    geos_warning_580,
+    geos_warning_581,
+    geos_warning_582,
+    geos_warning_583,
+    geos_warning_584,
+    geos_warning_585,
+    geos_warning_586,
+    geos_warning_587,
+    geos_warning_588,
+    geos_warning_589,
+    geos_warning_590,
+    geos_warning_591,
+    geos_warning_592,
+    geos_warning_593,
+    geos_warning_594,
+    geos_warning_595,
+    geos_warning_596,
+    geos_warning_597,
+    geos_warning_598,
+    geos_warning_599,
+    geos_warning_600,
+    geos_warning_601,
+    geos_warning_602,
+    geos_warning_603,
+    geos_warning_604,
+    geos_warning_605,
+    geos_warning_606,
+    geos_warning_607,
+    geos_warning_608,
+    geos_warning_609,
+    geos_warning_610,
+    geos_warning_611,
+    geos_warning_612,
+    geos_warning_613,
+    geos_warning_614,
+    geos_warning_615,
+    geos_warning_616,
+    geos_warning_617,
+    geos_warning_618,
+    geos_warning_619,
+    geos_warning_620,
+    geos_warning_621,
+    geos_warning_622,
+    geos_warning_623,
+    geos_warning_624,
+    geos_warning_625,
+    geos_warning_626,
+    geos_warning_627,
+    geos_warning_628,
+    geos_warning_629,
+    geos_warning_630,
+    geos_warning_631,
+    geos_warning_632,
+    geos_warning_633,
+    geos_warning_634,
+    geos_warning_635,
+    geos_warning_636,
+    geos_warning_637,
+    geos_warning_638,
+    geos_warning_639,
+    geos_warning_640,
+    geos_warning_641,
+    geos_warning_642,
+    geos_warning_643,
+    geos_warning_644,
+    geos_warning_645,
+    geos_warning_646,
+    geos_warning_647,
+    geos_warning_648,
+    geos_warning_649,
+    geos_warning_650,
+    geos_warning_651,
+    geos_warning_652,
+    geos_warning_653,
+    geos_warning_654,
+    geos_warning_655,
+    geos_warning_656,
+    geos_warning_657,
+    geos_warning_658,
+    geos_warning_659,
+    geos_warning_660,
+    geos_warning_661,
+    geos_warning_662,
+    geos_warning_663,
+    geos_warning_664,
+    geos_warning_665,
+    geos_warning_666,
+    geos_warning_667,
+    geos_warning_668,
+    geos_warning_669,
+    geos_warning_670,
+    geos_warning_671,
+    geos_warning_672,
+    geos_warning_673,
+    geos_warning_674,
+    geos_warning_675,
+    geos_warning_676,
+    geos_warning_677,
+    geos_warning_678,
+    geos_warning_679,
+    geos_warning_680,
+    geos_warning_681,
+    geos_warning_682,
+    geos_warning_683,
+    geos_warning_684,
+    geos_warning_685,
+    geos_warning_686,
+    geos_warning_687,
+    geos_warning_688,
+    geos_warning_689,
+    geos_warning_690,
+    geos_warning_691,
+    geos_warning_692,
+    geos_warning_693,
+    geos_warning_694,
+    geos_warning_695,
+    geos_warning_696,
+    geos_warning_697,
+    geos_warning_698,
+    geos_warning_699,
+    geos_warning_700,
+    geos_warning_701,
+    geos_warning_702,
+    geos_warning_703,
+    geos_warning_704,
+    geos_warning_705,
+    geos_warning_706,
+    geos_warning_707,
+    geos_warning_708,
+    geos_warning_709,
+    geos_warning_710,
+    geos_warning_711,
+    geos_warning_712,
+    geos_warning_713,
+    geos_warning_714,
+    geos_warning_715,
+    geos_warning_716,
+    geos_warning_717,
+    geos_warning_718,
+    geos_warning_719,
+    geos_warning_720,
+    geos_warning_721,
+    geos_warning_722,
+    geos_warning_723,
+    geos_warning_724,
+    geos_warning_725,
+    geos_warning_726,
+    geos_warning_727,
+    geos_warning_728,
+    geos_warning_729,
+    geos_warning_730,
+    geos_warning_731,
+    geos_warning_732,
+    geos_warning_733,
+    geos_warning_734,
+    geos_warning_735,
+    geos_warning_736,
+    geos_warning_737,
+    geos_warning_738,
+    geos_warning_739,
+    geos_warning_740,
+    geos_warning_741,
+    geos_warning_742,
+    geos_warning_743,
+    geos_warning_744,
+    geos_warning_745,
+    geos_warning_746,
+    geos_warning_747,
+    geos_warning_748,
+    geos_warning_749,
+    geos_warning_750,
+    geos_warning_751,
+    geos_warning_752,
+    geos_warning_753,
+    geos_warning_754,
+    geos_warning_755,
+    geos_warning_756,
+    geos_warning_757,
+    geos_warning_758,
+    geos_warning_759,
+    geos_warning_760,
+    geos_warning_761,
+    geos_warning_762,
+    geos_warning_763,
+    geos_warning_764,
+    geos_warning_765,
+    geos_warning_766,
+    geos_warning_767,
+    geos_warning_768,
+    geos_warning_769,
+    geos_warning_770,
+    geos_warning_771,
+    geos_warning_772,
+    geos_warning_773,
+    geos_warning_774,
+    geos_warning_775,
+    geos_warning_776,
+    geos_warning_777,
+    geos_warning_778,
+    geos_warning_779,
+    geos_warning_780,
+    geos_warning_781,
+    geos_warning_782,
+    geos_warning_783,
+    geos_warning_784,
+    geos_warning_785,
+    geos_warning_786,
+    geos_warning_787,
+    geos_warning_788,
+    geos_warning_789,
+    geos_warning_790,
+    geos_warning_791,
+    geos_warning_792,
+    geos_warning_793,
+    geos_warning_794,
+    geos_warning_795,
+    geos_warning_796,
+    geos_warning_797,
+    geos_warning_798,
+    geos_warning_799,
+    geos_warning_800,
+    geos_warning_801,
+    geos_warning_802,
+    geos_warning_803,
+    geos_warning_804,
+    geos_warning_805,
+    geos_warning_806,
+    geos_warning_807,
+    geos_warning_808,
+    geos_warning_809,
+    geos_warning_810,
+    geos_warning_811,
+    geos_warning_812,
+    geos_warning_813,
+    geos_warning_814,
+    geos_warning_815,
+    geos_warning_816,
+    geos_warning_817,
+    geos_warning_818,
+    geos_warning_819,
+    geos_warning_820,
+    geos_warning_821,
+    geos_warning_822,
+    geos_warning_823,
+    geos_warning_824,
+    geos_warning_825,
+    geos_warning_826,
+    geos_warning_827,
+    geos_warning_828,
+    geos_warning_829,
+    geos_warning_830,
+    geos_warning_831,
+    geos_warning_832,
+    geos_warning_833,
+    geos_warning_834,
+    geos_warning_835,
+    geos_warning_836,
+    geos_warning_837,
+    geos_warning_838,
+    geos_warning_839,
+    geos_warning_840,
+    geos_warning_841,
+    geos_warning_842,
+    geos_warning_843,
+    geos_warning_844,
+    geos_warning_845,
+    geos_warning_846,
+    geos_warning_847,
+    geos_warning_848,
+    geos_warning_849,
+    geos_warning_850,
+    geos_warning_851,
+    geos_warning_852,
+    geos_warning_853,
+    geos_warning_854,
+    geos_warning_855,
+    geos_warning_856,
+    geos_warning_857,
+    geos_warning_858,
+    geos_warning_859,
+    geos_warning_860,
+    geos_warning_861,
+    geos_warning_862,
+    geos_warning_863,
+    geos_warning_864,
+    geos_warning_865,
+    geos_warning_866,
+    geos_warning_867,
+    geos_warning_868,
+    geos_warning_869,
+    geos_warning_870,
+    geos_warning_871,
+    geos_warning_872,
+    geos_warning_873,
+    geos_warning_874,
+    geos_warning_875,
+    geos_warning_876,
+    geos_warning_877,
+    geos_warning_878,
+    geos_warning_879,
+    geos_warning_880,
+    geos_warning_881,
+    geos_warning_882,
+    geos_warning_883,
+    geos_warning_884,
+    geos_warning_885,
+    geos_warning_886,
+    geos_warning_887,
+    geos_warning_888,
+    geos_warning_889,
+    geos_warning_890,
+    geos_warning_891,
+    geos_warning_892,
+    geos_warning_893,
+    geos_warning_894,
+    geos_warning_895,
+    geos_warning_896,
+    geos_warning_897,
+    geos_warning_898,
+    geos_warning_899,
+    geos_warning_900,
+    geos_warning_901,
+    geos_warning_902,
+    geos_warning_903,
+    geos_warning_904,
+    geos_warning_905,
+    geos_warning_906,
+    geos_warning_907,
+    geos_warning_908,
+    geos_warning_909,
+    geos_warning_910,
+    geos_warning_911,
+    geos_warning_912,
+    geos_warning_913,
+    geos_warning_914,
+    geos_warning_915,
+    geos_warning_916,
+    geos_warning_917,
+    geos_warning_918,
+    geos_warning_919,
+    geos_warning_920,
+    geos_warning_921,
+    geos_warning_922,
+    geos_warning_923,
+    geos_warning_924,
+    geos_warning_925,
+    geos_warning_926,
+    geos_warning_927,
+    geos_warning_928,
+    geos_warning_929,
+    geos_warning_930,
+    geos_warning_931,
+    geos_warning_932,
+    geos_warning_933,
+    geos_warning_934,
+    geos_warning_935,
+    geos_warning_936,
+    geos_warning_937,
+    geos_warning_938,
+    geos_warning_939,
+    geos_warning_940,
+    geos_warning_941,
+    geos_warning_942,
+    geos_warning_943,
+    geos_warning_944,
+    geos_warning_945,
+    geos_warning_946,
+    geos_warning_947,
+    geos_warning_948,
+    geos_warning_949,
+    geos_warning_950,
+    geos_warning_951,
+    geos_warning_952,
+    geos_warning_953,
+    geos_warning_954,
+    geos_warning_955,
+    geos_warning_956,
+    geos_warning_957,
+    geos_warning_958,
+    geos_warning_959,
+    geos_warning_960,
+    geos_warning_961,
+    geos_warning_962,
+    geos_warning_963,
+    geos_warning_964,
+    geos_warning_965,
+    geos_warning_966,
+    geos_warning_967,
+    geos_warning_968,
+    geos_warning_969,
+    geos_warning_970,
+    geos_warning_971,
+    geos_warning_972,
+    geos_warning_973,
+    geos_warning_974,
+    geos_warning_975,
+    geos_warning_976,
+    geos_warning_977,
+    geos_warning_978,
+    geos_warning_979,
+    geos_warning_980,
+    geos_warning_981,
+    geos_warning_982,
+    geos_warning_983,
+    geos_warning_984,
+    geos_warning_985,
+    geos_warning_986,
+    geos_warning_987,
+    geos_warning_988,
+    geos_warning_989,
+    geos_warning_990,
+    geos_warning_991,
+    geos_warning_992,
+    geos_warning_993,
+    geos_warning_994,
+    geos_warning_995,
+    geos_warning_996,
+    geos_warning_997,
+    geos_warning_998,
+    geos_warning_999,
+    geos_warning_1000,
+    geos_warning_1001,
+    geos_warning_1002,
+    geos_warning_1003,
+    geos_warning_1004,
+    geos_warning_1005,
+    geos_warning_1006,
+    geos_warning_1007,
+    geos_warning_1008,
+    geos_warning_1009,
+    geos_warning_1010,
+    geos_warning_1011,
+    geos_warning_1012,
+    geos_warning_1013,
+    geos_warning_1014,
+    geos_warning_1015,
+    geos_warning_1016,
+    geos_warning_1017,
+    geos_warning_1018,
+    geos_warning_1019,
+    geos_warning_1020,
+    geos_warning_1021,
+    geos_warning_1022,
+    geos_warning_1023
+};
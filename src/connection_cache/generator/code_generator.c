@@ -75,14 +75,16 @@ main (int argc, char *argv[])
     fprintf (out, "struct splite_connection\n{\n");
     fprintf (out, "/* connections pool */\n");
     fprintf (out, "\tvoid *conn_ptr;\n");
+    fprintf (out, "\tint next_free;\n");
     fprintf (out,
 	     "} splite_connection_pool[" "SPATIALITE_MAX_CONNECTIONS] =\n{\n");
+/* initially all slots are chained into the free list */
     for (i = 0; i < max; i++)
       {
 	  if (i == (max - 1))
-	      fprintf (out, "\t{NULL}\n");
+	      fprintf (out, "\t{NULL, -1}\n");
 	  else
-	      fprintf (out, "\t{NULL},\n");
+	      fprintf (out, "\t{NULL, %d},\n", i + 1);
       }
     fprintf (out, "};\n");
     fclose (out);
@@ -112,6 +114,18 @@ main (int argc, char *argv[])
 	  fprintf (out, "\tgeos_warning_r (%d, fmt, ap);\n", i);
 	  fprintf (out, "\tva_end (ap);\n}\n\n");
       }
+/* slot-indexed tables of handlers */
+    fprintf (out, "static void (*const geos_error_handlers[]) "
+	     "(const char *fmt, ...) = {\n");
+    for (i = 0; i < max; i++)
+	fprintf (out, "\tgeos_error_%d%s\n", i, (i == (max - 1)) ? "" : ",");
+    fprintf (out, "};\n\n");
+    fprintf (out, "static void (*const geos_warning_handlers[]) "
+	     "(const char *fmt, ...) = {\n");
+    for (i = 0; i < max; i++)
+	fprintf (out, "\tgeos_warning_%d%s\n", i,
+		 (i == (max - 1)) ? "" : ",");
+    fprintf (out, "};\n");
     fclose (out);
 
 /* generating "cache_aux_3.h" */
@@ -122,15 +136,10 @@ main (int argc, char *argv[])
 	  return -1;
       }
     fprintf (out, "/* initializing all function pointers */\n");
-    fprintf (out, "\tswitch (cache->pool_index)\n\t{\n");
-    for (i = 0; i < max; i++)
-      {
-	  fprintf (out, "\tcase %d:\n", i);
-	  fprintf (out, "\t\tcache->geos_warning = geos_warning_%d;\n", i);
-	  fprintf (out, "\t\tcache->geos_error = geos_error_%d;\n", i);
-	  fprintf (out, "\t\tbreak;\n");
-      }
-    fprintf (out, "\t};\n\n");
+    fprintf (out,
+	     "\tcache->geos_warning = geos_warning_handlers[cache->pool_index];\n");
+    fprintf (out,
+	     "\tcache->geos_error = geos_error_handlers[cache->pool_index];\n\n");
     fclose (out);
 
     return 0;
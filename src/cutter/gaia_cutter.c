@@ -58,6 +58,7 @@ CIG: 6038019AE5
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <float.h>
 #include <time.h>
 
 #if defined(_WIN32) && !defined(__MINGW32__)
@@ -72,6 +73,15 @@ CIG: 6038019AE5
 #include "config.h"
 #endif
 
+#ifndef OMIT_GEOS		/* including GEOS */
+#ifdef GEOS_REENTRANT
+#ifdef GEOS_ONLY_REENTRANT
+#define GEOS_USE_ONLY_R_API	/* only fully thread-safe GEOS API */
+#endif
+#endif
+#include <geos_c.h>
+#endif
+
 #include <spatialite/sqlite.h>
 #include <spatialite/debug.h>
 
@@ -96,6 +106,10 @@ CIG: 6038019AE5
 #define GAIA_CUTTER_LINESTRING	2
 #define GAIA_CUTTER_POLYGON		3
 
+#define GAIA_CUTTER_MAX_THREADS	64
+#define GAIA_CUTTER_BATCH		16384	/* Input/Blade pairs per parallel batch */
+#define GAIA_CUTTER_TILES		64	/* partitioning grid: tiles per side */
+
 struct output_column
 {
 /* a struct wrapping an Output Table Column */
@@ -138,6 +152,33 @@ struct temporary_row
     struct multivar *last_blade;
 };
 
+struct cached_elementary
+{
+/* a struct wrapping a prepared elementary Input Polygon */
+    double minx;
+    double miny;
+    double maxx;
+    double maxy;
+    GEOSGeometry *geos;
+    const GEOSPreparedGeometry *prepared;
+};
+
+struct cached_input
+{
+/* a struct caching the Input Geometry shared by consecutive Input/Blade pairs */
+    const void *cache;
+    struct temporary_row row;
+    gaiaGeomCollPtr geom;
+    unsigned char *blob;
+    int blob_sz;
+    int prepare_failed;
+    GEOSGeometry *geos;
+    const GEOSPreparedGeometry *prepared;
+    int n_elem;
+    struct cached_elementary *elem;
+    GEOSGeometry *blade_geos;
+};
+
 struct child_row
 {
 /* a struct wrapping a resultset row */
@@ -175,6 +216,54 @@ struct cut_solution
     struct cut_item *last;
 };
 
+struct cut_pair
+{
+/* an Input geometry waiting to be cut against its renoded Blade */
+    sqlite3_int64 pk;
+    unsigned char *blob;
+    int blob_sz;
+    unsigned char *result;
+    int result_sz;
+};
+
+struct cut_blade
+{
+/* a renoded Blade and the range of its pending Input geometries */
+    unsigned char *blob;
+    int blob_sz;
+    int tile;
+    int progr;
+    int first_pair;
+    int n_pairs;
+    int seq;
+};
+
+struct cut_batch
+{
+/* a batch of Input/Blade pairs to be cut (possibly in parallel) */
+    const void *cache;
+    int gpkg_mode;
+    int gpkg_amphibious;
+    int tiny_point;
+    int threads;
+    int n_blades;
+    int max_blades;
+    struct cut_blade *blades;
+    int n_pairs;
+    int max_pairs;
+    struct cut_pair *pairs;
+};
+
+struct cut_job
+{
+/* a spatial partition of the current batch assigned to a single thread */
+    struct cut_batch *batch;
+    const void *p_cache;
+    int own_cache;
+    int first_seq;
+    int last_seq;
+};
+
 static struct multivar *
 alloc_multivar (void)
 {
@@ -1972,6 +2061,125 @@ do_read_blade_geometry (struct output_table *tbl, const void *cache,
     return geom;
 }
 
+static void
+init_cached_input (struct cached_input *cached, const void *cache)
+{
+/* initializing an empty Input Geometry cache */
+    cached->cache = cache;
+    cached->row.first_input = NULL;
+    cached->row.last_input = NULL;
+    cached->row.first_blade = NULL;
+    cached->row.last_blade = NULL;
+    cached->geom = NULL;
+    cached->blob = NULL;
+    cached->blob_sz = 0;
+    cached->prepare_failed = 0;
+    cached->geos = NULL;
+    cached->prepared = NULL;
+    cached->n_elem = 0;
+    cached->elem = NULL;
+    cached->blade_geos = NULL;
+}
+
+static GEOSContextHandle_t
+get_geos_handle (const void *cache)
+{
+/* returning the current GEOS handle (if any) */
+    struct splite_internal_cache *pcache =
+	(struct splite_internal_cache *) cache;
+    if (pcache == NULL)
+	return NULL;
+    if (pcache->magic1 != SPATIALITE_CACHE_MAGIC1
+	|| pcache->magic2 != SPATIALITE_CACHE_MAGIC2)
+	return NULL;
+    return splite_get_geos_handle (pcache);
+}
+
+static void
+free_cached_polygons (struct cached_input *cached)
+{
+/* memory cleanup - releasing all prepared elementary Polygons */
+    int i;
+    GEOSContextHandle_t handle = get_geos_handle (cached->cache);
+    if (cached->elem == NULL)
+	return;
+    if (handle != NULL)
+      {
+	  for (i = 0; i < cached->n_elem; i++)
+	    {
+		struct cached_elementary *elem = cached->elem + i;
+		if (elem->prepared != NULL)
+		    GEOSPreparedGeom_destroy_r (handle, elem->prepared);
+		if (elem->geos != NULL)
+		    GEOSGeom_destroy_r (handle, elem->geos);
+	    }
+      }
+    free (cached->elem);
+    cached->elem = NULL;
+    cached->n_elem = 0;
+}
+
+static void
+reset_cached_input (struct cached_input *cached)
+{
+/* memory cleanup - resetting the Input Geometry cache */
+    GEOSContextHandle_t handle = get_geos_handle (cached->cache);
+    reset_temporary_row (&(cached->row));
+    if (cached->geom != NULL)
+	gaiaFreeGeomColl (cached->geom);
+    if (handle != NULL)
+      {
+	  if (cached->blade_geos != NULL)
+	      GEOSGeom_destroy_r (handle, cached->blade_geos);
+	  if (cached->prepared != NULL)
+	      GEOSPreparedGeom_destroy_r (handle, cached->prepared);
+	  if (cached->geos != NULL)
+	      GEOSGeom_destroy_r (handle, cached->geos);
+      }
+    free_cached_polygons (cached);
+    init_cached_input (cached, cached->cache);
+}
+
+static gaiaGeomCollPtr
+do_read_cached_input_geometry (struct output_table *tbl, const void *cache,
+			       sqlite3_stmt * stmt_in, sqlite3 * handle,
+			       struct temporary_row *row,
+			       struct cached_input *cached, char **message,
+			       unsigned char **blob, int *blob_sz)
+{
+/* 
+/ reading an Input Geometry
+/
+/ the main loop is driven by the Input table, so all Blades
+/ matching the same Input come out as consecutive rows: the
+/ Input Geometry is fetched and decoded just once for the
+/ whole group and then reused until the Input PK changes.
+/ the returned Geometry is owned by the cache and the BLOB
+/ remains valid until stmt_in is stepped again
+*/
+    gaiaGeomCollPtr geom;
+
+    if (cached->geom != NULL && check_same_input (&(cached->row), row))
+      {
+	  /* cache hit */
+	  *blob = cached->blob;
+	  *blob_sz = cached->blob_sz;
+	  return cached->geom;
+      }
+
+    reset_cached_input (cached);
+    geom =
+	do_read_input_geometry (tbl, cache, stmt_in, handle, row, message,
+				blob, blob_sz);
+    if (geom == NULL)
+	return NULL;
+    copy_input_values (row, &(cached->row));
+    cached->geom = geom;
+    cached->blob = *blob;
+    cached->blob_sz = *blob_sz;
+    return geom;
+}
+
 static gaiaGeomCollPtr
 do_prepare_point (gaiaPointPtr pt, int srid)
 {
@@ -2859,6 +3067,229 @@ is_covered_by (const void *cache, gaiaGeomCollPtr input_g,
 					  blade_blob_sz);
 }
 
+static void
+release_cached_blade (struct cached_input *cached)
+{
+/* memory cleanup - releasing the GEOS copy of the current Blade */
+    GEOSContextHandle_t handle = get_geos_handle (cached->cache);
+    if (handle != NULL && cached->blade_geos != NULL)
+	GEOSGeom_destroy_r (handle, cached->blade_geos);
+    cached->blade_geos = NULL;
+}
+
+static GEOSGeometry *
+get_cached_blade (struct cached_input *cached, gaiaGeomCollPtr blade_g)
+{
+/* converting the current Blade into GEOS (just once per Input/Blade pair) */
+    if (cached->blade_geos == NULL)
+	cached->blade_geos = gaiaToGeos_r (cached->cache, blade_g);
+    return cached->blade_geos;
+}
+
+static int
+do_prepare_cached_input (struct cached_input *cached)
+{
+/* preparing the cached Input Geometry (just once per Input) */
+    GEOSContextHandle_t handle;
+    if (cached->prepared != NULL)
+	return 1;
+    if (cached->prepare_failed || cached->geom == NULL)
+	return 0;
+    handle = get_geos_handle (cached->cache);
+    if (handle == NULL)
+	goto error;
+    cached->geos = gaiaToGeos_r (cached->cache, cached->geom);
+    if (cached->geos == NULL)
+	goto error;
+    cached->prepared = GEOSPrepare_r (handle, cached->geos);
+    if (cached->prepared == NULL)
+	goto error;
+    return 1;
+
+  error:
+    cached->prepare_failed = 1;
+    return 0;
+}
+
+static int
+do_prepare_cached_polygons (struct cached_input *cached)
+{
+/* preparing all elementary Polygons of the cached Input (just once per Input) */
+    GEOSContextHandle_t handle;
+    gaiaPolygonPtr pg;
+    int i;
+    if (cached->prepare_failed)
+	return 0;
+    if (cached->elem != NULL)
+	return 1;
+    if (!do_prepare_cached_input (cached))
+	return 0;
+    handle = get_geos_handle (cached->cache);
+
+    pg = cached->geom->FirstPolygon;
+    while (pg != NULL)
+      {
+	  cached->n_elem += 1;
+	  pg = pg->Next;
+      }
+    if (cached->n_elem == 0)
+	goto error;
+    cached->elem = malloc (sizeof (struct cached_elementary) * cached->n_elem);
+    for (i = 0; i < cached->n_elem; i++)
+      {
+	  cached->elem[i].geos = NULL;
+	  cached->elem[i].prepared = NULL;
+      }
+
+    i = 0;
+    pg = cached->geom->FirstPolygon;
+    while (pg != NULL)
+      {
+	  struct cached_elementary *elem = cached->elem + i;
+	  gaiaGeomCollPtr pg_geom = do_prepare_polygon (pg, cached->geom->Srid);
+	  if (gaiaIsToxic_r (cached->cache, pg_geom))
+	    {
+		gaiaFreeGeomColl (pg_geom);
+		goto error;
+	    }
+	  elem->minx = pg_geom->MinX;
+	  elem->miny = pg_geom->MinY;
+	  elem->maxx = pg_geom->MaxX;
+	  elem->maxy = pg_geom->MaxY;
+	  elem->geos = gaiaToGeos_r (cached->cache, pg_geom);
+	  gaiaFreeGeomColl (pg_geom);
+	  if (elem->geos == NULL)
+	      goto error;
+	  elem->prepared = GEOSPrepare_r (handle, elem->geos);
+	  if (elem->prepared == NULL)
+	      goto error;
+	  i++;
+	  pg = pg->Next;
+      }
+    return 1;
+
+  error:
+    free_cached_polygons (cached);
+    cached->prepare_failed = 1;
+    return 0;
+}
+
+static int
+is_input_covered_by_blade (struct cached_input *cached,
+			   gaiaGeomCollPtr blade_g, unsigned char *blade_blob,
+			   int blade_blob_sz)
+{
+/* testing if the Input geometry is completely Covered By the Blade Geometry */
+    int ret;
+    GEOSGeometry *g_blade;
+    gaiaGeomCollPtr input_g = cached->geom;
+    if (!do_prepare_cached_input (cached))
+	return is_covered_by (cached->cache, input_g, cached->blob,
+			      cached->blob_sz, blade_g, blade_blob,
+			      blade_blob_sz);
+    gaiaResetGeosMsg_r (cached->cache);
+
+/* quick check based on MBRs comparison */
+    if (input_g->MinX < blade_g->MinX || input_g->MaxX > blade_g->MaxX
+	|| input_g->MinY < blade_g->MinY || input_g->MaxY > blade_g->MaxY)
+	return 0;
+
+    g_blade = get_cached_blade (cached, blade_g);
+    if (g_blade == NULL)
+	return -1;
+    ret =
+	GEOSPreparedCoveredBy_r (get_geos_handle (cached->cache),
+				 cached->prepared, g_blade);
+    if (ret == 2)
+	return -1;
+    return ret;
+}
+
+static int
+is_blade_covered_by_input (struct cached_input *cached,
+			   gaiaGeomCollPtr blade_g, unsigned char *blade_blob,
+			   int blade_blob_sz)
+{
+/* testing if the Blade geometry is completely Covered By the Input Geometry */
+    int ret;
+    GEOSGeometry *g_blade;
+    gaiaGeomCollPtr input_g = cached->geom;
+    if (!do_prepare_cached_input (cached))
+	return is_covered_by (cached->cache, blade_g, blade_blob,
+			      blade_blob_sz, input_g, cached->blob,
+			      cached->blob_sz);
+    gaiaResetGeosMsg_r (cached->cache);
+
+/* quick check based on MBRs comparison */
+    if (blade_g->MinX < input_g->MinX || blade_g->MaxX > input_g->MaxX
+	|| blade_g->MinY < input_g->MinY || blade_g->MaxY > input_g->MaxY)
+	return 0;
+
+    g_blade = get_cached_blade (cached, blade_g);
+    if (g_blade == NULL)
+	return -1;
+    ret =
+	GEOSPreparedCovers_r (get_geos_handle (cached->cache),
+			      cached->prepared, g_blade);
+    if (ret == 2)
+	return -1;
+    return ret;
+}
+
+static int
+is_input_polygon_intersecting_blade (struct cached_input *cached,
+				     gaiaPolygonPtr pg, int ipg,
+				     gaiaGeomCollPtr blade_g,
+				     unsigned char *blade_blob,
+				     int blade_blob_sz)
+{
+/* testing if an elementary Input Polygon intersects the Blade Geometry */
+    struct cached_elementary *elem;
+    GEOSGeometry *g_blade;
+
+    if (!do_prepare_cached_polygons (cached))
+      {
+	  /* fallback: evaluating the elementary Polygon on the fly */
+	  int ret;
+	  unsigned char *pg_blob;
+	  int pg_blob_sz;
+	  int gpkg_mode = 0;
+	  gaiaGeomCollPtr pg_geom;
+	  if (cached->cache != NULL)
+	    {
+		struct splite_internal_cache *pcache =
+		    (struct splite_internal_cache *) (cached->cache);
+		gpkg_mode = pcache->gpkg_mode;
+	    }
+	  pg_geom = do_prepare_polygon (pg, cached->geom->Srid);
+	  gaiaToSpatiaLiteBlobWkbEx2 (pg_geom, &pg_blob, &pg_blob_sz,
+				      gpkg_mode, 0);
+	  ret =
+	      gaiaGeomCollPreparedIntersects (cached->cache, pg_geom, pg_blob,
+					      pg_blob_sz, blade_g, blade_blob,
+					      blade_blob_sz);
+	  free (pg_blob);
+	  gaiaFreeGeomColl (pg_geom);
+	  return ret;
+      }
+
+    gaiaResetGeosMsg_r (cached->cache);
+    if (gaiaIsToxic_r (cached->cache, blade_g))
+	return -1;
+
+/* quick check based on MBRs comparison */
+    elem = cached->elem + ipg;
+    if (elem->maxx < blade_g->MinX || elem->minx > blade_g->MaxX
+	|| elem->maxy < blade_g->MinY || elem->miny > blade_g->MaxY)
+	return 0;
+
+    g_blade = get_cached_blade (cached, blade_g);
+    if (g_blade == NULL)
+	return -1;
+    return GEOSPreparedIntersects_r (get_geos_handle (cached->cache),
+				     elem->prepared, g_blade);
+}
+
 static int
 do_insert_temporary_linestrings (struct output_table *tbl, sqlite3 * handle,
 				 const void *cache, sqlite3_stmt * stmt_out,
@@ -2987,7 +3418,7 @@ do_insert_temporary_linestrings (struct output_table *tbl, sqlite3 * handle,
 	    {
 		do_update_message (message,
 				   "UNEXPECTED NULL TEMPORARY LINESTRING BLOB GEOMETRY");
-		gaiaFreeGeomColl (geom);
+		gaiaFreeGeomColl (g);
 		return 0;
 	    }
 	  sqlite3_bind_blob (stmt_out, icol, blob, size, free);
@@ -3214,6 +3645,7 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
     sqlite3_stmt *stmt_blade = NULL;
     sqlite3_stmt *stmt_tmp = NULL;
     sqlite3_stmt *stmt_nodes = NULL;
+    struct cached_input cached_input;
     char *xprefix;
     char *xtable;
     char *xcolumn;
@@ -3224,6 +3656,7 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
     int cast2d = 0;
     int cast3d = 0;
 
+    init_cached_input (&cached_input, cache);
     switch (type)
       {
       case GAIA_LINESTRINGM:
@@ -3576,11 +4009,16 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
 
 		/* reading the Input Geometry */
 		input_g =
-		    do_read_input_geometry (tbl, cache, stmt_input, handle,
-					    &row, message, &input_blob,
-					    &input_blob_sz);
+		    do_read_cached_input_geometry (tbl, cache, stmt_input,
+						   handle, &row,
+						   &cached_input, message,
+						   &input_blob,
+						   &input_blob_sz);
 		if (input_g == NULL)
-		    goto error;
+		  {
+		      reset_temporary_row (&row);
+		      goto error;
+		  }
 
 		if (is_null_blade (&row))
 		  {
@@ -3590,7 +4028,6 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
 			   message, -1))
 			{
 			    reset_temporary_row (&row);
-			    gaiaFreeGeomColl (input_g);
 			    goto error;
 			}
 		      goto skip;
@@ -3604,9 +4041,8 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
 		if (blade_g == NULL)
 		    goto error;
 
-		if (is_covered_by
-		    (cache, input_g, input_blob, input_blob_sz, blade_g,
-		     blade_blob, blade_blob_sz))
+		if (is_input_covered_by_blade
+		    (&cached_input, blade_g, blade_blob, blade_blob_sz))
 		  {
 		      /* Input is completely Covered By Blade */
 		      if (!do_insert_temporary_linestrings
@@ -3614,7 +4050,6 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
 			   message, -1))
 			{
 			    reset_temporary_row (&row);
-			    gaiaFreeGeomColl (input_g);
 			    gaiaFreeGeomColl (blade_g);
 			    goto error;
 			}
@@ -3639,7 +4074,6 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
 				 nodes, message))
 			      {
 				  reset_temporary_row (&row);
-				  gaiaFreeGeomColl (input_g);
 				  gaiaFreeGeomColl (blade_g);
 				  gaiaFreeGeomColl (linear_blade_g);
 				  gaiaFreeGeomColl (nodes);
@@ -3652,8 +4086,8 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
 		gaiaFreeGeomColl (linear_blade_g);
 
 	      skip:
+		release_cached_blade (&cached_input);
 		reset_temporary_row (&row);
-		gaiaFreeGeomColl (input_g);
 		gaiaFreeGeomColl (blade_g);
 	    }
 	  else
@@ -3665,6 +4099,7 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
 	    }
       }
 
+    reset_cached_input (&cached_input);
     sqlite3_finalize (stmt_main);
     sqlite3_finalize (stmt_input);
     sqlite3_finalize (stmt_blade);
@@ -3673,6 +4108,7 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
     return 1;
 
   error:
+    reset_cached_input (&cached_input);
     if (stmt_main == NULL)
 	sqlite3_finalize (stmt_main);
     if (stmt_input == NULL)
@@ -3686,57 +4122,445 @@ do_populate_temp_linestrings (struct output_table *tbl, sqlite3 * handle,
     return 0;
 }
 
+static void
+init_cut_batch (struct cut_batch *batch, const void *cache, int threads)
+{
+/* initializing an empty batch of Input/Blade pairs */
+    batch->cache = cache;
+    batch->gpkg_mode = 0;
+    batch->gpkg_amphibious = 0;
+    batch->tiny_point = 0;
+    if (cache != NULL)
+      {
+	  struct splite_internal_cache *pcache =
+	      (struct splite_internal_cache *) cache;
+	  batch->gpkg_amphibious = pcache->gpkg_amphibious_mode;
+	  batch->gpkg_mode = pcache->gpkg_mode;
+	  batch->tiny_point = pcache->tinyPointEnabled;
+      }
+    if (threads <= 0)
+	threads = splite_cpu_count (GAIA_CUTTER_MAX_THREADS);
+    if (threads > GAIA_CUTTER_MAX_THREADS)
+	threads = GAIA_CUTTER_MAX_THREADS;
+    batch->threads = threads;
+    batch->n_blades = 0;
+    batch->max_blades = 0;
+    batch->blades = NULL;
+    batch->n_pairs = 0;
+    batch->max_pairs = 0;
+    batch->pairs = NULL;
+}
+
+static void
+reset_cut_batch (struct cut_batch *batch)
+{
+/* memory cleanup - emptying a batch of Input/Blade pairs */
+    int i;
+    for (i = 0; i < batch->n_blades; i++)
+      {
+	  if (batch->blades[i].blob != NULL)
+	      free (batch->blades[i].blob);
+      }
+    for (i = 0; i < batch->n_pairs; i++)
+      {
+	  if (batch->pairs[i].blob != NULL)
+	      free (batch->pairs[i].blob);
+	  if (batch->pairs[i].result != NULL)
+	      free (batch->pairs[i].result);
+      }
+    batch->n_blades = 0;
+    batch->n_pairs = 0;
+}
+
+static void
+free_cut_batch (struct cut_batch *batch)
+{
+/* memory cleanup - destroying a batch of Input/Blade pairs */
+    reset_cut_batch (batch);
+    if (batch->blades != NULL)
+	free (batch->blades);
+    if (batch->pairs != NULL)
+	free (batch->pairs);
+    batch->blades = NULL;
+    batch->pairs = NULL;
+    batch->max_blades = 0;
+    batch->max_pairs = 0;
+}
+
+static void
+add_cut_blade (struct cut_batch *batch, const unsigned char *blob,
+	       int blob_sz)
+{
+/* appending a renoded Blade to the current batch */
+    struct cut_blade *blade;
+    if (batch->n_blades == batch->max_blades)
+      {
+	  batch->max_blades =
+	      (batch->max_blades == 0) ? 256 : batch->max_blades * 2;
+	  batch->blades =
+	      realloc (batch->blades,
+		       sizeof (struct cut_blade) * batch->max_blades);
+      }
+    blade = batch->blades + batch->n_blades;
+    blade->blob = malloc (blob_sz);
+    memcpy (blade->blob, blob, blob_sz);
+    blade->blob_sz = blob_sz;
+    blade->tile = 0;
+    blade->progr = batch->n_blades;
+    blade->first_pair = batch->n_pairs;
+    blade->n_pairs = 0;
+    blade->seq = 0;
+    batch->n_blades += 1;
+}
+
+static void
+add_cut_pair (struct cut_batch *batch, sqlite3_int64 pk,
+	      const unsigned char *blob, int blob_sz)
+{
+/* appending an Input geometry to be cut against the last Blade */
+    struct cut_pair *pair;
+    if (batch->n_pairs == batch->max_pairs)
+      {
+	  batch->max_pairs =
+	      (batch->max_pairs == 0) ? 1024 : batch->max_pairs * 2;
+	  batch->pairs =
+	      realloc (batch->pairs,
+		       sizeof (struct cut_pair) * batch->max_pairs);
+      }
+    pair = batch->pairs + batch->n_pairs;
+    pair->pk = pk;
+    pair->blob = malloc (blob_sz);
+    memcpy (pair->blob, blob, blob_sz);
+    pair->blob_sz = blob_sz;
+    pair->result = NULL;
+    pair->result_sz = 0;
+    batch->n_pairs += 1;
+    batch->blades[batch->n_blades - 1].n_pairs += 1;
+}
+
 static int
-do_update_tmp_cut_linestring (sqlite3 * handle, sqlite3_stmt * stmt_upd,
-			      sqlite3_int64 pk, const unsigned char *blob,
-			      int blob_sz, char **message)
+cmp_cut_blades (const void *p1, const void *p2)
 {
-/* saving an Input Linestring cut against a renoded Blade */
+/* sorting Blades by partitioning Tile */
+    const struct cut_blade *b1 = (const struct cut_blade *) p1;
+    const struct cut_blade *b2 = (const struct cut_blade *) p2;
+    if (b1->tile != b2->tile)
+	return (b1->tile < b2->tile) ? -1 : 1;
+    if (b1->progr == b2->progr)
+	return 0;
+    return (b1->progr < b2->progr) ? -1 : 1;
+}
+
+static int
+cmp_cut_pairs (const void *p1, const void *p2)
+{
+/* sorting Input/Blade pairs by TMP ROWID */
+    const struct cut_pair *c1 = (const struct cut_pair *) p1;
+    const struct cut_pair *c2 = (const struct cut_pair *) p2;
+    if (c1->pk == c2->pk)
+	return 0;
+    return (c1->pk < c2->pk) ? -1 : 1;
+}
+
+static void
+do_partition_cut_batch (struct cut_batch *batch)
+{
+/*
+/ spatially partitioning the current batch
+/
+/ Blades are assigned to the Tiles of a regular grid covering the
+/ whole batch (accordingly to the center of their MBR) and then
+/ sorted by Tile, so that each thread will receive a contiguous
+/ and spatially compact range of Input/Blade pairs
+*/
+    int i;
+    int seq = 0;
+    double minx = DBL_MAX;
+    double miny = DBL_MAX;
+    double maxx = -DBL_MAX;
+    double maxy = -DBL_MAX;
+    double *cx = malloc (sizeof (double) * batch->n_blades);
+    double *cy = malloc (sizeof (double) * batch->n_blades);
+    double tile_w;
+    double tile_h;
+
+    for (i = 0; i < batch->n_blades; i++)
+      {
+	  struct cut_blade *blade = batch->blades + i;
+	  double x0;
+	  double y0;
+	  double x1;
+	  double y1;
+	  if (!gaiaGetMbrMinX (blade->blob, blade->blob_sz, &x0)
+	      || !gaiaGetMbrMinY (blade->blob, blade->blob_sz, &y0)
+	      || !gaiaGetMbrMaxX (blade->blob, blade->blob_sz, &x1)
+	      || !gaiaGetMbrMaxY (blade->blob, blade->blob_sz, &y1))
+	    {
+		x0 = 0.0;
+		y0 = 0.0;
+		x1 = 0.0;
+		y1 = 0.0;
+	    }
+	  cx[i] = (x0 + x1) / 2.0;
+	  cy[i] = (y0 + y1) / 2.0;
+	  if (cx[i] < minx)
+	      minx = cx[i];
+	  if (cx[i] > maxx)
+	      maxx = cx[i];
+	  if (cy[i] < miny)
+	      miny = cy[i];
+	  if (cy[i] > maxy)
+	      maxy = cy[i];
+      }
+    tile_w = (maxx - minx) / GAIA_CUTTER_TILES;
+    tile_h = (maxy - miny) / GAIA_CUTTER_TILES;
+    for (i = 0; i < batch->n_blades; i++)
+      {
+	  int row = 0;
+	  int col = 0;
+	  if (tile_w > 0.0)
+	      col = (int) ((cx[i] - minx) / tile_w);
+	  if (tile_h > 0.0)
+	      row = (int) ((cy[i] - miny) / tile_h);
+	  if (col < 0)
+	      col = 0;
+	  if (col >= GAIA_CUTTER_TILES)
+	      col = GAIA_CUTTER_TILES - 1;
+	  if (row < 0)
+	      row = 0;
+	  if (row >= GAIA_CUTTER_TILES)
+	      row = GAIA_CUTTER_TILES - 1;
+	  batch->blades[i].tile = (row * GAIA_CUTTER_TILES) + col;
+      }
+    free (cx);
+    free (cy);
+    qsort (batch->blades, batch->n_blades, sizeof (struct cut_blade),
+	   cmp_cut_blades);
+    for (i = 0; i < batch->n_blades; i++)
+      {
+	  batch->blades[i].seq = seq;
+	  seq += batch->blades[i].n_pairs;
+      }
+}
+
+static void
+do_cut_job (struct cut_job *job)
+{
+/* cutting a range of Input/Blade pairs - may run on a worker thread */
+    struct cut_batch *batch = job->batch;
+    GEOSContextHandle_t handle = get_geos_handle (job->p_cache);
+    int ib;
+
+    for (ib = 0; ib < batch->n_blades; ib++)
+      {
+	  struct cut_blade *blade = batch->blades + ib;
+	  gaiaGeomCollPtr blade_g;
+	  GEOSGeometry *g_blade = NULL;
+	  const GEOSPreparedGeometry *prepared = NULL;
+	  int first = blade->seq;
+	  int last = blade->seq + blade->n_pairs;
+	  int ip;
+	  if (first < job->first_seq)
+	      first = job->first_seq;
+	  if (last > job->last_seq)
+	      last = job->last_seq;
+	  if (first >= last)
+	      continue;		/* not belonging to this partition */
+
+	  blade_g =
+	      gaiaFromSpatiaLiteBlobWkbEx (blade->blob, blade->blob_sz,
+					   batch->gpkg_mode,
+					   batch->gpkg_amphibious);
+	  if (blade_g == NULL)
+	      continue;
+	  if (handle != NULL)
+	    {
+		/* each thread prepares its own copy of the Blade */
+		g_blade = gaiaToGeos_r (job->p_cache, blade_g);
+		if (g_blade != NULL)
+		    prepared = GEOSPrepare_r (handle, g_blade);
+	    }
+	  for (ip = first; ip < last; ip++)
+	    {
+		struct cut_pair *pair =
+		    batch->pairs + blade->first_pair + (ip - blade->seq);
+		gaiaGeomCollPtr input_g;
+		gaiaGeomCollPtr result;
+		input_g =
+		    gaiaFromSpatiaLiteBlobWkbEx (pair->blob, pair->blob_sz,
+						 batch->gpkg_mode,
+						 batch->gpkg_amphibious);
+		if (input_g == NULL)
+		    continue;
+		if (input_g->MaxX < blade_g->MinX
+		    || input_g->MinX > blade_g->MaxX
+		    || input_g->MaxY < blade_g->MinY
+		    || input_g->MinY > blade_g->MaxY)
+		  {
+		      /* quick check based on MBRs comparison */
+		      gaiaFreeGeomColl (input_g);
+		      continue;
+		  }
+		if (prepared != NULL)
+		  {
+		      /* skipping disjoint pairs: their intersection is empty */
+		      GEOSGeometry *g_input = gaiaToGeos_r (job->p_cache,
+							    input_g);
+		      int ret = 1;
+		      if (g_input != NULL)
+			{
+			    ret =
+				GEOSPreparedIntersects_r (handle, prepared,
+							  g_input);
+			    GEOSGeom_destroy_r (handle, g_input);
+			}
+		      if (ret == 0)
+			{
+			    gaiaFreeGeomColl (input_g);
+			    continue;
+			}
+		  }
+		result = gaiaGeometryIntersection_r (job->p_cache, input_g,
+						     blade_g);
+		if (result != NULL)
+		  {
+		      gaiaToSpatiaLiteBlobWkbEx2 (result, &(pair->result),
+						  &(pair->result_sz),
+						  batch->gpkg_mode,
+						  batch->tiny_point);
+		      gaiaFreeGeomColl (result);
+		  }
+		gaiaFreeGeomColl (input_g);
+	    }
+	  if (prepared != NULL)
+	      GEOSPreparedGeom_destroy_r (handle, prepared);
+	  if (g_blade != NULL)
+	      GEOSGeom_destroy_r (handle, g_blade);
+	  gaiaFreeGeomColl (blade_g);
+      }
+}
+
+static void
+cut_thread (void *arg)
+{
+/* the worker thread */
+    do_cut_job ((struct cut_job *) arg);
+}
+
+static void
+do_run_cut_batch (struct cut_batch *batch)
+{
+/* cutting all pairs of the current batch - one partition per thread */
+    struct cut_job jobs[GAIA_CUTTER_MAX_THREADS];
+    void *threads[GAIA_CUTTER_MAX_THREADS];
+    int num_jobs = batch->threads;
+    int i;
+
+    if (batch->n_pairs == 0)
+	return;
+    if (batch->cache == NULL)
+	num_jobs = 1;		/* GEOS is thread-safe only when using distinct contexts */
+    if (num_jobs > batch->n_pairs)
+	num_jobs = batch->n_pairs;
+    if (num_jobs > 1)
+	do_partition_cut_batch (batch);
+    else
+      {
+	  batch->blades[0].seq = 0;
+	  for (i = 1; i < batch->n_blades; i++)
+	      batch->blades[i].seq =
+		  batch->blades[i - 1].seq + batch->blades[i - 1].n_pairs;
+      }
+    for (i = 0; i < num_jobs; i++)
+      {
+	  struct cut_job *job = jobs + i;
+	  job->batch = batch;
+	  job->p_cache = batch->cache;
+	  job->own_cache = 0;
+	  job->first_seq =
+	      (int) (((sqlite3_int64) batch->n_pairs * i) / num_jobs);
+	  job->last_seq =
+	      (int) (((sqlite3_int64) batch->n_pairs * (i + 1)) / num_jobs);
+	  threads[i] = NULL;
+	  if (i == 0)
+	      continue;		/* the first partition always runs on this thread */
+	  job->p_cache = spatialite_alloc_connection ();
+	  if (job->p_cache == NULL)
+	    {
+		/* no free connection slot: running on this thread */
+		job->p_cache = batch->cache;
+		continue;
+	    }
+	  job->own_cache = 1;
+	  threads[i] = splite_thread_start (cut_thread, job);
+      }
+    do_cut_job (jobs);
+    for (i = 1; i < num_jobs; i++)
+      {
+	  if (threads[i] == NULL)
+	    {
+		/* no thread available: running on this thread */
+		do_cut_job (jobs + i);
+	    }
+	  else
+	      splite_thread_join (threads[i]);
+	  if (jobs[i].own_cache)
+	      spatialite_internal_cleanup (jobs[i].p_cache);
+      }
+}
+
+static int
+do_flush_cut_batch (sqlite3 * handle, struct cut_batch *batch,
+		    sqlite3_stmt * stmt_upd, const char *what,
+		    char **message)
+{
+/*
+/ cutting all pending pairs and saving the results into the TMP table
+/
+/ results are always written in TMP ROWID order, so that the
+/ final Output doesn't depend on the number of threads
+*/
     int ret;
+    int i;
 
+    do_run_cut_batch (batch);
+    qsort (batch->pairs, batch->n_pairs, sizeof (struct cut_pair),
+	   cmp_cut_pairs);
+    for (i = 0; i < batch->n_pairs; i++)
+      {
+	  struct cut_pair *pair = batch->pairs + i;
+	  if (pair->result == NULL)
+	      continue;
+	  sqlite3_reset (stmt_upd);
+	  sqlite3_clear_bindings (stmt_upd);
+	  sqlite3_bind_blob (stmt_upd, 1, pair->result, pair->result_sz,
+			     SQLITE_STATIC);
+	  sqlite3_bind_int64 (stmt_upd, 2, pair->pk);
+	  ret = sqlite3_step (stmt_upd);
+	  if (ret == SQLITE_DONE || ret == SQLITE_ROW)
+	      continue;
+	  /* some error occurred */
+	  do_update_sql_error (message, what, sqlite3_errmsg (handle));
+	  reset_cut_batch (batch);
+	  return 0;
+      }
     sqlite3_reset (stmt_upd);
     sqlite3_clear_bindings (stmt_upd);
-/* binding the cut Input geometry */
-    sqlite3_bind_blob (stmt_upd, 1, blob, blob_sz, free);
-    sqlite3_bind_int64 (stmt_upd, 2, pk);
-    /* updating the TMP table */
-    ret = sqlite3_step (stmt_upd);
-    if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-	return 1;
-
-    /* some error occurred */
-    do_update_sql_error (message,
-			 "step: UPDATE TMP SET cut-Polygon",
-			 sqlite3_errmsg (handle));
-    return 0;
+    reset_cut_batch (batch);
+    return 1;
 }
 
 static int
-do_cut_tmp_linestrings (sqlite3 * handle, const void *cache,
-			sqlite3_stmt * stmt_in, sqlite3_stmt * stmt_upd,
-			struct temporary_row *row, char **message,
-			const unsigned char *blade_blob, int blade_blob_sz)
+do_collect_cut_pairs (sqlite3 * handle, sqlite3_stmt * stmt_in,
+		      sqlite3_stmt * stmt_upd, struct temporary_row *row,
+		      struct cut_batch *batch, const char *what,
+		      char **message, const unsigned char *blade_blob,
+		      int blade_blob_sz)
 {
-/* cutting all Input Linestrings intersecting the renoded Blade */
+/* queuing all Input geometries intersecting the renoded Blade */
     int ret;
     struct multivar *var;
     int icol = 1;
-    gaiaGeomCollPtr blade_g;
-    int gpkg_amphibious = 0;
-    int gpkg_mode = 0;
-    int tiny_point = 0;
-
-    if (cache != NULL)
-      {
-	  struct splite_internal_cache *pcache =
-	      (struct splite_internal_cache *) cache;
-	  gpkg_amphibious = pcache->gpkg_amphibious_mode;
-	  gpkg_mode = pcache->gpkg_mode;
-	  tiny_point = pcache->tinyPointEnabled;
-      }
-
-    blade_g = gaiaFromSpatiaLiteBlobWkbEx (blade_blob, blade_blob_sz,
-					   gpkg_mode, gpkg_amphibious);
 
     sqlite3_reset (stmt_in);
     sqlite3_clear_bindings (stmt_in);
@@ -3766,61 +4590,41 @@ do_cut_tmp_linestrings (sqlite3 * handle, const void *cache,
 	  var = var->next;
       }
 
+    add_cut_blade (batch, blade_blob, blade_blob_sz);
     while (1)
       {
-	  /* scrolling the result set rows - cut Linestrings */
+	  /* scrolling the result set rows - Input geometries */
 	  ret = sqlite3_step (stmt_in);
 	  if (ret == SQLITE_DONE)
 	      break;		/* end of result set */
 	  if (ret == SQLITE_ROW)
 	    {
 		/* fetched one row from the resultset */
-		sqlite3_int64 pk = 0;
-		unsigned char *blob = NULL;
-		int blob_sz = 0;
-		gaiaGeomCollPtr input_g;
-		gaiaGeomCollPtr result;
 		if (sqlite3_column_type (stmt_in, 0) == SQLITE_INTEGER
 		    && sqlite3_column_type (stmt_in, 1) == SQLITE_BLOB)
 		  {
-		      pk = sqlite3_column_int64 (stmt_in, 0);
-		      blob =
-			  (unsigned char *) sqlite3_column_blob (stmt_in, 1);
-		      blob_sz = sqlite3_column_bytes (stmt_in, 1);
-		      input_g = gaiaFromSpatiaLiteBlobWkbEx (blob, blob_sz,
-							     gpkg_mode,
-							     gpkg_amphibious);
-		      result =
-			  gaiaGeometryIntersection_r (cache, input_g,
-						      blade_g);
-		      if (result != NULL)
+		      if (batch->n_pairs >= GAIA_CUTTER_BATCH)
 			{
-			    gaiaToSpatiaLiteBlobWkbEx2 (result, &blob,
-							&blob_sz, gpkg_mode,
-							tiny_point);
-			    gaiaFreeGeomColl (result);
-			    if (!do_update_tmp_cut_linestring
-				(handle, stmt_upd, pk, blob, blob_sz,
-				 message))
-				goto error;
+			    /* the batch is full: cutting all pending pairs */
+			    if (!do_flush_cut_batch
+				(handle, batch, stmt_upd, what, message))
+				return 0;
+			    add_cut_blade (batch, blade_blob, blade_blob_sz);
 			}
-		      gaiaFreeGeomColl (input_g);
+		      add_cut_pair (batch, sqlite3_column_int64 (stmt_in, 0),
+				    sqlite3_column_blob (stmt_in, 1),
+				    sqlite3_column_bytes (stmt_in, 1));
 		  }
 	    }
 	  else
 	    {
-		do_update_sql_error (message,
-				     "step: cut Linestrings",
-				     sqlite3_errmsg (handle));
-		goto error;
+		do_update_sql_error (message, what, sqlite3_errmsg (handle));
+		return 0;
 	    }
       }
-    gaiaFreeGeomColl (blade_g);
+    if (batch->n_pairs >= GAIA_CUTTER_BATCH)
+	return do_flush_cut_batch (handle, batch, stmt_upd, what, message);
     return 1;
-
-  error:
-    gaiaFreeGeomColl (blade_g);
-    return 0;
 }
 
 static int
@@ -3829,7 +4633,7 @@ do_split_linestrings (struct output_table *tbl, sqlite3 * handle,
 		      const char *input_table, const char *input_geom,
 		      const char *blade_db_prefix, const char *blade_table,
 		      const char *blade_geom, const char *tmp_table,
-		      char **message)
+		      int threads, char **message)
 {
 /* cutting all Input Linestrings intersecting some Blade */
     int ret;
@@ -3844,6 +4648,9 @@ do_split_linestrings (struct output_table *tbl, sqlite3 * handle,
     char *prev;
     struct output_column *col;
     int comma = 0;
+    struct cut_batch batch;
+
+    init_cut_batch (&batch, cache, threads);
 
 /* composing the SQL statement - SELECT FROM Blades */
     sql = sqlite3_mprintf ("SELECT");
@@ -4112,10 +4919,10 @@ do_split_linestrings (struct output_table *tbl, sqlite3 * handle,
 		      const unsigned char *blob =
 			  sqlite3_column_blob (stmt_blades, icol);
 		      int blob_sz = sqlite3_column_bytes (stmt_blades, icol);
-		      /* cutting all Input geoms intersecting the Blade */
-		      if (!do_cut_tmp_linestrings
-			  (handle, cache, stmt_in, stmt_upd, &row, message,
-			   blob, blob_sz))
+		      /* queuing all Input geoms intersecting the Blade */
+		      if (!do_collect_cut_pairs
+			  (handle, stmt_in, stmt_upd, &row, &batch,
+			   "step: cut Linestrings", message, blob, blob_sz))
 			{
 			    reset_temporary_row (&row);
 			    goto error;
@@ -4137,13 +4944,18 @@ do_split_linestrings (struct output_table *tbl, sqlite3 * handle,
 		goto error;
 	    }
       }
+    if (!do_flush_cut_batch
+	(handle, &batch, stmt_upd, "step: cut Linestrings", message))
+	goto error;
 
+    free_cut_batch (&batch);
     sqlite3_finalize (stmt_blades);
     sqlite3_finalize (stmt_in);
     sqlite3_finalize (stmt_upd);
     return 1;
 
   error:
+    free_cut_batch (&batch);
     if (stmt_blades != NULL)
 	sqlite3_finalize (stmt_blades);
     if (stmt_in != NULL)
@@ -4277,7 +5089,7 @@ do_insert_temporary_polygons (struct output_table *tbl, sqlite3 * handle,
 	    {
 		do_update_message (message,
 				   "UNEXPECTED NULL TEMPORARY POLYGON BLOB GEOMETRY");
-		gaiaFreeGeomColl (geom);
+		gaiaFreeGeomColl (g);
 		return 0;
 	    }
 	  sqlite3_bind_blob (stmt_out, icol, blob, size, free);
@@ -4416,6 +5228,7 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
     sqlite3_stmt *stmt_input = NULL;
     sqlite3_stmt *stmt_blade = NULL;
     sqlite3_stmt *stmt_tmp = NULL;
+    struct cached_input cached_input;
     char *xprefix;
     char *xtable;
     char *xcolumn;
@@ -4425,16 +5238,8 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
     int comma = 0;
     int cast2d = 0;
     int cast3d = 0;
-    int gpkg_mode = 0;
-    int tiny_point = 0;
-
-    if (cache != NULL)
-      {
-	  struct splite_internal_cache *pcache =
-	      (struct splite_internal_cache *) cache;
-	  gpkg_mode = pcache->gpkg_mode;
-      }
 
+    init_cached_input (&cached_input, cache);
     switch (type)
       {
       case GAIA_POLYGONM:
@@ -4767,11 +5572,16 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
 
 		/* reading the Input Geometry */
 		input_g =
-		    do_read_input_geometry (tbl, cache, stmt_input, handle,
-					    &row, message, &input_blob,
-					    &input_blob_sz);
+		    do_read_cached_input_geometry (tbl, cache, stmt_input,
+						   handle, &row,
+						   &cached_input, message,
+						   &input_blob,
+						   &input_blob_sz);
 		if (input_g == NULL)
-		    goto error;
+		  {
+		      reset_temporary_row (&row);
+		      goto error;
+		  }
 
 		if (is_null_blade (&row))
 		  {
@@ -4781,7 +5591,6 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
 			   message, -1))
 			{
 			    reset_temporary_row (&row);
-			    gaiaFreeGeomColl (input_g);
 			    goto error;
 			}
 		      goto skip;
@@ -4795,9 +5604,8 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
 		if (blade_g == NULL)
 		    goto error;
 
-		if (is_covered_by
-		    (cache, input_g, input_blob, input_blob_sz, blade_g,
-		     blade_blob, blade_blob_sz))
+		if (is_input_covered_by_blade
+		    (&cached_input, blade_g, blade_blob, blade_blob_sz))
 		  {
 		      /* Input is completely Covered By Blade */
 		      if (!do_insert_temporary_polygons
@@ -4805,16 +5613,14 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
 			   message, -1))
 			{
 			    reset_temporary_row (&row);
-			    gaiaFreeGeomColl (input_g);
 			    gaiaFreeGeomColl (blade_g);
 			    goto error;
 			}
 		      goto skip;
 		  }
 
-		if (is_covered_by
-		    (cache, blade_g, blade_blob, blade_blob_sz, input_g,
-		     input_blob, input_blob_sz))
+		if (is_blade_covered_by_input
+		    (&cached_input, blade_g, blade_blob, blade_blob_sz))
 		  {
 		      /* Blade is completely Covered By Input */
 		      gaiaGeomCollPtr g =
@@ -4825,7 +5631,6 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
 			   -1))
 			{
 			    reset_temporary_row (&row);
-			    gaiaFreeGeomColl (input_g);
 			    gaiaFreeGeomColl (blade_g);
 			    gaiaFreeGeomColl (g);
 			    goto error;
@@ -4837,39 +5642,27 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
 		pg = input_g->FirstPolygon;
 		while (pg != NULL)
 		  {
-		      unsigned char *pg_blob;
-		      int pg_blob_sz;
-		      gaiaGeomCollPtr pg_geom =
-			  do_prepare_polygon (pg, input_g->Srid);
-		      gaiaToSpatiaLiteBlobWkbEx2 (pg_geom, &pg_blob,
-						  &pg_blob_sz, gpkg_mode,
-						  tiny_point);
-		      n_geom++;
-		      if (gaiaGeomCollPreparedIntersects
-			  (cache, pg_geom, pg_blob, pg_blob_sz, blade_g,
-			   blade_blob, blade_blob_sz))
+		      if (is_input_polygon_intersecting_blade
+			  (&cached_input, pg, n_geom, blade_g, blade_blob,
+			   blade_blob_sz))
 			{
 			    /* saving an Input/Blade intersection */
 			    if (!do_insert_temporary_polygon_intersection
-				(tbl, handle, stmt_tmp, &row, n_geom,
+				(tbl, handle, stmt_tmp, &row, n_geom + 1,
 				 message))
 			      {
 				  reset_temporary_row (&row);
-				  gaiaFreeGeomColl (input_g);
 				  gaiaFreeGeomColl (blade_g);
-				  gaiaFreeGeomColl (pg_geom);
-				  free (pg_blob);
 				  goto error;
 			      }
 			}
-		      free (pg_blob);
-		      gaiaFreeGeomColl (pg_geom);
+		      n_geom++;
 		      pg = pg->Next;
 		  }
 
 	      skip:
+		release_cached_blade (&cached_input);
 		reset_temporary_row (&row);
-		gaiaFreeGeomColl (input_g);
 		gaiaFreeGeomColl (blade_g);
 	    }
 	  else
@@ -4881,6 +5674,7 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
 	    }
       }
 
+    reset_cached_input (&cached_input);
     sqlite3_finalize (stmt_main);
     sqlite3_finalize (stmt_input);
     sqlite3_finalize (stmt_blade);
@@ -4888,6 +5682,7 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
     return 1;
 
   error:
+    reset_cached_input (&cached_input);
     if (stmt_main == NULL)
 	sqlite3_finalize (stmt_main);
     if (stmt_input == NULL)
@@ -4899,150 +5694,13 @@ do_populate_temp_polygons (struct output_table *tbl, sqlite3 * handle,
     return 0;
 }
 
-static int
-do_update_tmp_cut_polygon (sqlite3 * handle, sqlite3_stmt * stmt_upd,
-			   sqlite3_int64 pk, const unsigned char *blob,
-			   int blob_sz, char **message)
-{
-/* saving an Input Polygon cut against a renoded Blade */
-    int ret;
-
-    sqlite3_reset (stmt_upd);
-    sqlite3_clear_bindings (stmt_upd);
-/* binding the cut Input geometry */
-    sqlite3_bind_blob (stmt_upd, 1, blob, blob_sz, free);
-    sqlite3_bind_int64 (stmt_upd, 2, pk);
-    /* updating the TMP table */
-    ret = sqlite3_step (stmt_upd);
-    if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-	return 1;
-
-    /* some error occurred */
-    do_update_sql_error (message,
-			 "step: UPDATE TMP SET cut-Polygon",
-			 sqlite3_errmsg (handle));
-    return 0;
-}
-
-static int
-do_cut_tmp_polygons (sqlite3 * handle, const void *cache,
-		     sqlite3_stmt * stmt_in, sqlite3_stmt * stmt_upd,
-		     struct temporary_row *row, char **message,
-		     const unsigned char *blade_blob, int blade_blob_sz)
-{
-/* cutting all Input Polygons intersecting the renoded Blade */
-    int ret;
-    struct multivar *var;
-    int icol = 1;
-    gaiaGeomCollPtr blade_g;
-    int gpkg_amphibious = 0;
-    int gpkg_mode = 0;
-    int tiny_point = 0;
-
-    if (cache != NULL)
-      {
-	  struct splite_internal_cache *pcache =
-	      (struct splite_internal_cache *) cache;
-	  gpkg_amphibious = pcache->gpkg_amphibious_mode;
-	  gpkg_mode = pcache->gpkg_mode;
-	  tiny_point = pcache->tinyPointEnabled;
-      }
-
-    blade_g = gaiaFromSpatiaLiteBlobWkbEx (blade_blob, blade_blob_sz,
-					   gpkg_mode, gpkg_amphibious);
-
-    sqlite3_reset (stmt_in);
-    sqlite3_clear_bindings (stmt_in);
-    var = row->first_blade;
-    while (var != NULL)
-      {
-	  /* binding Primary Key values (from Blade) */
-	  switch (var->type)
-	    {
-	    case SQLITE_INTEGER:
-		sqlite3_bind_int64 (stmt_in, icol, var->value.intValue);
-		break;
-	    case SQLITE_FLOAT:
-		sqlite3_bind_double (stmt_in, icol, var->value.doubleValue);
-		break;
-	    case SQLITE_TEXT:
-		sqlite3_bind_text (stmt_in, icol,
-				   var->value.textValue,
-				   strlen (var->value.textValue),
-				   SQLITE_STATIC);
-		break;
-	    default:
-		sqlite3_bind_null (stmt_in, icol);
-		break;
-	    };
-	  icol++;
-	  var = var->next;
-      }
-
-    while (1)
-      {
-	  /* scrolling the result set rows - cut Polygons */
-	  ret = sqlite3_step (stmt_in);
-	  if (ret == SQLITE_DONE)
-	      break;		/* end of result set */
-	  if (ret == SQLITE_ROW)
-	    {
-		/* fetched one row from the resultset */
-		sqlite3_int64 pk = 0;
-		unsigned char *blob = NULL;
-		int blob_sz = 0;
-		gaiaGeomCollPtr input_g;
-		gaiaGeomCollPtr result;
-		if (sqlite3_column_type (stmt_in, 0) == SQLITE_INTEGER
-		    && sqlite3_column_type (stmt_in, 1) == SQLITE_BLOB)
-		  {
-		      pk = sqlite3_column_int64 (stmt_in, 0);
-		      blob =
-			  (unsigned char *) sqlite3_column_blob (stmt_in, 1);
-		      blob_sz = sqlite3_column_bytes (stmt_in, 1);
-		      input_g = gaiaFromSpatiaLiteBlobWkbEx (blob, blob_sz,
-							     gpkg_mode,
-							     gpkg_amphibious);
-		      result =
-			  gaiaGeometryIntersection_r (cache, input_g,
-						      blade_g);
-		      if (result != NULL)
-			{
-			    gaiaToSpatiaLiteBlobWkbEx2 (result, &blob,
-							&blob_sz, gpkg_mode,
-							tiny_point);
-			    gaiaFreeGeomColl (result);
-			    if (!do_update_tmp_cut_polygon
-				(handle, stmt_upd, pk, blob, blob_sz,
-				 message))
-				goto error;
-			}
-		      gaiaFreeGeomColl (input_g);
-		  }
-	    }
-	  else
-	    {
-		do_update_sql_error (message,
-				     "step: cut Polygons",
-				     sqlite3_errmsg (handle));
-		goto error;
-	    }
-      }
-    gaiaFreeGeomColl (blade_g);
-    return 1;
-
-  error:
-    gaiaFreeGeomColl (blade_g);
-    return 0;
-}
-
 static int
 do_split_polygons (struct output_table *tbl, sqlite3 * handle,
 		   const void *cache, const char *input_db_prefix,
 		   const char *input_table, const char *input_geom,
 		   const char *blade_db_prefix, const char *blade_table,
 		   const char *blade_geom, const char *tmp_table,
-		   char **message)
+		   int threads, char **message)
 {
 /* cutting all Input Polygons intersecting some Blade */
     int ret;
@@ -5057,6 +5715,9 @@ do_split_polygons (struct output_table *tbl, sqlite3 * handle,
     char *prev;
     struct output_column *col;
     int comma = 0;
+    struct cut_batch batch;
+
+    init_cut_batch (&batch, cache, threads);
 
 /* composing the SQL statement - SELECT FROM Blades */
     sql = sqlite3_mprintf ("SELECT");
@@ -5317,10 +5978,10 @@ do_split_polygons (struct output_table *tbl, sqlite3 * handle,
 		      const unsigned char *blob =
 			  sqlite3_column_blob (stmt_blades, icol);
 		      int blob_sz = sqlite3_column_bytes (stmt_blades, icol);
-		      /* cutting all Input geoms intersecting the Blade */
-		      if (!do_cut_tmp_polygons
-			  (handle, cache, stmt_in, stmt_upd, &row, message,
-			   blob, blob_sz))
+		      /* queuing all Input geoms intersecting the Blade */
+		      if (!do_collect_cut_pairs
+			  (handle, stmt_in, stmt_upd, &row, &batch,
+			   "step: cut Polygons", message, blob, blob_sz))
 			{
 			    reset_temporary_row (&row);
 			    goto error;
@@ -5342,13 +6003,18 @@ do_split_polygons (struct output_table *tbl, sqlite3 * handle,
 		goto error;
 	    }
       }
+    if (!do_flush_cut_batch
+	(handle, &batch, stmt_upd, "step: cut Polygons", message))
+	goto error;
 
+    free_cut_batch (&batch);
     sqlite3_finalize (stmt_blades);
     sqlite3_finalize (stmt_in);
     sqlite3_finalize (stmt_upd);
     return 1;
 
   error:
+    free_cut_batch (&batch);
     if (stmt_blades != NULL)
 	sqlite3_finalize (stmt_blades);
     if (stmt_in != NULL)
@@ -7460,7 +8126,7 @@ do_cut_linestrings (struct output_table *tbl, sqlite3 * handle,
 		    const char *blade_geom, const char *spatial_index_prefix,
 		    const char *spatial_index, const char *out_table,
 		    char **tmp_table, int *drop_tmp_table, int type,
-		    char **message)
+		    int threads, char **message)
 {
 /* cutting Input LINESTRINGs */
     if (!do_create_temp_linestrings (tbl, handle, tmp_table, message))
@@ -7472,7 +8138,8 @@ do_cut_linestrings (struct output_table *tbl, sqlite3 * handle,
 	return 0;
     if (!do_split_linestrings
 	(tbl, handle, cache, input_db_prefix, input_table, input_geom,
-	 blade_db_prefix, blade_table, blade_geom, *tmp_table, message))
+	 blade_db_prefix, blade_table, blade_geom, *tmp_table, threads,
+	 message))
 	return 0;
     if (!do_get_uncovered_linestrings
 	(tbl, handle, cache, input_db_prefix, input_table, input_geom,
@@ -7498,7 +8165,7 @@ do_cut_polygons (struct output_table *tbl, sqlite3 * handle,
 		 const char *blade_geom, const char *spatial_index_prefix,
 		 const char *spatial_index, const char *out_table,
 		 char **tmp_table, int *drop_tmp_table, int type,
-		 char **message)
+		 int threads, char **message)
 {
 /* cutting Input POLYGONs */
     if (!do_create_temp_polygons (tbl, handle, tmp_table, message))
@@ -7510,7 +8177,8 @@ do_cut_polygons (struct output_table *tbl, sqlite3 * handle,
 	return 0;
     if (!do_split_polygons
 	(tbl, handle, cache, input_db_prefix, input_table, input_geom,
-	 blade_db_prefix, blade_table, blade_geom, *tmp_table, message))
+	 blade_db_prefix, blade_table, blade_geom, *tmp_table, threads,
+	 message))
 	return 0;
     if (!do_get_uncovered_polygons
 	(tbl, handle, cache, input_db_prefix, input_table, input_geom,
@@ -7534,6 +8202,20 @@ gaiaCutter (sqlite3 * handle, const void *cache, const char *xin_db_prefix,
 	    const char *xblade_geom, const char *out_table, int transaction,
 	    int ram_tmp_store, char **message)
 {
+/* main Cutter tool implementation - single threaded */
+    return gaiaCutterEx (handle, cache, xin_db_prefix, input_table,
+			 xinput_geom, xblade_db_prefix, blade_table,
+			 xblade_geom, out_table, transaction, ram_tmp_store, 1,
+			 message);
+}
+
+SPATIALITE_DECLARE int
+gaiaCutterEx (sqlite3 * handle, const void *cache, const char *xin_db_prefix,
+	      const char *input_table, const char *xinput_geom,
+	      const char *xblade_db_prefix, const char *blade_table,
+	      const char *xblade_geom, const char *out_table, int transaction,
+	      int ram_tmp_store, int threads, char **message)
+{
 /* main Cutter tool implementation */
     const char *in_db_prefix = "MAIN";
     const char *blade_db_prefix = "MAIN";
@@ -7729,7 +8411,7 @@ gaiaCutter (sqlite3 * handle, const void *cache, const char *xin_db_prefix,
 	      (tbl, handle, cache, in_db_prefix, input_table, input_geom,
 	       blade_db_prefix, blade_table, blade_geom, spatial_index_prefix,
 	       spatial_index, out_table, &tmp_table, &drop_tmp_table,
-	       input_type, message))
+	       input_type, threads, message))
 	      goto end;
       }
     if (pg_type)
@@ -7739,7 +8421,7 @@ gaiaCutter (sqlite3 * handle, const void *cache, const char *xin_db_prefix,
 	      (tbl, handle, cache, in_db_prefix, input_table, input_geom,
 	       blade_db_prefix, blade_table, blade_geom, spatial_index_prefix,
 	       spatial_index, out_table, &tmp_table, &drop_tmp_table,
-	       input_type, message))
+	       input_type, threads, message))
 	      goto end;
       }
 
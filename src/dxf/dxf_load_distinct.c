@@ -1554,6 +1554,8 @@ import_by_layer (sqlite3 * handle, gaiaDxfParserPtr dxf, int append)
 	  if (hatch)
 	    {
 		/* creating and populating the HATCH-layer */
+		stmt_ext = NULL;
+		attr_name = NULL;
 		if (dxf->prefix == NULL)
 		    name = sqlite3_mprintf ("%s_hatch_2d", lyr->layer_name);
 		else
@@ -3922,19 +3922,14 @@ import_blocks (sqlite3 * handle, gaiaDxfParserPtr dxf, int append)
     return 1;
 }
 
-GAIAGEO_DECLARE int
-gaiaLoadFromDxfParser (sqlite3 * handle,
-		       gaiaDxfParserPtr dxf, int mode, int append)
+DXF_PRIVATE int
+import_dxf_chunk (sqlite3 * handle, gaiaDxfParserPtr dxf, int mode,
+		  int append, int blocks)
 {
-/* populating the target DB */
+/* populating the target DB - all entities currently held by the parser */
     int ret;
 
-    if (dxf == NULL)
-	return 0;
-    if (dxf->first_layer == NULL)
-	return 0;
-
-    if (dxf->first_block != NULL)
+    if (blocks && dxf->first_block != NULL)
       {
 	  if (!import_blocks (handle, dxf, append))
 	      return 0;
@@ -3946,3 +3941,15 @@ gaiaLoadFromDxfParser (sqlite3 * handle,
 	ret = import_by_layer (handle, dxf, append);
     return ret;
 }
+
+GAIAGEO_DECLARE int
+gaiaLoadFromDxfParser (sqlite3 * handle,
+		       gaiaDxfParserPtr dxf, int mode, int append)
+{
+/* populating the target DB */
+    if (dxf == NULL)
+	return 0;
+    if (dxf->first_layer == NULL)
+	return 0;
+    return import_dxf_chunk (handle, dxf, mode, append, 1);
+}
@@ -69,11 +69,28 @@ Regione Toscana - Settore Sistema Informativo Territoriale ed Ambientale
 #include <spatialite/gaiageo.h>
 #include <spatialite/gg_dxf.h>
 #include <spatialite.h>
+#include <spatialite_private.h>
 
 #include "dxf_private.h"
 
 #ifndef OMIT_GEOS		/* only if GEOS is enabled */
 
+/* max number of threads building Pattern Hatch lines */
+#ifndef DXF_HATCH_THREADS
+#define DXF_HATCH_THREADS	4
+#endif
+
+/* min number of Hatches deserving a further thread */
+#define DXF_HATCH_PER_THREAD	8
+
+struct dxf_block_index
+{
+/* hash index supporting Block lookups by Layer Name and Block Id */
+    int size;			/* always a power of 2 */
+    int count;
+    gaiaDxfBlockPtr *slots;
+};
+
 typedef struct dxf_segment
 {
 /* a DXF segment */
@@ -451,6 +468,136 @@ create_dxf_hatch_lines (const void *p_cache, gaiaDxfHatchPtr hatch, int srid)
     gaiaFreeGeomColl (clipped);
 }
 
+struct dxf_hatch_queue
+{
+/* Hatches still waiting for their Pattern lines */
+    int count;
+    int max;
+    gaiaDxfHatchPtr *items;
+};
+
+struct dxf_hatch_job
+{
+/* a share of the pending Hatches assigned to a single thread */
+    const void *p_cache;
+    int own_cache;
+    struct dxf_hatch_queue *queue;
+    int first;
+    int step;
+    int srid;
+};
+
+static void
+enqueue_dxf_hatch (gaiaDxfParserPtr dxf, gaiaDxfHatchPtr hatch)
+{
+/* deferring the creation of Pattern Hatch lines */
+    struct dxf_hatch_queue *queue = dxf->hatch_queue;
+    if (queue == NULL)
+      {
+	  queue = malloc (sizeof (struct dxf_hatch_queue));
+	  queue->count = 0;
+	  queue->max = 0;
+	  queue->items = NULL;
+	  dxf->hatch_queue = queue;
+      }
+    if (queue->count == queue->max)
+      {
+	  queue->max = (queue->max == 0) ? 64 : queue->max * 2;
+	  queue->items =
+	      realloc (queue->items, sizeof (gaiaDxfHatchPtr) * queue->max);
+      }
+    queue->items[queue->count++] = hatch;
+}
+
+static void
+destroy_dxf_hatch_queue (gaiaDxfParserPtr dxf)
+{
+/* memory cleanup - destroying the pending Hatches queue */
+    struct dxf_hatch_queue *queue = dxf->hatch_queue;
+    if (queue == NULL)
+	return;
+    if (queue->items != NULL)
+	free (queue->items);
+    free (queue);
+    dxf->hatch_queue = NULL;
+}
+
+static void
+do_dxf_hatch_job (struct dxf_hatch_job *job)
+{
+/* creating the Pattern lines for all Hatches assigned to a job */
+    int i;
+    for (i = job->first; i < job->queue->count; i += job->step)
+	create_dxf_hatch_lines (job->p_cache, job->queue->items[i],
+				job->srid);
+}
+
+static void
+dxf_hatch_thread (void *arg)
+{
+/* the worker thread */
+    do_dxf_hatch_job ((struct dxf_hatch_job *) arg);
+}
+
+static void
+build_dxf_hatches (const void *p_cache, gaiaDxfParserPtr dxf)
+{
+/* creating the Pattern lines for all pending Hatches */
+    struct dxf_hatch_queue *queue = dxf->hatch_queue;
+    struct dxf_hatch_job jobs[DXF_HATCH_THREADS];
+    void *threads[DXF_HATCH_THREADS];
+    int num_jobs = 1;
+    int i;
+
+    if (queue == NULL || queue->count == 0)
+	return;
+    if (p_cache != NULL)
+      {
+	  /* GEOS is thread-safe only when using distinct contexts */
+	  num_jobs = queue->count / DXF_HATCH_PER_THREAD;
+	  if (num_jobs > DXF_HATCH_THREADS)
+	      num_jobs = DXF_HATCH_THREADS;
+	  if (num_jobs < 1)
+	      num_jobs = 1;
+      }
+    for (i = 0; i < num_jobs; i++)
+      {
+	  struct dxf_hatch_job *job = jobs + i;
+	  job->p_cache = p_cache;
+	  job->own_cache = 0;
+	  job->queue = queue;
+	  job->first = i;
+	  job->step = num_jobs;
+	  job->srid = dxf->srid;
+	  threads[i] = NULL;
+	  if (i == 0)
+	      continue;		/* the first job always runs on this thread */
+	  job->p_cache = spatialite_alloc_connection ();
+	  if (job->p_cache == NULL)
+	    {
+		/* no free connection slot: running on this thread */
+		job->p_cache = p_cache;
+		continue;
+	    }
+	  job->own_cache = 1;
+	  threads[i] = splite_thread_start (dxf_hatch_thread, job);
+      }
+    do_dxf_hatch_job (jobs);
+    for (i = 1; i < num_jobs; i++)
+      {
+	  if (threads[i] == NULL)
+	    {
+		/* no thread available: running on this thread */
+		do_dxf_hatch_job (jobs + i);
+	    }
+	  else
+	      splite_thread_join (threads[i]);
+	  if (jobs[i].own_cache)
+	      spatialite_internal_cleanup (jobs[i].p_cache);
+      }
+    queue->count = 0;
+}
+
 static gaiaDxfHolePtr
 alloc_dxf_hole (int points)
 {
@@ -714,6 +861,8 @@ insert_dxf_hatch (gaiaDxfParserPtr dxf, const char *layer_name,
 		if (lyr->last_hatch != NULL)
 		    lyr->last_hatch->next = hatch;
 		lyr->last_hatch = hatch;
+		enqueue_dxf_hatch (dxf, hatch);
+		dxf->pending_entities += 1;
 		return;
 	    }
 	  lyr = lyr->next;
@@ -850,6 +999,7 @@ insert_dxf_text (gaiaDxfParserPtr dxf, const char *layer_name,
 		dxf->last_ext = NULL;
 		if (txt->first != NULL)
 		    lyr->hasExtraText = 1;
+		dxf->pending_entities += 1;
 		return;
 	    }
 	  lyr = lyr->next;
@@ -1044,6 +1194,7 @@ insert_dxf_insert (gaiaDxfParserPtr dxf, const char *layer_name,
 			  lyr->hasExtraInsPolyg = 1;
 		  }
 		destroy_dxf_insert (ins);
+		dxf->pending_entities += 1;
 		return;
 	    }
 	  lyr = lyr->next;
@@ -1122,6 +1273,7 @@ insert_dxf_point (gaiaDxfParserPtr dxf, const char *layer_name,
 		dxf->last_ext = NULL;
 		if (pt->first != NULL)
 		    lyr->hasExtraPoint = 1;
+		dxf->pending_entities += 1;
 		return;
 	    }
 	  lyr = lyr->next;
@@ -1513,6 +1665,7 @@ insert_dxf_polyline (const void *p_cache, gaiaDxfParserPtr dxf,
 		    lyr->hasExtraPolyg = 1;
 		if (ln->is_closed == 0 && ln->first != NULL)
 		    lyr->hasExtraLine = 1;
+		dxf->pending_entities += 1;
 		return;
 	    }
 	  lyr = lyr->next;
@@ -1656,11 +1809,114 @@ destroy_dxf_block (gaiaDxfBlockPtr blk)
     free (blk);
 }
 
+static unsigned int
+dxf_block_hash (const char *layer_name, const char *block_id)
+{
+/* FNV-1a hash of a Layer Name / Block Id pair */
+    unsigned int hash = 2166136261u;
+    const unsigned char *p;
+    for (p = (const unsigned char *) layer_name; *p != '\0'; p++)
+      {
+	  hash ^= *p;
+	  hash *= 16777619u;
+      }
+    hash *= 16777619u;		/* separator */
+    for (p = (const unsigned char *) block_id; *p != '\0'; p++)
+      {
+	  hash ^= *p;
+	  hash *= 16777619u;
+      }
+    return hash;
+}
+
+static void
+put_dxf_block_slot (struct dxf_block_index *index, gaiaDxfBlockPtr blk)
+{
+/* storing a Block object into the first free slot */
+    unsigned int slot =
+	dxf_block_hash (blk->layer_name, blk->block_id) & (index->size - 1);
+    while (index->slots[slot] != NULL)
+	slot = (slot + 1) & (index->size - 1);
+    index->slots[slot] = blk;
+    index->count += 1;
+}
+
+static gaiaDxfBlockPtr
+find_dxf_block (gaiaDxfParserPtr dxf, const char *layer_name,
+		const char *block_id)
+{
+/* attempting to find a Block object by its Id */
+    struct dxf_block_index *index = dxf->block_index;
+    gaiaDxfBlockPtr blk;
+    unsigned int slot;
+    if (index == NULL || layer_name == NULL || block_id == NULL)
+	return NULL;
+    slot = dxf_block_hash (layer_name, block_id) & (index->size - 1);
+    while ((blk = index->slots[slot]) != NULL)
+      {
+	  if (strcmp (blk->layer_name, layer_name) == 0
+	      && strcmp (blk->block_id, block_id) == 0)
+	    {
+		/* ok, matching item found */
+		return blk;
+	    }
+	  slot = (slot + 1) & (index->size - 1);
+      }
+    return NULL;
+}
+
+static void
+index_dxf_block (gaiaDxfParserPtr dxf, gaiaDxfBlockPtr blk)
+{
+/* adding a Block object to the hash index */
+    struct dxf_block_index *index = dxf->block_index;
+    if (index == NULL)
+      {
+	  index = malloc (sizeof (struct dxf_block_index));
+	  index->size = 64;
+	  index->count = 0;
+	  index->slots = calloc (index->size, sizeof (gaiaDxfBlockPtr));
+	  dxf->block_index = index;
+      }
+    if (find_dxf_block (dxf, blk->layer_name, blk->block_id) != NULL)
+	return;			/* the first definition always wins */
+    if ((index->count + 1) * 2 > index->size)
+      {
+	  /* growing the hash table */
+	  int i;
+	  int old_size = index->size;
+	  gaiaDxfBlockPtr *old_slots = index->slots;
+	  index->size *= 2;
+	  index->count = 0;
+	  index->slots = calloc (index->size, sizeof (gaiaDxfBlockPtr));
+	  for (i = 0; i < old_size; i++)
+	    {
+		if (old_slots[i] != NULL)
+		    put_dxf_block_slot (index, old_slots[i]);
+	    }
+	  free (old_slots);
+      }
+    put_dxf_block_slot (index, blk);
+}
+
+static void
+destroy_dxf_block_index (gaiaDxfParserPtr dxf)
+{
+/* memory cleanup - destroying the Block hash index */
+    struct dxf_block_index *index = dxf->block_index;
+    if (index == NULL)
+	return;
+    free (index->slots);
+    free (index);
+    dxf->block_index = NULL;
+}
+
 static void
 insert_dxf_block (gaiaDxfParserPtr dxf)
 {
 /* inserting a DXF Block object */
     gaiaDxfBlockPtr blk;
+    gaiaDxfHatchPtr htc;
     int ok = 0;
     if (dxf->curr_block.layer_name == NULL)
 	return;
@@ -1700,12 +1956,19 @@ insert_dxf_block (gaiaDxfParserPtr dxf)
     blk->last_hatch = dxf->curr_block.last_hatch;
     dxf->curr_block.first_hatch = NULL;
     dxf->curr_block.last_hatch = NULL;
+    htc = blk->first_hatch;
+    while (htc != NULL)
+      {
+	  enqueue_dxf_hatch (dxf, htc);
+	  htc = htc->next;
+      }
 
     if (dxf->first_block == NULL)
 	dxf->first_block = blk;
     if (dxf->last_block != NULL)
 	dxf->last_block->next = blk;
     dxf->last_block = blk;
+    index_dxf_block (dxf, blk);
 }
 
 static gaiaDxfLayerPtr
@@ -1772,9 +2035,9 @@ alloc_dxf_layer (const char *name, int force_dims)
 }
 
 static void
-destroy_dxf_layer (gaiaDxfLayerPtr lyr)
+reset_dxf_layer (gaiaDxfLayerPtr lyr)
 {
-/* memory cleanup - destroying a DXF Layer object */
+/* memory cleanup - releasing all entities from a DXF Layer object */
     gaiaDxfTextPtr txt;
     gaiaDxfTextPtr n_txt;
     gaiaDxfPointPtr pt;
@@ -1857,6 +2120,35 @@ destroy_dxf_layer (gaiaDxfLayerPtr lyr)
 	  destroy_dxf_insert (ins);
 	  ins = n_ins;
       }
+    lyr->first_text = NULL;
+    lyr->last_text = NULL;
+    lyr->first_point = NULL;
+    lyr->last_point = NULL;
+    lyr->first_line = NULL;
+    lyr->last_line = NULL;
+    lyr->first_polyg = NULL;
+    lyr->last_polyg = NULL;
+    lyr->first_hatch = NULL;
+    lyr->last_hatch = NULL;
+    lyr->first_ins_text = NULL;
+    lyr->last_ins_text = NULL;
+    lyr->first_ins_point = NULL;
+    lyr->last_ins_point = NULL;
+    lyr->first_ins_line = NULL;
+    lyr->last_ins_line = NULL;
+    lyr->first_ins_polyg = NULL;
+    lyr->last_ins_polyg = NULL;
+    lyr->first_ins_hatch = NULL;
+    lyr->last_ins_hatch = NULL;
+}
+
+static void
+destroy_dxf_layer (gaiaDxfLayerPtr lyr)
+{
+/* memory cleanup - destroying a DXF Layer object */
+    if (lyr == NULL)
+	return;
+    reset_dxf_layer (lyr);
     if (lyr->layer_name != NULL)
 	free (lyr->layer_name);
     free (lyr);
@@ -2061,28 +2353,6 @@ reset_dxf_block (gaiaDxfParserPtr dxf)
     dxf->curr_block.is3Dpolyg = 0;
 }
 
-static gaiaDxfBlockPtr
-find_dxf_block (gaiaDxfParserPtr dxf, const char *layer_name,
-		const char *block_id)
-{
-/* attempting to find a Block object by its Id */
-    gaiaDxfBlockPtr blk = dxf->first_block;
-    while (blk != NULL)
-      {
-	  if (layer_name != NULL && block_id != NULL)
-	    {
-		if (strcmp (blk->layer_name, layer_name) == 0
-		    && strcmp (blk->block_id, block_id) == 0)
-		  {
-		      /* ok, matching item found */
-		      return blk;
-		  }
-	    }
-	  blk = blk->next;
-      }
-    return NULL;
-}
-
 static void
 save_current_circle (const void *p_cache, gaiaDxfParserPtr dxf)
 {
@@ -2312,8 +2582,6 @@ reset_dxf_entity (const void *p_cache, gaiaDxfParserPtr dxf)
 	    {
 		if (is_valid_dxf_hatch (dxf->curr_hatch))
 		  {
-		      create_dxf_hatch_lines (p_cache, dxf->curr_hatch,
-					      dxf->srid);
 		      if (dxf->is_block)
 			  insert_dxf_block_hatch (dxf, dxf->curr_hatch);
 		      else
@@ -2640,6 +2908,70 @@ set_dxf_hatch_offset_y (gaiaDxfParserPtr dxf, double y)
 	dxf->curr_hatch->offset_y = y;
 }
 
+static double
+dxf_atof (const char *str)
+{
+/*
+/ converting a DXF numeric value
+/
+/ plain decimal values (the most common case by far) are directly
+/ converted: as long as the mantissa has no more than 15 digits
+/ both the mantissa and the power of ten are exactly represented
+/ as doubles, and a single division gives the correctly rounded
+/ result, i.e. exactly the same value returned by atof().
+/ any other case (exponents, too many digits ...) is left to atof()
+*/
+    static const double pow10[16] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+	1e13, 1e14, 1e15
+    };
+    const char *p = str;
+    sqlite3_int64 mantissa = 0;
+    int digits = 0;
+    int decimals = 0;
+    int negative = 0;
+    int point = 0;
+    double value;
+
+    while (*p == ' ' || *p == '\t')
+	p++;
+    if (*p == '-')
+      {
+	  negative = 1;
+	  p++;
+      }
+    else if (*p == '+')
+	p++;
+    while (1)
+      {
+	  if (*p >= '0' && *p <= '9')
+	    {
+		if (digits == 15)
+		  {
+		      /* too many digits: giving up before overflowing */
+		      return atof (str);
+		  }
+		mantissa = (mantissa * 10) + (*p - '0');
+		digits++;
+		if (point)
+		    decimals++;
+	    }
+	  else if (*p == '.' && !point)
+	      point = 1;
+	  else
+	      break;
+	  p++;
+      }
+    while (*p == ' ' || *p == '\t')
+	p++;
+    if (*p != '\0' || digits == 0)
+	return atof (str);
+    value = (double) mantissa / pow10[decimals];
+    if (negative)
+	return -value;
+    return value;
+}
+
 static int
 op_code_line (const char *line)
 {
@@ -2997,22 +3329,22 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 		set_dxf_layer_name (dxf, line);
 		break;
 	    case 10:
-		dxf->curr_point.x = atof (line);
+		dxf->curr_point.x = dxf_atof (line);
 		break;
 	    case 20:
-		dxf->curr_point.y = atof (line);
+		dxf->curr_point.y = dxf_atof (line);
 		break;
 	    case 30:
-		dxf->curr_point.z = atof (line);
+		dxf->curr_point.z = dxf_atof (line);
 		break;
 	    case 11:
-		dxf->curr_end_point.x = atof (line);
+		dxf->curr_end_point.x = dxf_atof (line);
 		break;
 	    case 21:
-		dxf->curr_end_point.y = atof (line);
+		dxf->curr_end_point.y = dxf_atof (line);
 		break;
 	    case 31:
-		dxf->curr_end_point.z = atof (line);
+		dxf->curr_end_point.z = dxf_atof (line);
 		break;
 	    };
       }
@@ -3025,16 +3357,16 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 		set_dxf_layer_name (dxf, line);
 		break;
 	    case 10:
-		dxf->curr_circle.cx = atof (line);
+		dxf->curr_circle.cx = dxf_atof (line);
 		break;
 	    case 20:
-		dxf->curr_circle.cy = atof (line);
+		dxf->curr_circle.cy = dxf_atof (line);
 		break;
 	    case 30:
-		dxf->curr_circle.cz = atof (line);
+		dxf->curr_circle.cz = dxf_atof (line);
 		break;
 	    case 40:
-		dxf->curr_circle.radius = atof (line);
+		dxf->curr_circle.radius = dxf_atof (line);
 		break;
 	    };
       }
@@ -3047,22 +3379,22 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 		set_dxf_layer_name (dxf, line);
 		break;
 	    case 10:
-		dxf->curr_arc.cx = atof (line);
+		dxf->curr_arc.cx = dxf_atof (line);
 		break;
 	    case 20:
-		dxf->curr_arc.cy = atof (line);
+		dxf->curr_arc.cy = dxf_atof (line);
 		break;
 	    case 30:
-		dxf->curr_arc.cz = atof (line);
+		dxf->curr_arc.cz = dxf_atof (line);
 		break;
 	    case 40:
-		dxf->curr_arc.radius = atof (line);
+		dxf->curr_arc.radius = dxf_atof (line);
 		break;
 	    case 50:
-		dxf->curr_arc.start = atof (line);
+		dxf->curr_arc.start = dxf_atof (line);
 		break;
 	    case 51:
-		dxf->curr_arc.stop = atof (line);
+		dxf->curr_arc.stop = dxf_atof (line);
 		break;
 	    };
       }
@@ -3078,25 +3410,25 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 		set_dxf_layer_name (dxf, line);
 		break;
 	    case 10:
-		dxf->curr_insert.x = atof (line);
+		dxf->curr_insert.x = dxf_atof (line);
 		break;
 	    case 20:
-		dxf->curr_insert.y = atof (line);
+		dxf->curr_insert.y = dxf_atof (line);
 		break;
 	    case 30:
-		dxf->curr_insert.z = atof (line);
+		dxf->curr_insert.z = dxf_atof (line);
 		break;
 	    case 41:
-		dxf->curr_insert.scale_x = atof (line);
+		dxf->curr_insert.scale_x = dxf_atof (line);
 		break;
 	    case 42:
-		dxf->curr_insert.scale_y = atof (line);
+		dxf->curr_insert.scale_y = dxf_atof (line);
 		break;
 	    case 43:
-		dxf->curr_insert.scale_z = atof (line);
+		dxf->curr_insert.scale_z = dxf_atof (line);
 		break;
 	    case 50:
-		dxf->curr_insert.angle = atof (line);
+		dxf->curr_insert.angle = dxf_atof (line);
 		break;
 	    case 1000:
 		set_dxf_extra_value (dxf, line);
@@ -3118,16 +3450,16 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 		set_dxf_layer_name (dxf, line);
 		break;
 	    case 10:
-		dxf->curr_text.x = atof (line);
+		dxf->curr_text.x = dxf_atof (line);
 		break;
 	    case 20:
-		dxf->curr_text.y = atof (line);
+		dxf->curr_text.y = dxf_atof (line);
 		break;
 	    case 30:
-		dxf->curr_text.z = atof (line);
+		dxf->curr_text.z = dxf_atof (line);
 		break;
 	    case 50:
-		dxf->curr_text.angle = atof (line);
+		dxf->curr_text.angle = dxf_atof (line);
 		break;
 	    case 1000:
 		set_dxf_extra_value (dxf, line);
@@ -3146,13 +3478,13 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 		set_dxf_layer_name (dxf, line);
 		break;
 	    case 10:
-		dxf->curr_point.x = atof (line);
+		dxf->curr_point.x = dxf_atof (line);
 		break;
 	    case 20:
-		dxf->curr_point.y = atof (line);
+		dxf->curr_point.y = dxf_atof (line);
 		break;
 	    case 30:
-		dxf->curr_point.z = atof (line);
+		dxf->curr_point.z = dxf_atof (line);
 		break;
 	    case 1000:
 		set_dxf_extra_value (dxf, line);
@@ -3171,10 +3503,10 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 		set_dxf_layer_name (dxf, line);
 		break;
 	    case 10:
-		dxf->curr_point.x = atof (line);
+		dxf->curr_point.x = dxf_atof (line);
 		break;
 	    case 20:
-		dxf->curr_point.y = atof (line);
+		dxf->curr_point.y = dxf_atof (line);
 		set_dxf_vertex (dxf);
 		break;
 	    case 70:
@@ -3219,13 +3551,13 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 	  switch (dxf->op_code)
 	    {
 	    case 10:
-		dxf->curr_point.x = atof (line);
+		dxf->curr_point.x = dxf_atof (line);
 		break;
 	    case 20:
-		dxf->curr_point.y = atof (line);
+		dxf->curr_point.y = dxf_atof (line);
 		break;
 	    case 30:
-		dxf->curr_point.z = atof (line);
+		dxf->curr_point.z = dxf_atof (line);
 		break;
 	    };
       }
@@ -3240,37 +3572,37 @@ parse_dxf_line (const void *p_cache, gaiaDxfParserPtr dxf, const char *line)
 		break;
 	    case 10:
 		if (dxf->is_hatch_boundary)
-		    dxf->curr_point.x = atof (line);
+		    dxf->curr_point.x = dxf_atof (line);
 		break;
 	    case 20:
 		if (dxf->is_hatch_boundary)
-		    dxf->curr_point.y = atof (line);
+		    dxf->curr_point.y = dxf_atof (line);
 		break;
 	    case 11:
 		if (dxf->is_hatch_boundary)
-		    dxf->curr_end_point.x = atof (line);
+		    dxf->curr_end_point.x = dxf_atof (line);
 		break;
 	    case 21:
-		dxf->curr_end_point.y = atof (line);
+		dxf->curr_end_point.y = dxf_atof (line);
 		insert_dxf_hatch_boundary_segm (dxf);
 		break;
 	    case 41:
-		set_dxf_hatch_spacing (dxf, atof (line));
+		set_dxf_hatch_spacing (dxf, dxf_atof (line));
 		break;
 	    case 43:
-		set_dxf_hatch_base_x (dxf, atof (line));
+		set_dxf_hatch_base_x (dxf, dxf_atof (line));
 		break;
 	    case 44:
-		set_dxf_hatch_base_y (dxf, atof (line));
+		set_dxf_hatch_base_y (dxf, dxf_atof (line));
 		break;
 	    case 45:
-		set_dxf_hatch_offset_x (dxf, atof (line));
+		set_dxf_hatch_offset_x (dxf, dxf_atof (line));
 		break;
 	    case 46:
-		set_dxf_hatch_offset_y (dxf, atof (line));
+		set_dxf_hatch_offset_y (dxf, dxf_atof (line));
 		break;
 	    case 53:
-		set_dxf_hatch_angle (dxf, atof (line));
+		set_dxf_hatch_angle (dxf, dxf_atof (line));
 		break;
 	    case 92:
 		start_dxf_hatch_boundary (dxf);
@@ -3389,6 +3721,9 @@ gaiaCreateDxfParser (int srid,
     if (special_rings == GAIA_DXF_RING_UNLINKED)
 	dxf->unlinked_rings = 1;
     dxf->undeclared_layers = 1;
+    dxf->pending_entities = 0;
+    dxf->block_index = NULL;
+    dxf->hatch_queue = NULL;
     return dxf;
 }
 
@@ -3447,6 +3782,8 @@ gaiaDestroyDxfParser (gaiaDxfParserPtr dxf)
     if (dxf->curr_hatch != NULL)
 	destroy_dxf_hatch (dxf->curr_hatch);
     reset_dxf_block (dxf);
+    destroy_dxf_block_index (dxf);
+    destroy_dxf_hatch_queue (dxf);
     free (dxf);
 }
 
@@ -3494,12 +3831,136 @@ save_dxf_filename (gaiaDxfParserPtr dxf, const char *path)
       }
 }
 
+struct dxf_stream
+{
+/* a DXF file being directly loaded into the DB [streaming] */
+    const void *p_cache;
+    sqlite3 *handle;
+    int mode;
+    int append;
+    gaiaDxfParserPtr scan;	/* the first pass parser (Layer layouts) */
+    int overflow;		/* the first pass exceeded DXF_STREAM_CHUNK */
+    int chunks;			/* count of already loaded chunks */
+};
+
+/* max number of entities to be held in memory when streaming */
+#ifndef DXF_STREAM_CHUNK
+#define DXF_STREAM_CHUNK	16384
+#endif
+
+static void
+merge_dxf_layer_layout (gaiaDxfLayerPtr lyr, gaiaDxfLayerPtr scan)
+{
+/* setting the final layout of a Layer as found by the first pass */
+    if (scan->is3Dtext)
+	lyr->is3Dtext = 1;
+    if (scan->is3Dpoint)
+	lyr->is3Dpoint = 1;
+    if (scan->is3Dline)
+	lyr->is3Dline = 1;
+    if (scan->is3Dpolyg)
+	lyr->is3Dpolyg = 1;
+    if (scan->is3DinsText)
+	lyr->is3DinsText = 1;
+    if (scan->is3DinsPoint)
+	lyr->is3DinsPoint = 1;
+    if (scan->is3DinsLine)
+	lyr->is3DinsLine = 1;
+    if (scan->is3DinsPolyg)
+	lyr->is3DinsPolyg = 1;
+    if (scan->hasExtraText)
+	lyr->hasExtraText = 1;
+    if (scan->hasExtraPoint)
+	lyr->hasExtraPoint = 1;
+    if (scan->hasExtraLine)
+	lyr->hasExtraLine = 1;
+    if (scan->hasExtraPolyg)
+	lyr->hasExtraPolyg = 1;
+    if (scan->hasExtraInsText)
+	lyr->hasExtraInsText = 1;
+    if (scan->hasExtraInsPoint)
+	lyr->hasExtraInsPoint = 1;
+    if (scan->hasExtraInsLine)
+	lyr->hasExtraInsLine = 1;
+    if (scan->hasExtraInsPolyg)
+	lyr->hasExtraInsPolyg = 1;
+}
+
 static int
-gaiaParseDxfFileCommon (const void *p_cache, gaiaDxfParserPtr dxf,
-			const char *path)
+flush_dxf_stream (struct dxf_stream *stream, gaiaDxfParserPtr dxf)
+{
+/* flushing all entities currently held in memory */
+    gaiaDxfLayerPtr lyr;
+    struct dxf_hatch_queue *queue = dxf->hatch_queue;
+    int ret = 1;
+    if (stream->scan == NULL)
+      {
+	  /* first pass: the DXF is too big, only collecting Layer layouts */
+	  stream->overflow = 1;
+	  if (queue != NULL)
+	      queue->count = 0;
+      }
+    else
+      {
+	  /* second pass: loading the current chunk into the DB */
+	  build_dxf_hatches (stream->p_cache, dxf);
+	  gaiaDxfLayerPtr scan = stream->scan->first_layer;
+	  while (scan != NULL)
+	    {
+		lyr = dxf->first_layer;
+		while (lyr != NULL)
+		  {
+		      if (strcmp (scan->layer_name, lyr->layer_name) == 0)
+			  break;
+		      lyr = lyr->next;
+		  }
+		if (lyr == NULL)
+		  {
+		      /* not yet found by the second pass */
+		      lyr = alloc_dxf_layer (scan->layer_name, dxf->force_dims);
+		      insert_dxf_layer (dxf, lyr);
+		  }
+		merge_dxf_layer_layout (lyr, scan);
+		scan = scan->next;
+	    }
+	  if (stream->chunks == 0)
+	    {
+		/* Blocks referenced by any Insert in the whole DXF */
+		gaiaDxfBlockPtr blk = dxf->first_block;
+		while (blk != NULL)
+		  {
+		      gaiaDxfBlockPtr ref =
+			  find_dxf_block (stream->scan, blk->layer_name,
+					  blk->block_id);
+		      if (ref != NULL && ref->hasInsert)
+			  blk->hasInsert = 1;
+		      blk = blk->next;
+		  }
+	    }
+	  ret =
+	      import_dxf_chunk (stream->handle, dxf, stream->mode,
+				(stream->chunks == 0) ? stream->append : 1,
+				(stream->chunks == 0) ? 1 : 0);
+	  stream->chunks += 1;
+      }
+    lyr = dxf->first_layer;
+    while (lyr != NULL)
+      {
+	  reset_dxf_layer (lyr);
+	  lyr = lyr->next;
+      }
+    dxf->pending_entities = 0;
+    return ret;
+}
+
+static int
+parse_dxf_file (const void *p_cache, gaiaDxfParserPtr dxf, const char *path,
+		struct dxf_stream *stream)
 {
 /* parsing the whole DXF file */
-    int c;
+    char buf[65536];
+    size_t rd;
+    size_t i;
     char line[4192];
     char *p = line;
     FILE *fl;
@@ -3519,42 +3980,65 @@ gaiaParseDxfFileCommon (const void *p_cache, gaiaDxfParserPtr dxf,
     if (fl == NULL)
 	return 0;
 
-/* scanning the DXF file */
-    while ((c = getc (fl)) != EOF)
+/* scanning the DXF file - one buffer at each time */
+    while ((rd = fread (buf, 1, sizeof (buf), fl)) > 0)
       {
-	  if (c == '\r')
-	    {
-		/* ignoring any CR */
-		continue;
-	    }
-	  if (c == '\n')
+	  for (i = 0; i < rd; i++)
 	    {
-		/* end line found */
-		*p = '\0';
-		if (!parse_dxf_line (p_cache, dxf, line))
-		    goto stop;
-		if (dxf->eof)
+		char c = buf[i];
+		if (c == '\r')
 		  {
-		      /* EOF marker found - quitting */
-		      break;
+		      /* ignoring any CR */
+		      continue;
 		  }
-		p = line;
-		continue;
+		if (c == '\n')
+		  {
+		      /* end line found */
+		      *p = '\0';
+		      if (!parse_dxf_line (p_cache, dxf, line))
+			  goto stop;
+		      if (dxf->eof)
+			{
+			    /* EOF marker found - quitting */
+			    goto done;
+			}
+		      if (stream != NULL
+			  && dxf->pending_entities >= DXF_STREAM_CHUNK)
+			{
+			    if (!flush_dxf_stream (stream, dxf))
+				goto stop;
+			}
+		      p = line;
+		      continue;
+		  }
+		*p++ = c;
+		/* Even Rouault 2013-06-02 - avoiding a potential buffer overflow */
+		if (p - line == sizeof (line) - 1)
+		    goto stop;
+		/* END - Even Rouault 2013-06-02 */
 	    }
-	  *p++ = (char) c;
-	  /* Even Rouault 2013-06-02 - avoiding a potential buffer overflow */
-	  if (p - line == sizeof (line) - 1)
-	      goto stop;
-	  /* END - Even Rouault 2013-06-02 */
       }
 
+  done:
     fclose (fl);
+    if (stream == NULL || !stream->overflow)
+	build_dxf_hatches (p_cache, dxf);
     return 1;
   stop:
     fclose (fl);
+    if (stream == NULL || !stream->overflow)
+	build_dxf_hatches (p_cache, dxf);
     return 0;
 }
 
+static int
+gaiaParseDxfFileCommon (const void *p_cache, gaiaDxfParserPtr dxf,
+			const char *path)
+{
+/* parsing the whole DXF file */
+    return parse_dxf_file (p_cache, dxf, path, NULL);
+}
+
 GAIAGEO_DECLARE int
 gaiaParseDxfFile (gaiaDxfParserPtr dxf, const char *path)
 {
@@ -3567,4 +4051,46 @@ gaiaParseDxfFile_r (const void *p_cache, gaiaDxfParserPtr dxf, const char *path)
     return gaiaParseDxfFileCommon (p_cache, dxf, path);
 }
 
+GAIAGEO_DECLARE int
+gaiaStreamDxfFile_r (const void *p_cache, sqlite3 * handle,
+		     gaiaDxfParserPtr dxf, const char *path, int mode,
+		     int append)
+{
+/* parsing a DXF file and directly loading it into the DB */
+    struct dxf_stream stream;
+    gaiaDxfParserPtr dxf2;
+    int special_rings = GAIA_DXF_RING_NONE;
+    int ret;
+
+    stream.p_cache = p_cache;
+    stream.handle = handle;
+    stream.mode = mode;
+    stream.append = append;
+    stream.scan = NULL;
+    stream.overflow = 0;
+    stream.chunks = 0;
+    if (!parse_dxf_file (p_cache, dxf, path, &stream))
+	return 0;
+    if (!stream.overflow)
+      {
+	  /* the whole DXF fitted in memory */
+	  return gaiaLoadFromDxfParser (handle, dxf, mode, append);
+      }
+
+/* second pass: loading all entities one chunk at each time */
+    if (dxf->linked_rings)
+	special_rings = GAIA_DXF_RING_LINKED;
+    if (dxf->unlinked_rings)
+	special_rings = GAIA_DXF_RING_UNLINKED;
+    dxf2 =
+	gaiaCreateDxfParser (dxf->srid, dxf->force_dims, dxf->prefix,
+			     dxf->selected_layer, special_rings);
+    stream.scan = dxf;
+    ret = parse_dxf_file (p_cache, dxf2, path, &stream);
+    if (ret && (dxf2->pending_entities > 0 || stream.chunks == 0))
+	ret = flush_dxf_stream (&stream, dxf2);
+    gaiaDestroyDxfParser (dxf2);
+    return ret;
+}
+
 #endif /* GEOS enabled */
@@ -165,6 +165,10 @@ extern "C"
     DXF_PRIVATE int
 	import_by_layer (sqlite3 * handle, gaiaDxfParserPtr dxf, int append);
 
+    DXF_PRIVATE int
+	import_dxf_chunk (sqlite3 * handle, gaiaDxfParserPtr dxf, int mode,
+			  int append, int blocks);
+
     DXF_PRIVATE int
 	create_instext_table (sqlite3 * handle, const char *name,
 			      const char *block, int is3d,
@@ -58,6 +58,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite/debug.h>
 
 #include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
 
 #ifdef _WIN32
 #define strcasecmp	_stricmp
@@ -1883,17 +1884,33 @@ findEwktSrid (const char *buffer, int *base_offset)
 gaiaGeomCollPtr
 gaiaParseEWKT (const unsigned char *dirty_buffer)
 {
-    void *pParser = ParseAlloc (malloc);
+    void *pParser;
     /* Linked-list of token values */
-    ewktFlexToken *tokens = malloc (sizeof (ewktFlexToken));
+    ewktFlexToken *tokens;
     /* Pointer to the head of the list */
-    ewktFlexToken *head = tokens;
+    ewktFlexToken *head;
     int yv;
     int srid;
     int base_offset;
     yyscan_t scanner;
     struct ewkt_data str_data;
 
+    srid = findEwktSrid ((char *) dirty_buffer, &base_offset);
+
+/* attempting first the direct parser */
+    str_data.result =
+	gaia_fast_parse_ewkt ((const char *) dirty_buffer + base_offset);
+    if (str_data.result != NULL)
+      {
+	  gaiaMbrGeometry (str_data.result);
+	  str_data.result->Srid = srid;
+	  return str_data.result;
+      }
+
+    pParser = ParseAlloc (malloc);
+    tokens = malloc (sizeof (ewktFlexToken));
+    head = tokens;
+
 /* initializing the helper structs */
     str_data.ewkt_line = 1;
     str_data.ewkt_col = 1;
@@ -1906,7 +1923,6 @@ gaiaParseEWKT (const unsigned char *dirty_buffer)
     Ewktlex_init_extra (&str_data, &scanner);
     tokens->Next = NULL;
 
-    srid = findEwktSrid ((char *) dirty_buffer, &base_offset);
     Ewkt_scan_string ((char *) dirty_buffer + base_offset, scanner);
 
     /*
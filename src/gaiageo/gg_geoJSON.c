@@ -64,6 +64,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite/debug.h>
 
 #include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
 
 #define GEOJSON_DYN_NONE	0
 #define GEOJSON_DYN_POINT	1
@@ -1474,7 +1475,8 @@ geoJSONnormalize (const char *dirty)
     n_crs = geoJSONlen (i_crs, i_coordinates, i_type, i_bbox, i_end, len);
     n_bbox = geoJSONlen (i_bbox, i_coordinates, i_type, i_crs, i_end, len);
 
-    clean = malloc (len + 1);
+    /* up to three separating COMMAs and a closing BRACE could be added */
+    clean = malloc (len + 5);
 
     if (i_end < 0)
       {
@@ -1574,18 +1576,381 @@ geoJSONnormalize (const char *dirty)
     return clean;
 }
 
+/*
+** direct GeoJSON parser: a single scan of the most common form
+** {"type": T, ["bbox": [...],] "coordinates": [...]} filling the
+** coordinate arrays in place.
+**
+** anything else (GeometryCollection, "crs", any other key or key
+** order, syntax errors, degenerated geometries) simply returns NULL,
+** so that the Flex/Lemon parser is invoked as before.
+*/
+
+static const char *
+geoJsonFastSkip (const char *p)
+{
+/* skipping white spaces (as the Flex lexer does) */
+    while (*p == ' ' || *p == '\t' || *p == '\n')
+	p++;
+    return p;
+}
+
+static int
+geoJsonFastToken (const char **ptr, const char *token)
+{
+/* expecting a punctuation mark or a quoted keyword */
+    int len = strlen (token);
+    const char *p = geoJsonFastSkip (*ptr);
+    if (strncmp (p, token, len) != 0)
+	return 0;
+    *ptr = p + len;
+    return 1;
+}
+
+static int
+geoJsonFastCountDims (const char *p)
+{
+/* counting the coordinates of the first position */
+    int count = 0;
+    while (*p == '[' || *p == ' ' || *p == '\t' || *p == '\n')
+	p++;
+    while (*p != ']')
+      {
+	  if (*p == '\0' || *p == '[')
+	      return 0;
+	  if (*p == ',')
+	      count++;
+	  p++;
+      }
+    return count + 1;
+}
+
+static int
+geoJsonFastCountItems (const char *p)
+{
+/* counting the items of a [[...], [...], ...] list */
+    int count = 1;
+    int depth = 0;
+    while (1)
+      {
+	  if (*p == '\0')
+	      return -1;
+	  if (*p == '[')
+	      depth++;
+	  if (*p == ']')
+	    {
+		if (depth == 0)
+		    break;
+		depth--;
+	    }
+	  if (*p == ',' && depth == 0)
+	      count++;
+	  p++;
+      }
+    return count;
+}
+
+static int
+geoJsonFastPosition (const char **ptr, int dims, double *coords)
+{
+/* parsing a single position: [x, y] or [x, y, z] */
+    int ic;
+    const char *p = *ptr;
+    if (!geoJsonFastToken (&p, "["))
+	return 0;
+    for (ic = 0; ic < dims; ic++)
+      {
+	  if (ic > 0 && !geoJsonFastToken (&p, ","))
+	      return 0;
+	  p = geoJsonFastSkip (p);
+	  if (!gaia_fast_parse_number (&p, coords + ic))
+	      return 0;
+      }
+    if (!geoJsonFastToken (&p, "]"))
+	return 0;
+    *ptr = p;
+    return 1;
+}
+
+static int
+geoJsonFastPositions (const char **ptr, int min_points, int *points)
+{
+/* checking the opening of a [[x, y], [x, y], ...] list */
+    const char *p = *ptr;
+    if (!geoJsonFastToken (&p, "["))
+	return 0;
+    *points = geoJsonFastCountItems (p);
+    if (*points < min_points)
+	return 0;
+    *ptr = p;
+    return 1;
+}
+
+static int
+geoJsonFastPointList (const char **ptr, int dims, int points, double *coords)
+{
+/* parsing the positions of a list into a Coords array */
+    int iv;
+    const char *p = *ptr;
+    for (iv = 0; iv < points; iv++)
+      {
+	  if (iv > 0 && !geoJsonFastToken (&p, ","))
+	      return 0;
+	  if (!geoJsonFastPosition (&p, dims, coords + (iv * dims)))
+	      return 0;
+      }
+    if (!geoJsonFastToken (&p, "]"))
+	return 0;
+    *ptr = p;
+    return 1;
+}
+
+static void
+geoJsonFastAddPoint (gaiaGeomCollPtr geom, double *coords)
+{
+/* adding a POINT to the Geometry */
+    if (geom->DimensionModel == GAIA_XY_Z)
+	gaiaAddPointToGeomCollXYZ (geom, coords[0], coords[1], coords[2]);
+    else
+	gaiaAddPointToGeomColl (geom, coords[0], coords[1]);
+}
+
+static int
+geoJsonFastLinestring (const char **ptr, gaiaGeomCollPtr geom, int dims)
+{
+/* parsing LineString coordinates */
+    gaiaLinestringPtr ln;
+    int points;
+    const char *p = *ptr;
+    if (!geoJsonFastPositions (&p, 2, &points))
+	return 0;
+    ln = gaiaAddLinestringToGeomColl (geom, points);
+    if (!geoJsonFastPointList (&p, dims, points, ln->Coords))
+	return 0;
+    *ptr = p;
+    return 1;
+}
+
+static int
+geoJsonFastPolygon (const char **ptr, gaiaGeomCollPtr geom, int dims)
+{
+/* parsing Polygon coordinates */
+    gaiaPolygonPtr pg = NULL;
+    gaiaRingPtr rng;
+    int rings;
+    int ir;
+    int points;
+    const char *p = *ptr;
+    if (!geoJsonFastToken (&p, "["))
+	return 0;
+    rings = geoJsonFastCountItems (p);
+    if (rings < 1)
+	return 0;
+    for (ir = 0; ir < rings; ir++)
+      {
+	  if (ir > 0 && !geoJsonFastToken (&p, ","))
+	      return 0;
+	  if (!geoJsonFastPositions (&p, 4, &points))
+	      return 0;
+	  if (ir == 0)
+	    {
+		pg = gaiaAddPolygonToGeomColl (geom, points, rings - 1);
+		rng = pg->Exterior;
+	    }
+	  else
+	      rng = gaiaAddInteriorRing (pg, ir - 1, points);
+	  if (!geoJsonFastPointList (&p, dims, points, rng->Coords))
+	      return 0;
+      }
+    if (!geoJsonFastToken (&p, "]"))
+	return 0;
+    *ptr = p;
+    return 1;
+}
+
+static int
+geoJsonFastMulti (const char **ptr, gaiaGeomCollPtr geom, int dims,
+		  int (*item) (const char **, gaiaGeomCollPtr, int))
+{
+/* parsing MultiLineString or MultiPolygon coordinates */
+    int items;
+    int it;
+    const char *p = *ptr;
+    if (!geoJsonFastToken (&p, "["))
+	return 0;
+    items = geoJsonFastCountItems (p);
+    if (items < 1)
+	return 0;
+    for (it = 0; it < items; it++)
+      {
+	  if (it > 0 && !geoJsonFastToken (&p, ","))
+	      return 0;
+	  if (!item (&p, geom, dims))
+	      return 0;
+      }
+    if (!geoJsonFastToken (&p, "]"))
+	return 0;
+    *ptr = p;
+    return 1;
+}
+
+static int
+geoJsonFastMultipoint (const char **ptr, gaiaGeomCollPtr geom, int dims)
+{
+/* parsing MultiPoint coordinates */
+    double coords[3];
+    int points;
+    int iv;
+    const char *p = *ptr;
+    if (!geoJsonFastPositions (&p, 1, &points))
+	return 0;
+    for (iv = 0; iv < points; iv++)
+      {
+	  if (iv > 0 && !geoJsonFastToken (&p, ","))
+	      return 0;
+	  if (!geoJsonFastPosition (&p, dims, coords))
+	      return 0;
+	  geoJsonFastAddPoint (geom, coords);
+      }
+    if (!geoJsonFastToken (&p, "]"))
+	return 0;
+    *ptr = p;
+    return 1;
+}
+
+static int
+geoJsonFastBody (const char **ptr, gaiaGeomCollPtr geom, int type, int dims)
+{
+/* parsing the "coordinates" value of any Geometry Type */
+    double coords[3];
+    switch (type)
+      {
+      case GAIA_POINT:
+	  if (!geoJsonFastPosition (ptr, dims, coords))
+	      return 0;
+	  geoJsonFastAddPoint (geom, coords);
+	  return 1;
+      case GAIA_LINESTRING:
+	  return geoJsonFastLinestring (ptr, geom, dims);
+      case GAIA_POLYGON:
+	  return geoJsonFastPolygon (ptr, geom, dims);
+      case GAIA_MULTIPOINT:
+	  return geoJsonFastMultipoint (ptr, geom, dims);
+      case GAIA_MULTILINESTRING:
+	  return geoJsonFastMulti (ptr, geom, dims, geoJsonFastLinestring);
+      case GAIA_MULTIPOLYGON:
+	  return geoJsonFastMulti (ptr, geom, dims, geoJsonFastPolygon);
+      };
+    return 0;
+}
+
+static gaiaGeomCollPtr
+geoJsonFastParse (const char *p)
+{
+/* attempting to directly parse a GeoJSON expression */
+    static const char *names[] = {
+	"\"Point\"", "\"LineString\"", "\"Polygon\"", "\"MultiPoint\"",
+	"\"MultiLineString\"", "\"MultiPolygon\""
+    };
+    static const int types[] = {
+	GAIA_POINT, GAIA_LINESTRING, GAIA_POLYGON, GAIA_MULTIPOINT,
+	GAIA_MULTILINESTRING, GAIA_MULTIPOLYGON
+    };
+    gaiaGeomCollPtr geom;
+    double bbox;
+    int type = -1;
+    int dims;
+    int i;
+    if (!geoJsonFastToken (&p, "{"))
+	return NULL;
+    if (!geoJsonFastToken (&p, "\"type\""))
+	return NULL;
+    if (!geoJsonFastToken (&p, ":"))
+	return NULL;
+    for (i = 0; i < 6; i++)
+      {
+	  if (geoJsonFastToken (&p, names[i]))
+	    {
+		type = types[i];
+		break;
+	    }
+      }
+    if (type < 0)
+	return NULL;
+    if (!geoJsonFastToken (&p, ","))
+	return NULL;
+    if (geoJsonFastToken (&p, "\"bbox\""))
+      {
+	  /* the BBOX is just validated and then ignored */
+	  if (!geoJsonFastToken (&p, ":"))
+	      return NULL;
+	  if (!geoJsonFastToken (&p, "["))
+	      return NULL;
+	  for (i = 0; i < 4; i++)
+	    {
+		if (i > 0 && !geoJsonFastToken (&p, ","))
+		    return NULL;
+		p = geoJsonFastSkip (p);
+		if (!gaia_fast_parse_number (&p, &bbox))
+		    return NULL;
+	    }
+	  if (!geoJsonFastToken (&p, "]"))
+	      return NULL;
+	  if (!geoJsonFastToken (&p, ","))
+	      return NULL;
+      }
+    if (!geoJsonFastToken (&p, "\"coordinates\""))
+	return NULL;
+    if (!geoJsonFastToken (&p, ":"))
+	return NULL;
+    dims = geoJsonFastCountDims (p);
+    if (dims == 2)
+	geom = gaiaAllocGeomColl ();
+    else if (dims == 3)
+	geom = gaiaAllocGeomCollXYZ ();
+    else
+	return NULL;
+    if (geom == NULL)
+	return NULL;
+    geom->DeclaredType = type;
+    if (type == GAIA_POINT && dims == 3)
+	geom->DeclaredType = GAIA_POINTZ;
+    if (type == GAIA_POINT || type == GAIA_LINESTRING)
+	geom->Srid = -1;
+    if (!geoJsonFastBody (&p, geom, type, dims)
+	|| !geoJsonFastToken (&p, "}") || *geoJsonFastSkip (p) != '\0')
+      {
+	  gaiaFreeGeomColl (geom);
+	  return NULL;
+      }
+    return geom;
+}
+
 gaiaGeomCollPtr
 gaiaParseGeoJSON (const unsigned char *dirty_buffer)
 {
-    void *pParser = ParseAlloc (malloc);
+    void *pParser;
     /* Linked-list of token values */
-    geoJsonFlexToken *tokens = malloc (sizeof (geoJsonFlexToken));
+    geoJsonFlexToken *tokens;
     /* Pointer to the head of the list */
-    geoJsonFlexToken *head = tokens;
+    geoJsonFlexToken *head;
     int yv;
     yyscan_t scanner;
     struct geoJson_data str_data;
-    char *normalized_buffer = geoJSONnormalize ((const char *) dirty_buffer);
+    char *normalized_buffer;
+
+/* attempting first the direct parser */
+    str_data.result = geoJsonFastParse ((const char *) dirty_buffer);
+    if (str_data.result != NULL)
+      {
+	  gaiaMbrGeometry (str_data.result);
+	  return str_data.result;
+      }
+
+    pParser = ParseAlloc (malloc);
+    tokens = malloc (sizeof (geoJsonFlexToken));
+    head = tokens;
+    normalized_buffer = geoJSONnormalize ((const char *) dirty_buffer);
 
 /* initializing the helper structs */
     str_data.geoJson_line = 1;
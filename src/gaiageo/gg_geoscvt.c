@@ -2152,7 +2152,7 @@ gaiaToGeos_r (const void *p_cache, const gaiaGeomCollPtr gaia)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     return toGeosGeometry (cache, handle, gaia, GAIA2GEOS_ALL);
@@ -2183,7 +2183,7 @@ gaiaToGeosSelective_r (const void *p_cache, const gaiaGeomCollPtr gaia,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     if (mode == GAIA2GEOS_ONLY_POINTS || mode == GAIA2GEOS_ONLY_LINESTRINGS
@@ -2239,7 +2239,7 @@ gaiaFromGeos_XY_r (const void *p_cache, const void *xgeos)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     return fromGeosGeometry (handle, geos, GAIA_XY);
@@ -2258,7 +2258,7 @@ gaiaFromGeos_XYZ_r (const void *p_cache, const void *xgeos)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     return fromGeosGeometry (handle, geos, GAIA_XY_Z);
@@ -2277,7 +2277,7 @@ gaiaFromGeos_XYM_r (const void *p_cache, const void *xgeos)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     return fromGeosGeometry (handle, geos, GAIA_XY_M);
@@ -2296,7 +2296,7 @@ gaiaFromGeos_XYZM_r (const void *p_cache, const void *xgeos)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     return fromGeosGeometry (handle, geos, GAIA_XY_Z_M);
@@ -549,7 +549,7 @@ evalGeosCache (struct splite_internal_cache *cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return 0;
 
@@ -719,7 +719,7 @@ gaiaGeomCollEquals_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -786,7 +786,7 @@ gaiaGeomCollIntersects_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -827,7 +827,7 @@ gaiaGeomCollPreparedIntersects (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -903,7 +903,7 @@ gaiaGeomCollDisjoint_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -944,7 +944,7 @@ gaiaGeomCollPreparedDisjoint (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1021,7 +1021,7 @@ gaiaGeomCollOverlaps_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1062,7 +1062,7 @@ gaiaGeomCollPreparedOverlaps (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1139,7 +1139,7 @@ gaiaGeomCollCrosses_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1180,7 +1180,7 @@ gaiaGeomCollPreparedCrosses (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1257,7 +1257,7 @@ gaiaGeomCollTouches_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1298,7 +1298,7 @@ gaiaGeomCollPreparedTouches (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1375,7 +1375,7 @@ gaiaGeomCollWithin_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1416,7 +1416,7 @@ gaiaGeomCollPreparedWithin (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1496,7 +1496,7 @@ gaiaGeomCollContains_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1537,7 +1537,7 @@ gaiaGeomCollPreparedContains (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1615,7 +1615,7 @@ gaiaGeomCollRelate_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1704,7 +1704,7 @@ gaiaGeomCollRelateBoundaryNodeRule_r (const void *p_cache,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -1774,7 +1774,7 @@ gaiaIntersectionMatrixPatternMatch_r (const void *p_cache, const char *matrix,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1827,7 +1827,7 @@ gaiaGeomCollLength_r (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -1894,7 +1894,7 @@ gaiaGeomCollLengthOrPerimeter_r (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     if (perimeter)
@@ -1957,7 +1957,7 @@ gaiaGeomCollArea_r (const void *p_cache, gaiaGeomCollPtr geom, double *xarea)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -2019,7 +2019,7 @@ gaiaGeomCollDistance_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -2104,7 +2104,7 @@ gaiaGeometryIntersection_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -2215,7 +2215,7 @@ gaiaGeometryUnion_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -2353,7 +2353,7 @@ gaiaUnionCascaded_r (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -2473,7 +2473,7 @@ gaiaGeometryDifference_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -2570,7 +2570,7 @@ gaiaGeometrySymDifference_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -2662,7 +2662,7 @@ gaiaBoundary_r (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -2762,7 +2762,7 @@ gaiaGeomCollCentroid_r (const void *p_cache, gaiaGeomCollPtr geom, double *x,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return 0;
     gaiaResetGeosMsg_r (cache);
@@ -2871,7 +2871,7 @@ gaiaGetPointOnSurface_r (const void *p_cache, gaiaGeomCollPtr geom, double *x,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return 0;
     gaiaResetGeosMsg_r (cache);
@@ -2951,7 +2951,7 @@ gaiaIsSimple_r (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -3069,7 +3069,7 @@ gaiaIsRing_r (const void *p_cache, gaiaLinestringPtr line)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -3175,7 +3175,7 @@ gaiaIsValid_r (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -3263,7 +3263,7 @@ gaiaIsValidReason_r (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3360,7 +3360,7 @@ gaiaIsValidDetailEx_r (const void *p_cache, gaiaGeomCollPtr geom, int esri_flag)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3514,7 +3514,7 @@ gaiaGeomCollSimplify_r (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3605,7 +3605,7 @@ gaiaGeomCollSimplifyPreserveTopology_r (const void *p_cache,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3695,7 +3695,7 @@ gaiaConvexHull_r (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3798,7 +3798,7 @@ gaiaGeomCollBuffer_r (const void *p_cache, gaiaGeomCollPtr geom, double radius,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -4461,7 +4461,7 @@ gaiaPolygonize_r (const void *p_cache, gaiaGeomCollPtr geom, int force_multi)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -4514,7 +4514,7 @@ gaiaGeomCollCovers_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -4555,7 +4555,7 @@ gaiaGeomCollPreparedCovers (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -4637,7 +4637,7 @@ gaiaGeomCollCoveredBy_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -4679,7 +4679,7 @@ gaiaGeomCollPreparedCoveredBy (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1;
     gaiaResetGeosMsg_r (cache);
@@ -179,7 +179,7 @@ gaiaOffsetCurve_r (const void *p_cache, gaiaGeomCollPtr geom, double radius,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -363,7 +363,7 @@ gaiaSingleSidedBuffer_r (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -491,7 +491,7 @@ gaiaHausdorffDistance_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return 0;
     gaiaResetGeosMsg_r (cache);
@@ -560,7 +560,7 @@ gaiaHausdorffDistanceDensify_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return 0;
     gaiaResetGeosMsg_r (cache);
@@ -626,7 +626,7 @@ gaiaFrechetDistance_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return 0;
     gaiaResetGeosMsg_r (cache);
@@ -693,7 +693,7 @@ gaiaFrechetDistanceDensify_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return 0;
     gaiaResetGeosMsg_r (cache);
@@ -1369,7 +1369,7 @@ gaiaSharedPaths_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -1529,7 +1529,7 @@ gaiaLineInterpolatePoint_r (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -1621,7 +1621,7 @@ gaiaLineInterpolateEquidistantPointsCommon (struct splite_internal_cache *cache,
 	  if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	      || cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	      return NULL;
-	  handle = cache->GEOS_handle;
+	  handle = splite_get_geos_handle (cache);
 	  if (handle == NULL)
 	      return NULL;
       }
@@ -1846,7 +1846,7 @@ gaiaLineInterpolateEquidistantPoints_r (const void *p_cache,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -1980,7 +1980,7 @@ gaiaLineLocatePoint_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1.0;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return -1.0;
     gaiaResetGeosMsg_r (cache);
@@ -2095,7 +2095,7 @@ gaiaLineSubstringCommon (struct splite_internal_cache *cache,
 	  if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	      || cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	      return NULL;
-	  handle = cache->GEOS_handle;
+	  handle = splite_get_geos_handle (cache);
 	  if (handle == NULL)
 	      return NULL;
       }
@@ -2449,7 +2449,7 @@ gaiaLineSubstring_r (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3130,7 +3130,7 @@ gaiaShortestLineCommon (struct splite_internal_cache *cache,
 	  if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	      || cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	      return NULL;
-	  handle = cache->GEOS_handle;
+	  handle = splite_get_geos_handle (cache);
 	  if (handle == NULL)
 	      return NULL;
       }
@@ -3712,7 +3712,7 @@ gaiaShortestLine_r (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3775,7 +3775,7 @@ gaiaSnap_r (const void *p_cache, gaiaGeomCollPtr geom1, gaiaGeomCollPtr geom2,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3857,7 +3857,7 @@ gaiaLineMerge_r (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -3938,7 +3938,7 @@ gaiaUnaryUnion_r (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -4460,7 +4460,7 @@ gaiaDelaunayTriangulation_r (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -4837,7 +4837,7 @@ gaiaVoronojDiagram_r (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -5011,7 +5011,7 @@ gaiaConcaveHull_r (const void *p_cache, gaiaGeomCollPtr geom, double factor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->GEOS_handle;
+    handle = splite_get_geos_handle (cache);
     if (handle == NULL)
 	return NULL;
     gaiaResetGeosMsg_r (cache);
@@ -1410,7 +1410,7 @@ gaiaMakeValid (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -1452,7 +1452,7 @@ gaiaMakeValidDiscarded (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -1476,6 +1476,61 @@ gaiaMakeValidDiscarded (const void *p_cache, gaiaGeomCollPtr geom)
     return result;
 }
 
+GAIAGEO_DECLARE gaiaGeomCollPtr
+gaiaMakeValidEx (const void *p_cache, gaiaGeomCollPtr geom,
+		 gaiaGeomCollPtr * discarded)
+{
+/* wrapping RTGEOM MakeValid [collecting both valid and discarded items] */
+    const RTCTX *ctx = NULL;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    RTGEOM *g1;
+    RTGEOM *g2;
+    gaiaGeomCollPtr result = NULL;
+    gaiaGeomCollPtr result2 = NULL;
+
+    if (discarded != NULL)
+	*discarded = NULL;
+    if (!geom)
+	return NULL;
+    if (cache == NULL)
+	return NULL;
+    if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
+	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
+	return NULL;
+    ctx = splite_get_rttopo_handle (cache);
+    if (ctx == NULL)
+	return NULL;
+
+/* a single MakeValid pass is shared by both results */
+    g1 = toRTGeom (ctx, geom);
+    g2 = rtgeom_make_valid (ctx, g1);
+    if (!g2)
+      {
+	  rtgeom_free (ctx, g1);
+	  goto done;
+      }
+    result =
+	fromRTGeomValidated (ctx, g2, geom->DimensionModel, geom->DeclaredType);
+    if (discarded != NULL)
+	result2 =
+	    fromRTGeomDiscarded (ctx, g2, geom->DimensionModel,
+				 geom->DeclaredType);
+    spatialite_init_geos ();
+    rtgeom_free (ctx, g1);
+    rtgeom_free (ctx, g2);
+    if (result != NULL)
+	result->Srid = geom->Srid;
+    if (result2 != NULL)
+      {
+	  result2->Srid = geom->Srid;
+	  *discarded = result2;
+      }
+
+  done:
+    return result;
+}
+
 GAIAGEO_DECLARE gaiaGeomCollPtr
 gaiaSegmentize (const void *p_cache, gaiaGeomCollPtr geom, double dist)
 {
@@ -1496,7 +1551,7 @@ gaiaSegmentize (const void *p_cache, gaiaGeomCollPtr geom, double dist)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -1958,7 +2013,7 @@ gaiaSplit (const void *p_cache, gaiaGeomCollPtr input, gaiaGeomCollPtr blade)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2007,7 +2062,7 @@ gaiaSplitLeft (const void *p_cache, gaiaGeomCollPtr input,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2092,7 +2147,7 @@ gaiaSplitRight (const void *p_cache, gaiaGeomCollPtr input,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2173,7 +2228,7 @@ gaiaAzimuth (const void *p_cache, double xa, double ya, double xb, double yb,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2207,7 +2262,7 @@ gaiaEllipsoidAzimuth (const void *p_cache, double xa, double ya, double xb,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2240,7 +2295,7 @@ gaiaProjectedPoint (const void *p_cache, double x1, double y1, double a,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2278,7 +2333,7 @@ gaiaGeodesicArea (const void *p_cache, gaiaGeomCollPtr geom, double a, double b,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2331,7 +2386,7 @@ gaiaGeoHash (const void *p_cache, gaiaGeomCollPtr geom, int precision)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2374,7 +2429,7 @@ gaiaAsX3D (const void *p_cache, gaiaGeomCollPtr geom, const char *srs,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2416,7 +2471,7 @@ gaia3DDistance (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2449,7 +2504,7 @@ gaiaMaxDistance (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2482,7 +2537,7 @@ gaia3DMaxDistance (const void *p_cache, gaiaGeomCollPtr geom1,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2562,7 +2617,7 @@ gaia3dLength (const void *p_cache, gaiaGeomCollPtr geom, double *length)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2598,7 +2653,7 @@ gaiaNodeLines (const void *p_cache, gaiaGeomCollPtr geom)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2640,7 +2695,7 @@ gaiaSubdivide (const void *p_cache, gaiaGeomCollPtr geom, int max_vertices)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2702,7 +2757,7 @@ gaiaToTWKB (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2744,7 +2799,7 @@ gaiaFromTWKB (const void *p_cache, const unsigned char *twkb, int twkb_size,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2805,7 +2860,7 @@ gaiaAsEncodedPolyLine (const void *p_cache, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2840,7 +2895,7 @@ gaiaLineFromEncodedPolyline (const void *p_cache, const char *encoded,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
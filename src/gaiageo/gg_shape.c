@@ -59,6 +59,10 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifdef _WIN32
 #include <Windows.h>
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <sys/mman.h>
 #endif
 
 #if OMIT_ICONV == 0		/* if ICONV is disabled no SHP support is available */
@@ -102,6 +106,8 @@ extern const char *locale_charset (void);
 
 #define SHAPEFILE_NO_DATA 1e-38
 
+#define SHAPEFILE_IO_BUFSZ	(1024 * 1024)
+
 #ifdef _WIN32
 #define strcasecmp	_stricmp
 #endif /* not WIN32 */
@@ -443,6 +449,7 @@ gaiaAllocShapefile ()
     shp->Valid = 0;
     shp->IconvObj = NULL;
     shp->LastError = NULL;
+    shp->IoBuffer = NULL;
     return shp;
 }
 
@@ -458,6 +465,8 @@ gaiaFreeShapefile (gaiaShapefilePtr shp)
 	fclose (shp->flShx);
     if (shp->flDbf)
 	fclose (shp->flDbf);
+    if (shp->IoBuffer)
+	free (shp->IoBuffer);
     if (shp->Dbf)
 	gaiaFreeDbfList (shp->Dbf);
     if (shp->BufShp)
@@ -1056,6 +1065,7 @@ gaiaOpenShpWriteEx (gaiaShapefilePtr shp, const char *path, int shape,
     unsigned char *buf_shp = NULL;
     int buf_size = 1024;
     unsigned char *dbf_buf = NULL;
+    char *io_buf = NULL;
     gaiaDbfFieldPtr fld;
     char *sys_err;
     char errMsg[4192];
@@ -1150,6 +1160,19 @@ gaiaOpenShpWriteEx (gaiaShapefilePtr shp, const char *path, int shape,
 	  fld = fld->Next;
       }
     dbf_buf = malloc (dbf_reclen);
+/* 
+/ large sequential output buffers: each record is written by
+/ many tiny fwrite() calls, that will simply fill the buffers
+*/
+    io_buf = malloc (3 * SHAPEFILE_IO_BUFSZ);
+    if (io_buf != NULL)
+      {
+	  setvbuf (fl_shp, io_buf, _IOFBF, SHAPEFILE_IO_BUFSZ);
+	  setvbuf (fl_shx, io_buf + SHAPEFILE_IO_BUFSZ, _IOFBF,
+		   SHAPEFILE_IO_BUFSZ);
+	  setvbuf (fl_dbf, io_buf + (2 * SHAPEFILE_IO_BUFSZ), _IOFBF,
+		   SHAPEFILE_IO_BUFSZ);
+      }
 /* writing an empty SHP file header */
     memset (buf_shp, 0, 100);
     fwrite (buf_shp, 1, 100, fl_shp);
@@ -1333,6 +1356,7 @@ gaiaOpenShpWriteEx (gaiaShapefilePtr shp, const char *path, int shape,
     shp->flShp = fl_shp;
     shp->flShx = fl_shx;
     shp->flDbf = fl_dbf;
+    shp->IoBuffer = io_buf;
     shp->Dbf = dbf_list;
     shp->BufShp = buf_shp;
     shp->ShpBfsz = buf_size;
@@ -1435,8 +1459,109 @@ to_sqlite_julian_date (int year, int month, int day, double *julian)
     return 1;
 }
 
+/* 
+/ caching ICONV conversions for low-cardinality text DBF fields:
+/ each field owns a small direct-mapped table, and gives it up
+/ as soon as the hit ratio shows that values are mostly unique
+*/
+#define DBF_ICONV_CACHE_SLOTS	64
+#define DBF_ICONV_CACHE_PROBE	1024
+
+struct dbf_iconv_item
+{
+/* a cached conversion: raw DBF bytes -> UTF-8 */
+    unsigned int hash;
+    int raw_len;
+    char *raw;
+    char *utf8;
+};
+
+struct dbf_iconv_field
+{
+/* the ICONV cache of a single DBF field */
+    int enabled;
+    int lookups;
+    int hits;
+    struct dbf_iconv_item items[DBF_ICONV_CACHE_SLOTS];
+};
+
+struct dbf_iconv_cache
+{
+/* the ICONV cache of a DBF file - one item for each field */
+    int count;
+    struct dbf_iconv_field *fields;
+};
+
+static void
+free_dbf_iconv_items (struct dbf_iconv_field *cache)
+{
+/* memory cleanup - cached conversions of some DBF field */
+    int i;
+    for (i = 0; i < DBF_ICONV_CACHE_SLOTS; i++)
+      {
+	  struct dbf_iconv_item *item = cache->items + i;
+	  if (item->raw != NULL)
+	      free (item->raw);
+	  if (item->utf8 != NULL)
+	      free (item->utf8);
+	  item->raw = NULL;
+	  item->utf8 = NULL;
+      }
+}
+
+static struct dbf_iconv_cache *
+create_dbf_iconv_cache (gaiaDbfListPtr list)
+{
+/* creating the ICONV cache of some DBF file */
+    struct dbf_iconv_cache *cache;
+    gaiaDbfFieldPtr pFld;
+    int count = 0;
+    int i;
+    pFld = list->First;
+    while (pFld)
+      {
+	  count++;
+	  pFld = pFld->Next;
+      }
+    cache = malloc (sizeof (struct dbf_iconv_cache));
+    cache->count = count;
+    cache->fields = calloc (count + 1, sizeof (struct dbf_iconv_field));
+    for (i = 0; i < count; i++)
+	(cache->fields + i)->enabled = 1;
+    return cache;
+}
+
+static void
+destroy_dbf_iconv_cache (void *p)
+{
+/* memory cleanup - destroying the ICONV cache of some DBF file */
+    struct dbf_iconv_cache *cache = (struct dbf_iconv_cache *) p;
+    int i;
+    if (cache == NULL)
+	return;
+    for (i = 0; i < cache->count; i++)
+	free_dbf_iconv_items (cache->fields + i);
+    free (cache->fields);
+    free (cache);
+}
+
+static unsigned int
+dbf_iconv_hash (const unsigned char *raw, int len)
+{
+/* FNV-1a hash of some raw DBF value */
+    unsigned int hash = 2166136261u;
+    int i;
+    for (i = 0; i < len; i++)
+      {
+	  hash ^= raw[i];
+	  hash *= 16777619u;
+      }
+    return hash;
+}
+
 static int
-parseDbfField (unsigned char *buf_dbf, void *iconv_obj, gaiaDbfFieldPtr pFld,
+parseDbfField (const unsigned char *buf_dbf, void *iconv_obj,
+	       struct dbf_iconv_field *cache, gaiaDbfFieldPtr pFld,
 	       int text_dates)
 {
 /* parsing a generic DBF field */
@@ -1451,6 +1576,9 @@ parseDbfField (unsigned char *buf_dbf, void *iconv_obj, gaiaDbfFieldPtr pFld,
     size_t utf8len;
     char *pUtf8buf;
     int i;
+    int raw_len;
+    unsigned int hash = 0;
+    struct dbf_iconv_item *item = NULL;
     memcpy (buf, buf_dbf + pFld->Offset + 1, pFld->Length);
     buf[pFld->Length] = '\0';
     if (*buf == '\0')
@@ -1543,6 +1671,30 @@ parseDbfField (unsigned char *buf_dbf, void *iconv_obj, gaiaDbfFieldPtr pFld,
 			  break;
 		  }
 		len = strlen ((char *) buf);
+		raw_len = len;
+		if (cache != NULL && cache->enabled)
+		  {
+		      /* attempting to reuse some previous conversion */
+		      hash = dbf_iconv_hash (buf, raw_len);
+		      item = cache->items + (hash % DBF_ICONV_CACHE_SLOTS);
+		      cache->lookups++;
+		      if (item->raw != NULL && item->hash == hash
+			  && item->raw_len == raw_len
+			  && memcmp (item->raw, buf, raw_len) == 0)
+			{
+			    cache->hits++;
+			    gaiaSetStrValue (pFld, item->utf8);
+			    return 1;
+			}
+		      if (cache->lookups >= DBF_ICONV_CACHE_PROBE
+			  && cache->hits < cache->lookups / 2)
+			{
+			    /* high-cardinality field: giving up caching */
+			    free_dbf_iconv_items (cache);
+			    cache->enabled = 0;
+			    item = NULL;
+			}
+		  }
 		utf8len = 2048;
 		pBuf = (char *) buf;
 		pUtf8buf = utf8buf;
@@ -1550,9 +1702,22 @@ parseDbfField (unsigned char *buf_dbf, void *iconv_obj, gaiaDbfFieldPtr pFld,
 		    ((iconv_t) (iconv_obj), &pBuf, &len, &pUtf8buf,
 		     &utf8len) == (size_t) (-1))
 		    return 0;
-		memcpy (buf, utf8buf, 2048 - utf8len);
-		buf[2048 - utf8len] = '\0';
-		gaiaSetStrValue (pFld, (char *) buf);
+		utf8buf[2048 - utf8len] = '\0';
+		gaiaSetStrValue (pFld, utf8buf);
+		if (item != NULL)
+		  {
+		      /* caching the current conversion */
+		      if (item->raw != NULL)
+			  free (item->raw);
+		      if (item->utf8 != NULL)
+			  free (item->utf8);
+		      item->hash = hash;
+		      item->raw_len = raw_len;
+		      item->raw = malloc (raw_len + 1);
+		      memcpy (item->raw, buf, raw_len + 1);
+		      item->utf8 = malloc ((2048 - utf8len) + 1);
+		      strcpy (item->utf8, utf8buf);
+		  }
 	    }
       }
     return 1;
@@ -2767,7 +2932,8 @@ gaiaReadShpEntity_ex (gaiaShapefilePtr shp, int current_row, int srid,
     pFld = shp->Dbf->First;
     while (pFld)
       {
-	  if (!parseDbfField (shp->BufDbf, shp->IconvObj, pFld, text_dates))
+	  if (!parseDbfField
+	      (shp->BufDbf, shp->IconvObj, NULL, pFld, text_dates))
 	    {
 		char *text = malloc (pFld->Length + 1);
 		memcpy (text, shp->BufDbf + pFld->Offset + 1, pFld->Length);
@@ -4943,6 +5109,9 @@ gaiaAllocDbf ()
     dbf->Valid = 0;
     dbf->IconvObj = NULL;
     dbf->LastError = NULL;
+    dbf->MapDbf = NULL;
+    dbf->MapSize = 0;
+    dbf->IconvCache = NULL;
     return dbf;
 }
 
@@ -4952,6 +5121,14 @@ gaiaFreeDbf (gaiaDbfPtr dbf)
 /* frees all memory allocations related to the DBF object */
     if (dbf->Path)
 	free (dbf->Path);
+    if (dbf->MapDbf)
+      {
+#ifdef _WIN32
+	  UnmapViewOfFile (dbf->MapDbf);
+#else
+	  munmap (dbf->MapDbf, dbf->MapSize);
+#endif
+      }
     if (dbf->flDbf)
 	fclose (dbf->flDbf);
     if (dbf->Dbf)
@@ -4960,11 +5137,62 @@ gaiaFreeDbf (gaiaDbfPtr dbf)
 	free (dbf->BufDbf);
     if (dbf->IconvObj)
 	iconv_close ((iconv_t) dbf->IconvObj);
+    if (dbf->IconvCache)
+	destroy_dbf_iconv_cache (dbf->IconvCache);
     if (dbf->LastError)
 	free (dbf->LastError);
     free (dbf);
 }
 
+static void
+map_dbf_file (gaiaDbfPtr dbf)
+{
+/* 
+/ attempting to map the whole DBF file in memory (read only):
+/ on failure records will be simply read by fread()
+*/
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+    LARGE_INTEGER size;
+    void *view;
+    file = (HANDLE) _get_osfhandle (_fileno (dbf->flDbf));
+    if (file == INVALID_HANDLE_VALUE)
+	return;
+    if (!GetFileSizeEx (file, &size))
+	return;
+    if (size.QuadPart <= 0 || (unsigned __int64) size.QuadPart > (size_t) (-1))
+	return;
+    mapping = CreateFileMapping (file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+	return;
+    view = MapViewOfFile (mapping, FILE_MAP_READ, 0, 0, 0);
+/* the view still remains valid after closing the mapping handle */
+    CloseHandle (mapping);
+    if (view == NULL)
+	return;
+    dbf->MapDbf = view;
+    dbf->MapSize = (size_t) size.QuadPart;
+#else
+    struct stat st;
+    void *view;
+    if (fstat (fileno (dbf->flDbf), &st) != 0)
+	return;
+    if (st.st_size <= 0 || (unsigned long long) st.st_size > (size_t) (-1))
+	return;
+    view =
+	mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+	      fileno (dbf->flDbf), 0);
+    if (view == MAP_FAILED)
+	return;
+#ifdef MADV_SEQUENTIAL
+    madvise (view, (size_t) st.st_size, MADV_SEQUENTIAL);
+#endif
+    dbf->MapDbf = view;
+    dbf->MapSize = (size_t) st.st_size;
+#endif
+}
+
 GAIAGEO_DECLARE void
 gaiaOpenDbfRead (gaiaDbfPtr dbf, const char *path, const char *charFrom,
 		 const char *charTo)
@@ -5146,6 +5374,9 @@ gaiaOpenDbfRead (gaiaDbfPtr dbf, const char *path, const char *charFrom,
     dbf->DbfReclen = dbf_reclen;
     dbf->Valid = 1;
     dbf->endian_arch = endian_arch;
+    if (fl_dbf != NULL)
+	map_dbf_file (dbf);
+    dbf->IconvCache = create_dbf_iconv_cache (dbf_list);
     return;
   unsupported_conversion:
 /* illegal charset */
@@ -5526,35 +5757,57 @@ gaiaReadDbfEntity (gaiaDbfPtr dbf, int current_row, int *deleted)
 GAIAGEO_DECLARE int
 gaiaReadDbfEntity_ex (gaiaDbfPtr dbf, int current_row, int *deleted,
 		      int text_dates)
+{
+    return gaiaReadDbfEntity_ex2 (dbf, current_row, deleted, text_dates, NULL);
+}
+
+GAIAGEO_DECLARE int
+gaiaReadDbfEntity_ex2 (gaiaDbfPtr dbf, int current_row, int *deleted,
+		       int text_dates, const char *fields)
 {
 /* trying to read an entity from DBF */
     int rd;
     int skpos;
     gaia_off_t offset;
     int len;
+    int ind;
     char errMsg[1024];
     gaiaDbfFieldPtr pFld;
+    const unsigned char *record;
+    struct dbf_iconv_cache *cache = (struct dbf_iconv_cache *) dbf->IconvCache;
 /* positioning and reading the DBF file */
     offset =
 	dbf->DbfHdsz +
 	((gaia_off_t) current_row * (gaia_off_t) (dbf->DbfReclen));
-    if (dbf->memDbf != NULL)
-	skpos = gaiaMemFseek (dbf->memDbf, offset);
-    else
-	skpos = gaia_fseek (dbf->flDbf, offset, SEEK_SET);
-    if (skpos != 0)
-	goto eof;
-    if (dbf->memDbf != NULL)
-	rd = gaiaMemRead (dbf->BufDbf, dbf->DbfReclen, dbf->memDbf);
+    if (dbf->MapDbf != NULL)
+      {
+	  /* directly accessing the memory mapped DBF file */
+	  if (current_row < 0
+	      || offset + dbf->DbfReclen > (gaia_off_t) (dbf->MapSize))
+	      goto eof;
+	  record = dbf->MapDbf + offset;
+      }
     else
-	rd = fread (dbf->BufDbf, sizeof (unsigned char), dbf->DbfReclen,
-		    dbf->flDbf);
-    if (rd != dbf->DbfReclen)
-	goto eof;
+      {
+	  if (dbf->memDbf != NULL)
+	      skpos = gaiaMemFseek (dbf->memDbf, offset);
+	  else
+	      skpos = gaia_fseek (dbf->flDbf, offset, SEEK_SET);
+	  if (skpos != 0)
+	      goto eof;
+	  if (dbf->memDbf != NULL)
+	      rd = gaiaMemRead (dbf->BufDbf, dbf->DbfReclen, dbf->memDbf);
+	  else
+	      rd = fread (dbf->BufDbf, sizeof (unsigned char), dbf->DbfReclen,
+			  dbf->flDbf);
+	  if (rd != dbf->DbfReclen)
+	      goto eof;
+	  record = dbf->BufDbf;
+      }
 /* setting up the current DBF ENTITY */
     gaiaResetDbfEntity (dbf->Dbf);
     dbf->Dbf->RowId = current_row;
-    if (*(dbf->BufDbf) == '*')
+    if (*record == '*')
       {
 	  /* deleted row */
 	  *deleted = 1;
@@ -5564,19 +5817,31 @@ gaiaReadDbfEntity_ex (gaiaDbfPtr dbf, int current_row, int *deleted,
 	  return 1;
       }
 /* fetching the DBF values */
+    ind = 0;
     pFld = dbf->Dbf->First;
     while (pFld)
       {
-	  if (!parseDbfField (dbf->BufDbf, dbf->IconvObj, pFld, text_dates))
+	  if (fields != NULL && !fields[ind])
+	    {
+		/* not requested: leaving the value unset */
+		ind++;
+		pFld = pFld->Next;
+		continue;
+	    }
+	  if (!parseDbfField
+	      (record, dbf->IconvObj,
+	       (cache != NULL && ind < cache->count) ? cache->fields + ind : NULL,
+	       pFld, text_dates))
 	    {
 		char *text = malloc (pFld->Length + 1);
-		memcpy (text, dbf->BufDbf + pFld->Offset + 1, pFld->Length);
+		memcpy (text, record + pFld->Offset + 1, pFld->Length);
 		text[pFld->Length] = '\0';
 		spatialite_e
 		    ("**** libiconv: unable to convert string=\"%s\"\n", text);
 		free (text);
 		goto conversion_error;
 	    }
+	  ind++;
 	  pFld = pFld->Next;
       }
     if (dbf->LastError)
@@ -121,9 +121,11 @@ gaiaSetProjDatabasePath (const void *p_cache, const char *path)
 	      && cache->magic2 == SPATIALITE_CACHE_MAGIC2)
 	    {
 		if (!proj_context_set_database_path
-		    (cache->PROJ_handle, path, NULL, NULL))
+		    (splite_get_proj_handle (cache), path, NULL, NULL))
 		    return NULL;
-		return proj_context_get_database_path (cache->PROJ_handle);
+		return
+		    proj_context_get_database_path (splite_get_proj_handle
+						    (cache));
 	    }
       }
     return NULL;
@@ -139,7 +141,9 @@ gaiaGetProjDatabasePath (const void *p_cache)
       {
 	  if (cache->magic1 == SPATIALITE_CACHE_MAGIC1
 	      && cache->magic2 == SPATIALITE_CACHE_MAGIC2)
-	      return proj_context_get_database_path (cache->PROJ_handle);
+	      return
+		  proj_context_get_database_path (splite_get_proj_handle
+						  (cache));
       }
     return NULL;
 }
@@ -1087,7 +1091,7 @@ gaiaTransformEx_r (const void *p_cache, gaiaGeomCollPtr org,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->PROJ_handle;
+    handle = splite_get_proj_handle (cache);
     if (handle == NULL)
 	return NULL;
     return gaiaTransformCommon (handle, cache, org, proj_string_1,
@@ -1114,7 +1118,7 @@ gaiaTransformXY_r (const void *p_cache, gaiaGeomCollPtr org,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->PROJ_handle;
+    handle = splite_get_proj_handle (cache);
     if (handle == NULL)
 	return NULL;
     return gaiaTransformCommon (handle, cache, org,
@@ -1141,7 +1145,7 @@ gaiaTransformXYZ_r (const void *p_cache, gaiaGeomCollPtr org,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    handle = cache->PROJ_handle;
+    handle = splite_get_proj_handle (cache);
     if (handle == NULL)
 	return NULL;
     return gaiaTransformCommon (handle, cache, org,
@@ -1163,12 +1167,13 @@ gaiaGetProjString (const void *p_cache, const char *auth_name, int auth_srid)
 
     sprintf (xsrid, "%d", auth_srid);
     crs_def =
-	proj_create_from_database (cache->PROJ_handle, auth_name, xsrid,
-				   PJ_CATEGORY_CRS, 0, NULL);
+	proj_create_from_database (splite_get_proj_handle (cache), auth_name,
+				   xsrid, PJ_CATEGORY_CRS, 0, NULL);
     if (crs_def == NULL)
 	return NULL;
     proj_string =
-	proj_as_proj_string (cache->PROJ_handle, crs_def, PJ_PROJ_5, NULL);
+	proj_as_proj_string (splite_get_proj_handle (cache), crs_def,
+			     PJ_PROJ_5, NULL);
     if (proj_string == NULL)
       {
 	  proj_destroy (crs_def);
@@ -1202,8 +1207,8 @@ gaiaGetProjWKT (const void *p_cache, const char *auth_name, int auth_srid,
 
     sprintf (xsrid, "%d", auth_srid);
     crs_def =
-	proj_create_from_database (cache->PROJ_handle, auth_name, xsrid,
-				   PJ_CATEGORY_CRS, 0, NULL);
+	proj_create_from_database (splite_get_proj_handle (cache), auth_name,
+				   xsrid, PJ_CATEGORY_CRS, 0, NULL);
     if (crs_def == NULL)
 	return NULL;
 
@@ -1232,7 +1237,7 @@ gaiaGetProjWKT (const void *p_cache, const char *auth_name, int auth_srid,
 	indentation = 8;
     sprintf (dummy, "INDENTATION_WIDTH=%d", indentation);
     wkt =
-	proj_as_wkt (cache->PROJ_handle, crs_def, proj_style,
+	proj_as_wkt (splite_get_proj_handle (cache), crs_def, proj_style,
 		     (const char *const *) options);
     if (wkt == NULL)
       {
@@ -1263,11 +1268,13 @@ gaiaGuessSridFromWKT (sqlite3 * sqlite, const void *p_cache, const char *wkt,
 /* sanity check */
     if (cache == NULL)
 	goto error;
-    if (cache->PROJ_handle == NULL)
+    if (splite_get_proj_handle (cache) == NULL)
 	goto error;
 
 /* attempting to parse the WKT expression */
-    crs1 = proj_create_from_wkt (cache->PROJ_handle, wkt, NULL, NULL, NULL);
+    crs1 =
+	proj_create_from_wkt (splite_get_proj_handle (cache), wkt, NULL, NULL,
+			      NULL);
     if (crs1 == NULL)
       {
 	  spatialite_e
@@ -1298,8 +1305,9 @@ gaiaGuessSridFromWKT (sqlite3 * sqlite, const void *p_cache, const char *wkt,
 		sprintf (dummy, "%d", auth_srid);
 		/* parsing some CRS */
 		crs2 =
-		    proj_create_from_database (cache->PROJ_handle, auth_name,
-					       dummy, PJ_CATEGORY_CRS, 0, NULL);
+		    proj_create_from_database (splite_get_proj_handle (cache),
+					       auth_name, dummy,
+					       PJ_CATEGORY_CRS, 0, NULL);
 		if (crs2 != NULL)
 		  {
 		      /* ok, it's a valid CRS - comparing */
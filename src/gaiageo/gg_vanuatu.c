@@ -48,6 +48,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <float.h>
 
 #include <assert.h>
 
@@ -61,6 +62,11 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite/debug.h>
 
 #include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
+
+#ifdef _WIN32
+#define strncasecmp	_strnicmp
+#endif /* not WIN32 */
 
 #if defined(_WIN32) || defined(WIN32)
 #include <io.h>
@@ -1856,18 +1862,648 @@ vanuatu_cleanup (vanuatuFlexToken * token)
     return 0;
 }
 
+/*
+** direct WKT parser: a single scan of the input text filling the
+** coordinate arrays in place, with no per-token or per-vertex
+** allocations.
+**
+** it only accepts well-formed input using the plain number notation
+** (an optional sign, digits, an optional fraction and exponent);
+** anything else (syntax errors, degenerated geometries, exotic number
+** forms) simply returns NULL, so that the Flex/Lemon parser is invoked
+** and will report exactly the same result as before.
+**
+** the same code also serves the EWKT parser (gg_ewkt.c), and the
+** number conversion is shared with the GeoJSON parser (gg_geoJSON.c)
+*/
+
+#define VANUATU_FAST_MAX_DEPTH	64
+
+static const double vanuatu_fast_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const char *
+vanuatuFastSkip (const char *p)
+{
+/* skipping white spaces (as the Flex lexer does) */
+    while (*p == ' ' || *p == '\t' || *p == '\n')
+	p++;
+    return p;
+}
+
+SPATIALITE_PRIVATE int
+gaia_fast_parse_number (const char **ptr, double *value)
+{
+/* parsing a number; returns 0 on any unexpected form */
+    const char *start = *ptr;
+    const char *p = start;
+    sqlite3_uint64 mantissa = 0;
+    int overflow = 0;
+    int exp10 = 0;
+    int exp_val = 0;
+    int exp_neg = 0;
+    int neg = 0;
+    int digits = 0;
+    double v;
+    char buf[128];
+
+    if (*p == '-' || *p == '+')
+      {
+	  neg = (*p == '-');
+	  p++;
+      }
+    while (*p >= '0' && *p <= '9')
+      {
+	  if (mantissa < 1844674407370955161ULL)
+	      mantissa = (mantissa * 10) + (*p - '0');
+	  else
+	      overflow = 1;
+	  digits++;
+	  p++;
+      }
+    if (!digits)
+	return 0;
+    if (*p == '.')
+      {
+	  p++;
+	  digits = 0;
+	  while (*p >= '0' && *p <= '9')
+	    {
+		if (mantissa < 1844674407370955161ULL)
+		  {
+		      mantissa = (mantissa * 10) + (*p - '0');
+		      exp10--;
+		  }
+		else
+		    overflow = 1;
+		digits++;
+		p++;
+	    }
+	  if (!digits)
+	      return 0;
+      }
+    if (*p == 'e' || *p == 'E')
+      {
+	  p++;
+	  if (*p == '-' || *p == '+')
+	    {
+		exp_neg = (*p == '-');
+		p++;
+	    }
+	  digits = 0;
+	  while (*p >= '0' && *p <= '9')
+	    {
+		if (exp_val < 100000)
+		    exp_val = (exp_val * 10) + (*p - '0');
+		digits++;
+		p++;
+	    }
+	  if (!digits)
+	      return 0;
+	  exp10 += exp_neg ? -exp_val : exp_val;
+      }
+    if (!(*p == ' ' || *p == '\t' || *p == '\n' || *p == ',' || *p == ')'
+	  || *p == ']'))
+	return 0;
+    *ptr = p;
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    if (!overflow && mantissa <= 9007199254740992ULL && exp10 >= -22
+	&& exp10 <= 22)
+      {
+	  /* exactly representable operands: a single IEEE operation
+	     gives the same correctly rounded value as atof() */
+	  v = (double) mantissa;
+	  if (exp10 < 0)
+	      v /= vanuatu_fast_pow10[-exp10];
+	  else
+	      v *= vanuatu_fast_pow10[exp10];
+	  *value = neg ? -v : v;
+	  return 1;
+      }
+#endif
+    if (p - start >= (int) sizeof (buf))
+	return 0;
+    memcpy (buf, start, p - start);
+    buf[p - start] = '\0';
+    *value = atof (buf);
+    return 1;
+}
+
+static int
+vanuatuFastCoords (const char **ptr, int dims, double *coords)
+{
+/* parsing a single vertex */
+    int ic;
+    const char *p = *ptr;
+    for (ic = 0; ic < dims; ic++)
+      {
+	  p = vanuatuFastSkip (p);
+	  if (!gaia_fast_parse_number (&p, coords + ic))
+	      return 0;
+      }
+    *ptr = p;
+    return 1;
+}
+
+static int
+vanuatuFastCountPoints (const char *p)
+{
+/* counting the vertices of a (x y, x y, ...) list */
+    int count = 1;
+    while (*p != ')')
+      {
+	  if (*p == '\0' || *p == '(')
+	      return -1;
+	  if (*p == ',')
+	      count++;
+	  p++;
+      }
+    return count;
+}
+
+static int
+vanuatuFastCountRings (const char *p)
+{
+/* counting the rings of a ((...), (...), ...) list */
+    int count = 0;
+    int depth = 0;
+    while (1)
+      {
+	  if (*p == '\0')
+	      return -1;
+	  if (*p == '(')
+	    {
+		if (depth == 0)
+		    count++;
+		depth++;
+	    }
+	  if (*p == ')')
+	    {
+		if (depth == 0)
+		    break;
+		depth--;
+	    }
+	  p++;
+      }
+    return count;
+}
+
+static int
+vanuatuFastPointList (const char **ptr, int dims, int points,
+		      double *coords)
+{
+/* parsing the vertices of a (x y, x y, ...) list into a Coords array */
+    int iv;
+    const char *p = *ptr;
+    for (iv = 0; iv < points; iv++)
+      {
+	  if (!vanuatuFastCoords (&p, dims, coords + (iv * dims)))
+	      return 0;
+	  p = vanuatuFastSkip (p);
+	  if (*p != ((iv == points - 1) ? ')' : ','))
+	      return 0;
+	  p++;
+      }
+    *ptr = p;
+    return 1;
+}
+
+static void
+vanuatuFastAddPoint (gaiaGeomCollPtr geom, double *coords)
+{
+/* adding a POINT to the Geometry */
+    switch (geom->DimensionModel)
+      {
+      case GAIA_XY_Z:
+	  gaiaAddPointToGeomCollXYZ (geom, coords[0], coords[1], coords[2]);
+	  break;
+      case GAIA_XY_M:
+	  gaiaAddPointToGeomCollXYM (geom, coords[0], coords[1], coords[2]);
+	  break;
+      case GAIA_XY_Z_M:
+	  gaiaAddPointToGeomCollXYZM (geom, coords[0], coords[1], coords[2],
+				      coords[3]);
+	  break;
+      default:
+	  gaiaAddPointToGeomColl (geom, coords[0], coords[1]);
+	  break;
+      };
+}
+
+static int
+vanuatuFastPoint (const char **ptr, gaiaGeomCollPtr geom, int dims)
+{
+/* parsing a POINT body: (x y) */
+    double coords[4];
+    const char *p = vanuatuFastSkip (*ptr);
+    if (*p != '(')
+	return 0;
+    p++;
+    if (!vanuatuFastCoords (&p, dims, coords))
+	return 0;
+    p = vanuatuFastSkip (p);
+    if (*p != ')')
+	return 0;
+    vanuatuFastAddPoint (geom, coords);
+    *ptr = p + 1;
+    return 1;
+}
+
+static int
+vanuatuFastLinestring (const char **ptr, gaiaGeomCollPtr geom, int dims)
+{
+/* parsing a LINESTRING body: (x y, x y, ...) */
+    gaiaLinestringPtr ln;
+    int points;
+    const char *p = vanuatuFastSkip (*ptr);
+    if (*p != '(')
+	return 0;
+    p++;
+    points = vanuatuFastCountPoints (p);
+    if (points < 2)
+	return 0;
+    ln = gaiaAddLinestringToGeomColl (geom, points);
+    if (!vanuatuFastPointList (&p, dims, points, ln->Coords))
+	return 0;
+    *ptr = p;
+    return 1;
+}
+
+static int
+vanuatuFastPolygon (const char **ptr, gaiaGeomCollPtr geom, int dims)
+{
+/* parsing a POLYGON body: ((x y, ...), (x y, ...), ...) */
+    gaiaPolygonPtr pg = NULL;
+    gaiaRingPtr rng;
+    int rings;
+    int ir;
+    int points;
+    const char *p = vanuatuFastSkip (*ptr);
+    if (*p != '(')
+	return 0;
+    p++;
+    rings = vanuatuFastCountRings (p);
+    if (rings < 1)
+	return 0;
+    for (ir = 0; ir < rings; ir++)
+      {
+	  p = vanuatuFastSkip (p);
+	  if (*p != '(')
+	      return 0;
+	  p++;
+	  points = vanuatuFastCountPoints (p);
+	  if (points < 4)
+	      return 0;
+	  if (ir == 0)
+	    {
+		pg = gaiaAddPolygonToGeomColl (geom, points, rings - 1);
+		rng = pg->Exterior;
+	    }
+	  else
+	      rng = gaiaAddInteriorRing (pg, ir - 1, points);
+	  if (!vanuatuFastPointList (&p, dims, points, rng->Coords))
+	      return 0;
+	  p = vanuatuFastSkip (p);
+	  if (*p != ((ir == rings - 1) ? ')' : ','))
+	      return 0;
+	  p++;
+      }
+    *ptr = p;
+    return 1;
+}
+
+static int
+vanuatuFastMultipoint (const char **ptr, gaiaGeomCollPtr geom, int dims)
+{
+/* parsing a MULTIPOINT body: (x y, ...) or ((x y), ...) */
+    double coords[4];
+    int bracketed;
+    const char *p = vanuatuFastSkip (*ptr);
+    if (*p != '(')
+	return 0;
+    p = vanuatuFastSkip (p + 1);
+    bracketed = (*p == '(');
+    while (1)
+      {
+	  if (bracketed)
+	    {
+		if (!vanuatuFastPoint (&p, geom, dims))
+		    return 0;
+	    }
+	  else
+	    {
+		if (!vanuatuFastCoords (&p, dims, coords))
+		    return 0;
+		vanuatuFastAddPoint (geom, coords);
+	    }
+	  p = vanuatuFastSkip (p);
+	  if (*p == ')')
+	      break;
+	  if (*p != ',')
+	      return 0;
+	  p++;
+      }
+    *ptr = p + 1;
+    return 1;
+}
+
+static int
+vanuatuFastMulti (const char **ptr, gaiaGeomCollPtr geom, int dims,
+		  int (*item) (const char **, gaiaGeomCollPtr, int))
+{
+/* parsing a MULTILINESTRING or MULTIPOLYGON body */
+    const char *p = vanuatuFastSkip (*ptr);
+    if (*p != '(')
+	return 0;
+    p++;
+    while (1)
+      {
+	  if (!item (&p, geom, dims))
+	      return 0;
+	  p = vanuatuFastSkip (p);
+	  if (*p == ')')
+	      break;
+	  if (*p != ',')
+	      return 0;
+	  p++;
+      }
+    *ptr = p + 1;
+    return 1;
+}
+
+static int
+vanuatuFastTag (const char **ptr, int *type, int *dims, int ewkt)
+{
+/* parsing a Geometry Type tag, e.g. POINT or MULTIPOLYGON ZM
+/  (EWKT: POINT or POINTM, dims being left to the caller as -1) */
+    static const char *names[] = {
+	"POINT", "LINESTRING", "POLYGON", "MULTIPOINT", "MULTILINESTRING",
+	"MULTIPOLYGON", "GEOMETRYCOLLECTION"
+    };
+    static const int types[] = {
+	GAIA_POINT, GAIA_LINESTRING, GAIA_POLYGON, GAIA_MULTIPOINT,
+	GAIA_MULTILINESTRING, GAIA_MULTIPOLYGON, GAIA_GEOMETRYCOLLECTION
+    };
+    const char *p = *ptr;
+    const char *q;
+    int i;
+    int len;
+    for (i = 0; i < 7; i++)
+      {
+	  len = strlen (names[i]);
+	  if (strncasecmp (p, names[i], len) == 0)
+	    {
+		/* rejecting any longer keyword, e.g. POINTS */
+		char c = p[len];
+		if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+		  {
+		      if (c != 'z' && c != 'Z' && c != 'm' && c != 'M')
+			  continue;
+		  }
+		break;
+	    }
+      }
+    if (i >= 7)
+	return 0;
+    *type = types[i];
+    p += len;
+    if (ewkt)
+      {
+	  /* EWKT: an M suffix is part of the keyword itself */
+	  if (*p == 'm' || *p == 'M')
+	    {
+		if ((p[1] >= 'a' && p[1] <= 'z') || (p[1] >= 'A' && p[1] <= 'Z'))
+		    return 0;
+		*dims = GAIA_XY_M;
+		p++;
+	    }
+	  else if ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z'))
+	      return 0;
+	  else
+	      *dims = -1;
+	  *ptr = p;
+	  return 1;
+      }
+    q = vanuatuFastSkip (p);
+    if (*q == 'z' || *q == 'Z')
+      {
+	  q++;
+	  if (*q == 'm' || *q == 'M')
+	    {
+		q++;
+		*dims = GAIA_XY_Z_M;
+	    }
+	  else
+	      *dims = GAIA_XY_Z;
+	  p = q;
+      }
+    else if (*q == 'm' || *q == 'M')
+      {
+	  *dims = GAIA_XY_M;
+	  p = q + 1;
+      }
+    else
+	*dims = GAIA_XY;
+    *ptr = p;
+    return 1;
+}
+
+static int
+vanuatuFastBody (const char **ptr, gaiaGeomCollPtr geom, int type,
+		 int depth)
+{
+/* parsing the body of any Geometry Type */
+    int dims;
+    int child_type;
+    int child_dims;
+    const char *p;
+    switch (geom->DimensionModel)
+      {
+      case GAIA_XY_Z:
+      case GAIA_XY_M:
+	  dims = 3;
+	  break;
+      case GAIA_XY_Z_M:
+	  dims = 4;
+	  break;
+      default:
+	  dims = 2;
+	  break;
+      };
+    switch (type)
+      {
+      case GAIA_POINT:
+	  return vanuatuFastPoint (ptr, geom, dims);
+      case GAIA_LINESTRING:
+	  return vanuatuFastLinestring (ptr, geom, dims);
+      case GAIA_POLYGON:
+	  return vanuatuFastPolygon (ptr, geom, dims);
+      case GAIA_MULTIPOINT:
+	  return vanuatuFastMultipoint (ptr, geom, dims);
+      case GAIA_MULTILINESTRING:
+	  return vanuatuFastMulti (ptr, geom, dims, vanuatuFastLinestring);
+      case GAIA_MULTIPOLYGON:
+	  return vanuatuFastMulti (ptr, geom, dims, vanuatuFastPolygon);
+      };
+
+/* GEOMETRYCOLLECTION: any item must share the same dimensions */
+    if (depth >= VANUATU_FAST_MAX_DEPTH)
+	return 0;
+    p = vanuatuFastSkip (*ptr);
+    if (*p != '(')
+	return 0;
+    p++;
+    while (1)
+      {
+	  p = vanuatuFastSkip (p);
+	  if (!vanuatuFastTag (&p, &child_type, &child_dims, 0))
+	      return 0;
+	  if (child_dims != geom->DimensionModel)
+	      return 0;
+	  if (!vanuatuFastBody (&p, geom, child_type, depth + 1))
+	      return 0;
+	  p = vanuatuFastSkip (p);
+	  if (*p == ')')
+	      break;
+	  if (*p != ',')
+	      return 0;
+	  p++;
+      }
+    *ptr = p + 1;
+    return 1;
+}
+
+static int
+vanuatuFastCountDims (const char *p)
+{
+/* counting the coordinates of the first vertex (EWKT) */
+    int count = 0;
+    while (*p == '(' || *p == ' ' || *p == '\t' || *p == '\n')
+	p++;
+    while (*p != ',' && *p != ')')
+      {
+	  if (*p == '\0' || *p == '(')
+	      return 0;
+	  if (*p == ' ' || *p == '\t' || *p == '\n')
+	    {
+		p++;
+		continue;
+	    }
+	  count++;
+	  while (!(*p == ' ' || *p == '\t' || *p == '\n' || *p == ','
+		   || *p == '(' || *p == ')' || *p == '\0'))
+	      p++;
+      }
+    return count;
+}
+
+static gaiaGeomCollPtr
+vanuatuFastParse (const char *p, int ewkt)
+{
+/* attempting to directly parse a WKT (or EWKT) expression */
+    gaiaGeomCollPtr geom;
+    int type;
+    int dims;
+    p = vanuatuFastSkip (p);
+    if (!vanuatuFastTag (&p, &type, &dims, ewkt))
+	return NULL;
+    if (ewkt)
+      {
+	  /* EWKT collections follow their own rules */
+	  if (type == GAIA_GEOMETRYCOLLECTION)
+	      return NULL;
+	  if (dims < 0)
+	    {
+		/* EWKT: dimensions implied by the coordinates count */
+		switch (vanuatuFastCountDims (p))
+		  {
+		  case 2:
+		      dims = GAIA_XY;
+		      break;
+		  case 3:
+		      dims = GAIA_XY_Z;
+		      break;
+		  case 4:
+		      dims = GAIA_XY_Z_M;
+		      break;
+		  default:
+		      return NULL;
+		  };
+	    }
+      }
+    switch (dims)
+      {
+      case GAIA_XY_Z:
+	  geom = gaiaAllocGeomCollXYZ ();
+	  break;
+      case GAIA_XY_M:
+	  geom = gaiaAllocGeomCollXYM ();
+	  break;
+      case GAIA_XY_Z_M:
+	  geom = gaiaAllocGeomCollXYZM ();
+	  break;
+      default:
+	  geom = gaiaAllocGeomColl ();
+	  break;
+      };
+    if (geom == NULL)
+	return NULL;
+    geom->DeclaredType = type;
+    if (type == GAIA_POINT)
+      {
+	  /* only POINTs carry dimensions into the declared type */
+	  if (dims == GAIA_XY_Z)
+	      geom->DeclaredType = GAIA_POINTZ;
+	  else if (dims == GAIA_XY_M)
+	      geom->DeclaredType = GAIA_POINTM;
+	  else if (dims == GAIA_XY_Z_M)
+	      geom->DeclaredType = GAIA_POINTZM;
+      }
+    if (!vanuatuFastBody (&p, geom, type, 0))
+      {
+	  gaiaFreeGeomColl (geom);
+	  return NULL;
+      }
+    p = vanuatuFastSkip (p);
+    if (*p != '\0')
+      {
+	  gaiaFreeGeomColl (geom);
+	  return NULL;
+      }
+    return geom;
+}
+
+SPATIALITE_PRIVATE void *
+gaia_fast_parse_ewkt (const char *text)
+{
+/* direct parser for the EWKT body following any SRID=n; prefix */
+    return vanuatuFastParse (text, 1);
+}
+
 gaiaGeomCollPtr
 gaiaParseWkt (const unsigned char *dirty_buffer, short type)
 {
-    void *pParser = ParseAlloc (malloc);
+    void *pParser;
     /* Linked-list of token values */
-    vanuatuFlexToken *tokens = malloc (sizeof (vanuatuFlexToken));
+    vanuatuFlexToken *tokens;
     /* Pointer to the head of the list */
-    vanuatuFlexToken *head = tokens;
+    vanuatuFlexToken *head;
     int yv;
     yyscan_t scanner;
     struct vanuatu_data str_data;
 
+/* attempting first the direct parser */
+    str_data.result = vanuatuFastParse ((const char *) dirty_buffer, 0);
+    if (str_data.result != NULL)
+	goto check_type;
+
+    pParser = ParseAlloc (malloc);
+    tokens = malloc (sizeof (vanuatuFlexToken));
+    head = tokens;
+
 /* initializing the helper structs */
     str_data.vanuatu_line = 1;
     str_data.vanuatu_col = 1;
@@ -1942,6 +2578,7 @@ gaiaParseWkt (const unsigned char *dirty_buffer, short type)
 	  gaiaFreeGeomColl (str_data.result);
 	  return NULL;
       }
+  check_type:
     if (type < 0)
 	;			/* no restrinction about GEOMETRY CLASS TYPE */
     else
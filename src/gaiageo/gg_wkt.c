@@ -59,6 +59,12 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #include <spatialite/gaiageo.h>
 
+/* a formatted coordinate: sign, 309 integer digits, point and decimals */
+#define GAIA_OUT_MAX_PRECISION	350
+#define GAIA_OUT_NUMBER_SIZE	1024
+/* a formatted vertex: up to four coordinates plus separators */
+#define GAIA_OUT_VERTEX_SIZE	4224
+
 static void
 gaiaOutClean (char *buffer)
 {
@@ -89,6 +95,24 @@ gaiaOutClean (char *buffer)
       }
 }
 
+static void
+gaiaOutFormatDouble (char *buffer, int precision, double value)
+{
+/* 
+/ formats a coordinate value into a caller supplied buffer
+/ of GAIA_OUT_NUMBER_SIZE bytes without any heap allocation
+/
+/ SQLite never prints more than 26 significant digits, so
+/ clamping the precision just drops trailing zeros that
+/ gaiaOutClean() would remove in any case
+*/
+    if (precision > GAIA_OUT_MAX_PRECISION)
+	precision = GAIA_OUT_MAX_PRECISION;
+    else if (precision < -GAIA_OUT_MAX_PRECISION)
+	precision = -GAIA_OUT_MAX_PRECISION;
+    sqlite3_snprintf (GAIA_OUT_NUMBER_SIZE, buffer, "%.*f", precision, value);
+}
+
 GAIAGEO_DECLARE void
 gaiaOutBufferInitialize (gaiaOutBufferPtr buf)
 {
@@ -129,7 +153,7 @@ gaiaAppendToOutBuffer (gaiaOutBufferPtr buf, const char *text)
 	  else if (buf->BufferSize <= 65536)
 	      new_size = buf->BufferSize + (len + 1) + 65536;
 	  else
-	      new_size = buf->BufferSize + (len + 1) + (1024 * 1024);
+	      new_size = (buf->BufferSize * 2) + (len + 1);
 	  new_buf = malloc (new_size);
 	  if (!new_buf)
 	    {
@@ -150,73 +174,64 @@ static void
 gaiaOutPointStrict (gaiaOutBufferPtr out_buf, gaiaPointPtr point, int precision)
 {
 /* formats a WKT POINT [Strict 2D] */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
-    buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
+    gaiaOutFormatDouble (buf_x, precision, point->X);
     gaiaOutClean (buf_x);
-    buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
+    gaiaOutFormatDouble (buf_y, precision, point->Y);
     gaiaOutClean (buf_y);
-    buf = sqlite3_mprintf ("%s %s", buf_x, buf_y);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s", buf_x, buf_y);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 static void
 gaiaOutPoint (gaiaOutBufferPtr out_buf, gaiaPointPtr point, int precision)
 {
 /* formats a WKT POINT */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     if (precision < 0)
-	buf_x = sqlite3_mprintf ("%1.6f", point->X);
+	gaiaOutFormatDouble (buf_x, 6, point->X);
     else
-	buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+	gaiaOutFormatDouble (buf_x, precision, point->X);
     gaiaOutClean (buf_x);
     if (precision < 0)
-	buf_y = sqlite3_mprintf ("%1.6f", point->Y);
+	gaiaOutFormatDouble (buf_y, 6, point->Y);
     else
-	buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
+	gaiaOutFormatDouble (buf_y, precision, point->Y);
     gaiaOutClean (buf_y);
-    buf = sqlite3_mprintf ("%s %s", buf_x, buf_y);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s", buf_x, buf_y);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 GAIAGEO_DECLARE void
 gaiaOutPointZex (gaiaOutBufferPtr out_buf, gaiaPointPtr point, int precision)
 {
 /* formats a WKT POINTZ */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     if (precision < 0)
-	buf_x = sqlite3_mprintf ("%1.6f", point->X);
+	gaiaOutFormatDouble (buf_x, 6, point->X);
     else
-	buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+	gaiaOutFormatDouble (buf_x, precision, point->X);
     gaiaOutClean (buf_x);
     if (precision < 0)
-	buf_y = sqlite3_mprintf ("%1.6f", point->Y);
+	gaiaOutFormatDouble (buf_y, 6, point->Y);
     else
-	buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
+	gaiaOutFormatDouble (buf_y, precision, point->Y);
     gaiaOutClean (buf_y);
     if (precision < 0)
-	buf_z = sqlite3_mprintf ("%1.6f", point->Z);
+	gaiaOutFormatDouble (buf_z, 6, point->Z);
     else
-	buf_z = sqlite3_mprintf ("%.*f", precision, point->Z);
+	gaiaOutFormatDouble (buf_z, precision, point->Z);
     gaiaOutClean (buf_z);
-    buf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_z);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
-    sqlite3_free (buf_z);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s", buf_x, buf_y,
+		      buf_z);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 GAIAGEO_DECLARE void
@@ -233,157 +248,137 @@ static void
 gaiaOutPointM (gaiaOutBufferPtr out_buf, gaiaPointPtr point, int precision)
 {
 /* formats a WKT POINTM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     if (precision < 0)
-	buf_x = sqlite3_mprintf ("%1.6f", point->X);
+	gaiaOutFormatDouble (buf_x, 6, point->X);
     else
-	buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+	gaiaOutFormatDouble (buf_x, precision, point->X);
     gaiaOutClean (buf_x);
     if (precision < 0)
-	buf_y = sqlite3_mprintf ("%1.6f", point->Y);
+	gaiaOutFormatDouble (buf_y, 6, point->Y);
     else
-	buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
+	gaiaOutFormatDouble (buf_y, precision, point->Y);
     gaiaOutClean (buf_y);
     if (precision < 0)
-	buf_m = sqlite3_mprintf ("%1.6f", point->M);
+	gaiaOutFormatDouble (buf_m, 6, point->M);
     else
-	buf_m = sqlite3_mprintf ("%.*f", precision, point->M);
+	gaiaOutFormatDouble (buf_m, precision, point->M);
     gaiaOutClean (buf_m);
-    buf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_m);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
-    sqlite3_free (buf_m);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s", buf_x, buf_y,
+		      buf_m);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 static void
 gaiaOutPointZM (gaiaOutBufferPtr out_buf, gaiaPointPtr point, int precision)
 {
 /* formats a WKT POINTZM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     if (precision < 0)
-	buf_x = sqlite3_mprintf ("%1.6f", point->X);
+	gaiaOutFormatDouble (buf_x, 6, point->X);
     else
-	buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+	gaiaOutFormatDouble (buf_x, precision, point->X);
     gaiaOutClean (buf_x);
     if (precision < 0)
-	buf_y = sqlite3_mprintf ("%1.6f", point->Y);
+	gaiaOutFormatDouble (buf_y, 6, point->Y);
     else
-	buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
+	gaiaOutFormatDouble (buf_y, precision, point->Y);
     gaiaOutClean (buf_y);
     if (precision < 0)
-	buf_z = sqlite3_mprintf ("%1.6f", point->Z);
+	gaiaOutFormatDouble (buf_z, 6, point->Z);
     else
-	buf_z = sqlite3_mprintf ("%.*f", precision, point->Z);
+	gaiaOutFormatDouble (buf_z, precision, point->Z);
     gaiaOutClean (buf_z);
     if (precision < 0)
-	buf_m = sqlite3_mprintf ("%1.6f", point->M);
+	gaiaOutFormatDouble (buf_m, 6, point->M);
     else
-	buf_m = sqlite3_mprintf ("%.*f", precision, point->M);
+	gaiaOutFormatDouble (buf_m, precision, point->M);
     gaiaOutClean (buf_m);
-    buf = sqlite3_mprintf ("%s %s %s %s", buf_x, buf_y, buf_z, buf_m);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
-    sqlite3_free (buf_z);
-    sqlite3_free (buf_m);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s %s", buf_x, buf_y,
+		      buf_z, buf_m);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 static void
 gaiaOutEwktPoint (gaiaOutBufferPtr out_buf, gaiaPointPtr point)
 {
 /* formats an EWKT POINT */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
-    buf_x = sqlite3_mprintf ("%1.15f", point->X);
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
+    gaiaOutFormatDouble (buf_x, 15, point->X);
     gaiaOutClean (buf_x);
-    buf_y = sqlite3_mprintf ("%1.15f", point->Y);
+    gaiaOutFormatDouble (buf_y, 15, point->Y);
     gaiaOutClean (buf_y);
-    buf = sqlite3_mprintf ("%s %s", buf_x, buf_y);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s", buf_x, buf_y);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 GAIAGEO_DECLARE void
 gaiaOutEwktPointZ (gaiaOutBufferPtr out_buf, gaiaPointPtr point)
 {
 /* formats an EWKT POINTZ */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf;
-    buf_x = sqlite3_mprintf ("%1.15f", point->X);
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
+    gaiaOutFormatDouble (buf_x, 15, point->X);
     gaiaOutClean (buf_x);
-    buf_y = sqlite3_mprintf ("%1.15f", point->Y);
+    gaiaOutFormatDouble (buf_y, 15, point->Y);
     gaiaOutClean (buf_y);
-    buf_z = sqlite3_mprintf ("%1.15f", point->Z);
+    gaiaOutFormatDouble (buf_z, 15, point->Z);
     gaiaOutClean (buf_z);
-    buf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_z);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
-    sqlite3_free (buf_z);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s", buf_x, buf_y,
+		      buf_z);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 static void
 gaiaOutEwktPointM (gaiaOutBufferPtr out_buf, gaiaPointPtr point)
 {
 /* formats an EWKT POINTM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_m;
-    char *buf;
-    buf_x = sqlite3_mprintf ("%1.15f", point->X);
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
+    gaiaOutFormatDouble (buf_x, 15, point->X);
     gaiaOutClean (buf_x);
-    buf_y = sqlite3_mprintf ("%1.15f", point->Y);
+    gaiaOutFormatDouble (buf_y, 15, point->Y);
     gaiaOutClean (buf_y);
-    buf_m = sqlite3_mprintf ("%1.15f", point->M);
+    gaiaOutFormatDouble (buf_m, 15, point->M);
     gaiaOutClean (buf_m);
-    buf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_m);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
-    sqlite3_free (buf_m);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s", buf_x, buf_y,
+		      buf_m);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 static void
 gaiaOutEwktPointZM (gaiaOutBufferPtr out_buf, gaiaPointPtr point)
 {
 /* formats an EWKT POINTZM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf_m;
-    char *buf;
-    buf_x = sqlite3_mprintf ("%1.15f", point->X);
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
+    gaiaOutFormatDouble (buf_x, 15, point->X);
     gaiaOutClean (buf_x);
-    buf_y = sqlite3_mprintf ("%1.15f", point->Y);
+    gaiaOutFormatDouble (buf_y, 15, point->Y);
     gaiaOutClean (buf_y);
-    buf_z = sqlite3_mprintf ("%1.15f", point->Z);
+    gaiaOutFormatDouble (buf_z, 15, point->Z);
     gaiaOutClean (buf_z);
-    buf_m = sqlite3_mprintf ("%1.15f", point->M);
+    gaiaOutFormatDouble (buf_m, 15, point->M);
     gaiaOutClean (buf_m);
-    buf = sqlite3_mprintf ("%s %s %s %s", buf_x, buf_y, buf_z, buf_m);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
-    sqlite3_free (buf_z);
-    sqlite3_free (buf_m);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s %s", buf_x, buf_y,
+		      buf_z, buf_m);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 static void
@@ -391,9 +386,9 @@ gaiaOutLinestringStrict (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
 			 int precision)
 {
 /* formats a WKT LINESTRING [Strict 2D] */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double z;
@@ -417,18 +412,17 @@ gaiaOutLinestringStrict (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
 	    {
 		gaiaGetPoint (line->Coords, iv, &x, &y);
 	    }
-	  buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	  gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	  gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (iv > 0)
-	      buf = sqlite3_mprintf (",%s %s", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s", buf_x,
+				buf_y);
 	  else
-	      buf = sqlite3_mprintf ("%s %s", buf_x, buf_y);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s", buf_x,
+				buf_y);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -437,9 +431,9 @@ gaiaOutLinestring (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
 		   int precision)
 {
 /* formats a WKT LINESTRING */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     int iv;
@@ -447,23 +441,22 @@ gaiaOutLinestring (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
       {
 	  gaiaGetPoint (line->Coords, iv, &x, &y);
 	  if (precision < 0)
-	      buf_x = sqlite3_mprintf ("%1.6f", x);
+	      gaiaOutFormatDouble (buf_x, 6, x);
 	  else
-	      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	      gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
 	  if (precision < 0)
-	      buf_y = sqlite3_mprintf ("%1.6f", y);
+	      gaiaOutFormatDouble (buf_y, 6, y);
 	  else
-	      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	      gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (iv > 0)
-	      buf = sqlite3_mprintf (", %s %s", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s", buf_x,
+				buf_y);
 	  else
-	      buf = sqlite3_mprintf ("%s %s", buf_x, buf_y);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s", buf_x,
+				buf_y);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -472,10 +465,10 @@ gaiaOutLinestringZex (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
 		      int precision)
 {
 /* formats a WKT LINESTRINGZ */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double z;
@@ -484,29 +477,27 @@ gaiaOutLinestringZex (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
       {
 	  gaiaGetPointXYZ (line->Coords, iv, &x, &y, &z);
 	  if (precision < 0)
-	      buf_x = sqlite3_mprintf ("%1.6f", x);
+	      gaiaOutFormatDouble (buf_x, 6, x);
 	  else
-	      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	      gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
 	  if (precision < 0)
-	      buf_y = sqlite3_mprintf ("%1.6f", y);
+	      gaiaOutFormatDouble (buf_y, 6, y);
 	  else
-	      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	      gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (precision < 0)
-	      buf_z = sqlite3_mprintf ("%1.6f", z);
+	      gaiaOutFormatDouble (buf_z, 6, z);
 	  else
-	      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+	      gaiaOutFormatDouble (buf_z, precision, z);
 	  gaiaOutClean (buf_z);
 	  if (iv > 0)
-	      buf = sqlite3_mprintf (", %s %s %s", buf_x, buf_y, buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s", buf_x,
+				buf_y, buf_z);
 	  else
-	      buf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_z);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s", buf_x,
+				buf_y, buf_z);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -525,10 +516,10 @@ gaiaOutLinestringM (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
 		    int precision)
 {
 /* formats a WKT LINESTRINGM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double m;
@@ -537,29 +528,27 @@ gaiaOutLinestringM (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
       {
 	  gaiaGetPointXYM (line->Coords, iv, &x, &y, &m);
 	  if (precision < 0)
-	      buf_x = sqlite3_mprintf ("%1.6f", x);
+	      gaiaOutFormatDouble (buf_x, 6, x);
 	  else
-	      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	      gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
 	  if (precision < 0)
-	      buf_y = sqlite3_mprintf ("%1.6f", y);
+	      gaiaOutFormatDouble (buf_y, 6, y);
 	  else
-	      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	      gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (precision < 0)
-	      buf_m = sqlite3_mprintf ("%1.6f", m);
+	      gaiaOutFormatDouble (buf_m, 6, m);
 	  else
-	      buf_m = sqlite3_mprintf ("%.*f", precision, m);
+	      gaiaOutFormatDouble (buf_m, precision, m);
 	  gaiaOutClean (buf_m);
 	  if (iv > 0)
-	      buf = sqlite3_mprintf (", %s %s %s", buf_x, buf_y, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s", buf_x,
+				buf_y, buf_m);
 	  else
-	      buf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_m);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s", buf_x,
+				buf_y, buf_m);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -568,11 +557,11 @@ gaiaOutLinestringZM (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
 		     int precision)
 {
 /* formats a WKT LINESTRINGZM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double z;
@@ -582,36 +571,32 @@ gaiaOutLinestringZM (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line,
       {
 	  gaiaGetPointXYZM (line->Coords, iv, &x, &y, &z, &m);
 	  if (precision < 0)
-	      buf_x = sqlite3_mprintf ("%1.6f", x);
+	      gaiaOutFormatDouble (buf_x, 6, x);
 	  else
-	      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	      gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
 	  if (precision < 0)
-	      buf_y = sqlite3_mprintf ("%1.6f", y);
+	      gaiaOutFormatDouble (buf_y, 6, y);
 	  else
-	      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	      gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (precision < 0)
-	      buf_z = sqlite3_mprintf ("%1.6f", z);
+	      gaiaOutFormatDouble (buf_z, 6, z);
 	  else
-	      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+	      gaiaOutFormatDouble (buf_z, precision, z);
 	  gaiaOutClean (buf_z);
 	  if (precision < 0)
-	      buf_m = sqlite3_mprintf ("%1.6f", m);
+	      gaiaOutFormatDouble (buf_m, 6, m);
 	  else
-	      buf_m = sqlite3_mprintf ("%.*f", precision, m);
+	      gaiaOutFormatDouble (buf_m, precision, m);
 	  gaiaOutClean (buf_m);
 	  if (iv > 0)
-	      buf =
-		  sqlite3_mprintf (", %s %s %s %s", buf_x, buf_y, buf_z, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s %s",
+				buf_x, buf_y, buf_z, buf_m);
 	  else
-	      buf = sqlite3_mprintf ("%s %s %s %s", buf_x, buf_y, buf_z, buf_m);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_z);
-	  sqlite3_free (buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s %s",
+				buf_x, buf_y, buf_z, buf_m);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -619,27 +604,26 @@ static void
 gaiaOutEwktLinestring (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line)
 {
 /* formats an EWKT LINESTRING */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     int iv;
     for (iv = 0; iv < line->Points; iv++)
       {
 	  gaiaGetPoint (line->Coords, iv, &x, &y);
-	  buf_x = sqlite3_mprintf ("%1.15f", x);
+	  gaiaOutFormatDouble (buf_x, 15, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%1.15f", y);
+	  gaiaOutFormatDouble (buf_y, 15, y);
 	  gaiaOutClean (buf_y);
 	  if (iv > 0)
-	      buf = sqlite3_mprintf (",%s %s", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s", buf_x,
+				buf_y);
 	  else
-	      buf = sqlite3_mprintf ("%s %s", buf_x, buf_y);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s", buf_x,
+				buf_y);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -647,10 +631,10 @@ GAIAGEO_DECLARE void
 gaiaOutEwktLinestringZ (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line)
 {
 /* formats an EWKT LINESTRINGZ */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double z;
@@ -658,21 +642,19 @@ gaiaOutEwktLinestringZ (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line)
     for (iv = 0; iv < line->Points; iv++)
       {
 	  gaiaGetPointXYZ (line->Coords, iv, &x, &y, &z);
-	  buf_x = sqlite3_mprintf ("%1.15f", x);
+	  gaiaOutFormatDouble (buf_x, 15, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%1.15f", y);
+	  gaiaOutFormatDouble (buf_y, 15, y);
 	  gaiaOutClean (buf_y);
-	  buf_z = sqlite3_mprintf ("%1.15f", z);
+	  gaiaOutFormatDouble (buf_z, 15, z);
 	  gaiaOutClean (buf_z);
 	  if (iv > 0)
-	      buf = sqlite3_mprintf (",%s %s %s", buf_x, buf_y, buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s", buf_x,
+				buf_y, buf_z);
 	  else
-	      buf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_z);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s", buf_x,
+				buf_y, buf_z);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -680,10 +662,10 @@ static void
 gaiaOutEwktLinestringM (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line)
 {
 /* formats an EWKT LINESTRINGM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double m;
@@ -691,21 +673,19 @@ gaiaOutEwktLinestringM (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line)
     for (iv = 0; iv < line->Points; iv++)
       {
 	  gaiaGetPointXYM (line->Coords, iv, &x, &y, &m);
-	  buf_x = sqlite3_mprintf ("%1.15f", x);
+	  gaiaOutFormatDouble (buf_x, 15, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%1.15f", y);
+	  gaiaOutFormatDouble (buf_y, 15, y);
 	  gaiaOutClean (buf_y);
-	  buf_m = sqlite3_mprintf ("%1.15f", m);
+	  gaiaOutFormatDouble (buf_m, 15, m);
 	  gaiaOutClean (buf_m);
 	  if (iv > 0)
-	      buf = sqlite3_mprintf (",%s %s %s", buf_x, buf_y, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s", buf_x,
+				buf_y, buf_m);
 	  else
-	      buf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_m);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s", buf_x,
+				buf_y, buf_m);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -713,11 +693,11 @@ static void
 gaiaOutEwktLinestringZM (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line)
 {
 /* formats an EWKT LINESTRINGZM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double z;
@@ -726,25 +706,21 @@ gaiaOutEwktLinestringZM (gaiaOutBufferPtr out_buf, gaiaLinestringPtr line)
     for (iv = 0; iv < line->Points; iv++)
       {
 	  gaiaGetPointXYZM (line->Coords, iv, &x, &y, &z, &m);
-	  buf_x = sqlite3_mprintf ("%1.15f", x);
+	  gaiaOutFormatDouble (buf_x, 15, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%1.15f", y);
+	  gaiaOutFormatDouble (buf_y, 15, y);
 	  gaiaOutClean (buf_y);
-	  buf_z = sqlite3_mprintf ("%1.15f", z);
+	  gaiaOutFormatDouble (buf_z, 15, z);
 	  gaiaOutClean (buf_z);
-	  buf_m = sqlite3_mprintf ("%1.15f", m);
+	  gaiaOutFormatDouble (buf_m, 15, m);
 	  gaiaOutClean (buf_m);
 	  if (iv > 0)
-	      buf =
-		  sqlite3_mprintf (",%s %s %s %s", buf_x, buf_y, buf_z, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s %s",
+				buf_x, buf_y, buf_z, buf_m);
 	  else
-	      buf = sqlite3_mprintf ("%s %s %s %s", buf_x, buf_y, buf_z, buf_m);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_z);
-	  sqlite3_free (buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s %s %s",
+				buf_x, buf_y, buf_z, buf_m);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -753,9 +729,9 @@ gaiaOutPolygonStrict (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg,
 		      int precision)
 {
 /* formats a WKT POLYGON [Strict 2D] */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -781,20 +757,20 @@ gaiaOutPolygonStrict (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg,
 	    {
 		gaiaGetPoint (ring->Coords, iv, &x, &y);
 	    }
-	  buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	  gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	  gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("(%s %s", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s", buf_x,
+				buf_y);
 	  else if (iv == (ring->Points - 1))
-	      buf = sqlite3_mprintf (",%s %s)", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s)", buf_x,
+				buf_y);
 	  else
-	      buf = sqlite3_mprintf (",%s %s", buf_x, buf_y);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s", buf_x,
+				buf_y);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -817,20 +793,20 @@ gaiaOutPolygonStrict (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg,
 		  {
 		      gaiaGetPoint (ring->Coords, iv, &x, &y);
 		  }
-		buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		gaiaOutFormatDouble (buf_x, precision, x);
 		gaiaOutClean (buf_x);
-		buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		gaiaOutFormatDouble (buf_y, precision, y);
 		gaiaOutClean (buf_y);
 		if (iv == 0)
-		    buf = sqlite3_mprintf (",(%s %s", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",(%s %s",
+				      buf_x, buf_y);
 		else if (iv == (ring->Points - 1))
-		    buf = sqlite3_mprintf (",%s %s)", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s)",
+				      buf_x, buf_y);
 		else
-		    buf = sqlite3_mprintf (",%s %s", buf_x, buf_y);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s",
+				      buf_x, buf_y);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -839,9 +815,9 @@ static void
 gaiaOutPolygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
 {
 /* formats a WKT POLYGON */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -851,25 +827,25 @@ gaiaOutPolygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
       {
 	  gaiaGetPoint (ring->Coords, iv, &x, &y);
 	  if (precision < 0)
-	      buf_x = sqlite3_mprintf ("%1.6f", x);
+	      gaiaOutFormatDouble (buf_x, 6, x);
 	  else
-	      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	      gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
 	  if (precision < 0)
-	      buf_y = sqlite3_mprintf ("%1.6f", y);
+	      gaiaOutFormatDouble (buf_y, 6, y);
 	  else
-	      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	      gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("(%s %s", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s", buf_x,
+				buf_y);
 	  else if (iv == (ring->Points - 1))
-	      buf = sqlite3_mprintf (", %s %s)", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s)", buf_x,
+				buf_y);
 	  else
-	      buf = sqlite3_mprintf (", %s %s", buf_x, buf_y);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s", buf_x,
+				buf_y);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -878,25 +854,25 @@ gaiaOutPolygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
 	    {
 		gaiaGetPoint (ring->Coords, iv, &x, &y);
 		if (precision < 0)
-		    buf_x = sqlite3_mprintf ("%1.6f", x);
+		    gaiaOutFormatDouble (buf_x, 6, x);
 		else
-		    buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		    gaiaOutFormatDouble (buf_x, precision, x);
 		gaiaOutClean (buf_x);
 		if (precision < 0)
-		    buf_y = sqlite3_mprintf ("%1.6f", y);
+		    gaiaOutFormatDouble (buf_y, 6, y);
 		else
-		    buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		    gaiaOutFormatDouble (buf_y, precision, y);
 		gaiaOutClean (buf_y);
 		if (iv == 0)
-		    buf = sqlite3_mprintf (", (%s %s", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", (%s %s",
+				      buf_x, buf_y);
 		else if (iv == (ring->Points - 1))
-		    buf = sqlite3_mprintf (", %s %s)", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s)",
+				      buf_x, buf_y);
 		else
-		    buf = sqlite3_mprintf (", %s %s", buf_x, buf_y);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s",
+				      buf_x, buf_y);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -906,10 +882,10 @@ gaiaOutPolygonZex (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg,
 		   int precision)
 {
 /* formats a WKT POLYGONZ */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -920,31 +896,30 @@ gaiaOutPolygonZex (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg,
       {
 	  gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
 	  if (precision < 0)
-	      buf_x = sqlite3_mprintf ("%1.6f", x);
+	      gaiaOutFormatDouble (buf_x, 6, x);
 	  else
-	      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	      gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
 	  if (precision < 0)
-	      buf_y = sqlite3_mprintf ("%1.6f", y);
+	      gaiaOutFormatDouble (buf_y, 6, y);
 	  else
-	      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	      gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (precision < 0)
-	      buf_z = sqlite3_mprintf ("%1.6f", z);
+	      gaiaOutFormatDouble (buf_z, 6, z);
 	  else
-	      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+	      gaiaOutFormatDouble (buf_z, precision, z);
 	  gaiaOutClean (buf_z);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("(%s %s %s", buf_x, buf_y, buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s %s", buf_x,
+				buf_y, buf_z);
 	  else if (iv == (ring->Points - 1))
-	      buf = sqlite3_mprintf (", %s %s %s)", buf_x, buf_y, buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s)",
+				buf_x, buf_y, buf_z);
 	  else
-	      buf = sqlite3_mprintf (", %s %s %s", buf_x, buf_y, buf_z);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s", buf_x,
+				buf_y, buf_z);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -953,31 +928,30 @@ gaiaOutPolygonZex (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg,
 	    {
 		gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
 		if (precision < 0)
-		    buf_x = sqlite3_mprintf ("%1.6f", x);
+		    gaiaOutFormatDouble (buf_x, 6, x);
 		else
-		    buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		    gaiaOutFormatDouble (buf_x, precision, x);
 		gaiaOutClean (buf_x);
 		if (precision < 0)
-		    buf_y = sqlite3_mprintf ("%1.6f", y);
+		    gaiaOutFormatDouble (buf_y, 6, y);
 		else
-		    buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		    gaiaOutFormatDouble (buf_y, precision, y);
 		gaiaOutClean (buf_y);
 		if (precision < 0)
-		    buf_z = sqlite3_mprintf ("%1.6f", z);
+		    gaiaOutFormatDouble (buf_z, 6, z);
 		else
-		    buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		    gaiaOutFormatDouble (buf_z, precision, z);
 		gaiaOutClean (buf_z);
 		if (iv == 0)
-		    buf = sqlite3_mprintf (", (%s %s %s", buf_x, buf_y, buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", (%s %s %s",
+				      buf_x, buf_y, buf_z);
 		else if (iv == (ring->Points - 1))
-		    buf = sqlite3_mprintf (", %s %s %s)", buf_x, buf_y, buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s)",
+				      buf_x, buf_y, buf_z);
 		else
-		    buf = sqlite3_mprintf (", %s %s %s", buf_x, buf_y, buf_z);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s",
+				      buf_x, buf_y, buf_z);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -996,10 +970,10 @@ static void
 gaiaOutPolygonM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
 {
 /* formats a WKT POLYGONM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -1010,31 +984,30 @@ gaiaOutPolygonM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
       {
 	  gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
 	  if (precision < 0)
-	      buf_x = sqlite3_mprintf ("%1.6f", x);
+	      gaiaOutFormatDouble (buf_x, 6, x);
 	  else
-	      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	      gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
 	  if (precision < 0)
-	      buf_y = sqlite3_mprintf ("%1.6f", y);
+	      gaiaOutFormatDouble (buf_y, 6, y);
 	  else
-	      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	      gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (precision < 0)
-	      buf_m = sqlite3_mprintf ("%1.6f", m);
+	      gaiaOutFormatDouble (buf_m, 6, m);
 	  else
-	      buf_m = sqlite3_mprintf ("%.*f", precision, m);
+	      gaiaOutFormatDouble (buf_m, precision, m);
 	  gaiaOutClean (buf_m);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("(%s %s %s", buf_x, buf_y, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s %s", buf_x,
+				buf_y, buf_m);
 	  else if (iv == (ring->Points - 1))
-	      buf = sqlite3_mprintf (", %s %s %s)", buf_x, buf_y, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s)",
+				buf_x, buf_y, buf_m);
 	  else
-	      buf = sqlite3_mprintf (", %s %s %s", buf_x, buf_y, buf_m);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s", buf_x,
+				buf_y, buf_m);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -1043,31 +1016,30 @@ gaiaOutPolygonM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
 	    {
 		gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
 		if (precision < 0)
-		    buf_x = sqlite3_mprintf ("%1.6f", x);
+		    gaiaOutFormatDouble (buf_x, 6, x);
 		else
-		    buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		    gaiaOutFormatDouble (buf_x, precision, x);
 		gaiaOutClean (buf_x);
 		if (precision < 0)
-		    buf_y = sqlite3_mprintf ("%1.6f", y);
+		    gaiaOutFormatDouble (buf_y, 6, y);
 		else
-		    buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		    gaiaOutFormatDouble (buf_y, precision, y);
 		gaiaOutClean (buf_y);
 		if (precision < 0)
-		    buf_m = sqlite3_mprintf ("%1.6f", m);
+		    gaiaOutFormatDouble (buf_m, 6, m);
 		else
-		    buf_m = sqlite3_mprintf ("%.*f", precision, m);
+		    gaiaOutFormatDouble (buf_m, precision, m);
 		gaiaOutClean (buf_m);
 		if (iv == 0)
-		    buf = sqlite3_mprintf (", (%s %s %s", buf_x, buf_y, buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", (%s %s %s",
+				      buf_x, buf_y, buf_m);
 		else if (iv == (ring->Points - 1))
-		    buf = sqlite3_mprintf (", %s %s %s)", buf_x, buf_y, buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s)",
+				      buf_x, buf_y, buf_m);
 		else
-		    buf = sqlite3_mprintf (", %s %s %s", buf_x, buf_y, buf_m);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s",
+				      buf_x, buf_y, buf_m);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -1076,11 +1048,11 @@ static void
 gaiaOutPolygonZM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
 {
 /* formats a WKT POLYGONZM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -1092,41 +1064,35 @@ gaiaOutPolygonZM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
       {
 	  gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
 	  if (precision < 0)
-	      buf_x = sqlite3_mprintf ("%1.6f", x);
+	      gaiaOutFormatDouble (buf_x, 6, x);
 	  else
-	      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	      gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
 	  if (precision < 0)
-	      buf_y = sqlite3_mprintf ("%1.6f", y);
+	      gaiaOutFormatDouble (buf_y, 6, y);
 	  else
-	      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	      gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (precision < 0)
-	      buf_z = sqlite3_mprintf ("%1.6f", z);
+	      gaiaOutFormatDouble (buf_z, 6, z);
 	  else
-	      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+	      gaiaOutFormatDouble (buf_z, precision, z);
 	  gaiaOutClean (buf_z);
 	  if (precision < 0)
-	      buf_m = sqlite3_mprintf ("%1.6f", m);
+	      gaiaOutFormatDouble (buf_m, 6, m);
 	  else
-	      buf_m = sqlite3_mprintf ("%.*f", precision, m);
+	      gaiaOutFormatDouble (buf_m, precision, m);
 	  gaiaOutClean (buf_m);
 	  if (iv == 0)
-	      buf =
-		  sqlite3_mprintf ("(%s %s %s %s", buf_x, buf_y, buf_z, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s %s %s",
+				buf_x, buf_y, buf_z, buf_m);
 	  else if (iv == (ring->Points - 1))
-	      buf =
-		  sqlite3_mprintf (", %s %s %s %s)", buf_x, buf_y, buf_z,
-				   buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s %s)",
+				buf_x, buf_y, buf_z, buf_m);
 	  else
-	      buf =
-		  sqlite3_mprintf (", %s %s %s %s", buf_x, buf_y, buf_z, buf_m);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_z);
-	  sqlite3_free (buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ", %s %s %s %s",
+				buf_x, buf_y, buf_z, buf_m);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -1135,43 +1101,38 @@ gaiaOutPolygonZM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg, int precision)
 	    {
 		gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
 		if (precision < 0)
-		    buf_x = sqlite3_mprintf ("%1.6f", x);
+		    gaiaOutFormatDouble (buf_x, 6, x);
 		else
-		    buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		    gaiaOutFormatDouble (buf_x, precision, x);
 		gaiaOutClean (buf_x);
 		if (precision < 0)
-		    buf_y = sqlite3_mprintf ("%1.6f", y);
+		    gaiaOutFormatDouble (buf_y, 6, y);
 		else
-		    buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		    gaiaOutFormatDouble (buf_y, precision, y);
 		gaiaOutClean (buf_y);
 		if (precision < 0)
-		    buf_z = sqlite3_mprintf ("%1.6f", z);
+		    gaiaOutFormatDouble (buf_z, 6, z);
 		else
-		    buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		    gaiaOutFormatDouble (buf_z, precision, z);
 		gaiaOutClean (buf_z);
 		if (precision < 0)
-		    buf_m = sqlite3_mprintf ("%1.6f", m);
+		    gaiaOutFormatDouble (buf_m, 6, m);
 		else
-		    buf_m = sqlite3_mprintf ("%.*f", precision, m);
+		    gaiaOutFormatDouble (buf_m, precision, m);
 		gaiaOutClean (buf_m);
 		if (iv == 0)
-		    buf =
-			sqlite3_mprintf (", (%s %s %s %s", buf_x, buf_y, buf_z,
-					 buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+				      ", (%s %s %s %s", buf_x, buf_y, buf_z,
+				      buf_m);
 		else if (iv == (ring->Points - 1))
-		    buf =
-			sqlite3_mprintf (", %s %s %s %s)", buf_x, buf_y, buf_z,
-					 buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+				      ", %s %s %s %s)", buf_x, buf_y, buf_z,
+				      buf_m);
 		else
-		    buf =
-			sqlite3_mprintf (", %s %s %s %s", buf_x, buf_y, buf_z,
-					 buf_m);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_z);
-		sqlite3_free (buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+				      ", %s %s %s %s", buf_x, buf_y, buf_z,
+				      buf_m);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -1180,9 +1141,9 @@ static void
 gaiaOutEwktPolygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
 {
 /* formats an EWKT POLYGON */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -1191,20 +1152,20 @@ gaiaOutEwktPolygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
     for (iv = 0; iv < ring->Points; iv++)
       {
 	  gaiaGetPoint (ring->Coords, iv, &x, &y);
-	  buf_x = sqlite3_mprintf ("%1.15f", x);
+	  gaiaOutFormatDouble (buf_x, 15, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%1.15f", y);
+	  gaiaOutFormatDouble (buf_y, 15, y);
 	  gaiaOutClean (buf_y);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("(%s %s", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s", buf_x,
+				buf_y);
 	  else if (iv == (ring->Points - 1))
-	      buf = sqlite3_mprintf (",%s %s)", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s)", buf_x,
+				buf_y);
 	  else
-	      buf = sqlite3_mprintf (",%s %s", buf_x, buf_y);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s", buf_x,
+				buf_y);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -1212,20 +1173,20 @@ gaiaOutEwktPolygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
 	  for (iv = 0; iv < ring->Points; iv++)
 	    {
 		gaiaGetPoint (ring->Coords, iv, &x, &y);
-		buf_x = sqlite3_mprintf ("%1.15f", x);
+		gaiaOutFormatDouble (buf_x, 15, x);
 		gaiaOutClean (buf_x);
-		buf_y = sqlite3_mprintf ("%1.15f", y);
+		gaiaOutFormatDouble (buf_y, 15, y);
 		gaiaOutClean (buf_y);
 		if (iv == 0)
-		    buf = sqlite3_mprintf (",(%s %s", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",(%s %s",
+				      buf_x, buf_y);
 		else if (iv == (ring->Points - 1))
-		    buf = sqlite3_mprintf (",%s %s)", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s)",
+				      buf_x, buf_y);
 		else
-		    buf = sqlite3_mprintf (",%s %s", buf_x, buf_y);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s",
+				      buf_x, buf_y);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -1234,10 +1195,10 @@ GAIAGEO_DECLARE void
 gaiaOutEwktPolygonZ (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
 {
 /* formats an EWKT POLYGONZ */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -1247,23 +1208,22 @@ gaiaOutEwktPolygonZ (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
     for (iv = 0; iv < ring->Points; iv++)
       {
 	  gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-	  buf_x = sqlite3_mprintf ("%1.15f", x);
+	  gaiaOutFormatDouble (buf_x, 15, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%1.15f", y);
+	  gaiaOutFormatDouble (buf_y, 15, y);
 	  gaiaOutClean (buf_y);
-	  buf_z = sqlite3_mprintf ("%1.15f", z);
+	  gaiaOutFormatDouble (buf_z, 15, z);
 	  gaiaOutClean (buf_z);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("(%s %s %s", buf_x, buf_y, buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s %s", buf_x,
+				buf_y, buf_z);
 	  else if (iv == (ring->Points - 1))
-	      buf = sqlite3_mprintf (",%s %s %s)", buf_x, buf_y, buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s)", buf_x,
+				buf_y, buf_z);
 	  else
-	      buf = sqlite3_mprintf (",%s %s %s", buf_x, buf_y, buf_z);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_z);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s", buf_x,
+				buf_y, buf_z);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -1271,23 +1231,22 @@ gaiaOutEwktPolygonZ (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
 	  for (iv = 0; iv < ring->Points; iv++)
 	    {
 		gaiaGetPointXYZ (ring->Coords, iv, &x, &y, &z);
-		buf_x = sqlite3_mprintf ("%1.15f", x);
+		gaiaOutFormatDouble (buf_x, 15, x);
 		gaiaOutClean (buf_x);
-		buf_y = sqlite3_mprintf ("%1.15f", y);
+		gaiaOutFormatDouble (buf_y, 15, y);
 		gaiaOutClean (buf_y);
-		buf_z = sqlite3_mprintf ("%1.15f", z);
+		gaiaOutFormatDouble (buf_z, 15, z);
 		gaiaOutClean (buf_z);
 		if (iv == 0)
-		    buf = sqlite3_mprintf (",(%s %s %s", buf_x, buf_y, buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",(%s %s %s",
+				      buf_x, buf_y, buf_z);
 		else if (iv == (ring->Points - 1))
-		    buf = sqlite3_mprintf (",%s %s %s)", buf_x, buf_y, buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s)",
+				      buf_x, buf_y, buf_z);
 		else
-		    buf = sqlite3_mprintf (",%s %s %s", buf_x, buf_y, buf_z);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s",
+				      buf_x, buf_y, buf_z);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -1296,10 +1255,10 @@ static void
 gaiaOutEwktPolygonM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
 {
 /* formats an EWKT POLYGONM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -1309,23 +1268,22 @@ gaiaOutEwktPolygonM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
     for (iv = 0; iv < ring->Points; iv++)
       {
 	  gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-	  buf_x = sqlite3_mprintf ("%1.15f", x);
+	  gaiaOutFormatDouble (buf_x, 15, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%1.15f", y);
+	  gaiaOutFormatDouble (buf_y, 15, y);
 	  gaiaOutClean (buf_y);
-	  buf_m = sqlite3_mprintf ("%1.15f", m);
+	  gaiaOutFormatDouble (buf_m, 15, m);
 	  gaiaOutClean (buf_m);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("(%s %s %s", buf_x, buf_y, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s %s", buf_x,
+				buf_y, buf_m);
 	  else if (iv == (ring->Points - 1))
-	      buf = sqlite3_mprintf (",%s %s %s)", buf_x, buf_y, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s)", buf_x,
+				buf_y, buf_m);
 	  else
-	      buf = sqlite3_mprintf (",%s %s %s", buf_x, buf_y, buf_m);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s", buf_x,
+				buf_y, buf_m);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -1333,23 +1291,22 @@ gaiaOutEwktPolygonM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
 	  for (iv = 0; iv < ring->Points; iv++)
 	    {
 		gaiaGetPointXYM (ring->Coords, iv, &x, &y, &m);
-		buf_x = sqlite3_mprintf ("%1.15f", x);
+		gaiaOutFormatDouble (buf_x, 15, x);
 		gaiaOutClean (buf_x);
-		buf_y = sqlite3_mprintf ("%1.15f", y);
+		gaiaOutFormatDouble (buf_y, 15, y);
 		gaiaOutClean (buf_y);
-		buf_m = sqlite3_mprintf ("%1.15f", m);
+		gaiaOutFormatDouble (buf_m, 15, m);
 		gaiaOutClean (buf_m);
 		if (iv == 0)
-		    buf = sqlite3_mprintf (",(%s %s %s", buf_x, buf_y, buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",(%s %s %s",
+				      buf_x, buf_y, buf_m);
 		else if (iv == (ring->Points - 1))
-		    buf = sqlite3_mprintf (",%s %s %s)", buf_x, buf_y, buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s)",
+				      buf_x, buf_y, buf_m);
 		else
-		    buf = sqlite3_mprintf (",%s %s %s", buf_x, buf_y, buf_m);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s",
+				      buf_x, buf_y, buf_m);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -1358,11 +1315,11 @@ static void
 gaiaOutEwktPolygonZM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
 {
 /* formats an EWKT POLYGONZM */
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
-    char *buf_m;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int ib;
     int iv;
     double x;
@@ -1373,29 +1330,24 @@ gaiaOutEwktPolygonZM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
     for (iv = 0; iv < ring->Points; iv++)
       {
 	  gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-	  buf_x = sqlite3_mprintf ("%1.15f", x);
+	  gaiaOutFormatDouble (buf_x, 15, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%1.15f", y);
+	  gaiaOutFormatDouble (buf_y, 15, y);
 	  gaiaOutClean (buf_y);
-	  buf_z = sqlite3_mprintf ("%1.15f", z);
+	  gaiaOutFormatDouble (buf_z, 15, z);
 	  gaiaOutClean (buf_z);
-	  buf_m = sqlite3_mprintf ("%1.15f", m);
+	  gaiaOutFormatDouble (buf_m, 15, m);
 	  gaiaOutClean (buf_m);
 	  if (iv == 0)
-	      buf =
-		  sqlite3_mprintf ("(%s %s %s %s", buf_x, buf_y, buf_z, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "(%s %s %s %s",
+				buf_x, buf_y, buf_z, buf_m);
 	  else if (iv == (ring->Points - 1))
-	      buf =
-		  sqlite3_mprintf (",%s %s %s %s)", buf_x, buf_y, buf_z, buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s %s)",
+				buf_x, buf_y, buf_z, buf_m);
 	  else
-	      buf =
-		  sqlite3_mprintf (",%s %s %s %s", buf_x, buf_y, buf_z, buf_m);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
-	  sqlite3_free (buf_z);
-	  sqlite3_free (buf_m);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, ",%s %s %s %s",
+				buf_x, buf_y, buf_z, buf_m);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     for (ib = 0; ib < polyg->NumInteriors; ib++)
       {
@@ -1403,32 +1355,27 @@ gaiaOutEwktPolygonZM (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polyg)
 	  for (iv = 0; iv < ring->Points; iv++)
 	    {
 		gaiaGetPointXYZM (ring->Coords, iv, &x, &y, &z, &m);
-		buf_x = sqlite3_mprintf ("%1.15f", x);
+		gaiaOutFormatDouble (buf_x, 15, x);
 		gaiaOutClean (buf_x);
-		buf_y = sqlite3_mprintf ("%1.15f", y);
+		gaiaOutFormatDouble (buf_y, 15, y);
 		gaiaOutClean (buf_y);
-		buf_z = sqlite3_mprintf ("%1.15f", z);
+		gaiaOutFormatDouble (buf_z, 15, z);
 		gaiaOutClean (buf_z);
-		buf_m = sqlite3_mprintf ("%1.15f", m);
+		gaiaOutFormatDouble (buf_m, 15, m);
 		gaiaOutClean (buf_m);
 		if (iv == 0)
-		    buf =
-			sqlite3_mprintf (",(%s %s %s %s", buf_x, buf_y, buf_z,
-					 buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+				      ",(%s %s %s %s", buf_x, buf_y, buf_z,
+				      buf_m);
 		else if (iv == (ring->Points - 1))
-		    buf =
-			sqlite3_mprintf (",%s %s %s %s)", buf_x, buf_y, buf_z,
-					 buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+				      ",%s %s %s %s)", buf_x, buf_y, buf_z,
+				      buf_m);
 		else
-		    buf =
-			sqlite3_mprintf (",%s %s %s %s", buf_x, buf_y, buf_z,
-					 buf_m);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_z);
-		sqlite3_free (buf_m);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+				      ",%s %s %s %s", buf_x, buf_y, buf_z,
+				      buf_m);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
       }
 }
@@ -2355,36 +2302,32 @@ static void
 SvgCoords (gaiaOutBufferPtr out_buf, gaiaPointPtr point, int precision)
 {
 /* formats POINT as SVG-attributes x,y */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
-    buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
+    gaiaOutFormatDouble (buf_x, precision, point->X);
     gaiaOutClean (buf_x);
-    buf_y = sqlite3_mprintf ("%.*f", precision, point->Y * -1);
+    gaiaOutFormatDouble (buf_y, precision, point->Y * -1);
     gaiaOutClean (buf_y);
-    buf = sqlite3_mprintf ("x=\"%s\" y=\"%s\"", buf_x, buf_y);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "x=\"%s\" y=\"%s\"", buf_x,
+		      buf_y);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 static void
 SvgCircle (gaiaOutBufferPtr out_buf, gaiaPointPtr point, int precision)
 {
 /* formats POINT as SVG-attributes cx,cy */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
-    buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
+    gaiaOutFormatDouble (buf_x, precision, point->X);
     gaiaOutClean (buf_x);
-    buf_y = sqlite3_mprintf ("%.*f", precision, point->Y * -1);
+    gaiaOutFormatDouble (buf_y, precision, point->Y * -1);
     gaiaOutClean (buf_y);
-    buf = sqlite3_mprintf ("cx=\"%s\" cy=\"%s\"", buf_x, buf_y);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
+    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "cx=\"%s\" cy=\"%s\"", buf_x,
+		      buf_y);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
 }
 
 static void
@@ -2392,9 +2335,9 @@ SvgPathRelative (gaiaOutBufferPtr out_buf, int dims, int points, double *coords,
 		 int precision, int closePath)
 {
 /* formats LINESTRING as SVG-path d-attribute with relative coordinate moves */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double z;
@@ -2420,23 +2363,22 @@ SvgPathRelative (gaiaOutBufferPtr out_buf, int dims, int points, double *coords,
 	    {
 		gaiaGetPoint (coords, iv, &x, &y);
 	    }
-	  buf_x = sqlite3_mprintf ("%.*f", precision, x - lastX);
+	  gaiaOutFormatDouble (buf_x, precision, x - lastX);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, (y - lastY) * -1);
+	  gaiaOutFormatDouble (buf_y, precision, (y - lastY) * -1);
 	  gaiaOutClean (buf_y);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("M %s %s l ", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "M %s %s l ", buf_x,
+				buf_y);
 	  else
-	      buf = sqlite3_mprintf ("%s %s ", buf_x, buf_y);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s ", buf_x,
+				buf_y);
 	  lastX = x;
 	  lastY = y;
 	  if (iv == points - 1 && closePath == 1)
 	      gaiaAppendToOutBuffer (out_buf, "z ");
 	  else
 	      gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -2445,9 +2387,9 @@ SvgPathAbsolute (gaiaOutBufferPtr out_buf, int dims, int points, double *coords,
 		 int precision, int closePath)
 {
 /* formats LINESTRING as SVG-path d-attribute with relative coordinate moves */
-    char *buf_x;
-    char *buf_y;
-    char *buf;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     double x;
     double y;
     double z;
@@ -2471,21 +2413,20 @@ SvgPathAbsolute (gaiaOutBufferPtr out_buf, int dims, int points, double *coords,
 	    {
 		gaiaGetPoint (coords, iv, &x, &y);
 	    }
-	  buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	  gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, y * -1);
+	  gaiaOutFormatDouble (buf_y, precision, y * -1);
 	  gaiaOutClean (buf_y);
 	  if (iv == 0)
-	      buf = sqlite3_mprintf ("M %s %s L ", buf_x, buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "M %s %s L ", buf_x,
+				buf_y);
 	  else
-	      buf = sqlite3_mprintf ("%s %s ", buf_x, buf_y);
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
+	      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s %s ", buf_x,
+				buf_y);
 	  if (iv == points - 1 && closePath == 1)
 	      gaiaAppendToOutBuffer (out_buf, "z ");
 	  else
 	      gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
 }
 
@@ -2816,33 +2757,30 @@ static void
 out_kml_point (gaiaOutBufferPtr out_buf, gaiaPointPtr point, int precision)
 {
 /* formats POINT as KML [x,y] */
-    char *buf_x = NULL;
-    char *buf_y = NULL;
-    char *buf_z = NULL;
-    char *buf = NULL;
-    buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
+    gaiaOutFormatDouble (buf_x, precision, point->X);
     gaiaOutClean (buf_x);
-    buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
+    gaiaOutFormatDouble (buf_y, precision, point->Y);
     gaiaOutClean (buf_y);
     if (point->DimensionModel == GAIA_XY_Z
 	|| point->DimensionModel == GAIA_XY_Z_M)
       {
-	  buf_z = sqlite3_mprintf ("%.*f", precision, point->Z);
+	  gaiaOutFormatDouble (buf_z, precision, point->Z);
 	  gaiaOutClean (buf_z);
       }
     gaiaAppendToOutBuffer (out_buf, "<Point><coordinates>");
     if (point->DimensionModel == GAIA_XY_Z
 	|| point->DimensionModel == GAIA_XY_Z_M)
       {
-	  buf = sqlite3_mprintf ("%s,%s,%s", buf_x, buf_y, buf_z);
-	  sqlite3_free (buf_z);
+	  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s,%s,%s", buf_x,
+			    buf_y, buf_z);
       }
     else
-	buf = sqlite3_mprintf ("%s,%s", buf_x, buf_y);
-    sqlite3_free (buf_x);
-    sqlite3_free (buf_y);
+	sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s,%s", buf_x, buf_y);
     gaiaAppendToOutBuffer (out_buf, buf);
-    sqlite3_free (buf);
     gaiaAppendToOutBuffer (out_buf, "</coordinates></Point>");
 }
 
@@ -2851,10 +2789,10 @@ out_kml_linestring (gaiaOutBuffer * out_buf, int dims, int points,
 		    double *coords, int precision)
 {
 /* formats LINESTRING as KML [x,y] */
-    char *buf_x = NULL;
-    char *buf_y = NULL;
-    char *buf_z = NULL;
-    char *buf = NULL;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     int iv;
     double x = 0.0;
     double y = 0.0;
@@ -2880,31 +2818,31 @@ out_kml_linestring (gaiaOutBuffer * out_buf, int dims, int points,
 	    {
 		gaiaGetPoint (coords, iv, &x, &y);
 	    }
-	  buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	  gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	  gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (dims == GAIA_XY_Z || dims == GAIA_XY_Z_M)
 	    {
-		buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		gaiaOutFormatDouble (buf_z, precision, z);
 		gaiaOutClean (buf_z);
 		if (iv == 0)
-		    buf = sqlite3_mprintf ("%s,%s,%s", buf_x, buf_y, buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s,%s,%s",
+				      buf_x, buf_y, buf_z);
 		else
-		    buf = sqlite3_mprintf (" %s,%s,%s", buf_x, buf_y, buf_z);
-		sqlite3_free (buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, " %s,%s,%s",
+				      buf_x, buf_y, buf_z);
 	    }
 	  else
 	    {
 		if (iv == 0)
-		    buf = sqlite3_mprintf ("%s,%s", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s,%s",
+				      buf_x, buf_y);
 		else
-		    buf = sqlite3_mprintf (" %s,%s", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, " %s,%s",
+				      buf_x, buf_y);
 	    }
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     gaiaAppendToOutBuffer (out_buf, "</coordinates></LineString>");
 }
@@ -2914,10 +2852,10 @@ out_kml_polygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polygon,
 		 int precision)
 {
 /* formats POLYGON as KML [x,y] */
-    char *buf_x = NULL;
-    char *buf_y = NULL;
-    char *buf_z = NULL;
-    char *buf = NULL;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char buf[GAIA_OUT_VERTEX_SIZE];
     gaiaRingPtr ring;
     int iv;
     int ib;
@@ -2948,32 +2886,32 @@ out_kml_polygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polygon,
 	    {
 		gaiaGetPoint (ring->Coords, iv, &x, &y);
 	    }
-	  buf_x = sqlite3_mprintf ("%.*f", precision, x);
+	  gaiaOutFormatDouble (buf_x, precision, x);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, y);
+	  gaiaOutFormatDouble (buf_y, precision, y);
 	  gaiaOutClean (buf_y);
 	  if (ring->DimensionModel == GAIA_XY_Z
 	      || ring->DimensionModel == GAIA_XY_Z_M)
 	    {
-		buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		gaiaOutFormatDouble (buf_z, precision, z);
 		gaiaOutClean (buf_z);
 		if (iv == 0)
-		    buf = sqlite3_mprintf ("%s,%s,%s", buf_x, buf_y, buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s,%s,%s",
+				      buf_x, buf_y, buf_z);
 		else
-		    buf = sqlite3_mprintf (" %s,%s,%s", buf_x, buf_y, buf_z);
-		sqlite3_free (buf_z);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, " %s,%s,%s",
+				      buf_x, buf_y, buf_z);
 	    }
 	  else
 	    {
 		if (iv == 0)
-		    buf = sqlite3_mprintf ("%s,%s", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s,%s",
+				      buf_x, buf_y);
 		else
-		    buf = sqlite3_mprintf (" %s,%s", buf_x, buf_y);
+		    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, " %s,%s",
+				      buf_x, buf_y);
 	    }
-	  sqlite3_free (buf_x);
-	  sqlite3_free (buf_y);
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
       }
     gaiaAppendToOutBuffer (out_buf,
 			   "</coordinates></LinearRing></outerBoundaryIs>");
@@ -3002,35 +2940,32 @@ out_kml_polygon (gaiaOutBufferPtr out_buf, gaiaPolygonPtr polygon,
 		  {
 		      gaiaGetPoint (ring->Coords, iv, &x, &y);
 		  }
-		buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		gaiaOutFormatDouble (buf_x, precision, x);
 		gaiaOutClean (buf_x);
-		buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		gaiaOutFormatDouble (buf_y, precision, y);
 		gaiaOutClean (buf_y);
 		if (ring->DimensionModel == GAIA_XY_Z
 		    || ring->DimensionModel == GAIA_XY_Z_M)
 		  {
-		      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		      gaiaOutFormatDouble (buf_z, precision, z);
 		      gaiaOutClean (buf_z);
 		      if (iv == 0)
-			  buf =
-			      sqlite3_mprintf ("%s,%s,%s", buf_x, buf_y, buf_z);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+					    "%s,%s,%s", buf_x, buf_y, buf_z);
 		      else
-			  buf =
-			      sqlite3_mprintf (" %s,%s,%s", buf_x, buf_y,
-					       buf_z);
-		      sqlite3_free (buf_z);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+					    " %s,%s,%s", buf_x, buf_y, buf_z);
 		  }
 		else
 		  {
 		      if (iv == 0)
-			  buf = sqlite3_mprintf ("%s,%s", buf_x, buf_y);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf, "%s,%s",
+					    buf_x, buf_y);
 		      else
-			  buf = sqlite3_mprintf (" %s,%s", buf_x, buf_y);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, buf,
+					    " %s,%s", buf_x, buf_y);
 		  }
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
 		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
 	    }
 	  gaiaAppendToOutBuffer (out_buf,
 				 "</coordinates></LinearRing></innerBoundaryIs>");
@@ -3237,10 +3172,10 @@ gaiaOutGml (gaiaOutBufferPtr out_buf, int version, int precision,
     int is_multi = 1;
     int is_coll = 0;
     char buf[2048];
-    char *xbuf;
-    char *buf_x;
-    char *buf_y;
-    char *buf_z;
+    char xbuf[GAIA_OUT_VERTEX_SIZE];
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
     if (!geom)
 	return;
     if (precision > 18)
@@ -3338,47 +3273,40 @@ gaiaOutGml (gaiaOutBufferPtr out_buf, int version, int precision,
 	  else
 	      strcat (buf, "<gml:coordinates>");
 	  gaiaAppendToOutBuffer (out_buf, buf);
-	  buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+	  gaiaOutFormatDouble (buf_x, precision, point->X);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
+	  gaiaOutFormatDouble (buf_y, precision, point->Y);
 	  gaiaOutClean (buf_y);
 	  if (point->DimensionModel == GAIA_XY_Z
 	      || point->DimensionModel == GAIA_XY_Z_M)
 	    {
-		buf_z = sqlite3_mprintf ("%.*f", precision, point->Z);
+		gaiaOutFormatDouble (buf_z, precision, point->Z);
 		gaiaOutClean (buf_z);
 		if (version == 3)
 		  {
-		      xbuf = sqlite3_mprintf ("%s %s %s", buf_x, buf_y, buf_z);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
-		      sqlite3_free (buf_z);
+		      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf, "%s %s %s",
+					buf_x, buf_y, buf_z);
 		  }
 		else
 		  {
-		      xbuf = sqlite3_mprintf ("%s,%s,%s", buf_x, buf_y, buf_z);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
-		      sqlite3_free (buf_z);
+		      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf, "%s,%s,%s",
+					buf_x, buf_y, buf_z);
 		  }
 	    }
 	  else
 	    {
 		if (version == 3)
 		  {
-		      xbuf = sqlite3_mprintf ("%s %s", buf_x, buf_y);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
+		      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf, "%s %s",
+					buf_x, buf_y);
 		  }
 		else
 		  {
-		      xbuf = sqlite3_mprintf ("%s,%s", buf_x, buf_y);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
+		      sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf, "%s,%s",
+					buf_x, buf_y);
 		  }
 	    }
 	  gaiaAppendToOutBuffer (out_buf, xbuf);
-	  sqlite3_free (xbuf);
 	  if (version == 3)
 	      strcpy (buf, "</gml:pos>");
 	  else
@@ -3484,54 +3412,43 @@ gaiaOutGml (gaiaOutBufferPtr out_buf, int version, int precision,
 		    strcpy (buf, " ");
 		if (has_z)
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		      gaiaOutFormatDouble (buf_x, precision, x);
 		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		      gaiaOutFormatDouble (buf_y, precision, y);
 		      gaiaOutClean (buf_y);
-		      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		      gaiaOutFormatDouble (buf_z, precision, z);
 		      gaiaOutClean (buf_z);
 		      if (version == 3)
 			{
-			    xbuf =
-				sqlite3_mprintf ("%s%s %s %s", buf, buf_x,
-						 buf_y, buf_z);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
-			    sqlite3_free (buf_z);
+			    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+					      "%s%s %s %s", buf, buf_x, buf_y,
+					      buf_z);
 			}
 		      else
 			{
-			    xbuf =
-				sqlite3_mprintf ("%s%s,%s,%s", buf, buf_x,
-						 buf_y, buf_z);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
-			    sqlite3_free (buf_z);
+			    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+					      "%s%s,%s,%s", buf, buf_x, buf_y,
+					      buf_z);
 			}
 		  }
 		else
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		      gaiaOutFormatDouble (buf_x, precision, x);
 		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		      gaiaOutFormatDouble (buf_y, precision, y);
 		      gaiaOutClean (buf_y);
 		      if (version == 3)
 			{
-			    xbuf =
-				sqlite3_mprintf ("%s%s %s", buf, buf_x, buf_y);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
+			    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+					      "%s%s %s", buf, buf_x, buf_y);
 			}
 		      else
 			{
-			    xbuf =
-				sqlite3_mprintf ("%s%s,%s", buf, buf_x, buf_y);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
+			    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+					      "%s%s,%s", buf, buf_x, buf_y);
 			}
 		  }
 		gaiaAppendToOutBuffer (out_buf, xbuf);
-		sqlite3_free (xbuf);
 	    }
 	  if (is_multi)
 	    {
@@ -3662,54 +3579,43 @@ gaiaOutGml (gaiaOutBufferPtr out_buf, int version, int precision,
 		    strcpy (buf, " ");
 		if (has_z)
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		      gaiaOutFormatDouble (buf_x, precision, x);
 		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		      gaiaOutFormatDouble (buf_y, precision, y);
 		      gaiaOutClean (buf_y);
-		      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		      gaiaOutFormatDouble (buf_z, precision, z);
 		      gaiaOutClean (buf_z);
 		      if (version == 3)
 			{
-			    xbuf =
-				sqlite3_mprintf ("%s%s %s %s", buf, buf_x,
-						 buf_y, buf_z);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
-			    sqlite3_free (buf_z);
+			    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+					      "%s%s %s %s", buf, buf_x, buf_y,
+					      buf_z);
 			}
 		      else
 			{
-			    xbuf =
-				sqlite3_mprintf ("%s%s,%s,%s", buf, buf_x,
-						 buf_y, buf_z);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
-			    sqlite3_free (buf_z);
+			    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+					      "%s%s,%s,%s", buf, buf_x, buf_y,
+					      buf_z);
 			}
 		  }
 		else
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		      gaiaOutFormatDouble (buf_x, precision, x);
 		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		      gaiaOutFormatDouble (buf_y, precision, y);
 		      gaiaOutClean (buf_y);
 		      if (version == 3)
 			{
-			    xbuf =
-				sqlite3_mprintf ("%s%s %s", buf, buf_x, buf_y);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
+			    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+					      "%s%s %s", buf, buf_x, buf_y);
 			}
 		      else
 			{
-			    xbuf =
-				sqlite3_mprintf ("%s%s,%s", buf, buf_x, buf_y);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
+			    sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+					      "%s%s,%s", buf, buf_x, buf_y);
 			}
 		  }
 		gaiaAppendToOutBuffer (out_buf, xbuf);
-		sqlite3_free (xbuf);
 	    }
 	  /* closing the Exterior Ring */
 	  if (version == 3)
@@ -3775,56 +3681,45 @@ gaiaOutGml (gaiaOutBufferPtr out_buf, int version, int precision,
 			  strcpy (buf, " ");
 		      if (has_z)
 			{
-			    buf_x = sqlite3_mprintf ("%.*f", precision, x);
+			    gaiaOutFormatDouble (buf_x, precision, x);
 			    gaiaOutClean (buf_x);
-			    buf_y = sqlite3_mprintf ("%.*f", precision, y);
+			    gaiaOutFormatDouble (buf_y, precision, y);
 			    gaiaOutClean (buf_y);
-			    buf_z = sqlite3_mprintf ("%.*f", precision, z);
+			    gaiaOutFormatDouble (buf_z, precision, z);
 			    gaiaOutClean (buf_z);
 			    if (version == 3)
 			      {
-				  xbuf =
-				      sqlite3_mprintf ("%s%s %s %s", buf, buf_x,
-						       buf_y, buf_z);
-				  sqlite3_free (buf_x);
-				  sqlite3_free (buf_y);
-				  sqlite3_free (buf_z);
+				  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+						    "%s%s %s %s", buf, buf_x,
+						    buf_y, buf_z);
 			      }
 			    else
 			      {
-				  xbuf =
-				      sqlite3_mprintf ("%s%s,%s,%s", buf, buf_x,
-						       buf_y, buf_z);
-				  sqlite3_free (buf_x);
-				  sqlite3_free (buf_y);
-				  sqlite3_free (buf_z);
+				  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+						    "%s%s,%s,%s", buf, buf_x,
+						    buf_y, buf_z);
 			      }
 			}
 		      else
 			{
-			    buf_x = sqlite3_mprintf ("%.*f", precision, x);
+			    gaiaOutFormatDouble (buf_x, precision, x);
 			    gaiaOutClean (buf_x);
-			    buf_y = sqlite3_mprintf ("%.*f", precision, y);
+			    gaiaOutFormatDouble (buf_y, precision, y);
 			    gaiaOutClean (buf_y);
 			    if (version == 3)
 			      {
-				  xbuf =
-				      sqlite3_mprintf ("%s%s %s", buf, buf_x,
-						       buf_y);
-				  sqlite3_free (buf_x);
-				  sqlite3_free (buf_y);
+				  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+						    "%s%s %s", buf, buf_x,
+						    buf_y);
 			      }
 			    else
 			      {
-				  xbuf =
-				      sqlite3_mprintf ("%s%s,%s", buf, buf_x,
-						       buf_y);
-				  sqlite3_free (buf_x);
-				  sqlite3_free (buf_y);
+				  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, xbuf,
+						    "%s%s,%s", buf, buf_x,
+						    buf_y);
 			      }
 			}
 		      gaiaAppendToOutBuffer (out_buf, xbuf);
-		      sqlite3_free (xbuf);
 		  }
 		/* closing the Interior Ring */
 		if (version == 3)
@@ -3919,10 +3814,11 @@ gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
     char *bbox;
     char crs[2048];
     char *buf;
-    char *buf_x;
-    char *buf_y;
-    char *buf_m;
-    char *buf_z = NULL;
+    char buf_x[GAIA_OUT_NUMBER_SIZE];
+    char buf_y[GAIA_OUT_NUMBER_SIZE];
+    char buf_m[GAIA_OUT_NUMBER_SIZE];
+    char buf_z[GAIA_OUT_NUMBER_SIZE];
+    char vertex[GAIA_OUT_VERTEX_SIZE];
     char endJson[16];
     if (!geom)
 	return;
@@ -3954,21 +3850,17 @@ gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
 	    {
 		/* including BBOX */
 		gaiaMbrGeometry (geom);
-		buf_x = sqlite3_mprintf ("%.*f", precision, geom->MinX);
+		gaiaOutFormatDouble (buf_x, precision, geom->MinX);
 		gaiaOutClean (buf_x);
-		buf_y = sqlite3_mprintf ("%.*f", precision, geom->MinY);
+		gaiaOutFormatDouble (buf_y, precision, geom->MinY);
 		gaiaOutClean (buf_y);
-		buf_z = sqlite3_mprintf ("%.*f", precision, geom->MaxX);
+		gaiaOutFormatDouble (buf_z, precision, geom->MaxX);
 		gaiaOutClean (buf_z);
-		buf_m = sqlite3_mprintf ("%.*f", precision, geom->MaxY);
+		gaiaOutFormatDouble (buf_m, precision, geom->MaxY);
 		gaiaOutClean (buf_m);
 		bbox =
 		    sqlite3_mprintf (",\"bbox\":[%s,%s,%s,%s]", buf_x, buf_y,
 				     buf_z, buf_m);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_z);
-		sqlite3_free (buf_m);
 	    }
 	  switch (geom->DeclaredType)
 	    {
@@ -4090,33 +3982,29 @@ gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
 		/* adding a further Point */
 		gaiaAppendToOutBuffer (out_buf, ",");
 	    }
-	  buf_x = sqlite3_mprintf ("%.*f", precision, point->X);
+	  gaiaOutFormatDouble (buf_x, precision, point->X);
 	  gaiaOutClean (buf_x);
-	  buf_y = sqlite3_mprintf ("%.*f", precision, point->Y);
+	  gaiaOutFormatDouble (buf_y, precision, point->Y);
 	  gaiaOutClean (buf_y);
 	  has_z = 0;
 	  if (point->DimensionModel == GAIA_XY_Z
 	      || point->DimensionModel == GAIA_XY_Z_M)
 	    {
-		buf_z = sqlite3_mprintf ("%.*f", precision, point->Z);
+		gaiaOutFormatDouble (buf_z, precision, point->Z);
 		gaiaOutClean (buf_z);
 		has_z = 1;
 	    }
 	  if (has_z)
 	    {
-		buf = sqlite3_mprintf ("[%s,%s,%s]", buf_x, buf_y, buf_z);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
-		sqlite3_free (buf_z);
+		sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex, "[%s,%s,%s]",
+				  buf_x, buf_y, buf_z);
 	    }
 	  else
 	    {
-		buf = sqlite3_mprintf ("[%s,%s]", buf_x, buf_y);
-		sqlite3_free (buf_x);
-		sqlite3_free (buf_y);
+		sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex, "[%s,%s]",
+				  buf_x, buf_y);
 	    }
-	  gaiaAppendToOutBuffer (out_buf, buf);
-	  sqlite3_free (buf);
+	  gaiaAppendToOutBuffer (out_buf, vertex);
 	  if (is_multi)
 	    {
 		gaiaAppendToOutBuffer (out_buf, "}");
@@ -4166,39 +4054,34 @@ gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
 		  }
 		if (has_z)
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		      gaiaOutFormatDouble (buf_x, precision, x);
 		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		      gaiaOutFormatDouble (buf_y, precision, y);
 		      gaiaOutClean (buf_y);
-		      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		      gaiaOutFormatDouble (buf_z, precision, z);
 		      gaiaOutClean (buf_z);
 		      if (iv == 0)
-			  buf =
-			      sqlite3_mprintf ("[%s,%s,%s]", buf_x, buf_y,
-					       buf_z);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+					    "[%s,%s,%s]", buf_x, buf_y, buf_z);
 		      else
-			  buf =
-			      sqlite3_mprintf (",[%s,%s,%s]", buf_x, buf_y,
-					       buf_z);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
-		      sqlite3_free (buf_z);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+					    ",[%s,%s,%s]", buf_x, buf_y,
+					    buf_z);
 		  }
 		else
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		      gaiaOutFormatDouble (buf_x, precision, x);
 		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		      gaiaOutFormatDouble (buf_y, precision, y);
 		      gaiaOutClean (buf_y);
 		      if (iv == 0)
-			  buf = sqlite3_mprintf ("[%s,%s]", buf_x, buf_y);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+					    "[%s,%s]", buf_x, buf_y);
 		      else
-			  buf = sqlite3_mprintf (",[%s,%s]", buf_x, buf_y);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+					    ",[%s,%s]", buf_x, buf_y);
 		  }
-		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
+		gaiaAppendToOutBuffer (out_buf, vertex);
 	    }
 	  /* closing the LineString */
 	  gaiaAppendToOutBuffer (out_buf, "]");
@@ -4252,39 +4135,35 @@ gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
 		  }
 		if (has_z)
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		      gaiaOutFormatDouble (buf_x, precision, x);
 		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		      gaiaOutFormatDouble (buf_y, precision, y);
 		      gaiaOutClean (buf_y);
-		      buf_z = sqlite3_mprintf ("%.*f", precision, z);
+		      gaiaOutFormatDouble (buf_z, precision, z);
 		      gaiaOutClean (buf_z);
 		      if (iv == 0)
-			  buf =
-			      sqlite3_mprintf ("[[%s,%s,%s]", buf_x, buf_y,
-					       buf_z);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+					    "[[%s,%s,%s]", buf_x, buf_y,
+					    buf_z);
 		      else
-			  buf =
-			      sqlite3_mprintf (",[%s,%s,%s]", buf_x, buf_y,
-					       buf_z);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
-		      sqlite3_free (buf_z);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+					    ",[%s,%s,%s]", buf_x, buf_y,
+					    buf_z);
 		  }
 		else
 		  {
-		      buf_x = sqlite3_mprintf ("%.*f", precision, x);
+		      gaiaOutFormatDouble (buf_x, precision, x);
 		      gaiaOutClean (buf_x);
-		      buf_y = sqlite3_mprintf ("%.*f", precision, y);
+		      gaiaOutFormatDouble (buf_y, precision, y);
 		      gaiaOutClean (buf_y);
 		      if (iv == 0)
-			  buf = sqlite3_mprintf ("[[%s,%s]", buf_x, buf_y);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+					    "[[%s,%s]", buf_x, buf_y);
 		      else
-			  buf = sqlite3_mprintf (",[%s,%s]", buf_x, buf_y);
-		      sqlite3_free (buf_x);
-		      sqlite3_free (buf_y);
+			  sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+					    ",[%s,%s]", buf_x, buf_y);
 		  }
-		gaiaAppendToOutBuffer (out_buf, buf);
-		sqlite3_free (buf);
+		gaiaAppendToOutBuffer (out_buf, vertex);
 	    }
 	  /* closing the Exterior Ring */
 	  gaiaAppendToOutBuffer (out_buf, "]");
@@ -4317,41 +4196,35 @@ gaiaOutGeoJSON (gaiaOutBufferPtr out_buf, gaiaGeomCollPtr geom, int precision,
 			}
 		      if (has_z)
 			{
-			    buf_x = sqlite3_mprintf ("%.*f", precision, x);
+			    gaiaOutFormatDouble (buf_x, precision, x);
 			    gaiaOutClean (buf_x);
-			    buf_y = sqlite3_mprintf ("%.*f", precision, y);
+			    gaiaOutFormatDouble (buf_y, precision, y);
 			    gaiaOutClean (buf_y);
-			    buf_z = sqlite3_mprintf ("%.*f", precision, z);
+			    gaiaOutFormatDouble (buf_z, precision, z);
 			    gaiaOutClean (buf_z);
 			    if (iv == 0)
-				buf =
-				    sqlite3_mprintf (",[[%s,%s,%s]", buf_x,
-						     buf_y, buf_z);
+				sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+						  ",[[%s,%s,%s]", buf_x, buf_y,
+						  buf_z);
 			    else
-				buf =
-				    sqlite3_mprintf (",[%s,%s,%s]", buf_x,
-						     buf_y, buf_z);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
-			    sqlite3_free (buf_z);
+				sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+						  ",[%s,%s,%s]", buf_x, buf_y,
+						  buf_z);
 			}
 		      else
 			{
-			    buf_x = sqlite3_mprintf ("%.*f", precision, x);
+			    gaiaOutFormatDouble (buf_x, precision, x);
 			    gaiaOutClean (buf_x);
-			    buf_y = sqlite3_mprintf ("%.*f", precision, y);
+			    gaiaOutFormatDouble (buf_y, precision, y);
 			    gaiaOutClean (buf_y);
 			    if (iv == 0)
-				buf =
-				    sqlite3_mprintf (",[[%s,%s]", buf_x, buf_y);
+				sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+						  ",[[%s,%s]", buf_x, buf_y);
 			    else
-				buf =
-				    sqlite3_mprintf (",[%s,%s]", buf_x, buf_y);
-			    sqlite3_free (buf_x);
-			    sqlite3_free (buf_y);
+				sqlite3_snprintf (GAIA_OUT_VERTEX_SIZE, vertex,
+						  ",[%s,%s]", buf_x, buf_y);
 			}
-		      gaiaAppendToOutBuffer (out_buf, buf);
-		      sqlite3_free (buf);
+		      gaiaAppendToOutBuffer (out_buf, vertex);
 		  }
 		/* closing the Interior Ring */
 		gaiaAppendToOutBuffer (out_buf, "]");
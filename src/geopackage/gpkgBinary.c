@@ -376,6 +376,116 @@ gaiaGetEnvelopeFromGPB (const unsigned char *gpb, int gpb_len, double *min_x,
     return 1;
 }
 
+GEOPACKAGE_DECLARE int
+gaiaGetMbrFromGPB (const unsigned char *gpb, int gpb_len, double *min_x,
+		   double *max_x, double *min_y, double *max_y)
+{
+/* attempts to retrieve the XY MBR from a GPB
+/
+/ when the GPB header declares an Envelope and its XY range
+/ looks sane we'll directly return it, thus avoiding at all
+/ to parse the WKB payload; in any other case (no Envelope,
+/ empty geometry, NaN or inverted ranges) we'll fall back
+/ to recompute the MBR from scratch
+*/
+    int srid;
+    unsigned int envelope_length;
+    int little_endian;
+    int endian_arch = gaiaEndianArch ();
+    const unsigned char *envelope;
+    double minx;
+    double maxx;
+    double miny;
+    double maxy;
+    int has_z;
+    double min_z;
+    double max_z;
+    int has_m;
+    double min_m;
+    double max_m;
+
+    if (gpb == NULL)
+	return 0;
+    if (!sanity_check_gpb (gpb, gpb_len, &srid, &envelope_length))
+	return 0;
+    if (envelope_length == 0)
+	goto full_decode;
+    if (*(gpb + 3) & GEOPACKAGE_WKB_EMPTY_FLAG)
+	goto full_decode;
+    if ((unsigned int) gpb_len < GEOPACKAGE_HEADER_LEN + envelope_length)
+	return 0;
+    little_endian = *(gpb + 3) & GEOPACKAGE_WKB_LITTLEENDIAN;
+    envelope = gpb + GEOPACKAGE_HEADER_LEN;
+    minx = gaiaImport64 (envelope, little_endian, endian_arch);
+    maxx = gaiaImport64 (envelope + 8, little_endian, endian_arch);
+    miny = gaiaImport64 (envelope + 16, little_endian, endian_arch);
+    maxy = gaiaImport64 (envelope + 24, little_endian, endian_arch);
+    if (!(minx <= maxx) || !(miny <= maxy))
+	goto full_decode;	/* NaN or inverted ranges */
+    *min_x = minx;
+    *max_x = maxx;
+    *min_y = miny;
+    *max_y = maxy;
+    return 1;
+
+  full_decode:
+    return gaiaGetEnvelopeFromGPB (gpb, gpb_len, min_x, max_x, min_y, max_y,
+				   &has_z, &min_z, &max_z, &has_m, &min_m,
+				   &max_m);
+}
+
+static const char *
+gpb_payload_geometry_type (const unsigned char *gpb, int gpb_len)
+{
+/* 
+/ attempts to read the Geometry Type straight from the WKB payload
+/
+/ only Linestrings, Polygons and homogeneous Multi-Geometries
+/ declaring at least one item are accepted: for all of them
+/ a full decode will always return the same Type, so we can
+/ avoid at all to parse the whole payload
+*/
+    int srid;
+    unsigned int envelope_length;
+    int little_endian;
+    int endian_arch = gaiaEndianArch ();
+    const unsigned char *wkb;
+    int type;
+    int items;
+
+    if (!sanity_check_gpb (gpb, gpb_len, &srid, &envelope_length))
+	return NULL;
+    if (*(gpb + 3) & GEOPACKAGE_WKB_EMPTY_FLAG)
+	return NULL;
+    if ((unsigned int) gpb_len < GEOPACKAGE_HEADER_LEN + envelope_length + 9)
+	return NULL;
+    wkb = gpb + GEOPACKAGE_HEADER_LEN + envelope_length;
+    if (*wkb == 0x01)
+	little_endian = 1;
+    else if (*wkb == 0x00)
+	little_endian = 0;
+    else
+	return NULL;
+    type = gaiaImport32 (wkb + 1, little_endian, endian_arch);
+    items = gaiaImport32 (wkb + 5, little_endian, endian_arch);
+    if (type < 0 || type >= 4000 || items <= 0)
+	return NULL;
+    switch (type % 1000)
+      {
+      case GAIA_LINESTRING:
+	  return "LINESTRING";
+      case GAIA_POLYGON:
+	  return "POLYGON";
+      case GAIA_MULTIPOINT:
+	  return "MULTIPOINT";
+      case GAIA_MULTILINESTRING:
+	  return "MULTILINESTRING";
+      case GAIA_MULTIPOLYGON:
+	  return "MULTIPOLYGON";
+      };
+    return NULL;
+}
+
 GEOPACKAGE_DECLARE char *
 gaiaGetGeometryTypeFromGPB (const unsigned char *gpb, int gpb_len)
 {
@@ -387,6 +497,9 @@ gaiaGetGeometryTypeFromGPB (const unsigned char *gpb, int gpb_len)
 
     if (gpb == NULL)
 	return NULL;
+    type = gpb_payload_geometry_type (gpb, gpb_len);
+    if (type != NULL)
+	goto done;
     geo = gaiaFromGeoPackageGeometryBlob (gpb, gpb_len);
     if (geo == NULL)
 	return NULL;
@@ -443,6 +556,7 @@ gaiaGetGeometryTypeFromGPB (const unsigned char *gpb, int gpb_len)
       };
     gaiaFreeGeomColl (geo);
 
+  done:
     if (type == NULL)
 	return NULL;
     len = strlen (type);
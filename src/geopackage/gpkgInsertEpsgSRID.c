@@ -66,8 +66,7 @@ fnct_gpkgInsertEpsgSRID (sqlite3_context * context, int argc,
     sqlite3_stmt *sql_stmt;
     int ret = 0;
     int srid;
-    struct epsg_defs *first = NULL;
-    struct epsg_defs *last = NULL;
+    const struct epsg_catalog_def *p_epsg;
 
     if (argc == 0)
 	argc = 0;		/* suppressing stupid compiler warnings */
@@ -82,8 +81,8 @@ fnct_gpkgInsertEpsgSRID (sqlite3_context * context, int argc,
     srid = sqlite3_value_int (argv[0]);
 
     /* get the EPSG definition for this SRID from our master list */
-    initialize_epsg (srid, &first, &last);
-    if (first == NULL)
+    p_epsg = find_epsg_def (srid);
+    if (p_epsg == NULL)
       {
 	  sqlite3_result_error (context,
 				"gpkgInsertEpsgSRID() error: srid is not defined in the EPSG inlined dataset",
@@ -105,21 +104,21 @@ fnct_gpkgInsertEpsgSRID (sqlite3_context * context, int argc,
 	  goto stop;
       }
     sqlite3_bind_text (sql_stmt, 1,
-		       first->ref_sys_name,
-		       strlen (first->ref_sys_name), SQLITE_STATIC);
-    sqlite3_bind_int (sql_stmt, 2, first->srid);
+		       p_epsg->ref_sys_name,
+		       strlen (p_epsg->ref_sys_name), SQLITE_STATIC);
+    sqlite3_bind_int (sql_stmt, 2, p_epsg->srid);
     sqlite3_bind_text (sql_stmt, 3,
-		       first->auth_name,
-		       strlen (first->auth_name), SQLITE_STATIC);
-    sqlite3_bind_int (sql_stmt, 4, first->auth_srid);
-    if (strlen (first->srs_wkt) == 0)
+		       p_epsg->auth_name,
+		       strlen (p_epsg->auth_name), SQLITE_STATIC);
+    sqlite3_bind_int (sql_stmt, 4, p_epsg->auth_srid);
+    if (strlen (p_epsg->srs_wkt) == 0)
       {
 	  sqlite3_bind_text (sql_stmt, 5, "Undefined", 9, SQLITE_STATIC);
       }
     else
       {
-	  sqlite3_bind_text (sql_stmt, 5, first->srs_wkt,
-			     strlen (first->srs_wkt), SQLITE_STATIC);
+	  sqlite3_bind_text (sql_stmt, 5, p_epsg->srs_wkt,
+			     strlen (p_epsg->srs_wkt), SQLITE_STATIC);
       }
     ret = sqlite3_step (sql_stmt);
     if (ret != SQLITE_DONE && ret != SQLITE_ROW)
@@ -132,8 +131,5 @@ fnct_gpkgInsertEpsgSRID (sqlite3_context * context, int argc,
       {
 	  sqlite3_finalize (sql_stmt);
       }
-
-/* freeing the EPSG defs list */
-    free_epsg (first);
 }
 #endif
@@ -122,6 +122,26 @@ extern "C"
  */
     SPATIALITE_DECLARE void *spatialite_alloc_connection (void);
 
+/**
+ Reports the occupancy of the process-wide connection pool
+
+ \param used on completion will contain the number of currently
+ allocated connections
+ \param peak on completion will contain the max number of connections
+ simultaneously allocated since the library was loaded
+ \param capacity on completion will contain the max number of connections
+ supporting per-connection GEOS error reporting, or -1 if unlimited
+ (fully reentrant builds)
+
+ \note any argument could be NULL if the corresponding value is not
+ required.
+
+ \sa spatialite_alloc_connection
+ */
+    SPATIALITE_DECLARE void spatialite_connection_pool_stats (int *used,
+							      int *peak,
+							      int *capacity);
+
 /**
  Disables reporting GEOS/RTTOPO error and warnings on stderr
 
@@ -1264,6 +1284,36 @@ extern "C"
 					  int colname_case, int *rows,
 					  char **error_message);
 
+/**
+ Dumps a full geometry-table into an external chunked Columnar file
+
+ \param sqlite handle to current DB connection
+ \param table the name of the table to be exported
+ \param geom_col the name of the geometry column
+ \param outfile_path pathname for the Columnar file to be written to
+ \param compressed if TRUE coordinates will be stored as quantized
+ deltas (zigzag + varint encoded); FALSE for plain doubles
+ \param precision number of decimal digits preserved by compressed
+ coordinates (0 to 15); ignored when compressed is FALSE
+ \param chunk_rows max number of rows stored into each chunk; if zero
+ or negative a default of 65536 rows will be assumed
+ \param rows on completion will contain the total number of exported rows
+
+ \sa dump_geojson_ex
+
+ \note each chunk stores the Geometry types, part/ring/vertex offsets
+ and the coordinate arrays followed by one array for each attribute
+ column (with a NULL bitmap). Chunks not fitting the quantized range
+ are silently stored as plain doubles.
+ The file can be read back by the VirtualColumnar module.
+
+ \return 0 on failure, any other value on success
+ */
+    SPATIALITE_DECLARE int dump_columnar (sqlite3 * sqlite, char *table,
+					  char *geom_col, char *outfile_path,
+					  int compressed, int precision,
+					  int chunk_rows, int *rows);
+
 /**
  Loads an external GeoJSON file into a newly created table
 
@@ -1339,6 +1389,49 @@ extern "C"
 						     const char *table,
 						     const char *geometry);
 
+/**
+ Enables trigger-maintained (incremental) Statistics for a VectorLayer
+
+ \param handle SQLite handle to current DB connection.
+ \param table VectorLayer Table.
+ \param geometry Geometry Column name.
+ 
+ \return 0 on failure, any other value on success
+
+ \sa gaiaStatisticsDisableIncremental, update_layer_statistics, 
+ gaiaStatisticsInvalidate
+
+ \note the Statistics will be immediately recomputed, then three triggers
+ (sti_, stu_ and std_) will keep both GEOMETRY_COLUMNS_STATISTICS and
+ GEOMETRY_COLUMNS_FIELD_INFOS up to date after each INSERT, UPDATE or DELETE.
+ \n Changes that can't be applied incrementally (e.g. deleting the row
+ defining the Extent or some min/max value) will simply invalidate the
+ Statistics, that will be then fully recomputed by the next call to
+ update_layer_statistics.
+ \n Requires current metadata style (>= v.4.0.0); must be called again
+ after adding further columns to the Table.
+ */
+    SPATIALITE_DECLARE int gaiaStatisticsEnableIncremental (sqlite3 * handle,
+							    const char *table,
+							    const char
+							    *geometry);
+
+/**
+ Disables trigger-maintained (incremental) Statistics for a VectorLayer
+
+ \param handle SQLite handle to current DB connection.
+ \param table VectorLayer Table.
+ \param geometry Geometry Column name.
+ 
+ \return 0 on failure, any other value on success
+
+ \sa gaiaStatisticsEnableIncremental
+ */
+    SPATIALITE_DECLARE int gaiaStatisticsDisableIncremental (sqlite3 * handle,
+							     const char *table,
+							     const char
+							     *geometry);
+
 /**
  Queries the Metadata tables returning the Layer Full Extent
 
@@ -1975,6 +2068,52 @@ extern "C"
 				       int transaction, int ram_tmp_store,
 				       char **message);
 
+/**
+  Will precisely cut the input dataset against polygonal blade(s)
+  (multithreaded)
+
+ \param db_handle handle to the current SQLite connection
+ \param cache a memory pointer returned by spatialite_alloc_connection()
+ \param in_db_prefix prefix of the DB containing the input table; NULL
+  for MAIN
+ \param input_table name of the input table.
+ \param input_geom name of the input Geometry column (could be NULL)
+ \param blade_db_prefix prefix of the DB containing the blade table; NULL
+  for MAIN
+ \param blade_table name of the blade table.
+ \param blade_geom name of the blade Geometry column (could be NULL)
+ \param output_table name of the output table to be created.
+ \param transaction boolean; if set to TRUE will internally handle
+  a SQL Transaction.
+ \param ram_tmp_store boolean; if set to TRUE all Temporary tables will
+  be stored in RAM, otherwise on disk.
+ \param threads max number of concurrent threads used to cut the
+  input geometries; 1 is strictly single threaded, 0 (or any negative
+  value) will use all the available CPU cores.
+ \param message pointer to a string buffer; if not NULL it will point
+  to an error message (if any).
+
+ \return 0 on failure, any other value on success
+
+ \sa gaiaCutter
+
+ \note exactly the same as gaiaCutter(), except in that the Input/Blade
+ pairs are spatially partitioned and cut in parallel, each thread using
+ its own GEOS context; the output table will always be identical to
+ the one created by gaiaCutter().
+ */
+    SPATIALITE_DECLARE int gaiaCutterEx (sqlite3 * db_handle,
+					 const void *cache,
+					 const char *in_db_prefix,
+					 const char *input_table,
+					 const char *input_geom,
+					 const char *blade_db_prefix,
+					 const char *blade_table,
+					 const char *blade_geom,
+					 const char *output_table,
+					 int transaction, int ram_tmp_store,
+					 int threads, char **message);
+
 /**
   Will attempt to create the Routing Nodes columns for a spatial table
   
@@ -2055,6 +2194,75 @@ extern "C"
 						const char *oneway_to,
 						int overwrite);
 
+/**
+  Will attempt to create a VirtualRouting from an input table, optionally
+  supporting hour-of-day Speed Profiles and Turn Restrictions
+  
+ \param db_handle handle to the current SQLite connection
+ \param cache a memory pointer returned by spatialite_alloc_connection()
+ \param routing_data_table name of the Routing Data Table to be created.
+ \param virtual_routing_table name of the VirtualRouting Table to be created.
+ \param input_table name of the input table to be processed.
+ \param from_column name of the input table column containing NodeFrom.
+ \param to_column name of the input table column containing NodeTo.
+ \param geom_column name of the input table column containing Linestring Geometries
+ (could be eventually NULL).
+ \param cost_column name of the input table column containing Cost values
+ (could be eventually NULL).
+ \param name_column name of the input table column containing RoadName
+ (could be eventually NULL).
+ \param a_star_enabled if set to TRUE the Routing Data Table will support
+ both Djiskra's Shortest Path and A* algorithms; if set to FALSE only
+ the Djiskra's algorithm will be supported.
+ \param bidirectional if set to TRUE all input arcs/links will be assumed
+ to be bidirectional (from-to and to-from); if set to FALSE all input
+ arcs/links will be assumed to be unidirectional (from-to only).
+ \param oneway_from name of the input table column containing OneWayFrom
+ (could be eventually NULL).
+ \param oneway_to name of the input table column containing OneWayTo
+ (could be eventually NULL).
+ \param overwrite if set to TRUE both the Routing Data Table and the
+ VirtualRouting Table will be dropped if already existing; if set to
+ FALSE an already existing Routing Data Table or VirtualRouting Table
+ will cause a fatal error.
+ \param profile_table name of the table containing the Speed Profiles
+ (could be eventually NULL); expected columns are "link_id" (ROWID
+ of the input table), "hour" (0-23) and "factor" (the Cost multiplier
+ to be applied during that hour).
+ \param restriction_table name of the table containing the Turn
+ Restrictions (could be eventually NULL); expected columns are 
+ "from_link" and "to_link" (ROWIDs of the input table) and "penalty"
+ (the Cost to be added when turning, NULL for a forbidden turn).
+ 
+ \return 0 on failure, any other value on success
+ 
+ \sa gaia_create_routing
+
+ \note Speed Profiles are only honoured when a DepartureTime is set
+ on the VirtualRouting Table; in this case Link Costs are assumed
+ to be travel times expressed in seconds.
+ */
+    SPATIALITE_DECLARE int gaia_create_routing_ex (sqlite3 * db_handle,
+						   const void *cache,
+						   const char
+						   *routing_data_table,
+						   const char
+						   *virtual_routing_table,
+						   const char *input_table,
+						   const char *from_column,
+						   const char *to_column,
+						   const char *geom_column,
+						   const char *cost_column,
+						   const char *name_column,
+						   int a_star_enabled,
+						   int bidirectional,
+						   const char *oneway_from,
+						   const char *oneway_to,
+						   int overwrite,
+						   const char *profile_table,
+						   const char
+						   *restriction_table);
+
 /**
   Will attempt to retrieve the Full Extent from an R*Tree (SpatiaLite)
    
@@ -4013,6 +4013,31 @@ extern "C"
 							    gaiaGeomCollPtr
 							    geom);
 
+/**
+ Utility function: MakeValid (extended)
+
+ \param p_cache a memory pointer returned by spatialite_alloc_connection()
+ \param geom the input Geometry object.
+ \param discarded on completion will point to the discarded items (if any);
+ can be NULL if the discarded items are not required.
+
+ \return the pointer to newly created Geometry object: NULL on failure.
+ \n this function is equivalent to calling both gaiaMakeValid and
+ gaiaMakeValidDiscarded, but the validation is computed just once.
+ \n discarded will be set to NULL if no offending item has been identified.
+
+ \sa gaiaFreeGeomColl, gaiaMakeValid, gaiaMakeValidDiscarded
+
+ \note you are responsible to destroy (before or after) any allocated Geometry,
+ this including both Geometries returned by gaiaMakeValidEx()
+
+ \remark \b RTTOPO support required.
+ */
+    GAIAGEO_DECLARE gaiaGeomCollPtr gaiaMakeValidEx (const void *p_cache,
+						     gaiaGeomCollPtr geom,
+						     gaiaGeomCollPtr *
+						     discarded);
+
 /**
  Utility function: Segmentize
 
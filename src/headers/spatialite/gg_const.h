@@ -330,6 +330,22 @@ extern "C"
 #define GAIA_NET_A_STAR_COEFF	0xa5
 /** VirtualNetwork internal markers: BLOCK */
 #define GAIA_NET_BLOCK		0xed
+/** VirtualNetwork internal markers: Speed PROFILE */
+#define GAIA_NET_PROFILE	0xee
+/** VirtualNetwork internal markers: TURN Restrictions */
+#define GAIA_NET_TURN		0xef
+
+/* constants used for Columnar files */
+/** Columnar files: signature (8 bytes) */
+#define GAIA_COLUMNAR_SIGNATURE	"SPLCOL01"
+/** Columnar files internal markers: CHUNK */
+#define GAIA_COLUMNAR_CHUNK	0x63
+/** Columnar files internal markers: END */
+#define GAIA_COLUMNAR_END	0x65
+/** Columnar files coordinates: plain doubles */
+#define GAIA_COLUMNAR_RAW	0x00
+/** Columnar files coordinates: quantized deltas, zigzag + varint */
+#define GAIA_COLUMNAR_DELTA	0x01
 
 /* constants used for Coordinate Dimensions */
 /** Coordinate Dimensions: XY */
@@ -635,6 +635,12 @@ extern "C"
 	gaiaDxfHatchPtr curr_hatch;
 /** internal parser variable */
 	int undeclared_layers;
+/** internal parser variable */
+	int pending_entities;
+/** internal parser variable */
+	void *block_index;
+/** internal parser variable */
+	void *hatch_queue;
     } gaiaDxfParser;
 /**
  Typedef for DXF Layer object
@@ -770,6 +776,43 @@ extern "C"
 					       gaiaDxfParserPtr parser,
 					       int mode, int append);
 
+/**
+ Parsing a DXF file and directly populating a DB [streaming]
+
+ \param p_cache a memory pointer returned by spatialite_alloc_connection()
+ \param db_handle handle to a valid DB connection
+ \param parser pointer to DXF Parser object
+ \param dxf_path pathname of the DXF external file
+ \param mode should be one of GAIA_DXF_IMPORT_BY_LAYER or GAIA_DXF_IMPORT_MIXED
+ \param append boolean flag: if set and some required DB table already exists 
+  will attempt to append further rows into the existing table.
+  otherwise an error will be returned.
+
+ \return 0 on failure, any other value on success
+
+ \sa gaiaCreateDxfParser, gaiaDestroyDxfParser, gaiaParseDxfFile_r,
+ gaiaLoadFromDxfParser
+
+ \note the pointer to the DXF Parser object is expected to be the one 
+ returned by a previous call to gaiaCreateDxfParser, and will be used
+ for a single time exactly as gaiaParseDxfFile_r() does.\n
+ Small DXF files are fully parsed and then loaded exactly as
+ gaiaLoadFromDxfParser() does; bigger files will instead be parsed
+ twice, the first pass only collecting the layout of each Layer
+ and the second one flushing all entities into the DB after each
+ chunk of a few thousands, so that the memory footprint stays
+ bounded whatever the size of the DXF file could be.
+ In this latter case the rows could be inserted in a different order
+ than the one adopted by gaiaLoadFromDxfParser(), and on completion
+ the DXF Parser object will contain the Layer definitions alone.\n
+ reentrant and thread-safe.
+ */
+    GAIAGEO_DECLARE int gaiaStreamDxfFile_r (const void *p_cache,
+					     sqlite3 * db_handle,
+					     gaiaDxfParserPtr parser,
+					     const char *dxf_path, int mode,
+					     int append);
+
 /**
  Initializing a DXF Writer Object
 
@@ -1812,6 +1812,34 @@ extern "C"
     GAIAGEO_DECLARE int gaiaReadDbfEntity_ex (gaiaDbfPtr dbf, int current_row,
 					      int *deleted, int text_dates);
 
+/**
+ Reads a record from a DBF File object, only fetching some fields
+
+ \param dbf pointer to the DBF File object.
+ \param current_row the row number identifying the record to be read.
+ \param deleted on completion this variable will contain 0 if the record
+ just read is valid: any other value if the record just read is marked as
+ \e logically \e deleted.
+ \param text_dates is TRUE all DBF dates will be considered as TEXT
+ \param fields an array of flags, one for each DBF field (in the same
+ order as the DBF fields list): only fields marked by a non-zero flag 
+ will be actually fetched. NULL means fetching all fields.
+
+ \return 0 on failure: any other value on success.
+
+ \sa gaiaAllocDbf, gaiaFreeDbf, gaiaOpenDbfRead, gaiaReadDbfEntity_ex
+
+ \note on completion the DBF File \e First member will point to the 
+ linked list containing the corresponding data attributes; any field
+ not fetched will have a NULL \e Value.
+
+ \remark the DBF File object should be opened in \e read mode.
+ */
+    GAIAGEO_DECLARE int gaiaReadDbfEntity_ex2 (gaiaDbfPtr dbf,
+					       int current_row, int *deleted,
+					       int text_dates,
+					       const char *fields);
+
 /**
  Writes a record into a DBF File object
 
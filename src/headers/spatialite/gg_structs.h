@@ -410,6 +410,12 @@ extern "C"
 	void *IconvObj;		/* opaque reference to ICONV converter */
 /** last error message (may be NULL) */
 	char *LastError;	/* last error message */
+/** read-only memory mapped view of the DBF file (may be NULL) */
+	unsigned char *MapDbf;	/* the DBF memory mapped view */
+/** size (in bytes) of the memory mapped view */
+	size_t MapSize;		/* the DBF memory mapped size */
+/** opaque reference to the cache of ICONV conversions */
+	void *IconvCache;	/* the DBF ICONV cache */
     } gaiaDbf;
 /** 
  Typedef for DBF file handler structure
@@ -482,6 +488,8 @@ extern "C"
 	int EffectiveType;	/* the effective Geometry-type, as determined by gaiaShpAnalyze() */
 /** SHP actual dims: one of GAIA_XY, GAIA_XY_Z, GAIA_XY_M, GAIA_XY_ZM */
 	int EffectiveDims;	/* the effective Dimensions [XY, XYZ, XYM, XYZM], as determined by gaiaShpAnalyze() */
+/** large output buffers used in write mode (may be NULL) */
+	void *IoBuffer;		/* the SHP, SHX and DBF output buffers */
     } gaiaShapefile;
 /**
  Typedef for SHP file handler structure
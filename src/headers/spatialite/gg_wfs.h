@@ -186,7 +186,8 @@ extern "C"
  \param callback_ptr an arbitrary pointer (to be passed as the second argument
  by the callback function).
  
- \sa create_wfs_catalog, load_from_wfs, reset_wfs_http_connection
+ \sa create_wfs_catalog, load_from_wfs, reset_wfs_http_connection,
+ load_from_wfs_paged_mt
 
  \return 0 on failure, any other value on success
  
@@ -212,6 +213,62 @@ extern "C"
 						   (int, void *),
 						   void *callback_ptr);
 
+/**
+ Loads data from some WFS source (using WFS paging) - Multithreaded
+
+ \param sqlite handle to current DB connection
+ \param wfs_version one of "1.0.0", "1.1.0", "2.0.0" or "2.0.2"
+ \param path_or_url pointer to some WFS-GetFeature XML Document (could be a pathname or an URL).
+ \param alt_describe_uri an alternative URI for DescribeFeatureType to be used
+ if no one is found within the XML document returned by GetFeature.
+ \param layer_name the name of the WFS layer.
+ \param swap_axes if TRUE the X and Y axes will be swapped 
+ \param table the name of the table to be created
+ \param pk_column name of the Primary Key column; if NULL or mismatching
+ then "PK_UID" will be assumed by default.
+ \param spatial_index if TRUE an R*Tree Spatial Index will be created
+ \param page_size max number of features for each single WFS call; if zero or
+ negative a single monolithic page is assumed (i.e. paging will not be applied).
+ \param max_threads max number of WFS pages to be concurrently fetched and
+ parsed by background threads; 1 (or less) means no concurrency at all.
+ \param rows on completion will contain the total number of actually imported rows
+ \param err_msg on completion will contain an error message (if any)
+ \param progress_callback pointer to a callback function to be invoked immediately
+ after processing each WFS page (could be NULL)
+ \param callback_ptr an arbitrary pointer (to be passed as the second argument
+ by the callback function).
+ 
+ \sa create_wfs_catalog, load_from_wfs, reset_wfs_http_connection,
+ load_from_wfs_paged_ex
+
+ \return 0 on failure, any other value on success
+ 
+ \note an eventual error message returned via err_msg requires to be deallocated
+ by invoking free()
+
+ \note the first page is always loaded on the calling thread; all the
+ following pages are then fetched in batches of max_threads, the next
+ batch being prefetched while the current one is still being inserted.
+ Rows are always inserted into the target table following the natural
+ order of the WFS pages, and the target table is only ever written by
+ the calling thread.
+ */
+    SPATIALITE_DECLARE int load_from_wfs_paged_mt (sqlite3 * sqlite,
+						   const char *wfs_version,
+						   const char *path_or_url,
+						   const char *alt_describe_uri,
+						   const char *layer_name,
+						   int swap_axes,
+						   const char *table,
+						   const char *pk_column_name,
+						   int spatial_index,
+						   int page_size,
+						   int max_threads, int *rows,
+						   char **err_msg,
+						   void (*progress_callback)
+						   (int, void *),
+						   void *callback_ptr);
+
 /**
  Creates a Catalog for some WFS service 
 
@@ -54,10 +54,18 @@ SPATIALITE_PRIVATE int virtualfdo_extension_init (void *db);
 SPATIALITE_PRIVATE int virtualbbox_extension_init (void *db,
 						   const void *p_cache);
 SPATIALITE_PRIVATE int mbrcache_extension_init (void *db);
+SPATIALITE_PRIVATE sqlite3_int64 mbrcache_memory_usage (void *db,
+							const char *table,
+							const char *column);
 SPATIALITE_PRIVATE int virtual_spatialindex_extension_init (void *db);
 SPATIALITE_PRIVATE int virtual_elementary_extension_init (void *db);
+SPATIALITE_PRIVATE int virtualcolumnar_extension_init (void *db);
 SPATIALITE_PRIVATE int virtual_knn_extension_init (void *db);
 SPATIALITE_PRIVATE int virtual_xpath_extension_init (void *db,
 						     const void *p_cache);
 SPATIALITE_PRIVATE int virtualgpkg_extension_init (void *db);
 SPATIALITE_PRIVATE int virtualgeojson_extension_init (void *db);
+SPATIALITE_PRIVATE int virtualgrid_extension_init (void *db,
+						   const void *p_cache);
+SPATIALITE_PRIVATE int virtualdelaunay_extension_init (void *db,
+						       const void *p_cache);
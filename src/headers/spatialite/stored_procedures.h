@@ -634,6 +634,35 @@ extern "C"
 					       const void *cache,
 					       const char *sql);
 
+/**
+ Retrieving the execution statistics of a cached SQL Procedure
+  
+ \param cache the same memory pointer passed to the corresponding call to
+ spatialite_init_ex() and returned by spatialite_alloc_connection()
+ \param blob pointer to the BLOB SQL Procedure Object.
+ \param blob_sz size (in bytes) of the BLOB SQL Procedure Object.
+ \param statement 0 for the whole SQL Body, or the relative position
+ (1-based) of some statement within the SQL Body.
+ \param executions on completion will contain how many times the SQL Body
+ (or the requested statement) was executed.
+ \param statements on completion will contain the number of statements
+ for which some statistics are available.
+ \param seconds on completion will contain the total elapsed time (in
+ seconds) spent executing the SQL Body (or the requested statement).
+ 
+ \return 0 if the SQL Body is not currently cached by this connection
+ or if the requested statement does not exist: any other different
+ value on success.
+ 
+ \sa gaia_sql_proc_cooked_sql, gaia_sql_proc_execute
+*/
+    SQLPROC_DECLARE int gaia_sql_proc_cache_stats (const void *cache,
+						   const unsigned char *blob,
+						   int blob_sz, int statement,
+						   sqlite3_int64 * executions,
+						   int *statements,
+						   double *seconds);
+
 #ifdef __cplusplus
 }
 #endif
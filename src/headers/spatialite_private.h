@@ -128,6 +128,24 @@ extern "C"
 	void *schema;
     };
 
+    struct splite_sqlproc_stmt_stats
+    {
+	/* execution statistics of a single SQL statement */
+	sqlite3_int64 count;
+	double seconds;
+    };
+
+    struct splite_sqlproc_cache_item
+    {
+	sqlite3_int64 last_access;
+	unsigned char *blob;
+	int blob_sz;
+	void *compiled;
+	sqlite3_int64 executions;
+	int n_stats;
+	struct splite_sqlproc_stmt_stats *stats;
+    };
+
     struct splite_savepoint
     {
 	char *savepoint_name;
@@ -159,6 +177,7 @@ extern "C"
     };
 
 #define MAX_XMLSCHEMA_CACHE	16
+#define MAX_SQLPROC_CACHE	8
 
     struct splite_internal_cache
     {
@@ -209,6 +228,9 @@ extern "C"
 	FILE *SqlProcLog;
 	int SqlProcContinue;
 	struct gaia_variant_value *SqlProcRetValue;
+	struct splite_sqlproc_cache_item sqlProcCache[MAX_SQLPROC_CACHE];
+	sqlite3_int64 sqlProcCacheClock;
+	int sqlProcCacheActive;
 	int tinyPointEnabled;
 	unsigned char magic2;
 	char *lastPostgreSqlError;
@@ -224,26 +246,33 @@ extern "C"
 	int is_pause_enabled;
     };
 
-    struct epsg_defs
+    struct epsg_catalog_def
     {
+	/* a read-only EPSG def [compiled into the library] */
 	int srid;
-	char *auth_name;
+	const char *auth_name;
 	int auth_srid;
-	char *ref_sys_name;
-	char *proj4text;
-	char *srs_wkt;
+	const char *ref_sys_name;
 	int is_geographic;
 	int flipped_axes;
-	char *spheroid;
-	char *prime_meridian;
-	char *datum;
-	char *projection;
-	char *unit;
-	char *axis_1;
-	char *orientation_1;
-	char *axis_2;
-	char *orientation_2;
-	struct epsg_defs *next;
+	const char *spheroid;
+	const char *prime_meridian;
+	const char *datum;
+	const char *projection;
+	const char *unit;
+	const char *axis_1;
+	const char *orientation_1;
+	const char *axis_2;
+	const char *orientation_2;
+	const char *proj4text;
+	const char *srs_wkt;
+    };
+
+    struct epsg_catalog
+    {
+	/* a block of read-only EPSG defs sorted by SRID */
+	const struct epsg_catalog_def *defs;
+	int count;
     };
 
     struct gaia_control_points
@@ -282,58 +311,27 @@ extern "C"
     SPATIALITE_PRIVATE void free_internal_cache (struct splite_internal_cache
 						 *cache);
 
-    SPATIALITE_PRIVATE void free_internal_cache_topologies (void *first);
+    SPATIALITE_PRIVATE void *splite_get_geos_handle (const void *p_cache);
 
-    SPATIALITE_PRIVATE void free_internal_cache_networks (void *first);
+    SPATIALITE_PRIVATE void *splite_get_proj_handle (const void *p_cache);
 
-    SPATIALITE_PRIVATE struct epsg_defs *add_epsg_def (int filter_srid,
-						       struct epsg_defs
-						       **first,
-						       struct epsg_defs
-						       **last, int srid,
-						       const char *auth_name,
-						       int auth_srid,
-						       const char
-						       *ref_sys_name);
+    SPATIALITE_PRIVATE void *splite_get_rttopo_handle (const void *p_cache);
 
-    SPATIALITE_PRIVATE struct epsg_defs *add_epsg_def_ex (int filter_srid,
-							  struct epsg_defs
-							  **first,
-							  struct epsg_defs
-							  **last, int srid,
-							  const char
-							  *auth_name,
-							  int auth_srid,
-							  const char
-							  *ref_sys_name,
-							  int is_geographic,
-							  int flipped_axes,
-							  const char
-							  *spheroid,
-							  const char
-							  *prime_meridian,
-							  const char *datum,
-							  const char
-							  *projection,
-							  const char *unit,
-							  const char *axis_1,
-							  const char
-							  *orientation_1,
-							  const char *axis_2,
-							  const char
-							  *orientation_2);
+    SPATIALITE_PRIVATE void free_internal_cache_topologies (void *first);
 
-    SPATIALITE_PRIVATE void add_proj4text (struct epsg_defs *p, int count,
-					   const char *text);
+    SPATIALITE_PRIVATE void free_internal_cache_networks (void *first);
 
-    SPATIALITE_PRIVATE void add_srs_wkt (struct epsg_defs *p, int count,
-					 const char *text);
+    SPATIALITE_PRIVATE void free_internal_cache_sqlproc (struct
+							 splite_sqlproc_cache_item
+							 *item);
 
-    SPATIALITE_PRIVATE void initialize_epsg (int filter,
-					     struct epsg_defs **first,
-					     struct epsg_defs **last);
+    SPATIALITE_PRIVATE const struct epsg_catalog_def *find_epsg_def (int
+								    srid);
 
-    SPATIALITE_PRIVATE void free_epsg (struct epsg_defs *first);
+    SPATIALITE_PRIVATE const struct epsg_catalog *const *get_epsg_catalog (int
+									   filter,
+									   int
+									   *count);
 
     SPATIALITE_PRIVATE int exists_spatial_ref_sys (void *handle);
 
@@ -373,6 +371,8 @@ extern "C"
 
     SPATIALITE_PRIVATE int createAdvancedMetaData (void *sqlite);
 
+    SPATIALITE_PRIVATE int createAdvancedMetaDataOnDemand (void *sqlite);
+
     SPATIALITE_PRIVATE void updateSpatiaLiteHistory (void *sqlite,
 						     const char *table,
 						     const char *geom,
@@ -1448,6 +1448,11 @@ extern "C"
 
     SPATIALITE_PRIVATE int gaia_do_check_linestring (const void *geom);
 
+    SPATIALITE_PRIVATE int gaia_fast_parse_number (const char **ptr,
+						   double *value);
+
+    SPATIALITE_PRIVATE void *gaia_fast_parse_ewkt (const char *text);
+
     SPATIALITE_PRIVATE void spatialite_internal_init (void *db_handle,
 						      const void *ptr);
 
@@ -1486,6 +1491,13 @@ extern "C"
     SPATIALITE_PRIVATE void splite_pause_signal (void);
 #endif
 
+    SPATIALITE_PRIVATE int splite_cpu_count (int max_threads);
+
+    SPATIALITE_PRIVATE void *splite_thread_start (void (*job) (void *arg),
+						  void *arg);
+
+    SPATIALITE_PRIVATE void splite_thread_join (void *thread);
+
     SPATIALITE_PRIVATE void finalize_topologies (const void *p_cache);
 
     SPATIALITE_PRIVATE int create_data_licenses (sqlite3 * sqlite);
@@ -100,6 +100,20 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #define GAIA_ZIPFILE_DBF	3
 #define GAIA_ZIPFILE_PRJ	4
 
+/* max number of threads decoding Geometries while dumping a Shapefile */
+#ifndef SHP_DUMP_THREADS
+#define SHP_DUMP_THREADS	4
+#endif
+
+/* number of rows buffered before being written into the Shapefile */
+#define SHP_DUMP_BATCH		1024
+
+/* min number of Geometries deserving a further thread */
+#define SHP_DUMP_PER_THREAD	64
+
+/* default number of rows stored into each chunk of a Columnar file */
+#define COLUMNAR_CHUNK_ROWS	65536
+
 struct auxdbf_fld
 {
 /* auxiliary DBF field struct */
@@ -115,6 +129,29 @@ struct auxdbf_list
     struct auxdbf_fld *last;
 };
 
+struct shp_dump_row
+{
+/* a resultset row waiting to be written into the Shapefile */
+    unsigned char *blob;
+    int size;
+    gaiaDbfListPtr entity;
+};
+
+struct shp_dump_batch
+{
+/* a batch of rows waiting to be written into the Shapefile */
+    int count;
+    struct shp_dump_row rows[SHP_DUMP_BATCH];
+};
+
+struct shp_dump_job
+{
+/* a share of the batched Geometries assigned to a single thread */
+    struct shp_dump_batch *batch;
+    int first;
+    int step;
+};
+
 struct resultset_values
 {
 /* a struct wrapping values from a resultset */
@@ -1676,12 +1713,30 @@ do_check_dbf_unique_pk_values (sqlite3 * sqlite, gaiaDbfPtr dbf, int text_dates,
     int deleted;
     int duplicates = 0;
     int current_row = 0;
+    int count = 0;
+    char *fields = NULL;
 
     sql = "CREATE TABLE TEMP.check_unique_pk (pkey ANYVALUE)";
     ret = sqlite3_exec (sqlite, sql, NULL, NULL, NULL);
     if (ret != SQLITE_OK)
 	return 0;
 
+/* the Primary Key is the only DBF field to be actually fetched */
+    dbf_field = dbf->Dbf->First;
+    while (dbf_field)
+      {
+	  count++;
+	  dbf_field = dbf_field->Next;
+      }
+    fields = malloc (count + 1);
+    count = 0;
+    dbf_field = dbf->Dbf->First;
+    while (dbf_field)
+      {
+	  fields[count++] = (strcasecmp (pk_name, dbf_field->Name) == 0);
+	  dbf_field = dbf_field->Next;
+      }
+
     sql = "INSERT INTO TEMP.check_unique_pk (pkey) VALUES (?)";
     ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
     if (ret != SQLITE_OK)
@@ -1693,7 +1748,9 @@ do_check_dbf_unique_pk_values (sqlite3 * sqlite, gaiaDbfPtr dbf, int text_dates,
       {
 	  /* reading rows from shapefile */
 	  int ok_insert = 0;
-	  ret = gaiaReadDbfEntity_ex (dbf, current_row, &deleted, text_dates);
+	  ret =
+	      gaiaReadDbfEntity_ex2 (dbf, current_row, &deleted, text_dates,
+				     fields);
 	  if (!ret)
 	      break;
 	  current_row++;
@@ -1768,6 +1825,7 @@ do_check_dbf_unique_pk_values (sqlite3 * sqlite, gaiaDbfPtr dbf, int text_dates,
     sqlite3_finalize (stmt);
 
     sqlite3_exec (sqlite, "DROP TABLE TEMP.check_unique_pk", NULL, NULL, NULL);
+    free (fields);
     if (duplicates)
 	return 0;
     else
@@ -1778,6 +1836,7 @@ do_check_dbf_unique_pk_values (sqlite3 * sqlite, gaiaDbfPtr dbf, int text_dates,
 	sqlite3_finalize (stmt);
     sqlite3_exec (sqlite, "COMMIT", NULL, NULL, NULL);
     sqlite3_exec (sqlite, "DROP TABLE TEMP.check_unique_pk", NULL, NULL, NULL);
+    free (fields);
     return 0;
 }
 
@@ -4437,6 +4496,20 @@ compute_text_length (const char *string, const char *charset)
     return len;
 }
 
+static void
+readjust_dbf_offsets (gaiaDbfListPtr dbf_list)
+{
+/* readjusting all offsets after changing some field length */
+    int offset = 0;
+    gaiaDbfFieldPtr fld = dbf_list->First;
+    while (fld)
+      {
+	  fld->Offset = offset;
+	  offset += fld->Length;
+	  fld = fld->Next;
+      }
+}
+
 static void
 compute_exact_text_max_length (sqlite3 * sqlite, gaiaDbfListPtr dbf_list,
 			       const char *table, const char *charset)
@@ -4450,7 +4523,6 @@ compute_exact_text_max_length (sqlite3 * sqlite, gaiaDbfListPtr dbf_list,
     int ok = 0;
     int ret;
     sqlite3_stmt *stmt = NULL;
-    int offset = 0;
 
 /* preparing the SQL query */
     sql = sqlite3_mprintf ("SELECT");
@@ -4529,15 +4601,240 @@ compute_exact_text_max_length (sqlite3 * sqlite, gaiaDbfListPtr dbf_list,
 	    }
       }
     sqlite3_finalize (stmt);
+    readjust_dbf_offsets (dbf_list);
+}
+
+static int
+is_single_byte_charset (const char *charset)
+{
+/* checking if some charset always encodes a character as a single byte */
+    int i;
+    const char *prefixes[] = {
+	"ASCII", "US-ASCII", "ISO-8859-", "ISO8859-", "ISO_8859-", "LATIN",
+	"CP125", "WINDOWS-125", "CP437", "CP737", "CP775", "CP85", "CP86",
+	"CP874", "KOI8-", "MACINTOSH", NULL
+    };
+    for (i = 0; prefixes[i] != NULL; i++)
+      {
+	  if (strncasecmp (charset, prefixes[i], strlen (prefixes[i])) == 0)
+	      return 1;
+      }
+    return 0;
+}
 
+static int
+compute_utf8_text_max_length (sqlite3 * sqlite, gaiaDbfListPtr dbf_list,
+			      const char *table)
+{
+/* 
+/ computing the exact max length of TEXT fields to be encoded as UTF-8:
+/ the DB already stores them as UTF-8, so a single aggregate query
+/ is enough and no charset conversion is required at all
+*/
+    char *sql;
+    char *prevsql;
+    char *xtable;
+    gaiaDbfFieldPtr fld;
+    int first = 1;
+    int ret;
+    int col;
+    char **results;
+    int rows;
+    int columns;
+    int utf8 = 0;
+    sqlite3_stmt *stmt = NULL;
+
+    ret =
+	sqlite3_get_table (sqlite, "PRAGMA encoding", &results, &rows,
+			   &columns, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (rows >= 1 && results[columns] != NULL
+	&& strcasecmp (results[columns], "UTF-8") == 0)
+	utf8 = 1;
+    sqlite3_free_table (results);
+    if (!utf8)
+	return 0;
+
+/* preparing the SQL query */
+    sql = sqlite3_mprintf ("SELECT");
+    prevsql = sql;
     fld = dbf_list->First;
     while (fld)
       {
-	  /* readjusting all offsets */
-	  fld->Offset = offset;
-	  offset += fld->Length;
+	  char *xcolumn;
+	  if (fld->Type != 'C')
+	    {
+		fld = fld->Next;
+		continue;
+	    }
+	  xcolumn = gaiaDoubleQuotedSql (fld->Name);
+	  sql =
+	      sqlite3_mprintf
+	      ("%s%s Max(CASE WHEN typeof(\"%s\") = 'text' THEN "
+	       "length(CAST(\"%s\" AS BLOB)) END)", prevsql,
+	       first ? "" : ",", xcolumn, xcolumn);
+	  first = 0;
+	  free (xcolumn);
+	  sqlite3_free (prevsql);
+	  prevsql = sql;
+	  fld = fld->Next;
+      }
+    if (first)
+      {
+	  /* there are no TEXT fields at all */
+	  sqlite3_free (sql);
+	  return 1;
+      }
+
+    xtable = gaiaDoubleQuotedSql (table);
+    sql = sqlite3_mprintf ("%s FROM \"%s\"", prevsql, xtable);
+    sqlite3_free (prevsql);
+    free (xtable);
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    ret = sqlite3_step (stmt);
+    if (ret != SQLITE_ROW)
+      {
+	  sqlite3_finalize (stmt);
+	  return 0;
+      }
+    col = 0;
+    fld = dbf_list->First;
+    while (fld)
+      {
+	  if (fld->Type == 'C')
+	    {
+		if (sqlite3_column_type (stmt, col) == SQLITE_INTEGER)
+		  {
+		      int len = sqlite3_column_int (stmt, col);
+		      if (len > 254)
+			  len = 254;	/* DBF C: max allowed length */
+		      if (len > fld->Length)
+			  fld->Length = len;
+		  }
+		col++;
+	    }
 	  fld = fld->Next;
       }
+    sqlite3_finalize (stmt);
+    readjust_dbf_offsets (dbf_list);
+    return 1;
+}
+
+static void
+compute_text_max_length (sqlite3 * sqlite, gaiaDbfListPtr dbf_list,
+			 const char *table, const char *charset, int text_stats)
+{
+/* computing the max length of TEXT fields */
+    if (text_stats && is_single_byte_charset (charset))
+      {
+	  /* 
+	     / one byte for each character: the Field Infos statistics
+	     / (max length in characters) are already exact
+	   */
+	  return;
+      }
+    if (strcasecmp (charset, "UTF-8") == 0 || strcasecmp (charset, "UTF8") == 0)
+      {
+	  if (compute_utf8_text_max_length (sqlite, dbf_list, table))
+	      return;
+      }
+    compute_exact_text_max_length (sqlite, dbf_list, table, charset);
+}
+
+static void
+do_shp_dump_job (struct shp_dump_job *job)
+{
+/* decoding all the Geometries assigned to a job */
+    int i;
+    for (i = job->first; i < job->batch->count; i += job->step)
+      {
+	  struct shp_dump_row *row = job->batch->rows + i;
+	  if (row->blob == NULL)
+	      continue;
+	  row->entity->Geometry =
+	      gaiaFromSpatiaLiteBlobWkb (row->blob, row->size);
+	  free (row->blob);
+	  row->blob = NULL;
+      }
+}
+
+static void
+shp_dump_thread (void *arg)
+{
+/* the worker thread */
+    do_shp_dump_job ((struct shp_dump_job *) arg);
+}
+
+static void
+decode_shp_dump_batch (struct shp_dump_batch *batch)
+{
+/* decoding all the batched Geometries */
+    struct shp_dump_job jobs[SHP_DUMP_THREADS];
+    void *threads[SHP_DUMP_THREADS];
+    int num_jobs;
+    int i;
+
+    num_jobs = batch->count / SHP_DUMP_PER_THREAD;
+    if (num_jobs > SHP_DUMP_THREADS)
+	num_jobs = SHP_DUMP_THREADS;
+    if (num_jobs < 1)
+	num_jobs = 1;
+    for (i = 0; i < num_jobs; i++)
+      {
+	  struct shp_dump_job *job = jobs + i;
+	  job->batch = batch;
+	  job->first = i;
+	  job->step = num_jobs;
+	  threads[i] = NULL;
+	  if (i == 0)
+	      continue;		/* the first job always runs on this thread */
+	  threads[i] = splite_thread_start (shp_dump_thread, job);
+      }
+    do_shp_dump_job (jobs);
+    for (i = 1; i < num_jobs; i++)
+      {
+	  if (threads[i] == NULL)
+	    {
+		/* no thread available: running on this thread */
+		do_shp_dump_job (jobs + i);
+	    }
+	  else
+	      splite_thread_join (threads[i]);
+      }
+}
+
+static void
+reset_shp_dump_batch (struct shp_dump_batch *batch)
+{
+/* memory cleanup - discarding all the batched rows */
+    int i;
+    for (i = 0; i < batch->count; i++)
+      {
+	  struct shp_dump_row *row = batch->rows + i;
+	  if (row->blob != NULL)
+	      free (row->blob);
+	  gaiaFreeDbfList (row->entity);
+      }
+    batch->count = 0;
+}
+
+static void
+flush_shp_dump_batch (gaiaShapefilePtr shp, struct shp_dump_batch *batch)
+{
+/* writing all the batched rows into the Shapefile */
+    int i;
+    decode_shp_dump_batch (batch);
+    for (i = 0; i < batch->count; i++)
+      {
+	  struct shp_dump_row *row = batch->rows + i;
+	  if (!gaiaWriteShpEntity (shp, row->entity))
+	      spatialite_e ("shapefile write error\n");
+      }
+    reset_shp_dump_batch (batch);
 }
 
 SPATIALITE_DECLARE int
@@ -4592,6 +4889,9 @@ dump_shapefile_ex2 (sqlite3 * sqlite, void *proj_ctx, char *table, char *column,
     char *xprefix;
     char *xxtable;
     struct auxdbf_list *auxdbf = NULL;
+    struct shp_dump_batch *batch = NULL;
+    struct shp_dump_row *row;
+    int text_stats = 1;
 
     if (xrows)
 	*xrows = -1;
@@ -4911,6 +5211,8 @@ dump_shapefile_ex2 (sqlite3 * sqlite, void *proj_ctx, char *table, char *column,
 		max_len = 254;
 		if (fld->MaxSize)
 		    max_len = fld->MaxSize->MaxSize;
+		else
+		    text_stats = 0;
 	    }
 	  if (sql_type == SQLITE_NULL)
 	    {
@@ -4954,7 +5256,7 @@ dump_shapefile_ex2 (sqlite3 * sqlite, void *proj_ctx, char *table, char *column,
       }
 
 /* exact computation of TEXT fields max length */
-    compute_exact_text_max_length (sqlite, dbf_list, table, charset);
+    compute_text_max_length (sqlite, dbf_list, table, charset, text_stats);
 
 /* resetting SQLite query */
   continue_exporting:
@@ -4969,6 +5271,8 @@ dump_shapefile_ex2 (sqlite3 * sqlite, void *proj_ctx, char *table, char *column,
 	goto no_file;
 /* trying to export the .PRJ file */
     output_prj_file (sqlite, shp_path, table, column, proj_ctx);
+    batch = malloc (sizeof (struct shp_dump_batch));
+    batch->count = 0;
     while (1)
       {
 	  /* scrolling the result set to dump data into shapefile */
@@ -4981,6 +5285,11 @@ dump_shapefile_ex2 (sqlite3 * sqlite, void *proj_ctx, char *table, char *column,
 		    n_cols = sqlite3_column_count (stmt);
 		rows++;
 		dbf_write = gaiaCloneDbfEntity (dbf_list);
+		row = batch->rows + batch->count;
+		row->blob = NULL;
+		row->size = 0;
+		row->entity = dbf_write;
+		batch->count += 1;
 		auxdbf = alloc_auxdbf (dbf_write);
 		for (i = 0; i < n_cols; i++)
 		  {
@@ -4996,11 +5305,14 @@ dump_shapefile_ex2 (sqlite3 * sqlite, void *proj_ctx, char *table, char *column,
 			      }
 			    else
 			      {
+				  /* to be decoded later, by the batch */
 				  blob_value = sqlite3_column_blob (stmt, i);
 				  len = sqlite3_column_bytes (stmt, i);
-				  dbf_write->Geometry =
-				      gaiaFromSpatiaLiteBlobWkb (blob_value,
-								 len);
+				  if (row->blob != NULL)
+				      free (row->blob);
+				  row->blob = malloc (len);
+				  memcpy (row->blob, blob_value, len);
+				  row->size = len;
 			      }
 			}
 		      dummy = (char *) sqlite3_column_name (stmt, i);
@@ -5064,13 +5376,14 @@ dump_shapefile_ex2 (sqlite3 * sqlite, void *proj_ctx, char *table, char *column,
 		  }
 		free_auxdbf (auxdbf);
 		auxdbf = NULL;
-		if (!gaiaWriteShpEntity (shp, dbf_write))
-		    spatialite_e ("shapefile write error\n");
-		gaiaFreeDbfList (dbf_write);
+		if (batch->count == SHP_DUMP_BATCH)
+		    flush_shp_dump_batch (shp, batch);
 	    }
 	  else
 	      goto sql_error;
       }
+    flush_shp_dump_batch (shp, batch);
+    free (batch);
     if (auxdbf != NULL)
 	free_auxdbf (auxdbf);
     sqlite3_finalize (stmt);
@@ -5092,6 +5405,11 @@ dump_shapefile_ex2 (sqlite3 * sqlite, void *proj_ctx, char *table, char *column,
     return 1;
   sql_error:
 /* some SQL error occurred */
+    if (batch != NULL)
+      {
+	  reset_shp_dump_batch (batch);
+	  free (batch);
+      }
     if (auxdbf != NULL)
 	free_auxdbf (auxdbf);
     sqlite3_finalize (stmt);
@@ -5816,6 +6134,902 @@ dump_geojson_ex (sqlite3 * sqlite, char *table, char *geom_col,
     return 0;
 }
 
+struct columnar_buffer
+{
+/* a growable binary buffer */
+    unsigned char *buf;
+    size_t size;
+    size_t alloc;
+    int error;
+};
+
+struct columnar_ints
+{
+/* a growable array of INTs */
+    int *values;
+    int count;
+    int alloc;
+};
+
+struct columnar_attribute
+{
+/* an attribute column of a Columnar file */
+    char *name;
+    int type;
+    unsigned char *validity;
+    sqlite3_int64 *int_values;
+    double *dbl_values;
+    int *offsets;
+    struct columnar_buffer data;
+};
+
+struct columnar_chunk
+{
+/* the chunk of rows currently being built by dump_columnar() */
+    int max_rows;
+    int n_rows;
+    int srid;
+    int srid_set;
+    int has_z;
+    int has_m;
+    int *geom_types;
+    int *geom_offsets;
+    struct columnar_ints part_types;
+    struct columnar_ints part_offsets;
+    struct columnar_ints ring_offsets;
+    double *coords;
+    int n_vertices;
+    int alloc_vertices;
+    int n_attributes;
+    struct columnar_attribute *attributes;
+    int compressed;
+    int precision;
+    int endian_arch;
+};
+
+static void
+columnar_buffer_append (struct columnar_buffer *buf, const void *data,
+			size_t len)
+{
+/* appending some bytes to a binary buffer */
+    if (buf->error)
+	return;
+    if (buf->size + len > buf->alloc)
+      {
+	  size_t alloc = (buf->alloc == 0) ? 4096 : buf->alloc;
+	  unsigned char *ptr;
+	  while (alloc < buf->size + len)
+	      alloc *= 2;
+	  ptr = realloc (buf->buf, alloc);
+	  if (ptr == NULL)
+	    {
+		buf->error = 1;
+		return;
+	    }
+	  buf->buf = ptr;
+	  buf->alloc = alloc;
+      }
+    if (len > 0)
+	memcpy (buf->buf + buf->size, data, len);
+    buf->size += len;
+}
+
+static void
+columnar_buffer_int32 (struct columnar_buffer *buf, int value,
+		       int endian_arch)
+{
+/* appending a little-endian 32 bit INT to a binary buffer */
+    unsigned char tmp[4];
+    gaiaExport32 (tmp, value, 1, endian_arch);
+    columnar_buffer_append (buf, tmp, 4);
+}
+
+static void
+columnar_buffer_int64 (struct columnar_buffer *buf, sqlite3_int64 value,
+		       int endian_arch)
+{
+/* appending a little-endian 64 bit INT to a binary buffer */
+    unsigned char tmp[8];
+    gaiaExportI64 (tmp, value, 1, endian_arch);
+    columnar_buffer_append (buf, tmp, 8);
+}
+
+static void
+columnar_buffer_double (struct columnar_buffer *buf, double value,
+			int endian_arch)
+{
+/* appending a little-endian DOUBLE to a binary buffer */
+    unsigned char tmp[8];
+    gaiaExport64 (tmp, value, 1, endian_arch);
+    columnar_buffer_append (buf, tmp, 8);
+}
+
+static void
+columnar_buffer_varint (struct columnar_buffer *buf, sqlite3_uint64 value)
+{
+/* appending an unsigned varint (7 bits per byte, LSB first) */
+    unsigned char tmp[10];
+    int len = 0;
+    while (value >= 0x80)
+      {
+	  tmp[len++] = (unsigned char) ((value & 0x7f) | 0x80);
+	  value >>= 7;
+      }
+    tmp[len++] = (unsigned char) value;
+    columnar_buffer_append (buf, tmp, len);
+}
+
+static void
+columnar_ints_append (struct columnar_ints *array, int value)
+{
+/* appending an INT to a growable array */
+    if (array->count == array->alloc)
+      {
+	  int alloc = (array->alloc == 0) ? 1024 : array->alloc * 2;
+	  array->values = realloc (array->values, sizeof (int) * alloc);
+	  array->alloc = alloc;
+      }
+    array->values[array->count++] = value;
+}
+
+static int
+columnar_column_type (const char *decl_type)
+{
+/* mapping a declared SQL type into a Columnar storage type */
+    char *upper;
+    char *p;
+    int type = SQLITE_TEXT;
+    if (decl_type == NULL)
+	return SQLITE_TEXT;
+    upper = malloc (strlen (decl_type) + 1);
+    strcpy (upper, decl_type);
+    for (p = upper; *p != '\0'; p++)
+      {
+	  if (*p >= 'a' && *p <= 'z')
+	      *p = *p - 'a' + 'A';
+      }
+/* same precedence as the SQLite's own affinity rules */
+    if (strstr (upper, "INT") != NULL)
+	type = SQLITE_INTEGER;
+    else if (strstr (upper, "CHAR") != NULL || strstr (upper, "CLOB") != NULL
+	     || strstr (upper, "TEXT") != NULL)
+	type = SQLITE_TEXT;
+    else if (strstr (upper, "BLOB") != NULL)
+	type = SQLITE_BLOB;
+    else if (strstr (upper, "REAL") != NULL || strstr (upper, "FLOA") != NULL
+	     || strstr (upper, "DOUB") != NULL)
+	type = SQLITE_FLOAT;
+    free (upper);
+    return type;
+}
+
+static struct columnar_chunk *
+create_columnar_chunk (int max_rows, int n_attributes, int compressed,
+		       int precision)
+{
+/* allocating an empty Columnar chunk */
+    int i;
+    struct columnar_chunk *chunk = malloc (sizeof (struct columnar_chunk));
+    chunk->max_rows = max_rows;
+    chunk->n_rows = 0;
+    chunk->srid = 0;
+    chunk->srid_set = 0;
+    chunk->has_z = 0;
+    chunk->has_m = 0;
+    chunk->geom_types = malloc (sizeof (int) * max_rows);
+    chunk->geom_offsets = malloc (sizeof (int) * max_rows);
+    chunk->part_types.values = NULL;
+    chunk->part_types.count = 0;
+    chunk->part_types.alloc = 0;
+    chunk->part_offsets = chunk->part_types;
+    chunk->ring_offsets = chunk->part_types;
+    chunk->coords = NULL;
+    chunk->n_vertices = 0;
+    chunk->alloc_vertices = 0;
+    chunk->n_attributes = n_attributes;
+    chunk->attributes = NULL;
+    if (n_attributes > 0)
+	chunk->attributes =
+	    malloc (sizeof (struct columnar_attribute) * n_attributes);
+    for (i = 0; i < n_attributes; i++)
+      {
+	  struct columnar_attribute *attr = chunk->attributes + i;
+	  attr->name = NULL;
+	  attr->type = SQLITE_TEXT;
+	  attr->validity = malloc ((max_rows + 7) / 8);
+	  memset (attr->validity, 0, (max_rows + 7) / 8);
+	  attr->int_values = NULL;
+	  attr->dbl_values = NULL;
+	  attr->offsets = NULL;
+	  attr->data.buf = NULL;
+	  attr->data.size = 0;
+	  attr->data.alloc = 0;
+	  attr->data.error = 0;
+      }
+    chunk->compressed = compressed;
+    chunk->precision = precision;
+    chunk->endian_arch = gaiaEndianArch ();
+    return chunk;
+}
+
+static void
+destroy_columnar_chunk (struct columnar_chunk *chunk)
+{
+/* memory cleanup - destroying a Columnar chunk */
+    int i;
+    if (chunk == NULL)
+	return;
+    free (chunk->geom_types);
+    free (chunk->geom_offsets);
+    if (chunk->part_types.values != NULL)
+	free (chunk->part_types.values);
+    if (chunk->part_offsets.values != NULL)
+	free (chunk->part_offsets.values);
+    if (chunk->ring_offsets.values != NULL)
+	free (chunk->ring_offsets.values);
+    if (chunk->coords != NULL)
+	free (chunk->coords);
+    for (i = 0; i < chunk->n_attributes; i++)
+      {
+	  struct columnar_attribute *attr = chunk->attributes + i;
+	  if (attr->name != NULL)
+	      free (attr->name);
+	  free (attr->validity);
+	  if (attr->int_values != NULL)
+	      free (attr->int_values);
+	  if (attr->dbl_values != NULL)
+	      free (attr->dbl_values);
+	  if (attr->offsets != NULL)
+	      free (attr->offsets);
+	  if (attr->data.buf != NULL)
+	      free (attr->data.buf);
+      }
+    if (chunk->attributes != NULL)
+	free (chunk->attributes);
+    free (chunk);
+}
+
+static void
+columnar_set_attribute (struct columnar_attribute *attr, const char *name,
+			int type, int max_rows)
+{
+/* defining an attribute column */
+    attr->name = malloc (strlen (name) + 1);
+    strcpy (attr->name, name);
+    attr->type = type;
+    if (type == SQLITE_INTEGER)
+	attr->int_values = malloc (sizeof (sqlite3_int64) * max_rows);
+    else if (type == SQLITE_FLOAT)
+	attr->dbl_values = malloc (sizeof (double) * max_rows);
+    else
+	attr->offsets = malloc (sizeof (int) * max_rows);
+}
+
+static void
+columnar_add_coords (struct columnar_chunk *chunk, double *coords,
+		     int points, int dims)
+{
+/* appending the vertices of a Linestring or Ring (always as XYZM) */
+    int iv;
+    if (chunk->n_vertices + points > chunk->alloc_vertices)
+      {
+	  int alloc =
+	      (chunk->alloc_vertices == 0) ? 4096 : chunk->alloc_vertices;
+	  while (alloc < chunk->n_vertices + points)
+	      alloc *= 2;
+	  chunk->coords = realloc (chunk->coords, sizeof (double) * 4 * alloc);
+	  chunk->alloc_vertices = alloc;
+      }
+    columnar_ints_append (&(chunk->ring_offsets), chunk->n_vertices);
+    for (iv = 0; iv < points; iv++)
+      {
+	  double *out = chunk->coords + (chunk->n_vertices * 4);
+	  double z = 0.0;
+	  double m = 0.0;
+	  if (dims == GAIA_XY_Z)
+	    {
+		gaiaGetPointXYZ (coords, iv, out, &(out[1]), &z);
+	    }
+	  else if (dims == GAIA_XY_M)
+	    {
+		gaiaGetPointXYM (coords, iv, out, &(out[1]), &m);
+	    }
+	  else if (dims == GAIA_XY_Z_M)
+	    {
+		gaiaGetPointXYZM (coords, iv, out, &(out[1]), &z, &m);
+	    }
+	  else
+	    {
+		gaiaGetPoint (coords, iv, out, &(out[1]));
+	    }
+	  out[2] = z;
+	  out[3] = m;
+	  chunk->n_vertices += 1;
+      }
+}
+
+static void
+columnar_add_geometry (struct columnar_chunk *chunk, gaiaGeomCollPtr geom)
+{
+/* appending a Geometry to the current chunk */
+    gaiaPointPtr pt;
+    gaiaLinestringPtr ln;
+    gaiaPolygonPtr pg;
+    int ib;
+    int type;
+    double xyzm[4];
+    int row = chunk->n_rows;
+
+    chunk->geom_offsets[row] = chunk->part_types.count;
+    if (geom == NULL)
+      {
+	  chunk->geom_types[row] = 0;
+	  return;
+      }
+    type = geom->DeclaredType;
+    if (type < GAIA_POINT || type > GAIA_GEOMETRYCOLLECTION)
+	type = GAIA_GEOMETRYCOLLECTION;
+/* ISO-like type codes: +1000 Z, +2000 M, +3000 ZM */
+    chunk->geom_types[row] = type + (1000 * geom->DimensionModel);
+    if (geom->DimensionModel == GAIA_XY_Z
+	|| geom->DimensionModel == GAIA_XY_Z_M)
+	chunk->has_z = 1;
+    if (geom->DimensionModel == GAIA_XY_M
+	|| geom->DimensionModel == GAIA_XY_Z_M)
+	chunk->has_m = 1;
+    if (!(chunk->srid_set))
+      {
+	  chunk->srid = geom->Srid;
+	  chunk->srid_set = 1;
+      }
+
+    pt = geom->FirstPoint;
+    while (pt)
+      {
+	  /* each Point is a Part made of a single one-vertex Ring */
+	  xyzm[0] = pt->X;
+	  xyzm[1] = pt->Y;
+	  xyzm[2] = pt->Z;
+	  xyzm[3] = pt->M;
+	  columnar_ints_append (&(chunk->part_types), GAIA_POINT);
+	  columnar_ints_append (&(chunk->part_offsets),
+				chunk->ring_offsets.count);
+	  columnar_add_coords (chunk, xyzm, 1, GAIA_XY_Z_M);
+	  pt = pt->Next;
+      }
+    ln = geom->FirstLinestring;
+    while (ln)
+      {
+	  columnar_ints_append (&(chunk->part_types), GAIA_LINESTRING);
+	  columnar_ints_append (&(chunk->part_offsets),
+				chunk->ring_offsets.count);
+	  columnar_add_coords (chunk, ln->Coords, ln->Points,
+			       ln->DimensionModel);
+	  ln = ln->Next;
+      }
+    pg = geom->FirstPolygon;
+    while (pg)
+      {
+	  columnar_ints_append (&(chunk->part_types), GAIA_POLYGON);
+	  columnar_ints_append (&(chunk->part_offsets),
+				chunk->ring_offsets.count);
+	  columnar_add_coords (chunk, pg->Exterior->Coords,
+			       pg->Exterior->Points,
+			       pg->Exterior->DimensionModel);
+	  for (ib = 0; ib < pg->NumInteriors; ib++)
+	    {
+		gaiaRingPtr rng = pg->Interiors + ib;
+		columnar_add_coords (chunk, rng->Coords, rng->Points,
+				     rng->DimensionModel);
+	    }
+	  pg = pg->Next;
+      }
+}
+
+static void
+columnar_add_value (struct columnar_attribute *attr, int row,
+		    sqlite3_stmt * stmt, int icol)
+{
+/* appending an attribute value to the current chunk */
+    if (attr->offsets != NULL)
+	attr->offsets[row] = attr->data.size;
+    if (sqlite3_column_type (stmt, icol) == SQLITE_NULL)
+      {
+	  if (attr->int_values != NULL)
+	      attr->int_values[row] = 0;
+	  if (attr->dbl_values != NULL)
+	      attr->dbl_values[row] = 0.0;
+	  return;
+      }
+    attr->validity[row / 8] |= (unsigned char) (1 << (row % 8));
+    switch (attr->type)
+      {
+      case SQLITE_INTEGER:
+	  attr->int_values[row] = sqlite3_column_int64 (stmt, icol);
+	  break;
+      case SQLITE_FLOAT:
+	  attr->dbl_values[row] = sqlite3_column_double (stmt, icol);
+	  break;
+      case SQLITE_BLOB:
+	  columnar_buffer_append (&(attr->data),
+				  sqlite3_column_blob (stmt, icol),
+				  sqlite3_column_bytes (stmt, icol));
+	  break;
+      default:
+	  columnar_buffer_append (&(attr->data),
+				  sqlite3_column_text (stmt, icol),
+				  sqlite3_column_bytes (stmt, icol));
+	  break;
+      };
+}
+
+static int
+columnar_can_quantize (struct columnar_chunk *chunk, double scale)
+{
+/* checking if all coordinates safely fit the quantized INT64 range */
+    int i;
+    int iv;
+    for (iv = 0; iv < chunk->n_vertices; iv++)
+      {
+	  double *xyzm = chunk->coords + (iv * 4);
+	  for (i = 0; i < 4; i++)
+	    {
+		double v = xyzm[i] * scale;
+		if (v != v)
+		    return 0;	/* NaN */
+		if (v > 9.0e15 || v < -9.0e15)
+		    return 0;	/* Infinity or beyond the exact INT range */
+	    }
+      }
+    return 1;
+}
+
+static void
+columnar_write_coords (struct columnar_chunk *chunk,
+		       struct columnar_buffer *payload, int encoding)
+{
+/* 
+/ writing the coordinate array of the current chunk
+/
+/ RAW: X,Y[,Z][,M] interleaved doubles
+/ DELTA: every ordinate is quantized to 10^-precision units and
+/ stored as the zigzag-encoded varint difference from the same
+/ ordinate of the previous vertex (the first vertex of a chunk
+/ being compared against zero)
+*/
+    int iv;
+    int i;
+    int dims[4];
+    int n_dims = 0;
+    sqlite3_int64 prev[4] = { 0, 0, 0, 0 };
+    double scale = pow (10.0, chunk->precision);
+    struct columnar_buffer varints;
+
+    dims[n_dims++] = 0;
+    dims[n_dims++] = 1;
+    if (chunk->has_z)
+	dims[n_dims++] = 2;
+    if (chunk->has_m)
+	dims[n_dims++] = 3;
+
+    if (encoding == GAIA_COLUMNAR_RAW)
+      {
+	  for (iv = 0; iv < chunk->n_vertices; iv++)
+	    {
+		double *xyzm = chunk->coords + (iv * 4);
+		for (i = 0; i < n_dims; i++)
+		    columnar_buffer_double (payload, xyzm[dims[i]],
+					    chunk->endian_arch);
+	    }
+	  return;
+      }
+
+    varints.buf = NULL;
+    varints.size = 0;
+    varints.alloc = 0;
+    varints.error = 0;
+    for (iv = 0; iv < chunk->n_vertices; iv++)
+      {
+	  double *xyzm = chunk->coords + (iv * 4);
+	  for (i = 0; i < n_dims; i++)
+	    {
+		sqlite3_int64 q =
+		    (sqlite3_int64) floor (xyzm[dims[i]] * scale + 0.5);
+		sqlite3_int64 delta = q - prev[i];
+		sqlite3_uint64 zigzag =
+		    ((sqlite3_uint64) delta << 1) ^ (sqlite3_uint64) (delta >>
+								      63);
+		columnar_buffer_varint (&varints, zigzag);
+		prev[i] = q;
+	    }
+      }
+    if (varints.error)
+	payload->error = 1;
+    columnar_buffer_int32 (payload, varints.size, chunk->endian_arch);
+    columnar_buffer_append (payload, varints.buf, varints.size);
+    if (varints.buf != NULL)
+	free (varints.buf);
+}
+
+static int
+flush_columnar_chunk (FILE * out, struct columnar_chunk *chunk)
+{
+/* writing the current chunk into the Columnar file */
+    int i;
+    int row;
+    int encoding = GAIA_COLUMNAR_RAW;
+    int endian_arch = chunk->endian_arch;
+    unsigned char header[24];
+    struct columnar_buffer payload;
+
+    if (chunk->n_rows == 0)
+	return 1;
+    if (chunk->compressed
+	&& columnar_can_quantize (chunk, pow (10.0, chunk->precision)))
+	encoding = GAIA_COLUMNAR_DELTA;
+
+    payload.buf = NULL;
+    payload.size = 0;
+    payload.alloc = 0;
+    payload.error = 0;
+/* Geometries: types and offsets */
+    for (row = 0; row < chunk->n_rows; row++)
+	columnar_buffer_int32 (&payload, chunk->geom_types[row], endian_arch);
+    columnar_buffer_int32 (&payload, chunk->part_types.count, endian_arch);
+    columnar_buffer_int32 (&payload, chunk->ring_offsets.count, endian_arch);
+    columnar_buffer_int32 (&payload, chunk->n_vertices, endian_arch);
+    for (row = 0; row < chunk->n_rows; row++)
+	columnar_buffer_int32 (&payload, chunk->geom_offsets[row],
+			       endian_arch);
+    columnar_buffer_int32 (&payload, chunk->part_types.count, endian_arch);
+    for (i = 0; i < chunk->part_types.count; i++)
+	columnar_buffer_int32 (&payload, chunk->part_types.values[i],
+			       endian_arch);
+    for (i = 0; i < chunk->part_offsets.count; i++)
+	columnar_buffer_int32 (&payload, chunk->part_offsets.values[i],
+			       endian_arch);
+    columnar_buffer_int32 (&payload, chunk->ring_offsets.count, endian_arch);
+    for (i = 0; i < chunk->ring_offsets.count; i++)
+	columnar_buffer_int32 (&payload, chunk->ring_offsets.values[i],
+			       endian_arch);
+    columnar_buffer_int32 (&payload, chunk->n_vertices, endian_arch);
+/* Geometries: coordinates */
+    columnar_write_coords (chunk, &payload, encoding);
+/* attribute columns */
+    for (i = 0; i < chunk->n_attributes; i++)
+      {
+	  struct columnar_attribute *attr = chunk->attributes + i;
+	  columnar_buffer_append (&payload, attr->validity,
+				  (chunk->n_rows + 7) / 8);
+	  for (row = 0; row < chunk->n_rows; row++)
+	    {
+		if (attr->type == SQLITE_INTEGER)
+		    columnar_buffer_int64 (&payload, attr->int_values[row],
+					   endian_arch);
+		else if (attr->type == SQLITE_FLOAT)
+		    columnar_buffer_double (&payload, attr->dbl_values[row],
+					    endian_arch);
+		else
+		    columnar_buffer_int32 (&payload, attr->offsets[row],
+					   endian_arch);
+	    }
+	  if (attr->type == SQLITE_TEXT || attr->type == SQLITE_BLOB)
+	    {
+		if (attr->data.size > 0x7fffffff)
+		    payload.error = 1;	/* offsets are 32 bit INTs */
+		columnar_buffer_int32 (&payload, attr->data.size, endian_arch);
+		columnar_buffer_append (&payload, attr->data.buf,
+					attr->data.size);
+		if (attr->data.error)
+		    payload.error = 1;
+	    }
+      }
+    if (payload.error)
+	goto error;
+
+/* chunk header */
+    header[0] = GAIA_COLUMNAR_CHUNK;
+    gaiaExport32 (header + 1, chunk->n_rows, 1, endian_arch);
+    gaiaExport32 (header + 5, chunk->srid, 1, endian_arch);
+    header[9] = (unsigned char) chunk->has_z;
+    header[10] = (unsigned char) chunk->has_m;
+    header[11] = (unsigned char) encoding;
+    gaiaExport32 (header + 12, chunk->precision, 1, endian_arch);
+    gaiaExportI64 (header + 16, payload.size, 1, endian_arch);
+    if (fwrite (header, 1, 24, out) != 24)
+	goto error;
+    if (fwrite (payload.buf, 1, payload.size, out) != payload.size)
+	goto error;
+    free (payload.buf);
+
+/* resetting the chunk */
+    chunk->n_rows = 0;
+    chunk->srid = 0;
+    chunk->srid_set = 0;
+    chunk->has_z = 0;
+    chunk->has_m = 0;
+    chunk->part_types.count = 0;
+    chunk->part_offsets.count = 0;
+    chunk->ring_offsets.count = 0;
+    chunk->n_vertices = 0;
+    for (i = 0; i < chunk->n_attributes; i++)
+      {
+	  struct columnar_attribute *attr = chunk->attributes + i;
+	  memset (attr->validity, 0, (chunk->max_rows + 7) / 8);
+	  attr->data.size = 0;
+      }
+    return 1;
+
+  error:
+    if (payload.buf != NULL)
+	free (payload.buf);
+    return 0;
+}
+
+static int
+columnar_write_header (FILE * out, struct columnar_chunk *chunk,
+		       const char *geom_col)
+{
+/* writing the Columnar file header */
+    int i;
+    int len;
+    int ok;
+    unsigned char type;
+    struct columnar_buffer header;
+    header.buf = NULL;
+    header.size = 0;
+    header.alloc = 0;
+    header.error = 0;
+    columnar_buffer_append (&header, GAIA_COLUMNAR_SIGNATURE, 8);
+    columnar_buffer_int32 (&header, chunk->n_attributes, chunk->endian_arch);
+    len = strlen (geom_col);
+    columnar_buffer_int32 (&header, len, chunk->endian_arch);
+    columnar_buffer_append (&header, geom_col, len);
+    for (i = 0; i < chunk->n_attributes; i++)
+      {
+	  struct columnar_attribute *attr = chunk->attributes + i;
+	  type = (unsigned char) attr->type;
+	  columnar_buffer_append (&header, &type, 1);
+	  len = strlen (attr->name);
+	  columnar_buffer_int32 (&header, len, chunk->endian_arch);
+	  columnar_buffer_append (&header, attr->name, len);
+      }
+    ok = 0;
+    if (!header.error)
+      {
+	  if (fwrite (header.buf, 1, header.size, out) == header.size)
+	      ok = 1;
+      }
+    if (header.buf != NULL)
+	free (header.buf);
+    return ok;
+}
+
+static int
+columnar_count_attributes (sqlite3 * sqlite, const char *table,
+			   const char *geom_col, int *geom_found)
+{
+/* counting the attribute columns of the table to be exported */
+    char *sql;
+    char *xtable;
+    int ret;
+    int i;
+    char **results;
+    int rows;
+    int columns;
+    int count = 0;
+
+    *geom_found = 0;
+    xtable = gaiaDoubleQuotedSql (table);
+    sql = sqlite3_mprintf ("PRAGMA table_info(\"%s\")", xtable);
+    free (xtable);
+    ret = sqlite3_get_table (sqlite, sql, &results, &rows, &columns, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return -1;
+    for (i = 1; i <= rows; i++)
+      {
+	  const char *name = results[(i * columns) + 1];
+	  if (strcasecmp (name, geom_col) == 0)
+	      *geom_found = 1;
+	  else
+	      count++;
+      }
+    sqlite3_free_table (results);
+    return count;
+}
+
+static char *
+columnar_prepare_attributes (sqlite3 * sqlite, const char *table,
+			     const char *geom_col,
+			     struct columnar_chunk *chunk)
+{
+/* defining all attribute columns and building the SELECT statement */
+    char *sql;
+    char *prev;
+    char *xtable;
+    char *xname;
+    int ret;
+    int i;
+    char **results;
+    int rows;
+    int columns;
+    int icol = 0;
+
+    xtable = gaiaDoubleQuotedSql (table);
+    sql = sqlite3_mprintf ("PRAGMA table_info(\"%s\")", xtable);
+    ret = sqlite3_get_table (sqlite, sql, &results, &rows, &columns, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  free (xtable);
+	  return NULL;
+      }
+    xname = gaiaDoubleQuotedSql (geom_col);
+    sql = sqlite3_mprintf ("SELECT \"%s\"", xname);
+    free (xname);
+    for (i = 1; i <= rows; i++)
+      {
+	  const char *name = results[(i * columns) + 1];
+	  const char *decl_type = results[(i * columns) + 2];
+	  if (strcasecmp (name, geom_col) == 0)
+	      continue;
+	  if (icol >= chunk->n_attributes)
+	      break;
+	  columnar_set_attribute (chunk->attributes + icol, name,
+				  columnar_column_type (decl_type),
+				  chunk->max_rows);
+	  xname = gaiaDoubleQuotedSql (name);
+	  prev = sql;
+	  sql = sqlite3_mprintf ("%s, \"%s\"", prev, xname);
+	  sqlite3_free (prev);
+	  free (xname);
+	  icol++;
+      }
+    sqlite3_free_table (results);
+    prev = sql;
+    sql = sqlite3_mprintf ("%s FROM \"%s\"", prev, xtable);
+    sqlite3_free (prev);
+    free (xtable);
+    return sql;
+}
+
+SPATIALITE_DECLARE int
+dump_columnar (sqlite3 * sqlite, char *table, char *geom_col,
+	       char *outfile_path, int compressed, int precision,
+	       int chunk_rows, int *xrows)
+{
+/* dumping a geometry table as a chunked Columnar file */
+    char *sql = NULL;
+    sqlite3_stmt *stmt = NULL;
+    FILE *out = NULL;
+    struct columnar_chunk *chunk = NULL;
+    int n_attributes;
+    int geom_found;
+    int ret;
+    int i;
+    int rows = 0;
+    unsigned char trailer[9];
+
+    *xrows = -1;
+    if (chunk_rows <= 0)
+	chunk_rows = COLUMNAR_CHUNK_ROWS;
+    if (precision < 0)
+	precision = 0;
+    if (precision > 15)
+	precision = 15;
+    n_attributes =
+	columnar_count_attributes (sqlite, table, geom_col, &geom_found);
+    if (n_attributes < 0 || !geom_found)
+      {
+	  spatialite_e
+	      ("Dump Columnar error: table \"%s\" has no column \"%s\"\n",
+	       table, geom_col);
+	  return 0;
+      }
+    chunk =
+	create_columnar_chunk (chunk_rows, n_attributes, compressed,
+			       precision);
+    sql = columnar_prepare_attributes (sqlite, table, geom_col, chunk);
+    if (sql == NULL)
+	goto sql_error;
+    ret = sqlite3_prepare_v2 (sqlite, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto sql_error;
+
+/* opening/creating the Columnar output file */
+#ifdef _WIN32
+    out = gaia_win_fopen (outfile_path, "wb");
+#else
+    out = fopen (outfile_path, "wb");
+#endif
+    if (!out)
+	goto no_file;
+    if (!columnar_write_header (out, chunk, geom_col))
+	goto write_error;
+
+    while (1)
+      {
+	  /* scrolling the result set */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret == SQLITE_ROW)
+	    {
+		gaiaGeomCollPtr geom = NULL;
+		if (sqlite3_column_type (stmt, 0) == SQLITE_BLOB)
+		    geom =
+			gaiaFromSpatiaLiteBlobWkb (sqlite3_column_blob
+						   (stmt, 0),
+						   sqlite3_column_bytes (stmt,
+									 0));
+		columnar_add_geometry (chunk, geom);
+		if (geom != NULL)
+		    gaiaFreeGeomColl (geom);
+		for (i = 0; i < n_attributes; i++)
+		    columnar_add_value (chunk->attributes + i, chunk->n_rows,
+					stmt, i + 1);
+		chunk->n_rows += 1;
+		rows++;
+		if (chunk->n_rows == chunk->max_rows)
+		  {
+		      if (!flush_columnar_chunk (out, chunk))
+			  goto write_error;
+		  }
+	    }
+	  else
+	      goto sql_error;
+      }
+    if (!flush_columnar_chunk (out, chunk))
+	goto write_error;
+/* the trailer: END marker and total number of rows */
+    trailer[0] = GAIA_COLUMNAR_END;
+    gaiaExportI64 (trailer + 1, rows, 1, chunk->endian_arch);
+    if (fwrite (trailer, 1, 9, out) != 9)
+	goto write_error;
+
+    sqlite3_finalize (stmt);
+    destroy_columnar_chunk (chunk);
+    if (fclose (out) != 0)
+      {
+	  spatialite_e ("Dump Columnar error: unable to write '%s'\n",
+			outfile_path);
+	  return 0;
+      }
+    *xrows = rows;
+    return 1;
+
+  sql_error:
+/* an SQL error occurred */
+    if (stmt)
+	sqlite3_finalize (stmt);
+    if (out)
+	fclose (out);
+    destroy_columnar_chunk (chunk);
+    spatialite_e ("Dump Columnar error: %s\n", sqlite3_errmsg (sqlite));
+    return 0;
+
+  write_error:
+/* Output file could not be written */
+    if (stmt)
+	sqlite3_finalize (stmt);
+    if (out)
+	fclose (out);
+    destroy_columnar_chunk (chunk);
+    spatialite_e ("Dump Columnar error: unable to write '%s'\n",
+		  outfile_path);
+    return 0;
+
+  no_file:
+/* Output file could not be created / opened */
+    if (stmt)
+	sqlite3_finalize (stmt);
+    destroy_columnar_chunk (chunk);
+    spatialite_e ("ERROR: unable to open '%s' for writing\n", outfile_path);
+    return 0;
+}
+
 static int
 do_check_geometry (sqlite3 * sqlite, const char *table, const char *geom_col,
 		   char **geoname, int *srid, int *dims)
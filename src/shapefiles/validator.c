@@ -2010,8 +2010,8 @@ sanitize_geometry_column_common (const void *p_cache, sqlite3 * sqlite,
 			    gaiaGeomCollPtr discarded;
 			    report->n_invalids += 1;
 			    gaiaResetRtTopoMsg (p_cache);
-			    repaired = gaiaMakeValid (p_cache, geom);
-			    discarded = gaiaMakeValidDiscarded (p_cache, geom);
+			    repaired =
+				gaiaMakeValidEx (p_cache, geom, &discarded);
 			    error = gaiaGetRtTopoErrorMsg (p_cache);
 			    warning = gaiaGetRtTopoWarningMsg (p_cache);
 			    if (discarded == NULL)
@@ -2049,13 +2049,521 @@ output_node (unsigned char *auxbuf, int *size, int index, int has_ids,
     return 1;
 }
 
+static int
+do_check_aux_table (sqlite3 * db_handle, const void *cache,
+		    const char *table, const char *title, const char *col1,
+		    const char *col2, const char *col3)
+{
+/* testing if some auxiliary table exists and it's correctly defined */
+    char *xtable;
+    char *sql;
+    int ret;
+    int i;
+    char **results;
+    int rows;
+    int columns;
+    int ok_col1 = 0;
+    int ok_col2 = 0;
+    int ok_col3 = 0;
+    const char *missing = NULL;
+
+    xtable = gaiaDoubleQuotedSql (table);
+    sql = sqlite3_mprintf ("PRAGMA table_info(\"%s\")", xtable);
+    free (xtable);
+    ret = sqlite3_get_table (db_handle, sql, &results, &rows, &columns, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  char *msg =
+	      sqlite3_mprintf ("SQL error: %s", sqlite3_errmsg (db_handle));
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  return 0;
+      }
+    for (i = 1; i <= rows; i++)
+      {
+	  const char *col = results[(i * columns) + 1];
+	  if (strcasecmp (col, col1) == 0)
+	      ok_col1 = 1;
+	  if (strcasecmp (col, col2) == 0)
+	      ok_col2 = 1;
+	  if (strcasecmp (col, col3) == 0)
+	      ok_col3 = 1;
+      }
+    sqlite3_free_table (results);
+
+    if (rows < 1)
+      {
+	  char *msg = sqlite3_mprintf ("%s \"%s\" does not exist", title,
+				       table);
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  return 0;
+      }
+    if (!ok_col1)
+	missing = col1;
+    else if (!ok_col2)
+	missing = col2;
+    else if (!ok_col3)
+	missing = col3;
+    if (missing != NULL)
+      {
+	  char *msg =
+	      sqlite3_mprintf ("Column \"%s\" is not defined in the %s", missing,
+			       title);
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+do_check_aux_values (sqlite3 * db_handle, const void *cache, const char *sql,
+		     const char *what)
+{
+/* 
+executing a validation query: any returned row will 
+be reported as an invalid item 
+*/
+    sqlite3_stmt *stmt = NULL;
+    int ret;
+    int valid = 1;
+    ret = sqlite3_prepare_v2 (db_handle, sql, strlen (sql), &stmt, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  char *msg =
+	      sqlite3_mprintf ("SQL error: %s", sqlite3_errmsg (db_handle));
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  return 0;
+      }
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_ROW)
+      {
+	  char *msg =
+	      sqlite3_mprintf ("%s (Link " FRMT64 "): %s",
+			       what, sqlite3_column_int64 (stmt, 0),
+			       (const char *) sqlite3_column_text (stmt, 1));
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  valid = 0;
+      }
+    else if (ret != SQLITE_DONE)
+      {
+	  char *msg =
+	      sqlite3_mprintf ("SQL error: %s", sqlite3_errmsg (db_handle));
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  valid = 0;
+      }
+    sqlite3_finalize (stmt);
+    return valid;
+}
+
+static int
+do_check_profile_table (sqlite3 * db_handle, const void *cache,
+			const char *profile_table)
+{
+/* testing if the Speed Profile Table is correctly defined */
+    char *xtable;
+    char *sql;
+    int ret;
+    if (!do_check_aux_table
+	(db_handle, cache, profile_table, "Speed Profile Table", "link_id",
+	 "hour", "factor"))
+	return 0;
+    xtable = gaiaDoubleQuotedSql (profile_table);
+    sql =
+	sqlite3_mprintf ("SELECT link_id, CASE "
+			 "WHEN link_id IS NULL OR link_id NOT IN "
+			 "(SELECT rowid FROM create_routing_links) "
+			 "THEN 'not found in the Input Table' "
+			 "WHEN typeof(hour) <> 'integer' OR hour < 0 OR hour > 23 "
+			 "THEN 'Hour should be an INTEGER between 0 and 23' "
+			 "ELSE 'Factor should be a positive number' END "
+			 "FROM \"%s\" WHERE link_id IS NULL OR link_id NOT IN "
+			 "(SELECT rowid FROM create_routing_links) "
+			 "OR typeof(hour) <> 'integer' OR hour < 0 OR hour > 23 "
+			 "OR typeof(factor) NOT IN ('integer', 'real') "
+			 "OR factor <= 0.0", xtable);
+    free (xtable);
+    ret = do_check_aux_values (db_handle, cache, sql, "invalid Speed Profile");
+    sqlite3_free (sql);
+    return ret;
+}
+
+static int
+do_check_restriction_table (sqlite3 * db_handle, const void *cache,
+			    const char *restriction_table)
+{
+/* testing if the Turn Restriction Table is correctly defined */
+    char *xtable;
+    char *sql;
+    int ret;
+    if (!do_check_aux_table
+	(db_handle, cache, restriction_table, "Turn Restriction Table",
+	 "from_link", "to_link", "penalty"))
+	return 0;
+    xtable = gaiaDoubleQuotedSql (restriction_table);
+    sql =
+	sqlite3_mprintf ("SELECT from_link, CASE "
+			 "WHEN from_link IS NULL OR from_link NOT IN "
+			 "(SELECT rowid FROM create_routing_links) "
+			 "THEN 'FromLink not found in the Input Table' "
+			 "WHEN to_link IS NULL OR to_link NOT IN "
+			 "(SELECT rowid FROM create_routing_links) "
+			 "THEN 'ToLink not found in the Input Table' "
+			 "ELSE 'Penalty should be NULL or a non-negative number' END "
+			 "FROM \"%s\" WHERE from_link IS NULL OR from_link NOT IN "
+			 "(SELECT rowid FROM create_routing_links) "
+			 "OR to_link IS NULL "
+			 "OR to_link NOT IN (SELECT rowid FROM create_routing_links) "
+			 "OR (penalty IS NOT NULL AND "
+			 "(typeof(penalty) NOT IN ('integer', 'real') OR penalty < 0.0))",
+			 xtable);
+    free (xtable);
+    ret =
+	do_check_aux_values (db_handle, cache, sql, "invalid Turn Restriction");
+    sqlite3_free (sql);
+    return ret;
+}
+
+static int
+do_insert_block (sqlite3 * db_handle, const void *cache,
+		 sqlite3_stmt * stmt_out, const unsigned char *buf, int size)
+{
+/* inserting a further data block into the NETWORK-DATA table */
+    int ret;
+    sqlite3_reset (stmt_out);
+    sqlite3_clear_bindings (stmt_out);
+    sqlite3_bind_null (stmt_out, 1);
+    sqlite3_bind_blob (stmt_out, 2, buf, size, SQLITE_STATIC);
+    ret = sqlite3_step (stmt_out);
+    if (ret == SQLITE_DONE || ret == SQLITE_ROW)
+	return 1;
+    else
+      {
+	  char *msg =
+	      sqlite3_mprintf ("SQL error: %s", sqlite3_errmsg (db_handle));
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  return 0;
+      }
+}
+
+struct link_profile
+{
+/* the hour-of-day Speed Profile of some Link */
+    sqlite3_int64 rowid;
+    double factors[24];
+};
+
+static int
+cmp_link_profiles (const void *p1, const void *p2)
+{
+/* sorting Link Profiles by Factors, then by Link ROWID */
+    int i;
+    const struct link_profile *lp1 = (const struct link_profile *) p1;
+    const struct link_profile *lp2 = (const struct link_profile *) p2;
+    for (i = 0; i < 24; i++)
+      {
+	  if (lp1->factors[i] < lp2->factors[i])
+	      return -1;
+	  if (lp1->factors[i] > lp2->factors[i])
+	      return 1;
+      }
+    if (lp1->rowid < lp2->rowid)
+	return -1;
+    if (lp1->rowid > lp2->rowid)
+	return 1;
+    return 0;
+}
+
+static int
+same_link_profile (const struct link_profile *lp1,
+		   const struct link_profile *lp2)
+{
+/* testing if two Links share the same Speed Profile */
+    int i;
+    for (i = 0; i < 24; i++)
+      {
+	  if (lp1->factors[i] != lp2->factors[i])
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+do_output_profiles (sqlite3 * db_handle, const void *cache,
+		    sqlite3_stmt * stmt_out, unsigned char *buf,
+		    const char *profile_table, int endian_arch)
+{
+/* 
+exporting the hour-of-day Speed Profiles into NETWORK-DATA
+
+any distinct Profile is stored just once, followed by the
+ROWIDs of all Links sharing it; hours lacking any explicit
+Factor will default to 1.0 (= the static Link Cost)
+*/
+    char *xtable;
+    char *sql;
+    int ret;
+    int i;
+    int h;
+    sqlite3_stmt *stmt = NULL;
+    struct link_profile *profiles = NULL;
+    struct link_profile *lp = NULL;
+    int count = 0;
+    int max_count = 1024;
+    int max_links = (MAX_BLOCK - (1 + (24 * 8) + 4 + 1)) / 8;
+    int links;
+    unsigned char *out;
+    unsigned char *p_links = NULL;
+    int error = 0;
+
+    xtable = gaiaDoubleQuotedSql (profile_table);
+    sql =
+	sqlite3_mprintf
+	("SELECT link_id, hour, factor FROM \"%s\" ORDER BY link_id, hour",
+	 xtable);
+    free (xtable);
+    ret = sqlite3_prepare_v2 (db_handle, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  char *msg =
+	      sqlite3_mprintf ("SQL error: %s", sqlite3_errmsg (db_handle));
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  return 0;
+      }
+    profiles = malloc (sizeof (struct link_profile) * max_count);
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret == SQLITE_ROW)
+	    {
+		sqlite3_int64 rowid = sqlite3_column_int64 (stmt, 0);
+		int hour = sqlite3_column_int (stmt, 1);
+		double factor = sqlite3_column_double (stmt, 2);
+		if (lp == NULL || lp->rowid != rowid)
+		  {
+		      /* starting a new Link Profile */
+		      if (count == max_count)
+			{
+			    max_count *= 2;
+			    profiles =
+				realloc (profiles,
+					 sizeof (struct link_profile) *
+					 max_count);
+			}
+		      lp = profiles + count++;
+		      lp->rowid = rowid;
+		      for (h = 0; h < 24; h++)
+			  lp->factors[h] = 1.0;
+		  }
+		lp->factors[hour] = factor;
+	    }
+	  else
+	    {
+		char *msg =
+		    sqlite3_mprintf ("SQL error: %s",
+				     sqlite3_errmsg (db_handle));
+		gaia_create_routing_set_error (cache, msg);
+		sqlite3_free (msg);
+		error = 1;
+		goto stop;
+	    }
+      }
+
+/* grouping together all Links sharing the same Profile */
+    qsort (profiles, count, sizeof (struct link_profile), cmp_link_profiles);
+    links = 0;
+    out = buf;
+    for (i = 0; i < count; i++)
+      {
+	  lp = profiles + i;
+	  if (links > 0
+	      && (links == max_links || !same_link_profile (lp - 1, lp)))
+	    {
+		/* inserting the completed Profile block */
+		gaiaExport32 (p_links, links, 1, endian_arch);
+		*out++ = GAIA_NET_END;
+		if (!do_insert_block
+		    (db_handle, cache, stmt_out, buf, out - buf))
+		  {
+		      error = 1;
+		      goto stop;
+		  }
+		links = 0;
+	    }
+	  if (links == 0)
+	    {
+		/* preparing a new Profile block */
+		out = buf;
+		*out++ = GAIA_NET_PROFILE;
+		for (h = 0; h < 24; h++)
+		  {
+		      gaiaExport64 (out, lp->factors[h], 1, endian_arch);
+		      out += 8;
+		  }
+		p_links = out;	/* how many Links share this Profile */
+		out += 4;
+	    }
+	  gaiaExportI64 (out, lp->rowid, 1, endian_arch);	/* the Link ROWID */
+	  out += 8;
+	  links++;
+      }
+    if (links > 0)
+      {
+	  /* inserting the last Profile block */
+	  gaiaExport32 (p_links, links, 1, endian_arch);
+	  *out++ = GAIA_NET_END;
+	  if (!do_insert_block (db_handle, cache, stmt_out, buf, out - buf))
+	      error = 1;
+      }
+
+  stop:
+    if (profiles != NULL)
+	free (profiles);
+    sqlite3_finalize (stmt);
+    return error ? 0 : 1;
+}
+
+static int
+do_output_turns (sqlite3 * db_handle, const void *cache,
+		 sqlite3_stmt * stmt_out, unsigned char *buf,
+		 const char *restriction_table, int endian_arch)
+{
+/* 
+exporting the Turn Restrictions into NETWORK-DATA
+
+each Turn is bound to the Node shared by its FromLink
+and ToLink: a Turn never connecting the two Links in
+some allowed direction will be simply ignored;
+a NULL Penalty always marks a forbidden Turn
+*/
+    char *xtable;
+    char *sql;
+    int ret;
+    sqlite3_stmt *stmt = NULL;
+    int max_turns = (MAX_BLOCK - (1 + 4 + 1)) / (4 + 8 + 8 + 8);
+    int turns = 0;
+    unsigned char *out = buf;
+    int error = 0;
+
+    sql =
+	"CREATE INDEX idx_create_routing_rowid ON create_routing_links (rowid)";
+    ret = sqlite3_exec (db_handle, sql, NULL, NULL, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  char *msg =
+	      sqlite3_mprintf ("SQL error: %s", sqlite3_errmsg (db_handle));
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  return 0;
+      }
+    xtable = gaiaDoubleQuotedSql (restriction_table);
+    sql =
+	sqlite3_mprintf
+	("SELECT DISTINCT a.index_to, t.from_link, t.to_link, t.penalty "
+	 "FROM \"%s\" AS t "
+	 "JOIN create_routing_links AS a ON (a.rowid = t.from_link) "
+	 "JOIN create_routing_links AS b ON (b.rowid = t.to_link "
+	 "AND b.index_from = a.index_to) "
+	 "ORDER BY a.index_to, t.from_link, t.to_link", xtable);
+    free (xtable);
+    ret = sqlite3_prepare_v2 (db_handle, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  char *msg =
+	      sqlite3_mprintf ("SQL error: %s", sqlite3_errmsg (db_handle));
+	  gaia_create_routing_set_error (cache, msg);
+	  sqlite3_free (msg);
+	  return 0;
+      }
+    while (1)
+      {
+	  /* scrolling the result set rows */
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;		/* end of result set */
+	  if (ret == SQLITE_ROW)
+	    {
+		int index = sqlite3_column_int (stmt, 0);
+		sqlite3_int64 from_link = sqlite3_column_int64 (stmt, 1);
+		sqlite3_int64 to_link = sqlite3_column_int64 (stmt, 2);
+		double penalty = DBL_MAX;	/* forbidden Turn */
+		if (sqlite3_column_type (stmt, 3) != SQLITE_NULL)
+		    penalty = sqlite3_column_double (stmt, 3);
+		if (turns == max_turns)
+		  {
+		      /* inserting the completed Turns block */
+		      gaiaExport32 (buf + 1, turns, 1, endian_arch);
+		      *out++ = GAIA_NET_END;
+		      if (!do_insert_block
+			  (db_handle, cache, stmt_out, buf, out - buf))
+			{
+			    error = 1;
+			    goto stop;
+			}
+		      turns = 0;
+		  }
+		if (turns == 0)
+		  {
+		      /* preparing a new Turns block */
+		      out = buf;
+		      *out++ = GAIA_NET_TURN;
+		      out += 4;	/* how many Turns are into this block */
+		  }
+		gaiaExport32 (out, index, 1, endian_arch);	/* the Node internal index */
+		out += 4;
+		gaiaExportI64 (out, from_link, 1, endian_arch);	/* the FromLink ROWID */
+		out += 8;
+		gaiaExportI64 (out, to_link, 1, endian_arch);	/* the ToLink ROWID */
+		out += 8;
+		gaiaExport64 (out, penalty, 1, endian_arch);	/* the Turn Penalty */
+		out += 8;
+		turns++;
+	    }
+	  else
+	    {
+		char *msg =
+		    sqlite3_mprintf ("SQL error: %s",
+				     sqlite3_errmsg (db_handle));
+		gaia_create_routing_set_error (cache, msg);
+		sqlite3_free (msg);
+		error = 1;
+		goto stop;
+	    }
+      }
+    if (turns > 0)
+      {
+	  /* inserting the last Turns block */
+	  gaiaExport32 (buf + 1, turns, 1, endian_arch);
+	  *out++ = GAIA_NET_END;
+	  if (!do_insert_block (db_handle, cache, stmt_out, buf, out - buf))
+	      error = 1;
+      }
+
+  stop:
+    sqlite3_finalize (stmt);
+    return error ? 0 : 1;
+}
+
 static int
 do_create_data (sqlite3 * db_handle, const void *cache,
 		const char *output_table, const char *input_table,
 		const char *from_column, const char *to_column,
 		const char *geom_column, const char *name_column,
 		int a_star_enabled, double a_star_coeff, int has_ids,
-		int n_nodes, int max_code_length)
+		int n_nodes, int max_code_length, const char *profile_table,
+		const char *restriction_table)
 {
 /* creating and populating the Routing Data table */
     char *sql;
@@ -2290,6 +2798,28 @@ do_create_data (sqlite3 * db_handle, const void *cache,
 	    }
       }
 
+    if (profile_table != NULL)
+      {
+	  /* inserting the Speed Profile blocks */
+	  if (!do_output_profiles
+	      (db_handle, cache, stmt_out, buf, profile_table, endian_arch))
+	    {
+		error = 1;
+		goto error;
+	    }
+      }
+    if (restriction_table != NULL)
+      {
+	  /* inserting the Turn Restriction blocks */
+	  if (!do_output_turns
+	      (db_handle, cache, stmt_out, buf, restriction_table,
+	       endian_arch))
+	    {
+		error = 1;
+		goto error;
+	    }
+      }
+
   error:
     if (auxbuf != NULL)
 	free (auxbuf);
@@ -3091,6 +3621,37 @@ gaia_create_routing (sqlite3 * db_handle,
 		     const char *oneway_to, int overwrite)
 {
 /* attempting to create a VirtualRouting from an input table */
+    return gaia_create_routing_ex (db_handle, cache, routing_data_table,
+				   virtual_routing_table, input_table,
+				   from_column, to_column, geom_column,
+				   cost_column, name_column, a_star_enabled,
+				   bidirectional, oneway_from, oneway_to,
+				   overwrite, NULL, NULL);
+}
+
+SPATIALITE_DECLARE int
+gaia_create_routing_ex (sqlite3 * db_handle,
+			const void *cache,
+			const char *routing_data_table,
+			const char
+			*virtual_routing_table,
+			const char *input_table,
+			const char *from_column,
+			const char *to_column,
+			const char *geom_column,
+			const char *cost_column,
+			const char *name_column,
+			int a_star_enabled,
+			int bidirectional,
+			const char *oneway_from,
+			const char *oneway_to, int overwrite,
+			const char *profile_table,
+			const char *restriction_table)
+{
+/* 
+attempting to create a VirtualRouting from an input table,
+optionally supporting Speed Profiles and Turn Restrictions
+*/
     int has_ids;
     int n_nodes = 0;
     int max_code_length = 0;
@@ -3208,11 +3769,24 @@ gaia_create_routing (sqlite3 * db_handle,
 	 bidirectional, &has_ids, &n_nodes, &max_code_length, &a_star_coeff))
 	return 0;
 
+/* testing the optional Speed Profile and Turn Restriction tables */
+    if (profile_table != NULL)
+      {
+	  if (!do_check_profile_table (db_handle, cache, profile_table))
+	      return 0;
+      }
+    if (restriction_table != NULL)
+      {
+	  if (!do_check_restriction_table
+	      (db_handle, cache, restriction_table))
+	      return 0;
+      }
+
 /* creating and populating the Routing Data table */
     if (!do_create_data
 	(db_handle, cache, routing_data_table, input_table, from_column,
 	 to_column, geom_column, name_column, a_star_enabled, a_star_coeff,
-	 has_ids, n_nodes, max_code_length))
+	 has_ids, n_nodes, max_code_length, profile_table, restriction_table))
 	return 0;
 
 /* creating the VirtualRouting table */
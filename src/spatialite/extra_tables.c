@@ -2176,6 +2176,10 @@ createRasterCoveragesTable (void *p_sqlite)
 	  goto error;
       }
 
+/* lazily initialized MetaData: creating the advanced tables */
+    if (!createAdvancedMetaDataOnDemand (sqlite))
+	goto error;
+
 /* creating the main RasterCoverages table */
     if (!create_raster_coverages (sqlite))
 	goto error;
@@ -2973,6 +2977,10 @@ createVectorCoveragesTable (void *p_sqlite)
 	  goto error;
       }
 
+/* lazily initialized MetaData: creating the advanced tables */
+    if (!createAdvancedMetaDataOnDemand (sqlite))
+	goto error;
+
 /* creating the main VectorCoverages table and triggers */
     if (!create_vector_coverages (sqlite))
 	goto error;
@@ -3279,6 +3287,10 @@ createWMSTables (void *p_sqlite)
 	  goto error;
       }
 
+/* lazily initialized MetaData: creating the advanced tables */
+    if (!createAdvancedMetaDataOnDemand (sqlite))
+	goto error;
+
 /* creating the WMS support tables */
     if (!create_wms_tables (sqlite))
 	goto error;
@@ -55,6 +55,12 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "config.h"
 #endif
 
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
 #include <spatialite/sqlite.h>
 #include <spatialite/debug.h>
 
@@ -172,8 +178,68 @@ implemented as a cache pages linked list
  pointer used to identify the current cache page when inserting a new cache cell
  */
     struct mbr_cache_page *current;
+/* number of allocated cache pages */
+    int n_pages;
+};
+
+struct mbr_cache_entry
+{
+/*
+a process-wide registered MBR's cache
+
+any MbrCache sharing the same database file, table and column 
+will share the same entry, so that the MBRs are loaded only once
+caches based on a MEMORY or TEMP database are never shared
+*/
+    char *db_path;		/* the database file - NULL if private */
+    sqlite3 *owner;		/* the owning connection - private only */
+    char *table_name;
+    char *column_name;
+    struct mbr_cache *cache;	/* the MBR's cache - lazily loaded */
+    int ref_count;		/* # of MbrCache Virtual Tables using this entry */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    SRWLOCK lock;
+#else
+    pthread_rwlock_t lock;
+#endif
+    struct mbr_cache_entry *next;
 };
 
+#define MBRC_INSERT	1
+#define MBRC_UPDATE	2
+#define MBRC_DELETE	3
+
+struct mbr_cache_change
+{
+/*
+a change not yet committed
+
+the new MBR is applied to the shared MBR's cache on COMMIT, the
+previous one (if any) is restored by ROLLBACK TO SAVEPOINT
+*/
+    int op;			/* MBRC_INSERT, MBRC_UPDATE or MBRC_DELETE */
+    sqlite3_int64 rowid;
+    double minx;
+    double miny;
+    double maxx;
+    double maxy;
+    int had_old;		/* TRUE if the cell already existed */
+    double old_minx;
+    double old_miny;
+    double old_maxx;
+    double old_maxy;
+    struct mbr_cache_change *prev;
+    struct mbr_cache_change *next;
+};
+
+/* the process-wide registry of MBR's caches */
+static struct mbr_cache_entry *mbr_cache_registry = NULL;
+#if defined(_WIN32) && !defined(__MINGW32__)
+static SRWLOCK mbr_cache_registry_lock = SRWLOCK_INIT;
+#else
+static pthread_mutex_t mbr_cache_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 typedef struct MbrCacheStruct
 {
 /* extends the sqlite3_vtab struct */
@@ -181,10 +247,21 @@ typedef struct MbrCacheStruct
     int nRef;			/* # references: USED INTERNALLY BY SQLITE */
     char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
     sqlite3 *db;		/* the sqlite db holding the virtual table */
-    struct mbr_cache *cache;	/* the  MBR's cache */
+    struct mbr_cache_entry *entry;	/* the shared MBR's cache */
     char *table_name;		/* the main table to be cached */
     char *column_name;		/* the column to be cached */
     int error;			/* some previous error disables any operation */
+/*
+uncommitted changes are never applied to the shared MBR's cache:
+the connection works on a private copy until COMMIT or ROLLBACK
+*/
+    struct mbr_cache *pending;	/* the private copy - NULL if none */
+    struct mbr_cache_change *first_change;
+    struct mbr_cache_change *last_change;
+    int n_changes;
+    int *savepoints;		/* n_changes when each SAVEPOINT started */
+    int n_savepoints;
+    int max_savepoints;
 } MbrCache;
 typedef MbrCache *MbrCachePtr;
 
@@ -192,6 +269,7 @@ typedef struct MbrCacheCursortStruct
 {
 /* extends the sqlite3_vtab_cursor struct */
     MbrCachePtr pVtab;		/* Virtual table of this cursor */
+    struct mbr_cache *cache;	/* the shared or private MBR's cache */
     int eof;			/* the EOF marker */
 /* 
 positioning parameters while performing a cache search 
@@ -200,6 +278,8 @@ positioning parameters while performing a cache search
     int current_block_index;
     int current_cell_index;
     struct mbr_cache_cell *current_cell;
+/* a private copy of the current cell */
+    struct mbr_cache_cell cell;
 /* 
 the strategy to use:
     0 = sequential scan
@@ -303,6 +383,7 @@ cache_alloc (void)
     p->first = NULL;
     p->last = NULL;
     p->current = NULL;
+    p->n_pages = 0;
     return p;
 }
 
@@ -404,6 +485,7 @@ cache_get_free_page (struct mbr_cache *p)
 	  p->first = pp;
 	  p->last = pp;
 	  p->current = pp;
+	  p->n_pages += 1;
 	  return pp;
       }
     if (p->current)
@@ -428,6 +510,7 @@ cache_get_free_page (struct mbr_cache *p)
     p->last->next = pp;
     p->last = pp;
     p->current = pp;
+    p->n_pages += 1;
     return pp;
 }
 
@@ -862,6 +945,391 @@ cache_update_cell (struct mbr_cache_page *pp, sqlite3_int64 rowid, double minx,
     return 0;
 }
 
+static struct mbr_cache *
+cache_clone (struct mbr_cache *p)
+{
+/* creating a private copy of some MBR's cache */
+    struct mbr_cache_page *pp;
+    struct mbr_cache_page *pn;
+    struct mbr_cache *clone = cache_alloc ();
+    pp = p->first;
+    while (pp)
+      {
+	  pn = malloc (sizeof (struct mbr_cache_page));
+	  memcpy (pn, pp, sizeof (struct mbr_cache_page));
+	  pn->next = NULL;
+	  if (clone->first == NULL)
+	      clone->first = pn;
+	  if (clone->last != NULL)
+	      clone->last->next = pn;
+	  clone->last = pn;
+	  if (pp == p->current)
+	      clone->current = pn;
+	  clone->n_pages += 1;
+	  pp = pp->next;
+      }
+    return clone;
+}
+
+static void
+cache_set_cell (struct mbr_cache *p, sqlite3_int64 rowid, double minx,
+		double miny, double maxx, double maxy)
+{
+/* updating a cell, or inserting it if not already existing */
+    if (!cache_update_cell (p->first, rowid, minx, miny, maxx, maxy))
+	cache_insert_cell (p, rowid, minx, miny, maxx, maxy);
+}
+
+static void
+cache_apply_change (struct mbr_cache *p, struct mbr_cache_change *chg)
+{
+/* applying a change to some MBR's cache */
+    switch (chg->op)
+      {
+      case MBRC_INSERT:
+	  if (!cache_find_by_rowid (p->first, chg->rowid))
+	      cache_insert_cell (p, chg->rowid, chg->minx, chg->miny,
+				 chg->maxx, chg->maxy);
+	  break;
+      case MBRC_UPDATE:
+	  cache_update_cell (p->first, chg->rowid, chg->minx, chg->miny,
+			     chg->maxx, chg->maxy);
+	  break;
+      case MBRC_DELETE:
+	  cache_delete_cell (p->first, chg->rowid);
+	  break;
+      };
+}
+
+static void
+cache_undo_change (struct mbr_cache *p, struct mbr_cache_change *chg)
+{
+/* restoring the cell as it was before some change */
+    if (chg->had_old)
+	cache_set_cell (p, chg->rowid, chg->old_minx, chg->old_miny,
+			chg->old_maxx, chg->old_maxy);
+    else
+	cache_delete_cell (p->first, chg->rowid);
+}
+
+static void
+registry_lock (void)
+{
+/* locking the MBR's cache registry */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    AcquireSRWLockExclusive (&mbr_cache_registry_lock);
+#else
+    pthread_mutex_lock (&mbr_cache_registry_lock);
+#endif
+}
+
+static void
+registry_unlock (void)
+{
+/* unlocking the MBR's cache registry */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    ReleaseSRWLockExclusive (&mbr_cache_registry_lock);
+#else
+    pthread_mutex_unlock (&mbr_cache_registry_lock);
+#endif
+}
+
+static void
+entry_read_lock (struct mbr_cache_entry *entry)
+{
+/* acquiring a shared (read) lock on some MBR's cache */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    AcquireSRWLockShared (&(entry->lock));
+#else
+    pthread_rwlock_rdlock (&(entry->lock));
+#endif
+}
+
+static void
+entry_read_unlock (struct mbr_cache_entry *entry)
+{
+/* releasing a shared (read) lock on some MBR's cache */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    ReleaseSRWLockShared (&(entry->lock));
+#else
+    pthread_rwlock_unlock (&(entry->lock));
+#endif
+}
+
+static void
+entry_write_lock (struct mbr_cache_entry *entry)
+{
+/* acquiring an exclusive (write) lock on some MBR's cache */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    AcquireSRWLockExclusive (&(entry->lock));
+#else
+    pthread_rwlock_wrlock (&(entry->lock));
+#endif
+}
+
+static void
+entry_write_unlock (struct mbr_cache_entry *entry)
+{
+/* releasing an exclusive (write) lock on some MBR's cache */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    ReleaseSRWLockExclusive (&(entry->lock));
+#else
+    pthread_rwlock_unlock (&(entry->lock));
+#endif
+}
+
+static sqlite3_int64
+entry_memory_usage (struct mbr_cache_entry *entry)
+{
+/* computing the memory allocated by some MBR's cache */
+    sqlite3_int64 bytes = sizeof (struct mbr_cache_entry);
+    if (entry->db_path)
+	bytes += strlen (entry->db_path) + 1;
+    bytes += strlen (entry->table_name) + 1;
+    bytes += strlen (entry->column_name) + 1;
+    if (entry->cache)
+      {
+	  bytes += sizeof (struct mbr_cache);
+	  bytes +=
+	      (sqlite3_int64) (entry->cache->n_pages) *
+	      sizeof (struct mbr_cache_page);
+      }
+    return bytes;
+}
+
+static struct mbr_cache_entry *
+entry_acquire (sqlite3 * db, const char *db_prefix, const char *table,
+	       const char *column)
+{
+/* 
+returning the registered MBR's cache for DB/Table/Column
+a new entry will be registered if not already existing
+*/
+    int len;
+    struct mbr_cache_entry *entry;
+    const char *db_path = sqlite3_db_filename (db, db_prefix);
+    if (db_path != NULL && *db_path == '\0')
+	db_path = NULL;
+
+    registry_lock ();
+    if (db_path != NULL)
+      {
+	  /* searching for an already existing shared cache */
+	  entry = mbr_cache_registry;
+	  while (entry)
+	    {
+		if (entry->db_path != NULL
+		    && strcmp (entry->db_path, db_path) == 0
+		    && strcasecmp (entry->table_name, table) == 0
+		    && strcasecmp (entry->column_name, column) == 0)
+		  {
+		      entry->ref_count += 1;
+		      registry_unlock ();
+		      return entry;
+		  }
+		entry = entry->next;
+	    }
+      }
+
+/* registering a new cache */
+    entry = malloc (sizeof (struct mbr_cache_entry));
+    entry->db_path = NULL;
+    entry->owner = NULL;
+    if (db_path != NULL)
+      {
+	  len = strlen (db_path);
+	  entry->db_path = malloc (len + 1);
+	  strcpy (entry->db_path, db_path);
+      }
+    else
+	entry->owner = db;
+    len = strlen (table);
+    entry->table_name = malloc (len + 1);
+    strcpy (entry->table_name, table);
+    len = strlen (column);
+    entry->column_name = malloc (len + 1);
+    strcpy (entry->column_name, column);
+    entry->cache = NULL;
+    entry->ref_count = 1;
+#if defined(_WIN32) && !defined(__MINGW32__)
+    InitializeSRWLock (&(entry->lock));
+#else
+    pthread_rwlock_init (&(entry->lock), NULL);
+#endif
+    entry->next = mbr_cache_registry;
+    mbr_cache_registry = entry;
+    registry_unlock ();
+    return entry;
+}
+
+static void
+entry_release (struct mbr_cache_entry *entry)
+{
+/* releasing a registered MBR's cache; the last user destroys it */
+    struct mbr_cache_entry *prev = NULL;
+    struct mbr_cache_entry *pe;
+    registry_lock ();
+    entry->ref_count -= 1;
+    if (entry->ref_count > 0)
+      {
+	  registry_unlock ();
+	  return;
+      }
+    pe = mbr_cache_registry;
+    while (pe)
+      {
+	  if (pe == entry)
+	    {
+		if (prev == NULL)
+		    mbr_cache_registry = pe->next;
+		else
+		    prev->next = pe->next;
+		break;
+	    }
+	  prev = pe;
+	  pe = pe->next;
+      }
+    registry_unlock ();
+
+    cache_destroy (entry->cache);
+#if !defined(_WIN32) || defined(__MINGW32__)
+    pthread_rwlock_destroy (&(entry->lock));
+#endif
+    if (entry->db_path)
+	free (entry->db_path);
+    free (entry->table_name);
+    free (entry->column_name);
+    free (entry);
+}
+
+static struct mbr_cache *
+entry_load (MbrCachePtr p_vt)
+{
+/* 
+returning the MBR's cache, loading it if not already done
+only the first user will actually load the cache, any 
+concurrent user will wait until the loading is completed
+*/
+    struct mbr_cache *cache;
+    struct mbr_cache_entry *entry = p_vt->entry;
+    entry_read_lock (entry);
+    cache = entry->cache;
+    entry_read_unlock (entry);
+    if (cache != NULL)
+	return cache;
+
+    entry_write_lock (entry);
+    if (entry->cache == NULL)
+	entry->cache =
+	    cache_load (p_vt->db, p_vt->table_name, p_vt->column_name);
+    cache = entry->cache;
+    entry_write_unlock (entry);
+    return cache;
+}
+
+static struct mbr_cache *
+mbrc_pending_cache (MbrCachePtr p_vt)
+{
+/* 
+returning the private copy of the MBR's cache, creating it if needed
+
+if the shared cache has not yet been loaded, the private copy is
+directly loaded from the main table (that could already contain
+uncommitted rows) and will become the shared cache on COMMIT
+*/
+    struct mbr_cache_entry *entry = p_vt->entry;
+    if (p_vt->pending != NULL)
+	return p_vt->pending;
+    entry_read_lock (entry);
+    if (entry->cache != NULL)
+	p_vt->pending = cache_clone (entry->cache);
+    entry_read_unlock (entry);
+    if (p_vt->pending == NULL)
+	p_vt->pending =
+	    cache_load (p_vt->db, p_vt->table_name, p_vt->column_name);
+    return p_vt->pending;
+}
+
+static void
+mbrc_free_changes (MbrCachePtr p_vt, int keep)
+{
+/* freeing all the uncommitted changes except the first KEEP ones */
+    int i = 0;
+    struct mbr_cache_change *chg = p_vt->first_change;
+    struct mbr_cache_change *next;
+    struct mbr_cache_change *last = NULL;
+    while (chg)
+      {
+	  next = chg->next;
+	  if (i < keep)
+	      last = chg;
+	  else
+	      free (chg);
+	  i++;
+	  chg = next;
+      }
+    if (last == NULL)
+	p_vt->first_change = NULL;
+    else
+	last->next = NULL;
+    p_vt->last_change = last;
+    if (p_vt->n_changes > keep)
+	p_vt->n_changes = keep;
+}
+
+static void
+mbrc_discard_pending (MbrCachePtr p_vt)
+{
+/* discarding the private copy and any uncommitted change */
+    cache_destroy (p_vt->pending);
+    p_vt->pending = NULL;
+    mbrc_free_changes (p_vt, 0);
+    p_vt->n_savepoints = 0;
+}
+
+SPATIALITE_PRIVATE sqlite3_int64
+mbrcache_memory_usage (void *p_db, const char *table, const char *column)
+{
+/* 
+computing the memory allocated by the MBR's caches
+- if TABLE and COLUMN are NULL: all caches of the whole process
+- otherwise: the cache for TABLE/COLUMN as seen by this connection
+*/
+    sqlite3 *db = (sqlite3 *) p_db;
+    sqlite3_int64 bytes = 0;
+    struct mbr_cache_entry *entry;
+    const char *db_path = NULL;
+    if (table != NULL && column != NULL)
+      {
+	  db_path = sqlite3_db_filename (db, "main");
+	  if (db_path != NULL && *db_path == '\0')
+	      db_path = NULL;
+      }
+
+    registry_lock ();
+    entry = mbr_cache_registry;
+    while (entry)
+      {
+	  entry_read_lock (entry);
+	  if (table == NULL || column == NULL)
+	      bytes += entry_memory_usage (entry);
+	  else if (strcasecmp (entry->table_name, table) == 0
+		   && strcasecmp (entry->column_name, column) == 0)
+	    {
+		if (entry->db_path == NULL && db_path == NULL
+		    && entry->owner == db)
+		    bytes += entry_memory_usage (entry);
+		if (entry->db_path != NULL && db_path != NULL
+		    && strcmp (entry->db_path, db_path) == 0)
+		    bytes += entry_memory_usage (entry);
+	    }
+	  entry_read_unlock (entry);
+	  entry = entry->next;
+      }
+    registry_unlock ();
+    return bytes;
+}
+
 static int
 mbrc_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 	     sqlite3_vtab ** ppVTab, char **pzErr)
@@ -898,7 +1366,14 @@ mbrc_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     p_vt->db = db;
     p_vt->table_name = NULL;
     p_vt->column_name = NULL;
-    p_vt->cache = NULL;
+    p_vt->entry = NULL;
+    p_vt->pending = NULL;
+    p_vt->first_change = NULL;
+    p_vt->last_change = NULL;
+    p_vt->n_changes = 0;
+    p_vt->savepoints = NULL;
+    p_vt->n_savepoints = 0;
+    p_vt->max_savepoints = 0;
 /* checking for table_name and geo_column_name */
     if (argc == 5)
       {
@@ -1015,6 +1490,9 @@ mbrc_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 	  return SQLITE_ERROR;
       }
     sqlite3_free (sql_statement);
+/* attaching the shared MBR's cache */
+    p_vt->entry =
+	entry_acquire (db, argv[1], p_vt->table_name, p_vt->column_name);
     *ppVTab = (sqlite3_vtab *) p_vt;
     return SQLITE_OK;
 }
@@ -1097,8 +1575,11 @@ mbrc_disconnect (sqlite3_vtab * pVTab)
 {
 /* disconnects the virtual table */
     MbrCachePtr p_vt = (MbrCachePtr) pVTab;
-    if (p_vt->cache)
-	cache_destroy (p_vt->cache);
+    mbrc_discard_pending (p_vt);
+    if (p_vt->savepoints)
+	free (p_vt->savepoints);
+    if (p_vt->entry)
+	entry_release (p_vt->entry);
     if (p_vt->table_name)
 	sqlite3_free (p_vt->table_name);
     if (p_vt->column_name)
@@ -1128,6 +1609,7 @@ mbrc_read_row_unfiltered (MbrCacheCursorPtr cursor)
 	  cursor->current_block_index = i_block;
 	  cursor->current_cell_index = i_cell;
 	  cursor->current_cell = cell;
+	  cursor->cell = *cell;
       }
     else
 	cursor->eof = 1;
@@ -1149,6 +1631,7 @@ mbrc_read_row_filtered (MbrCacheCursorPtr cursor)
 	  cursor->current_block_index = i_block;
 	  cursor->current_cell_index = i_cell;
 	  cursor->current_cell = cell;
+	  cursor->cell = *cell;
       }
     else
 	cursor->eof = 1;
@@ -1159,9 +1642,12 @@ mbrc_read_row_by_rowid (MbrCacheCursorPtr cursor, sqlite3_int64 rowid)
 {
 /* trying to find a row by rowid from the Mbr cache */
     struct mbr_cache_cell *cell =
-	cache_find_by_rowid (cursor->pVtab->cache->first, rowid);
+	cache_find_by_rowid (cursor->cache->first, rowid);
     if (cell)
-	cursor->current_cell = cell;
+      {
+	  cursor->current_cell = cell;
+	  cursor->cell = *cell;
+      }
     else
       {
 	  cursor->current_cell = NULL;
@@ -1179,16 +1665,20 @@ mbrc_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
     if (cursor == NULL)
 	return SQLITE_ERROR;
     cursor->pVtab = p_vt;
+    cursor->cache = NULL;
     if (p_vt->error)
       {
 	  cursor->eof = 1;
 	  *ppCursor = (sqlite3_vtab_cursor *) cursor;
 	  return SQLITE_OK;
       }
-    if (!(p_vt->cache))
-	p_vt->cache =
-	    cache_load (p_vt->db, p_vt->table_name, p_vt->column_name);
-    cursor->current_page = cursor->pVtab->cache->first;
+    if (p_vt->pending == NULL && entry_load (p_vt) == NULL)
+      {
+	  cursor->eof = 1;
+	  *ppCursor = (sqlite3_vtab_cursor *) cursor;
+	  return SQLITE_OK;
+      }
+    cursor->current_page = NULL;
     cursor->current_block_index = 0;
     cursor->current_cell_index = 0;
     cursor->current_cell = NULL;
@@ -1211,14 +1701,19 @@ mbrc_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
 {
 /* setting up a cursor filter */
     MbrCacheCursorPtr cursor = (MbrCacheCursorPtr) pCursor;
+    struct mbr_cache_entry *entry = cursor->pVtab->entry;
     if (idxStr || argc)
 	idxStr = idxStr;	/* unused arg warning suppression */
-    if (cursor->pVtab->error)
+/* uncommitted changes are only visible to this connection */
+    cursor->cache = cursor->pVtab->pending;
+    if (cursor->cache == NULL)
+	cursor->cache = entry->cache;
+    if (cursor->pVtab->error || cursor->cache == NULL)
       {
 	  cursor->eof = 1;
 	  return SQLITE_OK;
       }
-    cursor->current_page = cursor->pVtab->cache->first;
+    cursor->current_page = NULL;
     cursor->current_block_index = 0;
     cursor->current_cell_index = 0;
     cursor->current_cell = NULL;
@@ -1227,14 +1722,19 @@ mbrc_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
     if (idxNum == 0)
       {
 	  /* unfiltered mode */
+	  entry_read_lock (entry);
+	  cursor->current_page = cursor->cache->first;
 	  mbrc_read_row_unfiltered (cursor);
+	  entry_read_unlock (entry);
 	  return SQLITE_OK;
       }
     if (idxNum == 1)
       {
 	  /* filtering by ROWID */
 	  sqlite3_int64 rowid = sqlite3_value_int64 (argv[0]);
+	  entry_read_lock (entry);
 	  mbrc_read_row_by_rowid (cursor, rowid);
+	  entry_read_unlock (entry);
 	  return SQLITE_OK;
       }
     if (idxNum == 2)
@@ -1265,7 +1765,10 @@ mbrc_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
 			    cursor->maxx = maxx;
 			    cursor->maxy = maxy;
 			    cursor->mbr_mode = mode;
+			    entry_read_lock (entry);
+			    cursor->current_page = cursor->cache->first;
 			    mbrc_read_row_filtered (cursor);
+			    entry_read_unlock (entry);
 			}
 		      else
 			  cursor->eof = 1;
@@ -1289,9 +1792,17 @@ mbrc_next (sqlite3_vtab_cursor * pCursor)
 	  return SQLITE_OK;
       }
     if (cursor->strategy == 0)
-	mbrc_read_row_unfiltered (cursor);
+      {
+	  entry_read_lock (cursor->pVtab->entry);
+	  mbrc_read_row_unfiltered (cursor);
+	  entry_read_unlock (cursor->pVtab->entry);
+      }
     else if (cursor->strategy == 2)
-	mbrc_read_row_filtered (cursor);
+      {
+	  entry_read_lock (cursor->pVtab->entry);
+	  mbrc_read_row_filtered (cursor);
+	  entry_read_unlock (cursor->pVtab->entry);
+      }
     else
 	cursor->eof = 1;
     return SQLITE_OK;
@@ -1318,23 +1829,23 @@ mbrc_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
 	  if (column == 0)
 	    {
 		/* the PRIMARY KEY column */
-		sqlite3_result_int64 (pContext, cursor->current_cell->rowid);
+		sqlite3_result_int64 (pContext, cursor->cell.rowid);
 	    }
 	  if (column == 1)
 	    {
 		/* the MBR column */
 		char *envelope = sqlite3_mprintf ("POLYGON(("
 						  "%1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f, %1.2f %1.2f))",
-						  cursor->current_cell->minx,
-						  cursor->current_cell->miny,
-						  cursor->current_cell->maxx,
-						  cursor->current_cell->miny,
-						  cursor->current_cell->maxx,
-						  cursor->current_cell->maxy,
-						  cursor->current_cell->minx,
-						  cursor->current_cell->maxy,
-						  cursor->current_cell->minx,
-						  cursor->current_cell->miny);
+						  cursor->cell.minx,
+						  cursor->cell.miny,
+						  cursor->cell.maxx,
+						  cursor->cell.miny,
+						  cursor->cell.maxx,
+						  cursor->cell.maxy,
+						  cursor->cell.minx,
+						  cursor->cell.maxy,
+						  cursor->cell.minx,
+						  cursor->cell.miny);
 		sqlite3_result_text (pContext, envelope, strlen (envelope),
 				     sqlite3_free);
 	    }
@@ -1347,7 +1858,7 @@ mbrc_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
 {
 /* fetching the ROWID */
     MbrCacheCursorPtr cursor = (MbrCacheCursorPtr) pCursor;
-    *pRowid = cursor->current_cell->rowid;
+    *pRowid = cursor->cell.rowid;
     return SQLITE_OK;
 }
 
@@ -1356,30 +1867,31 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 	     sqlite_int64 * pRowid)
 {
 /* generic update [INSERT / UPDATE / DELETE */
-    sqlite3_int64 rowid;
+    sqlite3_int64 rowid = 0;
     unsigned char *p_blob;
     int n_bytes;
-    double minx;
-    double miny;
-    double maxx;
-    double maxy;
+    double minx = 0.0;
+    double miny = 0.0;
+    double maxx = 0.0;
+    double maxy = 0.0;
     int mode;
+    int op = 0;
     int illegal = 0;
     MbrCachePtr p_vtab = (MbrCachePtr) pVTab;
+    struct mbr_cache *cache;
+    struct mbr_cache_cell *old;
+    struct mbr_cache_change *chg;
     if (pRowid)
 	pRowid = pRowid;	/* unused arg warning suppression */
     if (p_vtab->error)
 	return SQLITE_OK;
-    if (!(p_vtab->cache))
-	p_vtab->cache =
-	    cache_load (p_vtab->db, p_vtab->table_name, p_vtab->column_name);
     if (argc == 1)
       {
 	  /* performing a DELETE */
 	  if (sqlite3_value_type (argv[0]) == SQLITE_INTEGER)
 	    {
 		rowid = sqlite3_value_int64 (argv[0]);
-		cache_delete_cell (p_vtab->cache->first, rowid);
+		op = MBRC_DELETE;
 	    }
 	  else
 	      illegal = 1;
@@ -1403,14 +1915,7 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 				 &mode))
 			      {
 				  if (mode == GAIA_FILTER_MBR_DECLARE)
-				    {
-					if (!cache_find_by_rowid
-					    (p_vtab->cache->first, rowid))
-					    cache_insert_cell (p_vtab->cache,
-							       rowid, minx,
-							       miny, maxx,
-							       maxy);
-				    }
+				      op = MBRC_INSERT;
 				  else
 				      illegal = 1;
 			      }
@@ -1440,9 +1945,7 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 				 &mode))
 			      {
 				  if (mode == GAIA_FILTER_MBR_DECLARE)
-				      cache_update_cell (p_vtab->cache->first,
-							 rowid, minx, miny,
-							 maxx, maxy);
+				      op = MBRC_UPDATE;
 				  else
 				      illegal = 1;
 			      }
@@ -1458,6 +1961,33 @@ mbrc_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
       }
     if (illegal)
 	return SQLITE_MISMATCH;
+
+/* the change only goes into the private copy until COMMIT */
+    cache = mbrc_pending_cache (p_vtab);
+    if (cache == NULL)
+	return SQLITE_ERROR;
+    chg = malloc (sizeof (struct mbr_cache_change));
+    chg->op = op;
+    chg->rowid = rowid;
+    chg->minx = minx;
+    chg->miny = miny;
+    chg->maxx = maxx;
+    chg->maxy = maxy;
+    old = cache_find_by_rowid (cache->first, rowid);
+    chg->had_old = (old != NULL);
+    chg->old_minx = (old != NULL) ? old->minx : 0.0;
+    chg->old_miny = (old != NULL) ? old->miny : 0.0;
+    chg->old_maxx = (old != NULL) ? old->maxx : 0.0;
+    chg->old_maxy = (old != NULL) ? old->maxy : 0.0;
+    chg->prev = p_vtab->last_change;
+    chg->next = NULL;
+    if (p_vtab->first_change == NULL)
+	p_vtab->first_change = chg;
+    if (p_vtab->last_change != NULL)
+	p_vtab->last_change->next = chg;
+    p_vtab->last_change = chg;
+    p_vtab->n_changes += 1;
+    cache_apply_change (cache, chg);
     return SQLITE_OK;
 }
 
@@ -1482,18 +2012,100 @@ mbrc_sync (sqlite3_vtab * pVTab)
 static int
 mbrc_commit (sqlite3_vtab * pVTab)
 {
-/* BEGIN TRANSACTION */
-    if (pVTab)
-	pVTab = pVTab;		/* unused arg warning suppression */
+/* COMMIT TRANSACTION - publishing the changes to every connection */
+    MbrCachePtr p_vt = (MbrCachePtr) pVTab;
+    struct mbr_cache_entry *entry = p_vt->entry;
+    struct mbr_cache_change *chg;
+    if (p_vt->pending == NULL)
+	return SQLITE_OK;
+    entry_write_lock (entry);
+    if (entry->cache == NULL)
+      {
+	  /* the private copy becomes the shared cache */
+	  entry->cache = p_vt->pending;
+	  p_vt->pending = NULL;
+      }
+    else
+      {
+	  /* replaying the changes on the shared cache */
+	  chg = p_vt->first_change;
+	  while (chg)
+	    {
+		cache_apply_change (entry->cache, chg);
+		chg = chg->next;
+	    }
+      }
+    entry_write_unlock (entry);
+    mbrc_discard_pending (p_vt);
     return SQLITE_OK;
 }
 
 static int
 mbrc_rollback (sqlite3_vtab * pVTab)
 {
-/* BEGIN TRANSACTION */
-    if (pVTab)
-	pVTab = pVTab;		/* unused arg warning suppression */
+/* ROLLBACK TRANSACTION - discarding any uncommitted change */
+    mbrc_discard_pending ((MbrCachePtr) pVTab);
+    return SQLITE_OK;
+}
+
+static int
+mbrc_savepoint (sqlite3_vtab * pVTab, int iSavepoint)
+{
+/* SAVEPOINT - marking the current position into the changes list */
+    int i;
+    MbrCachePtr p_vt = (MbrCachePtr) pVTab;
+    if (iSavepoint < 0)
+	return SQLITE_OK;
+    if (iSavepoint >= p_vt->max_savepoints)
+      {
+	  int max = iSavepoint + 8;
+	  int *savepoints = realloc (p_vt->savepoints, sizeof (int) * max);
+	  if (savepoints == NULL)
+	      return SQLITE_NOMEM;
+	  p_vt->savepoints = savepoints;
+	  p_vt->max_savepoints = max;
+      }
+    for (i = p_vt->n_savepoints; i < iSavepoint; i++)
+	p_vt->savepoints[i] = p_vt->n_changes;
+    p_vt->savepoints[iSavepoint] = p_vt->n_changes;
+    p_vt->n_savepoints = iSavepoint + 1;
+    return SQLITE_OK;
+}
+
+static int
+mbrc_release (sqlite3_vtab * pVTab, int iSavepoint)
+{
+/* RELEASE SAVEPOINT - the changes simply belong to the outer level */
+    MbrCachePtr p_vt = (MbrCachePtr) pVTab;
+    if (iSavepoint >= 0 && iSavepoint < p_vt->n_savepoints)
+	p_vt->n_savepoints = iSavepoint;
+    return SQLITE_OK;
+}
+
+static int
+mbrc_rollback_to (sqlite3_vtab * pVTab, int iSavepoint)
+{
+/* ROLLBACK TO SAVEPOINT - undoing the most recent changes */
+    int keep;
+    MbrCachePtr p_vt = (MbrCachePtr) pVTab;
+    struct mbr_cache_change *chg;
+    if (iSavepoint < 0 || iSavepoint >= p_vt->n_savepoints)
+	return SQLITE_OK;
+    keep = p_vt->savepoints[iSavepoint];
+    if (p_vt->pending != NULL)
+      {
+	  /* restoring the private copy in reverse order */
+	  int i = p_vt->n_changes;
+	  chg = p_vt->last_change;
+	  while (chg && i > keep)
+	    {
+		cache_undo_change (p_vt->pending, chg);
+		chg = chg->prev;
+		i--;
+	    }
+      }
+    mbrc_free_changes (p_vt, keep);
+    p_vt->n_savepoints = iSavepoint + 1;
     return SQLITE_OK;
 }
 
@@ -1501,7 +2113,7 @@ int
 sqlite3MbrCacheInit (sqlite3 * db)
 {
     int rc = SQLITE_OK;
-    my_mbr_module.iVersion = 1;
+    my_mbr_module.iVersion = 2;
     my_mbr_module.xCreate = &mbrc_create;
     my_mbr_module.xConnect = &mbrc_connect;
     my_mbr_module.xBestIndex = &mbrc_best_index;
@@ -1520,6 +2132,9 @@ sqlite3MbrCacheInit (sqlite3 * db)
     my_mbr_module.xCommit = &mbrc_commit;
     my_mbr_module.xRollback = &mbrc_rollback;
     my_mbr_module.xFindFunction = NULL;
+    my_mbr_module.xSavepoint = &mbrc_savepoint;
+    my_mbr_module.xRelease = &mbrc_release;
+    my_mbr_module.xRollbackTo = &mbrc_rollback_to;
     sqlite3_create_module_v2 (db, "MbrCache", &my_mbr_module, NULL, 0);
     return rc;
 }
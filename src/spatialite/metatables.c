@@ -2795,6 +2795,65 @@ createAdvancedMetaData (void *p_sqlite)
     return 1;
 }
 
+SPATIALITE_PRIVATE int
+createAdvancedMetaDataOnDemand (void *p_sqlite)
+{
+/* creating the advanced MetaData tables on first use
+/ (databases initialized by InitSpatialMetaDataLazy)
+/
+/ returns 1 if the advanced MetaData tables are available or are
+/ not required at all, 0 on failure
+*/
+    sqlite3 *sqlite = (sqlite3 *) p_sqlite;
+    char **results;
+    int rows;
+    int columns;
+    int ret;
+    int exists = 0;
+
+    ret =
+	sqlite3_get_table (sqlite,
+			   "SELECT name FROM main.sqlite_master WHERE type = 'table' "
+			   "AND Lower(name) = 'views_geometry_columns'", &results,
+			   &rows, &columns, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (rows >= 1)
+	exists = 1;
+    sqlite3_free_table (results);
+    if (exists)
+	return 1;
+    if (checkSpatialMetaData (sqlite) != 3)
+      {
+	  /* legacy or FDO-OGR MetaData: nothing to be created */
+	  return 1;
+      }
+    if (sqlite3_db_readonly (sqlite, "MAIN") == 1)
+	return 1;
+
+    ret =
+	sqlite3_exec (sqlite, "SAVEPOINT lazy_advanced_metadata", NULL, NULL,
+		      NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (!createAdvancedMetaData (sqlite))
+      {
+	  sqlite3_exec (sqlite, "ROLLBACK TO SAVEPOINT lazy_advanced_metadata",
+			NULL, NULL, NULL);
+	  sqlite3_exec (sqlite, "RELEASE SAVEPOINT lazy_advanced_metadata",
+			NULL, NULL, NULL);
+	  return 0;
+      }
+    ret =
+	sqlite3_exec (sqlite, "RELEASE SAVEPOINT lazy_advanced_metadata", NULL,
+		      NULL, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    updateSpatiaLiteHistory (sqlite, "*** Advanced MetaData ***", NULL,
+			     "tables successfully created on first use");
+    return 1;
+}
+
 SPATIALITE_PRIVATE int
 createGeometryColumns (void *p_sqlite)
 {
@@ -7770,7 +7829,36 @@ gaiaStatisticsInvalidate (sqlite3 * sqlite, const char *table,
 	  sqlite3_free (sql_statement);
 	  if (ret != SQLITE_OK)
 	    {
-		spatialite_e ("SQL error: %s: %s\n", sql_statement, errMsg);
+		spatialite_e ("SQL error: %s\n", errMsg);
+		sqlite3_free (errMsg);
+		return 0;
+	    }
+
+	  /* 
+	     / incremental statistics triggers will never touch a NULL
+	     / last_verified, so the Layer will stay invalid until it's
+	     / fully recomputed
+	   */
+	  if (table != NULL && geometry != NULL)
+	      sql_statement =
+		  sqlite3_mprintf
+		  ("UPDATE geometry_columns_statistics SET last_verified = NULL "
+		   "WHERE Lower(f_table_name) = Lower(%Q) AND "
+		   "Lower(f_geometry_column) = Lower(%Q)", table, geometry);
+	  else if (table != NULL)
+	      sql_statement =
+		  sqlite3_mprintf
+		  ("UPDATE geometry_columns_statistics SET last_verified = NULL "
+		   "WHERE Lower(f_table_name) = Lower(%Q)", table);
+	  else
+	      sql_statement =
+		  sqlite3_mprintf
+		  ("UPDATE geometry_columns_statistics SET last_verified = NULL");
+	  ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+	  sqlite3_free (sql_statement);
+	  if (ret != SQLITE_OK)
+	    {
+		spatialite_e ("SQL error: %s\n", errMsg);
 		sqlite3_free (errMsg);
 		return 0;
 	    }
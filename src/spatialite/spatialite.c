@@ -500,6 +500,47 @@ fnct_spatialite_target_cpu (sqlite3_context * context, int argc,
     sqlite3_result_text (context, p_result, len, SQLITE_TRANSIENT);
 }
 
+static void
+fnct_spatialite_connection_pool (sqlite3_context * context, int argc,
+				 sqlite3_value ** argv)
+{
+/* SQL function:
+/ spatialite_connection_pool()
+/     or
+/ spatialite_connection_pool(text item)
+/
+/ returns the occupancy of the process-wide connection pool;
+/ item is one of 'used' (default), 'peak', 'capacity' or 'free'
+/ ('capacity' and 'free' are NULL when the pool has no upper limit)
+/ or NULL on invalid arguments
+*/
+    int used;
+    int peak;
+    int capacity;
+    const char *item = "used";
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (argc == 1)
+      {
+	  if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  item = (const char *) sqlite3_value_text (argv[0]);
+      }
+    spatialite_connection_pool_stats (&used, &peak, &capacity);
+    if (strcasecmp (item, "used") == 0)
+	sqlite3_result_int (context, used);
+    else if (strcasecmp (item, "peak") == 0)
+	sqlite3_result_int (context, peak);
+    else if (strcasecmp (item, "capacity") == 0 && capacity >= 0)
+	sqlite3_result_int (context, capacity);
+    else if (strcasecmp (item, "free") == 0 && capacity >= 0)
+	sqlite3_result_int (context, (used < capacity) ? capacity - used : 0);
+    else
+	sqlite3_result_null (context);
+}
+
 static void
 fnct_freexl_version (sqlite3_context * context, int argc, sqlite3_value ** argv)
 {
@@ -2605,21 +2646,15 @@ fnct_CheckSpatialMetaData (sqlite3_context * context, int argc,
 }
 
 static void
-fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
-			  sqlite3_value ** argv)
+do_init_spatial_metadata (sqlite3_context * context, int argc,
+			  sqlite3_value ** argv, const char *fnct_name,
+			  int lazy)
 {
-/* SQL function:
-/ InitSpatialMetaData()
-/     or
-/ InitSpatialMetaData(text mode)
-/     or
-/ InitSpatialMetaData(integer transaction)
-/     or
-/ InitSpatialMetaData(integer transaction, text mode)
+/* common implementation of InitSpatialMetaData and InitSpatialMetaDataLazy
 /
-/ creates the SPATIAL_REF_SYS and GEOMETRY_COLUMNS tables
-/ returns 1 on success
-/ 0 on failure
+/ in "lazy" mode only SPATIAL_REF_SYS, GEOMETRY_COLUMNS and the query
+/ Virtual Tables are created; all the advanced MetaData tables will be
+/ created on first use by createAdvancedMetaDataOnDemand()
 */
     char sql[8192];
     char *errMsg = NULL;
@@ -2646,7 +2681,8 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
 	  else
 	    {
 		spatialite_e
-		    ("InitSpatialMetaData() error: argument 1 is not of the String or Integer type\n");
+		    ("%s() error: argument 1 is not of the String or Integer type\n",
+		     fnct_name);
 		sqlite3_result_int (context, 0);
 		return;
 	    }
@@ -2656,14 +2692,16 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
 	  if (sqlite3_value_type (argv[0]) != SQLITE_INTEGER)
 	    {
 		spatialite_e
-		    ("InitSpatialMetaData() error: argument 1 is not of the Integer type\n");
+		    ("%s() error: argument 1 is not of the Integer type\n",
+		     fnct_name);
 		sqlite3_result_int (context, 0);
 		return;
 	    }
 	  if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
 	    {
 		spatialite_e
-		    ("InitSpatialMetaData() error: argument 2 is not of the String type\n");
+		    ("%s() error: argument 2 is not of the String type\n",
+		     fnct_name);
 		sqlite3_result_int (context, 0);
 		return;
 	    }
@@ -2729,8 +2767,11 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
 	      updateSpatiaLiteHistory (sqlite, "spatial_ref_sys", NULL,
 				       "table successfully populated");
       }
-    if (!createAdvancedMetaData (sqlite))
-	goto error;
+    if (!lazy)
+      {
+	  if (!createAdvancedMetaData (sqlite))
+	      goto error;
+      }
 /* creating the SpatialIndex VIRTUAL TABLE */
     strcpy (sql, "CREATE VIRTUAL TABLE SpatialIndex ");
     strcat (sql, "USING VirtualSpatialIndex()");
@@ -2764,7 +2805,7 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
     sqlite3_result_int (context, 1);
     return;
   error:
-    spatialite_e ("InitSpatiaMetaData() error:\"%s\"\n", errMsg);
+    spatialite_e ("%s() error:\"%s\"\n", fnct_name, errMsg);
     sqlite3_free (errMsg);
     if (transaction)
       {
@@ -2772,7 +2813,7 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
 	  ret = sqlite3_exec (sqlite, "ROLLBACK", NULL, NULL, &errMsg);
 	  if (ret != SQLITE_OK)
 	    {
-		spatialite_e (" InitSpatiaMetaData() error:\"%s\"\n", errMsg);
+		spatialite_e (" %s() error:\"%s\"\n", fnct_name, errMsg);
 		sqlite3_free (errMsg);
 	    }
       }
@@ -2780,6 +2821,50 @@ fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
     return;
 }
 
+static void
+fnct_InitSpatialMetaData (sqlite3_context * context, int argc,
+			  sqlite3_value ** argv)
+{
+/* SQL function:
+/ InitSpatialMetaData()
+/     or
+/ InitSpatialMetaData(text mode)
+/     or
+/ InitSpatialMetaData(integer transaction)
+/     or
+/ InitSpatialMetaData(integer transaction, text mode)
+/
+/ creates the SPATIAL_REF_SYS and GEOMETRY_COLUMNS tables
+/ returns 1 on success
+/ 0 on failure
+*/
+    do_init_spatial_metadata (context, argc, argv, "InitSpatialMetaData", 0);
+}
+
+static void
+fnct_InitSpatialMetaDataLazy (sqlite3_context * context, int argc,
+			      sqlite3_value ** argv)
+{
+/* SQL function:
+/ InitSpatialMetaDataLazy()
+/     or
+/ InitSpatialMetaDataLazy(text mode)
+/     or
+/ InitSpatialMetaDataLazy(integer transaction)
+/     or
+/ InitSpatialMetaDataLazy(integer transaction, text mode)
+/
+/ lightweight variant of InitSpatialMetaData: only creates the core
+/ SPATIAL_REF_SYS and GEOMETRY_COLUMNS tables; all other MetaData
+/ tables will be created on first use (AddGeometryColumn,
+/ RecoverGeometryColumn, CreateVectorCoveragesTables and alike)
+/ returns 1 on success
+/ 0 on failure
+*/
+    do_init_spatial_metadata (context, argc, argv, "InitSpatialMetaDataLazy",
+			      1);
+}
+
 static void
 fnct_InitAdvancedMetaData (sqlite3_context * context, int argc,
 			   sqlite3_value ** argv)
@@ -4653,6 +4738,17 @@ fnct_AddGeometryColumn (sqlite3_context * context, int argc,
 	  sqlite3_result_int (context, 0);
 	  return;
       }
+    if (metadata_version == 3)
+      {
+	  /* lazily initialized MetaData: creating the advanced tables */
+	  if (!createAdvancedMetaDataOnDemand (sqlite))
+	    {
+		spatialite_e
+		    ("AddGeometryColumn() error: unable to create the advanced MetaData tables\n");
+		sqlite3_result_int (context, 0);
+		return;
+	    }
+      }
 
 /*
  * the following code has been contributed by Mark Johnson <mj10777@googlemail.com>
@@ -5949,6 +6045,17 @@ fnct_RecoverGeometryColumn (sqlite3_context * context, int argc,
 	  sqlite3_result_int (context, 0);
 	  return;
       }
+    if (metadata_version == 3)
+      {
+	  /* lazily initialized MetaData: creating the advanced tables */
+	  if (!createAdvancedMetaDataOnDemand (sqlite))
+	    {
+		spatialite_e
+		    ("RecoverGeometryColumn() error: unable to create the advanced MetaData tables\n");
+		sqlite3_result_int (context, 0);
+		return;
+	    }
+      }
 /* checking if the table exists */
     strcpy (sql,
 	    "SELECT name FROM sqlite_master WHERE type = 'table' AND Lower(name) = Lower(?)");
@@ -6761,6 +6868,36 @@ fnct_DiscardGeometryColumn (sqlite3_context * context, int argc,
     free (quoted);
     ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
     sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("sti_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("stu_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    raw = sqlite3_mprintf ("std_%s_%s", p_table, p_column);
+    quoted = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    sql_statement =
+	sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"", quoted);
+    free (quoted);
+    ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, &errMsg);
+    sqlite3_free (sql_statement);
     if (ret != SQLITE_OK)
 	goto error;
 
@@ -7122,6 +7259,8 @@ fnct_RegisterVirtualGeometry (sqlite3_context * context, int argc,
 	  return;
       }
     table = sqlite3_value_text (argv[0]);
+    if (!createAdvancedMetaDataOnDemand (sqlite))
+	goto error;
     if (!registerVirtual (sqlite, (char *) table))
 	goto error;
     sqlite3_result_int (context, 1);
@@ -7378,8 +7517,7 @@ fnct_AddFDOGeometryColumn (sqlite3_context * context, int argc,
     int type;
     int srid = -1;
     int srid_exists = -1;
-    struct epsg_defs *first = NULL;
-    struct epsg_defs *last = NULL;
+    const struct epsg_catalog_def *p_epsg;
     sqlite3_stmt *stmt_sql;
     int dimension = 2;
     char *sql_statement;
@@ -7542,8 +7680,8 @@ fnct_AddFDOGeometryColumn (sqlite3_context * context, int argc,
     if (srid_exists == 0)
       {
 	  /* get the EPSG definition for this SRID from our master list */
-	  initialize_epsg (srid, &first, &last);
-	  if (first == NULL)
+	  p_epsg = find_epsg_def (srid);
+	  if (p_epsg == NULL)
 	    {
 		sql_statement =
 		    sqlite3_mprintf
@@ -7564,26 +7702,22 @@ fnct_AddFDOGeometryColumn (sqlite3_context * context, int argc,
 	    {
 		sqlite3_free (sql_statement);
 		sqlite3_result_error (context, sqlite3_errmsg (sqlite), -1);
-		/* freeing the EPSG defs list */
-		free_epsg (first);
 		return;
 	    }
-	  sqlite3_bind_int (stmt_sql, 1, first->srid);
-	  sqlite3_bind_text (stmt_sql, 2, first->auth_name,
-			     strlen (first->auth_name), SQLITE_STATIC);
-	  sqlite3_bind_int (stmt_sql, 3, first->auth_srid);
-	  if (strlen (first->srs_wkt) == 0)
+	  sqlite3_bind_int (stmt_sql, 1, p_epsg->srid);
+	  sqlite3_bind_text (stmt_sql, 2, p_epsg->auth_name,
+			     strlen (p_epsg->auth_name), SQLITE_STATIC);
+	  sqlite3_bind_int (stmt_sql, 3, p_epsg->auth_srid);
+	  if (strlen (p_epsg->srs_wkt) == 0)
 	    {
 		sqlite3_bind_text (stmt_sql, 4, "Undefined", 9, SQLITE_STATIC);
 	    }
 	  else
 	    {
-		sqlite3_bind_text (stmt_sql, 4, first->srs_wkt,
-				   strlen (first->srs_wkt), SQLITE_STATIC);
+		sqlite3_bind_text (stmt_sql, 4, p_epsg->srs_wkt,
+				   strlen (p_epsg->srs_wkt), SQLITE_STATIC);
 	    }
 	  ret = sqlite3_step (stmt_sql);
-	  /* freeing the EPSG defs list */
-	  free_epsg (first);
 	  if (stmt_sql != NULL)
 	    {
 		sqlite3_finalize (stmt_sql);
@@ -9214,6 +9348,38 @@ fnct_CreateMbrCache (sqlite3_context * context, int argc, sqlite3_value ** argv)
     return;
 }
 
+static void
+fnct_MbrCacheMemoryUsage (sqlite3_context * context, int argc,
+			  sqlite3_value ** argv)
+{
+/* SQL function:
+/ MbrCacheMemoryUsage()
+/ MbrCacheMemoryUsage(table, column)
+/
+/ returns the number of bytes currently allocated by MbrCaches:
+/ either all the caches of the whole process, or the one
+/ shared by this DB for the given Table and Column
+/ NULL on invalid arguments
+*/
+    const char *table = NULL;
+    const char *column = NULL;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (argc == 2)
+      {
+	  if (sqlite3_value_type (argv[0]) != SQLITE_TEXT
+	      || sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  table = (const char *) sqlite3_value_text (argv[0]);
+	  column = (const char *) sqlite3_value_text (argv[1]);
+      }
+    sqlite3_result_int64 (context,
+			  mbrcache_memory_usage (sqlite, table, column));
+}
+
 static void
 fnct_DisableSpatialIndex (sqlite3_context * context, int argc,
 			  sqlite3_value ** argv)
@@ -9385,6 +9551,8 @@ fnct_UpdateLayerStatistics (sqlite3_context * context, int argc,
 	    }
 	  column = (const char *) sqlite3_value_text (argv[1]);
       }
+    if (!createAdvancedMetaDataOnDemand (sqlite))
+	goto error;
     if (!update_layer_statistics (sqlite, table, column))
 	goto error;
     sqlite3_result_int (context, 1);
@@ -9596,6 +9764,86 @@ fnct_InvalidateLayerStatistics (sqlite3_context * context, int argc,
     return;
 }
 
+static void
+fnct_EnableIncrementalStatistics (sqlite3_context * context, int argc,
+                                  sqlite3_value ** argv)
+{
+/* SQL function:
+/ EnableIncrementalStatistics(table, column)
+/
+/ Enables trigger-maintained (incremental) Layer Statistics
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("EnableIncrementalStatistics() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("EnableIncrementalStatistics() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (!gaiaStatisticsEnableIncremental (sqlite, table, column))
+      {
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    sqlite3_result_int (context, 1);
+    updateSpatiaLiteHistory (sqlite, table, column, "Incremental Statistics enabled");
+}
+
+static void
+fnct_DisableIncrementalStatistics (sqlite3_context * context, int argc,
+                                   sqlite3_value ** argv)
+{
+/* SQL function:
+/ DisableIncrementalStatistics(table, column)
+/
+/ Disables trigger-maintained (incremental) Layer Statistics
+/ returns 1 on success
+/ 0 on failure
+*/
+    const char *table;
+    const char *column;
+    sqlite3 *sqlite = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("DisableIncrementalStatistics() error: argument 1 [table_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  spatialite_e
+	      ("DisableIncrementalStatistics() error: argument 2 [column_name] is not of the String type\n");
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    column = (const char *) sqlite3_value_text (argv[1]);
+    if (!gaiaStatisticsDisableIncremental (sqlite, table, column))
+      {
+	  sqlite3_result_int (context, 0);
+	  return;
+      }
+    sqlite3_result_int (context, 1);
+    updateSpatiaLiteHistory (sqlite, table, column, "Incremental Statistics disabled");
+}
+
 static void
 fnct_CreateRasterCoveragesTable (sqlite3_context * context, int argc,
 				 sqlite3_value ** argv)
@@ -17948,6 +18196,36 @@ fnct_Envelope (sqlite3_context * context, int argc, sqlite3_value ** argv)
       }
     p_blob = (unsigned char *) sqlite3_value_blob (argv[0]);
     n_bytes = sqlite3_value_bytes (argv[0]);
+#ifdef ENABLE_GEOPACKAGE	/* GEOPACKAGE enabled: supporting GPKG geometries */
+    if ((gpkg_mode || gpkg_amphibious) && gaiaIsValidGPB (p_blob, n_bytes))
+      {
+	  /* GPKG geometry: the MBR could be read from the GPB header */
+	  double min_x;
+	  double max_x;
+	  double min_y;
+	  double max_y;
+	  if (!gaiaGetMbrFromGPB
+	      (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y))
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  bbox = gaiaAllocGeomColl ();
+	  bbox->Srid = gaiaGetSridFromGPB (p_blob, n_bytes);
+	  polyg = gaiaAddPolygonToGeomColl (bbox, 5, 0);
+	  rect = polyg->Exterior;
+	  gaiaSetPoint (rect->Coords, 0, min_x, min_y);	/* vertex # 1 */
+	  gaiaSetPoint (rect->Coords, 1, max_x, min_y);	/* vertex # 2 */
+	  gaiaSetPoint (rect->Coords, 2, max_x, max_y);	/* vertex # 3 */
+	  gaiaSetPoint (rect->Coords, 3, min_x, max_y);	/* vertex # 4 */
+	  gaiaSetPoint (rect->Coords, 4, min_x, min_y);	/* vertex # 5 [same as vertex # 1 to close the polygon] */
+	  gaiaToSpatiaLiteBlobWkbEx2 (bbox, &p_result, &len, gpkg_mode,
+				      tiny_point);
+	  gaiaFreeGeomColl (bbox);
+	  sqlite3_result_blob (context, p_result, len, free);
+	  return;
+      }
+#endif /* end GEOPACKAGE: supporting GPKG geometries */
     geo =
 	gaiaFromSpatiaLiteBlobWkbEx (p_blob, n_bytes, gpkg_mode,
 				     gpkg_amphibious);
@@ -18606,15 +18884,8 @@ fnct_MbrMinX (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		double max_x;
 		double min_y;
 		double max_y;
-		int has_z;
-		double min_z;
-		double max_z;
-		int has_m;
-		double min_m;
-		double max_m;
-		if (gaiaGetEnvelopeFromGPB
-		    (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y, &has_z,
-		     &min_z, &max_z, &has_m, &min_m, &max_m))
+		if (gaiaGetMbrFromGPB
+		    (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y))
 		  {
 		      sqlite3_result_double (context, min_x);
 		  }
@@ -18656,15 +18927,8 @@ fnct_MbrMaxX (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		double max_x;
 		double min_y;
 		double max_y;
-		int has_z;
-		double min_z;
-		double max_z;
-		int has_m;
-		double min_m;
-		double max_m;
-		if (gaiaGetEnvelopeFromGPB
-		    (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y, &has_z,
-		     &min_z, &max_z, &has_m, &min_m, &max_m))
+		if (gaiaGetMbrFromGPB
+		    (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y))
 		  {
 		      sqlite3_result_double (context, max_x);
 		  }
@@ -18706,15 +18970,8 @@ fnct_MbrMinY (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		double max_x;
 		double min_y;
 		double max_y;
-		int has_z;
-		double min_z;
-		double max_z;
-		int has_m;
-		double min_m;
-		double max_m;
-		if (gaiaGetEnvelopeFromGPB
-		    (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y, &has_z,
-		     &min_z, &max_z, &has_m, &min_m, &max_m))
+		if (gaiaGetMbrFromGPB
+		    (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y))
 		  {
 		      sqlite3_result_double (context, min_y);
 		  }
@@ -18756,15 +19013,8 @@ fnct_MbrMaxY (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		double max_x;
 		double min_y;
 		double max_y;
-		int has_z;
-		double min_z;
-		double max_z;
-		int has_m;
-		double min_m;
-		double max_m;
-		if (gaiaGetEnvelopeFromGPB
-		    (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y, &has_z,
-		     &min_z, &max_z, &has_m, &min_m, &max_m))
+		if (gaiaGetMbrFromGPB
+		    (p_blob, n_bytes, &min_x, &max_x, &min_y, &max_y))
 		  {
 		      sqlite3_result_double (context, max_y);
 		  }
@@ -32754,6 +33004,10 @@ fnct_Cutter (sqlite3_context * context, int argc, sqlite3_value ** argv)
 / ST_Cutter(TEXT in_db_prefix, TEXT input_table, TEXT input_geom,
 /              TEXT blade_db_prefix, TEXT blade_table, TEXT blade_geom,
 /              TEXT output_table, INT transaction, INT ram_temp_store)
+/ ST_Cutter(TEXT in_db_prefix, TEXT input_table, TEXT input_geom,
+/              TEXT blade_db_prefix, TEXT blade_table, TEXT blade_geom,
+/              TEXT output_table, INT transaction, INT ram_temp_store,
+/              INT threads)
 /
 / the "input" table-geometry is expected to be declared as POINT,
 / LINESTRING, POLYGON, MULTIPOINT, MULTILINESTRING or MULTIPOLYGON
@@ -32793,6 +33047,7 @@ fnct_Cutter (sqlite3_context * context, int argc, sqlite3_value ** argv)
     const char *output_table = NULL;
     int transaction = 0;
     int ram_tmp_store = 0;
+    int threads = 1;
     char **message = NULL;
     struct splite_internal_cache *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
@@ -32866,7 +33121,7 @@ fnct_Cutter (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		return;
 	    }
       }
-    if (argc == 9)
+    if (argc >= 9)
       {
 	  if (sqlite3_value_type (argv[8]) == SQLITE_INTEGER)
 	      ram_tmp_store = sqlite3_value_int (argv[8]);
@@ -32876,12 +33131,22 @@ fnct_Cutter (sqlite3_context * context, int argc, sqlite3_value ** argv)
 		return;
 	    }
       }
+    if (argc == 10)
+      {
+	  if (sqlite3_value_type (argv[9]) == SQLITE_INTEGER)
+	      threads = sqlite3_value_int (argv[9]);
+	  else
+	    {
+		sqlite3_result_int (context, -1);
+		return;
+	    }
+      }
 
     sqlite = sqlite3_context_db_handle (context);
     ret =
-	gaiaCutter (sqlite, cache, in_db_prefix, input_table, input_geom,
-		    blade_db_prefix, blade_table, blade_geom, output_table,
-		    transaction, ram_tmp_store, message);
+	gaiaCutterEx (sqlite, cache, in_db_prefix, input_table, input_geom,
+		      blade_db_prefix, blade_table, blade_geom, output_table,
+		      transaction, ram_tmp_store, threads, message);
 
     sqlite3_result_int (context, ret);
 }
@@ -34104,6 +34369,99 @@ fnct_ExportGeoJSON (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	sqlite3_result_int (context, rows);
 }
 
+static void
+fnct_ExportColumnar (sqlite3_context * context, int argc,
+		     sqlite3_value ** argv)
+{
+/* SQL function:
+/ ExportColumnar(TEXT table, TEXT geom_column, TEXT filename)
+/ ExportColumnar(TEXT table, TEXT geom_column, TEXT filename,
+/                BOOL compressed)
+/ ExportColumnar(TEXT table, TEXT geom_column, TEXT filename,
+/                BOOL compressed, INT precision)
+/ ExportColumnar(TEXT table, TEXT geom_column, TEXT filename,
+/                BOOL compressed, INT precision, INT chunk_rows)
+/
+/ returns:
+/ the number of exported rows
+/ NULL on invalid arguments
+*/
+    int ret;
+    char *table;
+    char *geom_col;
+    char *path;
+    int compressed = 0;
+    int precision = 6;
+    int chunk_rows = 0;
+    int rows;
+    sqlite3 *db_handle = sqlite3_context_db_handle (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    table = (char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    geom_col = (char *) sqlite3_value_text (argv[1]);
+    if (sqlite3_value_type (argv[2]) != SQLITE_TEXT)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    path = (char *) sqlite3_value_text (argv[2]);
+    if (argc > 3)
+      {
+	  if (sqlite3_value_type (argv[3]) != SQLITE_INTEGER)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  compressed = sqlite3_value_int (argv[3]);
+      }
+    if (argc > 4)
+      {
+	  if (sqlite3_value_type (argv[4]) != SQLITE_INTEGER)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  precision = sqlite3_value_int (argv[4]);
+	  if (precision < 0 || precision > 15)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+      }
+    if (argc > 5)
+      {
+	  if (sqlite3_value_type (argv[5]) != SQLITE_INTEGER)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  chunk_rows = sqlite3_value_int (argv[5]);
+	  if (chunk_rows <= 0)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+      }
+
+    ret =
+	dump_columnar (db_handle, table, geom_col, path, compressed, precision,
+		       chunk_rows, &rows);
+
+    if (rows < 0 || !ret)
+	sqlite3_result_null (context);
+    else
+	sqlite3_result_int (context, rows);
+}
+
 static void
 fnct_ExportGeoJSON2 (sqlite3_context * context, int argc, sqlite3_value ** argv)
 {
@@ -36099,20 +36457,11 @@ load_dxf (sqlite3 * db_handle, struct splite_internal_cache *cache,
 	  ret = 0;
 	  goto stop_dxf;
       }
-/* attempting to parse the DXF input file */
-    if (gaiaParseDxfFile_r (cache, dxf, filename))
-      {
-	  /* loading into the DB */
-	  if (!gaiaLoadFromDxfParser (db_handle, dxf, mode, append))
-	    {
-		ret = 0;
-		spatialite_e ("DB error while loading: %s\n", filename);
-	    }
-      }
-    else
+/* attempting to parse the DXF input file and loading into the DB */
+    if (!gaiaStreamDxfFile_r (cache, db_handle, dxf, filename, mode, append))
       {
 	  ret = 0;
-	  spatialite_e ("Unable to parse: %s\n", filename);
+	  spatialite_e ("Unable to load: %s\n", filename);
 	  goto stop_dxf;
       }
     spatialite_e ("\n*** DXF file successfully loaded\n");
@@ -37146,6 +37495,80 @@ fnct_sp_get_last_error (sqlite3_context * context, int argc,
 	sqlite3_result_text (context, msg, strlen (msg), SQLITE_STATIC);
 }
 
+static void
+fnct_sp_cache_stats (sqlite3_context * context, int argc,
+		     sqlite3_value ** argv)
+{
+/* SQL function:
+/ SqlProc_CacheStats(BLOB)
+/     or
+/ SqlProc_CacheStats(BLOB, text item)
+/     or
+/ SqlProc_CacheStats(BLOB, text item, int statement)
+/
+/ returns the execution statistics of an SQL Procedure cached by the
+/ current connection, either for the whole SQL Body or for its Nth
+/ statement (1-based); item is one of 'executions' (default),
+/ 'statements', 'seconds' or 'average'
+/ or NULL if the SQL Procedure is not cached or on invalid arguments
+*/
+    const unsigned char *blob;
+    int blob_sz;
+    const char *item = "executions";
+    int statement = 0;
+    sqlite3_int64 executions;
+    int statements;
+    double seconds;
+    void *data = sqlite3_user_data (context);
+    GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (sqlite3_value_type (argv[0]) != SQLITE_BLOB)
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    blob = sqlite3_value_blob (argv[0]);
+    blob_sz = sqlite3_value_bytes (argv[0]);
+    if (argc >= 2)
+      {
+	  if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  item = (const char *) sqlite3_value_text (argv[1]);
+      }
+    if (argc >= 3)
+      {
+	  if (sqlite3_value_type (argv[2]) != SQLITE_INTEGER)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+	  statement = sqlite3_value_int (argv[2]);
+	  if (statement < 1)
+	    {
+		sqlite3_result_null (context);
+		return;
+	    }
+      }
+    if (!gaia_sql_proc_cache_stats
+	(data, blob, blob_sz, statement, &executions, &statements, &seconds))
+      {
+	  sqlite3_result_null (context);
+	  return;
+      }
+    if (strcasecmp (item, "executions") == 0)
+	sqlite3_result_int64 (context, executions);
+    else if (strcasecmp (item, "statements") == 0)
+	sqlite3_result_int (context, statements);
+    else if (strcasecmp (item, "seconds") == 0)
+	sqlite3_result_double (context, seconds);
+    else if (strcasecmp (item, "average") == 0 && executions > 0)
+	sqlite3_result_double (context, seconds / (double) executions);
+    else
+	sqlite3_result_null (context);
+}
+
 static void
 fnct_sp_set_logfile (sqlite3_context * context, int argc, sqlite3_value ** argv)
 {
@@ -37793,6 +38216,24 @@ get_sql_proc_variables (const void *cache, int argc, sqlite3_value ** argv)
     return list;
 }
 
+#define SQLPROC_MAX_ARGS	65
+
+static int
+check_sqlproc_arg_count (sqlite3_context * context, int argc,
+			 const char *fnct_name)
+{
+/* checking the number of args passed to a variadic SQL Procedure function */
+    char *msg;
+    if (argc >= 1 && argc <= SQLPROC_MAX_ARGS)
+	return 1;
+    msg =
+	sqlite3_mprintf ("wrong number of arguments to function %s()",
+			 fnct_name);
+    sqlite3_result_error (context, msg, -1);
+    sqlite3_free (msg);
+    return 0;
+}
+
 static void
 fnct_sp_cooked_sql (sqlite3_context * context, int argc, sqlite3_value ** argv)
 {
@@ -37811,6 +38252,8 @@ fnct_sp_cooked_sql (sqlite3_context * context, int argc, sqlite3_value ** argv)
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
     struct splite_internal_cache *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (!check_sqlproc_arg_count (context, argc, "SqlProc_CookedSQL"))
+	return;
     if (sqlite3_value_type (argv[0]) != SQLITE_BLOB)
 	goto invalid_blob_argument;
     blob = sqlite3_value_blob (argv[0]);
@@ -37891,6 +38334,8 @@ fnct_sp_execute (sqlite3_context * context, int argc, sqlite3_value ** argv)
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
     struct splite_internal_cache *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (!check_sqlproc_arg_count (context, argc, "SqlProc_Execute"))
+	return;
     if (sqlite3_value_type (argv[0]) != SQLITE_BLOB)
 	goto invalid_blob_argument;
     blob = sqlite3_value_blob (argv[0]);
@@ -38011,6 +38456,8 @@ fnct_sp_execute_loop (sqlite3_context * context, int argc,
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
     struct splite_internal_cache *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (!check_sqlproc_arg_count (context, argc, "SqlProc_ExecuteLoop"))
+	return;
 
     while (1)
       {
@@ -38433,6 +38880,8 @@ fnct_sp_stored_execute (sqlite3_context * context, int argc,
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
     struct splite_internal_cache *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (!check_sqlproc_arg_count (context, argc, "StoredProc_Execute"))
+	return;
     if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
 	goto invalid_name_argument;
     name = (const char *) sqlite3_value_text (argv[0]);
@@ -38568,6 +39017,8 @@ fnct_sp_stored_execute_loop (sqlite3_context * context, int argc,
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
     struct splite_internal_cache *cache = sqlite3_user_data (context);
     GAIA_UNUSED ();		/* LCOV_EXCL_LINE */
+    if (!check_sqlproc_arg_count (context, argc, "StoredProc_ExecuteLoop"))
+	return;
 
     while (1)
       {
@@ -38674,6 +39125,41 @@ fnct_sp_stored_execute_loop (sqlite3_context * context, int argc,
     return;
 }
 
+/*
+/ the SQL Procedure functions accepting a variable list of args
+/ (BLOB or name, followed by up to 64 @var@=value assignments)
+/
+/ this precomputed table is shared by all connections: each function
+/ is registered once as variadic (nArg = -1) instead of once per arity
+*/
+struct splite_variadic_function
+{
+    const char *name;
+    void (*xFunc) (sqlite3_context *, int, sqlite3_value **);
+};
+
+static const struct splite_variadic_function splite_sqlproc_functions[] = {
+    {"SqlProc_CookedSQL", fnct_sp_cooked_sql},
+    {"SqlProc_Execute", fnct_sp_execute},
+    {"SqlProc_ExecuteLoop", fnct_sp_execute_loop},
+    {"StoredProc_Execute", fnct_sp_stored_execute},
+    {"StoredProc_ExecuteLoop", fnct_sp_stored_execute_loop},
+    {NULL, NULL}
+};
+
+static void
+register_sqlproc_variadic_functions (sqlite3 * db, void *cache)
+{
+/* registering all SQL Procedure variadic functions */
+    const struct splite_variadic_function *p = splite_sqlproc_functions;
+    while (p->name != NULL)
+      {
+	  sqlite3_create_function_v2 (db, p->name, -1, SQLITE_UTF8, cache,
+				      p->xFunc, 0, 0, 0);
+	  p++;
+      }
+}
+
 static void
 fnct_sp_var_register (sqlite3_context * context, int argc,
 		      sqlite3_value ** argv)
@@ -39066,6 +39552,12 @@ fnct_create_routing (sqlite3_context * context, int argc, sqlite3_value ** argv)
 /               geom-column TEXT , cost-column TEXT , name-column TEXT ,
 /               a-star-enabled BOOLEAN , bidirectional BOOLEAN ,
 /               oneway-from TEXT , oneway-to TEXT , overwrite BOOLEAN )
+/ CreateRouting(routing-data-table TEXT , virtual-routing-table TEXT , 
+/               input-table TEXT , from-column TEXT , to-column TEXT , 
+/               geom-column TEXT , cost-column TEXT , name-column TEXT ,
+/               a-star-enabled BOOLEAN , bidirectional BOOLEAN ,
+/               oneway-from TEXT , oneway-to TEXT , overwrite BOOLEAN ,
+/               speed-profile-table TEXT , turn-restriction-table TEXT )
 /
 / returns:
 / 1 on succes
@@ -39084,6 +39576,8 @@ fnct_create_routing (sqlite3_context * context, int argc, sqlite3_value ** argv)
     const char *oneway_from = NULL;
     const char *oneway_to = NULL;
     int overwrite = 0;
+    const char *profile_table = NULL;
+    const char *restriction_table = NULL;
     const char *msg;
     sqlite3 *sqlite = sqlite3_context_db_handle (context);
     struct splite_internal_cache *cache = sqlite3_user_data (context);
@@ -39151,11 +39645,26 @@ fnct_create_routing (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	      goto invalid_argument_13;
 	  overwrite = sqlite3_value_int (argv[12]);
       }
-    if (gaia_create_routing
+    if (argc >= 15)
+      {
+	  if (sqlite3_value_type (argv[13]) == SQLITE_NULL)
+	      profile_table = NULL;
+	  else if (sqlite3_value_type (argv[13]) == SQLITE_TEXT)
+	      profile_table = (const char *) sqlite3_value_text (argv[13]);
+	  else
+	      goto invalid_argument_14;
+	  if (sqlite3_value_type (argv[14]) == SQLITE_NULL)
+	      restriction_table = NULL;
+	  else if (sqlite3_value_type (argv[14]) == SQLITE_TEXT)
+	      restriction_table = (const char *) sqlite3_value_text (argv[14]);
+	  else
+	      goto invalid_argument_15;
+      }
+    if (gaia_create_routing_ex
 	(sqlite, cache, routing_data_table, virtual_routing_table,
 	 input_table, from_column, to_column, geom_column, cost_column,
 	 name_column, a_star_enabled, bidirectional, oneway_from, oneway_to,
-	 overwrite))
+	 overwrite, profile_table, restriction_table))
 	sqlite3_result_int (context, 1);
     else
       {
@@ -39249,6 +39758,18 @@ fnct_create_routing (sqlite3_context * context, int argc, sqlite3_value ** argv)
 	"CreateRouting exception - illegal OverWrite option [not an INTEGER].";
     sqlite3_result_error (context, msg, -1);
     return;
+
+  invalid_argument_14:
+    msg =
+	"CreateRouting exception - illegal SpeedProfile Table Name [not a TEXT string].";
+    sqlite3_result_error (context, msg, -1);
+    return;
+
+  invalid_argument_15:
+    msg =
+	"CreateRouting exception - illegal TurnRestriction Table Name [not a TEXT string].";
+    sqlite3_result_error (context, msg, -1);
+    return;
 }
 
 static void
@@ -40143,7 +40664,7 @@ fnct_ExportSHP (sqlite3_context * context, int argc, sqlite3_value ** argv)
 
 #ifdef PROJ_NEW			/* only if new PROJ.6 is supported */
     if (cache != NULL)
-	proj_ctx = cache->PROJ_handle;
+	proj_ctx = splite_get_proj_handle (cache);
 #endif
     ret =
 	dump_shapefile_ex2 (db_handle, proj_ctx, table, column, path, charset,
@@ -48251,6 +48772,12 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "spatialite_target_cpu", 0,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_spatialite_target_cpu, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "spatialite_connection_pool", 0,
+				SQLITE_UTF8, 0,
+				fnct_spatialite_connection_pool, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "spatialite_connection_pool", 1,
+				SQLITE_UTF8, 0,
+				fnct_spatialite_connection_pool, 0, 0, 0);
     sqlite3_create_function_v2 (db, "check_strict_sql_quoting", 0,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_check_strict_sql_quoting, 0, 0, 0);
@@ -48437,6 +48964,15 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_InitAdvancedMetaData, 0, 0, 0);
 
+    sqlite3_create_function_v2 (db, "InitSpatialMetaDataLazy", 0,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_InitSpatialMetaDataLazy, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "InitSpatialMetaDataLazy", 1,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_InitSpatialMetaDataLazy, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "InitSpatialMetaDataLazy", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_InitSpatialMetaDataLazy, 0, 0, 0);
     sqlite3_create_function_v2 (db, "InitSpatialMetaDataFull", 0,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_InitSpatialMetaDataFull, 0, 0, 0);
@@ -48561,6 +49097,10 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "CreateMbrCache", 2,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_CreateMbrCache, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "MbrCacheMemoryUsage", 0,
+				SQLITE_UTF8, 0, fnct_MbrCacheMemoryUsage, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "MbrCacheMemoryUsage", 2,
+				SQLITE_UTF8, 0, fnct_MbrCacheMemoryUsage, 0, 0, 0);
     sqlite3_create_function_v2 (db, "DisableSpatialIndex", 2,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_DisableSpatialIndex, 0, 0, 0);
@@ -48594,6 +49134,12 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "InvalidateLayerStatistics", 2,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_InvalidateLayerStatistics, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "EnableIncrementalStatistics", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_EnableIncrementalStatistics, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "DisableIncrementalStatistics", 2,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				fnct_DisableIncrementalStatistics, 0, 0, 0);
     sqlite3_create_function_v2 (db, "CreateRasterCoveragesTable", 0,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				fnct_CreateRasterCoveragesTable, 0, 0, 0);
@@ -50204,6 +50750,12 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 				cache, fnct_sp_get_last_error, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SqlProc_GetLogfile", 0, SQLITE_UTF8,
 				cache, fnct_sp_get_logfile, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "SqlProc_CacheStats", 1, SQLITE_UTF8,
+				cache, fnct_sp_cache_stats, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "SqlProc_CacheStats", 2, SQLITE_UTF8,
+				cache, fnct_sp_cache_stats, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "SqlProc_CacheStats", 3, SQLITE_UTF8,
+				cache, fnct_sp_cache_stats, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SqlProc_FromText", 1, SQLITE_UTF8,
 				cache, fnct_sp_from_text, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SqlProc_FromText", 2, SQLITE_UTF8,
@@ -50222,396 +50774,7 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 				0, fnct_sp_is_valid_var, 0, 0, 0);
     sqlite3_create_function_v2 (db, "SqlProc_RawSQL", 1, SQLITE_UTF8, 0,
 				fnct_sp_raw_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 1, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 2, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 3, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 4, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 5, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 6, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 7, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 8, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 9, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 10, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 11, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 12, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 13, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 14, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 15, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 16, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 17, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 18, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 19, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 20, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 21, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 22, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 23, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 24, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 25, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 26, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 27, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 28, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 29, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 30, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 31, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 32, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 33, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 34, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 35, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 36, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 37, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 38, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 39, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 40, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 41, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 42, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 43, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 44, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 45, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 46, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 47, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 48, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 49, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 50, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 51, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 52, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 53, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 54, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 55, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 56, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 57, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 58, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 59, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 60, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 61, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 62, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 63, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 64, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_CookedSQL", 65, SQLITE_UTF8,
-				cache, fnct_sp_cooked_sql, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 1, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 2, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 3, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 4, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 5, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 6, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 7, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 8, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 9, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 10, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 11, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 12, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 13, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 14, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 15, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 16, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 17, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 18, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 19, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 20, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 21, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 22, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 23, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 24, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 25, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 26, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 27, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 28, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 29, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 30, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 31, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 32, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 33, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 34, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 35, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 36, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 37, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 38, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 39, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 40, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 41, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 42, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 43, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 44, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 45, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 46, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 47, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 48, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 49, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 50, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 51, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 52, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 53, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 54, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 55, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 56, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 57, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 58, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 59, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 60, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 61, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 62, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 63, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 64, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_Execute", 65, SQLITE_UTF8, cache,
-				fnct_sp_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 1, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 2, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 3, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 4, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 5, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 6, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 7, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 8, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 9, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 10, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 11, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 12, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 13, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 14, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 15, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 16, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 17, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 18, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 19, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 20, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 21, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 22, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 23, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 24, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 25, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 26, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 27, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 28, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 29, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 30, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 31, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 32, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 33, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 34, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 35, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 36, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 37, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 38, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 39, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 40, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 41, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 42, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 43, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 44, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 45, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 46, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 47, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 48, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 49, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 50, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 51, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 52, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 53, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 54, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 55, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 56, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 57, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 58, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 59, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 60, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 61, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 62, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 63, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 64, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "SqlProc_ExecuteLoop", 65, SQLITE_UTF8,
-				cache, fnct_sp_execute_loop, 0, 0, 0);
+    register_sqlproc_variadic_functions (db, cache);
     sqlite3_create_function_v2 (db, "SqlProc_Return", 1, SQLITE_UTF8, cache,
 				fnct_sp_return, 0, 0, 0);
     sqlite3_create_function_v2 (db, "StoredProc_Return", 1, SQLITE_UTF8, cache,
@@ -50640,266 +50803,6 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 				cache, fnct_sp_var_update_title, 0, 0, 0);
     sqlite3_create_function_v2 (db, "StoredVar_UpdateValue", 2, SQLITE_UTF8,
 				cache, fnct_sp_var_update_value, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 1, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 2, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 3, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 4, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 5, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 6, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 7, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 8, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 9, SQLITE_UTF8, cache,
-				fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 10, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 11, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 12, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 13, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 14, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 15, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 16, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 17, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 18, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 19, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 20, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 21, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 22, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 23, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 24, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 25, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 26, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 27, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 28, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 29, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 30, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 31, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 32, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 33, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 34, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 35, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 36, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 37, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 38, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 39, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 40, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 41, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 42, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 43, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 44, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 45, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 46, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 47, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 48, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 49, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 50, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 51, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 52, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 53, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 54, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 55, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 56, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 57, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 58, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 59, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 60, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 61, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 62, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 63, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 64, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_Execute", 65, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 1, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 2, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 3, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 4, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 5, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 6, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 7, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 8, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 9, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 10, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 11, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 12, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 13, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 14, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 15, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 16, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 17, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 18, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 19, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 20, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 21, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 22, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 23, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 24, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 25, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 26, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 27, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 28, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 29, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 30, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 31, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 32, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 33, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 34, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 35, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 36, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 37, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 38, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 39, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 40, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 41, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 42, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 43, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 44, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 45, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 46, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 47, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 48, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 49, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 50, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 51, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 52, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 53, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 54, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 55, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 56, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 57, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 58, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 59, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 60, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 61, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 62, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 63, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 64, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
-    sqlite3_create_function_v2 (db, "StoredProc_ExecuteLoop", 65, SQLITE_UTF8,
-				cache, fnct_sp_stored_execute_loop, 0, 0, 0);
     sqlite3_create_function_v2 (db, "CreateRoutingNodes", 5, SQLITE_UTF8, cache,
 				fnct_create_routing_nodes, 0, 0, 0);
     sqlite3_create_function_v2 (db, "CreateRouting", 7, SQLITE_UTF8, cache,
@@ -50910,6 +50813,8 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 				fnct_create_routing, 0, 0, 0);
     sqlite3_create_function_v2 (db, "CreateRouting", 13, SQLITE_UTF8, cache,
 				fnct_create_routing, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "CreateRouting", 15, SQLITE_UTF8, cache,
+				fnct_create_routing, 0, 0, 0);
     sqlite3_create_function_v2 (db, "CreateRouting_GetLastError", 0,
 				SQLITE_UTF8, cache,
 				fnct_create_routing_get_last_error, 0, 0, 0);
@@ -51113,6 +51018,18 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
 	  sqlite3_create_function_v2 (db, "ExportGeoJSON", 5,
 				      SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				      fnct_ExportGeoJSON, 0, 0, 0);
+	  sqlite3_create_function_v2 (db, "ExportColumnar", 3,
+				      SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				      fnct_ExportColumnar, 0, 0, 0);
+	  sqlite3_create_function_v2 (db, "ExportColumnar", 4,
+				      SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				      fnct_ExportColumnar, 0, 0, 0);
+	  sqlite3_create_function_v2 (db, "ExportColumnar", 5,
+				      SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				      fnct_ExportColumnar, 0, 0, 0);
+	  sqlite3_create_function_v2 (db, "ExportColumnar", 6,
+				      SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
+				      fnct_ExportColumnar, 0, 0, 0);
 	  sqlite3_create_function_v2 (db, "ExportGeoJSON2", 3,
 				      SQLITE_UTF8 | SQLITE_DETERMINISTIC, 0,
 				      fnct_ExportGeoJSON2, 0, 0, 0);
@@ -52484,6 +52401,9 @@ register_spatialite_sql_functions (void *p_db, const void *p_cache)
     sqlite3_create_function_v2 (db, "ST_Cutter", 9,
 				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
 				fnct_Cutter, 0, 0, 0);
+    sqlite3_create_function_v2 (db, "ST_Cutter", 10,
+				SQLITE_UTF8 | SQLITE_DETERMINISTIC, cache,
+				fnct_Cutter, 0, 0, 0);
     sqlite3_create_function_v2 (db, "GetCutterMessage", 0,
 				SQLITE_UTF8, cache,
 				fnct_GetCutterMessage, 0, 0, 0);
@@ -53396,10 +53316,16 @@ init_spatialite_virtualtables (void *p_db, const void *p_cache)
     virtual_spatialindex_extension_init (db);
 /* initializing the VirtualElementary  extension */
     virtual_elementary_extension_init (db);
+/* initializing the VirtualColumnar  extension */
+    virtualcolumnar_extension_init (db);
 
 #ifndef OMIT_GEOS		/* only if GEOS is supported */
 /* initializing the VirtualRouting  extension */
     virtualrouting_extension_init (db);
+/* initializing the VirtualGrid  extension */
+    virtualgrid_extension_init (db, p_cache);
+/* initializing the VirtualDelaunay  extension */
+    virtualdelaunay_extension_init (db, p_cache);
 #ifndef OMIT_KNN		/* only if KNN is enabled */
 /* initializing the VirtualKNN  extension */
     virtual_knn_extension_init (db);
@@ -53488,6 +53414,8 @@ spatialite_splash_screen (int verbose)
 		    ("\t- 'VirtualSpatialIndex'\t[R*Tree metahandler]\n");
 		spatialite_i
 		    ("\t- 'VirtualElementary'\t[ElemGeoms metahandler]\n");
+		spatialite_i
+		    ("\t- 'VirtualColumnar'\t[chunked Columnar files]\n");
 
 #ifndef OMIT_GEOS		/* only if GEOS is supported */
 /* initializing the VirtualRouting  extension */
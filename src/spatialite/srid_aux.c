@@ -1790,7 +1790,8 @@ getProjParamsFromSpatialReferenceSystemTable (sqlite3 * sqlite, int srid,
 }
 
 static int
-coordinates_system_matches (struct epsg_defs *iter, const char *organization,
+coordinates_system_matches (const struct epsg_catalog_def *iter,
+			    const char *organization,
 			    const int organization_coordsys_id)
 {
     if (organization == NULL)
@@ -1818,9 +1819,11 @@ getProjParamsFromGeopackageTable (sqlite3 * sqlite, int srid,
     int ret;
     int len;
     char *errMsg = NULL;
-    struct epsg_defs *first = NULL;
-    struct epsg_defs *last = NULL;
-    struct epsg_defs *iter = NULL;
+    const struct epsg_catalog *const *blocks;
+    const struct epsg_catalog_def *iter = NULL;
+    int n_blocks;
+    int ib;
+    int i;
     const char *organization = NULL;
     int organization_coordsys_id = -1;
 
@@ -1871,29 +1874,39 @@ getProjParamsFromGeopackageTable (sqlite3 * sqlite, int srid,
     if (organization == NULL)
       {
 	  /* best-effort mode */
-	  initialize_epsg (srid, &first, &last);
-      }
-    else
-      {
-	  initialize_epsg (GAIA_EPSG_ANY, &first, &last);
-      }
-    iter = first;
-    while (iter)
-      {
-	  if (coordinates_system_matches
-	      (iter, organization, organization_coordsys_id))
+	  iter = find_epsg_def (srid);
+	  if (iter != NULL
+	      && coordinates_system_matches (iter, organization,
+					     organization_coordsys_id))
 	    {
 		len = strlen (iter->proj4text);
 		*proj_params = malloc (len + 1);
 		strcpy (*proj_params, iter->proj4text);
-		free_epsg (first);
 		sqlite3_free_table (results);
 		return;
 	    }
-	  iter = iter->next;
+      }
+    else
+      {
+	  blocks = get_epsg_catalog (GAIA_EPSG_ANY, &n_blocks);
+	  for (ib = 0; ib < n_blocks; ib++)
+	    {
+		for (i = 0; i < blocks[ib]->count; i++)
+		  {
+		      iter = blocks[ib]->defs + i;
+		      if (coordinates_system_matches
+			  (iter, organization, organization_coordsys_id))
+			{
+			    len = strlen (iter->proj4text);
+			    *proj_params = malloc (len + 1);
+			    strcpy (*proj_params, iter->proj4text);
+			    sqlite3_free_table (results);
+			    return;
+			}
+		  }
+	    }
       }
     /* if we get here, we didn't find a match */
-    free_epsg (first);
     sqlite3_free_table (results);
     spatialite_e ("unknown SRID: %d\n", srid);
 }
@@ -1748,6 +1748,468 @@ update_layer_statistics (sqlite3 * sqlite, const char *table,
     return 1;
 }
 
+static int
+do_get_statistics_layer (sqlite3 * sqlite, const char *table,
+			 const char *column, char **f_table_name,
+			 char **f_geometry_column)
+{
+/* retrieving the GEOMETRY_COLUMNS names of some table/geometry */
+    char *sql_statement;
+    int ret;
+    int i;
+    char **results;
+    int rows;
+    int columns;
+    int len;
+    const char *name;
+
+    *f_table_name = NULL;
+    *f_geometry_column = NULL;
+    sql_statement =
+	sqlite3_mprintf ("SELECT f_table_name, f_geometry_column "
+			 "FROM geometry_columns WHERE Lower(f_table_name) = Lower(%Q) "
+			 "AND Lower(f_geometry_column) = Lower(%Q)", table,
+			 column);
+    ret =
+	sqlite3_get_table (sqlite, sql_statement, &results, &rows, &columns,
+			   NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	return 0;
+    for (i = 1; i <= rows; i++)
+      {
+	  name = results[(i * columns) + 0];
+	  len = strlen (name);
+	  *f_table_name = malloc (len + 1);
+	  strcpy (*f_table_name, name);
+	  name = results[(i * columns) + 1];
+	  len = strlen (name);
+	  *f_geometry_column = malloc (len + 1);
+	  strcpy (*f_geometry_column, name);
+	  break;
+      }
+    sqlite3_free_table (results);
+    if (*f_table_name == NULL)
+	return 0;
+    return 1;
+}
+
+static int
+do_drop_statistics_triggers (sqlite3 * sqlite, const char *table,
+			     const char *column)
+{
+/* dropping the incremental statistics triggers of some table/geometry */
+    char *sql_statement;
+    char *raw;
+    char *quoted_trigger;
+    const char *prefix[3] = { "sti", "stu", "std" };
+    int ret;
+    int i;
+
+    for (i = 0; i < 3; i++)
+      {
+	  raw = sqlite3_mprintf ("%s_%s_%s", prefix[i], table, column);
+	  quoted_trigger = gaiaDoubleQuotedSql (raw);
+	  sqlite3_free (raw);
+	  sql_statement =
+	      sqlite3_mprintf ("DROP TRIGGER IF EXISTS main.\"%s\"",
+			       quoted_trigger);
+	  free (quoted_trigger);
+	  ret = sqlite3_exec (sqlite, sql_statement, NULL, NULL, NULL);
+	  sqlite3_free (sql_statement);
+	  if (ret != SQLITE_OK)
+	      return 0;
+      }
+    return 1;
+}
+
+static void
+do_statistics_trigger_extent (gaiaOutBufferPtr out_buf, const char *geom)
+{
+/* growing the Layer Extent so to include NEW.geometry */
+    char *sql_statement;
+    sql_statement =
+	sqlite3_mprintf ("extent_min_x = CASE WHEN MbrMinX(NEW.\"%s\") IS NULL "
+			 "THEN extent_min_x WHEN extent_min_x IS NULL OR MbrMinX(NEW.\"%s\") < extent_min_x "
+			 "THEN MbrMinX(NEW.\"%s\") ELSE extent_min_x END,\n"
+			 "extent_min_y = CASE WHEN MbrMinY(NEW.\"%s\") IS NULL "
+			 "THEN extent_min_y WHEN extent_min_y IS NULL OR MbrMinY(NEW.\"%s\") < extent_min_y "
+			 "THEN MbrMinY(NEW.\"%s\") ELSE extent_min_y END,\n"
+			 "extent_max_x = CASE WHEN MbrMaxX(NEW.\"%s\") IS NULL "
+			 "THEN extent_max_x WHEN extent_max_x IS NULL OR MbrMaxX(NEW.\"%s\") > extent_max_x "
+			 "THEN MbrMaxX(NEW.\"%s\") ELSE extent_max_x END,\n"
+			 "extent_max_y = CASE WHEN MbrMaxY(NEW.\"%s\") IS NULL "
+			 "THEN extent_max_y WHEN extent_max_y IS NULL OR MbrMaxY(NEW.\"%s\") > extent_max_y "
+			 "THEN MbrMaxY(NEW.\"%s\") ELSE extent_max_y END,\n",
+			 geom, geom, geom, geom, geom, geom, geom, geom, geom,
+			 geom, geom, geom);
+    gaiaAppendToOutBuffer (out_buf, sql_statement);
+    sqlite3_free (sql_statement);
+}
+
+static void
+do_statistics_trigger_layer (gaiaOutBufferPtr out_buf, const char *table,
+			     const char *column, const char *geom,
+			     char **results, int rows, int columns,
+			     int mode)
+{
+/* 
+/ updating GEOMETRY_COLUMNS_STATISTICS from within a trigger
+/
+/ mode: 0 = INSERT, 1 = UPDATE, 2 = DELETE
+/
+/ whenever the cheap incremental update can't be trusted (the OLD row
+/ was touching the Extent, or was holding some min/max/max_size value
+/ not found again within the first 256 rows of the table) last_verified
+/ will be set to NULL, so that the next call to UpdateLayerStatistics()
+/ will perform a full recomputation
+*/
+    char *sql_statement;
+    char *quoted;
+    char *quoted_table;
+    const char *col_name;
+    int ordinal;
+    int i;
+
+    gaiaAppendToOutBuffer (out_buf,
+			   "UPDATE geometry_columns_statistics SET\n");
+    if (mode == 0)
+	gaiaAppendToOutBuffer (out_buf, "row_count = row_count + 1,\n");
+    if (mode == 2)
+	gaiaAppendToOutBuffer (out_buf, "row_count = row_count - 1,\n");
+    if (mode != 2)
+	do_statistics_trigger_extent (out_buf, geom);
+    sql_statement =
+	sqlite3_mprintf ("last_verified = CASE WHEN last_verified IS NULL "
+			 "OR row_count IS NULL OR (SELECT Count(*) FROM geometry_columns_field_infos "
+			 "WHERE f_table_name = %Q AND f_geometry_column = %Q) <> %d",
+			 table, column, rows);
+    gaiaAppendToOutBuffer (out_buf, sql_statement);
+    sqlite3_free (sql_statement);
+    if (mode != 0)
+      {
+	  /* the OLD row could be required in order to shrink the Layer */
+	  if (mode == 1)
+	    {
+		/* an unchanged Geometry can't shrink anything */
+		sql_statement =
+		    sqlite3_mprintf
+		    ("\nOR (OLD.\"%s\" IS NOT NEW.\"%s\" AND (MbrMinX(OLD.\"%s\") <= extent_min_x "
+		     "OR MbrMinY(OLD.\"%s\") <= extent_min_y OR MbrMaxX(OLD.\"%s\") >= extent_max_x "
+		     "OR MbrMaxY(OLD.\"%s\") >= extent_max_y))", geom, geom,
+		     geom, geom, geom, geom);
+	    }
+	  else
+	      sql_statement =
+		  sqlite3_mprintf
+		  ("\nOR MbrMinX(OLD.\"%s\") <= extent_min_x OR MbrMinY(OLD.\"%s\") <= extent_min_y "
+		   "OR MbrMaxX(OLD.\"%s\") >= extent_max_x OR MbrMaxY(OLD.\"%s\") >= extent_max_y",
+		   geom, geom, geom, geom);
+	  gaiaAppendToOutBuffer (out_buf, sql_statement);
+	  sqlite3_free (sql_statement);
+      }
+    if (mode != 0 && rows > 0)
+      {
+	  /* or could be required in order to shrink some Field Info */
+	  quoted_table = gaiaDoubleQuotedSql (table);
+	  sql_statement =
+	      sqlite3_mprintf
+	      ("\nOR EXISTS (SELECT 1 FROM geometry_columns_field_infos "
+	       "WHERE f_table_name = %Q AND f_geometry_column = %Q AND (",
+	       table, column);
+	  gaiaAppendToOutBuffer (out_buf, sql_statement);
+	  sqlite3_free (sql_statement);
+	  for (i = 1; i <= rows; i++)
+	    {
+		ordinal = atoi (results[(i * columns) + 0]);
+		col_name = results[(i * columns) + 1];
+		quoted = gaiaDoubleQuotedSql (col_name);
+		sql_statement =
+		    sqlite3_mprintf
+		    ("%s(ordinal = %d AND column_name = %Q AND ("
+		     "(typeof(OLD.\"%s\") IN ('text', 'blob') AND length(OLD.\"%s\") >= max_size "
+		     "AND NOT EXISTS (SELECT 1 FROM (SELECT \"%s\" FROM \"%s\" LIMIT 256) WHERE typeof(\"%s\") IN ('text', 'blob') "
+		     "AND length(\"%s\") >= max_size)) "
+		     "OR (typeof(OLD.\"%s\") = 'integer' AND integer_min IS NOT NULL "
+		     "AND ((OLD.\"%s\" <= integer_min AND NOT EXISTS (SELECT 1 FROM (SELECT \"%s\" FROM \"%s\" LIMIT 256) WHERE \"%s\" <= integer_min)) "
+		     "OR (OLD.\"%s\" >= integer_max AND NOT EXISTS (SELECT 1 FROM (SELECT \"%s\" FROM \"%s\" LIMIT 256) WHERE \"%s\" >= integer_max)))) "
+		     "OR (typeof(OLD.\"%s\") = 'real' AND double_min IS NOT NULL "
+		     "AND ((OLD.\"%s\" <= double_min AND NOT EXISTS (SELECT 1 FROM (SELECT \"%s\" FROM \"%s\" LIMIT 256) WHERE \"%s\" <= double_min)) "
+		     "OR (OLD.\"%s\" >= double_max AND NOT EXISTS (SELECT 1 FROM (SELECT \"%s\" FROM \"%s\" LIMIT 256) WHERE \"%s\" >= double_max)))) "
+		     "OR (integer_min IS NULL AND double_min IS NULL AND ("
+		     "(typeof(OLD.\"%s\") IN ('real', 'text', 'blob') AND integer_values > 0 "
+		     "AND double_values + text_values + blob_values = 1) "
+		     "OR (typeof(OLD.\"%s\") IN ('integer', 'text', 'blob') AND double_values > 0 "
+		     "AND integer_values + text_values + blob_values = 1)))))",
+		     (i == 1) ? "" : "\nOR ", ordinal, col_name, quoted,
+		     quoted, quoted, quoted_table, quoted, quoted, quoted,
+		     quoted, quoted, quoted_table, quoted, quoted, quoted,
+		     quoted_table, quoted, quoted, quoted, quoted,
+		     quoted_table, quoted, quoted, quoted, quoted_table,
+		     quoted, quoted, quoted);
+		free (quoted);
+		gaiaAppendToOutBuffer (out_buf, sql_statement);
+		sqlite3_free (sql_statement);
+	    }
+	  gaiaAppendToOutBuffer (out_buf, "))");
+	  free (quoted_table);
+      }
+    sql_statement =
+	sqlite3_mprintf
+	("\nTHEN NULL ELSE strftime('%%Y-%%m-%%dT%%H:%%M:%%fZ', 'now') END\n"
+	 "WHERE f_table_name = %Q AND f_geometry_column = %Q;\n", table,
+	 column);
+    gaiaAppendToOutBuffer (out_buf, sql_statement);
+    sqlite3_free (sql_statement);
+}
+
+static void
+do_statistics_trigger_fields (gaiaOutBufferPtr out_buf, const char *table,
+			      const char *column, char **results, int rows,
+			      int columns, int mode)
+{
+/* 
+/ updating GEOMETRY_COLUMNS_FIELD_INFOS from within a trigger
+/
+/ mode: 0 = INSERT, 1 = UPDATE, 2 = DELETE
+/
+/ the OLD values are simply subtracted from the counters, because
+/ any OLD value able to affect min/max/max_size has already
+/ invalidated the Layer Statistics; the NEW values are added
+/ by strictly following the same rules of doComputeFieldInfos()
+*/
+    char *sql_statement;
+    char *quoted;
+    const char *col_name;
+    int ordinal;
+    int i;
+
+    for (i = 1; i <= rows; i++)
+      {
+	  ordinal = atoi (results[(i * columns) + 0]);
+	  col_name = results[(i * columns) + 1];
+	  quoted = gaiaDoubleQuotedSql (col_name);
+	  if (mode != 0)
+	    {
+		/* removing the OLD value */
+		sql_statement =
+		    sqlite3_mprintf
+		    ("UPDATE geometry_columns_field_infos SET "
+		     "null_values = null_values - (typeof(OLD.\"%s\") = 'null'), "
+		     "integer_values = integer_values - (typeof(OLD.\"%s\") = 'integer'), "
+		     "double_values = double_values - (typeof(OLD.\"%s\") = 'real'), "
+		     "text_values = text_values - (typeof(OLD.\"%s\") = 'text'), "
+		     "blob_values = blob_values - (typeof(OLD.\"%s\") = 'blob')\n"
+		     "WHERE f_table_name = %Q AND f_geometry_column = %Q "
+		     "AND ordinal = %d AND column_name = %Q;\n", quoted,
+		     quoted, quoted, quoted, quoted, table, column, ordinal,
+		     col_name);
+		gaiaAppendToOutBuffer (out_buf, sql_statement);
+		sqlite3_free (sql_statement);
+	    }
+	  if (mode != 2)
+	    {
+		/* adding the NEW value */
+		sql_statement =
+		    sqlite3_mprintf
+		    ("UPDATE geometry_columns_field_infos SET "
+		     "null_values = null_values + (typeof(NEW.\"%s\") = 'null'), "
+		     "integer_values = integer_values + (typeof(NEW.\"%s\") = 'integer'), "
+		     "double_values = double_values + (typeof(NEW.\"%s\") = 'real'), "
+		     "text_values = text_values + (typeof(NEW.\"%s\") = 'text'), "
+		     "blob_values = blob_values + (typeof(NEW.\"%s\") = 'blob'),\n"
+		     "max_size = CASE WHEN typeof(NEW.\"%s\") IN ('text', 'blob') "
+		     "AND (max_size IS NULL OR length(NEW.\"%s\") > max_size) "
+		     "THEN length(NEW.\"%s\") ELSE max_size END,\n"
+		     "integer_min = CASE typeof(NEW.\"%s\") WHEN 'null' THEN integer_min "
+		     "WHEN 'integer' THEN CASE WHEN double_values > 0 OR text_values > 0 OR blob_values > 0 THEN NULL "
+		     "WHEN integer_min IS NULL OR NEW.\"%s\" < integer_min THEN NEW.\"%s\" "
+		     "ELSE integer_min END ELSE NULL END,\n"
+		     "integer_max = CASE typeof(NEW.\"%s\") WHEN 'null' THEN integer_max "
+		     "WHEN 'integer' THEN CASE WHEN double_values > 0 OR text_values > 0 OR blob_values > 0 THEN NULL "
+		     "WHEN integer_max IS NULL OR NEW.\"%s\" > integer_max THEN NEW.\"%s\" "
+		     "ELSE integer_max END ELSE NULL END,\n"
+		     "double_min = CASE typeof(NEW.\"%s\") WHEN 'null' THEN double_min "
+		     "WHEN 'real' THEN CASE WHEN integer_values > 0 OR text_values > 0 OR blob_values > 0 THEN NULL "
+		     "WHEN double_min IS NULL OR NEW.\"%s\" < double_min THEN NEW.\"%s\" "
+		     "ELSE double_min END ELSE NULL END,\n"
+		     "double_max = CASE typeof(NEW.\"%s\") WHEN 'null' THEN double_max "
+		     "WHEN 'real' THEN CASE WHEN integer_values > 0 OR text_values > 0 OR blob_values > 0 THEN NULL "
+		     "WHEN double_max IS NULL OR NEW.\"%s\" > double_max THEN NEW.\"%s\" "
+		     "ELSE double_max END ELSE NULL END\n"
+		     "WHERE f_table_name = %Q AND f_geometry_column = %Q "
+		     "AND ordinal = %d AND column_name = %Q;\n", quoted,
+		     quoted, quoted, quoted, quoted, quoted, quoted, quoted,
+		     quoted, quoted, quoted, quoted, quoted, quoted, quoted,
+		     quoted, quoted, quoted, quoted, quoted, table, column,
+		     ordinal, col_name);
+		gaiaAppendToOutBuffer (out_buf, sql_statement);
+		sqlite3_free (sql_statement);
+	    }
+	  free (quoted);
+      }
+}
+
+static int
+do_create_statistics_trigger (sqlite3 * sqlite, const char *table,
+			      const char *column, char **results, int rows,
+			      int columns, int mode)
+{
+/* creating an incremental statistics trigger */
+    char *sql_statement;
+    char *raw;
+    char *quoted_trigger;
+    char *quoted_table;
+    char *quoted_column;
+    const char *prefix;
+    const char *event;
+    int ret;
+    gaiaOutBuffer out_buf;
+
+    switch (mode)
+      {
+      case 0:
+	  prefix = "sti";
+	  event = "INSERT";
+	  break;
+      case 1:
+	  prefix = "stu";
+	  event = "UPDATE";
+	  break;
+      default:
+	  prefix = "std";
+	  event = "DELETE";
+	  break;
+      };
+    raw = sqlite3_mprintf ("%s_%s_%s", prefix, table, column);
+    quoted_trigger = gaiaDoubleQuotedSql (raw);
+    sqlite3_free (raw);
+    quoted_table = gaiaDoubleQuotedSql (table);
+    quoted_column = gaiaDoubleQuotedSql (column);
+    gaiaOutBufferInitialize (&out_buf);
+    sql_statement =
+	sqlite3_mprintf ("CREATE TRIGGER main.\"%s\" AFTER %s ON \"%s\"\n"
+			 "FOR EACH ROW BEGIN\n", quoted_trigger, event,
+			 quoted_table);
+    free (quoted_trigger);
+    free (quoted_table);
+    gaiaAppendToOutBuffer (&out_buf, sql_statement);
+    sqlite3_free (sql_statement);
+/* the Layer Statistics must be checked before touching the Field Infos */
+    do_statistics_trigger_layer (&out_buf, table, column, quoted_column,
+				 results, rows, columns, mode);
+    do_statistics_trigger_fields (&out_buf, table, column, results, rows,
+				  columns, mode);
+    free (quoted_column);
+    gaiaAppendToOutBuffer (&out_buf, "END");
+    if (out_buf.Error || out_buf.Buffer == NULL)
+      {
+	  gaiaOutBufferReset (&out_buf);
+	  return 0;
+      }
+    ret = sqlite3_exec (sqlite, out_buf.Buffer, NULL, NULL, NULL);
+    gaiaOutBufferReset (&out_buf);
+    if (ret != SQLITE_OK)
+	return 0;
+    return 1;
+}
+
+SPATIALITE_DECLARE int
+gaiaStatisticsEnableIncremental (sqlite3 * sqlite, const char *table,
+				 const char *column)
+{
+/* 
+/ enabling trigger-maintained (incremental) Layer Statistics
+/ for a single table/geometry
+*/
+    char *f_table_name = NULL;
+    char *f_geometry_column = NULL;
+    char *sql_statement;
+    char *quoted;
+    int ret;
+    char **results;
+    int rows;
+    int columns;
+    int error = 0;
+    int mode;
+
+    if (checkSpatialMetaData (sqlite) != 3)
+	return 0;
+    if (table == NULL || column == NULL)
+	return 0;
+    if (!do_get_statistics_layer
+	(sqlite, table, column, &f_table_name, &f_geometry_column))
+	return 0;
+
+/* starting from a fully recomputed state */
+    if (!do_drop_statistics_triggers (sqlite, f_table_name, f_geometry_column))
+	goto error;
+    if (!do_compute_layer_statistics
+	(sqlite, f_table_name, f_geometry_column,
+	 SPATIALITE_STATISTICS_GENUINE))
+	goto error;
+
+/* retrieving the column names (same ordinals as doComputeFieldInfos) */
+    quoted = gaiaDoubleQuotedSql (f_table_name);
+    sql_statement =
+	sqlite3_mprintf ("PRAGMA table_info(\"%s\")", quoted);
+    free (quoted);
+    ret =
+	sqlite3_get_table (sqlite, sql_statement, &results, &rows, &columns,
+			   NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+	goto error;
+    for (mode = 0; mode < 3; mode++)
+      {
+	  if (!do_create_statistics_trigger
+	      (sqlite, f_table_name, f_geometry_column, results, rows, columns,
+	       mode))
+	    {
+		error = 1;
+		break;
+	    }
+      }
+    sqlite3_free_table (results);
+    if (error)
+      {
+	  do_drop_statistics_triggers (sqlite, f_table_name,
+				       f_geometry_column);
+	  goto error;
+      }
+    free (f_table_name);
+    free (f_geometry_column);
+    return 1;
+
+  error:
+    free (f_table_name);
+    free (f_geometry_column);
+    return 0;
+}
+
+SPATIALITE_DECLARE int
+gaiaStatisticsDisableIncremental (sqlite3 * sqlite, const char *table,
+				  const char *column)
+{
+/* disabling trigger-maintained (incremental) Layer Statistics */
+    char *f_table_name = NULL;
+    char *f_geometry_column = NULL;
+    int ret;
+
+    if (checkSpatialMetaData (sqlite) != 3)
+	return 0;
+    if (table == NULL || column == NULL)
+	return 0;
+    if (!do_get_statistics_layer
+	(sqlite, table, column, &f_table_name, &f_geometry_column))
+	return 0;
+    ret =
+	do_drop_statistics_triggers (sqlite, f_table_name, f_geometry_column);
+    free (f_table_name);
+    free (f_geometry_column);
+    return ret;
+}
+
 struct table_params
 {
 /* a struct supporting Drop Table / Rename Table / Rename Column */
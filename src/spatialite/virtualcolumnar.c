@@ -0,0 +1,1113 @@
+/*
+
+ virtualcolumnar.c -- SQLite3 extension [VIRTUAL TABLE accessing Columnar files]
+
+ version 5.1, 2026 October 18
+
+ -----------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2008-2021
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+
+/*
+/ a Columnar file (as written by dump_columnar) is laid out as:
+/
+/ HEADER:  signature (8 bytes), INT32 n_columns, INT32 + name of the
+/          Geometry column, then for each attribute column: the storage
+/          type (1 byte: SQLITE_INTEGER, SQLITE_FLOAT, SQLITE_TEXT or
+/          SQLITE_BLOB) and INT32 + name
+/ CHUNKS:  marker, INT32 rows, INT32 srid, has_z, has_m, encoding,
+/          INT32 precision, INT64 payload size, then the payload:
+/          - INT32 geometry types [rows] (0 = NULL, +1000 Z, +2000 M)
+/          - INT32 n_parts, n_rings, n_vertices
+/          - INT32 offsets: rows -> parts [rows + 1],
+/            part types [n_parts], parts -> rings [n_parts + 1],
+/            rings -> vertices [n_rings + 1]
+/          - coordinates: RAW doubles or DELTA INT32 size + varints
+/          - for each attribute: NULL bitmap, INT64 / DOUBLE values or
+/            INT32 offsets [rows + 1] followed by the TEXT/BLOB bytes
+/ TRAILER: END marker, INT64 total rows
+/
+/ all numbers are little-endian
+*/
+
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "config-msvc.h"
+#else
+#include "config.h"
+#endif
+
+#include <spatialite/sqlite.h>
+#include <spatialite/debug.h>
+
+#include <spatialite/spatialite_ext.h>
+#include <spatialite/gaiaaux.h>
+#include <spatialite/gaiageo.h>
+
+static struct sqlite3_module my_columnar_module;
+
+typedef struct VirtualColumnarStruct
+{
+/* extends the sqlite3_vtab struct */
+    const sqlite3_module *pModule;	/* ptr to sqlite module: USED INTERNALLY BY SQLITE */
+    int nRef;			/* # references: USED INTERNALLY BY SQLITE */
+    char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
+    sqlite3 *db;		/* the sqlite db holding the virtual table */
+    char *path;			/* the Columnar file path */
+    int Valid;			/* TRUE if the Columnar file is valid */
+    int nColumns;		/* number of attribute columns */
+    int *Types;			/* attribute storage types */
+    long DataStart;		/* file offset of the first chunk */
+    sqlite3_int64 TotalRows;	/* total number of rows */
+} VirtualColumnar;
+typedef VirtualColumnar *VirtualColumnarPtr;
+
+typedef struct VirtualColumnarAttrStruct
+{
+/* an attribute column of the current chunk */
+    const unsigned char *validity;	/* the NULL bitmap */
+    const unsigned char *values;	/* INT64 / DOUBLE values or INT32 offsets */
+    const unsigned char *data;	/* TEXT / BLOB bytes */
+    int data_size;
+} VirtualColumnarAttr;
+typedef VirtualColumnarAttr *VirtualColumnarAttrPtr;
+
+typedef struct VirtualColumnarCursorStruct
+{
+/* extends the sqlite3_vtab_cursor struct */
+    VirtualColumnarPtr pVtab;	/* Virtual table of this cursor */
+    FILE *fl;			/* the Columnar file */
+    int eof;			/* the EOF marker */
+    sqlite3_int64 current_row;	/* the current ROWID */
+    unsigned char *payload;	/* the current chunk */
+    int n_rows;			/* number of rows in the current chunk */
+    int chunk_row;		/* the current row within the chunk */
+    int srid;
+    int has_z;
+    int has_m;
+    int encoding;
+    int precision;
+    int n_parts;
+    int n_rings;
+    int n_vertices;
+    int *geom_types;
+    int *geom_offsets;
+    int *part_types;
+    int *part_offsets;
+    int *ring_offsets;
+    const unsigned char *raw_coords;	/* undecoded coordinates */
+    int raw_coords_size;
+    double *coords;		/* decoded coordinates (lazily) */
+    VirtualColumnarAttrPtr attrs;
+} VirtualColumnarCursor;
+typedef VirtualColumnarCursor *VirtualColumnarCursorPtr;
+
+static FILE *
+vcol_open_file (const char *path)
+{
+/* opening a Columnar file for reading */
+#ifdef _WIN32
+    return gaia_win_fopen (path, "rb");
+#else
+    return fopen (path, "rb");
+#endif
+}
+
+static char *
+vcol_read_name (FILE * fl, int endian_arch)
+{
+/* reading a length-prefixed name from the file header */
+    unsigned char buf[4];
+    int len;
+    char *name;
+    if (fread (buf, 1, 4, fl) != 4)
+	return NULL;
+    len = gaiaImport32 (buf, 1, endian_arch);
+    if (len <= 0 || len > 65535)
+	return NULL;
+    name = malloc (len + 1);
+    if (fread (name, 1, len, fl) != (size_t) len)
+      {
+	  free (name);
+	  return NULL;
+      }
+    *(name + len) = '\0';
+    return name;
+}
+
+static char *
+vcol_read_header (VirtualColumnarPtr p_vt, FILE * fl, const char *table)
+{
+/* parsing the Columnar header and building the CREATE TABLE statement */
+    unsigned char buf[16];
+    int endian_arch = gaiaEndianArch ();
+    int i;
+    char *name;
+    char *xname;
+    char *sql;
+    char *prev;
+    const char *type;
+
+    if (fread (buf, 1, 12, fl) != 12)
+	return NULL;
+    if (memcmp (buf, GAIA_COLUMNAR_SIGNATURE, 8) != 0)
+	return NULL;
+    p_vt->nColumns = gaiaImport32 (buf + 8, 1, endian_arch);
+    if (p_vt->nColumns < 0 || p_vt->nColumns > 32767)
+	return NULL;
+    name = vcol_read_name (fl, endian_arch);
+    if (name == NULL)
+	return NULL;
+    xname = gaiaDoubleQuotedSql (table);
+    sql = sqlite3_mprintf ("CREATE TABLE \"%s\" (", xname);
+    free (xname);
+    xname = gaiaDoubleQuotedSql (name);
+    free (name);
+/* the Geometry column is declared after all attribute columns */
+    name = sqlite3_mprintf ("\"%s\" BLOB)", xname);
+    free (xname);
+    if (p_vt->nColumns > 0)
+	p_vt->Types = malloc (sizeof (int) * p_vt->nColumns);
+    for (i = 0; i < p_vt->nColumns; i++)
+      {
+	  char *col;
+	  if (fread (buf, 1, 1, fl) != 1)
+	      goto error;
+	  p_vt->Types[i] = buf[0];
+	  switch (buf[0])
+	    {
+	    case SQLITE_INTEGER:
+		type = "INTEGER";
+		break;
+	    case SQLITE_FLOAT:
+		type = "DOUBLE";
+		break;
+	    case SQLITE_TEXT:
+		type = "TEXT";
+		break;
+	    case SQLITE_BLOB:
+		type = "BLOB";
+		break;
+	    default:
+		goto error;
+	    };
+	  col = vcol_read_name (fl, endian_arch);
+	  if (col == NULL)
+	      goto error;
+	  xname = gaiaDoubleQuotedSql (col);
+	  free (col);
+	  prev = sql;
+	  sql = sqlite3_mprintf ("%s\"%s\" %s, ", prev, xname, type);
+	  sqlite3_free (prev);
+	  free (xname);
+      }
+    prev = sql;
+    sql = sqlite3_mprintf ("%s%s", prev, name);
+    sqlite3_free (prev);
+    sqlite3_free (name);
+    p_vt->DataStart = ftell (fl);
+
+/* checking the trailer (so to detect truncated files) */
+    if (fseek (fl, -9, SEEK_END) != 0)
+	goto error2;
+    if (fread (buf, 1, 9, fl) != 9)
+	goto error2;
+    if (buf[0] != GAIA_COLUMNAR_END)
+	goto error2;
+    p_vt->TotalRows = gaiaImportI64 (buf + 1, 1, endian_arch);
+    if (p_vt->TotalRows < 0)
+	goto error2;
+    return sql;
+
+  error:
+    sqlite3_free (name);
+  error2:
+    sqlite3_free (sql);
+    return NULL;
+}
+
+static int
+vcol_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	     sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* creates the virtual table connected to some Columnar file */
+    char *sql = NULL;
+    VirtualColumnarPtr p_vt;
+    char path[2048];
+    const char *pPath;
+    int len;
+    char *xname;
+    FILE *fl;
+    if (pAux)
+	pAux = pAux;		/* unused arg warning suppression */
+/* checking for the Columnar file PATH */
+    if (argc == 4)
+      {
+	  pPath = argv[3];
+	  len = strlen (pPath);
+	  if (len >= (int) sizeof (path))
+	    {
+		*pzErr =
+		    sqlite3_mprintf
+		    ("[VirtualColumnar module] CREATE VIRTUAL: path too long");
+		return SQLITE_ERROR;
+	    }
+	  if ((*(pPath + 0) == '\'' || *(pPath + 0) == '"')
+	      && (*(pPath + len - 1) == '\'' || *(pPath + len - 1) == '"'))
+	    {
+		/* the path is enclosed between quotes - we need to dequote it */
+		strcpy (path, pPath + 1);
+		len = strlen (path);
+		*(path + len - 1) = '\0';
+	    }
+	  else
+	      strcpy (path, pPath);
+      }
+    else
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualColumnar module] CREATE VIRTUAL: illegal arg list {columnar_path}");
+	  return SQLITE_ERROR;
+      }
+    p_vt = (VirtualColumnarPtr) sqlite3_malloc (sizeof (VirtualColumnar));
+    if (!p_vt)
+	return SQLITE_NOMEM;
+    p_vt->pModule = &my_columnar_module;
+    p_vt->nRef = 0;
+    p_vt->zErrMsg = NULL;
+    p_vt->db = db;
+    p_vt->path = malloc (strlen (path) + 1);
+    strcpy (p_vt->path, path);
+    p_vt->Valid = 0;
+    p_vt->nColumns = 0;
+    p_vt->Types = NULL;
+    p_vt->DataStart = 0;
+    p_vt->TotalRows = 0;
+
+/* attempting to open the Columnar file for reading */
+    fl = vcol_open_file (path);
+    if (fl == NULL)
+	spatialite_e ("VirtualColumnar: unable to open %s for reading\n",
+		      path);
+    else
+      {
+	  sql = vcol_read_header (p_vt, fl, argv[2]);
+	  fclose (fl);
+	  if (sql == NULL)
+	      spatialite_e ("VirtualColumnar: %s is not a valid Columnar file\n",
+			    path);
+      }
+    if (sql != NULL)
+      {
+	  if (sqlite3_declare_vtab (db, sql) == SQLITE_OK)
+	    {
+		sqlite3_free (sql);
+		p_vt->Valid = 1;
+		*ppVTab = (sqlite3_vtab *) p_vt;
+		return SQLITE_OK;
+	    }
+	  sqlite3_free (sql);
+      }
+
+/* something is going the wrong way; creating a stupid default table */
+    p_vt->nColumns = 0;
+    xname = gaiaDoubleQuotedSql ((const char *) argv[2]);
+    sql = sqlite3_mprintf ("CREATE TABLE \"%s\" (Geometry BLOB)", xname);
+    free (xname);
+    if (sqlite3_declare_vtab (db, sql) != SQLITE_OK)
+      {
+	  sqlite3_free (sql);
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualColumnar module] cannot build a table from the Columnar file\n");
+	  return SQLITE_ERROR;
+      }
+    sqlite3_free (sql);
+    *ppVTab = (sqlite3_vtab *) p_vt;
+    return SQLITE_OK;
+}
+
+static int
+vcol_connect (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	      sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* connects the virtual table to some Columnar file - simply aliases vcol_create() */
+    return vcol_create (db, pAux, argc, argv, ppVTab, pzErr);
+}
+
+static int
+vcol_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIndex)
+{
+/* best index selection - always a sequential scan of all chunks */
+    VirtualColumnarPtr p_vt = (VirtualColumnarPtr) pVTab;
+    pIndex->estimatedCost = (double) (p_vt->TotalRows + 1);
+#if SQLITE_VERSION_NUMBER >= 3008002
+    pIndex->estimatedRows = p_vt->TotalRows;
+#endif
+    return SQLITE_OK;
+}
+
+static int
+vcol_disconnect (sqlite3_vtab * pVTab)
+{
+/* disconnects the virtual table */
+    VirtualColumnarPtr p_vt = (VirtualColumnarPtr) pVTab;
+    if (p_vt->path != NULL)
+	free (p_vt->path);
+    if (p_vt->Types != NULL)
+	free (p_vt->Types);
+    sqlite3_free (p_vt);
+    return SQLITE_OK;
+}
+
+static int
+vcol_destroy (sqlite3_vtab * pVTab)
+{
+/* destroys the virtual table - simply aliases vcol_disconnect() */
+    return vcol_disconnect (pVTab);
+}
+
+static void
+vcol_reset_chunk (VirtualColumnarCursorPtr cursor)
+{
+/* memory cleanup - releasing the current chunk */
+    if (cursor->payload != NULL)
+	free (cursor->payload);
+    if (cursor->geom_types != NULL)
+	free (cursor->geom_types);
+    if (cursor->geom_offsets != NULL)
+	free (cursor->geom_offsets);
+    if (cursor->part_types != NULL)
+	free (cursor->part_types);
+    if (cursor->part_offsets != NULL)
+	free (cursor->part_offsets);
+    if (cursor->ring_offsets != NULL)
+	free (cursor->ring_offsets);
+    if (cursor->coords != NULL)
+	free (cursor->coords);
+    cursor->payload = NULL;
+    cursor->geom_types = NULL;
+    cursor->geom_offsets = NULL;
+    cursor->part_types = NULL;
+    cursor->part_offsets = NULL;
+    cursor->ring_offsets = NULL;
+    cursor->coords = NULL;
+    cursor->raw_coords = NULL;
+    cursor->raw_coords_size = 0;
+    cursor->n_rows = 0;
+    cursor->chunk_row = 0;
+}
+
+static const unsigned char *
+vcol_take (const unsigned char **ptr, const unsigned char *end,
+	   sqlite3_int64 len)
+{
+/* consuming some bytes from the chunk payload (with bounds check) */
+    const unsigned char *p = *ptr;
+    if (len < 0 || len > end - p)
+	return NULL;
+    *ptr = p + len;
+    return p;
+}
+
+static int *
+vcol_read_ints (const unsigned char **ptr, const unsigned char *end,
+		int count, int max_value, int endian_arch)
+{
+/*
+/ decoding an array of INT32 offsets
+/ always starting from zero, never decreasing and ending
+/ exactly at max_value
+*/
+    int i;
+    int *values;
+    const unsigned char *p = vcol_take (ptr, end, (sqlite3_int64) count * 4);
+    if (p == NULL)
+	return NULL;
+    values = malloc (sizeof (int) * (count + 1));
+    for (i = 0; i < count; i++)
+      {
+	  values[i] = gaiaImport32 (p + (i * 4), 1, endian_arch);
+	  if (i == 0 && values[i] != 0)
+	      goto error;
+	  if (i > 0 && values[i] < values[i - 1])
+	      goto error;
+      }
+    if (count > 0 && values[count - 1] != max_value)
+	goto error;
+    return values;
+  error:
+    free (values);
+    return NULL;
+}
+
+static int
+vcol_parse_chunk (VirtualColumnarCursorPtr cursor, sqlite3_int64 size)
+{
+/* parsing (and validating) the payload of the current chunk */
+    int i;
+    int row;
+    int endian_arch = gaiaEndianArch ();
+    const unsigned char *ptr = cursor->payload;
+    const unsigned char *end = cursor->payload + size;
+    const unsigned char *p;
+    int dims = 2 + cursor->has_z + cursor->has_m;
+
+/* Geometry types */
+    p = vcol_take (&ptr, end, (sqlite3_int64) cursor->n_rows * 4);
+    if (p == NULL)
+	return 0;
+    cursor->geom_types = malloc (sizeof (int) * cursor->n_rows);
+    for (row = 0; row < cursor->n_rows; row++)
+	cursor->geom_types[row] = gaiaImport32 (p + (row * 4), 1, endian_arch);
+    p = vcol_take (&ptr, end, 12);
+    if (p == NULL)
+	return 0;
+    cursor->n_parts = gaiaImport32 (p, 1, endian_arch);
+    cursor->n_rings = gaiaImport32 (p + 4, 1, endian_arch);
+    cursor->n_vertices = gaiaImport32 (p + 8, 1, endian_arch);
+    if (cursor->n_parts < 0 || cursor->n_rings < 0 || cursor->n_vertices < 0)
+	return 0;
+
+/* Geometry offsets */
+    cursor->geom_offsets =
+	vcol_read_ints (&ptr, end, cursor->n_rows + 1, cursor->n_parts,
+			endian_arch);
+    if (cursor->geom_offsets == NULL)
+	return 0;
+    p = vcol_take (&ptr, end, (sqlite3_int64) cursor->n_parts * 4);
+    if (p == NULL)
+	return 0;
+    cursor->part_types = malloc (sizeof (int) * (cursor->n_parts + 1));
+    for (i = 0; i < cursor->n_parts; i++)
+      {
+	  int type = gaiaImport32 (p + (i * 4), 1, endian_arch);
+	  if (type != GAIA_POINT && type != GAIA_LINESTRING
+	      && type != GAIA_POLYGON)
+	      return 0;
+	  cursor->part_types[i] = type;
+      }
+    cursor->part_offsets =
+	vcol_read_ints (&ptr, end, cursor->n_parts + 1, cursor->n_rings,
+			endian_arch);
+    if (cursor->part_offsets == NULL)
+	return 0;
+    cursor->ring_offsets =
+	vcol_read_ints (&ptr, end, cursor->n_rings + 1, cursor->n_vertices,
+			endian_arch);
+    if (cursor->ring_offsets == NULL)
+	return 0;
+    for (i = 0; i < cursor->n_parts; i++)
+      {
+	  /* checking the Rings of each Part */
+	  int rings = cursor->part_offsets[i + 1] - cursor->part_offsets[i];
+	  int ring = cursor->part_offsets[i];
+	  if (rings < 1)
+	      return 0;
+	  if (cursor->part_types[i] == GAIA_POINT)
+	    {
+		if (rings != 1
+		    || cursor->ring_offsets[ring + 1] -
+		    cursor->ring_offsets[ring] != 1)
+		    return 0;
+	    }
+	  else if (cursor->part_types[i] == GAIA_LINESTRING && rings != 1)
+	      return 0;
+      }
+
+/* coordinates (decoded lazily) */
+    if (cursor->encoding == GAIA_COLUMNAR_RAW)
+      {
+	  if ((sqlite3_int64) cursor->n_vertices * dims * 8 > end - ptr)
+	      return 0;
+	  cursor->raw_coords_size = cursor->n_vertices * dims * 8;
+      }
+    else if (cursor->encoding == GAIA_COLUMNAR_DELTA)
+      {
+	  p = vcol_take (&ptr, end, 4);
+	  if (p == NULL)
+	      return 0;
+	  cursor->raw_coords_size = gaiaImport32 (p, 1, endian_arch);
+	  /* each varint takes at least one byte */
+	  if ((sqlite3_int64) cursor->n_vertices * dims >
+	      cursor->raw_coords_size)
+	      return 0;
+      }
+    else
+	return 0;
+    cursor->raw_coords = vcol_take (&ptr, end, cursor->raw_coords_size);
+    if (cursor->raw_coords == NULL)
+	return 0;
+
+/* attribute columns */
+    for (i = 0; i < cursor->pVtab->nColumns; i++)
+      {
+	  VirtualColumnarAttrPtr attr = cursor->attrs + i;
+	  int type = cursor->pVtab->Types[i];
+	  attr->validity = vcol_take (&ptr, end, (cursor->n_rows + 7) / 8);
+	  if (attr->validity == NULL)
+	      return 0;
+	  attr->data = NULL;
+	  attr->data_size = 0;
+	  if (type == SQLITE_INTEGER || type == SQLITE_FLOAT)
+	    {
+		attr->values =
+		    vcol_take (&ptr, end, (sqlite3_int64) cursor->n_rows * 8);
+		if (attr->values == NULL)
+		    return 0;
+	    }
+	  else
+	    {
+		attr->values =
+		    vcol_take (&ptr, end,
+			       ((sqlite3_int64) cursor->n_rows + 1) * 4);
+		if (attr->values == NULL)
+		    return 0;
+		attr->data_size =
+		    gaiaImport32 (attr->values + (cursor->n_rows * 4), 1,
+				  endian_arch);
+		for (row = 0; row < cursor->n_rows; row++)
+		  {
+		      int off =
+			  gaiaImport32 (attr->values + (row * 4), 1,
+					endian_arch);
+		      if (off < 0 || off > attr->data_size)
+			  return 0;
+		  }
+		attr->data = vcol_take (&ptr, end, attr->data_size);
+		if (attr->data == NULL)
+		    return 0;
+	    }
+      }
+    return 1;
+}
+
+static void
+vcol_read_chunk (VirtualColumnarCursorPtr cursor)
+{
+/* loading the next chunk of rows */
+    unsigned char header[24];
+    sqlite3_int64 size;
+    int endian_arch = gaiaEndianArch ();
+
+    vcol_reset_chunk (cursor);
+    while (1)
+      {
+	  if (fread (header, 1, 1, cursor->fl) != 1)
+	      goto error;
+	  if (header[0] == GAIA_COLUMNAR_END)
+	    {
+		/* normal EOF */
+		cursor->eof = 1;
+		return;
+	    }
+	  if (header[0] != GAIA_COLUMNAR_CHUNK)
+	      goto error;
+	  if (fread (header + 1, 1, 23, cursor->fl) != 23)
+	      goto error;
+	  cursor->n_rows = gaiaImport32 (header + 1, 1, endian_arch);
+	  cursor->srid = gaiaImport32 (header + 5, 1, endian_arch);
+	  cursor->has_z = header[9] ? 1 : 0;
+	  cursor->has_m = header[10] ? 1 : 0;
+	  cursor->encoding = header[11];
+	  cursor->precision = gaiaImport32 (header + 12, 1, endian_arch);
+	  size = gaiaImportI64 (header + 16, 1, endian_arch);
+	  if (cursor->n_rows < 0 || size < 0 || size > 0x7fffffff)
+	      goto error;
+	  if (cursor->precision < 0 || cursor->precision > 15)
+	      goto error;
+	  if (cursor->n_rows == 0)
+	    {
+		/* skipping an empty chunk */
+		if (fseek (cursor->fl, (long) size, SEEK_CUR) != 0)
+		    goto error;
+		continue;
+	    }
+	  cursor->payload = malloc (size > 0 ? size : 1);
+	  if (cursor->payload == NULL)
+	      goto error;
+	  if (fread (cursor->payload, 1, size, cursor->fl) != (size_t) size)
+	      goto error;
+	  if (!vcol_parse_chunk (cursor, size))
+	      goto error;
+	  return;
+      }
+
+  error:
+    spatialite_e ("VirtualColumnar: corrupted chunk in %s\n",
+		  cursor->pVtab->path);
+    vcol_reset_chunk (cursor);
+    cursor->eof = 1;
+}
+
+static int
+vcol_decode_coords (VirtualColumnarCursorPtr cursor)
+{
+/* decoding the coordinates of the current chunk */
+    int i;
+    int dims = 2 + cursor->has_z + cursor->has_m;
+    int count = cursor->n_vertices * dims;
+    int endian_arch = gaiaEndianArch ();
+    const unsigned char *p = cursor->raw_coords;
+    const unsigned char *end = cursor->raw_coords + cursor->raw_coords_size;
+    double scale;
+    sqlite3_int64 prev[4] = { 0, 0, 0, 0 };
+
+    if (cursor->coords != NULL)
+	return 1;
+    cursor->coords = malloc (sizeof (double) * (count > 0 ? count : 1));
+    if (cursor->encoding == GAIA_COLUMNAR_RAW)
+      {
+	  for (i = 0; i < count; i++)
+	      cursor->coords[i] = gaiaImport64 (p + (i * 8), 1, endian_arch);
+	  return 1;
+      }
+
+/* quantized deltas: zigzag + varint */
+    scale = 1.0;
+    for (i = 0; i < cursor->precision; i++)
+	scale *= 10.0;
+    for (i = 0; i < count; i++)
+      {
+	  sqlite3_uint64 zigzag = 0;
+	  sqlite3_int64 delta;
+	  int shift = 0;
+	  while (1)
+	    {
+		if (p >= end || shift > 63)
+		  {
+		      free (cursor->coords);
+		      cursor->coords = NULL;
+		      return 0;
+		  }
+		zigzag |= (sqlite3_uint64) (*p & 0x7f) << shift;
+		shift += 7;
+		if ((*p++ & 0x80) == 0)
+		    break;
+	    }
+	  delta = (sqlite3_int64) (zigzag >> 1) ^ -((sqlite3_int64) (zigzag & 1));
+	  prev[i % dims] += delta;
+	  cursor->coords[i] = (double) prev[i % dims] / scale;
+      }
+    return 1;
+}
+
+static void
+vcol_set_vertex (VirtualColumnarCursorPtr cursor, double *coords,
+		 int dims_model, int iv, int vertex)
+{
+/* copying a vertex into a Linestring or Ring */
+    int dims = 2 + cursor->has_z + cursor->has_m;
+    const double *in = cursor->coords + (vertex * dims);
+    double z = cursor->has_z ? in[2] : 0.0;
+    double m = cursor->has_m ? in[2 + cursor->has_z] : 0.0;
+    if (dims_model == GAIA_XY_Z)
+      {
+	  gaiaSetPointXYZ (coords, iv, in[0], in[1], z);
+      }
+    else if (dims_model == GAIA_XY_M)
+      {
+	  gaiaSetPointXYM (coords, iv, in[0], in[1], m);
+      }
+    else if (dims_model == GAIA_XY_Z_M)
+      {
+	  gaiaSetPointXYZM (coords, iv, in[0], in[1], z, m);
+      }
+    else
+      {
+	  gaiaSetPoint (coords, iv, in[0], in[1]);
+      }
+}
+
+static gaiaGeomCollPtr
+vcol_build_geometry (VirtualColumnarCursorPtr cursor)
+{
+/* building the Geometry of the current row */
+    gaiaGeomCollPtr geom;
+    gaiaLinestringPtr ln;
+    gaiaPolygonPtr pg;
+    gaiaRingPtr rng;
+    int ip;
+    int ir;
+    int iv;
+    int row = cursor->chunk_row;
+    int type = cursor->geom_types[row];
+    int dims_model = type / 1000;
+    int dims = 2 + cursor->has_z + cursor->has_m;
+
+    if (type == 0)
+	return NULL;
+    if (!vcol_decode_coords (cursor))
+	return NULL;
+    switch (dims_model)
+      {
+      case GAIA_XY_Z:
+	  geom = gaiaAllocGeomCollXYZ ();
+	  break;
+      case GAIA_XY_M:
+	  geom = gaiaAllocGeomCollXYM ();
+	  break;
+      case GAIA_XY_Z_M:
+	  geom = gaiaAllocGeomCollXYZM ();
+	  break;
+      default:
+	  geom = gaiaAllocGeomColl ();
+	  dims_model = GAIA_XY;
+	  break;
+      };
+    geom->Srid = cursor->srid;
+    geom->DeclaredType = type % 1000;
+
+    for (ip = cursor->geom_offsets[row]; ip < cursor->geom_offsets[row + 1];
+	 ip++)
+      {
+	  int first_ring = cursor->part_offsets[ip];
+	  int n_rings = cursor->part_offsets[ip + 1] - first_ring;
+	  for (ir = 0; ir < n_rings; ir++)
+	    {
+		int first = cursor->ring_offsets[first_ring + ir];
+		int points = cursor->ring_offsets[first_ring + ir + 1] - first;
+		if (cursor->part_types[ip] == GAIA_POINT)
+		  {
+		      const double *in = cursor->coords + (first * dims);
+		      double z = cursor->has_z ? in[2] : 0.0;
+		      double m = cursor->has_m ? in[2 + cursor->has_z] : 0.0;
+		      if (dims_model == GAIA_XY_Z)
+			  gaiaAddPointToGeomCollXYZ (geom, in[0], in[1], z);
+		      else if (dims_model == GAIA_XY_M)
+			  gaiaAddPointToGeomCollXYM (geom, in[0], in[1], m);
+		      else if (dims_model == GAIA_XY_Z_M)
+			  gaiaAddPointToGeomCollXYZM (geom, in[0], in[1], z,
+						      m);
+		      else
+			  gaiaAddPointToGeomColl (geom, in[0], in[1]);
+		      break;
+		  }
+		if (cursor->part_types[ip] == GAIA_LINESTRING)
+		  {
+		      ln = gaiaAddLinestringToGeomColl (geom, points);
+		      for (iv = 0; iv < points; iv++)
+			  vcol_set_vertex (cursor, ln->Coords, dims_model, iv,
+					   first + iv);
+		      break;
+		  }
+		if (ir == 0)
+		  {
+		      pg = gaiaAddPolygonToGeomColl (geom, points,
+						     n_rings - 1);
+		      rng = pg->Exterior;
+		  }
+		else
+		    rng = gaiaAddInteriorRing (pg, ir - 1, points);
+		for (iv = 0; iv < points; iv++)
+		    vcol_set_vertex (cursor, rng->Coords, dims_model, iv,
+				     first + iv);
+	    }
+      }
+    gaiaMbrGeometry (geom);
+    return geom;
+}
+
+static int
+vcol_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
+{
+/* opening a new cursor */
+    VirtualColumnarPtr p_vt = (VirtualColumnarPtr) pVTab;
+    VirtualColumnarCursorPtr cursor =
+	(VirtualColumnarCursorPtr)
+	sqlite3_malloc (sizeof (VirtualColumnarCursor));
+    if (cursor == NULL)
+	return SQLITE_ERROR;
+    cursor->pVtab = p_vt;
+    cursor->fl = NULL;
+    cursor->eof = 1;
+    cursor->current_row = 0;
+    cursor->payload = NULL;
+    cursor->geom_types = NULL;
+    cursor->geom_offsets = NULL;
+    cursor->part_types = NULL;
+    cursor->part_offsets = NULL;
+    cursor->ring_offsets = NULL;
+    cursor->coords = NULL;
+    cursor->attrs = NULL;
+    vcol_reset_chunk (cursor);
+    if (p_vt->nColumns > 0)
+	cursor->attrs = malloc (sizeof (VirtualColumnarAttr) * p_vt->nColumns);
+    if (p_vt->Valid)
+	cursor->fl = vcol_open_file (p_vt->path);
+    *ppCursor = (sqlite3_vtab_cursor *) cursor;
+    return SQLITE_OK;
+}
+
+static int
+vcol_close (sqlite3_vtab_cursor * pCursor)
+{
+/* closing the cursor */
+    VirtualColumnarCursorPtr cursor = (VirtualColumnarCursorPtr) pCursor;
+    vcol_reset_chunk (cursor);
+    if (cursor->attrs != NULL)
+	free (cursor->attrs);
+    if (cursor->fl != NULL)
+	fclose (cursor->fl);
+    sqlite3_free (pCursor);
+    return SQLITE_OK;
+}
+
+static int
+vcol_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
+	     int argc, sqlite3_value ** argv)
+{
+/* setting up a cursor filter - always a sequential scan */
+    VirtualColumnarCursorPtr cursor = (VirtualColumnarCursorPtr) pCursor;
+    if (idxNum || idxStr || argc || argv)
+	idxNum = idxNum;	/* unused arg warning suppression */
+    vcol_reset_chunk (cursor);
+    cursor->current_row = 0;
+    cursor->eof = 1;
+    if (cursor->fl == NULL)
+	return SQLITE_OK;
+    if (fseek (cursor->fl, cursor->pVtab->DataStart, SEEK_SET) != 0)
+	return SQLITE_OK;
+    cursor->eof = 0;
+    vcol_read_chunk (cursor);
+    if (!(cursor->eof))
+	cursor->current_row = 1;
+    return SQLITE_OK;
+}
+
+static int
+vcol_next (sqlite3_vtab_cursor * pCursor)
+{
+/* fetching a next row from cursor */
+    VirtualColumnarCursorPtr cursor = (VirtualColumnarCursorPtr) pCursor;
+    if (cursor->eof)
+	return SQLITE_OK;
+    cursor->chunk_row += 1;
+    if (cursor->chunk_row >= cursor->n_rows)
+	vcol_read_chunk (cursor);
+    if (!(cursor->eof))
+	cursor->current_row += 1;
+    return SQLITE_OK;
+}
+
+static int
+vcol_eof (sqlite3_vtab_cursor * pCursor)
+{
+/* cursor EOF */
+    VirtualColumnarCursorPtr cursor = (VirtualColumnarCursorPtr) pCursor;
+    return cursor->eof;
+}
+
+static int
+vcol_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
+	     int column)
+{
+/* fetching value for the Nth column */
+    VirtualColumnarCursorPtr cursor = (VirtualColumnarCursorPtr) pCursor;
+    VirtualColumnarAttrPtr attr;
+    int row = cursor->chunk_row;
+    int endian_arch = gaiaEndianArch ();
+    int start;
+    int stop;
+
+    if (cursor->eof)
+      {
+	  sqlite3_result_null (pContext);
+	  return SQLITE_OK;
+      }
+    if (column == cursor->pVtab->nColumns)
+      {
+	  /* the Geometry column */
+	  unsigned char *blob;
+	  int blob_size;
+	  gaiaGeomCollPtr geom = vcol_build_geometry (cursor);
+	  if (geom == NULL)
+	    {
+		sqlite3_result_null (pContext);
+		return SQLITE_OK;
+	    }
+	  gaiaToSpatiaLiteBlobWkb (geom, &blob, &blob_size);
+	  gaiaFreeGeomColl (geom);
+	  sqlite3_result_blob (pContext, blob, blob_size, free);
+	  return SQLITE_OK;
+      }
+    if (column < 0 || column > cursor->pVtab->nColumns)
+      {
+	  sqlite3_result_null (pContext);
+	  return SQLITE_OK;
+      }
+
+/* attribute columns */
+    attr = cursor->attrs + column;
+    if ((attr->validity[row / 8] & (1 << (row % 8))) == 0)
+      {
+	  sqlite3_result_null (pContext);
+	  return SQLITE_OK;
+      }
+    switch (cursor->pVtab->Types[column])
+      {
+      case SQLITE_INTEGER:
+	  sqlite3_result_int64 (pContext,
+				gaiaImportI64 (attr->values + (row * 8), 1,
+					       endian_arch));
+	  break;
+      case SQLITE_FLOAT:
+	  sqlite3_result_double (pContext,
+				 gaiaImport64 (attr->values + (row * 8), 1,
+					       endian_arch));
+	  break;
+      default:
+	  start = gaiaImport32 (attr->values + (row * 4), 1, endian_arch);
+	  stop = gaiaImport32 (attr->values + ((row + 1) * 4), 1, endian_arch);
+	  if (stop < start)
+	      stop = start;
+	  if (cursor->pVtab->Types[column] == SQLITE_BLOB)
+	      sqlite3_result_blob (pContext, attr->data + start, stop - start,
+				   SQLITE_TRANSIENT);
+	  else
+	      sqlite3_result_text (pContext, (const char *) attr->data + start,
+				   stop - start, SQLITE_TRANSIENT);
+	  break;
+      };
+    return SQLITE_OK;
+}
+
+static int
+vcol_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
+{
+/* fetching the ROWID */
+    VirtualColumnarCursorPtr cursor = (VirtualColumnarCursorPtr) pCursor;
+    *pRowid = cursor->current_row;
+    return SQLITE_OK;
+}
+
+static int
+vcol_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
+	     sqlite_int64 * pRowid)
+{
+/* generic update [INSERT / UPDATE / DELETE */
+    if (pVTab || argc || argv || pRowid)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_READONLY;
+}
+
+static int
+vcol_begin (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vcol_sync (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vcol_commit (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vcol_rollback (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vcol_rename (sqlite3_vtab * pVTab, const char *zNew)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    if (zNew)
+	zNew = zNew;		/* unused arg warning suppression */
+    return SQLITE_ERROR;
+}
+
+static int
+spliteVirtualColumnarInit (sqlite3 * db)
+{
+    int rc = SQLITE_OK;
+    my_columnar_module.iVersion = 1;
+    my_columnar_module.xCreate = &vcol_create;
+    my_columnar_module.xConnect = &vcol_connect;
+    my_columnar_module.xBestIndex = &vcol_best_index;
+    my_columnar_module.xDisconnect = &vcol_disconnect;
+    my_columnar_module.xDestroy = &vcol_destroy;
+    my_columnar_module.xOpen = &vcol_open;
+    my_columnar_module.xClose = &vcol_close;
+    my_columnar_module.xFilter = &vcol_filter;
+    my_columnar_module.xNext = &vcol_next;
+    my_columnar_module.xEof = &vcol_eof;
+    my_columnar_module.xColumn = &vcol_column;
+    my_columnar_module.xRowid = &vcol_rowid;
+    my_columnar_module.xUpdate = &vcol_update;
+    my_columnar_module.xBegin = &vcol_begin;
+    my_columnar_module.xSync = &vcol_sync;
+    my_columnar_module.xCommit = &vcol_commit;
+    my_columnar_module.xRollback = &vcol_rollback;
+    my_columnar_module.xFindFunction = NULL;
+    my_columnar_module.xRename = &vcol_rename;
+    sqlite3_create_module_v2 (db, "VirtualColumnar", &my_columnar_module,
+			      NULL, 0);
+    return rc;
+}
+
+SPATIALITE_PRIVATE int
+virtualcolumnar_extension_init (void *xdb)
+{
+    sqlite3 *db = (sqlite3 *) xdb;
+    return spliteVirtualColumnarInit (db);
+}
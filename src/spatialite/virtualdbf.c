@@ -100,6 +100,7 @@ typedef struct VirtualDbfCursorStruct
     VirtualDbfPtr pVtab;	/* Virtual table of this cursor */
     long current_row;		/* the current row ID */
     int eof;			/* the EOF marker */
+    char *ColUsed;		/* DBF fields to be fetched (NULL = all) */
     VirtualDbfConstraintPtr firstConstraint;
     VirtualDbfConstraintPtr lastConstraint;
 } VirtualDbfCursor;
@@ -354,19 +355,64 @@ vdbf_connect (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     return vdbf_create (db, pAux, argc, argv, ppVTab, pzErr);
 }
 
+static int
+vdbf_is_column_used (sqlite3_index_info * pIndex, int column)
+{
+/* checking if some column is referenced by the current query */
+#if SQLITE_VERSION_NUMBER >= 3010000
+    sqlite3_uint64 mask;
+    if (column >= 63)
+	mask = (sqlite3_uint64) 1 << 63;
+    else
+	mask = (sqlite3_uint64) 1 << column;
+    return (pIndex->colUsed & mask) ? 1 : 0;
+#else
+    if (pIndex != NULL || column)
+	pIndex = pIndex;	/* unused arg warning suppression */
+    return 1;
+#endif
+}
+
+static int
+vdbf_count_fields (VirtualDbfPtr p_vt)
+{
+/* counting how many fields are declared by the DBF */
+    int count = 0;
+    gaiaDbfFieldPtr pFld;
+    if (p_vt->dbf == NULL || !(p_vt->dbf->Valid) || p_vt->dbf->Dbf == NULL)
+	return 0;
+    pFld = p_vt->dbf->Dbf->First;
+    while (pFld)
+      {
+	  count++;
+	  pFld = pFld->Next;
+      }
+    return count;
+}
+
 static int
 vdbf_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIndex)
 {
 /* best index selection */
+    VirtualDbfPtr p_vt = (VirtualDbfPtr) pVTab;
     int i;
+    int iColumn;
     int iArg = 0;
-    char str[2048];
+    int nFields = vdbf_count_fields (p_vt);
+    char *flags = NULL;
     char buf[64];
+    gaiaOutBuffer idx;
 
-    if (pVTab)
-	pVTab = pVTab;		/* unused arg warning suppression */
+/* the DBF fields to be actually fetched */
+    if (nFields > 0)
+      {
+	  flags = malloc (nFields + 1);
+	  for (i = 0; i < nFields; i++)
+	      flags[i] = vdbf_is_column_used (pIndex, i + 1) ? '1' : '0';
+	  flags[nFields] = '\0';
+      }
 
-    *str = '\0';
+    gaiaOutBufferInitialize (&idx);
     for (i = 0; i < pIndex->nConstraint; i++)
       {
 	  if (pIndex->aConstraint[i].usable)
@@ -374,16 +420,29 @@ vdbf_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIndex)
 		iArg++;
 		pIndex->aConstraintUsage[i].argvIndex = iArg;
 		pIndex->aConstraintUsage[i].omit = 1;
-		sprintf (buf, "%d:%d,", pIndex->aConstraint[i].iColumn,
-			 pIndex->aConstraint[i].op);
-		strcat (str, buf);
+		iColumn = pIndex->aConstraint[i].iColumn;
+		sprintf (buf, "%d:%d,", iColumn, pIndex->aConstraint[i].op);
+		gaiaAppendToOutBuffer (&idx, buf);
+		if (flags != NULL && iColumn >= 1 && iColumn <= nFields)
+		    flags[iColumn - 1] = '1';	/* evaluated by vdbf_filter */
 	    }
       }
-    if (*str != '\0')
+    if (flags != NULL && strchr (flags, '0') != NULL)
       {
-	  pIndex->idxStr = sqlite3_mprintf ("%s", str);
+	  /* not all the DBF fields are required */
+	  pIndex->idxStr =
+	      sqlite3_mprintf ("%s;%s", flags,
+			       (idx.Buffer == NULL) ? "" : idx.Buffer);
 	  pIndex->needToFreeIdxStr = 1;
       }
+    else if (idx.Buffer != NULL && *(idx.Buffer) != '\0')
+      {
+	  pIndex->idxStr = sqlite3_mprintf ("%s", idx.Buffer);
+	  pIndex->needToFreeIdxStr = 1;
+      }
+    gaiaOutBufferReset (&idx);
+    if (flags != NULL)
+	free (flags);
 
     return SQLITE_OK;
 }
@@ -418,8 +477,9 @@ vdbf_read_row (VirtualDbfCursorPtr cursor, int *deleted_row)
 	  return;
       }
     ret =
-	gaiaReadDbfEntity_ex (cursor->pVtab->dbf, cursor->current_row, &deleted,
-			      cursor->pVtab->text_dates);
+	gaiaReadDbfEntity_ex2 (cursor->pVtab->dbf, cursor->current_row,
+			       &deleted, cursor->pVtab->text_dates,
+			       cursor->ColUsed);
     if (!ret)
       {
 	  if (!(cursor->pVtab->dbf->LastError))	/* normal DBF EOF */
@@ -447,6 +507,7 @@ vdbf_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
 	return SQLITE_ERROR;
     cursor->firstConstraint = NULL;
     cursor->lastConstraint = NULL;
+    cursor->ColUsed = NULL;
     cursor->pVtab = (VirtualDbfPtr) pVTab;
     cursor->current_row = 0;
     cursor->eof = 0;
@@ -487,6 +548,8 @@ vdbf_close (sqlite3_vtab_cursor * pCursor)
 /* closing the cursor */
     VirtualDbfCursorPtr cursor = (VirtualDbfCursorPtr) pCursor;
     vdbf_free_constraints (cursor);
+    if (cursor->ColUsed != NULL)
+	free (cursor->ColUsed);
     sqlite3_free (pCursor);
     return SQLITE_OK;
 }
@@ -805,6 +868,9 @@ vdbf_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
     int op;
     int len;
     int deleted;
+    int nFields;
+    const char *p = NULL;
+    const char *constraints = idxStr;
     VirtualDbfConstraintPtr pC;
     VirtualDbfCursorPtr cursor = (VirtualDbfCursorPtr) pCursor;
     if (idxNum)
@@ -813,9 +879,27 @@ vdbf_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
 /* resetting any previously set filter constraint */
     vdbf_free_constraints (cursor);
 
+/* setting up the DBF fields to be actually fetched */
+    if (cursor->ColUsed != NULL)
+	free (cursor->ColUsed);
+    cursor->ColUsed = NULL;
+    if (idxStr != NULL)
+	p = strchr (idxStr, ';');
+    if (p != NULL)
+      {
+	  constraints = p + 1;
+	  nFields = vdbf_count_fields (cursor->pVtab);
+	  if (nFields > 0 && (p - idxStr) == nFields)
+	    {
+		cursor->ColUsed = malloc (nFields);
+		for (i = 0; i < nFields; i++)
+		    cursor->ColUsed[i] = (idxStr[i] == '1') ? 1 : 0;
+	    }
+      }
+
     for (i = 0; i < argc; i++)
       {
-	  if (!vdbf_parse_constraint (idxStr, i, &iColumn, &op))
+	  if (!vdbf_parse_constraint (constraints, i, &iColumn, &op))
 	      continue;
 	  pC = sqlite3_malloc (sizeof (VirtualDbfConstraint));
 	  if (!pC)
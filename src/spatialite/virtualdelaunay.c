@@ -0,0 +1,2845 @@
+/*
+
+ virtualdelaunay.c -- SQLite3 extension [VIRTUAL TABLE tiled Delaunay]
+
+ version 5.1, 2026 October 18
+
+ -----------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2008-2021
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+
+/*
+/ DelaunayTriangles and VoronojCells are eponymous table-valued functions
+/ triangulating all the vertices stored into some Geometry column:
+/
+/ SELECT * FROM DelaunayTriangles(table, geom_column
+/                                 [, tile_size [, threads ]]);
+/ SELECT * FROM VoronojCells(table, geom_column
+/                            [, extra_frame_size [, tile_size [, threads ]]]);
+/
+/ the input extent is split into Tiles; each Tile is triangulated
+/ (on a worker thread) together with an overlapping margin, and only
+/ the triangles that are provably Delaunay for the whole dataset are
+/ returned, so that the seams between adjacent Tiles match exactly.
+/ a Tile failing to prove its own triangles is processed again after
+/ loading the further areas it needs (typically thin strips along the
+/ Convex Hull), or else with a doubled margin.
+/ memory usage is bounded by the number of points contained in the
+/ Tiles being processed at the same time, and the result can be
+/ streamed directly into a table:
+/
+/ INSERT INTO tin (geom)
+/   SELECT geometry FROM DelaunayTriangles('lidar', 'geom');
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "config-msvc.h"
+#else
+#include "config.h"
+#endif
+
+#ifndef OMIT_GEOS		/* only if GEOS is supported */
+
+#include <spatialite/sqlite.h>
+
+#include <spatialite/spatialite_ext.h>
+#include <spatialite/gaiaaux.h>
+#include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
+
+#ifdef GEOS_REENTRANT
+#ifdef GEOS_ONLY_REENTRANT
+#define GEOS_USE_ONLY_R_API	/* only fully thread-safe GEOS API */
+#endif
+#endif
+#include <geos_c.h>
+
+#ifdef _WIN32
+#define strcasecmp	_stricmp
+#endif /* not WIN32 */
+
+#define VDEL_DELAUNAY		1
+#define VDEL_VORONOJ		2
+
+#define VDEL_TILE_POINTS	65536	/* default number of points per Tile */
+#define VDEL_HULL_CHUNK		1048576	/* points per Convex Hull chunk */
+#define VDEL_MAX_THREADS	16
+
+#define VDEL_PENDING	0
+#define VDEL_DONE	1
+#define VDEL_RETRY	2
+#define VDEL_FAILURE	3
+
+static struct sqlite3_module my_delaunay_module;
+
+/******************************************************************************
+/
+/ the tiled triangulation engine
+/
+******************************************************************************/
+
+typedef struct vdel_point_struct
+{
+/* an input vertex */
+    double x;
+    double y;
+    double z;
+} vdelPoint;
+typedef vdelPoint *vdelPointPtr;
+
+typedef struct vdel_rect_struct
+{
+/* a rectangle */
+    double minx;
+    double miny;
+    double maxx;
+    double maxy;
+} vdelRect;
+typedef vdelRect *vdelRectPtr;
+
+typedef struct vdel_queue_item_struct
+{
+/* a Tile waiting to be processed */
+    int tile_no;
+    double buffer;		/* the overlapping margin */
+    vdelRectPtr extra;		/* additional areas to be loaded */
+    int num_extra;
+    int rounds;			/* how many times this Tile has been retried */
+} vdelQueueItem;
+typedef vdelQueueItem *vdelQueueItemPtr;
+
+struct vdel_engine_struct;
+
+typedef struct vdel_job_struct
+{
+/* a single Tile being processed */
+    const struct vdel_engine_struct *engine;
+    int tile_no;
+    double buffer;
+    double core_minx;		/* the Tile itself */
+    double core_miny;
+    double core_maxx;
+    double core_maxy;
+    double ext_minx;		/* the Tile plus its overlapping margin */
+    double ext_miny;
+    double ext_maxx;
+    double ext_maxy;
+    int whole;			/* the margin already covers the whole extent */
+    vdelRectPtr extra;		/* additional areas loaded near the Hull */
+    int num_extra;
+    int rounds;
+    double *outer[4];		/* the Convex Hull beyond each side */
+    int num_outer[4];
+    vdelRectPtr requests;	/* further areas required by this Tile */
+    int num_requests;
+    int max_requests;
+    int grow;			/* the margin itself must be enlarged */
+    vdelPointPtr points;	/* the input vertices within the extended Tile */
+    int num_points;
+    int max_points;
+    int status;
+    double *coords;		/* the output Polygons: XYZ triples */
+    int num_coords;
+    int max_coords;
+    int *sizes;			/* the output Polygons: vertices per ring */
+    int num_polygons;
+    int max_polygons;
+} vdelJob;
+typedef vdelJob *vdelJobPtr;
+
+typedef struct vdel_engine_struct
+{
+/* the tiled triangulation engine */
+    int mode;			/* Delaunay or Voronoj */
+    int has_z;
+    int srid;
+    double minx;		/* the full extent of the input */
+    double miny;
+    double maxx;
+    double maxy;
+    double frame_minx;		/* the Voronoj frame */
+    double frame_miny;
+    double frame_maxx;
+    double frame_maxy;
+    int nx;			/* the Tiles grid */
+    int ny;
+    double tile_w;
+    double tile_h;
+    double *hull;		/* the Convex Hull of all vertices [XY pairs] */
+    int num_hull;
+    sqlite3_stmt *stmt;		/* the per-Tile vertices query */
+    int gpkg_mode;
+    int gpkg_amphibious;
+    int max_threads;
+    vdelQueueItemPtr queue;
+    int queue_head;
+    int queue_count;
+    int queue_max;
+    vdelJobPtr jobs;		/* the current batch of Tiles */
+    int num_jobs;
+    int cur_job;		/* the current output Polygon */
+    int cur_polygon;
+    int cur_coord;
+} vdelEngine;
+typedef vdelEngine *vdelEnginePtr;
+
+static int
+vdel_add_point (vdelPointPtr * points, int *count, int *max, double x,
+		double y, double z)
+{
+/* appending a vertex to some dynamic array */
+    if (*count >= *max)
+      {
+	  int new_max = (*max == 0) ? 1024 : (*max * 2);
+	  vdelPointPtr p = realloc (*points, sizeof (vdelPoint) * new_max);
+	  if (p == NULL)
+	      return 0;
+	  *points = p;
+	  *max = new_max;
+      }
+    (*points + *count)->x = x;
+    (*points + *count)->y = y;
+    (*points + *count)->z = z;
+    *count += 1;
+    return 1;
+}
+
+static int
+vdel_add_coords (vdelPointPtr * points, int *count, int *max,
+		 gaiaGeomCollPtr geom, int is_filtered, double minx,
+		 double miny, double maxx, double maxy)
+{
+/* appending all vertices of some Geometry (optionally filtered by BBOX) */
+    gaiaPointPtr pt;
+    gaiaLinestringPtr ln;
+    gaiaPolygonPtr pg;
+    gaiaRingPtr rng;
+    int iv;
+    int ib;
+    double x;
+    double y;
+    double z;
+    double m;
+    pt = geom->FirstPoint;
+    while (pt)
+      {
+	  if (!is_filtered
+	      || (pt->X >= minx && pt->X <= maxx && pt->Y >= miny
+		  && pt->Y <= maxy))
+	    {
+		if (!vdel_add_point (points, count, max, pt->X, pt->Y, pt->Z))
+		    return 0;
+	    }
+	  pt = pt->Next;
+      }
+    ln = geom->FirstLinestring;
+    while (ln)
+      {
+	  for (iv = 0; iv < ln->Points; iv++)
+	    {
+		z = 0.0;
+		if (ln->DimensionModel == GAIA_XY_Z)
+		  {
+		      gaiaGetPointXYZ (ln->Coords, iv, &x, &y, &z);
+		  }
+		else if (ln->DimensionModel == GAIA_XY_M)
+		  {
+		      gaiaGetPointXYM (ln->Coords, iv, &x, &y, &m);
+		  }
+		else if (ln->DimensionModel == GAIA_XY_Z_M)
+		  {
+		      gaiaGetPointXYZM (ln->Coords, iv, &x, &y, &z, &m);
+		  }
+		else
+		  {
+		      gaiaGetPoint (ln->Coords, iv, &x, &y);
+		  }
+		if (is_filtered
+		    && (x < minx || x > maxx || y < miny || y > maxy))
+		    continue;
+		if (!vdel_add_point (points, count, max, x, y, z))
+		    return 0;
+	    }
+	  ln = ln->Next;
+      }
+    pg = geom->FirstPolygon;
+    while (pg)
+      {
+	  for (ib = -1; ib < pg->NumInteriors; ib++)
+	    {
+		rng = (ib < 0) ? pg->Exterior : (pg->Interiors + ib);
+		/* the closing vertex simply repeats the first one */
+		for (iv = 0; iv < rng->Points - 1; iv++)
+		  {
+		      z = 0.0;
+		      if (rng->DimensionModel == GAIA_XY_Z)
+			{
+			    gaiaGetPointXYZ (rng->Coords, iv, &x, &y, &z);
+			}
+		      else if (rng->DimensionModel == GAIA_XY_M)
+			{
+			    gaiaGetPointXYM (rng->Coords, iv, &x, &y, &m);
+			}
+		      else if (rng->DimensionModel == GAIA_XY_Z_M)
+			{
+			    gaiaGetPointXYZM (rng->Coords, iv, &x, &y, &z, &m);
+			}
+		      else
+			{
+			    gaiaGetPoint (rng->Coords, iv, &x, &y);
+			}
+		      if (is_filtered
+			  && (x < minx || x > maxx || y < miny || y > maxy))
+			  continue;
+		      if (!vdel_add_point (points, count, max, x, y, z))
+			  return 0;
+		  }
+	    }
+	  pg = pg->Next;
+      }
+    return 1;
+}
+
+static int
+vdel_cmp_points (const void *p1, const void *p2)
+{
+/* sorting vertices by X, Y */
+    const double *a = (const double *) p1;
+    const double *b = (const double *) p2;
+    if (a[0] < b[0])
+	return -1;
+    if (a[0] > b[0])
+	return 1;
+    if (a[1] < b[1])
+	return -1;
+    if (a[1] > b[1])
+	return 1;
+    return 0;
+}
+
+static double
+vdel_cross (double ox, double oy, double ax, double ay, double bx, double by)
+{
+/* 2D cross product of OA and OB */
+    return ((ax - ox) * (by - oy)) - ((ay - oy) * (bx - ox));
+}
+
+static int
+vdel_merge_hull (vdelEnginePtr engine, vdelPointPtr points, int count)
+{
+/*
+/ merging a chunk of vertices into the current Convex Hull
+/ [Andrew's monotone chain, counter-clockwise]
+*/
+    int n = engine->num_hull + count;
+    int i;
+    int k = 0;
+    int lower;
+    double *xy = malloc (sizeof (double) * 2 * n);
+    double *hull = malloc (sizeof (double) * 2 * (n + 1));
+    if (xy == NULL || hull == NULL)
+      {
+	  if (xy != NULL)
+	      free (xy);
+	  if (hull != NULL)
+	      free (hull);
+	  return 0;
+      }
+    for (i = 0; i < engine->num_hull; i++)
+      {
+	  xy[i * 2] = engine->hull[i * 2];
+	  xy[(i * 2) + 1] = engine->hull[(i * 2) + 1];
+      }
+    for (i = 0; i < count; i++)
+      {
+	  xy[(engine->num_hull + i) * 2] = (points + i)->x;
+	  xy[((engine->num_hull + i) * 2) + 1] = (points + i)->y;
+      }
+    qsort (xy, n, sizeof (double) * 2, vdel_cmp_points);
+    for (i = 0; i < n; i++)
+      {
+	  /* lower hull */
+	  while (k >= 2
+		 && vdel_cross (hull[(k - 2) * 2], hull[((k - 2) * 2) + 1],
+				hull[(k - 1) * 2], hull[((k - 1) * 2) + 1],
+				xy[i * 2], xy[(i * 2) + 1]) <= 0.0)
+	      k--;
+	  hull[k * 2] = xy[i * 2];
+	  hull[(k * 2) + 1] = xy[(i * 2) + 1];
+	  k++;
+      }
+    lower = k + 1;
+    for (i = n - 2; i >= 0; i--)
+      {
+	  /* upper hull */
+	  while (k >= lower
+		 && vdel_cross (hull[(k - 2) * 2], hull[((k - 2) * 2) + 1],
+				hull[(k - 1) * 2], hull[((k - 1) * 2) + 1],
+				xy[i * 2], xy[(i * 2) + 1]) <= 0.0)
+	      k--;
+	  hull[k * 2] = xy[i * 2];
+	  hull[(k * 2) + 1] = xy[(i * 2) + 1];
+	  k++;
+      }
+    free (xy);
+    if (k > 1)
+	k--;			/* the last vertex repeats the first one */
+    if (engine->hull != NULL)
+	free (engine->hull);
+    engine->hull = hull;
+    engine->num_hull = k;
+    return 1;
+}
+
+static int
+vdel_clip_halfplane (const double *src, int count, double a, double b,
+		     double c, double *dst)
+{
+/*
+/ clipping a convex Polygon [XY pairs] against the half-plane
+/ A*X + B*Y + C >= 0; DST must hold COUNT + 1 vertices
+*/
+    int i;
+    int k = 0;
+    for (i = 0; i < count; i++)
+      {
+	  double x0 = src[i * 2];
+	  double y0 = src[(i * 2) + 1];
+	  double x1 = src[((i + 1) % count) * 2];
+	  double y1 = src[(((i + 1) % count) * 2) + 1];
+	  double d0 = (a * x0) + (b * y0) + c;
+	  double d1 = (a * x1) + (b * y1) + c;
+	  if (d0 >= 0.0)
+	    {
+		dst[k * 2] = x0;
+		dst[(k * 2) + 1] = y0;
+		k++;
+	    }
+	  if ((d0 >= 0.0 && d1 < 0.0) || (d0 < 0.0 && d1 >= 0.0))
+	    {
+		double t = d0 / (d0 - d1);
+		dst[k * 2] = x0 + ((x1 - x0) * t);
+		dst[(k * 2) + 1] = y0 + ((y1 - y0) * t);
+		k++;
+	    }
+      }
+    return k;
+}
+
+static int
+vdel_clip_side (const double *src, int count, int side, double value,
+		double *dst)
+{
+/*
+/ clipping a convex Polygon [XY pairs] against an axis-aligned half-plane
+/ [0 = X >= value, 1 = X <= value, 2 = Y >= value, 3 = Y <= value]
+*/
+    switch (side)
+      {
+      case 0:
+	  return vdel_clip_halfplane (src, count, 1.0, 0.0, -value, dst);
+      case 1:
+	  return vdel_clip_halfplane (src, count, -1.0, 0.0, value, dst);
+      case 2:
+	  return vdel_clip_halfplane (src, count, 0.0, 1.0, -value, dst);
+      default:
+	  return vdel_clip_halfplane (src, count, 0.0, -1.0, value, dst);
+      };
+}
+
+static int
+vdel_clip_rect (const double *in, int n, double minx, double miny,
+		double maxx, double maxy, double *out, double *tmp)
+{
+/*
+/ clipping a convex Polygon [XY pairs] against a rectangle
+/ [Sutherland-Hodgman]; both OUT and TMP must hold N + 4 vertices
+*/
+    int count;
+    count = vdel_clip_side (in, n, 0, minx, tmp);
+    if (count > 0)
+	count = vdel_clip_side (tmp, count, 1, maxx, out);
+    if (count > 0)
+	count = vdel_clip_side (out, count, 2, miny, tmp);
+    if (count > 0)
+	count = vdel_clip_side (tmp, count, 3, maxy, out);
+    return count;
+}
+
+static double
+vdel_area (const double *xy, int n)
+{
+/* the (unsigned) area of some Polygon [XY pairs] */
+    int i;
+    double area = 0.0;
+    for (i = 0; i < n; i++)
+      {
+	  int j = (i + 1) % n;
+	  area += (xy[i * 2] * xy[(j * 2) + 1]) - (xy[j * 2] * xy[(i * 2) + 1]);
+      }
+    return fabs (area / 2.0);
+}
+
+static void
+vdel_owner (const vdelEngine * engine, double x, double y, int *ix, int *iy)
+{
+/* the Tile owning some location; the same rule is shared by all Tiles */
+    *ix = (int) floor ((x - engine->minx) / engine->tile_w);
+    *iy = (int) floor ((y - engine->miny) / engine->tile_h);
+    if (*ix < 0)
+	*ix = 0;
+    if (*ix >= engine->nx)
+	*ix = engine->nx - 1;
+    if (*iy < 0)
+	*iy = 0;
+    if (*iy >= engine->ny)
+	*iy = engine->ny - 1;
+}
+
+static int
+vdel_is_owned (const vdelJob * job, double x, double y)
+{
+/* checks if some location belongs to the Tile being processed */
+    int ix;
+    int iy;
+    vdel_owner (job->engine, x, y, &ix, &iy);
+    return ((iy * job->engine->nx) + ix == job->tile_no) ? 1 : 0;
+}
+
+static int
+vdel_disk_is_clear (const double *xy, int n, double cx, double cy, double r)
+{
+/* checks if a disk doesn't intersect some convex Polygon [XY pairs] */
+    int i;
+    int inside = 1;
+    double sign = 0.0;
+    for (i = 0; i < n; i++)
+      {
+	  double x0 = xy[i * 2];
+	  double y0 = xy[(i * 2) + 1];
+	  double x1 = xy[((i + 1) % n) * 2];
+	  double y1 = xy[(((i + 1) % n) * 2) + 1];
+	  double dx = x1 - x0;
+	  double dy = y1 - y0;
+	  double len2 = (dx * dx) + (dy * dy);
+	  double t = 0.0;
+	  double px;
+	  double py;
+	  double c = vdel_cross (x0, y0, x1, y1, cx, cy);
+	  if (c != 0.0)
+	    {
+		if (sign == 0.0)
+		    sign = c;
+		else if ((sign > 0.0) != (c > 0.0))
+		    inside = 0;
+	    }
+	  if (len2 > 0.0)
+	    {
+		t = (((cx - x0) * dx) + ((cy - y0) * dy)) / len2;
+		if (t < 0.0)
+		    t = 0.0;
+		if (t > 1.0)
+		    t = 1.0;
+	    }
+	  px = x0 + (dx * t) - cx;
+	  py = y0 + (dy * t) - cy;
+	  if ((px * px) + (py * py) <= r * r)
+	      return 0;
+      }
+    if (n >= 3 && inside)
+	return 0;		/* the center lies inside the Polygon */
+    return 1;
+}
+
+static int
+vdel_is_loaded (const vdelJob * job, const vdelRect * rect)
+{
+/* checks if all vertices within some rectangle have been loaded */
+    int i;
+    if (rect->minx >= job->ext_minx && rect->maxx <= job->ext_maxx
+	&& rect->miny >= job->ext_miny && rect->maxy <= job->ext_maxy)
+	return 1;
+    for (i = 0; i < job->num_extra; i++)
+      {
+	  const vdelRect *ext = job->extra + i;
+	  if (rect->minx >= ext->minx && rect->maxx <= ext->maxx
+	      && rect->miny >= ext->miny && rect->maxy <= ext->maxy)
+	      return 1;
+      }
+    return 0;
+}
+
+static void
+vdel_request (vdelJobPtr job, const vdelRect * area)
+{
+/* requesting some further area to be loaded before the next attempt */
+    const vdelEngine *engine = job->engine;
+    vdelRect rect;
+    double limit = (job->ext_maxx - job->ext_minx) *
+	(job->ext_maxy - job->ext_miny);
+    int i;
+/* a small margin avoids asking again for the nearby vertices */
+    rect.minx = area->minx - job->buffer;
+    rect.miny = area->miny - job->buffer;
+    rect.maxx = area->maxx + job->buffer;
+    rect.maxy = area->maxy + job->buffer;
+/* nothing lies beyond the full extent */
+    if (rect.minx < engine->minx)
+	rect.minx = engine->minx;
+    if (rect.miny < engine->miny)
+	rect.miny = engine->miny;
+    if (rect.maxx > engine->maxx)
+	rect.maxx = engine->maxx;
+    if (rect.maxy > engine->maxy)
+	rect.maxy = engine->maxy;
+    if (vdel_is_loaded (job, &rect)
+	|| (rect.maxx - rect.minx) * (rect.maxy - rect.miny) > limit)
+      {
+	  /* no progress is possible this way */
+	  job->grow = 1;
+	  return;
+      }
+    for (i = 0; i < job->num_requests; i++)
+      {
+	  vdelRectPtr req = job->requests + i;
+	  if (rect.minx >= req->minx && rect.maxx <= req->maxx
+	      && rect.miny >= req->miny && rect.maxy <= req->maxy)
+	      return;		/* already requested */
+	  if (req->minx >= rect.minx && req->maxx <= rect.maxx
+	      && req->miny >= rect.miny && req->maxy <= rect.maxy)
+	    {
+		/* replacing a smaller request */
+		*req = rect;
+		return;
+	    }
+      }
+    if (job->num_requests >= job->max_requests)
+      {
+	  int new_max = (job->max_requests == 0) ? 16 : job->max_requests * 2;
+	  vdelRectPtr p;
+	  if (job->num_requests >= 256)
+	    {
+		job->grow = 1;
+		return;
+	    }
+	  p = realloc (job->requests, sizeof (vdelRect) * new_max);
+	  if (p == NULL)
+	    {
+		job->grow = 1;
+		return;
+	    }
+	  job->requests = p;
+	  job->max_requests = new_max;
+      }
+    job->requests[job->num_requests] = rect;
+    job->num_requests += 1;
+}
+
+static void
+vdel_bbox (const double *xy, int n, vdelRectPtr rect)
+{
+/* the BBOX of some Polygon [XY pairs] */
+    int i;
+    rect->minx = DBL_MAX;
+    rect->miny = DBL_MAX;
+    rect->maxx = -DBL_MAX;
+    rect->maxy = -DBL_MAX;
+    for (i = 0; i < n; i++)
+      {
+	  if (xy[i * 2] < rect->minx)
+	      rect->minx = xy[i * 2];
+	  if (xy[i * 2] > rect->maxx)
+	      rect->maxx = xy[i * 2];
+	  if (xy[(i * 2) + 1] < rect->miny)
+	      rect->miny = xy[(i * 2) + 1];
+	  if (xy[(i * 2) + 1] > rect->maxy)
+	      rect->maxy = xy[(i * 2) + 1];
+      }
+}
+
+static int
+vdel_certified (vdelJobPtr job, double cx, double cy, double r)
+{
+/*
+/ checks if a circle can't contain any vertex that hasn't been loaded:
+/ all vertices lie within the Convex Hull, so only the parts of the
+/ Hull beyond each side of the extended Tile matter.
+/ the areas required for certifying the circle are requested
+*/
+    double rr = r * (1.0 + 1e-9);
+    int side;
+    int ok = 1;
+    if (r == DBL_MAX)
+	return 0;
+    for (side = 0; side < 4; side++)
+      {
+	  vdelRect rect;
+	  switch (side)
+	    {
+	    case 0:
+		if (cx - rr > job->ext_minx)
+		    continue;
+		break;
+	    case 1:
+		if (cx + rr < job->ext_maxx)
+		    continue;
+		break;
+	    case 2:
+		if (cy - rr > job->ext_miny)
+		    continue;
+		break;
+	    default:
+		if (cy + rr < job->ext_maxy)
+		    continue;
+		break;
+	    };
+	  if (vdel_disk_is_clear
+	      (job->outer[side], job->num_outer[side], cx, cy, rr))
+	      continue;
+	  /* the part of the Hull possibly falling within the circle */
+	  vdel_bbox (job->outer[side], job->num_outer[side], &rect);
+	  if (rect.minx < cx - rr)
+	      rect.minx = cx - rr;
+	  if (rect.maxx > cx + rr)
+	      rect.maxx = cx + rr;
+	  if (rect.miny < cy - rr)
+	      rect.miny = cy - rr;
+	  if (rect.maxy > cy + rr)
+	      rect.maxy = cy + rr;
+	  if (vdel_is_loaded (job, &rect))
+	      continue;
+	  vdel_request (job, &rect);
+	  ok = 0;
+      }
+    return ok;
+}
+
+static int
+vdel_hull_edge (vdelJobPtr job, double px, double py, double qx, double qy)
+{
+/*
+/ checks if the segment PQ [the outer side lying on its right]
+/ belongs to the Convex Hull of all vertices; if not, the part of
+/ the Hull lying beyond PQ is requested
+*/
+    const vdelEngine *engine = job->engine;
+    double *out;
+    double len = sqrt (((qx - px) * (qx - px)) + ((qy - py) * (qy - py)));
+    double diag = sqrt (((engine->maxx - engine->minx) *
+			 (engine->maxx - engine->minx)) +
+			((engine->maxy - engine->miny) *
+			 (engine->maxy - engine->miny)));
+    double tol = len * diag * 1e-12;
+    int n;
+    vdelRect rect;
+    out = malloc (sizeof (double) * 2 * (engine->num_hull + 1));
+    if (out == NULL)
+      {
+	  job->grow = 1;
+	  return 0;
+      }
+    n = vdel_clip_halfplane (engine->hull, engine->num_hull, qy - py,
+			     px - qx, ((qx - px) * py) - ((qy - py) * px) - tol,
+			     out);
+    if (n == 0)
+      {
+	  free (out);
+	  return 1;
+      }
+    vdel_bbox (out, n, &rect);
+    free (out);
+    vdel_request (job, &rect);
+    return 0;
+}
+
+static int
+vdel_build_outer (vdelJobPtr job)
+{
+/* the parts of the Convex Hull lying beyond each side of the extended Tile */
+    const vdelEngine *engine = job->engine;
+    int i;
+    int side[4] = { 1, 0, 3, 2 };
+    double value[4];
+    value[0] = job->ext_minx;
+    value[1] = job->ext_maxx;
+    value[2] = job->ext_miny;
+    value[3] = job->ext_maxy;
+    for (i = 0; i < 4; i++)
+      {
+	  job->outer[i] = malloc (sizeof (double) * 2 * (engine->num_hull + 1));
+	  if (job->outer[i] == NULL)
+	      return 0;
+	  if ((i == 0 && value[i] <= engine->minx)
+	      || (i == 1 && value[i] >= engine->maxx)
+	      || (i == 2 && value[i] <= engine->miny)
+	      || (i == 3 && value[i] >= engine->maxy))
+	      job->num_outer[i] = 0;	/* nothing lies beyond */
+	  else
+	      job->num_outer[i] =
+		  vdel_clip_side (engine->hull, engine->num_hull, side[i],
+				  value[i], job->outer[i]);
+      }
+    return 1;
+}
+
+static int
+vdel_add_polygon (vdelJobPtr job, const double *xyz, int n)
+{
+/* appending an output Polygon [XYZ triples] to the Tile's results */
+    if (job->num_polygons >= job->max_polygons)
+      {
+	  int new_max = (job->max_polygons == 0) ? 1024 : job->max_polygons * 2;
+	  int *p = realloc (job->sizes, sizeof (int) * new_max);
+	  if (p == NULL)
+	      return 0;
+	  job->sizes = p;
+	  job->max_polygons = new_max;
+      }
+    while (job->num_coords + (n * 3) > job->max_coords)
+      {
+	  int new_max = (job->max_coords == 0) ? 4096 : job->max_coords * 2;
+	  double *p = realloc (job->coords, sizeof (double) * new_max);
+	  if (p == NULL)
+	      return 0;
+	  job->coords = p;
+	  job->max_coords = new_max;
+      }
+    memcpy (job->coords + job->num_coords, xyz, sizeof (double) * n * 3);
+    job->num_coords += n * 3;
+    job->sizes[job->num_polygons] = n;
+    job->num_polygons += 1;
+    return 1;
+}
+
+/* the triangulation of a single Tile */
+
+typedef struct vdel_triangle_struct
+{
+    int v[3];			/* vertex indices [counter-clockwise] */
+    double cx;			/* the circumcircle */
+    double cy;
+    double r;
+    int group;			/* the Delaunay cell this triangle belongs to */
+} vdelTriangle;
+typedef vdelTriangle *vdelTrianglePtr;
+
+typedef struct vdel_edge_struct
+{
+    int a;			/* a < b */
+    int b;
+    int t1;			/* the adjacent triangles [-1 if none] */
+    int t2;
+} vdelEdge;
+typedef vdelEdge *vdelEdgePtr;
+
+typedef struct vdel_tin_struct
+{
+    vdelPointPtr points;
+    int num_points;
+    int *vhash;			/* vertex hash table */
+    unsigned int vhash_mask;
+    vdelTrianglePtr triangles;
+    int num_triangles;
+    vdelEdgePtr edges;		/* edge hash table */
+    unsigned int ehash_mask;
+    int *parent;		/* union-find of Delaunay cells */
+    int *star_offset;		/* triangles incident on each vertex */
+    int *star;
+} vdelTin;
+typedef vdelTin *vdelTinPtr;
+
+static unsigned int
+vdel_hash_double (unsigned int h, double v)
+{
+/* FNV-1a hashing of a double value */
+    unsigned char buf[sizeof (double)];
+    size_t i;
+    if (v == 0.0)
+	v = 0.0;		/* -0.0 and +0.0 must hash the same */
+    memcpy (buf, &v, sizeof (double));
+    for (i = 0; i < sizeof (double); i++)
+      {
+	  h ^= buf[i];
+	  h *= 16777619U;
+      }
+    return h;
+}
+
+static unsigned int
+vdel_table_size (int count)
+{
+/* a power of two at least twice as large as COUNT */
+    unsigned int size = 16;
+    while (size < (unsigned int) count * 2)
+	size *= 2;
+    return size;
+}
+
+static int
+vdel_find_vertex (vdelTinPtr tin, double x, double y)
+{
+/* returns the index of the first vertex located at X,Y (or -1) */
+    unsigned int h =
+	vdel_hash_double (vdel_hash_double (2166136261U, x), y) & tin->vhash_mask;
+    while (tin->vhash[h] >= 0)
+      {
+	  vdelPointPtr pt = tin->points + tin->vhash[h];
+	  if (pt->x == x && pt->y == y)
+	      return tin->vhash[h];
+	  h = (h + 1) & tin->vhash_mask;
+      }
+    return -1;
+}
+
+static int
+vdel_build_vertices (vdelTinPtr tin)
+{
+/* building the vertex hash table */
+    unsigned int size = vdel_table_size (tin->num_points);
+    int i;
+    tin->vhash = malloc (sizeof (int) * size);
+    if (tin->vhash == NULL)
+	return 0;
+    tin->vhash_mask = size - 1;
+    for (i = 0; i < (int) size; i++)
+	tin->vhash[i] = -1;
+    for (i = 0; i < tin->num_points; i++)
+      {
+	  vdelPointPtr pt = tin->points + i;
+	  unsigned int h =
+	      vdel_hash_double (vdel_hash_double (2166136261U, pt->x),
+				pt->y) & tin->vhash_mask;
+	  int dup = 0;
+	  while (tin->vhash[h] >= 0)
+	    {
+		vdelPointPtr pt2 = tin->points + tin->vhash[h];
+		if (pt2->x == pt->x && pt2->y == pt->y)
+		  {
+		      dup = 1;
+		      break;
+		  }
+		h = (h + 1) & tin->vhash_mask;
+	    }
+	  if (!dup)
+	      tin->vhash[h] = i;
+      }
+    return 1;
+}
+
+static vdelEdgePtr
+vdel_find_edge (vdelTinPtr tin, int a, int b, int insert)
+{
+/* searching (and optionally inserting) an edge */
+    unsigned int h;
+    if (a > b)
+      {
+	  int swap = a;
+	  a = b;
+	  b = swap;
+      }
+    h = ((((unsigned int) a) * 2654435761U) ^ (((unsigned int) b) *
+					       40503U)) & tin->ehash_mask;
+    while ((tin->edges + h)->a >= 0)
+      {
+	  vdelEdgePtr e = tin->edges + h;
+	  if (e->a == a && e->b == b)
+	      return e;
+	  h = (h + 1) & tin->ehash_mask;
+      }
+    if (!insert)
+	return NULL;
+    (tin->edges + h)->a = a;
+    (tin->edges + h)->b = b;
+    return tin->edges + h;
+}
+
+static int
+vdel_find_group (vdelTinPtr tin, int t)
+{
+/* union-find: the root of some Delaunay cell */
+    while (tin->parent[t] != t)
+      {
+	  tin->parent[t] = tin->parent[tin->parent[t]];
+	  t = tin->parent[t];
+      }
+    return t;
+}
+
+static void
+vdel_circumcircle (vdelTinPtr tin, vdelTrianglePtr tr)
+{
+/* computing the circumcircle of some triangle */
+    vdelPointPtr p1 = tin->points + tr->v[0];
+    vdelPointPtr p2 = tin->points + tr->v[1];
+    vdelPointPtr p3 = tin->points + tr->v[2];
+    double bx = p2->x - p1->x;
+    double by = p2->y - p1->y;
+    double cx = p3->x - p1->x;
+    double cy = p3->y - p1->y;
+    double d = 2.0 * ((bx * cy) - (by * cx));
+    double b2 = (bx * bx) + (by * by);
+    double c2 = (cx * cx) + (cy * cy);
+    double ux;
+    double uy;
+    if (d == 0.0)
+      {
+	  /* degenerate triangle: never certified */
+	  tr->cx = p1->x;
+	  tr->cy = p1->y;
+	  tr->r = DBL_MAX;
+	  return;
+      }
+    ux = ((cy * b2) - (by * c2)) / d;
+    uy = ((bx * c2) - (cx * b2)) / d;
+    tr->cx = p1->x + ux;
+    tr->cy = p1->y + uy;
+    tr->r = sqrt ((ux * ux) + (uy * uy));
+}
+
+static int
+vdel_same_circle (vdelTrianglePtr t1, vdelTrianglePtr t2)
+{
+/* checks if two adjacent triangles share the same circumcircle */
+    double tol = ((t1->r > t2->r) ? t1->r : t2->r) * 1e-9;
+    if (t1->r == DBL_MAX || t2->r == DBL_MAX)
+	return 0;
+    if (fabs (t1->cx - t2->cx) > tol || fabs (t1->cy - t2->cy) > tol
+	|| fabs (t1->r - t2->r) > tol)
+	return 0;
+    return 1;
+}
+
+static void
+vdel_free_tin (vdelTinPtr tin)
+{
+/* memory cleanup - TIN */
+    if (tin->vhash != NULL)
+	free (tin->vhash);
+    if (tin->triangles != NULL)
+	free (tin->triangles);
+    if (tin->edges != NULL)
+	free (tin->edges);
+    if (tin->parent != NULL)
+	free (tin->parent);
+    if (tin->star_offset != NULL)
+	free (tin->star_offset);
+    if (tin->star != NULL)
+	free (tin->star);
+}
+
+static int
+vdel_triangulate (GEOSContextHandle_t handle, vdelTinPtr tin)
+{
+/* triangulating all the vertices of the extended Tile */
+    GEOSGeometry **pts = NULL;
+    GEOSGeometry *mpt = NULL;
+    GEOSGeometry *tri = NULL;
+    int i;
+    int count = 0;
+    int ok = 0;
+    unsigned int size;
+
+    if (!vdel_build_vertices (tin))
+	return 0;
+    pts = malloc (sizeof (GEOSGeometry *) * (tin->num_points + 1));
+    if (pts == NULL)
+	return 0;
+    for (i = 0; i < tin->num_points; i++)
+      {
+	  GEOSCoordSequence *cs = GEOSCoordSeq_create_r (handle, 1, 2);
+	  GEOSCoordSeq_setX_r (handle, cs, 0, (tin->points + i)->x);
+	  GEOSCoordSeq_setY_r (handle, cs, 0, (tin->points + i)->y);
+	  pts[count++] = GEOSGeom_createPoint_r (handle, cs);
+      }
+    mpt =
+	GEOSGeom_createCollection_r (handle, GEOS_MULTIPOINT, pts,
+				     (unsigned int) count);
+    free (pts);
+    if (mpt == NULL)
+	return 0;
+    tri = GEOSDelaunayTriangulation_r (handle, mpt, 0.0, 0);
+    GEOSGeom_destroy_r (handle, mpt);
+    if (tri == NULL)
+	return 0;
+
+/* fetching the triangles */
+    count = GEOSGetNumGeometries_r (handle, tri);
+    if (count < 0)
+	goto stop;
+    tin->triangles = malloc (sizeof (vdelTriangle) * (count + 1));
+    tin->parent = malloc (sizeof (int) * (count + 1));
+    if (tin->triangles == NULL || tin->parent == NULL)
+	goto stop;
+    for (i = 0; i < count; i++)
+      {
+	  const GEOSGeometry *pg = GEOSGetGeometryN_r (handle, tri, i);
+	  const GEOSGeometry *rng = GEOSGetExteriorRing_r (handle, pg);
+	  const GEOSCoordSequence *cs = GEOSGeom_getCoordSeq_r (handle, rng);
+	  vdelTrianglePtr tr = tin->triangles + i;
+	  int iv;
+	  for (iv = 0; iv < 3; iv++)
+	    {
+		double x;
+		double y;
+		GEOSCoordSeq_getX_r (handle, cs, iv, &x);
+		GEOSCoordSeq_getY_r (handle, cs, iv, &y);
+		tr->v[iv] = vdel_find_vertex (tin, x, y);
+		if (tr->v[iv] < 0)
+		    goto stop;
+	    }
+	  if (vdel_cross
+	      ((tin->points + tr->v[0])->x, (tin->points + tr->v[0])->y,
+	       (tin->points + tr->v[1])->x, (tin->points + tr->v[1])->y,
+	       (tin->points + tr->v[2])->x, (tin->points + tr->v[2])->y) < 0.0)
+	    {
+		/* forcing counter-clockwise orientation */
+		int swap = tr->v[1];
+		tr->v[1] = tr->v[2];
+		tr->v[2] = swap;
+	    }
+	  vdel_circumcircle (tin, tr);
+	  tin->parent[i] = i;
+      }
+    tin->num_triangles = count;
+
+/* building the edges and grouping cocircular triangles into Delaunay cells */
+    size = vdel_table_size (count * 3);
+    tin->edges = malloc (sizeof (vdelEdge) * size);
+    if (tin->edges == NULL)
+	goto stop;
+    tin->ehash_mask = size - 1;
+    for (i = 0; i < (int) size; i++)
+      {
+	  (tin->edges + i)->a = -1;
+	  (tin->edges + i)->t1 = -1;
+	  (tin->edges + i)->t2 = -1;
+      }
+    for (i = 0; i < count; i++)
+      {
+	  vdelTrianglePtr tr = tin->triangles + i;
+	  int iv;
+	  for (iv = 0; iv < 3; iv++)
+	    {
+		vdelEdgePtr e =
+		    vdel_find_edge (tin, tr->v[iv], tr->v[(iv + 1) % 3], 1);
+		if (e->t1 < 0)
+		    e->t1 = i;
+		else
+		  {
+		      e->t2 = i;
+		      if (vdel_same_circle (tin->triangles + e->t1, tr))
+			{
+			    int g1 = vdel_find_group (tin, e->t1);
+			    int g2 = vdel_find_group (tin, i);
+			    if (g1 != g2)
+				tin->parent[g2] = g1;
+			}
+		  }
+	    }
+      }
+    for (i = 0; i < count; i++)
+	(tin->triangles + i)->group = vdel_find_group (tin, i);
+    ok = 1;
+
+  stop:
+    GEOSGeom_destroy_r (handle, tri);
+    return ok;
+}
+
+static void
+vdel_group_key (vdelTinPtr tin, int *members, int n, double *x, double *y)
+{
+/*
+/ the ownership key of some Delaunay cell: the centroid of its three
+/ lexicographically smallest vertices, that always lies inside the
+/ cell and never depends on how cocircular vertices were triangulated
+*/
+    int best[3] = { -1, -1, -1 };
+    int i;
+    int iv;
+    int k;
+    for (i = 0; i < n; i++)
+      {
+	  vdelTrianglePtr tr = tin->triangles + members[i];
+	  for (iv = 0; iv < 3; iv++)
+	    {
+		int v = tr->v[iv];
+		vdelPointPtr p = tin->points + v;
+		for (k = 0; k < 3; k++)
+		  {
+		      vdelPointPtr q;
+		      if (best[k] == v)
+			  break;
+		      if (best[k] >= 0)
+			{
+			    q = tin->points + best[k];
+			    if (p->x > q->x || (p->x == q->x && p->y > q->y))
+				continue;
+			}
+		      /* inserting at position K */
+		      if (k < 2)
+			  memmove (best + k + 1, best + k,
+				   sizeof (int) * (2 - k));
+		      best[k] = v;
+		      break;
+		  }
+	    }
+      }
+    *x = ((tin->points + best[0])->x + (tin->points + best[1])->x +
+	  (tin->points + best[2])->x) / 3.0;
+    *y = ((tin->points + best[0])->y + (tin->points + best[1])->y +
+	  (tin->points + best[2])->y) / 3.0;
+}
+
+static int
+vdel_check_coverage (vdelJobPtr job, vdelTinPtr tin)
+{
+/*
+/ the certified triangles must cover the whole Tile (within the Convex
+/ Hull of all vertices): otherwise some Delaunay triangles belonging
+/ to this Tile could depend on vertices beyond the overlapping margin
+*/
+    const vdelEngine *engine = job->engine;
+    double *out;
+    double *tmp;
+    double target = 0.0;
+    double covered = 0.0;
+    double tri[6];
+    double tile_area;
+    int n;
+    int i;
+    int max = (engine->num_hull > 3) ? engine->num_hull : 3;
+    out = malloc (sizeof (double) * 2 * (max + 8));
+    tmp = malloc (sizeof (double) * 2 * (max + 8));
+    if (out == NULL || tmp == NULL)
+      {
+	  if (out != NULL)
+	      free (out);
+	  if (tmp != NULL)
+	      free (tmp);
+	  return -1;
+      }
+    n = vdel_clip_rect (engine->hull, engine->num_hull, job->core_minx,
+			job->core_miny, job->core_maxx, job->core_maxy, out,
+			tmp);
+    if (n >= 3)
+	target = vdel_area (out, n);
+    for (i = 0; i < tin->num_triangles; i++)
+      {
+	  vdelTrianglePtr tr = tin->triangles + i;
+	  int iv;
+	  int outside = 0;
+	  for (iv = 0; iv < 3; iv++)
+	    {
+		tri[iv * 2] = (tin->points + tr->v[iv])->x;
+		tri[(iv * 2) + 1] = (tin->points + tr->v[iv])->y;
+	    }
+	  if (tri[0] < job->core_minx && tri[2] < job->core_minx
+	      && tri[4] < job->core_minx)
+	      outside = 1;
+	  if (tri[0] > job->core_maxx && tri[2] > job->core_maxx
+	      && tri[4] > job->core_maxx)
+	      outside = 1;
+	  if (tri[1] < job->core_miny && tri[3] < job->core_miny
+	      && tri[5] < job->core_miny)
+	      outside = 1;
+	  if (tri[1] > job->core_maxy && tri[3] > job->core_maxy
+	      && tri[5] > job->core_maxy)
+	      outside = 1;
+	  if (outside || !vdel_certified (job, tr->cx, tr->cy, tr->r))
+	      continue;
+	  n = vdel_clip_rect (tri, 3, job->core_minx, job->core_miny,
+			      job->core_maxx, job->core_maxy, out, tmp);
+	  if (n >= 3)
+	      covered += vdel_area (out, n);
+      }
+    free (out);
+    free (tmp);
+    tile_area =
+	(job->core_maxx - job->core_minx) * (job->core_maxy - job->core_miny);
+    if (covered >= target - (tile_area * 1e-9))
+	return 1;
+
+/* some part of the Tile lies beyond the local Hull: requesting it */
+    for (i = 0; i <= (int) (tin->ehash_mask); i++)
+      {
+	  vdelEdgePtr e = tin->edges + i;
+	  vdelTrianglePtr tr;
+	  vdelPointPtr p;
+	  vdelPointPtr q;
+	  int iv;
+	  if (e->a < 0 || e->t2 >= 0)
+	      continue;
+	  p = tin->points + e->a;
+	  q = tin->points + e->b;
+	  if ((p->x < job->core_minx && q->x < job->core_minx)
+	      || (p->x > job->core_maxx && q->x > job->core_maxx)
+	      || (p->y < job->core_miny && q->y < job->core_miny)
+	      || (p->y > job->core_maxy && q->y > job->core_maxy))
+	      continue;
+	  tr = tin->triangles + e->t1;
+	  for (iv = 0; iv < 3; iv++)
+	    {
+		if (tr->v[iv] == e->b && tr->v[(iv + 1) % 3] == e->a)
+		  {
+		      /* the triangle runs from B to A */
+		      p = tin->points + e->b;
+		      q = tin->points + e->a;
+		  }
+	    }
+	  vdel_hull_edge (job, p->x, p->y, q->x, q->y);
+      }
+    return 0;
+}
+
+static int
+vdel_emit_delaunay (vdelJobPtr job, vdelTinPtr tin)
+{
+/* returning all Delaunay cells owned by this Tile */
+    int *order = NULL;
+    int *first = NULL;
+    int i;
+    int k;
+    int ret = VDEL_FAILURE;
+    int retry = 0;
+    double xyz[9];
+
+/* sorting the triangles by Delaunay cell */
+    order = malloc (sizeof (int) * (tin->num_triangles + 1));
+    first = malloc (sizeof (int) * (tin->num_triangles + 1));
+    if (order == NULL || first == NULL)
+	goto stop;
+    for (i = 0; i <= tin->num_triangles; i++)
+	first[i] = 0;
+    for (i = 0; i < tin->num_triangles; i++)
+	first[(tin->triangles + i)->group + 1] += 1;
+    for (i = 0; i < tin->num_triangles; i++)
+	first[i + 1] += first[i];
+    for (i = 0; i < tin->num_triangles; i++)
+      {
+	  int g = (tin->triangles + i)->group;
+	  order[first[g]++] = i;
+      }
+    for (i = tin->num_triangles; i > 0; i--)
+	first[i] = first[i - 1];
+    first[0] = 0;
+
+    for (i = 0; i < tin->num_triangles; i++)
+      {
+	  vdelTrianglePtr root = tin->triangles + i;
+	  int n;
+	  double kx;
+	  double ky;
+	  if (root->group != i)
+	      continue;
+	  n = first[i + 1] - first[i];
+	  vdel_group_key (tin, order + first[i], n, &kx, &ky);
+	  if (!vdel_is_owned (job, kx, ky))
+	      continue;
+	  if (!job->whole)
+	    {
+		/* the whole Delaunay cell must be certified */
+		int certified = 1;
+		for (k = 0; k < n; k++)
+		  {
+		      vdelTrianglePtr tr = tin->triangles + order[first[i] + k];
+		      if (!vdel_certified (job, tr->cx, tr->cy, tr->r))
+			  certified = 0;
+		  }
+		if (!certified)
+		  {
+		      retry = 1;
+		      continue;
+		  }
+	    }
+	  if (retry)
+	      continue;		/* just checking the remaining cells */
+	  for (k = 0; k < n; k++)
+	    {
+		vdelTrianglePtr tr = tin->triangles + order[first[i] + k];
+		int iv;
+		for (iv = 0; iv < 3; iv++)
+		  {
+		      vdelPointPtr pt = tin->points + tr->v[iv];
+		      xyz[iv * 3] = pt->x;
+		      xyz[(iv * 3) + 1] = pt->y;
+		      xyz[(iv * 3) + 2] = pt->z;
+		  }
+		if (!vdel_add_polygon (job, xyz, 3))
+		    goto stop;
+	    }
+      }
+    ret = retry ? VDEL_RETRY : VDEL_DONE;
+
+  stop:
+    if (order != NULL)
+	free (order);
+    if (first != NULL)
+	free (first);
+    return ret;
+}
+
+static int
+vdel_build_stars (vdelTinPtr tin)
+{
+/* building the list of triangles incident on each vertex */
+    int i;
+    int iv;
+    tin->star_offset = malloc (sizeof (int) * (tin->num_points + 1));
+    tin->star = malloc (sizeof (int) * ((tin->num_triangles * 3) + 1));
+    if (tin->star_offset == NULL || tin->star == NULL)
+	return 0;
+    for (i = 0; i <= tin->num_points; i++)
+	tin->star_offset[i] = 0;
+    for (i = 0; i < tin->num_triangles; i++)
+	for (iv = 0; iv < 3; iv++)
+	    tin->star_offset[(tin->triangles + i)->v[iv] + 1] += 1;
+    for (i = 0; i < tin->num_points; i++)
+	tin->star_offset[i + 1] += tin->star_offset[i];
+    for (i = 0; i < tin->num_triangles; i++)
+	for (iv = 0; iv < 3; iv++)
+	    tin->star[tin->star_offset[(tin->triangles + i)->v[iv]]++] = i;
+    for (i = tin->num_points; i > 0; i--)
+	tin->star_offset[i] = tin->star_offset[i - 1];
+    tin->star_offset[0] = 0;
+    return 1;
+}
+
+static void
+vdel_star_edges (vdelTinPtr tin, int t, int p, int *a, int *b)
+{
+/* the vertices following P on some counter-clockwise triangle */
+    vdelTrianglePtr tr = tin->triangles + t;
+    int iv;
+    for (iv = 0; iv < 3; iv++)
+      {
+	  if (tr->v[iv] == p)
+	    {
+		*a = tr->v[(iv + 1) % 3];
+		*b = tr->v[(iv + 2) % 3];
+		return;
+	    }
+      }
+    *a = -1;
+    *b = -1;
+}
+
+static int
+vdel_voronoj_cell (vdelJobPtr job, vdelTinPtr tin, int p, double *cell,
+		   double *out, double *tmp, int *n_out)
+{
+/* building the Voronoj cell of some vertex from its Delaunay star */
+    const vdelEngine *engine = job->engine;
+    vdelPointPtr pt = tin->points + p;
+    int first = tin->star_offset[p];
+    int count = tin->star_offset[p + 1] - first;
+    int start = -1;
+    int t;
+    int a = -1;
+    int b = -1;
+    int k;
+    int n = 0;
+    int closed = 1;
+    int retry = 0;
+    double fx;
+    double fy;
+    double len;
+    double far_dist;
+    double nax = 0.0;
+    double nay = 0.0;
+    double nbx = 0.0;
+    double nby = 0.0;
+    vdelEdgePtr e;
+
+    *n_out = 0;
+    if (count == 0)
+	return VDEL_DONE;	/* an isolated vertex has no cell */
+    for (k = 0; k < count; k++)
+      {
+	  t = tin->star[first + k];
+	  if (!job->whole)
+	    {
+		vdelTrianglePtr tr = tin->triangles + t;
+		if (!vdel_certified (job, tr->cx, tr->cy, tr->r))
+		    retry = 1;
+	    }
+	  vdel_star_edges (tin, t, p, &a, &b);
+	  e = vdel_find_edge (tin, p, a, 0);
+	  if (e == NULL)
+	      return VDEL_FAILURE;
+	  if (e->t2 < 0)
+	    {
+		/* P lies on the Hull: the star is open */
+		start = t;
+		closed = 0;
+	    }
+      }
+    if (retry)
+	return VDEL_RETRY;
+    if (start < 0)
+	start = tin->star[first];
+
+/* walking the star counter-clockwise */
+    t = start;
+    for (k = 0; k < count; k++)
+      {
+	  vdelTrianglePtr tr = tin->triangles + t;
+	  cell[n * 2] = tr->cx;
+	  cell[(n * 2) + 1] = tr->cy;
+	  n++;
+	  vdel_star_edges (tin, t, p, &a, &b);
+	  e = vdel_find_edge (tin, p, b, 0);
+	  if (e == NULL)
+	      return VDEL_FAILURE;
+	  if (k == count - 1)
+	      break;
+	  t = (e->t1 == t) ? e->t2 : e->t1;
+	  if (t < 0)
+	      return VDEL_FAILURE;
+      }
+    if (closed)
+      {
+	  e = vdel_find_edge (tin, p, b, 0);
+	  if ((e->t1 == t ? e->t2 : e->t1) != start)
+	      return VDEL_FAILURE;
+      }
+    else
+      {
+	  /* an unbounded cell: both Hull edges must be true Hull edges */
+	  int a0;
+	  int b0;
+	  vdel_star_edges (tin, start, p, &a0, &b0);
+	  if (!job->whole)
+	    {
+		if (!vdel_hull_edge
+		    (job, pt->x, pt->y, (tin->points + a0)->x,
+		     (tin->points + a0)->y))
+		    retry = 1;
+		if (!vdel_hull_edge
+		    (job, (tin->points + b)->x, (tin->points + b)->y, pt->x,
+		     pt->y))
+		    retry = 1;
+		if (retry)
+		    return VDEL_RETRY;
+	    }
+	  /* the outer normals of the two Hull edges */
+	  fx = (tin->points + a0)->x - pt->x;
+	  fy = (tin->points + a0)->y - pt->y;
+	  len = sqrt ((fx * fx) + (fy * fy));
+	  nax = fy / len;
+	  nay = -fx / len;
+	  fx = (tin->points + b)->x - pt->x;
+	  fy = (tin->points + b)->y - pt->y;
+	  len = sqrt ((fx * fx) + (fy * fy));
+	  nbx = -fy / len;
+	  nby = fx / len;
+	  far_dist =
+	      2.0 * ((engine->frame_maxx - engine->frame_minx) +
+		     (engine->frame_maxy - engine->frame_miny));
+	  for (k = 0; k < n; k++)
+	    {
+		double d = fabs (cell[k * 2] - pt->x) +
+		    fabs (cell[(k * 2) + 1] - pt->y);
+		if (d > far_dist)
+		    far_dist = d;
+	    }
+	  far_dist *= 4.0;
+	  /* closing the cell far beyond the frame */
+	  cell[n * 2] = cell[(n - 1) * 2] + (nbx * far_dist);
+	  cell[(n * 2) + 1] = cell[((n - 1) * 2) + 1] + (nby * far_dist);
+	  n++;
+	  fx = nax + nbx;
+	  fy = nay + nby;
+	  len = sqrt ((fx * fx) + (fy * fy));
+	  cell[n * 2] = pt->x + ((fx / len) * far_dist * 2.0);
+	  cell[(n * 2) + 1] = pt->y + ((fy / len) * far_dist * 2.0);
+	  n++;
+	  cell[n * 2] = cell[0] + (nax * far_dist);
+	  cell[(n * 2) + 1] = cell[1] + (nay * far_dist);
+	  n++;
+      }
+
+/* clipping the cell against the frame */
+    n = vdel_clip_rect (cell, n, engine->frame_minx, engine->frame_miny,
+			engine->frame_maxx, engine->frame_maxy, out, tmp);
+    *n_out = n;
+    return VDEL_DONE;
+}
+
+static int
+vdel_emit_voronoj (vdelJobPtr job, vdelTinPtr tin)
+{
+/* returning the Voronoj cells of all vertices owned by this Tile */
+    int i;
+    int k;
+    int max = 0;
+    int ret = VDEL_FAILURE;
+    int retry = 0;
+    double *cell = NULL;
+    double *out = NULL;
+    double *tmp = NULL;
+    double *xyz = NULL;
+    if (!vdel_build_stars (tin))
+	return VDEL_FAILURE;
+    for (i = 0; i < tin->num_points; i++)
+      {
+	  int n = tin->star_offset[i + 1] - tin->star_offset[i];
+	  if (n > max)
+	      max = n;
+      }
+    max += 8;
+    cell = malloc (sizeof (double) * 2 * max);
+    out = malloc (sizeof (double) * 2 * (max + 4));
+    tmp = malloc (sizeof (double) * 2 * (max + 4));
+    xyz = malloc (sizeof (double) * 3 * (max + 4));
+    if (cell == NULL || out == NULL || tmp == NULL || xyz == NULL)
+	goto stop;
+    for (i = 0; i < tin->num_points; i++)
+      {
+	  vdelPointPtr pt = tin->points + i;
+	  int n;
+	  int nv = 0;
+	  int status;
+	  if (vdel_find_vertex (tin, pt->x, pt->y) != i)
+	      continue;		/* duplicate vertex */
+	  if (!vdel_is_owned (job, pt->x, pt->y))
+	      continue;
+	  status = vdel_voronoj_cell (job, tin, i, cell, out, tmp, &n);
+	  if (status == VDEL_FAILURE)
+	      goto stop;
+	  if (status == VDEL_RETRY)
+	      retry = 1;
+	  if (retry)
+	      continue;		/* just checking the remaining cells */
+	  for (k = 0; k < n; k++)
+	    {
+		/* cocircular vertices produce repeated points */
+		if (nv > 0
+		    && fabs (out[k * 2] - xyz[(nv - 1) * 3]) <=
+		    fabs (out[k * 2]) * 1e-12
+		    && fabs (out[(k * 2) + 1] - xyz[((nv - 1) * 3) + 1]) <=
+		    fabs (out[(k * 2) + 1]) * 1e-12)
+		    continue;
+		xyz[nv * 3] = out[k * 2];
+		xyz[(nv * 3) + 1] = out[(k * 2) + 1];
+		xyz[(nv * 3) + 2] = 0.0;
+		nv++;
+	    }
+	  while (nv > 1 && xyz[(nv - 1) * 3] == xyz[0]
+		 && xyz[((nv - 1) * 3) + 1] == xyz[1])
+	      nv--;
+	  if (nv < 3)
+	      continue;
+	  if (!vdel_add_polygon (job, xyz, nv))
+	      goto stop;
+      }
+    ret = retry ? VDEL_RETRY : VDEL_DONE;
+
+  stop:
+    if (cell != NULL)
+	free (cell);
+    if (out != NULL)
+	free (out);
+    if (tmp != NULL)
+	free (tmp);
+    if (xyz != NULL)
+	free (xyz);
+    return ret;
+}
+
+static void
+vdel_process_tile (vdelJobPtr job)
+{
+/* triangulating a single Tile - may run on a worker thread */
+    GEOSContextHandle_t handle;
+    vdelTin tin;
+    int status = VDEL_FAILURE;
+    int i;
+
+    memset (&tin, 0, sizeof (vdelTin));
+    job->num_requests = 0;
+    job->grow = 0;
+    tin.points = job->points;
+    tin.num_points = job->num_points;
+#ifdef GEOS_REENTRANT		/* reentrant (thread-safe) initialization */
+    handle = GEOS_init_r ();
+#else /* end GEOS_REENTRANT */
+    handle = initGEOS_r (NULL, NULL);
+#endif
+    if (handle == NULL)
+	goto stop;
+    if (!vdel_build_outer (job))
+	goto stop;
+    if (!vdel_triangulate (handle, &tin))
+	goto stop;
+    if (!job->whole)
+      {
+	  int ret = vdel_check_coverage (job, &tin);
+	  if (ret < 0)
+	      goto stop;
+	  if (ret == 0)
+	    {
+		status = VDEL_RETRY;
+		goto stop;
+	    }
+      }
+    if (job->engine->mode == VDEL_VORONOJ)
+	status = vdel_emit_voronoj (job, &tin);
+    else
+	status = vdel_emit_delaunay (job, &tin);
+
+  stop:
+    vdel_free_tin (&tin);
+    for (i = 0; i < 4; i++)
+      {
+	  if (job->outer[i] != NULL)
+	      free (job->outer[i]);
+	  job->outer[i] = NULL;
+      }
+    if (handle != NULL)
+      {
+#ifdef GEOS_REENTRANT		/* reentrant (thread-safe) initialization */
+	  GEOS_finish_r (handle);
+#else /* end GEOS_REENTRANT */
+	  finishGEOS_r (handle);
+#endif
+      }
+    if (status != VDEL_DONE)
+      {
+	  /* discarding any partial result */
+	  job->num_coords = 0;
+	  job->num_polygons = 0;
+      }
+    job->status = status;
+}
+
+static void
+vdel_thread (void *arg)
+{
+/* the worker thread */
+    vdel_process_tile ((vdelJobPtr) arg);
+}
+
+static void
+vdel_run_jobs (vdelEnginePtr engine)
+{
+/* processing the current batch of Tiles in parallel */
+    int i;
+    void *threads[VDEL_MAX_THREADS];
+    for (i = 0; i < engine->num_jobs; i++)
+      {
+	  threads[i] = NULL;
+	  if (i == 0)
+	      continue;		/* the first Tile always runs on this thread */
+	  threads[i] = splite_thread_start (vdel_thread, engine->jobs + i);
+      }
+    vdel_process_tile (engine->jobs);
+    for (i = 1; i < engine->num_jobs; i++)
+      {
+	  if (threads[i] == NULL)
+	    {
+		/* no thread available: running on this thread */
+		vdel_process_tile (engine->jobs + i);
+		continue;
+	    }
+	  splite_thread_join (threads[i]);
+      }
+}
+
+static int
+vdel_enqueue (vdelEnginePtr engine, int tile_no, double buffer,
+	      vdelRectPtr extra, int num_extra, int rounds)
+{
+/* appending a Tile to the processing queue */
+    vdelQueueItemPtr item;
+    if (engine->queue_head + engine->queue_count >= engine->queue_max)
+      {
+	  if (engine->queue_head > 0)
+	    {
+		memmove (engine->queue, engine->queue + engine->queue_head,
+			 sizeof (vdelQueueItem) * engine->queue_count);
+		engine->queue_head = 0;
+	    }
+	  if (engine->queue_count >= engine->queue_max)
+	    {
+		int new_max =
+		    (engine->queue_max == 0) ? 64 : engine->queue_max * 2;
+		vdelQueueItemPtr p =
+		    realloc (engine->queue, sizeof (vdelQueueItem) * new_max);
+		if (p == NULL)
+		  {
+		      if (extra != NULL)
+			  free (extra);
+		      return 0;
+		  }
+		engine->queue = p;
+		engine->queue_max = new_max;
+	    }
+      }
+    item = engine->queue + engine->queue_head + engine->queue_count;
+    item->tile_no = tile_no;
+    item->buffer = buffer;
+    item->extra = extra;
+    item->num_extra = num_extra;
+    item->rounds = rounds;
+    engine->queue_count += 1;
+    return 1;
+}
+
+static int
+vdel_load_rect (vdelEnginePtr engine, vdelJobPtr job, double minx,
+		double miny, double maxx, double maxy)
+{
+/* fetching all the vertices falling within some rectangle */
+    int ret;
+    sqlite3_reset (engine->stmt);
+    sqlite3_clear_bindings (engine->stmt);
+    sqlite3_bind_double (engine->stmt, 1, maxx);
+    sqlite3_bind_double (engine->stmt, 2, minx);
+    sqlite3_bind_double (engine->stmt, 3, maxy);
+    sqlite3_bind_double (engine->stmt, 4, miny);
+    while (1)
+      {
+	  ret = sqlite3_step (engine->stmt);
+	  if (ret == SQLITE_DONE)
+	      break;
+	  if (ret == SQLITE_ROW)
+	    {
+		gaiaGeomCollPtr geom;
+		if (sqlite3_column_type (engine->stmt, 0) != SQLITE_BLOB)
+		    continue;
+		geom =
+		    gaiaFromSpatiaLiteBlobWkbEx (sqlite3_column_blob
+						 (engine->stmt, 0),
+						 sqlite3_column_bytes
+						 (engine->stmt, 0),
+						 engine->gpkg_mode,
+						 engine->gpkg_amphibious);
+		if (geom == NULL)
+		    continue;
+		ret =
+		    vdel_add_coords (&(job->points), &(job->num_points),
+				     &(job->max_points), geom, 1, minx, miny,
+				     maxx, maxy);
+		gaiaFreeGeomColl (geom);
+		if (!ret)
+		    return 0;
+	    }
+	  else
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+vdel_load_tile (vdelEnginePtr engine, vdelJobPtr job)
+{
+/* fetching all the vertices falling within the extended Tile */
+    int ix = job->tile_no % engine->nx;
+    int iy = job->tile_no / engine->nx;
+    int i;
+    job->core_minx = engine->minx + (engine->tile_w * ix);
+    job->core_maxx =
+	(ix == engine->nx - 1) ? engine->maxx : job->core_minx + engine->tile_w;
+    job->core_miny = engine->miny + (engine->tile_h * iy);
+    job->core_maxy =
+	(iy == engine->ny - 1) ? engine->maxy : job->core_miny + engine->tile_h;
+    job->ext_minx = job->core_minx - job->buffer;
+    job->ext_miny = job->core_miny - job->buffer;
+    job->ext_maxx = job->core_maxx + job->buffer;
+    job->ext_maxy = job->core_maxy + job->buffer;
+    job->whole = 0;
+    if (job->ext_minx <= engine->minx && job->ext_miny <= engine->miny
+	&& job->ext_maxx >= engine->maxx && job->ext_maxy >= engine->maxy)
+	job->whole = 1;
+    job->num_points = 0;
+    job->num_coords = 0;
+    job->num_polygons = 0;
+    job->status = VDEL_PENDING;
+    if (!vdel_load_rect
+	(engine, job, job->ext_minx, job->ext_miny, job->ext_maxx,
+	 job->ext_maxy))
+	return 0;
+    if (job->whole)
+	return 1;
+    for (i = 0; i < job->num_extra; i++)
+      {
+	  /* the additional areas near the Hull */
+	  vdelRectPtr rect = job->extra + i;
+	  if (!vdel_load_rect
+	      (engine, job, rect->minx, rect->miny, rect->maxx, rect->maxy))
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+vdel_retry_tile (vdelEnginePtr engine, vdelJobPtr job)
+{
+/* queuing again some Tile that failed to certify its own triangles */
+    vdelRectPtr extra = NULL;
+    int num_extra = job->num_extra;
+    int rounds = job->rounds + 1;
+    double buffer = job->buffer;
+    if (job->grow || job->num_requests == 0 || rounds > 8
+	|| num_extra + job->num_requests > 256)
+      {
+	  /* trying again with a doubled margin */
+	  buffer *= 2.0;
+	  num_extra = 0;
+	  rounds = 0;
+      }
+    else
+      {
+	  /* trying again with the requested areas */
+	  num_extra += job->num_requests;
+	  extra = malloc (sizeof (vdelRect) * num_extra);
+	  if (extra == NULL)
+	      return 0;
+	  if (job->num_extra > 0)
+	      memcpy (extra, job->extra, sizeof (vdelRect) * job->num_extra);
+	  memcpy (extra + job->num_extra, job->requests,
+		  sizeof (vdelRect) * job->num_requests);
+      }
+    return vdel_enqueue (engine, job->tile_no, buffer, extra, num_extra,
+			 rounds);
+}
+
+static int
+vdel_next_batch (vdelEnginePtr engine)
+{
+/* processing the next batch of Tiles; 0 when there are no more Tiles */
+    int i;
+    while (engine->queue_count > 0)
+      {
+	  engine->num_jobs = 0;
+	  while (engine->queue_count > 0
+		 && engine->num_jobs < engine->max_threads)
+	    {
+		vdelQueueItemPtr item = engine->queue + engine->queue_head;
+		vdelJobPtr job = engine->jobs + engine->num_jobs;
+		job->tile_no = item->tile_no;
+		job->buffer = item->buffer;
+		if (job->extra != NULL)
+		    free (job->extra);
+		job->extra = item->extra;
+		job->num_extra = item->num_extra;
+		job->rounds = item->rounds;
+		item->extra = NULL;
+		engine->queue_head += 1;
+		engine->queue_count -= 1;
+		if (!vdel_load_tile (engine, job))
+		    return -1;
+		engine->num_jobs += 1;
+	    }
+	  vdel_run_jobs (engine);
+	  for (i = 0; i < engine->num_jobs; i++)
+	    {
+		vdelJobPtr job = engine->jobs + i;
+		if (job->status == VDEL_FAILURE)
+		    return -1;
+		if (job->status == VDEL_RETRY)
+		  {
+		      if (!vdel_retry_tile (engine, job))
+			  return -1;
+		  }
+		/* releasing the input vertices as soon as possible */
+		if (job->max_points > VDEL_TILE_POINTS * 4)
+		  {
+		      free (job->points);
+		      job->points = NULL;
+		      job->max_points = 0;
+		  }
+	    }
+	  engine->cur_job = 0;
+	  engine->cur_polygon = 0;
+	  engine->cur_coord = 0;
+	  for (i = 0; i < engine->num_jobs; i++)
+	    {
+		vdelJobPtr job = engine->jobs + i;
+		if (job->status == VDEL_DONE && job->num_polygons > 0)
+		    return 1;
+	    }
+      }
+    return 0;
+}
+
+static void
+vdel_free_engine (vdelEnginePtr engine)
+{
+/* memory cleanup - tiled triangulation engine */
+    int i;
+    if (engine == NULL)
+	return;
+    if (engine->stmt != NULL)
+	sqlite3_finalize (engine->stmt);
+    if (engine->hull != NULL)
+	free (engine->hull);
+    if (engine->queue != NULL)
+      {
+	  for (i = 0; i < engine->queue_count; i++)
+	    {
+		vdelQueueItemPtr item = engine->queue + engine->queue_head + i;
+		if (item->extra != NULL)
+		    free (item->extra);
+	    }
+	  free (engine->queue);
+      }
+    if (engine->jobs != NULL)
+      {
+	  for (i = 0; i < engine->max_threads; i++)
+	    {
+		vdelJobPtr job = engine->jobs + i;
+		if (job->points != NULL)
+		    free (job->points);
+		if (job->coords != NULL)
+		    free (job->coords);
+		if (job->sizes != NULL)
+		    free (job->sizes);
+		if (job->extra != NULL)
+		    free (job->extra);
+		if (job->requests != NULL)
+		    free (job->requests);
+	    }
+	  free (engine->jobs);
+      }
+    free (engine);
+}
+
+static int
+vdel_has_spatial_index (sqlite3 * db, const char *table, const char *column,
+			char **real_table, char **real_column)
+{
+/* checks if the input Geometry is supported by an R*Tree Spatial Index */
+    sqlite3_stmt *stmt = NULL;
+    int ret;
+    int index = 0;
+    const char *sql = "SELECT f_table_name, f_geometry_column "
+	"FROM geometry_columns WHERE Lower(f_table_name) = Lower(?) "
+	"AND Lower(f_geometry_column) = Lower(?) AND spatial_index_enabled = 1";
+    ret = sqlite3_prepare_v2 (db, sql, strlen (sql), &stmt, NULL);
+    if (ret != SQLITE_OK)
+	return 0;
+    sqlite3_bind_text (stmt, 1, table, strlen (table), SQLITE_STATIC);
+    sqlite3_bind_text (stmt, 2, column, strlen (column), SQLITE_STATIC);
+    while (1)
+      {
+	  ret = sqlite3_step (stmt);
+	  if (ret != SQLITE_ROW)
+	      break;
+	  if (index)
+	      continue;
+	  *real_table = sqlite3_mprintf ("%s", sqlite3_column_text (stmt, 0));
+	  *real_column = sqlite3_mprintf ("%s", sqlite3_column_text (stmt, 1));
+	  index = 1;
+      }
+    sqlite3_finalize (stmt);
+    return index;
+}
+
+static vdelEnginePtr
+vdel_create_engine (sqlite3 * db, const void *p_cache, int mode,
+		    const char *table, const char *column,
+		    double extra_frame_size, double tile_size, int threads)
+{
+/* preparing the tiled triangulation engine */
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) p_cache;
+    vdelEnginePtr engine;
+    sqlite3_stmt *stmt = NULL;
+    vdelPointPtr chunk = NULL;
+    int num_chunk = 0;
+    int max_chunk = 0;
+    sqlite3_int64 count = 0;
+    char *xtable;
+    char *xcolumn;
+    char *real_table = NULL;
+    char *real_column = NULL;
+    char *sql;
+    int ret;
+    int i;
+    int first = 1;
+    int first_pt = 1;
+    double width;
+    double height;
+    double spacing;
+    double buffer;
+    double delta;
+
+    engine = malloc (sizeof (vdelEngine));
+    if (engine == NULL)
+	return NULL;
+    memset (engine, 0, sizeof (vdelEngine));
+    engine->mode = mode;
+    if (cache != NULL)
+      {
+	  engine->gpkg_mode = cache->gpkg_mode;
+	  engine->gpkg_amphibious = cache->gpkg_amphibious_mode;
+      }
+
+/* first pass: full extent, Convex Hull and dimensions */
+    xtable = gaiaDoubleQuotedSql (table);
+    xcolumn = gaiaDoubleQuotedSql (column);
+    sql = sqlite3_mprintf ("SELECT \"%s\" FROM main.\"%s\"", xcolumn, xtable);
+    ret = sqlite3_prepare_v2 (db, sql, strlen (sql), &stmt, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  free (xtable);
+	  free (xcolumn);
+	  goto error;
+      }
+    while (1)
+      {
+	  ret = sqlite3_step (stmt);
+	  if (ret == SQLITE_DONE)
+	      break;
+	  if (ret == SQLITE_ROW)
+	    {
+		gaiaGeomCollPtr geom;
+		if (sqlite3_column_type (stmt, 0) != SQLITE_BLOB)
+		    continue;
+		geom =
+		    gaiaFromSpatiaLiteBlobWkbEx (sqlite3_column_blob (stmt, 0),
+						 sqlite3_column_bytes (stmt,
+								       0),
+						 engine->gpkg_mode,
+						 engine->gpkg_amphibious);
+		if (geom == NULL)
+		    continue;
+		if (first)
+		  {
+		      engine->srid = geom->Srid;
+		      if (geom->DimensionModel == GAIA_XY_Z
+			  || geom->DimensionModel == GAIA_XY_Z_M)
+			  engine->has_z = 1;
+		  }
+		first = 0;
+		i = num_chunk;
+		ret =
+		    vdel_add_coords (&chunk, &num_chunk, &max_chunk, geom, 0,
+				     0.0, 0.0, 0.0, 0.0);
+		gaiaFreeGeomColl (geom);
+		if (!ret)
+		    break;
+		count += num_chunk - i;
+		for (; i < num_chunk; i++)
+		  {
+		      vdelPointPtr pt = chunk + i;
+		      if (first_pt)
+			{
+			    first_pt = 0;
+			    engine->minx = pt->x;
+			    engine->maxx = pt->x;
+			    engine->miny = pt->y;
+			    engine->maxy = pt->y;
+			}
+		      if (pt->x < engine->minx)
+			  engine->minx = pt->x;
+		      if (pt->x > engine->maxx)
+			  engine->maxx = pt->x;
+		      if (pt->y < engine->miny)
+			  engine->miny = pt->y;
+		      if (pt->y > engine->maxy)
+			  engine->maxy = pt->y;
+		  }
+		if (num_chunk >= VDEL_HULL_CHUNK)
+		  {
+		      if (!vdel_merge_hull (engine, chunk, num_chunk))
+			  break;
+		      num_chunk = 0;
+		  }
+	    }
+	  else
+	      break;
+      }
+    sqlite3_finalize (stmt);
+    stmt = NULL;
+    if (ret != SQLITE_DONE)
+      {
+	  free (xtable);
+	  free (xcolumn);
+	  goto error;
+      }
+    if (num_chunk > 0)
+      {
+	  if (!vdel_merge_hull (engine, chunk, num_chunk))
+	    {
+		free (xtable);
+		free (xcolumn);
+		goto error;
+	    }
+      }
+    if (chunk != NULL)
+	free (chunk);
+    chunk = NULL;
+    if (count < 3 || engine->num_hull < 3)
+      {
+	  /* nothing to be triangulated */
+	  free (xtable);
+	  free (xcolumn);
+	  goto error;
+      }
+
+/* preparing the per-Tile query */
+    if (vdel_has_spatial_index (db, table, column, &real_table, &real_column))
+      {
+	  char *idx_name =
+	      sqlite3_mprintf ("idx_%s_%s", real_table, real_column);
+	  char *xidx_name = gaiaDoubleQuotedSql (idx_name);
+	  sqlite3_free (idx_name);
+	  sql =
+	      sqlite3_mprintf ("SELECT \"%s\" FROM main.\"%s\" WHERE ROWID IN "
+			       "(SELECT pkid FROM main.\"%s\" WHERE xmin <= ? "
+			       "AND xmax >= ? AND ymin <= ? AND ymax >= ?)",
+			       xcolumn, xtable, xidx_name);
+	  free (xidx_name);
+	  sqlite3_free (real_table);
+	  sqlite3_free (real_column);
+      }
+    else
+	sql =
+	    sqlite3_mprintf ("SELECT \"%s\" FROM main.\"%s\" WHERE "
+			     "MbrMinX(\"%s\") <= ? AND MbrMaxX(\"%s\") >= ? AND "
+			     "MbrMinY(\"%s\") <= ? AND MbrMaxY(\"%s\") >= ?",
+			     xcolumn, xtable, xcolumn, xcolumn, xcolumn,
+			     xcolumn);
+    free (xtable);
+    free (xcolumn);
+    ret = sqlite3_prepare_v2 (db, sql, strlen (sql), &(engine->stmt), NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	goto error;
+
+/* setting up the Tiles grid */
+    width = engine->maxx - engine->minx;
+    height = engine->maxy - engine->miny;
+    spacing = sqrt ((width * height) / (double) count);
+    if (tile_size <= 0.0)
+      {
+	  /* default: about VDEL_TILE_POINTS vertices per Tile */
+	  if (count <= VDEL_TILE_POINTS)
+	      tile_size = DBL_MAX;
+	  else
+	      tile_size = spacing * sqrt ((double) VDEL_TILE_POINTS);
+      }
+    engine->nx = 1;
+    engine->ny = 1;
+    if (width / tile_size > 1.0)
+	engine->nx = (int) ceil (width / tile_size);
+    if (height / tile_size > 1.0)
+	engine->ny = (int) ceil (height / tile_size);
+    if (engine->nx > 4096)
+	engine->nx = 4096;
+    if (engine->ny > 4096)
+	engine->ny = 4096;
+    engine->tile_w = width / engine->nx;
+    engine->tile_h = height / engine->ny;
+    if (engine->tile_w <= 0.0)
+	engine->tile_w = 1.0;
+    if (engine->tile_h <= 0.0)
+	engine->tile_h = 1.0;
+    buffer = spacing * 4.0;
+    if (buffer <= 0.0)
+	buffer = (width > height) ? width : height;
+
+/* setting up the Voronoj frame */
+    if (extra_frame_size < 0.0)
+	extra_frame_size = 5.0;
+    delta = (width * extra_frame_size) / 100.0;
+    if ((height * extra_frame_size) / 100.0 > delta)
+	delta = (height * extra_frame_size) / 100.0;
+    engine->frame_minx = engine->minx - delta;
+    engine->frame_miny = engine->miny - delta;
+    engine->frame_maxx = engine->maxx + delta;
+    engine->frame_maxy = engine->maxy + delta;
+
+/* queuing all Tiles intersecting the Convex Hull */
+    engine->max_threads = (threads > 0) ? threads : splite_cpu_count (VDEL_MAX_THREADS);
+    if (engine->max_threads > VDEL_MAX_THREADS)
+	engine->max_threads = VDEL_MAX_THREADS;
+    engine->jobs = malloc (sizeof (vdelJob) * engine->max_threads);
+    if (engine->jobs == NULL)
+	goto error;
+    memset (engine->jobs, 0, sizeof (vdelJob) * engine->max_threads);
+    for (i = 0; i < engine->max_threads; i++)
+	(engine->jobs + i)->engine = engine;
+    for (i = 0; i < engine->nx * engine->ny; i++)
+      {
+	  if (engine->nx * engine->ny > 1)
+	    {
+		/* skipping Tiles not intersecting the Convex Hull */
+		double *out = malloc (sizeof (double) * 2 * (engine->num_hull + 8));
+		double *tmp = malloc (sizeof (double) * 2 * (engine->num_hull + 8));
+		int ix = i % engine->nx;
+		int iy = i / engine->nx;
+		int n = 0;
+		if (out != NULL && tmp != NULL)
+		    n = vdel_clip_rect (engine->hull, engine->num_hull,
+					engine->minx + (engine->tile_w * ix),
+					engine->miny + (engine->tile_h * iy),
+					engine->minx +
+					(engine->tile_w * (ix + 1)),
+					engine->miny +
+					(engine->tile_h * (iy + 1)), out, tmp);
+		else
+		    n = 1;
+		if (out != NULL)
+		    free (out);
+		if (tmp != NULL)
+		    free (tmp);
+		if (n == 0)
+		    continue;
+	    }
+	  if (!vdel_enqueue (engine, i, buffer, NULL, 0, 0))
+	      goto error;
+      }
+    return engine;
+
+  error:
+    if (stmt != NULL)
+	sqlite3_finalize (stmt);
+    if (chunk != NULL)
+	free (chunk);
+    vdel_free_engine (engine);
+    return NULL;
+}
+
+/******************************************************************************
+/
+/ VirtualTable structs
+/
+******************************************************************************/
+
+typedef struct VirtualDelaunayStruct
+{
+/* extends the sqlite3_vtab struct */
+    const sqlite3_module *pModule;	/* ptr to sqlite module: USED INTERNALLY BY SQLITE */
+    int nRef;			/* # references: USED INTERNALLY BY SQLITE */
+    char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
+    sqlite3 *db;		/* the sqlite db holding the virtual table */
+    const void *p_cache;	/* pointer to the internal cache */
+    int mode;			/* Delaunay triangles or Voronoj cells */
+} VirtualDelaunay;
+typedef VirtualDelaunay *VirtualDelaunayPtr;
+
+typedef struct VirtualDelaunayCursorStruct
+{
+/* extends the sqlite3_vtab_cursor struct */
+    VirtualDelaunayPtr pVtab;	/* Virtual table of this cursor */
+    int eof;			/* the EOF marker */
+    vdelEnginePtr engine;	/* the tiled triangulation engine */
+    sqlite3_int64 current_row;	/* the current ROWID */
+} VirtualDelaunayCursor;
+typedef VirtualDelaunayCursor *VirtualDelaunayCursorPtr;
+
+static int
+vdel_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	     sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* creates the virtual table for tiled Delaunay */
+    VirtualDelaunayPtr p_vt;
+    char *buf;
+    char *vtable;
+    char *xname;
+    int mode;
+    if (argc == 3)
+	vtable = gaiaDequotedSql ((char *) argv[2]);
+    else
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualDelaunay module] CREATE VIRTUAL: illegal arg list {void}\n");
+	  return SQLITE_ERROR;
+      }
+    if (strcasecmp (argv[0], "VoronojCells") == 0)
+	mode = VDEL_VORONOJ;
+    else
+	mode = VDEL_DELAUNAY;
+    p_vt = (VirtualDelaunayPtr) sqlite3_malloc (sizeof (VirtualDelaunay));
+    if (!p_vt)
+      {
+	  free (vtable);
+	  return SQLITE_NOMEM;
+      }
+    p_vt->db = db;
+    p_vt->pModule = &my_delaunay_module;
+    p_vt->nRef = 0;
+    p_vt->zErrMsg = NULL;
+    p_vt->p_cache = pAux;
+    p_vt->mode = mode;
+/* preparing the COLUMNs for this VIRTUAL TABLE */
+    xname = gaiaDoubleQuotedSql (vtable);
+    if (mode == VDEL_VORONOJ)
+	buf = sqlite3_mprintf ("CREATE TABLE \"%s\" (tile_no INTEGER, "
+			       "geometry BLOB, table_name TEXT HIDDEN, "
+			       "geometry_column TEXT HIDDEN, "
+			       "extra_frame_size DOUBLE HIDDEN, "
+			       "tile_size DOUBLE HIDDEN, "
+			       "threads INTEGER HIDDEN)", xname);
+    else
+	buf = sqlite3_mprintf ("CREATE TABLE \"%s\" (tile_no INTEGER, "
+			       "geometry BLOB, table_name TEXT HIDDEN, "
+			       "geometry_column TEXT HIDDEN, "
+			       "tile_size DOUBLE HIDDEN, "
+			       "threads INTEGER HIDDEN)", xname);
+    free (xname);
+    free (vtable);
+    if (sqlite3_declare_vtab (db, buf) != SQLITE_OK)
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualDelaunay module] CREATE VIRTUAL: invalid SQL statement \"%s\"",
+	       buf);
+	  sqlite3_free (buf);
+	  sqlite3_free (p_vt);
+	  return SQLITE_ERROR;
+      }
+    sqlite3_free (buf);
+    *ppVTab = (sqlite3_vtab *) p_vt;
+    return SQLITE_OK;
+}
+
+static int
+vdel_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
+{
+/* best index selection */
+    VirtualDelaunayPtr p_vt = (VirtualDelaunayPtr) pVTab;
+    int args[5] = { -1, -1, -1, -1, -1 };
+    int max_args = (p_vt->mode == VDEL_VORONOJ) ? 5 : 4;
+    int i;
+    int n;
+    int unusable = 0;
+    for (i = 0; i < pIdxInfo->nConstraint; i++)
+      {
+	  /* verifying the constraints */
+	  struct sqlite3_index_constraint *p = &(pIdxInfo->aConstraint[i]);
+	  if (p->op != SQLITE_INDEX_CONSTRAINT_EQ || p->iColumn < 2
+	      || p->iColumn >= 2 + max_args)
+	      continue;
+	  if (!p->usable)
+	    {
+		unusable = 1;
+		continue;
+	    }
+	  args[p->iColumn - 2] = i;
+      }
+    for (n = 0; n < max_args; n++)
+      {
+	  /* the optional args must be contiguous */
+	  if (args[n] < 0)
+	      break;
+      }
+    if (n >= 2)
+      {
+	  /* this one is a valid tiled triangulation query */
+	  for (i = 0; i < n; i++)
+	    {
+		pIdxInfo->aConstraintUsage[args[i]].argvIndex = i + 1;
+		pIdxInfo->aConstraintUsage[args[i]].omit = 1;
+	    }
+	  pIdxInfo->idxNum = n;
+	  pIdxInfo->estimatedCost = 1000000.0;
+      }
+    else
+      {
+	  /* illegal query: the input args could become available later */
+	  pIdxInfo->idxNum = 0;
+	  pIdxInfo->estimatedCost = unusable ? 1.0e300 : 1.0e100;
+      }
+    return SQLITE_OK;
+}
+
+static int
+vdel_disconnect (sqlite3_vtab * pVTab)
+{
+/* disconnects the virtual table */
+    VirtualDelaunayPtr p_vt = (VirtualDelaunayPtr) pVTab;
+    sqlite3_free (p_vt);
+    return SQLITE_OK;
+}
+
+static int
+vdel_destroy (sqlite3_vtab * pVTab)
+{
+/* destroys the virtual table - simply aliases vdel_disconnect() */
+    return vdel_disconnect (pVTab);
+}
+
+static int
+vdel_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
+{
+/* opening a new cursor */
+    VirtualDelaunayCursorPtr cursor =
+	(VirtualDelaunayCursorPtr)
+	sqlite3_malloc (sizeof (VirtualDelaunayCursor));
+    if (cursor == NULL)
+	return SQLITE_ERROR;
+    memset (cursor, 0, sizeof (VirtualDelaunayCursor));
+    cursor->pVtab = (VirtualDelaunayPtr) pVTab;
+    cursor->eof = 1;
+    *ppCursor = (sqlite3_vtab_cursor *) cursor;
+    return SQLITE_OK;
+}
+
+static int
+vdel_close (sqlite3_vtab_cursor * pCursor)
+{
+/* closing the cursor */
+    VirtualDelaunayCursorPtr cursor = (VirtualDelaunayCursorPtr) pCursor;
+    vdel_free_engine (cursor->engine);
+    sqlite3_free (pCursor);
+    return SQLITE_OK;
+}
+
+static int
+vdel_fetch (VirtualDelaunayCursorPtr cursor)
+{
+/* positioning on the next output Polygon */
+    vdelEnginePtr engine = cursor->engine;
+    int ret;
+    while (1)
+      {
+	  while (engine->cur_job < engine->num_jobs)
+	    {
+		vdelJobPtr job = engine->jobs + engine->cur_job;
+		if (job->status == VDEL_DONE
+		    && engine->cur_polygon < job->num_polygons)
+		  {
+		      cursor->current_row += 1;
+		      return SQLITE_OK;
+		  }
+		engine->cur_job += 1;
+		engine->cur_polygon = 0;
+		engine->cur_coord = 0;
+	    }
+	  ret = vdel_next_batch (engine);
+	  if (ret == 0)
+	    {
+		cursor->eof = 1;
+		return SQLITE_OK;
+	    }
+	  if (ret < 0)
+	    {
+		cursor->eof = 1;
+		sqlite3_free (cursor->pVtab->zErrMsg);
+		cursor->pVtab->zErrMsg =
+		    sqlite3_mprintf
+		    ("%s: unable to triangulate some Tile",
+		     (cursor->pVtab->mode ==
+		      VDEL_VORONOJ) ? "VoronojCells" : "DelaunayTriangles");
+		return SQLITE_ERROR;
+	    }
+      }
+}
+
+static int
+vdel_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
+	     int argc, sqlite3_value ** argv)
+{
+/* setting up a cursor filter */
+    VirtualDelaunayCursorPtr cursor = (VirtualDelaunayCursorPtr) pCursor;
+    const char *table;
+    const char *column;
+    double extra_frame_size = -1.0;
+    double tile_size = 0.0;
+    int threads = 0;
+    int i;
+    if (idxStr)
+	idxStr = idxStr;	/* unused arg warning suppression */
+    vdel_free_engine (cursor->engine);
+    cursor->engine = NULL;
+    cursor->eof = 1;
+    cursor->current_row = 0;
+    if (idxNum < 2 || argc != idxNum)
+	return SQLITE_OK;
+
+    if (sqlite3_value_type (argv[0]) != SQLITE_TEXT)
+	return SQLITE_OK;
+    table = (const char *) sqlite3_value_text (argv[0]);
+    if (sqlite3_value_type (argv[1]) != SQLITE_TEXT)
+	return SQLITE_OK;
+    column = (const char *) sqlite3_value_text (argv[1]);
+    for (i = 2; i < argc; i++)
+      {
+	  /* the optional args */
+	  int arg = i;
+	  double value;
+	  if (cursor->pVtab->mode != VDEL_VORONOJ)
+	      arg++;		/* no extra_frame_size */
+	  if (arg == 4)
+	    {
+		/* number of threads */
+		if (sqlite3_value_type (argv[i]) != SQLITE_INTEGER)
+		    return SQLITE_OK;
+		threads = sqlite3_value_int (argv[i]);
+		if (threads < 1)
+		    return SQLITE_OK;
+		continue;
+	    }
+	  if (sqlite3_value_type (argv[i]) == SQLITE_INTEGER)
+	      value = sqlite3_value_int (argv[i]);
+	  else if (sqlite3_value_type (argv[i]) == SQLITE_FLOAT)
+	      value = sqlite3_value_double (argv[i]);
+	  else
+	      return SQLITE_OK;
+	  if (arg == 2)
+	      extra_frame_size = value;
+	  else
+	    {
+		/* tile size */
+		if (value <= 0.0)
+		    return SQLITE_OK;
+		tile_size = value;
+	    }
+      }
+
+    cursor->engine =
+	vdel_create_engine (cursor->pVtab->db, cursor->pVtab->p_cache,
+			    cursor->pVtab->mode, table, column,
+			    extra_frame_size, tile_size, threads);
+    if (cursor->engine == NULL)
+	return SQLITE_OK;
+    cursor->eof = 0;
+    return vdel_fetch (cursor);
+}
+
+static int
+vdel_next (sqlite3_vtab_cursor * pCursor)
+{
+/* fetching next row from cursor */
+    VirtualDelaunayCursorPtr cursor = (VirtualDelaunayCursorPtr) pCursor;
+    vdelEnginePtr engine = cursor->engine;
+    vdelJobPtr job;
+    if (cursor->eof)
+	return SQLITE_OK;
+    job = engine->jobs + engine->cur_job;
+    engine->cur_coord += job->sizes[engine->cur_polygon] * 3;
+    engine->cur_polygon += 1;
+    return vdel_fetch (cursor);
+}
+
+static int
+vdel_eof (sqlite3_vtab_cursor * pCursor)
+{
+/* cursor EOF */
+    VirtualDelaunayCursorPtr cursor = (VirtualDelaunayCursorPtr) pCursor;
+    return cursor->eof;
+}
+
+static int
+vdel_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
+	     int column)
+{
+/* fetching value for the Nth column */
+    VirtualDelaunayCursorPtr cursor = (VirtualDelaunayCursorPtr) pCursor;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) (cursor->pVtab->p_cache);
+    vdelEnginePtr engine = cursor->engine;
+    vdelJobPtr job;
+    if (cursor->eof || engine == NULL)
+      {
+	  sqlite3_result_null (pContext);
+	  return SQLITE_OK;
+      }
+    job = engine->jobs + engine->cur_job;
+    if (column == 0)
+      {
+	  /* the "tile_no" column */
+	  sqlite3_result_int (pContext, job->tile_no);
+      }
+    else if (column == 1)
+      {
+	  /* the "geometry" column */
+	  gaiaGeomCollPtr geom;
+	  gaiaPolygonPtr pg;
+	  gaiaRingPtr rng;
+	  unsigned char *blob;
+	  int size;
+	  int gpkg_mode = 0;
+	  int tiny_point = 0;
+	  int n = job->sizes[engine->cur_polygon];
+	  const double *xyz = job->coords + engine->cur_coord;
+	  int iv;
+	  int has_z = (engine->mode == VDEL_DELAUNAY && engine->has_z);
+	  if (cache != NULL)
+	    {
+		gpkg_mode = cache->gpkg_mode;
+		tiny_point = cache->tinyPointEnabled;
+	    }
+	  if (has_z)
+	      geom = gaiaAllocGeomCollXYZ ();
+	  else
+	      geom = gaiaAllocGeomColl ();
+	  geom->Srid = engine->srid;
+	  geom->DeclaredType = GAIA_POLYGON;
+	  pg = gaiaAddPolygonToGeomColl (geom, n + 1, 0);
+	  rng = pg->Exterior;
+	  for (iv = 0; iv <= n; iv++)
+	    {
+		const double *p = xyz + ((iv % n) * 3);
+		if (has_z)
+		  {
+		      gaiaSetPointXYZ (rng->Coords, iv, p[0], p[1], p[2]);
+		  }
+		else
+		  {
+		      gaiaSetPoint (rng->Coords, iv, p[0], p[1]);
+		  }
+	    }
+	  gaiaToSpatiaLiteBlobWkbEx2 (geom, &blob, &size, gpkg_mode,
+				      tiny_point);
+	  gaiaFreeGeomColl (geom);
+	  sqlite3_result_blob (pContext, blob, size, free);
+      }
+    else
+	sqlite3_result_null (pContext);
+    return SQLITE_OK;
+}
+
+static int
+vdel_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
+{
+/* fetching the ROWID */
+    VirtualDelaunayCursorPtr cursor = (VirtualDelaunayCursorPtr) pCursor;
+    *pRowid = cursor->current_row;
+    return SQLITE_OK;
+}
+
+static int
+vdel_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
+	     sqlite_int64 * pRowid)
+{
+/* generic update [INSERT / UPDATE / DELETE */
+    if (pRowid || argc || argv || pVTab)
+	pRowid = pRowid;	/* unused arg warning suppression */
+/* read only datasource */
+    return SQLITE_READONLY;
+}
+
+static int
+vdel_begin (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vdel_sync (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vdel_commit (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vdel_rollback (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vdel_rename (sqlite3_vtab * pVTab, const char *zNew)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    if (zNew)
+	zNew = zNew;		/* unused arg warning suppression */
+    return SQLITE_ERROR;
+}
+
+static int
+spliteVirtualDelaunayInit (sqlite3 * db, const void *p_cache)
+{
+    int rc = SQLITE_OK;
+    my_delaunay_module.iVersion = 1;
+    my_delaunay_module.xCreate = &vdel_create;
+    my_delaunay_module.xConnect = &vdel_create;	/* eponymous */
+    my_delaunay_module.xBestIndex = &vdel_best_index;
+    my_delaunay_module.xDisconnect = &vdel_disconnect;
+    my_delaunay_module.xDestroy = &vdel_destroy;
+    my_delaunay_module.xOpen = &vdel_open;
+    my_delaunay_module.xClose = &vdel_close;
+    my_delaunay_module.xFilter = &vdel_filter;
+    my_delaunay_module.xNext = &vdel_next;
+    my_delaunay_module.xEof = &vdel_eof;
+    my_delaunay_module.xColumn = &vdel_column;
+    my_delaunay_module.xRowid = &vdel_rowid;
+    my_delaunay_module.xUpdate = &vdel_update;
+    my_delaunay_module.xBegin = &vdel_begin;
+    my_delaunay_module.xSync = &vdel_sync;
+    my_delaunay_module.xCommit = &vdel_commit;
+    my_delaunay_module.xRollback = &vdel_rollback;
+    my_delaunay_module.xFindFunction = NULL;
+    my_delaunay_module.xRename = &vdel_rename;
+/* the same module acts as two eponymous table-valued functions */
+    sqlite3_create_module_v2 (db, "DelaunayTriangles", &my_delaunay_module,
+			      (void *) p_cache, 0);
+    sqlite3_create_module_v2 (db, "VoronojCells", &my_delaunay_module,
+			      (void *) p_cache, 0);
+    return rc;
+}
+
+SPATIALITE_PRIVATE int
+virtualdelaunay_extension_init (void *xdb, const void *p_cache)
+{
+    sqlite3 *db = (sqlite3 *) xdb;
+    return spliteVirtualDelaunayInit (db, p_cache);
+}
+
+#endif /* end GEOS conditional */
@@ -115,7 +115,6 @@ typedef struct VirtualFDOStruct
     char **Column;		/* the name for each column */
     char **Type;		/* the type for each column */
     int *NotNull;		/* NotNull clause for each column */
-    SqliteValuePtr *Value;	/* the current-row value for each column */
     int nGeometries;		/* # Geometry columns into the table */
     char **GeoColumn;		/* the name for each Geometry column */
     int *Srid;			/* the SRID for each Geometry column */
@@ -130,6 +129,9 @@ typedef struct VirtualFDOCursorStruct
 /* extends the sqlite3_vtab_cursor struct */
     VirtualFDOPtr pVtab;	/* Virtual table of this cursor */
     sqlite3_stmt *stmt;
+    char *idxStr;		/* the query plan the statement was built for */
+    int *ColUsed;		/* columns actually referenced by the query */
+    SqliteValuePtr *Value;	/* the current-row value for each column */
     sqlite3_int64 current_row;	/* the current row ID */
     int eof;			/* the EOF marker */
 } VirtualFDOCursor;
@@ -271,15 +273,6 @@ free_table (VirtualFDOPtr p_vt)
       }
     if (p_vt->NotNull)
 	sqlite3_free (p_vt->NotNull);
-    if (p_vt->Value)
-      {
-	  for (i = 0; i < p_vt->nColumns; i++)
-	    {
-		if (*(p_vt->Value + i))
-		    value_free (*(p_vt->Value + i));
-	    }
-	  sqlite3_free (p_vt->Value);
-      }
     if (p_vt->GeoColumn)
       {
 	  for (i = 0; i < p_vt->nGeometries; i++)
@@ -1478,18 +1471,18 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
     const unsigned char *blob;
     unsigned char *xblob;
     int size;
-    sqlite3_int64 pk;
     int geom_done;
     gaiaGeomCollPtr geom;
     stmt = cursor->stmt;
-    sqlite3_bind_int64 (stmt, 1, cursor->current_row);
     ret = sqlite3_step (stmt);
     if (ret == SQLITE_ROW)
       {
-	  pk = sqlite3_column_int64 (stmt, 0);
+	  cursor->current_row = sqlite3_column_int64 (stmt, 0);
 	  for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
 	    {
 		/* fetching column values */
+		if (!(*(cursor->ColUsed + ic)))
+		    continue;	/* not referenced by the query */
 		geom_done = 0;
 		for (ig = 0; ig < cursor->pVtab->nGeometries; ig++)
 		  {
@@ -1518,7 +1511,7 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 					      if (wkt == NULL)
 						{
 						    value_set_null (*
-								    (cursor->pVtab->Value
+								    (cursor->Value
 								     + ic));
 						    continue;
 						}
@@ -1529,8 +1522,7 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 					    free ((void *) wkt);
 					if (!geom)
 					    value_set_null (*
-							    (cursor->
-							     pVtab->Value +
+							    (cursor->Value +
 							     ic));
 					else
 					  {
@@ -1542,7 +1534,7 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 					      if (xblob)
 						{
 						    value_set_blob (*
-								    (cursor->pVtab->Value
+								    (cursor->Value
 								     + ic),
 								    xblob,
 								    size);
@@ -1550,14 +1542,14 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 						}
 					      else
 						  value_set_null (*
-								  (cursor->pVtab->Value
+								  (cursor->Value
 								   + ic));
 					      gaiaFreeGeomColl (geom);
 					  }
 				    }
 				  else
 				      value_set_null (*
-						      (cursor->pVtab->Value +
+						      (cursor->Value +
 						       ic));
 				  break;
 			      case FDO_OGR_WKB:
@@ -1572,8 +1564,7 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 					geom = gaiaFromWkb (blob, size);
 					if (!geom)
 					    value_set_null (*
-							    (cursor->
-							     pVtab->Value +
+							    (cursor->Value +
 							     ic));
 					else
 					  {
@@ -1585,7 +1576,7 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 					      if (xblob)
 						{
 						    value_set_blob (*
-								    (cursor->pVtab->Value
+								    (cursor->Value
 								     + ic),
 								    xblob,
 								    size);
@@ -1593,14 +1584,14 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 						}
 					      else
 						  value_set_null (*
-								  (cursor->pVtab->Value
+								  (cursor->Value
 								   + ic));
 					      gaiaFreeGeomColl (geom);
 					  }
 				    }
 				  else
 				      value_set_null (*
-						      (cursor->pVtab->Value +
+						      (cursor->Value +
 						       ic));
 				  break;
 			      case FDO_OGR_FGF:
@@ -1615,8 +1606,7 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 					geom = gaiaFromFgf (blob, size);
 					if (!geom)
 					    value_set_null (*
-							    (cursor->
-							     pVtab->Value +
+							    (cursor->Value +
 							     ic));
 					else
 					  {
@@ -1628,7 +1618,7 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 					      if (xblob)
 						{
 						    value_set_blob (*
-								    (cursor->pVtab->Value
+								    (cursor->Value
 								     + ic),
 								    xblob,
 								    size);
@@ -1636,14 +1626,14 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 						}
 					      else
 						  value_set_null (*
-								  (cursor->pVtab->Value
+								  (cursor->Value
 								   + ic));
 					      gaiaFreeGeomColl (geom);
 					  }
 				    }
 				  else
 				      value_set_null (*
-						      (cursor->pVtab->Value +
+						      (cursor->Value +
 						       ic));
 				  break;
 			      case FDO_OGR_SPLITE:
@@ -1656,16 +1646,16 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 					size =
 					    sqlite3_column_bytes (stmt, ic + 1);
 					value_set_blob (*
-							(cursor->pVtab->Value +
-							 ic), blob, size);
+							(cursor->Value
+							 + ic), blob, size);
 				    }
 				  else
 				      value_set_null (*
-						      (cursor->pVtab->Value +
+						      (cursor->Value +
 						       ic));
 				  break;
 			      default:
-				  value_set_null (*(cursor->pVtab->Value + ic));
+				  value_set_null (*(cursor->Value + ic));
 				  break;
 			      };
 			    geom_done = 1;
@@ -1676,38 +1666,37 @@ vfdo_read_row (VirtualFDOCursorPtr cursor)
 		switch (sqlite3_column_type (stmt, ic + 1))
 		  {
 		  case SQLITE_INTEGER:
-		      value_set_int (*(cursor->pVtab->Value + ic),
+		      value_set_int (*(cursor->Value + ic),
 				     sqlite3_column_int64 (stmt, ic + 1));
 		      break;
 		  case SQLITE_FLOAT:
-		      value_set_double (*(cursor->pVtab->Value + ic),
+		      value_set_double (*(cursor->Value + ic),
 					sqlite3_column_double (stmt, ic + 1));
 		      break;
 		  case SQLITE_TEXT:
 		      text = (char *) sqlite3_column_text (stmt, ic + 1);
 		      size = sqlite3_column_bytes (stmt, ic + 1);
-		      value_set_text (*(cursor->pVtab->Value + ic), text, size);
+		      value_set_text (*(cursor->Value + ic), text, size);
 		      break;
 		  case SQLITE_BLOB:
 		      blob = sqlite3_column_blob (stmt, ic + 1);
 		      size = sqlite3_column_bytes (stmt, ic + 1);
-		      value_set_blob (*(cursor->pVtab->Value + ic), blob, size);
+		      value_set_blob (*(cursor->Value + ic), blob, size);
 		      break;
 		  case SQLITE_NULL:
 		  default:
-		      value_set_null (*(cursor->pVtab->Value + ic));
+		      value_set_null (*(cursor->Value + ic));
 		      break;
 		  };
 	    }
       }
     else
       {
-	  /* an error occurred */
+	  /* end of result set or an error occurred */
 	  cursor->eof = 1;
 	  return;
       }
     cursor->eof = 0;
-    cursor->current_row = pk;
 }
 
 static int
@@ -1789,13 +1778,11 @@ vfdo_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 	  p_vt->Column = sqlite3_malloc (sizeof (char *) * n_rows);
 	  p_vt->Type = sqlite3_malloc (sizeof (char *) * n_rows);
 	  p_vt->NotNull = sqlite3_malloc (sizeof (int) * n_rows);
-	  p_vt->Value = sqlite3_malloc (sizeof (SqliteValuePtr) * n_rows);
 	  for (i = 0; i < n_rows; i++)
 	    {
 		*(p_vt->Column + i) = NULL;
 		*(p_vt->Type + i) = NULL;
 		*(p_vt->NotNull + i) = -1;
-		*(p_vt->Value + i) = value_alloc ();
 	    }
 	  p_vt->nGeometries = 0;
 	  p_vt->GeoColumn = NULL;
@@ -1958,15 +1945,150 @@ vfdo_connect (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     return vfdo_create (db, pAux, argc, argv, ppVTab, pzErr);
 }
 
+static int
+vfdo_is_geometry_column (VirtualFDOPtr p_vt, int column)
+{
+/* checking if some column is a Geometry column */
+    int ig;
+    for (ig = 0; ig < p_vt->nGeometries; ig++)
+      {
+	  if (strcasecmp (*(p_vt->Column + column), *(p_vt->GeoColumn + ig)) ==
+	      0)
+	      return 1;
+      }
+    return 0;
+}
+
+static const char *
+vfdo_constraint_op (int op)
+{
+/* mapping a usable constraint into the corresponding SQL operator */
+    switch (op)
+      {
+      case SQLITE_INDEX_CONSTRAINT_EQ:
+	  return "=";
+      case SQLITE_INDEX_CONSTRAINT_GT:
+	  return ">";
+      case SQLITE_INDEX_CONSTRAINT_LE:
+	  return "<=";
+      case SQLITE_INDEX_CONSTRAINT_LT:
+	  return "<";
+      case SQLITE_INDEX_CONSTRAINT_GE:
+	  return ">=";
+#ifdef HAVE_DECL_SQLITE_INDEX_CONSTRAINT_LIKE
+      case SQLITE_INDEX_CONSTRAINT_LIKE:
+	  return "LIKE";
+#endif
+      };
+    return NULL;
+}
+
+static int
+vfdo_is_column_used (sqlite3_index_info * pIndex, int column)
+{
+/* checking if some column is referenced by the current query */
+#if SQLITE_VERSION_NUMBER >= 3010000
+    sqlite3_uint64 mask;
+    if (column >= 63)
+	mask = (sqlite3_uint64) 1 << 63;
+    else
+	mask = (sqlite3_uint64) 1 << column;
+    return (pIndex->colUsed & mask) ? 1 : 0;
+#else
+    if (pIndex != NULL || column)
+	pIndex = pIndex;	/* unused arg warning suppression */
+    return 1;
+#endif
+}
+
 static int
 vfdo_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIndex)
 {
 /* best index selection */
-    if (pVTab || pIndex)
-	pVTab = pVTab;		/* unused arg warning suppression */
+    VirtualFDOPtr p_vt = (VirtualFDOPtr) pVTab;
+    int i;
+    int ic;
+    int iArg = 0;
+    int rowid_eq = 0;
+    int rowid_range = 0;
+    int attributes = 0;
+    const char *op;
+#if SQLITE_VERSION_NUMBER >= 3022000
+    const char *coll;
+#endif
+    char *item;
+    gaiaOutBuffer idx;
+
+    gaiaOutBufferInitialize (&idx);
+/* the columns to be actually fetched from the FDO-OGR table */
+    for (ic = 0; ic < p_vt->nColumns; ic++)
+	gaiaAppendToOutBuffer (&idx,
+			       vfdo_is_column_used (pIndex, ic) ? "1" : "0");
+    gaiaAppendToOutBuffer (&idx, ";");
+
+/* the constraints to be passed down to the FDO-OGR table */
+    for (i = 0; i < pIndex->nConstraint; i++)
+      {
+	  const struct sqlite3_index_constraint *p = &(pIndex->aConstraint[i]);
+	  if (!p->usable)
+	      continue;
+	  op = vfdo_constraint_op (p->op);
+	  if (op == NULL)
+	      continue;
+	  if (p->iColumn < 0)
+	    {
+		/* ROWID: evaluated by the FDO-OGR table itself */
+		if (strcmp (op, "LIKE") == 0)
+		    continue;
+		if (p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+		    rowid_eq = 1;
+		else
+		    rowid_range = 1;
+		pIndex->aConstraintUsage[i].omit = 1;
+	    }
+	  else
+	    {
+		/* plain attribute: SQLite will check it once again */
+		if (p->iColumn >= p_vt->nColumns)
+		    continue;
+		if (vfdo_is_geometry_column (p_vt, p->iColumn))
+		    continue;	/* the Geometry is exposed in another format */
+#if SQLITE_VERSION_NUMBER >= 3022000
+		coll = sqlite3_vtab_collation (pIndex, i);
+		if (coll != NULL && strcasecmp (coll, "BINARY") != 0)
+		    continue;	/* not the same comparison as the FDO-OGR table */
+#else
+		continue;	/* unable to check the collation */
+#endif
+		attributes = 1;
+		pIndex->aConstraintUsage[i].omit = 0;
+	    }
+	  pIndex->aConstraintUsage[i].argvIndex = ++iArg;
+	  item = sqlite3_mprintf ("%d:%s,", p->iColumn, op);
+	  gaiaAppendToOutBuffer (&idx, item);
+	  sqlite3_free (item);
+      }
+    if (idx.Error || idx.Buffer == NULL)
+      {
+	  gaiaOutBufferReset (&idx);
+	  return SQLITE_NOMEM;
+      }
+    pIndex->idxStr = sqlite3_mprintf ("%s", idx.Buffer);
+    pIndex->needToFreeIdxStr = 1;
+    gaiaOutBufferReset (&idx);
+    pIndex->idxNum = iArg;
+    if (rowid_eq)
+	pIndex->estimatedCost = 1.0;
+    else if (rowid_range)
+	pIndex->estimatedCost = 10000.0;
+    else if (attributes)
+	pIndex->estimatedCost = 100000.0;
+    else
+	pIndex->estimatedCost = 1000000.0;
     return SQLITE_OK;
 }
 
+
 static int
 vfdo_disconnect (sqlite3_vtab * pVTab)
 {
@@ -1987,78 +2109,185 @@ static int
 vfdo_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
 {
 /* opening a new cursor */
-    sqlite3_stmt *stmt = NULL;
-    gaiaOutBuffer sql_statement;
-    int ret;
-    char *sql;
     int ic;
-    char *xprefix;
-    char *xname;
     VirtualFDOCursorPtr cursor =
 	(VirtualFDOCursorPtr) sqlite3_malloc (sizeof (VirtualFDOCursor));
     if (cursor == NULL)
 	return SQLITE_ERROR;
     cursor->pVtab = (VirtualFDOPtr) pVTab;
+    cursor->stmt = NULL;
+    cursor->idxStr = NULL;
+    cursor->ColUsed = sqlite3_malloc (sizeof (int) * cursor->pVtab->nColumns);
+    cursor->Value =
+	sqlite3_malloc (sizeof (SqliteValuePtr) * cursor->pVtab->nColumns);
+    for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
+      {
+	  *(cursor->ColUsed + ic) = 1;
+	  *(cursor->Value + ic) = value_alloc ();
+      }
+    cursor->current_row = LONG64_MIN;
+    cursor->eof = 1;
+    *ppCursor = (sqlite3_vtab_cursor *) cursor;
+    return SQLITE_OK;
+}
+
+static int
+vfdo_close (sqlite3_vtab_cursor * pCursor)
+{
+/* closing the cursor */
+    int ic;
+    VirtualFDOCursorPtr cursor = (VirtualFDOCursorPtr) pCursor;
+    for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
+	value_free (*(cursor->Value + ic));
+    sqlite3_free (cursor->Value);
+    sqlite3_free (cursor->ColUsed);
+    if (cursor->stmt)
+	sqlite3_finalize (cursor->stmt);
+    if (cursor->idxStr)
+	sqlite3_free (cursor->idxStr);
+    sqlite3_free (pCursor);
+    return SQLITE_OK;
+}
+
+static int
+vfdo_prepare_query (VirtualFDOCursorPtr cursor, const char *idxStr)
+{
+/*
+/ preparing the SQL query on the FDO-OGR table corresponding to
+/ some query plan as encoded by vfdo_best_index()
+*/
+    VirtualFDOPtr p_vt = cursor->pVtab;
+    sqlite3_stmt *stmt;
+    gaiaOutBuffer sql_statement;
+    int ret;
+    char *sql;
+    int ic;
+    int column;
+    char op[8];
+    int where = 0;
+    const char *p = NULL;
+    char *xprefix;
+    char *xname;
+
+    if (idxStr != NULL)
+      {
+	  p = strchr (idxStr, ';');
+	  if (p != NULL && (p - idxStr) != p_vt->nColumns)
+	      p = NULL;
+      }
+    for (ic = 0; ic < p_vt->nColumns; ic++)
+      {
+	  if (p == NULL)
+	      *(cursor->ColUsed + ic) = 1;
+	  else
+	      *(cursor->ColUsed + ic) = (idxStr[ic] == '1') ? 1 : 0;
+	  value_set_null (*(cursor->Value + ic));
+      }
+
     gaiaOutBufferInitialize (&sql_statement);
     gaiaAppendToOutBuffer (&sql_statement, "SELECT ROWID");
-    for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
+    for (ic = 0; ic < p_vt->nColumns; ic++)
       {
-	  value_set_null (*(cursor->pVtab->Value + ic));
-	  xname = gaiaDoubleQuotedSql (*(cursor->pVtab->Column + ic));
+	  if (!(*(cursor->ColUsed + ic)))
+	    {
+		/* not referenced by the query: skipping */
+		gaiaAppendToOutBuffer (&sql_statement, ",NULL");
+		continue;
+	    }
+	  xname = gaiaDoubleQuotedSql (*(p_vt->Column + ic));
 	  sql = sqlite3_mprintf (",\"%s\"", xname);
 	  free (xname);
 	  gaiaAppendToOutBuffer (&sql_statement, sql);
 	  sqlite3_free (sql);
       }
-    xprefix = gaiaDoubleQuotedSql (cursor->pVtab->db_prefix);
-    xname = gaiaDoubleQuotedSql (cursor->pVtab->table);
-    sql = sqlite3_mprintf (" FROM \"%s\" WHERE ROWID >= ?", xname);
+    xprefix = gaiaDoubleQuotedSql (p_vt->db_prefix);
+    xname = gaiaDoubleQuotedSql (p_vt->table);
+    sql = sqlite3_mprintf (" FROM \"%s\".\"%s\"", xprefix, xname);
     free (xname);
     free (xprefix);
     gaiaAppendToOutBuffer (&sql_statement, sql);
     sqlite3_free (sql);
+
+/* appending the constraints */
+    while (p != NULL && *(p + 1) != '\0')
+      {
+	  p++;
+	  if (sscanf (p, "%d:%7[^,],", &column, op) != 2)
+	      break;
+	  if (column < 0)
+	      sql = sqlite3_mprintf (" %s ROWID %s ?", where ? "AND" : "WHERE",
+				     op);
+	  else
+	    {
+		xname = gaiaDoubleQuotedSql (*(p_vt->Column + column));
+		sql =
+		    sqlite3_mprintf (" %s \"%s\" %s ?",
+				     where ? "AND" : "WHERE", xname, op);
+		free (xname);
+	    }
+	  where = 1;
+	  gaiaAppendToOutBuffer (&sql_statement, sql);
+	  sqlite3_free (sql);
+	  p = strchr (p, ',');
+      }
+
     if (sql_statement.Error == 0 && sql_statement.Buffer != NULL)
 	ret =
-	    sqlite3_prepare_v2 (cursor->pVtab->db, sql_statement.Buffer,
+	    sqlite3_prepare_v2 (p_vt->db, sql_statement.Buffer,
 				strlen (sql_statement.Buffer), &stmt, NULL);
     else
 	ret = SQLITE_ERROR;
     gaiaOutBufferReset (&sql_statement);
     if (ret != SQLITE_OK)
-      {
-	  /* an error occurred */
-	  cursor->eof = 1;
-	  return SQLITE_ERROR;
-      }
+	return 0;
     cursor->stmt = stmt;
-    cursor->current_row = LONG64_MIN;
-    cursor->eof = 0;
-    *ppCursor = (sqlite3_vtab_cursor *) cursor;
-    vfdo_read_row (cursor);
-    return SQLITE_OK;
-}
-
-static int
-vfdo_close (sqlite3_vtab_cursor * pCursor)
-{
-/* closing the cursor */
-    int ic;
-    VirtualFDOCursorPtr cursor = (VirtualFDOCursorPtr) pCursor;
-    for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
-	value_set_null (*(cursor->pVtab->Value + ic));
-    if (cursor->stmt)
-	sqlite3_finalize (cursor->stmt);
-    sqlite3_free (pCursor);
-    return SQLITE_OK;
+    if (idxStr != NULL)
+	cursor->idxStr = sqlite3_mprintf ("%s", idxStr);
+    return 1;
 }
 
 static int
 vfdo_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
-	     int argc, sqlite3_value ** argv)
+	      int argc, sqlite3_value ** argv)
 {
 /* setting up a cursor filter */
-    if (pCursor || idxNum || idxStr || argc || argv)
-	pCursor = pCursor;	/* unused arg warning suppression */
+    VirtualFDOCursorPtr cursor = (VirtualFDOCursorPtr) pCursor;
+    int i;
+    int reuse = 0;
+    if (idxNum)
+	idxNum = idxNum;	/* unused arg warning suppression */
+    if (cursor->stmt != NULL)
+      {
+	  if (idxStr == NULL && cursor->idxStr == NULL)
+	      reuse = 1;
+	  else if (idxStr != NULL && cursor->idxStr != NULL
+		   && strcmp (idxStr, cursor->idxStr) == 0)
+	      reuse = 1;
+      }
+    if (reuse)
+      {
+	  /* same query plan: simply resetting the statement */
+	  sqlite3_reset (cursor->stmt);
+	  sqlite3_clear_bindings (cursor->stmt);
+      }
+    else
+      {
+	  if (cursor->stmt != NULL)
+	      sqlite3_finalize (cursor->stmt);
+	  cursor->stmt = NULL;
+	  if (cursor->idxStr != NULL)
+	      sqlite3_free (cursor->idxStr);
+	  cursor->idxStr = NULL;
+	  if (!vfdo_prepare_query (cursor, idxStr))
+	    {
+		cursor->eof = 1;
+		return SQLITE_ERROR;
+	    }
+      }
+    for (i = 0; i < argc; i++)
+	sqlite3_bind_value (cursor->stmt, i + 1, argv[i]);
+    cursor->current_row = LONG64_MIN;
+    vfdo_read_row (cursor);
     return SQLITE_OK;
 }
 
@@ -2067,7 +2296,6 @@ vfdo_next (sqlite3_vtab_cursor * pCursor)
 {
 /* fetching next row from cursor */
     VirtualFDOCursorPtr cursor = (VirtualFDOCursorPtr) pCursor;
-    (cursor->current_row)++;
     vfdo_read_row (cursor);
     return SQLITE_OK;
 }
@@ -2082,14 +2310,14 @@ vfdo_eof (sqlite3_vtab_cursor * pCursor)
 
 static int
 vfdo_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
-	     int column)
+	      int column)
 {
 /* fetching value for the Nth column */
     VirtualFDOCursorPtr cursor = (VirtualFDOCursorPtr) pCursor;
     SqliteValuePtr value;
     if (column >= 0 && column < cursor->pVtab->nColumns)
       {
-	  value = *(cursor->pVtab->Value + column);
+	  value = *(cursor->Value + column);
 	  switch (value->Type)
 	    {
 	    case SQLITE_INTEGER:
@@ -108,7 +108,6 @@ typedef struct VirtualGPKGStruct
     char **Column;		/* the name for each column */
     char **Type;		/* the type for each column */
     int *NotNull;		/* NotNull clause for each column */
-    SqliteValuePtr *Value;	/* the current-row value for each column */
     char *GeoColumn;		/* name of the Geometry column */
     int Srid;			/* SRID of the Geometry column */
     int GeoType;		/* Type of the Geometry column */
@@ -120,6 +119,9 @@ typedef struct VirtualGPKGCursorStruct
 /* extends the sqlite3_vtab_cursor struct */
     VirtualGPKGPtr pVtab;	/* Virtual table of this cursor */
     sqlite3_stmt *stmt;
+    char *idxStr;		/* the query plan the statement was built for */
+    int *ColUsed;		/* columns actually referenced by the query */
+    SqliteValuePtr *Value;	/* the current-row value for each column */
     sqlite3_int64 current_row;	/* the current row ID */
     int eof;			/* the EOF marker */
 } VirtualGPKGCursor;
@@ -240,51 +242,51 @@ vgpkg_read_row (VirtualGPKGCursorPtr cursor)
     const char *text;
     const unsigned char *blob;
     int size;
-    sqlite3_int64 pk;
+    SqliteValuePtr value;
     stmt = cursor->stmt;
-    sqlite3_bind_int64 (stmt, 1, cursor->current_row);
     ret = sqlite3_step (stmt);
     if (ret == SQLITE_ROW)
       {
-	  pk = sqlite3_column_int64 (stmt, 0);
+	  cursor->current_row = sqlite3_column_int64 (stmt, 0);
 	  for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
 	    {
 		/* fetching column values */
+		if (!(*(cursor->ColUsed + ic)))
+		    continue;	/* not referenced by the query */
+		value = *(cursor->Value + ic);
 		switch (sqlite3_column_type (stmt, ic + 1))
 		  {
 		  case SQLITE_INTEGER:
-		      value_set_int (*(cursor->pVtab->Value + ic),
-				     sqlite3_column_int64 (stmt, ic + 1));
+		      value_set_int (value, sqlite3_column_int64 (stmt, ic + 1));
 		      break;
 		  case SQLITE_FLOAT:
-		      value_set_double (*(cursor->pVtab->Value + ic),
+		      value_set_double (value,
 					sqlite3_column_double (stmt, ic + 1));
 		      break;
 		  case SQLITE_TEXT:
 		      text = (char *) sqlite3_column_text (stmt, ic + 1);
 		      size = sqlite3_column_bytes (stmt, ic + 1);
-		      value_set_text (*(cursor->pVtab->Value + ic), text, size);
+		      value_set_text (value, text, size);
 		      break;
 		  case SQLITE_BLOB:
 		      blob = sqlite3_column_blob (stmt, ic + 1);
 		      size = sqlite3_column_bytes (stmt, ic + 1);
-		      value_set_blob (*(cursor->pVtab->Value + ic), blob, size);
+		      value_set_blob (value, blob, size);
 		      break;
 		  case SQLITE_NULL:
 		  default:
-		      value_set_null (*(cursor->pVtab->Value + ic));
+		      value_set_null (value);
 		      break;
 		  };
 	    }
       }
     else
       {
-	  /* an error occurred */
+	  /* end of result set or an error occurred */
 	  cursor->eof = 1;
 	  return;
       }
     cursor->eof = 0;
-    cursor->current_row = pk;
 }
 
 static int
@@ -494,7 +496,8 @@ vgpkg_delete_row (VirtualGPKGPtr p_vt, sqlite3_int64 rowid)
     xname = gaiaDoubleQuotedSql (p_vt->table);
     sprintf (dummy, FRMT64, rowid);
     sql_statement =
-	sqlite3_mprintf ("DELETE FROM \"%s\" WHERE ROWID = %s", xname, dummy);
+	sqlite3_mprintf ("DELETE FROM \"%s\".\"%s\" WHERE ROWID = %s", xprefix,
+			 xname, dummy);
     free (xname);
     free (xprefix);
     ret = sqlite3_exec (p_vt->db, sql_statement, NULL, NULL, NULL);
@@ -533,15 +536,6 @@ free_table (VirtualGPKGPtr p_vt)
       }
     if (p_vt->NotNull)
 	sqlite3_free (p_vt->NotNull);
-    if (p_vt->Value)
-      {
-	  for (i = 0; i < p_vt->nColumns; i++)
-	    {
-		if (*(p_vt->Value + i))
-		    value_free (*(p_vt->Value + i));
-	    }
-	  sqlite3_free (p_vt->Value);
-      }
     if (p_vt->GeoColumn)
 	sqlite3_free (p_vt->GeoColumn);
     sqlite3_free (p_vt);
@@ -625,13 +619,11 @@ vgpkg_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 	  p_vt->Column = sqlite3_malloc (sizeof (char *) * n_rows);
 	  p_vt->Type = sqlite3_malloc (sizeof (char *) * n_rows);
 	  p_vt->NotNull = sqlite3_malloc (sizeof (int) * n_rows);
-	  p_vt->Value = sqlite3_malloc (sizeof (SqliteValuePtr) * n_rows);
 	  for (i = 0; i < n_rows; i++)
 	    {
 		*(p_vt->Column + i) = NULL;
 		*(p_vt->Type + i) = NULL;
 		*(p_vt->NotNull + i) = -1;
-		*(p_vt->Value + i) = value_alloc ();
 	    }
 	  p_vt->GeoColumn = NULL;
 	  p_vt->Srid = -1;
@@ -833,12 +825,133 @@ vgpkg_connect (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     return vgpkg_create (db, pAux, argc, argv, ppVTab, pzErr);
 }
 
+static const char *
+vgpkg_constraint_op (int op)
+{
+/* mapping a usable constraint into the corresponding SQL operator */
+    switch (op)
+      {
+      case SQLITE_INDEX_CONSTRAINT_EQ:
+	  return "=";
+      case SQLITE_INDEX_CONSTRAINT_GT:
+	  return ">";
+      case SQLITE_INDEX_CONSTRAINT_LE:
+	  return "<=";
+      case SQLITE_INDEX_CONSTRAINT_LT:
+	  return "<";
+      case SQLITE_INDEX_CONSTRAINT_GE:
+	  return ">=";
+#ifdef HAVE_DECL_SQLITE_INDEX_CONSTRAINT_LIKE
+      case SQLITE_INDEX_CONSTRAINT_LIKE:
+	  return "LIKE";
+#endif
+      };
+    return NULL;
+}
+
+static int
+vgpkg_is_column_used (sqlite3_index_info * pIndex, int column)
+{
+/* checking if some column is referenced by the current query */
+#if SQLITE_VERSION_NUMBER >= 3010000
+    sqlite3_uint64 mask;
+    if (column >= 63)
+	mask = (sqlite3_uint64) 1 << 63;
+    else
+	mask = (sqlite3_uint64) 1 << column;
+    return (pIndex->colUsed & mask) ? 1 : 0;
+#else
+    if (pIndex != NULL || column)
+	pIndex = pIndex;	/* unused arg warning suppression */
+    return 1;
+#endif
+}
+
 static int
 vgpkg_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIndex)
 {
 /* best index selection */
-    if (pVTab || pIndex)
-	pVTab = pVTab;		/* unused arg warning suppression */
+    VirtualGPKGPtr p_vt = (VirtualGPKGPtr) pVTab;
+    int i;
+    int ic;
+    int iArg = 0;
+    int rowid_eq = 0;
+    int rowid_range = 0;
+    int attributes = 0;
+    const char *op;
+#if SQLITE_VERSION_NUMBER >= 3022000
+    const char *coll;
+#endif
+    char *item;
+    gaiaOutBuffer idx;
+
+    gaiaOutBufferInitialize (&idx);
+/* the columns to be actually fetched from the GPKG table */
+    for (ic = 0; ic < p_vt->nColumns; ic++)
+	gaiaAppendToOutBuffer (&idx,
+			       vgpkg_is_column_used (pIndex, ic) ? "1" : "0");
+    gaiaAppendToOutBuffer (&idx, ";");
+
+/* the constraints to be passed down to the GPKG table */
+    for (i = 0; i < pIndex->nConstraint; i++)
+      {
+	  const struct sqlite3_index_constraint *p = &(pIndex->aConstraint[i]);
+	  if (!p->usable)
+	      continue;
+	  op = vgpkg_constraint_op (p->op);
+	  if (op == NULL)
+	      continue;
+	  if (p->iColumn < 0)
+	    {
+		/* ROWID: evaluated by the GPKG table itself */
+		if (strcmp (op, "LIKE") == 0)
+		    continue;
+		if (p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+		    rowid_eq = 1;
+		else
+		    rowid_range = 1;
+		pIndex->aConstraintUsage[i].omit = 1;
+	    }
+	  else
+	    {
+		/* plain attribute: SQLite will check it once again */
+		if (p->iColumn >= p_vt->nColumns)
+		    continue;
+		if (strcasecmp (*(p_vt->Column + p->iColumn), p_vt->GeoColumn)
+		    == 0)
+		    continue;	/* the Geometry is exposed in another format */
+#if SQLITE_VERSION_NUMBER >= 3022000
+		coll = sqlite3_vtab_collation (pIndex, i);
+		if (coll != NULL && strcasecmp (coll, "BINARY") != 0)
+		    continue;	/* not the same comparison as the GPKG table */
+#else
+		continue;	/* unable to check the collation */
+#endif
+		attributes = 1;
+		pIndex->aConstraintUsage[i].omit = 0;
+	    }
+	  pIndex->aConstraintUsage[i].argvIndex = ++iArg;
+	  item = sqlite3_mprintf ("%d:%s,", p->iColumn, op);
+	  gaiaAppendToOutBuffer (&idx, item);
+	  sqlite3_free (item);
+      }
+    if (idx.Error || idx.Buffer == NULL)
+      {
+	  gaiaOutBufferReset (&idx);
+	  return SQLITE_NOMEM;
+      }
+    pIndex->idxStr = sqlite3_mprintf ("%s", idx.Buffer);
+    pIndex->needToFreeIdxStr = 1;
+    gaiaOutBufferReset (&idx);
+    pIndex->idxNum = iArg;
+    if (rowid_eq)
+	pIndex->estimatedCost = 1.0;
+    else if (rowid_range)
+	pIndex->estimatedCost = 10000.0;
+    else if (attributes)
+	pIndex->estimatedCost = 100000.0;
+    else
+	pIndex->estimatedCost = 1000000.0;
     return SQLITE_OK;
 }
 
@@ -862,26 +975,93 @@ static int
 vgpkg_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
 {
 /* opening a new cursor */
+    int ic;
+    VirtualGPKGCursorPtr cursor =
+	(VirtualGPKGCursorPtr) sqlite3_malloc (sizeof (VirtualGPKGCursor));
+    if (cursor == NULL)
+	return SQLITE_ERROR;
+    cursor->pVtab = (VirtualGPKGPtr) pVTab;
+    cursor->stmt = NULL;
+    cursor->idxStr = NULL;
+    cursor->ColUsed = sqlite3_malloc (sizeof (int) * cursor->pVtab->nColumns);
+    cursor->Value =
+	sqlite3_malloc (sizeof (SqliteValuePtr) * cursor->pVtab->nColumns);
+    for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
+      {
+	  *(cursor->ColUsed + ic) = 1;
+	  *(cursor->Value + ic) = value_alloc ();
+      }
+    cursor->current_row = LONG64_MIN;
+    cursor->eof = 1;
+    *ppCursor = (sqlite3_vtab_cursor *) cursor;
+    return SQLITE_OK;
+}
+
+static int
+vgpkg_close (sqlite3_vtab_cursor * pCursor)
+{
+/* closing the cursor */
+    int ic;
+    VirtualGPKGCursorPtr cursor = (VirtualGPKGCursorPtr) pCursor;
+    for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
+	value_free (*(cursor->Value + ic));
+    sqlite3_free (cursor->Value);
+    sqlite3_free (cursor->ColUsed);
+    if (cursor->stmt)
+	sqlite3_finalize (cursor->stmt);
+    if (cursor->idxStr)
+	sqlite3_free (cursor->idxStr);
+    sqlite3_free (pCursor);
+    return SQLITE_OK;
+}
+
+static int
+vgpkg_prepare_query (VirtualGPKGCursorPtr cursor, const char *idxStr)
+{
+/*
+/ preparing the SQL query on the GPKG table corresponding to
+/ some query plan as encoded by vgpkg_best_index()
+*/
+    VirtualGPKGPtr p_vt = cursor->pVtab;
     sqlite3_stmt *stmt;
     gaiaOutBuffer sql_statement;
     int ret;
     char *sql;
     int ic;
+    int column;
+    char op[8];
+    int where = 0;
+    const char *p = NULL;
     char *xprefix;
     char *xname;
-    VirtualGPKGCursorPtr cursor =
-	(VirtualGPKGCursorPtr) sqlite3_malloc (sizeof (VirtualGPKGCursor));
-    if (cursor == NULL)
-	return SQLITE_ERROR;
-    cursor->pVtab = (VirtualGPKGPtr) pVTab;
+
+    if (idxStr != NULL)
+      {
+	  p = strchr (idxStr, ';');
+	  if (p != NULL && (p - idxStr) != p_vt->nColumns)
+	      p = NULL;
+      }
+    for (ic = 0; ic < p_vt->nColumns; ic++)
+      {
+	  if (p == NULL)
+	      *(cursor->ColUsed + ic) = 1;
+	  else
+	      *(cursor->ColUsed + ic) = (idxStr[ic] == '1') ? 1 : 0;
+	  value_set_null (*(cursor->Value + ic));
+      }
+
     gaiaOutBufferInitialize (&sql_statement);
     gaiaAppendToOutBuffer (&sql_statement, "SELECT ROWID");
-    for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
+    for (ic = 0; ic < p_vt->nColumns; ic++)
       {
-	  value_set_null (*(cursor->pVtab->Value + ic));
-	  xname = gaiaDoubleQuotedSql (*(cursor->pVtab->Column + ic));
-	  if (strcasecmp
-	      (*(cursor->pVtab->Column + ic), cursor->pVtab->GeoColumn) == 0)
+	  if (!(*(cursor->ColUsed + ic)))
+	    {
+		/* not referenced by the query: skipping */
+		gaiaAppendToOutBuffer (&sql_statement, ",NULL");
+		continue;
+	    }
+	  xname = gaiaDoubleQuotedSql (*(p_vt->Column + ic));
+	  if (strcasecmp (*(p_vt->Column + ic), p_vt->GeoColumn) == 0)
 	    {
 		/* this is the geometry column */
 		sql = sqlite3_mprintf (",GeomFromGPB(\"%s\")", xname);
@@ -892,46 +1072,50 @@ vgpkg_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
 	  gaiaAppendToOutBuffer (&sql_statement, sql);
 	  sqlite3_free (sql);
       }
-    xprefix = gaiaDoubleQuotedSql (cursor->pVtab->db_prefix);
-    xname = gaiaDoubleQuotedSql (cursor->pVtab->table);
-    sql = sqlite3_mprintf (" FROM \"%s\" WHERE ROWID >= ?", xname);
+    xprefix = gaiaDoubleQuotedSql (p_vt->db_prefix);
+    xname = gaiaDoubleQuotedSql (p_vt->table);
+    sql = sqlite3_mprintf (" FROM \"%s\".\"%s\"", xprefix, xname);
     free (xname);
     free (xprefix);
     gaiaAppendToOutBuffer (&sql_statement, sql);
     sqlite3_free (sql);
+
+/* appending the constraints */
+    while (p != NULL && *(p + 1) != '\0')
+      {
+	  p++;
+	  if (sscanf (p, "%d:%7[^,],", &column, op) != 2)
+	      break;
+	  if (column < 0)
+	      sql = sqlite3_mprintf (" %s ROWID %s ?", where ? "AND" : "WHERE",
+				     op);
+	  else
+	    {
+		xname = gaiaDoubleQuotedSql (*(p_vt->Column + column));
+		sql =
+		    sqlite3_mprintf (" %s \"%s\" %s ?",
+				     where ? "AND" : "WHERE", xname, op);
+		free (xname);
+	    }
+	  where = 1;
+	  gaiaAppendToOutBuffer (&sql_statement, sql);
+	  sqlite3_free (sql);
+	  p = strchr (p, ',');
+      }
+
     if (sql_statement.Error == 0 && sql_statement.Buffer != NULL)
 	ret =
-	    sqlite3_prepare_v2 (cursor->pVtab->db, sql_statement.Buffer,
+	    sqlite3_prepare_v2 (p_vt->db, sql_statement.Buffer,
 				strlen (sql_statement.Buffer), &stmt, NULL);
     else
 	ret = SQLITE_ERROR;
     gaiaOutBufferReset (&sql_statement);
     if (ret != SQLITE_OK)
-      {
-	  /* an error occurred */
-	  cursor->eof = 1;
-	  return SQLITE_ERROR;
-      }
+	return 0;
     cursor->stmt = stmt;
-    cursor->current_row = LONG64_MIN;
-    cursor->eof = 0;
-    *ppCursor = (sqlite3_vtab_cursor *) cursor;
-    vgpkg_read_row (cursor);
-    return SQLITE_OK;
-}
-
-static int
-vgpkg_close (sqlite3_vtab_cursor * pCursor)
-{
-/* closing the cursor */
-    int ic;
-    VirtualGPKGCursorPtr cursor = (VirtualGPKGCursorPtr) pCursor;
-    for (ic = 0; ic < cursor->pVtab->nColumns; ic++)
-	value_set_null (*(cursor->pVtab->Value + ic));
-    if (cursor->stmt)
-	sqlite3_finalize (cursor->stmt);
-    sqlite3_free (pCursor);
-    return SQLITE_OK;
+    if (idxStr != NULL)
+	cursor->idxStr = sqlite3_mprintf ("%s", idxStr);
+    return 1;
 }
 
 static int
@@ -939,8 +1123,43 @@ vgpkg_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
 	      int argc, sqlite3_value ** argv)
 {
 /* setting up a cursor filter */
-    if (pCursor || idxNum || idxStr || argc || argv)
-	pCursor = pCursor;	/* unused arg warning suppression */
+    VirtualGPKGCursorPtr cursor = (VirtualGPKGCursorPtr) pCursor;
+    int i;
+    int reuse = 0;
+    if (idxNum)
+	idxNum = idxNum;	/* unused arg warning suppression */
+    if (cursor->stmt != NULL)
+      {
+	  if (idxStr == NULL && cursor->idxStr == NULL)
+	      reuse = 1;
+	  else if (idxStr != NULL && cursor->idxStr != NULL
+		   && strcmp (idxStr, cursor->idxStr) == 0)
+	      reuse = 1;
+      }
+    if (reuse)
+      {
+	  /* same query plan: simply resetting the statement */
+	  sqlite3_reset (cursor->stmt);
+	  sqlite3_clear_bindings (cursor->stmt);
+      }
+    else
+      {
+	  if (cursor->stmt != NULL)
+	      sqlite3_finalize (cursor->stmt);
+	  cursor->stmt = NULL;
+	  if (cursor->idxStr != NULL)
+	      sqlite3_free (cursor->idxStr);
+	  cursor->idxStr = NULL;
+	  if (!vgpkg_prepare_query (cursor, idxStr))
+	    {
+		cursor->eof = 1;
+		return SQLITE_ERROR;
+	    }
+      }
+    for (i = 0; i < argc; i++)
+	sqlite3_bind_value (cursor->stmt, i + 1, argv[i]);
+    cursor->current_row = LONG64_MIN;
+    vgpkg_read_row (cursor);
     return SQLITE_OK;
 }
 
@@ -949,7 +1168,6 @@ vgpkg_next (sqlite3_vtab_cursor * pCursor)
 {
 /* fetching next row from cursor */
     VirtualGPKGCursorPtr cursor = (VirtualGPKGCursorPtr) pCursor;
-    (cursor->current_row)++;
     vgpkg_read_row (cursor);
     return SQLITE_OK;
 }
@@ -971,7 +1189,7 @@ vgpkg_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
     SqliteValuePtr value;
     if (column >= 0 && column < cursor->pVtab->nColumns)
       {
-	  value = *(cursor->pVtab->Value + column);
+	  value = *(cursor->Value + column);
 	  switch (value->Type)
 	    {
 	    case SQLITE_INTEGER:
@@ -0,0 +1,1269 @@
+/*
+
+ virtualgrid.c -- SQLite3 extension [VIRTUAL TABLE Grid Cells]
+
+ version 5.1, 2026 October 18
+
+ -----------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2008-2021
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <limits.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "config-msvc.h"
+#else
+#include "config.h"
+#endif
+
+#ifndef OMIT_GEOS		/* only if GEOS is supported */
+
+#include <spatialite/sqlite.h>
+
+#include <spatialite.h>
+#include <spatialite/spatialite_ext.h>
+#include <spatialite/gaiaaux.h>
+#include <spatialite/gaiageo.h>
+#include <spatialite_private.h>
+
+#ifdef GEOS_REENTRANT
+#ifdef GEOS_ONLY_REENTRANT
+#define GEOS_USE_ONLY_R_API	/* only fully thread-safe GEOS API */
+#endif
+#endif
+#include <geos_c.h>
+
+#ifdef _WIN32
+#define strcasecmp	_stricmp
+#endif /* not WIN32 */
+
+#define VGRID_SQUARE		1
+#define VGRID_TRIANGULAR	2
+#define VGRID_HEXAGONAL		3
+
+#define VGRID_MAX_THREADS	64
+#define VGRID_CHUNK		4096	/* candidate cells per parallel chunk */
+#define VGRID_MIN_CELLS		256	/* min candidate cells per thread */
+#define VGRID_MAX_BANDS		1048576	/* max scanline bands */
+#define VGRID_MAX_INDEX		(INT_MAX / 4)	/* max row/col index */
+
+static struct sqlite3_module my_grid_module;
+
+/******************************************************************************
+/
+/ VirtualTable structs
+/
+******************************************************************************/
+
+typedef struct VirtualGridStruct
+{
+/* extends the sqlite3_vtab struct */
+    const sqlite3_module *pModule;	/* ptr to sqlite module: USED INTERNALLY BY SQLITE */
+    int nRef;			/* # references: USED INTERNALLY BY SQLITE */
+    char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
+    sqlite3 *db;		/* the sqlite db holding the virtual table */
+    const void *p_cache;	/* pointer to the internal cache */
+    int shape;			/* Square, Triangular or Hexagonal cells */
+} VirtualGrid;
+typedef VirtualGrid *VirtualGridPtr;
+
+struct vgrid_candidate
+{
+/* a candidate cell waiting to be tested against the input Geometry */
+    int row_no;
+    int col_no;
+    int down;
+    gaiaGeomCollPtr cell;
+    int hit;
+};
+
+struct vgrid_worker
+{
+/* a worker thread testing a slice of the current chunk */
+    const void *p_cache;	/* the thread's own connection cache */
+    int own_cache;
+    void *geos_input;		/* the input Geometry [thread's own GEOS] */
+    const void *prepared;	/* the input Geometry [thread's own GEOS prepared] */
+    struct vgrid_candidate *first;
+    struct vgrid_candidate *last;
+};
+
+typedef struct VirtualGridCursorStruct
+{
+/* extends the sqlite3_vtab_cursor struct */
+    VirtualGridPtr pVtab;	/* Virtual table of this cursor */
+    int eof;			/* the EOF marker */
+    int scan_eof;		/* no more candidate cells */
+    gaiaGeomCollPtr input;	/* the input Geometry */
+    void *geos_input;		/* the input Geometry [GEOS] */
+    const void *prepared;	/* the input Geometry [GEOS prepared] */
+    int threads;		/* max number of worker threads */
+    int num_workers;		/* number of initialized workers */
+    struct vgrid_worker workers[VGRID_MAX_THREADS];
+    struct vgrid_candidate *chunk;	/* the current chunk of candidate cells */
+    int chunk_count;
+    int chunk_index;		/* the current output cell */
+    double size;		/* the cell's edge length */
+    double origin_x;		/* the grid origin */
+    double origin_y;
+    double step_x;		/* horizontal distance between two cells */
+    double step_y;		/* vertical distance between two rows */
+    double cell_width;		/* the cell's width */
+    int first_band;		/* index of the first scanline band */
+    int num_bands;		/* number of scanline bands */
+    double *band_min_x;		/* the input's X range on each band */
+    double *band_max_x;
+    int row_no;			/* current scan row */
+    int last_row;
+    int col_no;			/* current scan column */
+    int last_col;
+    int down;			/* Triangular cells: pointing downside */
+    sqlite3_int64 current_row;	/* the current ROWID */
+} VirtualGridCursor;
+typedef VirtualGridCursor *VirtualGridCursorPtr;
+
+static int
+vgrid_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
+	      sqlite3_vtab ** ppVTab, char **pzErr)
+{
+/* creates the virtual table for Grid Cells */
+    VirtualGridPtr p_vt;
+    char *buf;
+    char *vtable;
+    char *xname;
+    int shape;
+    if (argc == 3)
+	vtable = gaiaDequotedSql ((char *) argv[2]);
+    else
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualGrid module] CREATE VIRTUAL: illegal arg list {void}\n");
+	  return SQLITE_ERROR;
+      }
+    if (strcasecmp (argv[0], "TriangularGridCells") == 0)
+	shape = VGRID_TRIANGULAR;
+    else if (strcasecmp (argv[0], "HexGridCells") == 0)
+	shape = VGRID_HEXAGONAL;
+    else
+	shape = VGRID_SQUARE;
+    p_vt = (VirtualGridPtr) sqlite3_malloc (sizeof (VirtualGrid));
+    if (!p_vt)
+      {
+	  free (vtable);
+	  return SQLITE_NOMEM;
+      }
+    p_vt->db = db;
+    p_vt->pModule = &my_grid_module;
+    p_vt->nRef = 0;
+    p_vt->zErrMsg = NULL;
+    p_vt->p_cache = pAux;
+    p_vt->shape = shape;
+/* preparing the COLUMNs for this VIRTUAL TABLE */
+    xname = gaiaDoubleQuotedSql (vtable);
+    buf = sqlite3_mprintf ("CREATE TABLE \"%s\" (row_no INTEGER, "
+			   "col_no INTEGER, geometry BLOB, "
+			   "input_geom BLOB HIDDEN, size DOUBLE HIDDEN, "
+			   "origin BLOB HIDDEN, threads INTEGER HIDDEN)", xname);
+    free (xname);
+    free (vtable);
+    if (sqlite3_declare_vtab (db, buf) != SQLITE_OK)
+      {
+	  *pzErr =
+	      sqlite3_mprintf
+	      ("[VirtualGrid module] CREATE VIRTUAL: invalid SQL statement \"%s\"",
+	       buf);
+	  sqlite3_free (buf);
+	  sqlite3_free (p_vt);
+	  return SQLITE_ERROR;
+      }
+    sqlite3_free (buf);
+    *ppVTab = (sqlite3_vtab *) p_vt;
+    return SQLITE_OK;
+}
+
+static int
+vgrid_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
+{
+/* best index selection */
+    int i;
+    int geom = -1;
+    int size = -1;
+    int origin = -1;
+    int threads = -1;
+    int argv_index = 3;
+    int unusable = 0;
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    for (i = 0; i < pIdxInfo->nConstraint; i++)
+      {
+	  /* verifying the constraints */
+	  struct sqlite3_index_constraint *p = &(pIdxInfo->aConstraint[i]);
+	  if (p->op != SQLITE_INDEX_CONSTRAINT_EQ || p->iColumn < 3)
+	      continue;
+	  if (!p->usable)
+	    {
+		unusable = 1;
+		continue;
+	    }
+	  if (p->iColumn == 3)
+	      geom = i;
+	  else if (p->iColumn == 4)
+	      size = i;
+	  else if (p->iColumn == 5)
+	      origin = i;
+	  else if (p->iColumn == 6)
+	      threads = i;
+      }
+    if (geom >= 0 && size >= 0)
+      {
+	  /* this one is a valid Grid Cells query */
+	  pIdxInfo->aConstraintUsage[geom].argvIndex = 1;
+	  pIdxInfo->aConstraintUsage[geom].omit = 1;
+	  pIdxInfo->aConstraintUsage[size].argvIndex = 2;
+	  pIdxInfo->aConstraintUsage[size].omit = 1;
+	  pIdxInfo->idxNum = 1;
+	  if (origin >= 0)
+	    {
+		pIdxInfo->aConstraintUsage[origin].argvIndex = argv_index++;
+		pIdxInfo->aConstraintUsage[origin].omit = 1;
+		pIdxInfo->idxNum |= 2;
+	    }
+	  if (threads >= 0)
+	    {
+		pIdxInfo->aConstraintUsage[threads].argvIndex = argv_index++;
+		pIdxInfo->aConstraintUsage[threads].omit = 1;
+		pIdxInfo->idxNum |= 4;
+	    }
+	  pIdxInfo->estimatedCost = 1000.0;
+      }
+    else
+      {
+	  /* illegal query: the input args could become available later */
+	  pIdxInfo->idxNum = 0;
+	  pIdxInfo->estimatedCost = unusable ? 1.0e300 : 1.0e100;
+      }
+    return SQLITE_OK;
+}
+
+static int
+vgrid_disconnect (sqlite3_vtab * pVTab)
+{
+/* disconnects the virtual table */
+    VirtualGridPtr p_vt = (VirtualGridPtr) pVTab;
+    sqlite3_free (p_vt);
+    return SQLITE_OK;
+}
+
+static int
+vgrid_destroy (sqlite3_vtab * pVTab)
+{
+/* destroys the virtual table - simply aliases vgrid_disconnect() */
+    return vgrid_disconnect (pVTab);
+}
+
+static void
+vgrid_free_worker (struct vgrid_worker *worker)
+{
+/* destroying a worker's own GEOS objects and connection cache */
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) (worker->p_cache);
+    GEOSContextHandle_t handle = NULL;
+    if (cache != NULL)
+	handle = cache->GEOS_handle;
+    if (worker->prepared != NULL && handle != NULL)
+	GEOSPreparedGeom_destroy_r (handle,
+				    (const GEOSPreparedGeometry *)
+				    (worker->prepared));
+    if (worker->geos_input != NULL && handle != NULL)
+	GEOSGeom_destroy_r (handle, (GEOSGeometry *) (worker->geos_input));
+    if (worker->own_cache)
+	spatialite_internal_cleanup (worker->p_cache);
+    worker->p_cache = NULL;
+    worker->own_cache = 0;
+    worker->geos_input = NULL;
+    worker->prepared = NULL;
+}
+
+static void
+vgrid_free_chunk (VirtualGridCursorPtr cursor)
+{
+/* freeing all cells of the current chunk */
+    int i;
+    for (i = 0; i < cursor->chunk_count; i++)
+      {
+	  struct vgrid_candidate *candidate = cursor->chunk + i;
+	  if (candidate->cell != NULL)
+	      gaiaFreeGeomColl (candidate->cell);
+      }
+    cursor->chunk_count = 0;
+    cursor->chunk_index = -1;
+}
+
+static void
+vgrid_reset_cursor (VirtualGridCursorPtr cursor)
+{
+/* cleaning the cursor's current state */
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) (cursor->pVtab->p_cache);
+    GEOSContextHandle_t handle = NULL;
+    int i;
+    if (cache != NULL)
+	handle = cache->GEOS_handle;
+    for (i = 1; i < cursor->num_workers; i++)
+	vgrid_free_worker (cursor->workers + i);
+    cursor->num_workers = 0;
+    if (cursor->chunk != NULL)
+      {
+	  vgrid_free_chunk (cursor);
+	  free (cursor->chunk);
+      }
+    if (cursor->prepared != NULL && handle != NULL)
+	GEOSPreparedGeom_destroy_r (handle,
+				    (const GEOSPreparedGeometry *)
+				    (cursor->prepared));
+    if (cursor->geos_input != NULL && handle != NULL)
+	GEOSGeom_destroy_r (handle, (GEOSGeometry *) (cursor->geos_input));
+    if (cursor->input != NULL)
+	gaiaFreeGeomColl (cursor->input);
+    if (cursor->band_min_x != NULL)
+	free (cursor->band_min_x);
+    if (cursor->band_max_x != NULL)
+	free (cursor->band_max_x);
+    cursor->input = NULL;
+    cursor->geos_input = NULL;
+    cursor->prepared = NULL;
+    cursor->chunk = NULL;
+    cursor->chunk_count = 0;
+    cursor->chunk_index = -1;
+    cursor->band_min_x = NULL;
+    cursor->band_max_x = NULL;
+    cursor->num_bands = 0;
+    cursor->eof = 1;
+    cursor->scan_eof = 1;
+}
+
+static int
+vgrid_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
+{
+/* opening a new cursor */
+    VirtualGridCursorPtr cursor =
+	(VirtualGridCursorPtr) sqlite3_malloc (sizeof (VirtualGridCursor));
+    if (cursor == NULL)
+	return SQLITE_ERROR;
+    memset (cursor, 0, sizeof (VirtualGridCursor));
+    cursor->pVtab = (VirtualGridPtr) pVTab;
+    cursor->eof = 1;
+    cursor->scan_eof = 1;
+    cursor->chunk_index = -1;
+    *ppCursor = (sqlite3_vtab_cursor *) cursor;
+    return SQLITE_OK;
+}
+
+static int
+vgrid_close (sqlite3_vtab_cursor * pCursor)
+{
+/* closing the cursor */
+    VirtualGridCursorPtr cursor = (VirtualGridCursorPtr) pCursor;
+    vgrid_reset_cursor (cursor);
+    sqlite3_free (pCursor);
+    return SQLITE_OK;
+}
+
+static int
+vgrid_valid_index (double index)
+{
+/* checking a row/col index against overflows (NaN and Inf included) */
+    if (index > (double) (0 - VGRID_MAX_INDEX)
+	&& index < (double) VGRID_MAX_INDEX)
+	return 1;
+    return 0;
+}
+
+static int
+vgrid_band_index (VirtualGridCursorPtr cursor, double y)
+{
+/* returns the index of the scanline band containing Y */
+    return (int) floor ((y - cursor->origin_y) / cursor->step_y);
+}
+
+static void
+vgrid_scan_segment (VirtualGridCursorPtr cursor, double x0, double y0,
+		    double x1, double y1)
+{
+/* updating the X ranges of all scanline bands crossed by a segment */
+    double tol = cursor->step_y * 1e-9;
+    double y_min = (y0 < y1) ? y0 : y1;
+    double y_max = (y0 < y1) ? y1 : y0;
+    int first = vgrid_band_index (cursor, y_min) - 1;
+    int last = vgrid_band_index (cursor, y_max) + 1;
+    int k;
+    if (first < cursor->first_band)
+	first = cursor->first_band;
+    if (last > cursor->first_band + cursor->num_bands - 1)
+	last = cursor->first_band + cursor->num_bands - 1;
+    for (k = first; k <= last; k++)
+      {
+	  double band_y0 = cursor->origin_y + (k * cursor->step_y) - tol;
+	  double band_y1 = band_y0 + cursor->step_y + (2.0 * tol);
+	  double xa;
+	  double xb;
+	  int idx = k - cursor->first_band;
+	  if (y_max < band_y0 || y_min > band_y1)
+	      continue;
+	  if (y0 == y1)
+	    {
+		/* horizontal segment */
+		xa = x0;
+		xb = x1;
+	    }
+	  else
+	    {
+		/* clipping the segment against the band */
+		double ta = (band_y0 - y0) / (y1 - y0);
+		double tb = (band_y1 - y0) / (y1 - y0);
+		if (ta < 0.0)
+		    ta = 0.0;
+		if (ta > 1.0)
+		    ta = 1.0;
+		if (tb < 0.0)
+		    tb = 0.0;
+		if (tb > 1.0)
+		    tb = 1.0;
+		xa = x0 + ((x1 - x0) * ta);
+		xb = x0 + ((x1 - x0) * tb);
+	    }
+	  if (xa < *(cursor->band_min_x + idx))
+	      *(cursor->band_min_x + idx) = xa;
+	  if (xb < *(cursor->band_min_x + idx))
+	      *(cursor->band_min_x + idx) = xb;
+	  if (xa > *(cursor->band_max_x + idx))
+	      *(cursor->band_max_x + idx) = xa;
+	  if (xb > *(cursor->band_max_x + idx))
+	      *(cursor->band_max_x + idx) = xb;
+      }
+}
+
+static void
+vgrid_scan_ring (VirtualGridCursorPtr cursor, gaiaRingPtr rng)
+{
+/* scanning all segments of a Ring */
+    int iv;
+    double x0 = 0.0;
+    double y0 = 0.0;
+    double x1;
+    double y1;
+    double z;
+    double m;
+    for (iv = 0; iv < rng->Points; iv++)
+      {
+	  if (rng->DimensionModel == GAIA_XY_Z)
+	    {
+		gaiaGetPointXYZ (rng->Coords, iv, &x1, &y1, &z);
+	    }
+	  else if (rng->DimensionModel == GAIA_XY_M)
+	    {
+		gaiaGetPointXYM (rng->Coords, iv, &x1, &y1, &m);
+	    }
+	  else if (rng->DimensionModel == GAIA_XY_Z_M)
+	    {
+		gaiaGetPointXYZM (rng->Coords, iv, &x1, &y1, &z, &m);
+	    }
+	  else
+	    {
+		gaiaGetPoint (rng->Coords, iv, &x1, &y1);
+	    }
+	  if (iv > 0)
+	      vgrid_scan_segment (cursor, x0, y0, x1, y1);
+	  x0 = x1;
+	  y0 = y1;
+      }
+}
+
+static void
+vgrid_scanlines (VirtualGridCursorPtr cursor)
+{
+/*
+/ determining, for each horizontal band, the X range actually
+/ covered by the input Polygons, so that empty rows and the cells
+/ falling outside the input will never be generated at all
+*/
+    int first = vgrid_band_index (cursor, cursor->input->MinY) - 1;
+    int last = vgrid_band_index (cursor, cursor->input->MaxY) + 1;
+    int k;
+    int ib;
+    gaiaPolygonPtr pg;
+    cursor->first_band = first;
+    cursor->num_bands = last - first + 1;
+    if (cursor->num_bands > VGRID_MAX_BANDS)
+      {
+	  /* far too many bands: scanning the whole BBOX */
+	  cursor->num_bands = 0;
+	  return;
+      }
+    cursor->band_min_x = malloc (sizeof (double) * cursor->num_bands);
+    cursor->band_max_x = malloc (sizeof (double) * cursor->num_bands);
+    if (cursor->band_min_x == NULL || cursor->band_max_x == NULL)
+      {
+	  /* insufficient memory: scanning the whole BBOX */
+	  if (cursor->band_min_x != NULL)
+	      free (cursor->band_min_x);
+	  if (cursor->band_max_x != NULL)
+	      free (cursor->band_max_x);
+	  cursor->band_min_x = NULL;
+	  cursor->band_max_x = NULL;
+	  return;
+      }
+    for (k = 0; k < cursor->num_bands; k++)
+      {
+	  *(cursor->band_min_x + k) = DBL_MAX;
+	  *(cursor->band_max_x + k) = 0.0 - DBL_MAX;
+      }
+    pg = cursor->input->FirstPolygon;
+    while (pg)
+      {
+	  /* the X range of a Polygon within a band is always set by its boundary */
+	  vgrid_scan_ring (cursor, pg->Exterior);
+	  for (ib = 0; ib < pg->NumInteriors; ib++)
+	      vgrid_scan_ring (cursor, pg->Interiors + ib);
+	  pg = pg->Next;
+      }
+}
+
+static int
+vgrid_row_range (VirtualGridCursorPtr cursor, int row, double *min_x,
+		 double *max_x)
+{
+/* returns the X range to be covered by some row of cells */
+    int first_band = row;
+    int last_band = row;
+    int k;
+    double tol = cursor->size * 1e-9;
+    *min_x = DBL_MAX;
+    *max_x = 0.0 - DBL_MAX;
+    if (cursor->pVtab->shape == VGRID_HEXAGONAL)
+	first_band = row - 1;	/* Hexagons span two bands */
+    if (cursor->band_min_x == NULL)
+      {
+	  /* no scanlines: the whole BBOX */
+	  *min_x = cursor->input->MinX - tol;
+	  *max_x = cursor->input->MaxX + tol;
+	  return 1;
+      }
+    for (k = first_band; k <= last_band; k++)
+      {
+	  int idx = k - cursor->first_band;
+	  if (idx < 0 || idx >= cursor->num_bands)
+	      continue;
+	  if (*(cursor->band_min_x + idx) < *min_x)
+	      *min_x = *(cursor->band_min_x + idx);
+	  if (*(cursor->band_max_x + idx) > *max_x)
+	      *max_x = *(cursor->band_max_x + idx);
+      }
+    if (*min_x > *max_x)
+	return 0;
+    *min_x -= tol;
+    *max_x += tol;
+    return 1;
+}
+
+static double
+vgrid_row_shift (VirtualGridCursorPtr cursor, int row)
+{
+/* odd rows of Triangular and Hexagonal grids are shifted */
+    if ((row & 1) == 0)
+	return 0.0;
+    if (cursor->pVtab->shape == VGRID_TRIANGULAR)
+	return 0.0 - (cursor->size / 2.0);
+    if (cursor->pVtab->shape == VGRID_HEXAGONAL)
+	return cursor->size * 1.5;
+    return 0.0;
+}
+
+static int
+vgrid_start_row (VirtualGridCursorPtr cursor)
+{
+/* positioning on the first cell of the current row (skipping empty rows) */
+    double min_x;
+    double max_x;
+    double base_x;
+    while (cursor->row_no <= cursor->last_row)
+      {
+	  if (vgrid_row_range (cursor, cursor->row_no, &min_x, &max_x))
+	    {
+		base_x =
+		    cursor->origin_x + vgrid_row_shift (cursor, cursor->row_no);
+		cursor->col_no =
+		    (int) floor ((min_x - base_x -
+				  cursor->cell_width) / cursor->step_x);
+		cursor->last_col =
+		    (int) floor ((max_x - base_x) / cursor->step_x);
+		cursor->down = 0;
+		return 1;
+	    }
+	  cursor->row_no += 1;
+      }
+    return 0;
+}
+
+static gaiaGeomCollPtr
+vgrid_build_cell (VirtualGridCursorPtr cursor)
+{
+/* building the current cell */
+    gaiaGeomCollPtr cell;
+    gaiaPolygonPtr pg;
+    gaiaRingPtr rng;
+    double size = cursor->size;
+    double h = cursor->step_y;
+    double x1 =
+	cursor->origin_x + vgrid_row_shift (cursor,
+					    cursor->row_no) +
+	(cursor->col_no * cursor->step_x);
+    double y1 = cursor->origin_y + (cursor->row_no * cursor->step_y);
+
+    cell = gaiaAllocGeomColl ();
+    cell->Srid = cursor->input->Srid;
+    cell->DeclaredType = GAIA_POLYGON;
+    switch (cursor->pVtab->shape)
+      {
+      case VGRID_TRIANGULAR:
+	  pg = gaiaAddPolygonToGeomColl (cell, 4, 0);
+	  rng = pg->Exterior;
+	  if (cursor->down)
+	    {
+		gaiaSetPoint (rng->Coords, 0, x1 + (size / 2.0), y1 + h);
+		gaiaSetPoint (rng->Coords, 1, x1 + size, y1);
+		gaiaSetPoint (rng->Coords, 2, x1 + (size * 1.5), y1 + h);
+		gaiaSetPoint (rng->Coords, 3, x1 + (size / 2.0), y1 + h);
+	    }
+	  else
+	    {
+		gaiaSetPoint (rng->Coords, 0, x1, y1);
+		gaiaSetPoint (rng->Coords, 1, x1 + size, y1);
+		gaiaSetPoint (rng->Coords, 2, x1 + (size / 2.0), y1 + h);
+		gaiaSetPoint (rng->Coords, 3, x1, y1);
+	    }
+	  break;
+      case VGRID_HEXAGONAL:
+	  pg = gaiaAddPolygonToGeomColl (cell, 7, 0);
+	  rng = pg->Exterior;
+	  gaiaSetPoint (rng->Coords, 0, x1, y1);
+	  gaiaSetPoint (rng->Coords, 1, x1 + (size / 2.0), y1 - h);
+	  gaiaSetPoint (rng->Coords, 2, x1 + (size * 1.5), y1 - h);
+	  gaiaSetPoint (rng->Coords, 3, x1 + (size * 2.0), y1);
+	  gaiaSetPoint (rng->Coords, 4, x1 + (size * 1.5), y1 + h);
+	  gaiaSetPoint (rng->Coords, 5, x1 + (size / 2.0), y1 + h);
+	  gaiaSetPoint (rng->Coords, 6, x1, y1);
+	  break;
+      default:
+	  pg = gaiaAddPolygonToGeomColl (cell, 5, 0);
+	  rng = pg->Exterior;
+	  gaiaSetPoint (rng->Coords, 0, x1, y1);
+	  gaiaSetPoint (rng->Coords, 1, x1 + size, y1);
+	  gaiaSetPoint (rng->Coords, 2, x1 + size, y1 + size);
+	  gaiaSetPoint (rng->Coords, 3, x1, y1 + size);
+	  gaiaSetPoint (rng->Coords, 4, x1, y1);
+	  break;
+      };
+    gaiaMbrGeometry (cell);
+    return cell;
+}
+
+static int
+vgrid_check_bbox (VirtualGridCursorPtr cursor, gaiaGeomCollPtr cell)
+{
+/* cells merely touching the input's BBOX are never part of the grid */
+    if (cell->MaxX <= cursor->input->MinX
+	|| cell->MinX >= cursor->input->MaxX)
+	return 0;
+    if (cell->MaxY <= cursor->input->MinY
+	|| cell->MinY >= cursor->input->MaxY)
+	return 0;
+    return 1;
+}
+
+static int
+vgrid_check_cell (const void *p_cache, const void *prepared,
+		  gaiaGeomCollPtr cell)
+{
+/* testing a cell against the prepared input Geometry */
+    GEOSContextHandle_t handle = splite_get_geos_handle (p_cache);
+    GEOSGeometry *g;
+    int ret;
+    if (handle == NULL)
+	return 0;
+    g = gaiaToGeos_r (p_cache, cell);
+    if (g == NULL)
+	return 0;
+    ret =
+	GEOSPreparedIntersects_r (handle,
+				  (const GEOSPreparedGeometry *) prepared, g);
+    GEOSGeom_destroy_r (handle, g);
+    return (ret == 1) ? 1 : 0;
+}
+
+static void
+vgrid_advance (VirtualGridCursorPtr cursor)
+{
+/* moving to the next candidate cell */
+    if (cursor->pVtab->shape == VGRID_TRIANGULAR && !(cursor->down))
+      {
+	  cursor->down = 1;
+	  return;
+      }
+    cursor->down = 0;
+    cursor->col_no += 1;
+    if (cursor->col_no > cursor->last_col)
+      {
+	  cursor->row_no += 1;
+	  if (!vgrid_start_row (cursor))
+	      cursor->scan_eof = 1;
+      }
+}
+
+static int
+vgrid_init_worker (VirtualGridCursorPtr cursor, struct vgrid_worker *worker)
+{
+/* 
+/ a worker thread requires its own connection cache and GEOS context;
+/ a Prepared Geometry can't be shared between threads
+*/
+    worker->p_cache = spatialite_alloc_connection ();
+    if (worker->p_cache == NULL)
+	return 0;
+    worker->own_cache = 1;
+    worker->geos_input = gaiaToGeos_r (worker->p_cache, cursor->input);
+    if (worker->geos_input != NULL)
+	worker->prepared =
+	    GEOSPrepare_r (splite_get_geos_handle (worker->p_cache),
+			   (const GEOSGeometry *) (worker->geos_input));
+    if (worker->prepared == NULL)
+      {
+	  vgrid_free_worker (worker);
+	  return 0;
+      }
+    return 1;
+}
+
+static void
+vgrid_check_job (struct vgrid_worker *worker)
+{
+/* testing a slice of the current chunk */
+    struct vgrid_candidate *candidate;
+    for (candidate = worker->first; candidate < worker->last; candidate++)
+	candidate->hit =
+	    vgrid_check_cell (worker->p_cache, worker->prepared,
+			      candidate->cell);
+}
+
+static void
+vgrid_check_thread (void *arg)
+{
+/* the worker thread */
+    vgrid_check_job ((struct vgrid_worker *) arg);
+}
+
+static void
+vgrid_check_chunk (VirtualGridCursorPtr cursor)
+{
+/* testing all cells of the current chunk - one slice per thread */
+    void *threads[VGRID_MAX_THREADS];
+    int num_jobs = cursor->chunk_count / VGRID_MIN_CELLS;
+    int i;
+
+    if (num_jobs > cursor->threads)
+	num_jobs = cursor->threads;
+    if (num_jobs < 1)
+	num_jobs = 1;
+    if (cursor->num_workers == 0)
+      {
+	  /* the first worker always runs on this thread */
+	  cursor->workers[0].p_cache = cursor->pVtab->p_cache;
+	  cursor->workers[0].own_cache = 0;
+	  cursor->workers[0].geos_input = NULL;
+	  cursor->workers[0].prepared = cursor->prepared;
+	  cursor->num_workers = 1;
+      }
+    while (cursor->num_workers < num_jobs)
+      {
+	  /* lazily initializing further workers */
+	  if (!vgrid_init_worker (cursor, cursor->workers + cursor->num_workers))
+	    {
+		/* no free connection slot */
+		cursor->threads = cursor->num_workers;
+		break;
+	    }
+	  cursor->num_workers += 1;
+      }
+    if (num_jobs > cursor->num_workers)
+	num_jobs = cursor->num_workers;
+    for (i = 0; i < num_jobs; i++)
+      {
+	  struct vgrid_worker *worker = cursor->workers + i;
+	  worker->first =
+	      cursor->chunk + ((cursor->chunk_count * i) / num_jobs);
+	  worker->last =
+	      cursor->chunk + ((cursor->chunk_count * (i + 1)) / num_jobs);
+	  threads[i] = NULL;
+	  if (i == 0)
+	      continue;
+	  threads[i] = splite_thread_start (vgrid_check_thread, worker);
+      }
+    vgrid_check_job (cursor->workers);
+    for (i = 1; i < num_jobs; i++)
+      {
+	  if (threads[i] == NULL)
+	    {
+		/* no thread available: running on this thread */
+		vgrid_check_job (cursor->workers + i);
+		continue;
+	    }
+	  splite_thread_join (threads[i]);
+      }
+}
+
+static void
+vgrid_fill_chunk (VirtualGridCursorPtr cursor)
+{
+/* collecting and testing the next chunk of candidate cells */
+    gaiaGeomCollPtr cell;
+    vgrid_free_chunk (cursor);
+    while (!(cursor->scan_eof) && cursor->chunk_count < VGRID_CHUNK)
+      {
+	  cell = vgrid_build_cell (cursor);
+	  if (vgrid_check_bbox (cursor, cell))
+	    {
+		struct vgrid_candidate *candidate =
+		    cursor->chunk + cursor->chunk_count;
+		candidate->row_no = cursor->row_no;
+		candidate->col_no = cursor->col_no;
+		candidate->down = cursor->down;
+		candidate->cell = cell;
+		candidate->hit = 0;
+		cursor->chunk_count += 1;
+	    }
+	  else
+	      gaiaFreeGeomColl (cell);
+	  vgrid_advance (cursor);
+      }
+    if (cursor->chunk_count > 0)
+	vgrid_check_chunk (cursor);
+}
+
+static void
+vgrid_fetch (VirtualGridCursorPtr cursor)
+{
+/* positioning on the next cell intersecting the input Geometry */
+    while (1)
+      {
+	  cursor->chunk_index += 1;
+	  if (cursor->chunk_index >= cursor->chunk_count)
+	    {
+		/* the current chunk is exhausted */
+		if (cursor->scan_eof)
+		  {
+		      cursor->eof = 1;
+		      return;
+		  }
+		vgrid_fill_chunk (cursor);
+		continue;
+	    }
+	  if ((cursor->chunk + cursor->chunk_index)->hit)
+	    {
+		cursor->current_row += 1;
+		return;
+	    }
+      }
+}
+
+static int
+vgrid_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
+	      int argc, sqlite3_value ** argv)
+{
+/* setting up a cursor filter */
+    VirtualGridCursorPtr cursor = (VirtualGridCursorPtr) pCursor;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) (cursor->pVtab->p_cache);
+    GEOSContextHandle_t handle = NULL;
+    const unsigned char *blob;
+    int size;
+    int gpkg_mode = 0;
+    int gpkg_amphibious = 0;
+    int has_origin = 0;
+    int has_threads = 0;
+    gaiaGeomCollPtr point;
+    if (idxStr)
+	idxStr = idxStr;	/* unused arg warning suppression */
+    vgrid_reset_cursor (cursor);
+    cursor->current_row = 0;
+    if (idxNum & 2)
+	has_origin = 1;
+    if (idxNum & 4)
+	has_threads = 1;
+    if (cache != NULL)
+      {
+	  handle = splite_get_geos_handle (cache);
+	  gpkg_mode = cache->gpkg_mode;
+	  gpkg_amphibious = cache->gpkg_amphibious_mode;
+      }
+    if (handle == NULL)
+	return SQLITE_OK;
+    if (!(idxNum & 1) || argc != 2 + has_origin + has_threads)
+	return SQLITE_OK;
+
+/* retrieving the cell size */
+    if (sqlite3_value_type (argv[1]) == SQLITE_INTEGER)
+	cursor->size = sqlite3_value_int (argv[1]);
+    else if (sqlite3_value_type (argv[1]) == SQLITE_FLOAT)
+	cursor->size = sqlite3_value_double (argv[1]);
+    else
+	return SQLITE_OK;
+    if (cursor->size <= 0.0)
+	return SQLITE_OK;
+
+/* retrieving the (optional) grid origin */
+    cursor->origin_x = 0.0;
+    cursor->origin_y = 0.0;
+    if (has_origin && sqlite3_value_type (argv[2]) != SQLITE_NULL)
+      {
+	  if (sqlite3_value_type (argv[2]) != SQLITE_BLOB)
+	      return SQLITE_OK;
+	  blob = sqlite3_value_blob (argv[2]);
+	  size = sqlite3_value_bytes (argv[2]);
+	  point =
+	      gaiaFromSpatiaLiteBlobWkbEx (blob, size, gpkg_mode,
+					   gpkg_amphibious);
+	  if (point == NULL)
+	      return SQLITE_OK;
+	  if (point->FirstLinestring != NULL || point->FirstPolygon != NULL
+	      || point->FirstPoint == NULL
+	      || point->FirstPoint != point->LastPoint)
+	    {
+		gaiaFreeGeomColl (point);
+		return SQLITE_OK;
+	    }
+	  cursor->origin_x = point->FirstPoint->X;
+	  cursor->origin_y = point->FirstPoint->Y;
+	  gaiaFreeGeomColl (point);
+      }
+
+/* retrieving the (optional) number of threads */
+    cursor->threads = 0;
+    if (has_threads)
+      {
+	  if (sqlite3_value_type (argv[argc - 1]) == SQLITE_INTEGER)
+	      cursor->threads = sqlite3_value_int (argv[argc - 1]);
+	  else if (sqlite3_value_type (argv[argc - 1]) != SQLITE_NULL)
+	      return SQLITE_OK;
+      }
+    if (cursor->threads <= 0)
+	cursor->threads = splite_cpu_count (VGRID_MAX_THREADS);
+    if (cursor->threads > VGRID_MAX_THREADS)
+	cursor->threads = VGRID_MAX_THREADS;
+
+/* retrieving the input Geometry: Polygons only */
+    if (sqlite3_value_type (argv[0]) != SQLITE_BLOB)
+	return SQLITE_OK;
+    blob = sqlite3_value_blob (argv[0]);
+    size = sqlite3_value_bytes (argv[0]);
+    cursor->input =
+	gaiaFromSpatiaLiteBlobWkbEx (blob, size, gpkg_mode, gpkg_amphibious);
+    if (cursor->input == NULL)
+	return SQLITE_OK;
+    if (cursor->input->FirstPoint != NULL
+	|| cursor->input->FirstLinestring != NULL
+	|| cursor->input->FirstPolygon == NULL)
+      {
+	  vgrid_reset_cursor (cursor);
+	  return SQLITE_OK;
+      }
+    gaiaMbrGeometry (cursor->input);
+    cursor->geos_input = gaiaToGeos_r (cache, cursor->input);
+    if (cursor->geos_input == NULL)
+      {
+	  vgrid_reset_cursor (cursor);
+	  return SQLITE_OK;
+      }
+    cursor->prepared =
+	GEOSPrepare_r (handle, (const GEOSGeometry *) (cursor->geos_input));
+    if (cursor->prepared == NULL)
+      {
+	  vgrid_reset_cursor (cursor);
+	  return SQLITE_OK;
+      }
+
+/* setting up the grid layout */
+    switch (cursor->pVtab->shape)
+      {
+      case VGRID_TRIANGULAR:
+	  cursor->step_x = cursor->size;
+	  cursor->step_y = cursor->size * sin (3.14159265358979323846 / 3.0);
+	  cursor->cell_width = cursor->size * 1.5;
+	  break;
+      case VGRID_HEXAGONAL:
+	  cursor->step_x = cursor->size * 3.0;
+	  cursor->step_y = cursor->size * sin (3.14159265358979323846 / 3.0);
+	  cursor->cell_width = cursor->size * 2.0;
+	  break;
+      default:
+	  cursor->step_x = cursor->size;
+	  cursor->step_y = cursor->size;
+	  cursor->cell_width = cursor->size;
+	  break;
+      };
+    if (!vgrid_valid_index
+	((cursor->input->MinX - cursor->origin_x) / cursor->step_x)
+	|| !vgrid_valid_index ((cursor->input->MaxX -
+				cursor->origin_x) / cursor->step_x)
+	|| !vgrid_valid_index ((cursor->input->MinY -
+				cursor->origin_y) / cursor->step_y)
+	|| !vgrid_valid_index ((cursor->input->MaxY -
+				cursor->origin_y) / cursor->step_y))
+      {
+	  /* cells too tiny: row/col indices would overflow an int */
+	  vgrid_reset_cursor (cursor);
+	  return SQLITE_OK;
+      }
+    cursor->row_no = vgrid_band_index (cursor, cursor->input->MinY);
+    cursor->last_row = vgrid_band_index (cursor, cursor->input->MaxY);
+    if (cursor->pVtab->shape == VGRID_HEXAGONAL)
+	cursor->last_row += 1;	/* Hexagons extend below their own row */
+    vgrid_scanlines (cursor);
+    cursor->chunk = malloc (sizeof (struct vgrid_candidate) * VGRID_CHUNK);
+    if (cursor->chunk == NULL)
+      {
+	  vgrid_reset_cursor (cursor);
+	  return SQLITE_NOMEM;
+      }
+
+/* positioning on the first cell */
+    cursor->eof = 0;
+    cursor->scan_eof = 0;
+    cursor->chunk_count = 0;
+    cursor->chunk_index = -1;
+    if (!vgrid_start_row (cursor))
+	cursor->scan_eof = 1;
+    vgrid_fetch (cursor);
+    return SQLITE_OK;
+}
+
+static int
+vgrid_next (sqlite3_vtab_cursor * pCursor)
+{
+/* fetching next row from cursor */
+    VirtualGridCursorPtr cursor = (VirtualGridCursorPtr) pCursor;
+    if (cursor->eof)
+	return SQLITE_OK;
+    vgrid_fetch (cursor);
+    return SQLITE_OK;
+}
+
+static int
+vgrid_eof (sqlite3_vtab_cursor * pCursor)
+{
+/* cursor EOF */
+    VirtualGridCursorPtr cursor = (VirtualGridCursorPtr) pCursor;
+    return cursor->eof;
+}
+
+static int
+vgrid_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
+	      int column)
+{
+/* fetching value for the Nth column */
+    VirtualGridCursorPtr cursor = (VirtualGridCursorPtr) pCursor;
+    struct splite_internal_cache *cache =
+	(struct splite_internal_cache *) (cursor->pVtab->p_cache);
+    struct vgrid_candidate *candidate = NULL;
+    if (cursor->chunk != NULL && cursor->chunk_index >= 0
+	&& cursor->chunk_index < cursor->chunk_count)
+	candidate = cursor->chunk + cursor->chunk_index;
+    if (candidate == NULL)
+	sqlite3_result_null (pContext);
+    else if (column == 0)
+      {
+	  /* the "row_no" column */
+	  sqlite3_result_int (pContext, candidate->row_no);
+      }
+    else if (column == 1)
+      {
+	  /* the "col_no" column */
+	  if (cursor->pVtab->shape == VGRID_TRIANGULAR)
+	      sqlite3_result_int (pContext,
+				  (candidate->col_no * 2) + candidate->down);
+	  else
+	      sqlite3_result_int (pContext, candidate->col_no);
+      }
+    else if (column == 2)
+      {
+	  /* the "geometry" column */
+	  if (candidate->cell == NULL)
+	      sqlite3_result_null (pContext);
+	  else
+	    {
+		unsigned char *blob;
+		int size;
+		int gpkg_mode = 0;
+		int tiny_point = 0;
+		if (cache != NULL)
+		  {
+		      gpkg_mode = cache->gpkg_mode;
+		      tiny_point = cache->tinyPointEnabled;
+		  }
+		gaiaToSpatiaLiteBlobWkbEx2 (candidate->cell, &blob, &size,
+					    gpkg_mode, tiny_point);
+		sqlite3_result_blob (pContext, blob, size, free);
+	    }
+      }
+    else
+	sqlite3_result_null (pContext);
+    return SQLITE_OK;
+}
+
+static int
+vgrid_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
+{
+/* fetching the ROWID */
+    VirtualGridCursorPtr cursor = (VirtualGridCursorPtr) pCursor;
+    *pRowid = cursor->current_row;
+    return SQLITE_OK;
+}
+
+static int
+vgrid_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
+	      sqlite_int64 * pRowid)
+{
+/* generic update [INSERT / UPDATE / DELETE */
+    if (pRowid || argc || argv || pVTab)
+	pRowid = pRowid;	/* unused arg warning suppression */
+/* read only datasource */
+    return SQLITE_READONLY;
+}
+
+static int
+vgrid_begin (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vgrid_sync (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vgrid_commit (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vgrid_rollback (sqlite3_vtab * pVTab)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    return SQLITE_OK;
+}
+
+static int
+vgrid_rename (sqlite3_vtab * pVTab, const char *zNew)
+{
+/* BEGIN TRANSACTION */
+    if (pVTab)
+	pVTab = pVTab;		/* unused arg warning suppression */
+    if (zNew)
+	zNew = zNew;		/* unused arg warning suppression */
+    return SQLITE_ERROR;
+}
+
+static int
+spliteVirtualGridInit (sqlite3 * db, const void *p_cache)
+{
+    int rc = SQLITE_OK;
+    my_grid_module.iVersion = 1;
+    my_grid_module.xCreate = &vgrid_create;
+    my_grid_module.xConnect = &vgrid_create;	/* eponymous */
+    my_grid_module.xBestIndex = &vgrid_best_index;
+    my_grid_module.xDisconnect = &vgrid_disconnect;
+    my_grid_module.xDestroy = &vgrid_destroy;
+    my_grid_module.xOpen = &vgrid_open;
+    my_grid_module.xClose = &vgrid_close;
+    my_grid_module.xFilter = &vgrid_filter;
+    my_grid_module.xNext = &vgrid_next;
+    my_grid_module.xEof = &vgrid_eof;
+    my_grid_module.xColumn = &vgrid_column;
+    my_grid_module.xRowid = &vgrid_rowid;
+    my_grid_module.xUpdate = &vgrid_update;
+    my_grid_module.xBegin = &vgrid_begin;
+    my_grid_module.xSync = &vgrid_sync;
+    my_grid_module.xCommit = &vgrid_commit;
+    my_grid_module.xRollback = &vgrid_rollback;
+    my_grid_module.xFindFunction = NULL;
+    my_grid_module.xRename = &vgrid_rename;
+/* the same module acts as three eponymous table-valued functions */
+    sqlite3_create_module_v2 (db, "SquareGridCells", &my_grid_module,
+			      (void *) p_cache, 0);
+    sqlite3_create_module_v2 (db, "TriangularGridCells", &my_grid_module,
+			      (void *) p_cache, 0);
+    sqlite3_create_module_v2 (db, "HexGridCells", &my_grid_module,
+			      (void *) p_cache, 0);
+    return rc;
+}
+
+SPATIALITE_PRIVATE int
+virtualgrid_extension_init (void *xdb, const void *p_cache)
+{
+    sqlite3 *db = (sqlite3 *) xdb;
+    return spliteVirtualGridInit (db, p_cache);
+}
+
+#endif /* end GEOS conditional */
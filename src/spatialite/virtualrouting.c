@@ -144,9 +144,27 @@ typedef struct RouteLinkStruct
     const struct RouteNodeStruct *NodeTo;
     sqlite3_int64 LinkRowid;
     double Cost;
+    const double *Profile;	/* hour-of-day Cost factors - may be NULL */
 } RouteLink;
 typedef RouteLink *RouteLinkPtr;
 
+typedef struct RouteTurnStruct
+{
+/* a TURN Restriction */
+    sqlite3_int64 FromLinkRowid;
+    sqlite3_int64 ToLinkRowid;
+    double Penalty;		/* DBL_MAX marks a forbidden Turn */
+} RouteTurn;
+typedef RouteTurn *RouteTurnPtr;
+
+typedef struct RouteProfileStruct
+{
+/* an hour-of-day Speed Profile */
+    double Factors[24];
+    struct RouteProfileStruct *Next;
+} RouteProfile;
+typedef RouteProfile *RouteProfilePtr;
+
 typedef struct RouteNodeStruct
 {
 /* a NODE */
@@ -157,6 +175,8 @@ typedef struct RouteNodeStruct
     double CoordY;
     int NumLinks;
     RouteLinkPtr Links;
+    int NumTurns;
+    RouteTurnPtr Turns;
 } RouteNode;
 typedef RouteNode *RouteNodePtr;
 
@@ -179,6 +199,9 @@ typedef struct RoutingStruct
     int HasZ;
     int Srid;
     RouteNodePtr Nodes;
+    RouteProfilePtr FirstProfile;
+    RouteProfilePtr LastProfile;
+    double MinProfileFactor;
 } Routing;
 typedef Routing *RoutingPtr;
 
@@ -440,6 +463,7 @@ typedef struct RoutingNode
     double Distance;
     double HeuristicDistance;
     int Inspected;
+    unsigned int Generation;	/* the search this node was last reset for */
 } RoutingNode;
 typedef RoutingNode *RoutingNodePtr;
 
@@ -450,6 +474,10 @@ typedef struct RoutingNodes
     RoutingNodePtr *NodesBuffer;
     int Dim;
     int DimLink;
+    unsigned int Generation;	/* the current search */
+    struct RoutingHeapStruct *Heap;	/* the reusable Heap */
+    int HasTurns;		/* some Links are expanded by Turn Restrictions */
+    double DepartureTime;	/* seconds since midnight - negative if not set */
 } RoutingNodes;
 typedef RoutingNodes *RoutingNodesPtr;
 
@@ -464,6 +492,7 @@ typedef struct RoutingHeapStruct
 {
     HeapNodePtr Nodes;
     int Count;
+    int Capacity;
 } RoutingHeap;
 typedef RoutingHeap *RoutingHeapPtr;
 
@@ -487,6 +516,7 @@ typedef struct virtualroutingStruct
     int currentOptions;		/* the currently selected Shortest Path Options */
     char currentDelimiter;	/* the currently set delimiter char */
     double Tolerance;		/* the currently set Tolerance value [Point2Point] */
+    double DepartureTime;	/* the currently set Departure Time [seconds] */
     MultiSolutionPtr multiSolution;	/* the current multiple solution */
     Point2PointSolutionPtr point2PointSolution;	/* the current Point2Point solution */
     int eof;			/* the EOF marker */
@@ -511,6 +541,23 @@ typedef virtualroutingCursor *virtualroutingCursorPtr;
 /
 */
 
+static RoutingHeapPtr routing_heap_init (int n);
+static void routing_heap_free (RoutingHeapPtr heap);
+
+static int
+routing_restricted_link (RouteLinkPtr link)
+{
+/* testing if some Link is the FromLink of any Turn Restriction */
+    int i;
+    const RouteNode *to = link->NodeTo;
+    for (i = 0; i < to->NumTurns; i++)
+      {
+	  if (to->Turns[i].FromLinkRowid == link->LinkRowid)
+	      return 1;
+      }
+    return 0;
+}
+
 static RoutingNodesPtr
 routing_init (RoutingPtr graph)
 {
@@ -518,27 +565,48 @@ routing_init (RoutingPtr graph)
     int i;
     int j;
     int cnt = 0;
+    int states = graph->NumNodes;
     RoutingNodesPtr nd;
     RoutingNodePtr ndn;
+    RoutingNodePtr st;
     RouteNodePtr nn;
+/* 
+edge-based expansion: any Link entering some Node by 
+a restricted direction requires a further dedicated
+state, so to remember the Link it arrived from
+*/
+    for (i = 0; i < graph->NumNodes; i++)
+      {
+	  nn = graph->Nodes + i;
+	  for (j = 0; j < nn->NumLinks; j++)
+	    {
+		if (routing_restricted_link (nn->Links + j))
+		    states++;
+	    }
+      }
 /* allocating the main Nodes struct */
     nd = malloc (sizeof (RoutingNodes));
 /* allocating and initializing  Nodes array */
-    nd->Nodes = malloc (sizeof (RoutingNode) * graph->NumNodes);
-    nd->Dim = graph->NumNodes;
+    nd->Nodes = malloc (sizeof (RoutingNode) * states);
+    nd->Dim = states;
     nd->DimLink = 0;
+    nd->Generation = 0;
+    nd->HasTurns = (states > graph->NumNodes) ? 1 : 0;
+    nd->DepartureTime = -1.0;
 /* pre-alloc buffer strategy - GENSCHER 2010-01-05 */
     for (i = 0; i < graph->NumNodes; cnt += graph->Nodes[i].NumLinks, i++);
     nd->NodesBuffer = malloc (sizeof (RoutingNodePtr) * cnt);
     nd->LinksBuffer = malloc (sizeof (RouteLinkPtr) * cnt);
 
     cnt = 0;
+    st = nd->Nodes + graph->NumNodes;
     for (i = 0; i < graph->NumNodes; i++)
       {
 	  /* initializing the Nodes array */
 	  nn = graph->Nodes + i;
 	  ndn = nd->Nodes + i;
 	  ndn->Id = nn->InternalIndex;
+	  ndn->Generation = 0;
 	  ndn->DimTo = nn->NumLinks;
 	  ndn->Node = nn;
 	  ndn->To = &(nd->NodesBuffer[cnt]);
@@ -549,10 +617,34 @@ routing_init (RoutingPtr graph)
 	    {
 		/*  setting the outcoming Links for the current Node */
 		nd->DimLink++;
-		ndn->To[j] = nd->Nodes + nn->Links[j].NodeTo->InternalIndex;
+		if (nd->HasTurns && routing_restricted_link (nn->Links + j))
+		  {
+		      /* entering the restricted state of NodeTo */
+		      st->Id = nn->Links[j].NodeTo->InternalIndex;
+		      st->Generation = 0;
+		      st->Node = graph->Nodes + st->Id;
+		      ndn->To[j] = st++;
+		  }
+		else
+		    ndn->To[j] =
+			nd->Nodes + nn->Links[j].NodeTo->InternalIndex;
 		ndn->Link[j] = nn->Links + j;
 	    }
       }
+    for (i = graph->NumNodes; i < states; i++)
+      {
+	  /* any restricted state shares the outcoming Links of its Node */
+	  st = nd->Nodes + i;
+	  ndn = nd->Nodes + st->Id;
+	  st->DimTo = ndn->DimTo;
+	  st->To = ndn->To;
+	  st->Link = ndn->Link;
+      }
+/* 
+the Heap will be reused by any search, growing on demand 
+so to remain proportional to the searched area
+*/
+    nd->Heap = routing_heap_init (1024);
     return (nd);
 }
 
@@ -560,6 +652,7 @@ static void
 routing_free (RoutingNodes * e)
 {
 /* memory cleanup; freeing the ROUTING struct */
+    routing_heap_free (e->Heap);
     free (e->LinksBuffer);
     free (e->NodesBuffer);
     free (e->Nodes);
@@ -572,10 +665,22 @@ routing_heap_init (int n)
 /* allocating and initializing the Heap (min-priority queue) */
     RoutingHeapPtr heap = malloc (sizeof (RoutingHeap));
     heap->Count = 0;
+    heap->Capacity = n;
     heap->Nodes = malloc (sizeof (HeapNode) * (n + 1));
     return heap;
 }
 
+static void
+routing_heap_grow (RoutingHeapPtr heap)
+{
+/* ensuring the Heap (min-priority queue) has room for a further Node */
+    if (heap->Count < heap->Capacity)
+	return;
+    heap->Capacity *= 2;
+    heap->Nodes =
+	realloc (heap->Nodes, sizeof (HeapNode) * (heap->Capacity + 1));
+}
+
 static void
 routing_heap_reset (RoutingHeapPtr heap)
 {
@@ -594,6 +699,91 @@ routing_heap_free (RoutingHeapPtr heap)
     free (heap);
 }
 
+static RoutingHeapPtr
+routing_begin_search (RoutingNodesPtr e)
+{
+/* 
+starting a new search: the Nodes are not reset at all, the
+current generation is simply bumped; any Node belonging to 
+some previous generation will be lazily reset on first access
+*/
+    int i;
+    e->Generation += 1;
+    if (e->Generation == 0)
+      {
+	  /* wrapped around: a full reset is required */
+	  for (i = 0; i < e->Dim; i++)
+	      e->Nodes[i].Generation = 0;
+	  e->Generation = 1;
+      }
+    routing_heap_reset (e->Heap);
+    return e->Heap;
+}
+
+static RoutingNodePtr
+routing_touch (RoutingNodesPtr e, RoutingNodePtr n)
+{
+/* lazily resetting a Node not yet reached by the current search */
+    if (n->Generation != e->Generation)
+      {
+	  n->PreviousNode = NULL;
+	  n->xLink = NULL;
+	  n->Inspected = 0;
+	  n->Distance = DBL_MAX;
+	  n->HeuristicDistance = DBL_MAX;
+	  n->Generation = e->Generation;
+      }
+    return n;
+}
+
+static int
+routing_constrained (RoutingNodesPtr e)
+{
+/* testing if Costs are time-dependent or restricted by Turns */
+    if (e->HasTurns || e->DepartureTime >= 0.0)
+	return 1;
+    return 0;
+}
+
+static double
+routing_link_cost (RoutingNodesPtr e, RoutingNodePtr n, RouteLinkPtr link)
+{
+/* 
+the Cost of leaving Node N by some Link: when a Departure Time
+is set the Link Cost is scaled by the Speed Profile factor of the
+hour of day N has been reached at, then any Turn Penalty is added.
+DBL_MAX marks a forbidden Turn
+*/
+    int i;
+    double cost = link->Cost;
+    if (e->DepartureTime >= 0.0 && link->Profile != NULL)
+      {
+	  double clock = fmod (e->DepartureTime + n->Distance, 86400.0);
+	  int hour = (int) (clock / 3600.0);
+	  if (hour < 0)
+	      hour = 0;
+	  if (hour > 23)
+	      hour = 23;
+	  cost *= link->Profile[hour];
+      }
+    if (e->HasTurns && n->xLink != NULL)
+      {
+	  const RouteNode *node = n->Node;
+	  for (i = 0; i < node->NumTurns; i++)
+	    {
+		RouteTurnPtr turn = node->Turns + i;
+		if (turn->FromLinkRowid != n->xLink->LinkRowid
+		    || turn->ToLinkRowid != link->LinkRowid)
+		    continue;
+		if (turn->Penalty == DBL_MAX)
+		    return DBL_MAX;
+		cost += turn->Penalty;
+		break;
+	    }
+      }
+    return cost;
+}
+
 static void
 dijkstra_insert (RoutingNodePtr node, HeapNodePtr heap, int size)
 {
@@ -620,6 +810,7 @@ static void
 dijkstra_enqueue (RoutingHeapPtr heap, RoutingNodePtr node)
 {
 /* enqueuing a Node into the heap */
+    routing_heap_grow (heap);
     dijkstra_insert (node, heap->Nodes, heap->Count);
     heap->Count += 1;
 }
@@ -1722,6 +1913,7 @@ build_tsp_solution (MultiSolutionPtr multiSolution, TspTargetsPtr targets,
     int route_row = 0;
     int route_num = 0;
     int found;
+    int no_return = 0;
 
 /* checking for undefined or unreacheable targets */
     for (i = 0; i < targets->Count; i++)
@@ -1732,6 +1924,12 @@ build_tsp_solution (MultiSolutionPtr multiSolution, TspTargetsPtr targets,
 	  if (*(targets->Found + i) != 'Y')
 	      unreachable = 1;
       }
+    if (targets->LastSolution == NULL && !unreachable)
+      {
+	  /* the circular path can't be closed back to FROM */
+	  unreachable = 1;
+	  no_return = 1;
+      }
 
 /* inserting the TSP Header */
     row = malloc (sizeof (ResultsetRow));
@@ -1783,6 +1981,26 @@ build_tsp_solution (MultiSolutionPtr multiSolution, TspTargetsPtr targets,
 		      multiSolution->LastRow = row;
 		  }
 	    }
+	  if (no_return)
+	    {
+		/* unreacheable FROM (final trip) */
+		row = malloc (sizeof (ResultsetRow));
+		row->RouteNum = route_num++;
+		row->RouteRow = 0;
+		row->Point2PointRole = VROUTE_POINT2POINT_NONE;
+		row->From = multiSolution->From;
+		row->To = multiSolution->From;
+		row->Undefined = NULL;
+		row->linkRef = NULL;
+		row->TotalCost = 0.0;
+		row->Geometry = NULL;
+		row->Next = NULL;
+		if (multiSolution->FirstRow == NULL)
+		    multiSolution->FirstRow = row;
+		if (multiSolution->LastRow != NULL)
+		    multiSolution->LastRow->Next = row;
+		multiSolution->LastRow = row;
+	    }
 	  return;
       }
 
@@ -2019,22 +2237,14 @@ dijkstra_multi_shortest_path (sqlite3 * handle, int options, RoutingPtr graph,
     RoutingNodePtr n;
     RoutingNodePtr p_to;
     RouteLinkPtr p_link;
+    double cost;
     RoutingHeapPtr heap;
 /* setting From */
     from = multiSolution->From->InternalIndex;
-/* initializing the heap */
-    heap = routing_heap_init (e->DimLink);
-/* initializing the graph */
-    for (i = 0; i < e->Dim; i++)
-      {
-	  n = e->Nodes + i;
-	  n->PreviousNode = NULL;
-	  n->xLink = NULL;
-	  n->Inspected = 0;
-	  n->Distance = DBL_MAX;
-      }
+/* initializing the heap and the graph */
+    heap = routing_begin_search (e);
 /* queuing the From node into the heap */
-    e->Nodes[from].Distance = 0.0;
+    routing_touch (e, e->Nodes + from)->Distance = 0.0;
     dijkstra_enqueue (heap, e->Nodes + from);
     while (heap->Count > 0)
       {
@@ -2047,8 +2257,7 @@ dijkstra_multi_shortest_path (sqlite3 * handle, int options, RoutingPtr graph,
 		RouteLinkPtr *result;
 		RoutingNodePtr nn;
 		int cnt = 0;
-		int to = destination->InternalIndex;
-		nn = e->Nodes + to;
+		nn = n;
 		while (nn->PreviousNode != NULL)
 		  {
 		      /* counting how many Links are into the Shortest Path solution */
@@ -2058,7 +2267,7 @@ dijkstra_multi_shortest_path (sqlite3 * handle, int options, RoutingPtr graph,
 		/* allocating the solution */
 		result = malloc (sizeof (RouteLinkPtr) * cnt);
 		k = cnt - 1;
-		nn = e->Nodes + to;
+		nn = n;
 		while (nn->PreviousNode != NULL)
 		  {
 		      /* inserting a Link into the solution */
@@ -2070,6 +2279,8 @@ dijkstra_multi_shortest_path (sqlite3 * handle, int options, RoutingPtr graph,
 		    add2multiSolution (multiSolution, multiSolution->From,
 				       destination);
 		build_solution (handle, options, graph, solution, result, cnt);
+		if (routing_constrained (e))
+		    solution->TotalCost = n->Distance;
 		/* testing for end (all destinations already reached) */
 		if (end_multiTo (multiSolution->MultiTo))
 		    break;
@@ -2077,29 +2288,31 @@ dijkstra_multi_shortest_path (sqlite3 * handle, int options, RoutingPtr graph,
 	  n->Inspected = 1;
 	  for (i = 0; i < n->DimTo; i++)
 	    {
-		p_to = *(n->To + i);
+		p_to = routing_touch (e, *(n->To + i));
 		p_link = *(n->Link + i);
 		if (p_to->Inspected == 0)
 		  {
+		      cost = routing_link_cost (e, n, p_link);
+		      if (cost == DBL_MAX)
+			  continue;	/* forbidden Turn */
 		      if (p_to->Distance == DBL_MAX)
 			{
 			    /* queuing a new node into the heap */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    p_to->PreviousNode = n;
 			    p_to->xLink = p_link;
 			    dijkstra_enqueue (heap, p_to);
 			}
-		      else if (p_to->Distance > n->Distance + p_link->Cost)
+		      else if (p_to->Distance > n->Distance + cost)
 			{
 			    /* updating an already inserted node */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    p_to->PreviousNode = n;
 			    p_to->xLink = p_link;
 			}
 		  }
 	    }
       }
-    routing_heap_free (heap);
 }
 
 static RouteNodePtr
@@ -2154,22 +2367,14 @@ dijkstra_targets_solve (RoutingNodesPtr e, TspTargetsPtr targets)
     RoutingNodePtr n;
     RoutingNodePtr p_to;
     RouteLinkPtr p_link;
+    double cost;
     RoutingHeapPtr heap;
 /* setting From */
     from = targets->From->InternalIndex;
-/* initializing the heap */
-    heap = routing_heap_init (e->DimLink);
-/* initializing the graph */
-    for (i = 0; i < e->Dim; i++)
-      {
-	  n = e->Nodes + i;
-	  n->PreviousNode = NULL;
-	  n->xLink = NULL;
-	  n->Inspected = 0;
-	  n->Distance = DBL_MAX;
-      }
+/* initializing the heap and the graph */
+    heap = routing_begin_search (e);
 /* queuing the From node into the heap */
-    e->Nodes[from].Distance = 0.0;
+    routing_touch (e, e->Nodes + from)->Distance = 0.0;
     dijkstra_enqueue (heap, e->Nodes + from);
     while (heap->Count > 0)
       {
@@ -2181,13 +2386,17 @@ dijkstra_targets_solve (RoutingNodesPtr e, TspTargetsPtr targets)
 		/* reached one of the targets */
 		int stop = 0;
 		double totalCost = 0.0;
-		int to = destination->InternalIndex;
-		n = e->Nodes + to;
-		while (n->PreviousNode != NULL)
+		RoutingNodePtr nn = n;
+		if (routing_constrained (e))
+		    totalCost = n->Distance;
+		else
 		  {
-		      /* computing the total Cost */
-		      totalCost += n->xLink->Cost;
-		      n = n->PreviousNode;
+		      while (nn->PreviousNode != NULL)
+			{
+			    /* computing the total Cost */
+			    totalCost += nn->xLink->Cost;
+			    nn = nn->PreviousNode;
+			}
 		  }
 		/* updating targets */
 		update_targets (targets, destination, totalCost, &stop);
@@ -2197,29 +2406,31 @@ dijkstra_targets_solve (RoutingNodesPtr e, TspTargetsPtr targets)
 	  n->Inspected = 1;
 	  for (i = 0; i < n->DimTo; i++)
 	    {
-		p_to = *(n->To + i);
+		p_to = routing_touch (e, *(n->To + i));
 		p_link = *(n->Link + i);
 		if (p_to->Inspected == 0)
 		  {
+		      cost = routing_link_cost (e, n, p_link);
+		      if (cost == DBL_MAX)
+			  continue;	/* forbidden Turn */
 		      if (p_to->Distance == DBL_MAX)
 			{
 			    /* queuing a new node into the heap */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    p_to->PreviousNode = n;
 			    p_to->xLink = p_link;
 			    dijkstra_enqueue (heap, p_to);
 			}
-		      else if (p_to->Distance > n->Distance + p_link->Cost)
+		      else if (p_to->Distance > n->Distance + cost)
 			{
 			    /* updating an already inserted node */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    p_to->PreviousNode = n;
 			    p_to->xLink = p_link;
 			}
 		  }
 	    }
       }
-    routing_heap_free (heap);
 }
 
 static void
@@ -2427,24 +2638,16 @@ dijkstra_tsp_nn (sqlite3 * handle, int options, RoutingPtr graph,
     RoutingNodePtr n;
     RoutingNodePtr p_to;
     RouteLinkPtr p_link;
+    double cost;
     RoutingHeapPtr heap;
 
 /* setting From */
     from = targets->From->InternalIndex;
     origin = targets->From;
-/* initializing the heap */
-    heap = routing_heap_init (e->DimLink);
-/* initializing the graph */
-    for (i = 0; i < e->Dim; i++)
-      {
-	  n = e->Nodes + i;
-	  n->PreviousNode = NULL;
-	  n->xLink = NULL;
-	  n->Inspected = 0;
-	  n->Distance = DBL_MAX;
-      }
+/* initializing the heap and the graph */
+    heap = routing_begin_search (e);
 /* queuing the From node into the heap */
-    e->Nodes[from].Distance = 0.0;
+    routing_touch (e, e->Nodes + from)->Distance = 0.0;
     dijkstra_enqueue (heap, e->Nodes + from);
     while (heap->Count > 0)
       {
@@ -2458,24 +2661,25 @@ dijkstra_tsp_nn (sqlite3 * handle, int options, RoutingPtr graph,
 	    {
 		/* reached one of the target destinations */
 		RouteLinkPtr *result;
+		RoutingNodePtr nn;
 		int cnt = 0;
 		int to = destination->InternalIndex;
-		n = e->Nodes + to;
-		while (n->PreviousNode != NULL)
+		nn = n;
+		while (nn->PreviousNode != NULL)
 		  {
 		      /* counting how many Links are into the Shortest Path solution */
 		      cnt++;
-		      n = n->PreviousNode;
+		      nn = nn->PreviousNode;
 		  }
 		/* allocating the solution */
 		result = malloc (sizeof (RouteLinkPtr) * cnt);
 		k = cnt - 1;
-		n = e->Nodes + to;
-		while (n->PreviousNode != NULL)
+		nn = n;
+		while (nn->PreviousNode != NULL)
 		  {
 		      /* inserting a Link into the solution */
-		      result[k] = n->xLink;
-		      n = n->PreviousNode;
+		      result[k] = nn->xLink;
+		      nn = nn->PreviousNode;
 		      k--;
 		  }
 		if (last_route)
@@ -2484,6 +2688,13 @@ dijkstra_tsp_nn (sqlite3 * handle, int options, RoutingPtr graph,
 		else
 		    solution = add2tspSolution (targets, origin, destination);
 		build_solution (handle, options, graph, solution, result, cnt);
+		if (routing_constrained (e))
+		  {
+		      /* the next leg will depart as soon as this one arrives */
+		      solution->TotalCost = n->Distance;
+		      if (e->DepartureTime >= 0.0)
+			  e->DepartureTime += n->Distance;
+		  }
 		targets->TotalCost += solution->TotalCost;
 
 		/* testing for end (all destinations already reached) */
@@ -2497,16 +2708,8 @@ dijkstra_tsp_nn (sqlite3 * handle, int options, RoutingPtr graph,
 
 		/* restarting from the current target */
 		from = to;
-		for (i = 0; i < e->Dim; i++)
-		  {
-		      n = e->Nodes + i;
-		      n->PreviousNode = NULL;
-		      n->xLink = NULL;
-		      n->Inspected = 0;
-		      n->Distance = DBL_MAX;
-		  }
-		e->Nodes[from].Distance = 0.0;
-		routing_heap_reset (heap);
+		heap = routing_begin_search (e);
+		routing_touch (e, e->Nodes + from)->Distance = 0.0;
 		dijkstra_enqueue (heap, e->Nodes + from);
 		origin = destination;
 		continue;
@@ -2514,29 +2717,44 @@ dijkstra_tsp_nn (sqlite3 * handle, int options, RoutingPtr graph,
 	  n->Inspected = 1;
 	  for (i = 0; i < n->DimTo; i++)
 	    {
-		p_to = *(n->To + i);
+		p_to = routing_touch (e, *(n->To + i));
 		p_link = *(n->Link + i);
 		if (p_to->Inspected == 0)
 		  {
+		      cost = routing_link_cost (e, n, p_link);
+		      if (cost == DBL_MAX)
+			  continue;	/* forbidden Turn */
 		      if (p_to->Distance == DBL_MAX)
 			{
 			    /* queuing a new node into the heap */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    p_to->PreviousNode = n;
 			    p_to->xLink = p_link;
 			    dijkstra_enqueue (heap, p_to);
 			}
-		      else if (p_to->Distance > n->Distance + p_link->Cost)
+		      else if (p_to->Distance > n->Distance + cost)
 			{
 			    /* updating an already inserted node */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    p_to->PreviousNode = n;
 			    p_to->xLink = p_link;
 			}
 		  }
 	    }
       }
-    routing_heap_free (heap);
+}
+
+static int
+cmp_routing_nodes (const void *p1, const void *p2)
+{
+/* compares two Routing Nodes by index */
+    RoutingNodePtr pN1 = *((RoutingNodePtr *) p1);
+    RoutingNodePtr pN2 = *((RoutingNodePtr *) p2);
+    if (pN1->Id == pN2->Id)
+	return 0;
+    if (pN1->Id > pN2->Id)
+	return 1;
+    return -1;
 }
 
 static RoutingNodePtr *
@@ -2549,79 +2767,80 @@ dijkstra_range_analysis (RoutingNodesPtr e, RouteNodePtr pfrom,
     RoutingNodePtr p_to;
     RoutingNodePtr n;
     RouteLinkPtr p_link;
-    int cnt;
+    double cost;
+    int cnt = 0;
+    int max_cnt = 1024;
     RoutingNodePtr *result;
     RoutingHeapPtr heap;
 /* setting From */
     from = pfrom->InternalIndex;
-/* initializing the heap */
-    heap = routing_heap_init (e->DimLink);
-/* initializing the graph */
-    for (i = 0; i < e->Dim; i++)
-      {
-	  n = e->Nodes + i;
-	  n->PreviousNode = NULL;
-	  n->xLink = NULL;
-	  n->Inspected = 0;
-	  n->Distance = DBL_MAX;
-      }
+/* the resultset will directly collect any traversed Node */
+    result = malloc (sizeof (RoutingNodePtr) * max_cnt);
+/* initializing the heap and the graph */
+    heap = routing_begin_search (e);
 /* queuing the From node into the heap */
-    e->Nodes[from].Distance = 0.0;
+    routing_touch (e, e->Nodes + from)->Distance = 0.0;
     dijkstra_enqueue (heap, e->Nodes + from);
     while (heap->Count > 0)
       {
 	  /* Dijsktra loop */
 	  n = routing_dequeue (heap);
 	  n->Inspected = 1;
+	  if (n->Id != from)
+	    {
+		/* inserting a traversed Node into the resultset */
+		if (cnt == max_cnt)
+		  {
+		      max_cnt *= 2;
+		      result =
+			  realloc (result, sizeof (RoutingNodePtr) * max_cnt);
+		  }
+		result[cnt++] = n;
+	    }
 	  for (i = 0; i < n->DimTo; i++)
 	    {
-		p_to = *(n->To + i);
+		p_to = routing_touch (e, *(n->To + i));
 		p_link = *(n->Link + i);
 		if (p_to->Inspected == 0)
 		  {
+		      cost = routing_link_cost (e, n, p_link);
+		      if (cost == DBL_MAX)
+			  continue;	/* forbidden Turn */
 		      if (p_to->Distance == DBL_MAX)
 			{
 			    /* queuing a new node into the heap */
-			    if (n->Distance + p_link->Cost <= max_cost)
+			    if (n->Distance + cost <= max_cost)
 			      {
-				  p_to->Distance = n->Distance + p_link->Cost;
+				  p_to->Distance = n->Distance + cost;
 				  p_to->PreviousNode = n;
 				  p_to->xLink = p_link;
 				  dijkstra_enqueue (heap, p_to);
 			      }
 			}
-		      else if (p_to->Distance > n->Distance + p_link->Cost)
+		      else if (p_to->Distance > n->Distance + cost)
 			{
 			    /* updating an already inserted node */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    p_to->PreviousNode = n;
 			    p_to->xLink = p_link;
 			}
 		  }
 	    }
       }
-    routing_heap_free (heap);
-    cnt = 0;
-    for (i = 0; i < e->Dim; i++)
-      {
-	  /* counting how many traversed Nodes */
-	  n = e->Nodes + i;
-	  if (n->Node->InternalIndex == from)
-	      continue;
-	  if (n->Inspected)
-	      cnt++;
-      }
-/* allocating the solution */
-    result = malloc (sizeof (RouteNodePtr) * cnt);
-    cnt = 0;
-    for (i = 0; i < e->Dim; i++)
+/* sorting the resultset by Node */
+    qsort (result, cnt, sizeof (RoutingNodePtr), cmp_routing_nodes);
+    if (e->HasTurns && cnt > 1)
       {
-	  /* populating the resultset */
-	  n = e->Nodes + i;
-	  if (n->Node->InternalIndex == from)
-	      continue;
-	  if (n->Inspected)
-	      result[cnt++] = n;
+	  /* any Node reached by many states is reported just once */
+	  int k = 0;
+	  for (i = 1; i < cnt; i++)
+	    {
+		if (result[i]->Id != result[k]->Id)
+		    result[++k] = result[i];
+		else if (result[i]->Distance < result[k]->Distance)
+		    result[k] = result[i];
+	    }
+	  cnt = k + 1;
       }
     *ll = cnt;
     return (result);
@@ -2659,6 +2878,7 @@ static void
 astar_enqueue (RoutingHeapPtr heap, RoutingNodePtr node)
 {
 /* enqueuing a Node into the heap */
+    routing_heap_grow (heap);
     astar_insert (node, heap->Nodes, heap->Count);
     heap->Count += 1;
 }
@@ -2676,7 +2896,7 @@ astar_heuristic_distance (RouteNodePtr n1, RouteNodePtr n2, double coeff)
 static RouteLinkPtr *
 astar_shortest_path (RoutingNodesPtr e, RouteNodePtr nodes,
 		     RouteNodePtr pfrom, RouteNodePtr pto,
-		     double heuristic_coeff, int *ll)
+		     double heuristic_coeff, int *ll, double *total_cost)
 {
 /* identifying the Shortest Path - A* algorithm */
     int from;
@@ -2685,10 +2905,12 @@ astar_shortest_path (RoutingNodesPtr e, RouteNodePtr nodes,
     int k;
     RoutingNodePtr pAux;
     RoutingNodePtr n;
+    RoutingNodePtr target = NULL;
     RoutingNodePtr p_to;
     RouteNodePtr pOrg;
     RouteNodePtr pDest;
     RouteLinkPtr p_link;
+    double cost;
     int cnt;
     RouteLinkPtr *result;
     RoutingHeapPtr heap;
@@ -2699,20 +2921,10 @@ astar_shortest_path (RoutingNodesPtr e, RouteNodePtr nodes,
     pOrg = nodes + pAux->Id;
     pAux = e->Nodes + to;
     pDest = nodes + pAux->Id;
-/* initializing the heap */
-    heap = routing_heap_init (e->DimLink);
-/* initializing the graph */
-    for (i = 0; i < e->Dim; i++)
-      {
-	  n = e->Nodes + i;
-	  n->PreviousNode = NULL;
-	  n->xLink = NULL;
-	  n->Inspected = 0;
-	  n->Distance = DBL_MAX;
-	  n->HeuristicDistance = DBL_MAX;
-      }
+/* initializing the heap and the graph */
+    heap = routing_begin_search (e);
 /* queuing the From node into the heap */
-    e->Nodes[from].Distance = 0.0;
+    routing_touch (e, e->Nodes + from)->Distance = 0.0;
     e->Nodes[from].HeuristicDistance =
 	astar_heuristic_distance (pOrg, pDest, heuristic_coeff);
     astar_enqueue (heap, e->Nodes + from);
@@ -2723,19 +2935,23 @@ astar_shortest_path (RoutingNodesPtr e, RouteNodePtr nodes,
 	  if (n->Id == to)
 	    {
 		/* destination reached */
+		target = n;
 		break;
 	    }
 	  n->Inspected = 1;
 	  for (i = 0; i < n->DimTo; i++)
 	    {
-		p_to = *(n->To + i);
+		p_to = routing_touch (e, *(n->To + i));
 		p_link = *(n->Link + i);
 		if (p_to->Inspected == 0)
 		  {
+		      cost = routing_link_cost (e, n, p_link);
+		      if (cost == DBL_MAX)
+			  continue;	/* forbidden Turn */
 		      if (p_to->Distance == DBL_MAX)
 			{
 			    /* queuing a new node into the heap */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    pOrg = nodes + p_to->Id;
 			    p_to->HeuristicDistance =
 				p_to->Distance + astar_heuristic_distance (pOrg,
@@ -2745,10 +2961,10 @@ astar_shortest_path (RoutingNodesPtr e, RouteNodePtr nodes,
 			    p_to->xLink = p_link;
 			    astar_enqueue (heap, p_to);
 			}
-		      else if (p_to->Distance > n->Distance + p_link->Cost)
+		      else if (p_to->Distance > n->Distance + cost)
 			{
 			    /* updating an already inserted node */
-			    p_to->Distance = n->Distance + p_link->Cost;
+			    p_to->Distance = n->Distance + cost;
 			    pOrg = nodes + p_to->Id;
 			    p_to->HeuristicDistance =
 				p_to->Distance + astar_heuristic_distance (pOrg,
@@ -2760,9 +2976,10 @@ astar_shortest_path (RoutingNodesPtr e, RouteNodePtr nodes,
 		  }
 	    }
       }
-    routing_heap_free (heap);
     cnt = 0;
-    n = e->Nodes + to;
+    if (target == NULL)
+	target = routing_touch (e, e->Nodes + to);
+    n = target;
     while (n->PreviousNode != NULL)
       {
 	  /* counting how many Links are into the Shortest Path solution */
@@ -2772,7 +2989,7 @@ astar_shortest_path (RoutingNodesPtr e, RouteNodePtr nodes,
 /* allocating the solution */
     result = malloc (sizeof (RouteLinkPtr) * cnt);
     k = cnt - 1;
-    n = e->Nodes + to;
+    n = target;
     while (n->PreviousNode != NULL)
       {
 	  /* inserting a Link into the solution */
@@ -2781,6 +2998,7 @@ astar_shortest_path (RoutingNodesPtr e, RouteNodePtr nodes,
 	  k--;
       }
     *ll = cnt;
+    *total_cost = target->Distance;
     return (result);
 }
 
@@ -3647,16 +3865,25 @@ astar_solve (sqlite3 * handle, int options, RoutingPtr graph,
 {
 /* computing an A* Shortest Path solution */
     int cnt;
+    double total_cost;
+    double coeff = graph->AStarHeuristicCoeff;
     RouteLinkPtr *shortest_path;
     ShortestPathSolutionPtr solution;
     RouteNodePtr to = findSingleTo (multiSolution->MultiTo);
     if (to == NULL)
 	return;
+    if (routing->DepartureTime >= 0.0)
+      {
+	  /* the heuristic must remain admissible even on the fastest hour */
+	  coeff *= graph->MinProfileFactor;
+      }
     shortest_path =
 	astar_shortest_path (routing, graph->Nodes, multiSolution->From, to,
-			     graph->AStarHeuristicCoeff, &cnt);
+			     coeff, &cnt, &total_cost);
     solution = add2multiSolution (multiSolution, multiSolution->From, to);
     build_solution (handle, options, graph, solution, shortest_path, cnt);
+    if (routing_constrained (routing) && cnt > 0)
+	solution->TotalCost = total_cost;
     build_multi_solution (multiSolution);
 }
 
@@ -4855,9 +5082,17 @@ network_free (RoutingPtr p)
 	      free (pN->Code);
 	  if (pN->Links)
 	      free (pN->Links);
+	  if (pN->Turns)
+	      free (pN->Turns);
       }
     if (p->Nodes)
 	free (p->Nodes);
+    while (p->FirstProfile != NULL)
+      {
+	  RouteProfilePtr pP = p->FirstProfile->Next;
+	  free (p->FirstProfile);
+	  p->FirstProfile = pP;
+      }
     if (p->TableName)
 	free (p->TableName);
     if (p->FromColumn)
@@ -4980,7 +5215,12 @@ network_init (const unsigned char *blob, int size)
 	  graph->Nodes[i].Code = NULL;
 	  graph->Nodes[i].NumLinks = 0;
 	  graph->Nodes[i].Links = NULL;
+	  graph->Nodes[i].NumTurns = 0;
+	  graph->Nodes[i].Turns = NULL;
       }
+    graph->FirstProfile = NULL;
+    graph->LastProfile = NULL;
+    graph->MinProfileFactor = 1.0;
     len = strlen (table);
     graph->TableName = malloc (len + 1);
     strcpy (graph->TableName, table);
@@ -5169,6 +5409,7 @@ network_block (RoutingPtr graph, const unsigned char *blob, int size)
 		      pA->NodeTo = graph->Nodes + nodeToIdx;
 		      pA->LinkRowid = linkId;
 		      pA->Cost = cost;
+		      pA->Profile = NULL;
 		  }
 	    }
 	  else
@@ -5186,6 +5427,145 @@ network_block (RoutingPtr graph, const unsigned char *blob, int size)
     return 0;
 }
 
+static int
+cmp_links_rowid (const void *p1, const void *p2)
+{
+/* compares two Links by ROWID [for QSORT/BSEARCH] */
+    RouteLinkPtr pA1 = *((RouteLinkPtr *) p1);
+    RouteLinkPtr pA2 = *((RouteLinkPtr *) p2);
+    if (pA1->LinkRowid == pA2->LinkRowid)
+	return 0;
+    if (pA1->LinkRowid > pA2->LinkRowid)
+	return 1;
+    return -1;
+}
+
+static RouteLinkPtr *
+network_links_by_rowid (RoutingPtr graph, int *count)
+{
+/* building an array of all Links sorted by ROWID */
+    int i;
+    int ia;
+    int cnt = 0;
+    RouteLinkPtr *sorted;
+    for (i = 0; i < graph->NumNodes; i++)
+	cnt += graph->Nodes[i].NumLinks;
+    sorted = malloc (sizeof (RouteLinkPtr) * (cnt + 1));
+    cnt = 0;
+    for (i = 0; i < graph->NumNodes; i++)
+      {
+	  RouteNodePtr pN = graph->Nodes + i;
+	  for (ia = 0; ia < pN->NumLinks; ia++)
+	      sorted[cnt++] = pN->Links + ia;
+      }
+    qsort (sorted, cnt, sizeof (RouteLinkPtr), cmp_links_rowid);
+    *count = cnt;
+    return sorted;
+}
+
+static int
+network_profiles (RoutingPtr graph, const unsigned char *blob, int size,
+		  RouteLinkPtr * sorted, int count)
+{
+/* parsing a Speed PROFILE Block */
+    const unsigned char *in = blob;
+    RouteProfilePtr profile;
+    RouteLink key;
+    RouteLinkPtr pKey = &key;
+    RouteLinkPtr *found;
+    int links;
+    int i;
+    int h;
+    if (size < 1 + (24 * 8) + 4 + 1)
+	return 0;
+    if (*in++ != GAIA_NET_PROFILE)	/* signature */
+	return 0;
+    profile = malloc (sizeof (RouteProfile));
+    profile->Next = NULL;
+    if (graph->FirstProfile == NULL)
+	graph->FirstProfile = profile;
+    if (graph->LastProfile != NULL)
+	graph->LastProfile->Next = profile;
+    graph->LastProfile = profile;
+    for (h = 0; h < 24; h++)
+      {
+	  /* the hourly Speed factors */
+	  profile->Factors[h] = gaiaImport64 (in, 1, graph->EndianArch);
+	  in += 8;
+	  if (profile->Factors[h] <= 0.0)
+	      return 0;
+	  if (profile->Factors[h] < graph->MinProfileFactor)
+	      graph->MinProfileFactor = profile->Factors[h];
+      }
+    links = gaiaImport32 (in, 1, graph->EndianArch);	/* # Links */
+    in += 4;
+    if (links < 0 || (size - (in - blob)) < (links * 8) + 1)
+	return 0;
+    for (i = 0; i < links; i++)
+      {
+	  /* any Arc sharing the same Link ROWID adopts this profile */
+	  key.LinkRowid = gaiaImportI64 (in, 1, graph->EndianArch);
+	  in += 8;
+	  found =
+	      bsearch (&pKey, sorted, count, sizeof (RouteLinkPtr),
+		       cmp_links_rowid);
+	  if (found == NULL)
+	      continue;
+	  while (found > sorted && (*(found - 1))->LinkRowid == key.LinkRowid)
+	      found--;
+	  while (found < sorted + count && (*found)->LinkRowid == key.LinkRowid)
+	    {
+		(*found)->Profile = profile->Factors;
+		found++;
+	    }
+      }
+    if (*in++ != GAIA_NET_END)	/* signature */
+	return 0;
+    return 1;
+}
+
+static int
+network_turns (RoutingPtr graph, const unsigned char *blob, int size)
+{
+/* parsing a TURN Restrictions Block */
+    const unsigned char *in = blob;
+    int turns;
+    int i;
+    int index;
+    RouteNodePtr pN;
+    RouteTurnPtr pT;
+    if (size < 6)
+	return 0;
+    if (*in++ != GAIA_NET_TURN)	/* signature */
+	return 0;
+    turns = gaiaImport32 (in, 1, graph->EndianArch);	/* # Turns */
+    in += 4;
+    if (turns < 0 || (size - (in - blob)) < (turns * 28) + 1)
+	return 0;
+    for (i = 0; i < turns; i++)
+      {
+	  /* parsing each Turn */
+	  index = gaiaImport32 (in, 1, graph->EndianArch);	/* node internal index */
+	  in += 4;
+	  if (index < 0 || index >= graph->NumNodes)
+	      return 0;
+	  pN = graph->Nodes + index;
+	  pN->Turns =
+	      realloc (pN->Turns, sizeof (RouteTurn) * (pN->NumTurns + 1));
+	  pT = pN->Turns + pN->NumTurns;
+	  pN->NumTurns += 1;
+	  pT->FromLinkRowid = gaiaImportI64 (in, 1, graph->EndianArch);
+	  in += 8;
+	  pT->ToLinkRowid = gaiaImportI64 (in, 1, graph->EndianArch);
+	  in += 8;
+	  pT->Penalty = gaiaImport64 (in, 1, graph->EndianArch);
+	  in += 8;
+      }
+    if (*in++ != GAIA_NET_END)	/* signature */
+	return 0;
+    return 1;
+}
+
 static RoutingPtr
 load_network (sqlite3 * handle, const char *table)
 {
@@ -5198,6 +5578,9 @@ load_network (sqlite3 * handle, const char *table)
     const unsigned char *blob;
     int size;
     char *xname;
+    RouteLinkPtr *sorted = NULL;
+    int count = 0;
+    int ok;
     xname = gaiaDoubleQuotedSql (table);
     sql = sqlite3_mprintf ("SELECT NetworkData FROM \"%s\" ORDER BY Id", xname);
     free (xname);
@@ -5231,7 +5614,21 @@ load_network (sqlite3 * handle, const char *table)
 				  sqlite3_finalize (stmt);
 				  goto abort;
 			      }
-			    if (!network_block (graph, blob, size))
+			    if (size > 0 && *blob == GAIA_NET_PROFILE)
+			      {
+				  /* Speed Profiles follow all Node blocks */
+				  if (sorted == NULL)
+				      sorted =
+					  network_links_by_rowid (graph,
+								  &count);
+				  ok = network_profiles (graph, blob, size,
+							 sorted, count);
+			      }
+			    else if (size > 0 && *blob == GAIA_NET_TURN)
+				ok = network_turns (graph, blob, size);
+			    else
+				ok = network_block (graph, blob, size);
+			    if (!ok)
 			      {
 				  sqlite3_finalize (stmt);
 				  goto abort;
@@ -5251,9 +5648,13 @@ load_network (sqlite3 * handle, const char *table)
 	    }
       }
     sqlite3_finalize (stmt);
+    if (sorted != NULL)
+	free (sorted);
     find_srid (handle, graph);
     return graph;
   abort:
+    if (sorted != NULL)
+	free (sorted);
     network_free (graph);
     return NULL;
 }
@@ -7213,6 +7614,7 @@ vroute_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     p_vt->currentOptions = VROUTE_SHORTEST_PATH_FULL;
     p_vt->currentDelimiter = ',';
     p_vt->Tolerance = 20.0;
+    p_vt->DepartureTime = -1.0;
     p_vt->routing = NULL;
     p_vt->pModule = &my_route_module;
     p_vt->nRef = 0;
@@ -7229,7 +7631,8 @@ vroute_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 				     "RouteId INTEGER, RouteRow INTEGER, Role TEXT, "
 				     "LinkRowid INTEGER, NodeFrom TEXT, NodeTo TEXT,"
 				     "PointFrom BLOB, PointTo BLOB, Tolerance DOUBLE, "
-				     "Cost DOUBLE, Geometry BLOB, Name TEXT)",
+				     "Cost DOUBLE, Geometry BLOB, Name TEXT, "
+				     "DepartureTime DOUBLE HIDDEN)",
 				     xname);
 	    }
 	  else
@@ -7240,7 +7643,8 @@ vroute_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 				     "RouteId INTEGER, RouteRow INTEGER, Role TEXT, "
 				     "LinkRowid INTEGER, NodeFrom TEXT, NodeTo TEXT,"
 				     "PointFrom BLOB, PointTo BLOB, Tolerance DOUBLE, "
-				     "Cost DOUBLE, Geometry BLOB)", xname);
+				     "Cost DOUBLE, Geometry BLOB, "
+				     "DepartureTime DOUBLE HIDDEN)", xname);
 	    }
       }
     else
@@ -7253,7 +7657,8 @@ vroute_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 				     "RouteId INTEGER, RouteRow INTEGER, Role TEXT, "
 				     "LinkRowid INTEGER, NodeFrom INTEGER, NodeTo INTEGER, "
 				     "PointFrom BLOB, PointTo BLOB, Tolerance Double, "
-				     "Cost DOUBLE, Geometry BLOB, Name TEXT)",
+				     "Cost DOUBLE, Geometry BLOB, Name TEXT, "
+				     "DepartureTime DOUBLE HIDDEN)",
 				     xname);
 	    }
 	  else
@@ -7264,7 +7669,8 @@ vroute_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 				     "RouteId INTEGER, RouteRow INTEGER, Role TEXT, "
 				     "LinkRowid INTEGER, NodeFrom INTEGER, NodeTo INTEGER, "
 				     "PointFrom BLOB, PointTo BLOB, Tolerance DOUBLE, "
-				     "Cost DOUBLE, Geometry BLOB)", xname);
+				     "Cost DOUBLE, Geometry BLOB, "
+				     "DepartureTime DOUBLE HIDDEN)", xname);
 	    }
       }
     free (xname);
@@ -7519,6 +7925,7 @@ vroute_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
     reset_multiSolution (multiSolution);
     reset_point2PointSolution (p2p);
     cursor->pVtab->eof = 0;
+    net->routing->DepartureTime = net->DepartureTime;
     if (idxNum == 1 && argc == 2)
       {
 	  /* retrieving the Shortest Path From/To params */
@@ -9025,6 +9432,15 @@ vroute_column (sqlite3_vtab_cursor * pCursor, sqlite3_context * pContext,
     virtualroutingCursorPtr cursor = (virtualroutingCursorPtr) pCursor;
     virtualroutingPtr net = (virtualroutingPtr) cursor->pVtab;
     node_code = net->graph->NodeCode;
+    if (column == ((net->graph->NameColumn) ? 16 : 15))
+      {
+	  /* the DepartureTime HIDDEN column */
+	  if (net->DepartureTime < 0.0)
+	      sqlite3_result_null (pContext);
+	  else
+	      sqlite3_result_double (pContext, net->DepartureTime);
+	  return SQLITE_OK;
+      }
     if (cursor->pVtab->multiSolution->Mode == VROUTE_RANGE_SOLUTION)
       {
 	  /* processing "within Cost range" solution */
@@ -9065,6 +9481,38 @@ vroute_rowid (sqlite3_vtab_cursor * pCursor, sqlite_int64 * pRowid)
     return SQLITE_OK;
 }
 
+static double
+vroute_parse_departure (sqlite3_value * value)
+{
+/* 
+parsing a Departure Time: seconds since midnight, or 
+a 'HH:MM[:SS]' text; NULL (or anything invalid) means 
+that the routing is not time-dependent
+*/
+    int hh;
+    int mm;
+    int ss = 0;
+    double secs;
+    switch (sqlite3_value_type (value))
+      {
+      case SQLITE_INTEGER:
+      case SQLITE_FLOAT:
+	  secs = sqlite3_value_double (value);
+	  if (secs < 0.0)
+	      return -1.0;
+	  return secs;
+      case SQLITE_TEXT:
+	  if (sscanf
+	      ((const char *) sqlite3_value_text (value), "%d:%d:%d", &hh,
+	       &mm, &ss) < 2)
+	      return -1.0;
+	  if (hh < 0 || hh > 23 || mm < 0 || mm > 59 || ss < 0 || ss > 59)
+	      return -1.0;
+	  return (hh * 3600.0) + (mm * 60.0) + ss;
+      }
+    return -1.0;
+}
+
 static int
 vroute_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 	       sqlite_int64 * pRowid)
@@ -9088,7 +9536,9 @@ vroute_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 	  else
 	    {
 		/* performing an UPDATE */
-		if (argc == 18)
+		int departure =
+		    (p_vtab->graph->NameColumn) ? 18 : 17;
+		if (argc == departure + 1)
 		  {
 		      p_vtab->currentAlgorithm = VROUTE_DIJKSTRA_ALGORITHM;
 		      p_vtab->currentDelimiter = ',';
@@ -9145,6 +9595,8 @@ vroute_update (sqlite3_vtab * pVTab, int argc, sqlite3_value ** argv,
 			}
 		      if (sqlite3_value_type (argv[14]) == SQLITE_FLOAT)
 			  p_vtab->Tolerance = sqlite3_value_double (argv[14]);
+		      p_vtab->DepartureTime =
+			  vroute_parse_departure (argv[departure]);
 		  }
 		return SQLITE_OK;
 	    }
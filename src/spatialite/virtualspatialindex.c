@@ -75,6 +75,22 @@ static struct sqlite3_module my_spidx_module;
 /
 ******************************************************************************/
 
+typedef struct VirtualSpatialIndexCacheStruct
+{
+/* a resolved R*Tree for some Table/Column, reused by following queries */
+    char *db_prefix;
+    char *table_name;
+    char *geom_column;		/* NULL when the Column was not specified */
+    int exists;			/* 0 if no R*Tree was found */
+    int valid;			/* 0 if still to be resolved */
+    sqlite3_stmt *stmt;		/* the prepared R*Tree query */
+    int in_use;			/* the R*Tree query belongs to some cursor */
+    int reprepared;		/* SQLITE_STMTSTATUS_REPREPARE of the R*Tree query
+				   (PRAGMA schema_version before SQLite 3.20.0) */
+    struct VirtualSpatialIndexCacheStruct *next;
+} VirtualSpatialIndexCache;
+typedef VirtualSpatialIndexCache *VirtualSpatialIndexCachePtr;
+
 typedef struct VirtualSpatialIndexStruct
 {
 /* extends the sqlite3_vtab struct */
@@ -82,6 +98,8 @@ typedef struct VirtualSpatialIndexStruct
     int nRef;			/* # references: USED INTERNALLY BY SQLITE */
     char *zErrMsg;		/* error message: USE INTERNALLY BY SQLITE */
     sqlite3 *db;		/* the sqlite db holding the virtual table */
+    VirtualSpatialIndexCachePtr first_cache;	/* resolved R*Trees */
+    VirtualSpatialIndexCachePtr last_cache;
 } VirtualSpatialIndex;
 typedef VirtualSpatialIndex *VirtualSpatialIndexPtr;
 
@@ -91,6 +109,10 @@ typedef struct VirtualSpatialIndexCursorStruct
     VirtualSpatialIndexPtr pVtab;	/* Virtual table of this cursor */
     int eof;			/* the EOF marker */
     sqlite3_stmt *stmt;
+    VirtualSpatialIndexCachePtr cache;	/* owner of stmt (NULL if private) */
+    sqlite3_int64 *batch_rowids;	/* batch probe: sorted distinct ROWIDs */
+    int batch_count;
+    int batch_next;
     sqlite3_int64 CurrentRowId;
 } VirtualSpatialIndexCursor;
 typedef VirtualSpatialIndexCursor *VirtualSpatialIndexCursorPtr;
@@ -550,6 +572,509 @@ vspidx_parse_table_name (const char *tn, char **db_prefix, char **table_name)
     strcpy (*table_name, tn);
 }
 
+#ifdef ENABLE_GEOPACKAGE	/* only if GeoPackage support is enabled */
+static int
+vspidx_find_gpkg_rtree (sqlite3 * sqlite, const char *db_prefix,
+			const char *table_name, const char *geom_column,
+			char **rtree_name)
+{
+/* attempts to find the GeoPackage R*Tree supporting some Geometry Column */
+    char *sql_statement;
+    char *quoted_db;
+    char **results;
+    int rows;
+    int columns;
+    int ret;
+    char *name = NULL;
+
+    *rtree_name = NULL;
+    quoted_db = gaiaDoubleQuotedSql (db_prefix == NULL ? "main" : db_prefix);
+    if (geom_column == NULL)
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT 'rtree_' || table_name || '_' || column_name "
+	     "FROM \"%s\".gpkg_geometry_columns "
+	     "WHERE Upper(table_name) = Upper(%Q)", quoted_db, table_name);
+    else
+	sql_statement =
+	    sqlite3_mprintf
+	    ("SELECT 'rtree_' || table_name || '_' || column_name "
+	     "FROM \"%s\".gpkg_geometry_columns "
+	     "WHERE Upper(table_name) = Upper(%Q) AND "
+	     "Upper(column_name) = Upper(%Q)", quoted_db, table_name,
+	     geom_column);
+    ret =
+	sqlite3_get_table (sqlite, sql_statement, &results, &rows, &columns,
+			   NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+      {
+	  free (quoted_db);
+	  return 0;
+      }
+    if (rows == 1 && results[1] != NULL)
+	name = sqlite3_mprintf ("%s", results[1]);
+    sqlite3_free_table (results);
+    if (name == NULL)
+      {
+	  free (quoted_db);
+	  return 0;
+      }
+
+/* checking if the R*Tree does really exist */
+    sql_statement =
+	sqlite3_mprintf ("SELECT name FROM \"%s\".sqlite_master "
+			 "WHERE type = 'table' AND name = %Q", quoted_db,
+			 name);
+    free (quoted_db);
+    ret =
+	sqlite3_get_table (sqlite, sql_statement, &results, &rows, &columns,
+			   NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK || rows != 1)
+      {
+	  if (ret == SQLITE_OK)
+	      sqlite3_free_table (results);
+	  sqlite3_free (name);
+	  return 0;
+      }
+    sqlite3_free_table (results);
+    *rtree_name = name;
+    return 1;
+}
+#endif /* end GEOPACKAGE */
+
+static int
+vspidx_prepare_rtree (sqlite3 * sqlite, const char *db_prefix,
+		      const char *table_name, const char *geom_column,
+		      sqlite3_stmt ** xstmt)
+{
+/* resolving the R*Tree and preparing the corresponding query */
+    char *xtable = NULL;
+    char *xgeom = NULL;
+    char *idx_name;
+    char *idx_nameQ;
+    char *sql_statement;
+    int exists;
+    int ret;
+
+    *xstmt = NULL;
+    if (geom_column != NULL)
+	exists =
+	    vspidx_check_rtree (sqlite, db_prefix, table_name, geom_column,
+				&xtable, &xgeom);
+    else
+	exists =
+	    vspidx_find_rtree (sqlite, db_prefix, table_name, &xtable, &xgeom);
+    if (!exists)
+      {
+#ifdef ENABLE_GEOPACKAGE	/* only if GeoPackage support is enabled */
+	  /* may be a GeoPackage table supported by its own R*Tree */
+	  if (!vspidx_find_gpkg_rtree
+	      (sqlite, db_prefix, table_name, geom_column, &idx_name))
+	      return 0;
+	  idx_nameQ = gaiaDoubleQuotedSql (idx_name);
+	  sqlite3_free (idx_name);
+	  if (db_prefix == NULL)
+	      sql_statement = sqlite3_mprintf ("SELECT id FROM \"%s\" WHERE "
+					       "minx <= ? AND maxx >= ? AND miny <= ? AND maxy >= ?",
+					       idx_nameQ);
+	  else
+	    {
+		char *quoted_db = gaiaDoubleQuotedSql (db_prefix);
+		sql_statement =
+		    sqlite3_mprintf ("SELECT id FROM \"%s\".\"%s\" WHERE "
+				     "minx <= ? AND maxx >= ? AND miny <= ? AND maxy >= ?",
+				     quoted_db, idx_nameQ);
+		free (quoted_db);
+	    }
+	  free (idx_nameQ);
+	  ret =
+	      sqlite3_prepare_v2 (sqlite, sql_statement,
+				  strlen (sql_statement), xstmt, NULL);
+	  sqlite3_free (sql_statement);
+	  if (ret != SQLITE_OK)
+	    {
+		*xstmt = NULL;
+		return 0;
+	    }
+	  return 1;
+#else
+	  return 0;
+#endif /* end GEOPACKAGE */
+      }
+
+/* building the RTree query */
+    idx_name = sqlite3_mprintf ("idx_%s_%s", xtable, xgeom);
+    idx_nameQ = gaiaDoubleQuotedSql (idx_name);
+    if (db_prefix == NULL)
+      {
+	  sql_statement = sqlite3_mprintf ("SELECT pkid FROM \"%s\" WHERE "
+					   "xmin <= ? AND xmax >= ? AND ymin <= ? AND ymax >= ?",
+					   idx_nameQ);
+      }
+    else
+      {
+	  char *quoted_db = gaiaDoubleQuotedSql (db_prefix);
+	  sql_statement =
+	      sqlite3_mprintf ("SELECT pkid FROM \"%s\".\"%s\" WHERE "
+			       "xmin <= ? AND xmax >= ? AND ymin <= ? AND ymax >= ?",
+			       quoted_db, idx_nameQ);
+	  free (quoted_db);
+      }
+    free (idx_nameQ);
+    sqlite3_free (idx_name);
+    free (xtable);
+    free (xgeom);
+    ret =
+	sqlite3_prepare_v2 (sqlite, sql_statement, strlen (sql_statement),
+			    xstmt, NULL);
+    sqlite3_free (sql_statement);
+    if (ret != SQLITE_OK)
+      {
+	  *xstmt = NULL;
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+vspidx_reprepared (sqlite3 * sqlite, VirtualSpatialIndexCachePtr p)
+{
+/* a value changing whenever the cached R*Tree query could be outdated */
+#if SQLITE_VERSION_NUMBER >= 3020000
+    if (sqlite != NULL)
+	sqlite = sqlite;	/* unused arg warning suppression */
+    return sqlite3_stmt_status (p->stmt, SQLITE_STMTSTATUS_REPREPARE, 0);
+#else
+    int ret;
+    char *sql;
+    char **results;
+    int rows;
+    int columns;
+    int version = -1;
+    if (p->db_prefix == NULL)
+	sql = sqlite3_mprintf ("PRAGMA schema_version");
+    else
+      {
+	  char *quoted_db = gaiaDoubleQuotedSql (p->db_prefix);
+	  sql = sqlite3_mprintf ("PRAGMA \"%s\".schema_version", quoted_db);
+	  free (quoted_db);
+      }
+    ret = sqlite3_get_table (sqlite, sql, &results, &rows, &columns, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return -1;
+    if (rows == 1 && results[1] != NULL)
+	version = atoi (results[1]);
+    sqlite3_free_table (results);
+    return version;
+#endif
+}
+
+static int
+vspidx_cache_check (sqlite3 * sqlite, VirtualSpatialIndexCachePtr p,
+		    int step_ret)
+{
+/*
+/ checking if a cached R*Tree is still up to date after having
+/ stepped its query
+/
+/ the query only depends on the R*Tree itself and on geometry_columns,
+/ and any relevant change (CreateSpatialIndex, DisableSpatialIndex,
+/ DROP TABLE ...) always alters the DB schema, thus forcing SQLite
+/ to silently re-prepare the cached statement; plain INSERT, UPDATE
+/ or DELETE on the indexed table never invalidate the cache, and
+/ checking it never requires executing any further SQL
+/
+/ SQLITE_STMTSTATUS_REPREPARE requires SQLite 3.20.0 or later; on
+/ older versions PRAGMA schema_version is checked instead
+*/
+    int reprepared;
+    if (step_ret != SQLITE_ROW && step_ret != SQLITE_DONE)
+      {
+	  /* the R*Tree has probably been dropped */
+	  p->valid = 0;
+	  return 0;
+      }
+    reprepared = vspidx_reprepared (sqlite, p);
+    if (reprepared == p->reprepared)
+	return 1;
+    p->valid = 0;
+    return 0;
+}
+
+static void
+vspidx_cache_resolve (VirtualSpatialIndexPtr p_vt,
+		      VirtualSpatialIndexCachePtr p)
+{
+/* resolving the R*Tree once again */
+    if (p->stmt != NULL)
+	sqlite3_finalize (p->stmt);
+    p->exists =
+	vspidx_prepare_rtree (p_vt->db, p->db_prefix, p->table_name,
+			      p->geom_column, &(p->stmt));
+    p->reprepared = 0;
+    if (p->exists)
+	p->reprepared = vspidx_reprepared (p_vt->db, p);
+/* a missing R*Tree is never cached, it could be created at any time */
+    p->valid = p->exists;
+}
+
+static void
+vspidx_bind_mbr (sqlite3_stmt * stmt, const double *frame)
+{
+/* binding the R*Tree query params [MBR: minx, miny, maxx, maxy] */
+    float minx;
+    float miny;
+    float maxx;
+    float maxy;
+    double tic;
+    double tic2;
+
+/* adjusting the MBR so to compensate for DOUBLE/FLOAT truncations */
+    minx = (float) (frame[0]);
+    miny = (float) (frame[1]);
+    maxx = (float) (frame[2]);
+    maxy = (float) (frame[3]);
+    tic = fabs (frame[0] - minx);
+    tic2 = fabs (frame[1] - miny);
+    if (tic2 > tic)
+	tic = tic2;
+    tic2 = fabs (frame[2] - maxx);
+    if (tic2 > tic)
+	tic = tic2;
+    tic2 = fabs (frame[3] - maxy);
+    if (tic2 > tic)
+	tic = tic2;
+    tic *= 2.0;
+    sqlite3_bind_double (stmt, 1, frame[2] + tic);
+    sqlite3_bind_double (stmt, 2, frame[0] - tic);
+    sqlite3_bind_double (stmt, 3, frame[3] + tic);
+    sqlite3_bind_double (stmt, 4, frame[1] - tic);
+}
+
+static double *
+vspidx_batch_frames (gaiaGeomCollPtr geom, int *count)
+{
+/* batch probe: one MBR for each elementary item of the search frame */
+    int n = 0;
+    double *frames;
+    double *p;
+    gaiaPointPtr pt;
+    gaiaLinestringPtr ln;
+    gaiaPolygonPtr pg;
+
+    pt = geom->FirstPoint;
+    while (pt != NULL)
+      {
+	  n++;
+	  pt = pt->Next;
+      }
+    ln = geom->FirstLinestring;
+    while (ln != NULL)
+      {
+	  n++;
+	  ln = ln->Next;
+      }
+    pg = geom->FirstPolygon;
+    while (pg != NULL)
+      {
+	  n++;
+	  pg = pg->Next;
+      }
+    *count = n;
+    if (n == 0)
+	return NULL;
+    frames = malloc (sizeof (double) * 4 * n);
+    p = frames;
+    pt = geom->FirstPoint;
+    while (pt != NULL)
+      {
+	  *p++ = pt->X;
+	  *p++ = pt->Y;
+	  *p++ = pt->X;
+	  *p++ = pt->Y;
+	  pt = pt->Next;
+      }
+    ln = geom->FirstLinestring;
+    while (ln != NULL)
+      {
+	  gaiaMbrLinestring (ln);
+	  *p++ = ln->MinX;
+	  *p++ = ln->MinY;
+	  *p++ = ln->MaxX;
+	  *p++ = ln->MaxY;
+	  ln = ln->Next;
+      }
+    pg = geom->FirstPolygon;
+    while (pg != NULL)
+      {
+	  gaiaMbrPolygon (pg);
+	  *p++ = pg->MinX;
+	  *p++ = pg->MinY;
+	  *p++ = pg->MaxX;
+	  *p++ = pg->MaxY;
+	  pg = pg->Next;
+      }
+    return frames;
+}
+
+static int
+vspidx_cmp_rowids (const void *p1, const void *p2)
+{
+/* comparing two ROWIDs [qsort] */
+    sqlite3_int64 id1 = *((const sqlite3_int64 *) p1);
+    sqlite3_int64 id2 = *((const sqlite3_int64 *) p2);
+    if (id1 < id2)
+	return -1;
+    if (id1 > id2)
+	return 1;
+    return 0;
+}
+
+static void
+vspidx_batch_add (VirtualSpatialIndexCursorPtr cursor, sqlite3_int64 rowid,
+		  int *max)
+{
+/* batch probe: collecting a further ROWID */
+    if (cursor->batch_count == *max)
+      {
+	  *max = (*max == 0) ? 256 : *max * 2;
+	  cursor->batch_rowids =
+	      realloc (cursor->batch_rowids, sizeof (sqlite3_int64) * *max);
+      }
+    cursor->batch_rowids[cursor->batch_count++] = rowid;
+}
+
+static void
+vspidx_batch_sort (VirtualSpatialIndexCursorPtr cursor)
+{
+/* batch probe: sorting the ROWIDs and removing duplicates */
+    int i;
+    int n = 0;
+    if (cursor->batch_count < 2)
+	return;
+    qsort (cursor->batch_rowids, cursor->batch_count, sizeof (sqlite3_int64),
+	   vspidx_cmp_rowids);
+    for (i = 1; i < cursor->batch_count; i++)
+      {
+	  if (cursor->batch_rowids[i] != cursor->batch_rowids[n])
+	      cursor->batch_rowids[++n] = cursor->batch_rowids[i];
+      }
+    cursor->batch_count = n + 1;
+}
+
+static int
+vspidx_cache_same (const char *str1, const char *str2)
+{
+/* case-insensitive comparison of two eventually NULL strings */
+    if (str1 == NULL && str2 == NULL)
+	return 1;
+    if (str1 == NULL || str2 == NULL)
+	return 0;
+    return (strcasecmp (str1, str2) == 0);
+}
+
+static char *
+vspidx_cache_strdup (const char *str)
+{
+/* duplicating an eventually NULL string */
+    char *dup;
+    if (str == NULL)
+	return NULL;
+    dup = malloc (strlen (str) + 1);
+    strcpy (dup, str);
+    return dup;
+}
+
+static VirtualSpatialIndexCachePtr
+vspidx_cache_get (VirtualSpatialIndexPtr p_vt, const char *db_prefix,
+		  const char *table_name, const char *geom_column)
+{
+/* retrieving (or creating) the cache item for some Table/Column */
+    VirtualSpatialIndexCachePtr p = p_vt->first_cache;
+    while (p != NULL)
+      {
+	  if (vspidx_cache_same (p->db_prefix, db_prefix)
+	      && vspidx_cache_same (p->table_name, table_name)
+	      && vspidx_cache_same (p->geom_column, geom_column))
+	      return p;
+	  p = p->next;
+      }
+
+    p = malloc (sizeof (VirtualSpatialIndexCache));
+    p->db_prefix = vspidx_cache_strdup (db_prefix);
+    p->table_name = vspidx_cache_strdup (table_name);
+    p->geom_column = vspidx_cache_strdup (geom_column);
+    p->exists = 0;
+    p->valid = 0;
+    p->stmt = NULL;
+    p->in_use = 0;
+    p->reprepared = 0;
+    p->next = NULL;
+    if (p_vt->first_cache == NULL)
+	p_vt->first_cache = p;
+    if (p_vt->last_cache != NULL)
+	p_vt->last_cache->next = p;
+    p_vt->last_cache = p;
+    return p;
+}
+
+static void
+vspidx_free_cache (VirtualSpatialIndexPtr p_vt)
+{
+/* memory cleanup - freeing all cached R*Trees */
+    VirtualSpatialIndexCachePtr p;
+    VirtualSpatialIndexCachePtr pn;
+    p = p_vt->first_cache;
+    while (p != NULL)
+      {
+	  pn = p->next;
+	  if (p->db_prefix != NULL)
+	      free (p->db_prefix);
+	  if (p->table_name != NULL)
+	      free (p->table_name);
+	  if (p->geom_column != NULL)
+	      free (p->geom_column);
+	  if (p->stmt != NULL)
+	      sqlite3_finalize (p->stmt);
+	  free (p);
+	  p = pn;
+      }
+    p_vt->first_cache = NULL;
+    p_vt->last_cache = NULL;
+}
+
+static void
+vspidx_release_batch (VirtualSpatialIndexCursorPtr cursor)
+{
+/* freeing the ROWIDs collected by a batch probe */
+    if (cursor->batch_rowids != NULL)
+	free (cursor->batch_rowids);
+    cursor->batch_rowids = NULL;
+    cursor->batch_count = 0;
+    cursor->batch_next = 0;
+}
+
+static void
+vspidx_release_stmt (VirtualSpatialIndexCursorPtr cursor)
+{
+/* releasing the R*Tree query owned by a cursor */
+    if (cursor->stmt == NULL)
+	return;
+    if (cursor->cache != NULL)
+      {
+	  /* a cached statement: simply resetting */
+	  sqlite3_reset (cursor->stmt);
+	  cursor->cache->in_use = 0;
+      }
+    else
+	sqlite3_finalize (cursor->stmt);
+    cursor->stmt = NULL;
+    cursor->cache = NULL;
+}
+
 static int
 vspidx_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
 	       sqlite3_vtab ** ppVTab, char **pzErr)
@@ -580,10 +1105,13 @@ vspidx_create (sqlite3 * db, void *pAux, int argc, const char *const *argv,
     p_vt->pModule = &my_spidx_module;
     p_vt->nRef = 0;
     p_vt->zErrMsg = NULL;
+    p_vt->first_cache = NULL;
+    p_vt->last_cache = NULL;
 /* preparing the COLUMNs for this VIRTUAL TABLE */
     xname = gaiaDoubleQuotedSql (vtable);
     buf = sqlite3_mprintf ("CREATE TABLE \"%s\" (f_table_name TEXT, "
-			   "f_geometry_column TEXT, search_frame BLOB)", xname);
+			   "f_geometry_column TEXT, search_frame BLOB, "
+			   "batch_probe INTEGER HIDDEN)", xname);
     free (xname);
     free (vtable);
     if (sqlite3_declare_vtab (db, buf) != SQLITE_OK)
@@ -618,6 +1146,8 @@ vspidx_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
     int table = 0;
     int geom = 0;
     int mbr = 0;
+    int batch = 0;
+    int arg;
     if (pVTab)
 	pVTab = pVTab;		/* unused arg warning suppression */
     for (i = 0; i < pIdxInfo->nConstraint; i++)
@@ -632,23 +1162,44 @@ vspidx_best_index (sqlite3_vtab * pVTab, sqlite3_index_info * pIdxInfo)
 		    geom++;
 		else if (p->iColumn == 2 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
 		    mbr++;
+		else if (p->iColumn == 3 && p->op == SQLITE_INDEX_CONSTRAINT_EQ)
+		    batch++;
 		else
 		    errors++;
 	    }
       }
-    if (table == 1 && (geom == 0 || geom == 1) && mbr == 1 && errors == 0)
+    if (table == 1 && (geom == 0 || geom == 1) && mbr == 1
+	&& (batch == 0 || batch == 1) && errors == 0)
       {
 	  /* this one is a valid SpatialIndex query */
 	  if (geom == 1)
 	      pIdxInfo->idxNum = 1;
 	  else
 	      pIdxInfo->idxNum = 2;
+	  if (batch == 1)
+	      pIdxInfo->idxNum |= 4;
 	  pIdxInfo->estimatedCost = 1.0;
 	  for (i = 0; i < pIdxInfo->nConstraint; i++)
 	    {
 		if (pIdxInfo->aConstraint[i].usable)
 		  {
-		      pIdxInfo->aConstraintUsage[i].argvIndex = i + 1;
+		      /* args order: Table, Column, MBR, batch */
+		      switch (pIdxInfo->aConstraint[i].iColumn)
+			{
+			case 0:
+			    arg = 1;
+			    break;
+			case 1:
+			    arg = 2;
+			    break;
+			case 2:
+			    arg = 2 + geom;
+			    break;
+			default:
+			    arg = 3 + geom;
+			    break;
+			};
+		      pIdxInfo->aConstraintUsage[i].argvIndex = arg;
 		      pIdxInfo->aConstraintUsage[i].omit = 1;
 		  }
 	    }
@@ -667,6 +1218,7 @@ vspidx_disconnect (sqlite3_vtab * pVTab)
 {
 /* disconnects the virtual table */
     VirtualSpatialIndexPtr p_vt = (VirtualSpatialIndexPtr) pVTab;
+    vspidx_free_cache (p_vt);
     sqlite3_free (p_vt);
     return SQLITE_OK;
 }
@@ -689,6 +1241,10 @@ vspidx_open (sqlite3_vtab * pVTab, sqlite3_vtab_cursor ** ppCursor)
 	return SQLITE_ERROR;
     cursor->pVtab = (VirtualSpatialIndexPtr) pVTab;
     cursor->stmt = NULL;
+    cursor->cache = NULL;
+    cursor->batch_rowids = NULL;
+    cursor->batch_count = 0;
+    cursor->batch_next = 0;
     cursor->eof = 1;
     *ppCursor = (sqlite3_vtab_cursor *) cursor;
     return SQLITE_OK;
@@ -700,8 +1256,8 @@ vspidx_close (sqlite3_vtab_cursor * pCursor)
 /* closing the cursor */
     VirtualSpatialIndexCursorPtr cursor =
 	(VirtualSpatialIndexCursorPtr) pCursor;
-    if (cursor->stmt)
-	sqlite3_finalize (cursor->stmt);
+    vspidx_release_stmt (cursor);
+    vspidx_release_batch (cursor);
     sqlite3_free (pCursor);
     return SQLITE_OK;
 }
@@ -714,31 +1270,37 @@ vspidx_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
     char *db_prefix = NULL;
     char *table_name = NULL;
     char *geom_column = NULL;
-    char *xtable = NULL;
-    char *xgeom = NULL;
-    char *idx_name;
-    char *idx_nameQ;
-    char *sql_statement;
     gaiaGeomCollPtr geom = NULL;
     int ok_table = 0;
     int ok_geom = 0;
+    int batch = 0;
     const unsigned char *blob;
     int size;
-    int exists;
     int ret;
+    int i;
+    int max = 0;
+    int n_frames = 1;
+    double frame[4];
+    double *frames = frame;
     sqlite3_stmt *stmt;
-    float minx;
-    float miny;
-    float maxx;
-    float maxy;
-    double tic;
-    double tic2;
+    VirtualSpatialIndexCachePtr cache;
     VirtualSpatialIndexCursorPtr cursor =
 	(VirtualSpatialIndexCursorPtr) pCursor;
     VirtualSpatialIndexPtr spidx = (VirtualSpatialIndexPtr) cursor->pVtab;
     if (idxStr)
 	idxStr = idxStr;	/* unused arg warning suppression */
+    vspidx_release_stmt (cursor);
+    vspidx_release_batch (cursor);
     cursor->eof = 1;
+    if (idxNum & 4)
+      {
+	  /* the last arg is the batch probe flag */
+	  argc--;
+	  if (sqlite3_value_type (argv[argc]) == SQLITE_INTEGER
+	      && sqlite3_value_int (argv[argc]) != 0)
+	      batch = 1;
+	  idxNum &= 3;
+      }
     if (idxNum == 1 && argc == 3)
       {
 	  /* retrieving the Table/Column/MBR params */
@@ -790,83 +1352,115 @@ vspidx_filter (sqlite3_vtab_cursor * pCursor, int idxNum, const char *idxStr,
 		goto stop;
 	    }
       }
+    if (geom == NULL)
+	goto stop;
 
-/* checking if the corresponding R*Tree exists */
-    if (ok_geom)
-	exists =
-	    vspidx_check_rtree (spidx->db, db_prefix, table_name, geom_column,
-				&xtable, &xgeom);
+/* the search frame(s) */
+    if (batch)
+      {
+	  frames = vspidx_batch_frames (geom, &n_frames);
+	  if (frames == NULL)
+	      goto stop;
+      }
     else
-	exists =
-	    vspidx_find_rtree (spidx->db, db_prefix, table_name, &xtable,
-			       &xgeom);
-    if (!exists)
-	goto stop;
+      {
+	  gaiaMbrGeometry (geom);
+	  frame[0] = geom->MinX;
+	  frame[1] = geom->MinY;
+	  frame[2] = geom->MaxX;
+	  frame[3] = geom->MaxY;
+      }
 
-/* building the RTree query */
-    idx_name = sqlite3_mprintf ("idx_%s_%s", xtable, xgeom);
-    idx_nameQ = gaiaDoubleQuotedSql (idx_name);
-    if (db_prefix == NULL)
+/* checking if the corresponding R*Tree exists */
+    cache =
+	vspidx_cache_get (spidx, db_prefix, table_name,
+			  ok_geom ? geom_column : NULL);
+    if (cache->in_use)
       {
-	  sql_statement = sqlite3_mprintf ("SELECT pkid FROM \"%s\" WHERE "
-					   "xmin <= ? AND xmax >= ? AND ymin <= ? AND ymax >= ?",
-					   idx_nameQ);
+	  /* already owned by another cursor: using a private statement */
+	  if (!vspidx_prepare_rtree
+	      (spidx->db, db_prefix, table_name, ok_geom ? geom_column : NULL,
+	       &stmt))
+	      goto stop;
       }
     else
       {
-	  char *quoted_db = gaiaDoubleQuotedSql (db_prefix);
-	  sql_statement =
-	      sqlite3_mprintf ("SELECT pkid FROM \"%s\".\"%s\" WHERE "
-			       "xmin <= ? AND xmax >= ? AND ymin <= ? AND ymax >= ?",
-			       quoted_db, idx_nameQ);
-	  free (quoted_db);
+	  if (!cache->valid)
+	      vspidx_cache_resolve (spidx, cache);
+	  if (!cache->exists)
+	      goto stop;
+	  stmt = cache->stmt;
+	  cache->in_use = 1;
+	  cursor->cache = cache;
       }
-    free (idx_nameQ);
-    sqlite3_free (idx_name);
-    ret =
-	sqlite3_prepare_v2 (spidx->db, sql_statement, strlen (sql_statement),
-			    &stmt, NULL);
-    sqlite3_free (sql_statement);
-    if (ret != SQLITE_OK)
-	goto stop;
 /* binding stmt params [MBR] */
-    gaiaMbrGeometry (geom);
-
-/* adjusting the MBR so to compensate for DOUBLE/FLOAT truncations */
-    minx = (float) (geom->MinX);
-    miny = (float) (geom->MinY);
-    maxx = (float) (geom->MaxX);
-    maxy = (float) (geom->MaxY);
-    tic = fabs (geom->MinX - minx);
-    tic2 = fabs (geom->MinY - miny);
-    if (tic2 > tic)
-	tic = tic2;
-    tic2 = fabs (geom->MaxX - maxx);
-    if (tic2 > tic)
-	tic = tic2;
-    tic2 = fabs (geom->MaxY - maxy);
-    if (tic2 > tic)
-	tic = tic2;
-    tic *= 2.0;
-    sqlite3_bind_double (stmt, 1, geom->MaxX + tic);
-    sqlite3_bind_double (stmt, 2, geom->MinX - tic);
-    sqlite3_bind_double (stmt, 3, geom->MaxY + tic);
-    sqlite3_bind_double (stmt, 4, geom->MinY - tic);
+    vspidx_bind_mbr (stmt, frames);
     cursor->stmt = stmt;
     cursor->eof = 0;
 /* fetching the first ResultSet's row */
     ret = sqlite3_step (cursor->stmt);
+    if (cursor->cache != NULL && !vspidx_cache_check (spidx->db, cache, ret))
+      {
+	  /* the DB schema has changed: resolving the R*Tree once again */
+	  sqlite3_reset (stmt);
+	  vspidx_cache_resolve (spidx, cache);
+	  if (!cache->exists)
+	    {
+		cache->in_use = 0;
+		cursor->cache = NULL;
+		cursor->stmt = NULL;
+		cursor->eof = 1;
+		goto stop;
+	    }
+	  stmt = cache->stmt;
+	  vspidx_bind_mbr (stmt, frames);
+	  cursor->stmt = stmt;
+	  ret = sqlite3_step (cursor->stmt);
+	  cache->reprepared = vspidx_reprepared (spidx->db, cache);
+      }
+    if (batch)
+      {
+	  /* batch probe: collecting the ROWIDs matching any frame */
+	  for (i = 0; i < n_frames; i++)
+	    {
+		if (i > 0)
+		  {
+		      sqlite3_reset (stmt);
+		      vspidx_bind_mbr (stmt, frames + (i * 4));
+		      ret = sqlite3_step (stmt);
+		  }
+		while (ret == SQLITE_ROW)
+		  {
+		      vspidx_batch_add (cursor, sqlite3_column_int64 (stmt, 0),
+					&max);
+		      ret = sqlite3_step (stmt);
+		  }
+	    }
+	  /* the R*Tree query is immediately made available to other cursors */
+	  vspidx_release_stmt (cursor);
+	  vspidx_batch_sort (cursor);
+	  if (cursor->batch_count > 0)
+	    {
+		cursor->CurrentRowId = cursor->batch_rowids[0];
+		cursor->batch_next = 1;
+	    }
+	  else
+	      cursor->eof = 1;
+	  goto stop;
+      }
     if (ret == SQLITE_ROW)
 	cursor->CurrentRowId = sqlite3_column_int64 (cursor->stmt, 0);
     else
-	cursor->eof = 1;
+      {
+	  /* the R*Tree query is immediately made available to other cursors */
+	  cursor->eof = 1;
+	  vspidx_release_stmt (cursor);
+      }
   stop:
+    if (frames != frame && frames != NULL)
+	free (frames);
     if (geom)
 	gaiaFreeGeomColl (geom);
-    if (xtable)
-	free (xtable);
-    if (xgeom)
-	free (xgeom);
     if (db_prefix)
 	free (db_prefix);
     if (table_name)
@@ -881,11 +1475,28 @@ vspidx_next (sqlite3_vtab_cursor * pCursor)
     int ret;
     VirtualSpatialIndexCursorPtr cursor =
 	(VirtualSpatialIndexCursorPtr) pCursor;
+    if (cursor->batch_rowids != NULL)
+      {
+	  /* batch probe: the ROWIDs are already known */
+	  if (cursor->batch_next < cursor->batch_count)
+	      cursor->CurrentRowId =
+		  cursor->batch_rowids[cursor->batch_next++];
+	  else
+	    {
+		cursor->eof = 1;
+		vspidx_release_batch (cursor);
+	    }
+	  return SQLITE_OK;
+      }
     ret = sqlite3_step (cursor->stmt);
     if (ret == SQLITE_ROW)
 	cursor->CurrentRowId = sqlite3_column_int64 (cursor->stmt, 0);
     else
-	cursor->eof = 1;
+      {
+	  /* the R*Tree query is immediately made available to other cursors */
+	  cursor->eof = 1;
+	  vspidx_release_stmt (cursor);
+      }
     return SQLITE_OK;
 }
 
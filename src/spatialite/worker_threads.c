@@ -0,0 +1,152 @@
+/*
+
+ worker_threads.c -- starting and joining worker threads on Unix/Linux and Windows
+
+ version 5.0, 2020 August 1
+
+ Author: Sandro Furieri a.furieri@lqt.it
+
+ ------------------------------------------------------------------------------
+ 
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+ 
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+ 
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+ 
+Portions created by the Initial Developer are Copyright (C) 2008-2021
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+ 
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <pthread.h>
+#endif
+
+#include <spatialite_private.h>
+
+struct splite_worker_thread
+{
+/* a worker thread running some job */
+    void (*job) (void *arg);
+    void *arg;
+#if defined(_WIN32) && !defined(__MINGW32__)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+};
+
+SPATIALITE_PRIVATE int
+splite_cpu_count (int max_threads)
+{
+/* the number of available CPU cores - never exceeding MAX_THREADS */
+    int count = 1;
+#if defined(_WIN32) && !defined(__MINGW32__)
+    SYSTEM_INFO info;
+    GetSystemInfo (&info);
+    count = (int) (info.dwNumberOfProcessors);
+#else
+#ifdef _SC_NPROCESSORS_ONLN
+    count = (int) sysconf (_SC_NPROCESSORS_ONLN);
+#endif
+#endif
+    if (count < 1)
+	count = 1;
+    if (max_threads > 0 && count > max_threads)
+	count = max_threads;
+    return count;
+}
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+static DWORD WINAPI
+splite_worker_main (void *arg)
+#else
+static void *
+splite_worker_main (void *arg)
+#endif
+{
+/* the worker thread */
+    struct splite_worker_thread *thread = (struct splite_worker_thread *) arg;
+    thread->job (thread->arg);
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+SPATIALITE_PRIVATE void *
+splite_thread_start (void (*job) (void *arg), void *arg)
+{
+/* 
+/ starting a new thread running JOB(ARG)
+/ returns NULL if no thread could be started: the caller is 
+/ then expected to run the job by itself
+*/
+    struct splite_worker_thread *thread =
+	malloc (sizeof (struct splite_worker_thread));
+    if (thread == NULL)
+	return NULL;
+    thread->job = job;
+    thread->arg = arg;
+#if defined(_WIN32) && !defined(__MINGW32__)
+    thread->handle =
+	CreateThread (NULL, 0, splite_worker_main, thread, 0, NULL);
+    if (thread->handle != NULL)
+	return thread;
+#else
+    if (pthread_create (&(thread->handle), NULL, splite_worker_main, thread)
+	== 0)
+	return thread;
+#endif
+    free (thread);
+    return NULL;
+}
+
+SPATIALITE_PRIVATE void
+splite_thread_join (void *p_thread)
+{
+/* waiting until a thread started by splite_thread_start() terminates */
+    struct splite_worker_thread *thread =
+	(struct splite_worker_thread *) p_thread;
+    if (thread == NULL)
+	return;
+#if defined(_WIN32) && !defined(__MINGW32__)
+    WaitForSingleObject (thread->handle, INFINITE);
+    CloseHandle (thread->handle);
+#else
+    pthread_join (thread->handle, NULL);
+#endif
+    free (thread);
+}
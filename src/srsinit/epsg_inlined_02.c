@@ -53,3951 +53,2234 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_02 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2209, "epsg", 2209,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_02[] = {
+    {2209, "epsg", 2209,
         "ED50 / 3-degree Gauss-Kruger zone 12", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=12500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 12\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 8,
-        "6],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",12500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",");
-    add_srs_wkt (p, 11,
-        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2209\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2210, "epsg", 2210,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=12500000 +y_0=0"
+        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 12\",GEOGCS[\""
+        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3"
+        "6],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",12500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\","
+        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2209\""
+        "]]"},
+    {2210, "epsg", 2210,
         "ED50 / 3-degree Gauss-Kruger zone 13", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=13500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 13\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 8,
-        "9],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",13500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",");
-    add_srs_wkt (p, 11,
-        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2210\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2211, "epsg", 2211,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=13500000 +y_0=0"
+        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 13\",GEOGCS[\""
+        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3"
+        "9],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",13500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\","
+        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2210\""
+        "]]"},
+    {2211, "epsg", 2211,
         "ED50 / 3-degree Gauss-Kruger zone 14", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=14500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 14\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",4");
-    add_srs_wkt (p, 8,
-        "2],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",14500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",");
-    add_srs_wkt (p, 11,
-        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2211\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2212, "epsg", 2212,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=14500000 +y_0=0"
+        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 14\",GEOGCS[\""
+        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",4"
+        "2],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",14500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\","
+        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2211\""
+        "]]"},
+    {2212, "epsg", 2212,
         "ED50 / 3-degree Gauss-Kruger zone 15", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=15500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 15\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",4");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",15500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",");
-    add_srs_wkt (p, 11,
-        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2212\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2213, "epsg", 2213,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=15500000 +y_0=0"
+        " +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"ED50 / 3-degree Gauss-Kruger zone 15\",GEOGCS[\""
+        "ED50\",DATUM[\"European_Datum_1950\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4230\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",4"
+        "5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",15500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\","
+        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2212\""
+        "]]"},
+    {2213, "epsg", 2213,
         "ETRS89 / TM 30 NE", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / TM 30 NE\",GEOGCS[\"ETRS89\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Terrestrial_Reference_System_1989\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",30],PARAMETER[\"scale_factor\",0.9996],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2213\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2214, "epsg", 2214,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=0.9996 +x_0=500000 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def"
+        "s",
+        "PROJCS[\"ETRS89 / TM 30 NE\",GEOGCS[\"ETRS89\",DATUM[\"E"
+        "uropean_Terrestrial_Reference_System_1989\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",30],PARAMETER[\"scale_factor\",0.9996],PARAMETER["
+        "\"false_easting\",500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"2213\"]]"},
+    {2214, "epsg", 2214,
         "Douala 1948 / AEF west", 0, 0,
         "International 1924", "Greenwich",
         "Douala_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.5 +k=0.999 +x_0=1000000 +");
-    add_proj4text (p, 1,
-        "y_0=1000000 +ellps=intl +towgs84=-206.1,-174.7,-87.7,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Douala 1948 / AEF west\",GEOGCS[\"Douala 1948\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Douala_1948\",SPHEROID[\"International 1924\",6");
-    add_srs_wkt (p, 2,
-        "378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6192\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4192\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",10.5],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.999],PARAMETER[\"false_easting\",10");
-    add_srs_wkt (p, 9,
-        "00000],PARAMETER[\"false_northing\",1000000],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3119\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2215, "epsg", 2215,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=10.5 +k=0.999 +x_0=1000000 +"
+        "y_0=1000000 +ellps=intl +towgs84=-206.1,-174.7,-87.7,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Douala 1948 / AEF west\",GEOGCS[\"Douala 1948\""
+        ",DATUM[\"Douala_1948\",SPHEROID[\"International 1924\",6"
+        "378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPS"
+        "G\",\"6192\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4192\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",10.5],PARAMETE"
+        "R[\"scale_factor\",0.999],PARAMETER[\"false_easting\",10"
+        "00000],PARAMETER[\"false_northing\",1000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3119\"]"
+        "]"},
+    {2215, "epsg", 2215,
         "Manoca 1962 / UTM zone 32N", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Manoca_1962", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +towgs84=-70.");
-    add_proj4text (p, 1,
-        "9,-151.8,-41.4,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Manoca 1962 / UTM zone 32N\",GEOGCS[\"Manoca 19");
-    add_srs_wkt (p, 1,
-        "62\",DATUM[\"Manoca_1962\",SPHEROID[\"Clarke 1880 (IGN)\"");
-    add_srs_wkt (p, 2,
-        ",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6193\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4193\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2215\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2216, "epsg", 2216,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +towgs84=-70."
+        "9,-151.8,-41.4,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Manoca 1962 / UTM zone 32N\",GEOGCS[\"Manoca 19"
+        "62\",DATUM[\"Manoca_1962\",SPHEROID[\"Clarke 1880 (IGN)\""
+        ",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]"
+        "],AUTHORITY[\"EPSG\",\"6193\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4193\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2215\"]]"},
+    {2216, "epsg", 2216,
         "Qornoq 1927 / UTM zone 22N", 0, 0,
         "International 1924", "Greenwich",
         "Qornoq_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=intl +towgs84=164,138,-189,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Qornoq 1927 / UTM zone 22N\",GEOGCS[\"Qornoq 19");
-    add_srs_wkt (p, 1,
-        "27\",DATUM[\"Qornoq_1927\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6194\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4194\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",-51],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2216\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2217, "epsg", 2217,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +ellps=intl +towgs84=164,138,-189,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Qornoq 1927 / UTM zone 22N\",GEOGCS[\"Qornoq 19"
+        "27\",DATUM[\"Qornoq_1927\",SPHEROID[\"International 1924"
+        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\""
+        "EPSG\",\"6194\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4194\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",-51],PARAME"
+        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2216\"]]"},
+    {2217, "epsg", 2217,
         "Qornoq 1927 / UTM zone 23N", 0, 0,
         "International 1924", "Greenwich",
         "Qornoq_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +ellps=intl +towgs84=164,138,-189,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Qornoq 1927 / UTM zone 23N\",GEOGCS[\"Qornoq 19");
-    add_srs_wkt (p, 1,
-        "27\",DATUM[\"Qornoq_1927\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6194\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4194\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",-45],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2217\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2219, "epsg", 2219,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=23 +ellps=intl +towgs84=164,138,-189,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Qornoq 1927 / UTM zone 23N\",GEOGCS[\"Qornoq 19"
+        "27\",DATUM[\"Qornoq_1927\",SPHEROID[\"International 1924"
+        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\""
+        "EPSG\",\"6194\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4194\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",-45],PARAME"
+        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2217\"]]"},
+    {2219, "epsg", 2219,
         "ATS77 / UTM zone 19N", 0, 0,
         "Average Terrestrial System 1977", "Greenwich",
         "Average_Terrestrial_System_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +a=6378135 +b=6356750.304921594 +unit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / UTM zone 19N\",GEOGCS[\"ATS77\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Average_Terrestrial_System_1977\",SPHEROID[\"Average Ter");
-    add_srs_wkt (p, 2,
-        "restrial System 1977\",6378135,298.257,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-69],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"2219\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2220, "epsg", 2220,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +a=6378135 +b=6356750.304921594 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"ATS77 / UTM zone 19N\",GEOGCS[\"ATS77\",DATUM[\""
+        "Average_Terrestrial_System_1977\",SPHEROID[\"Average Ter"
+        "restrial System 1977\",6378135,298.257,AUTHORITY[\"EPSG\""
+        ",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",-69],PARAMETER[\"scale_factor\",0.9996],PAR"
+        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"2219\"]]"},
+    {2220, "epsg", 2220,
         "ATS77 / UTM zone 20N", 0, 0,
         "Average Terrestrial System 1977", "Greenwich",
         "Average_Terrestrial_System_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +a=6378135 +b=6356750.304921594 +unit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / UTM zone 20N\",GEOGCS[\"ATS77\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Average_Terrestrial_System_1977\",SPHEROID[\"Average Ter");
-    add_srs_wkt (p, 2,
-        "restrial System 1977\",6378135,298.257,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-63],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"2220\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2222, "epsg", 2222,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +a=6378135 +b=6356750.304921594 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"ATS77 / UTM zone 20N\",GEOGCS[\"ATS77\",DATUM[\""
+        "Average_Terrestrial_System_1977\",SPHEROID[\"Average Ter"
+        "restrial System 1977\",6378135,298.257,AUTHORITY[\"EPSG\""
+        ",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",-63],PARAMETER[\"scale_factor\",0.9996],PAR"
+        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"2220\"]]"},
+    {2222, "epsg", 2222,
         "NAD83 / Arizona East (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Arizona East (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",31],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 8,
-        "10.166666666667],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",700000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2222\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2223, "epsg", 2223,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=ft +no_defs",
+        "PROJCS[\"NAD83 / Arizona East (ft)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",31],PARAMETER[\"central_meridian\",-1"
+        "10.166666666667],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",700000],PARAMETER[\"false_northi"
+        "ng\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2222\"]]"},
+    {2223, "epsg", 2223,
         "NAD83 / Arizona Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Arizona Central (ft)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",31],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 8,
-        "-111.916666666667],PARAMETER[\"scale_factor\",0.9999],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",700000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"2223\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2224, "epsg", 2224,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=ft +no_defs",
+        "PROJCS[\"NAD83 / Arizona Central (ft)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",31],PARAMETER[\"central_meridian\","
+        "-111.916666666667],PARAMETER[\"scale_factor\",0.9999],PA"
+        "RAMETER[\"false_easting\",700000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2223\"]]"},
+    {2224, "epsg", 2224,
         "NAD83 / Arizona West (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0");
-    add_proj4text (p, 1,
-        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Arizona West (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",31],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 8,
-        "13.75],PARAMETER[\"scale_factor\",0.999933333],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",700000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"2224\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2225, "epsg", 2225,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0"
+        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83 / Arizona West (ft)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",31],PARAMETER[\"central_meridian\",-1"
+        "13.75],PARAMETER[\"scale_factor\",0.999933333],PARAMETER"
+        "[\"false_easting\",700000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"2224\"]]"},
+    {2225, "epsg", 2225,
         "NAD83 / California zone 1 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3");
-    add_proj4text (p, 1,
-        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000");
-    add_proj4text (p, 2,
-        "00.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 1 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",39.3333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-122],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 9,
-        "allel_1\",41.6666666666667],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",40],PARAMETER[\"false_easting\",6561666.667],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",1640416.667],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"2225\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2226, "epsg", 2226,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3"
+        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000"
+        "00.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83 / California zone 1 (ftUS)\",GEOGCS[\"NAD"
+        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",39.3333333333333],PARAM"
+        "ETER[\"central_meridian\",-122],PARAMETER[\"standard_par"
+        "allel_1\",41.6666666666667],PARAMETER[\"standard_paralle"
+        "l_2\",40],PARAMETER[\"false_easting\",6561666.667],PARAM"
+        "ETER[\"false_northing\",1640416.667],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"2225\"]]"},
+    {2226, "epsg", 2226,
         "NAD83 / California zone 2 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00");
-    add_proj4text (p, 2,
-        "01016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 2 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",37.6666666666667],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-122],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 9,
-        "allel_1\",39.8333333333333],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",38.3333333333333],PARAMETER[\"false_easting\",6561");
-    add_srs_wkt (p, 11,
-        "666.667],PARAMETER[\"false_northing\",1640416.667],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"2226\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2227, "epsg", 2227,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333"
+        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00"
+        "01016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,0,0"
+        ",0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / California zone 2 (ftUS)\",GEOGCS[\"NAD"
+        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",37.6666666666667],PARAM"
+        "ETER[\"central_meridian\",-122],PARAMETER[\"standard_par"
+        "allel_1\",39.8333333333333],PARAMETER[\"standard_paralle"
+        "l_2\",38.3333333333333],PARAMETER[\"false_easting\",6561"
+        "666.667],PARAMETER[\"false_northing\",1640416.667],UNIT["
+        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\","
+        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"2226\"]]"},
+    {2227, "epsg", 2227,
         "NAD83 / California zone 3 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0=");
-    add_proj4text (p, 2,
-        "500000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 3 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",36.5],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-120.5],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 9,
-        "38.4333333333333],PARAMETER[\"standard_parallel_2\",37.0");
-    add_srs_wkt (p, 10,
-        "666666666667],PARAMETER[\"false_easting\",6561666.667],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",1640416.667],UNIT[\"US surve");
-    add_srs_wkt (p, 12,
-        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"2227\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2228, "epsg", 2228,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666"
+        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0="
+        "500000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=us-ft +no_defs",
+        "PROJCS[\"NAD83 / California zone 3 (ftUS)\",GEOGCS[\"NAD"
+        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",36.5],PARAMETER[\"centr"
+        "al_meridian\",-120.5],PARAMETER[\"standard_parallel_1\","
+        "38.4333333333333],PARAMETER[\"standard_parallel_2\",37.0"
+        "666666666667],PARAMETER[\"false_easting\",6561666.667],P"
+        "ARAMETER[\"false_northing\",1640416.667],UNIT[\"US surve"
+        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"2227\"]]"},
+    {2228, "epsg", 2228,
         "NAD83 / California zone 4 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333");
-    add_proj4text (p, 1,
-        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600");
-    add_proj4text (p, 2,
-        "1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 4 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",35.3333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-119],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 9,
-        "allel_1\",37.25],PARAMETER[\"standard_parallel_2\",36],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",6561666.667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",1640416.667],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 12,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 14,
-        "228\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2229, "epsg", 2229,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333"
+        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600"
+        "1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d"
+        "efs",
+        "PROJCS[\"NAD83 / California zone 4 (ftUS)\",GEOGCS[\"NAD"
+        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",35.3333333333333],PARAM"
+        "ETER[\"central_meridian\",-119],PARAMETER[\"standard_par"
+        "allel_1\",37.25],PARAMETER[\"standard_parallel_2\",36],P"
+        "ARAMETER[\"false_easting\",6561666.667],PARAMETER[\"fals"
+        "e_northing\",1640416.667],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "228\"]]"},
+    {2229, "epsg", 2229,
         "NAD83 / California zone 5 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50");
-    add_proj4text (p, 2,
-        "0000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 5 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",33.5],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-118],PARAMETER[\"standard_parallel_1\",35");
-    add_srs_wkt (p, 9,
-        ".4666666666667],PARAMETER[\"standard_parallel_2\",34.033");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"false_easting\",6561666.667],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",1640416.667],UNIT[\"US survey ");
-    add_srs_wkt (p, 12,
-        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"2229\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2230, "epsg", 2230,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333"
+        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50"
+        "0000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=us-ft +no_defs",
+        "PROJCS[\"NAD83 / California zone 5 (ftUS)\",GEOGCS[\"NAD"
+        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",33.5],PARAMETER[\"centr"
+        "al_meridian\",-118],PARAMETER[\"standard_parallel_1\",35"
+        ".4666666666667],PARAMETER[\"standard_parallel_2\",34.033"
+        "3333333333],PARAMETER[\"false_easting\",6561666.667],PAR"
+        "AMETER[\"false_northing\",1640416.667],UNIT[\"US survey "
+        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"2229\"]]"},
+    {2230, "epsg", 2230,
         "NAD83 / California zone 6 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000");
-    add_proj4text (p, 2,
-        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California zone 6 (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",32.1666666666667],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-116.25],PARAMETER[\"standard_");
-    add_srs_wkt (p, 9,
-        "parallel_1\",33.8833333333333],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",32.7833333333333],PARAMETER[\"false_easting\",6");
-    add_srs_wkt (p, 11,
-        "561666.667],PARAMETER[\"false_northing\",1640416.667],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 14,
-        "ORTH],AUTHORITY[\"EPSG\",\"2230\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2231, "epsg", 2231,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333"
+        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000"
+        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / California zone 6 (ftUS)\",GEOGCS[\"NAD"
+        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",32.1666666666667],PARAM"
+        "ETER[\"central_meridian\",-116.25],PARAMETER[\"standard_"
+        "parallel_1\",33.8833333333333],PARAMETER[\"standard_para"
+        "llel_2\",32.7833333333333],PARAMETER[\"false_easting\",6"
+        "561666.667],PARAMETER[\"false_northing\",1640416.667],UN"
+        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG"
+        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"2230\"]]"},
+    {2231, "epsg", 2231,
         "NAD83 / Colorado North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Colorado North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",39.3333333333333],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-105.5],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",40.7833333333333],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",39.7166666666667],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",1000000],UNIT[\"US surv");
-    add_srs_wkt (p, 12,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"2231\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2232, "epsg", 2232,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666"
+        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8"
+        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Colorado North (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",39.3333333333333],PARAMETE"
+        "R[\"central_meridian\",-105.5],PARAMETER[\"standard_para"
+        "llel_1\",40.7833333333333],PARAMETER[\"standard_parallel"
+        "_2\",39.7166666666667],PARAMETER[\"false_easting\",30000"
+        "00],PARAMETER[\"false_northing\",1000000],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"2231\"]]"},
+    {2232, "epsg", 2232,
         "NAD83 / Colorado Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333");
-    add_proj4text (p, 1,
-        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60");
-    add_proj4text (p, 2,
-        "96012192 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Colorado Central (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",37.8333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-105.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",39.75],PARAMETER[\"standard_parallel_2\",38.");
-    add_srs_wkt (p, 10,
-        "45],PARAMETER[\"false_easting\",3000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",1000000],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 12,
-        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2232");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2233, "epsg", 2233,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333"
+        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60"
+        "96012192 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83 / Colorado Central (ftUS)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",37.8333333333333],PARAM"
+        "ETER[\"central_meridian\",-105.5],PARAMETER[\"standard_p"
+        "arallel_1\",39.75],PARAMETER[\"standard_parallel_2\",38."
+        "45],PARAMETER[\"false_easting\",3000000],PARAMETER[\"fal"
+        "se_northing\",1000000],UNIT[\"US survey foot\",0.3048006"
+        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2232"
+        "\"]]"},
+    {2233, "epsg", 2233,
         "NAD83 / Colorado South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Colorado South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",36.6666666666667],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-105.5],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",38.4333333333333],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",37.2333333333333],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",1000000],UNIT[\"US surv");
-    add_srs_wkt (p, 12,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"2233\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2234, "epsg", 2234,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333"
+        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8"
+        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Colorado South (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",36.6666666666667],PARAMETE"
+        "R[\"central_meridian\",-105.5],PARAMETER[\"standard_para"
+        "llel_1\",38.4333333333333],PARAMETER[\"standard_parallel"
+        "_2\",37.2333333333333],PARAMETER[\"false_easting\",30000"
+        "00],PARAMETER[\"false_northing\",1000000],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"2233\"]]"},
+    {2234, "epsg", 2234,
         "NAD83 / Connecticut (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40");
-    add_proj4text (p, 1,
-        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_");
-    add_proj4text (p, 2,
-        "0=152400.3048006096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 3,
-        "+units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Connecticut (ftUS)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",40.8333333333333],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-72.75],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",41.8666666666667],PARAMETER[\"standard_parallel_2");
-    add_srs_wkt (p, 10,
-        "\",41.2],PARAMETER[\"false_easting\",1000000],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",500000],UNIT[\"US survey foot\",0.304");
-    add_srs_wkt (p, 12,
-        "800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 13,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2234\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2235, "epsg", 2235,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40"
+        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_"
+        "0=152400.3048006096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Connecticut (ftUS)\",GEOGCS[\"NAD83\",D"
+        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",40.8333333333333],PARAMETER["
+        "\"central_meridian\",-72.75],PARAMETER[\"standard_parall"
+        "el_1\",41.8666666666667],PARAMETER[\"standard_parallel_2"
+        "\",41.2],PARAMETER[\"false_easting\",1000000],PARAMETER["
+        "\"false_northing\",500000],UNIT[\"US survey foot\",0.304"
+        "800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2234\"]]"},
+    {2235, "epsg", 2235,
         "NAD83 / Delaware (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Delaware (ftUS)\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",38],PARAMETER[\"central_meridian\",-75.4");
-    add_srs_wkt (p, 8,
-        "166666666667],PARAMETER[\"scale_factor\",0.999995],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",656166.667],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"US survey foot\",0.304800609601219,AUT");
-    add_srs_wkt (p, 11,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2235\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2236, "epsg", 2236,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999"
+        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Delaware (ftUS)\",GEOGCS[\"NAD83\",DATU"
+        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63"
+        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",38],PARAMETER[\"central_meridian\",-75.4"
+        "166666666667],PARAMETER[\"scale_factor\",0.999995],PARAM"
+        "ETER[\"false_easting\",656166.667],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"US survey foot\",0.304800609601219,AUT"
+        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2235\"]]"},
+    {2236, "epsg", 2236,
         "NAD83 / Florida East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Florida East (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",24.3333333333333],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-81],PARAMETER[\"scale_factor\",0.999941177");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",656166.667],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 11,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2236\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2237, "epsg", 2237,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999"
+        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Florida East (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",24.3333333333333],PARAMETER[\"centra"
+        "l_meridian\",-81],PARAMETER[\"scale_factor\",0.999941177"
+        "],PARAMETER[\"false_easting\",656166.667],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2236\"]]"},
+    {2237, "epsg", 2237,
         "NAD83 / Florida West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Florida West (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",24.3333333333333],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-82],PARAMETER[\"scale_factor\",0.999941177");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",656166.667],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 11,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2237\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2238, "epsg", 2238,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999"
+        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Florida West (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",24.3333333333333],PARAMETER[\"centra"
+        "l_meridian\",-82],PARAMETER[\"scale_factor\",0.999941177"
+        "],PARAMETER[\"false_easting\",656166.667],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2237\"]]"},
+    {2238, "epsg", 2238,
         "NAD83 / Florida North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2");
-    add_proj4text (p, 1,
-        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Florida North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",29],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",-84.5],PARAMETER[\"standard_parallel_1\",30.75]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_2\",29.5833333333333],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",1968500],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 11,
-        "hing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2238\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2239, "epsg", 2239,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2"
+        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Florida North (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",29],PARAMETER[\"central_me"
+        "ridian\",-84.5],PARAMETER[\"standard_parallel_1\",30.75]"
+        ",PARAMETER[\"standard_parallel_2\",29.5833333333333],PAR"
+        "AMETER[\"false_easting\",1968500],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2238\"]]"},
+    {2239, "epsg", 2239,
         "NAD83 / Georgia East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Georgia East (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",30],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "82.1666666666667],PARAMETER[\"scale_factor\",0.9999],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",656166.667],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2239\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2240, "epsg", 2240,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999"
+        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Georgia East (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",30],PARAMETER[\"central_meridian\",-"
+        "82.1666666666667],PARAMETER[\"scale_factor\",0.9999],PAR"
+        "AMETER[\"false_easting\",656166.667],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2239\"]]"},
+    {2240, "epsg", 2240,
         "NAD83 / Georgia West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Georgia West (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",30],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "84.1666666666667],PARAMETER[\"scale_factor\",0.9999],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",2296583.333],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 11,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2240\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2241, "epsg", 2241,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999"
+        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Georgia West (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",30],PARAMETER[\"central_meridian\",-"
+        "84.1666666666667],PARAMETER[\"scale_factor\",0.9999],PAR"
+        "AMETER[\"false_easting\",2296583.333],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2240\"]]"},
+    {2241, "epsg", 2241,
         "NAD83 / Idaho East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Idaho East (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",41.6666666666667],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-112.166666666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.999947368],PARAMETER[\"false_easting\",656166.667],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.");
-    add_srs_wkt (p, 11,
-        "304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 12,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2241\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2242, "epsg", 2242,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666"
+        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83 / Idaho East (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",41.6666666666667],PARAMETER[\"central"
+        "_meridian\",-112.166666666667],PARAMETER[\"scale_factor\""
+        ",0.999947368],PARAMETER[\"false_easting\",656166.667],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0."
+        "304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"2241\"]]"},
+    {2242, "epsg", 2242,
         "NAD83 / Idaho Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99");
-    add_proj4text (p, 1,
-        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Idaho Central (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",41.6666666666667],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-114],PARAMETER[\"scale_factor\",0.9999473");
-    add_srs_wkt (p, 9,
-        "68],PARAMETER[\"false_easting\",1640416.667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 11,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2242\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2243, "epsg", 2243,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99"
+        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8"
+        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Idaho Central (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",41.6666666666667],PARAMETER[\"centr"
+        "al_meridian\",-114],PARAMETER[\"scale_factor\",0.9999473"
+        "68],PARAMETER[\"false_easting\",1640416.667],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2242\"]"
+        "]"},
+    {2243, "epsg", 2243,
         "NAD83 / Idaho West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0");
-    add_proj4text (p, 1,
-        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Idaho West (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",41.6666666666667],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-115.75],PARAMETER[\"scale_factor\",0.999933");
-    add_srs_wkt (p, 9,
-        "333],PARAMETER[\"false_easting\",2624666.667],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 11,
-        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2243\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2244, "epsg", 2244,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0"
+        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +t"
+        "owgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Idaho West (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",41.6666666666667],PARAMETER[\"central"
+        "_meridian\",-115.75],PARAMETER[\"scale_factor\",0.999933"
+        "333],PARAMETER[\"false_easting\",2624666.667],PARAMETER["
+        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060"
+        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2243\""
+        "]]"},
+    {2244, "epsg", 2244,
         "NAD83 / Indiana East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249364.9987299975 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Indiana East (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",37.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-85.6666666666667],PARAMETER[\"scale_factor\",0.9999666");
-    add_srs_wkt (p, 9,
-        "67],PARAMETER[\"false_easting\",328083.333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",820208.333],UNIT[\"US survey foot\",0.3");
-    add_srs_wkt (p, 11,
-        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"2965\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2245, "epsg", 2245,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9"
+        "99966667 +x_0=99999.99989839978 +y_0=249364.9987299975 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Indiana East (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",37.5],PARAMETER[\"central_meridian\""
+        ",-85.6666666666667],PARAMETER[\"scale_factor\",0.9999666"
+        "67],PARAMETER[\"false_easting\",328083.333],PARAMETER[\""
+        "false_northing\",820208.333],UNIT[\"US survey foot\",0.3"
+        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"2965\"]]"},
+    {2245, "epsg", 2245,
         "NAD83 / Indiana West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249364.9987299975 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Indiana West (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",37.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-87.0833333333333],PARAMETER[\"scale_factor\",0.9999666");
-    add_srs_wkt (p, 9,
-        "67],PARAMETER[\"false_easting\",2952750],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",820208.333],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 11,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 13,
-        "966\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2246, "epsg", 2246,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9"
+        "99966667 +x_0=900000 +y_0=249364.9987299975 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Indiana West (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",37.5],PARAMETER[\"central_meridian\""
+        ",-87.0833333333333],PARAMETER[\"scale_factor\",0.9999666"
+        "67],PARAMETER[\"false_easting\",2952750],PARAMETER[\"fal"
+        "se_northing\",820208.333],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "966\"]]"},
+    {2246, "epsg", 2246,
         "NAD83 / Kentucky North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Kentucky North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",37.5],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-84.25],PARAMETER[\"standard_parallel_1\",37.");
-    add_srs_wkt (p, 9,
-        "9666666666667],PARAMETER[\"standard_parallel_2\",38.9666");
-    add_srs_wkt (p, 10,
-        "666666667],PARAMETER[\"false_easting\",1640416.667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 12,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2246\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2247, "epsg", 2247,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666"
+        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no"
+        "_defs",
+        "PROJCS[\"NAD83 / Kentucky North (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",37.5],PARAMETER[\"central_"
+        "meridian\",-84.25],PARAMETER[\"standard_parallel_1\",37."
+        "9666666666667],PARAMETER[\"standard_parallel_2\",38.9666"
+        "666666667],PARAMETER[\"false_easting\",1640416.667],PARA"
+        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2246\"]]"},
+    {2247, "epsg", 2247,
         "NAD83 / Kentucky South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Kentucky South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",36.3333333333333],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-85.75],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",37.9333333333333],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",36.7333333333333],PARAMETER[\"false_easting\",16404");
-    add_srs_wkt (p, 11,
-        "16.667],PARAMETER[\"false_northing\",1640416.667],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"2247\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2248, "epsg", 2248,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333"
+        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0"
+        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Kentucky South (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",36.3333333333333],PARAMETE"
+        "R[\"central_meridian\",-85.75],PARAMETER[\"standard_para"
+        "llel_1\",37.9333333333333],PARAMETER[\"standard_parallel"
+        "_2\",36.7333333333333],PARAMETER[\"false_easting\",16404"
+        "16.667],PARAMETER[\"false_northing\",1640416.667],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"2247\"]]"},
+    {2248, "epsg", 2248,
         "NAD83 / Maryland (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Maryland (ftUS)\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",37.6666666666667],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-77],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 9,
-        "39.45],PARAMETER[\"standard_parallel_2\",38.3],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",1312333.333],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 13,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2248\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2249, "epsg", 2249,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666"
+        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8"
+        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Maryland (ftUS)\",GEOGCS[\"NAD83\",DATU"
+        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63"
+        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER"
+        "[\"latitude_of_origin\",37.6666666666667],PARAMETER[\"ce"
+        "ntral_meridian\",-77],PARAMETER[\"standard_parallel_1\","
+        "39.45],PARAMETER[\"standard_parallel_2\",38.3],PARAMETER"
+        "[\"false_easting\",1312333.333],PARAMETER[\"false_northi"
+        "ng\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHOR"
+        "ITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2248\"]]"},
+    {2249, "epsg", 2249,
         "NAD83 / Massachusetts Mainland (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7");
-    add_proj4text (p, 2,
-        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Massachusetts Mainland (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",41],PARAMETER[\"cen");
-    add_srs_wkt (p, 8,
-        "tral_meridian\",-71.5],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",42.6833333333333],PARAMETER[\"standard_parallel_2\",41.");
-    add_srs_wkt (p, 10,
-        "7166666666667],PARAMETER[\"false_easting\",656166.667],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",2460625],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"2249\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2250, "epsg", 2250,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666"
+        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7"
+        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83 / Massachusetts Mainland (ftUS)\",GEOGCS["
+        "\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP"
+        "\"],PARAMETER[\"latitude_of_origin\",41],PARAMETER[\"cen"
+        "tral_meridian\",-71.5],PARAMETER[\"standard_parallel_1\""
+        ",42.6833333333333],PARAMETER[\"standard_parallel_2\",41."
+        "7166666666667],PARAMETER[\"false_easting\",656166.667],P"
+        "ARAMETER[\"false_northing\",2460625],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"2249\"]]"},
+    {2250, "epsg", 2250,
         "NAD83 / Massachusetts Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Massachusetts Island (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",41],PARAMETER[\"cen");
-    add_srs_wkt (p, 8,
-        "tral_meridian\",-70.5],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",41.4833333333333],PARAMETER[\"standard_parallel_2\",41.");
-    add_srs_wkt (p, 10,
-        "2833333333333],PARAMETER[\"false_easting\",1640416.667],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 12,
-        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"2250\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2251, "epsg", 2251,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333"
+        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83 / Massachusetts Island (ftUS)\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP"
+        "\"],PARAMETER[\"latitude_of_origin\",41],PARAMETER[\"cen"
+        "tral_meridian\",-70.5],PARAMETER[\"standard_parallel_1\""
+        ",41.4833333333333],PARAMETER[\"standard_parallel_2\",41."
+        "2833333333333],PARAMETER[\"false_easting\",1640416.667],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\","
+        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"2250\"]]"},
+    {2251, "epsg", 2251,
         "NAD83 / Michigan North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999");
-    add_proj4text (p, 2,
-        "968001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Michigan North (ft)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",44.7833333333333],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-87],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 9,
-        "1\",47.0833333333333],PARAMETER[\"standard_parallel_2\",");
-    add_srs_wkt (p, 10,
-        "45.4833333333333],PARAMETER[\"false_easting\",26246719.1");
-    add_srs_wkt (p, 11,
-        "6],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2251\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2252, "epsg", 2252,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333"
+        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999"
+        "968001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=ft +no_defs",
+        "PROJCS[\"NAD83 / Michigan North (ft)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",44.7833333333333],PARAMETER["
+        "\"central_meridian\",-87],PARAMETER[\"standard_parallel_"
+        "1\",47.0833333333333],PARAMETER[\"standard_parallel_2\","
+        "45.4833333333333],PARAMETER[\"false_easting\",26246719.1"
+        "6],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,"
+        "AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2251\"]]"},
+    {2252, "epsg", 2252,
         "NAD83 / Michigan Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9");
-    add_proj4text (p, 2,
-        "99976001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Michigan Central (ft)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",43.3166666666667],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-84.3666666666667],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_1\",45.7],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",44.1833333333333],PARAMETER[\"false_easting\",196850");
-    add_srs_wkt (p, 11,
-        "39.37],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3");
-    add_srs_wkt (p, 12,
-        "048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2252\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2253, "epsg", 2253,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43"
+        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9"
+        "99976001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=ft +no_defs",
+        "PROJCS[\"NAD83 / Michigan Central (ft)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",43.3166666666667],PARAMETE"
+        "R[\"central_meridian\",-84.3666666666667],PARAMETER[\"st"
+        "andard_parallel_1\",45.7],PARAMETER[\"standard_parallel_"
+        "2\",44.1833333333333],PARAMETER[\"false_easting\",196850"
+        "39.37],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3"
+        "048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2252\"]]"},
+    {2253, "epsg", 2253,
         "NAD83 / Michigan South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Michigan South (ft)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",41.5],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",-84.3666666666667],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 9,
-        "l_1\",43.6666666666667],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",42.1],PARAMETER[\"false_easting\",13123359.58],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2253\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2254, "epsg", 2254,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41"
+        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83 / Michigan South (ft)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",41.5],PARAMETER[\"central_me"
+        "ridian\",-84.3666666666667],PARAMETER[\"standard_paralle"
+        "l_1\",43.6666666666667],PARAMETER[\"standard_parallel_2\""
+        ",42.1],PARAMETER[\"false_easting\",13123359.58],PARAMETE"
+        "R[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\""
+        "EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"2253\"]]"},
+    {2254, "epsg", 2254,
         "NAD83 / Mississippi East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Mississippi East (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",29.5],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-88.8333333333333],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 9,
-        "995],PARAMETER[\"false_easting\",984250],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",0],UNIT[\"US survey foot\",0.3048006096012");
-    add_srs_wkt (p, 11,
-        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2254\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2255, "epsg", 2255,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9"
+        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Mississippi East (ftUS)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",29.5],PARAMETER[\"central_merid"
+        "ian\",-88.8333333333333],PARAMETER[\"scale_factor\",0.99"
+        "995],PARAMETER[\"false_easting\",984250],PARAMETER[\"fal"
+        "se_northing\",0],UNIT[\"US survey foot\",0.3048006096012"
+        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2254\"]]"},
+    {2255, "epsg", 2255,
         "NAD83 / Mississippi West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Mississippi West (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",29.5],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-90.3333333333333],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 9,
-        "995],PARAMETER[\"false_easting\",2296583.333],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 11,
-        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2255\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2256, "epsg", 2256,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9"
+        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Mississippi West (ftUS)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",29.5],PARAMETER[\"central_merid"
+        "ian\",-90.3333333333333],PARAMETER[\"scale_factor\",0.99"
+        "995],PARAMETER[\"false_easting\",2296583.333],PARAMETER["
+        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060"
+        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2255\""
+        "]]"},
+    {2256, "epsg", 2256,
         "NAD83 / Montana (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Montana (ft)\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",44.25],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-109.5],PARAMETER[\"standard_parallel_1\",49],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_2\",45],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",1968503.937],PARAMETER[\"false_northing\",0],UNIT[\"f");
-    add_srs_wkt (p, 11,
-        "oot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 12,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "2256\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2257, "epsg", 2257,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5"
+        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83 / Montana (ft)\",GEOGCS[\"NAD83\",DATUM[\""
+        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],"
+        "PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",44.25],PARAMETER[\"central_meridian"
+        "\",-109.5],PARAMETER[\"standard_parallel_1\",49],PARAMET"
+        "ER[\"standard_parallel_2\",45],PARAMETER[\"false_easting"
+        "\",1968503.937],PARAMETER[\"false_northing\",0],UNIT[\"f"
+        "oot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2256\"]]"},
+    {2257, "epsg", 2257,
         "NAD83 / New Mexico East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New Mexico East (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",31],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-104.333333333333],PARAMETER[\"scale_factor\",0.99990");
-    add_srs_wkt (p, 9,
-        "9091],PARAMETER[\"false_easting\",541337.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 11,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2257\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2258, "epsg", 2258,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999"
+        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New Mexico East (ftUS)\",GEOGCS[\"NAD83"
+        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",31],PARAMETER[\"central_meridian"
+        "\",-104.333333333333],PARAMETER[\"scale_factor\",0.99990"
+        "9091],PARAMETER[\"false_easting\",541337.5],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2257\"]"
+        "]"},
+    {2258, "epsg", 2258,
         "NAD83 / New Mexico Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00.0001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New Mexico Central (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",31],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 8,
-        "n\",-106.25],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",1640416.667],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"2258\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2259, "epsg", 2259,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000"
+        "00.0001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New Mexico Central (ftUS)\",GEOGCS[\"NA"
+        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",31],PARAMETER[\"central_meridia"
+        "n\",-106.25],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",1640416.667],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHO"
+        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"2258\"]]"},
+    {2259, "epsg", 2259,
         "NAD83 / New Mexico West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New Mexico West (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",31],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-107.833333333333],PARAMETER[\"scale_factor\",0.99991");
-    add_srs_wkt (p, 9,
-        "6667],PARAMETER[\"false_easting\",2723091.667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_northing\",0],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 11,
-        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2259");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2260, "epsg", 2260,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999"
+        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New Mexico West (ftUS)\",GEOGCS[\"NAD83"
+        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",31],PARAMETER[\"central_meridian"
+        "\",-107.833333333333],PARAMETER[\"scale_factor\",0.99991"
+        "6667],PARAMETER[\"false_easting\",2723091.667],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"US survey foot\",0.3048006"
+        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2259"
+        "\"]]"},
+    {2260, "epsg", 2260,
         "NAD83 / New York East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New York East (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",38.8333333333333],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-74.5],PARAMETER[\"scale_factor\",0.9999],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",492125],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"US survey foot\",0.304800609601219,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2260\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2261, "epsg", 2261,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New York East (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",38.8333333333333],PARAMETER[\"centr"
+        "al_meridian\",-74.5],PARAMETER[\"scale_factor\",0.9999],"
+        "PARAMETER[\"false_easting\",492125],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"US survey foot\",0.304800609601219,AU"
+        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2260\"]]"},
+    {2261, "epsg", 2261,
         "NAD83 / New York Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New York Central (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",40],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 8,
-        "n\",-76.5833333333333],PARAMETER[\"scale_factor\",0.9999");
-    add_srs_wkt (p, 9,
-        "375],PARAMETER[\"false_easting\",820208.333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 11,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2261\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2262, "epsg", 2262,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999"
+        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New York Central (ftUS)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",40],PARAMETER[\"central_meridia"
+        "n\",-76.5833333333333],PARAMETER[\"scale_factor\",0.9999"
+        "375],PARAMETER[\"false_easting\",820208.333],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2261\"]"
+        "]"},
+    {2262, "epsg", 2262,
         "NAD83 / New York West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New York West (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",40],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 8,
-        "-78.5833333333333],PARAMETER[\"scale_factor\",0.9999375]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",1148291.667],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 11,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2262\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2263, "epsg", 2263,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999"
+        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New York West (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",40],PARAMETER[\"central_meridian\","
+        "-78.5833333333333],PARAMETER[\"scale_factor\",0.9999375]"
+        ",PARAMETER[\"false_easting\",1148291.667],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2262\"]]"},
+    {2263, "epsg", 2263,
         "NAD83 / New York Long Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000");
-    add_proj4text (p, 2,
-        "000001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New York Long Island (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",40.1666666666667],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-74],PARAMETER[\"standard_");
-    add_srs_wkt (p, 9,
-        "parallel_1\",41.0333333333333],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",40.6666666666667],PARAMETER[\"false_easting\",9");
-    add_srs_wkt (p, 11,
-        "84250],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 12,
-        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"2263\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2264, "epsg", 2264,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666"
+        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000"
+        "000001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New York Long Island (ftUS)\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP"
+        "\"],PARAMETER[\"latitude_of_origin\",40.1666666666667],P"
+        "ARAMETER[\"central_meridian\",-74],PARAMETER[\"standard_"
+        "parallel_1\",41.0333333333333],PARAMETER[\"standard_para"
+        "llel_2\",40.6666666666667],PARAMETER[\"false_easting\",9"
+        "84250],PARAMETER[\"false_northing\",0],UNIT[\"US survey "
+        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"2263\"]]"},
+    {2264, "epsg", 2264,
         "NAD83 / North Carolina (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0=");
-    add_proj4text (p, 2,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / North Carolina (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",33.75],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-79],PARAMETER[\"standard_parallel_1\",36.16");
-    add_srs_wkt (p, 9,
-        "66666666667],PARAMETER[\"standard_parallel_2\",34.333333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"false_easting\",2000000],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 12,
-        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2264\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2265, "epsg", 2265,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333"
+        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d"
+        "efs",
+        "PROJCS[\"NAD83 / North Carolina (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",33.75],PARAMETER[\"central"
+        "_meridian\",-79],PARAMETER[\"standard_parallel_1\",36.16"
+        "66666666667],PARAMETER[\"standard_parallel_2\",34.333333"
+        "3333333],PARAMETER[\"false_easting\",2000000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060"
+        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2264\""
+        "]]"},
+    {2265, "epsg", 2265,
         "NAD83 / North Dakota North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / North Dakota North (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",47],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-100.5],PARAMETER[\"standard_parallel_1\",48");
-    add_srs_wkt (p, 9,
-        ".7333333333333],PARAMETER[\"standard_parallel_2\",47.433");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"false_easting\",1968503.937],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 13,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2265\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2266, "epsg", 2266,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333"
+        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83 / North Dakota North (ft)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",47],PARAMETER[\"central"
+        "_meridian\",-100.5],PARAMETER[\"standard_parallel_1\",48"
+        ".7333333333333],PARAMETER[\"standard_parallel_2\",47.433"
+        "3333333333],PARAMETER[\"false_easting\",1968503.937],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHOR"
+        "ITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2265\"]]"},
+    {2266, "epsg", 2266,
         "NAD83 / North Dakota South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9");
-    add_proj4text (p, 2,
-        "999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / North Dakota South (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",45.6666666666667],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-100.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",47.4833333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",46.1833333333333],PARAMETER[\"false_easting\",19");
-    add_srs_wkt (p, 11,
-        "68503.937],PARAMETER[\"false_northing\",0],UNIT[\"foot\"");
-    add_srs_wkt (p, 12,
-        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2266\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2267, "epsg", 2267,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333"
+        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9"
+        "999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=ft +no_defs",
+        "PROJCS[\"NAD83 / North Dakota South (ft)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",45.6666666666667],PARAM"
+        "ETER[\"central_meridian\",-100.5],PARAMETER[\"standard_p"
+        "arallel_1\",47.4833333333333],PARAMETER[\"standard_paral"
+        "lel_2\",46.1833333333333],PARAMETER[\"false_easting\",19"
+        "68503.937],PARAMETER[\"false_northing\",0],UNIT[\"foot\""
+        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2266\""
+        "]]"},
+    {2267, "epsg", 2267,
         "NAD83 / Oklahoma North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oklahoma North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",35],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",-98],PARAMETER[\"standard_parallel_1\",36.76666");
-    add_srs_wkt (p, 9,
-        "66666667],PARAMETER[\"standard_parallel_2\",35.566666666");
-    add_srs_wkt (p, 10,
-        "6667],PARAMETER[\"false_easting\",1968500],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 12,
-        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2267\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2268, "epsg", 2268,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666"
+        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Oklahoma North (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",35],PARAMETER[\"central_me"
+        "ridian\",-98],PARAMETER[\"standard_parallel_1\",36.76666"
+        "66666667],PARAMETER[\"standard_parallel_2\",35.566666666"
+        "6667],PARAMETER[\"false_easting\",1968500],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960"
+        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2267\"]]"},
+    {2268, "epsg", 2268,
         "NAD83 / Oklahoma South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oklahoma South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",33.3333333333333],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-98],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 9,
-        "l_1\",35.2333333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",33.9333333333333],PARAMETER[\"false_easting\",1968500],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 12,
-        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"2268\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2269, "epsg", 2269,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333"
+        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83 / Oklahoma South (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",33.3333333333333],PARAMETE"
+        "R[\"central_meridian\",-98],PARAMETER[\"standard_paralle"
+        "l_1\",35.2333333333333],PARAMETER[\"standard_parallel_2\""
+        ",33.9333333333333],PARAMETER[\"false_easting\",1968500],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\","
+        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"2268\"]]"},
+    {2269, "epsg", 2269,
         "NAD83 / Oregon North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oregon North (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",43.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-120.5],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",46],PARAMETER[\"standard_parallel_2\",44.3333333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"false_easting\",8202099.738],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2269\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2270, "epsg", 2270,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6"
+        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83 / Oregon North (ft)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",43.6666666666667],PARAMETER[\""
+        "central_meridian\",-120.5],PARAMETER[\"standard_parallel"
+        "_1\",46],PARAMETER[\"standard_parallel_2\",44.3333333333"
+        "333],PARAMETER[\"false_easting\",8202099.738],PARAMETER["
+        "\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"E"
+        "PSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"2269\"]]"},
+    {2270, "epsg", 2270,
         "NAD83 / Oregon South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oregon South (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",41.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-120.5],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",44],PARAMETER[\"standard_parallel_2\",42.3333333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"false_easting\",4921259.843],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2270\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2271, "epsg", 2271,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6"
+        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83 / Oregon South (ft)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",41.6666666666667],PARAMETER[\""
+        "central_meridian\",-120.5],PARAMETER[\"standard_parallel"
+        "_1\",44],PARAMETER[\"standard_parallel_2\",42.3333333333"
+        "333],PARAMETER[\"false_easting\",4921259.843],PARAMETER["
+        "\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"E"
+        "PSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"2270\"]]"},
+    {2271, "epsg", 2271,
         "NAD83 / Pennsylvania North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Pennsylvania North (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",40.1666666666667],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-77.75],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",41.95],PARAMETER[\"standard_parallel_2\",40.");
-    add_srs_wkt (p, 10,
-        "8833333333333],PARAMETER[\"false_easting\",1968500],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 12,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2271\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2272, "epsg", 2272,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4"
+        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Pennsylvania North (ftUS)\",GEOGCS[\"NA"
+        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",40.1666666666667],PARAM"
+        "ETER[\"central_meridian\",-77.75],PARAMETER[\"standard_p"
+        "arallel_1\",41.95],PARAMETER[\"standard_parallel_2\",40."
+        "8833333333333],PARAMETER[\"false_easting\",1968500],PARA"
+        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2271\"]]"},
+    {2272, "epsg", 2272,
         "NAD83 / Pennsylvania South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Pennsylvania South (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",39.3333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-77.75],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",40.9666666666667],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",39.9333333333333],PARAMETER[\"false_easting\",19");
-    add_srs_wkt (p, 11,
-        "68500],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 12,
-        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"2272\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2273, "epsg", 2273,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333"
+        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83 / Pennsylvania South (ftUS)\",GEOGCS[\"NA"
+        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",39.3333333333333],PARAM"
+        "ETER[\"central_meridian\",-77.75],PARAMETER[\"standard_p"
+        "arallel_1\",40.9666666666667],PARAMETER[\"standard_paral"
+        "lel_2\",39.9333333333333],PARAMETER[\"false_easting\",19"
+        "68500],PARAMETER[\"false_northing\",0],UNIT[\"US survey "
+        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"2272\"]]"},
+    {2273, "epsg", 2273,
         "NAD83 / South Carolina (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / South Carolina (ft)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",31.8333333333333],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-81],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 9,
-        "1\",34.8333333333333],PARAMETER[\"standard_parallel_2\",");
-    add_srs_wkt (p, 10,
-        "32.5],PARAMETER[\"false_easting\",2000000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"2273\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2274, "epsg", 2274,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31"
+        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83 / South Carolina (ft)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",31.8333333333333],PARAMETER["
+        "\"central_meridian\",-81],PARAMETER[\"standard_parallel_"
+        "1\",34.8333333333333],PARAMETER[\"standard_parallel_2\","
+        "32.5],PARAMETER[\"false_easting\",2000000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG"
+        "\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"2273\"]]"},
+    {2274, "epsg", 2274,
         "NAD83 / Tennessee (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Tennessee (ftUS)\",GEOGCS[\"NAD83\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"latitude_of_origin\",34.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-86],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",36.4166666666667],PARAMETER[\"standard_parallel_2\",35.");
-    add_srs_wkt (p, 10,
-        "25],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",0],UNIT[\"US survey foot\",0.3048006096012");
-    add_srs_wkt (p, 12,
-        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2274\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2275, "epsg", 2275,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3"
+        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Tennessee (ftUS)\",GEOGCS[\"NAD83\",DAT"
+        "UM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269"
+        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET"
+        "ER[\"latitude_of_origin\",34.3333333333333],PARAMETER[\""
+        "central_meridian\",-86],PARAMETER[\"standard_parallel_1\""
+        ",36.4166666666667],PARAMETER[\"standard_parallel_2\",35."
+        "25],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fal"
+        "se_northing\",0],UNIT[\"US survey foot\",0.3048006096012"
+        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2274\"]]"},
+    {2275, "epsg", 2275,
         "NAD83 / Texas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989");
-    add_proj4text (p, 2,
-        "83998 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas North (ftUS)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",34],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-101.5],PARAMETER[\"standard_parallel_1\",36.1833");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"standard_parallel_2\",34.65],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",656166.667],PARAMETER[\"false_no");
-    add_srs_wkt (p, 11,
-        "rthing\",3280833.333],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 12,
-        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2275\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2276, "epsg", 2276,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3"
+        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989"
+        "83998 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83 / Texas North (ftUS)\",GEOGCS[\"NAD83\",D"
+        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",34],PARAMETER[\"central_meri"
+        "dian\",-101.5],PARAMETER[\"standard_parallel_1\",36.1833"
+        "333333333],PARAMETER[\"standard_parallel_2\",34.65],PARA"
+        "METER[\"false_easting\",656166.667],PARAMETER[\"false_no"
+        "rthing\",3280833.333],UNIT[\"US survey foot\",0.30480060"
+        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2275\""
+        "]]"},
+    {2276, "epsg", 2276,
         "NAD83 / Texas North Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 3,
-        "units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas North Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",31.6666666666667],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-98.5],PARAMETER[\"standard_");
-    add_srs_wkt (p, 9,
-        "parallel_1\",33.9666666666667],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",32.1333333333333],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 11,
-        "968500],PARAMETER[\"false_northing\",6561666.667],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"2276\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2277, "epsg", 2277,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333"
+        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y"
+        "_0=2000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Texas North Central (ftUS)\",GEOGCS[\"N"
+        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",31.6666666666667],PAR"
+        "AMETER[\"central_meridian\",-98.5],PARAMETER[\"standard_"
+        "parallel_1\",33.9666666666667],PARAMETER[\"standard_para"
+        "llel_2\",32.1333333333333],PARAMETER[\"false_easting\",1"
+        "968500],PARAMETER[\"false_northing\",6561666.667],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"2276\"]]"},
+    {2277, "epsg", 2277,
         "NAD83 / Texas Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 3,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas Central (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",29.6666666666667],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-100.333333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_1\",31.8833333333333],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",30.1166666666667],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",2296583.333],PARAMETER[\"false_northing\",9842500]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2277\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2278, "epsg", 2278,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666"
+        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +"
+        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Texas Central (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",29.6666666666667],PARAMETE"
+        "R[\"central_meridian\",-100.333333333333],PARAMETER[\"st"
+        "andard_parallel_1\",31.8833333333333],PARAMETER[\"standa"
+        "rd_parallel_2\",30.1166666666667],PARAMETER[\"false_east"
+        "ing\",2296583.333],PARAMETER[\"false_northing\",9842500]"
+        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E"
+        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"2277\"]]"},
+    {2278, "epsg", 2278,
         "NAD83 / Texas South Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=3999999.9998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 3,
-        "its=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas South Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",27.8333333333333],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-99],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",30.2833333333333],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 10,
-        "el_2\",28.3833333333333],PARAMETER[\"false_easting\",196");
-    add_srs_wkt (p, 11,
-        "8500],PARAMETER[\"false_northing\",13123333.333],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"2278\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2279, "epsg", 2279,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333"
+        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0"
+        "=3999999.9998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un"
+        "its=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Texas South Central (ftUS)\",GEOGCS[\"N"
+        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",27.8333333333333],PAR"
+        "AMETER[\"central_meridian\",-99],PARAMETER[\"standard_pa"
+        "rallel_1\",30.2833333333333],PARAMETER[\"standard_parall"
+        "el_2\",28.3833333333333],PARAMETER[\"false_easting\",196"
+        "8500],PARAMETER[\"false_northing\",13123333.333],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"2278\"]]"},
+    {2279, "epsg", 2279,
         "NAD83 / Texas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00");
-    add_proj4text (p, 2,
-        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas South (ftUS)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",25.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-98.5],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 9,
-        "l_1\",27.8333333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",26.1666666666667],PARAMETER[\"false_easting\",984250],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",16404166.667],UNIT[\"US surv");
-    add_srs_wkt (p, 12,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"2279\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2280, "epsg", 2280,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666"
+        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00"
+        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Texas South (ftUS)\",GEOGCS[\"NAD83\",D"
+        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",25.6666666666667],PARAMETER["
+        "\"central_meridian\",-98.5],PARAMETER[\"standard_paralle"
+        "l_1\",27.8333333333333],PARAMETER[\"standard_parallel_2\""
+        ",26.1666666666667],PARAMETER[\"false_easting\",984250],P"
+        "ARAMETER[\"false_northing\",16404166.667],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"2279\"]]"},
+    {2280, "epsg", 2280,
         "NAD83 / Utah North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001504 +y_0=999999.9999960001 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah North (ft)\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",40.3333333333333],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-111.5],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 9,
-        "\",41.7833333333333],PARAMETER[\"standard_parallel_2\",4");
-    add_srs_wkt (p, 10,
-        "0.7166666666667],PARAMETER[\"false_easting\",1640419.948");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_northing\",3280839.895],UNIT[\"foot\"");
-    add_srs_wkt (p, 12,
-        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2280\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2281, "epsg", 2281,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0"
+        "001504 +y_0=999999.9999960001 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83 / Utah North (ft)\",GEOGCS[\"NAD83\",DATU"
+        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63"
+        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER"
+        "[\"latitude_of_origin\",40.3333333333333],PARAMETER[\"ce"
+        "ntral_meridian\",-111.5],PARAMETER[\"standard_parallel_1"
+        "\",41.7833333333333],PARAMETER[\"standard_parallel_2\",4"
+        "0.7166666666667],PARAMETER[\"false_easting\",1640419.948"
+        "],PARAMETER[\"false_northing\",3280839.895],UNIT[\"foot\""
+        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2280\""
+        "]]"},
+    {2281, "epsg", 2281,
         "NAD83 / Utah Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.0001504 +y_0=");
-    add_proj4text (p, 2,
-        "1999999.999992 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah Central (ft)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",38.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-111.5],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",40.65],PARAMETER[\"standard_parallel_2\",39.0166666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"false_easting\",1640419.948],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",6561679.79],UNIT[\"foot\",0.3048,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2281\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2282, "epsg", 2282,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000.0001504 +y_0="
+        "1999999.999992 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83 / Utah Central (ft)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",38.3333333333333],PARAMETER[\""
+        "central_meridian\",-111.5],PARAMETER[\"standard_parallel"
+        "_1\",40.65],PARAMETER[\"standard_parallel_2\",39.0166666"
+        "666667],PARAMETER[\"false_easting\",1640419.948],PARAMET"
+        "ER[\"false_northing\",6561679.79],UNIT[\"foot\",0.3048,A"
+        "UTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2281\"]]"},
+    {2282, "epsg", 2282,
         "NAD83 / Utah South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.0001504 +y_0=");
-    add_proj4text (p, 2,
-        "2999999.999988 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah South (ft)\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",36.6666666666667],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-111.5],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 9,
-        "\",38.35],PARAMETER[\"standard_parallel_2\",37.216666666");
-    add_srs_wkt (p, 10,
-        "6667],PARAMETER[\"false_easting\",1640419.948],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",9842519.685],UNIT[\"foot\",0.3048,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2282\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2283, "epsg", 2283,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000.0001504 +y_0="
+        "2999999.999988 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83 / Utah South (ft)\",GEOGCS[\"NAD83\",DATU"
+        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63"
+        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER"
+        "[\"latitude_of_origin\",36.6666666666667],PARAMETER[\"ce"
+        "ntral_meridian\",-111.5],PARAMETER[\"standard_parallel_1"
+        "\",38.35],PARAMETER[\"standard_parallel_2\",37.216666666"
+        "6667],PARAMETER[\"false_easting\",1640419.948],PARAMETER"
+        "[\"false_northing\",9842519.685],UNIT[\"foot\",0.3048,AU"
+        "THORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2282\"]]"},
+    {2283, "epsg", 2283,
         "NAD83 / Virginia North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2");
-    add_proj4text (p, 2,
-        "000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Virginia North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",37.6666666666667],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-78.5],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",39.2],PARAMETER[\"standard_parallel_2\",38.03333");
-    add_srs_wkt (p, 10,
-        "33333333],PARAMETER[\"false_easting\",11482916.667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",6561666.667],UNIT[\"US survey f");
-    add_srs_wkt (p, 12,
-        "oot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"2283\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2284, "epsg", 2284,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37"
+        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2"
+        "000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Virginia North (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",37.6666666666667],PARAMETE"
+        "R[\"central_meridian\",-78.5],PARAMETER[\"standard_paral"
+        "lel_1\",39.2],PARAMETER[\"standard_parallel_2\",38.03333"
+        "33333333],PARAMETER[\"false_easting\",11482916.667],PARA"
+        "METER[\"false_northing\",6561666.667],UNIT[\"US survey f"
+        "oot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"2283\"]]"},
+    {2284, "epsg", 2284,
         "NAD83 / Virginia South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0");
-    add_proj4text (p, 2,
-        "001016 +y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Virginia South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",36.3333333333333],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-78.5],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",37.9666666666667],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",36.7666666666667],PARAMETER[\"false_easting\",114829");
-    add_srs_wkt (p, 11,
-        "16.667],PARAMETER[\"false_northing\",3280833.333],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"2284\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2285, "epsg", 2285,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666"
+        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0"
+        "001016 +y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Virginia South (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",36.3333333333333],PARAMETE"
+        "R[\"central_meridian\",-78.5],PARAMETER[\"standard_paral"
+        "lel_1\",37.9666666666667],PARAMETER[\"standard_parallel_"
+        "2\",36.7666666666667],PARAMETER[\"false_easting\",114829"
+        "16.667],PARAMETER[\"false_northing\",3280833.333],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"2284\"]]"},
+    {2285, "epsg", 2285,
         "NAD83 / Washington North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Washington North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",47],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-120.833333333333],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",48.7333333333333],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",47.5],PARAMETER[\"false_easting\",1640416.667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 12,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2285\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2286, "epsg", 2286,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47"
+        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83 / Washington North (ftUS)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",47],PARAMETER[\"central"
+        "_meridian\",-120.833333333333],PARAMETER[\"standard_para"
+        "llel_1\",48.7333333333333],PARAMETER[\"standard_parallel"
+        "_2\",47.5],PARAMETER[\"false_easting\",1640416.667],PARA"
+        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2285\"]]"},
+    {2286, "epsg", 2286,
         "NAD83 / Washington South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 3,
-        "its=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Washington South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",45.3333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-120.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",47.3333333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",45.8333333333333],PARAMETER[\"false_easting\",16");
-    add_srs_wkt (p, 11,
-        "40416.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 12,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"2286\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2287, "epsg", 2287,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333"
+        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0"
+        "001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un"
+        "its=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Washington South (ftUS)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",45.3333333333333],PARAM"
+        "ETER[\"central_meridian\",-120.5],PARAMETER[\"standard_p"
+        "arallel_1\",47.3333333333333],PARAMETER[\"standard_paral"
+        "lel_2\",45.8333333333333],PARAMETER[\"false_easting\",16"
+        "40416.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2286\"]]"},
+    {2287, "epsg", 2287,
         "NAD83 / Wisconsin North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wisconsin North (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"latitude_of_origin\",45.1666666666667],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"central_meridian\",-90],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",46.7666666666667],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",45.5666666666667],PARAMETER[\"false_easting\",196850");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 12,
-        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"2287\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2288, "epsg", 2288,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666"
+        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83 / Wisconsin North (ftUS)\",GEOGCS[\"NAD83"
+        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],P"
+        "ARAMETER[\"latitude_of_origin\",45.1666666666667],PARAME"
+        "TER[\"central_meridian\",-90],PARAMETER[\"standard_paral"
+        "lel_1\",46.7666666666667],PARAMETER[\"standard_parallel_"
+        "2\",45.5666666666667],PARAMETER[\"false_easting\",196850"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot"
+        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"2287\"]]"},
+    {2288, "epsg", 2288,
         "NAD83 / Wisconsin Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wisconsin Central (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",43.8333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-90],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",45.5],PARAMETER[\"standard_parallel_2\",44.25],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2288\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2289, "epsg", 2289,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333"
+        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Wisconsin Central (ftUS)\",GEOGCS[\"NAD"
+        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",43.8333333333333],PARAM"
+        "ETER[\"central_meridian\",-90],PARAMETER[\"standard_para"
+        "llel_1\",45.5],PARAMETER[\"standard_parallel_2\",44.25],"
+        "PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2288\"]]"},
+    {2289, "epsg", 2289,
         "NAD83 / Wisconsin South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wisconsin South (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"latitude_of_origin\",42],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-90],PARAMETER[\"standard_parallel_1\",44.066");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"standard_parallel_2\",42.7333333");
-    add_srs_wkt (p, 10,
-        "333333],PARAMETER[\"false_easting\",1968500],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 12,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2289\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2290, "epsg", 2290,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333"
+        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Wisconsin South (ftUS)\",GEOGCS[\"NAD83"
+        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],P"
+        "ARAMETER[\"latitude_of_origin\",42],PARAMETER[\"central_"
+        "meridian\",-90],PARAMETER[\"standard_parallel_1\",44.066"
+        "6666666667],PARAMETER[\"standard_parallel_2\",42.7333333"
+        "333333],PARAMETER[\"false_easting\",1968500],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2289\"]"
+        "]"},
+    {2290, "epsg", 2290,
         "ATS77 / Prince Edward Isl. Stereographic (ATS77)", 0, 0,
         "Average Terrestrial System 1977", "Greenwich",
         "Average_Terrestrial_System_1977", "Oblique_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=70");
-    add_proj4text (p, 1,
-        "0000 +y_0=400000 +a=6378135 +b=6356750.304921594 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / Prince Edward Isl. Stereographic (ATS77");
-    add_srs_wkt (p, 1,
-        ")\",GEOGCS[\"ATS77\",DATUM[\"Average_Terrestrial_System_");
-    add_srs_wkt (p, 2,
-        "1977\",SPHEROID[\"Average Terrestrial System 1977\",6378");
-    add_srs_wkt (p, 3,
-        "135,298.257,AUTHORITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6122\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4122\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",47.25],PARAMETER[\"central_meridian\",-63],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.999912],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",700000],PARAMETER[\"false_northing\",400000],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 13,
-        "290\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2291, "epsg", 2291,
+        "Easting", "East", "Northing", "North",
+        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=70"
+        "0000 +y_0=400000 +a=6378135 +b=6356750.304921594 +units="
+        "m +no_defs",
+        "PROJCS[\"ATS77 / Prince Edward Isl. Stereographic (ATS77"
+        ")\",GEOGCS[\"ATS77\",DATUM[\"Average_Terrestrial_System_"
+        "1977\",SPHEROID[\"Average Terrestrial System 1977\",6378"
+        "135,298.257,AUTHORITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EP"
+        "SG\",\"6122\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4122\"]],PROJE"
+        "CTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude_of"
+        "_origin\",47.25],PARAMETER[\"central_meridian\",-63],PAR"
+        "AMETER[\"scale_factor\",0.999912],PARAMETER[\"false_east"
+        "ing\",700000],PARAMETER[\"false_northing\",400000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "290\"]]"},
+    {2291, "epsg", 2291,
         "NAD83(CSRS98) / Prince Edward Isl. Stereographic (NAD83) (deprecated)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Oblique_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40");
-    add_proj4text (p, 1,
-        "0000 +y_0=800000 +a=6378135 +b=6356750.304921594 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS98) / Prince Edward Isl. Stereographi");
-    add_srs_wkt (p, 1,
-        "c (NAD83) (deprecated)\",GEOGCS[\"NAD83(CSRS98) (depreca");
-    add_srs_wkt (p, 2,
-        "ted)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\"");
-    add_srs_wkt (p, 3,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 5,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 6,
-        "e minute second hemisphere\",0.0174532925199433,AUTHORIT");
-    add_srs_wkt (p, 7,
-        "Y[\"EPSG\",\"9108\"]],AUTHORITY[\"EPSG\",\"4140\"]],PROJ");
-    add_srs_wkt (p, 8,
-        "ECTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 9,
-        "f_origin\",47.25],PARAMETER[\"central_meridian\",-63],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.999912],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",400000],PARAMETER[\"false_northing\",800000],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 13,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2292\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2292, "epsg", 2292,
+        "Easting", "East", "Northing", "North",
+        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40"
+        "0000 +y_0=800000 +a=6378135 +b=6356750.304921594 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(CSRS98) / Prince Edward Isl. Stereographi"
+        "c (NAD83) (deprecated)\",GEOGCS[\"NAD83(CSRS98) (depreca"
+        "ted)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e minute second hemisphere\",0.0174532925199433,AUTHORIT"
+        "Y[\"EPSG\",\"9108\"]],AUTHORITY[\"EPSG\",\"4140\"]],PROJ"
+        "ECTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude_o"
+        "f_origin\",47.25],PARAMETER[\"central_meridian\",-63],PA"
+        "RAMETER[\"scale_factor\",0.999912],PARAMETER[\"false_eas"
+        "ting\",400000],PARAMETER[\"false_northing\",800000],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2292\"]]"},
+    {2292, "epsg", 2292,
         "NAD83(CSRS) / Prince Edward Isl. Stereographic (NAD83)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Oblique_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40");
-    add_proj4text (p, 1,
-        "0000 +y_0=800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Prince Edward Isl. Stereographic ");
-    add_srs_wkt (p, 1,
-        "(NAD83)\",GEOGCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_");
-    add_srs_wkt (p, 2,
-        "Spatial_Reference_System\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",47.25],PARAMETER[\"central_meridian\",-63],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",0.999912],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",400000],PARAMETER[\"false_northing\",800000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"2954\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2294, "epsg", 2294,
+        "Easting", "East", "Northing", "North",
+        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40"
+        "0000 +y_0=800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un"
+        "its=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Prince Edward Isl. Stereographic "
+        "(NAD83)\",GEOGCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_"
+        "Spatial_Reference_System\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PR"
+        "OJECTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude"
+        "_of_origin\",47.25],PARAMETER[\"central_meridian\",-63],"
+        "PARAMETER[\"scale_factor\",0.999912],PARAMETER[\"false_e"
+        "asting\",400000],PARAMETER[\"false_northing\",800000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"2954\"]]"},
+    {2294, "epsg", 2294,
         "ATS77 / MTM Nova Scotia zone 4", 0, 0,
         "Average Terrestrial System 1977", "Greenwich",
         "Average_Terrestrial_System_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-61.5 +k=0.9999 +x_0=4500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +a=6378135 +b=6356750.304921594 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / MTM Nova Scotia zone 4\",GEOGCS[\"ATS77");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Average_Terrestrial_System_1977\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Average Terrestrial System 1977\",6378135,298.257,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-61.5],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",4500000],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"2294\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2295, "epsg", 2295,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-61.5 +k=0.9999 +x_0=4500000"
+        " +y_0=0 +a=6378135 +b=6356750.304921594 +units=m +no_def"
+        "s",
+        "PROJCS[\"ATS77 / MTM Nova Scotia zone 4\",GEOGCS[\"ATS77"
+        "\",DATUM[\"Average_Terrestrial_System_1977\",SPHEROID[\""
+        "Average Terrestrial System 1977\",6378135,298.257,AUTHOR"
+        "ITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET"
+        "ER[\"central_meridian\",-61.5],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",4500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"2294\"]]"},
+    {2295, "epsg", 2295,
         "ATS77 / MTM Nova Scotia zone 5", 0, 0,
         "Average Terrestrial System 1977", "Greenwich",
         "Average_Terrestrial_System_1977", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-64.5 +k=0.9999 +x_0=5500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +a=6378135 +b=6356750.304921594 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ATS77 / MTM Nova Scotia zone 5\",GEOGCS[\"ATS77");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Average_Terrestrial_System_1977\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Average Terrestrial System 1977\",6378135,298.257,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-64.5],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",5500000],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"2295\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2308, "epsg", 2308,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-64.5 +k=0.9999 +x_0=5500000"
+        " +y_0=0 +a=6378135 +b=6356750.304921594 +units=m +no_def"
+        "s",
+        "PROJCS[\"ATS77 / MTM Nova Scotia zone 5\",GEOGCS[\"ATS77"
+        "\",DATUM[\"Average_Terrestrial_System_1977\",SPHEROID[\""
+        "Average Terrestrial System 1977\",6378135,298.257,AUTHOR"
+        "ITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\",\"6122\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4122\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET"
+        "ER[\"central_meridian\",-64.5],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",5500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"2295\"]]"},
+    {2308, "epsg", 2308,
         "Batavia / TM 109 SE", 0, 0,
         "Bessel 1841", "Greenwich",
         "Batavia", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=109 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=10000000 +ellps=bessel +towgs84=-377,681,-50,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Batavia / TM 109 SE\",GEOGCS[\"Batavia\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"Batavia\",SPHEROID[\"Bessel 1841\",6377397.155,299.152");
-    add_srs_wkt (p, 2,
-        "8128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6211\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4211\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",109],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 10,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2308\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2309, "epsg", 2309,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=109 +k=0.9996 +x_0=500000 +y"
+        "_0=10000000 +ellps=bessel +towgs84=-377,681,-50,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"Batavia / TM 109 SE\",GEOGCS[\"Batavia\",DATUM["
+        "\"Batavia\",SPHEROID[\"Bessel 1841\",6377397.155,299.152"
+        "8128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\""
+        "6211\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4211\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",109],PARAMETER[\"scal"
+        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2308\"]]"},
+    {2309, "epsg", 2309,
         "WGS 84 / TM 116 SE", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=116 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=10000000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / TM 116 SE\",GEOGCS[\"WGS 84\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",116],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 8,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2309\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2310, "epsg", 2310,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=116 +k=0.9996 +x_0=500000 +y"
+        "_0=10000000 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / TM 116 SE\",GEOGCS[\"WGS 84\",DATUM[\""
+        "WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT"
+        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",116],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2309\"]]"},
+    {2310, "epsg", 2310,
         "WGS 84 / TM 132 SE", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=10000000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / TM 132 SE\",GEOGCS[\"WGS 84\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",132],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 8,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2310\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2311, "epsg", 2311,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=132 +k=0.9996 +x_0=500000 +y"
+        "_0=10000000 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / TM 132 SE\",GEOGCS[\"WGS 84\",DATUM[\""
+        "WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT"
+        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",132],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2310\"]]"},
+    {2311, "epsg", 2311,
         "WGS 84 / TM 6 NE", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=6 +k=0.9996 +x_0=500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / TM 6 NE\",GEOGCS[\"WGS 84\",DATUM[\"WG");
-    add_srs_wkt (p, 1,
-        "S_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]],P");
-    add_srs_wkt (p, 3,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 4,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 5,
-        "\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 6,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"central_meridian\",6],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 8,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 11,
-        "H],AUTHORITY[\"EPSG\",\"2311\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2312, "epsg", 2312,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=6 +k=0.9996 +x_0=500000 +y_0"
+        "=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / TM 6 NE\",GEOGCS[\"WGS 84\",DATUM[\"WG"
+        "S_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHO"
+        "RITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transver"
+        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAM"
+        "ETER[\"central_meridian\",6],PARAMETER[\"scale_factor\","
+        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"2311\"]]"},
+    {2312, "epsg", 2312,
         "Garoua / UTM zone 33N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Garoua", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Garoua / UTM zone 33N\",GEOGCS[\"Garoua\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Garoua\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,2");
-    add_srs_wkt (p, 2,
-        "93.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6197\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4197\"]],PROJECTIO");
-    add_srs_wkt (p, 6,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 7,
-        "n\",0],PARAMETER[\"central_meridian\",15],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2312\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2313, "epsg", 2313,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"Garoua / UTM zone 33N\",GEOGCS[\"Garoua\",DATUM"
+        "[\"Garoua\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,2"
+        "93.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\","
+        "\"6197\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4197\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",0],PARAMETER[\"central_meridian\",15],PARAMETER[\"sc"
+        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2312\"]]"},
+    {2313, "epsg", 2313,
         "Kousseri / UTM zone 33N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Kousseri", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Kousseri / UTM zone 33N\",GEOGCS[\"Kousseri\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Kousseri\",SPHEROID[\"Clarke 1880 (RGS)\",6378249");
-    add_srs_wkt (p, 2,
-        ".145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6198\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4198\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",15],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 9,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 10,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2313\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2314, "epsg", 2314,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"Kousseri / UTM zone 33N\",GEOGCS[\"Kousseri\",D"
+        "ATUM[\"Kousseri\",SPHEROID[\"Clarke 1880 (RGS)\",6378249"
+        ".145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"E"
+        "PSG\",\"6198\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4198\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",15],PARAMETE"
+        "R[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",5"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2313\"]]"},
+    {2314, "epsg", 2314,
         "Trinidad 1903 / Trinidad Grid (ftCla)", 0, 0,
         "Clarke 1858", "Greenwich",
         "Trinidad_1903", "Cassini_Soldner", "Clarke's foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=10.44166666666667 +lon_0=-61.333333333");
-    add_proj4text (p, 1,
-        "33334 +x_0=86501.46392052001 +y_0=65379.0134283 +a=63782");
-    add_proj4text (p, 2,
-        "93.645208759 +b=6356617.987679838 +towgs84=-61.702,284.4");
-    add_proj4text (p, 3,
-        "88,472.052,0,0,0,0 +to_meter=0.3047972654 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Trinidad 1903 / Trinidad Grid (ftCla)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Trinidad 1903\",DATUM[\"Trinidad_1903\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1858\",6378293.64520876,294.260676369261,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"6302\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4302\"]],PROJECTION[\"Cassini_Soldner\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",10.4416666666667],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-61.3333333333333],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",283800],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "214500],UNIT[\"Clarke's foot\",0.3047972654,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9005\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2314\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2315, "epsg", 2315,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=10.44166666666667 +lon_0=-61.333333333"
+        "33334 +x_0=86501.46392052001 +y_0=65379.0134283 +a=63782"
+        "93.645208759 +b=6356617.987679838 +towgs84=-61.702,284.4"
+        "88,472.052,0,0,0,0 +to_meter=0.3047972654 +no_defs",
+        "PROJCS[\"Trinidad 1903 / Trinidad Grid (ftCla)\",GEOGCS["
+        "\"Trinidad 1903\",DATUM[\"Trinidad_1903\",SPHEROID[\"Cla"
+        "rke 1858\",6378293.64520876,294.260676369261,AUTHORITY[\""
+        "EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"6302\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4302\"]],PROJECTION[\"Cassini_Soldner\""
+        "],PARAMETER[\"latitude_of_origin\",10.4416666666667],PAR"
+        "AMETER[\"central_meridian\",-61.3333333333333],PARAMETER"
+        "[\"false_easting\",283800],PARAMETER[\"false_northing\","
+        "214500],UNIT[\"Clarke's foot\",0.3047972654,AUTHORITY[\""
+        "EPSG\",\"9005\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"2314\"]]"},
+    {2315, "epsg", 2315,
         "Campo Inchauspe / UTM zone 19S", 0, 0,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=intl +towgs84=-148,136,");
-    add_proj4text (p, 1,
-        "90,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / UTM zone 19S\",GEOGCS[\"Campo");
-    add_srs_wkt (p, 1,
-        " Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-69],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",100000");
-    add_srs_wkt (p, 10,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"2315\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2316, "epsg", 2316,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=intl +towgs84=-148,136,"
+        "90,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Campo Inchauspe / UTM zone 19S\",GEOGCS[\"Campo"
+        " Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Intern"
+        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]"
+        ",AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-69],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",100000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"2315\"]]"},
+    {2316, "epsg", 2316,
         "Campo Inchauspe / UTM zone 20S", 0, 0,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +south +ellps=intl +towgs84=-148,136,");
-    add_proj4text (p, 1,
-        "90,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / UTM zone 20S\",GEOGCS[\"Campo");
-    add_srs_wkt (p, 1,
-        " Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",100000");
-    add_srs_wkt (p, 10,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"2316\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2317, "epsg", 2317,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +south +ellps=intl +towgs84=-148,136,"
+        "90,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Campo Inchauspe / UTM zone 20S\",GEOGCS[\"Campo"
+        " Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Intern"
+        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]"
+        ",AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",100000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"2316\"]]"},
+    {2317, "epsg", 2317,
         "PSAD56 / ICN Regional", 0, 0,
         "International 1924", "Greenwich",
         "Provisional_South_American_Datum_1956", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=9 +lat_2=3 +lat_0=6 +lon_0=-66 +x_0=100");
-    add_proj4text (p, 1,
-        "0000 +y_0=1000000 +ellps=intl +towgs84=-288,175,-376,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PSAD56 / ICN Regional\",GEOGCS[\"PSAD56\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Provisional_South_American_Datum_1956\",SPHEROID[\"In");
-    add_srs_wkt (p, 2,
-        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6248\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4248\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",6],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-66],PARAMETER[\"standard_parallel_1\",9],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_2\",3],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",1000000],PARAMETER[\"false_northing\",1000000],U");
-    add_srs_wkt (p, 11,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 12,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"2317\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2318, "epsg", 2318,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=9 +lat_2=3 +lat_0=6 +lon_0=-66 +x_0=100"
+        "0000 +y_0=1000000 +ellps=intl +towgs84=-288,175,-376,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"PSAD56 / ICN Regional\",GEOGCS[\"PSAD56\",DATUM"
+        "[\"Provisional_South_American_Datum_1956\",SPHEROID[\"In"
+        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022"
+        "\"]],AUTHORITY[\"EPSG\",\"6248\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4248\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",6],PARAMETER[\"centra"
+        "l_meridian\",-66],PARAMETER[\"standard_parallel_1\",9],P"
+        "ARAMETER[\"standard_parallel_2\",3],PARAMETER[\"false_ea"
+        "sting\",1000000],PARAMETER[\"false_northing\",1000000],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"2317\"]]"},
+    {2318, "epsg", 2318,
         "Ain el Abd / Aramco Lambert", 0, 0,
         "International 1924", "Greenwich",
         "Ain_el_Abd_1970", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=17 +lat_2=33 +lat_0=25.08951 +lon_0=48 ");
-    add_proj4text (p, 1,
-        "+x_0=0 +y_0=0 +ellps=intl +towgs84=-143,-236,7,0,0,0,0 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ain el Abd / Aramco Lambert\",GEOGCS[\"Ain el A");
-    add_srs_wkt (p, 1,
-        "bd\",DATUM[\"Ain_el_Abd_1970\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6204\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4204\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",25.08951],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",48],PARAMETER[\"standard_parallel_1\",17],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_2\",33],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2318\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2319, "epsg", 2319,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=17 +lat_2=33 +lat_0=25.08951 +lon_0=48 "
+        "+x_0=0 +y_0=0 +ellps=intl +towgs84=-143,-236,7,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Ain el Abd / Aramco Lambert\",GEOGCS[\"Ain el A"
+        "bd\",DATUM[\"Ain_el_Abd_1970\",SPHEROID[\"International "
+        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI"
+        "TY[\"EPSG\",\"6204\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4204\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER"
+        "[\"latitude_of_origin\",25.08951],PARAMETER[\"central_me"
+        "ridian\",48],PARAMETER[\"standard_parallel_1\",17],PARAM"
+        "ETER[\"standard_parallel_2\",33],PARAMETER[\"false_easti"
+        "ng\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2318\"]]"},
+    {2319, "epsg", 2319,
         "ED50 / TM27", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM27\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",27],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 8,
-        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AUTHORITY[\"EPSG\",\"2319\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2320, "epsg", 2320,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"ED50 / TM27\",GEOGCS[\"ED50\",DATUM[\"European_"
+        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297"
+        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",27],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"2319\"]]"},
+    {2320, "epsg", 2320,
         "ED50 / TM30", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM30\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",30],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 8,
-        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AUTHORITY[\"EPSG\",\"2320\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2321, "epsg", 2321,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"ED50 / TM30\",GEOGCS[\"ED50\",DATUM[\"European_"
+        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297"
+        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",30],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"2320\"]]"},
+    {2321, "epsg", 2321,
         "ED50 / TM33", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM33\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",33],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 8,
-        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AUTHORITY[\"EPSG\",\"2321\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2322, "epsg", 2322,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"ED50 / TM33\",GEOGCS[\"ED50\",DATUM[\"European_"
+        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297"
+        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",33],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"2321\"]]"},
+    {2322, "epsg", 2322,
         "ED50 / TM36", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM36\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",36],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 8,
-        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AUTHORITY[\"EPSG\",\"2322\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2323, "epsg", 2323,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"ED50 / TM36\",GEOGCS[\"ED50\",DATUM[\"European_"
+        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297"
+        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",36],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"2322\"]]"},
+    {2323, "epsg", 2323,
         "ED50 / TM39", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM39\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",39],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 8,
-        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AUTHORITY[\"EPSG\",\"2323\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2324, "epsg", 2324,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"ED50 / TM39\",GEOGCS[\"ED50\",DATUM[\"European_"
+        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297"
+        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",39],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"2323\"]]"},
+    {2324, "epsg", 2324,
         "ED50 / TM42", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM42\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",42],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 8,
-        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AUTHORITY[\"EPSG\",\"2324\"]]");
-}
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"ED50 / TM42\",GEOGCS[\"ED50\",DATUM[\"European_"
+        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297"
+        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",42],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"2324\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_02 = {
+    epsg_defs_02, sizeof (epsg_defs_02) / sizeof (epsg_defs_02[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
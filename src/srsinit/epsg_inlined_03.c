@@ -53,3489 +53,2003 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_03 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2325, "epsg", 2325,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_03[] = {
+    {2325, "epsg", 2325,
         "ED50 / TM45", 0, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM45\",GEOGCS[\"ED50\",DATUM[\"European_");
-    add_srs_wkt (p, 1,
-        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",45],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 8,
-        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AUTHORITY[\"EPSG\",\"2325\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2326, "epsg", 2326,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"ED50 / TM45\",GEOGCS[\"ED50\",DATUM[\"European_"
+        "Datum_1950\",SPHEROID[\"International 1924\",6378388,297"
+        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6230"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",45],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"2325\"]]"},
+    {2326, "epsg", 2326,
         "Hong Kong 1980 Grid System", 0, 1,
         "International 1924", "Greenwich",
         "Hong_Kong_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=22.31213333333334 +lon_0=114.17855555");
-    add_proj4text (p, 1,
-        "55556 +k=1 +x_0=836694.05 +y_0=819069.8 +ellps=intl +tow");
-    add_proj4text (p, 2,
-        "gs84=-162.619,-276.959,-161.764,0.067753,-2.243649,-1.15");
-    add_proj4text (p, 3,
-        "8827,-1.094246 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hong Kong 1980 Grid System\",GEOGCS[\"Hong Kong");
-    add_srs_wkt (p, 1,
-        " 1980\",DATUM[\"Hong_Kong_1980\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6611\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4611");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",22.3121333333333],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",114.178555555556],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "1],PARAMETER[\"false_easting\",836694.05],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",819069.8],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AUTHORITY[\"EPSG\",\"2326\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2327, "epsg", 2327,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=22.31213333333334 +lon_0=114.17855555"
+        "55556 +k=1 +x_0=836694.05 +y_0=819069.8 +ellps=intl +tow"
+        "gs84=-162.619,-276.959,-161.764,0.067753,-2.243649,-1.15"
+        "8827,-1.094246 +units=m +no_defs",
+        "PROJCS[\"Hong Kong 1980 Grid System\",GEOGCS[\"Hong Kong"
+        " 1980\",DATUM[\"Hong_Kong_1980\",SPHEROID[\"Internationa"
+        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO"
+        "RITY[\"EPSG\",\"6611\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4611"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",22.3121333333333],PARAMETER[\"central_"
+        "meridian\",114.178555555556],PARAMETER[\"scale_factor\","
+        "1],PARAMETER[\"false_easting\",836694.05],PARAMETER[\"fa"
+        "lse_northing\",819069.8],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\""
+        ",EAST],AUTHORITY[\"EPSG\",\"2326\"]]"},
+    {2327, "epsg", 2327,
         "Xian 1980 / Gauss-Kruger zone 13", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=13500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 13\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",75],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",13500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2327\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2328, "epsg", 2328,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=13500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 13\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",75],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",13500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2327\"]]"},
+    {2328, "epsg", 2328,
         "Xian 1980 / Gauss-Kruger zone 14", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=14500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 14\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",81],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",14500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2328\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2329, "epsg", 2329,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=14500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 14\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",81],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",14500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2328\"]]"},
+    {2329, "epsg", 2329,
         "Xian 1980 / Gauss-Kruger zone 15", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=15500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 15\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",87],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",15500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2329\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2330, "epsg", 2330,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=15500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 15\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",87],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",15500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2329\"]]"},
+    {2330, "epsg", 2330,
         "Xian 1980 / Gauss-Kruger zone 16", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=16500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 16\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",93],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",16500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2330\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2331, "epsg", 2331,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=16500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 16\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",93],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",16500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2330\"]]"},
+    {2331, "epsg", 2331,
         "Xian 1980 / Gauss-Kruger zone 17", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=17500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 17\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",99],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",17500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2331\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2332, "epsg", 2332,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=17500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 17\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",99],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",17500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2331\"]]"},
+    {2332, "epsg", 2332,
         "Xian 1980 / Gauss-Kruger zone 18", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=18500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 18\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",105],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",1850000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2332\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2333, "epsg", 2333,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=18500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 18\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",105],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",1850000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2332\"]]"},
+    {2333, "epsg", 2333,
         "Xian 1980 / Gauss-Kruger zone 19", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=19500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 19\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",111],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",1950000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2333\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2334, "epsg", 2334,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=19500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 19\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",111],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",1950000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2333\"]]"},
+    {2334, "epsg", 2334,
         "Xian 1980 / Gauss-Kruger zone 20", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=20500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 20\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",117],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",2050000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2334\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2335, "epsg", 2335,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=20500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 20\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",117],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",2050000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2334\"]]"},
+    {2335, "epsg", 2335,
         "Xian 1980 / Gauss-Kruger zone 21", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=21500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 21\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",123],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",2150000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2335\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2336, "epsg", 2336,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=21500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 21\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",123],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",2150000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2335\"]]"},
+    {2336, "epsg", 2336,
         "Xian 1980 / Gauss-Kruger zone 22", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=22500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 22\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",129],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",2250000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2336\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2337, "epsg", 2337,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=22500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 22\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",129],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",2250000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2336\"]]"},
+    {2337, "epsg", 2337,
         "Xian 1980 / Gauss-Kruger zone 23", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=23500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 23\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",135],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",2350000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2337\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2338, "epsg", 2338,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=23500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger zone 23\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",135],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",2350000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2337\"]]"},
+    {2338, "epsg", 2338,
         "Xian 1980 / Gauss-Kruger CM 75E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 75E\",GEOGCS[\"Xian");
-    add_srs_wkt (p, 1,
-        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814");
-    add_srs_wkt (p, 2,
-        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",75],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AUTHORITY[\"EPSG\",\"2338\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2339, "epsg", 2339,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 75E\",GEOGCS[\"Xian"
+        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814"
+        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG"
+        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",75],PARAMETER[\""
+        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas"
+        "ting\",EAST],AUTHORITY[\"EPSG\",\"2338\"]]"},
+    {2339, "epsg", 2339,
         "Xian 1980 / Gauss-Kruger CM 81E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 81E\",GEOGCS[\"Xian");
-    add_srs_wkt (p, 1,
-        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814");
-    add_srs_wkt (p, 2,
-        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",81],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AUTHORITY[\"EPSG\",\"2339\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2340, "epsg", 2340,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 81E\",GEOGCS[\"Xian"
+        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814"
+        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG"
+        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",81],PARAMETER[\""
+        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas"
+        "ting\",EAST],AUTHORITY[\"EPSG\",\"2339\"]]"},
+    {2340, "epsg", 2340,
         "Xian 1980 / Gauss-Kruger CM 87E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 87E\",GEOGCS[\"Xian");
-    add_srs_wkt (p, 1,
-        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814");
-    add_srs_wkt (p, 2,
-        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",87],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AUTHORITY[\"EPSG\",\"2340\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2341, "epsg", 2341,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 87E\",GEOGCS[\"Xian"
+        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814"
+        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG"
+        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",87],PARAMETER[\""
+        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas"
+        "ting\",EAST],AUTHORITY[\"EPSG\",\"2340\"]]"},
+    {2341, "epsg", 2341,
         "Xian 1980 / Gauss-Kruger CM 93E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 93E\",GEOGCS[\"Xian");
-    add_srs_wkt (p, 1,
-        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814");
-    add_srs_wkt (p, 2,
-        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",93],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AUTHORITY[\"EPSG\",\"2341\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2342, "epsg", 2342,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 93E\",GEOGCS[\"Xian"
+        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814"
+        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG"
+        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",93],PARAMETER[\""
+        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas"
+        "ting\",EAST],AUTHORITY[\"EPSG\",\"2341\"]]"},
+    {2342, "epsg", 2342,
         "Xian 1980 / Gauss-Kruger CM 99E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 99E\",GEOGCS[\"Xian");
-    add_srs_wkt (p, 1,
-        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814");
-    add_srs_wkt (p, 2,
-        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",99],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AUTHORITY[\"EPSG\",\"2342\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2343, "epsg", 2343,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 99E\",GEOGCS[\"Xian"
+        " 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",637814"
+        "0,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPSG"
+        "\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",99],PARAMETER[\""
+        "scale_factor\",1],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas"
+        "ting\",EAST],AUTHORITY[\"EPSG\",\"2342\"]]"},
+    {2343, "epsg", 2343,
         "Xian 1980 / Gauss-Kruger CM 105E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 105E\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",105],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2343\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2344, "epsg", 2344,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 105E\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",105],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2343\"]]"},
+    {2344, "epsg", 2344,
         "Xian 1980 / Gauss-Kruger CM 111E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 111E\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",111],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2344\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2345, "epsg", 2345,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 111E\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",111],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2344\"]]"},
+    {2345, "epsg", 2345,
         "Xian 1980 / Gauss-Kruger CM 117E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 117E\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",117],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2345\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2346, "epsg", 2346,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 117E\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",117],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2345\"]]"},
+    {2346, "epsg", 2346,
         "Xian 1980 / Gauss-Kruger CM 123E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 123E\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",123],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2346\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2347, "epsg", 2347,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 123E\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",123],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2346\"]]"},
+    {2347, "epsg", 2347,
         "Xian 1980 / Gauss-Kruger CM 129E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 129E\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",129],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2347\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2348, "epsg", 2348,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 129E\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",129],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2347\"]]"},
+    {2348, "epsg", 2348,
         "Xian 1980 / Gauss-Kruger CM 135E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 135E\",GEOGCS[\"Xia");
-    add_srs_wkt (p, 1,
-        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781");
-    add_srs_wkt (p, 2,
-        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",135],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2348\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2349, "epsg", 2349,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / Gauss-Kruger CM 135E\",GEOGCS[\"Xia"
+        "n 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975\",63781"
+        "40,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORITY[\"EPS"
+        "G\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",135],PARAMETER"
+        "[\"scale_factor\",1],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"2348\"]]"},
+    {2349, "epsg", 2349,
         "Xian 1980 / 3-degree Gauss-Kruger zone 25", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 25\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",75],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "25500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2349\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2350, "epsg", 2350,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 25\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",75],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "25500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2349\"]]"},
+    {2350, "epsg", 2350,
         "Xian 1980 / 3-degree Gauss-Kruger zone 26", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 26\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",78],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "26500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2350\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2351, "epsg", 2351,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 26\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",78],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "26500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2350\"]]"},
+    {2351, "epsg", 2351,
         "Xian 1980 / 3-degree Gauss-Kruger zone 27", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 27\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",81],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "27500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2351\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2352, "epsg", 2352,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 27\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",81],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "27500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2351\"]]"},
+    {2352, "epsg", 2352,
         "Xian 1980 / 3-degree Gauss-Kruger zone 28", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 28\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",84],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "28500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2352\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2353, "epsg", 2353,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 28\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",84],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "28500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2352\"]]"},
+    {2353, "epsg", 2353,
         "Xian 1980 / 3-degree Gauss-Kruger zone 29", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 29\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",87],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "29500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2353\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2354, "epsg", 2354,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 29\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",87],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "29500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2353\"]]"},
+    {2354, "epsg", 2354,
         "Xian 1980 / 3-degree Gauss-Kruger zone 30", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 30\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",90],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "30500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2354\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2355, "epsg", 2355,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 30\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",90],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "30500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2354\"]]"},
+    {2355, "epsg", 2355,
         "Xian 1980 / 3-degree Gauss-Kruger zone 31", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 31\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",93],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "31500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2355\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2356, "epsg", 2356,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 31\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",93],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "31500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2355\"]]"},
+    {2356, "epsg", 2356,
         "Xian 1980 / 3-degree Gauss-Kruger zone 32", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 32\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",96],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "32500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2356\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2357, "epsg", 2357,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 32\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",96],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "32500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2356\"]]"},
+    {2357, "epsg", 2357,
         "Xian 1980 / 3-degree Gauss-Kruger zone 33", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 33\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",99],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "33500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2357\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2358, "epsg", 2358,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0"
+        " +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 33\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",99],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "33500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2357\"]]"},
+    {2358, "epsg", 2358,
         "Xian 1980 / 3-degree Gauss-Kruger zone 34", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 34\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",102],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",34500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2358\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2359, "epsg", 2359,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 34\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",102],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",34500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2358\"]]"},
+    {2359, "epsg", 2359,
         "Xian 1980 / 3-degree Gauss-Kruger zone 35", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 35\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",105],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",35500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2359\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2360, "epsg", 2360,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 35\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",105],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",35500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2359\"]]"},
+    {2360, "epsg", 2360,
         "Xian 1980 / 3-degree Gauss-Kruger zone 36", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 36\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",108],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",36500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2360\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2361, "epsg", 2361,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 36\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",108],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",36500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2360\"]]"},
+    {2361, "epsg", 2361,
         "Xian 1980 / 3-degree Gauss-Kruger zone 37", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 37\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",111],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",37500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2361\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2362, "epsg", 2362,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 37\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",111],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",37500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2361\"]]"},
+    {2362, "epsg", 2362,
         "Xian 1980 / 3-degree Gauss-Kruger zone 38", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 38\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",114],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",38500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2362\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2363, "epsg", 2363,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 38\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",114],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",38500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2362\"]]"},
+    {2363, "epsg", 2363,
         "Xian 1980 / 3-degree Gauss-Kruger zone 39", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 39\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",117],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",39500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2363\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2364, "epsg", 2364,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 39\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",117],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",39500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2363\"]]"},
+    {2364, "epsg", 2364,
         "Xian 1980 / 3-degree Gauss-Kruger zone 40", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 40\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",120],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",40500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2364\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2365, "epsg", 2365,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 40\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",120],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",40500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2364\"]]"},
+    {2365, "epsg", 2365,
         "Xian 1980 / 3-degree Gauss-Kruger zone 41", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 41\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",123],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",41500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2365\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2366, "epsg", 2366,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 41\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",123],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",41500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2365\"]]"},
+    {2366, "epsg", 2366,
         "Xian 1980 / 3-degree Gauss-Kruger zone 42", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 42\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",126],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",42500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2366\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2367, "epsg", 2367,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 42\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",126],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",42500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2366\"]]"},
+    {2367, "epsg", 2367,
         "Xian 1980 / 3-degree Gauss-Kruger zone 43", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 43\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",129],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",43500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2367\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2368, "epsg", 2368,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 43\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",129],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",43500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2367\"]]"},
+    {2368, "epsg", 2368,
         "Xian 1980 / 3-degree Gauss-Kruger zone 44", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 44\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",132],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",44500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2368\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2369, "epsg", 2369,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 44\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",132],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",44500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2368\"]]"},
+    {2369, "epsg", 2369,
         "Xian 1980 / 3-degree Gauss-Kruger zone 45", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 45\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",135],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",45500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2369\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2370, "epsg", 2370,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0="
+        "0 +a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger zone 45\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",135],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",45500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2369\"]]"},
+    {2370, "epsg", 2370,
         "Xian 1980 / 3-degree Gauss-Kruger CM 75E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 75E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",75],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2370\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2371, "epsg", 2371,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 75E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",75],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2370\"]]"},
+    {2371, "epsg", 2371,
         "Xian 1980 / 3-degree Gauss-Kruger CM 78E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 78E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",78],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2371\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2372, "epsg", 2372,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 78E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",78],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2371\"]]"},
+    {2372, "epsg", 2372,
         "Xian 1980 / 3-degree Gauss-Kruger CM 81E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 81E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",81],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2372\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2373, "epsg", 2373,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 81E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",81],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2372\"]]"},
+    {2373, "epsg", 2373,
         "Xian 1980 / 3-degree Gauss-Kruger CM 84E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 84E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",84],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2373\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2374, "epsg", 2374,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 84E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",84],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2373\"]]"},
+    {2374, "epsg", 2374,
         "Xian 1980 / 3-degree Gauss-Kruger CM 87E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 87E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",87],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2374\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2375, "epsg", 2375,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 87E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",87],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2374\"]]"},
+    {2375, "epsg", 2375,
         "Xian 1980 / 3-degree Gauss-Kruger CM 90E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 90E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",90],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2375\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2376, "epsg", 2376,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 90E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",90],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2375\"]]"},
+    {2376, "epsg", 2376,
         "Xian 1980 / 3-degree Gauss-Kruger CM 93E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 93E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",93],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2376\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2377, "epsg", 2377,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 93E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",93],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2376\"]]"},
+    {2377, "epsg", 2377,
         "Xian 1980 / 3-degree Gauss-Kruger CM 96E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 96E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",96],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2377\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2378, "epsg", 2378,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 96E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",96],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2377\"]]"},
+    {2378, "epsg", 2378,
         "Xian 1980 / 3-degree Gauss-Kruger CM 99E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 99E\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975");
-    add_srs_wkt (p, 2,
-        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",99],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2378\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2379, "epsg", 2379,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +"
+        "a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 99E\",GEOG"
+        "CS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 1975"
+        "\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHORI"
+        "TY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",99],PA"
+        "RAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2378\"]]"},
+    {2379, "epsg", 2379,
         "Xian 1980 / 3-degree Gauss-Kruger CM 102E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 102E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",102],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2379\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2380, "epsg", 2380,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 102E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",102],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2379\"]]"},
+    {2380, "epsg", 2380,
         "Xian 1980 / 3-degree Gauss-Kruger CM 105E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 105E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",105],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2380\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2381, "epsg", 2381,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 105E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",105],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2380\"]]"},
+    {2381, "epsg", 2381,
         "Xian 1980 / 3-degree Gauss-Kruger CM 108E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 108E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",108],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2381\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2382, "epsg", 2382,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 108E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",108],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2381\"]]"},
+    {2382, "epsg", 2382,
         "Xian 1980 / 3-degree Gauss-Kruger CM 111E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 111E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",111],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2382\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2383, "epsg", 2383,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 111E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",111],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2382\"]]"},
+    {2383, "epsg", 2383,
         "Xian 1980 / 3-degree Gauss-Kruger CM 114E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 114E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",114],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2383\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2384, "epsg", 2384,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 114E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",114],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2383\"]]"},
+    {2384, "epsg", 2384,
         "Xian 1980 / 3-degree Gauss-Kruger CM 117E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 117E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",117],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2384\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2385, "epsg", 2385,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 117E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",117],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2384\"]]"},
+    {2385, "epsg", 2385,
         "Xian 1980 / 3-degree Gauss-Kruger CM 120E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 120E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",120],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2385\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2386, "epsg", 2386,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 120E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",120],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2385\"]]"},
+    {2386, "epsg", 2386,
         "Xian 1980 / 3-degree Gauss-Kruger CM 123E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 123E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",123],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2386\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2387, "epsg", 2387,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 123E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",123],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2386\"]]"},
+    {2387, "epsg", 2387,
         "Xian 1980 / 3-degree Gauss-Kruger CM 126E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 126E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",126],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2387\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2388, "epsg", 2388,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 126E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",126],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2387\"]]"},
+    {2388, "epsg", 2388,
         "Xian 1980 / 3-degree Gauss-Kruger CM 129E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 129E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",129],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2388\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2389, "epsg", 2389,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 129E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",129],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2388\"]]"},
+    {2389, "epsg", 2389,
         "Xian 1980 / 3-degree Gauss-Kruger CM 132E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 132E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",132],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2389\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2390, "epsg", 2390,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 132E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",132],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2389\"]]"},
+    {2390, "epsg", 2390,
         "Xian 1980 / 3-degree Gauss-Kruger CM 135E", 0, 1,
         "IAG 1975", "Greenwich",
         "Xian_1980", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+a=6378140 +b=6356755.288157528 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 135E\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197");
-    add_srs_wkt (p, 2,
-        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",135],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2390\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2391, "epsg", 2391,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 "
+        "+a=6378140 +b=6356755.288157528 +units=m +no_defs",
+        "PROJCS[\"Xian 1980 / 3-degree Gauss-Kruger CM 135E\",GEO"
+        "GCS[\"Xian 1980\",DATUM[\"Xian_1980\",SPHEROID[\"IAG 197"
+        "5\",6378140,298.257,AUTHORITY[\"EPSG\",\"7049\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6610\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4610\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",135],P"
+        "ARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH]"
+        ",AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2390\"]]"},
+    {2391, "epsg", 2391,
         "KKJ / Finland zone 1", 0, 1,
         "International 1924", "Greenwich",
         "Kartastokoordinaattijarjestelma_1966", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=1500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34");
-    add_proj4text (p, 2,
-        "5,-1.376,1.496 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KKJ / Finland zone 1\",GEOGCS[\"KKJ\",DATUM[\"K");
-    add_srs_wkt (p, 1,
-        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2391\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2392, "epsg", 2392,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=1500000 +y_0=0 "
+        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34"
+        "5,-1.376,1.496 +units=m +no_defs",
+        "PROJCS[\"KKJ / Finland zone 1\",GEOGCS[\"KKJ\",DATUM[\"K"
+        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2"
+        "1],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2391\""
+        "]]"},
+    {2392, "epsg", 2392,
         "KKJ / Finland zone 2", 0, 1,
         "International 1924", "Greenwich",
         "Kartastokoordinaattijarjestelma_1966", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=2500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34");
-    add_proj4text (p, 2,
-        "5,-1.376,1.496 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KKJ / Finland zone 2\",GEOGCS[\"KKJ\",DATUM[\"K");
-    add_srs_wkt (p, 1,
-        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2");
-    add_srs_wkt (p, 8,
-        "4],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",2500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2392\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2393, "epsg", 2393,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=2500000 +y_0=0 "
+        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34"
+        "5,-1.376,1.496 +units=m +no_defs",
+        "PROJCS[\"KKJ / Finland zone 2\",GEOGCS[\"KKJ\",DATUM[\"K"
+        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2"
+        "4],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",2500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2392\""
+        "]]"},
+    {2393, "epsg", 2393,
         "KKJ / Finland Uniform Coordinate System", 0, 1,
         "International 1924", "Greenwich",
         "Kartastokoordinaattijarjestelma_1966", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=3500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34");
-    add_proj4text (p, 2,
-        "5,-1.376,1.496 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KKJ / Finland Uniform Coordinate System\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"KKJ\",DATUM[\"Kartastokoordinaattijarjestelma_1966\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4123\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",27],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",3500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"2393\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2394, "epsg", 2394,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=3500000 +y_0=0 "
+        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34"
+        "5,-1.376,1.496 +units=m +no_defs",
+        "PROJCS[\"KKJ / Finland Uniform Coordinate System\",GEOGC"
+        "S[\"KKJ\",DATUM[\"Kartastokoordinaattijarjestelma_1966\""
+        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\""
+        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4123\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",27],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",3500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"2393\"]]"},
+    {2394, "epsg", 2394,
         "KKJ / Finland zone 4", 0, 1,
         "International 1924", "Greenwich",
         "Kartastokoordinaattijarjestelma_1966", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34");
-    add_proj4text (p, 2,
-        "5,-1.376,1.496 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KKJ / Finland zone 4\",GEOGCS[\"KKJ\",DATUM[\"K");
-    add_srs_wkt (p, 1,
-        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",4500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2394\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2395, "epsg", 2395,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=4500000 +y_0=0 "
+        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34"
+        "5,-1.376,1.496 +units=m +no_defs",
+        "PROJCS[\"KKJ / Finland zone 4\",GEOGCS[\"KKJ\",DATUM[\"K"
+        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3"
+        "0],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",4500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2394\""
+        "]]"},
+    {2395, "epsg", 2395,
         "South Yemen / Gauss-Kruger zone 8", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "South_Yemen", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=8500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=-76,-138,67,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"South Yemen / Gauss-Kruger zone 8\",GEOGCS[\"So");
-    add_srs_wkt (p, 1,
-        "uth Yemen\",DATUM[\"South_Yemen\",SPHEROID[\"Krassowsky ");
-    add_srs_wkt (p, 2,
-        "1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6164\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4164");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",45],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",8500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2395\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2396, "epsg", 2396,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=8500000 +y_0=0 "
+        "+ellps=krass +towgs84=-76,-138,67,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"South Yemen / Gauss-Kruger zone 8\",GEOGCS[\"So"
+        "uth Yemen\",DATUM[\"South_Yemen\",SPHEROID[\"Krassowsky "
+        "1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHO"
+        "RITY[\"EPSG\",\"6164\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4164"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",0],PARAMETER[\"central_meridian\",45],"
+        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",8500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2395\"]]"},
+    {2396, "epsg", 2396,
         "South Yemen / Gauss-Kruger zone 9", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "South_Yemen", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=9500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=-76,-138,67,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"South Yemen / Gauss-Kruger zone 9\",GEOGCS[\"So");
-    add_srs_wkt (p, 1,
-        "uth Yemen\",DATUM[\"South_Yemen\",SPHEROID[\"Krassowsky ");
-    add_srs_wkt (p, 2,
-        "1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6164\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4164");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",51],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",9500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2396\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2397, "epsg", 2397,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=9500000 +y_0=0 "
+        "+ellps=krass +towgs84=-76,-138,67,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"South Yemen / Gauss-Kruger zone 9\",GEOGCS[\"So"
+        "uth Yemen\",DATUM[\"South_Yemen\",SPHEROID[\"Krassowsky "
+        "1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHO"
+        "RITY[\"EPSG\",\"6164\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4164"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",0],PARAMETER[\"central_meridian\",51],"
+        "PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting\""
+        ",9500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2396\"]]"},
+    {2397, "epsg", 2397,
         "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 3", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.9,-126.4,-93.2,-0.063,-0.247,-0.");
-    add_proj4text (p, 2,
-        "041,1.01 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 3");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",9],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",3500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"2397\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2398, "epsg", 2398,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +"
+        "ellps=krass +towgs84=24.9,-126.4,-93.2,-0.063,-0.247,-0."
+        "041,1.01 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 3"
+        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",9],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",3500000],PARAMETER[\"false_northi"
+        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY"
+        "[\"EPSG\",\"2397\"]]"},
+    {2398, "epsg", 2398,
         "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 4", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.9,-126.4,-93.2,-0.063,-0.247,-0");
-    add_proj4text (p, 2,
-        ".041,1.01 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 4");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",12],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",4500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"2398\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2399, "epsg", 2399,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 "
+        "+ellps=krass +towgs84=24.9,-126.4,-93.2,-0.063,-0.247,-0"
+        ".041,1.01 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 4"
+        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",12],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",4500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"2398\"]]"},
+    {2399, "epsg", 2399,
         "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 5", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.9,-126.4,-93.2,-0.063,-0.247,-0");
-    add_proj4text (p, 2,
-        ".041,1.01 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 5");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",15],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",5500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"2399\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2400, "epsg", 2400,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 "
+        "+ellps=krass +towgs84=24.9,-126.4,-93.2,-0.063,-0.247,-0"
+        ".041,1.01 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 5"
+        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",15],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",5500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"2399\"]]"},
+    {2400, "epsg", 2400,
         "RT90 2.5 gon V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 2.5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets");
-    add_srs_wkt (p, 1,
-        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",15.80827");
-    add_srs_wkt (p, 8,
-        "77777778],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",1500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3021\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2401, "epsg", 2401,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-"
+        "0.855,2.141,-7.023,0 +units=m +no_defs",
+        "PROJCS[\"RT90 2.5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets"
+        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397"
+        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY"
+        "[\"EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",15.80827"
+        "77777778],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",1500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "3021\"]]"},
+    {2401, "epsg", 2401,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 25", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 25\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",25500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2401\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2402, "epsg", 2402,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 25\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",25500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2401\"]]"},
+    {2402, "epsg", 2402,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 26", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 26\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",78],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",26500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2402\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2403, "epsg", 2403,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 26\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",78],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",26500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2402\"]]"},
+    {2403, "epsg", 2403,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 27", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 27\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",27500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2403\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2404, "epsg", 2404,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 27\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",27500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2403\"]]"},
+    {2404, "epsg", 2404,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 28", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 28\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",84],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",28500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2404\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2405, "epsg", 2405,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 28\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",84],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",28500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2404\"]]"},
+    {2405, "epsg", 2405,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 29", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 29\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",87],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",29500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2405\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2406, "epsg", 2406,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 29\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",87],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",29500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2405\"]]"},
+    {2406, "epsg", 2406,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 30", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 30\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",90],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",30500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2406\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2407, "epsg", 2407,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 30\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",90],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",30500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2406\"]]"},
+    {2407, "epsg", 2407,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 31", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 31\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",93],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",31500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2407\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2408, "epsg", 2408,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 31\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",93],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",31500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2407\"]]"},
+    {2408, "epsg", 2408,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 32", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 32\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",96],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",32500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2408\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2409, "epsg", 2409,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 32\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",96],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",32500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2408\"]]"},
+    {2409, "epsg", 2409,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 33", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 33\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",99],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",33500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2409\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2410, "epsg", 2410,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0"
+        " +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 33\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",99],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",33500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2409\"]]"},
+    {2410, "epsg", 2410,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 34", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 34\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",102],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",34500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2410\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2411, "epsg", 2411,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 34\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",102],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",34500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2410\"]]"},
+    {2411, "epsg", 2411,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 35", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 35\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",105],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",35500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2411\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2412, "epsg", 2412,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 35\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",105],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",35500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2411\"]]"},
+    {2412, "epsg", 2412,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 36", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 36\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",108],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",36500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2412\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2413, "epsg", 2413,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 36\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",108],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",36500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2412\"]]"},
+    {2413, "epsg", 2413,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 37", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 37\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",111],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",37500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2413\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2414, "epsg", 2414,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 37\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",111],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",37500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2413\"]]"},
+    {2414, "epsg", 2414,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 38", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 38\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",114],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",38500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2414\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2415, "epsg", 2415,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 38\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",114],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",38500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2414\"]]"},
+    {2415, "epsg", 2415,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 39", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 39\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",117],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",39500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2415\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2416, "epsg", 2416,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 39\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",117],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",39500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2415\"]]"},
+    {2416, "epsg", 2416,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 40", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 40\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",120],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",40500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2416\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2417, "epsg", 2417,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 40\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",120],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",40500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2416\"]]"},
+    {2417, "epsg", 2417,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 41", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 41\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",123],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",41500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2417\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2418, "epsg", 2418,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 41\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",123],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",41500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2417\"]]"},
+    {2418, "epsg", 2418,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 42", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 42\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",126],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",42500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2418\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2419, "epsg", 2419,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 42\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",126],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",42500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2418\"]]"},
+    {2419, "epsg", 2419,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 43", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 43\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",129],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",43500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2419\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2420, "epsg", 2420,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 43\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",129],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",43500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2419\"]]"},
+    {2420, "epsg", 2420,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 44", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 44\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",132],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",44500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2420\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2421, "epsg", 2421,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 44\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",132],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",44500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2420\"]]"},
+    {2421, "epsg", 2421,
         "Beijing 1954 / 3-degree Gauss-Kruger zone 45", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 45\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",135],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",45500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2421\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2422, "epsg", 2422,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0="
+        "0 +ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger zone 45\","
+        "GEOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",135],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",45500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2421\"]]"},
+    {2422, "epsg", 2422,
         "Beijing 1954 / 3-degree Gauss-Kruger CM 75E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger CM 75E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2422\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2423, "epsg", 2423,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger CM 75E\",G"
+        "EOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2422\"]]"},
+    {2423, "epsg", 2423,
         "Beijing 1954 / 3-degree Gauss-Kruger CM 78E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger CM 78E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",78],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2423\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2424, "epsg", 2424,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger CM 78E\",G"
+        "EOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",78],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2423\"]]"},
+    {2424, "epsg", 2424,
         "Beijing 1954 / 3-degree Gauss-Kruger CM 81E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger CM 81E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2424\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2425, "epsg", 2425,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger CM 81E\",G"
+        "EOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2424\"]]"},
+    {2425, "epsg", 2425,
         "Beijing 1954 / 3-degree Gauss-Kruger CM 84E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger CM 84E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",84],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2425\"]]");
-}
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"Beijing 1954 / 3-degree Gauss-Kruger CM 84E\",G"
+        "EOGCS[\"Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4214\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",84],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2425\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_03 = {
+    epsg_defs_03, sizeof (epsg_defs_03) / sizeof (epsg_defs_03[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3745 +53,2131 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_05 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2527, "epsg", 2527,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_05[] = {
+    {2527, "epsg", 2527,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 11", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=11500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 11\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",33],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",11500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2527\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2528, "epsg", 2528,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=11500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 11\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",33],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",11500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2527\"]]"},
+    {2528, "epsg", 2528,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 12", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=12500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 12\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",36],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",12500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2528\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2529, "epsg", 2529,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=12500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 12\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",36],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",12500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2528\"]]"},
+    {2529, "epsg", 2529,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 13", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=13500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 13\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",39],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",13500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2529\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2530, "epsg", 2530,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=13500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 13\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",39],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",13500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2529\"]]"},
+    {2530, "epsg", 2530,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 14", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=14500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 14\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",42],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",14500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2530\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2531, "epsg", 2531,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=14500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 14\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",42],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",14500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2530\"]]"},
+    {2531, "epsg", 2531,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 15", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=15500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 15\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",45],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",15500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2531\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2532, "epsg", 2532,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=15500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 15\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",45],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",15500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2531\"]]"},
+    {2532, "epsg", 2532,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 16", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=16500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 16\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",48],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",16500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2532\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2533, "epsg", 2533,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=16500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 16\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",48],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",16500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2532\"]]"},
+    {2533, "epsg", 2533,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 17", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=17500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 17\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",51],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",17500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2533\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2534, "epsg", 2534,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=17500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 17\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",51],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",17500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2533\"]]"},
+    {2534, "epsg", 2534,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 18", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=54 +k=1 +x_0=18500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 18\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",54],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",18500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2534\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2535, "epsg", 2535,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=54 +k=1 +x_0=18500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 18\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",54],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",18500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2534\"]]"},
+    {2535, "epsg", 2535,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 19", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=57 +k=1 +x_0=19500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 19\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",57],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",19500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2535\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2536, "epsg", 2536,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=57 +k=1 +x_0=19500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 19\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",57],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",19500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2535\"]]"},
+    {2536, "epsg", 2536,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 20", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=60 +k=1 +x_0=20500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 20\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",60],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",20500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2536\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2537, "epsg", 2537,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=60 +k=1 +x_0=20500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 20\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",60],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",20500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2536\"]]"},
+    {2537, "epsg", 2537,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 21", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=63 +k=1 +x_0=21500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 21\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",63],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",21500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2537\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2538, "epsg", 2538,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=63 +k=1 +x_0=21500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 21\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",63],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",21500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2537\"]]"},
+    {2538, "epsg", 2538,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 22", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=66 +k=1 +x_0=22500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 22\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",66],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",22500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2538\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2539, "epsg", 2539,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=66 +k=1 +x_0=22500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 22\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",66],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",22500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2538\"]]"},
+    {2539, "epsg", 2539,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 23", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=69 +k=1 +x_0=23500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 23\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",69],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",23500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2539\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2540, "epsg", 2540,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=69 +k=1 +x_0=23500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 23\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",69],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",23500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2539\"]]"},
+    {2540, "epsg", 2540,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 24", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=72 +k=1 +x_0=24500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 24\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",72],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",24500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2540\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2541, "epsg", 2541,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=72 +k=1 +x_0=24500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 24\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",72],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",24500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2540\"]]"},
+    {2541, "epsg", 2541,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 25", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 25\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",25500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2541\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2542, "epsg", 2542,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=25500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 25\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",25500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2541\"]]"},
+    {2542, "epsg", 2542,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 26", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 26\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",78],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",26500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2542\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2543, "epsg", 2543,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=26500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 26\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",78],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",26500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2542\"]]"},
+    {2543, "epsg", 2543,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 27", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 27\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",27500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2543\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2544, "epsg", 2544,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=27500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 27\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",27500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2543\"]]"},
+    {2544, "epsg", 2544,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 28", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 28\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",84],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",28500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2544\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2545, "epsg", 2545,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=28500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 28\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",84],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",28500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2544\"]]"},
+    {2545, "epsg", 2545,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 29", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 29\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",87],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",29500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2545\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2546, "epsg", 2546,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=29500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 29\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",87],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",29500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2545\"]]"},
+    {2546, "epsg", 2546,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 30", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 30\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",90],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",30500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2546\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2547, "epsg", 2547,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=30500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 30\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",90],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",30500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2546\"]]"},
+    {2547, "epsg", 2547,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 31", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 31\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",93],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",31500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2547\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2548, "epsg", 2548,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=31500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 31\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",93],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",31500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2547\"]]"},
+    {2548, "epsg", 2548,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 32", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 32\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",96],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",32500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2548\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2549, "epsg", 2549,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=32500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 32\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",96],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",32500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2548\"]]"},
+    {2549, "epsg", 2549,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 33", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 33\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",99],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",33500000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"2549\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2550, "epsg", 2550,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=33500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 33\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",99],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",33500000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"2549\"]]"},
+    {2550, "epsg", 2550,
         "Segara / UTM zone 50S", 0, 0,
         "Bessel 1841", "Greenwich",
         "Gunung_Segara", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=50 +south +ellps=bessel +towgs84=-404.78");
-    add_proj4text (p, 1,
-        ",685.68,45.47,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Segara / UTM zone 50S\",GEOGCS[\"Segara\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Gunung_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,");
-    add_srs_wkt (p, 2,
-        "299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6613\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4613\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",117],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2933\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2551, "epsg", 2551,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=50 +south +ellps=bessel +towgs84=-404.78"
+        ",685.68,45.47,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Segara / UTM zone 50S\",GEOGCS[\"Segara\",DATUM"
+        "[\"Gunung_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,"
+        "299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EP"
+        "SG\",\"6613\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4613\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",117],PARAMETER"
+        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2933\"]"
+        "]"},
+    {2551, "epsg", 2551,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 34", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 34\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",102],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",34500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2551\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2552, "epsg", 2552,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=34500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 34\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",102],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",34500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2551\"]]"},
+    {2552, "epsg", 2552,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 35", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 35\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",105],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",35500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2552\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2553, "epsg", 2553,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=35500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 35\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",105],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",35500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2552\"]]"},
+    {2553, "epsg", 2553,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 36", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 36\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",108],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",36500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2553\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2554, "epsg", 2554,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=36500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 36\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",108],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",36500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2553\"]]"},
+    {2554, "epsg", 2554,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 37", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 37\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",111],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",37500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2554\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2555, "epsg", 2555,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=37500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 37\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",111],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",37500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2554\"]]"},
+    {2555, "epsg", 2555,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 38", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 38\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",114],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",38500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2555\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2556, "epsg", 2556,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=38500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 38\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",114],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",38500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2555\"]]"},
+    {2556, "epsg", 2556,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 39", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 39\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",117],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",39500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2556\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2557, "epsg", 2557,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=39500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 39\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",117],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",39500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2556\"]]"},
+    {2557, "epsg", 2557,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 40", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 40\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",120],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",40500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2557\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2558, "epsg", 2558,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=40500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 40\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",120],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",40500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2557\"]]"},
+    {2558, "epsg", 2558,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 41", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 41\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",123],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",41500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2558\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2559, "epsg", 2559,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=41500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 41\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",123],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",41500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2558\"]]"},
+    {2559, "epsg", 2559,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 42", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 42\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",126],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",42500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2559\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2560, "epsg", 2560,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=42500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 42\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",126],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",42500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2559\"]]"},
+    {2560, "epsg", 2560,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 43", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 43\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",129],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",43500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2560\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2561, "epsg", 2561,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=43500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 43\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",129],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",43500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2560\"]]"},
+    {2561, "epsg", 2561,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 44", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 44\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",132],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",44500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2561\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2562, "epsg", 2562,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=44500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 44\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",132],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",44500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2561\"]]"},
+    {2562, "epsg", 2562,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 45", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 45\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",135],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",45500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2562\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2563, "epsg", 2563,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=45500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 45\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",135],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",45500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2562\"]]"},
+    {2563, "epsg", 2563,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 46", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=138 +k=1 +x_0=46500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 46\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",138],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",46500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2563\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2564, "epsg", 2564,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=138 +k=1 +x_0=46500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 46\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",138],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",46500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2563\"]]"},
+    {2564, "epsg", 2564,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 47", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=141 +k=1 +x_0=47500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 47\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",141],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",47500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2564\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2565, "epsg", 2565,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=141 +k=1 +x_0=47500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 47\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",141],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",47500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2564\"]]"},
+    {2565, "epsg", 2565,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 48", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=144 +k=1 +x_0=48500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 48\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",144],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",48500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2565\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2566, "epsg", 2566,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=144 +k=1 +x_0=48500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 48\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",144],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",48500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2565\"]]"},
+    {2566, "epsg", 2566,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 49", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=147 +k=1 +x_0=49500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 49\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",147],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",49500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2566\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2567, "epsg", 2567,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=147 +k=1 +x_0=49500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 49\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",147],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",49500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2566\"]]"},
+    {2567, "epsg", 2567,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 50", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=150 +k=1 +x_0=50500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 50\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",150],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",50500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2567\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2568, "epsg", 2568,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=150 +k=1 +x_0=50500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 50\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",150],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",50500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2567\"]]"},
+    {2568, "epsg", 2568,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 51", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=153 +k=1 +x_0=51500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 51\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",153],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",51500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2568\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2569, "epsg", 2569,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=153 +k=1 +x_0=51500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 51\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",153],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",51500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2568\"]]"},
+    {2569, "epsg", 2569,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 52", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=156 +k=1 +x_0=52500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 52\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",156],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",52500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2569\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2570, "epsg", 2570,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=156 +k=1 +x_0=52500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 52\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",156],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",52500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2569\"]]"},
+    {2570, "epsg", 2570,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 53", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=159 +k=1 +x_0=53500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 53\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",159],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",53500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2570\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2571, "epsg", 2571,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=159 +k=1 +x_0=53500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 53\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",159],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",53500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2570\"]]"},
+    {2571, "epsg", 2571,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 54", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=162 +k=1 +x_0=54500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 54\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",162],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",54500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2571\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2572, "epsg", 2572,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=162 +k=1 +x_0=54500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 54\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",162],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",54500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2571\"]]"},
+    {2572, "epsg", 2572,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 55", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=165 +k=1 +x_0=55500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 55\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",165],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",55500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2572\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2573, "epsg", 2573,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=165 +k=1 +x_0=55500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 55\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",165],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",55500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2572\"]]"},
+    {2573, "epsg", 2573,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 56", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=168 +k=1 +x_0=56500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 56\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",168],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",56500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2573\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2574, "epsg", 2574,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=168 +k=1 +x_0=56500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 56\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",168],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",56500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2573\"]]"},
+    {2574, "epsg", 2574,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 57", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=171 +k=1 +x_0=57500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 57\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",171],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",57500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2574\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2575, "epsg", 2575,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=171 +k=1 +x_0=57500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 57\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",171],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",57500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2574\"]]"},
+    {2575, "epsg", 2575,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 58", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=174 +k=1 +x_0=58500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 58\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",174],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",58500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2575\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2576, "epsg", 2576,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=174 +k=1 +x_0=58500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 58\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",174],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",58500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2575\"]]"},
+    {2576, "epsg", 2576,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 59", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=177 +k=1 +x_0=59500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 59\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",177],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",59500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2576\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2577, "epsg", 2577,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=177 +k=1 +x_0=59500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 59\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",177],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",59500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2576\"]]"},
+    {2577, "epsg", 2577,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 60", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=60000000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 60\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",180],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",60500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3389\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2578, "epsg", 2578,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=60000000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 60\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",180],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",60500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"3389\"]]"},
+    {2578, "epsg", 2578,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 61", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=1 +x_0=61500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82");
-    add_proj4text (p, 2,
-        ",-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 61\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",-177],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",61500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2578\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2579, "epsg", 2579,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=1 +x_0=61500000 +y_0"
+        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82"
+        ",-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 61\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",-177],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",61500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2578\"]]"},
+    {2579, "epsg", 2579,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 62", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-174 +k=1 +x_0=62500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82");
-    add_proj4text (p, 2,
-        ",-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 62\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",-174],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",62500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2579\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2580, "epsg", 2580,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-174 +k=1 +x_0=62500000 +y_0"
+        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82"
+        ",-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 62\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",-174],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",62500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2579\"]]"},
+    {2580, "epsg", 2580,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 63", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=1 +x_0=63500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82");
-    add_proj4text (p, 2,
-        ",-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 63\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",-171],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",63500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2580\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2581, "epsg", 2581,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=1 +x_0=63500000 +y_0"
+        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82"
+        ",-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 63\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",-171],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",63500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2580\"]]"},
+    {2581, "epsg", 2581,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 64", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-168 +k=1 +x_0=64500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82");
-    add_proj4text (p, 2,
-        ",-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 64\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",-168],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",64500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2581\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2582, "epsg", 2582,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-168 +k=1 +x_0=64500000 +y_0"
+        "=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82"
+        ",-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 64\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",-168],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",64500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"2581\"]]"},
+    {2582, "epsg", 2582,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 21E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 21E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2582\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2583, "epsg", 2583,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 21E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2582\"]]"},
+    {2583, "epsg", 2583,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 24E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 24E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",24],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2583\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2584, "epsg", 2584,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 24E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",24],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2583\"]]"},
+    {2584, "epsg", 2584,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 27E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 27E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2584\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2585, "epsg", 2585,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 27E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2584\"]]"},
+    {2585, "epsg", 2585,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 30E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 30E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2585\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2586, "epsg", 2586,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 30E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2585\"]]"},
+    {2586, "epsg", 2586,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 33E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 33E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",33],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2586\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2587, "epsg", 2587,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 33E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",33],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2586\"]]"},
+    {2587, "epsg", 2587,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 36E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 36E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",36],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2587\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2588, "epsg", 2588,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 36E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",36],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2587\"]]"},
+    {2588, "epsg", 2588,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 39E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 39E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",39],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2588\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2589, "epsg", 2589,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 39E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",39],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2588\"]]"},
+    {2589, "epsg", 2589,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 42E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 42E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",42],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2589\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2590, "epsg", 2590,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=42 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 42E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",42],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2589\"]]"},
+    {2590, "epsg", 2590,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 45E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 45E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",45],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2590\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2591, "epsg", 2591,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=45 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 45E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",45],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2590\"]]"},
+    {2591, "epsg", 2591,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 48E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 48E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",48],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2591\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2592, "epsg", 2592,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=48 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 48E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",48],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2591\"]]"},
+    {2592, "epsg", 2592,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 51E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 51E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",51],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2592\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2593, "epsg", 2593,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=51 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 51E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",51],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2592\"]]"},
+    {2593, "epsg", 2593,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 54E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=54 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 54E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",54],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2593\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2594, "epsg", 2594,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=54 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 54E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",54],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2593\"]]"},
+    {2594, "epsg", 2594,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 57E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=57 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 57E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",57],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2594\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2595, "epsg", 2595,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=57 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 57E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",57],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2594\"]]"},
+    {2595, "epsg", 2595,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 60E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=60 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 60E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",60],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2595\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2596, "epsg", 2596,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=60 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 60E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",60],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2595\"]]"},
+    {2596, "epsg", 2596,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 63E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=63 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 63E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",63],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2596\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2597, "epsg", 2597,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=63 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 63E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",63],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2596\"]]"},
+    {2597, "epsg", 2597,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 66E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=66 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 66E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",66],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2597\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2598, "epsg", 2598,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=66 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 66E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",66],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2597\"]]"},
+    {2598, "epsg", 2598,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 69E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=69 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 69E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",69],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2598\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2599, "epsg", 2599,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=69 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 69E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",69],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2598\"]]"},
+    {2599, "epsg", 2599,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 72E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=72 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 72E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",72],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2599\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2600, "epsg", 2600,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=72 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 72E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",72],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2599\"]]"},
+    {2600, "epsg", 2600,
         "LKS94 / Lithuania TM", 0, 1,
         "GRS 1980", "Greenwich",
         "Lithuania_1994_ETRS89", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9998 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LKS94 / Lithuania TM\",GEOGCS[\"LKS94\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Lithuania_1994_ETRS89\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 2,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6126\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4669\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",24],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9998],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3346\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2601, "epsg", 2601,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9998 +x_0=500000 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def"
+        "s",
+        "PROJCS[\"LKS94 / Lithuania TM\",GEOGCS[\"LKS94\",DATUM[\""
+        "Lithuania_1994_ETRS89\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6126\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4669\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",24],PARAMETER["
+        "\"scale_factor\",0.9998],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI"
+        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3346\"]]"},
+    {2601, "epsg", 2601,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 75E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 75E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2601\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2602, "epsg", 2602,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=75 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 75E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",75],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2601\"]]"},
+    {2602, "epsg", 2602,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 78E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 78E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",78],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2602\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2603, "epsg", 2603,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=78 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 78E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",78],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2602\"]]"},
+    {2603, "epsg", 2603,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 81E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 81E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2603\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2604, "epsg", 2604,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=81 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 81E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",81],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2603\"]]"},
+    {2604, "epsg", 2604,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 84E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 84E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",84],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2604\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2605, "epsg", 2605,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=84 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 84E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",84],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2604\"]]"},
+    {2605, "epsg", 2605,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 87E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 87E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",87],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2605\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2606, "epsg", 2606,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=87 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 87E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",87],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2605\"]]"},
+    {2606, "epsg", 2606,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 90E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 90E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",90],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2606\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2607, "epsg", 2607,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=90 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 90E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",90],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2606\"]]"},
+    {2607, "epsg", 2607,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 93E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 93E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",93],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2607\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2608, "epsg", 2608,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=93 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 93E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",93],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2607\"]]"},
+    {2608, "epsg", 2608,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 96E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 96E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",96],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2608\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2609, "epsg", 2609,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=96 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 96E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",96],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2608\"]]"},
+    {2609, "epsg", 2609,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 99E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 99E\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",99],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2609\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2610, "epsg", 2610,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=99 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 99E\",G"
+        "EOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",99],PARAMETER[\"scale_factor\",1],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "2609\"]]"},
+    {2610, "epsg", 2610,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 102E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 102E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",102],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2610\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2611, "epsg", 2611,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=102 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 102E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",102],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2610\"]]"},
+    {2611, "epsg", 2611,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 105E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 105E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",105],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2611\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2612, "epsg", 2612,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=105 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 105E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",105],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2611\"]]"},
+    {2612, "epsg", 2612,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 108E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 108E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",108],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2612\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2613, "epsg", 2613,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=108 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 108E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",108],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2612\"]]"},
+    {2613, "epsg", 2613,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 111E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 111E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",111],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2613\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2614, "epsg", 2614,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=111 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 111E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",111],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2613\"]]"},
+    {2614, "epsg", 2614,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 114E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 114E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",114],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2614\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2615, "epsg", 2615,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=114 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 114E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",114],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2614\"]]"},
+    {2615, "epsg", 2615,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 117E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 117E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",117],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2615\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2616, "epsg", 2616,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=117 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 117E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",117],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2615\"]]"},
+    {2616, "epsg", 2616,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 120E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 120E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",120],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2616\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2617, "epsg", 2617,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=120 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 120E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",120],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2616\"]]"},
+    {2617, "epsg", 2617,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 123E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 123E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",123],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2617\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2618, "epsg", 2618,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 123E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",123],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2617\"]]"},
+    {2618, "epsg", 2618,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 126E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 126E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",126],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2618\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2619, "epsg", 2619,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=126 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 126E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",126],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2618\"]]"},
+    {2619, "epsg", 2619,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 129E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 129E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",129],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2619\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2620, "epsg", 2620,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 129E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",129],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2619\"]]"},
+    {2620, "epsg", 2620,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 132E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 132E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",132],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2620\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2621, "epsg", 2621,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=132 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 132E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",132],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2620\"]]"},
+    {2621, "epsg", 2621,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 135E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 135E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",135],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2621\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2622, "epsg", 2622,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 135E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",135],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2621\"]]"},
+    {2622, "epsg", 2622,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 138E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=138 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 138E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",138],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2622\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2623, "epsg", 2623,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=138 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 138E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",138],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2622\"]]"},
+    {2623, "epsg", 2623,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 141E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=141 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 141E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",141],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2623\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2624, "epsg", 2624,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=141 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 141E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",141],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2623\"]]"},
+    {2624, "epsg", 2624,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 144E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=144 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 144E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",144],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2624\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2625, "epsg", 2625,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=144 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 144E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",144],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2624\"]]"},
+    {2625, "epsg", 2625,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 147E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=147 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 147E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",147],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2625\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2626, "epsg", 2626,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=147 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 147E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",147],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2625\"]]"},
+    {2626, "epsg", 2626,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 150E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=150 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 150E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",150],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2626\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2627, "epsg", 2627,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=150 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 150E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",150],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2626\"]]"},
+    {2627, "epsg", 2627,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 153E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=153 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 153E\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",153],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"2627\"]]");
-}
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=153 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 153E\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",153],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"2627\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_05 = {
+    epsg_defs_05, sizeof (epsg_defs_05) / sizeof (epsg_defs_05[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,4139 +53,2328 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_08 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2830, "epsg", 2830,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_08[] = {
+    {2830, "epsg", 2830,
         "NAD83(HARN) / New York West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New York West\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",40],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-78.5833333333333],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 9,
-        "actor\",0.9999375],PARAMETER[\"false_easting\",350000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2830\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2831, "epsg", 2831,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999"
+        "9375 +x_0=350000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / New York West\",GEOGCS[\"NAD83(HA"
+        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",40],PARAMETER[\"c"
+        "entral_meridian\",-78.5833333333333],PARAMETER[\"scale_f"
+        "actor\",0.9999375],PARAMETER[\"false_easting\",350000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2830\"]]"},
+    {2831, "epsg", 2831,
         "NAD83(HARN) / New York Long Island", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New York Long Island\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.");
-    add_srs_wkt (p, 8,
-        "1666666666667],PARAMETER[\"central_meridian\",-74],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",41.0333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",40.6666666666667],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",300000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"2831\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2832, "epsg", 2832,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666"
+        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / New York Long Island\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40."
+        "1666666666667],PARAMETER[\"central_meridian\",-74],PARAM"
+        "ETER[\"standard_parallel_1\",41.0333333333333],PARAMETER"
+        "[\"standard_parallel_2\",40.6666666666667],PARAMETER[\"f"
+        "alse_easting\",300000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"2831\"]]"},
+    {2832, "epsg", 2832,
         "NAD83(HARN) / North Dakota North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / North Dakota North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",47],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-100.5],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_1\",48.7333333333333],PARAMETER[\"standard_");
-    add_srs_wkt (p, 10,
-        "parallel_2\",47.4333333333333],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2832\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2833, "epsg", 2833,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333"
+        "333 +lat_0=47 +lon_0=-100.5 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / North Dakota North\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",47],"
+        "PARAMETER[\"central_meridian\",-100.5],PARAMETER[\"stand"
+        "ard_parallel_1\",48.7333333333333],PARAMETER[\"standard_"
+        "parallel_2\",47.4333333333333],PARAMETER[\"false_easting"
+        "\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2832\"]]"},
+    {2833, "epsg", 2833,
         "NAD83(HARN) / North Dakota South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / North Dakota South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",45.6");
-    add_srs_wkt (p, 8,
-        "666666666667],PARAMETER[\"central_meridian\",-100.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",47.4833333333333],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",46.1833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",600000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"2833\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2834, "epsg", 2834,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333"
+        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(HARN) / North Dakota South\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",45.6"
+        "666666666667],PARAMETER[\"central_meridian\",-100.5],PAR"
+        "AMETER[\"standard_parallel_1\",47.4833333333333],PARAMET"
+        "ER[\"standard_parallel_2\",46.1833333333333],PARAMETER[\""
+        "false_easting\",600000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"2833\"]]"},
+    {2834, "epsg", 2834,
         "NAD83(HARN) / Ohio North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Ohio North\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",39.6666666666");
-    add_srs_wkt (p, 8,
-        "667],PARAMETER[\"central_meridian\",-82.5],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",41.7],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",40.4333333333333],PARAMETER[\"false_easting\",60000");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2834\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2835, "epsg", 2835,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39"
+        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Ohio North\",GEOGCS[\"NAD83(HARN)"
+        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",39.6666666666"
+        "667],PARAMETER[\"central_meridian\",-82.5],PARAMETER[\"s"
+        "tandard_parallel_1\",41.7],PARAMETER[\"standard_parallel"
+        "_2\",40.4333333333333],PARAMETER[\"false_easting\",60000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2834\"]]"},
+    {2835, "epsg", 2835,
         "NAD83(HARN) / Ohio South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Ohio South\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-82.5],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",40.0333333333333],PARAMETER[\"standard_parallel_2");
-    add_srs_wkt (p, 10,
-        "\",38.7333333333333],PARAMETER[\"false_easting\",600000]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 13,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2835\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2836, "epsg", 2836,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333"
+        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Ohio South\",GEOGCS[\"NAD83(HARN)"
+        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER"
+        "[\"central_meridian\",-82.5],PARAMETER[\"standard_parall"
+        "el_1\",40.0333333333333],PARAMETER[\"standard_parallel_2"
+        "\",38.7333333333333],PARAMETER[\"false_easting\",600000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2835\"]]"},
+    {2836, "epsg", 2836,
         "NAD83(HARN) / Oklahoma North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oklahoma North\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",35],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-98],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 9,
-        "allel_1\",36.7666666666667],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",35.5666666666667],PARAMETER[\"false_easting\",6000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2836\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2837, "epsg", 2837,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666"
+        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oklahoma North\",GEOGCS[\"NAD83(H"
+        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",35],PARA"
+        "METER[\"central_meridian\",-98],PARAMETER[\"standard_par"
+        "allel_1\",36.7666666666667],PARAMETER[\"standard_paralle"
+        "l_2\",35.5666666666667],PARAMETER[\"false_easting\",6000"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2836\"]]"},
+    {2837, "epsg", 2837,
         "NAD83(HARN) / Oklahoma South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oklahoma South\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-98],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",35.2333333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",33.9333333333333],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"283");
-    add_srs_wkt (p, 14,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2838, "epsg", 2838,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333"
+        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oklahoma South\",GEOGCS[\"NAD83(H"
+        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33.33333"
+        "33333333],PARAMETER[\"central_meridian\",-98],PARAMETER["
+        "\"standard_parallel_1\",35.2333333333333],PARAMETER[\"st"
+        "andard_parallel_2\",33.9333333333333],PARAMETER[\"false_"
+        "easting\",600000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"283"
+        "7\"]]"},
+    {2838, "epsg", 2838,
         "NAD83(HARN) / Oregon North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oregon North\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",43.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-120.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",46],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",44.3333333333333],PARAMETER[\"false_easting\",2500");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2838\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2839, "epsg", 2839,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6"
+        "6666666666666 +lon_0=-120.5 +x_0=2500000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oregon North\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",43.66666666"
+        "66667],PARAMETER[\"central_meridian\",-120.5],PARAMETER["
+        "\"standard_parallel_1\",46],PARAMETER[\"standard_paralle"
+        "l_2\",44.3333333333333],PARAMETER[\"false_easting\",2500"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2838\"]]"},
+    {2839, "epsg", 2839,
         "NAD83(HARN) / Oregon South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oregon South\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",41.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-120.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",44],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",42.3333333333333],PARAMETER[\"false_easting\",1500");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2839\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2840, "epsg", 2840,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6"
+        "6666666666666 +lon_0=-120.5 +x_0=1500000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oregon South\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",41.66666666"
+        "66667],PARAMETER[\"central_meridian\",-120.5],PARAMETER["
+        "\"standard_parallel_1\",44],PARAMETER[\"standard_paralle"
+        "l_2\",42.3333333333333],PARAMETER[\"false_easting\",1500"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2839\"]]"},
+    {2840, "epsg", 2840,
         "NAD83(HARN) / Rhode Island", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=100000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Rhode Island\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",41.0833333333333],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-71.5],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 9,
-        "actor\",0.99999375],PARAMETER[\"false_easting\",100000],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 11,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 12,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"2840\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2841, "epsg", 2841,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9"
+        "9999375 +x_0=100000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0"
+        ",0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Rhode Island\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",41.0833333333333],P"
+        "ARAMETER[\"central_meridian\",-71.5],PARAMETER[\"scale_f"
+        "actor\",0.99999375],PARAMETER[\"false_easting\",100000],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI"
+        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"2840\"]]"},
+    {2841, "epsg", 2841,
         "NAD83(HARN) / South Dakota North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 3,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / South Dakota North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43.8");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-100],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",45.6833333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",44.4166666666667],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",600000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"2841\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2842, "epsg", 2842,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666"
+        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def"
+        "s",
+        "PROJCS[\"NAD83(HARN) / South Dakota North\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43.8"
+        "333333333333],PARAMETER[\"central_meridian\",-100],PARAM"
+        "ETER[\"standard_parallel_1\",45.6833333333333],PARAMETER"
+        "[\"standard_parallel_2\",44.4166666666667],PARAMETER[\"f"
+        "alse_easting\",600000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"2841\"]]"},
+    {2842, "epsg", 2842,
         "NAD83(HARN) / South Dakota South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / South Dakota South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",42.3");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-100.333333");
-    add_srs_wkt (p, 9,
-        "333333],PARAMETER[\"standard_parallel_1\",44.4],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",42.8333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",600000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"2842\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2843, "epsg", 2843,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42"
+        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83(HARN) / South Dakota South\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",42.3"
+        "333333333333],PARAMETER[\"central_meridian\",-100.333333"
+        "333333],PARAMETER[\"standard_parallel_1\",44.4],PARAMETE"
+        "R[\"standard_parallel_2\",42.8333333333333],PARAMETER[\""
+        "false_easting\",600000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"2842\"]]"},
+    {2843, "epsg", 2843,
         "NAD83(HARN) / Tennessee", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Tennessee\",GEOGCS[\"NAD83(HARN)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 7,
-        "c_2SP\"],PARAMETER[\"latitude_of_origin\",34.33333333333");
-    add_srs_wkt (p, 8,
-        "33],PARAMETER[\"central_meridian\",-86],PARAMETER[\"stan");
-    add_srs_wkt (p, 9,
-        "dard_parallel_1\",36.4166666666667],PARAMETER[\"standard");
-    add_srs_wkt (p, 10,
-        "_parallel_2\",35.25],PARAMETER[\"false_easting\",600000]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 13,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2843\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2844, "epsg", 2844,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3"
+        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Tennessee\",GEOGCS[\"NAD83(HARN)\""
+        ",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHEROI"
+        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\","
+        "\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Coni"
+        "c_2SP\"],PARAMETER[\"latitude_of_origin\",34.33333333333"
+        "33],PARAMETER[\"central_meridian\",-86],PARAMETER[\"stan"
+        "dard_parallel_1\",36.4166666666667],PARAMETER[\"standard"
+        "_parallel_2\",35.25],PARAMETER[\"false_easting\",600000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2843\"]]"},
+    {2844, "epsg", 2844,
         "NAD83(HARN) / Texas North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000 +y_0=1000000 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas North\",GEOGCS[\"NAD83(HARN");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",34],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-101.5],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 9,
-        "allel_1\",36.1833333333333],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",34.65],PARAMETER[\"false_easting\",200000],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",1000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2844\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2845, "epsg", 2845,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3"
+        "4 +lon_0=-101.5 +x_0=200000 +y_0=1000000 +ellps=GRS80 +t"
+        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas North\",GEOGCS[\"NAD83(HARN"
+        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE"
+        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG"
+        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",34],PARAMET"
+        "ER[\"central_meridian\",-101.5],PARAMETER[\"standard_par"
+        "allel_1\",36.1833333333333],PARAMETER[\"standard_paralle"
+        "l_2\",34.65],PARAMETER[\"false_easting\",200000],PARAMET"
+        "ER[\"false_northing\",1000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2844\"]]"},
+    {2845, "epsg", 2845,
         "NAD83(HARN) / Texas North Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas North Central\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",31.");
-    add_srs_wkt (p, 8,
-        "6666666666667],PARAMETER[\"central_meridian\",-98.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",33.9666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",32.1333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",600000],PARAMETER[\"false_northing\",200");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"2845\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2846, "epsg", 2846,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333"
+        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y"
+        "_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas North Central\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",31."
+        "6666666666667],PARAMETER[\"central_meridian\",-98.5],PAR"
+        "AMETER[\"standard_parallel_1\",33.9666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",32.1333333333333],PARAMETER[\""
+        "false_easting\",600000],PARAMETER[\"false_northing\",200"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"2845\"]]"},
+    {2846, "epsg", 2846,
         "NAD83(HARN) / Texas Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=700000 +y_0=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 3,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas Central\",GEOGCS[\"NAD83(HA");
-    add_srs_wkt (p, 1,
-        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 7,
-        "_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29.666666");
-    add_srs_wkt (p, 8,
-        "6666667],PARAMETER[\"central_meridian\",-100.33333333333");
-    add_srs_wkt (p, 9,
-        "3],PARAMETER[\"standard_parallel_1\",31.8833333333333],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",30.1166666666667],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",700000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",3000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"2846\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2847, "epsg", 2847,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666"
+        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +"
+        "x_0=700000 +y_0=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas Central\",GEOGCS[\"NAD83(HA"
+        "RN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal"
+        "_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29.666666"
+        "6666667],PARAMETER[\"central_meridian\",-100.33333333333"
+        "3],PARAMETER[\"standard_parallel_1\",31.8833333333333],P"
+        "ARAMETER[\"standard_parallel_2\",30.1166666666667],PARAM"
+        "ETER[\"false_easting\",700000],PARAMETER[\"false_northin"
+        "g\",3000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2846\"]]"},
+    {2847, "epsg", 2847,
         "NAD83(HARN) / Texas South Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas South Central\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",27.");
-    add_srs_wkt (p, 8,
-        "8333333333333],PARAMETER[\"central_meridian\",-99],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",30.2833333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",28.3833333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",600000],PARAMETER[\"false_northing\",4000");
-    add_srs_wkt (p, 12,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"2847\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2848, "epsg", 2848,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333"
+        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0"
+        "=4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"NAD83(HARN) / Texas South Central\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",27."
+        "8333333333333],PARAMETER[\"central_meridian\",-99],PARAM"
+        "ETER[\"standard_parallel_1\",30.2833333333333],PARAMETER"
+        "[\"standard_parallel_2\",28.3833333333333],PARAMETER[\"f"
+        "alse_easting\",600000],PARAMETER[\"false_northing\",4000"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"2847\"]]"},
+    {2848, "epsg", 2848,
         "NAD83(HARN) / Texas South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000 +y");
-    add_proj4text (p, 2,
-        "_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas South\",GEOGCS[\"NAD83(HARN");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",25.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-98.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",27.8333333333333],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",26.1666666666667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",300000],PARAMETER[\"false_northing\",5000000],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 13,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"2848\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2849, "epsg", 2849,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666"
+        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000 +y"
+        "_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas South\",GEOGCS[\"NAD83(HARN"
+        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE"
+        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG"
+        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",25.66666666"
+        "66667],PARAMETER[\"central_meridian\",-98.5],PARAMETER[\""
+        "standard_parallel_1\",27.8333333333333],PARAMETER[\"stan"
+        "dard_parallel_2\",26.1666666666667],PARAMETER[\"false_ea"
+        "sting\",300000],PARAMETER[\"false_northing\",5000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"2848\"]]"},
+    {2849, "epsg", 2849,
         "NAD83(HARN) / Utah North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 3,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah North\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",40.3333333333");
-    add_srs_wkt (p, 8,
-        "333],PARAMETER[\"central_meridian\",-111.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",41.7833333333333],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",40.7166666666667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",1000000],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 13,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"2849\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2850, "epsg", 2850,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000 +"
+        "y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah North\",GEOGCS[\"NAD83(HARN)"
+        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",40.3333333333"
+        "333],PARAMETER[\"central_meridian\",-111.5],PARAMETER[\""
+        "standard_parallel_1\",41.7833333333333],PARAMETER[\"stan"
+        "dard_parallel_2\",40.7166666666667],PARAMETER[\"false_ea"
+        "sting\",500000],PARAMETER[\"false_northing\",1000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"2849\"]]"},
+    {2850, "epsg", 2850,
         "NAD83(HARN) / Utah Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000 +y_0=2000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah Central\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",38.33333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-111.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",40.65],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",39.0166666666667],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",2000000],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2850\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2851, "epsg", 2851,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000 +y_0=2000000 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah Central\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",38.33333333"
+        "33333],PARAMETER[\"central_meridian\",-111.5],PARAMETER["
+        "\"standard_parallel_1\",40.65],PARAMETER[\"standard_para"
+        "llel_2\",39.0166666666667],PARAMETER[\"false_easting\",5"
+        "00000],PARAMETER[\"false_northing\",2000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2850\"]"
+        "]"},
+    {2851, "epsg", 2851,
         "NAD83(HARN) / Utah South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000 +y_0=3000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah South\",GEOGCS[\"NAD83(HARN)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",36.6666666666");
-    add_srs_wkt (p, 8,
-        "667],PARAMETER[\"central_meridian\",-111.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",38.35],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 10,
-        "el_2\",37.2166666666667],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",3000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2851\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2852, "epsg", 2852,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000 +y_0=3000000 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah South\",GEOGCS[\"NAD83(HARN)"
+        "\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",36.6666666666"
+        "667],PARAMETER[\"central_meridian\",-111.5],PARAMETER[\""
+        "standard_parallel_1\",38.35],PARAMETER[\"standard_parall"
+        "el_2\",37.2166666666667],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",3000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2851\"]]"},
+    {2852, "epsg", 2852,
         "NAD83(HARN) / Vermont", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0");
-    add_proj4text (p, 1,
-        "=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Vermont\",GEOGCS[\"NAD83(HARN)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",42.5],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-72.5],PARAMETER[\"scale_factor\",0.99996428");
-    add_srs_wkt (p, 9,
-        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"2852\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2853, "epsg", 2853,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0"
+        "=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Vermont\",GEOGCS[\"NAD83(HARN)\","
+        "DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",42.5],PARAMETER[\"central"
+        "_meridian\",-72.5],PARAMETER[\"scale_factor\",0.99996428"
+        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2852\"]]"},
+    {2853, "epsg", 2853,
         "NAD83(HARN) / Virginia North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000 +y_0=2000000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Virginia North\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-78.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",39.2],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",38.0333333333333],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "3500000],PARAMETER[\"false_northing\",2000000],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2853\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2854, "epsg", 2854,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37"
+        ".66666666666666 +lon_0=-78.5 +x_0=3500000 +y_0=2000000 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Virginia North\",GEOGCS[\"NAD83(H"
+        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37.66666"
+        "66666667],PARAMETER[\"central_meridian\",-78.5],PARAMETE"
+        "R[\"standard_parallel_1\",39.2],PARAMETER[\"standard_par"
+        "allel_2\",38.0333333333333],PARAMETER[\"false_easting\","
+        "3500000],PARAMETER[\"false_northing\",2000000],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2853\""
+        "]]"},
+    {2854, "epsg", 2854,
         "NAD83(HARN) / Virginia South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000 +");
-    add_proj4text (p, 2,
-        "y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 3,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Virginia South\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-78.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",37.9666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",36.7666666666667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",3500000],PARAMETER[\"false_northing\",100000");
-    add_srs_wkt (p, 12,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"2854\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2855, "epsg", 2855,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666"
+        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000 +"
+        "y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"NAD83(HARN) / Virginia South\",GEOGCS[\"NAD83(H"
+        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.33333"
+        "33333333],PARAMETER[\"central_meridian\",-78.5],PARAMETE"
+        "R[\"standard_parallel_1\",37.9666666666667],PARAMETER[\""
+        "standard_parallel_2\",36.7666666666667],PARAMETER[\"fals"
+        "e_easting\",3500000],PARAMETER[\"false_northing\",100000"
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"2854\"]]"},
+    {2855, "epsg", 2855,
         "NAD83(HARN) / Washington North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Washington North\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",47],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-120.833333333333],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",48.7333333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",47.5],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2855\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2856, "epsg", 2856,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47"
+        " +lon_0=-120.8333333333333 +x_0=500000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Washington North\",GEOGCS[\"NAD83"
+        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",47],PARA"
+        "METER[\"central_meridian\",-120.833333333333],PARAMETER["
+        "\"standard_parallel_1\",48.7333333333333],PARAMETER[\"st"
+        "andard_parallel_2\",47.5],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2855\"]]"},
+    {2856, "epsg", 2856,
         "NAD83(HARN) / Washington South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Washington South\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",45.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-120.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",47.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",45.8333333333333],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 13,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2856\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2857, "epsg", 2857,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333"
+        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(HARN) / Washington South\",GEOGCS[\"NAD83"
+        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",45.33333"
+        "33333333],PARAMETER[\"central_meridian\",-120.5],PARAMET"
+        "ER[\"standard_parallel_1\",47.3333333333333],PARAMETER[\""
+        "standard_parallel_2\",45.8333333333333],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2856\"]]"},
+    {2857, "epsg", 2857,
         "NAD83(HARN) / West Virginia North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79.");
-    add_proj4text (p, 1,
-        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / West Virginia North\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38.");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"central_meridian\",-79.5],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",40.25],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",39],PARAMETER[\"false_easting\",600000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2857\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2858, "epsg", 2858,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79."
+        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / West Virginia North\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38."
+        "5],PARAMETER[\"central_meridian\",-79.5],PARAMETER[\"sta"
+        "ndard_parallel_1\",40.25],PARAMETER[\"standard_parallel_"
+        "2\",39],PARAMETER[\"false_easting\",600000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"2857\"]]"},
+    {2858, "epsg", 2858,
         "NAD83(HARN) / West Virginia South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / West Virginia South\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"central_meridian\",-81],PARAMETER[\"standar");
-    add_srs_wkt (p, 9,
-        "d_parallel_1\",38.8833333333333],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 10,
-        "rallel_2\",37.4833333333333],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2858\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2859, "epsg", 2859,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333"
+        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / West Virginia South\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37]"
+        ",PARAMETER[\"central_meridian\",-81],PARAMETER[\"standar"
+        "d_parallel_1\",38.8833333333333],PARAMETER[\"standard_pa"
+        "rallel_2\",37.4833333333333],PARAMETER[\"false_easting\""
+        ",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2858\"]]"},
+    {2859, "epsg", 2859,
         "NAD83(HARN) / Wisconsin North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wisconsin North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",45.16666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-90],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",46.7666666666667],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",45.5666666666667],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"285");
-    add_srs_wkt (p, 14,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2860, "epsg", 2860,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666"
+        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wisconsin North\",GEOGCS[\"NAD83("
+        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",45.16666"
+        "66666667],PARAMETER[\"central_meridian\",-90],PARAMETER["
+        "\"standard_parallel_1\",46.7666666666667],PARAMETER[\"st"
+        "andard_parallel_2\",45.5666666666667],PARAMETER[\"false_"
+        "easting\",600000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"285"
+        "9\"]]"},
+    {2860, "epsg", 2860,
         "NAD83(HARN) / Wisconsin Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wisconsin Central\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43.83333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-90],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",45.5],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",44.25],PARAMETER[\"false_easting\",600000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2860\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2861, "epsg", 2861,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333"
+        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wisconsin Central\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43.83333"
+        "33333333],PARAMETER[\"central_meridian\",-90],PARAMETER["
+        "\"standard_parallel_1\",45.5],PARAMETER[\"standard_paral"
+        "lel_2\",44.25],PARAMETER[\"false_easting\",600000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"2860\"]]"},
+    {2861, "epsg", 2861,
         "NAD83(HARN) / Wisconsin South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wisconsin South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",42],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-90],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 9,
-        "allel_1\",44.0666666666667],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",42.7333333333333],PARAMETER[\"false_easting\",6000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2861\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2862, "epsg", 2862,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333"
+        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wisconsin South\",GEOGCS[\"NAD83("
+        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",42],PARA"
+        "METER[\"central_meridian\",-90],PARAMETER[\"standard_par"
+        "allel_1\",44.0666666666667],PARAMETER[\"standard_paralle"
+        "l_2\",42.7333333333333],PARAMETER[\"false_easting\",6000"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2861\"]]"},
+    {2862, "epsg", 2862,
         "NAD83(HARN) / Wyoming East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wyoming East\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",40.5],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-105.166666666667],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 9,
-        "actor\",0.9999375],PARAMETER[\"false_easting\",200000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2862\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2863, "epsg", 2863,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9"
+        "999375 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wyoming East\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",40.5],PARAMETER[\"c"
+        "entral_meridian\",-105.166666666667],PARAMETER[\"scale_f"
+        "actor\",0.9999375],PARAMETER[\"false_easting\",200000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2862\"]]"},
+    {2863, "epsg", 2863,
         "NAD83(HARN) / Wyoming East Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=400000 +y_0=100000 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wyoming East Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-107.333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",40");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",100000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2863\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2864, "epsg", 2864,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9"
+        "999375 +x_0=400000 +y_0=100000 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wyoming East Central\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM"
+        "ETER[\"central_meridian\",-107.333333333333],PARAMETER[\""
+        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",40"
+        "0000],PARAMETER[\"false_northing\",100000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2863\"]]"},
+    {2864, "epsg", 2864,
         "NAD83(HARN) / Wyoming West Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wyoming West Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-108.75],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9999375],PARAMETER[\"false_easting\",600000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"2864\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2865, "epsg", 2865,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0"
+        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wyoming West Central\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM"
+        "ETER[\"central_meridian\",-108.75],PARAMETER[\"scale_fac"
+        "tor\",0.9999375],PARAMETER[\"false_easting\",600000],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"2864\"]]"},
+    {2865, "epsg", 2865,
         "NAD83(HARN) / Wyoming West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000 +y_0=100000 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wyoming West\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",40.5],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-110.083333333333],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 9,
-        "actor\",0.9999375],PARAMETER[\"false_easting\",800000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",100000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 11,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2865\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2866, "epsg", 2866,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9"
+        "999375 +x_0=800000 +y_0=100000 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wyoming West\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",40.5],PARAMETER[\"c"
+        "entral_meridian\",-110.083333333333],PARAMETER[\"scale_f"
+        "actor\",0.9999375],PARAMETER[\"false_easting\",800000],P"
+        "ARAMETER[\"false_northing\",100000],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2865\"]]"},
+    {2866, "epsg", 2866,
         "NAD83(HARN) / Puerto Rico and Virgin Is.", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +");
-    add_proj4text (p, 2,
-        "x_0=200000 +y_0=200000 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Puerto Rico and Virgin Is.\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference");
-    add_srs_wkt (p, 2,
-        "_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",17.8333333333333],PARAMETER[\"central_meridian\",-66");
-    add_srs_wkt (p, 9,
-        ".4333333333333],PARAMETER[\"standard_parallel_1\",18.433");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"standard_parallel_2\",18.0333333");
-    add_srs_wkt (p, 11,
-        "333333],PARAMETER[\"false_easting\",200000],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",200000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2866\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2867, "epsg", 2867,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333"
+        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +"
+        "x_0=200000 +y_0=200000 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Puerto Rico and Virgin Is.\",GEOG"
+        "CS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference"
+        "_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",17.8333333333333],PARAMETER[\"central_meridian\",-66"
+        ".4333333333333],PARAMETER[\"standard_parallel_1\",18.433"
+        "3333333333],PARAMETER[\"standard_parallel_2\",18.0333333"
+        "333333],PARAMETER[\"false_easting\",200000],PARAMETER[\""
+        "false_northing\",200000],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"2866\"]]"},
+    {2867, "epsg", 2867,
         "NAD83(HARN) / Arizona East (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arizona East (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-110.166666666667],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.9999],PARAMETER[\"false_easting\",700000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHOR");
-    add_srs_wkt (p, 11,
-        "ITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 12,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2867\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2868, "epsg", 2868,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Arizona East (ft)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\""
+        "central_meridian\",-110.166666666667],PARAMETER[\"scale_"
+        "factor\",0.9999],PARAMETER[\"false_easting\",700000],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHOR"
+        "ITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2867\"]]"},
+    {2868, "epsg", 2868,
         "NAD83(HARN) / Arizona Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arizona Central (ft)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-111.916666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",700000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2868\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2869, "epsg", 2869,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Arizona Central (ft)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAMET"
+        "ER[\"central_meridian\",-111.916666666667],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",700000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,A"
+        "UTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2868\"]]"},
+    {2869, "epsg", 2869,
         "NAD83(HARN) / Arizona West (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0");
-    add_proj4text (p, 1,
-        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arizona West (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-113.75],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".999933333],PARAMETER[\"false_easting\",700000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2869\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2870, "epsg", 2870,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0"
+        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Arizona West (ft)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",31],PARAMETER[\""
+        "central_meridian\",-113.75],PARAMETER[\"scale_factor\",0"
+        ".999933333],PARAMETER[\"false_easting\",700000],PARAMETE"
+        "R[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\""
+        "EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"2869\"]]"},
+    {2870, "epsg", 2870,
         "NAD83(HARN) / California zone 1 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3");
-    add_proj4text (p, 1,
-        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000");
-    add_proj4text (p, 2,
-        "00.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 1 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N");
-    add_srs_wkt (p, 2,
-        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",39.3333333333333],PARAMETER[\"central_meridian\",-122],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",41.6666666666667],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",40],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",6561666.667],PARAMETER[\"false_northing\",1640416.");
-    add_srs_wkt (p, 12,
-        "667],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 14,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2870\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2871, "epsg", 2871,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3"
+        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000"
+        "00.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / California zone 1 (ftUS)\",GEOGCS"
+        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N"
+        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",39.3333333333333],PARAMETER[\"central_meridian\",-122],"
+        "PARAMETER[\"standard_parallel_1\",41.6666666666667],PARA"
+        "METER[\"standard_parallel_2\",40],PARAMETER[\"false_east"
+        "ing\",6561666.667],PARAMETER[\"false_northing\",1640416."
+        "667],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY"
+        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"2870\"]]"},
+    {2871, "epsg", 2871,
         "NAD83(HARN) / California zone 2 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00");
-    add_proj4text (p, 2,
-        "01016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 2 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N");
-    add_srs_wkt (p, 2,
-        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",37.6666666666667],PARAMETER[\"central_meridian\",-122],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",39.8333333333333],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",38.3333333333333],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",6561666.667],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",1640416.667],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 13,
-        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 14,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2871\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2872, "epsg", 2872,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333"
+        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00"
+        "01016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,0,0"
+        ",0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / California zone 2 (ftUS)\",GEOGCS"
+        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N"
+        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",37.6666666666667],PARAMETER[\"central_meridian\",-122],"
+        "PARAMETER[\"standard_parallel_1\",39.8333333333333],PARA"
+        "METER[\"standard_parallel_2\",38.3333333333333],PARAMETE"
+        "R[\"false_easting\",6561666.667],PARAMETER[\"false_north"
+        "ing\",1640416.667],UNIT[\"US survey foot\",0.30480060960"
+        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2871\"]]"},
+    {2872, "epsg", 2872,
         "NAD83(HARN) / California zone 3 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0=");
-    add_proj4text (p, 2,
-        "500000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 3 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N");
-    add_srs_wkt (p, 2,
-        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",36.5],PARAMETER[\"central_meridian\",-120.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",38.4333333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",37.0666666666667],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",6561666.667],PARAMETER[\"false_northing\",1640");
-    add_srs_wkt (p, 12,
-        "416.667],UNIT[\"US survey foot\",0.304800609601219,AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 14,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"2872\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2873, "epsg", 2873,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666"
+        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0="
+        "500000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / California zone 3 (ftUS)\",GEOGCS"
+        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N"
+        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",36.5],PARAMETER[\"central_meridian\",-120.5],PARAMETER["
+        "\"standard_parallel_1\",38.4333333333333],PARAMETER[\"st"
+        "andard_parallel_2\",37.0666666666667],PARAMETER[\"false_"
+        "easting\",6561666.667],PARAMETER[\"false_northing\",1640"
+        "416.667],UNIT[\"US survey foot\",0.304800609601219,AUTHO"
+        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"2872\"]]"},
+    {2873, "epsg", 2873,
         "NAD83(HARN) / California zone 4 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333");
-    add_proj4text (p, 1,
-        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600");
-    add_proj4text (p, 2,
-        "1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 4 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N");
-    add_srs_wkt (p, 2,
-        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",35.3333333333333],PARAMETER[\"central_meridian\",-119],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",37.25],PARAMETER[\"sta");
-    add_srs_wkt (p, 10,
-        "ndard_parallel_2\",36],PARAMETER[\"false_easting\",65616");
-    add_srs_wkt (p, 11,
-        "66.667],PARAMETER[\"false_northing\",1640416.667],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"2873\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2874, "epsg", 2874,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333"
+        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600"
+        "1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d"
+        "efs",
+        "PROJCS[\"NAD83(HARN) / California zone 4 (ftUS)\",GEOGCS"
+        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N"
+        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",35.3333333333333],PARAMETER[\"central_meridian\",-119],"
+        "PARAMETER[\"standard_parallel_1\",37.25],PARAMETER[\"sta"
+        "ndard_parallel_2\",36],PARAMETER[\"false_easting\",65616"
+        "66.667],PARAMETER[\"false_northing\",1640416.667],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"2873\"]]"},
+    {2874, "epsg", 2874,
         "NAD83(HARN) / California zone 5 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50");
-    add_proj4text (p, 2,
-        "0000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 5 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N");
-    add_srs_wkt (p, 2,
-        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",33.5],PARAMETER[\"central_meridian\",-118],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",35.4666666666667],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",34.0333333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",6561666.667],PARAMETER[\"false_northing\",164041");
-    add_srs_wkt (p, 12,
-        "6.667],UNIT[\"US survey foot\",0.304800609601219,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"2874\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2875, "epsg", 2875,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333"
+        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50"
+        "0000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / California zone 5 (ftUS)\",GEOGCS"
+        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N"
+        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",33.5],PARAMETER[\"central_meridian\",-118],PARAMETER[\""
+        "standard_parallel_1\",35.4666666666667],PARAMETER[\"stan"
+        "dard_parallel_2\",34.0333333333333],PARAMETER[\"false_ea"
+        "sting\",6561666.667],PARAMETER[\"false_northing\",164041"
+        "6.667],UNIT[\"US survey foot\",0.304800609601219,AUTHORI"
+        "TY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"2874\"]]"},
+    {2875, "epsg", 2875,
         "NAD83(HARN) / California zone 6 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000");
-    add_proj4text (p, 2,
-        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California zone 6 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N");
-    add_srs_wkt (p, 2,
-        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",32.1666666666667],PARAMETER[\"central_meridian\",-116.2");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_1\",33.8833333333333],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",32.7833333333333],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",6561666.667],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",1640416.667],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 13,
-        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2875\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2876, "epsg", 2876,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333"
+        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000"
+        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / California zone 6 (ftUS)\",GEOGCS"
+        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N"
+        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",32.1666666666667],PARAMETER[\"central_meridian\",-116.2"
+        "5],PARAMETER[\"standard_parallel_1\",33.8833333333333],P"
+        "ARAMETER[\"standard_parallel_2\",32.7833333333333],PARAM"
+        "ETER[\"false_easting\",6561666.667],PARAMETER[\"false_no"
+        "rthing\",1640416.667],UNIT[\"US survey foot\",0.30480060"
+        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2875\""
+        "]]"},
+    {2876, "epsg", 2876,
         "NAD83(HARN) / Colorado North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Colorado North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-105.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",40.7833333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",39.7166666666667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",3000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",1000000],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2876\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2877, "epsg", 2877,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666"
+        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8"
+        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Colorado North (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39"
+        ".3333333333333],PARAMETER[\"central_meridian\",-105.5],P"
+        "ARAMETER[\"standard_parallel_1\",40.7833333333333],PARAM"
+        "ETER[\"standard_parallel_2\",39.7166666666667],PARAMETER"
+        "[\"false_easting\",3000000],PARAMETER[\"false_northing\""
+        ",1000000],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2876\"]]"},
+    {2877, "epsg", 2877,
         "NAD83(HARN) / Colorado Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333");
-    add_proj4text (p, 1,
-        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60");
-    add_proj4text (p, 2,
-        "96012192 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Colorado Central (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",37.8333333333333],PARAMETER[\"central_meridian\",-105.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",39.75],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",38.45],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "3000000],PARAMETER[\"false_northing\",1000000],UNIT[\"US");
-    add_srs_wkt (p, 12,
-        " survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "03\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 14,
-        "UTHORITY[\"EPSG\",\"2877\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2878, "epsg", 2878,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333"
+        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60"
+        "96012192 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(HARN) / Colorado Central (ftUS)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",37.8333333333333],PARAMETER[\"central_meridian\",-105.5"
+        "],PARAMETER[\"standard_parallel_1\",39.75],PARAMETER[\"s"
+        "tandard_parallel_2\",38.45],PARAMETER[\"false_easting\","
+        "3000000],PARAMETER[\"false_northing\",1000000],UNIT[\"US"
+        " survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"90"
+        "03\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"2877\"]]"},
+    {2878, "epsg", 2878,
         "NAD83(HARN) / Colorado South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Colorado South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-105.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",38.4333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",37.2333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",3000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",1000000],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2878\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2879, "epsg", 2879,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333"
+        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8"
+        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Colorado South (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36"
+        ".6666666666667],PARAMETER[\"central_meridian\",-105.5],P"
+        "ARAMETER[\"standard_parallel_1\",38.4333333333333],PARAM"
+        "ETER[\"standard_parallel_2\",37.2333333333333],PARAMETER"
+        "[\"false_easting\",3000000],PARAMETER[\"false_northing\""
+        ",1000000],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2878\"]]"},
+    {2879, "epsg", 2879,
         "NAD83(HARN) / Connecticut (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40");
-    add_proj4text (p, 1,
-        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_");
-    add_proj4text (p, 2,
-        "0=152400.3048006096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 3,
-        "+units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Connecticut (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.8");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-72.75],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",41.8666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",41.2],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",1000000],PARAMETER[\"false_northing\",500000],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"2879\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2880, "epsg", 2880,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40"
+        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_"
+        "0=152400.3048006096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Connecticut (ftUS)\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.8"
+        "333333333333],PARAMETER[\"central_meridian\",-72.75],PAR"
+        "AMETER[\"standard_parallel_1\",41.8666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",41.2],PARAMETER[\"false_easti"
+        "ng\",1000000],PARAMETER[\"false_northing\",500000],UNIT["
+        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\","
+        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"2879\"]]"},
+    {2880, "epsg", 2880,
         "NAD83(HARN) / Delaware (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Delaware (ftUS)\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-75.4166666666667],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.999995],PARAMETER[\"false_easting\",656166.66");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 11,
-        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"2880\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2881, "epsg", 2881,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999"
+        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Delaware (ftUS)\",GEOGCS[\"NAD83("
+        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\""
+        "central_meridian\",-75.4166666666667],PARAMETER[\"scale_"
+        "factor\",0.999995],PARAMETER[\"false_easting\",656166.66"
+        "7],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot"
+        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"2880\"]]"},
+    {2881, "epsg", 2881,
         "NAD83(HARN) / Florida East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Florida East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",24.33333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-81],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.999941177],PARAMETER[\"false_easting\",6");
-    add_srs_wkt (p, 10,
-        "56166.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 11,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"2881\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2882, "epsg", 2882,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999"
+        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Florida East (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",24.33333333"
+        "33333],PARAMETER[\"central_meridian\",-81],PARAMETER[\"s"
+        "cale_factor\",0.999941177],PARAMETER[\"false_easting\",6"
+        "56166.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2881\"]]"},
+    {2882, "epsg", 2882,
         "NAD83(HARN) / Florida West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Florida West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",24.33333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-82],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.999941177],PARAMETER[\"false_easting\",6");
-    add_srs_wkt (p, 10,
-        "56166.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 11,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"2882\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2883, "epsg", 2883,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999"
+        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Florida West (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",24.33333333"
+        "33333],PARAMETER[\"central_meridian\",-82],PARAMETER[\"s"
+        "cale_factor\",0.999941177],PARAMETER[\"false_easting\",6"
+        "56166.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2882\"]]"},
+    {2883, "epsg", 2883,
         "NAD83(HARN) / Florida North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2");
-    add_proj4text (p, 1,
-        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Florida North (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"central_meridian\",-84.5],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_1\",30.75],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",29.5833333333333],PARAMETER[\"false_easting\",1968500],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 12,
-        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"2883\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2884, "epsg", 2884,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2"
+        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Florida North (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29]"
+        ",PARAMETER[\"central_meridian\",-84.5],PARAMETER[\"stand"
+        "ard_parallel_1\",30.75],PARAMETER[\"standard_parallel_2\""
+        ",29.5833333333333],PARAMETER[\"false_easting\",1968500],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\","
+        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"2883\"]]"},
+    {2884, "epsg", 2884,
         "NAD83(HARN) / Georgia East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Georgia East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-82.1666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",656166");
-    add_srs_wkt (p, 10,
-        ".667],PARAMETER[\"false_northing\",0],UNIT[\"US survey f");
-    add_srs_wkt (p, 11,
-        "oot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"2884\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2885, "epsg", 2885,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999"
+        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Georgia East (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET"
+        "ER[\"central_meridian\",-82.1666666666667],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",656166"
+        ".667],PARAMETER[\"false_northing\",0],UNIT[\"US survey f"
+        "oot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"2884\"]]"},
+    {2885, "epsg", 2885,
         "NAD83(HARN) / Georgia West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Georgia West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-84.1666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",229658");
-    add_srs_wkt (p, 10,
-        "3.333],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 11,
-        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"2885\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2886, "epsg", 2886,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999"
+        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Georgia West (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET"
+        "ER[\"central_meridian\",-84.1666666666667],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",229658"
+        "3.333],PARAMETER[\"false_northing\",0],UNIT[\"US survey "
+        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"2885\"]]"},
+    {2886, "epsg", 2886,
         "NAD83(HARN) / Idaho East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Idaho East (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",41.6666666666667");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-112.166666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999947368],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",656166.667],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"2886\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2887, "epsg", 2887,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666"
+        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(HARN) / Idaho East (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",41.6666666666667"
+        "],PARAMETER[\"central_meridian\",-112.166666666667],PARA"
+        "METER[\"scale_factor\",0.999947368],PARAMETER[\"false_ea"
+        "sting\",656166.667],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"2886\"]]"},
+    {2887, "epsg", 2887,
         "NAD83(HARN) / Idaho Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99");
-    add_proj4text (p, 1,
-        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Idaho Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",41.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-114],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999947368],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "1640416.667],PARAMETER[\"false_northing\",0],UNIT[\"US s");
-    add_srs_wkt (p, 11,
-        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2887\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2888, "epsg", 2888,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99"
+        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8"
+        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Idaho Central (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",41.66666666"
+        "66667],PARAMETER[\"central_meridian\",-114],PARAMETER[\""
+        "scale_factor\",0.999947368],PARAMETER[\"false_easting\","
+        "1640416.667],PARAMETER[\"false_northing\",0],UNIT[\"US s"
+        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2887\"]]"},
+    {2888, "epsg", 2888,
         "NAD83(HARN) / Idaho West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0");
-    add_proj4text (p, 1,
-        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Idaho West (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",41.6666666666667");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-115.75],PARAMETER[\"sc");
-    add_srs_wkt (p, 9,
-        "ale_factor\",0.999933333],PARAMETER[\"false_easting\",26");
-    add_srs_wkt (p, 10,
-        "24666.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 11,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"2888\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2889, "epsg", 2889,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0"
+        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +t"
+        "owgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Idaho West (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",41.6666666666667"
+        "],PARAMETER[\"central_meridian\",-115.75],PARAMETER[\"sc"
+        "ale_factor\",0.999933333],PARAMETER[\"false_easting\",26"
+        "24666.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2888\"]]"},
+    {2889, "epsg", 2889,
         "NAD83(HARN) / Indiana East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249364.9987299975 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Indiana East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-85.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999966667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "328083.333],PARAMETER[\"false_northing\",820208.333],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"2967\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2890, "epsg", 2890,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9"
+        "99966667 +x_0=99999.99989839978 +y_0=249364.9987299975 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Indiana East (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-85.6666666666667],PARAMETER[\""
+        "scale_factor\",0.999966667],PARAMETER[\"false_easting\","
+        "328083.333],PARAMETER[\"false_northing\",820208.333],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"2967\"]]"},
+    {2890, "epsg", 2890,
         "NAD83(HARN) / Indiana West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249364.9987299975 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Indiana West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-87.0833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999966667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "2952750],PARAMETER[\"false_northing\",820208.333],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"2968\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2891, "epsg", 2891,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9"
+        "99966667 +x_0=900000 +y_0=249364.9987299975 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Indiana West (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-87.0833333333333],PARAMETER[\""
+        "scale_factor\",0.999966667],PARAMETER[\"false_easting\","
+        "2952750],PARAMETER[\"false_northing\",820208.333],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"2968\"]]"},
+    {2891, "epsg", 2891,
         "NAD83(HARN) / Kentucky North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kentucky North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37");
-    add_srs_wkt (p, 8,
-        ".5],PARAMETER[\"central_meridian\",-84.25],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",37.9666666666667],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",38.9666666666667],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",1640416.667],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"2891\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2892, "epsg", 2892,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666"
+        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no"
+        "_defs",
+        "PROJCS[\"NAD83(HARN) / Kentucky North (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37"
+        ".5],PARAMETER[\"central_meridian\",-84.25],PARAMETER[\"s"
+        "tandard_parallel_1\",37.9666666666667],PARAMETER[\"stand"
+        "ard_parallel_2\",38.9666666666667],PARAMETER[\"false_eas"
+        "ting\",1640416.667],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"2891\"]]"},
+    {2892, "epsg", 2892,
         "NAD83(HARN) / Kentucky South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kentucky South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-85.75],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",37.9333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",36.7333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",1640416.667],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",1640416.667],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 13,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2892\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2893, "epsg", 2893,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333"
+        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0"
+        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Kentucky South (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36"
+        ".3333333333333],PARAMETER[\"central_meridian\",-85.75],P"
+        "ARAMETER[\"standard_parallel_1\",37.9333333333333],PARAM"
+        "ETER[\"standard_parallel_2\",36.7333333333333],PARAMETER"
+        "[\"false_easting\",1640416.667],PARAMETER[\"false_northi"
+        "ng\",1640416.667],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2892\"]]"},
+    {2893, "epsg", 2893,
         "NAD83(HARN) / Maryland (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Maryland (ftUS)\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-77],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",39.45],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",38.3],PARAMETER[\"false_easting\",1312333.333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 12,
-        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"2893\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2894, "epsg", 2894,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666"
+        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8"
+        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Maryland (ftUS)\",GEOGCS[\"NAD83("
+        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37.66666"
+        "66666667],PARAMETER[\"central_meridian\",-77],PARAMETER["
+        "\"standard_parallel_1\",39.45],PARAMETER[\"standard_para"
+        "llel_2\",38.3],PARAMETER[\"false_easting\",1312333.333],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\","
+        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"2893\"]]"},
+    {2894, "epsg", 2894,
         "NAD83(HARN) / Massachusetts Mainland (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7");
-    add_proj4text (p, 2,
-        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Massachusetts Mainland (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refere");
-    add_srs_wkt (p, 2,
-        "nce_Network\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"615");
-    add_srs_wkt (p, 4,
-        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",41],PARAMETER[\"central_meridian\",-71.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",42.6833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",41.7166666666667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",656166.667],PARAMETER[\"false_northing\",246");
-    add_srs_wkt (p, 12,
-        "0625],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2894\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2895, "epsg", 2895,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666"
+        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7"
+        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(HARN) / Massachusetts Mainland (ftUS)\",G"
+        "EOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refere"
+        "nce_Network\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"615"
+        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",41],PARAMETER[\"central_meridian\",-71.5],PARAMET"
+        "ER[\"standard_parallel_1\",42.6833333333333],PARAMETER[\""
+        "standard_parallel_2\",41.7166666666667],PARAMETER[\"fals"
+        "e_easting\",656166.667],PARAMETER[\"false_northing\",246"
+        "0625],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2894\"]]"},
+    {2895, "epsg", 2895,
         "NAD83(HARN) / Massachusetts Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Massachusetts Island (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc");
-    add_srs_wkt (p, 2,
-        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",41],PARAMETER[\"central_meridian\",-70.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",41.4833333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",41.2833333333333],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",1640416.667],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 14,
-        "NORTH],AUTHORITY[\"EPSG\",\"2895\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2896, "epsg", 2896,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333"
+        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(HARN) / Massachusetts Island (ftUS)\",GEO"
+        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc"
+        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",41],PARAMETER[\"central_meridian\",-70.5],PARAMETER["
+        "\"standard_parallel_1\",41.4833333333333],PARAMETER[\"st"
+        "andard_parallel_2\",41.2833333333333],PARAMETER[\"false_"
+        "easting\",1640416.667],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPS"
+        "G\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"2895\"]]"},
+    {2896, "epsg", 2896,
         "NAD83(HARN) / Michigan North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999");
-    add_proj4text (p, 2,
-        "968001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Michigan North (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44.");
-    add_srs_wkt (p, 8,
-        "7833333333333],PARAMETER[\"central_meridian\",-87],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",47.0833333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",45.4833333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",26246719.16],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"2896\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2897, "epsg", 2897,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333"
+        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999"
+        "968001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Michigan North (ft)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44."
+        "7833333333333],PARAMETER[\"central_meridian\",-87],PARAM"
+        "ETER[\"standard_parallel_1\",47.0833333333333],PARAMETER"
+        "[\"standard_parallel_2\",45.4833333333333],PARAMETER[\"f"
+        "alse_easting\",26246719.16],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"2896\"]]"},
+    {2897, "epsg", 2897,
         "NAD83(HARN) / Michigan Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9");
-    add_proj4text (p, 2,
-        "99976001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Michigan Central (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43");
-    add_srs_wkt (p, 8,
-        ".3166666666667],PARAMETER[\"central_meridian\",-84.36666");
-    add_srs_wkt (p, 9,
-        "66666667],PARAMETER[\"standard_parallel_1\",45.7],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",44.1833333333333],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",19685039.37],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"2897\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2898, "epsg", 2898,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43"
+        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9"
+        "99976001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Michigan Central (ft)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43"
+        ".3166666666667],PARAMETER[\"central_meridian\",-84.36666"
+        "66666667],PARAMETER[\"standard_parallel_1\",45.7],PARAME"
+        "TER[\"standard_parallel_2\",44.1833333333333],PARAMETER["
+        "\"false_easting\",19685039.37],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"2897\"]]"},
+    {2898, "epsg", 2898,
         "NAD83(HARN) / Michigan South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Michigan South (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"central_meridian\",-84.3666666666667],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",43.6666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",42.1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",13123359.58],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "2898\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2899, "epsg", 2899,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41"
+        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Michigan South (ft)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41."
+        "5],PARAMETER[\"central_meridian\",-84.3666666666667],PAR"
+        "AMETER[\"standard_parallel_1\",43.6666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",42.1],PARAMETER[\"false_easti"
+        "ng\",13123359.58],PARAMETER[\"false_northing\",0],UNIT[\""
+        "foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2898\"]]"},
+    {2899, "epsg", 2899,
         "NAD83(HARN) / Mississippi East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Mississippi East (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-88.8333333333333],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",984250],PARAMETER[\"false_northing\",0],UNIT[\"US surve");
-    add_srs_wkt (p, 11,
-        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"2899\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2900, "epsg", 2900,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9"
+        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Mississippi East (ftUS)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P"
+        "ARAMETER[\"central_meridian\",-88.8333333333333],PARAMET"
+        "ER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\""
+        ",984250],PARAMETER[\"false_northing\",0],UNIT[\"US surve"
+        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"2899\"]]"},
+    {2900, "epsg", 2900,
         "NAD83(HARN) / Mississippi West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Mississippi West (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-90.3333333333333],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",2296583.333],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 11,
-        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"2900\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2901, "epsg", 2901,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9"
+        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Mississippi West (ftUS)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P"
+        "ARAMETER[\"central_meridian\",-90.3333333333333],PARAMET"
+        "ER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\""
+        ",2296583.333],PARAMETER[\"false_northing\",0],UNIT[\"US "
+        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900"
+        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2900\"]]"},
+    {2901, "epsg", 2901,
         "NAD83(HARN) / Montana (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Montana (ft)\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",44.25],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-109.5],PARAMETER[\"standard_");
-    add_srs_wkt (p, 9,
-        "parallel_1\",49],PARAMETER[\"standard_parallel_2\",45],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_easting\",1968503.937],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"2901\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2902, "epsg", 2902,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5"
+        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Montana (ft)\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",44.25],PARA"
+        "METER[\"central_meridian\",-109.5],PARAMETER[\"standard_"
+        "parallel_1\",49],PARAMETER[\"standard_parallel_2\",45],P"
+        "ARAMETER[\"false_easting\",1968503.937],PARAMETER[\"fals"
+        "e_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\","
+        "\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"2901\"]]"},
+    {2902, "epsg", 2902,
         "NAD83(HARN) / New Mexico East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Mexico East (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"central_meridian\",-104.333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999909091],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "541337.5],PARAMETER[\"false_northing\",0],UNIT[\"US surv");
-    add_srs_wkt (p, 11,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"2902\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2903, "epsg", 2903,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999"
+        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New Mexico East (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAME"
+        "TER[\"central_meridian\",-104.333333333333],PARAMETER[\""
+        "scale_factor\",0.999909091],PARAMETER[\"false_easting\","
+        "541337.5],PARAMETER[\"false_northing\",0],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"2902\"]]"},
+    {2903, "epsg", 2903,
         "NAD83(HARN) / New Mexico Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00.0001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Mexico Central (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_");
-    add_srs_wkt (p, 2,
-        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-106.25],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",1640416.66");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 11,
-        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"2903\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2904, "epsg", 2904,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000"
+        "00.0001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New Mexico Central (ftUS)\",GEOGC"
+        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_"
+        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],P"
+        "ARAMETER[\"central_meridian\",-106.25],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",1640416.66"
+        "7],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot"
+        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"2903\"]]"},
+    {2904, "epsg", 2904,
         "NAD83(HARN) / New Mexico West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Mexico West (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"central_meridian\",-107.833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999916667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "2723091.667],PARAMETER[\"false_northing\",0],UNIT[\"US s");
-    add_srs_wkt (p, 11,
-        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2904\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2905, "epsg", 2905,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999"
+        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New Mexico West (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAME"
+        "TER[\"central_meridian\",-107.833333333333],PARAMETER[\""
+        "scale_factor\",0.999916667],PARAMETER[\"false_easting\","
+        "2723091.667],PARAMETER[\"false_northing\",0],UNIT[\"US s"
+        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2904\"]]"},
+    {2905, "epsg", 2905,
         "NAD83(HARN) / New York East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New York East (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",38.83333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",49212");
-    add_srs_wkt (p, 10,
-        "5],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 11,
-        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"2905\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2906, "epsg", 2906,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New York East (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",38.83333333"
+        "33333],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",49212"
+        "5],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot"
+        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"2905\"]]"},
+    {2906, "epsg", 2906,
         "NAD83(HARN) / New York Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New York Central (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",40],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-76.5833333333333],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",0.9999375],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",820208.333],PARAMETER[\"false_northing\",0],UNIT[\"US s");
-    add_srs_wkt (p, 11,
-        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"2906\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2907, "epsg", 2907,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999"
+        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New York Central (ftUS)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",40],PAR"
+        "AMETER[\"central_meridian\",-76.5833333333333],PARAMETER"
+        "[\"scale_factor\",0.9999375],PARAMETER[\"false_easting\""
+        ",820208.333],PARAMETER[\"false_northing\",0],UNIT[\"US s"
+        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2906\"]]"},
+    {2907, "epsg", 2907,
         "NAD83(HARN) / New York West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New York West (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",40],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-78.5833333333333],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.9999375],PARAMETER[\"false_easting\",114");
-    add_srs_wkt (p, 10,
-        "8291.667],PARAMETER[\"false_northing\",0],UNIT[\"US surv");
-    add_srs_wkt (p, 11,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"2907\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2908, "epsg", 2908,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999"
+        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New York West (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",40],PARAMET"
+        "ER[\"central_meridian\",-78.5833333333333],PARAMETER[\"s"
+        "cale_factor\",0.9999375],PARAMETER[\"false_easting\",114"
+        "8291.667],PARAMETER[\"false_northing\",0],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"2907\"]]"},
+    {2908, "epsg", 2908,
         "NAD83(HARN) / New York Long Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000");
-    add_proj4text (p, 2,
-        "000001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New York Long Island (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc");
-    add_srs_wkt (p, 2,
-        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",40.1666666666667],PARAMETER[\"central_meridian\",-74");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",41.0333333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",40.6666666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",984250],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2908\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2909, "epsg", 2909,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666"
+        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000"
+        "000001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New York Long Island (ftUS)\",GEO"
+        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc"
+        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",40.1666666666667],PARAMETER[\"central_meridian\",-74"
+        "],PARAMETER[\"standard_parallel_1\",41.0333333333333],PA"
+        "RAMETER[\"standard_parallel_2\",40.6666666666667],PARAME"
+        "TER[\"false_easting\",984250],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2908\"]]"},
+    {2909, "epsg", 2909,
         "NAD83(HARN) / North Dakota North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / North Dakota North (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",47],PARAMETER[\"central_meridian\",-100.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",48.7333333333333],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",47.4333333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",1968503.937],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"2909\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2910, "epsg", 2910,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333"
+        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / North Dakota North (ft)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",47],PARAMETER[\"central_meridian\",-100.5],PARAMETER[\""
+        "standard_parallel_1\",48.7333333333333],PARAMETER[\"stan"
+        "dard_parallel_2\",47.4333333333333],PARAMETER[\"false_ea"
+        "sting\",1968503.937],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"2909\"]]"},
+    {2910, "epsg", 2910,
         "NAD83(HARN) / North Dakota South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9");
-    add_proj4text (p, 2,
-        "999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / North Dakota South (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",45.6666666666667],PARAMETER[\"central_meridian\",-100.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",47.4833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",46.1833333333333],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1968503.937],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"2910\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2911, "epsg", 2911,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333"
+        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9"
+        "999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / North Dakota South (ft)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",45.6666666666667],PARAMETER[\"central_meridian\",-100.5"
+        "],PARAMETER[\"standard_parallel_1\",47.4833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",46.1833333333333],PARAME"
+        "TER[\"false_easting\",1968503.937],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900"
+        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2910\"]]"},
+    {2911, "epsg", 2911,
         "NAD83(HARN) / Oklahoma North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oklahoma North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",35");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-98],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",36.7666666666667],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 10,
-        "arallel_2\",35.5666666666667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US surv");
-    add_srs_wkt (p, 12,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"2911\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2912, "epsg", 2912,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666"
+        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oklahoma North (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",35"
+        "],PARAMETER[\"central_meridian\",-98],PARAMETER[\"standa"
+        "rd_parallel_1\",36.7666666666667],PARAMETER[\"standard_p"
+        "arallel_2\",35.5666666666667],PARAMETER[\"false_easting\""
+        ",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"2911\"]]"},
+    {2912, "epsg", 2912,
         "NAD83(HARN) / Oklahoma South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oklahoma South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-98],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",35.2333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",33.9333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",1968500],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2912\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2913, "epsg", 2913,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333"
+        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(HARN) / Oklahoma South (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33"
+        ".3333333333333],PARAMETER[\"central_meridian\",-98],PARA"
+        "METER[\"standard_parallel_1\",35.2333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",33.9333333333333],PARAMETER[\""
+        "false_easting\",1968500],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E"
+        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"2912\"]]"},
+    {2913, "epsg", 2913,
         "NAD83(HARN) / Oregon North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oregon North (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-120.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",46],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",44.3333333333333],PARAMETER[\"false_easting\",8");
-    add_srs_wkt (p, 11,
-        "202099.738],PARAMETER[\"false_northing\",0],UNIT[\"foot\"");
-    add_srs_wkt (p, 12,
-        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2913\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2914, "epsg", 2914,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6"
+        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oregon North (ft)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43.66666"
+        "66666667],PARAMETER[\"central_meridian\",-120.5],PARAMET"
+        "ER[\"standard_parallel_1\",46],PARAMETER[\"standard_para"
+        "llel_2\",44.3333333333333],PARAMETER[\"false_easting\",8"
+        "202099.738],PARAMETER[\"false_northing\",0],UNIT[\"foot\""
+        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2913\""
+        "]]"},
+    {2914, "epsg", 2914,
         "NAD83(HARN) / Oregon South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oregon South (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-120.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",44],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",42.3333333333333],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 11,
-        "921259.843],PARAMETER[\"false_northing\",0],UNIT[\"foot\"");
-    add_srs_wkt (p, 12,
-        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2914\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2915, "epsg", 2915,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6"
+        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oregon South (ft)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.66666"
+        "66666667],PARAMETER[\"central_meridian\",-120.5],PARAMET"
+        "ER[\"standard_parallel_1\",44],PARAMETER[\"standard_para"
+        "llel_2\",42.3333333333333],PARAMETER[\"false_easting\",4"
+        "921259.843],PARAMETER[\"false_northing\",0],UNIT[\"foot\""
+        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2914\""
+        "]]"},
+    {2915, "epsg", 2915,
         "NAD83(HARN) / Tennessee (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Tennessee (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-86],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",36.4166666666667],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",35.25],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 11,
-        "968500],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 12,
-        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"2915\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2916, "epsg", 2916,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3"
+        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Tennessee (ftUS)\",GEOGCS[\"NAD83"
+        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34.33333"
+        "33333333],PARAMETER[\"central_meridian\",-86],PARAMETER["
+        "\"standard_parallel_1\",36.4166666666667],PARAMETER[\"st"
+        "andard_parallel_2\",35.25],PARAMETER[\"false_easting\",1"
+        "968500],PARAMETER[\"false_northing\",0],UNIT[\"US survey"
+        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"2915\"]]"},
+    {2916, "epsg", 2916,
         "NAD83(HARN) / Texas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989");
-    add_proj4text (p, 2,
-        "83998 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas North (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-101.5],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_1\",36.1833333333333],PARAMETER[\"standard_");
-    add_srs_wkt (p, 10,
-        "parallel_2\",34.65],PARAMETER[\"false_easting\",656166.6");
-    add_srs_wkt (p, 11,
-        "67],PARAMETER[\"false_northing\",3280833.333],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"2916\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2917, "epsg", 2917,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3"
+        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989"
+        "83998 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas North (ftUS)\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34],"
+        "PARAMETER[\"central_meridian\",-101.5],PARAMETER[\"stand"
+        "ard_parallel_1\",36.1833333333333],PARAMETER[\"standard_"
+        "parallel_2\",34.65],PARAMETER[\"false_easting\",656166.6"
+        "67],PARAMETER[\"false_northing\",3280833.333],UNIT[\"US "
+        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900"
+        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2916\"]]"},
+    {2917, "epsg", 2917,
         "NAD83(HARN) / Texas North Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 3,
-        "units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas North Central (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference");
-    add_srs_wkt (p, 2,
-        "_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",31.6666666666667],PARAMETER[\"central_meridian\",-98");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"standard_parallel_1\",33.9666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",32.1333333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",1968500],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",6561666.667],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 13,
-        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 14,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2917\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2918, "epsg", 2918,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333"
+        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y"
+        "_0=2000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas North Central (ftUS)\",GEOG"
+        "CS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference"
+        "_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",31.6666666666667],PARAMETER[\"central_meridian\",-98"
+        ".5],PARAMETER[\"standard_parallel_1\",33.9666666666667],"
+        "PARAMETER[\"standard_parallel_2\",32.1333333333333],PARA"
+        "METER[\"false_easting\",1968500],PARAMETER[\"false_north"
+        "ing\",6561666.667],UNIT[\"US survey foot\",0.30480060960"
+        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2917\"]]"},
+    {2918, "epsg", 2918,
         "NAD83(HARN) / Texas Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 3,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29.");
-    add_srs_wkt (p, 8,
-        "6666666666667],PARAMETER[\"central_meridian\",-100.33333");
-    add_srs_wkt (p, 9,
-        "3333333],PARAMETER[\"standard_parallel_1\",31.8833333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"standard_parallel_2\",30.1166666666667]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",2296583.333],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_northing\",9842500],UNIT[\"US survey foot\",0.304800");
-    add_srs_wkt (p, 13,
-        "609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"291");
-    add_srs_wkt (p, 15,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2919, "epsg", 2919,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666"
+        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +"
+        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas Central (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29."
+        "6666666666667],PARAMETER[\"central_meridian\",-100.33333"
+        "3333333],PARAMETER[\"standard_parallel_1\",31.8833333333"
+        "333],PARAMETER[\"standard_parallel_2\",30.1166666666667]"
+        ",PARAMETER[\"false_easting\",2296583.333],PARAMETER[\"fa"
+        "lse_northing\",9842500],UNIT[\"US survey foot\",0.304800"
+        "609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"291"
+        "8\"]]"},
+    {2919, "epsg", 2919,
         "NAD83(HARN) / Texas South Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=3999999.9998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 3,
-        "its=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas South Central (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference");
-    add_srs_wkt (p, 2,
-        "_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",27.8333333333333],PARAMETER[\"central_meridian\",-99");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",30.2833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",28.3833333333333],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1968500],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",13123333.333],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 13,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2919\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2920, "epsg", 2920,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333"
+        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0"
+        "=3999999.9998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un"
+        "its=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas South Central (ftUS)\",GEOG"
+        "CS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference"
+        "_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",27.8333333333333],PARAMETER[\"central_meridian\",-99"
+        "],PARAMETER[\"standard_parallel_1\",30.2833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",28.3833333333333],PARAME"
+        "TER[\"false_easting\",1968500],PARAMETER[\"false_northin"
+        "g\",13123333.333],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2919\"]]"},
+    {2920, "epsg", 2920,
         "NAD83(HARN) / Texas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00");
-    add_proj4text (p, 2,
-        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas South (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",25.6");
-    add_srs_wkt (p, 8,
-        "666666666667],PARAMETER[\"central_meridian\",-98.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",27.8333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",26.1666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",984250],PARAMETER[\"false_northing\",164");
-    add_srs_wkt (p, 12,
-        "04166.667],UNIT[\"US survey foot\",0.304800609601219,AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2920\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2921, "epsg", 2921,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666"
+        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00"
+        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas South (ftUS)\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",25.6"
+        "666666666667],PARAMETER[\"central_meridian\",-98.5],PARA"
+        "METER[\"standard_parallel_1\",27.8333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",26.1666666666667],PARAMETER[\""
+        "false_easting\",984250],PARAMETER[\"false_northing\",164"
+        "04166.667],UNIT[\"US survey foot\",0.304800609601219,AUT"
+        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2920\"]]"},
+    {2921, "epsg", 2921,
         "NAD83(HARN) / Utah North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001504 +y_0=999999.9999960001 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah North (ft)\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-111.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",41.7833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",40.7166666666667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",1640419.948],PARAMETER[\"false_northing\",32");
-    add_srs_wkt (p, 12,
-        "80839.895],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"2921\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2922, "epsg", 2922,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0"
+        "001504 +y_0=999999.9999960001 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah North (ft)\",GEOGCS[\"NAD83("
+        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.33333"
+        "33333333],PARAMETER[\"central_meridian\",-111.5],PARAMET"
+        "ER[\"standard_parallel_1\",41.7833333333333],PARAMETER[\""
+        "standard_parallel_2\",40.7166666666667],PARAMETER[\"fals"
+        "e_easting\",1640419.948],PARAMETER[\"false_northing\",32"
+        "80839.895],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900"
+        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2921\"]]"},
+    {2922, "epsg", 2922,
         "NAD83(HARN) / Utah Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.0001504 +y_0=");
-    add_proj4text (p, 2,
-        "1999999.999992 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah Central (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-111.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",40.65],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 10,
-        "arallel_2\",39.0166666666667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1640419.948],PARAMETER[\"false_northing\",6561679.79],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"2922\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2923, "epsg", 2923,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000.0001504 +y_0="
+        "1999999.999992 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah Central (ft)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38.33333"
+        "33333333],PARAMETER[\"central_meridian\",-111.5],PARAMET"
+        "ER[\"standard_parallel_1\",40.65],PARAMETER[\"standard_p"
+        "arallel_2\",39.0166666666667],PARAMETER[\"false_easting\""
+        ",1640419.948],PARAMETER[\"false_northing\",6561679.79],U"
+        "NIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"2922\"]]"},
+    {2923, "epsg", 2923,
         "NAD83(HARN) / Utah South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.0001504 +y_0=");
-    add_proj4text (p, 2,
-        "2999999.999988 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah South (ft)\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-111.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",38.35],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 10,
-        "arallel_2\",37.2166666666667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1640419.948],PARAMETER[\"false_northing\",9842519.685],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"2923\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2924, "epsg", 2924,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000.0001504 +y_0="
+        "2999999.999988 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah South (ft)\",GEOGCS[\"NAD83("
+        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.66666"
+        "66666667],PARAMETER[\"central_meridian\",-111.5],PARAMET"
+        "ER[\"standard_parallel_1\",38.35],PARAMETER[\"standard_p"
+        "arallel_2\",37.2166666666667],PARAMETER[\"false_easting\""
+        ",1640419.948],PARAMETER[\"false_northing\",9842519.685],"
+        "UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"2923\"]]"},
+    {2924, "epsg", 2924,
         "NAD83(HARN) / Virginia North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2");
-    add_proj4text (p, 2,
-        "000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Virginia North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-78.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",39.2],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",38.0333333333333],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",11482916.667],PARAMETER[\"false_northing\",6561666");
-    add_srs_wkt (p, 12,
-        ".667],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2924\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2925, "epsg", 2925,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37"
+        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2"
+        "000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Virginia North (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37"
+        ".6666666666667],PARAMETER[\"central_meridian\",-78.5],PA"
+        "RAMETER[\"standard_parallel_1\",39.2],PARAMETER[\"standa"
+        "rd_parallel_2\",38.0333333333333],PARAMETER[\"false_east"
+        "ing\",11482916.667],PARAMETER[\"false_northing\",6561666"
+        ".667],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2924\"]]"},
+    {2925, "epsg", 2925,
         "NAD83(HARN) / Virginia South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0");
-    add_proj4text (p, 2,
-        "001016 +y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Virginia South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-78.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",37.9666666666667],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",36.7666666666667],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",11482916.667],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",3280833.333],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 13,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2925\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2926, "epsg", 2926,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666"
+        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0"
+        "001016 +y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Virginia South (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36"
+        ".3333333333333],PARAMETER[\"central_meridian\",-78.5],PA"
+        "RAMETER[\"standard_parallel_1\",37.9666666666667],PARAME"
+        "TER[\"standard_parallel_2\",36.7666666666667],PARAMETER["
+        "\"false_easting\",11482916.667],PARAMETER[\"false_northi"
+        "ng\",3280833.333],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2925\"]]"},
+    {2926, "epsg", 2926,
         "NAD83(HARN) / Washington North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Washington North (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",47],PARAMETER[\"central_meridian\",-120.833333333333],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",48.7333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",47.5],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",1640416.667],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"2926\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2927, "epsg", 2927,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47"
+        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(HARN) / Washington North (ftUS)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",47],PARAMETER[\"central_meridian\",-120.833333333333],P"
+        "ARAMETER[\"standard_parallel_1\",48.7333333333333],PARAM"
+        "ETER[\"standard_parallel_2\",47.5],PARAMETER[\"false_eas"
+        "ting\",1640416.667],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"2926\"]]"},
+    {2927, "epsg", 2927,
         "NAD83(HARN) / Washington South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 3,
-        "its=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Washington South (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",45.3333333333333],PARAMETER[\"central_meridian\",-120.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",47.3333333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",45.8333333333333],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1640416.667],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"US survey foot\",0.304800609601219,AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2927\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2928, "epsg", 2928,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333"
+        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0"
+        "001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un"
+        "its=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Washington South (ftUS)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",45.3333333333333],PARAMETER[\"central_meridian\",-120.5"
+        "],PARAMETER[\"standard_parallel_1\",47.3333333333333],PA"
+        "RAMETER[\"standard_parallel_2\",45.8333333333333],PARAME"
+        "TER[\"false_easting\",1640416.667],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"US survey foot\",0.304800609601219,AUT"
+        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"2927\"]]"},
+    {2928, "epsg", 2928,
         "NAD83(HARN) / Wisconsin North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wisconsin North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",45");
-    add_srs_wkt (p, 8,
-        ".1666666666667],PARAMETER[\"central_meridian\",-90],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",46.7666666666667],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",45.5666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",1968500],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"2928\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2929, "epsg", 2929,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666"
+        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(HARN) / Wisconsin North (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",45"
+        ".1666666666667],PARAMETER[\"central_meridian\",-90],PARA"
+        "METER[\"standard_parallel_1\",46.7666666666667],PARAMETE"
+        "R[\"standard_parallel_2\",45.5666666666667],PARAMETER[\""
+        "false_easting\",1968500],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E"
+        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"2928\"]]"},
+    {2929, "epsg", 2929,
         "NAD83(HARN) / Wisconsin Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wisconsin Central (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N");
-    add_srs_wkt (p, 2,
-        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",43.8333333333333],PARAMETER[\"central_meridian\",-90],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",45.5],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",44.25],PARAMETER[\"false_easting\",1968");
-    add_srs_wkt (p, 11,
-        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"2929\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2930, "epsg", 2930,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333"
+        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wisconsin Central (ftUS)\",GEOGCS"
+        "[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_N"
+        "etwork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",43.8333333333333],PARAMETER[\"central_meridian\",-90],P"
+        "ARAMETER[\"standard_parallel_1\",45.5],PARAMETER[\"stand"
+        "ard_parallel_2\",44.25],PARAMETER[\"false_easting\",1968"
+        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"2929\"]]"},
+    {2930, "epsg", 2930,
         "NAD83(HARN) / Wisconsin South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wisconsin South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",42");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-90],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",44.0666666666667],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 10,
-        "arallel_2\",42.7333333333333],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US surv");
-    add_srs_wkt (p, 12,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 14,
-        "ITY[\"EPSG\",\"2930\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333"
+        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wisconsin South (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",42"
+        "],PARAMETER[\"central_meridian\",-90],PARAMETER[\"standa"
+        "rd_parallel_1\",44.0666666666667],PARAMETER[\"standard_p"
+        "arallel_2\",42.7333333333333],PARAMETER[\"false_easting\""
+        ",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"2930\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_08 = {
+    epsg_defs_08, sizeof (epsg_defs_08) / sizeof (epsg_defs_08[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3609 +53,2063 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_09 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 2931, "epsg", 2931,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_09[] = {
+    {2931, "epsg", 2931,
         "Beduaram / TM 13 NE", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Beduaram", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +a=6378249.2 +b=6356515 +towgs84=-106,-87,188,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beduaram / TM 13 NE\",GEOGCS[\"Beduaram\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Beduaram\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,2");
-    add_srs_wkt (p, 2,
-        "93.466021293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6213\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4213\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",13],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2931\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2932, "epsg", 2932,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=13 +k=0.9996 +x_0=500000 +y_"
+        "0=0 +a=6378249.2 +b=6356515 +towgs84=-106,-87,188,0,0,0,"
+        "0 +units=m +no_defs",
+        "PROJCS[\"Beduaram / TM 13 NE\",GEOGCS[\"Beduaram\",DATUM"
+        "[\"Beduaram\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,2"
+        "93.466021293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHORITY["
+        "\"EPSG\",\"6213\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4213\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",13],PARAM"
+        "ETER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2931\"]]"},
+    {2932, "epsg", 2932,
         "QND95 / Qatar National Grid", 0, 0,
         "International 1924", "Greenwich",
         "Qatar_National_Datum_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.45 +lon_0=51.21666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000 +y_0=300000 +ellps=intl +towgs84=-119.4");
-    add_proj4text (p, 2,
-        "248,-303.65872,-11.00061,1.164298,0.174458,1.096259,3.65");
-    add_proj4text (p, 3,
-        "7065 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"QND95 / Qatar National Grid\",GEOGCS[\"QND95\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Qatar_National_Datum_1995\",SPHEROID[\"Internati");
-    add_srs_wkt (p, 2,
-        "onal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6614\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "614\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",24.45],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",51.2166666666667],PARAMETER[\"scale_factor\",0.99999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",200000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"2932\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2933, "epsg", 2933,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.45 +lon_0=51.21666666666667 +k=0.9"
+        "9999 +x_0=200000 +y_0=300000 +ellps=intl +towgs84=-119.4"
+        "248,-303.65872,-11.00061,1.164298,0.174458,1.096259,3.65"
+        "7065 +units=m +no_defs",
+        "PROJCS[\"QND95 / Qatar National Grid\",GEOGCS[\"QND95\","
+        "DATUM[\"Qatar_National_Datum_1995\",SPHEROID[\"Internati"
+        "onal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AU"
+        "THORITY[\"EPSG\",\"6614\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "614\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",24.45],PARAMETER[\"central_meridian"
+        "\",51.2166666666667],PARAMETER[\"scale_factor\",0.99999]"
+        ",PARAMETER[\"false_easting\",200000],PARAMETER[\"false_n"
+        "orthing\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"2932\"]]"},
+    {2933, "epsg", 2933,
         "Segara / UTM zone 50S", 0, 0,
         "Bessel 1841", "Greenwich",
         "Gunung_Segara", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=50 +south +ellps=bessel +towgs84=-403,68");
-    add_proj4text (p, 1,
-        "4,41,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Segara / UTM zone 50S\",GEOGCS[\"Segara\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Gunung_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,");
-    add_srs_wkt (p, 2,
-        "299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6613\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4613\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",117],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2933\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2934, "epsg", 2934,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=50 +south +ellps=bessel +towgs84=-403,68"
+        "4,41,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Segara / UTM zone 50S\",GEOGCS[\"Segara\",DATUM"
+        "[\"Gunung_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,"
+        "299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EP"
+        "SG\",\"6613\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4613\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",117],PARAMETER"
+        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2933\"]"
+        "]"},
+    {2934, "epsg", 2934,
         "Segara / NEIEZ", 0, 0,
         "Bessel 1841", "Greenwich",
         "Gunung_Segara", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=-403,684,41,0,0,0,0 +pm=jakarta +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Segara / NEIEZ\",GEOGCS[\"Segara\",DATUM[\"Gunu");
-    add_srs_wkt (p, 1,
-        "ng_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,299.152");
-    add_srs_wkt (p, 2,
-        "8128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6613\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4613\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Mercator_1SP\"],PARAMETER[\"central_meridian\",110],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"scale_factor\",0.997],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 8,
-        "g\",3900000],PARAMETER[\"false_northing\",900000],UNIT[\"");
-    add_srs_wkt (p, 9,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 10,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"300");
-    add_srs_wkt (p, 11,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2935, "epsg", 2935,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 "
+        "+ellps=bessel +towgs84=-403,684,41,0,0,0,0 +pm=jakarta +"
+        "units=m +no_defs",
+        "PROJCS[\"Segara / NEIEZ\",GEOGCS[\"Segara\",DATUM[\"Gunu"
+        "ng_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,299.152"
+        "8128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\""
+        "6613\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4613\"]],PROJECTION["
+        "\"Mercator_1SP\"],PARAMETER[\"central_meridian\",110],PA"
+        "RAMETER[\"scale_factor\",0.997],PARAMETER[\"false_eastin"
+        "g\",3900000],PARAMETER[\"false_northing\",900000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"300"
+        "0\"]]"},
+    {2935, "epsg", 2935,
         "Pulkovo 1942 / CS63 zone A1", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=41.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=1300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone A1\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.116666666666667],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",41.5333333333333],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",1300000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2935\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2936, "epsg", 2936,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=41.53333333"
+        "333333 +k=1 +x_0=1300000 +y_0=0 +ellps=krass +towgs84=23"
+        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone A1\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.116666666666667],PARAMETER[\"central_mer"
+        "idian\",41.5333333333333],PARAMETER[\"scale_factor\",1],"
+        "PARAMETER[\"false_easting\",1300000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"2935\"]]"},
+    {2936, "epsg", 2936,
         "Pulkovo 1942 / CS63 zone A2", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=44.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=2300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone A2\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.116666666666667],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",44.5333333333333],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",2300000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2936\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2937, "epsg", 2937,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=44.53333333"
+        "333333 +k=1 +x_0=2300000 +y_0=0 +ellps=krass +towgs84=23"
+        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone A2\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.116666666666667],PARAMETER[\"central_mer"
+        "idian\",44.5333333333333],PARAMETER[\"scale_factor\",1],"
+        "PARAMETER[\"false_easting\",2300000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"2936\"]]"},
+    {2937, "epsg", 2937,
         "Pulkovo 1942 / CS63 zone A3", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=47.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=3300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone A3\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.116666666666667],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",47.5333333333333],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",3300000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2937\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2938, "epsg", 2938,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=47.53333333"
+        "333333 +k=1 +x_0=3300000 +y_0=0 +ellps=krass +towgs84=23"
+        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone A3\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.116666666666667],PARAMETER[\"central_mer"
+        "idian\",47.5333333333333],PARAMETER[\"scale_factor\",1],"
+        "PARAMETER[\"false_easting\",3300000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"2937\"]]"},
+    {2938, "epsg", 2938,
         "Pulkovo 1942 / CS63 zone A4", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=50.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=4300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone A4\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.116666666666667],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",50.5333333333333],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",4300000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2938\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2939, "epsg", 2939,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1166666666666667 +lon_0=50.53333333"
+        "333333 +k=1 +x_0=4300000 +y_0=0 +ellps=krass +towgs84=23"
+        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone A4\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.116666666666667],PARAMETER[\"central_mer"
+        "idian\",50.5333333333333],PARAMETER[\"scale_factor\",1],"
+        "PARAMETER[\"false_easting\",4300000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"2938\"]]"},
+    {2939, "epsg", 2939,
         "Pulkovo 1942 / CS63 zone K2", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=50.76666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=2300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone K2\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.133333333333333],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",50.7666666666667],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",2300000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2939\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2940, "epsg", 2940,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=50.76666666"
+        "666667 +k=1 +x_0=2300000 +y_0=0 +ellps=krass +towgs84=23"
+        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone K2\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.133333333333333],PARAMETER[\"central_mer"
+        "idian\",50.7666666666667],PARAMETER[\"scale_factor\",1],"
+        "PARAMETER[\"false_easting\",2300000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"2939\"]]"},
+    {2940, "epsg", 2940,
         "Pulkovo 1942 / CS63 zone K3", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=53.76666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=3300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone K3\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.133333333333333],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",53.7666666666667],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",3300000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2940\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2941, "epsg", 2941,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=53.76666666"
+        "666667 +k=1 +x_0=3300000 +y_0=0 +ellps=krass +towgs84=23"
+        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone K3\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.133333333333333],PARAMETER[\"central_mer"
+        "idian\",53.7666666666667],PARAMETER[\"scale_factor\",1],"
+        "PARAMETER[\"false_easting\",3300000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"2940\"]]"},
+    {2941, "epsg", 2941,
         "Pulkovo 1942 / CS63 zone K4", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=56.76666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=4300000 +y_0=0 +ellps=krass +towgs84=23");
-    add_proj4text (p, 2,
-        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone K4\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.133333333333333],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",56.7666666666667],PARAMETER[\"scale_factor\",1],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",4300000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2941\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2942, "epsg", 2942,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1333333333333333 +lon_0=56.76666666"
+        "666667 +k=1 +x_0=4300000 +y_0=0 +ellps=krass +towgs84=23"
+        ".92,-141.27,-80.9,0,0.35,0.82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone K4\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.133333333333333],PARAMETER[\"central_mer"
+        "idian\",56.7666666666667],PARAMETER[\"scale_factor\",1],"
+        "PARAMETER[\"false_easting\",4300000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"2941\"]]"},
+    {2942, "epsg", 2942,
         "Porto Santo / UTM zone 28N", 0, 0,
         "International 1924", "Greenwich",
         "Porto_Santo_1936", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-499,-249,314,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Porto Santo / UTM zone 28N\",GEOGCS[\"Porto San");
-    add_srs_wkt (p, 1,
-        "to\",DATUM[\"Porto_Santo_1936\",SPHEROID[\"International");
-    add_srs_wkt (p, 2,
-        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6615\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4615\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-15],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_east");
-    add_srs_wkt (p, 9,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2942\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2943, "epsg", 2943,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=intl +towgs84=-499,-249,314,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Porto Santo / UTM zone 28N\",GEOGCS[\"Porto San"
+        "to\",DATUM[\"Porto_Santo_1936\",SPHEROID[\"International"
+        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6615\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4615\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-15],P"
+        "ARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_east"
+        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2942\""
+        "]]"},
+    {2943, "epsg", 2943,
         "Selvagem Grande / UTM zone 28N", 0, 0,
         "International 1924", "Greenwich",
         "Selvagem_Grande", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-289,-124,60,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Selvagem Grande / UTM zone 28N\",GEOGCS[\"Selva");
-    add_srs_wkt (p, 1,
-        "gem Grande\",DATUM[\"Selvagem_Grande\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6616\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4616\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2943\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2944, "epsg", 2944,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=intl +towgs84=-289,-124,60,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Selvagem Grande / UTM zone 28N\",GEOGCS[\"Selva"
+        "gem Grande\",DATUM[\"Selvagem_Grande\",SPHEROID[\"Intern"
+        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]"
+        ",AUTHORITY[\"EPSG\",\"6616\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4616\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2943\"]]"},
+    {2944, "epsg", 2944,
         "NAD83(CSRS) / SCoPQ zone 2 (deprecated)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-55.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / SCoPQ zone 2 (deprecated)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-55.5],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 9,
-        "actor\",0.9999],PARAMETER[\"false_easting\",304800],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"2944\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2945, "epsg", 2945,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-55.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / SCoPQ zone 2 (deprecated)\",GEOGC"
+        "S[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Referen"
+        "ce_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-55.5],PARAMETER[\"scale_f"
+        "actor\",0.9999],PARAMETER[\"false_easting\",304800],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"2944\"]]"},
+    {2945, "epsg", 2945,
         "NAD83(CSRS) / MTM zone 3", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-58.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 3\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-58.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2945\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2946, "epsg", 2946,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-58.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / MTM zone 3\",GEOGCS[\"NAD83(CSRS)"
+        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-58.5],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2945\"]]"},
+    {2946, "epsg", 2946,
         "NAD83(CSRS) / MTM zone 4", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-61.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 4\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-61.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2946\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2947, "epsg", 2947,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-61.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / MTM zone 4\",GEOGCS[\"NAD83(CSRS)"
+        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-61.5],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2946\"]]"},
+    {2947, "epsg", 2947,
         "NAD83(CSRS) / MTM zone 5", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-64.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 5\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-64.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2947\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2948, "epsg", 2948,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-64.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / MTM zone 5\",GEOGCS[\"NAD83(CSRS)"
+        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-64.5],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2947\"]]"},
+    {2948, "epsg", 2948,
         "NAD83(CSRS) / MTM zone 6", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-67.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 6\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-67.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2948\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2949, "epsg", 2949,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-67.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / MTM zone 6\",GEOGCS[\"NAD83(CSRS)"
+        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-67.5],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2948\"]]"},
+    {2949, "epsg", 2949,
         "NAD83(CSRS) / MTM zone 7", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-70.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 7\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-70.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2949\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2950, "epsg", 2950,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-70.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / MTM zone 7\",GEOGCS[\"NAD83(CSRS)"
+        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-70.5],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2949\"]]"},
+    {2950, "epsg", 2950,
         "NAD83(CSRS) / MTM zone 8", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-73.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 8\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-73.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2950\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2951, "epsg", 2951,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-73.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / MTM zone 8\",GEOGCS[\"NAD83(CSRS)"
+        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-73.5],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2950\"]]"},
+    {2951, "epsg", 2951,
         "NAD83(CSRS) / MTM zone 9", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-76.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 9\",GEOGCS[\"NAD83(CSRS)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-76.5],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"2951\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2952, "epsg", 2952,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-76.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / MTM zone 9\",GEOGCS[\"NAD83(CSRS)"
+        "\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-76.5],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",304800],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"2951\"]]"},
+    {2952, "epsg", 2952,
         "NAD83(CSRS) / MTM zone 10", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-79.5 +k=0.9999 +x_0=304800 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTM zone 10\",GEOGCS[\"NAD83(CSRS");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-79.5],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 9,
-        "9],PARAMETER[\"false_easting\",304800],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"2952\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2953, "epsg", 2953,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-79.5 +k=0.9999 +x_0=304800 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(CSRS) / MTM zone 10\",GEOGCS[\"NAD83(CSRS"
+        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",-79.5],PARAMETER[\"scale_factor\",0.999"
+        "9],PARAMETER[\"false_easting\",304800],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2952\"]]"},
+    {2953, "epsg", 2953,
         "NAD83(CSRS) / New Brunswick Stereographic", 0, 1,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Oblique_Stereographic", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=46.5 +lon_0=-66.5 +k=0.999912 +x_0=2");
-    add_proj4text (p, 1,
-        "500000 +y_0=7500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / New Brunswick Stereographic\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"O");
-    add_srs_wkt (p, 7,
-        "blique_Stereographic\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",46.5],PARAMETER[\"central_meridian\",-66.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999912],PARAMETER[\"false_easting\",250");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",7500000],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2953\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2954, "epsg", 2954,
+        "Northing", "North", "Easting", "East",
+        "+proj=sterea +lat_0=46.5 +lon_0=-66.5 +k=0.999912 +x_0=2"
+        "500000 +y_0=7500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / New Brunswick Stereographic\",GEO"
+        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer"
+        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614"
+        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"O"
+        "blique_Stereographic\"],PARAMETER[\"latitude_of_origin\""
+        ",46.5],PARAMETER[\"central_meridian\",-66.5],PARAMETER[\""
+        "scale_factor\",0.999912],PARAMETER[\"false_easting\",250"
+        "0000],PARAMETER[\"false_northing\",7500000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR"
+        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2953\"]]"},
+    {2954, "epsg", 2954,
         "NAD83(CSRS) / Prince Edward Isl. Stereographic (NAD83)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Oblique_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40");
-    add_proj4text (p, 1,
-        "0000 +y_0=800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Prince Edward Isl. Stereographic ");
-    add_srs_wkt (p, 1,
-        "(NAD83)\",GEOGCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_");
-    add_srs_wkt (p, 2,
-        "Spatial_Reference_System\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",47.25],PARAMETER[\"central_meridian\",-63],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",0.999912],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",400000],PARAMETER[\"false_northing\",800000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"2954\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2955, "epsg", 2955,
+        "Easting", "East", "Northing", "North",
+        "+proj=sterea +lat_0=47.25 +lon_0=-63 +k=0.999912 +x_0=40"
+        "0000 +y_0=800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un"
+        "its=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Prince Edward Isl. Stereographic "
+        "(NAD83)\",GEOGCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_"
+        "Spatial_Reference_System\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PR"
+        "OJECTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude"
+        "_of_origin\",47.25],PARAMETER[\"central_meridian\",-63],"
+        "PARAMETER[\"scale_factor\",0.999912],PARAMETER[\"false_e"
+        "asting\",400000],PARAMETER[\"false_northing\",800000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"2954\"]]"},
+    {2955, "epsg", 2955,
         "NAD83(CSRS) / UTM zone 11N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 11N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-117],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 9,
-        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"2955\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2956, "epsg", 2956,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 11N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-117],PARAMETER[\"scale_factor\",0.999"
+        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2955\"]]"},
+    {2956, "epsg", 2956,
         "NAD83(CSRS) / UTM zone 12N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 12N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-111],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 9,
-        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"2956\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2957, "epsg", 2957,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 12N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-111],PARAMETER[\"scale_factor\",0.999"
+        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2956\"]]"},
+    {2957, "epsg", 2957,
         "NAD83(CSRS) / UTM zone 13N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 13N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-105],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 9,
-        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"2957\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2958, "epsg", 2958,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 13N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-105],PARAMETER[\"scale_factor\",0.999"
+        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"2957\"]]"},
+    {2958, "epsg", 2958,
         "NAD83(CSRS) / UTM zone 17N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 17N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-81],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"2958\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2959, "epsg", 2959,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 17N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-81],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2958\"]]"},
+    {2959, "epsg", 2959,
         "NAD83(CSRS) / UTM zone 18N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 18N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-75],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"2959\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2960, "epsg", 2960,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 18N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-75],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2959\"]]"},
+    {2960, "epsg", 2960,
         "NAD83(CSRS) / UTM zone 19N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 19N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-69],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"2960\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2961, "epsg", 2961,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 19N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-69],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2960\"]]"},
+    {2961, "epsg", 2961,
         "NAD83(CSRS) / UTM zone 20N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 20N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-63],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"2961\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2962, "epsg", 2962,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 20N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-63],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2961\"]]"},
+    {2962, "epsg", 2962,
         "NAD83(CSRS) / UTM zone 21N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 21N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-57],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"2962\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2964, "epsg", 2964,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 21N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-57],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"2962\"]]"},
+    {2964, "epsg", 2964,
         "NAD27 / Alaska Albers", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Albers_Conic_Equal_Area", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0");
-    add_proj4text (p, 1,
-        "=0 +y_0=0 +datum=NAD27 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Alaska Albers\",GEOGCS[\"NAD27\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4267\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"latitude_of_center\",50],PARAMETER[\"longitude_of_c");
-    add_srs_wkt (p, 8,
-        "enter\",-154],PARAMETER[\"standard_parallel_1\",55],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",65],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",0],PARAMETER[\"false_northing\",0],UNIT[\"US surve");
-    add_srs_wkt (p, 11,
-        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"2964\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2965, "epsg", 2965,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0"
+        "=0 +y_0=0 +datum=NAD27 +units=us-ft +no_defs",
+        "PROJCS[\"NAD27 / Alaska Albers\",GEOGCS[\"NAD27\",DATUM["
+        "\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6"
+        "378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],"
+        "AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4267\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMET"
+        "ER[\"latitude_of_center\",50],PARAMETER[\"longitude_of_c"
+        "enter\",-154],PARAMETER[\"standard_parallel_1\",55],PARA"
+        "METER[\"standard_parallel_2\",65],PARAMETER[\"false_east"
+        "ing\",0],PARAMETER[\"false_northing\",0],UNIT[\"US surve"
+        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"2964\"]]"},
+    {2965, "epsg", 2965,
         "NAD83 / Indiana East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Indiana East (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",37.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-85.6666666666667],PARAMETER[\"scale_factor\",0.9999666");
-    add_srs_wkt (p, 9,
-        "67],PARAMETER[\"false_easting\",328083.333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",820208.333],UNIT[\"US survey foot\",0.3");
-    add_srs_wkt (p, 11,
-        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"2965\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2966, "epsg", 2966,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9"
+        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Indiana East (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",37.5],PARAMETER[\"central_meridian\""
+        ",-85.6666666666667],PARAMETER[\"scale_factor\",0.9999666"
+        "67],PARAMETER[\"false_easting\",328083.333],PARAMETER[\""
+        "false_northing\",820208.333],UNIT[\"US survey foot\",0.3"
+        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"2965\"]]"},
+    {2966, "epsg", 2966,
         "NAD83 / Indiana West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Indiana West (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",37.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-87.0833333333333],PARAMETER[\"scale_factor\",0.9999666");
-    add_srs_wkt (p, 9,
-        "67],PARAMETER[\"false_easting\",2952750],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",820208.333],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 11,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 13,
-        "966\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2967, "epsg", 2967,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9"
+        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Indiana West (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",37.5],PARAMETER[\"central_meridian\""
+        ",-87.0833333333333],PARAMETER[\"scale_factor\",0.9999666"
+        "67],PARAMETER[\"false_easting\",2952750],PARAMETER[\"fal"
+        "se_northing\",820208.333],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "966\"]]"},
+    {2967, "epsg", 2967,
         "NAD83(HARN) / Indiana East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Indiana East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-85.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999966667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "328083.333],PARAMETER[\"false_northing\",820208.333],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"2967\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2968, "epsg", 2968,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9"
+        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Indiana East (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-85.6666666666667],PARAMETER[\""
+        "scale_factor\",0.999966667],PARAMETER[\"false_easting\","
+        "328083.333],PARAMETER[\"false_northing\",820208.333],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"2967\"]]"},
+    {2968, "epsg", 2968,
         "NAD83(HARN) / Indiana West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Indiana West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-87.0833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999966667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "2952750],PARAMETER[\"false_northing\",820208.333],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"2968\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2969, "epsg", 2969,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9"
+        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Indiana West (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-87.0833333333333],PARAMETER[\""
+        "scale_factor\",0.999966667],PARAMETER[\"false_easting\","
+        "2952750],PARAMETER[\"false_northing\",820208.333],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"2968\"]]"},
+    {2969, "epsg", 2969,
         "Fort Marigot / UTM zone 20N", 0, 0,
         "International 1924", "Greenwich",
         "Fort_Marigot", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=intl +towgs84=137,248,-430,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fort Marigot / UTM zone 20N\",GEOGCS[\"Fort Mar");
-    add_srs_wkt (p, 1,
-        "igot\",DATUM[\"Fort_Marigot\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6621\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4621\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2969\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2970, "epsg", 2970,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=intl +towgs84=137,248,-430,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Fort Marigot / UTM zone 20N\",GEOGCS[\"Fort Mar"
+        "igot\",DATUM[\"Fort_Marigot\",SPHEROID[\"International 1"
+        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6621\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4621\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2969\"]]"},
+    {2970, "epsg", 2970,
         "Guadeloupe 1948 / UTM zone 20N", 0, 0,
         "International 1924", "Greenwich",
         "Guadeloupe_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=intl +towgs84=-467,-16,-300,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Guadeloupe 1948 / UTM zone 20N\",GEOGCS[\"Guade");
-    add_srs_wkt (p, 1,
-        "loupe 1948\",DATUM[\"Guadeloupe_1948\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6622\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4622\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2970\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2971, "epsg", 2971,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=intl +towgs84=-467,-16,-300,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Guadeloupe 1948 / UTM zone 20N\",GEOGCS[\"Guade"
+        "loupe 1948\",DATUM[\"Guadeloupe_1948\",SPHEROID[\"Intern"
+        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]"
+        ",AUTHORITY[\"EPSG\",\"6622\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4622\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2970\"]]"},
+    {2971, "epsg", 2971,
         "CSG67 / UTM zone 22N", 0, 0,
         "International 1924", "Greenwich",
         "Centre_Spatial_Guyanais_1967", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=intl +towgs84=-186,230,110,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CSG67 / UTM zone 22N\",GEOGCS[\"CSG67\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Centre_Spatial_Guyanais_1967\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6623\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4623\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-51],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_east");
-    add_srs_wkt (p, 9,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2971\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 2972, "epsg", 2972,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +ellps=intl +towgs84=-186,230,110,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"CSG67 / UTM zone 22N\",GEOGCS[\"CSG67\",DATUM[\""
+        "Centre_Spatial_Guyanais_1967\",SPHEROID[\"International "
+        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI"
+        "TY[\"EPSG\",\"6623\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4623\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-51],P"
+        "ARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_east"
+        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2971\""
+        "]]"},
+    {2972, "epsg", 2972,
         "RGFG95 / UTM zone 22N", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_Guyane_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGFG95 / UTM zone 22N\",GEOGCS[\"RGFG95\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Reseau_Geodesique_Francais_Guyane_1995\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6624\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4624\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-51],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2972\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2973, "epsg", 2973,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"RGFG95 / UTM zone 22N\",GEOGCS[\"RGFG95\",DATUM"
+        "[\"Reseau_Geodesique_Francais_Guyane_1995\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6624\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4624\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-51],PARAMETER[\"scale_factor\",0.9996],PARAMETER"
+        "[\"false_easting\",500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"2972\"]]"},
+    {2973, "epsg", 2973,
         "Martinique 1938 / UTM zone 20N", 0, 0,
         "International 1924", "Greenwich",
         "Martinique_1938", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=intl +towgs84=186,482,151,0,0,");
-    add_proj4text (p, 1,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Martinique 1938 / UTM zone 20N\",GEOGCS[\"Marti");
-    add_srs_wkt (p, 1,
-        "nique 1938\",DATUM[\"Martinique_1938\",SPHEROID[\"Intern");
-    add_srs_wkt (p, 2,
-        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6625\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4625\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "2973\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2975, "epsg", 2975,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=intl +towgs84=186,482,151,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Martinique 1938 / UTM zone 20N\",GEOGCS[\"Marti"
+        "nique 1938\",DATUM[\"Martinique_1938\",SPHEROID[\"Intern"
+        "ational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]]"
+        ",AUTHORITY[\"EPSG\",\"6625\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4625\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "2973\"]]"},
+    {2975, "epsg", 2975,
         "RGR92 / UTM zone 40S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_Reunion_1992", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=40 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGR92 / UTM zone 40S\",GEOGCS[\"RGR92\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Reseau_Geodesique_de_la_Reunion_1992\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6627\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4627\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",500000],PARAMETER[\"false_northing\",1000000");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2975\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2976, "epsg", 2976,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=40 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGR92 / UTM zone 40S\",GEOGCS[\"RGR92\",DATUM[\""
+        "Reseau_Geodesique_de_la_Reunion_1992\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6627\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4627\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",1000000"
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"2975\"]]"},
+    {2976, "epsg", 2976,
         "Tahiti 52 / UTM zone 6S", 0, 0,
         "International 1924", "Greenwich",
         "Tahiti_52", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=6 +south +ellps=intl +towgs84=162,117,15");
-    add_proj4text (p, 1,
-        "4,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tahiti 52 / UTM zone 6S\",GEOGCS[\"Tahiti 52\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Tahiti_52\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6628\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4628\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-147],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2976\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2977, "epsg", 2977,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=6 +south +ellps=intl +towgs84=162,117,15"
+        "4,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tahiti 52 / UTM zone 6S\",GEOGCS[\"Tahiti 52\","
+        "DATUM[\"Tahiti_52\",SPHEROID[\"International 1924\",6378"
+        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6628\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4628\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-147],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2976\"]]"},
+    {2977, "epsg", 2977,
         "Tahaa 54 / UTM zone 5S", 0, 0,
         "International 1924", "Greenwich",
         "Tahaa_54", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=5 +south +ellps=intl +towgs84=72.438,345");
-    add_proj4text (p, 1,
-        ".918,79.486,1.6045,0.8823,0.5565,1.3746 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tahaa 54 / UTM zone 5S\",GEOGCS[\"Tahaa 54\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Tahaa_54\",SPHEROID[\"International 1924\",6378388");
-    add_srs_wkt (p, 2,
-        ",297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6629\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4629\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",-153],PARAMETER[\"sca");
-    add_srs_wkt (p, 8,
-        "le_factor\",0.9996],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 10,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2977\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2978, "epsg", 2978,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=5 +south +ellps=intl +towgs84=72.438,345"
+        ".918,79.486,1.6045,0.8823,0.5565,1.3746 +units=m +no_def"
+        "s",
+        "PROJCS[\"Tahaa 54 / UTM zone 5S\",GEOGCS[\"Tahaa 54\",DA"
+        "TUM[\"Tahaa_54\",SPHEROID[\"International 1924\",6378388"
+        ",297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\""
+        "6629\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4629\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",-153],PARAMETER[\"sca"
+        "le_factor\",0.9996],PARAMETER[\"false_easting\",500000],"
+        "PARAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2977\"]]"},
+    {2978, "epsg", 2978,
         "IGN72 Nuku Hiva / UTM zone 7S", 0, 0,
         "International 1924", "Greenwich",
         "IGN72_Nuku_Hiva", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +south +ellps=intl +towgs84=84,274,65,");
-    add_proj4text (p, 1,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN72 Nuku Hiva / UTM zone 7S\",GEOGCS[\"IGN72 ");
-    add_srs_wkt (p, 1,
-        "Nuku Hiva\",DATUM[\"IGN72_Nuku_Hiva\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6630\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4630\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "141],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",500000],PARAMETER[\"false_northing\",1000000");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2978\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2979, "epsg", 2979,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=7 +south +ellps=intl +towgs84=84,274,65,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGN72 Nuku Hiva / UTM zone 7S\",GEOGCS[\"IGN72 "
+        "Nuku Hiva\",DATUM[\"IGN72_Nuku_Hiva\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6630\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4630\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-"
+        "141],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",1000000"
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"2978\"]]"},
+    {2979, "epsg", 2979,
         "IGN 1962 Kerguelen / UTM zone 42S", 0, 0,
         "International 1924", "Greenwich",
         "IGN_1962_Kerguelen", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=42 +south +ellps=intl +towgs84=145,-187,");
-    add_proj4text (p, 1,
-        "103,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN 1962 Kerguelen / UTM zone 42S\",GEOGCS[\"IG");
-    add_srs_wkt (p, 1,
-        "N 1962 Kerguelen\",DATUM[\"IGN_1962_Kerguelen\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7022\"]],AUTHORITY[\"EPSG\",\"6698\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4698\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",69],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3336\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2980, "epsg", 2980,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=42 +south +ellps=intl +towgs84=145,-187,"
+        "103,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGN 1962 Kerguelen / UTM zone 42S\",GEOGCS[\"IG"
+        "N 1962 Kerguelen\",DATUM[\"IGN_1962_Kerguelen\",SPHEROID"
+        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\""
+        "7022\"]],AUTHORITY[\"EPSG\",\"6698\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4698\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",69],PARAMETER[\"scale_factor\",0.9996],PARAMETE"
+        "R[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3336\"]]"},
+    {2980, "epsg", 2980,
         "Combani 1950 / UTM zone 38S", 0, 0,
         "International 1924", "Greenwich",
         "Combani_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-382,-59,");
-    add_proj4text (p, 1,
-        "-262,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Combani 1950 / UTM zone 38S\",GEOGCS[\"Combani ");
-    add_srs_wkt (p, 1,
-        "1950\",DATUM[\"Combani_1950\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6632\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4632\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",45],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"298");
-    add_srs_wkt (p, 12,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2981, "epsg", 2981,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-382,-59,"
+        "-262,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Combani 1950 / UTM zone 38S\",GEOGCS[\"Combani "
+        "1950\",DATUM[\"Combani_1950\",SPHEROID[\"International 1"
+        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6632\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4632\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",45],PARA"
+        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"298"
+        "0\"]]"},
+    {2981, "epsg", 2981,
         "IGN56 Lifou / UTM zone 58S", 0, 0,
         "International 1924", "Greenwich",
         "IGN56_Lifou", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=335.47,22");
-    add_proj4text (p, 1,
-        "2.58,-230.94,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN56 Lifou / UTM zone 58S\",GEOGCS[\"IGN56 Lif");
-    add_srs_wkt (p, 1,
-        "ou\",DATUM[\"IGN56_Lifou\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6633\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4633\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",165],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"m");
-    add_srs_wkt (p, 10,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 11,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2981");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2982, "epsg", 2982,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=intl +towgs84=335.47,22"
+        "2.58,-230.94,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGN56 Lifou / UTM zone 58S\",GEOGCS[\"IGN56 Lif"
+        "ou\",DATUM[\"IGN56_Lifou\",SPHEROID[\"International 1924"
+        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\""
+        "EPSG\",\"6633\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4633\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",165],PARAME"
+        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2981"
+        "\"]]"},
+    {2982, "epsg", 2982,
         "IGN72 Grande Terre / UTM zone 58S", 0, 0,
         "International 1924", "Greenwich",
         "IGN72_Grande_Terre", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-13,-348,");
-    add_proj4text (p, 1,
-        "292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN72 Grande Terre / UTM zone 58S\",GEOGCS[\"IG");
-    add_srs_wkt (p, 1,
-        "N72 Grande Terre\",DATUM[\"IGN72_Grande_Terre\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7022\"]],AUTHORITY[\"EPSG\",\"6634\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4662\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",165],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3060\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2983, "epsg", 2983,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-13,-348,"
+        "292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGN72 Grande Terre / UTM zone 58S\",GEOGCS[\"IG"
+        "N72 Grande Terre\",DATUM[\"IGN72_Grande_Terre\",SPHEROID"
+        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\""
+        "7022\"]],AUTHORITY[\"EPSG\",\"6634\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4662\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",165],PARAMETER[\"scale_factor\",0.9996],PARAMET"
+        "ER[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3060\"]]"},
+    {2983, "epsg", 2983,
         "ST87 Ouvea / UTM zone 58S", 0, 0,
         "WGS 84", "Greenwich",
         "ST87_Ouvea", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-122.383,");
-    add_proj4text (p, 1,
-        "-188.696,103.344,3.5107,-4.9668,-5.7047,4.4798 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ST87 Ouvea / UTM zone 58S\",GEOGCS[\"ST87 Ouvea");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"ST87_Ouvea\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6750\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4750\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",165],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",10000000],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3164\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2984, "epsg", 2984,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-122.383,"
+        "-188.696,103.344,3.5107,-4.9668,-5.7047,4.4798 +units=m "
+        "+no_defs",
+        "PROJCS[\"ST87 Ouvea / UTM zone 58S\",GEOGCS[\"ST87 Ouvea"
+        "\",DATUM[\"ST87_Ouvea\",SPHEROID[\"WGS 84\",6378137,298."
+        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG"
+        "\",\"6750\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4750\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",165],PARAMETER["
+        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",10000000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3164\"]]"},
+    {2984, "epsg", 2984,
         "RGNC91-93 / Lambert New Caledonia", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_Nouvelle_Caledonie_91-93", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-20.66666666666667 +lat_2=-22.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-21.5 +lon_0=166 +x_0=400000 +y_0=300000 +e");
-    add_proj4text (p, 2,
-        "llps=intl +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGNC91-93 / Lambert New Caledonia\",GEOGCS[\"RG");
-    add_srs_wkt (p, 1,
-        "NC91-93\",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledoni");
-    add_srs_wkt (p, 2,
-        "e_91-93\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",-21.5],PARAMETER[\"central_meridian\",166],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",-20.6666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",-22.3333333333333],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",400000],PARAMETER[\"false_northing\",300000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"3163\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2987, "epsg", 2987,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-20.66666666666667 +lat_2=-22.333333333"
+        "33333 +lat_0=-21.5 +lon_0=166 +x_0=400000 +y_0=300000 +e"
+        "llps=intl +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGNC91-93 / Lambert New Caledonia\",GEOGCS[\"RG"
+        "NC91-93\",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledoni"
+        "e_91-93\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",-21.5],PARAMETER[\"central_meridian\",166],PARAMETER["
+        "\"standard_parallel_1\",-20.6666666666667],PARAMETER[\"s"
+        "tandard_parallel_2\",-22.3333333333333],PARAMETER[\"fals"
+        "e_easting\",400000],PARAMETER[\"false_northing\",300000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"3163\"]]"},
+    {2987, "epsg", 2987,
         "Saint Pierre et Miquelon 1950 / UTM zone 21N", 0, 0,
         "Clarke 1866", "Greenwich",
         "Saint_Pierre_et_Miquelon_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=clrk66 +towgs84=30,430,368,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Saint Pierre et Miquelon 1950 / UTM zone 21N\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Saint Pierre et Miquelon 1950\",DATUM[\"Saint_P");
-    add_srs_wkt (p, 2,
-        "ierre_et_Miquelon_1950\",SPHEROID[\"Clarke 1866\",637820");
-    add_srs_wkt (p, 3,
-        "6.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6638\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4638");
-    add_srs_wkt (p, 7,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-57]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2987");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2988, "epsg", 2988,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +ellps=clrk66 +towgs84=30,430,368,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Saint Pierre et Miquelon 1950 / UTM zone 21N\","
+        "GEOGCS[\"Saint Pierre et Miquelon 1950\",DATUM[\"Saint_P"
+        "ierre_et_Miquelon_1950\",SPHEROID[\"Clarke 1866\",637820"
+        "6.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHO"
+        "RITY[\"EPSG\",\"6638\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4638"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",0],PARAMETER[\"central_meridian\",-57]"
+        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea"
+        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2987"
+        "\"]]"},
+    {2988, "epsg", 2988,
         "MOP78 / UTM zone 1S", 0, 0,
         "International 1924", "Greenwich",
         "MOP78", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=1 +south +ellps=intl +towgs84=253,-132,-");
-    add_proj4text (p, 1,
-        "127,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MOP78 / UTM zone 1S\",GEOGCS[\"MOP78\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "MOP78\",SPHEROID[\"International 1924\",6378388,297,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6639\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AUTHORITY[\"EPSG\",\"4639\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 6,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"central_meridian\",-177],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 8,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2988\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2989, "epsg", 2989,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=1 +south +ellps=intl +towgs84=253,-132,-"
+        "127,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"MOP78 / UTM zone 1S\",GEOGCS[\"MOP78\",DATUM[\""
+        "MOP78\",SPHEROID[\"International 1924\",6378388,297,AUTH"
+        "ORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6639\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4639\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA"
+        "METER[\"central_meridian\",-177],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"2988\"]]"},
+    {2989, "epsg", 2989,
         "RRAF 1991 / UTM zone 20N", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_de_Reference_des_Antilles_Francaises_1991", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RRAF 1991 / UTM zone 20N\",GEOGCS[\"RRAF 1991\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Reseau_de_Reference_des_Antilles_Francaises_199");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1047\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4558\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-63],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"4559\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2990, "epsg", 2990,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"RRAF 1991 / UTM zone 20N\",GEOGCS[\"RRAF 1991\""
+        ",DATUM[\"Reseau_de_Reference_des_Antilles_Francaises_199"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1047\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4558\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-63],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"4559\"]]"},
+    {2990, "epsg", 2990,
         "Reunion 1947 / TM Reunion", 0, 0,
         "International 1924", "Greenwich",
         "Reunion_1947", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-21.11666666666667 +lon_0=55.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=50000 +y_0=160000 +ellps=intl +towgs84=");
-    add_proj4text (p, 2,
-        "94,-948,-1262,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Reunion 1947 / TM Reunion\",GEOGCS[\"Reunion 19");
-    add_srs_wkt (p, 1,
-        "47\",DATUM[\"Reunion_1947\",SPHEROID[\"International 192");
-    add_srs_wkt (p, 2,
-        "4\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6626\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4626\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",-21.1166666666667],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",55.5333333333333],PARAMETER[\"scale_factor\",1],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",160000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",50000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"3727\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2991, "epsg", 2991,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-21.11666666666667 +lon_0=55.53333333"
+        "333333 +k=1 +x_0=50000 +y_0=160000 +ellps=intl +towgs84="
+        "94,-948,-1262,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Reunion 1947 / TM Reunion\",GEOGCS[\"Reunion 19"
+        "47\",DATUM[\"Reunion_1947\",SPHEROID[\"International 192"
+        "4\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY["
+        "\"EPSG\",\"6626\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4626\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",-21.1166666666667],PARAMETER[\"central_meri"
+        "dian\",55.5333333333333],PARAMETER[\"scale_factor\",1],P"
+        "ARAMETER[\"false_easting\",160000],PARAMETER[\"false_nor"
+        "thing\",50000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3727\"]]"},
+    {2991, "epsg", 2991,
         "NAD83 / Oregon LCC (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oregon LCC (m)\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",41.75],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-120.5],PARAMETER[\"standard_parallel_1\",43],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",45.5],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",400000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2991");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2992, "epsg", 2992,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120"
+        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,"
+        "0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Oregon LCC (m)\",GEOGCS[\"NAD83\",DATUM"
+        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637"
+        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORI"
+        "TY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER"
+        "[\"latitude_of_origin\",41.75],PARAMETER[\"central_merid"
+        "ian\",-120.5],PARAMETER[\"standard_parallel_1\",43],PARA"
+        "METER[\"standard_parallel_2\",45.5],PARAMETER[\"false_ea"
+        "sting\",400000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2991"
+        "\"]]"},
+    {2992, "epsg", 2992,
         "NAD83 / Oregon GIC Lambert (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Oregon GIC Lambert (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",41.75],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-120.5],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",43],PARAMETER[\"standard_parallel_2\",45.5],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",1312335.958],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"2992\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2993, "epsg", 2993,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120"
+        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83 / Oregon GIC Lambert (ft)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",41.75],PARAMETER[\"cent"
+        "ral_meridian\",-120.5],PARAMETER[\"standard_parallel_1\""
+        ",43],PARAMETER[\"standard_parallel_2\",45.5],PARAMETER[\""
+        "false_easting\",1312335.958],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"2992\"]]"},
+    {2993, "epsg", 2993,
         "NAD83(HARN) / Oregon LCC (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oregon LCC (m)\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.75],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-120.5],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",43],PARAMETER[\"standard_parallel_2\",45");
-    add_srs_wkt (p, 10,
-        ".5],PARAMETER[\"false_easting\",400000],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"2993\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2994, "epsg", 2994,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120"
+        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,"
+        "0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oregon LCC (m)\",GEOGCS[\"NAD83(H"
+        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.75],P"
+        "ARAMETER[\"central_meridian\",-120.5],PARAMETER[\"standa"
+        "rd_parallel_1\",43],PARAMETER[\"standard_parallel_2\",45"
+        ".5],PARAMETER[\"false_easting\",400000],PARAMETER[\"fals"
+        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90"
+        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"2993\"]]"},
+    {2994, "epsg", 2994,
         "NAD83(HARN) / Oregon GIC Lambert (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Oregon GIC Lambert (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne");
-    add_srs_wkt (p, 2,
-        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",41.75],PARAMETER[\"central_meridian\",-120.5],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",43],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 10,
-        "el_2\",45.5],PARAMETER[\"false_easting\",1312335.958],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 13,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"2994\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2995, "epsg", 2995,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120"
+        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Oregon GIC Lambert (ft)\",GEOGCS["
+        "\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Ne"
+        "twork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",41.75],PARAMETER[\"central_meridian\",-120.5],PARAMETER"
+        "[\"standard_parallel_1\",43],PARAMETER[\"standard_parall"
+        "el_2\",45.5],PARAMETER[\"false_easting\",1312335.958],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHO"
+        "RITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"2994\"]]"},
+    {2995, "epsg", 2995,
         "IGN53 Mare / UTM zone 58S", 0, 0,
         "International 1924", "Greenwich",
         "IGN53_Mare", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=287.58,17");
-    add_proj4text (p, 1,
-        "7.78,-135.41,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN53 Mare / UTM zone 58S\",GEOGCS[\"IGN53 Mare");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"IGN53_Mare\",SPHEROID[\"International 1924\",");
-    add_srs_wkt (p, 2,
-        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6641\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4641\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",165],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2995\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2996, "epsg", 2996,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=intl +towgs84=287.58,17"
+        "7.78,-135.41,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGN53 Mare / UTM zone 58S\",GEOGCS[\"IGN53 Mare"
+        "\",DATUM[\"IGN53_Mare\",SPHEROID[\"International 1924\","
+        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EP"
+        "SG\",\"6641\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4641\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",165],PARAMETER"
+        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2995\"]"
+        "]"},
+    {2996, "epsg", 2996,
         "ST84 Ile des Pins / UTM zone 58S", 0, 0,
         "International 1924", "Greenwich",
         "ST84_Ile_des_Pins", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-13,-348,");
-    add_proj4text (p, 1,
-        "292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ST84 Ile des Pins / UTM zone 58S\",GEOGCS[\"ST8");
-    add_srs_wkt (p, 1,
-        "4 Ile des Pins\",DATUM[\"ST84_Ile_des_Pins\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "22\"]],AUTHORITY[\"EPSG\",\"6642\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4642\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",165],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"2996\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2997, "epsg", 2997,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-13,-348,"
+        "292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ST84 Ile des Pins / UTM zone 58S\",GEOGCS[\"ST8"
+        "4 Ile des Pins\",DATUM[\"ST84_Ile_des_Pins\",SPHEROID[\""
+        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70"
+        "22\"]],AUTHORITY[\"EPSG\",\"6642\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4642\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",165],PARAMETER[\"scale_factor\",0.9996],PARAMETER"
+        "[\"false_easting\",500000],PARAMETER[\"false_northing\","
+        "10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"2996\"]]"},
+    {2997, "epsg", 2997,
         "ST71 Belep / UTM zone 58S", 0, 0,
         "International 1924", "Greenwich",
         "ST71_Belep", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-480.26,-");
-    add_proj4text (p, 1,
-        "438.32,-643.429,16.3119,20.1721,-4.0349,-111.7002 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ST71 Belep / UTM zone 58S\",GEOGCS[\"ST71 Belep");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"ST71_Belep\",SPHEROID[\"International 1924\",");
-    add_srs_wkt (p, 2,
-        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6643\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4643\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",165],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2997\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 2998, "epsg", 2998,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-480.26,-"
+        "438.32,-643.429,16.3119,20.1721,-4.0349,-111.7002 +units"
+        "=m +no_defs",
+        "PROJCS[\"ST71 Belep / UTM zone 58S\",GEOGCS[\"ST71 Belep"
+        "\",DATUM[\"ST71_Belep\",SPHEROID[\"International 1924\","
+        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EP"
+        "SG\",\"6643\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4643\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",165],PARAMETER"
+        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2997\"]"
+        "]"},
+    {2998, "epsg", 2998,
         "NEA74 Noumea / UTM zone 58S", 0, 0,
         "International 1924", "Greenwich",
         "NEA74_Noumea", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-10.18,-3");
-    add_proj4text (p, 1,
-        "50.43,291.37,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NEA74 Noumea / UTM zone 58S\",GEOGCS[\"NEA74 No");
-    add_srs_wkt (p, 1,
-        "umea\",DATUM[\"NEA74_Noumea\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6644\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4644\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",165],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "998\"]]");
-    p = add_epsg_def_ex (filter, first, last, 2999, "epsg", 2999,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-10.18,-3"
+        "50.43,291.37,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NEA74 Noumea / UTM zone 58S\",GEOGCS[\"NEA74 No"
+        "umea\",DATUM[\"NEA74_Noumea\",SPHEROID[\"International 1"
+        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6644\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4644\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",165],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "998\"]]"},
+    {2999, "epsg", 2999,
         "Grand Comoros / UTM zone 38S", 0, 0,
         "International 1924", "Greenwich",
         "Grand_Comoros", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-963,510,");
-    add_proj4text (p, 1,
-        "-359,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Grand Comoros / UTM zone 38S\",GEOGCS[\"Grand C");
-    add_srs_wkt (p, 1,
-        "omoros\",DATUM[\"Grand_Comoros\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6646\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4646");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",45],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",500000],PARAMETER[\"false_northing\",10000000],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"2999\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3000, "epsg", 3000,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-963,510,"
+        "-359,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Grand Comoros / UTM zone 38S\",GEOGCS[\"Grand C"
+        "omoros\",DATUM[\"Grand_Comoros\",SPHEROID[\"Internationa"
+        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO"
+        "RITY[\"EPSG\",\"6646\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4646"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",0],PARAMETER[\"central_meridian\",45],"
+        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",10000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"2999\"]]"},
+    {3000, "epsg", 3000,
         "Segara / NEIEZ", 0, 0,
         "Bessel 1841", "Greenwich",
         "Gunung_Segara", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=-403,684,41,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Segara / NEIEZ\",GEOGCS[\"Segara\",DATUM[\"Gunu");
-    add_srs_wkt (p, 1,
-        "ng_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,299.152");
-    add_srs_wkt (p, 2,
-        "8128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6613\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4613\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Mercator_1SP\"],PARAMETER[\"central_meridian\",110],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"scale_factor\",0.997],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 8,
-        "g\",3900000],PARAMETER[\"false_northing\",900000],UNIT[\"");
-    add_srs_wkt (p, 9,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 10,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"300");
-    add_srs_wkt (p, 11,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3001, "epsg", 3001,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 "
+        "+ellps=bessel +towgs84=-403,684,41,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"Segara / NEIEZ\",GEOGCS[\"Segara\",DATUM[\"Gunu"
+        "ng_Segara\",SPHEROID[\"Bessel 1841\",6377397.155,299.152"
+        "8128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\""
+        "6613\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4613\"]],PROJECTION["
+        "\"Mercator_1SP\"],PARAMETER[\"central_meridian\",110],PA"
+        "RAMETER[\"scale_factor\",0.997],PARAMETER[\"false_eastin"
+        "g\",3900000],PARAMETER[\"false_northing\",900000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"300"
+        "0\"]]"},
+    {3001, "epsg", 3001,
         "Batavia / NEIEZ", 0, 0,
         "Bessel 1841", "Greenwich",
         "Batavia", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=-377,681,-50,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Batavia / NEIEZ\",GEOGCS[\"Batavia\",DATUM[\"Ba");
-    add_srs_wkt (p, 1,
-        "tavia\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6211");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4211\"]],PROJECTION[\"Me");
-    add_srs_wkt (p, 6,
-        "rcator_1SP\"],PARAMETER[\"central_meridian\",110],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"scale_factor\",0.997],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 8,
-        "3900000],PARAMETER[\"false_northing\",900000],UNIT[\"met");
-    add_srs_wkt (p, 9,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 10,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3001\"");
-    add_srs_wkt (p, 11,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3002, "epsg", 3002,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 "
+        "+ellps=bessel +towgs84=-377,681,-50,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"Batavia / NEIEZ\",GEOGCS[\"Batavia\",DATUM[\"Ba"
+        "tavia\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128"
+        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6211"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4211\"]],PROJECTION[\"Me"
+        "rcator_1SP\"],PARAMETER[\"central_meridian\",110],PARAME"
+        "TER[\"scale_factor\",0.997],PARAMETER[\"false_easting\","
+        "3900000],PARAMETER[\"false_northing\",900000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3001\""
+        "]]"},
+    {3002, "epsg", 3002,
         "Makassar / NEIEZ", 0, 0,
         "Bessel 1841", "Greenwich",
         "Makassar", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +towgs84=-587.8,519.75,145.76,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Makassar / NEIEZ\",GEOGCS[\"Makassar\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Makassar\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "257\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4257\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Mercator_1SP\"],PARAMETER[\"central_meridian\",110],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"scale_factor\",0.997],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 8,
-        ",3900000],PARAMETER[\"false_northing\",900000],UNIT[\"me");
-    add_srs_wkt (p, 9,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 10,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3002\"");
-    add_srs_wkt (p, 11,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3003, "epsg", 3003,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=110 +k=0.997 +x_0=3900000 +y_0=900000 "
+        "+ellps=bessel +towgs84=-587.8,519.75,145.76,0,0,0,0 +uni"
+        "ts=m +no_defs",
+        "PROJCS[\"Makassar / NEIEZ\",GEOGCS[\"Makassar\",DATUM[\""
+        "Makassar\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528"
+        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6"
+        "257\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4257\"]],PROJECTION[\""
+        "Mercator_1SP\"],PARAMETER[\"central_meridian\",110],PARA"
+        "METER[\"scale_factor\",0.997],PARAMETER[\"false_easting\""
+        ",3900000],PARAMETER[\"false_northing\",900000],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3002\""
+        "]]"},
+    {3003, "epsg", 3003,
         "Monte Mario / Italy zone 1", 0, 0,
         "International 1924", "Greenwich",
         "Monte_Mario", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.9996 +x_0=1500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-104.1,-49.1,-9.9,0.971,-2.917,");
-    add_proj4text (p, 2,
-        "0.714,-11.68 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Monte Mario / Italy zone 1\",GEOGCS[\"Monte Mar");
-    add_srs_wkt (p, 1,
-        "io\",DATUM[\"Monte_Mario\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6265\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4265\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",9],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3003\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3004, "epsg", 3004,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.9996 +x_0=1500000 +y_"
+        "0=0 +ellps=intl +towgs84=-104.1,-49.1,-9.9,0.971,-2.917,"
+        "0.714,-11.68 +units=m +no_defs",
+        "PROJCS[\"Monte Mario / Italy zone 1\",GEOGCS[\"Monte Mar"
+        "io\",DATUM[\"Monte_Mario\",SPHEROID[\"International 1924"
+        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\""
+        "EPSG\",\"6265\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4265\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",9],PARAMETE"
+        "R[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",1"
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3003\"]]"},
+    {3004, "epsg", 3004,
         "Monte Mario / Italy zone 2", 0, 0,
         "International 1924", "Greenwich",
         "Monte_Mario", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9996 +x_0=2520000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-104.1,-49.1,-9.9,0.971,-2.917");
-    add_proj4text (p, 2,
-        ",0.714,-11.68 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Monte Mario / Italy zone 2\",GEOGCS[\"Monte Mar");
-    add_srs_wkt (p, 1,
-        "io\",DATUM[\"Monte_Mario\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6265\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4265\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",15],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 9,
-        "2520000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3004\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3005, "epsg", 3005,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9996 +x_0=2520000 +y"
+        "_0=0 +ellps=intl +towgs84=-104.1,-49.1,-9.9,0.971,-2.917"
+        ",0.714,-11.68 +units=m +no_defs",
+        "PROJCS[\"Monte Mario / Italy zone 2\",GEOGCS[\"Monte Mar"
+        "io\",DATUM[\"Monte_Mario\",SPHEROID[\"International 1924"
+        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\""
+        "EPSG\",\"6265\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4265\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",15],PARAMET"
+        "ER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\","
+        "2520000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3004\"]]"},
+    {3005, "epsg", 3005,
         "NAD83 / BC Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=50 +lat_2=58.5 +lat_0=45 +lon_0=-126 +x");
-    add_proj4text (p, 1,
-        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / BC Albers\",GEOGCS[\"NAD83\",DATUM[\"No");
-    add_srs_wkt (p, 1,
-        "rth_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 7,
-        "de_of_center\",45],PARAMETER[\"longitude_of_center\",-12");
-    add_srs_wkt (p, 8,
-        "6],PARAMETER[\"standard_parallel_1\",50],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_2\",58.5],PARAMETER[\"false_easting\",100");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3005\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3006, "epsg", 3006,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=50 +lat_2=58.5 +lat_0=45 +lon_0=-126 +x"
+        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83 / BC Albers\",GEOGCS[\"NAD83\",DATUM[\"No"
+        "rth_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378137,"
+        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],PR"
+        "OJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"latitu"
+        "de_of_center\",45],PARAMETER[\"longitude_of_center\",-12"
+        "6],PARAMETER[\"standard_parallel_1\",50],PARAMETER[\"sta"
+        "ndard_parallel_2\",58.5],PARAMETER[\"false_easting\",100"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3005\"]]"},
+    {3006, "epsg", 3006,
         "SWEREF99 TM", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 TM\",GEOGCS[\"SWEREF99\",DATUM[\"SWERE");
-    add_srs_wkt (p, 1,
-        "F99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 6,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"central_meridian\",15],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 8,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 10,
-        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"3006\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3007, "epsg", 3007,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=33 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"SWEREF99 TM\",GEOGCS[\"SWEREF99\",DATUM[\"SWERE"
+        "F99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET"
+        "ER[\"central_meridian\",15],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"3006\"]]"},
+    {3007, "epsg", 3007,
         "SWEREF99 12 00", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=150000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 12 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",12],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 8,
-        "\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 10,
-        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"3007\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3008, "epsg", 3008,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=150000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 12 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",12],PARAMETER[\"scale_factor"
+        "\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"3007\"]]"},
+    {3008, "epsg", 3008,
         "SWEREF99 13 30", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.5 +k=1 +x_0=150000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 13 30\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",13.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 8,
-        "or\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3008\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3009, "epsg", 3009,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=13.5 +k=1 +x_0=150000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 13 30\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",13.5],PARAMETER[\"scale_fact"
+        "or\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3008\"]]"},
+    {3009, "epsg", 3009,
         "SWEREF99 15 00", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=150000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 15 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",15],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 8,
-        "\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 10,
-        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"3009\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3010, "epsg", 3010,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=150000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 15 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",15],PARAMETER[\"scale_factor"
+        "\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"3009\"]]"},
+    {3010, "epsg", 3010,
         "SWEREF99 16 30", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.5 +k=1 +x_0=150000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 16 30\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",16.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 8,
-        "or\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3010\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3011, "epsg", 3011,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=16.5 +k=1 +x_0=150000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 16 30\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",16.5],PARAMETER[\"scale_fact"
+        "or\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3010\"]]"},
+    {3011, "epsg", 3011,
         "SWEREF99 18 00", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=150000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 18 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",18],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 8,
-        "\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 10,
-        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"3011\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3012, "epsg", 3012,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=150000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 18 00\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",18],PARAMETER[\"scale_factor"
+        "\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"3011\"]]"},
+    {3012, "epsg", 3012,
         "SWEREF99 14 15", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=14.25 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 14 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",14.25],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3012\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3013, "epsg", 3013,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=14.25 +k=1 +x_0=150000 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 14 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",14.25],PARAMETER[\"scale_fac"
+        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3012\"]]"},
+    {3013, "epsg", 3013,
         "SWEREF99 15 45", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.75 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 15 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",15.75],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3013\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3014, "epsg", 3014,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15.75 +k=1 +x_0=150000 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 15 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",15.75],PARAMETER[\"scale_fac"
+        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3013\"]]"},
+    {3014, "epsg", 3014,
         "SWEREF99 17 15", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17.25 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 17 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",17.25],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3014\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3015, "epsg", 3015,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=17.25 +k=1 +x_0=150000 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 17 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",17.25],PARAMETER[\"scale_fac"
+        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3014\"]]"},
+    {3015, "epsg", 3015,
         "SWEREF99 18 45", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.75 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 18 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",18.75],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3015\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3016, "epsg", 3016,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18.75 +k=1 +x_0=150000 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 18 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",18.75],PARAMETER[\"scale_fac"
+        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3015\"]]"},
+    {3016, "epsg", 3016,
         "SWEREF99 20 15", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20.25 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 20 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",20.25],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3016\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3017, "epsg", 3017,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=20.25 +k=1 +x_0=150000 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 20 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",20.25],PARAMETER[\"scale_fac"
+        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3016\"]]"},
+    {3017, "epsg", 3017,
         "SWEREF99 21 45", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21.75 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 21 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",21.75],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3017\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3018, "epsg", 3018,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21.75 +k=1 +x_0=150000 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 21 45\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",21.75],PARAMETER[\"scale_fac"
+        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3017\"]]"},
+    {3018, "epsg", 3018,
         "SWEREF99 23 15", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23.25 +k=1 +x_0=150000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 23 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",23.25],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"3018\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3019, "epsg", 3019,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=23.25 +k=1 +x_0=150000 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 23 15\",GEOGCS[\"SWEREF99\",DATUM[\"SW"
+        "EREF99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",23.25],PARAMETER[\"scale_fac"
+        "tor\",1],PARAMETER[\"false_easting\",150000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3018\"]]"},
+    {3019, "epsg", 3019,
         "RT90 7.5 gon V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.30827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 7.5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets");
-    add_srs_wkt (p, 1,
-        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",11.30827");
-    add_srs_wkt (p, 8,
-        "77777778],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",1500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3019\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3020, "epsg", 3020,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=11.30827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-"
+        "0.855,2.141,-7.023,0 +units=m +no_defs",
+        "PROJCS[\"RT90 7.5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets"
+        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397"
+        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY"
+        "[\"EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",11.30827"
+        "77777778],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",1500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "3019\"]]"},
+    {3020, "epsg", 3020,
         "RT90 5 gon V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.55827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets_k");
-    add_srs_wkt (p, 1,
-        "oordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.1");
-    add_srs_wkt (p, 2,
-        "55,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",13.55827777");
-    add_srs_wkt (p, 8,
-        "77778],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3020");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3021, "epsg", 3021,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=13.55827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-"
+        "0.855,2.141,-7.023,0 +units=m +no_defs",
+        "PROJCS[\"RT90 5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets_k"
+        "oordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.1"
+        "55,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\""
+        "EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",13.55827777"
+        "77778],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e"
+        "asting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3020"
+        "\"]]"},
+    {3021, "epsg", 3021,
         "RT90 2.5 gon V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 2.5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets");
-    add_srs_wkt (p, 1,
-        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",15.80827");
-    add_srs_wkt (p, 8,
-        "77777778],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",1500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3021\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3022, "epsg", 3022,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-"
+        "0.855,2.141,-7.023,0 +units=m +no_defs",
+        "PROJCS[\"RT90 2.5 gon V\",GEOGCS[\"RT90\",DATUM[\"Rikets"
+        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397"
+        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY"
+        "[\"EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",15.80827"
+        "77777778],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",1500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "3021\"]]"},
+    {3022, "epsg", 3022,
         "RT90 0 gon", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.05827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 0 gon\",GEOGCS[\"RT90\",DATUM[\"Rikets_koo");
-    add_srs_wkt (p, 1,
-        "rdinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.155");
-    add_srs_wkt (p, 2,
-        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",18.058277777");
-    add_srs_wkt (p, 8,
-        "7778],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3022");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3023, "epsg", 3023,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18.05827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-"
+        "0.855,2.141,-7.023,0 +units=m +no_defs",
+        "PROJCS[\"RT90 0 gon\",GEOGCS[\"RT90\",DATUM[\"Rikets_koo"
+        "rdinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.155"
+        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E"
+        "PSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",18.058277777"
+        "7778],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3022"
+        "\"]]"},
+    {3023, "epsg", 3023,
         "RT90 2.5 gon O", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20.30827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 2.5 gon O\",GEOGCS[\"RT90\",DATUM[\"Rikets");
-    add_srs_wkt (p, 1,
-        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",20.30827");
-    add_srs_wkt (p, 8,
-        "77777778],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",1500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3023\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3024, "epsg", 3024,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=20.30827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-"
+        "0.855,2.141,-7.023,0 +units=m +no_defs",
+        "PROJCS[\"RT90 2.5 gon O\",GEOGCS[\"RT90\",DATUM[\"Rikets"
+        "_koordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397"
+        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY"
+        "[\"EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",20.30827"
+        "77777778],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",1500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "3023\"]]"},
+    {3024, "epsg", 3024,
         "RT90 5 gon O", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rikets_koordinatsystem_1990", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22.55827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-");
-    add_proj4text (p, 2,
-        "0.855,2.141,-7.023,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT90 5 gon O\",GEOGCS[\"RT90\",DATUM[\"Rikets_k");
-    add_srs_wkt (p, 1,
-        "oordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.1");
-    add_srs_wkt (p, 2,
-        "55,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",22.55827777");
-    add_srs_wkt (p, 8,
-        "77778],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3024");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3025, "epsg", 3025,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=22.55827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +towgs84=414.1,41.3,603.1,-"
+        "0.855,2.141,-7.023,0 +units=m +no_defs",
+        "PROJCS[\"RT90 5 gon O\",GEOGCS[\"RT90\",DATUM[\"Rikets_k"
+        "oordinatsystem_1990\",SPHEROID[\"Bessel 1841\",6377397.1"
+        "55,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\""
+        "EPSG\",\"6124\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4124\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",22.55827777"
+        "77778],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e"
+        "asting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3024"
+        "\"]]"},
+    {3025, "epsg", 3025,
         "RT38 7.5 gon V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Stockholm_1938", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.30827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 7.5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockh");
-    add_srs_wkt (p, 1,
-        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",11.3082777777778],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 9,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 10,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3025\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3026, "epsg", 3026,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=11.30827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RT38 7.5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockh"
+        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528"
+        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6"
+        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",11.3082777777778],PARA"
+        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A"
+        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3025\"]]"},
+    {3026, "epsg", 3026,
         "RT38 5 gon V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Stockholm_1938", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.55827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockhol");
-    add_srs_wkt (p, 1,
-        "m_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.152812");
-    add_srs_wkt (p, 2,
-        "8,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"630");
-    add_srs_wkt (p, 3,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 6,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",13.5582777777778],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",150");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 10,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3026\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3027, "epsg", 3027,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=13.55827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RT38 5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockhol"
+        "m_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.152812"
+        "8,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"630"
+        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",13.5582777777778],PARAM"
+        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",150"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX"
+        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3026\"]]"},
+    {3027, "epsg", 3027,
         "RT38 2.5 gon V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Stockholm_1938", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 2.5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockh");
-    add_srs_wkt (p, 1,
-        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",15.8082777777778],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 9,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 10,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3027\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3028, "epsg", 3028,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RT38 2.5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockh"
+        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528"
+        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6"
+        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",15.8082777777778],PARA"
+        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A"
+        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3027\"]]"},
+    {3028, "epsg", 3028,
         "RT38 0 gon", 0, 1,
         "Bessel 1841", "Greenwich",
         "Stockholm_1938", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.05827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 0 gon\",GEOGCS[\"RT38\",DATUM[\"Stockholm_");
-    add_srs_wkt (p, 1,
-        "1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6308\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 6,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"central_meridian\",18.0582777777778],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",1],PARAMETER[\"false_easting\",150000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3028\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3029, "epsg", 3029,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18.05827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RT38 0 gon\",GEOGCS[\"RT38\",DATUM[\"Stockholm_"
+        "1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,"
+        "AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6308\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",18.0582777777778],PARAMETE"
+        "R[\"scale_factor\",1],PARAMETER[\"false_easting\",150000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3028\"]]"},
+    {3029, "epsg", 3029,
         "RT38 2.5 gon O", 0, 1,
         "Bessel 1841", "Greenwich",
         "Stockholm_1938", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20.30827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 2.5 gon O\",GEOGCS[\"RT38\",DATUM[\"Stockh");
-    add_srs_wkt (p, 1,
-        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",20.3082777777778],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 9,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 10,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3029\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3030, "epsg", 3030,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=20.30827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RT38 2.5 gon O\",GEOGCS[\"RT38\",DATUM[\"Stockh"
+        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528"
+        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6"
+        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",20.3082777777778],PARA"
+        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A"
+        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3029\"]]"},
+    {3030, "epsg", 3030,
         "RT38 5 gon O", 0, 1,
         "Bessel 1841", "Greenwich",
         "Stockholm_1938", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22.55827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 5 gon O\",GEOGCS[\"RT38\",DATUM[\"Stockhol");
-    add_srs_wkt (p, 1,
-        "m_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.152812");
-    add_srs_wkt (p, 2,
-        "8,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"630");
-    add_srs_wkt (p, 3,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 6,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",22.5582777777778],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",150");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 10,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3030\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3031, "epsg", 3031,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=22.55827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RT38 5 gon O\",GEOGCS[\"RT38\",DATUM[\"Stockhol"
+        "m_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.152812"
+        "8,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"630"
+        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",22.5582777777778],PARAM"
+        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",150"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX"
+        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3030\"]]"},
+    {3031, "epsg", 3031,
         "WGS 84 / Antarctic Polar Stereographic", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-71 +lon_0=0 +k=1 +x_0=0 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Antarctic Polar Stereographic\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781");
-    add_srs_wkt (p, 2,
-        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Polar_Stereographic\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",-71],PARAMETER[\"central_meridian\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"3031\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3032, "epsg", 3032,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-71 +lon_0=0 +k=1 +x_0=0 "
+        "+y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / Antarctic Polar Stereographic\",GEOGCS"
+        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781"
+        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY"
+        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]]"
+        ",PROJECTION[\"Polar_Stereographic\"],PARAMETER[\"latitud"
+        "e_of_origin\",-71],PARAMETER[\"central_meridian\",0],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3031\"]]"},
+    {3032, "epsg", 3032,
         "WGS 84 / Australian Antarctic Polar Stereographic", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-71 +lon_0=70 +k=1 +x_0=6");
-    add_proj4text (p, 1,
-        "000000 +y_0=6000000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Australian Antarctic Polar Stereograph");
-    add_srs_wkt (p, 1,
-        "ic\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS");
-    add_srs_wkt (p, 2,
-        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",-71],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 8,
-        "an\",70],PARAMETER[\"false_easting\",6000000],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_northing\",6000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",NORTH],AXIS[\"Northin");
-    add_srs_wkt (p, 11,
-        "g\",NORTH],AUTHORITY[\"EPSG\",\"3032\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3033, "epsg", 3033,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-71 +lon_0=70 +k=1 +x_0=6"
+        "000000 +y_0=6000000 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / Australian Antarctic Polar Stereograph"
+        "ic\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS"
+        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]"
+        "],AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETE"
+        "R[\"latitude_of_origin\",-71],PARAMETER[\"central_meridi"
+        "an\",70],PARAMETER[\"false_easting\",6000000],PARAMETER["
+        "\"false_northing\",6000000],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",NORTH],AXIS[\"Northin"
+        "g\",NORTH],AUTHORITY[\"EPSG\",\"3032\"]]"},
+    {3033, "epsg", 3033,
         "WGS 84 / Australian Antarctic Lambert", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.5 +lat_2=-74.5 +lat_0=-50 +lon_0=70");
-    add_proj4text (p, 1,
-        " +x_0=6000000 +y_0=6000000 +datum=WGS84 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Australian Antarctic Lambert\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-50],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",70],PARAMETER[\"standard_parallel_1\",-68.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-74.5],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",6000000],PARAMETER[\"false_northing\",6000000],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"303");
-    add_srs_wkt (p, 13,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3034, "epsg", 3034,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.5 +lat_2=-74.5 +lat_0=-50 +lon_0=70"
+        " +x_0=6000000 +y_0=6000000 +datum=WGS84 +units=m +no_def"
+        "s",
+        "PROJCS[\"WGS 84 / Australian Antarctic Lambert\",GEOGCS["
+        "\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",637813"
+        "7,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY["
+        "\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],"
+        "PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",-50],PARAMETER[\"central_meridian\""
+        ",70],PARAMETER[\"standard_parallel_1\",-68.5],PARAMETER["
+        "\"standard_parallel_2\",-74.5],PARAMETER[\"false_easting"
+        "\",6000000],PARAMETER[\"false_northing\",6000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"303"
+        "3\"]]"},
+    {3034, "epsg", 3034,
         "ETRS89-extended / LCC Europe", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35 +lat_2=65 +lat_0=52 +lon_0=10 +x_0=4");
-    add_proj4text (p, 1,
-        "000000 +y_0=2800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89-extended / LCC Europe\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 7,
-        "_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",52],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",10],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 9,
-        "lel_1\",35],PARAMETER[\"standard_parallel_2\",65],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_easting\",4000000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",2800000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"3034\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3035, "epsg", 3035,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=35 +lat_2=65 +lat_0=52 +lon_0=10 +x_0=4"
+        "000000 +y_0=2800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"ETRS89-extended / LCC Europe\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conformal"
+        "_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",52],PARAM"
+        "ETER[\"central_meridian\",10],PARAMETER[\"standard_paral"
+        "lel_1\",35],PARAMETER[\"standard_parallel_2\",65],PARAME"
+        "TER[\"false_easting\",4000000],PARAMETER[\"false_northin"
+        "g\",2800000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3034\"]]"},
+    {3035, "epsg", 3035,
         "ETRS89-extended / LAEA Europe", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89-extended / LAEA Europe\",GEOGCS[\"ETRS89");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"European_Terrestrial_Reference_System_1989\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Azimutha");
-    add_srs_wkt (p, 7,
-        "l_Equal_Area\"],PARAMETER[\"latitude_of_center\",52],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"longitude_of_center\",10],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",4321000],PARAMETER[\"false_northing\",3210000],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3035\"]]");
-}
+        "Northing", "North", "Easting", "East",
+        "+proj=laea +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89-extended / LAEA Europe\",GEOGCS[\"ETRS89"
+        "\",DATUM[\"European_Terrestrial_Reference_System_1989\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Azimutha"
+        "l_Equal_Area\"],PARAMETER[\"latitude_of_center\",52],PAR"
+        "AMETER[\"longitude_of_center\",10],PARAMETER[\"false_eas"
+        "ting\",4321000],PARAMETER[\"false_northing\",3210000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3035\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_09 = {
+    epsg_defs_09, sizeof (epsg_defs_09) / sizeof (epsg_defs_09[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3691 +53,2104 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_10 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3036, "epsg", 3036,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_10[] = {
+    {3036, "epsg", 3036,
         "Moznet / UTM zone 36S", 0, 0,
         "WGS 84", "Greenwich",
         "Moznet_ITRF94", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +south +ellps=WGS84 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Moznet / UTM zone 36S\",GEOGCS[\"Moznet\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Moznet_ITRF94\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6130\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4130\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",33],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3036\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3037, "epsg", 3037,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=36 +south +ellps=WGS84 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Moznet / UTM zone 36S\",GEOGCS[\"Moznet\",DATUM"
+        "[\"Moznet_ITRF94\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6130\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4130\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",33],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3036\"]]"},
+    {3037, "epsg", 3037,
         "Moznet / UTM zone 37S", 0, 0,
         "WGS 84", "Greenwich",
         "Moznet_ITRF94", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=37 +south +ellps=WGS84 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Moznet / UTM zone 37S\",GEOGCS[\"Moznet\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Moznet_ITRF94\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6130\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4130\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",39],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3037\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3038, "epsg", 3038,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=37 +south +ellps=WGS84 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Moznet / UTM zone 37S\",GEOGCS[\"Moznet\",DATUM"
+        "[\"Moznet_ITRF94\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6130\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4130\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",39],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3037\"]]"},
+    {3038, "epsg", 3038,
         "ETRS89 / TM26 (deprecated)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=26 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / TM26 (deprecated)\",GEOGCS[\"ETRS89\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-27],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3038\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3039, "epsg", 3039,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=26 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / TM26 (deprecated)\",GEOGCS[\"ETRS89\","
+        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-27],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR"
+        "ITY[\"EPSG\",\"3038\"]]"},
+    {3039, "epsg", 3039,
         "ETRS89 / TM27 (deprecated)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=27 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / TM27 (deprecated)\",GEOGCS[\"ETRS89\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-21],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3039\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3040, "epsg", 3040,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=27 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / TM27 (deprecated)\",GEOGCS[\"ETRS89\","
+        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-21],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR"
+        "ITY[\"EPSG\",\"3039\"]]"},
+    {3040, "epsg", 3040,
         "ETRS89 / UTM zone 28N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 28N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-15],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3040\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3041, "epsg", 3041,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 28N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",-15],PARAMETER[\"scale_factor\",0.9996]"
+        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3040\"]]"},
+    {3041, "epsg", 3041,
         "ETRS89 / UTM zone 29N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 29N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-9],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3041\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3042, "epsg", 3042,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=29 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 29N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",-9],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3041\"]]"},
+    {3042, "epsg", 3042,
         "ETRS89 / UTM zone 30N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 30N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-3],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3042\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3043, "epsg", 3043,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=30 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 30N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",-3],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3042\"]]"},
+    {3043, "epsg", 3043,
         "ETRS89 / UTM zone 31N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=31 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 31N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",3],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3043\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3044, "epsg", 3044,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=31 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 31N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",3],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR"
+        "ITY[\"EPSG\",\"3043\"]]"},
+    {3044, "epsg", 3044,
         "ETRS89 / UTM zone 32N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 32N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",9],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3044\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3045, "epsg", 3045,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=32 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 32N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",9],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR"
+        "ITY[\"EPSG\",\"3044\"]]"},
+    {3045, "epsg", 3045,
         "ETRS89 / UTM zone 33N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 33N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",15],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3045\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3046, "epsg", 3046,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=33 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 33N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",15],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3045\"]]"},
+    {3046, "epsg", 3046,
         "ETRS89 / UTM zone 34N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 34N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",21],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3046\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3047, "epsg", 3047,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=34 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 34N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",21],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3046\"]]"},
+    {3047, "epsg", 3047,
         "ETRS89 / UTM zone 35N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 35N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",27],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3047\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3048, "epsg", 3048,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 35N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",27],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3047\"]]"},
+    {3048, "epsg", 3048,
         "ETRS89 / UTM zone 36N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 36N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",33],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3048\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3049, "epsg", 3049,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=36 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 36N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",33],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3048\"]]"},
+    {3049, "epsg", 3049,
         "ETRS89 / UTM zone 37N (N-E)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=37 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / UTM zone 37N (N-E)\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",39],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3049\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3050, "epsg", 3050,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=37 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / UTM zone 37N (N-E)\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",39],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3049\"]]"},
+    {3050, "epsg", 3050,
         "ETRS89 / TM38 (deprecated)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / TM38 (deprecated)\",GEOGCS[\"ETRS89\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",45],PARAMETER[\"scale_factor\",0.9996],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3050\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3051, "epsg", 3051,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=38 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / TM38 (deprecated)\",GEOGCS[\"ETRS89\","
+        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",45],PARAMETER[\"scale_factor\",0.9996],PA"
+        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORI"
+        "TY[\"EPSG\",\"3050\"]]"},
+    {3051, "epsg", 3051,
         "ETRS89 / TM39 (deprecated)", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / TM39 (deprecated)\",GEOGCS[\"ETRS89\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",51],PARAMETER[\"scale_factor\",0.9996],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3051\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3054, "epsg", 3054,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=39 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / TM39 (deprecated)\",GEOGCS[\"ETRS89\","
+        "DATUM[\"European_Terrestrial_Reference_System_1989\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",51],PARAMETER[\"scale_factor\",0.9996],PA"
+        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORI"
+        "TY[\"EPSG\",\"3051\"]]"},
+    {3054, "epsg", 3054,
         "Hjorsey 1955 / UTM zone 26N", 0, 0,
         "International 1924", "Greenwich",
         "Hjorsey_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=26 +ellps=intl +towgs84=-73,47,-83,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hjorsey 1955 / UTM zone 26N\",GEOGCS[\"Hjorsey ");
-    add_srs_wkt (p, 1,
-        "1955\",DATUM[\"Hjorsey_1955\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6658\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4658\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-27],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3054\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3055, "epsg", 3055,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=26 +ellps=intl +towgs84=-73,47,-83,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Hjorsey 1955 / UTM zone 26N\",GEOGCS[\"Hjorsey "
+        "1955\",DATUM[\"Hjorsey_1955\",SPHEROID[\"International 1"
+        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6658\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4658\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-27],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3054\"]]"},
+    {3055, "epsg", 3055,
         "Hjorsey 1955 / UTM zone 27N", 0, 0,
         "International 1924", "Greenwich",
         "Hjorsey_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=27 +ellps=intl +towgs84=-73,47,-83,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hjorsey 1955 / UTM zone 27N\",GEOGCS[\"Hjorsey ");
-    add_srs_wkt (p, 1,
-        "1955\",DATUM[\"Hjorsey_1955\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6658\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4658\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-21],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3055\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3056, "epsg", 3056,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=27 +ellps=intl +towgs84=-73,47,-83,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Hjorsey 1955 / UTM zone 27N\",GEOGCS[\"Hjorsey "
+        "1955\",DATUM[\"Hjorsey_1955\",SPHEROID[\"International 1"
+        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6658\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4658\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-21],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3055\"]]"},
+    {3056, "epsg", 3056,
         "Hjorsey 1955 / UTM zone 28N", 0, 0,
         "International 1924", "Greenwich",
         "Hjorsey_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-73,47,-83,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hjorsey 1955 / UTM zone 28N\",GEOGCS[\"Hjorsey ");
-    add_srs_wkt (p, 1,
-        "1955\",DATUM[\"Hjorsey_1955\",SPHEROID[\"International 1");
-    add_srs_wkt (p, 2,
-        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6658\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4658\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-15],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3056\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3057, "epsg", 3057,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=intl +towgs84=-73,47,-83,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Hjorsey 1955 / UTM zone 28N\",GEOGCS[\"Hjorsey "
+        "1955\",DATUM[\"Hjorsey_1955\",SPHEROID[\"International 1"
+        "924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6658\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4658\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-15],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3056\"]]"},
+    {3057, "epsg", 3057,
         "ISN93 / Lambert 1993", 0, 0,
         "GRS 1980", "Greenwich",
         "Islands_Net_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=64.25 +lat_2=65.75 +lat_0=65 +lon_0=-19");
-    add_proj4text (p, 1,
-        " +x_0=500000 +y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ISN93 / Lambert 1993\",GEOGCS[\"ISN93\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Islands_Net_1993\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 2,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6659\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4659\"]],PROJECTIO");
-    add_srs_wkt (p, 6,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 7,
-        "of_origin\",65],PARAMETER[\"central_meridian\",-19],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"standard_parallel_1\",64.25],PARAMETER[\"standar");
-    add_srs_wkt (p, 9,
-        "d_parallel_2\",65.75],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",500000],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 11,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3057\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3058, "epsg", 3058,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=64.25 +lat_2=65.75 +lat_0=65 +lon_0=-19"
+        " +x_0=500000 +y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ISN93 / Lambert 1993\",GEOGCS[\"ISN93\",DATUM[\""
+        "Islands_Net_1993\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6659\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4659\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",65],PARAMETER[\"central_meridian\",-19],PARA"
+        "METER[\"standard_parallel_1\",64.25],PARAMETER[\"standar"
+        "d_parallel_2\",65.75],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",500000],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3057\"]]"},
+    {3058, "epsg", 3058,
         "Helle 1954 / Jan Mayen Grid", 0, 1,
         "International 1924", "Greenwich",
         "Helle_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-8.5 +k=1 +x_0=50000 +y_0=-7");
-    add_proj4text (p, 1,
-        "800000 +ellps=intl +towgs84=982.6087,552.753,-540.873,6.");
-    add_proj4text (p, 2,
-        "6816266,-31.6114924,-19.84816,16.805 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Helle 1954 / Jan Mayen Grid\",GEOGCS[\"Helle 19");
-    add_srs_wkt (p, 1,
-        "54\",DATUM[\"Helle_1954\",SPHEROID[\"International 1924\"");
-    add_srs_wkt (p, 2,
-        ",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6660\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4660\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",-8.5],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",-7800000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3058\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3059, "epsg", 3059,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-8.5 +k=1 +x_0=50000 +y_0=-7"
+        "800000 +ellps=intl +towgs84=982.6087,552.753,-540.873,6."
+        "6816266,-31.6114924,-19.84816,16.805 +units=m +no_defs",
+        "PROJCS[\"Helle 1954 / Jan Mayen Grid\",GEOGCS[\"Helle 19"
+        "54\",DATUM[\"Helle_1954\",SPHEROID[\"International 1924\""
+        ",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"E"
+        "PSG\",\"6660\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4660\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",-8.5],PARAME"
+        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",5000"
+        "0],PARAMETER[\"false_northing\",-7800000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3058\"]]"},
+    {3059, "epsg", 3059,
         "LKS92 / Latvia TM", 0, 1,
         "GRS 1980", "Greenwich",
         "Latvia_1992", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=-6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LKS92 / Latvia TM\",GEOGCS[\"LKS92\",DATUM[\"La");
-    add_srs_wkt (p, 1,
-        "tvia_1992\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6661\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4661\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 6,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"central_meridian\",24],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 8,
-        "or\",0.9996],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"false_northing\",-6000000],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 10,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"E");
-    add_srs_wkt (p, 11,
-        "asting\",EAST],AUTHORITY[\"EPSG\",\"3059\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3060, "epsg", 3060,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9996 +x_0=500000 +y_"
+        "0=-6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"LKS92 / Latvia TM\",GEOGCS[\"LKS92\",DATUM[\"La"
+        "tvia_1992\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6661\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4661\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",24],PARAMETER[\"scale_fact"
+        "or\",0.9996],PARAMETER[\"false_easting\",500000],PARAMET"
+        "ER[\"false_northing\",-6000000],UNIT[\"metre\",1,AUTHORI"
+        "TY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"E"
+        "asting\",EAST],AUTHORITY[\"EPSG\",\"3059\"]]"},
+    {3060, "epsg", 3060,
         "IGN72 Grande Terre / UTM zone 58S", 0, 0,
         "International 1924", "Greenwich",
         "IGN72_Grande_Terre", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-11.64,-3");
-    add_proj4text (p, 1,
-        "48.6,291.98,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN72 Grande Terre / UTM zone 58S\",GEOGCS[\"IG");
-    add_srs_wkt (p, 1,
-        "N72 Grande Terre\",DATUM[\"IGN72_Grande_Terre\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7022\"]],AUTHORITY[\"EPSG\",\"6634\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4662\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",165],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3060\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3061, "epsg", 3061,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=intl +towgs84=-11.64,-3"
+        "48.6,291.98,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGN72 Grande Terre / UTM zone 58S\",GEOGCS[\"IG"
+        "N72 Grande Terre\",DATUM[\"IGN72_Grande_Terre\",SPHEROID"
+        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\""
+        "7022\"]],AUTHORITY[\"EPSG\",\"6634\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4662\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",165],PARAMETER[\"scale_factor\",0.9996],PARAMET"
+        "ER[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3060\"]]"},
+    {3061, "epsg", 3061,
         "Porto Santo 1995 / UTM zone 28N", 0, 0,
         "International 1924", "Greenwich",
         "Porto_Santo_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-502.862,-247.43");
-    add_proj4text (p, 1,
-        "8,312.724,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Porto Santo 1995 / UTM zone 28N\",GEOGCS[\"Port");
-    add_srs_wkt (p, 1,
-        "o Santo 1995\",DATUM[\"Porto_Santo_1995\",SPHEROID[\"Int");
-    add_srs_wkt (p, 2,
-        "ernational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6663\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4663\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3061\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3062, "epsg", 3062,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=intl +towgs84=-502.862,-247.43"
+        "8,312.724,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Porto Santo 1995 / UTM zone 28N\",GEOGCS[\"Port"
+        "o Santo 1995\",DATUM[\"Porto_Santo_1995\",SPHEROID[\"Int"
+        "ernational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\""
+        "]],AUTHORITY[\"EPSG\",\"6663\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4663\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3061\"]]"},
+    {3062, "epsg", 3062,
         "Azores Oriental 1995 / UTM zone 26N", 0, 0,
         "International 1924", "Greenwich",
         "Azores_Oriental_Islands_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=26 +ellps=intl +towgs84=-204.619,140.176");
-    add_proj4text (p, 1,
-        ",55.226,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Azores Oriental 1995 / UTM zone 26N\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Azores Oriental 1995\",DATUM[\"Azores_Oriental_Islands_1");
-    add_srs_wkt (p, 2,
-        "995\",SPHEROID[\"International 1924\",6378388,297,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6664\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4664\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-27],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"3062\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3063, "epsg", 3063,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=26 +ellps=intl +towgs84=-204.619,140.176"
+        ",55.226,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Azores Oriental 1995 / UTM zone 26N\",GEOGCS[\""
+        "Azores Oriental 1995\",DATUM[\"Azores_Oriental_Islands_1"
+        "995\",SPHEROID[\"International 1924\",6378388,297,AUTHOR"
+        "ITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6664\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4664\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET"
+        "ER[\"central_meridian\",-27],PARAMETER[\"scale_factor\","
+        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"3062\"]]"},
+    {3063, "epsg", 3063,
         "Azores Central 1995 / UTM zone 26N", 0, 0,
         "International 1924", "Greenwich",
         "Azores_Central_Islands_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=26 +ellps=intl +towgs84=-106.226,166.366");
-    add_proj4text (p, 1,
-        ",-37.893,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Azores Central 1995 / UTM zone 26N\",GEOGCS[\"A");
-    add_srs_wkt (p, 1,
-        "zores Central 1995\",DATUM[\"Azores_Central_Islands_1995");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6665\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4665\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-27],PARAMETER[\"scale_factor\",0.");
-    add_srs_wkt (p, 9,
-        "9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"3063\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3064, "epsg", 3064,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=26 +ellps=intl +towgs84=-106.226,166.366"
+        ",-37.893,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Azores Central 1995 / UTM zone 26N\",GEOGCS[\"A"
+        "zores Central 1995\",DATUM[\"Azores_Central_Islands_1995"
+        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY"
+        "[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6665\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4665\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-27],PARAMETER[\"scale_factor\",0."
+        "9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3063\"]]"},
+    {3064, "epsg", 3064,
         "IGM95 / UTM zone 32N", 0, 0,
         "GRS 1980", "Greenwich",
         "Istituto_Geografico_Militaire_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGM95 / UTM zone 32N\",GEOGCS[\"IGM95\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Istituto_Geografico_Militaire_1995\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6670\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4670\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"306");
-    add_srs_wkt (p, 12,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3065, "epsg", 3065,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"IGM95 / UTM zone 32N\",GEOGCS[\"IGM95\",DATUM[\""
+        "Istituto_Geografico_Militaire_1995\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6670\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4670\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9"
+        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"306"
+        "4\"]]"},
+    {3065, "epsg", 3065,
         "IGM95 / UTM zone 33N", 0, 0,
         "GRS 1980", "Greenwich",
         "Istituto_Geografico_Militaire_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGM95 / UTM zone 33N\",GEOGCS[\"IGM95\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Istituto_Geografico_Militaire_1995\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6670\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4670\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"306");
-    add_srs_wkt (p, 12,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3066, "epsg", 3066,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"IGM95 / UTM zone 33N\",GEOGCS[\"IGM95\",DATUM[\""
+        "Istituto_Geografico_Militaire_1995\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6670\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4670\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"306"
+        "5\"]]"},
+    {3066, "epsg", 3066,
         "ED50 / Jordan TM", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=37 +k=0.9998 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=-3000000 +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / Jordan TM\",GEOGCS[\"ED50\",DATUM[\"Euro");
-    add_srs_wkt (p, 1,
-        "pean_Datum_1950\",SPHEROID[\"International 1924\",637838");
-    add_srs_wkt (p, 2,
-        "8,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",37],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9998],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",-3000000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3066\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3067, "epsg", 3067,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=37 +k=0.9998 +x_0=500000 +y_"
+        "0=-3000000 +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +un"
+        "its=m +no_defs",
+        "PROJCS[\"ED50 / Jordan TM\",GEOGCS[\"ED50\",DATUM[\"Euro"
+        "pean_Datum_1950\",SPHEROID[\"International 1924\",637838"
+        "8,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\""
+        "6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",37],PARAMETER[\"scale"
+        "_factor\",0.9998],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",-3000000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3066\"]]"},
+    {3067, "epsg", 3067,
         "ETRS89 / TM35FIN(E,N)", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / TM35FIN(E,N)\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",27],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"3067\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3068, "epsg", 3068,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"ETRS89 / TM35FIN(E,N)\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",27],PARAMETER[\"scale_factor\",0.9996],PARAMETE"
+        "R[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3067\"]]"},
+    {3068, "epsg", 3068,
         "DHDN / Soldner Berlin", 0, 1,
         "Bessel 1841", "Greenwich",
         "Deutsches_Hauptdreiecksnetz", "Cassini_Soldner", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=52.41864827777778 +lon_0=13.6272036666");
-    add_proj4text (p, 1,
-        "6667 +x_0=40000 +y_0=10000 +ellps=bessel +towgs84=598.1,");
-    add_proj4text (p, 2,
-        "73.7,418.2,0.202,0.045,-2.455,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / Soldner Berlin\",GEOGCS[\"DHDN\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Deutsches_Hauptdreiecksnetz\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"43");
-    add_srs_wkt (p, 6,
-        "14\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",52.4186482777778],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",13.6272036666667],PARAMETER[\"false_easting\",4");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",10000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3068\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3069, "epsg", 3069,
+        "Northing", "North", "Easting", "East",
+        "+proj=cass +lat_0=52.41864827777778 +lon_0=13.6272036666"
+        "6667 +x_0=40000 +y_0=10000 +ellps=bessel +towgs84=598.1,"
+        "73.7,418.2,0.202,0.045,-2.455,6.7 +units=m +no_defs",
+        "PROJCS[\"DHDN / Soldner Berlin\",GEOGCS[\"DHDN\",DATUM[\""
+        "Deutsches_Hauptdreiecksnetz\",SPHEROID[\"Bessel 1841\",6"
+        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT"
+        "HORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"43"
+        "14\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"latit"
+        "ude_of_origin\",52.4186482777778],PARAMETER[\"central_me"
+        "ridian\",13.6272036666667],PARAMETER[\"false_easting\",4"
+        "0000],PARAMETER[\"false_northing\",10000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3068\"]]"},
+    {3069, "epsg", 3069,
         "NAD27 / Wisconsin Transverse Mercator", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=-4500000 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Wisconsin Transverse Mercator\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-90],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",-4500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"3069\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3070, "epsg", 3070,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=500000 +y"
+        "_0=-4500000 +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / Wisconsin Transverse Mercator\",GEOGCS["
+        "\"NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\""
+        "Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPS"
+        "G\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-90],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",-4500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3069\"]]"},
+    {3070, "epsg", 3070,
         "NAD83 / Wisconsin Transverse Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y");
-    add_proj4text (p, 1,
-        "_0=-4480000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wisconsin Transverse Mercator\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-90],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",520000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "-4480000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3070\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3071, "epsg", 3071,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y"
+        "_0=-4480000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"NAD83 / Wisconsin Transverse Mercator\",GEOGCS["
+        "\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-90],PARAMETER[\"scale_factor\",0.9996],PARAMETER"
+        "[\"false_easting\",520000],PARAMETER[\"false_northing\","
+        "-4480000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"3070\"]]"},
+    {3071, "epsg", 3071,
         "NAD83(HARN) / Wisconsin Transverse Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y");
-    add_proj4text (p, 1,
-        "_0=-4480000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wisconsin Transverse Mercator\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refere");
-    add_srs_wkt (p, 2,
-        "nce_Network\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"615");
-    add_srs_wkt (p, 4,
-        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-90],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.9996],PARAMETER[\"false_easting\",520000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",-4480000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 11,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3071\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3072, "epsg", 3072,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y"
+        "_0=-4480000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wisconsin Transverse Mercator\",G"
+        "EOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refere"
+        "nce_Network\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"615"
+        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",-90],PARAMETER[\"scale_"
+        "factor\",0.9996],PARAMETER[\"false_easting\",520000],PAR"
+        "AMETER[\"false_northing\",-4480000],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3071\"]]"},
+    {3072, "epsg", 3072,
         "NAD83 / Maine CS2000 East", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Maine CS2000 East\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",43.8333333333333],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-67.875],PARAMETER[\"scale_factor\",0.99998]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",700000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3072\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3073, "epsg", 3073,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0"
+        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Maine CS2000 East\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",43.8333333333333],PARAMETER[\"central"
+        "_meridian\",-67.875],PARAMETER[\"scale_factor\",0.99998]"
+        ",PARAMETER[\"false_easting\",700000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3072\"]]"},
+    {3073, "epsg", 3073,
         "NAD83 / Maine CS2000 Central", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43 +lon_0=-69.125 +k=0.99998 +x_0=500");
-    add_proj4text (p, 1,
-        "000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Maine CS2000 Central\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",43.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-69.125],PARAMETER[\"scale_factor\",0.99998],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3463\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3074, "epsg", 3074,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43 +lon_0=-69.125 +k=0.99998 +x_0=500"
+        "000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83 / Maine CS2000 Central\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",43.5],PARAMETER[\"central_meridian\""
+        ",-69.125],PARAMETER[\"scale_factor\",0.99998],PARAMETER["
+        "\"false_easting\",500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3463\"]]"},
+    {3074, "epsg", 3074,
         "NAD83 / Maine CS2000 West", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Maine CS2000 West\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",42.8333333333333],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-70.375],PARAMETER[\"scale_factor\",0.99998]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",300000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3074\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3075, "epsg", 3075,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0"
+        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Maine CS2000 West\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",42.8333333333333],PARAMETER[\"central"
+        "_meridian\",-70.375],PARAMETER[\"scale_factor\",0.99998]"
+        ",PARAMETER[\"false_easting\",300000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3074\"]]"},
+    {3075, "epsg", 3075,
         "NAD83(HARN) / Maine CS2000 East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Maine CS2000 East\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",43.8333333333333");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-67.875],PARAMETER[\"sc");
-    add_srs_wkt (p, 9,
-        "ale_factor\",0.99998],PARAMETER[\"false_easting\",700000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3075\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3076, "epsg", 3076,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0"
+        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Maine CS2000 East\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",43.8333333333333"
+        "],PARAMETER[\"central_meridian\",-67.875],PARAMETER[\"sc"
+        "ale_factor\",0.99998],PARAMETER[\"false_easting\",700000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3075\"]]"},
+    {3076, "epsg", 3076,
         "NAD83(HARN) / Maine CS2000 Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43 +lon_0=-69.125 +k=0.99998 +x_0=500");
-    add_proj4text (p, 1,
-        "000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Maine CS2000 Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",43.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-69.125],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.99998],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3464\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3077, "epsg", 3077,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43 +lon_0=-69.125 +k=0.99998 +x_0=500"
+        "000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(HARN) / Maine CS2000 Central\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",43.5],PARAM"
+        "ETER[\"central_meridian\",-69.125],PARAMETER[\"scale_fac"
+        "tor\",0.99998],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3464\"]]"},
+    {3077, "epsg", 3077,
         "NAD83(HARN) / Maine CS2000 West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Maine CS2000 West\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",42.8333333333333");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-70.375],PARAMETER[\"sc");
-    add_srs_wkt (p, 9,
-        "ale_factor\",0.99998],PARAMETER[\"false_easting\",300000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3077\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3078, "epsg", 3078,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0"
+        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Maine CS2000 West\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",42.8333333333333"
+        "],PARAMETER[\"central_meridian\",-70.375],PARAMETER[\"sc"
+        "ale_factor\",0.99998],PARAMETER[\"false_easting\",300000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3077\"]]"},
+    {3078, "epsg", 3078,
         "NAD83 / Michigan Oblique Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33");
-    add_proj4text (p, 1,
-        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no");
-    add_proj4text (p, 2,
-        "_uoff +gamma=337.25556 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Michigan Oblique Mercator\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_center\",45.3091666666667],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"longitude_of_center\",-86],PARAMETER[\"azimuth\",337.");
-    add_srs_wkt (p, 9,
-        "25556],PARAMETER[\"rectified_grid_angle\",337.25556],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",2546731.496],PARAMETER[\"false_northing\",-4354009.8");
-    add_srs_wkt (p, 12,
-        "16],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"3078\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3079, "epsg", 3079,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33"
+        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no"
+        "_uoff +gamma=337.25556 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Michigan Oblique Mercator\",GEOGCS[\"NA"
+        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],PARA"
+        "METER[\"latitude_of_center\",45.3091666666667],PARAMETER"
+        "[\"longitude_of_center\",-86],PARAMETER[\"azimuth\",337."
+        "25556],PARAMETER[\"rectified_grid_angle\",337.25556],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",2546731.496],PARAMETER[\"false_northing\",-4354009.8"
+        "16],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3078\"]]"},
+    {3079, "epsg", 3079,
         "NAD83(HARN) / Michigan Oblique Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33");
-    add_proj4text (p, 1,
-        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no");
-    add_proj4text (p, 2,
-        "_uoff +gamma=337.25556 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Michigan Oblique Mercator\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_");
-    add_srs_wkt (p, 2,
-        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Hotin");
-    add_srs_wkt (p, 7,
-        "e_Oblique_Mercator\"],PARAMETER[\"latitude_of_center\",4");
-    add_srs_wkt (p, 8,
-        "5.3091666666667],PARAMETER[\"longitude_of_center\",-86],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"azimuth\",337.25556],PARAMETER[\"rectified_g");
-    add_srs_wkt (p, 10,
-        "rid_angle\",337.25556],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",2546731.496],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_northing\",-4354009.816],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 14,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3079\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3080, "epsg", 3080,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33"
+        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no"
+        "_uoff +gamma=337.25556 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Michigan Oblique Mercator\",GEOGC"
+        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_"
+        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Hotin"
+        "e_Oblique_Mercator\"],PARAMETER[\"latitude_of_center\",4"
+        "5.3091666666667],PARAMETER[\"longitude_of_center\",-86],"
+        "PARAMETER[\"azimuth\",337.25556],PARAMETER[\"rectified_g"
+        "rid_angle\",337.25556],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",2546731.496],PARAMETER[\"f"
+        "alse_northing\",-4354009.816],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3079\"]]"},
+    {3080, "epsg", 3080,
         "NAD27 / Shackleford", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.41666666666667 +lat_2=34.91666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=31.16666666666667 +lon_0=-100 +x_0=914400 +y_");
-    add_proj4text (p, 2,
-        "0=914400 +datum=NAD27 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Shackleford\",GEOGCS[\"NAD27\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637");
-    add_srs_wkt (p, 2,
-        "8206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "267\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",31.1666666666667],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-100],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 9,
-        "l_1\",27.4166666666667],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",34.9166666666667],PARAMETER[\"false_easting\",3000000],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",3000000],UNIT[\"foot\",0.30");
-    add_srs_wkt (p, 12,
-        "48,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3080\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3081, "epsg", 3081,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.41666666666667 +lat_2=34.91666666666"
+        "666 +lat_0=31.16666666666667 +lon_0=-100 +x_0=914400 +y_"
+        "0=914400 +datum=NAD27 +units=ft +no_defs",
+        "PROJCS[\"NAD27 / Shackleford\",GEOGCS[\"NAD27\",DATUM[\""
+        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637"
+        "8206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AU"
+        "THORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "267\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARA"
+        "METER[\"latitude_of_origin\",31.1666666666667],PARAMETER"
+        "[\"central_meridian\",-100],PARAMETER[\"standard_paralle"
+        "l_1\",27.4166666666667],PARAMETER[\"standard_parallel_2\""
+        ",34.9166666666667],PARAMETER[\"false_easting\",3000000],"
+        "PARAMETER[\"false_northing\",3000000],UNIT[\"foot\",0.30"
+        "48,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3080\"]]"},
+    {3081, "epsg", 3081,
         "NAD83 / Texas State Mapping System", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.41666666666667 +lat_2=34.91666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=31.16666666666667 +lon_0=-100 +x_0=1000000 +y");
-    add_proj4text (p, 2,
-        "_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas State Mapping System\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",31.1666666666667],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-100],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",27.4166666666667],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",34.9166666666667],PARAMETER[\"false_easting\",10");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",1000000],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3081\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3082, "epsg", 3082,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.41666666666667 +lat_2=34.91666666666"
+        "666 +lat_0=31.16666666666667 +lon_0=-100 +x_0=1000000 +y"
+        "_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83 / Texas State Mapping System\",GEOGCS[\"N"
+        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",31.1666666666667],PAR"
+        "AMETER[\"central_meridian\",-100],PARAMETER[\"standard_p"
+        "arallel_1\",27.4166666666667],PARAMETER[\"standard_paral"
+        "lel_2\",34.9166666666667],PARAMETER[\"false_easting\",10"
+        "00000],PARAMETER[\"false_northing\",1000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3081\"]"
+        "]"},
+    {3082, "epsg", 3082,
         "NAD83 / Texas Centric Lambert Conformal", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas Centric Lambert Conformal\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2");
-    add_srs_wkt (p, 7,
-        "SP\"],PARAMETER[\"latitude_of_origin\",18],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-100],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",27.5],PARAMETER[\"standard_parallel_2\",35],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",1500000],PARAMETER[\"false_northing\",50");
-    add_srs_wkt (p, 11,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"3082\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3083, "epsg", 3083,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x"
+        "_0=1500000 +y_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Texas Centric Lambert Conformal\",GEOGC"
+        "S[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2"
+        "SP\"],PARAMETER[\"latitude_of_origin\",18],PARAMETER[\"c"
+        "entral_meridian\",-100],PARAMETER[\"standard_parallel_1\""
+        ",27.5],PARAMETER[\"standard_parallel_2\",35],PARAMETER[\""
+        "false_easting\",1500000],PARAMETER[\"false_northing\",50"
+        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3082\"]]"},
+    {3083, "epsg", 3083,
         "NAD83 / Texas Centric Albers Equal Area", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Texas Centric Albers Equal Area\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4269\"]],PROJECTION[\"Albers_Conic_Equal_Area\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_center\",18],PARAMETER[\"longi");
-    add_srs_wkt (p, 8,
-        "tude_of_center\",-100],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",27.5],PARAMETER[\"standard_parallel_2\",35],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",1500000],PARAMETER[\"false_northing\",60");
-    add_srs_wkt (p, 11,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"3083\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3084, "epsg", 3084,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x"
+        "_0=1500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Texas Centric Albers Equal Area\",GEOGC"
+        "S[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4269\"]],PROJECTION[\"Albers_Conic_Equal_Area\""
+        "],PARAMETER[\"latitude_of_center\",18],PARAMETER[\"longi"
+        "tude_of_center\",-100],PARAMETER[\"standard_parallel_1\""
+        ",27.5],PARAMETER[\"standard_parallel_2\",35],PARAMETER[\""
+        "false_easting\",1500000],PARAMETER[\"false_northing\",60"
+        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3083\"]]"},
+    {3084, "epsg", 3084,
         "NAD83(HARN) / Texas Centric Lambert Conformal", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas Centric Lambert Conformal\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refe");
-    add_srs_wkt (p, 2,
-        "rence_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",18],PARAMETER[\"central_meridian\",-100],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",27.5],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 10,
-        "rallel_2\",35],PARAMETER[\"false_easting\",1500000],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",5000000],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 13,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3084\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3085, "epsg", 3085,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x"
+        "_0=1500000 +y_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas Centric Lambert Conformal\""
+        ",GEOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refe"
+        "rence_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",18],PARAMETER[\"central_meridian\",-100],PARAMET"
+        "ER[\"standard_parallel_1\",27.5],PARAMETER[\"standard_pa"
+        "rallel_2\",35],PARAMETER[\"false_easting\",1500000],PARA"
+        "METER[\"false_northing\",5000000],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3084\"]]"},
+    {3085, "epsg", 3085,
         "NAD83(HARN) / Texas Centric Albers Equal Area", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Texas Centric Albers Equal Area\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refe");
-    add_srs_wkt (p, 2,
-        "rence_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Albers_Conic_Equal_Area\"],PARAMETER[\"latitude_of_cente");
-    add_srs_wkt (p, 8,
-        "r\",18],PARAMETER[\"longitude_of_center\",-100],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",27.5],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",35],PARAMETER[\"false_easting\",1500000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",6000000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 13,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"3085\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3086, "epsg", 3086,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x"
+        "_0=1500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Texas Centric Albers Equal Area\""
+        ",GEOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refe"
+        "rence_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "152\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\""
+        "Albers_Conic_Equal_Area\"],PARAMETER[\"latitude_of_cente"
+        "r\",18],PARAMETER[\"longitude_of_center\",-100],PARAMETE"
+        "R[\"standard_parallel_1\",27.5],PARAMETER[\"standard_par"
+        "allel_2\",35],PARAMETER[\"false_easting\",1500000],PARAM"
+        "ETER[\"false_northing\",6000000],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"3085\"]]"},
+    {3086, "epsg", 3086,
         "NAD83 / Florida GDL Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=24 +lat_2=31.5 +lat_0=24 +lon_0=-84 +x_");
-    add_proj4text (p, 1,
-        "0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Florida GDL Albers\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_center\",24],PARAMETER[\"longitude_of_cen");
-    add_srs_wkt (p, 8,
-        "ter\",-84],PARAMETER[\"standard_parallel_1\",24],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_2\",31.5],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",400000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3086\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3087, "epsg", 3087,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=24 +lat_2=31.5 +lat_0=24 +lon_0=-84 +x_"
+        "0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=m +no_defs",
+        "PROJCS[\"NAD83 / Florida GDL Albers\",GEOGCS[\"NAD83\",D"
+        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER"
+        "[\"latitude_of_center\",24],PARAMETER[\"longitude_of_cen"
+        "ter\",-84],PARAMETER[\"standard_parallel_1\",24],PARAMET"
+        "ER[\"standard_parallel_2\",31.5],PARAMETER[\"false_easti"
+        "ng\",400000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3086\"]"
+        "]"},
+    {3087, "epsg", 3087,
         "NAD83(HARN) / Florida GDL Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=24 +lat_2=31.5 +lat_0=24 +lon_0=-84 +x_");
-    add_proj4text (p, 1,
-        "0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Florida GDL Albers\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Albers_Conic");
-    add_srs_wkt (p, 7,
-        "_Equal_Area\"],PARAMETER[\"latitude_of_center\",24],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"longitude_of_center\",-84],PARAMETER[\"standard_");
-    add_srs_wkt (p, 9,
-        "parallel_1\",24],PARAMETER[\"standard_parallel_2\",31.5]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",400000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"3087\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3088, "epsg", 3088,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=24 +lat_2=31.5 +lat_0=24 +lon_0=-84 +x_"
+        "0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Florida GDL Albers\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Albers_Conic"
+        "_Equal_Area\"],PARAMETER[\"latitude_of_center\",24],PARA"
+        "METER[\"longitude_of_center\",-84],PARAMETER[\"standard_"
+        "parallel_1\",24],PARAMETER[\"standard_parallel_2\",31.5]"
+        ",PARAMETER[\"false_easting\",400000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3087\"]]"},
+    {3088, "epsg", 3088,
         "NAD83 / Kentucky Single Zone", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Kentucky Single Zone\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",36.3333333333333],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-85.75],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",37.0833333333333],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 10,
-        "_2\",38.6666666666667],PARAMETER[\"false_easting\",15000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",1000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3088\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3089, "epsg", 3089,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666"
+        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 "
+        "+y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83 / Kentucky Single Zone\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",36.3333333333333],PARAMETE"
+        "R[\"central_meridian\",-85.75],PARAMETER[\"standard_para"
+        "llel_1\",37.0833333333333],PARAMETER[\"standard_parallel"
+        "_2\",38.6666666666667],PARAMETER[\"false_easting\",15000"
+        "00],PARAMETER[\"false_northing\",1000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3088\"]]"},
+    {3089, "epsg", 3089,
         "NAD83 / Kentucky Single Zone (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Kentucky Single Zone (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",36.3333333333333],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-85.75],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",37.0833333333333],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 10,
-        "arallel_2\",38.6666666666667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",4921250],PARAMETER[\"false_northing\",3280833.333],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3089\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3090, "epsg", 3090,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666"
+        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 "
+        "+y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Kentucky Single Zone (ftUS)\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP"
+        "\"],PARAMETER[\"latitude_of_origin\",36.3333333333333],P"
+        "ARAMETER[\"central_meridian\",-85.75],PARAMETER[\"standa"
+        "rd_parallel_1\",37.0833333333333],PARAMETER[\"standard_p"
+        "arallel_2\",38.6666666666667],PARAMETER[\"false_easting\""
+        ",4921250],PARAMETER[\"false_northing\",3280833.333],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3089\"]]"},
+    {3090, "epsg", 3090,
         "NAD83(HARN) / Kentucky Single Zone", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kentucky Single Zone\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.");
-    add_srs_wkt (p, 8,
-        "3333333333333],PARAMETER[\"central_meridian\",-85.75],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",37.0833333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",38.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",1500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"3090\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3091, "epsg", 3091,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666"
+        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 "
+        "+y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Kentucky Single Zone\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36."
+        "3333333333333],PARAMETER[\"central_meridian\",-85.75],PA"
+        "RAMETER[\"standard_parallel_1\",37.0833333333333],PARAME"
+        "TER[\"standard_parallel_2\",38.6666666666667],PARAMETER["
+        "\"false_easting\",1500000],PARAMETER[\"false_northing\","
+        "1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3090\"]]"},
+    {3091, "epsg", 3091,
         "NAD83(HARN) / Kentucky Single Zone (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kentucky Single Zone (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc");
-    add_srs_wkt (p, 2,
-        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",36.3333333333333],PARAMETER[\"central_meridian\",-85");
-    add_srs_wkt (p, 9,
-        ".75],PARAMETER[\"standard_parallel_1\",37.0833333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",38.6666666666667],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",4921250],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 12,
-        "hing\",3280833.333],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 13,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3091\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3092, "epsg", 3092,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666"
+        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 "
+        "+y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Kentucky Single Zone (ftUS)\",GEO"
+        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc"
+        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",36.3333333333333],PARAMETER[\"central_meridian\",-85"
+        ".75],PARAMETER[\"standard_parallel_1\",37.0833333333333]"
+        ",PARAMETER[\"standard_parallel_2\",38.6666666666667],PAR"
+        "AMETER[\"false_easting\",4921250],PARAMETER[\"false_nort"
+        "hing\",3280833.333],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3091\"]"
+        "]"},
+    {3092, "epsg", 3092,
         "Tokyo / UTM zone 51N", 0, 0,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=51 +ellps=bessel +towgs84=-146.414,507.3");
-    add_proj4text (p, 1,
-        "37,680.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / UTM zone 51N\",GEOGCS[\"Tokyo\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",123],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 8,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3092\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3093, "epsg", 3093,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=51 +ellps=bessel +towgs84=-146.414,507.3"
+        "37,680.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / UTM zone 51N\",GEOGCS[\"Tokyo\",DATUM[\""
+        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128"
+        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",123],PARAMETER[\"scale_f"
+        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3092\"]]"},
+    {3093, "epsg", 3093,
         "Tokyo / UTM zone 52N", 0, 0,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=52 +ellps=bessel +towgs84=-146.414,507.3");
-    add_proj4text (p, 1,
-        "37,680.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / UTM zone 52N\",GEOGCS[\"Tokyo\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",129],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 8,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3093\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3094, "epsg", 3094,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=52 +ellps=bessel +towgs84=-146.414,507.3"
+        "37,680.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / UTM zone 52N\",GEOGCS[\"Tokyo\",DATUM[\""
+        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128"
+        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",129],PARAMETER[\"scale_f"
+        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3093\"]]"},
+    {3094, "epsg", 3094,
         "Tokyo / UTM zone 53N", 0, 0,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=53 +ellps=bessel +towgs84=-146.414,507.3");
-    add_proj4text (p, 1,
-        "37,680.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / UTM zone 53N\",GEOGCS[\"Tokyo\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",135],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 8,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3094\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3095, "epsg", 3095,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=53 +ellps=bessel +towgs84=-146.414,507.3"
+        "37,680.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / UTM zone 53N\",GEOGCS[\"Tokyo\",DATUM[\""
+        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128"
+        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",135],PARAMETER[\"scale_f"
+        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3094\"]]"},
+    {3095, "epsg", 3095,
         "Tokyo / UTM zone 54N", 0, 0,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=54 +ellps=bessel +towgs84=-146.414,507.3");
-    add_proj4text (p, 1,
-        "37,680.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / UTM zone 54N\",GEOGCS[\"Tokyo\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",141],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 8,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3095\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3096, "epsg", 3096,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=54 +ellps=bessel +towgs84=-146.414,507.3"
+        "37,680.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / UTM zone 54N\",GEOGCS[\"Tokyo\",DATUM[\""
+        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128"
+        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",141],PARAMETER[\"scale_f"
+        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3095\"]]"},
+    {3096, "epsg", 3096,
         "Tokyo / UTM zone 55N", 0, 0,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=55 +ellps=bessel +towgs84=-146.414,507.3");
-    add_proj4text (p, 1,
-        "37,680.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / UTM zone 55N\",GEOGCS[\"Tokyo\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",147],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 8,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3096\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3097, "epsg", 3097,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=55 +ellps=bessel +towgs84=-146.414,507.3"
+        "37,680.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / UTM zone 55N\",GEOGCS[\"Tokyo\",DATUM[\""
+        "Tokyo\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128"
+        ",AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6301"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",147],PARAMETER[\"scale_f"
+        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3096\"]]"},
+    {3097, "epsg", 3097,
         "JGD2000 / UTM zone 51N", 0, 0,
         "GRS 1980", "Greenwich",
         "Japanese_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=51 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2000 / UTM zone 51N\",GEOGCS[\"JGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",12");
-    add_srs_wkt (p, 8,
-        "3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"309");
-    add_srs_wkt (p, 12,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3098, "epsg", 3098,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=51 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"JGD2000 / UTM zone 51N\",GEOGCS[\"JGD2000\",DAT"
+        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",12"
+        "3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"309"
+        "7\"]]"},
+    {3098, "epsg", 3098,
         "JGD2000 / UTM zone 52N", 0, 0,
         "GRS 1980", "Greenwich",
         "Japanese_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=52 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2000 / UTM zone 52N\",GEOGCS[\"JGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",12");
-    add_srs_wkt (p, 8,
-        "9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"309");
-    add_srs_wkt (p, 12,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3099, "epsg", 3099,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=52 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"JGD2000 / UTM zone 52N\",GEOGCS[\"JGD2000\",DAT"
+        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",12"
+        "9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"309"
+        "8\"]]"},
+    {3099, "epsg", 3099,
         "JGD2000 / UTM zone 53N", 0, 0,
         "GRS 1980", "Greenwich",
         "Japanese_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=53 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2000 / UTM zone 53N\",GEOGCS[\"JGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",13");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"309");
-    add_srs_wkt (p, 12,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3100, "epsg", 3100,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=53 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"JGD2000 / UTM zone 53N\",GEOGCS[\"JGD2000\",DAT"
+        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",13"
+        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"309"
+        "9\"]]"},
+    {3100, "epsg", 3100,
         "JGD2000 / UTM zone 54N", 0, 0,
         "GRS 1980", "Greenwich",
         "Japanese_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=54 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2000 / UTM zone 54N\",GEOGCS[\"JGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",14");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"310");
-    add_srs_wkt (p, 12,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3101, "epsg", 3101,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=54 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"JGD2000 / UTM zone 54N\",GEOGCS[\"JGD2000\",DAT"
+        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",14"
+        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"310"
+        "0\"]]"},
+    {3101, "epsg", 3101,
         "JGD2000 / UTM zone 55N", 0, 0,
         "GRS 1980", "Greenwich",
         "Japanese_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=55 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JGD2000 / UTM zone 55N\",GEOGCS[\"JGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",14");
-    add_srs_wkt (p, 8,
-        "7],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"310");
-    add_srs_wkt (p, 12,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3102, "epsg", 3102,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=55 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"JGD2000 / UTM zone 55N\",GEOGCS[\"JGD2000\",DAT"
+        "UM[\"Japanese_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6612\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",14"
+        "7],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"310"
+        "1\"]]"},
+    {3102, "epsg", 3102,
         "American Samoa 1962 / American Samoa Lambert", 0, 0,
         "Clarke 1866", "Greenwich",
         "American_Samoa_1962", "Lambert_Conformal_Conic_1SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-14.26666666666667 +lat_0=-14.266666666");
-    add_proj4text (p, 1,
-        "66667 +lon_0=-170 +k_0=1 +x_0=152400.3048006096 +y_0=951");
-    add_proj4text (p, 2,
-        "69.31165862332 +ellps=clrk66 +towgs84=-115,118,426,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"American Samoa 1962 / American Samoa Lambert\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"American Samoa 1962\",DATUM[\"American_Samoa_19");
-    add_srs_wkt (p, 2,
-        "62\",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6169");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4169\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",-14.2666666666667],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-170],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",500000],PARAMETER[\"false_northing\",312234.65],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3102\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3103, "epsg", 3103,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-14.26666666666667 +lat_0=-14.266666666"
+        "66667 +lon_0=-170 +k_0=1 +x_0=152400.3048006096 +y_0=951"
+        "69.31165862332 +ellps=clrk66 +towgs84=-115,118,426,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"American Samoa 1962 / American Samoa Lambert\","
+        "GEOGCS[\"American Samoa 1962\",DATUM[\"American_Samoa_19"
+        "62\",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898"
+        ",AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6169"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4169\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",-14.2666666666667],PARAMETER[\"central_meridian\","
+        "-170],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",500000],PARAMETER[\"false_northing\",312234.65],"
+        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP"
+        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3102\"]]"},
+    {3103, "epsg", 3103,
         "Mauritania 1999 / UTM zone 28N (deprecated)", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Mauritania_1999", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mauritania 1999 / UTM zone 28N (deprecated)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Mauritania 1999 (deprecated)\",DATUM[\"Mauritani");
-    add_srs_wkt (p, 2,
-        "a_1999\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.");
-    add_srs_wkt (p, 3,
-        "465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "681\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4681\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"central_meridian\",-15],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3103\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3104, "epsg", 3104,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"Mauritania 1999 / UTM zone 28N (deprecated)\",G"
+        "EOGCS[\"Mauritania 1999 (deprecated)\",DATUM[\"Mauritani"
+        "a_1999\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293."
+        "465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6"
+        "681\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4681\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-15],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3103\"]]"},
+    {3104, "epsg", 3104,
         "Mauritania 1999 / UTM zone 29N (deprecated)", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Mauritania_1999", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mauritania 1999 / UTM zone 29N (deprecated)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Mauritania 1999 (deprecated)\",DATUM[\"Mauritani");
-    add_srs_wkt (p, 2,
-        "a_1999\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.");
-    add_srs_wkt (p, 3,
-        "465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "681\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4681\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3104\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3105, "epsg", 3105,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=29 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"Mauritania 1999 / UTM zone 29N (deprecated)\",G"
+        "EOGCS[\"Mauritania 1999 (deprecated)\",DATUM[\"Mauritani"
+        "a_1999\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293."
+        "465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6"
+        "681\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4681\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"scale_"
+        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3104\"]]"},
+    {3105, "epsg", 3105,
         "Mauritania 1999 / UTM zone 30N (deprecated)", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Mauritania_1999", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mauritania 1999 / UTM zone 30N (deprecated)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Mauritania 1999 (deprecated)\",DATUM[\"Mauritani");
-    add_srs_wkt (p, 2,
-        "a_1999\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.");
-    add_srs_wkt (p, 3,
-        "465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "681\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4681\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"central_meridian\",-3],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3105\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3106, "epsg", 3106,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=30 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"Mauritania 1999 / UTM zone 30N (deprecated)\",G"
+        "EOGCS[\"Mauritania 1999 (deprecated)\",DATUM[\"Mauritani"
+        "a_1999\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293."
+        "465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6"
+        "681\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4681\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-3],PARAMETER[\"scale_"
+        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3105\"]]"},
+    {3106, "epsg", 3106,
         "Gulshan 303 / Bangladesh Transverse Mercator", 0, 0,
         "Everest 1830 (1937 Adjustment)", "Greenwich",
         "Gulshan_303", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +a=6377276.345 +b=6356075.41314024 +towgs84=283.7,73");
-    add_proj4text (p, 2,
-        "5.9,261.1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Gulshan 303 / Bangladesh Transverse Mercator\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Gulshan 303\",DATUM[\"Gulshan_303\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Everest 1830 (1937 Adjustment)\",6377276.345,300.8017,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",\"6682\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4682\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"central_meridian\",90],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 11,
-        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AUTHORITY[\"EPSG\",\"3106\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3107, "epsg", 3107,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=90 +k=0.9996 +x_0=500000 +y_"
+        "0=0 +a=6377276.345 +b=6356075.41314024 +towgs84=283.7,73"
+        "5.9,261.1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Gulshan 303 / Bangladesh Transverse Mercator\","
+        "GEOGCS[\"Gulshan 303\",DATUM[\"Gulshan_303\",SPHEROID[\""
+        "Everest 1830 (1937 Adjustment)\",6377276.345,300.8017,AU"
+        "THORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",\"6682\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4682\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PA"
+        "RAMETER[\"central_meridian\",90],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS"
+        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"3106\"]]"},
+    {3107, "epsg", 3107,
         "GDA94 / SA Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "Geocentric_Datum_of_Australia_1994", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-28 +lat_2=-36 +lat_0=-32 +lon_0=135 +x");
-    add_proj4text (p, 1,
-        "_0=1000000 +y_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDA94 / SA Lambert\",GEOGCS[\"GDA94\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "eocentric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "83\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",-32],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",135],PARAMETER[\"standard_parallel_1\",-28],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",-36],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",1000000],PARAMETER[\"false_northing\",2000000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"3107\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3108, "epsg", 3108,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-28 +lat_2=-36 +lat_0=-32 +lon_0=135 +x"
+        "_0=1000000 +y_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"GDA94 / SA Lambert\",GEOGCS[\"GDA94\",DATUM[\"G"
+        "eocentric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "83\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",-32],PARAMETER[\"central_mer"
+        "idian\",135],PARAMETER[\"standard_parallel_1\",-28],PARA"
+        "METER[\"standard_parallel_2\",-36],PARAMETER[\"false_eas"
+        "ting\",1000000],PARAMETER[\"false_northing\",2000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3107\"]]"},
+    {3108, "epsg", 3108,
         "ETRS89 / Guernsey Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=49.5 +lon_0=-2.416666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99997 +x_0=47000 +y_0=50000 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / Guernsey Grid\",GEOGCS[\"ETRS89\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"European_Terrestrial_Reference_System_1989\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"latitude_of_origin\",49.5],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-2.41666666666667],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 9,
-        "or\",0.999997],PARAMETER[\"false_easting\",47000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",50000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3108\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3109, "epsg", 3109,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=49.5 +lon_0=-2.416666666666667 +k=0.9"
+        "99997 +x_0=47000 +y_0=50000 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / Guernsey Grid\",GEOGCS[\"ETRS89\",DATU"
+        "M[\"European_Terrestrial_Reference_System_1989\",SPHEROI"
+        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\","
+        "\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"]"
+        ",PARAMETER[\"latitude_of_origin\",49.5],PARAMETER[\"cent"
+        "ral_meridian\",-2.41666666666667],PARAMETER[\"scale_fact"
+        "or\",0.999997],PARAMETER[\"false_easting\",47000],PARAME"
+        "TER[\"false_northing\",50000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3108\"]]"},
+    {3109, "epsg", 3109,
         "ETRS89 / Jersey Transverse Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=49.225 +lon_0=-2.135 +k=0.99999990000");
-    add_proj4text (p, 1,
-        "00001 +x_0=40000 +y_0=70000 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / Jersey Transverse Mercator\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "ETRS89\",DATUM[\"European_Terrestrial_Reference_System_1");
-    add_srs_wkt (p, 2,
-        "989\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",49.225],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"central_meridian\",-2.135],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 9,
-        "actor\",0.9999999],PARAMETER[\"false_easting\",40000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",70000],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3109\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3110, "epsg", 3110,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=49.225 +lon_0=-2.135 +k=0.99999990000"
+        "00001 +x_0=40000 +y_0=70000 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / Jersey Transverse Mercator\",GEOGCS[\""
+        "ETRS89\",DATUM[\"European_Terrestrial_Reference_System_1"
+        "989\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",49.225],PA"
+        "RAMETER[\"central_meridian\",-2.135],PARAMETER[\"scale_f"
+        "actor\",0.9999999],PARAMETER[\"false_easting\",40000],PA"
+        "RAMETER[\"false_northing\",70000],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3109\"]]"},
+    {3110, "epsg", 3110,
         "AGD66 / Vicgrid66", 0, 0,
         "Australian National Spheroid", "Greenwich",
         "Australian_Geodetic_Datum_1966", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-36 +lat_2=-38 +lat_0=-37 +lon_0=145 +x");
-    add_proj4text (p, 1,
-        "_0=2500000 +y_0=4500000 +ellps=aust_SA +towgs84=-117.808");
-    add_proj4text (p, 2,
-        ",-51.536,137.784,0.303,0.446,0.234,-0.29 +units=m +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"AGD66 / Vicgrid66\",GEOGCS[\"AGD66\",DATUM[\"Au");
-    add_srs_wkt (p, 1,
-        "stralian_Geodetic_Datum_1966\",SPHEROID[\"Australian Nat");
-    add_srs_wkt (p, 2,
-        "ional Spheroid\",6378160,298.25,AUTHORITY[\"EPSG\",\"700");
-    add_srs_wkt (p, 3,
-        "3\"]],AUTHORITY[\"EPSG\",\"6202\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4202\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",-37],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",145],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 9,
-        "-36],PARAMETER[\"standard_parallel_2\",-38],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",2500000],PARAMETER[\"false_northing\",45");
-    add_srs_wkt (p, 11,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"3110\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3111, "epsg", 3111,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-36 +lat_2=-38 +lat_0=-37 +lon_0=145 +x"
+        "_0=2500000 +y_0=4500000 +ellps=aust_SA +towgs84=-117.808"
+        ",-51.536,137.784,0.303,0.446,0.234,-0.29 +units=m +no_de"
+        "fs",
+        "PROJCS[\"AGD66 / Vicgrid66\",GEOGCS[\"AGD66\",DATUM[\"Au"
+        "stralian_Geodetic_Datum_1966\",SPHEROID[\"Australian Nat"
+        "ional Spheroid\",6378160,298.25,AUTHORITY[\"EPSG\",\"700"
+        "3\"]],AUTHORITY[\"EPSG\",\"6202\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4202\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP"
+        "\"],PARAMETER[\"latitude_of_origin\",-37],PARAMETER[\"ce"
+        "ntral_meridian\",145],PARAMETER[\"standard_parallel_1\","
+        "-36],PARAMETER[\"standard_parallel_2\",-38],PARAMETER[\""
+        "false_easting\",2500000],PARAMETER[\"false_northing\",45"
+        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3110\"]]"},
+    {3111, "epsg", 3111,
         "GDA94 / Vicgrid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geocentric_Datum_of_Australia_1994", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-36 +lat_2=-38 +lat_0=-37 +lon_0=145 +x");
-    add_proj4text (p, 1,
-        "_0=2500000 +y_0=2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDA94 / Vicgrid\",GEOGCS[\"GDA94\",DATUM[\"Geoc");
-    add_srs_wkt (p, 1,
-        "entric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4283");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"latitude_of_origin\",-37],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",145],PARAMETER[\"standard_parallel_1\",-36],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_2\",-38],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",2500000],PARAMETER[\"false_northing\",2500000],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 12,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3111\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3112, "epsg", 3112,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-36 +lat_2=-38 +lat_0=-37 +lon_0=145 +x"
+        "_0=2500000 +y_0=2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"GDA94 / Vicgrid\",GEOGCS[\"GDA94\",DATUM[\"Geoc"
+        "entric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4283"
+        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET"
+        "ER[\"latitude_of_origin\",-37],PARAMETER[\"central_merid"
+        "ian\",145],PARAMETER[\"standard_parallel_1\",-36],PARAME"
+        "TER[\"standard_parallel_2\",-38],PARAMETER[\"false_easti"
+        "ng\",2500000],PARAMETER[\"false_northing\",2500000],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3111\"]]"},
+    {3112, "epsg", 3112,
         "GDA94 / Geoscience Australia Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "Geocentric_Datum_of_Australia_1994", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-18 +lat_2=-36 +lat_0=0 +lon_0=134 +x_0");
-    add_proj4text (p, 1,
-        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDA94 / Geoscience Australia Lambert\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "GDA94\",DATUM[\"Geocentric_Datum_of_Australia_1994\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6283\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4283\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",134],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 9,
-        "l_1\",-18],PARAMETER[\"standard_parallel_2\",-36],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_easting\",0],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 11,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 12,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"3112\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3113, "epsg", 3113,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-18 +lat_2=-36 +lat_0=0 +lon_0=134 +x_0"
+        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"GDA94 / Geoscience Australia Lambert\",GEOGCS[\""
+        "GDA94\",DATUM[\"Geocentric_Datum_of_Australia_1994\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6283\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4283\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",134],PARAMETER[\"standard_paralle"
+        "l_1\",-18],PARAMETER[\"standard_parallel_2\",-36],PARAME"
+        "TER[\"false_easting\",0],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"3112\"]]"},
+    {3113, "epsg", 3113,
         "GDA94 / BCSG02", 0, 0,
         "GRS 1980", "Greenwich",
         "Geocentric_Datum_of_Australia_1994", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-28 +lon_0=153 +k=0.99999 +x_0=50000 ");
-    add_proj4text (p, 1,
-        "+y_0=100000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDA94 / BCSG02\",GEOGCS[\"GDA94\",DATUM[\"Geoce");
-    add_srs_wkt (p, 1,
-        "ntric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4283\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",-28],PARAMETER[\"central_meridian\",153]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",0.99999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",50000],PARAMETER[\"false_northing\",100000],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3113\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3114, "epsg", 3114,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-28 +lon_0=153 +k=0.99999 +x_0=50000 "
+        "+y_0=100000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"GDA94 / BCSG02\",GEOGCS[\"GDA94\",DATUM[\"Geoce"
+        "ntric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980\",63"
+        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4283\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",-28],PARAMETER[\"central_meridian\",153]"
+        ",PARAMETER[\"scale_factor\",0.99999],PARAMETER[\"false_e"
+        "asting\",50000],PARAMETER[\"false_northing\",100000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3113\"]]"},
+    {3114, "epsg", 3114,
         "MAGNA-SIRGAS / Colombia Far West zone", 0, 1,
         "GRS 1980", "Greenwich",
         "Marco_Geocentrico_Nacional_de_Referencia", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-80.07750791");
-    add_proj4text (p, 1,
-        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MAGNA-SIRGAS / Colombia Far West zone\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"MAGNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_de_R");
-    add_srs_wkt (p, 2,
-        "eferencia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6686\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.59");
-    add_srs_wkt (p, 8,
-        "620041666667],PARAMETER[\"central_meridian\",-80.0775079");
-    add_srs_wkt (p, 9,
-        "166667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",1000000],PARAMETER[\"false_northing\",1000000]");
-    add_srs_wkt (p, 11,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"3114\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3115, "epsg", 3115,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-80.07750791"
+        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"MAGNA-SIRGAS / Colombia Far West zone\",GEOGCS["
+        "\"MAGNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_de_R"
+        "eferencia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6686\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.59"
+        "620041666667],PARAMETER[\"central_meridian\",-80.0775079"
+        "166667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_"
+        "easting\",1000000],PARAMETER[\"false_northing\",1000000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"N"
+        "orthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG"
+        "\",\"3114\"]]"},
+    {3115, "epsg", 3115,
         "MAGNA-SIRGAS / Colombia West zone", 0, 1,
         "GRS 1980", "Greenwich",
         "Marco_Geocentrico_Nacional_de_Referencia", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-77.07750791");
-    add_proj4text (p, 1,
-        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MAGNA-SIRGAS / Colombia West zone\",GEOGCS[\"MA");
-    add_srs_wkt (p, 1,
-        "GNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_de_Refer");
-    add_srs_wkt (p, 2,
-        "encia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6686\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.59620");
-    add_srs_wkt (p, 8,
-        "041666667],PARAMETER[\"central_meridian\",-77.0775079166");
-    add_srs_wkt (p, 9,
-        "667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",1000000],PARAMETER[\"false_northing\",1000000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"3115\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3116, "epsg", 3116,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-77.07750791"
+        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"MAGNA-SIRGAS / Colombia West zone\",GEOGCS[\"MA"
+        "GNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_de_Refer"
+        "encia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6686\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.59620"
+        "041666667],PARAMETER[\"central_meridian\",-77.0775079166"
+        "667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas"
+        "ting\",1000000],PARAMETER[\"false_northing\",1000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3115\"]]"},
+    {3116, "epsg", 3116,
         "MAGNA-SIRGAS / Colombia Bogota zone", 0, 1,
         "GRS 1980", "Greenwich",
         "Marco_Geocentrico_Nacional_de_Referencia", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-74.07750791");
-    add_proj4text (p, 1,
-        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MAGNA-SIRGAS / Colombia Bogota zone\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "MAGNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_de_Ref");
-    add_srs_wkt (p, 2,
-        "erencia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6686\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.596");
-    add_srs_wkt (p, 8,
-        "20041666667],PARAMETER[\"central_meridian\",-74.07750791");
-    add_srs_wkt (p, 9,
-        "66667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",1000000],PARAMETER[\"false_northing\",1000000],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 12,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"3116\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3117, "epsg", 3117,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-74.07750791"
+        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"MAGNA-SIRGAS / Colombia Bogota zone\",GEOGCS[\""
+        "MAGNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_de_Ref"
+        "erencia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6686\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.596"
+        "20041666667],PARAMETER[\"central_meridian\",-74.07750791"
+        "66667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e"
+        "asting\",1000000],PARAMETER[\"false_northing\",1000000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3116\"]]"},
+    {3117, "epsg", 3117,
         "MAGNA-SIRGAS / Colombia East Central zone", 0, 1,
         "GRS 1980", "Greenwich",
         "Marco_Geocentrico_Nacional_de_Referencia", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-71.07750791");
-    add_proj4text (p, 1,
-        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MAGNA-SIRGAS / Colombia East Central zone\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"MAGNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_");
-    add_srs_wkt (p, 2,
-        "de_Referencia\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "686\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "4.59620041666667],PARAMETER[\"central_meridian\",-71.077");
-    add_srs_wkt (p, 9,
-        "5079166667],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",1000000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 11,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"3117\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3118, "epsg", 3118,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-71.07750791"
+        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"MAGNA-SIRGAS / Colombia East Central zone\",GEO"
+        "GCS[\"MAGNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_"
+        "de_Referencia\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "686\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "4.59620041666667],PARAMETER[\"central_meridian\",-71.077"
+        "5079166667],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa"
+        "lse_easting\",1000000],PARAMETER[\"false_northing\",1000"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\""
+        "EPSG\",\"3117\"]]"},
+    {3118, "epsg", 3118,
         "MAGNA-SIRGAS / Colombia East zone", 0, 1,
         "GRS 1980", "Greenwich",
         "Marco_Geocentrico_Nacional_de_Referencia", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-68.07750791");
-    add_proj4text (p, 1,
-        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MAGNA-SIRGAS / Colombia East zone\",GEOGCS[\"MA");
-    add_srs_wkt (p, 1,
-        "GNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_de_Refer");
-    add_srs_wkt (p, 2,
-        "encia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6686\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.59620");
-    add_srs_wkt (p, 8,
-        "041666667],PARAMETER[\"central_meridian\",-68.0775079166");
-    add_srs_wkt (p, 9,
-        "667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",1000000],PARAMETER[\"false_northing\",1000000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"3118\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3119, "epsg", 3119,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.596200416666666 +lon_0=-68.07750791"
+        "666666 +k=1 +x_0=1000000 +y_0=1000000 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"MAGNA-SIRGAS / Colombia East zone\",GEOGCS[\"MA"
+        "GNA-SIRGAS\",DATUM[\"Marco_Geocentrico_Nacional_de_Refer"
+        "encia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6686\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4686\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",4.59620"
+        "041666667],PARAMETER[\"central_meridian\",-68.0775079166"
+        "667],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas"
+        "ting\",1000000],PARAMETER[\"false_northing\",1000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3118\"]]"},
+    {3119, "epsg", 3119,
         "Douala 1948 / AEF west", 0, 0,
         "International 1924", "Greenwich",
         "Douala_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.5 +k=0.999 +x_0=1000000 +");
-    add_proj4text (p, 1,
-        "y_0=1000000 +ellps=intl +towgs84=-206.1,-174.7,-87.7,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Douala 1948 / AEF west\",GEOGCS[\"Douala 1948\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Douala_1948\",SPHEROID[\"International 1924\",6");
-    add_srs_wkt (p, 2,
-        "378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6192\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4192\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",10.5],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.999],PARAMETER[\"false_easting\",10");
-    add_srs_wkt (p, 9,
-        "00000],PARAMETER[\"false_northing\",1000000],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3119\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3120, "epsg", 3120,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=10.5 +k=0.999 +x_0=1000000 +"
+        "y_0=1000000 +ellps=intl +towgs84=-206.1,-174.7,-87.7,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Douala 1948 / AEF west\",GEOGCS[\"Douala 1948\""
+        ",DATUM[\"Douala_1948\",SPHEROID[\"International 1924\",6"
+        "378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPS"
+        "G\",\"6192\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4192\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",10.5],PARAMETE"
+        "R[\"scale_factor\",0.999],PARAMETER[\"false_easting\",10"
+        "00000],PARAMETER[\"false_northing\",1000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3119\"]"
+        "]"},
+    {3120, "epsg", 3120,
         "Pulkovo 1942(58) / Poland zone I", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Oblique_Stereographic", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=50.625 +lon_0=21.08333333333333 +k=0");
-    add_proj4text (p, 1,
-        ".9998 +x_0=4637000 +y_0=5467000 +ellps=krass +towgs84=33");
-    add_proj4text (p, 2,
-        ".4,-146.6,-76.3,-0.359,-0.053,0.844,-0.84 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / Poland zone I\",GEOGCS[\"Pul");
-    add_srs_wkt (p, 1,
-        "kovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID[\"Kra");
-    add_srs_wkt (p, 2,
-        "ssowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4179\"]],PROJECTION[\"Oblique_Stereographic\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",50.625],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",21.0833333333333],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9998],PARAMETER[\"false_easting\",4637000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",5467000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AUTHORITY[\"EPSG\",\"3120\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3121, "epsg", 3121,
+        "Northing", "North", "Easting", "East",
+        "+proj=sterea +lat_0=50.625 +lon_0=21.08333333333333 +k=0"
+        ".9998 +x_0=4637000 +y_0=5467000 +ellps=krass +towgs84=33"
+        ".4,-146.6,-76.3,-0.359,-0.053,0.844,-0.84 +units=m +no_d"
+        "efs",
+        "PROJCS[\"Pulkovo 1942(58) / Poland zone I\",GEOGCS[\"Pul"
+        "kovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID[\"Kra"
+        "ssowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\""
+        "]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4179\"]],PROJECTION[\"Oblique_Stereographic\"],PARAME"
+        "TER[\"latitude_of_origin\",50.625],PARAMETER[\"central_m"
+        "eridian\",21.0833333333333],PARAMETER[\"scale_factor\",0"
+        ".9998],PARAMETER[\"false_easting\",4637000],PARAMETER[\""
+        "false_northing\",5467000],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting"
+        "\",EAST],AUTHORITY[\"EPSG\",\"3120\"]]"},
+    {3121, "epsg", 3121,
         "PRS92 / Philippines zone 1", 0, 0,
         "Clarke 1866", "Greenwich",
         "Philippine_Reference_System_1992", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=117 +k=0.99995 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06");
-    add_proj4text (p, 2,
-        "8,4.903,1.578,-1.06 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PRS92 / Philippines zone 1\",GEOGCS[\"PRS92\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",117],PARAMETER[\"scale_factor\",0.99995],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3121\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3122, "epsg", 3122,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=117 +k=0.99995 +x_0=500000 +"
+        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06"
+        "8,4.903,1.578,-1.06 +units=m +no_defs",
+        "PROJCS[\"PRS92 / Philippines zone 1\",GEOGCS[\"PRS92\",D"
+        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla"
+        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\""
+        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",117],PARAMETER[\"scale_factor\",0.99995],PA"
+        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"3121\"]]"},
+    {3122, "epsg", 3122,
         "PRS92 / Philippines zone 2", 0, 0,
         "Clarke 1866", "Greenwich",
         "Philippine_Reference_System_1992", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=119 +k=0.99995 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06");
-    add_proj4text (p, 2,
-        "8,4.903,1.578,-1.06 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PRS92 / Philippines zone 2\",GEOGCS[\"PRS92\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",119],PARAMETER[\"scale_factor\",0.99995],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3122\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3123, "epsg", 3123,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=119 +k=0.99995 +x_0=500000 +"
+        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06"
+        "8,4.903,1.578,-1.06 +units=m +no_defs",
+        "PROJCS[\"PRS92 / Philippines zone 2\",GEOGCS[\"PRS92\",D"
+        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla"
+        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\""
+        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",119],PARAMETER[\"scale_factor\",0.99995],PA"
+        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"3122\"]]"},
+    {3123, "epsg", 3123,
         "PRS92 / Philippines zone 3", 0, 0,
         "Clarke 1866", "Greenwich",
         "Philippine_Reference_System_1992", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=121 +k=0.99995 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06");
-    add_proj4text (p, 2,
-        "8,4.903,1.578,-1.06 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PRS92 / Philippines zone 3\",GEOGCS[\"PRS92\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",121],PARAMETER[\"scale_factor\",0.99995],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3123\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3124, "epsg", 3124,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=121 +k=0.99995 +x_0=500000 +"
+        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06"
+        "8,4.903,1.578,-1.06 +units=m +no_defs",
+        "PROJCS[\"PRS92 / Philippines zone 3\",GEOGCS[\"PRS92\",D"
+        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla"
+        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\""
+        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",121],PARAMETER[\"scale_factor\",0.99995],PA"
+        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"3123\"]]"},
+    {3124, "epsg", 3124,
         "PRS92 / Philippines zone 4", 0, 0,
         "Clarke 1866", "Greenwich",
         "Philippine_Reference_System_1992", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=0.99995 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06");
-    add_proj4text (p, 2,
-        "8,4.903,1.578,-1.06 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PRS92 / Philippines zone 4\",GEOGCS[\"PRS92\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",123],PARAMETER[\"scale_factor\",0.99995],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3124\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3125, "epsg", 3125,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=0.99995 +x_0=500000 +"
+        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06"
+        "8,4.903,1.578,-1.06 +units=m +no_defs",
+        "PROJCS[\"PRS92 / Philippines zone 4\",GEOGCS[\"PRS92\",D"
+        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla"
+        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\""
+        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",123],PARAMETER[\"scale_factor\",0.99995],PA"
+        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"3124\"]]"},
+    {3125, "epsg", 3125,
         "PRS92 / Philippines zone 5", 0, 0,
         "Clarke 1866", "Greenwich",
         "Philippine_Reference_System_1992", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=125 +k=0.99995 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06");
-    add_proj4text (p, 2,
-        "8,4.903,1.578,-1.06 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PRS92 / Philippines zone 5\",GEOGCS[\"PRS92\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",125],PARAMETER[\"scale_factor\",0.99995],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3125\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3126, "epsg", 3126,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=125 +k=0.99995 +x_0=500000 +"
+        "y_0=0 +ellps=clrk66 +towgs84=-127.62,-67.24,-47.04,-3.06"
+        "8,4.903,1.578,-1.06 +units=m +no_defs",
+        "PROJCS[\"PRS92 / Philippines zone 5\",GEOGCS[\"PRS92\",D"
+        "ATUM[\"Philippine_Reference_System_1992\",SPHEROID[\"Cla"
+        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\""
+        ",\"7008\"]],AUTHORITY[\"EPSG\",\"6683\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4683\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",125],PARAMETER[\"scale_factor\",0.99995],PA"
+        "RAMETER[\"false_easting\",500000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"3125\"]]"},
+    {3126, "epsg", 3126,
         "ETRS89 / ETRS-GK19FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=19 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK19FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",19],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3126\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3127, "epsg", 3127,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=19 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK19FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",19],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3126\"]]"},
+    {3127, "epsg", 3127,
         "ETRS89 / ETRS-GK20FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK20FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",20],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3127\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3128, "epsg", 3128,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=20 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK20FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",20],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3127\"]]"},
+    {3128, "epsg", 3128,
         "ETRS89 / ETRS-GK21FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK21FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3128\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3129, "epsg", 3129,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK21FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3128\"]]"},
+    {3129, "epsg", 3129,
         "ETRS89 / ETRS-GK22FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK22FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",22],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3129\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3130, "epsg", 3130,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=22 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK22FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",22],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3129\"]]"},
+    {3130, "epsg", 3130,
         "ETRS89 / ETRS-GK23FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK23FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",23],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3130\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3131, "epsg", 3131,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=23 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK23FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",23],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3130\"]]"},
+    {3131, "epsg", 3131,
         "ETRS89 / ETRS-GK24FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK24FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",24],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3131\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3132, "epsg", 3132,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK24FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",24],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3131\"]]"},
+    {3132, "epsg", 3132,
         "ETRS89 / ETRS-GK25FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=25 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK25FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",25],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3132\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3133, "epsg", 3133,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=25 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK25FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",25],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3132\"]]"},
+    {3133, "epsg", 3133,
         "ETRS89 / ETRS-GK26FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=26 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK26FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",26],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3133\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3134, "epsg", 3134,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=26 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK26FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",26],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3133\"]]"},
+    {3134, "epsg", 3134,
         "ETRS89 / ETRS-GK27FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK27FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3134\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3135, "epsg", 3135,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK27FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3134\"]]"},
+    {3135, "epsg", 3135,
         "ETRS89 / ETRS-GK28FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK28FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",28],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3135\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3136, "epsg", 3136,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=28 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK28FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",28],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3135\"]]"},
+    {3136, "epsg", 3136,
         "ETRS89 / ETRS-GK29FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=29 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK29FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",29],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3136\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3137, "epsg", 3137,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=29 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK29FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",29],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3136\"]]"},
+    {3137, "epsg", 3137,
         "ETRS89 / ETRS-GK30FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK30FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3137\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3138, "epsg", 3138,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK30FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3137\"]]"},
+    {3138, "epsg", 3138,
         "ETRS89 / ETRS-GK31FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / ETRS-GK31FIN\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",31],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3138\"]]");
-}
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / ETRS-GK31FIN\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",31],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3138\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_10 = {
+    epsg_defs_10, sizeof (epsg_defs_10) / sizeof (epsg_defs_10[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
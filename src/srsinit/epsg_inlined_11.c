@@ -53,3765 +53,2141 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_11 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3140, "epsg", 3140,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_11[] = {
+    {3140, "epsg", 3140,
         "Viti Levu 1912 / Viti Levu Grid", 0, 1,
         "Clarke 1880 (international foot)", "Greenwich",
         "Viti_Levu_1912", "Cassini_Soldner", "link",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=-18 +lon_0=178 +x_0=109435.392 +y_0=14");
-    add_proj4text (p, 1,
-        "1622.272 +a=6378306.3696 +b=6356571.996 +towgs84=98,390,");
-    add_proj4text (p, 2,
-        "-22,0,0,0,0 +units=link +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Viti Levu 1912 / Viti Levu Grid\",GEOGCS[\"Viti");
-    add_srs_wkt (p, 1,
-        " Levu 1912\",DATUM[\"Viti_Levu_1912\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 2,
-        "1880 (international foot)\",6378306.3696,293.46630765563");
-    add_srs_wkt (p, 3,
-        "5,AUTHORITY[\"EPSG\",\"7055\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4752\"]],PROJECTION[\"C");
-    add_srs_wkt (p, 7,
-        "assini_Soldner\"],PARAMETER[\"latitude_of_origin\",-18],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",178],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",544000],PARAMETER[\"false_northing\",704000],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"link\",0.201168,AUTHORITY[\"EPSG\",\"9098\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3140\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3141, "epsg", 3141,
+        "Northing", "North", "Easting", "East",
+        "+proj=cass +lat_0=-18 +lon_0=178 +x_0=109435.392 +y_0=14"
+        "1622.272 +a=6378306.3696 +b=6356571.996 +towgs84=98,390,"
+        "-22,0,0,0,0 +units=link +no_defs",
+        "PROJCS[\"Viti Levu 1912 / Viti Levu Grid\",GEOGCS[\"Viti"
+        " Levu 1912\",DATUM[\"Viti_Levu_1912\",SPHEROID[\"Clarke "
+        "1880 (international foot)\",6378306.3696,293.46630765563"
+        "5,AUTHORITY[\"EPSG\",\"7055\"]],AUTHORITY[\"EPSG\",\"675"
+        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4752\"]],PROJECTION[\"C"
+        "assini_Soldner\"],PARAMETER[\"latitude_of_origin\",-18],"
+        "PARAMETER[\"central_meridian\",178],PARAMETER[\"false_ea"
+        "sting\",544000],PARAMETER[\"false_northing\",704000],UNI"
+        "T[\"link\",0.201168,AUTHORITY[\"EPSG\",\"9098\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"3140\"]]"},
+    {3141, "epsg", 3141,
         "Fiji 1956 / UTM zone 60S", 0, 0,
         "International 1924", "Greenwich",
         "Fiji_1956", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=60 +south +ellps=intl +towgs84=265.025,3");
-    add_proj4text (p, 1,
-        "84.929,-194.046,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fiji 1956 / UTM zone 60S\",GEOGCS[\"Fiji 1956\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Fiji_1956\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6721\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4721\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",177],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3141\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3142, "epsg", 3142,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=60 +south +ellps=intl +towgs84=265.025,3"
+        "84.929,-194.046,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Fiji 1956 / UTM zone 60S\",GEOGCS[\"Fiji 1956\""
+        ",DATUM[\"Fiji_1956\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6721\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4721\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",177],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3141\"]]"},
+    {3142, "epsg", 3142,
         "Fiji 1956 / UTM zone 1S", 0, 0,
         "International 1924", "Greenwich",
         "Fiji_1956", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=1 +south +ellps=intl +towgs84=265.025,38");
-    add_proj4text (p, 1,
-        "4.929,-194.046,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fiji 1956 / UTM zone 1S\",GEOGCS[\"Fiji 1956\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Fiji_1956\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6721\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4721\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-177],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3142\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3143, "epsg", 3143,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=1 +south +ellps=intl +towgs84=265.025,38"
+        "4.929,-194.046,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Fiji 1956 / UTM zone 1S\",GEOGCS[\"Fiji 1956\","
+        "DATUM[\"Fiji_1956\",SPHEROID[\"International 1924\",6378"
+        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6721\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4721\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-177],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3142\"]]"},
+    {3143, "epsg", 3143,
         "Fiji 1986 / Fiji Map Grid", 0, 0,
         "WGS 72", "Greenwich",
         "Fiji_Geodetic_Datum_1986", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-17 +lon_0=178.75 +k=0.99985 +x_0=200");
-    add_proj4text (p, 1,
-        "0000 +y_0=4000000 +ellps=WGS72 +towgs84=0,0,4.5,0,0,0.55");
-    add_proj4text (p, 2,
-        "4,0.2263 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fiji 1986 / Fiji Map Grid\",GEOGCS[\"Fiji 1986\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Fiji_Geodetic_Datum_1986\",SPHEROID[\"WGS 72\",");
-    add_srs_wkt (p, 2,
-        "6378135,298.26,AUTHORITY[\"EPSG\",\"7043\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6720\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4720\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",-17],PARAMETER[\"central_meridian\",178.75],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",0.99985],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",2000000],PARAMETER[\"false_northing\",4000000],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3460\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3146, "epsg", 3146,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-17 +lon_0=178.75 +k=0.99985 +x_0=200"
+        "0000 +y_0=4000000 +ellps=WGS72 +towgs84=0,0,4.5,0,0,0.55"
+        "4,0.2263 +units=m +no_defs",
+        "PROJCS[\"Fiji 1986 / Fiji Map Grid\",GEOGCS[\"Fiji 1986\""
+        ",DATUM[\"Fiji_Geodetic_Datum_1986\",SPHEROID[\"WGS 72\","
+        "6378135,298.26,AUTHORITY[\"EPSG\",\"7043\"]],AUTHORITY[\""
+        "EPSG\",\"6720\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4720\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",-17],PARAMETER[\"central_meridian\",178.75],P"
+        "ARAMETER[\"scale_factor\",0.99985],PARAMETER[\"false_eas"
+        "ting\",2000000],PARAMETER[\"false_northing\",4000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3460\"]]"},
+    {3146, "epsg", 3146,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 6 (deprecated)", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 6 (de");
-    add_srs_wkt (p, 1,
-        "precated)\",GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 7,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",18],PARAMETER[\"scale_factor\",1],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",6500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3146\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3147, "epsg", 3147,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 6 (de"
+        "precated)\",GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942"
+        "\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY["
+        "\"EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM"
+        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de"
+        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],"
+        "AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"Transverse_Me"
+        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER["
+        "\"central_meridian\",18],PARAMETER[\"scale_factor\",1],P"
+        "ARAMETER[\"false_easting\",6500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3146\"]]"},
+    {3147, "epsg", 3147,
         "Pulkovo 1942 / 3-degree Gauss-Kruger CM 18E (deprecated)", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.");
-    add_proj4text (p, 2,
-        "12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 18E (de");
-    add_srs_wkt (p, 1,
-        "precated)\",GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 7,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",18],PARAMETER[\"scale_factor\",1],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3147\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3148, "epsg", 3148,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0."
+        "12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger CM 18E (de"
+        "precated)\",GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942"
+        "\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY["
+        "\"EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM"
+        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de"
+        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],"
+        "AUTHORITY[\"EPSG\",\"4284\"]],PROJECTION[\"Transverse_Me"
+        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER["
+        "\"central_meridian\",18],PARAMETER[\"scale_factor\",1],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR"
+        "ITY[\"EPSG\",\"3147\"]]"},
+    {3148, "epsg", 3148,
         "Indian 1960 / UTM zone 48N", 0, 0,
         "Everest 1830 (1937 Adjustment)", "Greenwich",
         "Indian_1960", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=48 +a=6377276.345 +b=6356075.41314024 +t");
-    add_proj4text (p, 1,
-        "owgs84=198,881,317,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Indian 1960 / UTM zone 48N\",GEOGCS[\"Indian 19");
-    add_srs_wkt (p, 1,
-        "60\",DATUM[\"Indian_1960\",SPHEROID[\"Everest 1830 (1937");
-    add_srs_wkt (p, 2,
-        " Adjustment)\",6377276.345,300.8017,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7015\"]],AUTHORITY[\"EPSG\",\"6131\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4131\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",105],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"3148\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3149, "epsg", 3149,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=48 +a=6377276.345 +b=6356075.41314024 +t"
+        "owgs84=198,881,317,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Indian 1960 / UTM zone 48N\",GEOGCS[\"Indian 19"
+        "60\",DATUM[\"Indian_1960\",SPHEROID[\"Everest 1830 (1937"
+        " Adjustment)\",6377276.345,300.8017,AUTHORITY[\"EPSG\",\""
+        "7015\"]],AUTHORITY[\"EPSG\",\"6131\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4131\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",105],PARAMETER[\"scale_factor\",0.9996],PARAMET"
+        "ER[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3148\"]]"},
+    {3149, "epsg", 3149,
         "Indian 1960 / UTM zone 49N", 0, 0,
         "Everest 1830 (1937 Adjustment)", "Greenwich",
         "Indian_1960", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=49 +a=6377276.345 +b=6356075.41314024 +t");
-    add_proj4text (p, 1,
-        "owgs84=198,881,317,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Indian 1960 / UTM zone 49N\",GEOGCS[\"Indian 19");
-    add_srs_wkt (p, 1,
-        "60\",DATUM[\"Indian_1960\",SPHEROID[\"Everest 1830 (1937");
-    add_srs_wkt (p, 2,
-        " Adjustment)\",6377276.345,300.8017,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7015\"]],AUTHORITY[\"EPSG\",\"6131\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4131\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",111],PARAMETER[\"scale_factor\",0.9996],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"3149\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3150, "epsg", 3150,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=49 +a=6377276.345 +b=6356075.41314024 +t"
+        "owgs84=198,881,317,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Indian 1960 / UTM zone 49N\",GEOGCS[\"Indian 19"
+        "60\",DATUM[\"Indian_1960\",SPHEROID[\"Everest 1830 (1937"
+        " Adjustment)\",6377276.345,300.8017,AUTHORITY[\"EPSG\",\""
+        "7015\"]],AUTHORITY[\"EPSG\",\"6131\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4131\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",111],PARAMETER[\"scale_factor\",0.9996],PARAMET"
+        "ER[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3149\"]]"},
+    {3150, "epsg", 3150,
         "Pulkovo 1995 / 3-degree Gauss-Kruger zone 6 (deprecated)", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2");
-    add_proj4text (p, 2,
-        "2 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 6 (de");
-    add_srs_wkt (p, 1,
-        "precated)\",GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6200\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4200\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 7,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",18],PARAMETER[\"scale_factor\",1],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",6500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3150\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3151, "epsg", 3151,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 "
+        "+ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.2"
+        "2 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 6 (de"
+        "precated)\",GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995"
+        "\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY["
+        "\"EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6200\"]],PRIMEM"
+        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de"
+        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],"
+        "AUTHORITY[\"EPSG\",\"4200\"]],PROJECTION[\"Transverse_Me"
+        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER["
+        "\"central_meridian\",18],PARAMETER[\"scale_factor\",1],P"
+        "ARAMETER[\"false_easting\",6500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"3150\"]]"},
+    {3151, "epsg", 3151,
         "Pulkovo 1995 / 3-degree Gauss-Kruger CM 18E (deprecated)", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 18E (de");
-    add_srs_wkt (p, 1,
-        "precated)\",GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6200\"]],PRIMEM");
-    add_srs_wkt (p, 4,
-        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4200\"]],PROJECTION[\"Transverse_Me");
-    add_srs_wkt (p, 7,
-        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",18],PARAMETER[\"scale_factor\",1],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3151\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3152, "epsg", 3152,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0.22"
+        " +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger CM 18E (de"
+        "precated)\",GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995"
+        "\",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY["
+        "\"EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6200\"]],PRIMEM"
+        "[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"de"
+        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],"
+        "AUTHORITY[\"EPSG\",\"4200\"]],PROJECTION[\"Transverse_Me"
+        "rcator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER["
+        "\"central_meridian\",18],PARAMETER[\"scale_factor\",1],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR"
+        "ITY[\"EPSG\",\"3151\"]]"},
+    {3152, "epsg", 3152,
         "ST74", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.05779 +k=0.99999425 +x_0=");
-    add_proj4text (p, 1,
-        "100178.1808 +y_0=-6500614.7836 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ST74\",GEOGCS[\"SWEREF99\",DATUM[\"SWEREF99\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 2,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 6,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 7,
-        "entral_meridian\",18.05779],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 8,
-        ".99999425],PARAMETER[\"false_easting\",100178.1808],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",-6500614.7836],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3152\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3153, "epsg", 3153,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18.05779 +k=0.99999425 +x_0="
+        "100178.1808 +y_0=-6500614.7836 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ST74\",GEOGCS[\"SWEREF99\",DATUM[\"SWEREF99\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",18.05779],PARAMETER[\"scale_factor\",0"
+        ".99999425],PARAMETER[\"false_easting\",100178.1808],PARA"
+        "METER[\"false_northing\",-6500614.7836],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],"
+        "AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3152\"]]"},
+    {3153, "epsg", 3153,
         "NAD83(CSRS) / BC Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=50 +lat_2=58.5 +lat_0=45 +lon_0=-126 +x");
-    add_proj4text (p, 1,
-        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / BC Albers\",GEOGCS[\"NAD83(CSRS)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4617\"]],PROJECTION[\"Albers_Conic_Equal_Ar");
-    add_srs_wkt (p, 7,
-        "ea\"],PARAMETER[\"latitude_of_center\",45],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "ongitude_of_center\",-126],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",50],PARAMETER[\"standard_parallel_2\",58.5],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1000000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 11,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"3153\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3154, "epsg", 3154,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=50 +lat_2=58.5 +lat_0=45 +lon_0=-126 +x"
+        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / BC Albers\",GEOGCS[\"NAD83(CSRS)\""
+        ",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4617\"]],PROJECTION[\"Albers_Conic_Equal_Ar"
+        "ea\"],PARAMETER[\"latitude_of_center\",45],PARAMETER[\"l"
+        "ongitude_of_center\",-126],PARAMETER[\"standard_parallel"
+        "_1\",50],PARAMETER[\"standard_parallel_2\",58.5],PARAMET"
+        "ER[\"false_easting\",1000000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3153\"]]"},
+    {3154, "epsg", 3154,
         "NAD83(CSRS) / UTM zone 7N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 7N\",GEOGCS[\"NAD83(CSRS");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-141],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3154\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3155, "epsg", 3155,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=7 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 7N\",GEOGCS[\"NAD83(CSRS"
+        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",-141],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3154\"]]"},
+    {3155, "epsg", 3155,
         "NAD83(CSRS) / UTM zone 8N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=8 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 8N\",GEOGCS[\"NAD83(CSRS");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-135],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3155\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3156, "epsg", 3156,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=8 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 8N\",GEOGCS[\"NAD83(CSRS"
+        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",-135],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3155\"]]"},
+    {3156, "epsg", 3156,
         "NAD83(CSRS) / UTM zone 9N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=9 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 9N\",GEOGCS[\"NAD83(CSRS");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-129],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3156\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3157, "epsg", 3157,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=9 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 9N\",GEOGCS[\"NAD83(CSRS"
+        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",-129],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3156\"]]"},
+    {3157, "epsg", 3157,
         "NAD83(CSRS) / UTM zone 10N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=10 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 10N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-123],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 9,
-        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"3157\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3158, "epsg", 3158,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=10 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 10N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-123],PARAMETER[\"scale_factor\",0.999"
+        "6],PARAMETER[\"false_easting\",500000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3157\"]]"},
+    {3158, "epsg", 3158,
         "NAD83(CSRS) / UTM zone 14N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 14N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-99],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3158\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3159, "epsg", 3159,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 14N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-99],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3158\"]]"},
+    {3159, "epsg", 3159,
         "NAD83(CSRS) / UTM zone 15N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 15N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-93],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3159\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3160, "epsg", 3160,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 15N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-93],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3159\"]]"},
+    {3160, "epsg", 3160,
         "NAD83(CSRS) / UTM zone 16N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 16N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-87],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3160\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3161, "epsg", 3161,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 16N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-87],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3160\"]]"},
+    {3161, "epsg", 3161,
         "NAD83 / Ontario MNR Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.5 +lat_2=53.5 +lat_0=0 +lon_0=-85 +x");
-    add_proj4text (p, 1,
-        "_0=930000 +y_0=6430000 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Ontario MNR Lambert\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-85],PARAMETER[\"standard_parallel_1\",44.5],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_2\",53.5],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",930000],PARAMETER[\"false_northing\",6430000],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3161\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3162, "epsg", 3162,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.5 +lat_2=53.5 +lat_0=0 +lon_0=-85 +x"
+        "_0=930000 +y_0=6430000 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Ontario MNR Lambert\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",-85],PARAMETER[\"standard_parallel_1\",44.5],PARAM"
+        "ETER[\"standard_parallel_2\",53.5],PARAMETER[\"false_eas"
+        "ting\",930000],PARAMETER[\"false_northing\",6430000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3161\"]]"},
+    {3162, "epsg", 3162,
         "NAD83(CSRS) / Ontario MNR Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.5 +lat_2=53.5 +lat_0=0 +lon_0=-85 +x");
-    add_proj4text (p, 1,
-        "_0=930000 +y_0=6430000 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Ontario MNR Lambert\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"central_meridian\",-85],PARAMETER[\"standar");
-    add_srs_wkt (p, 9,
-        "d_parallel_1\",44.5],PARAMETER[\"standard_parallel_2\",5");
-    add_srs_wkt (p, 10,
-        "3.5],PARAMETER[\"false_easting\",930000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",6430000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"3162\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3163, "epsg", 3163,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.5 +lat_2=53.5 +lat_0=0 +lon_0=-85 +x"
+        "_0=930000 +y_0=6430000 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Ontario MNR Lambert\",GEOGCS[\"NA"
+        "D83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_Sys"
+        "tem\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",-85],PARAMETER[\"standar"
+        "d_parallel_1\",44.5],PARAMETER[\"standard_parallel_2\",5"
+        "3.5],PARAMETER[\"false_easting\",930000],PARAMETER[\"fal"
+        "se_northing\",6430000],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"3162\"]]"},
+    {3163, "epsg", 3163,
         "RGNC91-93 / Lambert New Caledonia", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_Nouvelle_Caledonie_91-93", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-20.66666666666667 +lat_2=-22.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-21.5 +lon_0=166 +x_0=400000 +y_0=300000 +e");
-    add_proj4text (p, 2,
-        "llps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGNC91-93 / Lambert New Caledonia\",GEOGCS[\"RG");
-    add_srs_wkt (p, 1,
-        "NC91-93\",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledoni");
-    add_srs_wkt (p, 2,
-        "e_91-93\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",-21.5],PARAMETER[\"central_meridian\",166],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",-20.6666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",-22.3333333333333],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",400000],PARAMETER[\"false_northing\",300000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"3163\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3164, "epsg", 3164,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-20.66666666666667 +lat_2=-22.333333333"
+        "33333 +lat_0=-21.5 +lon_0=166 +x_0=400000 +y_0=300000 +e"
+        "llps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGNC91-93 / Lambert New Caledonia\",GEOGCS[\"RG"
+        "NC91-93\",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledoni"
+        "e_91-93\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",-21.5],PARAMETER[\"central_meridian\",166],PARAMETER["
+        "\"standard_parallel_1\",-20.6666666666667],PARAMETER[\"s"
+        "tandard_parallel_2\",-22.3333333333333],PARAMETER[\"fals"
+        "e_easting\",400000],PARAMETER[\"false_northing\",300000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"3163\"]]"},
+    {3164, "epsg", 3164,
         "ST87 Ouvea / UTM zone 58S", 0, 0,
         "WGS 84", "Greenwich",
         "ST87_Ouvea", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=WGS84 +towgs84=-56.263,");
-    add_proj4text (p, 1,
-        "16.136,-22.856,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ST87 Ouvea / UTM zone 58S\",GEOGCS[\"ST87 Ouvea");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"ST87_Ouvea\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6750\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4750\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",165],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",10000000],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3164\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3165, "epsg", 3165,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=WGS84 +towgs84=-56.263,"
+        "16.136,-22.856,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ST87 Ouvea / UTM zone 58S\",GEOGCS[\"ST87 Ouvea"
+        "\",DATUM[\"ST87_Ouvea\",SPHEROID[\"WGS 84\",6378137,298."
+        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG"
+        "\",\"6750\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4750\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",165],PARAMETER["
+        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",10000000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3164\"]]"},
+    {3165, "epsg", 3165,
         "NEA74 Noumea / Noumea Lambert", 0, 0,
         "International 1924", "Greenwich",
         "NEA74_Noumea", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-22.24469175 +lat_2=-22.29469175 +lat_0");
-    add_proj4text (p, 1,
-        "=-22.26969175 +lon_0=166.44242575 +x_0=0.66 +y_0=1.02 +e");
-    add_proj4text (p, 2,
-        "llps=intl +towgs84=-10.18,-350.43,291.37,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NEA74 Noumea / Noumea Lambert\",GEOGCS[\"NEA74 ");
-    add_srs_wkt (p, 1,
-        "Noumea\",DATUM[\"NEA74_Noumea\",SPHEROID[\"International");
-    add_srs_wkt (p, 2,
-        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6644\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4644\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",-22.26969175],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",166.44242575],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",-22.24469175],PARAMETER[\"standard_parallel_2\",-22");
-    add_srs_wkt (p, 10,
-        ".29469175],PARAMETER[\"false_easting\",0.66],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",1.02],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"3165\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3166, "epsg", 3166,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-22.24469175 +lat_2=-22.29469175 +lat_0"
+        "=-22.26969175 +lon_0=166.44242575 +x_0=0.66 +y_0=1.02 +e"
+        "llps=intl +towgs84=-10.18,-350.43,291.37,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NEA74 Noumea / Noumea Lambert\",GEOGCS[\"NEA74 "
+        "Noumea\",DATUM[\"NEA74_Noumea\",SPHEROID[\"International"
+        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6644\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4644\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER"
+        "[\"latitude_of_origin\",-22.26969175],PARAMETER[\"centra"
+        "l_meridian\",166.44242575],PARAMETER[\"standard_parallel"
+        "_1\",-22.24469175],PARAMETER[\"standard_parallel_2\",-22"
+        ".29469175],PARAMETER[\"false_easting\",0.66],PARAMETER[\""
+        "false_northing\",1.02],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"3165\"]]"},
+    {3166, "epsg", 3166,
         "NEA74 Noumea / Noumea Lambert 2", 0, 0,
         "International 1924", "Greenwich",
         "NEA74_Noumea", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-22.24472222222222 +lat_2=-22.294722222");
-    add_proj4text (p, 1,
-        "22222 +lat_0=-22.26972222222222 +lon_0=166.4425 +x_0=8.3");
-    add_proj4text (p, 2,
-        "13000000000001 +y_0=-2.354 +ellps=intl +towgs84=-10.18,-");
-    add_proj4text (p, 3,
-        "350.43,291.37,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NEA74 Noumea / Noumea Lambert 2\",GEOGCS[\"NEA7");
-    add_srs_wkt (p, 1,
-        "4 Noumea\",DATUM[\"NEA74_Noumea\",SPHEROID[\"Internation");
-    add_srs_wkt (p, 2,
-        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6644\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"464");
-    add_srs_wkt (p, 6,
-        "4\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",-22.2697222222222],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",166.4425],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",-22.2447222222222],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",-22.2947222222222],PARAMETER[\"false_easting\",8.3");
-    add_srs_wkt (p, 11,
-        "13],PARAMETER[\"false_northing\",-2.354],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3166\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3167, "epsg", 3167,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-22.24472222222222 +lat_2=-22.294722222"
+        "22222 +lat_0=-22.26972222222222 +lon_0=166.4425 +x_0=8.3"
+        "13000000000001 +y_0=-2.354 +ellps=intl +towgs84=-10.18,-"
+        "350.43,291.37,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NEA74 Noumea / Noumea Lambert 2\",GEOGCS[\"NEA7"
+        "4 Noumea\",DATUM[\"NEA74_Noumea\",SPHEROID[\"Internation"
+        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH"
+        "ORITY[\"EPSG\",\"6644\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"464"
+        "4\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",-22.2697222222222],PARAMETER["
+        "\"central_meridian\",166.4425],PARAMETER[\"standard_para"
+        "llel_1\",-22.2447222222222],PARAMETER[\"standard_paralle"
+        "l_2\",-22.2947222222222],PARAMETER[\"false_easting\",8.3"
+        "13],PARAMETER[\"false_northing\",-2.354],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3166\"]]"},
+    {3167, "epsg", 3167,
         "Kertau (RSO) / RSO Malaya (ch)", 0, 0,
         "Everest 1830 (RSO 1969)", "Greenwich",
         "Kertau_RSO", "Hotine_Oblique_Mercator", "British chain (Sears 1922 truncated)",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=4 +lonc=102.25 +alpha=323.0257905 +k=");
-    add_proj4text (p, 1,
-        "0.99984 +x_0=40000 +y_0=0 +no_uoff +gamma=323.1301023611");
-    add_proj4text (p, 2,
-        "111 +a=6377295.664 +b=6356094.667915204 +to_meter=20.116");
-    add_proj4text (p, 3,
-        "756 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Kertau (RSO) / RSO Malaya (ch)\",GEOGCS[\"Kerta");
-    add_srs_wkt (p, 1,
-        "u (RSO)\",DATUM[\"Kertau_RSO\",SPHEROID[\"Everest 1830 (");
-    add_srs_wkt (p, 2,
-        "RSO 1969)\",6377295.664,300.8017,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "56\"]],AUTHORITY[\"EPSG\",\"6751\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4751\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_center\",4],PARAMETER[\"longitud");
-    add_srs_wkt (p, 8,
-        "e_of_center\",102.25],PARAMETER[\"azimuth\",323.0257905]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"rectified_grid_angle\",323.130102361111],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.99984],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",40000],PARAMETER[\"false_northing\",0],UNIT[\"Brit");
-    add_srs_wkt (p, 12,
-        "ish chain (Sears 1922 truncated)\",20.116756,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9301\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3167\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3168, "epsg", 3168,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=4 +lonc=102.25 +alpha=323.0257905 +k="
+        "0.99984 +x_0=40000 +y_0=0 +no_uoff +gamma=323.1301023611"
+        "111 +a=6377295.664 +b=6356094.667915204 +to_meter=20.116"
+        "756 +no_defs",
+        "PROJCS[\"Kertau (RSO) / RSO Malaya (ch)\",GEOGCS[\"Kerta"
+        "u (RSO)\",DATUM[\"Kertau_RSO\",SPHEROID[\"Everest 1830 ("
+        "RSO 1969)\",6377295.664,300.8017,AUTHORITY[\"EPSG\",\"70"
+        "56\"]],AUTHORITY[\"EPSG\",\"6751\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4751\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],"
+        "PARAMETER[\"latitude_of_center\",4],PARAMETER[\"longitud"
+        "e_of_center\",102.25],PARAMETER[\"azimuth\",323.0257905]"
+        ",PARAMETER[\"rectified_grid_angle\",323.130102361111],PA"
+        "RAMETER[\"scale_factor\",0.99984],PARAMETER[\"false_east"
+        "ing\",40000],PARAMETER[\"false_northing\",0],UNIT[\"Brit"
+        "ish chain (Sears 1922 truncated)\",20.116756,AUTHORITY[\""
+        "EPSG\",\"9301\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3167\"]]"},
+    {3168, "epsg", 3168,
         "Kertau (RSO) / RSO Malaya (m)", 0, 0,
         "Everest 1830 (RSO 1969)", "Greenwich",
         "Kertau_RSO", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=4 +lonc=102.25 +alpha=323.0257905 +k=");
-    add_proj4text (p, 1,
-        "0.99984 +x_0=804670.24 +y_0=0 +no_uoff +gamma=323.130102");
-    add_proj4text (p, 2,
-        "3611111 +a=6377295.664 +b=6356094.667915204 +units=m +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Kertau (RSO) / RSO Malaya (m)\",GEOGCS[\"Kertau");
-    add_srs_wkt (p, 1,
-        " (RSO)\",DATUM[\"Kertau_RSO\",SPHEROID[\"Everest 1830 (R");
-    add_srs_wkt (p, 2,
-        "SO 1969)\",6377295.664,300.8017,AUTHORITY[\"EPSG\",\"705");
-    add_srs_wkt (p, 3,
-        "6\"]],AUTHORITY[\"EPSG\",\"6751\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4751\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_center\",4],PARAMETER[\"longitud");
-    add_srs_wkt (p, 8,
-        "e_of_center\",102.25],PARAMETER[\"azimuth\",323.0257905]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"rectified_grid_angle\",323.130102361111],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"scale_factor\",0.99984],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",804670.24],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"316");
-    add_srs_wkt (p, 14,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3169, "epsg", 3169,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=4 +lonc=102.25 +alpha=323.0257905 +k="
+        "0.99984 +x_0=804670.24 +y_0=0 +no_uoff +gamma=323.130102"
+        "3611111 +a=6377295.664 +b=6356094.667915204 +units=m +no"
+        "_defs",
+        "PROJCS[\"Kertau (RSO) / RSO Malaya (m)\",GEOGCS[\"Kertau"
+        " (RSO)\",DATUM[\"Kertau_RSO\",SPHEROID[\"Everest 1830 (R"
+        "SO 1969)\",6377295.664,300.8017,AUTHORITY[\"EPSG\",\"705"
+        "6\"]],AUTHORITY[\"EPSG\",\"6751\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4751\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],"
+        "PARAMETER[\"latitude_of_center\",4],PARAMETER[\"longitud"
+        "e_of_center\",102.25],PARAMETER[\"azimuth\",323.0257905]"
+        ",PARAMETER[\"rectified_grid_angle\",323.130102361111],PA"
+        "RAMETER[\"scale_factor\",0.99984],PARAMETER[\"false_east"
+        "ing\",804670.24],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"316"
+        "8\"]]"},
+    {3169, "epsg", 3169,
         "RGNC91-93 / UTM zone 57S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_Nouvelle_Caledonie_91-93", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=57 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGNC91-93 / UTM zone 57S\",GEOGCS[\"RGNC91-93\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledonie_91-93\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",159],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"3169\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3170, "epsg", 3170,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=57 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGNC91-93 / UTM zone 57S\",GEOGCS[\"RGNC91-93\""
+        ",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledonie_91-93\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",159],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3169\"]]"},
+    {3170, "epsg", 3170,
         "RGNC91-93 / UTM zone 58S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_Nouvelle_Caledonie_91-93", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=58 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGNC91-93 / UTM zone 58S\",GEOGCS[\"RGNC91-93\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledonie_91-93\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",165],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"3170\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3171, "epsg", 3171,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=58 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGNC91-93 / UTM zone 58S\",GEOGCS[\"RGNC91-93\""
+        ",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledonie_91-93\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",165],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3170\"]]"},
+    {3171, "epsg", 3171,
         "RGNC91-93 / UTM zone 59S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_Nouvelle_Caledonie_91-93", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=59 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGNC91-93 / UTM zone 59S\",GEOGCS[\"RGNC91-93\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledonie_91-93\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",171],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"3171\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3172, "epsg", 3172,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=59 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGNC91-93 / UTM zone 59S\",GEOGCS[\"RGNC91-93\""
+        ",DATUM[\"Reseau_Geodesique_de_Nouvelle_Caledonie_91-93\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6749\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4749\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",171],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3171\"]]"},
+    {3172, "epsg", 3172,
         "IGN53 Mare / UTM zone 59S", 0, 0,
         "International 1924", "Greenwich",
         "IGN53_Mare", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=59 +south +ellps=intl +towgs84=287.58,17");
-    add_proj4text (p, 1,
-        "7.78,-135.41,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN53 Mare / UTM zone 59S\",GEOGCS[\"IGN53 Mare");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"IGN53_Mare\",SPHEROID[\"International 1924\",");
-    add_srs_wkt (p, 2,
-        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6641\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4641\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",171],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3172\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3174, "epsg", 3174,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=59 +south +ellps=intl +towgs84=287.58,17"
+        "7.78,-135.41,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGN53 Mare / UTM zone 59S\",GEOGCS[\"IGN53 Mare"
+        "\",DATUM[\"IGN53_Mare\",SPHEROID[\"International 1924\","
+        "6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EP"
+        "SG\",\"6641\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4641\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",171],PARAMETER"
+        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3172\"]"
+        "]"},
+    {3174, "epsg", 3174,
         "NAD83 / Great Lakes Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=42.122774 +lat_2=49.01518 +lat_0=45.568");
-    add_proj4text (p, 1,
-        "977 +lon_0=-84.455955 +x_0=1000000 +y_0=1000000 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Great Lakes Albers\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_center\",45.568977],PARAMETER[\"longitude");
-    add_srs_wkt (p, 8,
-        "_of_center\",-84.455955],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 9,
-        "\",42.122774],PARAMETER[\"standard_parallel_2\",49.01518");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",1000000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"3174\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3175, "epsg", 3175,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=42.122774 +lat_2=49.01518 +lat_0=45.568"
+        "977 +lon_0=-84.455955 +x_0=1000000 +y_0=1000000 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Great Lakes Albers\",GEOGCS[\"NAD83\",D"
+        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER"
+        "[\"latitude_of_center\",45.568977],PARAMETER[\"longitude"
+        "_of_center\",-84.455955],PARAMETER[\"standard_parallel_1"
+        "\",42.122774],PARAMETER[\"standard_parallel_2\",49.01518"
+        "],PARAMETER[\"false_easting\",1000000],PARAMETER[\"false"
+        "_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3174\"]]"},
+    {3175, "epsg", 3175,
         "NAD83 / Great Lakes and St Lawrence Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=42.122774 +lat_2=49.01518 +lat_0=45.568");
-    add_proj4text (p, 1,
-        "977 +lon_0=-83.248627 +x_0=1000000 +y_0=1000000 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Great Lakes and St Lawrence Albers\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4269\"]],PROJECTION[\"Albers_Conic_Equal_Ar");
-    add_srs_wkt (p, 7,
-        "ea\"],PARAMETER[\"latitude_of_center\",45.568977],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"longitude_of_center\",-83.248627],PARAMETER[\"stan");
-    add_srs_wkt (p, 9,
-        "dard_parallel_1\",42.122774],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 10,
-        "el_2\",49.01518],PARAMETER[\"false_easting\",1000000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3175\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3176, "epsg", 3176,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=42.122774 +lat_2=49.01518 +lat_0=45.568"
+        "977 +lon_0=-83.248627 +x_0=1000000 +y_0=1000000 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Great Lakes and St Lawrence Albers\",GE"
+        "OGCS[\"NAD83\",DATUM[\"North_American_Datum_1983\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4269\"]],PROJECTION[\"Albers_Conic_Equal_Ar"
+        "ea\"],PARAMETER[\"latitude_of_center\",45.568977],PARAME"
+        "TER[\"longitude_of_center\",-83.248627],PARAMETER[\"stan"
+        "dard_parallel_1\",42.122774],PARAMETER[\"standard_parall"
+        "el_2\",49.01518],PARAMETER[\"false_easting\",1000000],PA"
+        "RAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3175\"]]"},
+    {3176, "epsg", 3176,
         "Indian 1960 / TM 106 NE", 0, 0,
         "Everest 1830 (1937 Adjustment)", "Greenwich",
         "Indian_1960", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=106 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +a=6377276.345 +b=6356075.41314024 +towgs84=198,881");
-    add_proj4text (p, 2,
-        ",317,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Indian 1960 / TM 106 NE\",GEOGCS[\"Indian 1960\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Indian_1960\",SPHEROID[\"Everest 1830 (1937 Adj");
-    add_srs_wkt (p, 2,
-        "ustment)\",6377276.345,300.8017,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "5\"]],AUTHORITY[\"EPSG\",\"6131\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4131\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",106],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3176\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3177, "epsg", 3177,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=106 +k=0.9996 +x_0=500000 +y"
+        "_0=0 +a=6377276.345 +b=6356075.41314024 +towgs84=198,881"
+        ",317,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Indian 1960 / TM 106 NE\",GEOGCS[\"Indian 1960\""
+        ",DATUM[\"Indian_1960\",SPHEROID[\"Everest 1830 (1937 Adj"
+        "ustment)\",6377276.345,300.8017,AUTHORITY[\"EPSG\",\"701"
+        "5\"]],AUTHORITY[\"EPSG\",\"6131\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4131\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",106],PARAMETER[\"scale_factor\",0.9996],PARAMETER"
+        "[\"false_easting\",500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3176\"]]"},
+    {3177, "epsg", 3177,
         "LGD2006 / Libya TM", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17 +k=0.9965000000000001 +x_");
-    add_proj4text (p, 1,
-        "0=1000000 +y_0=0 +ellps=intl +towgs84=-208.4058,-109.877");
-    add_proj4text (p, 2,
-        "7,-2.5764,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM\",GEOGCS[\"LGD2006\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Libyan_Geodetic_Datum_2006\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4754\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",17],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9965],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3177\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3178, "epsg", 3178,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=17 +k=0.9965000000000001 +x_"
+        "0=1000000 +y_0=0 +ellps=intl +towgs84=-208.4058,-109.877"
+        "7,-2.5764,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM\",GEOGCS[\"LGD2006\",DATUM[\""
+        "Libyan_Geodetic_Datum_2006\",SPHEROID[\"International 19"
+        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY"
+        "[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4754\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",17],PARA"
+        "METER[\"scale_factor\",0.9965],PARAMETER[\"false_easting"
+        "\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3177\"]]"},
+    {3178, "epsg", 3178,
         "GR96 / UTM zone 18N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 18N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-75],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3178\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3179, "epsg", 3179,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 18N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-75],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3178\"]]"},
+    {3179, "epsg", 3179,
         "GR96 / UTM zone 19N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 19N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-69],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3179\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3180, "epsg", 3180,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 19N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-69],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3179\"]]"},
+    {3180, "epsg", 3180,
         "GR96 / UTM zone 20N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 20N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-63],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3180\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3181, "epsg", 3181,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 20N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-63],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3180\"]]"},
+    {3181, "epsg", 3181,
         "GR96 / UTM zone 21N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 21N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-57],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3181\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3182, "epsg", 3182,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 21N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-57],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3181\"]]"},
+    {3182, "epsg", 3182,
         "GR96 / UTM zone 22N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 22N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-51],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3182\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3183, "epsg", 3183,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 22N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-51],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3182\"]]"},
+    {3183, "epsg", 3183,
         "GR96 / UTM zone 23N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 23N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-45],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3183\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3184, "epsg", 3184,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=23 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 23N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-45],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3183\"]]"},
+    {3184, "epsg", 3184,
         "GR96 / UTM zone 24N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=24 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 24N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-39],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3184\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3185, "epsg", 3185,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=24 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 24N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-39],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3184\"]]"},
+    {3185, "epsg", 3185,
         "GR96 / UTM zone 25N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 25N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-33],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3185\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3186, "epsg", 3186,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=25 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 25N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-33],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3185\"]]"},
+    {3186, "epsg", 3186,
         "GR96 / UTM zone 26N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=26 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 26N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-27],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3186\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3187, "epsg", 3187,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=26 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 26N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-27],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3186\"]]"},
+    {3187, "epsg", 3187,
         "GR96 / UTM zone 27N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=27 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 27N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-21],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3187\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3188, "epsg", 3188,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=27 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 27N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-21],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3187\"]]"},
+    {3188, "epsg", 3188,
         "GR96 / UTM zone 28N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 28N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-15],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3188\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3189, "epsg", 3189,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 28N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-15],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3188\"]]"},
+    {3189, "epsg", 3189,
         "GR96 / UTM zone 29N", 0, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GR96 / UTM zone 29N\",GEOGCS[\"GR96\",DATUM[\"G");
-    add_srs_wkt (p, 1,
-        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"scale_");
-    add_srs_wkt (p, 8,
-        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 10,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 11,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3189\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3190, "epsg", 3190,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=29 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"GR96 / UTM zone 29N\",GEOGCS[\"GR96\",DATUM[\"G"
+        "reenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4747\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"scale_"
+        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3189\"]]"},
+    {3190, "epsg", 3190,
         "LGD2006 / Libya TM zone 5", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.99995 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 5\",GEOGCS[\"LGD2006\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",200000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319");
-    add_srs_wkt (p, 12,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3191, "epsg", 3191,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.99995 +x_0=200000 +y_"
+        "0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 5\",GEOGCS[\"LGD2006\","
+        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9"
+        "],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_"
+        "easting\",200000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"319"
+        "0\"]]"},
+    {3191, "epsg", 3191,
         "LGD2006 / Libya TM zone 6", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 6\",GEOGCS[\"LGD2006\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "191\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3192, "epsg", 3192,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=11 +k=0.99995 +x_0=200000 +y"
+        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 6\",GEOGCS[\"LGD2006\","
+        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "1],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false"
+        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "191\"]]"},
+    {3192, "epsg", 3192,
         "LGD2006 / Libya TM zone 7", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 7\",GEOGCS[\"LGD2006\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "3],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "192\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3193, "epsg", 3193,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=13 +k=0.99995 +x_0=200000 +y"
+        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 7\",GEOGCS[\"LGD2006\","
+        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "3],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false"
+        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "192\"]]"},
+    {3193, "epsg", 3193,
         "LGD2006 / Libya TM zone 8", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 8\",GEOGCS[\"LGD2006\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "193\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3194, "epsg", 3194,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.99995 +x_0=200000 +y"
+        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 8\",GEOGCS[\"LGD2006\","
+        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "5],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false"
+        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "193\"]]"},
+    {3194, "epsg", 3194,
         "LGD2006 / Libya TM zone 9", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 9\",GEOGCS[\"LGD2006\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "7],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "194\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3195, "epsg", 3195,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=17 +k=0.99995 +x_0=200000 +y"
+        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 9\",GEOGCS[\"LGD2006\","
+        "DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "7],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false"
+        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "194\"]]"},
+    {3195, "epsg", 3195,
         "LGD2006 / Libya TM zone 10", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=19 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 10\",GEOGCS[\"LGD2006\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "9],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "195\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3196, "epsg", 3196,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=19 +k=0.99995 +x_0=200000 +y"
+        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 10\",GEOGCS[\"LGD2006\""
+        ",DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "9],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false"
+        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "195\"]]"},
+    {3196, "epsg", 3196,
         "LGD2006 / Libya TM zone 11", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 11\",GEOGCS[\"LGD2006\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "196\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3197, "epsg", 3197,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.99995 +x_0=200000 +y"
+        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 11\",GEOGCS[\"LGD2006\""
+        ",DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2"
+        "1],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false"
+        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "196\"]]"},
+    {3197, "epsg", 3197,
         "LGD2006 / Libya TM zone 12", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 12\",GEOGCS[\"LGD2006\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2");
-    add_srs_wkt (p, 8,
-        "3],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "197\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3198, "epsg", 3198,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=23 +k=0.99995 +x_0=200000 +y"
+        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 12\",GEOGCS[\"LGD2006\""
+        ",DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2"
+        "3],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false"
+        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "197\"]]"},
+    {3198, "epsg", 3198,
         "LGD2006 / Libya TM zone 13", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=25 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / Libya TM zone 13\",GEOGCS[\"LGD2006\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "198\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3199, "epsg", 3199,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=25 +k=0.99995 +x_0=200000 +y"
+        "_0=0 +ellps=intl +towgs84=-208.4058,-109.8777,-2.5764,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / Libya TM zone 13\",GEOGCS[\"LGD2006\""
+        ",DATUM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4754\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2"
+        "5],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false"
+        "_easting\",200000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "198\"]]"},
+    {3199, "epsg", 3199,
         "LGD2006 / UTM zone 32N", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +ellps=intl +towgs84=-208.4058,-109.8");
-    add_proj4text (p, 1,
-        "777,-2.5764,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / UTM zone 32N\",GEOGCS[\"LGD2006\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internation");
-    add_srs_wkt (p, 2,
-        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 6,
-        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",9],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 11,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3199\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3200, "epsg", 3200,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +ellps=intl +towgs84=-208.4058,-109.8"
+        "777,-2.5764,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / UTM zone 32N\",GEOGCS[\"LGD2006\",DAT"
+        "UM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internation"
+        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH"
+        "ORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"475"
+        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",0],PARAMETER[\"central_meridian\",9],"
+        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3199\""
+        "]]"},
+    {3200, "epsg", 3200,
         "FD58 / Iraq zone", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Final_Datum_1958", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.5 +lat_0=32.5 +lon_0=45 +k_0=0.99878");
-    add_proj4text (p, 1,
-        "64078000001 +x_0=1500000 +y_0=1166200 +ellps=clrk80 +tow");
-    add_proj4text (p, 2,
-        "gs84=-241.54,-163.64,396.06,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"FD58 / Iraq zone\",GEOGCS[\"FD58\",DATUM[\"Fina");
-    add_srs_wkt (p, 1,
-        "l_Datum_1958\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 2,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6132\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4132\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 7,
-        "de_of_origin\",32.5],PARAMETER[\"central_meridian\",45],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9987864078],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",1500000],PARAMETER[\"false_northing\",11662");
-    add_srs_wkt (p, 10,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"3200\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3201, "epsg", 3201,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=32.5 +lat_0=32.5 +lon_0=45 +k_0=0.99878"
+        "64078000001 +x_0=1500000 +y_0=1166200 +ellps=clrk80 +tow"
+        "gs84=-241.54,-163.64,396.06,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"FD58 / Iraq zone\",GEOGCS[\"FD58\",DATUM[\"Fina"
+        "l_Datum_1958\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6132\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4132\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",32.5],PARAMETER[\"central_meridian\",45],"
+        "PARAMETER[\"scale_factor\",0.9987864078],PARAMETER[\"fal"
+        "se_easting\",1500000],PARAMETER[\"false_northing\",11662"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3200\"]]"},
+    {3201, "epsg", 3201,
         "LGD2006 / UTM zone 33N", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=intl +towgs84=-208.4058,-109.8");
-    add_proj4text (p, 1,
-        "777,-2.5764,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / UTM zone 33N\",GEOGCS[\"LGD2006\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internation");
-    add_srs_wkt (p, 2,
-        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 6,
-        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",15]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 10,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 11,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3201");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3202, "epsg", 3202,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +ellps=intl +towgs84=-208.4058,-109.8"
+        "777,-2.5764,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / UTM zone 33N\",GEOGCS[\"LGD2006\",DAT"
+        "UM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internation"
+        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH"
+        "ORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"475"
+        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",0],PARAMETER[\"central_meridian\",15]"
+        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea"
+        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3201"
+        "\"]]"},
+    {3202, "epsg", 3202,
         "LGD2006 / UTM zone 34N", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +ellps=intl +towgs84=-208.4058,-109.8");
-    add_proj4text (p, 1,
-        "777,-2.5764,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / UTM zone 34N\",GEOGCS[\"LGD2006\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internation");
-    add_srs_wkt (p, 2,
-        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 6,
-        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",21]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 10,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 11,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3202");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3203, "epsg", 3203,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=34 +ellps=intl +towgs84=-208.4058,-109.8"
+        "777,-2.5764,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / UTM zone 34N\",GEOGCS[\"LGD2006\",DAT"
+        "UM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internation"
+        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH"
+        "ORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"475"
+        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",0],PARAMETER[\"central_meridian\",21]"
+        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea"
+        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3202"
+        "\"]]"},
+    {3203, "epsg", 3203,
         "LGD2006 / UTM zone 35N", 0, 0,
         "International 1924", "Greenwich",
         "Libyan_Geodetic_Datum_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=intl +towgs84=-208.4058,-109.8");
-    add_proj4text (p, 1,
-        "777,-2.5764,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LGD2006 / UTM zone 35N\",GEOGCS[\"LGD2006\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internation");
-    add_srs_wkt (p, 2,
-        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"475");
-    add_srs_wkt (p, 6,
-        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",27]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 10,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 11,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3203");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3204, "epsg", 3204,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=35 +ellps=intl +towgs84=-208.4058,-109.8"
+        "777,-2.5764,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"LGD2006 / UTM zone 35N\",GEOGCS[\"LGD2006\",DAT"
+        "UM[\"Libyan_Geodetic_Datum_2006\",SPHEROID[\"Internation"
+        "al 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTH"
+        "ORITY[\"EPSG\",\"6754\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"475"
+        "4\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",0],PARAMETER[\"central_meridian\",27]"
+        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea"
+        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3203"
+        "\"]]"},
+    {3204, "epsg", 3204,
         "WGS 84 / SCAR IMW SP19-20", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-60.66666666666666 +lat_2=-63.333333333");
-    add_proj4text (p, 1,
-        "33334 +lat_0=-90 +lon_0=-66 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SP19-20\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-66],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-60.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-63.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320");
-    add_srs_wkt (p, 13,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3205, "epsg", 3205,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-60.66666666666666 +lat_2=-63.333333333"
+        "33334 +lat_0=-90 +lon_0=-66 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SP19-20\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-66],PARAMET"
+        "ER[\"standard_parallel_1\",-60.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-63.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320"
+        "4\"]]"},
+    {3205, "epsg", 3205,
         "WGS 84 / SCAR IMW SP21-22", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-60.66666666666666 +lat_2=-63.333333333");
-    add_proj4text (p, 1,
-        "33334 +lat_0=-90 +lon_0=-54 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SP21-22\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-60.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-63.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320");
-    add_srs_wkt (p, 13,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3206, "epsg", 3206,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-60.66666666666666 +lat_2=-63.333333333"
+        "33334 +lat_0=-90 +lon_0=-54 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SP21-22\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-54],PARAMET"
+        "ER[\"standard_parallel_1\",-60.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-63.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320"
+        "5\"]]"},
+    {3206, "epsg", 3206,
         "WGS 84 / SCAR IMW SP23-24", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-60.66666666666666 +lat_2=-63.333333333");
-    add_proj4text (p, 1,
-        "33334 +lat_0=-90 +lon_0=-42 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SP23-24\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-42],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-60.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-63.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320");
-    add_srs_wkt (p, 13,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3207, "epsg", 3207,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-60.66666666666666 +lat_2=-63.333333333"
+        "33334 +lat_0=-90 +lon_0=-42 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SP23-24\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-42],PARAMET"
+        "ER[\"standard_parallel_1\",-60.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-63.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320"
+        "6\"]]"},
+    {3207, "epsg", 3207,
         "WGS 84 / SCAR IMW SQ01-02", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-174 +x_0=0 +y_0=0 +datum=WGS84 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ01-02\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-174],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"standard_parallel_1\",-64.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "207\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3208, "epsg", 3208,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=-174 +x_0=0 +y_0=0 +datum=WGS84 "
+        "+units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ01-02\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-174],PARAME"
+        "TER[\"standard_parallel_1\",-64.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",-67.3333333333333],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "207\"]]"},
+    {3208, "epsg", 3208,
         "WGS 84 / SCAR IMW SQ19-20", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-66 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ19-20\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-66],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320");
-    add_srs_wkt (p, 13,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3209, "epsg", 3209,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=-66 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ19-20\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-66],PARAMET"
+        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320"
+        "8\"]]"},
+    {3209, "epsg", 3209,
         "WGS 84 / SCAR IMW SQ21-22", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-54 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ21-22\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320");
-    add_srs_wkt (p, 13,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3210, "epsg", 3210,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=-54 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ21-22\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-54],PARAMET"
+        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"320"
+        "9\"]]"},
+    {3210, "epsg", 3210,
         "WGS 84 / SCAR IMW SQ37-38", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=42 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ37-38\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",42],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3210");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3211, "epsg", 3211,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=42 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ37-38\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",42],PARAMETE"
+        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3210"
+        "\"]]"},
+    {3211, "epsg", 3211,
         "WGS 84 / SCAR IMW SQ39-40", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=54 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ39-40\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",54],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3211");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3212, "epsg", 3212,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=54 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ39-40\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",54],PARAMETE"
+        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3211"
+        "\"]]"},
+    {3212, "epsg", 3212,
         "WGS 84 / SCAR IMW SQ41-42", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=66 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ41-42\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",66],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3212");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3213, "epsg", 3213,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=66 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ41-42\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",66],PARAMETE"
+        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3212"
+        "\"]]"},
+    {3213, "epsg", 3213,
         "WGS 84 / SCAR IMW SQ43-44", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=78 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ43-44\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",78],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3213");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3214, "epsg", 3214,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=78 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ43-44\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",78],PARAMETE"
+        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3213"
+        "\"]]"},
+    {3214, "epsg", 3214,
         "WGS 84 / SCAR IMW SQ45-46", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=90 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ45-46\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",90],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3214");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3215, "epsg", 3215,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=90 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ45-46\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",90],PARAMETE"
+        "R[\"standard_parallel_1\",-64.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-67.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3214"
+        "\"]]"},
+    {3215, "epsg", 3215,
         "WGS 84 / SCAR IMW SQ47-48", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=102 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ47-48\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",102],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321");
-    add_srs_wkt (p, 13,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3216, "epsg", 3216,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=102 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ47-48\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",102],PARAMET"
+        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321"
+        "5\"]]"},
+    {3216, "epsg", 3216,
         "WGS 84 / SCAR IMW SQ49-50", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=114 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ49-50\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",114],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321");
-    add_srs_wkt (p, 13,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3217, "epsg", 3217,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=114 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ49-50\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",114],PARAMET"
+        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321"
+        "6\"]]"},
+    {3217, "epsg", 3217,
         "WGS 84 / SCAR IMW SQ51-52", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=126 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ51-52\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",126],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321");
-    add_srs_wkt (p, 13,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3218, "epsg", 3218,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=126 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ51-52\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",126],PARAMET"
+        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321"
+        "7\"]]"},
+    {3218, "epsg", 3218,
         "WGS 84 / SCAR IMW SQ53-54", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=138 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ53-54\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",138],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321");
-    add_srs_wkt (p, 13,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3219, "epsg", 3219,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=138 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ53-54\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",138],PARAMET"
+        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321"
+        "8\"]]"},
+    {3219, "epsg", 3219,
         "WGS 84 / SCAR IMW SQ55-56", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=150 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ55-56\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",150],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321");
-    add_srs_wkt (p, 13,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3220, "epsg", 3220,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=150 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ55-56\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",150],PARAMET"
+        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"321"
+        "9\"]]"},
+    {3220, "epsg", 3220,
         "WGS 84 / SCAR IMW SQ57-58", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=162 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SQ57-58\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",162],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322");
-    add_srs_wkt (p, 13,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3221, "epsg", 3221,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-64.66666666666667 +lat_2=-67.333333333"
+        "33333 +lat_0=-90 +lon_0=162 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SQ57-58\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",162],PARAMET"
+        "ER[\"standard_parallel_1\",-64.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-67.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322"
+        "0\"]]"},
+    {3221, "epsg", 3221,
         "WGS 84 / SCAR IMW SR13-14", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-102 +x_0=0 +y_0=0 +datum=WGS84 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR13-14\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-102],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"standard_parallel_1\",-68.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "221\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3222, "epsg", 3222,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=-102 +x_0=0 +y_0=0 +datum=WGS84 "
+        "+units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR13-14\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-102],PARAME"
+        "TER[\"standard_parallel_1\",-68.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",-71.3333333333333],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "221\"]]"},
+    {3222, "epsg", 3222,
         "WGS 84 / SCAR IMW SR15-16", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-90 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR15-16\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-90],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322");
-    add_srs_wkt (p, 13,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3223, "epsg", 3223,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=-90 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR15-16\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-90],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322"
+        "2\"]]"},
+    {3223, "epsg", 3223,
         "WGS 84 / SCAR IMW SR17-18", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-78 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR17-18\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-78],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322");
-    add_srs_wkt (p, 13,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3224, "epsg", 3224,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=-78 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR17-18\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-78],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322"
+        "3\"]]"},
+    {3224, "epsg", 3224,
         "WGS 84 / SCAR IMW SR19-20", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-66 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR19-20\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-66],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322");
-    add_srs_wkt (p, 13,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3225, "epsg", 3225,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=-66 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR19-20\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-66],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322"
+        "4\"]]"},
+    {3225, "epsg", 3225,
         "WGS 84 / SCAR IMW SR27-28", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-18 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR27-28\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-18],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322");
-    add_srs_wkt (p, 13,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3226, "epsg", 3226,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=-18 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR27-28\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-18],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"322"
+        "5\"]]"},
+    {3226, "epsg", 3226,
         "WGS 84 / SCAR IMW SR29-30", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-6 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR29-30\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-6],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3226");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3227, "epsg", 3227,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=-6 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR29-30\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-6],PARAMETE"
+        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3226"
+        "\"]]"},
+    {3227, "epsg", 3227,
         "WGS 84 / SCAR IMW SR31-32", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=6 +x_0=0 +y_0=0 +datum=WGS84 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR31-32\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",6],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3227");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3228, "epsg", 3228,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=6 +x_0=0 +y_0=0 +datum=WGS84 +un"
+        "its=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR31-32\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",6],PARAMETER"
+        "[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3227"
+        "\"]]"},
+    {3228, "epsg", 3228,
         "WGS 84 / SCAR IMW SR33-34", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=18 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR33-34\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",18],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3228");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3229, "epsg", 3229,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=18 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR33-34\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",18],PARAMETE"
+        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3228"
+        "\"]]"},
+    {3229, "epsg", 3229,
         "WGS 84 / SCAR IMW SR35-36", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=30 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR35-36\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",30],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3229");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3230, "epsg", 3230,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=30 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR35-36\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",30],PARAMETE"
+        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3229"
+        "\"]]"},
+    {3230, "epsg", 3230,
         "WGS 84 / SCAR IMW SR37-38", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=42 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR37-38\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",42],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3230");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3231, "epsg", 3231,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=42 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR37-38\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",42],PARAMETE"
+        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3230"
+        "\"]]"},
+    {3231, "epsg", 3231,
         "WGS 84 / SCAR IMW SR39-40", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=54 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR39-40\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",54],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3231");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3232, "epsg", 3232,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=54 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR39-40\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",54],PARAMETE"
+        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3231"
+        "\"]]"},
+    {3232, "epsg", 3232,
         "WGS 84 / SCAR IMW SR41-42", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=66 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR41-42\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",66],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3232");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3233, "epsg", 3233,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=66 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR41-42\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",66],PARAMETE"
+        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3232"
+        "\"]]"},
+    {3233, "epsg", 3233,
         "WGS 84 / SCAR IMW SR43-44", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=78 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR43-44\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",78],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3233");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3234, "epsg", 3234,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=78 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR43-44\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",78],PARAMETE"
+        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3233"
+        "\"]]"},
+    {3234, "epsg", 3234,
         "WGS 84 / SCAR IMW SR45-46", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=90 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR45-46\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",90],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3234");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3235, "epsg", 3235,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=90 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR45-46\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",90],PARAMETE"
+        "R[\"standard_parallel_1\",-68.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-71.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3234"
+        "\"]]"},
+    {3235, "epsg", 3235,
         "WGS 84 / SCAR IMW SR47-48", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=102 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR47-48\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",102],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323");
-    add_srs_wkt (p, 13,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3236, "epsg", 3236,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=102 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR47-48\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",102],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323"
+        "5\"]]"},
+    {3236, "epsg", 3236,
         "WGS 84 / SCAR IMW SR49-50", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=114 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR49-50\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",114],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323");
-    add_srs_wkt (p, 13,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3237, "epsg", 3237,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=114 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR49-50\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",114],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323"
+        "6\"]]"},
+    {3237, "epsg", 3237,
         "WGS 84 / SCAR IMW SR51-52", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=126 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR51-52\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",126],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323");
-    add_srs_wkt (p, 13,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3238, "epsg", 3238,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=126 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR51-52\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",126],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323"
+        "7\"]]"},
+    {3238, "epsg", 3238,
         "WGS 84 / SCAR IMW SR53-54", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=138 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR53-54\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",138],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323");
-    add_srs_wkt (p, 13,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3239, "epsg", 3239,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=138 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR53-54\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",138],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323"
+        "8\"]]"},
+    {3239, "epsg", 3239,
         "WGS 84 / SCAR IMW SR55-56", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=150 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR55-56\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",150],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323");
-    add_srs_wkt (p, 13,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3240, "epsg", 3240,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=150 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR55-56\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",150],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"323"
+        "9\"]]"},
+    {3240, "epsg", 3240,
         "WGS 84 / SCAR IMW SR57-58", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=162 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR57-58\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",162],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324");
-    add_srs_wkt (p, 13,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3241, "epsg", 3241,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=162 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR57-58\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",162],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324"
+        "0\"]]"},
+    {3241, "epsg", 3241,
         "WGS 84 / SCAR IMW SR59-60", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=174 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SR59-60\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",174],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324");
-    add_srs_wkt (p, 13,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3242, "epsg", 3242,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-68.66666666666667 +lat_2=-71.333333333"
+        "33333 +lat_0=-90 +lon_0=174 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SR59-60\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",174],PARAMET"
+        "ER[\"standard_parallel_1\",-68.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-71.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324"
+        "1\"]]"},
+    {3242, "epsg", 3242,
         "WGS 84 / SCAR IMW SS04-06", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-153 +x_0=0 +y_0=0 +datum=WGS84 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS04-06\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-153],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"standard_parallel_1\",-72.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "242\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3243, "epsg", 3243,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=-153 +x_0=0 +y_0=0 +datum=WGS84 "
+        "+units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS04-06\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-153],PARAME"
+        "TER[\"standard_parallel_1\",-72.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",-75.3333333333333],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "242\"]]"},
+    {3243, "epsg", 3243,
         "WGS 84 / SCAR IMW SS07-09", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-135 +x_0=0 +y_0=0 +datum=WGS84 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS07-09\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-135],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"standard_parallel_1\",-72.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "243\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=-135 +x_0=0 +y_0=0 +datum=WGS84 "
+        "+units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS07-09\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-135],PARAME"
+        "TER[\"standard_parallel_1\",-72.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",-75.3333333333333],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "243\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_11 = {
+    epsg_defs_11, sizeof (epsg_defs_11) / sizeof (epsg_defs_11[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
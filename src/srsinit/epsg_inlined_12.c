@@ -53,3707 +53,2112 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_12 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3244, "epsg", 3244,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_12[] = {
+    {3244, "epsg", 3244,
         "WGS 84 / SCAR IMW SS10-12", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-117 +x_0=0 +y_0=0 +datum=WGS84 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS10-12\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-117],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"standard_parallel_1\",-72.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "244\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3245, "epsg", 3245,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=-117 +x_0=0 +y_0=0 +datum=WGS84 "
+        "+units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS10-12\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-117],PARAME"
+        "TER[\"standard_parallel_1\",-72.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",-75.3333333333333],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "244\"]]"},
+    {3245, "epsg", 3245,
         "WGS 84 / SCAR IMW SS13-15", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-99 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS13-15\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-99],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324");
-    add_srs_wkt (p, 13,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3246, "epsg", 3246,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=-99 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS13-15\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-99],PARAMET"
+        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324"
+        "5\"]]"},
+    {3246, "epsg", 3246,
         "WGS 84 / SCAR IMW SS16-18", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-81 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS16-18\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-81],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324");
-    add_srs_wkt (p, 13,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3247, "epsg", 3247,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=-81 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS16-18\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-81],PARAMET"
+        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324"
+        "6\"]]"},
+    {3247, "epsg", 3247,
         "WGS 84 / SCAR IMW SS19-21", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-63 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS19-21\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-63],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324");
-    add_srs_wkt (p, 13,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3248, "epsg", 3248,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=-63 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS19-21\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-63],PARAMET"
+        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324"
+        "7\"]]"},
+    {3248, "epsg", 3248,
         "WGS 84 / SCAR IMW SS25-27", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-27 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS25-27\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-27],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324");
-    add_srs_wkt (p, 13,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3249, "epsg", 3249,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=-27 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS25-27\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-27],PARAMET"
+        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"324"
+        "8\"]]"},
+    {3249, "epsg", 3249,
         "WGS 84 / SCAR IMW SS28-30", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-9 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS28-30\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-9],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3249");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3250, "epsg", 3250,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=-9 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS28-30\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-9],PARAMETE"
+        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3249"
+        "\"]]"},
+    {3250, "epsg", 3250,
         "WGS 84 / SCAR IMW SS31-33", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=9 +x_0=0 +y_0=0 +datum=WGS84 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS31-33\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",9],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3250");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3251, "epsg", 3251,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=9 +x_0=0 +y_0=0 +datum=WGS84 +un"
+        "its=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS31-33\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",9],PARAMETER"
+        "[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3250"
+        "\"]]"},
+    {3251, "epsg", 3251,
         "WGS 84 / SCAR IMW SS34-36", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=27 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS34-36\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",27],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3251");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3252, "epsg", 3252,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=27 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS34-36\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",27],PARAMETE"
+        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3251"
+        "\"]]"},
+    {3252, "epsg", 3252,
         "WGS 84 / SCAR IMW SS37-39", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=45 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS37-39\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",45],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3252");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3253, "epsg", 3253,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=45 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS37-39\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",45],PARAMETE"
+        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3252"
+        "\"]]"},
+    {3253, "epsg", 3253,
         "WGS 84 / SCAR IMW SS40-42", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=63 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS40-42\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",63],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3253");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3254, "epsg", 3254,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=63 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS40-42\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",63],PARAMETE"
+        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3253"
+        "\"]]"},
+    {3254, "epsg", 3254,
         "WGS 84 / SCAR IMW SS43-45", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=81 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS43-45\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",81],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3254");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3255, "epsg", 3255,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=81 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS43-45\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",81],PARAMETE"
+        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3254"
+        "\"]]"},
+    {3255, "epsg", 3255,
         "WGS 84 / SCAR IMW SS46-48", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=99 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS46-48\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",99],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3255");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3256, "epsg", 3256,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=99 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS46-48\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",99],PARAMETE"
+        "R[\"standard_parallel_1\",-72.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-75.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3255"
+        "\"]]"},
+    {3256, "epsg", 3256,
         "WGS 84 / SCAR IMW SS49-51", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=117 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS49-51\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",117],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"325");
-    add_srs_wkt (p, 13,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3257, "epsg", 3257,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=117 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS49-51\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",117],PARAMET"
+        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"325"
+        "6\"]]"},
+    {3257, "epsg", 3257,
         "WGS 84 / SCAR IMW SS52-54", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=135 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS52-54\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",135],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"325");
-    add_srs_wkt (p, 13,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3258, "epsg", 3258,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=135 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS52-54\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",135],PARAMET"
+        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"325"
+        "7\"]]"},
+    {3258, "epsg", 3258,
         "WGS 84 / SCAR IMW SS55-57", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=153 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS55-57\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",153],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"325");
-    add_srs_wkt (p, 13,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3259, "epsg", 3259,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=153 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS55-57\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",153],PARAMET"
+        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"325"
+        "8\"]]"},
+    {3259, "epsg", 3259,
         "WGS 84 / SCAR IMW SS58-60", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=171 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SS58-60\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",171],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"325");
-    add_srs_wkt (p, 13,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3260, "epsg", 3260,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-72.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-90 +lon_0=171 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SS58-60\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",171],PARAMET"
+        "ER[\"standard_parallel_1\",-72.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-75.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"325"
+        "9\"]]"},
+    {3260, "epsg", 3260,
         "WGS 84 / SCAR IMW ST01-04", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-168 +x_0=0 +y_0=0 +datum=WGS84 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST01-04\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-168],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"standard_parallel_1\",-76.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "260\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3261, "epsg", 3261,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=-168 +x_0=0 +y_0=0 +datum=WGS84 "
+        "+units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST01-04\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-168],PARAME"
+        "TER[\"standard_parallel_1\",-76.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",-79.3333333333333],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "260\"]]"},
+    {3261, "epsg", 3261,
         "WGS 84 / SCAR IMW ST05-08", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-144 +x_0=0 +y_0=0 +datum=WGS84 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST05-08\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-144],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"standard_parallel_1\",-76.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "261\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3262, "epsg", 3262,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=-144 +x_0=0 +y_0=0 +datum=WGS84 "
+        "+units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST05-08\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-144],PARAME"
+        "TER[\"standard_parallel_1\",-76.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",-79.3333333333333],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "261\"]]"},
+    {3262, "epsg", 3262,
         "WGS 84 / SCAR IMW ST09-12", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-120 +x_0=0 +y_0=0 +datum=WGS84 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST09-12\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-120],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"standard_parallel_1\",-76.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "262\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3263, "epsg", 3263,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=-120 +x_0=0 +y_0=0 +datum=WGS84 "
+        "+units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST09-12\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-120],PARAME"
+        "TER[\"standard_parallel_1\",-76.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",-79.3333333333333],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "262\"]]"},
+    {3263, "epsg", 3263,
         "WGS 84 / SCAR IMW ST13-16", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-96 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST13-16\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-96],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"326");
-    add_srs_wkt (p, 13,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3264, "epsg", 3264,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=-96 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST13-16\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-96],PARAMET"
+        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"326"
+        "3\"]]"},
+    {3264, "epsg", 3264,
         "WGS 84 / SCAR IMW ST17-20", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-72 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST17-20\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-72],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"326");
-    add_srs_wkt (p, 13,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3265, "epsg", 3265,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=-72 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST17-20\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-72],PARAMET"
+        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"326"
+        "4\"]]"},
+    {3265, "epsg", 3265,
         "WGS 84 / SCAR IMW ST21-24", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-48 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST21-24\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-48],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"326");
-    add_srs_wkt (p, 13,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3266, "epsg", 3266,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=-48 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST21-24\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-48],PARAMET"
+        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"326"
+        "5\"]]"},
+    {3266, "epsg", 3266,
         "WGS 84 / SCAR IMW ST25-28", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=-24 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST25-28\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-24],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"326");
-    add_srs_wkt (p, 13,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3267, "epsg", 3267,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=-24 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST25-28\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-24],PARAMET"
+        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"326"
+        "6\"]]"},
+    {3267, "epsg", 3267,
         "WGS 84 / SCAR IMW ST29-32", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=0 +x_0=0 +y_0=0 +datum=WGS84 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST29-32\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3267");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3268, "epsg", 3268,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=0 +x_0=0 +y_0=0 +datum=WGS84 +un"
+        "its=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST29-32\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",0],PARAMETER"
+        "[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3267"
+        "\"]]"},
+    {3268, "epsg", 3268,
         "WGS 84 / SCAR IMW ST33-36", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=24 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST33-36\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",24],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3268");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3269, "epsg", 3269,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=24 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST33-36\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",24],PARAMETE"
+        "R[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3268"
+        "\"]]"},
+    {3269, "epsg", 3269,
         "WGS 84 / SCAR IMW ST37-40", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=48 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST37-40\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",48],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3269");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3270, "epsg", 3270,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=48 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST37-40\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",48],PARAMETE"
+        "R[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3269"
+        "\"]]"},
+    {3270, "epsg", 3270,
         "WGS 84 / SCAR IMW ST41-44", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=72 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST41-44\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",72],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3270");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3271, "epsg", 3271,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=72 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST41-44\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",72],PARAMETE"
+        "R[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3270"
+        "\"]]"},
+    {3271, "epsg", 3271,
         "WGS 84 / SCAR IMW ST45-48", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=96 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST45-48\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",96],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3271");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3272, "epsg", 3272,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=96 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST45-48\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",96],PARAMETE"
+        "R[\"standard_parallel_1\",-76.6666666666667],PARAMETER[\""
+        "standard_parallel_2\",-79.3333333333333],PARAMETER[\"fal"
+        "se_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3271"
+        "\"]]"},
+    {3272, "epsg", 3272,
         "WGS 84 / SCAR IMW ST49-52", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=120 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST49-52\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",120],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"327");
-    add_srs_wkt (p, 13,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3273, "epsg", 3273,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=120 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST49-52\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",120],PARAMET"
+        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"327"
+        "2\"]]"},
+    {3273, "epsg", 3273,
         "WGS 84 / SCAR IMW ST53-56", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=144 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST53-56\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",144],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"327");
-    add_srs_wkt (p, 13,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3274, "epsg", 3274,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=144 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST53-56\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",144],PARAMET"
+        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"327"
+        "3\"]]"},
+    {3274, "epsg", 3274,
         "WGS 84 / SCAR IMW ST57-60", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=168 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW ST57-60\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",168],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"327");
-    add_srs_wkt (p, 13,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3275, "epsg", 3275,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=168 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW ST57-60\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",168],PARAMET"
+        "ER[\"standard_parallel_1\",-76.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",-79.3333333333333],PARAMETER[\"f"
+        "alse_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"327"
+        "4\"]]"},
+    {3275, "epsg", 3275,
         "WGS 84 / SCAR IMW SU01-05", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-165 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU01-05\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-165],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 9,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 10,
-        "IS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"3275\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3276, "epsg", 3276,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-165 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU01-05\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-165],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3275\"]]"},
+    {3276, "epsg", 3276,
         "WGS 84 / SCAR IMW SU06-10", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-135 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU06-10\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-135],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 9,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 10,
-        "IS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"3276\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3277, "epsg", 3277,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-135 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU06-10\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-135],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3276\"]]"},
+    {3277, "epsg", 3277,
         "WGS 84 / SCAR IMW SU11-15", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-105 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU11-15\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-105],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 9,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 10,
-        "IS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"3277\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3278, "epsg", 3278,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-105 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU11-15\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-105],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3277\"]]"},
+    {3278, "epsg", 3278,
         "WGS 84 / SCAR IMW SU16-20", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-75 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU16-20\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-75],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3278\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3279, "epsg", 3279,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-75 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU16-20\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-75],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3278\"]]"},
+    {3279, "epsg", 3279,
         "WGS 84 / SCAR IMW SU21-25", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-45 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU21-25\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-45],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3279\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3280, "epsg", 3280,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-45 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU21-25\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-45],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3279\"]]"},
+    {3280, "epsg", 3280,
         "WGS 84 / SCAR IMW SU26-30", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-15 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU26-30\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-15],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3280\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3281, "epsg", 3281,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-15 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU26-30\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-15],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3280\"]]"},
+    {3281, "epsg", 3281,
         "WGS 84 / SCAR IMW SU31-35", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=15 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU31-35\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",15],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"3281\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3282, "epsg", 3282,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=15 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU31-35\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",15],PA"
+        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3281\"]]"},
+    {3282, "epsg", 3282,
         "WGS 84 / SCAR IMW SU36-40", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=45 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU36-40\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",45],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"3282\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3283, "epsg", 3283,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=45 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU36-40\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",45],PA"
+        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3282\"]]"},
+    {3283, "epsg", 3283,
         "WGS 84 / SCAR IMW SU41-45", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=75 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU41-45\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",75],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"3283\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3284, "epsg", 3284,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=75 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU41-45\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",75],PA"
+        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3283\"]]"},
+    {3284, "epsg", 3284,
         "WGS 84 / SCAR IMW SU46-50", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=105 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU46-50\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",105],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3284\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3285, "epsg", 3285,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=105 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU46-50\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",105],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3284\"]]"},
+    {3285, "epsg", 3285,
         "WGS 84 / SCAR IMW SU51-55", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=135 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU51-55\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",135],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3285\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3286, "epsg", 3286,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=135 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU51-55\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",135],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3285\"]]"},
+    {3286, "epsg", 3286,
         "WGS 84 / SCAR IMW SU56-60", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=165 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SU56-60\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",165],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3286\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3287, "epsg", 3287,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=165 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SU56-60\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",165],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3286\"]]"},
+    {3287, "epsg", 3287,
         "WGS 84 / SCAR IMW SV01-10", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-150 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SV01-10\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-150],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 9,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 10,
-        "IS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"3287\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3288, "epsg", 3288,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-150 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SV01-10\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-150],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3287\"]]"},
+    {3288, "epsg", 3288,
         "WGS 84 / SCAR IMW SV11-20", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-90 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SV11-20\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-90],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3288\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3289, "epsg", 3289,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-90 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SV11-20\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-90],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3288\"]]"},
+    {3289, "epsg", 3289,
         "WGS 84 / SCAR IMW SV21-30", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=-30 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SV21-30\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",-30],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3289\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3290, "epsg", 3290,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=-30 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SV21-30\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",-30],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3289\"]]"},
+    {3290, "epsg", 3290,
         "WGS 84 / SCAR IMW SV31-40", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=30 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SV31-40\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",30],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"3290\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3291, "epsg", 3291,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=30 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SV31-40\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",30],PA"
+        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3290\"]]"},
+    {3291, "epsg", 3291,
         "WGS 84 / SCAR IMW SV41-50", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=90 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SV41-50\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",90],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"3291\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3292, "epsg", 3292,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=90 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SV41-50\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",90],PA"
+        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3291\"]]"},
+    {3292, "epsg", 3292,
         "WGS 84 / SCAR IMW SV51-60", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=150 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SV51-60\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",150],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"3292\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3293, "epsg", 3293,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=150 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SV51-60\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",150],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3292\"]]"},
+    {3293, "epsg", 3293,
         "WGS 84 / SCAR IMW SW01-60", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0");
-    add_proj4text (p, 1,
-        "=0 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / SCAR IMW SW01-60\",GEOGCS[\"WGS 84\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223");
-    add_srs_wkt (p, 2,
-        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "-80.2386111111111],PARAMETER[\"central_meridian\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"3293\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3294, "epsg", 3294,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-80.23861111111111 +lon_0"
+        "=0 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / SCAR IMW SW01-60\",GEOGCS[\"WGS 84\",D"
+        "ATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223"
+        "563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6"
+        "326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\""
+        "Polar_Stereographic\"],PARAMETER[\"latitude_of_origin\","
+        "-80.2386111111111],PARAMETER[\"central_meridian\",0],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3293\"]]"},
+    {3294, "epsg", 3294,
         "WGS 84 / USGS Transantarctic Mountains", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-78 +lon_0=162 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / USGS Transantarctic Mountains\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781");
-    add_srs_wkt (p, 2,
-        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-78],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",162],PARAMETER[\"standard_parallel_1\",-76.666666666666");
-    add_srs_wkt (p, 9,
-        "7],PARAMETER[\"standard_parallel_2\",-79.3333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"3294\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3295, "epsg", 3295,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-78 +lon_0=162 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / USGS Transantarctic Mountains\",GEOGCS"
+        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781"
+        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY"
+        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]]"
+        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",-78],PARAMETER[\"central_meridian\""
+        ",162],PARAMETER[\"standard_parallel_1\",-76.666666666666"
+        "7],PARAMETER[\"standard_parallel_2\",-79.3333333333333],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3294\"]]"},
+    {3295, "epsg", 3295,
         "Guam 1963 / Yap Islands", 0, 0,
         "Clarke 1866", "Greenwich",
         "Guam_1963", "Azimuthal_Equidistant", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aeqd +lat_0=9.54670833333333 +lon_0=138.1687444444");
-    add_proj4text (p, 1,
-        "44 +x_0=40000 +y_0=60000 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Guam 1963 / Yap Islands\",GEOGCS[\"Guam 1963\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Guam_1963\",SPHEROID[\"Clarke 1866\",6378206.4,2");
-    add_srs_wkt (p, 2,
-        "94.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6675\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4675\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Azimuthal_Equidistant\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 7,
-        "de_of_center\",9.54670833333333],PARAMETER[\"longitude_o");
-    add_srs_wkt (p, 8,
-        "f_center\",138.168744444444],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",40000],PARAMETER[\"false_northing\",60000],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3295\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3296, "epsg", 3296,
+        "Easting", "East", "Northing", "North",
+        "+proj=aeqd +lat_0=9.54670833333333 +lon_0=138.1687444444"
+        "44 +x_0=40000 +y_0=60000 +ellps=clrk66 +units=m +no_defs",
+        "PROJCS[\"Guam 1963 / Yap Islands\",GEOGCS[\"Guam 1963\","
+        "DATUM[\"Guam_1963\",SPHEROID[\"Clarke 1866\",6378206.4,2"
+        "94.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY["
+        "\"EPSG\",\"6675\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4675\"]],"
+        "PROJECTION[\"Azimuthal_Equidistant\"],PARAMETER[\"latitu"
+        "de_of_center\",9.54670833333333],PARAMETER[\"longitude_o"
+        "f_center\",138.168744444444],PARAMETER[\"false_easting\""
+        ",40000],PARAMETER[\"false_northing\",60000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3295\"]]"},
+    {3296, "epsg", 3296,
         "RGPF / UTM zone 5S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_Polynesie_Francaise", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=5 +south +ellps=GRS80 +towgs84=0.072,-0.");
-    add_proj4text (p, 1,
-        "507,-0.245,-0.0183,0.0003,-0.007,-0.0093 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGPF / UTM zone 5S\",GEOGCS[\"RGPF\",DATUM[\"Re");
-    add_srs_wkt (p, 1,
-        "seau_Geodesique_de_la_Polynesie_Francaise\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6687\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4687\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-153],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3296\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3297, "epsg", 3297,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=5 +south +ellps=GRS80 +towgs84=0.072,-0."
+        "507,-0.245,-0.0183,0.0003,-0.007,-0.0093 +units=m +no_de"
+        "fs",
+        "PROJCS[\"RGPF / UTM zone 5S\",GEOGCS[\"RGPF\",DATUM[\"Re"
+        "seau_Geodesique_de_la_Polynesie_Francaise\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6687\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4687\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-153],PARAMETER[\"scale_factor\",0.9996],PARAMETE"
+        "R[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3296\"]]"},
+    {3297, "epsg", 3297,
         "RGPF / UTM zone 6S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_Polynesie_Francaise", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=6 +south +ellps=GRS80 +towgs84=0.072,-0.");
-    add_proj4text (p, 1,
-        "507,-0.245,-0.0183,0.0003,-0.007,-0.0093 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGPF / UTM zone 6S\",GEOGCS[\"RGPF\",DATUM[\"Re");
-    add_srs_wkt (p, 1,
-        "seau_Geodesique_de_la_Polynesie_Francaise\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6687\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4687\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-147],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3297\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3298, "epsg", 3298,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=6 +south +ellps=GRS80 +towgs84=0.072,-0."
+        "507,-0.245,-0.0183,0.0003,-0.007,-0.0093 +units=m +no_de"
+        "fs",
+        "PROJCS[\"RGPF / UTM zone 6S\",GEOGCS[\"RGPF\",DATUM[\"Re"
+        "seau_Geodesique_de_la_Polynesie_Francaise\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6687\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4687\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-147],PARAMETER[\"scale_factor\",0.9996],PARAMETE"
+        "R[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3297\"]]"},
+    {3298, "epsg", 3298,
         "RGPF / UTM zone 7S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_Polynesie_Francaise", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +south +ellps=GRS80 +towgs84=0.072,-0.");
-    add_proj4text (p, 1,
-        "507,-0.245,-0.0183,0.0003,-0.007,-0.0093 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGPF / UTM zone 7S\",GEOGCS[\"RGPF\",DATUM[\"Re");
-    add_srs_wkt (p, 1,
-        "seau_Geodesique_de_la_Polynesie_Francaise\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6687\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4687\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-141],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3298\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3299, "epsg", 3299,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=7 +south +ellps=GRS80 +towgs84=0.072,-0."
+        "507,-0.245,-0.0183,0.0003,-0.007,-0.0093 +units=m +no_de"
+        "fs",
+        "PROJCS[\"RGPF / UTM zone 7S\",GEOGCS[\"RGPF\",DATUM[\"Re"
+        "seau_Geodesique_de_la_Polynesie_Francaise\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6687\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4687\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-141],PARAMETER[\"scale_factor\",0.9996],PARAMETE"
+        "R[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3298\"]]"},
+    {3299, "epsg", 3299,
         "RGPF / UTM zone 8S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_Polynesie_Francaise", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=8 +south +ellps=GRS80 +towgs84=0.072,-0.");
-    add_proj4text (p, 1,
-        "507,-0.245,-0.0183,0.0003,-0.007,-0.0093 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGPF / UTM zone 8S\",GEOGCS[\"RGPF\",DATUM[\"Re");
-    add_srs_wkt (p, 1,
-        "seau_Geodesique_de_la_Polynesie_Francaise\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6687\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4687\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-135],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3299\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3300, "epsg", 3300,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=8 +south +ellps=GRS80 +towgs84=0.072,-0."
+        "507,-0.245,-0.0183,0.0003,-0.007,-0.0093 +units=m +no_de"
+        "fs",
+        "PROJCS[\"RGPF / UTM zone 8S\",GEOGCS[\"RGPF\",DATUM[\"Re"
+        "seau_Geodesique_de_la_Polynesie_Francaise\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6687\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4687\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-135],PARAMETER[\"scale_factor\",0.9996],PARAMETE"
+        "R[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3299\"]]"},
+    {3300, "epsg", 3300,
         "Estonian Coordinate System of 1992", 0, 1,
         "GRS 1980", "Greenwich",
         "Estonia_1992", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=59.33333333333334 +lat_2=58 +lat_0=57.5");
-    add_proj4text (p, 1,
-        "1755393055556 +lon_0=24 +x_0=500000 +y_0=6375000 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0.055,-0.541,-0.185,0.0183,-0.0003,-0.007");
-    add_proj4text (p, 3,
-        ",-0.014 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Estonian Coordinate System of 1992\",GEOGCS[\"E");
-    add_srs_wkt (p, 1,
-        "ST92\",DATUM[\"Estonia_1992\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6133\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4133\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",57.5175539305556],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",24],PARAMETER[\"standard_parallel_1\",59.3");
-    add_srs_wkt (p, 9,
-        "333333333333],PARAMETER[\"standard_parallel_2\",58],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",6375000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"3300\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3301, "epsg", 3301,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=59.33333333333334 +lat_2=58 +lat_0=57.5"
+        "1755393055556 +lon_0=24 +x_0=500000 +y_0=6375000 +ellps="
+        "GRS80 +towgs84=0.055,-0.541,-0.185,0.0183,-0.0003,-0.007"
+        ",-0.014 +units=m +no_defs",
+        "PROJCS[\"Estonian Coordinate System of 1992\",GEOGCS[\"E"
+        "ST92\",DATUM[\"Estonia_1992\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6133\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4133\"]]"
+        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",57.5175539305556],PARAMETER[\"centr"
+        "al_meridian\",24],PARAMETER[\"standard_parallel_1\",59.3"
+        "333333333333],PARAMETER[\"standard_parallel_2\",58],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",6375000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT"
+        "HORITY[\"EPSG\",\"3300\"]]"},
+    {3301, "epsg", 3301,
         "Estonian Coordinate System of 1997", 0, 1,
         "GRS 1980", "Greenwich",
         "Estonia_1997", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=59.33333333333334 +lat_2=58 +lat_0=57.5");
-    add_proj4text (p, 1,
-        "1755393055556 +lon_0=24 +x_0=500000 +y_0=6375000 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Estonian Coordinate System of 1997\",GEOGCS[\"E");
-    add_srs_wkt (p, 1,
-        "ST97\",DATUM[\"Estonia_1997\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6180\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4180\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",57.5175539305556],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",24],PARAMETER[\"standard_parallel_1\",59.3");
-    add_srs_wkt (p, 9,
-        "333333333333],PARAMETER[\"standard_parallel_2\",58],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",6375000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"3301\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3302, "epsg", 3302,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=59.33333333333334 +lat_2=58 +lat_0=57.5"
+        "1755393055556 +lon_0=24 +x_0=500000 +y_0=6375000 +ellps="
+        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Estonian Coordinate System of 1997\",GEOGCS[\"E"
+        "ST97\",DATUM[\"Estonia_1997\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6180\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4180\"]]"
+        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",57.5175539305556],PARAMETER[\"centr"
+        "al_meridian\",24],PARAMETER[\"standard_parallel_1\",59.3"
+        "333333333333],PARAMETER[\"standard_parallel_2\",58],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",6375000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT"
+        "HORITY[\"EPSG\",\"3301\"]]"},
+    {3302, "epsg", 3302,
         "IGN63 Hiva Oa / UTM zone 7S", 0, 0,
         "International 1924", "Greenwich",
         "IGN63_Hiva_Oa", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +south +ellps=intl +towgs84=410.721,55");
-    add_proj4text (p, 1,
-        ".049,80.746,2.5779,2.3514,0.6664,17.3311 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN63 Hiva Oa / UTM zone 7S\",GEOGCS[\"IGN63 Hi");
-    add_srs_wkt (p, 1,
-        "va Oa\",DATUM[\"IGN63_Hiva_Oa\",SPHEROID[\"International");
-    add_srs_wkt (p, 2,
-        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6689\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4689\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-141],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",500000],PARAMETER[\"false_northing\",10000000],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3302\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3303, "epsg", 3303,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=7 +south +ellps=intl +towgs84=410.721,55"
+        ".049,80.746,2.5779,2.3514,0.6664,17.3311 +units=m +no_de"
+        "fs",
+        "PROJCS[\"IGN63 Hiva Oa / UTM zone 7S\",GEOGCS[\"IGN63 Hi"
+        "va Oa\",DATUM[\"IGN63_Hiva_Oa\",SPHEROID[\"International"
+        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6689\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4689\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-141],"
+        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",10000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3302\"]]"},
+    {3303, "epsg", 3303,
         "Fatu Iva 72 / UTM zone 7S", 0, 0,
         "International 1924", "Greenwich",
         "Fatu_Iva_72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +south +ellps=intl +towgs84=347.103,10");
-    add_proj4text (p, 1,
-        "78.125,2623.922,-33.8875,70.6773,-9.3943,186.074 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fatu Iva 72 / UTM zone 7S\",GEOGCS[\"Fatu Iva 7");
-    add_srs_wkt (p, 1,
-        "2\",DATUM[\"Fatu_Iva_72\",SPHEROID[\"International 1924\"");
-    add_srs_wkt (p, 2,
-        ",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6688\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4688\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",-141],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"m");
-    add_srs_wkt (p, 10,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 11,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3303");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3304, "epsg", 3304,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=7 +south +ellps=intl +towgs84=347.103,10"
+        "78.125,2623.922,-33.8875,70.6773,-9.3943,186.074 +units="
+        "m +no_defs",
+        "PROJCS[\"Fatu Iva 72 / UTM zone 7S\",GEOGCS[\"Fatu Iva 7"
+        "2\",DATUM[\"Fatu_Iva_72\",SPHEROID[\"International 1924\""
+        ",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"E"
+        "PSG\",\"6688\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4688\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",-141],PARAME"
+        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3303"
+        "\"]]"},
+    {3304, "epsg", 3304,
         "Tahiti 79 / UTM zone 6S", 0, 0,
         "International 1924", "Greenwich",
         "Tahiti_79", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=6 +south +ellps=intl +towgs84=221.525,15");
-    add_proj4text (p, 1,
-        "2.948,176.768,-2.3847,-1.3896,-0.877,11.4741 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tahiti 79 / UTM zone 6S\",GEOGCS[\"Tahiti 79\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Tahiti_79\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6690\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4690\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-147],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3304\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3305, "epsg", 3305,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=6 +south +ellps=intl +towgs84=221.525,15"
+        "2.948,176.768,-2.3847,-1.3896,-0.877,11.4741 +units=m +n"
+        "o_defs",
+        "PROJCS[\"Tahiti 79 / UTM zone 6S\",GEOGCS[\"Tahiti 79\","
+        "DATUM[\"Tahiti_79\",SPHEROID[\"International 1924\",6378"
+        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6690\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4690\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-147],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3304\"]]"},
+    {3305, "epsg", 3305,
         "Moorea 87 / UTM zone 6S", 0, 0,
         "International 1924", "Greenwich",
         "Moorea_87", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=6 +south +ellps=intl +towgs84=215.525,14");
-    add_proj4text (p, 1,
-        "9.593,176.229,-3.2624,-1.692,-1.1571,10.4773 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Moorea 87 / UTM zone 6S\",GEOGCS[\"Moorea 87\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Moorea_87\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6691\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4691\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-147],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3305\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3306, "epsg", 3306,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=6 +south +ellps=intl +towgs84=215.525,14"
+        "9.593,176.229,-3.2624,-1.692,-1.1571,10.4773 +units=m +n"
+        "o_defs",
+        "PROJCS[\"Moorea 87 / UTM zone 6S\",GEOGCS[\"Moorea 87\","
+        "DATUM[\"Moorea_87\",SPHEROID[\"International 1924\",6378"
+        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6691\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4691\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-147],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3305\"]]"},
+    {3306, "epsg", 3306,
         "Maupiti 83 / UTM zone 5S", 0, 0,
         "International 1924", "Greenwich",
         "Maupiti_83", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=5 +south +ellps=intl +towgs84=217.037,86");
-    add_proj4text (p, 1,
-        ".959,23.956,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Maupiti 83 / UTM zone 5S\",GEOGCS[\"Maupiti 83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Maupiti_83\",SPHEROID[\"International 1924\",63");
-    add_srs_wkt (p, 2,
-        "78388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6692\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4692\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",-153],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3306\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3307, "epsg", 3307,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=5 +south +ellps=intl +towgs84=217.037,86"
+        ".959,23.956,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Maupiti 83 / UTM zone 5S\",GEOGCS[\"Maupiti 83\""
+        ",DATUM[\"Maupiti_83\",SPHEROID[\"International 1924\",63"
+        "78388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG"
+        "\",\"6692\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4692\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",-153],PARAMETER"
+        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3306\"]"
+        "]"},
+    {3307, "epsg", 3307,
         "Nakhl-e Ghanem / UTM zone 39N", 0, 0,
         "WGS 84", "Greenwich",
         "Nakhl-e_Ghanem", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=WGS84 +towgs84=0,-0.15,0.68,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nakhl-e Ghanem / UTM zone 39N\",GEOGCS[\"Nakhl-");
-    add_srs_wkt (p, 1,
-        "e Ghanem\",DATUM[\"Nakhl-e_Ghanem\",SPHEROID[\"WGS 84\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6693\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"469");
-    add_srs_wkt (p, 6,
-        "3\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",51]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 10,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 11,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3307");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3308, "epsg", 3308,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=39 +ellps=WGS84 +towgs84=0,-0.15,0.68,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Nakhl-e Ghanem / UTM zone 39N\",GEOGCS[\"Nakhl-"
+        "e Ghanem\",DATUM[\"Nakhl-e_Ghanem\",SPHEROID[\"WGS 84\","
+        "6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTH"
+        "ORITY[\"EPSG\",\"6693\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"469"
+        "3\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",0],PARAMETER[\"central_meridian\",51]"
+        ",PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_ea"
+        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3307"
+        "\"]]"},
+    {3308, "epsg", 3308,
         "GDA94 / NSW Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "Geocentric_Datum_of_Australia_1994", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-30.75 +lat_2=-35.75 +lat_0=-33.25 +lon");
-    add_proj4text (p, 1,
-        "_0=147 +x_0=9300000 +y_0=4500000 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDA94 / NSW Lambert\",GEOGCS[\"GDA94\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Geocentric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4283\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",-33.25],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",147],PARAMETER[\"standard_parallel_1\",-30.");
-    add_srs_wkt (p, 9,
-        "75],PARAMETER[\"standard_parallel_2\",-35.75],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",9300000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "4500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"3308\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3309, "epsg", 3309,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-30.75 +lat_2=-35.75 +lat_0=-33.25 +lon"
+        "_0=147 +x_0=9300000 +y_0=4500000 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"GDA94 / NSW Lambert\",GEOGCS[\"GDA94\",DATUM[\""
+        "Geocentric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4283\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",-33.25],PARAMETER[\"centra"
+        "l_meridian\",147],PARAMETER[\"standard_parallel_1\",-30."
+        "75],PARAMETER[\"standard_parallel_2\",-35.75],PARAMETER["
+        "\"false_easting\",9300000],PARAMETER[\"false_northing\","
+        "4500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3308\"]]"},
+    {3309, "epsg", 3309,
         "NAD27 / California Albers", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=-4000000 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / California Albers\",GEOGCS[\"NAD27\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866");
-    add_srs_wkt (p, 2,
-        "\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4267\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_center\",0],PARAMETER[\"longitude_of");
-    add_srs_wkt (p, 8,
-        "_center\",-120],PARAMETER[\"standard_parallel_1\",34],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_2\",40.5],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",0],PARAMETER[\"false_northing\",-4000000],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 12,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3309\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3310, "epsg", 3310,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_"
+        "0=0 +y_0=-4000000 +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / California Albers\",GEOGCS[\"NAD27\",DA"
+        "TUM[\"North_American_Datum_1927\",SPHEROID[\"Clarke 1866"
+        "\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\""
+        "]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4267\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARA"
+        "METER[\"latitude_of_center\",0],PARAMETER[\"longitude_of"
+        "_center\",-120],PARAMETER[\"standard_parallel_1\",34],PA"
+        "RAMETER[\"standard_parallel_2\",40.5],PARAMETER[\"false_"
+        "easting\",0],PARAMETER[\"false_northing\",-4000000],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3309\"]]"},
+    {3310, "epsg", 3310,
         "NAD83 / California Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=-4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / California Albers\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[");
-    add_srs_wkt (p, 7,
-        "\"latitude_of_center\",0],PARAMETER[\"longitude_of_cente");
-    add_srs_wkt (p, 8,
-        "r\",-120],PARAMETER[\"standard_parallel_1\",34],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_2\",40.5],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",0],PARAMETER[\"false_northing\",-4000000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3310\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3311, "epsg", 3311,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_"
+        "0=0 +y_0=-4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83 / California Albers\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER["
+        "\"latitude_of_center\",0],PARAMETER[\"longitude_of_cente"
+        "r\",-120],PARAMETER[\"standard_parallel_1\",34],PARAMETE"
+        "R[\"standard_parallel_2\",40.5],PARAMETER[\"false_eastin"
+        "g\",0],PARAMETER[\"false_northing\",-4000000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3310\""
+        "]]"},
+    {3311, "epsg", 3311,
         "NAD83(HARN) / California Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=-4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / California Albers\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Albers_Conic_Equ");
-    add_srs_wkt (p, 7,
-        "al_Area\"],PARAMETER[\"latitude_of_center\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"longitude_of_center\",-120],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",34],PARAMETER[\"standard_parallel_2\",40.5],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",-4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"3311\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3312, "epsg", 3312,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_"
+        "0=0 +y_0=-4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / California Albers\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Albers_Conic_Equ"
+        "al_Area\"],PARAMETER[\"latitude_of_center\",0],PARAMETER"
+        "[\"longitude_of_center\",-120],PARAMETER[\"standard_para"
+        "llel_1\",34],PARAMETER[\"standard_parallel_2\",40.5],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",-4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3311\"]]"},
+    {3312, "epsg", 3312,
         "CSG67 / UTM zone 21N", 0, 0,
         "International 1924", "Greenwich",
         "Centre_Spatial_Guyanais_1967", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=intl +towgs84=-186,230,110,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CSG67 / UTM zone 21N\",GEOGCS[\"CSG67\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Centre_Spatial_Guyanais_1967\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6623\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4623\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-57],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_east");
-    add_srs_wkt (p, 9,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3312\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3313, "epsg", 3313,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +ellps=intl +towgs84=-186,230,110,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"CSG67 / UTM zone 21N\",GEOGCS[\"CSG67\",DATUM[\""
+        "Centre_Spatial_Guyanais_1967\",SPHEROID[\"International "
+        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI"
+        "TY[\"EPSG\",\"6623\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4623\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-57],P"
+        "ARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_east"
+        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3312\""
+        "]]"},
+    {3313, "epsg", 3313,
         "RGFG95 / UTM zone 21N", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_Guyane_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGFG95 / UTM zone 21N\",GEOGCS[\"RGFG95\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Reseau_Geodesique_Francais_Guyane_1995\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6624\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4624\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3313\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3314, "epsg", 3314,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"RGFG95 / UTM zone 21N\",GEOGCS[\"RGFG95\",DATUM"
+        "[\"Reseau_Geodesique_Francais_Guyane_1995\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6624\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4624\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER"
+        "[\"false_easting\",500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3313\"]]"},
+    {3314, "epsg", 3314,
         "Katanga 1955 / Katanga Lambert (deprecated)", 0, 0,
         "Clarke 1866", "Greenwich",
         "Katanga_1955", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-6.5 +lat_2=-11.5 +lat_0=0 +lon_0=26 +x");
-    add_proj4text (p, 1,
-        "_0=0 +y_0=0 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.");
-    add_proj4text (p, 2,
-        "95,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Katanga 1955 / Katanga Lambert (deprecated)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4695\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",9],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",26],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",-6.5],PARAMETER[\"standard_parallel_2\",-11.5],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"3985\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3315, "epsg", 3315,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-6.5 +lat_2=-11.5 +lat_0=0 +lon_0=26 +x"
+        "_0=0 +y_0=0 +ellps=clrk66 +towgs84=-103.746,-9.614,-255."
+        "95,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Katanga 1955 / Katanga Lambert (deprecated)\",G"
+        "EOGCS[\"Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\""
+        "Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPS"
+        "G\",\"7008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4695\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",9],PARAMETE"
+        "R[\"central_meridian\",26],PARAMETER[\"standard_parallel"
+        "_1\",-6.5],PARAMETER[\"standard_parallel_2\",-11.5],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3985\"]]"},
+    {3315, "epsg", 3315,
         "Katanga 1955 / Katanga TM (deprecated)", 0, 0,
         "Clarke 1866", "Greenwich",
         "Katanga_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-9 +lon_0=26 +k=0.9998 +x_0=0 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,0,0 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Katanga 1955 / Katanga TM (deprecated)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"latitude_of_origin\",-9],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",26],PARAMETER[\"scale_factor\",0.9998],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",0],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3315\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3316, "epsg", 3316,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-9 +lon_0=26 +k=0.9998 +x_0=0 +y_0=0 "
+        "+ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Katanga 1955 / Katanga TM (deprecated)\",GEOGCS"
+        "[\"Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clar"
+        "ke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\","
+        "\"7008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"]"
+        ",PARAMETER[\"latitude_of_origin\",-9],PARAMETER[\"centra"
+        "l_meridian\",26],PARAMETER[\"scale_factor\",0.9998],PARA"
+        "METER[\"false_easting\",0],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3315\"]]"},
+    {3316, "epsg", 3316,
         "Kasai 1953 / Congo TM zone 22", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Kasai_1953", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Kasai 1953 / Congo TM zone 22\",GEOGCS[\"Kasai ");
-    add_srs_wkt (p, 1,
-        "1953\",DATUM[\"Kasai_1953\",SPHEROID[\"Clarke 1880 (RGS)");
-    add_srs_wkt (p, 2,
-        "\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6696\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "96\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",22");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",10000000],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3316\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3317, "epsg", 3317,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=22 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"Kasai 1953 / Congo TM zone 22\",GEOGCS[\"Kasai "
+        "1953\",DATUM[\"Kasai_1953\",SPHEROID[\"Clarke 1880 (RGS)"
+        "\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUT"
+        "HORITY[\"EPSG\",\"6696\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "96\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",22"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",10000000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3316\"]]"},
+    {3317, "epsg", 3317,
         "Kasai 1953 / Congo TM zone 24", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Kasai_1953", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Kasai 1953 / Congo TM zone 24\",GEOGCS[\"Kasai ");
-    add_srs_wkt (p, 1,
-        "1953\",DATUM[\"Kasai_1953\",SPHEROID[\"Clarke 1880 (RGS)");
-    add_srs_wkt (p, 2,
-        "\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6696\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "96\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",24");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",10000000],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3317\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3318, "epsg", 3318,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"Kasai 1953 / Congo TM zone 24\",GEOGCS[\"Kasai "
+        "1953\",DATUM[\"Kasai_1953\",SPHEROID[\"Clarke 1880 (RGS)"
+        "\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUT"
+        "HORITY[\"EPSG\",\"6696\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "96\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",24"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",10000000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3317\"]]"},
+    {3318, "epsg", 3318,
         "IGC 1962 / Congo TM zone 12", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 12\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",12],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3318\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3319, "epsg", 3319,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 12\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",12],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3318\"]]"},
+    {3319, "epsg", 3319,
         "IGC 1962 / Congo TM zone 14", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=14 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 14\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",14],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3319\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3320, "epsg", 3320,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=14 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 14\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",14],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3319\"]]"},
+    {3320, "epsg", 3320,
         "IGC 1962 / Congo TM zone 16", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 16\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",16],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3320\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3321, "epsg", 3321,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=16 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 16\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",16],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3320\"]]"},
+    {3321, "epsg", 3321,
         "IGC 1962 / Congo TM zone 18", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 18\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",18],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3321\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3322, "epsg", 3322,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 18\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",18],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3321\"]]"},
+    {3322, "epsg", 3322,
         "IGC 1962 / Congo TM zone 20", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 20\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",20],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3322\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3323, "epsg", 3323,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=20 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 20\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",20],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3322\"]]"},
+    {3323, "epsg", 3323,
         "IGC 1962 / Congo TM zone 22", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 22\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",22],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3323\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3324, "epsg", 3324,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=22 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 22\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",22],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3323\"]]"},
+    {3324, "epsg", 3324,
         "IGC 1962 / Congo TM zone 24", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 24\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",24],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3324\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3325, "epsg", 3325,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 24\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",24],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3324\"]]"},
+    {3325, "epsg", 3325,
         "IGC 1962 / Congo TM zone 26", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=26 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 26\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",26],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3325\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3326, "epsg", 3326,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=26 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 26\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",26],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3325\"]]"},
+    {3326, "epsg", 3326,
         "IGC 1962 / Congo TM zone 28", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 28\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",28],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3326\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3327, "epsg", 3327,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=28 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 28\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",28],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3326\"]]"},
+    {3327, "epsg", 3327,
         "IGC 1962 / Congo TM zone 30", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGC_1962_Arc_of_the_6th_Parallel_South", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGC 1962 / Congo TM zone 30\",GEOGCS[\"IGC 1962");
-    add_srs_wkt (p, 1,
-        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa");
-    add_srs_wkt (p, 2,
-        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 3,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",0],PARAMETER[\"central_meridian\",30],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3327\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3328, "epsg", 3328,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGC 1962 / Congo TM zone 30\",GEOGCS[\"IGC 1962"
+        " 6th Parallel South\",DATUM[\"IGC_1962_Arc_of_the_6th_Pa"
+        "rallel_South\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6697\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4697\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",30],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",10000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3327\"]]"},
+    {3328, "epsg", 3328,
         "Pulkovo 1942(58) / GUGiK-80", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Oblique_Stereographic", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=52.16666666666666 +lon_0=19.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999714 +x_0=500000 +y_0=500000 +ellps=krass ");
-    add_proj4text (p, 2,
-        "+towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.844,-0.84 +un");
-    add_proj4text (p, 3,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / GUGiK-80\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID[\"Krassows");
-    add_srs_wkt (p, 2,
-        "ky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "179\"]],PROJECTION[\"Oblique_Stereographic\"],PARAMETER[");
-    add_srs_wkt (p, 7,
-        "\"latitude_of_origin\",52.1666666666667],PARAMETER[\"cen");
-    add_srs_wkt (p, 8,
-        "tral_meridian\",19.1666666666667],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 9,
-        "or\",0.999714],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",500000],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 11,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"E");
-    add_srs_wkt (p, 12,
-        "asting\",EAST],AUTHORITY[\"EPSG\",\"3328\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3329, "epsg", 3329,
+        "Northing", "North", "Easting", "East",
+        "+proj=sterea +lat_0=52.16666666666666 +lon_0=19.16666666"
+        "666667 +k=0.999714 +x_0=500000 +y_0=500000 +ellps=krass "
+        "+towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.844,-0.84 +un"
+        "its=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / GUGiK-80\",GEOGCS[\"Pulkovo "
+        "1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID[\"Krassows"
+        "ky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AU"
+        "THORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "179\"]],PROJECTION[\"Oblique_Stereographic\"],PARAMETER["
+        "\"latitude_of_origin\",52.1666666666667],PARAMETER[\"cen"
+        "tral_meridian\",19.1666666666667],PARAMETER[\"scale_fact"
+        "or\",0.999714],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",500000],UNIT[\"metre\",1,AUTHORI"
+        "TY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"E"
+        "asting\",EAST],AUTHORITY[\"EPSG\",\"3328\"]]"},
+    {3329, "epsg", 3329,
         "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 5", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 5");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",15],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",5500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"3329\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3330, "epsg", 3330,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 5"
+        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",15],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",5500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"3329\"]]"},
+    {3330, "epsg", 3330,
         "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 6", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 6");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",18],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",6500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"3330\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3331, "epsg", 3331,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 6"
+        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",18],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",6500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"3330\"]]"},
+    {3331, "epsg", 3331,
         "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 7", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=7500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 7");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",21],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",7500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"3331\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3332, "epsg", 3332,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=7500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 7"
+        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",21],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",7500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"3331\"]]"},
+    {3332, "epsg", 3332,
         "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 8", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=8500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 8");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",24],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",8500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"3332\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3333, "epsg", 3333,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=8500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 8"
+        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",24],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",8500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"3332\"]]"},
+    {3333, "epsg", 3333,
         "Pulkovo 1942(58) / Gauss-Kruger zone 3", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=3500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / Gauss-Kruger zone 3\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4179\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",3500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3333\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3334, "epsg", 3334,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=3500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / Gauss-Kruger zone 3\",GEOGCS"
+        "[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID"
+        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\""
+        "7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4179\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",3500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3333\"]]"},
+    {3334, "epsg", 3334,
         "Pulkovo 1942(58) / Gauss-Kruger zone 4", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / Gauss-Kruger zone 4\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4179\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",4500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3334\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3335, "epsg", 3335,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=4500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / Gauss-Kruger zone 4\",GEOGCS"
+        "[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID"
+        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\""
+        "7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4179\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",4500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3334\"]]"},
+    {3335, "epsg", 3335,
         "Pulkovo 1942(58) / Gauss-Kruger zone 5", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / Gauss-Kruger zone 5\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4179\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",5500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3335\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3336, "epsg", 3336,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=5500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / Gauss-Kruger zone 5\",GEOGCS"
+        "[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID"
+        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\""
+        "7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4179\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",5500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3335\"]]"},
+    {3336, "epsg", 3336,
         "IGN 1962 Kerguelen / UTM zone 42S", 0, 0,
         "International 1924", "Greenwich",
         "IGN_1962_Kerguelen", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=42 +south +ellps=intl +towgs84=145,-187,");
-    add_proj4text (p, 1,
-        "103,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN 1962 Kerguelen / UTM zone 42S\",GEOGCS[\"IG");
-    add_srs_wkt (p, 1,
-        "N 1962 Kerguelen\",DATUM[\"IGN_1962_Kerguelen\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7022\"]],AUTHORITY[\"EPSG\",\"6698\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4698\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",69],PARAMETER[\"scale_factor\",0.9996],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3336\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3337, "epsg", 3337,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=42 +south +ellps=intl +towgs84=145,-187,"
+        "103,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGN 1962 Kerguelen / UTM zone 42S\",GEOGCS[\"IG"
+        "N 1962 Kerguelen\",DATUM[\"IGN_1962_Kerguelen\",SPHEROID"
+        "[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\""
+        "7022\"]],AUTHORITY[\"EPSG\",\"6698\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4698\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",69],PARAMETER[\"scale_factor\",0.9996],PARAMETE"
+        "R[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3336\"]]"},
+    {3337, "epsg", 3337,
         "Le Pouce 1934 / Mauritius Grid", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Le_Pouce_1934", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-20.19506944444445 +lat_0=-20.195069444");
-    add_proj4text (p, 1,
-        "44445 +lon_0=57.52182777777778 +k_0=1 +x_0=1000000 +y_0=");
-    add_proj4text (p, 2,
-        "1000000 +ellps=clrk80 +towgs84=-770.1,158.4,-498.2,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Le Pouce 1934 / Mauritius Grid\",GEOGCS[\"Le Po");
-    add_srs_wkt (p, 1,
-        "uce 1934\",DATUM[\"Le_Pouce_1934\",SPHEROID[\"Clarke 188");
-    add_srs_wkt (p, 2,
-        "0 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6699\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4699\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",-20.1950694444444],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",57.5218277777778],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",1],PARAMETER[\"false_easting\",1000000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3337\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3338, "epsg", 3338,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-20.19506944444445 +lat_0=-20.195069444"
+        "44445 +lon_0=57.52182777777778 +k_0=1 +x_0=1000000 +y_0="
+        "1000000 +ellps=clrk80 +towgs84=-770.1,158.4,-498.2,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Le Pouce 1934 / Mauritius Grid\",GEOGCS[\"Le Po"
+        "uce 1934\",DATUM[\"Le_Pouce_1934\",SPHEROID[\"Clarke 188"
+        "0 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\""
+        "]],AUTHORITY[\"EPSG\",\"6699\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4699\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],"
+        "PARAMETER[\"latitude_of_origin\",-20.1950694444444],PARA"
+        "METER[\"central_meridian\",57.5218277777778],PARAMETER[\""
+        "scale_factor\",1],PARAMETER[\"false_easting\",1000000],P"
+        "ARAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3337\"]]"},
+    {3338, "epsg", 3338,
         "NAD83 / Alaska Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0");
-    add_proj4text (p, 1,
-        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Alaska Albers\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_center\",50],PARAMETER[\"longitude_of_center\",");
-    add_srs_wkt (p, 8,
-        "-154],PARAMETER[\"standard_parallel_1\",55],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",65],PARAMETER[\"false_easting\",0]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 11,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 12,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"3338\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3339, "epsg", 3339,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0"
+        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"NAD83 / Alaska Albers\",GEOGCS[\"NAD83\",DATUM["
+        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]]"
+        ",PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"lat"
+        "itude_of_center\",50],PARAMETER[\"longitude_of_center\","
+        "-154],PARAMETER[\"standard_parallel_1\",55],PARAMETER[\""
+        "standard_parallel_2\",65],PARAMETER[\"false_easting\",0]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"3338\"]]"},
+    {3339, "epsg", 3339,
         "IGCB 1955 / Congo TM zone 12", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Institut_Geographique_du_Congo_Belge_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +towgs84=-79.9,-158,-168.9,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGCB 1955 / Congo TM zone 12\",GEOGCS[\"IGCB 19");
-    add_srs_wkt (p, 1,
-        "55\",DATUM[\"Institut_Geographique_du_Congo_Belge_1955\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6701\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4701\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",12],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3339\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3340, "epsg", 3340,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +towgs84=-79.9,-158,-168.9,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"IGCB 1955 / Congo TM zone 12\",GEOGCS[\"IGCB 19"
+        "55\",DATUM[\"Institut_Geographique_du_Congo_Belge_1955\""
+        ",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTH"
+        "ORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6701\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4701\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA"
+        "METER[\"central_meridian\",12],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3339\"]]"},
+    {3340, "epsg", 3340,
         "IGCB 1955 / Congo TM zone 14", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Institut_Geographique_du_Congo_Belge_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=14 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +towgs84=-79.9,-158,-168.9,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGCB 1955 / Congo TM zone 14\",GEOGCS[\"IGCB 19");
-    add_srs_wkt (p, 1,
-        "55\",DATUM[\"Institut_Geographique_du_Congo_Belge_1955\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6701\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4701\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",14],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3340\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3341, "epsg", 3341,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=14 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +towgs84=-79.9,-158,-168.9,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"IGCB 1955 / Congo TM zone 14\",GEOGCS[\"IGCB 19"
+        "55\",DATUM[\"Institut_Geographique_du_Congo_Belge_1955\""
+        ",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTH"
+        "ORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6701\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4701\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA"
+        "METER[\"central_meridian\",14],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3340\"]]"},
+    {3341, "epsg", 3341,
         "IGCB 1955 / Congo TM zone 16", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Institut_Geographique_du_Congo_Belge_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +towgs84=-79.9,-158,-168.9,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGCB 1955 / Congo TM zone 16\",GEOGCS[\"IGCB 19");
-    add_srs_wkt (p, 1,
-        "55\",DATUM[\"Institut_Geographique_du_Congo_Belge_1955\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6701\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4701\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",16],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3341\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3342, "epsg", 3342,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=16 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +towgs84=-79.9,-158,-168.9,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"IGCB 1955 / Congo TM zone 16\",GEOGCS[\"IGCB 19"
+        "55\",DATUM[\"Institut_Geographique_du_Congo_Belge_1955\""
+        ",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTH"
+        "ORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6701\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4701\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA"
+        "METER[\"central_meridian\",16],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3341\"]]"},
+    {3342, "epsg", 3342,
         "IGCB 1955 / UTM zone 33S", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Institut_Geographique_du_Congo_Belge_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +south +ellps=clrk80 +towgs84=-79.9,-");
-    add_proj4text (p, 1,
-        "158,-168.9,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGCB 1955 / UTM zone 33S\",GEOGCS[\"IGCB 1955\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Institut_Geographique_du_Congo_Belge_1955\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6701\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4701\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",15],PARAMETER[\"scale_factor\",0.");
-    add_srs_wkt (p, 9,
-        "9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3342\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3343, "epsg", 3343,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +south +ellps=clrk80 +towgs84=-79.9,-"
+        "158,-168.9,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"IGCB 1955 / UTM zone 33S\",GEOGCS[\"IGCB 1955\""
+        ",DATUM[\"Institut_Geographique_du_Congo_Belge_1955\",SPH"
+        "EROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORIT"
+        "Y[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6701\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4701\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",15],PARAMETER[\"scale_factor\",0."
+        "9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"fa"
+        "lse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3342\"]]"},
+    {3343, "epsg", 3343,
         "Mauritania 1999 / UTM zone 28N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mauritania_1999", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mauritania 1999 / UTM zone 28N\",GEOGCS[\"Mauri");
-    add_srs_wkt (p, 1,
-        "tania 1999\",DATUM[\"Mauritania_1999\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6702\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4702\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3343\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3344, "epsg", 3344,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mauritania 1999 / UTM zone 28N\",GEOGCS[\"Mauri"
+        "tania 1999\",DATUM[\"Mauritania_1999\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6702\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4702\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3343\"]]"},
+    {3344, "epsg", 3344,
         "Mauritania 1999 / UTM zone 29N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mauritania_1999", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mauritania 1999 / UTM zone 29N\",GEOGCS[\"Mauri");
-    add_srs_wkt (p, 1,
-        "tania 1999\",DATUM[\"Mauritania_1999\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6702\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4702\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 10,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 11,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3344\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=29 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mauritania 1999 / UTM zone 29N\",GEOGCS[\"Mauri"
+        "tania 1999\",DATUM[\"Mauritania_1999\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6702\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4702\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3344\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_12 = {
+    epsg_defs_12, sizeof (epsg_defs_12) / sizeof (epsg_defs_12[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3779 +53,2148 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_13 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3345, "epsg", 3345,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_13[] = {
+    {3345, "epsg", 3345,
         "Mauritania 1999 / UTM zone 30N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mauritania_1999", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mauritania 1999 / UTM zone 30N\",GEOGCS[\"Mauri");
-    add_srs_wkt (p, 1,
-        "tania 1999\",DATUM[\"Mauritania_1999\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6702\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4702\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 10,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 11,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3345\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3346, "epsg", 3346,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=30 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mauritania 1999 / UTM zone 30N\",GEOGCS[\"Mauri"
+        "tania 1999\",DATUM[\"Mauritania_1999\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6702\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4702\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3345\"]]"},
+    {3346, "epsg", 3346,
         "LKS94 / Lithuania TM", 0, 1,
         "GRS 1980", "Greenwich",
         "Lithuania_1994_ETRS89", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9998 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"LKS94 / Lithuania TM\",GEOGCS[\"LKS94\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Lithuania_1994_ETRS89\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 2,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6126\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4669\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",24],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9998],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3346\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3347, "epsg", 3347,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9998 +x_0=500000 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def"
+        "s",
+        "PROJCS[\"LKS94 / Lithuania TM\",GEOGCS[\"LKS94\",DATUM[\""
+        "Lithuania_1994_ETRS89\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6126\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4669\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",24],PARAMETER["
+        "\"scale_factor\",0.9998],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI"
+        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3346\"]]"},
+    {3347, "epsg", 3347,
         "NAD83 / Statistics Canada Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=77 +lat_0=63.390675 +lon_0=-9");
-    add_proj4text (p, 1,
-        "1.86666666666666 +x_0=6200000 +y_0=3000000 +ellps=GRS80 ");
-    add_proj4text (p, 2,
-        "+towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Statistics Canada Lambert\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",63.390675],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-91.8666666666667],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",49],PARAMETER[\"standard_parallel_2\",77");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",6200000],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",3000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"3347\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3348, "epsg", 3348,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=77 +lat_0=63.390675 +lon_0=-9"
+        "1.86666666666666 +x_0=6200000 +y_0=3000000 +ellps=GRS80 "
+        "+towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Statistics Canada Lambert\",GEOGCS[\"NA"
+        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",63.390675],PARAMETER[\""
+        "central_meridian\",-91.8666666666667],PARAMETER[\"standa"
+        "rd_parallel_1\",49],PARAMETER[\"standard_parallel_2\",77"
+        "],PARAMETER[\"false_easting\",6200000],PARAMETER[\"false"
+        "_northing\",3000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3347\"]]"},
+    {3348, "epsg", 3348,
         "NAD83(CSRS) / Statistics Canada Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=77 +lat_0=63.390675 +lon_0=-9");
-    add_proj4text (p, 1,
-        "1.86666666666666 +x_0=6200000 +y_0=3000000 +ellps=GRS80 ");
-    add_proj4text (p, 2,
-        "+towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Statistics Canada Lambert\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",63.390675],PARAMETER[\"central_meridian\",-91.866666");
-    add_srs_wkt (p, 9,
-        "6666667],PARAMETER[\"standard_parallel_1\",49],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",77],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",6200000],PARAMETER[\"false_northing\",3000000],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3348");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3349, "epsg", 3349,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=77 +lat_0=63.390675 +lon_0=-9"
+        "1.86666666666666 +x_0=6200000 +y_0=3000000 +ellps=GRS80 "
+        "+towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Statistics Canada Lambert\",GEOGC"
+        "S[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Referen"
+        "ce_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",63.390675],PARAMETER[\"central_meridian\",-91.866666"
+        "6666667],PARAMETER[\"standard_parallel_1\",49],PARAMETER"
+        "[\"standard_parallel_2\",77],PARAMETER[\"false_easting\""
+        ",6200000],PARAMETER[\"false_northing\",3000000],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3348"
+        "\"]]"},
+    {3349, "epsg", 3349,
         "WGS 84 / PDC Mercator", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=-150 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / PDC Mercator\",GEOGCS[\"WGS 84\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Merc");
-    add_srs_wkt (p, 6,
-        "ator_1SP\"],PARAMETER[\"central_meridian\",150],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 9,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 10,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3832\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3350, "epsg", 3350,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=-150 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +"
+        "units=m +no_defs",
+        "PROJCS[\"WGS 84 / PDC Mercator\",GEOGCS[\"WGS 84\",DATUM"
+        "[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,"
+        "AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Merc"
+        "ator_1SP\"],PARAMETER[\"central_meridian\",150],PARAMETE"
+        "R[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3832\"]]"},
+    {3350, "epsg", 3350,
         "Pulkovo 1942 / CS63 zone C0", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1 +lon_0=21.95 +k=1 +x_0=250000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.8");
-    add_proj4text (p, 2,
-        "2,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone C0\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.1],PARAMETER[\"central_meridian\",21.95]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",250000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3350\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3351, "epsg", 3351,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1 +lon_0=21.95 +k=1 +x_0=250000 +y_"
+        "0=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.8"
+        "2,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone C0\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.1],PARAMETER[\"central_meridian\",21.95]"
+        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting"
+        "\",250000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3350\"]]"},
+    {3351, "epsg", 3351,
         "Pulkovo 1942 / CS63 zone C1", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1 +lon_0=24.95 +k=1 +x_0=1250000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.");
-    add_proj4text (p, 2,
-        "82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone C1\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.1],PARAMETER[\"central_meridian\",24.95]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",1250000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 11,
-        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3351\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3352, "epsg", 3352,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1 +lon_0=24.95 +k=1 +x_0=1250000 +y"
+        "_0=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0."
+        "82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone C1\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.1],PARAMETER[\"central_meridian\",24.95]"
+        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting"
+        "\",1250000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR"
+        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3351\"]]"},
+    {3352, "epsg", 3352,
         "Pulkovo 1942 / CS63 zone C2", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0.1 +lon_0=27.95 +k=1 +x_0=2250000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.");
-    add_proj4text (p, 2,
-        "82,-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / CS63 zone C2\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940");
-    add_srs_wkt (p, 2,
-        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0.1],PARAMETER[\"central_meridian\",27.95]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",2250000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 11,
-        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3352\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3353, "epsg", 3353,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0.1 +lon_0=27.95 +k=1 +x_0=2250000 +y"
+        "_0=0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0."
+        "82,-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / CS63 zone C2\",GEOGCS[\"Pulkovo "
+        "1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassowsky 1940"
+        "\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY"
+        "[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4284\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0.1],PARAMETER[\"central_meridian\",27.95]"
+        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting"
+        "\",2250000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR"
+        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3352\"]]"},
+    {3353, "epsg", 3353,
         "Mhast (onshore) / UTM zone 32S", 0, 0,
         "International 1924", "Greenwich",
         "Mhast_onshore", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +south +ellps=intl +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mhast (onshore) / UTM zone 32S\",GEOGCS[\"Mhast");
-    add_srs_wkt (p, 1,
-        " (onshore)\",DATUM[\"Mhast_onshore\",SPHEROID[\"Internat");
-    add_srs_wkt (p, 2,
-        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6704\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4704\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",10000000],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3353\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3354, "epsg", 3354,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +south +ellps=intl +units=m +no_defs",
+        "PROJCS[\"Mhast (onshore) / UTM zone 32S\",GEOGCS[\"Mhast"
+        " (onshore)\",DATUM[\"Mhast_onshore\",SPHEROID[\"Internat"
+        "ional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],A"
+        "UTHORITY[\"EPSG\",\"6704\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4704\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9"
+        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",10000000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3353\"]]"},
+    {3354, "epsg", 3354,
         "Mhast (offshore) / UTM zone 32S", 0, 0,
         "International 1924", "Greenwich",
         "Mhast_offshore", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +south +ellps=intl +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mhast (offshore) / UTM zone 32S\",GEOGCS[\"Mhas");
-    add_srs_wkt (p, 1,
-        "t (offshore)\",DATUM[\"Mhast_offshore\",SPHEROID[\"Inter");
-    add_srs_wkt (p, 2,
-        "national 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6705\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4705\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",100000");
-    add_srs_wkt (p, 10,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"3354\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3355, "epsg", 3355,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +south +ellps=intl +units=m +no_defs",
+        "PROJCS[\"Mhast (offshore) / UTM zone 32S\",GEOGCS[\"Mhas"
+        "t (offshore)\",DATUM[\"Mhast_offshore\",SPHEROID[\"Inter"
+        "national 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]"
+        "],AUTHORITY[\"EPSG\",\"6705\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4705\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",100000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3354\"]]"},
+    {3355, "epsg", 3355,
         "Egypt Gulf of Suez S-650 TL / Red Belt", 0, 0,
         "Helmert 1906", "Greenwich",
         "Egypt_Gulf_of_Suez_S-650_TL", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=31 +k=1 +x_0=615000 +y_0=81");
-    add_proj4text (p, 1,
-        "0000 +ellps=helmert +towgs84=-146.21,112.63,4.05,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt Gulf of Suez S-650 TL / Red Belt\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Egypt Gulf of Suez S-650 TL\",DATUM[\"Egypt_Gulf_of_S");
-    add_srs_wkt (p, 2,
-        "uez_S-650_TL\",SPHEROID[\"Helmert 1906\",6378200,298.3,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"6706\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4706\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",31],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",1],PARAMETER[\"false_easting\",615000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",810000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3355\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3356, "epsg", 3356,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=31 +k=1 +x_0=615000 +y_0=81"
+        "0000 +ellps=helmert +towgs84=-146.21,112.63,4.05,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"Egypt Gulf of Suez S-650 TL / Red Belt\",GEOGCS"
+        "[\"Egypt Gulf of Suez S-650 TL\",DATUM[\"Egypt_Gulf_of_S"
+        "uez_S-650_TL\",SPHEROID[\"Helmert 1906\",6378200,298.3,A"
+        "UTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"6706\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4706\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],"
+        "PARAMETER[\"central_meridian\",31],PARAMETER[\"scale_fac"
+        "tor\",1],PARAMETER[\"false_easting\",615000],PARAMETER[\""
+        "false_northing\",810000],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3355\"]]"},
+    {3356, "epsg", 3356,
         "Grand Cayman National Grid 1959", 0, 0,
         "Clarke 1866", "Greenwich",
         "Grand_Cayman_Geodetic_Datum_1959", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=clrk66 +towgs84=-179.483,-69.3");
-    add_proj4text (p, 1,
-        "79,-27.584,-7.862,8.163,6.042,-13.925 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Grand Cayman National Grid 1959\",GEOGCS[\"GCGD");
-    add_srs_wkt (p, 1,
-        "59\",DATUM[\"Grand_Cayman_Geodetic_Datum_1959\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6723\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4723\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-81],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",1640419.9475],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 11,
-        "G\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AUTHORITY[\"EPSG\",\"6128\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3357, "epsg", 3357,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=clrk66 +towgs84=-179.483,-69.3"
+        "79,-27.584,-7.862,8.163,6.042,-13.925 +units=m +no_defs",
+        "PROJCS[\"Grand Cayman National Grid 1959\",GEOGCS[\"GCGD"
+        "59\",DATUM[\"Grand_Cayman_Geodetic_Datum_1959\",SPHEROID"
+        "[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\""
+        "EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6723\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4723\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-81],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",1640419.9475],PARAMETER[\""
+        "false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPS"
+        "G\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"6128\"]]"},
+    {3357, "epsg", 3357,
         "Sister Islands National Grid 1961", 0, 0,
         "Clarke 1866", "Greenwich",
         "Sister_Islands_Geodetic_Datum_1961", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=clrk66 +towgs84=8.853,-52.644,");
-    add_proj4text (p, 1,
-        "180.304,-0.393,-2.323,2.96,-24.081 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Sister Islands National Grid 1961\",GEOGCS[\"SI");
-    add_srs_wkt (p, 1,
-        "GD61\",DATUM[\"Sister_Islands_Geodetic_Datum_1961\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6726\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4726\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-81],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",1640419.9475],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6129\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3358, "epsg", 3358,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=clrk66 +towgs84=8.853,-52.644,"
+        "180.304,-0.393,-2.323,2.96,-24.081 +units=m +no_defs",
+        "PROJCS[\"Sister Islands National Grid 1961\",GEOGCS[\"SI"
+        "GD61\",DATUM[\"Sister_Islands_Geodetic_Datum_1961\",SPHE"
+        "ROID[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORIT"
+        "Y[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6726\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4726\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-81],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",1640419.9475],PARAMET"
+        "ER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY["
+        "\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6129\"]]"},
+    {3358, "epsg", 3358,
         "NAD83(HARN) / North Carolina", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.22 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / North Carolina\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33.75],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-79],PARAMETER[\"standard_");
-    add_srs_wkt (p, 9,
-        "parallel_1\",36.1666666666667],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",34.3333333333333],PARAMETER[\"false_easting\",6");
-    add_srs_wkt (p, 11,
-        "09601.22],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3358\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3359, "epsg", 3359,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333"
+        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.22 +y_0=0 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / North Carolina\",GEOGCS[\"NAD83(H"
+        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33.75],P"
+        "ARAMETER[\"central_meridian\",-79],PARAMETER[\"standard_"
+        "parallel_1\",36.1666666666667],PARAMETER[\"standard_para"
+        "llel_2\",34.3333333333333],PARAMETER[\"false_easting\",6"
+        "09601.22],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3358\"]]"},
+    {3359, "epsg", 3359,
         "NAD83(HARN) / North Carolina (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024385 +y_0=");
-    add_proj4text (p, 2,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / North Carolina (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33");
-    add_srs_wkt (p, 8,
-        ".75],PARAMETER[\"central_meridian\",-79],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",36.1666666666667],PARAMETER[\"standar");
-    add_srs_wkt (p, 10,
-        "d_parallel_2\",34.3333333333333],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",2000000],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"3404\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3360, "epsg", 3360,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333"
+        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024385 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / North Carolina (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33"
+        ".75],PARAMETER[\"central_meridian\",-79],PARAMETER[\"sta"
+        "ndard_parallel_1\",36.1666666666667],PARAMETER[\"standar"
+        "d_parallel_2\",34.3333333333333],PARAMETER[\"false_easti"
+        "ng\",2000000],PARAMETER[\"false_northing\",0],UNIT[\"US "
+        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900"
+        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3404\"]]"},
+    {3360, "epsg", 3360,
         "NAD83(HARN) / South Carolina", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / South Carolina\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",31.83333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-81],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",34.8333333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",32.5],PARAMETER[\"false_easting\",60");
-    add_srs_wkt (p, 11,
-        "9600],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3360\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3361, "epsg", 3361,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31"
+        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / South Carolina\",GEOGCS[\"NAD83(H"
+        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",31.83333"
+        "33333333],PARAMETER[\"central_meridian\",-81],PARAMETER["
+        "\"standard_parallel_1\",34.8333333333333],PARAMETER[\"st"
+        "andard_parallel_2\",32.5],PARAMETER[\"false_easting\",60"
+        "9600],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3360\"]]"},
+    {3361, "epsg", 3361,
         "NAD83(HARN) / South Carolina (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / South Carolina (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",31.");
-    add_srs_wkt (p, 8,
-        "8333333333333],PARAMETER[\"central_meridian\",-81],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",34.8333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",32.5],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",2000000],PARAMETER[\"false_northing\",0],UNIT[\"foot\"");
-    add_srs_wkt (p, 12,
-        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3361\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3362, "epsg", 3362,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31"
+        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / South Carolina (ft)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",31."
+        "8333333333333],PARAMETER[\"central_meridian\",-81],PARAM"
+        "ETER[\"standard_parallel_1\",34.8333333333333],PARAMETER"
+        "[\"standard_parallel_2\",32.5],PARAMETER[\"false_easting"
+        "\",2000000],PARAMETER[\"false_northing\",0],UNIT[\"foot\""
+        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3361\""
+        "]]"},
+    {3362, "epsg", 3362,
         "NAD83(HARN) / Pennsylvania North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Pennsylvania North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.1");
-    add_srs_wkt (p, 8,
-        "666666666667],PARAMETER[\"central_meridian\",-77.75],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",41.95],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",40.8833333333333],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",600000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 12,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3362\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3363, "epsg", 3363,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4"
+        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Pennsylvania North\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.1"
+        "666666666667],PARAMETER[\"central_meridian\",-77.75],PAR"
+        "AMETER[\"standard_parallel_1\",41.95],PARAMETER[\"standa"
+        "rd_parallel_2\",40.8833333333333],PARAMETER[\"false_east"
+        "ing\",600000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3362\""
+        "]]"},
+    {3363, "epsg", 3363,
         "NAD83(HARN) / Pennsylvania North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Pennsylvania North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_");
-    add_srs_wkt (p, 2,
-        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",40.1666666666667],PARAMETER[\"central_meridian\",-77.");
-    add_srs_wkt (p, 9,
-        "75],PARAMETER[\"standard_parallel_1\",41.95],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",40.8833333333333],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",1968500],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3363\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3364, "epsg", 3364,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4"
+        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Pennsylvania North (ftUS)\",GEOGC"
+        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_"
+        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",40.1666666666667],PARAMETER[\"central_meridian\",-77."
+        "75],PARAMETER[\"standard_parallel_1\",41.95],PARAMETER[\""
+        "standard_parallel_2\",40.8833333333333],PARAMETER[\"fals"
+        "e_easting\",1968500],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3363\"]]"},
+    {3364, "epsg", 3364,
         "NAD83(HARN) / Pennsylvania South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Pennsylvania South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39.3");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-77.75],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",40.9666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",39.9333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",600000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3364\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3365, "epsg", 3365,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333"
+        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(HARN) / Pennsylvania South\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39.3"
+        "333333333333],PARAMETER[\"central_meridian\",-77.75],PAR"
+        "AMETER[\"standard_parallel_1\",40.9666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",39.9333333333333],PARAMETER[\""
+        "false_easting\",600000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3364\"]]"},
+    {3365, "epsg", 3365,
         "NAD83(HARN) / Pennsylvania South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Pennsylvania South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_");
-    add_srs_wkt (p, 2,
-        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",39.3333333333333],PARAMETER[\"central_meridian\",-77.");
-    add_srs_wkt (p, 9,
-        "75],PARAMETER[\"standard_parallel_1\",40.9666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",39.9333333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",1968500],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 14,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3365\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3366, "epsg", 3366,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333"
+        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(HARN) / Pennsylvania South (ftUS)\",GEOGC"
+        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_"
+        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",39.3333333333333],PARAMETER[\"central_meridian\",-77."
+        "75],PARAMETER[\"standard_parallel_1\",40.9666666666667],"
+        "PARAMETER[\"standard_parallel_2\",39.9333333333333],PARA"
+        "METER[\"false_easting\",1968500],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHO"
+        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3365\"]]"},
+    {3366, "epsg", 3366,
         "Hong Kong 1963 Grid System", 0, 1,
         "Clarke 1858", "Greenwich",
         "Hong_Kong_1963", "Cassini_Soldner", "Clarke's foot",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=22.31213333333334 +lon_0=114.178555555");
-    add_proj4text (p, 1,
-        "5556 +x_0=40243.57775604237 +y_0=19069.93351512578 +a=63");
-    add_proj4text (p, 2,
-        "78293.645208759 +b=6356617.987679838 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hong Kong 1963 Grid System\",GEOGCS[\"Hong Kong");
-    add_srs_wkt (p, 1,
-        " 1963\",DATUM[\"Hong_Kong_1963\",SPHEROID[\"Clarke 1858\"");
-    add_srs_wkt (p, 2,
-        ",6378293.64520876,294.260676369261,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7007\"]],AUTHORITY[\"EPSG\",\"6738\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4738\"]],PROJECTION[\"Cassini_Soldner\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",22.3121333333333],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",114.178555555556],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",132033.92],PARAMETER[\"false_northing\",62565.9");
-    add_srs_wkt (p, 10,
-        "6],UNIT[\"Clarke's foot\",0.3047972654,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9005\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AUTHORITY[\"EPSG\",\"3407\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3367, "epsg", 3367,
+        "Northing", "North", "Easting", "East",
+        "+proj=cass +lat_0=22.31213333333334 +lon_0=114.178555555"
+        "5556 +x_0=40243.57775604237 +y_0=19069.93351512578 +a=63"
+        "78293.645208759 +b=6356617.987679838 +units=m +no_defs",
+        "PROJCS[\"Hong Kong 1963 Grid System\",GEOGCS[\"Hong Kong"
+        " 1963\",DATUM[\"Hong_Kong_1963\",SPHEROID[\"Clarke 1858\""
+        ",6378293.64520876,294.260676369261,AUTHORITY[\"EPSG\",\""
+        "7007\"]],AUTHORITY[\"EPSG\",\"6738\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4738\"]],PROJECTION[\"Cassini_Soldner\"],PARAME"
+        "TER[\"latitude_of_origin\",22.3121333333333],PARAMETER[\""
+        "central_meridian\",114.178555555556],PARAMETER[\"false_e"
+        "asting\",132033.92],PARAMETER[\"false_northing\",62565.9"
+        "6],UNIT[\"Clarke's foot\",0.3047972654,AUTHORITY[\"EPSG\""
+        ",\"9005\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"3407\"]]"},
+    {3367, "epsg", 3367,
         "IGN Astro 1960 / UTM zone 28N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGN_Astro_1960", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN Astro 1960 / UTM zone 28N\",GEOGCS[\"IGN As");
-    add_srs_wkt (p, 1,
-        "tro 1960\",DATUM[\"IGN_Astro_1960\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 2,
-        "80 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6700\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4700\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3367\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3368, "epsg", 3368,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGN Astro 1960 / UTM zone 28N\",GEOGCS[\"IGN As"
+        "tro 1960\",DATUM[\"IGN_Astro_1960\",SPHEROID[\"Clarke 18"
+        "80 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012"
+        "\"]],AUTHORITY[\"EPSG\",\"6700\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4700\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER["
+        "\"false_easting\",500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3367\"]]"},
+    {3368, "epsg", 3368,
         "IGN Astro 1960 / UTM zone 29N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGN_Astro_1960", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN Astro 1960 / UTM zone 29N\",GEOGCS[\"IGN As");
-    add_srs_wkt (p, 1,
-        "tro 1960\",DATUM[\"IGN_Astro_1960\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 2,
-        "80 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6700\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4700\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3368\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3369, "epsg", 3369,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=29 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGN Astro 1960 / UTM zone 29N\",GEOGCS[\"IGN As"
+        "tro 1960\",DATUM[\"IGN_Astro_1960\",SPHEROID[\"Clarke 18"
+        "80 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012"
+        "\"]],AUTHORITY[\"EPSG\",\"6700\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4700\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",-9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3368\"]]"},
+    {3369, "epsg", 3369,
         "IGN Astro 1960 / UTM zone 30N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "IGN_Astro_1960", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=clrk80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGN Astro 1960 / UTM zone 30N\",GEOGCS[\"IGN As");
-    add_srs_wkt (p, 1,
-        "tro 1960\",DATUM[\"IGN_Astro_1960\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 2,
-        "80 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6700\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4700\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3369\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3370, "epsg", 3370,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=30 +ellps=clrk80 +units=m +no_defs",
+        "PROJCS[\"IGN Astro 1960 / UTM zone 30N\",GEOGCS[\"IGN As"
+        "tro 1960\",DATUM[\"IGN_Astro_1960\",SPHEROID[\"Clarke 18"
+        "80 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012"
+        "\"]],AUTHORITY[\"EPSG\",\"6700\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4700\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",-3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3369\"]]"},
+    {3370, "epsg", 3370,
         "NAD27 / UTM zone 59N", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=59 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / UTM zone 59N\",GEOGCS[\"NAD27\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637");
-    add_srs_wkt (p, 2,
-        "8206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "267\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "71],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "370\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3371, "epsg", 3371,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=59 +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / UTM zone 59N\",GEOGCS[\"NAD27\",DATUM[\""
+        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637"
+        "8206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AU"
+        "THORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "267\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "71],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false"
+        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "370\"]]"},
+    {3371, "epsg", 3371,
         "NAD27 / UTM zone 60N", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=60 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / UTM zone 60N\",GEOGCS[\"NAD27\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637");
-    add_srs_wkt (p, 2,
-        "8206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "267\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "77],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "371\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3372, "epsg", 3372,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=60 +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / UTM zone 60N\",GEOGCS[\"NAD27\",DATUM[\""
+        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637"
+        "8206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AU"
+        "THORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "267\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "77],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false"
+        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "371\"]]"},
+    {3372, "epsg", 3372,
         "NAD83 / UTM zone 59N", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=59 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / UTM zone 59N\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",171],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3372\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3373, "epsg", 3373,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=59 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83 / UTM zone 59N\",GEOGCS[\"NAD83\",DATUM[\""
+        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",171],PARA"
+        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3372\"]]"},
+    {3373, "epsg", 3373,
         "NAD83 / UTM zone 60N", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=60 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / UTM zone 60N\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",177],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3373\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3374, "epsg", 3374,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=60 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83 / UTM zone 60N\",GEOGCS[\"NAD83\",DATUM[\""
+        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",177],PARA"
+        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3373\"]]"},
+    {3374, "epsg", 3374,
         "FD54 / UTM zone 29N", 0, 0,
         "International 1924", "Greenwich",
         "Faroe_Datum_1954", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=intl +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"FD54 / UTM zone 29N\",GEOGCS[\"FD54\",DATUM[\"F");
-    add_srs_wkt (p, 1,
-        "aroe_Datum_1954\",SPHEROID[\"International 1924\",637838");
-    add_srs_wkt (p, 2,
-        "8,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6741\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4741\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3374\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3375, "epsg", 3375,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=29 +ellps=intl +units=m +no_defs",
+        "PROJCS[\"FD54 / UTM zone 29N\",GEOGCS[\"FD54\",DATUM[\"F"
+        "aroe_Datum_1954\",SPHEROID[\"International 1924\",637838"
+        "8,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\""
+        "6741\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4741\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3374\"]]"},
+    {3375, "epsg", 3375,
         "GDM2000 / Peninsula RSO", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=4 +lonc=102.25 +alpha=323.02579646666");
-    add_proj4text (p, 1,
-        "66 +k=0.99984 +x_0=804671 +y_0=0 +no_uoff +gamma=323.130");
-    add_proj4text (p, 2,
-        "1023611111 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Peninsula RSO\",GEOGCS[\"GDM2000\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4742\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_center\",4],PARAMETER[\"longitude_of");
-    add_srs_wkt (p, 8,
-        "_center\",102.25],PARAMETER[\"azimuth\",323.025796466667");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"rectified_grid_angle\",323.130102361111],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"scale_factor\",0.99984],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",804671],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3375\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3376, "epsg", 3376,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=4 +lonc=102.25 +alpha=323.02579646666"
+        "66 +k=0.99984 +x_0=804671 +y_0=0 +no_uoff +gamma=323.130"
+        "1023611111 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"GDM2000 / Peninsula RSO\",GEOGCS[\"GDM2000\",DA"
+        "TUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4742\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],PARA"
+        "METER[\"latitude_of_center\",4],PARAMETER[\"longitude_of"
+        "_center\",102.25],PARAMETER[\"azimuth\",323.025796466667"
+        "],PARAMETER[\"rectified_grid_angle\",323.130102361111],P"
+        "ARAMETER[\"scale_factor\",0.99984],PARAMETER[\"false_eas"
+        "ting\",804671],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3375\""
+        "]]"},
+    {3376, "epsg", 3376,
         "GDM2000 / East Malaysia BRSO", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31580995 +k=0.9");
-    add_proj4text (p, 1,
-        "9984 +x_0=0 +y_0=0 +no_uoff +gamma=53.13010236111111 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / East Malaysia BRSO\",GEOGCS[\"GDM2000");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4742\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_center\",4],PARAMETER[\"longitud");
-    add_srs_wkt (p, 8,
-        "e_of_center\",115],PARAMETER[\"azimuth\",53.31580995],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"rectified_grid_angle\",53.1301023611111],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"scale_factor\",0.99984],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3376\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3377, "epsg", 3377,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31580995 +k=0.9"
+        "9984 +x_0=0 +y_0=0 +no_uoff +gamma=53.13010236111111 +el"
+        "lps=GRS80 +units=m +no_defs",
+        "PROJCS[\"GDM2000 / East Malaysia BRSO\",GEOGCS[\"GDM2000"
+        "\",DATUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4742\"]],PROJECTION[\"Hotine_Oblique_Mercator\"],"
+        "PARAMETER[\"latitude_of_center\",4],PARAMETER[\"longitud"
+        "e_of_center\",115],PARAMETER[\"azimuth\",53.31580995],PA"
+        "RAMETER[\"rectified_grid_angle\",53.1301023611111],PARAM"
+        "ETER[\"scale_factor\",0.99984],PARAMETER[\"false_easting"
+        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3376\"]]"},
+    {3377, "epsg", 3377,
         "GDM2000 / Johor Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=2.121679744444445 +lon_0=103.427936236");
-    add_proj4text (p, 1,
-        "1111 +x_0=-14810.562 +y_0=8758.32 +ellps=GRS80 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Johor Grid\",GEOGCS[\"GDM2000\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",2.12167974444444],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",103.427936236111],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",-14810.562],PARAMETER[\"false_northing\",8758.32],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "377\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3378, "epsg", 3378,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=2.121679744444445 +lon_0=103.427936236"
+        "1111 +x_0=-14810.562 +y_0=8758.32 +ellps=GRS80 +units=m "
+        "+no_defs",
+        "PROJCS[\"GDM2000 / Johor Grid\",GEOGCS[\"GDM2000\",DATUM"
+        "[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat"
+        "itude_of_origin\",2.12167974444444],PARAMETER[\"central_"
+        "meridian\",103.427936236111],PARAMETER[\"false_easting\""
+        ",-14810.562],PARAMETER[\"false_northing\",8758.32],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "377\"]]"},
+    {3378, "epsg", 3378,
         "GDM2000 / Sembilan and Melaka Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=2.682347636111111 +lon_0=101.974905041");
-    add_proj4text (p, 1,
-        "6667 +x_0=3673.785 +y_0=-4240.573 +ellps=GRS80 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Sembilan and Melaka Grid\",GEOGCS[\"G");
-    add_srs_wkt (p, 1,
-        "DM2000\",DATUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",2.68234763611111],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",101.974905041667],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",3673.785],PARAMETER[\"false_northing\",-42");
-    add_srs_wkt (p, 10,
-        "40.573],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"3378\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3379, "epsg", 3379,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=2.682347636111111 +lon_0=101.974905041"
+        "6667 +x_0=3673.785 +y_0=-4240.573 +ellps=GRS80 +units=m "
+        "+no_defs",
+        "PROJCS[\"GDM2000 / Sembilan and Melaka Grid\",GEOGCS[\"G"
+        "DM2000\",DATUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PA"
+        "RAMETER[\"latitude_of_origin\",2.68234763611111],PARAMET"
+        "ER[\"central_meridian\",101.974905041667],PARAMETER[\"fa"
+        "lse_easting\",3673.785],PARAMETER[\"false_northing\",-42"
+        "40.573],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3378\"]]"},
+    {3379, "epsg", 3379,
         "GDM2000 / Pahang Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=3.769388088888889 +lon_0=102.368298983");
-    add_proj4text (p, 1,
-        "3333 +x_0=-7368.228 +y_0=6485.858 +ellps=GRS80 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Pahang Grid\",GEOGCS[\"GDM2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 198");
-    add_srs_wkt (p, 2,
-        "0\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",3.76938808888889],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",102.368298983333],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",-7368.228],PARAMETER[\"false_northing\",6485.858],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "379\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3380, "epsg", 3380,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=3.769388088888889 +lon_0=102.368298983"
+        "3333 +x_0=-7368.228 +y_0=6485.858 +ellps=GRS80 +units=m "
+        "+no_defs",
+        "PROJCS[\"GDM2000 / Pahang Grid\",GEOGCS[\"GDM2000\",DATU"
+        "M[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 198"
+        "0\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],"
+        "AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat"
+        "itude_of_origin\",3.76938808888889],PARAMETER[\"central_"
+        "meridian\",102.368298983333],PARAMETER[\"false_easting\""
+        ",-7368.228],PARAMETER[\"false_northing\",6485.858],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "379\"]]"},
+    {3380, "epsg", 3380,
         "GDM2000 / Selangor Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=3.68464905 +lon_0=101.3891079138889 +x");
-    add_proj4text (p, 1,
-        "_0=-34836.161 +y_0=56464.049 +ellps=GRS80 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Selangor Grid\",GEOGCS[\"GDM2000\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",3.68464905],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",101.389107913889],PARAMETER[\"false_easting\",-3");
-    add_srs_wkt (p, 9,
-        "4836.161],PARAMETER[\"false_northing\",56464.049],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"338");
-    add_srs_wkt (p, 12,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3381, "epsg", 3381,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=3.68464905 +lon_0=101.3891079138889 +x"
+        "_0=-34836.161 +y_0=56464.049 +ellps=GRS80 +units=m +no_d"
+        "efs",
+        "PROJCS[\"GDM2000 / Selangor Grid\",GEOGCS[\"GDM2000\",DA"
+        "TUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\""
+        "latitude_of_origin\",3.68464905],PARAMETER[\"central_mer"
+        "idian\",101.389107913889],PARAMETER[\"false_easting\",-3"
+        "4836.161],PARAMETER[\"false_northing\",56464.049],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"338"
+        "0\"]]"},
+    {3381, "epsg", 3381,
         "GDM2000 / Terengganu Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=4.9762852 +lon_0=103.070275625 +x_0=19");
-    add_proj4text (p, 1,
-        "594.245 +y_0=3371.895 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Terengganu Grid\",GEOGCS[\"GDM2000\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",4.9762852],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",103.070275625],PARAMETER[\"false_easting\",19594.");
-    add_srs_wkt (p, 9,
-        "245],PARAMETER[\"false_northing\",3371.895],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3381\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3382, "epsg", 3382,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=4.9762852 +lon_0=103.070275625 +x_0=19"
+        "594.245 +y_0=3371.895 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"GDM2000 / Terengganu Grid\",GEOGCS[\"GDM2000\","
+        "DATUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\""
+        "latitude_of_origin\",4.9762852],PARAMETER[\"central_meri"
+        "dian\",103.070275625],PARAMETER[\"false_easting\",19594."
+        "245],PARAMETER[\"false_northing\",3371.895],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3381\"]]"},
+    {3382, "epsg", 3382,
         "GDM2000 / Pinang Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=5.421517541666667 +lon_0=100.344376963");
-    add_proj4text (p, 1,
-        "8889 +x_0=-23.414 +y_0=62.283 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Pinang Grid\",GEOGCS[\"GDM2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 198");
-    add_srs_wkt (p, 2,
-        "0\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",5.42151754166667],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",100.344376963889],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",-23.414],PARAMETER[\"false_northing\",62.283],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 11,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3382\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3383, "epsg", 3383,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=5.421517541666667 +lon_0=100.344376963"
+        "8889 +x_0=-23.414 +y_0=62.283 +ellps=GRS80 +units=m +no_"
+        "defs",
+        "PROJCS[\"GDM2000 / Pinang Grid\",GEOGCS[\"GDM2000\",DATU"
+        "M[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 198"
+        "0\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],"
+        "AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat"
+        "itude_of_origin\",5.42151754166667],PARAMETER[\"central_"
+        "meridian\",100.344376963889],PARAMETER[\"false_easting\""
+        ",-23.414],PARAMETER[\"false_northing\",62.283],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3382\""
+        "]]"},
+    {3383, "epsg", 3383,
         "GDM2000 / Kedah and Perlis Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=5.964672713888889 +lon_0=100.636371111");
-    add_proj4text (p, 1,
-        "1111 +x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Kedah and Perlis Grid\",GEOGCS[\"GDM2");
-    add_srs_wkt (p, 1,
-        "000\",DATUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",5.96467271388889],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",100.636371111111],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3383\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3384, "epsg", 3384,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=5.964672713888889 +lon_0=100.636371111"
+        "1111 +x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"GDM2000 / Kedah and Perlis Grid\",GEOGCS[\"GDM2"
+        "000\",DATUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAME"
+        "TER[\"latitude_of_origin\",5.96467271388889],PARAMETER[\""
+        "central_meridian\",100.636371111111],PARAMETER[\"false_e"
+        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3383\"]]"},
+    {3384, "epsg", 3384,
         "GDM2000 / Perak Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=4.859063022222222 +lon_0=100.815410586");
-    add_proj4text (p, 1,
-        "1111 +x_0=-1.769 +y_0=133454.779 +ellps=GRS80 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Perak Grid\",GEOGCS[\"GDM2000\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",4.85906302222222],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",100.815410586111],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",-1.769],PARAMETER[\"false_northing\",133454.779],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"338");
-    add_srs_wkt (p, 12,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3385, "epsg", 3385,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=4.859063022222222 +lon_0=100.815410586"
+        "1111 +x_0=-1.769 +y_0=133454.779 +ellps=GRS80 +units=m +"
+        "no_defs",
+        "PROJCS[\"GDM2000 / Perak Grid\",GEOGCS[\"GDM2000\",DATUM"
+        "[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"lat"
+        "itude_of_origin\",4.85906302222222],PARAMETER[\"central_"
+        "meridian\",100.815410586111],PARAMETER[\"false_easting\""
+        ",-1.769],PARAMETER[\"false_northing\",133454.779],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"338"
+        "4\"]]"},
+    {3385, "epsg", 3385,
         "GDM2000 / Kelantan Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Geodetic_Datum_of_Malaysia_2000", "Cassini_Soldner", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=5.972543658333334 +lon_0=102.295241669");
-    add_proj4text (p, 1,
-        "4444 +x_0=13227.851 +y_0=8739.894 +ellps=GRS80 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDM2000 / Kelantan Grid\",GEOGCS[\"GDM2000\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",5.97254365833333],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",102.295241669444],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",13227.851],PARAMETER[\"false_northing\",8739.894],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3385\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3386, "epsg", 3386,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=5.972543658333334 +lon_0=102.295241669"
+        "4444 +x_0=13227.851 +y_0=8739.894 +ellps=GRS80 +units=m "
+        "+no_defs",
+        "PROJCS[\"GDM2000 / Kelantan Grid\",GEOGCS[\"GDM2000\",DA"
+        "TUM[\"Geodetic_Datum_of_Malaysia_2000\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6742\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4742\"]],PROJECTION[\"Cassini_Soldner\"],PARAMETER[\""
+        "latitude_of_origin\",5.97254365833333],PARAMETER[\"centr"
+        "al_meridian\",102.295241669444],PARAMETER[\"false_eastin"
+        "g\",13227.851],PARAMETER[\"false_northing\",8739.894],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3385\"]]"},
+    {3386, "epsg", 3386,
         "KKJ / Finland zone 0", 0, 1,
         "International 1924", "Greenwich",
         "Kartastokoordinaattijarjestelma_1966", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.345");
-    add_proj4text (p, 2,
-        ",-1.376,1.496 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KKJ / Finland zone 0\",GEOGCS[\"KKJ\",DATUM[\"K");
-    add_srs_wkt (p, 1,
-        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "8],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NO");
-    add_srs_wkt (p, 11,
-        "RTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3386\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3387, "epsg", 3387,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=500000 +y_0=0 +"
+        "ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.345"
+        ",-1.376,1.496 +units=m +no_defs",
+        "PROJCS[\"KKJ / Finland zone 0\",GEOGCS[\"KKJ\",DATUM[\"K"
+        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "8],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NO"
+        "RTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3386\"]"
+        "]"},
+    {3387, "epsg", 3387,
         "KKJ / Finland zone 5", 0, 1,
         "International 1924", "Greenwich",
         "Kartastokoordinaattijarjestelma_1966", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34");
-    add_proj4text (p, 2,
-        "5,-1.376,1.496 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KKJ / Finland zone 5\",GEOGCS[\"KKJ\",DATUM[\"K");
-    add_srs_wkt (p, 1,
-        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 8,
-        "3],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",5500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3387\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3388, "epsg", 3388,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=5500000 +y_0=0 "
+        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34"
+        "5,-1.376,1.496 +units=m +no_defs",
+        "PROJCS[\"KKJ / Finland zone 5\",GEOGCS[\"KKJ\",DATUM[\"K"
+        "artastokoordinaattijarjestelma_1966\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6123\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4123\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3"
+        "3],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",5500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3387\""
+        "]]"},
+    {3388, "epsg", 3388,
         "Pulkovo 1942 / Caspian Sea Mercator", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Mercator_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=51 +lat_ts=42 +x_0=0 +y_0=0 +ellps=kra");
-    add_proj4text (p, 1,
-        "ss +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.12 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / Caspian Sea Mercator\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4284\"]],PROJECTION[\"Mercator_2SP\"],PARAMETER[\"standa");
-    add_srs_wkt (p, 7,
-        "rd_parallel_1\",42],PARAMETER[\"central_meridian\",51],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"3388\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3389, "epsg", 3389,
+        "Northing", "North", "Easting", "East",
+        "+proj=merc +lon_0=51 +lat_ts=42 +x_0=0 +y_0=0 +ellps=kra"
+        "ss +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0.12 +units"
+        "=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / Caspian Sea Mercator\",GEOGCS[\""
+        "Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassow"
+        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A"
+        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4284\"]],PROJECTION[\"Mercator_2SP\"],PARAMETER[\"standa"
+        "rd_parallel_1\",42],PARAMETER[\"central_meridian\",51],P"
+        "ARAMETER[\"false_easting\",0],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\""
+        "EPSG\",\"3388\"]]"},
+    {3389, "epsg", 3389,
         "Pulkovo 1942 / 3-degree Gauss-Kruger zone 60", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=60500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,");
-    add_proj4text (p, 2,
-        "-0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 60\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",180],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",60500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3389\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3390, "epsg", 3390,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=60500000 +y_0="
+        "0 +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,"
+        "-0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / 3-degree Gauss-Kruger zone 60\","
+        "GEOGCS[\"Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4284\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",180],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",60500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"3389\"]]"},
+    {3390, "epsg", 3390,
         "Pulkovo 1995 / 3-degree Gauss-Kruger zone 60", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1995", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=60500000 +y_0=");
-    add_proj4text (p, 1,
-        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0");
-    add_proj4text (p, 2,
-        ".22 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 60\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "024\"]],AUTHORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4200\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",180],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",60500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3390\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3391, "epsg", 3391,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=180 +k=1 +x_0=60500000 +y_0="
+        "0 +ellps=krass +towgs84=24.47,-130.89,-81.56,0,0,0.13,-0"
+        ".22 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1995 / 3-degree Gauss-Kruger zone 60\","
+        "GEOGCS[\"Pulkovo 1995\",DATUM[\"Pulkovo_1995\",SPHEROID["
+        "\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7"
+        "024\"]],AUTHORITY[\"EPSG\",\"6200\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4200\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",180],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",60500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"3390\"]]"},
+    {3391, "epsg", 3391,
         "Karbala 1979 / UTM zone 37N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Karbala_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=37 +ellps=clrk80 +towgs84=70.995,-335.91");
-    add_proj4text (p, 1,
-        "6,262.898,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Karbala 1979 / UTM zone 37N\",GEOGCS[\"Karbala ");
-    add_srs_wkt (p, 1,
-        "1979\",DATUM[\"Karbala_1979\",SPHEROID[\"Clarke 1880 (RG");
-    add_srs_wkt (p, 2,
-        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6743\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4743\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3");
-    add_srs_wkt (p, 8,
-        "9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"339");
-    add_srs_wkt (p, 12,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3392, "epsg", 3392,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=37 +ellps=clrk80 +towgs84=70.995,-335.91"
+        "6,262.898,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Karbala 1979 / UTM zone 37N\",GEOGCS[\"Karbala "
+        "1979\",DATUM[\"Karbala_1979\",SPHEROID[\"Clarke 1880 (RG"
+        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],A"
+        "UTHORITY[\"EPSG\",\"6743\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4743\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",3"
+        "9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"339"
+        "1\"]]"},
+    {3392, "epsg", 3392,
         "Karbala 1979 / UTM zone 38N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Karbala_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=clrk80 +towgs84=70.995,-335.91");
-    add_proj4text (p, 1,
-        "6,262.898,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Karbala 1979 / UTM zone 38N\",GEOGCS[\"Karbala ");
-    add_srs_wkt (p, 1,
-        "1979\",DATUM[\"Karbala_1979\",SPHEROID[\"Clarke 1880 (RG");
-    add_srs_wkt (p, 2,
-        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6743\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4743\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",4");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"339");
-    add_srs_wkt (p, 12,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3393, "epsg", 3393,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=38 +ellps=clrk80 +towgs84=70.995,-335.91"
+        "6,262.898,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Karbala 1979 / UTM zone 38N\",GEOGCS[\"Karbala "
+        "1979\",DATUM[\"Karbala_1979\",SPHEROID[\"Clarke 1880 (RG"
+        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],A"
+        "UTHORITY[\"EPSG\",\"6743\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4743\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",4"
+        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"339"
+        "2\"]]"},
+    {3393, "epsg", 3393,
         "Karbala 1979 / UTM zone 39N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Karbala_1979", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=clrk80 +towgs84=70.995,-335.91");
-    add_proj4text (p, 1,
-        "6,262.898,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Karbala 1979 / UTM zone 39N\",GEOGCS[\"Karbala ");
-    add_srs_wkt (p, 1,
-        "1979\",DATUM[\"Karbala_1979\",SPHEROID[\"Clarke 1880 (RG");
-    add_srs_wkt (p, 2,
-        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6743\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4743\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",5");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"339");
-    add_srs_wkt (p, 12,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3394, "epsg", 3394,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=39 +ellps=clrk80 +towgs84=70.995,-335.91"
+        "6,262.898,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Karbala 1979 / UTM zone 39N\",GEOGCS[\"Karbala "
+        "1979\",DATUM[\"Karbala_1979\",SPHEROID[\"Clarke 1880 (RG"
+        "S)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],A"
+        "UTHORITY[\"EPSG\",\"6743\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4743\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",5"
+        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"339"
+        "3\"]]"},
+    {3394, "epsg", 3394,
         "Nahrwan 1934 / Iraq zone", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Nahrwan_1934", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.5 +lat_0=32.5 +lon_0=45 +k_0=0.99878");
-    add_proj4text (p, 1,
-        "64078000001 +x_0=1500000 +y_0=1166200 +ellps=clrk80 +tow");
-    add_proj4text (p, 2,
-        "gs84=-242.2,-144.9,370.3,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nahrwan 1934 / Iraq zone\",GEOGCS[\"Nahrwan 193");
-    add_srs_wkt (p, 1,
-        "4\",DATUM[\"Nahrwan_1934\",SPHEROID[\"Clarke 1880 (RGS)\"");
-    add_srs_wkt (p, 2,
-        ",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6744\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4744");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"latitude_of_origin\",32.5],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",45],PARAMETER[\"scale_factor\",0.9987864078],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",1500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",1166200],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"3394\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3395, "epsg", 3395,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=32.5 +lat_0=32.5 +lon_0=45 +k_0=0.99878"
+        "64078000001 +x_0=1500000 +y_0=1166200 +ellps=clrk80 +tow"
+        "gs84=-242.2,-144.9,370.3,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Nahrwan 1934 / Iraq zone\",GEOGCS[\"Nahrwan 193"
+        "4\",DATUM[\"Nahrwan_1934\",SPHEROID[\"Clarke 1880 (RGS)\""
+        ",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHO"
+        "RITY[\"EPSG\",\"6744\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4744"
+        "\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMET"
+        "ER[\"latitude_of_origin\",32.5],PARAMETER[\"central_meri"
+        "dian\",45],PARAMETER[\"scale_factor\",0.9987864078],PARA"
+        "METER[\"false_easting\",1500000],PARAMETER[\"false_north"
+        "ing\",1166200],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3394\"]]"},
+    {3395, "epsg", 3395,
         "WGS 84 / World Mercator", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=0 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +uni");
-    add_proj4text (p, 1,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / World Mercator\",GEOGCS[\"WGS 84\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.25722356");
-    add_srs_wkt (p, 2,
-        "3,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"632");
-    add_srs_wkt (p, 3,
-        "6\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"M");
-    add_srs_wkt (p, 6,
-        "ercator_1SP\"],PARAMETER[\"central_meridian\",0],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 9,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 10,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3395\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3396, "epsg", 3396,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=0 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +uni"
+        "ts=m +no_defs",
+        "PROJCS[\"WGS 84 / World Mercator\",GEOGCS[\"WGS 84\",DAT"
+        "UM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.25722356"
+        "3,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"632"
+        "6\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"M"
+        "ercator_1SP\"],PARAMETER[\"central_meridian\",0],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3395\"]]"},
+    {3396, "epsg", 3396,
         "PD/83 / 3-degree Gauss-Kruger zone 3", 0, 1,
         "Bessel 1841", "Greenwich",
         "Potsdam_Datum_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PD/83 / 3-degree Gauss-Kruger zone 3\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "PD/83\",DATUM[\"Potsdam_Datum_83\",SPHEROID[\"Bessel 184");
-    add_srs_wkt (p, 2,
-        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6746\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4746\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",9],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",3500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3396");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3397, "epsg", 3397,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +"
+        "ellps=bessel +units=m +no_defs",
+        "PROJCS[\"PD/83 / 3-degree Gauss-Kruger zone 3\",GEOGCS[\""
+        "PD/83\",DATUM[\"Potsdam_Datum_83\",SPHEROID[\"Bessel 184"
+        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]"
+        "],AUTHORITY[\"EPSG\",\"6746\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4746\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",9],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",3500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3396"
+        "\"]]"},
+    {3397, "epsg", 3397,
         "PD/83 / 3-degree Gauss-Kruger zone 4", 0, 1,
         "Bessel 1841", "Greenwich",
         "Potsdam_Datum_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PD/83 / 3-degree Gauss-Kruger zone 4\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "PD/83\",DATUM[\"Potsdam_Datum_83\",SPHEROID[\"Bessel 184");
-    add_srs_wkt (p, 2,
-        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6746\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4746\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",12],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",4500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3397");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3398, "epsg", 3398,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 "
+        "+ellps=bessel +units=m +no_defs",
+        "PROJCS[\"PD/83 / 3-degree Gauss-Kruger zone 4\",GEOGCS[\""
+        "PD/83\",DATUM[\"Potsdam_Datum_83\",SPHEROID[\"Bessel 184"
+        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]"
+        "],AUTHORITY[\"EPSG\",\"6746\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4746\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",12],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e"
+        "asting\",4500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3397"
+        "\"]]"},
+    {3398, "epsg", 3398,
         "RD/83 / 3-degree Gauss-Kruger zone 4", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rauenberg_Datum_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RD/83 / 3-degree Gauss-Kruger zone 4\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "RD/83\",DATUM[\"Rauenberg_Datum_83\",SPHEROID[\"Bessel 1");
-    add_srs_wkt (p, 2,
-        "841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6745\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4745\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",12],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",4500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3398");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3399, "epsg", 3399,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 "
+        "+ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RD/83 / 3-degree Gauss-Kruger zone 4\",GEOGCS[\""
+        "RD/83\",DATUM[\"Rauenberg_Datum_83\",SPHEROID[\"Bessel 1"
+        "841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\""
+        "]],AUTHORITY[\"EPSG\",\"6745\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4745\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",12],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e"
+        "asting\",4500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3398"
+        "\"]]"},
+    {3399, "epsg", 3399,
         "RD/83 / 3-degree Gauss-Kruger zone 5", 0, 1,
         "Bessel 1841", "Greenwich",
         "Rauenberg_Datum_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RD/83 / 3-degree Gauss-Kruger zone 5\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "RD/83\",DATUM[\"Rauenberg_Datum_83\",SPHEROID[\"Bessel 1");
-    add_srs_wkt (p, 2,
-        "841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6745\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4745\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",5500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3399");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3400, "epsg", 3400,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=5500000 +y_0=0 "
+        "+ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RD/83 / 3-degree Gauss-Kruger zone 5\",GEOGCS[\""
+        "RD/83\",DATUM[\"Rauenberg_Datum_83\",SPHEROID[\"Bessel 1"
+        "841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\""
+        "]],AUTHORITY[\"EPSG\",\"6745\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4745\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e"
+        "asting\",5500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3399"
+        "\"]]"},
+    {3400, "epsg", 3400,
         "NAD83 / Alberta 10-TM (Forest)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-115 +k=0.9992 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Alberta 10-TM (Forest)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-115],PARAMETER[\"scale_factor\",0.9992],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3400\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3401, "epsg", 3401,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-115 +k=0.9992 +x_0=500000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83 / Alberta 10-TM (Forest)\",GEOGCS[\"NAD83"
+        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-115],PARAMETER[\"scale_factor\",0.9992],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3400\"]]"},
+    {3401, "epsg", 3401,
         "NAD83 / Alberta 10-TM (Resource)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-115 +k=0.9992 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Alberta 10-TM (Resource)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-115],PARAMETER[\"scale_factor\",0.9992],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "401\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3402, "epsg", 3402,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-115 +k=0.9992 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Alberta 10-TM (Resource)\",GEOGCS[\"NAD"
+        "83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-115],PARAMETER[\"scale_factor\",0.9992],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "401\"]]"},
+    {3402, "epsg", 3402,
         "NAD83(CSRS) / Alberta 10-TM (Forest)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-115 +k=0.9992 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Alberta 10-TM (Forest)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-115],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.9992],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 11,
-        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AUTHORITY[\"EPSG\",\"3402\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3403, "epsg", 3403,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-115 +k=0.9992 +x_0=500000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(CSRS) / Alberta 10-TM (Forest)\",GEOGCS[\""
+        "NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_S"
+        "ystem\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA"
+        "METER[\"central_meridian\",-115],PARAMETER[\"scale_facto"
+        "r\",0.9992],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS"
+        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"3402\"]]"},
+    {3403, "epsg", 3403,
         "NAD83(CSRS) / Alberta 10-TM (Resource)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-115 +k=0.9992 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Alberta 10-TM (Resource)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-115],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9992],PARAMETER[\"false_easting\",0],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"3403\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3404, "epsg", 3404,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-115 +k=0.9992 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Alberta 10-TM (Resource)\",GEOGCS"
+        "[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Referenc"
+        "e_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-115],PARAMETER[\"scale_fa"
+        "ctor\",0.9992],PARAMETER[\"false_easting\",0],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3403\"]]"},
+    {3404, "epsg", 3404,
         "NAD83(HARN) / North Carolina (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0=");
-    add_proj4text (p, 2,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / North Carolina (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33");
-    add_srs_wkt (p, 8,
-        ".75],PARAMETER[\"central_meridian\",-79],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",36.1666666666667],PARAMETER[\"standar");
-    add_srs_wkt (p, 10,
-        "d_parallel_2\",34.3333333333333],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",2000000],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"3404\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3405, "epsg", 3405,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333"
+        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d"
+        "efs",
+        "PROJCS[\"NAD83(HARN) / North Carolina (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33"
+        ".75],PARAMETER[\"central_meridian\",-79],PARAMETER[\"sta"
+        "ndard_parallel_1\",36.1666666666667],PARAMETER[\"standar"
+        "d_parallel_2\",34.3333333333333],PARAMETER[\"false_easti"
+        "ng\",2000000],PARAMETER[\"false_northing\",0],UNIT[\"US "
+        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900"
+        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3404\"]]"},
+    {3405, "epsg", 3405,
         "VN-2000 / UTM zone 48N", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=48 +ellps=WGS84 +towgs84=-191.90441429,-");
-    add_proj4text (p, 1,
-        "39.30318279,-111.45032835,0.00928836,-0.01975479,0.00427");
-    add_proj4text (p, 2,
-        "372,0.252906278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / UTM zone 48N\",GEOGCS[\"VN-2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",105],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3405\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3406, "epsg", 3406,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=48 +ellps=WGS84 +towgs84=-191.90441429,-"
+        "39.30318279,-111.45032835,0.00928836,-0.01975479,0.00427"
+        "372,0.252906278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / UTM zone 48N\",GEOGCS[\"VN-2000\",DAT"
+        "UM[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.2572"
+        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",105],PARAMETER[\"scal"
+        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3405\"]]"},
+    {3406, "epsg", 3406,
         "VN-2000 / UTM zone 49N", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=49 +ellps=WGS84 +towgs84=-191.90441429,-");
-    add_proj4text (p, 1,
-        "39.30318279,-111.45032835,0.00928836,-0.01975479,0.00427");
-    add_proj4text (p, 2,
-        "372,0.252906278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / UTM zone 49N\",GEOGCS[\"VN-2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",111],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3406\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3407, "epsg", 3407,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=49 +ellps=WGS84 +towgs84=-191.90441429,-"
+        "39.30318279,-111.45032835,0.00928836,-0.01975479,0.00427"
+        "372,0.252906278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / UTM zone 49N\",GEOGCS[\"VN-2000\",DAT"
+        "UM[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.2572"
+        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",111],PARAMETER[\"scal"
+        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3406\"]]"},
+    {3407, "epsg", 3407,
         "Hong Kong 1963 Grid System", 0, 1,
         "Clarke 1858", "Greenwich",
         "Hong_Kong_1963", "Cassini_Soldner", "Clarke's foot",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=22.31213333333334 +lon_0=114.178555555");
-    add_proj4text (p, 1,
-        "5556 +x_0=40243.57775604237 +y_0=19069.93351512578 +a=63");
-    add_proj4text (p, 2,
-        "78293.645208759 +b=6356617.987679838 +to_meter=0.3047972");
-    add_proj4text (p, 3,
-        "654 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hong Kong 1963 Grid System\",GEOGCS[\"Hong Kong");
-    add_srs_wkt (p, 1,
-        " 1963\",DATUM[\"Hong_Kong_1963\",SPHEROID[\"Clarke 1858\"");
-    add_srs_wkt (p, 2,
-        ",6378293.64520876,294.260676369261,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7007\"]],AUTHORITY[\"EPSG\",\"6738\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4738\"]],PROJECTION[\"Cassini_Soldner\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",22.3121333333333],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",114.178555555556],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",132033.92],PARAMETER[\"false_northing\",62565.9");
-    add_srs_wkt (p, 10,
-        "6],UNIT[\"Clarke's foot\",0.3047972654,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9005\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AUTHORITY[\"EPSG\",\"3407\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3408, "epsg", 3408,
+        "Northing", "North", "Easting", "East",
+        "+proj=cass +lat_0=22.31213333333334 +lon_0=114.178555555"
+        "5556 +x_0=40243.57775604237 +y_0=19069.93351512578 +a=63"
+        "78293.645208759 +b=6356617.987679838 +to_meter=0.3047972"
+        "654 +no_defs",
+        "PROJCS[\"Hong Kong 1963 Grid System\",GEOGCS[\"Hong Kong"
+        " 1963\",DATUM[\"Hong_Kong_1963\",SPHEROID[\"Clarke 1858\""
+        ",6378293.64520876,294.260676369261,AUTHORITY[\"EPSG\",\""
+        "7007\"]],AUTHORITY[\"EPSG\",\"6738\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4738\"]],PROJECTION[\"Cassini_Soldner\"],PARAME"
+        "TER[\"latitude_of_origin\",22.3121333333333],PARAMETER[\""
+        "central_meridian\",114.178555555556],PARAMETER[\"false_e"
+        "asting\",132033.92],PARAMETER[\"false_northing\",62565.9"
+        "6],UNIT[\"Clarke's foot\",0.3047972654,AUTHORITY[\"EPSG\""
+        ",\"9005\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"3407\"]]"},
+    {3408, "epsg", 3408,
         "WGS 84 / NSIDC EASE-Grid 2.0 North", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=0 +x_0=0 +y_0=0 +a=6371228 +");
-    add_proj4text (p, 1,
-        "b=6371228 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 North\",GEOGCS[\"W");
-    add_srs_wkt (p, 1,
-        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2");
-    add_srs_wkt (p, 2,
-        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_center\",90],PARAMETER[\"longitude_of_center\"");
-    add_srs_wkt (p, 8,
-        ",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 9,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 10,
-        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"6931\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3409, "epsg", 3409,
+        "Easting", "South", "Northing", "South",
+        "+proj=laea +lat_0=90 +lon_0=0 +x_0=0 +y_0=0 +a=6371228 +"
+        "b=6371228 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 North\",GEOGCS[\"W"
+        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2"
+        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E"
+        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO"
+        "JECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"la"
+        "titude_of_center\",90],PARAMETER[\"longitude_of_center\""
+        ",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO"
+        "RITY[\"EPSG\",\"6931\"]]"},
+    {3409, "epsg", 3409,
         "WGS 84 / NSIDC EASE-Grid 2.0 South", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=-90 +lon_0=0 +x_0=0 +y_0=0 +a=6371228 ");
-    add_proj4text (p, 1,
-        "+b=6371228 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 South\",GEOGCS[\"W");
-    add_srs_wkt (p, 1,
-        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2");
-    add_srs_wkt (p, 2,
-        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_center\",-90],PARAMETER[\"longitude_of_center\"");
-    add_srs_wkt (p, 8,
-        ",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 9,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 10,
-        "],AXIS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"6932\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3410, "epsg", 3410,
+        "Easting", "North", "Northing", "North",
+        "+proj=laea +lat_0=-90 +lon_0=0 +x_0=0 +y_0=0 +a=6371228 "
+        "+b=6371228 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 South\",GEOGCS[\"W"
+        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2"
+        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E"
+        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO"
+        "JECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"la"
+        "titude_of_center\",-90],PARAMETER[\"longitude_of_center\""
+        ",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"6932\"]]"},
+    {3410, "epsg", 3410,
         "WGS 84 / NSIDC EASE-Grid 2.0 Global", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Cylindrical_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cea +lon_0=0 +lat_ts=30 +x_0=0 +y_0=0 +a=6371228 +");
-    add_proj4text (p, 1,
-        "b=6371228 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 Global\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Cylindrical_Equal_Area\"],PARAMETER[\"standar");
-    add_srs_wkt (p, 7,
-        "d_parallel_1\",30],PARAMETER[\"central_meridian\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"6933\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3411, "epsg", 3411,
+        "Easting", "East", "Northing", "North",
+        "+proj=cea +lon_0=0 +lat_ts=30 +x_0=0 +y_0=0 +a=6371228 +"
+        "b=6371228 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 Global\",GEOGCS[\""
+        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,"
+        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\""
+        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PR"
+        "OJECTION[\"Cylindrical_Equal_Area\"],PARAMETER[\"standar"
+        "d_parallel_1\",30],PARAMETER[\"central_meridian\",0],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"6933\"]]"},
+    {3411, "epsg", 3411,
         "WGS 84 / NSIDC Sea Ice Polar Stereographic North", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=90 +lat_ts=70 +lon_0=-45 +k=1 +x_0=0 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +a=6378273 +b=6356889.449 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC Sea Ice Polar Stereographic Nort");
-    add_srs_wkt (p, 1,
-        "h\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS ");
-    add_srs_wkt (p, 2,
-        "84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",70],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-45],PARAMETER[\"false_easting\",0],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 10,
-        "1\"]],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"3413\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3412, "epsg", 3412,
+        "Easting", "South", "Northing", "South",
+        "+proj=stere +lat_0=90 +lat_ts=70 +lon_0=-45 +k=1 +x_0=0 "
+        "+y_0=0 +a=6378273 +b=6356889.449 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC Sea Ice Polar Stereographic Nort"
+        "h\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS "
+        "84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]]"
+        ",AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER"
+        "[\"latitude_of_origin\",70],PARAMETER[\"central_meridian"
+        "\",-45],PARAMETER[\"false_easting\",0],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],A"
+        "UTHORITY[\"EPSG\",\"3413\"]]"},
+    {3412, "epsg", 3412,
         "WGS 84 / NSIDC Sea Ice Polar Stereographic South", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-70 +lon_0=0 +k=1 +x_0=0 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +a=6378273 +b=6356889.449 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC Sea Ice Polar Stereographic Sout");
-    add_srs_wkt (p, 1,
-        "h\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS ");
-    add_srs_wkt (p, 2,
-        "84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",-70],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 8,
-        "n\",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 10,
-        "\"]],AXIS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"3976\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3413, "epsg", 3413,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-70 +lon_0=0 +k=1 +x_0=0 "
+        "+y_0=0 +a=6378273 +b=6356889.449 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC Sea Ice Polar Stereographic Sout"
+        "h\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS "
+        "84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]]"
+        ",AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER"
+        "[\"latitude_of_origin\",-70],PARAMETER[\"central_meridia"
+        "n\",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3976\"]]"},
+    {3413, "epsg", 3413,
         "WGS 84 / NSIDC Sea Ice Polar Stereographic North", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=90 +lat_ts=70 +lon_0=-45 +k=1 +x_0=0 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC Sea Ice Polar Stereographic Nort");
-    add_srs_wkt (p, 1,
-        "h\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS ");
-    add_srs_wkt (p, 2,
-        "84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",70],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-45],PARAMETER[\"false_easting\",0],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 10,
-        "1\"]],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"3413\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3414, "epsg", 3414,
+        "Easting", "South", "Northing", "South",
+        "+proj=stere +lat_0=90 +lat_ts=70 +lon_0=-45 +k=1 +x_0=0 "
+        "+y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC Sea Ice Polar Stereographic Nort"
+        "h\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS "
+        "84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]]"
+        ",AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER"
+        "[\"latitude_of_origin\",70],PARAMETER[\"central_meridian"
+        "\",-45],PARAMETER[\"false_easting\",0],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],A"
+        "UTHORITY[\"EPSG\",\"3413\"]]"},
+    {3414, "epsg", 3414,
         "SVY21 / Singapore TM", 0, 1,
         "WGS 84", "Greenwich",
         "SVY21", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=1.366666666666667 +lon_0=103.83333333");
-    add_proj4text (p, 1,
-        "33333 +k=1 +x_0=28001.642 +y_0=38744.572 +ellps=WGS84 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SVY21 / Singapore TM\",GEOGCS[\"SVY21\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "SVY21\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6757\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AUTHORITY[\"EPSG\",\"4757\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 6,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",1.36666666");
-    add_srs_wkt (p, 7,
-        "666667],PARAMETER[\"central_meridian\",103.833333333333]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",28001.642],PARAMETER[\"false_northing\",38744.572],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3414\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3415, "epsg", 3415,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=1.366666666666667 +lon_0=103.83333333"
+        "33333 +k=1 +x_0=28001.642 +y_0=38744.572 +ellps=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"SVY21 / Singapore TM\",GEOGCS[\"SVY21\",DATUM[\""
+        "SVY21\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHOR"
+        "ITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6757\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4757\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",1.36666666"
+        "666667],PARAMETER[\"central_meridian\",103.833333333333]"
+        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting"
+        "\",28001.642],PARAMETER[\"false_northing\",38744.572],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3414\"]]"},
+    {3415, "epsg", 3415,
         "WGS 72BE / South China Sea Lambert", 0, 0,
         "WGS 72", "Greenwich",
         "WGS_72_Transit_Broadcast_Ephemeris", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18 +lat_2=24 +lat_0=21 +lon_0=114 +x_0=");
-    add_proj4text (p, 1,
-        "500000 +y_0=500000 +ellps=WGS72 +towgs84=0,0,1.9,0,0,0.8");
-    add_proj4text (p, 2,
-        "14,-0.38 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 72BE / South China Sea Lambert\",GEOGCS[\"W");
-    add_srs_wkt (p, 1,
-        "GS 72BE\",DATUM[\"WGS_72_Transit_Broadcast_Ephemeris\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"WGS 72\",6378135,298.26,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "043\"]],AUTHORITY[\"EPSG\",\"6324\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4324\"]],PROJECTION[\"Lambert_Conformal_Conic_2");
-    add_srs_wkt (p, 7,
-        "SP\"],PARAMETER[\"latitude_of_origin\",21],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",114],PARAMETER[\"standard_parallel_1\"");
-    add_srs_wkt (p, 9,
-        ",18],PARAMETER[\"standard_parallel_2\",24],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",5000");
-    add_srs_wkt (p, 11,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"3415\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3416, "epsg", 3416,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=18 +lat_2=24 +lat_0=21 +lon_0=114 +x_0="
+        "500000 +y_0=500000 +ellps=WGS72 +towgs84=0,0,1.9,0,0,0.8"
+        "14,-0.38 +units=m +no_defs",
+        "PROJCS[\"WGS 72BE / South China Sea Lambert\",GEOGCS[\"W"
+        "GS 72BE\",DATUM[\"WGS_72_Transit_Broadcast_Ephemeris\",S"
+        "PHEROID[\"WGS 72\",6378135,298.26,AUTHORITY[\"EPSG\",\"7"
+        "043\"]],AUTHORITY[\"EPSG\",\"6324\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4324\"]],PROJECTION[\"Lambert_Conformal_Conic_2"
+        "SP\"],PARAMETER[\"latitude_of_origin\",21],PARAMETER[\"c"
+        "entral_meridian\",114],PARAMETER[\"standard_parallel_1\""
+        ",18],PARAMETER[\"standard_parallel_2\",24],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",5000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3415\"]]"},
+    {3416, "epsg", 3416,
         "ETRS89 / Austria Lambert", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=46 +lat_0=47.5 +lon_0=13.3333");
-    add_proj4text (p, 1,
-        "3333333333 +x_0=400000 +y_0=400000 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / Austria Lambert\",GEOGCS[\"ETRS89\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"European_Terrestrial_Reference_System_1989\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",47.5],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",13.3333333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_1\",49],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",46],PARAMETER[\"false_easting\",400000],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_northing\",400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AUTHORITY[\"EPSG\",\"3416\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3417, "epsg", 3417,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=49 +lat_2=46 +lat_0=47.5 +lon_0=13.3333"
+        "3333333333 +x_0=400000 +y_0=400000 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / Austria Lambert\",GEOGCS[\"ETRS89\",DA"
+        "TUM[\"European_Terrestrial_Reference_System_1989\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",47.5],PARAMET"
+        "ER[\"central_meridian\",13.3333333333333],PARAMETER[\"st"
+        "andard_parallel_1\",49],PARAMETER[\"standard_parallel_2\""
+        ",46],PARAMETER[\"false_easting\",400000],PARAMETER[\"fal"
+        "se_northing\",400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"3416\"]]"},
+    {3417, "epsg", 3417,
         "NAD83 / Iowa North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99");
-    add_proj4text (p, 2,
-        "99898402 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Iowa North (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",41.5],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",-93.5],PARAMETER[\"standard_parallel_1\",43.2666");
-    add_srs_wkt (p, 9,
-        "666666667],PARAMETER[\"standard_parallel_2\",42.06666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"false_easting\",4921250],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",3280833.3333],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 12,
-        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3417\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3418, "epsg", 3418,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666"
+        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99"
+        "99898402 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83 / Iowa North (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",41.5],PARAMETER[\"central_mer"
+        "idian\",-93.5],PARAMETER[\"standard_parallel_1\",43.2666"
+        "666666667],PARAMETER[\"standard_parallel_2\",42.06666666"
+        "66667],PARAMETER[\"false_easting\",4921250],PARAMETER[\""
+        "false_northing\",3280833.3333],UNIT[\"US survey foot\",0"
+        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3417\"]]"},
+    {3418, "epsg", 3418,
         "NAD83 / Iowa South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Iowa South (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",40],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-93.5],PARAMETER[\"standard_parallel_1\",41.783333");
-    add_srs_wkt (p, 9,
-        "3333333],PARAMETER[\"standard_parallel_2\",40.6166666666");
-    add_srs_wkt (p, 10,
-        "667],PARAMETER[\"false_easting\",1640416.6667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",0],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 12,
-        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3418");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3419, "epsg", 3419,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666"
+        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Iowa South (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",40],PARAMETER[\"central_merid"
+        "ian\",-93.5],PARAMETER[\"standard_parallel_1\",41.783333"
+        "3333333],PARAMETER[\"standard_parallel_2\",40.6166666666"
+        "667],PARAMETER[\"false_easting\",1640416.6667],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"US survey foot\",0.3048006"
+        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3418"
+        "\"]]"},
+    {3419, "epsg", 3419,
         "NAD83 / Kansas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u");
-    add_proj4text (p, 3,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Kansas North (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",38.3333333333333],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-98],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 9,
-        "1\",39.7833333333333],PARAMETER[\"standard_parallel_2\",");
-    add_srs_wkt (p, 10,
-        "38.7166666666667],PARAMETER[\"false_easting\",1312333.33");
-    add_srs_wkt (p, 11,
-        "33],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo");
-    add_srs_wkt (p, 12,
-        "t\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3419\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3420, "epsg", 3420,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666"
+        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999"
+        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83 / Kansas North (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",38.3333333333333],PARAMETER["
+        "\"central_meridian\",-98],PARAMETER[\"standard_parallel_"
+        "1\",39.7833333333333],PARAMETER[\"standard_parallel_2\","
+        "38.7166666666667],PARAMETER[\"false_easting\",1312333.33"
+        "33],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo"
+        "t\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3419\"]]"},
+    {3420, "epsg", 3420,
         "NAD83 / Kansas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99");
-    add_proj4text (p, 2,
-        "998984 +y_0=399999.99998984 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Kansas South (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",36.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-98.5],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 9,
-        "l_1\",38.5666666666667],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",37.2666666666667],PARAMETER[\"false_easting\",1312333.3");
-    add_srs_wkt (p, 11,
-        "333],PARAMETER[\"false_northing\",1312333.3333],UNIT[\"U");
-    add_srs_wkt (p, 12,
-        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 13,
-        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 14,
-        "AUTHORITY[\"EPSG\",\"3420\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3421, "epsg", 3421,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666"
+        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99"
+        "998984 +y_0=399999.99998984 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Kansas South (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",36.6666666666667],PARAMETER["
+        "\"central_meridian\",-98.5],PARAMETER[\"standard_paralle"
+        "l_1\",38.5666666666667],PARAMETER[\"standard_parallel_2\""
+        ",37.2666666666667],PARAMETER[\"false_easting\",1312333.3"
+        "333],PARAMETER[\"false_northing\",1312333.3333],UNIT[\"U"
+        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9"
+        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"3420\"]]"},
+    {3421, "epsg", 3421,
         "NAD83 / Nevada East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Nevada East (ftUS)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",34.75],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-115.583333333333],PARAMETER[\"scale_factor\",0.9999],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",656166.6667],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_northing\",26246666.6667],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 11,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3421\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3422, "epsg", 3422,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0."
+        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps="
+        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Nevada East (ftUS)\",GEOGCS[\"NAD83\",D"
+        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",34.75],PARAMETER[\"central_meridian\""
+        ",-115.583333333333],PARAMETER[\"scale_factor\",0.9999],P"
+        "ARAMETER[\"false_easting\",656166.6667],PARAMETER[\"fals"
+        "e_northing\",26246666.6667],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3421\"]]"},
+    {3422, "epsg", 3422,
         "NAD83 / Nevada Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Nevada Central (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",34.75],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-116.666666666667],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",1640416.6667],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",19685000],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 11,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "422\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3423, "epsg", 3423,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0."
+        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Nevada Central (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",34.75],PARAMETER[\"central_meridian"
+        "\",-116.666666666667],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",1640416.6667],PARAMETER[\"f"
+        "alse_northing\",19685000],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "422\"]]"},
+    {3423, "epsg", 3423,
         "NAD83 / Nevada West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Nevada West (ftUS)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",34.75],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-118.583333333333],PARAMETER[\"scale_factor\",0.9999],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",2624666.6667],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",13123333.3333],UNIT[\"US survey foot\",0.3");
-    add_srs_wkt (p, 11,
-        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"3423\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3424, "epsg", 3424,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0."
+        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Nevada West (ftUS)\",GEOGCS[\"NAD83\",D"
+        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",34.75],PARAMETER[\"central_meridian\""
+        ",-118.583333333333],PARAMETER[\"scale_factor\",0.9999],P"
+        "ARAMETER[\"false_easting\",2624666.6667],PARAMETER[\"fal"
+        "se_northing\",13123333.3333],UNIT[\"US survey foot\",0.3"
+        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3423\"]]"},
+    {3424, "epsg", 3424,
         "NAD83 / New Jersey (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New Jersey (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",38.8333333333333],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-74.5],PARAMETER[\"scale_factor\",0.9999],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_easting\",492125],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 11,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3424\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3425, "epsg", 3425,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New Jersey (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",38.8333333333333],PARAMETER[\"central"
+        "_meridian\",-74.5],PARAMETER[\"scale_factor\",0.9999],PA"
+        "RAMETER[\"false_easting\",492125],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3424\"]]"},
+    {3425, "epsg", 3425,
         "NAD83(HARN) / Iowa North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99");
-    add_proj4text (p, 2,
-        "99898402 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Iowa North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.5],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"central_meridian\",-93.5],PARAMETER[\"standard");
-    add_srs_wkt (p, 9,
-        "_parallel_1\",43.2666666666667],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",42.0666666666667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "4921250],PARAMETER[\"false_northing\",3280833.3333],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3425\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3426, "epsg", 3426,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666"
+        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99"
+        "99898402 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(HARN) / Iowa North (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.5],PA"
+        "RAMETER[\"central_meridian\",-93.5],PARAMETER[\"standard"
+        "_parallel_1\",43.2666666666667],PARAMETER[\"standard_par"
+        "allel_2\",42.0666666666667],PARAMETER[\"false_easting\","
+        "4921250],PARAMETER[\"false_northing\",3280833.3333],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3425\"]]"},
+    {3426, "epsg", 3426,
         "NAD83(HARN) / Iowa South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Iowa South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-93.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",41.7833333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",40.6166666666667],PARAMETER[\"false_easting\",16");
-    add_srs_wkt (p, 11,
-        "40416.6667],PARAMETER[\"false_northing\",0],UNIT[\"US su");
-    add_srs_wkt (p, 12,
-        "rvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"3426\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3427, "epsg", 3427,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666"
+        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Iowa South (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40],PARA"
+        "METER[\"central_meridian\",-93.5],PARAMETER[\"standard_p"
+        "arallel_1\",41.7833333333333],PARAMETER[\"standard_paral"
+        "lel_2\",40.6166666666667],PARAMETER[\"false_easting\",16"
+        "40416.6667],PARAMETER[\"false_northing\",0],UNIT[\"US su"
+        "rvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3426\"]]"},
+    {3427, "epsg", 3427,
         "NAD83(HARN) / Kansas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u");
-    add_proj4text (p, 3,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kansas North (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38.");
-    add_srs_wkt (p, 8,
-        "3333333333333],PARAMETER[\"central_meridian\",-98],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",39.7833333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",38.7166666666667],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",1312333.3333],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3427\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3428, "epsg", 3428,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666"
+        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999"
+        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Kansas North (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38."
+        "3333333333333],PARAMETER[\"central_meridian\",-98],PARAM"
+        "ETER[\"standard_parallel_1\",39.7833333333333],PARAMETER"
+        "[\"standard_parallel_2\",38.7166666666667],PARAMETER[\"f"
+        "alse_easting\",1312333.3333],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3427\"]]"},
+    {3428, "epsg", 3428,
         "NAD83(HARN) / Kansas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99");
-    add_proj4text (p, 2,
-        "998984 +y_0=399999.99998984 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Kansas South (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.");
-    add_srs_wkt (p, 8,
-        "6666666666667],PARAMETER[\"central_meridian\",-98.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",38.5666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",37.2666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",1312333.3333],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",1312333.3333],UNIT[\"US survey foot\",0.3048006096012");
-    add_srs_wkt (p, 13,
-        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3428\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3429, "epsg", 3429,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666"
+        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99"
+        "998984 +y_0=399999.99998984 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Kansas South (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36."
+        "6666666666667],PARAMETER[\"central_meridian\",-98.5],PAR"
+        "AMETER[\"standard_parallel_1\",38.5666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",37.2666666666667],PARAMETER[\""
+        "false_easting\",1312333.3333],PARAMETER[\"false_northing"
+        "\",1312333.3333],UNIT[\"US survey foot\",0.3048006096012"
+        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3428\"]]"},
+    {3429, "epsg", 3429,
         "NAD83(HARN) / Nevada East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Nevada East (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-115.583333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",65616");
-    add_srs_wkt (p, 10,
-        "6.6667],PARAMETER[\"false_northing\",26246666.6667],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"3429\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3430, "epsg", 3430,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0."
+        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps="
+        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Nevada East (ftUS)\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARAM"
+        "ETER[\"central_meridian\",-115.583333333333],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",65616"
+        "6.6667],PARAMETER[\"false_northing\",26246666.6667],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3429\"]]"},
+    {3430, "epsg", 3430,
         "NAD83(HARN) / Nevada Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Nevada Central (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-116.666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",16");
-    add_srs_wkt (p, 10,
-        "40416.6667],PARAMETER[\"false_northing\",19685000],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"3430\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3431, "epsg", 3431,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0."
+        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Nevada Central (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75],PAR"
+        "AMETER[\"central_meridian\",-116.666666666667],PARAMETER"
+        "[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",16"
+        "40416.6667],PARAMETER[\"false_northing\",19685000],UNIT["
+        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\","
+        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"3430\"]]"},
+    {3431, "epsg", 3431,
         "NAD83(HARN) / Nevada West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Nevada West (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-118.583333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",26246");
-    add_srs_wkt (p, 10,
-        "66.6667],PARAMETER[\"false_northing\",13123333.3333],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"3431\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3432, "epsg", 3432,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0."
+        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Nevada West (ftUS)\",GEOGCS[\"NAD"
+        "83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARAM"
+        "ETER[\"central_meridian\",-118.583333333333],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",26246"
+        "66.6667],PARAMETER[\"false_northing\",13123333.3333],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3431\"]]"},
+    {3432, "epsg", 3432,
         "NAD83(HARN) / New Jersey (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Jersey (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",38.8333333333333");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 9,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",492125],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 11,
-        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 12,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"3432\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3433, "epsg", 3433,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New Jersey (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",38.8333333333333"
+        "],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"scal"
+        "e_factor\",0.9999],PARAMETER[\"false_easting\",492125],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0"
+        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3432\"]]"},
+    {3433, "epsg", 3433,
         "NAD83 / Arkansas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u");
-    add_proj4text (p, 3,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Arkansas North (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",34.3333333333333],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-92],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 9,
-        "l_1\",36.2333333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",34.9333333333333],PARAMETER[\"false_easting\",1312333.3");
-    add_srs_wkt (p, 11,
-        "333],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3433\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3434, "epsg", 3434,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333"
+        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=399999.9999"
+        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83 / Arkansas North (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",34.3333333333333],PARAMETE"
+        "R[\"central_meridian\",-92],PARAMETER[\"standard_paralle"
+        "l_1\",36.2333333333333],PARAMETER[\"standard_parallel_2\""
+        ",34.9333333333333],PARAMETER[\"false_easting\",1312333.3"
+        "333],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3433\"]]"},
+    {3434, "epsg", 3434,
         "NAD83 / Arkansas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-92 +x_0=399999.99998984 +y_0=399");
-    add_proj4text (p, 2,
-        "999.99998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Arkansas South (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",32.6666666666667],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-92],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 9,
-        "l_1\",34.7666666666667],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",33.3],PARAMETER[\"false_easting\",1312333.3333],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_northing\",1312333.3333],UNIT[\"US survey foo");
-    add_srs_wkt (p, 12,
-        "t\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3434\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3435, "epsg", 3435,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32"
+        ".66666666666666 +lon_0=-92 +x_0=399999.99998984 +y_0=399"
+        "999.99998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "us-ft +no_defs",
+        "PROJCS[\"NAD83 / Arkansas South (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",32.6666666666667],PARAMETE"
+        "R[\"central_meridian\",-92],PARAMETER[\"standard_paralle"
+        "l_1\",34.7666666666667],PARAMETER[\"standard_parallel_2\""
+        ",33.3],PARAMETER[\"false_easting\",1312333.3333],PARAMET"
+        "ER[\"false_northing\",1312333.3333],UNIT[\"US survey foo"
+        "t\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3434\"]]"},
+    {3435, "epsg", 3435,
         "NAD83 / Illinois East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333");
-    add_proj4text (p, 1,
-        "333333 +k=0.9999749999999999 +x_0=300000.0000000001 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Illinois East (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",36.6666666666667],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-88.3333333333333],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.999975],PARAMETER[\"false_easting\",984250],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 11,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "435\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3436, "epsg", 3436,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333"
+        "333333 +k=0.9999749999999999 +x_0=300000.0000000001 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83 / Illinois East (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",36.6666666666667],PARAMETER[\"centr"
+        "al_meridian\",-88.3333333333333],PARAMETER[\"scale_facto"
+        "r\",0.999975],PARAMETER[\"false_easting\",984250],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "435\"]]"},
+    {3436, "epsg", 3436,
         "NAD83 / Illinois West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999941177 +x_0=699999.9999898402 +y_0=0 +ell");
-    add_proj4text (p, 2,
-        "ps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Illinois West (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",36.6666666666667],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-90.1666666666667],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.999941177],PARAMETER[\"false_easting\",2296583.333");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot");
-    add_srs_wkt (p, 11,
-        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"3436\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3437, "epsg", 3437,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666"
+        "666667 +k=0.999941177 +x_0=699999.9999898402 +y_0=0 +ell"
+        "ps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Illinois West (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",36.6666666666667],PARAMETER[\"centr"
+        "al_meridian\",-90.1666666666667],PARAMETER[\"scale_facto"
+        "r\",0.999941177],PARAMETER[\"false_easting\",2296583.333"
+        "3],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot"
+        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3436\"]]"},
+    {3437, "epsg", 3437,
         "NAD83 / New Hampshire (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / New Hampshire (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",42.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-71.6666666666667],PARAMETER[\"scale_factor\",0.9999666");
-    add_srs_wkt (p, 9,
-        "67],PARAMETER[\"false_easting\",984250],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_northing\",0],UNIT[\"US survey foot\",0.30480060960121");
-    add_srs_wkt (p, 11,
-        "9,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3437\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3438, "epsg", 3438,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9"
+        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / New Hampshire (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",42.5],PARAMETER[\"central_meridian\""
+        ",-71.6666666666667],PARAMETER[\"scale_factor\",0.9999666"
+        "67],PARAMETER[\"false_easting\",984250],PARAMETER[\"fals"
+        "e_northing\",0],UNIT[\"US survey foot\",0.30480060960121"
+        "9,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3437\"]]"},
+    {3438, "epsg", 3438,
         "NAD83 / Rhode Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Rhode Island (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",41.0833333333333],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-71.5],PARAMETER[\"scale_factor\",0.9999937");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"false_easting\",328083.3333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 11,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3438\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3439, "epsg", 3439,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9"
+        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Rhode Island (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",41.0833333333333],PARAMETER[\"centra"
+        "l_meridian\",-71.5],PARAMETER[\"scale_factor\",0.9999937"
+        "5],PARAMETER[\"false_easting\",328083.3333],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3438\"]"
+        "]"},
+    {3439, "epsg", 3439,
         "PSD93 / UTM zone 39N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "PDO_Survey_Datum_1993", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=clrk80 +towgs84=-180.624,-225.");
-    add_proj4text (p, 1,
-        "516,173.919,-0.81,-1.898,8.336,16.71006 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PSD93 / UTM zone 39N\",GEOGCS[\"PSD93\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "PDO_Survey_Datum_1993\",SPHEROID[\"Clarke 1880 (RGS)\",6");
-    add_srs_wkt (p, 2,
-        "378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6134\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4134\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",51],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3439\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3440, "epsg", 3440,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=39 +ellps=clrk80 +towgs84=-180.624,-225."
+        "516,173.919,-0.81,-1.898,8.336,16.71006 +units=m +no_def"
+        "s",
+        "PROJCS[\"PSD93 / UTM zone 39N\",GEOGCS[\"PSD93\",DATUM[\""
+        "PDO_Survey_Datum_1993\",SPHEROID[\"Clarke 1880 (RGS)\",6"
+        "378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORI"
+        "TY[\"EPSG\",\"6134\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4134\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",51],PA"
+        "RAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_easti"
+        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3439\"]"
+        "]"},
+    {3440, "epsg", 3440,
         "PSD93 / UTM zone 40N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "PDO_Survey_Datum_1993", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=40 +ellps=clrk80 +towgs84=-180.624,-225.");
-    add_proj4text (p, 1,
-        "516,173.919,-0.81,-1.898,8.336,16.71006 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"PSD93 / UTM zone 40N\",GEOGCS[\"PSD93\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "PDO_Survey_Datum_1993\",SPHEROID[\"Clarke 1880 (RGS)\",6");
-    add_srs_wkt (p, 2,
-        "378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6134\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4134\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",57],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3440\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3441, "epsg", 3441,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=40 +ellps=clrk80 +towgs84=-180.624,-225."
+        "516,173.919,-0.81,-1.898,8.336,16.71006 +units=m +no_def"
+        "s",
+        "PROJCS[\"PSD93 / UTM zone 40N\",GEOGCS[\"PSD93\",DATUM[\""
+        "PDO_Survey_Datum_1993\",SPHEROID[\"Clarke 1880 (RGS)\",6"
+        "378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORI"
+        "TY[\"EPSG\",\"6134\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4134\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",57],PA"
+        "RAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_easti"
+        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3440\"]"
+        "]"},
+    {3441, "epsg", 3441,
         "NAD83(HARN) / Arkansas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u");
-    add_proj4text (p, 3,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arkansas North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-92],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",36.2333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",34.9333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",1312333.3333],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3441\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3442, "epsg", 3442,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333"
+        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=399999.9999"
+        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Arkansas North (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34"
+        ".3333333333333],PARAMETER[\"central_meridian\",-92],PARA"
+        "METER[\"standard_parallel_1\",36.2333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",34.9333333333333],PARAMETER[\""
+        "false_easting\",1312333.3333],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3441\"]]"},
+    {3442, "epsg", 3442,
         "NAD83(HARN) / Arkansas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-92 +x_0=399999.99998984 +y_0=399");
-    add_proj4text (p, 2,
-        "999.99998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Arkansas South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",32");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-92],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",34.7666666666667],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",33.3],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",1312333.3333],PARAMETER[\"false_northing\",1312333.3");
-    add_srs_wkt (p, 12,
-        "333],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 14,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3442\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3443, "epsg", 3443,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32"
+        ".66666666666666 +lon_0=-92 +x_0=399999.99998984 +y_0=399"
+        "999.99998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Arkansas South (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",32"
+        ".6666666666667],PARAMETER[\"central_meridian\",-92],PARA"
+        "METER[\"standard_parallel_1\",34.7666666666667],PARAMETE"
+        "R[\"standard_parallel_2\",33.3],PARAMETER[\"false_eastin"
+        "g\",1312333.3333],PARAMETER[\"false_northing\",1312333.3"
+        "333],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY"
+        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3442\"]]"},
+    {3443, "epsg", 3443,
         "NAD83(HARN) / Illinois East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333");
-    add_proj4text (p, 1,
-        "333333 +k=0.9999749999999999 +x_0=300000.0000000001 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Illinois East (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-88.3333333333333]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.999975],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",984250],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"3443\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3444, "epsg", 3444,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333"
+        "333333 +k=0.9999749999999999 +x_0=300000.0000000001 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(HARN) / Illinois East (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.66666666"
+        "66667],PARAMETER[\"central_meridian\",-88.3333333333333]"
+        ",PARAMETER[\"scale_factor\",0.999975],PARAMETER[\"false_"
+        "easting\",984250],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3443\"]]"},
+    {3444, "epsg", 3444,
         "NAD83(HARN) / Illinois West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999941177 +x_0=699999.9999898402 +y_0=0 +ell");
-    add_proj4text (p, 2,
-        "ps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Illinois West (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-90.1666666666667]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",2296583.3333],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3444\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3445, "epsg", 3445,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666"
+        "666667 +k=0.999941177 +x_0=699999.9999898402 +y_0=0 +ell"
+        "ps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Illinois West (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.66666666"
+        "66667],PARAMETER[\"central_meridian\",-90.1666666666667]"
+        ",PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fal"
+        "se_easting\",2296583.3333],PARAMETER[\"false_northing\","
+        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3444\"]]"},
+    {3445, "epsg", 3445,
         "NAD83(HARN) / New Hampshire (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / New Hampshire (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-71.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999966667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "984250],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 11,
-        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"3445\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9"
+        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / New Hampshire (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PARAM"
+        "ETER[\"central_meridian\",-71.6666666666667],PARAMETER[\""
+        "scale_factor\",0.999966667],PARAMETER[\"false_easting\","
+        "984250],PARAMETER[\"false_northing\",0],UNIT[\"US survey"
+        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3445\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_13 = {
+    epsg_defs_13, sizeof (epsg_defs_13) / sizeof (epsg_defs_13[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,4073 +53,2295 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_14 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3446, "epsg", 3446,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_14[] = {
+    {3446, "epsg", 3446,
         "NAD83(HARN) / Rhode Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Rhode Island (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",41.08333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-71.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.99999375],PARAMETER[\"false_easting\",3");
-    add_srs_wkt (p, 10,
-        "28083.3333],PARAMETER[\"false_northing\",0],UNIT[\"US su");
-    add_srs_wkt (p, 11,
-        "rvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"3446\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3447, "epsg", 3447,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9"
+        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Rhode Island (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",41.08333333"
+        "33333],PARAMETER[\"central_meridian\",-71.5],PARAMETER[\""
+        "scale_factor\",0.99999375],PARAMETER[\"false_easting\",3"
+        "28083.3333],PARAMETER[\"false_northing\",0],UNIT[\"US su"
+        "rvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3446\"]]"},
+    {3447, "epsg", 3447,
         "ETRS89 / Belgian Lambert 2005", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49.83333333333334 +lat_2=51.16666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=50.797815 +lon_0=4.359215833333333 +x_0=15032");
-    add_proj4text (p, 2,
-        "8 +y_0=166262 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / Belgian Lambert 2005\",GEOGCS[\"ETRS89");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"European_Terrestrial_Reference_System_1989\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",50.79781");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"central_meridian\",4.35921583333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",49.8333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",51.1666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",150328],PARAMETER[\"false_northing\",166");
-    add_srs_wkt (p, 12,
-        "262],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3447\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3448, "epsg", 3448,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49.83333333333334 +lat_2=51.16666666666"
+        "666 +lat_0=50.797815 +lon_0=4.359215833333333 +x_0=15032"
+        "8 +y_0=166262 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"ETRS89 / Belgian Lambert 2005\",GEOGCS[\"ETRS89"
+        "\",DATUM[\"European_Terrestrial_Reference_System_1989\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",50.79781"
+        "5],PARAMETER[\"central_meridian\",4.35921583333333],PARA"
+        "METER[\"standard_parallel_1\",49.8333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",51.1666666666667],PARAMETER[\""
+        "false_easting\",150328],PARAMETER[\"false_northing\",166"
+        "262],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3447\"]]"},
+    {3448, "epsg", 3448,
         "JAD2001 / Jamaica Metric Grid", 0, 0,
         "WGS 84", "Greenwich",
         "Jamaica_2001", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18 +lat_0=18 +lon_0=-77 +k_0=1 +x_0=750");
-    add_proj4text (p, 1,
-        "000 +y_0=650000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JAD2001 / Jamaica Metric Grid\",GEOGCS[\"JAD200");
-    add_srs_wkt (p, 1,
-        "1\",DATUM[\"Jamaica_2001\",SPHEROID[\"WGS 84\",6378137,2");
-    add_srs_wkt (p, 2,
-        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6758\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4758\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",18],PARAMETER[\"central_meridian\",-77");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",750000],PARAMETER[\"false_northing\",650000],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"344");
-    add_srs_wkt (p, 12,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3449, "epsg", 3449,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=18 +lat_0=18 +lon_0=-77 +k_0=1 +x_0=750"
+        "000 +y_0=650000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=m +no_defs",
+        "PROJCS[\"JAD2001 / Jamaica Metric Grid\",GEOGCS[\"JAD200"
+        "1\",DATUM[\"Jamaica_2001\",SPHEROID[\"WGS 84\",6378137,2"
+        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E"
+        "PSG\",\"6758\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4758\"]],PRO"
+        "JECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"lat"
+        "itude_of_origin\",18],PARAMETER[\"central_meridian\",-77"
+        "],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eastin"
+        "g\",750000],PARAMETER[\"false_northing\",650000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"344"
+        "8\"]]"},
+    {3449, "epsg", 3449,
         "JAD2001 / UTM zone 17N", 0, 0,
         "WGS 84", "Greenwich",
         "Jamaica_2001", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JAD2001 / UTM zone 17N\",GEOGCS[\"JAD2001\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Jamaica_2001\",SPHEROID[\"WGS 84\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6758\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4758\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",-81],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3449\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3450, "epsg", 3450,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"JAD2001 / UTM zone 17N\",GEOGCS[\"JAD2001\",DAT"
+        "UM[\"Jamaica_2001\",SPHEROID[\"WGS 84\",6378137,298.2572"
+        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6758\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4758\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",-81],PARAMETER[\"scal"
+        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3449\"]]"},
+    {3450, "epsg", 3450,
         "JAD2001 / UTM zone 18N", 0, 0,
         "WGS 84", "Greenwich",
         "Jamaica_2001", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"JAD2001 / UTM zone 18N\",GEOGCS[\"JAD2001\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Jamaica_2001\",SPHEROID[\"WGS 84\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6758\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4758\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",-75],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3450\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3451, "epsg", 3451,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"JAD2001 / UTM zone 18N\",GEOGCS[\"JAD2001\",DAT"
+        "UM[\"Jamaica_2001\",SPHEROID[\"WGS 84\",6378137,298.2572"
+        "23563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6758\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4758\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",-75],PARAMETER[\"scal"
+        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3450\"]]"},
+    {3451, "epsg", 3451,
         "NAD83 / Louisiana North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Louisiana North (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"latitude_of_origin\",30.5],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-92.5],PARAMETER[\"standard_parallel_1\",32");
-    add_srs_wkt (p, 9,
-        ".6666666666667],PARAMETER[\"standard_parallel_2\",31.166");
-    add_srs_wkt (p, 10,
-        "6666666667],PARAMETER[\"false_easting\",3280833.3333],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.");
-    add_srs_wkt (p, 12,
-        "304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3451\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3452, "epsg", 3452,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666"
+        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83 / Louisiana North (ftUS)\",GEOGCS[\"NAD83"
+        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],P"
+        "ARAMETER[\"latitude_of_origin\",30.5],PARAMETER[\"centra"
+        "l_meridian\",-92.5],PARAMETER[\"standard_parallel_1\",32"
+        ".6666666666667],PARAMETER[\"standard_parallel_2\",31.166"
+        "6666666667],PARAMETER[\"false_easting\",3280833.3333],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0."
+        "304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3451\"]]"},
+    {3452, "epsg", 3452,
         "NAD83 / Louisiana South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Louisiana South (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"latitude_of_origin\",28.5],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-91.3333333333333],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 9,
-        "allel_1\",30.7],PARAMETER[\"standard_parallel_2\",29.3],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_easting\",3280833.3333],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 12,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3452\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3453, "epsg", 3453,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91"
+        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Louisiana South (ftUS)\",GEOGCS[\"NAD83"
+        "\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],P"
+        "ARAMETER[\"latitude_of_origin\",28.5],PARAMETER[\"centra"
+        "l_meridian\",-91.3333333333333],PARAMETER[\"standard_par"
+        "allel_1\",30.7],PARAMETER[\"standard_parallel_2\",29.3],"
+        "PARAMETER[\"false_easting\",3280833.3333],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3452\"]]"},
+    {3453, "epsg", 3453,
         "NAD83 / Louisiana Offshore (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.5 +lon_0=-91.33333333333333 +x_0=999999.99");
-    add_proj4text (p, 2,
-        "99898402 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Louisiana Offshore (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",25.5],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-91.3333333333333],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",27.8333333333333],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 10,
-        "el_2\",26.1666666666667],PARAMETER[\"false_easting\",328");
-    add_srs_wkt (p, 11,
-        "0833.3333],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 12,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"3453\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3454, "epsg", 3454,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666"
+        "667 +lat_0=25.5 +lon_0=-91.33333333333333 +x_0=999999.99"
+        "99898402 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Louisiana Offshore (ftUS)\",GEOGCS[\"NA"
+        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",25.5],PARAMETER[\"centr"
+        "al_meridian\",-91.3333333333333],PARAMETER[\"standard_pa"
+        "rallel_1\",27.8333333333333],PARAMETER[\"standard_parall"
+        "el_2\",26.1666666666667],PARAMETER[\"false_easting\",328"
+        "0833.3333],PARAMETER[\"false_northing\",0],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3453\"]]"},
+    {3454, "epsg", 3454,
         "NAD83 / South Dakota North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / South Dakota North (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",43.8333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-100],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 9,
-        "allel_1\",45.6833333333333],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",44.4166666666667],PARAMETER[\"false_easting\",1968");
-    add_srs_wkt (p, 11,
-        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"4457\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3455, "epsg", 3455,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42"
+        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +n"
+        "o_defs",
+        "PROJCS[\"NAD83 / South Dakota North (ftUS)\",GEOGCS[\"NA"
+        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",43.8333333333333],PARAM"
+        "ETER[\"central_meridian\",-100],PARAMETER[\"standard_par"
+        "allel_1\",45.6833333333333],PARAMETER[\"standard_paralle"
+        "l_2\",44.4166666666667],PARAMETER[\"false_easting\",1968"
+        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"4457\"]]"},
+    {3455, "epsg", 3455,
         "NAD83 / South Dakota South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / South Dakota South (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",42.3333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-100.333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",44.4],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",42.8333333333333],PARAMETER[\"false_easting\",1968");
-    add_srs_wkt (p, 11,
-        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3455\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3456, "epsg", 3456,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42"
+        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +n"
+        "o_defs",
+        "PROJCS[\"NAD83 / South Dakota South (ftUS)\",GEOGCS[\"NA"
+        "D83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",42.3333333333333],PARAM"
+        "ETER[\"central_meridian\",-100.333333333333],PARAMETER[\""
+        "standard_parallel_1\",44.4],PARAMETER[\"standard_paralle"
+        "l_2\",42.8333333333333],PARAMETER[\"false_easting\",1968"
+        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3455\"]]"},
+    {3456, "epsg", 3456,
         "NAD83(HARN) / Louisiana North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Louisiana North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",30");
-    add_srs_wkt (p, 8,
-        ".5],PARAMETER[\"central_meridian\",-92.5],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_1\",32.6666666666667],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",31.1666666666667],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",3280833.3333],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3456\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3457, "epsg", 3457,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666"
+        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(HARN) / Louisiana North (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",30"
+        ".5],PARAMETER[\"central_meridian\",-92.5],PARAMETER[\"st"
+        "andard_parallel_1\",32.6666666666667],PARAMETER[\"standa"
+        "rd_parallel_2\",31.1666666666667],PARAMETER[\"false_east"
+        "ing\",3280833.3333],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3456\"]]"},
+    {3457, "epsg", 3457,
         "NAD83(HARN) / Louisiana South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Louisiana South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw");
-    add_srs_wkt (p, 2,
-        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",28");
-    add_srs_wkt (p, 8,
-        ".5],PARAMETER[\"central_meridian\",-91.3333333333333],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",30.7],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",29.3],PARAMETER[\"false_easting\",328083");
-    add_srs_wkt (p, 11,
-        "3.3333],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 12,
-        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"3457\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3458, "epsg", 3458,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91"
+        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Louisiana South (ftUS)\",GEOGCS[\""
+        "NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netw"
+        "ork\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",28"
+        ".5],PARAMETER[\"central_meridian\",-91.3333333333333],PA"
+        "RAMETER[\"standard_parallel_1\",30.7],PARAMETER[\"standa"
+        "rd_parallel_2\",29.3],PARAMETER[\"false_easting\",328083"
+        "3.3333],PARAMETER[\"false_northing\",0],UNIT[\"US survey"
+        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3457\"]]"},
+    {3458, "epsg", 3458,
         "NAD83(HARN) / South Dakota North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / South Dakota North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_");
-    add_srs_wkt (p, 2,
-        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",43.8333333333333],PARAMETER[\"central_meridian\",-100");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",45.6833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",44.4166666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1968500],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3458\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3459, "epsg", 3459,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666"
+        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no"
+        "_defs",
+        "PROJCS[\"NAD83(HARN) / South Dakota North (ftUS)\",GEOGC"
+        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_"
+        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",43.8333333333333],PARAMETER[\"central_meridian\",-100"
+        "],PARAMETER[\"standard_parallel_1\",45.6833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",44.4166666666667],PARAME"
+        "TER[\"false_easting\",1968500],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORI"
+        "TY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3458\"]]"},
+    {3459, "epsg", 3459,
         "NAD83(HARN) / South Dakota South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / South Dakota South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_");
-    add_srs_wkt (p, 2,
-        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",42.3333333333333],PARAMETER[\"central_meridian\",-100");
-    add_srs_wkt (p, 9,
-        ".333333333333],PARAMETER[\"standard_parallel_1\",44.4],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",42.8333333333333],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",1968500],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 14,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"3459\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3460, "epsg", 3460,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42"
+        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +n"
+        "o_defs",
+        "PROJCS[\"NAD83(HARN) / South Dakota South (ftUS)\",GEOGC"
+        "S[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_"
+        "Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",42.3333333333333],PARAMETER[\"central_meridian\",-100"
+        ".333333333333],PARAMETER[\"standard_parallel_1\",44.4],P"
+        "ARAMETER[\"standard_parallel_2\",42.8333333333333],PARAM"
+        "ETER[\"false_easting\",1968500],PARAMETER[\"false_northi"
+        "ng\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHOR"
+        "ITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"3459\"]]"},
+    {3460, "epsg", 3460,
         "Fiji 1986 / Fiji Map Grid", 0, 0,
         "WGS 72", "Greenwich",
         "Fiji_Geodetic_Datum_1986", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-17 +lon_0=178.75 +k=0.99985 +x_0=200");
-    add_proj4text (p, 1,
-        "0000 +y_0=4000000 +ellps=WGS72 +towgs84=0,0,4.5,0,0,0.55");
-    add_proj4text (p, 2,
-        "4,0.2263 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fiji 1986 / Fiji Map Grid\",GEOGCS[\"Fiji 1986\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Fiji_Geodetic_Datum_1986\",SPHEROID[\"WGS 72\",");
-    add_srs_wkt (p, 2,
-        "6378135,298.26,AUTHORITY[\"EPSG\",\"7043\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6720\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4720\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",-17],PARAMETER[\"central_meridian\",178.75],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"scale_factor\",0.99985],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",2000000],PARAMETER[\"false_northing\",4000000],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3460\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3461, "epsg", 3461,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-17 +lon_0=178.75 +k=0.99985 +x_0=200"
+        "0000 +y_0=4000000 +ellps=WGS72 +towgs84=0,0,4.5,0,0,0.55"
+        "4,0.2263 +units=m +no_defs",
+        "PROJCS[\"Fiji 1986 / Fiji Map Grid\",GEOGCS[\"Fiji 1986\""
+        ",DATUM[\"Fiji_Geodetic_Datum_1986\",SPHEROID[\"WGS 72\","
+        "6378135,298.26,AUTHORITY[\"EPSG\",\"7043\"]],AUTHORITY[\""
+        "EPSG\",\"6720\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4720\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",-17],PARAMETER[\"central_meridian\",178.75],P"
+        "ARAMETER[\"scale_factor\",0.99985],PARAMETER[\"false_eas"
+        "ting\",2000000],PARAMETER[\"false_northing\",4000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3460\"]]"},
+    {3461, "epsg", 3461,
         "Dabola 1981 / UTM zone 28N", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Dabola_1981", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +a=6378249.2 +b=6356515 +towgs84=-83,");
-    add_proj4text (p, 1,
-        "37,124,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Dabola 1981 / UTM zone 28N\",GEOGCS[\"Dabola 19");
-    add_srs_wkt (p, 1,
-        "81\",DATUM[\"Dabola_1981\",SPHEROID[\"Clarke 1880 (IGN)\"");
-    add_srs_wkt (p, 2,
-        ",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6155\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4155\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3461\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3462, "epsg", 3462,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +a=6378249.2 +b=6356515 +towgs84=-83,"
+        "37,124,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Dabola 1981 / UTM zone 28N\",GEOGCS[\"Dabola 19"
+        "81\",DATUM[\"Dabola_1981\",SPHEROID[\"Clarke 1880 (IGN)\""
+        ",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]"
+        "],AUTHORITY[\"EPSG\",\"6155\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4155\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3461\"]]"},
+    {3462, "epsg", 3462,
         "Dabola 1981 / UTM zone 29N", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Dabola_1981", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +a=6378249.2 +b=6356515 +towgs84=-83,");
-    add_proj4text (p, 1,
-        "37,124,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Dabola 1981 / UTM zone 29N\",GEOGCS[\"Dabola 19");
-    add_srs_wkt (p, 1,
-        "81\",DATUM[\"Dabola_1981\",SPHEROID[\"Clarke 1880 (IGN)\"");
-    add_srs_wkt (p, 2,
-        ",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6155\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4155\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3462\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3463, "epsg", 3463,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=29 +a=6378249.2 +b=6356515 +towgs84=-83,"
+        "37,124,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Dabola 1981 / UTM zone 29N\",GEOGCS[\"Dabola 19"
+        "81\",DATUM[\"Dabola_1981\",SPHEROID[\"Clarke 1880 (IGN)\""
+        ",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]"
+        "],AUTHORITY[\"EPSG\",\"6155\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4155\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3462\"]]"},
+    {3463, "epsg", 3463,
         "NAD83 / Maine CS2000 Central", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Maine CS2000 Central\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",43.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-69.125],PARAMETER[\"scale_factor\",0.99998],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3463\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3464, "epsg", 3464,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5"
+        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83 / Maine CS2000 Central\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",43.5],PARAMETER[\"central_meridian\""
+        ",-69.125],PARAMETER[\"scale_factor\",0.99998],PARAMETER["
+        "\"false_easting\",500000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3463\"]]"},
+    {3464, "epsg", 3464,
         "NAD83(HARN) / Maine CS2000 Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Maine CS2000 Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",43.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-69.125],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.99998],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3464\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3465, "epsg", 3465,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5"
+        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Maine CS2000 Central\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",43.5],PARAM"
+        "ETER[\"central_meridian\",-69.125],PARAMETER[\"scale_fac"
+        "tor\",0.99998],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3464\"]]"},
+    {3465, "epsg", 3465,
         "NAD83(NSRS2007) / Alabama East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30.5 +lon_0=-85.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9996 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alabama East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-85.8333333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.99996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",200000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3465\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3466, "epsg", 3466,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30.5 +lon_0=-85.83333333333333 +k=0.9"
+        "9996 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alabama East\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30.5"
+        "],PARAMETER[\"central_meridian\",-85.8333333333333],PARA"
+        "METER[\"scale_factor\",0.99996],PARAMETER[\"false_eastin"
+        "g\",200000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3465\"]]"},
+    {3466, "epsg", 3466,
         "NAD83(NSRS2007) / Alabama West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-87.5 +k=0.999933333 +x_0=6");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alabama West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-87.5],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.999933333],PARAMETER[\"false_easting\",600000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3466\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3467, "epsg", 3467,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-87.5 +k=0.999933333 +x_0=6"
+        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alabama West\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],"
+        "PARAMETER[\"central_meridian\",-87.5],PARAMETER[\"scale_"
+        "factor\",0.999933333],PARAMETER[\"false_easting\",600000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3466\"]]"},
+    {3467, "epsg", 3467,
         "NAD83(NSRS2007) / Alaska Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0");
-    add_proj4text (p, 1,
-        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska Albers\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Al");
-    add_srs_wkt (p, 7,
-        "bers_Conic_Equal_Area\"],PARAMETER[\"latitude_of_center\"");
-    add_srs_wkt (p, 8,
-        ",50],PARAMETER[\"longitude_of_center\",-154],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",55],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",65],PARAMETER[\"false_easting\",0],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"3467\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3468, "epsg", 3468,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0"
+        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska Albers\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Al"
+        "bers_Conic_Equal_Area\"],PARAMETER[\"latitude_of_center\""
+        ",50],PARAMETER[\"longitude_of_center\",-154],PARAMETER[\""
+        "standard_parallel_1\",55],PARAMETER[\"standard_parallel_"
+        "2\",65],PARAMETER[\"false_easting\",0],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3467\"]]"},
+    {3468, "epsg", 3468,
         "NAD83(NSRS2007) / Alaska zone 1", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=57 +lonc=-133.6666666666667 +alpha=32");
-    add_proj4text (p, 1,
-        "3.1301023611111 +k=0.9999 +x_0=5000000 +y_0=-5000000 +no");
-    add_proj4text (p, 2,
-        "_uoff +gamma=323.1301023611111 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 1\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Ho");
-    add_srs_wkt (p, 7,
-        "tine_Oblique_Mercator\"],PARAMETER[\"latitude_of_center\"");
-    add_srs_wkt (p, 8,
-        ",57],PARAMETER[\"longitude_of_center\",-133.666666666667");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"azimuth\",323.130102361111],PARAMETER[\"re");
-    add_srs_wkt (p, 10,
-        "ctified_grid_angle\",323.130102361111],PARAMETER[\"scale");
-    add_srs_wkt (p, 11,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",5000000],P");
-    add_srs_wkt (p, 12,
-        "ARAMETER[\"false_northing\",-5000000],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3468\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3469, "epsg", 3469,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=57 +lonc=-133.6666666666667 +alpha=32"
+        "3.1301023611111 +k=0.9999 +x_0=5000000 +y_0=-5000000 +no"
+        "_uoff +gamma=323.1301023611111 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 1\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Ho"
+        "tine_Oblique_Mercator\"],PARAMETER[\"latitude_of_center\""
+        ",57],PARAMETER[\"longitude_of_center\",-133.666666666667"
+        "],PARAMETER[\"azimuth\",323.130102361111],PARAMETER[\"re"
+        "ctified_grid_angle\",323.130102361111],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",5000000],P"
+        "ARAMETER[\"false_northing\",-5000000],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3468\"]]"},
+    {3469, "epsg", 3469,
         "NAD83(NSRS2007) / Alaska zone 2", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-142 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 2\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-142],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3469\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3470, "epsg", 3470,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-142 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 2\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54"
+        "],PARAMETER[\"central_meridian\",-142],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3469\"]]"},
+    {3470, "epsg", 3470,
         "NAD83(NSRS2007) / Alaska zone 3", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-146 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 3\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-146],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3470\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3471, "epsg", 3471,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-146 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 3\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54"
+        "],PARAMETER[\"central_meridian\",-146],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3470\"]]"},
+    {3471, "epsg", 3471,
         "NAD83(NSRS2007) / Alaska zone 4", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-150 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 4\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-150],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3471\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3472, "epsg", 3472,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-150 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 4\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54"
+        "],PARAMETER[\"central_meridian\",-150],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3471\"]]"},
+    {3472, "epsg", 3472,
         "NAD83(NSRS2007) / Alaska zone 5", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-154 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 5\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-154],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3472\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3473, "epsg", 3473,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-154 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 5\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54"
+        "],PARAMETER[\"central_meridian\",-154],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3472\"]]"},
+    {3473, "epsg", 3473,
         "NAD83(NSRS2007) / Alaska zone 6", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-158 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 6\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-158],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3473\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3474, "epsg", 3474,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-158 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 6\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54"
+        "],PARAMETER[\"central_meridian\",-158],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3473\"]]"},
+    {3474, "epsg", 3474,
         "NAD83(NSRS2007) / Alaska zone 7", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-162 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 7\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-162],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3474\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3475, "epsg", 3475,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-162 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 7\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54"
+        "],PARAMETER[\"central_meridian\",-162],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3474\"]]"},
+    {3475, "epsg", 3475,
         "NAD83(NSRS2007) / Alaska zone 8", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-166 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 8\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-166],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3475\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3476, "epsg", 3476,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-166 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 8\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54"
+        "],PARAMETER[\"central_meridian\",-166],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3475\"]]"},
+    {3476, "epsg", 3476,
         "NAD83(NSRS2007) / Alaska zone 9", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-170 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 9\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-170],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3476\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3477, "epsg", 3477,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-170 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 9\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",54"
+        "],PARAMETER[\"central_meridian\",-170],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3476\"]]"},
+    {3477, "epsg", 3477,
         "NAD83(NSRS2007) / Alaska zone 10", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=53.83333333333334 +lat_2=51.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=51 +lon_0=-176 +x_0=1000000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 10\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",51],PARAMETER[\"central_meridian\",-176],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",53.8333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",51.8333333333333],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",1000000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "3477\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3478, "epsg", 3478,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=53.83333333333334 +lat_2=51.83333333333"
+        "334 +lat_0=51 +lon_0=-176 +x_0=1000000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Alaska zone 10\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",51],PARAMETER[\"central_meridian\",-176],PARAMETE"
+        "R[\"standard_parallel_1\",53.8333333333333],PARAMETER[\""
+        "standard_parallel_2\",51.8333333333333],PARAMETER[\"fals"
+        "e_easting\",1000000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3477\"]]"},
+    {3478, "epsg", 3478,
         "NAD83(NSRS2007) / Arizona Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arizona Central\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"central_meridian\",-111.916666666667],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",213360],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3478\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3479, "epsg", 3479,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arizona Central\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3"
+        "1],PARAMETER[\"central_meridian\",-111.916666666667],PAR"
+        "AMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eastin"
+        "g\",213360],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3478\"]]"},
+    {3479, "epsg", 3479,
         "NAD83(NSRS2007) / Arizona Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arizona Central (ft)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",31],PARAMETER[\"central_meridian\",-111.91666666666");
-    add_srs_wkt (p, 9,
-        "7],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",700000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3479\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3480, "epsg", 3480,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arizona Central (ft)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",31],PARAMETER[\"central_meridian\",-111.91666666666"
+        "7],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_"
+        "easting\",700000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3479\"]]"},
+    {3480, "epsg", 3480,
         "NAD83(NSRS2007) / Arizona East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arizona East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-110.166666666667],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",213360],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3480\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3481, "epsg", 3481,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arizona East\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],"
+        "PARAMETER[\"central_meridian\",-110.166666666667],PARAME"
+        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",213360],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3480\"]]"},
+    {3481, "epsg", 3481,
         "NAD83(NSRS2007) / Arizona East (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arizona East (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",31],PARAMETER[\"central_meridian\",-110.166666666667],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",700000],PARAMETER[\"false_northing\",0],UNIT[\"foo");
-    add_srs_wkt (p, 11,
-        "t\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"348");
-    add_srs_wkt (p, 13,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3482, "epsg", 3482,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arizona East (ft)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",31],PARAMETER[\"central_meridian\",-110.166666666667],P"
+        "ARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_east"
+        "ing\",700000],PARAMETER[\"false_northing\",0],UNIT[\"foo"
+        "t\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"348"
+        "1\"]]"},
+    {3482, "epsg", 3482,
         "NAD83(NSRS2007) / Arizona West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0");
-    add_proj4text (p, 1,
-        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arizona West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-113.75],PARAMETER[\"scal");
-    add_srs_wkt (p, 9,
-        "e_factor\",0.999933333],PARAMETER[\"false_easting\",2133");
-    add_srs_wkt (p, 10,
-        "60],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 11,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3482\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3483, "epsg", 3483,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0"
+        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arizona West\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],"
+        "PARAMETER[\"central_meridian\",-113.75],PARAMETER[\"scal"
+        "e_factor\",0.999933333],PARAMETER[\"false_easting\",2133"
+        "60],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3482\"]]"},
+    {3483, "epsg", 3483,
         "NAD83(NSRS2007) / Arizona West (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0");
-    add_proj4text (p, 1,
-        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arizona West (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",31],PARAMETER[\"central_meridian\",-113.75],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999933333],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.");
-    add_srs_wkt (p, 11,
-        "3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3483\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3484, "epsg", 3484,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0"
+        "=213360 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arizona West (ft)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",31],PARAMETER[\"central_meridian\",-113.75],PARAMETER[\""
+        "scale_factor\",0.999933333],PARAMETER[\"false_easting\","
+        "700000],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0."
+        "3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3483\"]]"},
+    {3484, "epsg", 3484,
         "NAD83(NSRS2007) / Arkansas North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=400000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arkansas North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",34.3333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-92],PARAMETER[\"standard_parallel_1\",36.2333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",34.9333333333333],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",400000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"3484\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3485, "epsg", 3485,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333"
+        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=400000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arkansas North\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",34.3333333333333],PARAMETER[\"central_meridian\","
+        "-92],PARAMETER[\"standard_parallel_1\",36.2333333333333]"
+        ",PARAMETER[\"standard_parallel_2\",34.9333333333333],PAR"
+        "AMETER[\"false_easting\",400000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3484\"]]"},
+    {3485, "epsg", 3485,
         "NAD83(NSRS2007) / Arkansas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u");
-    add_proj4text (p, 3,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arkansas North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",34.3333333333333],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-92],PARAMETER[\"standard_parallel_1\",36.23333333");
-    add_srs_wkt (p, 10,
-        "33333],PARAMETER[\"standard_parallel_2\",34.933333333333");
-    add_srs_wkt (p, 11,
-        "3],PARAMETER[\"false_easting\",1312333.3333],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 13,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3485\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3486, "epsg", 3486,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333"
+        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=399999.9999"
+        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arkansas North (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",34.3333333333333],PARAMETER[\"central_merid"
+        "ian\",-92],PARAMETER[\"standard_parallel_1\",36.23333333"
+        "33333],PARAMETER[\"standard_parallel_2\",34.933333333333"
+        "3],PARAMETER[\"false_easting\",1312333.3333],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3485\"]"
+        "]"},
+    {3486, "epsg", 3486,
         "NAD83(NSRS2007) / Arkansas South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-92 +x_0=400000 +y_0=400000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arkansas South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",32.6666666666667],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-92],PARAMETER[\"standard_parallel_1\",34.7666666666667]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",33.3],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_easting\",400000],PARAMETER[\"false_northing\",400000");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"3486\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3487, "epsg", 3487,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32"
+        ".66666666666666 +lon_0=-92 +x_0=400000 +y_0=400000 +ellp"
+        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arkansas South\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",32.6666666666667],PARAMETER[\"central_meridian\","
+        "-92],PARAMETER[\"standard_parallel_1\",34.7666666666667]"
+        ",PARAMETER[\"standard_parallel_2\",33.3],PARAMETER[\"fal"
+        "se_easting\",400000],PARAMETER[\"false_northing\",400000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3486\"]]"},
+    {3487, "epsg", 3487,
         "NAD83(NSRS2007) / Arkansas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-92 +x_0=399999.99998984 +y_0=399");
-    add_proj4text (p, 2,
-        "999.99998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Arkansas South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",32.6666666666667],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-92],PARAMETER[\"standard_parallel_1\",34.76666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"standard_parallel_2\",33.3],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",1312333.3333],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",1312333.3333],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 13,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3487\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3488, "epsg", 3488,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32"
+        ".66666666666666 +lon_0=-92 +x_0=399999.99998984 +y_0=399"
+        "999.99998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Arkansas South (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",32.6666666666667],PARAMETER[\"central_merid"
+        "ian\",-92],PARAMETER[\"standard_parallel_1\",34.76666666"
+        "66667],PARAMETER[\"standard_parallel_2\",33.3],PARAMETER"
+        "[\"false_easting\",1312333.3333],PARAMETER[\"false_north"
+        "ing\",1312333.3333],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3487\"]"
+        "]"},
+    {3488, "epsg", 3488,
         "NAD83(NSRS2007) / California Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=-4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California Albers\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Albers_Conic_Equal_Area\"],PARAMETER[\"latitude_of_cen");
-    add_srs_wkt (p, 8,
-        "ter\",0],PARAMETER[\"longitude_of_center\",-120],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",34],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",40.5],PARAMETER[\"false_easting\",0],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",-4000000],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3488\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3489, "epsg", 3489,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_"
+        "0=0 +y_0=-4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California Albers\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Albers_Conic_Equal_Area\"],PARAMETER[\"latitude_of_cen"
+        "ter\",0],PARAMETER[\"longitude_of_center\",-120],PARAMET"
+        "ER[\"standard_parallel_1\",34],PARAMETER[\"standard_para"
+        "llel_2\",40.5],PARAMETER[\"false_easting\",0],PARAMETER["
+        "\"false_northing\",-4000000],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3488\"]]"},
+    {3489, "epsg", 3489,
         "NAD83(NSRS2007) / California zone 1", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3");
-    add_proj4text (p, 1,
-        "3333333333334 +lon_0=-122 +x_0=2000000 +y_0=500000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 1\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",39.3333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-122],PARAMETER[\"standard_parallel_1\",41.6666666666");
-    add_srs_wkt (p, 10,
-        "667],PARAMETER[\"standard_parallel_2\",40],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",2000000],PARAMETER[\"false_northing\",500");
-    add_srs_wkt (p, 12,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3489\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3490, "epsg", 3490,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3"
+        "3333333333334 +lon_0=-122 +x_0=2000000 +y_0=500000 +ellp"
+        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 1\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",39.3333333333333],PARAMETER[\"central_meridian"
+        "\",-122],PARAMETER[\"standard_parallel_1\",41.6666666666"
+        "667],PARAMETER[\"standard_parallel_2\",40],PARAMETER[\"f"
+        "alse_easting\",2000000],PARAMETER[\"false_northing\",500"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3489\"]]"},
+    {3490, "epsg", 3490,
         "NAD83(NSRS2007) / California zone 1 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3");
-    add_proj4text (p, 1,
-        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000");
-    add_proj4text (p, 2,
-        "00.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 1 (ftUS)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_");
-    add_srs_wkt (p, 2,
-        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",39.3333333333333],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-122],PARAMETER[\"standard_parallel_1\",41.6666");
-    add_srs_wkt (p, 10,
-        "666666667],PARAMETER[\"standard_parallel_2\",40],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_easting\",6561666.667],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 12,
-        "hing\",1640416.667],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 13,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3490\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3491, "epsg", 3491,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3"
+        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000"
+        "00.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 1 (ftUS)\",GE"
+        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_"
+        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",39.3333333333333],PARAMETER[\"central_me"
+        "ridian\",-122],PARAMETER[\"standard_parallel_1\",41.6666"
+        "666666667],PARAMETER[\"standard_parallel_2\",40],PARAMET"
+        "ER[\"false_easting\",6561666.667],PARAMETER[\"false_nort"
+        "hing\",1640416.667],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3490\"]"
+        "]"},
+    {3491, "epsg", 3491,
         "NAD83(NSRS2007) / California zone 2", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000 +y");
-    add_proj4text (p, 2,
-        "_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 2\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",37.6666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-122],PARAMETER[\"standard_parallel_1\",39.8333333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"standard_parallel_2\",38.3333333333333]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",2000000],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"3491\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3492, "epsg", 3492,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333"
+        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000 +y"
+        "_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 2\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",37.6666666666667],PARAMETER[\"central_meridian"
+        "\",-122],PARAMETER[\"standard_parallel_1\",39.8333333333"
+        "333],PARAMETER[\"standard_parallel_2\",38.3333333333333]"
+        ",PARAMETER[\"false_easting\",2000000],PARAMETER[\"false_"
+        "northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3491\"]]"},
+    {3492, "epsg", 3492,
         "NAD83(NSRS2007) / California zone 2 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00");
-    add_proj4text (p, 2,
-        "01016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 2 (ftUS)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_");
-    add_srs_wkt (p, 2,
-        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",37.6666666666667],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-122],PARAMETER[\"standard_parallel_1\",39.8333");
-    add_srs_wkt (p, 10,
-        "333333333],PARAMETER[\"standard_parallel_2\",38.33333333");
-    add_srs_wkt (p, 11,
-        "33333],PARAMETER[\"false_easting\",6561666.667],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_northing\",1640416.667],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 13,
-        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"3492\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3493, "epsg", 3493,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333"
+        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00"
+        "01016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,0,0"
+        ",0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 2 (ftUS)\",GE"
+        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_"
+        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",37.6666666666667],PARAMETER[\"central_me"
+        "ridian\",-122],PARAMETER[\"standard_parallel_1\",39.8333"
+        "333333333],PARAMETER[\"standard_parallel_2\",38.33333333"
+        "33333],PARAMETER[\"false_easting\",6561666.667],PARAMETE"
+        "R[\"false_northing\",1640416.667],UNIT[\"US survey foot\""
+        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3492\"]]"},
+    {3493, "epsg", 3493,
         "NAD83(NSRS2007) / California zone 3", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000 +y_0=500000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 3\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",36.5],PARAMETER[\"central_meridian\",-120.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",38.4333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",37.0666666666667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",2000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"3493\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3494, "epsg", 3494,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666"
+        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000 +y_0=500000 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 3\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",36.5],PARAMETER[\"central_meridian\",-120.5],P"
+        "ARAMETER[\"standard_parallel_1\",38.4333333333333],PARAM"
+        "ETER[\"standard_parallel_2\",37.0666666666667],PARAMETER"
+        "[\"false_easting\",2000000],PARAMETER[\"false_northing\""
+        ",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3493\"]]"},
+    {3494, "epsg", 3494,
         "NAD83(NSRS2007) / California zone 3 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0=");
-    add_proj4text (p, 2,
-        "500000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 3 (ftUS)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_");
-    add_srs_wkt (p, 2,
-        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",36.5],PARAMETER[\"central_meridian\",-12");
-    add_srs_wkt (p, 9,
-        "0.5],PARAMETER[\"standard_parallel_1\",38.4333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",37.0666666666667],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",6561666.667],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",1640416.667],UNIT[\"US survey foot\",0.304800");
-    add_srs_wkt (p, 13,
-        "609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"349");
-    add_srs_wkt (p, 15,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3495, "epsg", 3495,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666"
+        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0="
+        "500000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 3 (ftUS)\",GE"
+        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_"
+        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",36.5],PARAMETER[\"central_meridian\",-12"
+        "0.5],PARAMETER[\"standard_parallel_1\",38.4333333333333]"
+        ",PARAMETER[\"standard_parallel_2\",37.0666666666667],PAR"
+        "AMETER[\"false_easting\",6561666.667],PARAMETER[\"false_"
+        "northing\",1640416.667],UNIT[\"US survey foot\",0.304800"
+        "609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"349"
+        "4\"]]"},
+    {3495, "epsg", 3495,
         "NAD83(NSRS2007) / California zone 4", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333");
-    add_proj4text (p, 1,
-        "4 +lon_0=-119 +x_0=2000000 +y_0=500000 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 4\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",35.3333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-119],PARAMETER[\"standard_parallel_1\",37.25],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",36],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",2000000],PARAMETER[\"false_northing\",500000],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"349");
-    add_srs_wkt (p, 14,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3496, "epsg", 3496,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333"
+        "4 +lon_0=-119 +x_0=2000000 +y_0=500000 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 4\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",35.3333333333333],PARAMETER[\"central_meridian"
+        "\",-119],PARAMETER[\"standard_parallel_1\",37.25],PARAME"
+        "TER[\"standard_parallel_2\",36],PARAMETER[\"false_eastin"
+        "g\",2000000],PARAMETER[\"false_northing\",500000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"349"
+        "5\"]]"},
+    {3496, "epsg", 3496,
         "NAD83(NSRS2007) / California zone 4 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333");
-    add_proj4text (p, 1,
-        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600");
-    add_proj4text (p, 2,
-        "1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 4 (ftUS)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_");
-    add_srs_wkt (p, 2,
-        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",35.3333333333333],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-119],PARAMETER[\"standard_parallel_1\",37.25],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",36],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",6561666.667],PARAMETER[\"false_northing\",1640");
-    add_srs_wkt (p, 12,
-        "416.667],UNIT[\"US survey foot\",0.304800609601219,AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 14,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3496\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3497, "epsg", 3497,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333"
+        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600"
+        "1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d"
+        "efs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 4 (ftUS)\",GE"
+        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_"
+        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",35.3333333333333],PARAMETER[\"central_me"
+        "ridian\",-119],PARAMETER[\"standard_parallel_1\",37.25],"
+        "PARAMETER[\"standard_parallel_2\",36],PARAMETER[\"false_"
+        "easting\",6561666.667],PARAMETER[\"false_northing\",1640"
+        "416.667],UNIT[\"US survey foot\",0.304800609601219,AUTHO"
+        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3496\"]]"},
+    {3497, "epsg", 3497,
         "NAD83(NSRS2007) / California zone 5", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000 +y_0=500000 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 5\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",33.5],PARAMETER[\"central_meridian\",-118],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",35.4666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",34.0333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",2000000],PARAMETER[\"false_northing\",50");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3497\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3498, "epsg", 3498,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333"
+        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000 +y_0=500000 +el"
+        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 5\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",33.5],PARAMETER[\"central_meridian\",-118],PAR"
+        "AMETER[\"standard_parallel_1\",35.4666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",34.0333333333333],PARAMETER[\""
+        "false_easting\",2000000],PARAMETER[\"false_northing\",50"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3497\"]]"},
+    {3498, "epsg", 3498,
         "NAD83(NSRS2007) / California zone 5 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50");
-    add_proj4text (p, 2,
-        "0000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 5 (ftUS)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_");
-    add_srs_wkt (p, 2,
-        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",33.5],PARAMETER[\"central_meridian\",-11");
-    add_srs_wkt (p, 9,
-        "8],PARAMETER[\"standard_parallel_1\",35.4666666666667],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",34.0333333333333],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",6561666.667],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",1640416.667],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 13,
-        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3498\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3499, "epsg", 3499,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333"
+        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50"
+        "0000.0001016001 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 5 (ftUS)\",GE"
+        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_"
+        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",33.5],PARAMETER[\"central_meridian\",-11"
+        "8],PARAMETER[\"standard_parallel_1\",35.4666666666667],P"
+        "ARAMETER[\"standard_parallel_2\",34.0333333333333],PARAM"
+        "ETER[\"false_easting\",6561666.667],PARAMETER[\"false_no"
+        "rthing\",1640416.667],UNIT[\"US survey foot\",0.30480060"
+        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3498\""
+        "]]"},
+    {3499, "epsg", 3499,
         "NAD83(NSRS2007) / California zone 6", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000");
-    add_proj4text (p, 2,
-        " +y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 6\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",32.1666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-116.25],PARAMETER[\"standard_parallel_1\",33.8833333");
-    add_srs_wkt (p, 10,
-        "333333],PARAMETER[\"standard_parallel_2\",32.78333333333");
-    add_srs_wkt (p, 11,
-        "33],PARAMETER[\"false_easting\",2000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3499\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3500, "epsg", 3500,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333"
+        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000"
+        " +y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 6\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",32.1666666666667],PARAMETER[\"central_meridian"
+        "\",-116.25],PARAMETER[\"standard_parallel_1\",33.8833333"
+        "333333],PARAMETER[\"standard_parallel_2\",32.78333333333"
+        "33],PARAMETER[\"false_easting\",2000000],PARAMETER[\"fal"
+        "se_northing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3499\"]]"},
+    {3500, "epsg", 3500,
         "NAD83(NSRS2007) / California zone 6 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000");
-    add_proj4text (p, 2,
-        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / California zone 6 (ftUS)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_");
-    add_srs_wkt (p, 2,
-        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",32.1666666666667],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-116.25],PARAMETER[\"standard_parallel_1\",33.8");
-    add_srs_wkt (p, 10,
-        "833333333333],PARAMETER[\"standard_parallel_2\",32.78333");
-    add_srs_wkt (p, 11,
-        "33333333],PARAMETER[\"false_easting\",6561666.667],PARAM");
-    add_srs_wkt (p, 12,
-        "ETER[\"false_northing\",1640416.667],UNIT[\"US survey fo");
-    add_srs_wkt (p, 13,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 15,
-        "EPSG\",\"3500\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3501, "epsg", 3501,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333"
+        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000"
+        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / California zone 6 (ftUS)\",GE"
+        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_"
+        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",32.1666666666667],PARAMETER[\"central_me"
+        "ridian\",-116.25],PARAMETER[\"standard_parallel_1\",33.8"
+        "833333333333],PARAMETER[\"standard_parallel_2\",32.78333"
+        "33333333],PARAMETER[\"false_easting\",6561666.667],PARAM"
+        "ETER[\"false_northing\",1640416.667],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3500\"]]"},
+    {3501, "epsg", 3501,
         "NAD83(NSRS2007) / Colorado Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333");
-    add_proj4text (p, 1,
-        "3334 +lon_0=-105.5 +x_0=914401.8289 +y_0=304800.6096 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Colorado Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",37.8333333333333],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-105.5],PARAMETER[\"standard_parallel_1\",39.75],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",38.45],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",914401.8289],PARAMETER[\"false_northing\",304800.");
-    add_srs_wkt (p, 12,
-        "6096],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3501\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3502, "epsg", 3502,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333"
+        "3334 +lon_0=-105.5 +x_0=914401.8289 +y_0=304800.6096 +el"
+        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Colorado Central\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",37.8333333333333],PARAMETER[\"central_meridian\""
+        ",-105.5],PARAMETER[\"standard_parallel_1\",39.75],PARAME"
+        "TER[\"standard_parallel_2\",38.45],PARAMETER[\"false_eas"
+        "ting\",914401.8289],PARAMETER[\"false_northing\",304800."
+        "6096],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3501\"]]"},
+    {3502, "epsg", 3502,
         "NAD83(NSRS2007) / Colorado Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333");
-    add_proj4text (p, 1,
-        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60");
-    add_proj4text (p, 2,
-        "96012192 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Colorado Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",37.8333333333333],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-105.5],PARAMETER[\"standard_parallel_1\",39.75");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"standard_parallel_2\",38.45],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",3000000],PARAMETER[\"false_northing\",100");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3502\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3503, "epsg", 3503,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333"
+        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60"
+        "96012192 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Colorado Central (ftUS)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",37.8333333333333],PARAMETER[\"central_me"
+        "ridian\",-105.5],PARAMETER[\"standard_parallel_1\",39.75"
+        "],PARAMETER[\"standard_parallel_2\",38.45],PARAMETER[\"f"
+        "alse_easting\",3000000],PARAMETER[\"false_northing\",100"
+        "0000],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3502\"]]"},
+    {3503, "epsg", 3503,
         "NAD83(NSRS2007) / Colorado North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "289 +y_0=304800.6096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Colorado North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",39.3333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-105.5],PARAMETER[\"standard_parallel_1\",40.78333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"standard_parallel_2\",39.7166666666667],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",914401.8289],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_northing\",304800.6096],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3503\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3504, "epsg", 3504,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666"
+        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8"
+        "289 +y_0=304800.6096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Colorado North\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",39.3333333333333],PARAMETER[\"central_meridian\","
+        "-105.5],PARAMETER[\"standard_parallel_1\",40.78333333333"
+        "33],PARAMETER[\"standard_parallel_2\",39.7166666666667],"
+        "PARAMETER[\"false_easting\",914401.8289],PARAMETER[\"fal"
+        "se_northing\",304800.6096],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3503\"]]"},
+    {3504, "epsg", 3504,
         "NAD83(NSRS2007) / Colorado North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Colorado North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",39.3333333333333],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-105.5],PARAMETER[\"standard_parallel_1\",40.78333");
-    add_srs_wkt (p, 10,
-        "33333333],PARAMETER[\"standard_parallel_2\",39.716666666");
-    add_srs_wkt (p, 11,
-        "6667],PARAMETER[\"false_easting\",3000000],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_northing\",1000000],UNIT[\"US survey foot\",0.30480");
-    add_srs_wkt (p, 13,
-        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"350");
-    add_srs_wkt (p, 15,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3505, "epsg", 3505,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666"
+        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8"
+        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Colorado North (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",39.3333333333333],PARAMETER[\"central_merid"
+        "ian\",-105.5],PARAMETER[\"standard_parallel_1\",40.78333"
+        "33333333],PARAMETER[\"standard_parallel_2\",39.716666666"
+        "6667],PARAMETER[\"false_easting\",3000000],PARAMETER[\"f"
+        "alse_northing\",1000000],UNIT[\"US survey foot\",0.30480"
+        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"350"
+        "4\"]]"},
+    {3505, "epsg", 3505,
         "NAD83(NSRS2007) / Colorado South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "289 +y_0=304800.6096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Colorado South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",36.6666666666667],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-105.5],PARAMETER[\"standard_parallel_1\",38.43333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"standard_parallel_2\",37.2333333333333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",914401.8289],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_northing\",304800.6096],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3505\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3506, "epsg", 3506,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333"
+        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8"
+        "289 +y_0=304800.6096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Colorado South\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",36.6666666666667],PARAMETER[\"central_meridian\","
+        "-105.5],PARAMETER[\"standard_parallel_1\",38.43333333333"
+        "33],PARAMETER[\"standard_parallel_2\",37.2333333333333],"
+        "PARAMETER[\"false_easting\",914401.8289],PARAMETER[\"fal"
+        "se_northing\",304800.6096],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3505\"]]"},
+    {3506, "epsg", 3506,
         "NAD83(NSRS2007) / Colorado South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Colorado South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",36.6666666666667],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-105.5],PARAMETER[\"standard_parallel_1\",38.43333");
-    add_srs_wkt (p, 10,
-        "33333333],PARAMETER[\"standard_parallel_2\",37.233333333");
-    add_srs_wkt (p, 11,
-        "3333],PARAMETER[\"false_easting\",3000000],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_northing\",1000000],UNIT[\"US survey foot\",0.30480");
-    add_srs_wkt (p, 13,
-        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"350");
-    add_srs_wkt (p, 15,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3507, "epsg", 3507,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333"
+        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8"
+        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Colorado South (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",36.6666666666667],PARAMETER[\"central_merid"
+        "ian\",-105.5],PARAMETER[\"standard_parallel_1\",38.43333"
+        "33333333],PARAMETER[\"standard_parallel_2\",37.233333333"
+        "3333],PARAMETER[\"false_easting\",3000000],PARAMETER[\"f"
+        "alse_northing\",1000000],UNIT[\"US survey foot\",0.30480"
+        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"350"
+        "6\"]]"},
+    {3507, "epsg", 3507,
         "NAD83(NSRS2007) / Connecticut", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40");
-    add_proj4text (p, 1,
-        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096 +y_0=1524");
-    add_proj4text (p, 2,
-        "00.3048 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Connecticut\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",40.8333333333333],PARAMETER[\"central_meridian\",-72");
-    add_srs_wkt (p, 9,
-        ".75],PARAMETER[\"standard_parallel_1\",41.8666666666667]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",41.2],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_easting\",304800.6096],PARAMETER[\"false_northing\",1");
-    add_srs_wkt (p, 12,
-        "52400.3048],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"3507\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3508, "epsg", 3508,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40"
+        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096 +y_0=1524"
+        "00.3048 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Connecticut\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",40.8333333333333],PARAMETER[\"central_meridian\",-72"
+        ".75],PARAMETER[\"standard_parallel_1\",41.8666666666667]"
+        ",PARAMETER[\"standard_parallel_2\",41.2],PARAMETER[\"fal"
+        "se_easting\",304800.6096],PARAMETER[\"false_northing\",1"
+        "52400.3048],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3507\"]]"},
+    {3508, "epsg", 3508,
         "NAD83(NSRS2007) / Connecticut (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40");
-    add_proj4text (p, 1,
-        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_");
-    add_proj4text (p, 2,
-        "0=152400.3048006096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 3,
-        "+units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Connecticut (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",40.8333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-72.75],PARAMETER[\"standard_parallel_1\",41.86666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"standard_parallel_2\",41.2],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",1000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",500000],UNIT[\"US survey foot\",0.304800609601219,AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 14,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3508\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3509, "epsg", 3509,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40"
+        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_"
+        "0=152400.3048006096 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Connecticut (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",40.8333333333333],PARAMETER[\"central_meridian"
+        "\",-72.75],PARAMETER[\"standard_parallel_1\",41.86666666"
+        "66667],PARAMETER[\"standard_parallel_2\",41.2],PARAMETER"
+        "[\"false_easting\",1000000],PARAMETER[\"false_northing\""
+        ",500000],UNIT[\"US survey foot\",0.304800609601219,AUTHO"
+        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"3508\"]]"},
+    {3509, "epsg", 3509,
         "NAD83(NSRS2007) / Delaware", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "995 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Delaware\",GEOGCS[\"NAD83(NSR");
-    add_srs_wkt (p, 1,
-        "S2007)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",38],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-75.4166666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",0.999995],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "200000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3509\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3510, "epsg", 3510,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999"
+        "995 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Delaware\",GEOGCS[\"NAD83(NSR"
+        "S2007)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",38],PAR"
+        "AMETER[\"central_meridian\",-75.4166666666667],PARAMETER"
+        "[\"scale_factor\",0.999995],PARAMETER[\"false_easting\","
+        "200000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3509\"]]"},
+    {3510, "epsg", 3510,
         "NAD83(NSRS2007) / Delaware (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Delaware (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 8,
-        "8],PARAMETER[\"central_meridian\",-75.4166666666667],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.999995],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",656166.667],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"3510\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3511, "epsg", 3511,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999"
+        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Delaware (ftUS)\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3"
+        "8],PARAMETER[\"central_meridian\",-75.4166666666667],PAR"
+        "AMETER[\"scale_factor\",0.999995],PARAMETER[\"false_east"
+        "ing\",656166.667],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3510\"]]"},
+    {3511, "epsg", 3511,
         "NAD83(NSRS2007) / Florida East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Florida East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",24.3");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-81],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.999941177],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",200000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3511\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3512, "epsg", 3512,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999"
+        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Florida East\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",24.3"
+        "333333333333],PARAMETER[\"central_meridian\",-81],PARAME"
+        "TER[\"scale_factor\",0.999941177],PARAMETER[\"false_east"
+        "ing\",200000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3511\""
+        "]]"},
+    {3512, "epsg", 3512,
         "NAD83(NSRS2007) / Florida East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Florida East (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",24.3333333333333],PARAMETER[\"central_meridian\",-81");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",656166.667],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3512\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3513, "epsg", 3513,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999"
+        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Florida East (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",24.3333333333333],PARAMETER[\"central_meridian\",-81"
+        "],PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fa"
+        "lse_easting\",656166.667],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3512\"]]"},
+    {3513, "epsg", 3513,
         "NAD83(NSRS2007) / Florida GDL Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=24 +lat_2=31.5 +lat_0=24 +lon_0=-84 +x_");
-    add_proj4text (p, 1,
-        "0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Florida GDL Albers\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Albers_Conic_Equal_Area\"],PARAMETER[\"latitude_of_cen");
-    add_srs_wkt (p, 8,
-        "ter\",24],PARAMETER[\"longitude_of_center\",-84],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",24],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",31.5],PARAMETER[\"false_easting\",400000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3513\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3514, "epsg", 3514,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=24 +lat_2=31.5 +lat_0=24 +lon_0=-84 +x_"
+        "0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Florida GDL Albers\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Albers_Conic_Equal_Area\"],PARAMETER[\"latitude_of_cen"
+        "ter\",24],PARAMETER[\"longitude_of_center\",-84],PARAMET"
+        "ER[\"standard_parallel_1\",24],PARAMETER[\"standard_para"
+        "llel_2\",31.5],PARAMETER[\"false_easting\",400000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3513\"]]"},
+    {3514, "epsg", 3514,
         "NAD83(NSRS2007) / Florida North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2");
-    add_proj4text (p, 1,
-        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Florida North\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",29],PARAMETER[\"central_meridian\",-84.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",30.75],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 10,
-        "rallel_2\",29.5833333333333],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3514\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3515, "epsg", 3515,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2"
+        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Florida North\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",29],PARAMETER[\"central_meridian\",-84.5],PARAMETE"
+        "R[\"standard_parallel_1\",30.75],PARAMETER[\"standard_pa"
+        "rallel_2\",29.5833333333333],PARAMETER[\"false_easting\""
+        ",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3514\"]]"},
+    {3515, "epsg", 3515,
         "NAD83(NSRS2007) / Florida North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2");
-    add_proj4text (p, 1,
-        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Florida North (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",29],PARAMETER[\"central_meridian\",-84.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",30.75],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",29.5833333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"3515\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3516, "epsg", 3516,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2"
+        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Florida North (ftUS)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",29],PARAMETER[\"central_meridian\",-84.5],P"
+        "ARAMETER[\"standard_parallel_1\",30.75],PARAMETER[\"stan"
+        "dard_parallel_2\",29.5833333333333],PARAMETER[\"false_ea"
+        "sting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3515\"]]"},
+    {3516, "epsg", 3516,
         "NAD83(NSRS2007) / Florida West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Florida West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",24.3");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-82],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.999941177],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",200000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3516\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3517, "epsg", 3517,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999"
+        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Florida West\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",24.3"
+        "333333333333],PARAMETER[\"central_meridian\",-82],PARAME"
+        "TER[\"scale_factor\",0.999941177],PARAMETER[\"false_east"
+        "ing\",200000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3516\""
+        "]]"},
+    {3517, "epsg", 3517,
         "NAD83(NSRS2007) / Florida West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Florida West (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",24.3333333333333],PARAMETER[\"central_meridian\",-82");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",656166.667],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3517\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3518, "epsg", 3518,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999"
+        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Florida West (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",24.3333333333333],PARAMETER[\"central_meridian\",-82"
+        "],PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fa"
+        "lse_easting\",656166.667],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3517\"]]"},
+    {3518, "epsg", 3518,
         "NAD83(NSRS2007) / Georgia East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Georgia East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-82.1666666666667],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",200000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3518\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3519, "epsg", 3519,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999"
+        "9 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Georgia East\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],"
+        "PARAMETER[\"central_meridian\",-82.1666666666667],PARAME"
+        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",200000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3518\"]]"},
+    {3519, "epsg", 3519,
         "NAD83(NSRS2007) / Georgia East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Georgia East (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",30],PARAMETER[\"central_meridian\",-82.1666666666667");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",656166.667],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"3519\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3520, "epsg", 3520,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999"
+        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Georgia East (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",30],PARAMETER[\"central_meridian\",-82.1666666666667"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",656166.667],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3519\"]]"},
+    {3520, "epsg", 3520,
         "NAD83(NSRS2007) / Georgia West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Georgia West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-84.1666666666667],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",700000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3520\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3521, "epsg", 3521,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999"
+        "9 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Georgia West\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],"
+        "PARAMETER[\"central_meridian\",-84.1666666666667],PARAME"
+        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",700000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3520\"]]"},
+    {3521, "epsg", 3521,
         "NAD83(NSRS2007) / Georgia West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Georgia West (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",30],PARAMETER[\"central_meridian\",-84.1666666666667");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",2296583.333],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"3521\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3522, "epsg", 3522,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999"
+        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Georgia West (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",30],PARAMETER[\"central_meridian\",-84.1666666666667"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",2296583.333],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG"
+        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"3521\"]]"},
+    {3522, "epsg", 3522,
         "NAD83(NSRS2007) / Idaho Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99");
-    add_proj4text (p, 1,
-        "99473679999999 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Idaho Central\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-114],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.999947368],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"352");
-    add_srs_wkt (p, 13,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3523, "epsg", 3523,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99"
+        "99473679999999 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Idaho Central\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41"
+        ".6666666666667],PARAMETER[\"central_meridian\",-114],PAR"
+        "AMETER[\"scale_factor\",0.999947368],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"352"
+        "2\"]]"},
+    {3523, "epsg", 3523,
         "NAD83(NSRS2007) / Idaho Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99");
-    add_proj4text (p, 1,
-        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Idaho Central (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",41.6666666666667],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 9,
-        "14],PARAMETER[\"scale_factor\",0.999947368],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",1640416.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3523\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3524, "epsg", 3524,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99"
+        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8"
+        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Idaho Central (ftUS)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",41.6666666666667],PARAMETER[\"central_meridian\",-1"
+        "14],PARAMETER[\"scale_factor\",0.999947368],PARAMETER[\""
+        "false_easting\",1640416.667],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3523\"]]"},
+    {3524, "epsg", 3524,
         "NAD83(NSRS2007) / Idaho East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.9999473679999999 +x_0=200000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Idaho East\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.66");
-    add_srs_wkt (p, 8,
-        "66666666667],PARAMETER[\"central_meridian\",-112.1666666");
-    add_srs_wkt (p, 9,
-        "66667],PARAMETER[\"scale_factor\",0.999947368],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",200000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"3524\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3525, "epsg", 3525,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666"
+        "666667 +k=0.9999473679999999 +x_0=200000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Idaho East\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.66"
+        "66666666667],PARAMETER[\"central_meridian\",-112.1666666"
+        "66667],PARAMETER[\"scale_factor\",0.999947368],PARAMETER"
+        "[\"false_easting\",200000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3524\"]]"},
+    {3525, "epsg", 3525,
         "NAD83(NSRS2007) / Idaho East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Idaho East (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",41.6666666666667],PARAMETER[\"central_meridian\",-112.1");
-    add_srs_wkt (p, 9,
-        "66666666667],PARAMETER[\"scale_factor\",0.999947368],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",656166.667],PARAMETER[\"false_n");
-    add_srs_wkt (p, 11,
-        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3525\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3526, "epsg", 3526,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666"
+        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Idaho East (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",41.6666666666667],PARAMETER[\"central_meridian\",-112.1"
+        "66666666667],PARAMETER[\"scale_factor\",0.999947368],PAR"
+        "AMETER[\"false_easting\",656166.667],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3525\"]]"},
+    {3526, "epsg", 3526,
         "NAD83(NSRS2007) / Idaho West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0");
-    add_proj4text (p, 1,
-        ".999933333 +x_0=800000 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Idaho West\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.66");
-    add_srs_wkt (p, 8,
-        "66666666667],PARAMETER[\"central_meridian\",-115.75],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.999933333],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",800000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"352");
-    add_srs_wkt (p, 13,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3527, "epsg", 3527,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0"
+        ".999933333 +x_0=800000 +y_0=0 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Idaho West\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.66"
+        "66666666667],PARAMETER[\"central_meridian\",-115.75],PAR"
+        "AMETER[\"scale_factor\",0.999933333],PARAMETER[\"false_e"
+        "asting\",800000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"352"
+        "6\"]]"},
+    {3527, "epsg", 3527,
         "NAD83(NSRS2007) / Idaho West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0");
-    add_proj4text (p, 1,
-        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Idaho West (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",41.6666666666667],PARAMETER[\"central_meridian\",-115.7");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"scale_factor\",0.999933333],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",2624666.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3527\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3528, "epsg", 3528,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0"
+        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +t"
+        "owgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Idaho West (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",41.6666666666667],PARAMETER[\"central_meridian\",-115.7"
+        "5],PARAMETER[\"scale_factor\",0.999933333],PARAMETER[\"f"
+        "alse_easting\",2624666.667],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3527\"]]"},
+    {3528, "epsg", 3528,
         "NAD83(NSRS2007) / Illinois East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333");
-    add_proj4text (p, 1,
-        "333333 +k=0.9999749999999999 +x_0=300000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Illinois East\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-88.33333");
-    add_srs_wkt (p, 9,
-        "33333333],PARAMETER[\"scale_factor\",0.999975],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",300000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"3528\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3529, "epsg", 3529,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333"
+        "333333 +k=0.9999749999999999 +x_0=300000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Illinois East\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36"
+        ".6666666666667],PARAMETER[\"central_meridian\",-88.33333"
+        "33333333],PARAMETER[\"scale_factor\",0.999975],PARAMETER"
+        "[\"false_easting\",300000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3528\"]]"},
+    {3529, "epsg", 3529,
         "NAD83(NSRS2007) / Illinois East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333");
-    add_proj4text (p, 1,
-        "333333 +k=0.9999749999999999 +x_0=300000.0000000001 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Illinois East (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",36.6666666666667],PARAMETER[\"central_meridian\",-8");
-    add_srs_wkt (p, 9,
-        "8.3333333333333],PARAMETER[\"scale_factor\",0.999975],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_easting\",984250],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 11,
-        "hing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3529\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3530, "epsg", 3530,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333"
+        "333333 +k=0.9999749999999999 +x_0=300000.0000000001 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Illinois East (ftUS)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",36.6666666666667],PARAMETER[\"central_meridian\",-8"
+        "8.3333333333333],PARAMETER[\"scale_factor\",0.999975],PA"
+        "RAMETER[\"false_easting\",984250],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3529\"]]"},
+    {3530, "epsg", 3530,
         "NAD83(NSRS2007) / Illinois West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999941177 +x_0=700000 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Illinois West\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-90.16666");
-    add_srs_wkt (p, 9,
-        "66666667],PARAMETER[\"scale_factor\",0.999941177],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_easting\",700000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 11,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"3530\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3531, "epsg", 3531,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666"
+        "666667 +k=0.999941177 +x_0=700000 +y_0=0 +ellps=GRS80 +t"
+        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Illinois West\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36"
+        ".6666666666667],PARAMETER[\"central_meridian\",-90.16666"
+        "66666667],PARAMETER[\"scale_factor\",0.999941177],PARAME"
+        "TER[\"false_easting\",700000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3530\"]]"},
+    {3531, "epsg", 3531,
         "NAD83(NSRS2007) / Illinois West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999941177 +x_0=699999.9999898402 +y_0=0 +ell");
-    add_proj4text (p, 2,
-        "ps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Illinois West (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",36.6666666666667],PARAMETER[\"central_meridian\",-9");
-    add_srs_wkt (p, 9,
-        "0.1666666666667],PARAMETER[\"scale_factor\",0.999941177]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",2296583.3333],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 12,
-        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3531\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3532, "epsg", 3532,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666"
+        "666667 +k=0.999941177 +x_0=699999.9999898402 +y_0=0 +ell"
+        "ps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Illinois West (ftUS)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",36.6666666666667],PARAMETER[\"central_meridian\",-9"
+        "0.1666666666667],PARAMETER[\"scale_factor\",0.999941177]"
+        ",PARAMETER[\"false_easting\",2296583.3333],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960"
+        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3531\"]]"},
+    {3532, "epsg", 3532,
         "NAD83(NSRS2007) / Indiana East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=100000 +y_0=250000 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Indiana East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-85.6666666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",100000],PARAMETER[\"false_northing\",250000],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3532\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3533, "epsg", 3533,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9"
+        "99966667 +x_0=100000 +y_0=250000 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Indiana East\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5"
+        "],PARAMETER[\"central_meridian\",-85.6666666666667],PARA"
+        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea"
+        "sting\",100000],PARAMETER[\"false_northing\",250000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3532\"]]"},
+    {3533, "epsg", 3533,
         "NAD83(NSRS2007) / Indiana East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Indiana East (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",37.5],PARAMETER[\"central_meridian\",-85.66666666666");
-    add_srs_wkt (p, 9,
-        "67],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",328083.333],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",820208.333],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3533\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3534, "epsg", 3534,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9"
+        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Indiana East (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",37.5],PARAMETER[\"central_meridian\",-85.66666666666"
+        "67],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\""
+        "false_easting\",328083.333],PARAMETER[\"false_northing\""
+        ",820208.333],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3533\"]]"},
+    {3534, "epsg", 3534,
         "NAD83(NSRS2007) / Indiana West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=250000 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Indiana West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-87.0833333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",900000],PARAMETER[\"false_northing\",250000],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3534\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3535, "epsg", 3535,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9"
+        "99966667 +x_0=900000 +y_0=250000 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Indiana West\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5"
+        "],PARAMETER[\"central_meridian\",-87.0833333333333],PARA"
+        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea"
+        "sting\",900000],PARAMETER[\"false_northing\",250000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3534\"]]"},
+    {3535, "epsg", 3535,
         "NAD83(NSRS2007) / Indiana West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Indiana West (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",37.5],PARAMETER[\"central_meridian\",-87.08333333333");
-    add_srs_wkt (p, 9,
-        "33],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",2952750],PARAMETER[\"false_northing\",82");
-    add_srs_wkt (p, 11,
-        "0208.333],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3535\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3536, "epsg", 3536,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9"
+        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Indiana West (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",37.5],PARAMETER[\"central_meridian\",-87.08333333333"
+        "33],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\""
+        "false_easting\",2952750],PARAMETER[\"false_northing\",82"
+        "0208.333],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3535\"]]"},
+    {3536, "epsg", 3536,
         "NAD83(NSRS2007) / Iowa North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=1000000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Iowa North\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",41.5],PARAMETER[\"central_meridian\",-93.5],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",43.2666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",42.0666666666667],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",1500000],PARAMETER[\"false_northing\",1000000");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"3536\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3537, "epsg", 3537,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666"
+        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=1000000 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Iowa North\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",41.5],PARAMETER[\"central_meridian\",-93.5],PARAMETER"
+        "[\"standard_parallel_1\",43.2666666666667],PARAMETER[\"s"
+        "tandard_parallel_2\",42.0666666666667],PARAMETER[\"false"
+        "_easting\",1500000],PARAMETER[\"false_northing\",1000000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3536\"]]"},
+    {3537, "epsg", 3537,
         "NAD83(NSRS2007) / Iowa North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99");
-    add_proj4text (p, 2,
-        "99898402 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Iowa North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",41.5],PARAMETER[\"central_meridian\",-93.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",43.2666666666667],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",42.0666666666667],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",4921250],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "3280833.3333],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3537\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3538, "epsg", 3538,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666"
+        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99"
+        "99898402 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Iowa North (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",41.5],PARAMETER[\"central_meridian\",-93.5],PA"
+        "RAMETER[\"standard_parallel_1\",43.2666666666667],PARAME"
+        "TER[\"standard_parallel_2\",42.0666666666667],PARAMETER["
+        "\"false_easting\",4921250],PARAMETER[\"false_northing\","
+        "3280833.3333],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3537\"]]"},
+    {3538, "epsg", 3538,
         "NAD83(NSRS2007) / Iowa South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Iowa South\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",40],PARAMETER[\"central_meridian\",-93.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",41.7833333333333],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",40.6166666666667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3538");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3539, "epsg", 3539,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666"
+        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Iowa South\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",40],PARAMETER[\"central_meridian\",-93.5],PARAMETER[\""
+        "standard_parallel_1\",41.7833333333333],PARAMETER[\"stan"
+        "dard_parallel_2\",40.6166666666667],PARAMETER[\"false_ea"
+        "sting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3538"
+        "\"]]"},
+    {3539, "epsg", 3539,
         "NAD83(NSRS2007) / Iowa South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Iowa South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",40],PARAMETER[\"central_meridian\",-93.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",41.7833333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",40.6166666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",1640416.6667],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3539\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3540, "epsg", 3540,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666"
+        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Iowa South (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",40],PARAMETER[\"central_meridian\",-93.5],PARA"
+        "METER[\"standard_parallel_1\",41.7833333333333],PARAMETE"
+        "R[\"standard_parallel_2\",40.6166666666667],PARAMETER[\""
+        "false_easting\",1640416.6667],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3539\"]]"},
+    {3540, "epsg", 3540,
         "NAD83(NSRS2007) / Kansas North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=400000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kansas North\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",38.3333333333333],PARAMETER[\"central_meridian\",-98");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",39.7833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",38.7166666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",400000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3540\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3541, "epsg", 3541,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666"
+        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=400000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kansas North\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",38.3333333333333],PARAMETER[\"central_meridian\",-98"
+        "],PARAMETER[\"standard_parallel_1\",39.7833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",38.7166666666667],PARAME"
+        "TER[\"false_easting\",400000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3540\"]]"},
+    {3541, "epsg", 3541,
         "NAD83(NSRS2007) / Kansas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u");
-    add_proj4text (p, 3,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kansas North (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",38.3333333333333],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-98],PARAMETER[\"standard_parallel_1\",39.783333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"standard_parallel_2\",38.7166666666667");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",1312333.3333],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 13,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3541\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3542, "epsg", 3542,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666"
+        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999"
+        "8984 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kansas North (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",38.3333333333333],PARAMETER[\"central_meridi"
+        "an\",-98],PARAMETER[\"standard_parallel_1\",39.783333333"
+        "3333],PARAMETER[\"standard_parallel_2\",38.7166666666667"
+        "],PARAMETER[\"false_easting\",1312333.3333],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3541\"]"
+        "]"},
+    {3542, "epsg", 3542,
         "NAD83(NSRS2007) / Kansas South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=400000 +y");
-    add_proj4text (p, 2,
-        "_0=400000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kansas South\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",36.6666666666667],PARAMETER[\"central_meridian\",-98");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"standard_parallel_1\",38.5666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",37.2666666666667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",400000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"3542\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3543, "epsg", 3543,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666"
+        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=400000 +y"
+        "_0=400000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kansas South\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",36.6666666666667],PARAMETER[\"central_meridian\",-98"
+        ".5],PARAMETER[\"standard_parallel_1\",38.5666666666667],"
+        "PARAMETER[\"standard_parallel_2\",37.2666666666667],PARA"
+        "METER[\"false_easting\",400000],PARAMETER[\"false_northi"
+        "ng\",400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3542\"]]"},
+    {3543, "epsg", 3543,
         "NAD83(NSRS2007) / Kansas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99");
-    add_proj4text (p, 2,
-        "998984 +y_0=399999.99998984 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kansas South (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",36.6666666666667],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-98.5],PARAMETER[\"standard_parallel_1\",38.5666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"standard_parallel_2\",37.26666666666");
-    add_srs_wkt (p, 11,
-        "67],PARAMETER[\"false_easting\",1312333.3333],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",1312333.3333],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 13,
-        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"3543\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3544, "epsg", 3544,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666"
+        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99"
+        "998984 +y_0=399999.99998984 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kansas South (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",36.6666666666667],PARAMETER[\"central_meridi"
+        "an\",-98.5],PARAMETER[\"standard_parallel_1\",38.5666666"
+        "666667],PARAMETER[\"standard_parallel_2\",37.26666666666"
+        "67],PARAMETER[\"false_easting\",1312333.3333],PARAMETER["
+        "\"false_northing\",1312333.3333],UNIT[\"US survey foot\""
+        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3543\"]]"},
+    {3544, "epsg", 3544,
         "NAD83(NSRS2007) / Kentucky North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kentucky North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",37.5],PARAMETER[\"central_meridian\",-84.25],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",37.9666666666667],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",38.9666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3544\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3545, "epsg", 3545,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666"
+        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000 +y_0=0 +ellps="
+        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kentucky North\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",37.5],PARAMETER[\"central_meridian\",-84.25],PARA"
+        "METER[\"standard_parallel_1\",37.9666666666667],PARAMETE"
+        "R[\"standard_parallel_2\",38.9666666666667],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3544\"]]"},
+    {3545, "epsg", 3545,
         "NAD83(NSRS2007) / Kentucky North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kentucky North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",37.5],PARAMETER[\"central_meridian\",-84.25");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",37.9666666666667],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",38.9666666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1640416.667],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"US survey foot\",0.304800609601219,AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3545\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3546, "epsg", 3546,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666"
+        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no"
+        "_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kentucky North (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",37.5],PARAMETER[\"central_meridian\",-84.25"
+        "],PARAMETER[\"standard_parallel_1\",37.9666666666667],PA"
+        "RAMETER[\"standard_parallel_2\",38.9666666666667],PARAME"
+        "TER[\"false_easting\",1640416.667],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"US survey foot\",0.304800609601219,AUT"
+        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3545\"]]"},
+    {3546, "epsg", 3546,
         "NAD83(NSRS2007) / Kentucky Single Zone", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 3,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kentucky Single Zone\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",36.3333333333333],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-85.75],PARAMETER[\"standard_parallel_1\",37.08333");
-    add_srs_wkt (p, 10,
-        "33333333],PARAMETER[\"standard_parallel_2\",38.666666666");
-    add_srs_wkt (p, 11,
-        "6667],PARAMETER[\"false_easting\",1500000],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3546\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666"
+        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 "
+        "+y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kentucky Single Zone\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",36.3333333333333],PARAMETER[\"central_merid"
+        "ian\",-85.75],PARAMETER[\"standard_parallel_1\",37.08333"
+        "33333333],PARAMETER[\"standard_parallel_2\",38.666666666"
+        "6667],PARAMETER[\"false_easting\",1500000],PARAMETER[\"f"
+        "alse_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3546\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_14 = {
+    epsg_defs_14, sizeof (epsg_defs_14) / sizeof (epsg_defs_14[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,4049 +53,2283 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_15 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3547, "epsg", 3547,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_15[] = {
+    {3547, "epsg", 3547,
         "NAD83(NSRS2007) / Kentucky Single Zone (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kentucky Single Zone (ftUS)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati");
-    add_srs_wkt (p, 2,
-        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",36.3333333333333],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-85.75],PARAMETER[\"standard_parallel_1\",37");
-    add_srs_wkt (p, 10,
-        ".0833333333333],PARAMETER[\"standard_parallel_2\",38.666");
-    add_srs_wkt (p, 11,
-        "6666666667],PARAMETER[\"false_easting\",4921250],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_northing\",3280833.333],UNIT[\"US survey foot");
-    add_srs_wkt (p, 13,
-        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[");
-    add_srs_wkt (p, 14,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 15,
-        "PSG\",\"3547\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3548, "epsg", 3548,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666"
+        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 "
+        "+y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kentucky Single Zone (ftUS)\""
+        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati"
+        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",36.3333333333333],PARAMETER[\"central"
+        "_meridian\",-85.75],PARAMETER[\"standard_parallel_1\",37"
+        ".0833333333333],PARAMETER[\"standard_parallel_2\",38.666"
+        "6666666667],PARAMETER[\"false_easting\",4921250],PARAMET"
+        "ER[\"false_northing\",3280833.333],UNIT[\"US survey foot"
+        "\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3547\"]]"},
+    {3548, "epsg", 3548,
         "NAD83(NSRS2007) / Kentucky South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kentucky South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",36.3333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-85.75],PARAMETER[\"standard_parallel_1\",37.93333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"standard_parallel_2\",36.7333333333333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 13,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 14,
-        "AUTHORITY[\"EPSG\",\"3548\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3549, "epsg", 3549,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333"
+        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000 +"
+        "y_0=500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kentucky South\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",36.3333333333333],PARAMETER[\"central_meridian\","
+        "-85.75],PARAMETER[\"standard_parallel_1\",37.93333333333"
+        "33],PARAMETER[\"standard_parallel_2\",36.7333333333333],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9"
+        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"3548\"]]"},
+    {3549, "epsg", 3549,
         "NAD83(NSRS2007) / Kentucky South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Kentucky South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",36.3333333333333],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-85.75],PARAMETER[\"standard_parallel_1\",37.93333");
-    add_srs_wkt (p, 10,
-        "33333333],PARAMETER[\"standard_parallel_2\",36.733333333");
-    add_srs_wkt (p, 11,
-        "3333],PARAMETER[\"false_easting\",1640416.667],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_northing\",1640416.667],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 13,
-        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"3549\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3550, "epsg", 3550,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333"
+        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0"
+        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Kentucky South (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",36.3333333333333],PARAMETER[\"central_merid"
+        "ian\",-85.75],PARAMETER[\"standard_parallel_1\",37.93333"
+        "33333333],PARAMETER[\"standard_parallel_2\",36.733333333"
+        "3333],PARAMETER[\"false_easting\",1640416.667],PARAMETER"
+        "[\"false_northing\",1640416.667],UNIT[\"US survey foot\""
+        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3549\"]]"},
+    {3550, "epsg", 3550,
         "NAD83(NSRS2007) / Louisiana North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=1000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Louisiana North\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",30.5],PARAMETER[\"central_meridian\",-92.5],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",32.6666666666667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",31.1666666666667],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",1000000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3550\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3551, "epsg", 3551,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666"
+        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=1000000 +y_0=0 +ellps="
+        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Louisiana North\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",30.5],PARAMETER[\"central_meridian\",-92.5],PARAM"
+        "ETER[\"standard_parallel_1\",32.6666666666667],PARAMETER"
+        "[\"standard_parallel_2\",31.1666666666667],PARAMETER[\"f"
+        "alse_easting\",1000000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3550\"]]"},
+    {3551, "epsg", 3551,
         "NAD83(NSRS2007) / Louisiana North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Louisiana North (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",30.5],PARAMETER[\"central_meridian\",-92.");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_1\",32.6666666666667],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",31.1666666666667],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",3280833.3333],PARAMETER[\"false_n");
-    add_srs_wkt (p, 12,
-        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3551\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3552, "epsg", 3552,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666"
+        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Louisiana North (ftUS)\",GEOG"
+        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",30.5],PARAMETER[\"central_meridian\",-92."
+        "5],PARAMETER[\"standard_parallel_1\",32.6666666666667],P"
+        "ARAMETER[\"standard_parallel_2\",31.1666666666667],PARAM"
+        "ETER[\"false_easting\",3280833.3333],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3551\"]]"},
+    {3552, "epsg", 3552,
         "NAD83(NSRS2007) / Louisiana South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=1000000 +y_0=0 +ellps=GRS80 +towgs8");
-    add_proj4text (p, 2,
-        "4=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Louisiana South\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",28.5],PARAMETER[\"central_meridian\",-91.33333333");
-    add_srs_wkt (p, 9,
-        "33333],PARAMETER[\"standard_parallel_1\",30.7],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",29.3],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3552\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3553, "epsg", 3553,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91"
+        ".33333333333333 +x_0=1000000 +y_0=0 +ellps=GRS80 +towgs8"
+        "4=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Louisiana South\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",28.5],PARAMETER[\"central_meridian\",-91.33333333"
+        "33333],PARAMETER[\"standard_parallel_1\",30.7],PARAMETER"
+        "[\"standard_parallel_2\",29.3],PARAMETER[\"false_easting"
+        "\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3552\"]]"},
+    {3553, "epsg", 3553,
         "NAD83(NSRS2007) / Louisiana South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Louisiana South (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",28.5],PARAMETER[\"central_meridian\",-91.");
-    add_srs_wkt (p, 9,
-        "3333333333333],PARAMETER[\"standard_parallel_1\",30.7],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",29.3],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",3280833.3333],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3553\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3554, "epsg", 3554,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91"
+        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Louisiana South (ftUS)\",GEOG"
+        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",28.5],PARAMETER[\"central_meridian\",-91."
+        "3333333333333],PARAMETER[\"standard_parallel_1\",30.7],P"
+        "ARAMETER[\"standard_parallel_2\",29.3],PARAMETER[\"false"
+        "_easting\",3280833.3333],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E"
+        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3553\"]]"},
+    {3554, "epsg", 3554,
         "NAD83(NSRS2007) / Maine CS2000 Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 Central\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",43.5],PARAMETER[\"central_meridian\",-69.125],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",0.99998],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3554\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3555, "epsg", 3555,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5"
+        "00000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 Central\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",43.5],PARAMETER[\"central_meridian\",-69.125],PARAM"
+        "ETER[\"scale_factor\",0.99998],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3554\"]]"},
+    {3555, "epsg", 3555,
         "NAD83(NSRS2007) / Maine CS2000 East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 East\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",43.8333333333333],PARAMETER[\"central_meridian\",-67.87");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"scale_factor\",0.99998],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_easting\",700000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "555\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3556, "epsg", 3556,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0"
+        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 East\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",43.8333333333333],PARAMETER[\"central_meridian\",-67.87"
+        "5],PARAMETER[\"scale_factor\",0.99998],PARAMETER[\"false"
+        "_easting\",700000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "555\"]]"},
+    {3556, "epsg", 3556,
         "NAD83(NSRS2007) / Maine CS2000 West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 West\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",42.8333333333333],PARAMETER[\"central_meridian\",-70.37");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"scale_factor\",0.99998],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_easting\",300000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "556\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3557, "epsg", 3557,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0"
+        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Maine CS2000 West\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",42.8333333333333],PARAMETER[\"central_meridian\",-70.37"
+        "5],PARAMETER[\"scale_factor\",0.99998],PARAMETER[\"false"
+        "_easting\",300000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "556\"]]"},
+    {3557, "epsg", 3557,
         "NAD83(NSRS2007) / Maine East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine East\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.66");
-    add_srs_wkt (p, 8,
-        "66666666667],PARAMETER[\"central_meridian\",-68.5],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",300000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3557\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3558, "epsg", 3558,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9"
+        "999 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Maine East\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.66"
+        "66666666667],PARAMETER[\"central_meridian\",-68.5],PARAM"
+        "ETER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",300000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3557\"]]"},
+    {3558, "epsg", 3558,
         "NAD83(NSRS2007) / Maine West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maine West\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.83");
-    add_srs_wkt (p, 8,
-        "33333333333],PARAMETER[\"central_meridian\",-70.16666666");
-    add_srs_wkt (p, 9,
-        "66667],PARAMETER[\"scale_factor\",0.999966667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_easting\",900000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"3558\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3559, "epsg", 3559,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666"
+        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +t"
+        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Maine West\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.83"
+        "33333333333],PARAMETER[\"central_meridian\",-70.16666666"
+        "66667],PARAMETER[\"scale_factor\",0.999966667],PARAMETER"
+        "[\"false_easting\",900000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3558\"]]"},
+    {3559, "epsg", 3559,
         "NAD83(NSRS2007) / Maryland", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maryland\",GEOGCS[\"NAD83(NSR");
-    add_srs_wkt (p, 1,
-        "S2007)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",37.6666666666667],PARAMETER[\"central_meridian\",-77],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",39.45],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",38.3],PARAMETER[\"false_easting\",4000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3559\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3560, "epsg", 3560,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666"
+        "666 +lon_0=-77 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Maryland\",GEOGCS[\"NAD83(NSR"
+        "S2007)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",37.6666666666667],PARAMETER[\"central_meridian\",-77],P"
+        "ARAMETER[\"standard_parallel_1\",39.45],PARAMETER[\"stan"
+        "dard_parallel_2\",38.3],PARAMETER[\"false_easting\",4000"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3559\"]]"},
+    {3560, "epsg", 3560,
         "NAD83 / Utah North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah North (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",40.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-111.5],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",41.7833333333333],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",40.7166666666667],PARAMETER[\"false_easting\",1640416.6");
-    add_srs_wkt (p, 11,
-        "667],PARAMETER[\"false_northing\",3280833.3333],UNIT[\"U");
-    add_srs_wkt (p, 12,
-        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 13,
-        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 14,
-        "AUTHORITY[\"EPSG\",\"3560\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3561, "epsg", 3561,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0"
+        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Utah North (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",40.3333333333333],PARAMETER[\""
+        "central_meridian\",-111.5],PARAMETER[\"standard_parallel"
+        "_1\",41.7833333333333],PARAMETER[\"standard_parallel_2\""
+        ",40.7166666666667],PARAMETER[\"false_easting\",1640416.6"
+        "667],PARAMETER[\"false_northing\",3280833.3333],UNIT[\"U"
+        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9"
+        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"3560\"]]"},
+    {3561, "epsg", 3561,
         "Old Hawaiian / Hawaii zone 1", 0, 0,
         "Clarke 1866", "Greenwich",
         "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=18.83333333333333 +lon_0=-155.5 +k=0.");
-    add_proj4text (p, 1,
-        "999966667 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +t");
-    add_proj4text (p, 2,
-        "owgs84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 1\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",18.8333333333333],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-155.5],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 9,
-        "9966667],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 11,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3561\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3562, "epsg", 3562,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=18.83333333333333 +lon_0=-155.5 +k=0."
+        "999966667 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +t"
+        "owgs84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"Old Hawaiian / Hawaii zone 1\",GEOGCS[\"Old Haw"
+        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\","
+        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]"
+        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",18.8333333333333],PARAMETER[\"ce"
+        "ntral_meridian\",-155.5],PARAMETER[\"scale_factor\",0.99"
+        "9966667],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3561\"]"
+        "]"},
+    {3562, "epsg", 3562,
         "Old Hawaiian / Hawaii zone 2", 0, 0,
         "Clarke 1866", "Greenwich",
         "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=20.33333333333333 +lon_0=-156.6666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=152400.3048006096 +y_0=0 +ell");
-    add_proj4text (p, 2,
-        "ps=clrk66 +towgs84=61,-285,-181,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 2\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",20.3333333333333],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-156.666666666667],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.999966667],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 11,
-        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E");
-    add_srs_wkt (p, 12,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"3562\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3563, "epsg", 3563,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=20.33333333333333 +lon_0=-156.6666666"
+        "666667 +k=0.999966667 +x_0=152400.3048006096 +y_0=0 +ell"
+        "ps=clrk66 +towgs84=61,-285,-181,0,0,0,0 +units=us-ft +no"
+        "_defs",
+        "PROJCS[\"Old Hawaiian / Hawaii zone 2\",GEOGCS[\"Old Haw"
+        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\","
+        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]"
+        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",20.3333333333333],PARAMETER[\"ce"
+        "ntral_meridian\",-156.666666666667],PARAMETER[\"scale_fa"
+        "ctor\",0.999966667],PARAMETER[\"false_easting\",500000],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\","
+        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"3562\"]]"},
+    {3563, "epsg", 3563,
         "Old Hawaiian / Hawaii zone 3", 0, 0,
         "Clarke 1866", "Greenwich",
         "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99");
-    add_proj4text (p, 1,
-        "999 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +towgs84");
-    add_proj4text (p, 2,
-        "=61,-285,-181,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 3\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",21.1666666666667],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-158],PARAMETER[\"scale_factor\",0.9999");
-    add_srs_wkt (p, 9,
-        "9],PARAMETER[\"false_easting\",500000],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_northing\",0],UNIT[\"US survey foot\",0.304800609601219");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3563\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3564, "epsg", 3564,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99"
+        "999 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +towgs84"
+        "=61,-285,-181,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"Old Hawaiian / Hawaii zone 3\",GEOGCS[\"Old Haw"
+        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\","
+        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]"
+        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",21.1666666666667],PARAMETER[\"ce"
+        "ntral_meridian\",-158],PARAMETER[\"scale_factor\",0.9999"
+        "9],PARAMETER[\"false_easting\",500000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"US survey foot\",0.304800609601219"
+        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3563\"]]"},
+    {3564, "epsg", 3564,
         "Old Hawaiian / Hawaii zone 4", 0, 0,
         "Clarke 1866", "Greenwich",
         "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.83333333333333 +lon_0=-159.5 +k=0.");
-    add_proj4text (p, 1,
-        "99999 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +towgs");
-    add_proj4text (p, 2,
-        "84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 4\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",21.8333333333333],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-159.5],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 9,
-        "999],PARAMETER[\"false_easting\",500000],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",0],UNIT[\"US survey foot\",0.3048006096012");
-    add_srs_wkt (p, 11,
-        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3564\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3565, "epsg", 3565,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=21.83333333333333 +lon_0=-159.5 +k=0."
+        "99999 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +towgs"
+        "84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"Old Hawaiian / Hawaii zone 4\",GEOGCS[\"Old Haw"
+        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\","
+        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]"
+        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",21.8333333333333],PARAMETER[\"ce"
+        "ntral_meridian\",-159.5],PARAMETER[\"scale_factor\",0.99"
+        "999],PARAMETER[\"false_easting\",500000],PARAMETER[\"fal"
+        "se_northing\",0],UNIT[\"US survey foot\",0.3048006096012"
+        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3564\"]]"},
+    {3565, "epsg", 3565,
         "Old Hawaiian / Hawaii zone 5", 0, 0,
         "Clarke 1866", "Greenwich",
         "Old_Hawaiian", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.66666666666667 +lon_0=-160.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 ");
-    add_proj4text (p, 2,
-        "+towgs84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Old Hawaiian / Hawaii zone 5\",GEOGCS[\"Old Haw");
-    add_srs_wkt (p, 1,
-        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 2,
-        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",21.6666666666667],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-160.166666666667],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 11,
-        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3565\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3566, "epsg", 3566,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=21.66666666666667 +lon_0=-160.1666666"
+        "666667 +k=1 +x_0=152400.3048006096 +y_0=0 +ellps=clrk66 "
+        "+towgs84=61,-285,-181,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"Old Hawaiian / Hawaii zone 5\",GEOGCS[\"Old Haw"
+        "aiian\",DATUM[\"Old_Hawaiian\",SPHEROID[\"Clarke 1866\","
+        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]"
+        ",AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4135\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",21.6666666666667],PARAMETER[\"ce"
+        "ntral_meridian\",-160.166666666667],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",500000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060"
+        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3565\""
+        "]]"},
+    {3566, "epsg", 3566,
         "NAD83 / Utah Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=2000000.00001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah Central (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",38.3333333333333],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-111.5],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 9,
-        "el_1\",40.65],PARAMETER[\"standard_parallel_2\",39.01666");
-    add_srs_wkt (p, 10,
-        "66666667],PARAMETER[\"false_easting\",1640416.6667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_northing\",6561666.6667],UNIT[\"US survey ");
-    add_srs_wkt (p, 12,
-        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"3566\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3567, "epsg", 3567,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0"
+        "=2000000.00001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Utah Central (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",38.3333333333333],PARAMETER["
+        "\"central_meridian\",-111.5],PARAMETER[\"standard_parall"
+        "el_1\",40.65],PARAMETER[\"standard_parallel_2\",39.01666"
+        "66666667],PARAMETER[\"false_easting\",1640416.6667],PARA"
+        "METER[\"false_northing\",6561666.6667],UNIT[\"US survey "
+        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3566\"]]"},
+    {3567, "epsg", 3567,
         "NAD83 / Utah South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Utah South (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",36.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-111.5],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_1\",38.35],PARAMETER[\"standard_parallel_2\",37.2166666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"false_easting\",1640416.6667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",9842500],UNIT[\"US survey foot\",");
-    add_srs_wkt (p, 12,
-        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"3567\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3568, "epsg", 3568,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0"
+        "=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83 / Utah South (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",36.6666666666667],PARAMETER[\""
+        "central_meridian\",-111.5],PARAMETER[\"standard_parallel"
+        "_1\",38.35],PARAMETER[\"standard_parallel_2\",37.2166666"
+        "666667],PARAMETER[\"false_easting\",1640416.6667],PARAME"
+        "TER[\"false_northing\",9842500],UNIT[\"US survey foot\","
+        "0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"3567\"]]"},
+    {3568, "epsg", 3568,
         "NAD83(HARN) / Utah North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-111.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",41.7833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",40.7166666666667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",1640416.6667],PARAMETER[\"false_northing\",3");
-    add_srs_wkt (p, 12,
-        "280833.3333],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3568\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3569, "epsg", 3569,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0"
+        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah North (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.33333"
+        "33333333],PARAMETER[\"central_meridian\",-111.5],PARAMET"
+        "ER[\"standard_parallel_1\",41.7833333333333],PARAMETER[\""
+        "standard_parallel_2\",40.7166666666667],PARAMETER[\"fals"
+        "e_easting\",1640416.6667],PARAMETER[\"false_northing\",3"
+        "280833.3333],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3568\"]]"},
+    {3569, "epsg", 3569,
         "NAD83(HARN) / Utah Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=2000000.00001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah Central (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38.");
-    add_srs_wkt (p, 8,
-        "3333333333333],PARAMETER[\"central_meridian\",-111.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",40.65],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",39.0166666666667],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",1640416.6667],PARAMETER[\"false_northing\",656166");
-    add_srs_wkt (p, 12,
-        "6.6667],UNIT[\"US survey foot\",0.304800609601219,AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 14,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"3569\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3570, "epsg", 3570,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0"
+        "=2000000.00001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah Central (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38."
+        "3333333333333],PARAMETER[\"central_meridian\",-111.5],PA"
+        "RAMETER[\"standard_parallel_1\",40.65],PARAMETER[\"stand"
+        "ard_parallel_2\",39.0166666666667],PARAMETER[\"false_eas"
+        "ting\",1640416.6667],PARAMETER[\"false_northing\",656166"
+        "6.6667],UNIT[\"US survey foot\",0.304800609601219,AUTHOR"
+        "ITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"3569\"]]"},
+    {3570, "epsg", 3570,
         "NAD83(HARN) / Utah South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Utah South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-111.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",38.35],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 10,
-        "arallel_2\",37.2166666666667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1640416.6667],PARAMETER[\"false_northing\",9842500],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3570\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3571, "epsg", 3571,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0"
+        "=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(HARN) / Utah South (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.66666"
+        "66666667],PARAMETER[\"central_meridian\",-111.5],PARAMET"
+        "ER[\"standard_parallel_1\",38.35],PARAMETER[\"standard_p"
+        "arallel_2\",37.2166666666667],PARAMETER[\"false_easting\""
+        ",1640416.6667],PARAMETER[\"false_northing\",9842500],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3570\"]]"},
+    {3571, "epsg", 3571,
         "WGS 84 / North Pole LAEA Bering Sea", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=180 +x_0=0 +y_0=0 +datum=WGS");
-    add_proj4text (p, 1,
-        "84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Bering Sea\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_center\",90],PARAMETER[\"longitude_of_center\"");
-    add_srs_wkt (p, 8,
-        ",180],PARAMETER[\"false_easting\",0],PARAMETER[\"false_n");
-    add_srs_wkt (p, 9,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 10,
-        "]],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTH");
-    add_srs_wkt (p, 11,
-        "ORITY[\"EPSG\",\"3571\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3572, "epsg", 3572,
+        "Easting", "South", "Northing", "South",
+        "+proj=laea +lat_0=90 +lon_0=180 +x_0=0 +y_0=0 +datum=WGS"
+        "84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / North Pole LAEA Bering Sea\",GEOGCS[\""
+        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,"
+        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\""
+        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PR"
+        "OJECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"l"
+        "atitude_of_center\",90],PARAMETER[\"longitude_of_center\""
+        ",180],PARAMETER[\"false_easting\",0],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTH"
+        "ORITY[\"EPSG\",\"3571\"]]"},
+    {3572, "epsg", 3572,
         "WGS 84 / North Pole LAEA Alaska", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=-150 +x_0=0 +y_0=0 +datum=WG");
-    add_proj4text (p, 1,
-        "S84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Alaska\",GEOGCS[\"WGS ");
-    add_srs_wkt (p, 1,
-        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_center\",90],PARAMETER[\"longitude_of_center\",-1");
-    add_srs_wkt (p, 8,
-        "50],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 9,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 10,
-        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"3572\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3573, "epsg", 3573,
+        "Easting", "South", "Northing", "South",
+        "+proj=laea +lat_0=90 +lon_0=-150 +x_0=0 +y_0=0 +datum=WG"
+        "S84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / North Pole LAEA Alaska\",GEOGCS[\"WGS "
+        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298."
+        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG"
+        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC"
+        "TION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latit"
+        "ude_of_center\",90],PARAMETER[\"longitude_of_center\",-1"
+        "50],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO"
+        "RITY[\"EPSG\",\"3572\"]]"},
+    {3573, "epsg", 3573,
         "WGS 84 / North Pole LAEA Canada", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=-100 +x_0=0 +y_0=0 +datum=WG");
-    add_proj4text (p, 1,
-        "S84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Canada\",GEOGCS[\"WGS ");
-    add_srs_wkt (p, 1,
-        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_center\",90],PARAMETER[\"longitude_of_center\",-1");
-    add_srs_wkt (p, 8,
-        "00],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 9,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 10,
-        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"3573\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3574, "epsg", 3574,
+        "Easting", "South", "Northing", "South",
+        "+proj=laea +lat_0=90 +lon_0=-100 +x_0=0 +y_0=0 +datum=WG"
+        "S84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / North Pole LAEA Canada\",GEOGCS[\"WGS "
+        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298."
+        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG"
+        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC"
+        "TION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latit"
+        "ude_of_center\",90],PARAMETER[\"longitude_of_center\",-1"
+        "00],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO"
+        "RITY[\"EPSG\",\"3573\"]]"},
+    {3574, "epsg", 3574,
         "WGS 84 / North Pole LAEA Atlantic", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=-40 +x_0=0 +y_0=0 +datum=WGS");
-    add_proj4text (p, 1,
-        "84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Atlantic\",GEOGCS[\"WG");
-    add_srs_wkt (p, 1,
-        "S 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,29");
-    add_srs_wkt (p, 2,
-        "8.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"lati");
-    add_srs_wkt (p, 7,
-        "tude_of_center\",90],PARAMETER[\"longitude_of_center\",-");
-    add_srs_wkt (p, 8,
-        "40],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 9,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 10,
-        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"3574\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3575, "epsg", 3575,
+        "Easting", "South", "Northing", "South",
+        "+proj=laea +lat_0=90 +lon_0=-40 +x_0=0 +y_0=0 +datum=WGS"
+        "84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / North Pole LAEA Atlantic\",GEOGCS[\"WG"
+        "S 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,29"
+        "8.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EP"
+        "SG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJE"
+        "CTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"lati"
+        "tude_of_center\",90],PARAMETER[\"longitude_of_center\",-"
+        "40],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO"
+        "RITY[\"EPSG\",\"3574\"]]"},
+    {3575, "epsg", 3575,
         "WGS 84 / North Pole LAEA Europe", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=10 +x_0=0 +y_0=0 +datum=WGS8");
-    add_proj4text (p, 1,
-        "4 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Europe\",GEOGCS[\"WGS ");
-    add_srs_wkt (p, 1,
-        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_center\",90],PARAMETER[\"longitude_of_center\",10");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"false_easting\",0],PARAMETER[\"false_north");
-    add_srs_wkt (p, 9,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 10,
-        "AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHORI");
-    add_srs_wkt (p, 11,
-        "TY[\"EPSG\",\"3575\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3576, "epsg", 3576,
+        "Easting", "South", "Northing", "South",
+        "+proj=laea +lat_0=90 +lon_0=10 +x_0=0 +y_0=0 +datum=WGS8"
+        "4 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / North Pole LAEA Europe\",GEOGCS[\"WGS "
+        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298."
+        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG"
+        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC"
+        "TION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latit"
+        "ude_of_center\",90],PARAMETER[\"longitude_of_center\",10"
+        "],PARAMETER[\"false_easting\",0],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHORI"
+        "TY[\"EPSG\",\"3575\"]]"},
+    {3576, "epsg", 3576,
         "WGS 84 / North Pole LAEA Russia", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=90 +x_0=0 +y_0=0 +datum=WGS8");
-    add_proj4text (p, 1,
-        "4 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / North Pole LAEA Russia\",GEOGCS[\"WGS ");
-    add_srs_wkt (p, 1,
-        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_center\",90],PARAMETER[\"longitude_of_center\",90");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"false_easting\",0],PARAMETER[\"false_north");
-    add_srs_wkt (p, 9,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 10,
-        "AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHORI");
-    add_srs_wkt (p, 11,
-        "TY[\"EPSG\",\"3576\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3577, "epsg", 3577,
+        "Easting", "South", "Northing", "South",
+        "+proj=laea +lat_0=90 +lon_0=90 +x_0=0 +y_0=0 +datum=WGS8"
+        "4 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / North Pole LAEA Russia\",GEOGCS[\"WGS "
+        "84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298."
+        "257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG"
+        "\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJEC"
+        "TION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"latit"
+        "ude_of_center\",90],PARAMETER[\"longitude_of_center\",90"
+        "],PARAMETER[\"false_easting\",0],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHORI"
+        "TY[\"EPSG\",\"3576\"]]"},
+    {3577, "epsg", 3577,
         "GDA94 / Australian Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "Geocentric_Datum_of_Australia_1994", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=-18 +lat_2=-36 +lat_0=0 +lon_0=132 +x_0");
-    add_proj4text (p, 1,
-        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDA94 / Australian Albers\",GEOGCS[\"GDA94\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Geocentric_Datum_of_Australia_1994\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4283\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"latitude_of_center\",0],PARAMETER[\"longitude");
-    add_srs_wkt (p, 8,
-        "_of_center\",132],PARAMETER[\"standard_parallel_1\",-18]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_2\",-36],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3577\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3578, "epsg", 3578,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=-18 +lat_2=-36 +lat_0=0 +lon_0=132 +x_0"
+        "=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"GDA94 / Australian Albers\",GEOGCS[\"GDA94\",DA"
+        "TUM[\"Geocentric_Datum_of_Australia_1994\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4283\"]],PROJECTION[\"Albers_Conic_Equal_Area\"],P"
+        "ARAMETER[\"latitude_of_center\",0],PARAMETER[\"longitude"
+        "_of_center\",132],PARAMETER[\"standard_parallel_1\",-18]"
+        ",PARAMETER[\"standard_parallel_2\",-36],PARAMETER[\"fals"
+        "e_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3577\""
+        "]]"},
+    {3578, "epsg", 3578,
         "NAD83 / Yukon Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=61.66666666666666 +lat_2=68 +lat_0=59 +");
-    add_proj4text (p, 1,
-        "lon_0=-132.5 +x_0=500000 +y_0=500000 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Yukon Albers\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"lati");
-    add_srs_wkt (p, 7,
-        "tude_of_center\",59],PARAMETER[\"longitude_of_center\",-");
-    add_srs_wkt (p, 8,
-        "132.5],PARAMETER[\"standard_parallel_1\",61.666666666666");
-    add_srs_wkt (p, 9,
-        "7],PARAMETER[\"standard_parallel_2\",68],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",500000],PARAMETER[\"false_northing\",500000");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"3578\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3579, "epsg", 3579,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=61.66666666666666 +lat_2=68 +lat_0=59 +"
+        "lon_0=-132.5 +x_0=500000 +y_0=500000 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Yukon Albers\",GEOGCS[\"NAD83\",DATUM[\""
+        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],"
+        "PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"lati"
+        "tude_of_center\",59],PARAMETER[\"longitude_of_center\",-"
+        "132.5],PARAMETER[\"standard_parallel_1\",61.666666666666"
+        "7],PARAMETER[\"standard_parallel_2\",68],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",500000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3578\"]]"},
+    {3579, "epsg", 3579,
         "NAD83(CSRS) / Yukon Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=61.66666666666666 +lat_2=68 +lat_0=59 +");
-    add_proj4text (p, 1,
-        "lon_0=-132.5 +x_0=500000 +y_0=500000 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Yukon Albers\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Albers_Conic_Equ");
-    add_srs_wkt (p, 7,
-        "al_Area\"],PARAMETER[\"latitude_of_center\",59],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"longitude_of_center\",-132.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",61.6666666666667],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",68],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_northing\",500000],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3579\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3580, "epsg", 3580,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=61.66666666666666 +lat_2=68 +lat_0=59 +"
+        "lon_0=-132.5 +x_0=500000 +y_0=500000 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Yukon Albers\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Albers_Conic_Equ"
+        "al_Area\"],PARAMETER[\"latitude_of_center\",59],PARAMETE"
+        "R[\"longitude_of_center\",-132.5],PARAMETER[\"standard_p"
+        "arallel_1\",61.6666666666667],PARAMETER[\"standard_paral"
+        "lel_2\",68],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",500000],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3579\"]]"},
+    {3580, "epsg", 3580,
         "NAD83 / NWT Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=62 +lat_2=70 +lat_0=0 +lon_0=-112 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / NWT Lambert\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "112],PARAMETER[\"standard_parallel_1\",62],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_2\",70],PARAMETER[\"false_easting\",0],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 11,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 12,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3580\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3581, "epsg", 3581,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=62 +lat_2=70 +lat_0=0 +lon_0=-112 +x_0="
+        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"NAD83 / NWT Lambert\",GEOGCS[\"NAD83\",DATUM[\""
+        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],"
+        "PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-"
+        "112],PARAMETER[\"standard_parallel_1\",62],PARAMETER[\"s"
+        "tandard_parallel_2\",70],PARAMETER[\"false_easting\",0],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI"
+        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3580\"]]"},
+    {3581, "epsg", 3581,
         "NAD83(CSRS) / NWT Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=62 +lat_2=70 +lat_0=0 +lon_0=-112 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / NWT Lambert\",GEOGCS[\"NAD83(CSRS");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 7,
-        "_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",0],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"central_meridian\",-112],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",62],PARAMETER[\"standard_parallel_2\",70],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",0],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"3581\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3582, "epsg", 3582,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=62 +lat_2=70 +lat_0=0 +lon_0=-112 +x_0="
+        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"NAD83(CSRS) / NWT Lambert\",GEOGCS[\"NAD83(CSRS"
+        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_Conformal"
+        "_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",0],PARAME"
+        "TER[\"central_meridian\",-112],PARAMETER[\"standard_para"
+        "llel_1\",62],PARAMETER[\"standard_parallel_2\",70],PARAM"
+        "ETER[\"false_easting\",0],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3581\"]]"},
+    {3582, "epsg", 3582,
         "NAD83(NSRS2007) / Maryland (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Maryland (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",37.6666666666667],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-77],PARAMETER[\"standard_parallel_1\",39.45],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",38.3],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1312333.333],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 12,
-        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"3582\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3583, "epsg", 3583,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666"
+        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8"
+        "0 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Maryland (ftUS)\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",37.6666666666667],PARAMETER[\"central_meridian\","
+        "-77],PARAMETER[\"standard_parallel_1\",39.45],PARAMETER["
+        "\"standard_parallel_2\",38.3],PARAMETER[\"false_easting\""
+        ",1312333.333],PARAMETER[\"false_northing\",0],UNIT[\"US "
+        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900"
+        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3582\"]]"},
+    {3583, "epsg", 3583,
         "NAD83(NSRS2007) / Massachusetts Island", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Island\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",41],PARAMETER[\"central_meridian\",-70.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",41.4833333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",41.2833333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"3583\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3584, "epsg", 3584,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333"
+        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Island\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",41],PARAMETER[\"central_meridian\",-70.5],P"
+        "ARAMETER[\"standard_parallel_1\",41.4833333333333],PARAM"
+        "ETER[\"standard_parallel_2\",41.2833333333333],PARAMETER"
+        "[\"false_easting\",500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3583\"]]"},
+    {3584, "epsg", 3584,
         "NAD83(NSRS2007) / Massachusetts Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Island (ftUS)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati");
-    add_srs_wkt (p, 2,
-        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",41],PARAMETER[\"central_meridian\",-7");
-    add_srs_wkt (p, 9,
-        "0.5],PARAMETER[\"standard_parallel_1\",41.4833333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",41.2833333333333],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",1640416.667],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3584\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3585, "epsg", 3585,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333"
+        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Island (ftUS)\""
+        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati"
+        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",41],PARAMETER[\"central_meridian\",-7"
+        "0.5],PARAMETER[\"standard_parallel_1\",41.4833333333333]"
+        ",PARAMETER[\"standard_parallel_2\",41.2833333333333],PAR"
+        "AMETER[\"false_easting\",1640416.667],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3584\"]]"},
+    {3585, "epsg", 3585,
         "NAD83(NSRS2007) / Massachusetts Mainland", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000 +y_0=750000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Mainland\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",41],PARAMETER[\"central_meridian\",-71.5]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_1\",42.6833333333333],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"standard_parallel_2\",41.7166666666667],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_easting\",200000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",750000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"3585\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3586, "epsg", 3586,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666"
+        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000 +y_0=750000 +ellp"
+        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Mainland\",GEOG"
+        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",41],PARAMETER[\"central_meridian\",-71.5]"
+        ",PARAMETER[\"standard_parallel_1\",42.6833333333333],PAR"
+        "AMETER[\"standard_parallel_2\",41.7166666666667],PARAMET"
+        "ER[\"false_easting\",200000],PARAMETER[\"false_northing\""
+        ",750000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3585\"]]"},
+    {3586, "epsg", 3586,
         "NAD83(NSRS2007) / Massachusetts Mainland (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7");
-    add_proj4text (p, 2,
-        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Mainland (ftUS)");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spa");
-    add_srs_wkt (p, 2,
-        "tial_Reference_System_2007\",SPHEROID[\"GRS 1980\",63781");
-    add_srs_wkt (p, 3,
-        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]]");
-    add_srs_wkt (p, 7,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",41],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-71.5],PARAMETER[\"standard_parallel_1\",42.683333333333");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"standard_parallel_2\",41.7166666666667],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",656166.667],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",2460625],UNIT[\"US survey foot\",0.304800609");
-    add_srs_wkt (p, 13,
-        "601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 14,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3586\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3587, "epsg", 3587,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666"
+        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7"
+        "50000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Massachusetts Mainland (ftUS)"
+        "\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spa"
+        "tial_Reference_System_2007\",SPHEROID[\"GRS 1980\",63781"
+        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY"
+        "[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]]"
+        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",41],PARAMETER[\"central_meridian\","
+        "-71.5],PARAMETER[\"standard_parallel_1\",42.683333333333"
+        "3],PARAMETER[\"standard_parallel_2\",41.7166666666667],P"
+        "ARAMETER[\"false_easting\",656166.667],PARAMETER[\"false"
+        "_northing\",2460625],UNIT[\"US survey foot\",0.304800609"
+        "601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3586\""
+        "]]"},
+    {3587, "epsg", 3587,
         "NAD83(NSRS2007) / Michigan Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=6000000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",43.3166666666667],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-84.3666666666667],PARAMETER[\"standard_parallel_1\",45");
-    add_srs_wkt (p, 10,
-        ".7],PARAMETER[\"standard_parallel_2\",44.1833333333333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",6000000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 12,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"3587\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3588, "epsg", 3588,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43"
+        ".31666666666667 +lon_0=-84.36666666666666 +x_0=6000000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(NSRS2007) / Michigan Central\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",43.3166666666667],PARAMETER[\"central_meridian\""
+        ",-84.3666666666667],PARAMETER[\"standard_parallel_1\",45"
+        ".7],PARAMETER[\"standard_parallel_2\",44.1833333333333],"
+        "PARAMETER[\"false_easting\",6000000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3587\"]]"},
+    {3588, "epsg", 3588,
         "NAD83(NSRS2007) / Michigan Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9");
-    add_proj4text (p, 2,
-        "99976001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni");
-    add_proj4text (p, 3,
-        "ts=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan Central (ft)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",43.3166666666667],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-84.3666666666667],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 10,
-        "\",45.7],PARAMETER[\"standard_parallel_2\",44.1833333333");
-    add_srs_wkt (p, 11,
-        "333],PARAMETER[\"false_easting\",19685039.37],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3588\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3589, "epsg", 3589,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43"
+        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9"
+        "99976001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +uni"
+        "ts=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Michigan Central (ft)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",43.3166666666667],PARAMETER[\"central_merid"
+        "ian\",-84.3666666666667],PARAMETER[\"standard_parallel_1"
+        "\",45.7],PARAMETER[\"standard_parallel_2\",44.1833333333"
+        "333],PARAMETER[\"false_easting\",19685039.37],PARAMETER["
+        "\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"E"
+        "PSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3588\"]]"},
+    {3589, "epsg", 3589,
         "NAD83(NSRS2007) / Michigan North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=8000000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 3,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",44.7833333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-87],PARAMETER[\"standard_parallel_1\",47.0833333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",45.4833333333333],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",8000000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 12,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"3589\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3590, "epsg", 3590,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333"
+        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=8000000 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def"
+        "s",
+        "PROJCS[\"NAD83(NSRS2007) / Michigan North\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",44.7833333333333],PARAMETER[\"central_meridian\","
+        "-87],PARAMETER[\"standard_parallel_1\",47.0833333333333]"
+        ",PARAMETER[\"standard_parallel_2\",45.4833333333333],PAR"
+        "AMETER[\"false_easting\",8000000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"3589\"]]"},
+    {3590, "epsg", 3590,
         "NAD83(NSRS2007) / Michigan North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999");
-    add_proj4text (p, 2,
-        "968001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan North (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",44.7833333333333],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-87],PARAMETER[\"standard_parallel_1\",47.083333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"standard_parallel_2\",45.4833333333333");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",26246719.16],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 14,
-        "ORTH],AUTHORITY[\"EPSG\",\"3590\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3591, "epsg", 3591,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333"
+        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999"
+        "968001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Michigan North (ft)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",44.7833333333333],PARAMETER[\"central_meridi"
+        "an\",-87],PARAMETER[\"standard_parallel_1\",47.083333333"
+        "3333],PARAMETER[\"standard_parallel_2\",45.4833333333333"
+        "],PARAMETER[\"false_easting\",26246719.16],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG"
+        "\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"3590\"]]"},
+    {3591, "epsg", 3591,
         "NAD83(NSRS2007) / Michigan Oblique Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33");
-    add_proj4text (p, 1,
-        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no");
-    add_proj4text (p, 2,
-        "_uoff +gamma=337.25556 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 3,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan Oblique Mercator\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Hotine_Oblique_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 8,
-        "e_of_center\",45.3091666666667],PARAMETER[\"longitude_of");
-    add_srs_wkt (p, 9,
-        "_center\",-86],PARAMETER[\"azimuth\",337.25556],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"rectified_grid_angle\",337.25556],PARAMETER[\"scale_");
-    add_srs_wkt (p, 11,
-        "factor\",0.9996],PARAMETER[\"false_easting\",2546731.496");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_northing\",-4354009.816],UNIT[\"metr");
-    add_srs_wkt (p, 13,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3591\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3592, "epsg", 3592,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33"
+        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no"
+        "_uoff +gamma=337.25556 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Michigan Oblique Mercator\",G"
+        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO"
+        "JECTION[\"Hotine_Oblique_Mercator\"],PARAMETER[\"latitud"
+        "e_of_center\",45.3091666666667],PARAMETER[\"longitude_of"
+        "_center\",-86],PARAMETER[\"azimuth\",337.25556],PARAMETE"
+        "R[\"rectified_grid_angle\",337.25556],PARAMETER[\"scale_"
+        "factor\",0.9996],PARAMETER[\"false_easting\",2546731.496"
+        "],PARAMETER[\"false_northing\",-4354009.816],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3591\"]"
+        "]"},
+    {3592, "epsg", 3592,
         "NAD83(NSRS2007) / Michigan South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=4000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",41.5],PARAMETER[\"central_meridian\",-84.36666666");
-    add_srs_wkt (p, 9,
-        "66667],PARAMETER[\"standard_parallel_1\",43.666666666666");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"standard_parallel_2\",42.1],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",4000000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3592\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3593, "epsg", 3593,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41"
+        ".5 +lon_0=-84.36666666666666 +x_0=4000000 +y_0=0 +ellps="
+        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Michigan South\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",41.5],PARAMETER[\"central_meridian\",-84.36666666"
+        "66667],PARAMETER[\"standard_parallel_1\",43.666666666666"
+        "7],PARAMETER[\"standard_parallel_2\",42.1],PARAMETER[\"f"
+        "alse_easting\",4000000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3592\"]]"},
+    {3593, "epsg", 3593,
         "NAD83(NSRS2007) / Michigan South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Michigan South (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",41.5],PARAMETER[\"central_meridian\",-84.366");
-    add_srs_wkt (p, 9,
-        "6666666667],PARAMETER[\"standard_parallel_1\",43.6666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"standard_parallel_2\",42.1],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",13123359.58],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"3593\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3594, "epsg", 3594,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41"
+        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Michigan South (ft)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",41.5],PARAMETER[\"central_meridian\",-84.366"
+        "6666666667],PARAMETER[\"standard_parallel_1\",43.6666666"
+        "666667],PARAMETER[\"standard_parallel_2\",42.1],PARAMETE"
+        "R[\"false_easting\",13123359.58],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3593\"]]"},
+    {3594, "epsg", 3594,
         "NAD83(NSRS2007) / Minnesota Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4");
-    add_proj4text (p, 1,
-        "5 +lon_0=-94.25 +x_0=800000 +y_0=100000 +ellps=GRS80 +to");
-    add_proj4text (p, 2,
-        "wgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Minnesota Central\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",45],PARAMETER[\"central_meridian\",-94.25],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",47.05],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",45.6166666666667],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",800000],PARAMETER[\"false_northing\",100000],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 14,
-        "594\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3595, "epsg", 3595,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4"
+        "5 +lon_0=-94.25 +x_0=800000 +y_0=100000 +ellps=GRS80 +to"
+        "wgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Minnesota Central\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",45],PARAMETER[\"central_meridian\",-94.25],PAR"
+        "AMETER[\"standard_parallel_1\",47.05],PARAMETER[\"standa"
+        "rd_parallel_2\",45.6166666666667],PARAMETER[\"false_east"
+        "ing\",800000],PARAMETER[\"false_northing\",100000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "594\"]]"},
+    {3595, "epsg", 3595,
         "NAD83(NSRS2007) / Minnesota North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000 +y");
-    add_proj4text (p, 2,
-        "_0=100000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Minnesota North\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",46.5],PARAMETER[\"central_meridian\",-93.1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",48.6333333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",47.0333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",800000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 12,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"3595\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3596, "epsg", 3596,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333"
+        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000 +y"
+        "_0=100000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Minnesota North\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",46.5],PARAMETER[\"central_meridian\",-93.1],PARAM"
+        "ETER[\"standard_parallel_1\",48.6333333333333],PARAMETER"
+        "[\"standard_parallel_2\",47.0333333333333],PARAMETER[\"f"
+        "alse_easting\",800000],PARAMETER[\"false_northing\",1000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3595\"]]"},
+    {3596, "epsg", 3596,
         "NAD83(NSRS2007) / Minnesota South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=43 +lon_0=-94 +x_0=800000 +y_0=100000 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Minnesota South\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",43],PARAMETER[\"central_meridian\",-94],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",45.2166666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",43.7833333333333],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",800000],PARAMETER[\"false_northing\",100000],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3596\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3597, "epsg", 3597,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333"
+        "333 +lat_0=43 +lon_0=-94 +x_0=800000 +y_0=100000 +ellps="
+        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Minnesota South\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",43],PARAMETER[\"central_meridian\",-94],PARAMETER"
+        "[\"standard_parallel_1\",45.2166666666667],PARAMETER[\"s"
+        "tandard_parallel_2\",43.7833333333333],PARAMETER[\"false"
+        "_easting\",800000],PARAMETER[\"false_northing\",100000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3596\"]]"},
+    {3597, "epsg", 3597,
         "NAD83(NSRS2007) / Mississippi East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi East\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "29.5],PARAMETER[\"central_meridian\",-88.8333333333333],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",300000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3597");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3598, "epsg", 3598,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9"
+        "9995 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Mississippi East\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "29.5],PARAMETER[\"central_meridian\",-88.8333333333333],"
+        "PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_ea"
+        "sting\",300000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3597"
+        "\"]]"},
+    {3598, "epsg", 3598,
         "NAD83(NSRS2007) / Mississippi East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi East (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",29.5],PARAMETER[\"central_meridian\",-88.8333333");
-    add_srs_wkt (p, 9,
-        "333333],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",984250],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3598\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3599, "epsg", 3599,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9"
+        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Mississippi East (ftUS)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",29.5],PARAMETER[\"central_meridian\",-88.8333333"
+        "333333],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\""
+        "false_easting\",984250],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP"
+        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3598\"]]"},
+    {3599, "epsg", 3599,
         "NAD83(NSRS2007) / Mississippi West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi West\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "29.5],PARAMETER[\"central_meridian\",-90.3333333333333],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",700000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3599");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3600, "epsg", 3600,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9"
+        "9995 +x_0=700000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Mississippi West\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "29.5],PARAMETER[\"central_meridian\",-90.3333333333333],"
+        "PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_ea"
+        "sting\",700000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3599"
+        "\"]]"},
+    {3600, "epsg", 3600,
         "NAD83(NSRS2007) / Mississippi West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi West (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",29.5],PARAMETER[\"central_meridian\",-90.3333333");
-    add_srs_wkt (p, 9,
-        "333333],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",2296583.333],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3600\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3601, "epsg", 3601,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9"
+        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Mississippi West (ftUS)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",29.5],PARAMETER[\"central_meridian\",-90.3333333"
+        "333333],PARAMETER[\"scale_factor\",0.99995],PARAMETER[\""
+        "false_easting\",2296583.333],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3600\"]]"},
+    {3601, "epsg", 3601,
         "NAD83(NSRS2007) / Missouri Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-92.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Missouri Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "35.8333333333333],PARAMETER[\"central_meridian\",-92.5],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",0.999933333],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 12,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3601\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3602, "epsg", 3602,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-92.5 +k=0.9"
+        "99933333 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Missouri Central\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "35.8333333333333],PARAMETER[\"central_meridian\",-92.5],"
+        "PARAMETER[\"scale_factor\",0.999933333],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3601\"]]"},
+    {3602, "epsg", 3602,
         "NAD83(NSRS2007) / Missouri East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-90.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=250000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Missouri East\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",35");
-    add_srs_wkt (p, 8,
-        ".8333333333333],PARAMETER[\"central_meridian\",-90.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",0.999933333],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",250000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"360");
-    add_srs_wkt (p, 13,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3603, "epsg", 3603,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-90.5 +k=0.9"
+        "99933333 +x_0=250000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Missouri East\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",35"
+        ".8333333333333],PARAMETER[\"central_meridian\",-90.5],PA"
+        "RAMETER[\"scale_factor\",0.999933333],PARAMETER[\"false_"
+        "easting\",250000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"360"
+        "2\"]]"},
+    {3603, "epsg", 3603,
         "NAD83(NSRS2007) / Missouri West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.16666666666666 +lon_0=-94.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99941177 +x_0=850000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Missouri West\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".1666666666667],PARAMETER[\"central_meridian\",-94.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",0.999941177],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",850000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"360");
-    add_srs_wkt (p, 13,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3604, "epsg", 3604,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.16666666666666 +lon_0=-94.5 +k=0.9"
+        "99941177 +x_0=850000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Missouri West\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36"
+        ".1666666666667],PARAMETER[\"central_meridian\",-94.5],PA"
+        "RAMETER[\"scale_factor\",0.999941177],PARAMETER[\"false_"
+        "easting\",850000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"360"
+        "3\"]]"},
+    {3604, "epsg", 3604,
         "NAD83(NSRS2007) / Montana", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Montana\",GEOGCS[\"NAD83(NSRS");
-    add_srs_wkt (p, 1,
-        "2007)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "44.25],PARAMETER[\"central_meridian\",-109.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",49],PARAMETER[\"standard_paralle");
-    add_srs_wkt (p, 10,
-        "l_2\",45],PARAMETER[\"false_easting\",600000],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"3604\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3605, "epsg", 3605,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5"
+        " +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Montana\",GEOGCS[\"NAD83(NSRS"
+        "2007)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "44.25],PARAMETER[\"central_meridian\",-109.5],PARAMETER["
+        "\"standard_parallel_1\",49],PARAMETER[\"standard_paralle"
+        "l_2\",45],PARAMETER[\"false_easting\",600000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3604\"]]"},
+    {3605, "epsg", 3605,
         "NAD83(NSRS2007) / Montana (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Montana (ft)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",44.25],PARAMETER[\"central_meridian\",-109.5],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",49],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",45],PARAMETER[\"false_easting\",1968503.937],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3605\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3606, "epsg", 3606,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5"
+        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Montana (ft)\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",44.25],PARAMETER[\"central_meridian\",-109.5],PARAME"
+        "TER[\"standard_parallel_1\",49],PARAMETER[\"standard_par"
+        "allel_2\",45],PARAMETER[\"false_easting\",1968503.937],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTH"
+        "ORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3605\"]]"},
+    {3606, "epsg", 3606,
         "NAD83(NSRS2007) / Nebraska", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +");
-    add_proj4text (p, 1,
-        "lon_0=-100 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nebraska\",GEOGCS[\"NAD83(NSR");
-    add_srs_wkt (p, 1,
-        "S2007)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",39.8333333333333],PARAMETER[\"central_meridian\",-100],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",43],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",40],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 13,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3606\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3607, "epsg", 3607,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +"
+        "lon_0=-100 +x_0=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Nebraska\",GEOGCS[\"NAD83(NSR"
+        "S2007)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",39.8333333333333],PARAMETER[\"central_meridian\",-100],"
+        "PARAMETER[\"standard_parallel_1\",43],PARAMETER[\"standa"
+        "rd_parallel_2\",40],PARAMETER[\"false_easting\",500000],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI"
+        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3606\"]]"},
+    {3607, "epsg", 3607,
         "NAD83(NSRS2007) / Nevada Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada Central\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 8,
-        "4.75],PARAMETER[\"central_meridian\",-116.666666666667],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",500000],PARAMETER[\"false_northing\",6000000],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "3607\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3608, "epsg", 3608,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0."
+        "9999 +x_0=500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Nevada Central\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3"
+        "4.75],PARAMETER[\"central_meridian\",-116.666666666667],"
+        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",6000000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3607\"]]"},
+    {3608, "epsg", 3608,
         "NAD83(NSRS2007) / Nevada Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada Central (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",34.75],PARAMETER[\"central_meridian\",-116.66666666");
-    add_srs_wkt (p, 9,
-        "6667],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",1640416.6667],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "19685000],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3608\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3609, "epsg", 3609,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0."
+        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Nevada Central (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",34.75],PARAMETER[\"central_meridian\",-116.66666666"
+        "6667],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"fal"
+        "se_easting\",1640416.6667],PARAMETER[\"false_northing\","
+        "19685000],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3608\"]]"},
+    {3609, "epsg", 3609,
         "NAD83(NSRS2007) / Nevada East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000 +y_0=8000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada East\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",34.7");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"central_meridian\",-115.583333333333],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",200000],PARAMETER[\"false_northing\",8000000],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"360");
-    add_srs_wkt (p, 13,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3610, "epsg", 3610,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0."
+        "9999 +x_0=200000 +y_0=8000000 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Nevada East\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",34.7"
+        "5],PARAMETER[\"central_meridian\",-115.583333333333],PAR"
+        "AMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eastin"
+        "g\",200000],PARAMETER[\"false_northing\",8000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"360"
+        "9\"]]"},
+    {3610, "epsg", 3610,
         "NAD83(NSRS2007) / Nevada East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada East (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",34.75],PARAMETER[\"central_meridian\",-115.583333333333");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",656166.6667],PARAMETER[\"false_northing\",26246");
-    add_srs_wkt (p, 11,
-        "666.6667],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3610\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3611, "epsg", 3611,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0."
+        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps="
+        "GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Nevada East (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",34.75],PARAMETER[\"central_meridian\",-115.583333333333"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",656166.6667],PARAMETER[\"false_northing\",26246"
+        "666.6667],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3610\"]]"},
+    {3611, "epsg", 3611,
         "NAD83(NSRS2007) / Nevada West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000 +y_0=4000000 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada West\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",34.7");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"central_meridian\",-118.583333333333],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",800000],PARAMETER[\"false_northing\",4000000],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"361");
-    add_srs_wkt (p, 13,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3612, "epsg", 3612,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0."
+        "9999 +x_0=800000 +y_0=4000000 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Nevada West\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",34.7"
+        "5],PARAMETER[\"central_meridian\",-118.583333333333],PAR"
+        "AMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eastin"
+        "g\",800000],PARAMETER[\"false_northing\",4000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"361"
+        "1\"]]"},
+    {3612, "epsg", 3612,
         "NAD83(NSRS2007) / Nevada West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Nevada West (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",34.75],PARAMETER[\"central_meridian\",-118.583333333333");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",2624666.6667],PARAMETER[\"false_northing\",1312");
-    add_srs_wkt (p, 11,
-        "3333.3333],UNIT[\"US survey foot\",0.304800609601219,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3612\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3613, "epsg", 3613,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0."
+        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Nevada West (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",34.75],PARAMETER[\"central_meridian\",-118.583333333333"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",2624666.6667],PARAMETER[\"false_northing\",1312"
+        "3333.3333],UNIT[\"US survey foot\",0.304800609601219,AUT"
+        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3612\"]]"},
+    {3613, "epsg", 3613,
         "NAD83(NSRS2007) / New Hampshire", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Hampshire\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",42");
-    add_srs_wkt (p, 8,
-        ".5],PARAMETER[\"central_meridian\",-71.6666666666667],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",0.999966667],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",300000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"361");
-    add_srs_wkt (p, 13,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3614, "epsg", 3614,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9"
+        "99966667 +x_0=300000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Hampshire\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",42"
+        ".5],PARAMETER[\"central_meridian\",-71.6666666666667],PA"
+        "RAMETER[\"scale_factor\",0.999966667],PARAMETER[\"false_"
+        "easting\",300000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"361"
+        "3\"]]"},
+    {3614, "epsg", 3614,
         "NAD83(NSRS2007) / New Hampshire (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Hampshire (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",42.5],PARAMETER[\"central_meridian\",-71.6666666666");
-    add_srs_wkt (p, 9,
-        "667],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",984250],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3614\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3615, "epsg", 3615,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9"
+        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Hampshire (ftUS)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",42.5],PARAMETER[\"central_meridian\",-71.6666666666"
+        "667],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\""
+        "false_easting\",984250],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP"
+        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3614\"]]"},
+    {3615, "epsg", 3615,
         "NAD83(NSRS2007) / New Jersey", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Jersey\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",38.83");
-    add_srs_wkt (p, 8,
-        "33333333333],PARAMETER[\"central_meridian\",-74.5],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",150000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3615\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3616, "epsg", 3616,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Jersey\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",38.83"
+        "33333333333],PARAMETER[\"central_meridian\",-74.5],PARAM"
+        "ETER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",150000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3615\"]]"},
+    {3616, "epsg", 3616,
         "NAD83(NSRS2007) / New Jersey (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Jersey (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",38.8333333333333],PARAMETER[\"central_meridian\",-74.5]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",492125],PARAMETER[\"false_northing\",0],UNIT[\"U");
-    add_srs_wkt (p, 11,
-        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"3616\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3617, "epsg", 3617,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Jersey (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",38.8333333333333],PARAMETER[\"central_meridian\",-74.5]"
+        ",PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_ea"
+        "sting\",492125],PARAMETER[\"false_northing\",0],UNIT[\"U"
+        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9"
+        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"3616\"]]"},
+    {3617, "epsg", 3617,
         "NAD83(NSRS2007) / New Mexico Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico Central\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",31],PARAMETER[\"central_meridian\",-106.25],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 11,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3617\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3618, "epsg", 3618,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000"
+        "00 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Mexico Central\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",31],PARAMETER[\"central_meridian\",-106.25],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3617\"]]"},
+    {3618, "epsg", 3618,
         "NAD83(NSRS2007) / New Mexico Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00.0001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico Central (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",31],PARAMETER[\"central_meridian\",-106.25],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",1640416.667],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"3618\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3619, "epsg", 3619,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000"
+        "00.0001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Mexico Central (ftUS)\",G"
+        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",31],PARAMETER[\"central_meridian\",-106.25],PA"
+        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti"
+        "ng\",1640416.667],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3618\"]]"},
+    {3619, "epsg", 3619,
         "NAD83(NSRS2007) / New Mexico East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico East\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"central_meridian\",-104.333333333333],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.999909091],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",165000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"361");
-    add_srs_wkt (p, 13,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3620, "epsg", 3620,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999"
+        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Mexico East\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3"
+        "1],PARAMETER[\"central_meridian\",-104.333333333333],PAR"
+        "AMETER[\"scale_factor\",0.999909091],PARAMETER[\"false_e"
+        "asting\",165000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"361"
+        "9\"]]"},
+    {3620, "epsg", 3620,
         "NAD83(NSRS2007) / New Mexico East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico East (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",31],PARAMETER[\"central_meridian\",-104.333333333");
-    add_srs_wkt (p, 9,
-        "333],PARAMETER[\"scale_factor\",0.999909091],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",541337.5],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3620\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3621, "epsg", 3621,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999"
+        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Mexico East (ftUS)\",GEOG"
+        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",31],PARAMETER[\"central_meridian\",-104.333333333"
+        "333],PARAMETER[\"scale_factor\",0.999909091],PARAMETER[\""
+        "false_easting\",541337.5],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3620\"]]"},
+    {3621, "epsg", 3621,
         "NAD83(NSRS2007) / New Mexico West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico West\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"central_meridian\",-107.833333333333],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.999916667],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",830000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"362");
-    add_srs_wkt (p, 13,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3622, "epsg", 3622,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999"
+        "916667 +x_0=830000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Mexico West\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3"
+        "1],PARAMETER[\"central_meridian\",-107.833333333333],PAR"
+        "AMETER[\"scale_factor\",0.999916667],PARAMETER[\"false_e"
+        "asting\",830000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"362"
+        "1\"]]"},
+    {3622, "epsg", 3622,
         "NAD83(NSRS2007) / New Mexico West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +towgs");
-    add_proj4text (p, 2,
-        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New Mexico West (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",31],PARAMETER[\"central_meridian\",-107.833333333");
-    add_srs_wkt (p, 9,
-        "333],PARAMETER[\"scale_factor\",0.999916667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",2723091.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3622\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3623, "epsg", 3623,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999"
+        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +towgs"
+        "84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New Mexico West (ftUS)\",GEOG"
+        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",31],PARAMETER[\"central_meridian\",-107.833333333"
+        "333],PARAMETER[\"scale_factor\",0.999916667],PARAMETER[\""
+        "false_easting\",2723091.667],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3622\"]]"},
+    {3623, "epsg", 3623,
         "NAD83(NSRS2007) / New York Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=250000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "40],PARAMETER[\"central_meridian\",-76.5833333333333],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",0.9999375],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",250000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3623");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3624, "epsg", 3624,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999"
+        "9375 +x_0=250000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New York Central\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "40],PARAMETER[\"central_meridian\",-76.5833333333333],PA"
+        "RAMETER[\"scale_factor\",0.9999375],PARAMETER[\"false_ea"
+        "sting\",250000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3623"
+        "\"]]"},
+    {3624, "epsg", 3624,
         "NAD83(NSRS2007) / New York Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",40],PARAMETER[\"central_meridian\",-76.583333333");
-    add_srs_wkt (p, 9,
-        "3333],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",820208.333],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3624\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3625, "epsg", 3625,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999"
+        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New York Central (ftUS)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",40],PARAMETER[\"central_meridian\",-76.583333333"
+        "3333],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\""
+        "false_easting\",820208.333],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3624\"]]"},
+    {3625, "epsg", 3625,
         "NAD83(NSRS2007) / New York East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York East\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",38");
-    add_srs_wkt (p, 8,
-        ".8333333333333],PARAMETER[\"central_meridian\",-74.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",150000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3625\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3626, "epsg", 3626,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New York East\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",38"
+        ".8333333333333],PARAMETER[\"central_meridian\",-74.5],PA"
+        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti"
+        "ng\",150000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3625\"]"
+        "]"},
+    {3626, "epsg", 3626,
         "NAD83(NSRS2007) / New York East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York East (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",38.8333333333333],PARAMETER[\"central_meridian\",-7");
-    add_srs_wkt (p, 9,
-        "4.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",492125],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"3626\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3627, "epsg", 3627,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0"
+        ",0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New York East (ftUS)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",38.8333333333333],PARAMETER[\"central_meridian\",-7"
+        "4.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"fals"
+        "e_easting\",492125],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3626\"]]"},
+    {3627, "epsg", 3627,
         "NAD83(NSRS2007) / New York Long Island", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York Long Island\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",40.1666666666667],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-74],PARAMETER[\"standard_parallel_1\",41.03333333");
-    add_srs_wkt (p, 10,
-        "33333],PARAMETER[\"standard_parallel_2\",40.666666666666");
-    add_srs_wkt (p, 11,
-        "7],PARAMETER[\"false_easting\",300000],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"3627\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3628, "epsg", 3628,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666"
+        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New York Long Island\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",40.1666666666667],PARAMETER[\"central_merid"
+        "ian\",-74],PARAMETER[\"standard_parallel_1\",41.03333333"
+        "33333],PARAMETER[\"standard_parallel_2\",40.666666666666"
+        "7],PARAMETER[\"false_easting\",300000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3627\"]]"},
+    {3628, "epsg", 3628,
         "NAD83(NSRS2007) / New York Long Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000");
-    add_proj4text (p, 2,
-        "000001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York Long Island (ftUS)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati");
-    add_srs_wkt (p, 2,
-        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",40.1666666666667],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-74],PARAMETER[\"standard_parallel_1\",41.03");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"standard_parallel_2\",40.666666");
-    add_srs_wkt (p, 11,
-        "6666667],PARAMETER[\"false_easting\",984250],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096");
-    add_srs_wkt (p, 13,
-        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 14,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3628\"]");
-    add_srs_wkt (p, 15,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3629, "epsg", 3629,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666"
+        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000"
+        "000001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New York Long Island (ftUS)\""
+        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati"
+        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",40.1666666666667],PARAMETER[\"central"
+        "_meridian\",-74],PARAMETER[\"standard_parallel_1\",41.03"
+        "33333333333],PARAMETER[\"standard_parallel_2\",40.666666"
+        "6666667],PARAMETER[\"false_easting\",984250],PARAMETER[\""
+        "false_northing\",0],UNIT[\"US survey foot\",0.3048006096"
+        "01219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3628\"]"
+        "]"},
+    {3629, "epsg", 3629,
         "NAD83(NSRS2007) / New York West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York West\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-78.5833333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",350000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3629\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3630, "epsg", 3630,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999"
+        "9375 +x_0=350000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New York West\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40"
+        "],PARAMETER[\"central_meridian\",-78.5833333333333],PARA"
+        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east"
+        "ing\",350000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3629\""
+        "]]"},
+    {3630, "epsg", 3630,
         "NAD83(NSRS2007) / New York West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / New York West (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",40],PARAMETER[\"central_meridian\",-78.583333333333");
-    add_srs_wkt (p, 9,
-        "3],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",1148291.667],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3630\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3631, "epsg", 3631,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999"
+        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / New York West (ftUS)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",40],PARAMETER[\"central_meridian\",-78.583333333333"
+        "3],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"fal"
+        "se_easting\",1148291.667],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3630\"]]"},
+    {3631, "epsg", 3631,
         "NAD83(NSRS2007) / North Carolina", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.22 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Carolina\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",33.75],PARAMETER[\"central_meridian\",-79],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",36.1666666666667],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",34.3333333333333],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",609601.22],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"3631\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3632, "epsg", 3632,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333"
+        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.22 +y_0=0 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / North Carolina\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",33.75],PARAMETER[\"central_meridian\",-79],PARAME"
+        "TER[\"standard_parallel_1\",36.1666666666667],PARAMETER["
+        "\"standard_parallel_2\",34.3333333333333],PARAMETER[\"fa"
+        "lse_easting\",609601.22],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"3631\"]]"},
+    {3632, "epsg", 3632,
         "NAD83(NSRS2007) / North Carolina (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0=");
-    add_proj4text (p, 2,
-        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Carolina (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",33.75],PARAMETER[\"central_meridian\",-79],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",36.1666666666667],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",34.3333333333333],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",2000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3632\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3633, "epsg", 3633,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333"
+        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0="
+        "0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_d"
+        "efs",
+        "PROJCS[\"NAD83(NSRS2007) / North Carolina (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",33.75],PARAMETER[\"central_meridian\",-79],"
+        "PARAMETER[\"standard_parallel_1\",36.1666666666667],PARA"
+        "METER[\"standard_parallel_2\",34.3333333333333],PARAMETE"
+        "R[\"false_easting\",2000000],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3632\"]]"},
+    {3633, "epsg", 3633,
         "NAD83(NSRS2007) / North Dakota North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Dakota North\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",47],PARAMETER[\"central_meridian\",-100.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",48.7333333333333],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",47.4333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",600000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3633\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3634, "epsg", 3634,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333"
+        "333 +lat_0=47 +lon_0=-100.5 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / North Dakota North\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",47],PARAMETER[\"central_meridian\",-100.5],PAR"
+        "AMETER[\"standard_parallel_1\",48.7333333333333],PARAMET"
+        "ER[\"standard_parallel_2\",47.4333333333333],PARAMETER[\""
+        "false_easting\",600000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3633\"]]"},
+    {3634, "epsg", 3634,
         "NAD83(NSRS2007) / North Dakota North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Dakota North (ft)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",47],PARAMETER[\"central_meridian\",-100.");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_1\",48.7333333333333],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",47.4333333333333],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",1968503.937],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "02\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 14,
-        "UTHORITY[\"EPSG\",\"3634\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3635, "epsg", 3635,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333"
+        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / North Dakota North (ft)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",47],PARAMETER[\"central_meridian\",-100."
+        "5],PARAMETER[\"standard_parallel_1\",48.7333333333333],P"
+        "ARAMETER[\"standard_parallel_2\",47.4333333333333],PARAM"
+        "ETER[\"false_easting\",1968503.937],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"90"
+        "02\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"3634\"]]"},
+    {3635, "epsg", 3635,
         "NAD83(NSRS2007) / North Dakota South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Dakota South\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",45.6666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-100.5],PARAMETER[\"standard_parallel_1\",47.48333333");
-    add_srs_wkt (p, 10,
-        "33333],PARAMETER[\"standard_parallel_2\",46.183333333333");
-    add_srs_wkt (p, 11,
-        "3],PARAMETER[\"false_easting\",600000],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"3635\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3636, "epsg", 3636,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333"
+        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(NSRS2007) / North Dakota South\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",45.6666666666667],PARAMETER[\"central_meridian"
+        "\",-100.5],PARAMETER[\"standard_parallel_1\",47.48333333"
+        "33333],PARAMETER[\"standard_parallel_2\",46.183333333333"
+        "3],PARAMETER[\"false_easting\",600000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3635\"]]"},
+    {3636, "epsg", 3636,
         "NAD83(NSRS2007) / North Dakota South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9");
-    add_proj4text (p, 2,
-        "999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / North Dakota South (ft)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",45.6666666666667],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-100.5],PARAMETER[\"standard_parallel_1\",47.48");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"standard_parallel_2\",46.183333");
-    add_srs_wkt (p, 11,
-        "3333333],PARAMETER[\"false_easting\",1968503.937],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 14,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3636\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3637, "epsg", 3637,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333"
+        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9"
+        "999976 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / North Dakota South (ft)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",45.6666666666667],PARAMETER[\"central_me"
+        "ridian\",-100.5],PARAMETER[\"standard_parallel_1\",47.48"
+        "33333333333],PARAMETER[\"standard_parallel_2\",46.183333"
+        "3333333],PARAMETER[\"false_easting\",1968503.937],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY"
+        "[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3636\"]]"},
+    {3637, "epsg", 3637,
         "NAD83(NSRS2007) / Ohio North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Ohio North\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",39.6666666666667],PARAMETER[\"central_meridian\",-82.");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_1\",41.7],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",40.4333333333333],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",600000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 14,
-        "637\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3638, "epsg", 3638,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39"
+        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Ohio North\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",39.6666666666667],PARAMETER[\"central_meridian\",-82."
+        "5],PARAMETER[\"standard_parallel_1\",41.7],PARAMETER[\"s"
+        "tandard_parallel_2\",40.4333333333333],PARAMETER[\"false"
+        "_easting\",600000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "637\"]]"},
+    {3638, "epsg", 3638,
         "NAD83(NSRS2007) / Ohio South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Ohio South\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",38],PARAMETER[\"central_meridian\",-82.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",40.0333333333333],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",38.7333333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3638");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3639, "epsg", 3639,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333"
+        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Ohio South\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",38],PARAMETER[\"central_meridian\",-82.5],PARAMETER[\""
+        "standard_parallel_1\",40.0333333333333],PARAMETER[\"stan"
+        "dard_parallel_2\",38.7333333333333],PARAMETER[\"false_ea"
+        "sting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3638"
+        "\"]]"},
+    {3639, "epsg", 3639,
         "NAD83(NSRS2007) / Oklahoma North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oklahoma North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",35],PARAMETER[\"central_meridian\",-98],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",36.7666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",35.5666666666667],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",600000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 14,
-        "639\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3640, "epsg", 3640,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666"
+        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oklahoma North\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",35],PARAMETER[\"central_meridian\",-98],PARAMETER"
+        "[\"standard_parallel_1\",36.7666666666667],PARAMETER[\"s"
+        "tandard_parallel_2\",35.5666666666667],PARAMETER[\"false"
+        "_easting\",600000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "639\"]]"},
+    {3640, "epsg", 3640,
         "NAD83(NSRS2007) / Oklahoma North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oklahoma North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",35],PARAMETER[\"central_meridian\",-98],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",36.7666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",35.5666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",1968500],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3640\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3641, "epsg", 3641,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666"
+        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oklahoma North (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",35],PARAMETER[\"central_meridian\",-98],PAR"
+        "AMETER[\"standard_parallel_1\",36.7666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",35.5666666666667],PARAMETER[\""
+        "false_easting\",1968500],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E"
+        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3640\"]]"},
+    {3641, "epsg", 3641,
         "NAD83(NSRS2007) / Oklahoma South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oklahoma South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",33.3333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-98],PARAMETER[\"standard_parallel_1\",35.2333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",33.9333333333333],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",600000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"3641\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3642, "epsg", 3642,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333"
+        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oklahoma South\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",33.3333333333333],PARAMETER[\"central_meridian\","
+        "-98],PARAMETER[\"standard_parallel_1\",35.2333333333333]"
+        ",PARAMETER[\"standard_parallel_2\",33.9333333333333],PAR"
+        "AMETER[\"false_easting\",600000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3641\"]]"},
+    {3642, "epsg", 3642,
         "NAD83(NSRS2007) / Oklahoma South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oklahoma South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",33.3333333333333],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-98],PARAMETER[\"standard_parallel_1\",35.23333333");
-    add_srs_wkt (p, 10,
-        "33333],PARAMETER[\"standard_parallel_2\",33.933333333333");
-    add_srs_wkt (p, 11,
-        "3],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_northing\",0],UNIT[\"US survey foot\",0.30480060960121");
-    add_srs_wkt (p, 13,
-        "9,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 14,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3642\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3643, "epsg", 3643,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333"
+        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oklahoma South (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",33.3333333333333],PARAMETER[\"central_merid"
+        "ian\",-98],PARAMETER[\"standard_parallel_1\",35.23333333"
+        "33333],PARAMETER[\"standard_parallel_2\",33.933333333333"
+        "3],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fals"
+        "e_northing\",0],UNIT[\"US survey foot\",0.30480060960121"
+        "9,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3642\"]]"},
+    {3643, "epsg", 3643,
         "NAD83(NSRS2007) / Oregon LCC (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon LCC (m)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",41.75],PARAMETER[\"central_meridian\",-120.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",43],PARAMETER[\"standard_");
-    add_srs_wkt (p, 10,
-        "parallel_2\",45.5],PARAMETER[\"false_easting\",400000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3643\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3644, "epsg", 3644,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120"
+        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,"
+        "0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oregon LCC (m)\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",41.75],PARAMETER[\"central_meridian\",-120.5],PAR"
+        "AMETER[\"standard_parallel_1\",43],PARAMETER[\"standard_"
+        "parallel_2\",45.5],PARAMETER[\"false_easting\",400000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3643\"]]"},
+    {3644, "epsg", 3644,
         "NAD83(NSRS2007) / Oregon GIC Lambert (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon GIC Lambert (ft)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",41.75],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 9,
-        "20.5],PARAMETER[\"standard_parallel_1\",43],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",45.5],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "1312335.958],PARAMETER[\"false_northing\",0],UNIT[\"foot");
-    add_srs_wkt (p, 12,
-        "\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"364");
-    add_srs_wkt (p, 14,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3645, "epsg", 3645,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120"
+        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oregon GIC Lambert (ft)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",41.75],PARAMETER[\"central_meridian\",-1"
+        "20.5],PARAMETER[\"standard_parallel_1\",43],PARAMETER[\""
+        "standard_parallel_2\",45.5],PARAMETER[\"false_easting\","
+        "1312335.958],PARAMETER[\"false_northing\",0],UNIT[\"foot"
+        "\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"364"
+        "4\"]]"},
+    {3645, "epsg", 3645,
         "NAD83(NSRS2007) / Oregon North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon North\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",43.6666666666667],PARAMETER[\"central_meridian\",-12");
-    add_srs_wkt (p, 9,
-        "0.5],PARAMETER[\"standard_parallel_1\",46],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",44.3333333333333],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",2500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 13,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "3645\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3646, "epsg", 3646,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6"
+        "6666666666666 +lon_0=-120.5 +x_0=2500000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oregon North\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",43.6666666666667],PARAMETER[\"central_meridian\",-12"
+        "0.5],PARAMETER[\"standard_parallel_1\",46],PARAMETER[\"s"
+        "tandard_parallel_2\",44.3333333333333],PARAMETER[\"false"
+        "_easting\",2500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3645\"]]"},
+    {3646, "epsg", 3646,
         "NAD83(NSRS2007) / Oregon North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon North (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",43.6666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-120.5],PARAMETER[\"standard_parallel_1\",46],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",44.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",8202099.738],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"3646\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3647, "epsg", 3647,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6"
+        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oregon North (ft)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",43.6666666666667],PARAMETER[\"central_meridian"
+        "\",-120.5],PARAMETER[\"standard_parallel_1\",46],PARAMET"
+        "ER[\"standard_parallel_2\",44.3333333333333],PARAMETER[\""
+        "false_easting\",8202099.738],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3646\"]]"},
+    {3647, "epsg", 3647,
         "NAD83(NSRS2007) / Oregon South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon South\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",41.6666666666667],PARAMETER[\"central_meridian\",-12");
-    add_srs_wkt (p, 9,
-        "0.5],PARAMETER[\"standard_parallel_1\",44],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",42.3333333333333],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",1500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 13,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "3647\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6"
+        "6666666666666 +lon_0=-120.5 +x_0=1500000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oregon South\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",41.6666666666667],PARAMETER[\"central_meridian\",-12"
+        "0.5],PARAMETER[\"standard_parallel_1\",44],PARAMETER[\"s"
+        "tandard_parallel_2\",42.3333333333333],PARAMETER[\"false"
+        "_easting\",1500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3647\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_15 = {
+    epsg_defs_15, sizeof (epsg_defs_15) / sizeof (epsg_defs_15[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
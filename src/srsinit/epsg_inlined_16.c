@@ -53,4009 +53,2263 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_16 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3648, "epsg", 3648,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_16[] = {
+    {3648, "epsg", 3648,
         "NAD83(NSRS2007) / Oregon South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Oregon South (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",41.6666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-120.5],PARAMETER[\"standard_parallel_1\",44],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",42.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",4921259.843],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"3648\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3649, "epsg", 3649,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6"
+        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Oregon South (ft)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",41.6666666666667],PARAMETER[\"central_meridian"
+        "\",-120.5],PARAMETER[\"standard_parallel_1\",44],PARAMET"
+        "ER[\"standard_parallel_2\",42.3333333333333],PARAMETER[\""
+        "false_easting\",4921259.843],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3648\"]]"},
+    {3649, "epsg", 3649,
         "NAD83(NSRS2007) / Pennsylvania North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Pennsylvania North\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",40.1666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-77.75],PARAMETER[\"standard_parallel_1\",41.95],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",40.8833333333333],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",600000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"3649\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3650, "epsg", 3650,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4"
+        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Pennsylvania North\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",40.1666666666667],PARAMETER[\"central_meridian"
+        "\",-77.75],PARAMETER[\"standard_parallel_1\",41.95],PARA"
+        "METER[\"standard_parallel_2\",40.8833333333333],PARAMETE"
+        "R[\"false_easting\",600000],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3649\"]]"},
+    {3650, "epsg", 3650,
         "NAD83(NSRS2007) / Pennsylvania North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Pennsylvania North (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",40.1666666666667],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-77.75],PARAMETER[\"standard_parallel_1\",41.");
-    add_srs_wkt (p, 10,
-        "95],PARAMETER[\"standard_parallel_2\",40.8833333333333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_n");
-    add_srs_wkt (p, 12,
-        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3650\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3651, "epsg", 3651,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4"
+        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps"
+        "=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Pennsylvania North (ftUS)\",G"
+        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO"
+        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat"
+        "itude_of_origin\",40.1666666666667],PARAMETER[\"central_"
+        "meridian\",-77.75],PARAMETER[\"standard_parallel_1\",41."
+        "95],PARAMETER[\"standard_parallel_2\",40.8833333333333],"
+        "PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3650\"]]"},
+    {3651, "epsg", 3651,
         "NAD83(NSRS2007) / Pennsylvania South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Pennsylvania South\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",39.3333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-77.75],PARAMETER[\"standard_parallel_1\",40.96666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"standard_parallel_2\",39.933333333333");
-    add_srs_wkt (p, 11,
-        "3],PARAMETER[\"false_easting\",600000],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"3651\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3652, "epsg", 3652,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333"
+        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(NSRS2007) / Pennsylvania South\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",39.3333333333333],PARAMETER[\"central_meridian"
+        "\",-77.75],PARAMETER[\"standard_parallel_1\",40.96666666"
+        "66667],PARAMETER[\"standard_parallel_2\",39.933333333333"
+        "3],PARAMETER[\"false_easting\",600000],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3651\"]]"},
+    {3652, "epsg", 3652,
         "NAD83(NSRS2007) / Pennsylvania South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Pennsylvania South (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",39.3333333333333],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-77.75],PARAMETER[\"standard_parallel_1\",40.");
-    add_srs_wkt (p, 10,
-        "9666666666667],PARAMETER[\"standard_parallel_2\",39.9333");
-    add_srs_wkt (p, 11,
-        "333333333],PARAMETER[\"false_easting\",1968500],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_northing\",0],UNIT[\"US survey foot\",0.304800");
-    add_srs_wkt (p, 13,
-        "609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"365");
-    add_srs_wkt (p, 15,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3653, "epsg", 3653,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333"
+        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Pennsylvania South (ftUS)\",G"
+        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO"
+        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat"
+        "itude_of_origin\",39.3333333333333],PARAMETER[\"central_"
+        "meridian\",-77.75],PARAMETER[\"standard_parallel_1\",40."
+        "9666666666667],PARAMETER[\"standard_parallel_2\",39.9333"
+        "333333333],PARAMETER[\"false_easting\",1968500],PARAMETE"
+        "R[\"false_northing\",0],UNIT[\"US survey foot\",0.304800"
+        "609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"365"
+        "2\"]]"},
+    {3653, "epsg", 3653,
         "NAD83(NSRS2007) / Rhode Island", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=100000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Rhode Island\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.0");
-    add_srs_wkt (p, 8,
-        "833333333333],PARAMETER[\"central_meridian\",-71.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.99999375],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",100000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3653\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3654, "epsg", 3654,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9"
+        "9999375 +x_0=100000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0"
+        ",0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Rhode Island\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.0"
+        "833333333333],PARAMETER[\"central_meridian\",-71.5],PARA"
+        "METER[\"scale_factor\",0.99999375],PARAMETER[\"false_eas"
+        "ting\",100000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3653\""
+        "]]"},
+    {3654, "epsg", 3654,
         "NAD83(NSRS2007) / Rhode Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Rhode Island (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",41.0833333333333],PARAMETER[\"central_meridian\",-71");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"scale_factor\",0.99999375],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",328083.3333],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3654\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3655, "epsg", 3655,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9"
+        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Rhode Island (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",41.0833333333333],PARAMETER[\"central_meridian\",-71"
+        ".5],PARAMETER[\"scale_factor\",0.99999375],PARAMETER[\"f"
+        "alse_easting\",328083.3333],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3654\"]]"},
+    {3655, "epsg", 3655,
         "NAD83(NSRS2007) / South Carolina", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / South Carolina\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",31.8333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-81],PARAMETER[\"standard_parallel_1\",34.8333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",32.5],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_easting\",609600],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "3655\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3656, "epsg", 3656,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31"
+        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / South Carolina\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",31.8333333333333],PARAMETER[\"central_meridian\","
+        "-81],PARAMETER[\"standard_parallel_1\",34.8333333333333]"
+        ",PARAMETER[\"standard_parallel_2\",32.5],PARAMETER[\"fal"
+        "se_easting\",609600],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3655\"]]"},
+    {3656, "epsg", 3656,
         "NAD83(NSRS2007) / South Carolina (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / South Carolina (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",31.8333333333333],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-81],PARAMETER[\"standard_parallel_1\",34.833333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"standard_parallel_2\",32.5],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",2000000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"3656\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3657, "epsg", 3657,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31"
+        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / South Carolina (ft)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",31.8333333333333],PARAMETER[\"central_meridi"
+        "an\",-81],PARAMETER[\"standard_parallel_1\",34.833333333"
+        "3333],PARAMETER[\"standard_parallel_2\",32.5],PARAMETER["
+        "\"false_easting\",2000000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3656\"]]"},
+    {3657, "epsg", 3657,
         "NAD83(NSRS2007) / South Dakota North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def");
-    add_proj4text (p, 3,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / South Dakota North\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",43.8333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-100],PARAMETER[\"standard_parallel_1\",45.6833333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"standard_parallel_2\",44.4166666666667]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",600000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 12,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"3657\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3658, "epsg", 3658,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666"
+        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_def"
+        "s",
+        "PROJCS[\"NAD83(NSRS2007) / South Dakota North\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",43.8333333333333],PARAMETER[\"central_meridian"
+        "\",-100],PARAMETER[\"standard_parallel_1\",45.6833333333"
+        "333],PARAMETER[\"standard_parallel_2\",44.4166666666667]"
+        ",PARAMETER[\"false_easting\",600000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3657\"]]"},
+    {3658, "epsg", 3658,
         "NAD83(NSRS2007) / South Dakota North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / South Dakota North (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",43.8333333333333],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-100],PARAMETER[\"standard_parallel_1\",45.68");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"standard_parallel_2\",44.416666");
-    add_srs_wkt (p, 11,
-        "6666667],PARAMETER[\"false_easting\",1968500],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060");
-    add_srs_wkt (p, 13,
-        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 14,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3658\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3659, "epsg", 3659,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666"
+        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_"
+        "0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no"
+        "_defs",
+        "PROJCS[\"NAD83(NSRS2007) / South Dakota North (ftUS)\",G"
+        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO"
+        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat"
+        "itude_of_origin\",43.8333333333333],PARAMETER[\"central_"
+        "meridian\",-100],PARAMETER[\"standard_parallel_1\",45.68"
+        "33333333333],PARAMETER[\"standard_parallel_2\",44.416666"
+        "6666667],PARAMETER[\"false_easting\",1968500],PARAMETER["
+        "\"false_northing\",0],UNIT[\"US survey foot\",0.30480060"
+        "9601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3658\""
+        "]]"},
+    {3659, "epsg", 3659,
         "NAD83(NSRS2007) / South Dakota South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / South Dakota South\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",42.3333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-100.333333333333],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 10,
-        "44.4],PARAMETER[\"standard_parallel_2\",42.8333333333333");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",600000],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"3659\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3660, "epsg", 3660,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42"
+        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83(NSRS2007) / South Dakota South\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",42.3333333333333],PARAMETER[\"central_meridian"
+        "\",-100.333333333333],PARAMETER[\"standard_parallel_1\","
+        "44.4],PARAMETER[\"standard_parallel_2\",42.8333333333333"
+        "],PARAMETER[\"false_easting\",600000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3659\"]]"},
+    {3660, "epsg", 3660,
         "NAD83(NSRS2007) / South Dakota South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / South Dakota South (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",42.3333333333333],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-100.333333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_1\",44.4],PARAMETER[\"standard_parallel_2\",42.83333");
-    add_srs_wkt (p, 11,
-        "33333333],PARAMETER[\"false_easting\",1968500],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_northing\",0],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 13,
-        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 14,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3660");
-    add_srs_wkt (p, 15,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3661, "epsg", 3661,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42"
+        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +n"
+        "o_defs",
+        "PROJCS[\"NAD83(NSRS2007) / South Dakota South (ftUS)\",G"
+        "EOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PRO"
+        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat"
+        "itude_of_origin\",42.3333333333333],PARAMETER[\"central_"
+        "meridian\",-100.333333333333],PARAMETER[\"standard_paral"
+        "lel_1\",44.4],PARAMETER[\"standard_parallel_2\",42.83333"
+        "33333333],PARAMETER[\"false_easting\",1968500],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"US survey foot\",0.3048006"
+        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3660"
+        "\"]]"},
+    {3661, "epsg", 3661,
         "NAD83(NSRS2007) / Tennessee", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Tennessee\",GEOGCS[\"NAD83(NS");
-    add_srs_wkt (p, 1,
-        "RS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",34.3333333333333],PARAMETER[\"central_meridian\",-86],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",36.4166666666667],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",35.25],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3661");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3662, "epsg", 3662,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3"
+        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Tennessee\",GEOGCS[\"NAD83(NS"
+        "RS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",34.3333333333333],PARAMETER[\"central_meridian\",-86],P"
+        "ARAMETER[\"standard_parallel_1\",36.4166666666667],PARAM"
+        "ETER[\"standard_parallel_2\",35.25],PARAMETER[\"false_ea"
+        "sting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3661"
+        "\"]]"},
+    {3662, "epsg", 3662,
         "NAD83(NSRS2007) / Tennessee (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Tennessee (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",34.3333333333333],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-86],PARAMETER[\"standard_parallel_1\",36.4166666666667");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"standard_parallel_2\",35.25],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",1968500],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3662\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3663, "epsg", 3663,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3"
+        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Tennessee (ftUS)\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",34.3333333333333],PARAMETER[\"central_meridian\""
+        ",-86],PARAMETER[\"standard_parallel_1\",36.4166666666667"
+        "],PARAMETER[\"standard_parallel_2\",35.25],PARAMETER[\"f"
+        "alse_easting\",1968500],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP"
+        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3662\"]]"},
+    {3663, "epsg", 3663,
         "NAD83(NSRS2007) / Texas Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=700000 +y_0=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 3,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas Central\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",29.6666666666667],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "100.333333333333],PARAMETER[\"standard_parallel_1\",31.8");
-    add_srs_wkt (p, 10,
-        "833333333333],PARAMETER[\"standard_parallel_2\",30.11666");
-    add_srs_wkt (p, 11,
-        "66666667],PARAMETER[\"false_easting\",700000],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",3000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3663\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3664, "epsg", 3664,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666"
+        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +"
+        "x_0=700000 +y_0=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas Central\",GEOGCS[\"NAD8"
+        "3(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",29.6666666666667],PARAMETER[\"central_meridian\",-"
+        "100.333333333333],PARAMETER[\"standard_parallel_1\",31.8"
+        "833333333333],PARAMETER[\"standard_parallel_2\",30.11666"
+        "66666667],PARAMETER[\"false_easting\",700000],PARAMETER["
+        "\"false_northing\",3000000],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3663\"]]"},
+    {3664, "epsg", 3664,
         "NAD83(NSRS2007) / Texas Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 3,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas Central (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",29.6666666666667],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-100.333333333333],PARAMETER[\"standard_parallel_1");
-    add_srs_wkt (p, 10,
-        "\",31.8833333333333],PARAMETER[\"standard_parallel_2\",3");
-    add_srs_wkt (p, 11,
-        "0.1166666666667],PARAMETER[\"false_easting\",2296583.333");
-    add_srs_wkt (p, 12,
-        "],PARAMETER[\"false_northing\",9842500],UNIT[\"US survey");
-    add_srs_wkt (p, 13,
-        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 15,
-        "Y[\"EPSG\",\"3664\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3665, "epsg", 3665,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666"
+        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +"
+        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas Central (ftUS)\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",29.6666666666667],PARAMETER[\"central_merid"
+        "ian\",-100.333333333333],PARAMETER[\"standard_parallel_1"
+        "\",31.8833333333333],PARAMETER[\"standard_parallel_2\",3"
+        "0.1166666666667],PARAMETER[\"false_easting\",2296583.333"
+        "],PARAMETER[\"false_northing\",9842500],UNIT[\"US survey"
+        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3664\"]]"},
+    {3665, "epsg", 3665,
         "NAD83(NSRS2007) / Texas Centric Albers Equal Area", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas Centric Albers Equal Ar");
-    add_srs_wkt (p, 1,
-        "ea\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_S");
-    add_srs_wkt (p, 2,
-        "patial_Reference_System_2007\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 3,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 7,
-        "]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"l");
-    add_srs_wkt (p, 8,
-        "atitude_of_center\",18],PARAMETER[\"longitude_of_center\"");
-    add_srs_wkt (p, 9,
-        ",-100],PARAMETER[\"standard_parallel_1\",27.5],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",35],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",1500000],PARAMETER[\"false_northing\",6000000],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3665");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3666, "epsg", 3666,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x"
+        "_0=1500000 +y_0=6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas Centric Albers Equal Ar"
+        "ea\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_S"
+        "patial_Reference_System_2007\",SPHEROID[\"GRS 1980\",637"
+        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORI"
+        "TY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\""
+        "]],PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"l"
+        "atitude_of_center\",18],PARAMETER[\"longitude_of_center\""
+        ",-100],PARAMETER[\"standard_parallel_1\",27.5],PARAMETER"
+        "[\"standard_parallel_2\",35],PARAMETER[\"false_easting\""
+        ",1500000],PARAMETER[\"false_northing\",6000000],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3665"
+        "\"]]"},
+    {3666, "epsg", 3666,
         "NAD83(NSRS2007) / Texas Centric Lambert Conformal", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas Centric Lambert Conform");
-    add_srs_wkt (p, 1,
-        "al\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_S");
-    add_srs_wkt (p, 2,
-        "patial_Reference_System_2007\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 3,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"");
-    add_srs_wkt (p, 7,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"latitude_of_origin\",18],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-100],PARAMETER[\"standard_parallel_1\",27.5],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",35],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",1500000],PARAMETER[\"false_northing\",5000000],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"366");
-    add_srs_wkt (p, 14,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3667, "epsg", 3667,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x"
+        "_0=1500000 +y_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas Centric Lambert Conform"
+        "al\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_S"
+        "patial_Reference_System_2007\",SPHEROID[\"GRS 1980\",637"
+        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORI"
+        "TY[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER"
+        "[\"latitude_of_origin\",18],PARAMETER[\"central_meridian"
+        "\",-100],PARAMETER[\"standard_parallel_1\",27.5],PARAMET"
+        "ER[\"standard_parallel_2\",35],PARAMETER[\"false_easting"
+        "\",1500000],PARAMETER[\"false_northing\",5000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"366"
+        "6\"]]"},
+    {3667, "epsg", 3667,
         "NAD83(NSRS2007) / Texas North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000 +y_0=1000000 +ellps=GRS80 +t");
-    add_proj4text (p, 2,
-        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",34],PARAMETER[\"central_meridian\",-101.5],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",36.1833333333333],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",34.65],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "200000],PARAMETER[\"false_northing\",1000000],UNIT[\"met");
-    add_srs_wkt (p, 12,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3667\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3668, "epsg", 3668,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3"
+        "4 +lon_0=-101.5 +x_0=200000 +y_0=1000000 +ellps=GRS80 +t"
+        "owgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas North\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",34],PARAMETER[\"central_meridian\",-101.5],PARAMETER"
+        "[\"standard_parallel_1\",36.1833333333333],PARAMETER[\"s"
+        "tandard_parallel_2\",34.65],PARAMETER[\"false_easting\","
+        "200000],PARAMETER[\"false_northing\",1000000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3667\""
+        "]]"},
+    {3668, "epsg", 3668,
         "NAD83(NSRS2007) / Texas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989");
-    add_proj4text (p, 2,
-        "83998 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",34],PARAMETER[\"central_meridian\",-101.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",36.1833333333333],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",34.65],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",656166.667],PARAMETER[\"false_northing\",3280833.3");
-    add_srs_wkt (p, 12,
-        "33],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3668\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3669, "epsg", 3669,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3"
+        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989"
+        "83998 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas North (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",34],PARAMETER[\"central_meridian\",-101.5],PAR"
+        "AMETER[\"standard_parallel_1\",36.1833333333333],PARAMET"
+        "ER[\"standard_parallel_2\",34.65],PARAMETER[\"false_east"
+        "ing\",656166.667],PARAMETER[\"false_northing\",3280833.3"
+        "33],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3668\"]]"},
+    {3669, "epsg", 3669,
         "NAD83(NSRS2007) / Texas North Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas North Central\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",31.6666666666667],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-98.5],PARAMETER[\"standard_parallel_1\",33.9666666");
-    add_srs_wkt (p, 10,
-        "666667],PARAMETER[\"standard_parallel_2\",32.13333333333");
-    add_srs_wkt (p, 11,
-        "33],PARAMETER[\"false_easting\",600000],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_northing\",2000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3669\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3670, "epsg", 3670,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333"
+        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y"
+        "_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas North Central\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",31.6666666666667],PARAMETER[\"central_meridi"
+        "an\",-98.5],PARAMETER[\"standard_parallel_1\",33.9666666"
+        "666667],PARAMETER[\"standard_parallel_2\",32.13333333333"
+        "33],PARAMETER[\"false_easting\",600000],PARAMETER[\"fals"
+        "e_northing\",2000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3669\"]]"},
+    {3670, "epsg", 3670,
         "NAD83(NSRS2007) / Texas North Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 3,
-        "units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas North Central (ftUS)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatia");
-    add_srs_wkt (p, 2,
-        "l_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 3,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",31.6666666666667],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-98.5],PARAMETER[\"standard_parallel_1\",33.");
-    add_srs_wkt (p, 10,
-        "9666666666667],PARAMETER[\"standard_parallel_2\",32.1333");
-    add_srs_wkt (p, 11,
-        "333333333],PARAMETER[\"false_easting\",1968500],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_northing\",6561666.667],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 13,
-        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"3670\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3671, "epsg", 3671,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333"
+        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y"
+        "_0=2000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas North Central (ftUS)\","
+        "GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatia"
+        "l_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,"
+        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",31.6666666666667],PARAMETER[\"central"
+        "_meridian\",-98.5],PARAMETER[\"standard_parallel_1\",33."
+        "9666666666667],PARAMETER[\"standard_parallel_2\",32.1333"
+        "333333333],PARAMETER[\"false_easting\",1968500],PARAMETE"
+        "R[\"false_northing\",6561666.667],UNIT[\"US survey foot\""
+        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3670\"]]"},
+    {3671, "epsg", 3671,
         "NAD83(NSRS2007) / Texas South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000 +y");
-    add_proj4text (p, 2,
-        "_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",25.6666666666667],PARAMETER[\"central_meridian\",-98");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"standard_parallel_1\",27.8333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",26.1666666666667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",300000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",5000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"3671\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3672, "epsg", 3672,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666"
+        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000 +y"
+        "_0=5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas South\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",25.6666666666667],PARAMETER[\"central_meridian\",-98"
+        ".5],PARAMETER[\"standard_parallel_1\",27.8333333333333],"
+        "PARAMETER[\"standard_parallel_2\",26.1666666666667],PARA"
+        "METER[\"false_easting\",300000],PARAMETER[\"false_northi"
+        "ng\",5000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3671\"]]"},
+    {3672, "epsg", 3672,
         "NAD83(NSRS2007) / Texas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00");
-    add_proj4text (p, 2,
-        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",25.6666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-98.5],PARAMETER[\"standard_parallel_1\",27.833333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"standard_parallel_2\",26.1666666666667");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",984250],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",16404166.667],UNIT[\"US survey foot\",0.30480");
-    add_srs_wkt (p, 13,
-        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"367");
-    add_srs_wkt (p, 15,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3673, "epsg", 3673,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666"
+        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00"
+        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas South (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",25.6666666666667],PARAMETER[\"central_meridian"
+        "\",-98.5],PARAMETER[\"standard_parallel_1\",27.833333333"
+        "3333],PARAMETER[\"standard_parallel_2\",26.1666666666667"
+        "],PARAMETER[\"false_easting\",984250],PARAMETER[\"false_"
+        "northing\",16404166.667],UNIT[\"US survey foot\",0.30480"
+        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"367"
+        "2\"]]"},
+    {3673, "epsg", 3673,
         "NAD83(NSRS2007) / Texas South Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas South Central\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",27.8333333333333],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-99],PARAMETER[\"standard_parallel_1\",30.283333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"standard_parallel_2\",28.3833333333333");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",600000],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"3673\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3674, "epsg", 3674,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333"
+        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0"
+        "=4000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas South Central\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",27.8333333333333],PARAMETER[\"central_meridi"
+        "an\",-99],PARAMETER[\"standard_parallel_1\",30.283333333"
+        "3333],PARAMETER[\"standard_parallel_2\",28.3833333333333"
+        "],PARAMETER[\"false_easting\",600000],PARAMETER[\"false_"
+        "northing\",4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"3673\"]]"},
+    {3674, "epsg", 3674,
         "NAD83(NSRS2007) / Texas South Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=3999999.9998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 3,
-        "its=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Texas South Central (ftUS)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatia");
-    add_srs_wkt (p, 2,
-        "l_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 3,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",27.8333333333333],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-99],PARAMETER[\"standard_parallel_1\",30.28");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"standard_parallel_2\",28.383333");
-    add_srs_wkt (p, 11,
-        "3333333],PARAMETER[\"false_easting\",1968500],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",13123333.333],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 13,
-        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"3674\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3675, "epsg", 3675,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333"
+        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0"
+        "=3999999.9998984 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un"
+        "its=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Texas South Central (ftUS)\","
+        "GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatia"
+        "l_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,"
+        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",27.8333333333333],PARAMETER[\"central"
+        "_meridian\",-99],PARAMETER[\"standard_parallel_1\",30.28"
+        "33333333333],PARAMETER[\"standard_parallel_2\",28.383333"
+        "3333333],PARAMETER[\"false_easting\",1968500],PARAMETER["
+        "\"false_northing\",13123333.333],UNIT[\"US survey foot\""
+        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3674\"]]"},
+    {3675, "epsg", 3675,
         "NAD83(NSRS2007) / Utah Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000 +y_0=2000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",38.3333333333333],PARAMETER[\"central_meridian\",-11");
-    add_srs_wkt (p, 9,
-        "1.5],PARAMETER[\"standard_parallel_1\",40.65],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",39.0166666666667],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",20000");
-    add_srs_wkt (p, 12,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"3675\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3676, "epsg", 3676,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000 +y_0=2000000 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah Central\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",38.3333333333333],PARAMETER[\"central_meridian\",-11"
+        "1.5],PARAMETER[\"standard_parallel_1\",40.65],PARAMETER["
+        "\"standard_parallel_2\",39.0166666666667],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",20000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3675\"]]"},
+    {3676, "epsg", 3676,
         "NAD83(NSRS2007) / Utah Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.0001504 +y_0=");
-    add_proj4text (p, 2,
-        "1999999.999992 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah Central (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",38.3333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-111.5],PARAMETER[\"standard_parallel_1\",40.65],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",39.0166666666667],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",1640419.948],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",6561679.79],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3676\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3677, "epsg", 3677,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000.0001504 +y_0="
+        "1999999.999992 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah Central (ft)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",38.3333333333333],PARAMETER[\"central_meridian"
+        "\",-111.5],PARAMETER[\"standard_parallel_1\",40.65],PARA"
+        "METER[\"standard_parallel_2\",39.0166666666667],PARAMETE"
+        "R[\"false_easting\",1640419.948],PARAMETER[\"false_north"
+        "ing\",6561679.79],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\""
+        ",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3676\"]]"},
+    {3677, "epsg", 3677,
         "NAD83(NSRS2007) / Utah Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=2000000.00001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 3,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah Central (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",38.3333333333333],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-111.5],PARAMETER[\"standard_parallel_1\",40.65],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",39.0166666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1640416.6667],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",6561666.6667],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 13,
-        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 14,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3677");
-    add_srs_wkt (p, 15,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3678, "epsg", 3678,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0"
+        "=2000000.00001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah Central (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",38.3333333333333],PARAMETER[\"central_meridi"
+        "an\",-111.5],PARAMETER[\"standard_parallel_1\",40.65],PA"
+        "RAMETER[\"standard_parallel_2\",39.0166666666667],PARAME"
+        "TER[\"false_easting\",1640416.6667],PARAMETER[\"false_no"
+        "rthing\",6561666.6667],UNIT[\"US survey foot\",0.3048006"
+        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3677"
+        "\"]]"},
+    {3678, "epsg", 3678,
         "NAD83(NSRS2007) / Utah North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 3,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah North\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",40.3333333333333],PARAMETER[\"central_meridian\",-111");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"standard_parallel_1\",41.7833333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",40.7166666666667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"3678\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3679, "epsg", 3679,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000 +"
+        "y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah North\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",40.3333333333333],PARAMETER[\"central_meridian\",-111"
+        ".5],PARAMETER[\"standard_parallel_1\",41.7833333333333],"
+        "PARAMETER[\"standard_parallel_2\",40.7166666666667],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3678\"]]"},
+    {3679, "epsg", 3679,
         "NAD83(NSRS2007) / Utah North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001504 +y_0=999999.9999960001 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah North (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",40.3333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-111.5],PARAMETER[\"standard_parallel_1\",41.78333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"standard_parallel_2\",40.7166666666667],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",1640419.948],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_northing\",3280839.895],UNIT[\"foot\",0.3048,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3679\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3680, "epsg", 3680,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0"
+        "001504 +y_0=999999.9999960001 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah North (ft)\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",40.3333333333333],PARAMETER[\"central_meridian\","
+        "-111.5],PARAMETER[\"standard_parallel_1\",41.78333333333"
+        "33],PARAMETER[\"standard_parallel_2\",40.7166666666667],"
+        "PARAMETER[\"false_easting\",1640419.948],PARAMETER[\"fal"
+        "se_northing\",3280839.895],UNIT[\"foot\",0.3048,AUTHORIT"
+        "Y[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3679\"]]"},
+    {3680, "epsg", 3680,
         "NAD83(NSRS2007) / Utah North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 3,
-        ",0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",40.3333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-111.5],PARAMETER[\"standard_parallel_1\",41.78333333");
-    add_srs_wkt (p, 10,
-        "33333],PARAMETER[\"standard_parallel_2\",40.716666666666");
-    add_srs_wkt (p, 11,
-        "7],PARAMETER[\"false_easting\",1640416.6667],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",3280833.3333],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 13,
-        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 14,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"3680\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3681, "epsg", 3681,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0"
+        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah North (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",40.3333333333333],PARAMETER[\"central_meridian"
+        "\",-111.5],PARAMETER[\"standard_parallel_1\",41.78333333"
+        "33333],PARAMETER[\"standard_parallel_2\",40.716666666666"
+        "7],PARAMETER[\"false_easting\",1640416.6667],PARAMETER[\""
+        "false_northing\",3280833.3333],UNIT[\"US survey foot\",0"
+        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3680\"]]"},
+    {3681, "epsg", 3681,
         "NAD83(NSRS2007) / Utah South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000 +y_0=3000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah South\",GEOGCS[\"NAD83(N");
-    add_srs_wkt (p, 1,
-        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",36.6666666666667],PARAMETER[\"central_meridian\",-111");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"standard_parallel_1\",38.35],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",37.2166666666667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",500000],PARAMETER[\"false_northing\",3000000");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"3681\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3682, "epsg", 3682,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000 +y_0=3000000 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah South\",GEOGCS[\"NAD83(N"
+        "SRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",36.6666666666667],PARAMETER[\"central_meridian\",-111"
+        ".5],PARAMETER[\"standard_parallel_1\",38.35],PARAMETER[\""
+        "standard_parallel_2\",37.2166666666667],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",3000000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3681\"]]"},
+    {3682, "epsg", 3682,
         "NAD83(NSRS2007) / Utah South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.0001504 +y_0=");
-    add_proj4text (p, 2,
-        "2999999.999988 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah South (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",36.6666666666667],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-111.5],PARAMETER[\"standard_parallel_1\",38.35],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",37.2166666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",1640419.948],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",9842519.685],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"3682\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3683, "epsg", 3683,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000.0001504 +y_0="
+        "2999999.999988 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah South (ft)\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",36.6666666666667],PARAMETER[\"central_meridian\","
+        "-111.5],PARAMETER[\"standard_parallel_1\",38.35],PARAMET"
+        "ER[\"standard_parallel_2\",37.2166666666667],PARAMETER[\""
+        "false_easting\",1640419.948],PARAMETER[\"false_northing\""
+        ",9842519.685],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\""
+        "9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3682\"]]"},
+    {3683, "epsg", 3683,
         "NAD83(NSRS2007) / Utah South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Utah South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",36.6666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-111.5],PARAMETER[\"standard_parallel_1\",38.35],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",37.2166666666667],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",1640416.6667],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 12,
-        "hing\",9842500],UNIT[\"US survey foot\",0.30480060960121");
-    add_srs_wkt (p, 13,
-        "9,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 14,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3683\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3684, "epsg", 3684,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0"
+        "=3000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Utah South (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",36.6666666666667],PARAMETER[\"central_meridian"
+        "\",-111.5],PARAMETER[\"standard_parallel_1\",38.35],PARA"
+        "METER[\"standard_parallel_2\",37.2166666666667],PARAMETE"
+        "R[\"false_easting\",1640416.6667],PARAMETER[\"false_nort"
+        "hing\",9842500],UNIT[\"US survey foot\",0.30480060960121"
+        "9,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3683\"]]"},
+    {3684, "epsg", 3684,
         "NAD83(NSRS2007) / Vermont", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0");
-    add_proj4text (p, 1,
-        "=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Vermont\",GEOGCS[\"NAD83(NSRS");
-    add_srs_wkt (p, 1,
-        "2007)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 7,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"central_meridian\",-72.5],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.999964286],PARAMETER[\"false_easting\",500000],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 11,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 12,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3684\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3685, "epsg", 3685,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0"
+        "=500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Vermont\",GEOGCS[\"NAD83(NSRS"
+        "2007)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Transver"
+        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PA"
+        "RAMETER[\"central_meridian\",-72.5],PARAMETER[\"scale_fa"
+        "ctor\",0.999964286],PARAMETER[\"false_easting\",500000],"
+        "PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORI"
+        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"3684\"]]"},
+    {3685, "epsg", 3685,
         "NAD83(NSRS2007) / Virginia North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000 +y_0=2000000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Virginia North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",37.6666666666667],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-78.5],PARAMETER[\"standard_parallel_1\",39.2],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",38.0333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",3500000],PARAMETER[\"false_northing\",200");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3685\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3686, "epsg", 3686,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37"
+        ".66666666666666 +lon_0=-78.5 +x_0=3500000 +y_0=2000000 +"
+        "ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Virginia North\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",37.6666666666667],PARAMETER[\"central_meridian\","
+        "-78.5],PARAMETER[\"standard_parallel_1\",39.2],PARAMETER"
+        "[\"standard_parallel_2\",38.0333333333333],PARAMETER[\"f"
+        "alse_easting\",3500000],PARAMETER[\"false_northing\",200"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3685\"]]"},
+    {3686, "epsg", 3686,
         "NAD83(NSRS2007) / Virginia North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2");
-    add_proj4text (p, 2,
-        "000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 3,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Virginia North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",37.6666666666667],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-78.5],PARAMETER[\"standard_parallel_1\",39.2],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"standard_parallel_2\",38.0333333333333],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_easting\",11482916.667],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",6561666.667],UNIT[\"US survey foot\",0.304800609");
-    add_srs_wkt (p, 13,
-        "601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 14,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3686\"");
-    add_srs_wkt (p, 15,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3687, "epsg", 3687,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37"
+        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2"
+        "000000.0001016 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Virginia North (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",37.6666666666667],PARAMETER[\"central_merid"
+        "ian\",-78.5],PARAMETER[\"standard_parallel_1\",39.2],PAR"
+        "AMETER[\"standard_parallel_2\",38.0333333333333],PARAMET"
+        "ER[\"false_easting\",11482916.667],PARAMETER[\"false_nor"
+        "thing\",6561666.667],UNIT[\"US survey foot\",0.304800609"
+        "601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3686\""
+        "]]"},
+    {3687, "epsg", 3687,
         "NAD83(NSRS2007) / Virginia South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000 +");
-    add_proj4text (p, 2,
-        "y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 3,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Virginia South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",36.3333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-78.5],PARAMETER[\"standard_parallel_1\",37.966666666666");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"standard_parallel_2\",36.7666666666667],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",3500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"3687\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3688, "epsg", 3688,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666"
+        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000 +"
+        "y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Virginia South\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",36.3333333333333],PARAMETER[\"central_meridian\","
+        "-78.5],PARAMETER[\"standard_parallel_1\",37.966666666666"
+        "7],PARAMETER[\"standard_parallel_2\",36.7666666666667],P"
+        "ARAMETER[\"false_easting\",3500000],PARAMETER[\"false_no"
+        "rthing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"3687\"]]"},
+    {3688, "epsg", 3688,
         "NAD83(NSRS2007) / Virginia South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0");
-    add_proj4text (p, 2,
-        "001016 +y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,");
-    add_proj4text (p, 3,
-        "0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Virginia South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",36.3333333333333],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-78.5],PARAMETER[\"standard_parallel_1\",37.966666");
-    add_srs_wkt (p, 10,
-        "6666667],PARAMETER[\"standard_parallel_2\",36.7666666666");
-    add_srs_wkt (p, 11,
-        "667],PARAMETER[\"false_easting\",11482916.667],PARAMETER");
-    add_srs_wkt (p, 12,
-        "[\"false_northing\",3280833.333],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 13,
-        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"3688\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3689, "epsg", 3689,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666"
+        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0"
+        "001016 +y_0=999999.9998983998 +ellps=GRS80 +towgs84=0,0,"
+        "0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Virginia South (ftUS)\",GEOGC"
+        "S[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",36.3333333333333],PARAMETER[\"central_merid"
+        "ian\",-78.5],PARAMETER[\"standard_parallel_1\",37.966666"
+        "6666667],PARAMETER[\"standard_parallel_2\",36.7666666666"
+        "667],PARAMETER[\"false_easting\",11482916.667],PARAMETER"
+        "[\"false_northing\",3280833.333],UNIT[\"US survey foot\""
+        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"3688\"]]"},
+    {3689, "epsg", 3689,
         "NAD83(NSRS2007) / Washington North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Washington North\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",47],PARAMETER[\"central_meridian\",-120.83333333");
-    add_srs_wkt (p, 9,
-        "3333],PARAMETER[\"standard_parallel_1\",48.7333333333333");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"standard_parallel_2\",47.5],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 13,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"3689\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3690, "epsg", 3690,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47"
+        " +lon_0=-120.8333333333333 +x_0=500000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Washington North\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",47],PARAMETER[\"central_meridian\",-120.83333333"
+        "3333],PARAMETER[\"standard_parallel_1\",48.7333333333333"
+        "],PARAMETER[\"standard_parallel_2\",47.5],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3689\"]]"},
+    {3690, "epsg", 3690,
         "NAD83(NSRS2007) / Washington North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de");
-    add_proj4text (p, 3,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Washington North (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",47],PARAMETER[\"central_meridian\",-120.");
-    add_srs_wkt (p, 9,
-        "833333333333],PARAMETER[\"standard_parallel_1\",48.73333");
-    add_srs_wkt (p, 10,
-        "33333333],PARAMETER[\"standard_parallel_2\",47.5],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1640416.667],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"US survey foot\",0.304800609601219,AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3690\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3691, "epsg", 3691,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47"
+        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(NSRS2007) / Washington North (ftUS)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",47],PARAMETER[\"central_meridian\",-120."
+        "833333333333],PARAMETER[\"standard_parallel_1\",48.73333"
+        "33333333],PARAMETER[\"standard_parallel_2\",47.5],PARAME"
+        "TER[\"false_easting\",1640416.667],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"US survey foot\",0.304800609601219,AUT"
+        "HORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3690\"]]"},
+    {3691, "epsg", 3691,
         "NAD83(NSRS2007) / Washington South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 3,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Washington South\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",45.3333333333333],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-120.5],PARAMETER[\"standard_parallel_1\",47.3333333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"standard_parallel_2\",45.8333333333333]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 12,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"3691\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3692, "epsg", 3692,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333"
+        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(NSRS2007) / Washington South\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",45.3333333333333],PARAMETER[\"central_meridian\""
+        ",-120.5],PARAMETER[\"standard_parallel_1\",47.3333333333"
+        "333],PARAMETER[\"standard_parallel_2\",45.8333333333333]"
+        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3691\"]]"},
+    {3692, "epsg", 3692,
         "NAD83(NSRS2007) / Washington South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un");
-    add_proj4text (p, 3,
-        "its=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Washington South (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",45.3333333333333],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-120.5],PARAMETER[\"standard_parallel_1\",47.33");
-    add_srs_wkt (p, 10,
-        "33333333333],PARAMETER[\"standard_parallel_2\",45.833333");
-    add_srs_wkt (p, 11,
-        "3333333],PARAMETER[\"false_easting\",1640416.667],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_northing\",0],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 13,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 15,
-        "692\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3693, "epsg", 3693,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333"
+        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0"
+        "001016001 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +un"
+        "its=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Washington South (ftUS)\",GEO"
+        "GCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",45.3333333333333],PARAMETER[\"central_me"
+        "ridian\",-120.5],PARAMETER[\"standard_parallel_1\",47.33"
+        "33333333333],PARAMETER[\"standard_parallel_2\",45.833333"
+        "3333333],PARAMETER[\"false_easting\",1640416.667],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "692\"]]"},
+    {3693, "epsg", 3693,
         "NAD83(NSRS2007) / West Virginia North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79.");
-    add_proj4text (p, 1,
-        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / West Virginia North\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",38.5],PARAMETER[\"central_meridian\",-79.5],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",40.25],PARAMETER[\"sta");
-    add_srs_wkt (p, 10,
-        "ndard_parallel_2\",39],PARAMETER[\"false_easting\",60000");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3693\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3694, "epsg", 3694,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79."
+        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / West Virginia North\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",38.5],PARAMETER[\"central_meridian\",-79.5],"
+        "PARAMETER[\"standard_parallel_1\",40.25],PARAMETER[\"sta"
+        "ndard_parallel_2\",39],PARAMETER[\"false_easting\",60000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3693\"]]"},
+    {3694, "epsg", 3694,
         "NAD83(NSRS2007) / West Virginia South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / West Virginia South\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",37],PARAMETER[\"central_meridian\",-81],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",38.8833333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",37.4833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",600000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"3694\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3695, "epsg", 3695,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333"
+        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / West Virginia South\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",37],PARAMETER[\"central_meridian\",-81],PARA"
+        "METER[\"standard_parallel_1\",38.8833333333333],PARAMETE"
+        "R[\"standard_parallel_2\",37.4833333333333],PARAMETER[\""
+        "false_easting\",600000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3694\"]]"},
+    {3695, "epsg", 3695,
         "NAD83(NSRS2007) / Wisconsin Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wisconsin Central\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",43.8333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-90],PARAMETER[\"standard_parallel_1\",45.5],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",44.25],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3695\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3696, "epsg", 3696,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333"
+        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wisconsin Central\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",43.8333333333333],PARAMETER[\"central_meridian"
+        "\",-90],PARAMETER[\"standard_parallel_1\",45.5],PARAMETE"
+        "R[\"standard_parallel_2\",44.25],PARAMETER[\"false_easti"
+        "ng\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3695\"]"
+        "]"},
+    {3696, "epsg", 3696,
         "NAD83(NSRS2007) / Wisconsin Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wisconsin Central (ftUS)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_");
-    add_srs_wkt (p, 2,
-        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",43.8333333333333],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-90],PARAMETER[\"standard_parallel_1\",45.5],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",44.25],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",1968500],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"3696\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3697, "epsg", 3697,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333"
+        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wisconsin Central (ftUS)\",GE"
+        "OGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_"
+        "Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",43.8333333333333],PARAMETER[\"central_me"
+        "ridian\",-90],PARAMETER[\"standard_parallel_1\",45.5],PA"
+        "RAMETER[\"standard_parallel_2\",44.25],PARAMETER[\"false"
+        "_easting\",1968500],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3696\"]]"},
+    {3697, "epsg", 3697,
         "NAD83(NSRS2007) / Wisconsin North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wisconsin North\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",45.1666666666667],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-90],PARAMETER[\"standard_parallel_1\",46.7666666666667]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",45.5666666666667],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",600000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"3697\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3698, "epsg", 3698,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666"
+        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wisconsin North\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",45.1666666666667],PARAMETER[\"central_meridian\","
+        "-90],PARAMETER[\"standard_parallel_1\",46.7666666666667]"
+        ",PARAMETER[\"standard_parallel_2\",45.5666666666667],PAR"
+        "AMETER[\"false_easting\",600000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3697\"]]"},
+    {3698, "epsg", 3698,
         "NAD83(NSRS2007) / Wisconsin North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_");
-    add_proj4text (p, 3,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wisconsin North (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",45.1666666666667],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-90],PARAMETER[\"standard_parallel_1\",46.766666");
-    add_srs_wkt (p, 10,
-        "6666667],PARAMETER[\"standard_parallel_2\",45.5666666666");
-    add_srs_wkt (p, 11,
-        "667],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 13,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3698\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3699, "epsg", 3699,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666"
+        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wisconsin North (ftUS)\",GEOG"
+        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",45.1666666666667],PARAMETER[\"central_mer"
+        "idian\",-90],PARAMETER[\"standard_parallel_1\",46.766666"
+        "6666667],PARAMETER[\"standard_parallel_2\",45.5666666666"
+        "667],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3698\"]]"},
+    {3699, "epsg", 3699,
         "NAD83(NSRS2007) / Wisconsin South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wisconsin South\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",42],PARAMETER[\"central_meridian\",-90],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",44.0666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",42.7333333333333],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",600000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 14,
-        "699\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3700, "epsg", 3700,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333"
+        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wisconsin South\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",42],PARAMETER[\"central_meridian\",-90],PARAMETER"
+        "[\"standard_parallel_1\",44.0666666666667],PARAMETER[\"s"
+        "tandard_parallel_2\",42.7333333333333],PARAMETER[\"false"
+        "_easting\",600000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "699\"]]"},
+    {3700, "epsg", 3700,
         "NAD83(NSRS2007) / Wisconsin South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wisconsin South (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",42],PARAMETER[\"central_meridian\",-90],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",44.0666666666667],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",42.7333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",1968500],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3700\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3701, "epsg", 3701,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333"
+        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wisconsin South (ftUS)\",GEOG"
+        "CS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2007\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",42],PARAMETER[\"central_meridian\",-90],P"
+        "ARAMETER[\"standard_parallel_1\",44.0666666666667],PARAM"
+        "ETER[\"standard_parallel_2\",42.7333333333333],PARAMETER"
+        "[\"false_easting\",1968500],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3700\"]]"},
+    {3701, "epsg", 3701,
         "NAD83(NSRS2007) / Wisconsin Transverse Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y");
-    add_proj4text (p, 1,
-        "_0=-4480000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wisconsin Transverse Mercator");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spa");
-    add_srs_wkt (p, 2,
-        "tial_Reference_System_2007\",SPHEROID[\"GRS 1980\",63781");
-    add_srs_wkt (p, 3,
-        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]]");
-    add_srs_wkt (p, 7,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 8,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",520000],PARAMETER[\"false_northing\",-4480000],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "701\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3702, "epsg", 3702,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y"
+        "_0=-4480000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wisconsin Transverse Mercator"
+        "\",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spa"
+        "tial_Reference_System_2007\",SPHEROID[\"GRS 1980\",63781"
+        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY"
+        "[\"EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-90],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",520000],PARAMETER[\"false_northing\",-4480000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "701\"]]"},
+    {3702, "epsg", 3702,
         "NAD83(NSRS2007) / Wyoming East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wyoming East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-105.166666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",200000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3702\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3703, "epsg", 3703,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9"
+        "999375 +x_0=200000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wyoming East\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5"
+        "],PARAMETER[\"central_meridian\",-105.166666666667],PARA"
+        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east"
+        "ing\",200000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3702\""
+        "]]"},
+    {3703, "epsg", 3703,
         "NAD83(NSRS2007) / Wyoming East Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=400000 +y_0=100000 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wyoming East Central\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",40.5],PARAMETER[\"central_meridian\",-107.333333333");
-    add_srs_wkt (p, 9,
-        "333],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_easting\",400000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 11,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"3703\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3704, "epsg", 3704,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9"
+        "999375 +x_0=400000 +y_0=100000 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wyoming East Central\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",40.5],PARAMETER[\"central_meridian\",-107.333333333"
+        "333],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"f"
+        "alse_easting\",400000],PARAMETER[\"false_northing\",1000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"3703\"]]"},
+    {3704, "epsg", 3704,
         "NAD83(NSRS2007) / Wyoming West Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wyoming West Central\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",40.5],PARAMETER[\"central_meridian\",-108.75],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",0.9999375],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3704\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3705, "epsg", 3705,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0"
+        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wyoming West Central\",GEOGCS"
+        "[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",40.5],PARAMETER[\"central_meridian\",-108.75],PARAM"
+        "ETER[\"scale_factor\",0.9999375],PARAMETER[\"false_easti"
+        "ng\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3704\"]"
+        "]"},
+    {3705, "epsg", 3705,
         "NAD83(NSRS2007) / Wyoming West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000 +y_0=100000 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wyoming West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-110.083333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",800000],PARAMETER[\"false_northing\",100000],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 13,
-        "705\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3706, "epsg", 3706,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9"
+        "999375 +x_0=800000 +y_0=100000 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wyoming West\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5"
+        "],PARAMETER[\"central_meridian\",-110.083333333333],PARA"
+        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east"
+        "ing\",800000],PARAMETER[\"false_northing\",100000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "705\"]]"},
+    {3706, "epsg", 3706,
         "NAD83(NSRS2007) / UTM zone 59N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=59 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 59N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",171],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3706\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3707, "epsg", 3707,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=59 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 59N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",171],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3706\"]]"},
+    {3707, "epsg", 3707,
         "NAD83(NSRS2007) / UTM zone 60N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=60 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 60N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",177],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3707\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3708, "epsg", 3708,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=60 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 60N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",177],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3707\"]]"},
+    {3708, "epsg", 3708,
         "NAD83(NSRS2007) / UTM zone 1N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 1N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-177],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3708\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3709, "epsg", 3709,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=1 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 1N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-177],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3708\"]]"},
+    {3709, "epsg", 3709,
         "NAD83(NSRS2007) / UTM zone 2N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=2 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 2N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-171],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3709\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3710, "epsg", 3710,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=2 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 2N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-171],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3709\"]]"},
+    {3710, "epsg", 3710,
         "NAD83(NSRS2007) / UTM zone 3N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=3 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 3N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-165],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3710\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3711, "epsg", 3711,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=3 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 3N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-165],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3710\"]]"},
+    {3711, "epsg", 3711,
         "NAD83(NSRS2007) / UTM zone 4N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=4 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 4N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-159],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3711\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3712, "epsg", 3712,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=4 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 4N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-159],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3711\"]]"},
+    {3712, "epsg", 3712,
         "NAD83(NSRS2007) / UTM zone 5N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=5 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 5N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-153],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3712\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3713, "epsg", 3713,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=5 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 5N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-153],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3712\"]]"},
+    {3713, "epsg", 3713,
         "NAD83(NSRS2007) / UTM zone 6N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=6 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 6N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-147],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3713\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3714, "epsg", 3714,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=6 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 6N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-147],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3713\"]]"},
+    {3714, "epsg", 3714,
         "NAD83(NSRS2007) / UTM zone 7N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 7N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-141],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3714\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3715, "epsg", 3715,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=7 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 7N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-141],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3714\"]]"},
+    {3715, "epsg", 3715,
         "NAD83(NSRS2007) / UTM zone 8N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=8 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 8N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-135],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3715\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3716, "epsg", 3716,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=8 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 8N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-135],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3715\"]]"},
+    {3716, "epsg", 3716,
         "NAD83(NSRS2007) / UTM zone 9N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=9 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 9N\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-129],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3716\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3717, "epsg", 3717,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=9 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 9N\",GEOGCS[\"NAD83("
+        "NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-129],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3716\"]]"},
+    {3717, "epsg", 3717,
         "NAD83(NSRS2007) / UTM zone 10N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=10 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 10N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-123],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3717\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3718, "epsg", 3718,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=10 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 10N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-123],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3717\"]]"},
+    {3718, "epsg", 3718,
         "NAD83(NSRS2007) / UTM zone 11N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 11N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-117],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3718\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3719, "epsg", 3719,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 11N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-117],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3718\"]]"},
+    {3719, "epsg", 3719,
         "NAD83(NSRS2007) / UTM zone 12N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 12N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-111],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3719\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3720, "epsg", 3720,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 12N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-111],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3719\"]]"},
+    {3720, "epsg", 3720,
         "NAD83(NSRS2007) / UTM zone 13N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 13N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-105],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3720\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3721, "epsg", 3721,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 13N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-105],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3720\"]]"},
+    {3721, "epsg", 3721,
         "NAD83(NSRS2007) / UTM zone 14N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 14N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-99],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3721\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3722, "epsg", 3722,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 14N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-99],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3721\"]]"},
+    {3722, "epsg", 3722,
         "NAD83(NSRS2007) / UTM zone 15N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 15N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-93],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3722\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3723, "epsg", 3723,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 15N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-93],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3722\"]]"},
+    {3723, "epsg", 3723,
         "NAD83(NSRS2007) / UTM zone 16N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 16N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-87],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3723\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3724, "epsg", 3724,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 16N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-87],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3723\"]]"},
+    {3724, "epsg", 3724,
         "NAD83(NSRS2007) / UTM zone 17N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 17N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-81],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3724\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3725, "epsg", 3725,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 17N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-81],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3724\"]]"},
+    {3725, "epsg", 3725,
         "NAD83(NSRS2007) / UTM zone 18N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 18N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-75],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3725\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3726, "epsg", 3726,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 18N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-75],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3725\"]]"},
+    {3726, "epsg", 3726,
         "NAD83(NSRS2007) / UTM zone 19N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / UTM zone 19N\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-69],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3726\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3727, "epsg", 3727,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / UTM zone 19N\",GEOGCS[\"NAD83"
+        "(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6759\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-69],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3726\"]]"},
+    {3727, "epsg", 3727,
         "Reunion 1947 / TM Reunion", 0, 0,
         "International 1924", "Greenwich",
         "Reunion_1947", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-21.11666666666667 +lon_0=55.53333333");
-    add_proj4text (p, 1,
-        "333333 +k=1 +x_0=160000 +y_0=50000 +ellps=intl +towgs84=");
-    add_proj4text (p, 2,
-        "94,-948,-1262,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Reunion 1947 / TM Reunion\",GEOGCS[\"Reunion 19");
-    add_srs_wkt (p, 1,
-        "47\",DATUM[\"Reunion_1947\",SPHEROID[\"International 192");
-    add_srs_wkt (p, 2,
-        "4\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6626\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4626\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",-21.1166666666667],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",55.5333333333333],PARAMETER[\"scale_factor\",1],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",160000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",50000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"3727\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3728, "epsg", 3728,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-21.11666666666667 +lon_0=55.53333333"
+        "333333 +k=1 +x_0=160000 +y_0=50000 +ellps=intl +towgs84="
+        "94,-948,-1262,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Reunion 1947 / TM Reunion\",GEOGCS[\"Reunion 19"
+        "47\",DATUM[\"Reunion_1947\",SPHEROID[\"International 192"
+        "4\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY["
+        "\"EPSG\",\"6626\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4626\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",-21.1166666666667],PARAMETER[\"central_meri"
+        "dian\",55.5333333333333],PARAMETER[\"scale_factor\",1],P"
+        "ARAMETER[\"false_easting\",160000],PARAMETER[\"false_nor"
+        "thing\",50000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3727\"]]"},
+    {3728, "epsg", 3728,
         "NAD83(NSRS2007) / Ohio North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Ohio North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",39.6666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-82.5],PARAMETER[\"standard_parallel_1\",41.7],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",40.4333333333333],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",1968500],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3728\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3729, "epsg", 3729,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39"
+        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Ohio North (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",39.6666666666667],PARAMETER[\"central_meridian"
+        "\",-82.5],PARAMETER[\"standard_parallel_1\",41.7],PARAME"
+        "TER[\"standard_parallel_2\",40.4333333333333],PARAMETER["
+        "\"false_easting\",1968500],PARAMETER[\"false_northing\","
+        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3728\"]]"},
+    {3729, "epsg", 3729,
         "NAD83(NSRS2007) / Ohio South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Ohio South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",38],PARAMETER[\"central_meridian\",-82.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",40.0333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",38.7333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",1968500],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3729\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3730, "epsg", 3730,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333"
+        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Ohio South (ftUS)\",GEOGCS[\""
+        "NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",38],PARAMETER[\"central_meridian\",-82.5],PARA"
+        "METER[\"standard_parallel_1\",40.0333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",38.7333333333333],PARAMETER[\""
+        "false_easting\",1968500],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"E"
+        "PSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3729\"]]"},
+    {3730, "epsg", 3730,
         "NAD83(NSRS2007) / Wyoming East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wyoming East (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",40.5],PARAMETER[\"central_meridian\",-105.1666666666");
-    add_srs_wkt (p, 9,
-        "67],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",656166.6667],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3730\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3731, "epsg", 3731,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9"
+        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wyoming East (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",40.5],PARAMETER[\"central_meridian\",-105.1666666666"
+        "67],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"fa"
+        "lse_easting\",656166.6667],PARAMETER[\"false_northing\","
+        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3730\"]]"},
+    {3731, "epsg", 3731,
         "NAD83(NSRS2007) / Wyoming East Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wyoming East Central (ftUS)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati");
-    add_srs_wkt (p, 2,
-        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",40.5],PARAMETER[\"central_meridian\",-107.333");
-    add_srs_wkt (p, 9,
-        "333333333],PARAMETER[\"scale_factor\",0.9999375],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",1312333.3333],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",328083.3333],UNIT[\"US survey foot\",0.304800609");
-    add_srs_wkt (p, 12,
-        "601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 13,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3731\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3732, "epsg", 3732,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9"
+        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp"
+        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wyoming East Central (ftUS)\""
+        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati"
+        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",40.5],PARAMETER[\"central_meridian\",-107.333"
+        "333333333],PARAMETER[\"scale_factor\",0.9999375],PARAMET"
+        "ER[\"false_easting\",1312333.3333],PARAMETER[\"false_nor"
+        "thing\",328083.3333],UNIT[\"US survey foot\",0.304800609"
+        "601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3731\""
+        "]]"},
+    {3732, "epsg", 3732,
         "NAD83(NSRS2007) / Wyoming West Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wyoming West Central (ftUS)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati");
-    add_srs_wkt (p, 2,
-        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",40.5],PARAMETER[\"central_meridian\",-108.75]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_easting\",1968500],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"3732\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3733, "epsg", 3733,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0"
+        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wyoming West Central (ftUS)\""
+        ",GEOGCS[\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spati"
+        "al_Reference_System_2007\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",40.5],PARAMETER[\"central_meridian\",-108.75]"
+        ",PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"false"
+        "_easting\",1968500],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3732\"]]"},
+    {3733, "epsg", 3733,
         "NAD83(NSRS2007) / Wyoming West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Wyoming West (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",40.5],PARAMETER[\"central_meridian\",-110.0833333333");
-    add_srs_wkt (p, 9,
-        "33],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",2624666.6667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",328083.3333],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3733\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3734, "epsg", 3734,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9"
+        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el"
+        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Wyoming West (ftUS)\",GEOGCS["
+        "\"NAD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"6759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",40.5],PARAMETER[\"central_meridian\",-110.0833333333"
+        "33],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"fa"
+        "lse_easting\",2624666.6667],PARAMETER[\"false_northing\""
+        ",328083.3333],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3733\"]]"},
+    {3734, "epsg", 3734,
         "NAD83 / Ohio North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Ohio North (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",39.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-82.5],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 9,
-        "1\",41.7],PARAMETER[\"standard_parallel_2\",40.433333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"false_easting\",1968500],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 12,
-        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3734\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3735, "epsg", 3735,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39"
+        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Ohio North (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",39.6666666666667],PARAMETER[\""
+        "central_meridian\",-82.5],PARAMETER[\"standard_parallel_"
+        "1\",41.7],PARAMETER[\"standard_parallel_2\",40.433333333"
+        "3333],PARAMETER[\"false_easting\",1968500],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960"
+        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3734\"]]"},
+    {3735, "epsg", 3735,
         "NAD83 / Ohio South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Ohio South (ftUS)\",GEOGCS[\"NAD83\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 2,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426");
-    add_srs_wkt (p, 6,
-        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME");
-    add_srs_wkt (p, 7,
-        "TER[\"latitude_of_origin\",38],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",-82.5],PARAMETER[\"standard_parallel_1\",40.033333");
-    add_srs_wkt (p, 9,
-        "3333333],PARAMETER[\"standard_parallel_2\",38.7333333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 12,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3735\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3736, "epsg", 3736,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333"
+        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Ohio South (ftUS)\",GEOGCS[\"NAD83\",DA"
+        "TUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"426"
+        "9\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAME"
+        "TER[\"latitude_of_origin\",38],PARAMETER[\"central_merid"
+        "ian\",-82.5],PARAMETER[\"standard_parallel_1\",40.033333"
+        "3333333],PARAMETER[\"standard_parallel_2\",38.7333333333"
+        "333],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3735\"]]"},
+    {3736, "epsg", 3736,
         "NAD83 / Wyoming East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wyoming East (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",40.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-105.166666666667],PARAMETER[\"scale_factor\",0.9999375");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",656166.6667],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960");
-    add_srs_wkt (p, 11,
-        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3736\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3737, "epsg", 3737,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9"
+        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Wyoming East (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",40.5],PARAMETER[\"central_meridian\""
+        ",-105.166666666667],PARAMETER[\"scale_factor\",0.9999375"
+        "],PARAMETER[\"false_easting\",656166.6667],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"US survey foot\",0.30480060960"
+        "1219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3736\"]]"},
+    {3737, "epsg", 3737,
         "NAD83 / Wyoming East Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wyoming East Central (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",40.5],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",-107.333333333333],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.9999375],PARAMETER[\"false_easting\",1312333.3333],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",328083.3333],UNIT[\"US survey ");
-    add_srs_wkt (p, 11,
-        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"3737\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3738, "epsg", 3738,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9"
+        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp"
+        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Wyoming East Central (ftUS)\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",40.5],PARAMETER[\"central_m"
+        "eridian\",-107.333333333333],PARAMETER[\"scale_factor\","
+        "0.9999375],PARAMETER[\"false_easting\",1312333.3333],PAR"
+        "AMETER[\"false_northing\",328083.3333],UNIT[\"US survey "
+        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3737\"]]"},
+    {3738, "epsg", 3738,
         "NAD83 / Wyoming West Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wyoming West Central (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",40.5],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",-108.75],PARAMETER[\"scale_factor\",0.9999375]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 11,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3738\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3739, "epsg", 3739,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0"
+        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Wyoming West Central (ftUS)\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",40.5],PARAMETER[\"central_m"
+        "eridian\",-108.75],PARAMETER[\"scale_factor\",0.9999375]"
+        ",PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3738\"]]"},
+    {3739, "epsg", 3739,
         "NAD83 / Wyoming West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Wyoming West (ftUS)\",GEOGCS[\"NAD83\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",40.5],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-110.083333333333],PARAMETER[\"scale_factor\",0.9999375");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",2624666.6667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",328083.3333],UNIT[\"US survey foot\",0.");
-    add_srs_wkt (p, 11,
-        "304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 12,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"3739\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3740, "epsg", 3740,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9"
+        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el"
+        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Wyoming West (ftUS)\",GEOGCS[\"NAD83\","
+        "DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",40.5],PARAMETER[\"central_meridian\""
+        ",-110.083333333333],PARAMETER[\"scale_factor\",0.9999375"
+        "],PARAMETER[\"false_easting\",2624666.6667],PARAMETER[\""
+        "false_northing\",328083.3333],UNIT[\"US survey foot\",0."
+        "304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3739\"]]"},
+    {3740, "epsg", 3740,
         "NAD83(HARN) / UTM zone 10N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=10 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 10N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-123],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3740\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3741, "epsg", 3741,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=10 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 10N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-123],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3740\"]]"},
+    {3741, "epsg", 3741,
         "NAD83(HARN) / UTM zone 11N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 11N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-117],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3741\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3742, "epsg", 3742,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 11N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-117],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3741\"]]"},
+    {3742, "epsg", 3742,
         "NAD83(HARN) / UTM zone 12N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 12N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-111],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3742\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3743, "epsg", 3743,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 12N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-111],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3742\"]]"},
+    {3743, "epsg", 3743,
         "NAD83(HARN) / UTM zone 13N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 13N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-105],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3743\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3744, "epsg", 3744,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 13N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-105],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3743\"]]"},
+    {3744, "epsg", 3744,
         "NAD83(HARN) / UTM zone 14N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 14N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-99],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3744\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3745, "epsg", 3745,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 14N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-99],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3744\"]]"},
+    {3745, "epsg", 3745,
         "NAD83(HARN) / UTM zone 15N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 15N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-93],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3745\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3746, "epsg", 3746,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 15N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-93],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3745\"]]"},
+    {3746, "epsg", 3746,
         "NAD83(HARN) / UTM zone 16N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 16N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-87],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3746\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3747, "epsg", 3747,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 16N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-87],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3746\"]]"},
+    {3747, "epsg", 3747,
         "NAD83(HARN) / UTM zone 17N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 17N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-81],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3747\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3748, "epsg", 3748,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 17N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-81],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3747\"]]"},
+    {3748, "epsg", 3748,
         "NAD83(HARN) / UTM zone 18N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 18N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-75],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3748\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 18N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-75],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3748\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_16 = {
+    epsg_defs_16, sizeof (epsg_defs_16) / sizeof (epsg_defs_16[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3643 +53,2080 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_17 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3749, "epsg", 3749,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_17[] = {
+    {3749, "epsg", 3749,
         "NAD83(HARN) / UTM zone 19N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 19N\",GEOGCS[\"NAD83(HAR");
-    add_srs_wkt (p, 1,
-        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-69],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3749\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3750, "epsg", 3750,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 19N\",GEOGCS[\"NAD83(HAR"
+        "N)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-69],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3749\"]]"},
+    {3750, "epsg", 3750,
         "NAD83(HARN) / UTM zone 4N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=4 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 4N\",GEOGCS[\"NAD83(HARN");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-159],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3750\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3751, "epsg", 3751,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=4 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 4N\",GEOGCS[\"NAD83(HARN"
+        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE"
+        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG"
+        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-159],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3750\"]]"},
+    {3751, "epsg", 3751,
         "NAD83(HARN) / UTM zone 5N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=5 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / UTM zone 5N\",GEOGCS[\"NAD83(HARN");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-153],PARAMETER[\"scale_factor\",0.9996],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"3751\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3752, "epsg", 3752,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=5 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / UTM zone 5N\",GEOGCS[\"NAD83(HARN"
+        ")\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",SPHE"
+        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG"
+        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-153],PARAMETER[\"scale_factor\",0.9996],"
+        "PARAMETER[\"false_easting\",500000],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3751\"]]"},
+    {3752, "epsg", 3752,
         "WGS 84 / Mercator 41", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Mercator_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=100 +lat_ts=-41 +x_0=0 +y_0=0 +datum=W");
-    add_proj4text (p, 1,
-        "GS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Mercator 41\",GEOGCS[\"WGS 84\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Merc");
-    add_srs_wkt (p, 6,
-        "ator_2SP\"],PARAMETER[\"standard_parallel_1\",-41],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"central_meridian\",100],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 8,
-        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 9,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 10,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3994\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3753, "epsg", 3753,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=100 +lat_ts=-41 +x_0=0 +y_0=0 +datum=W"
+        "GS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / Mercator 41\",GEOGCS[\"WGS 84\",DATUM["
+        "\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,A"
+        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Merc"
+        "ator_2SP\"],PARAMETER[\"standard_parallel_1\",-41],PARAM"
+        "ETER[\"central_meridian\",100],PARAMETER[\"false_easting"
+        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3994\"]]"},
+    {3753, "epsg", 3753,
         "NAD83(HARN) / Ohio North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Ohio North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-82.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",41.7],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",40.4333333333333],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "1968500],PARAMETER[\"false_northing\",0],UNIT[\"US surve");
-    add_srs_wkt (p, 12,
-        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"3753\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3754, "epsg", 3754,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39"
+        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G"
+        "RS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Ohio North (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39.66666"
+        "66666667],PARAMETER[\"central_meridian\",-82.5],PARAMETE"
+        "R[\"standard_parallel_1\",41.7],PARAMETER[\"standard_par"
+        "allel_2\",40.4333333333333],PARAMETER[\"false_easting\","
+        "1968500],PARAMETER[\"false_northing\",0],UNIT[\"US surve"
+        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"3753\"]]"},
+    {3754, "epsg", 3754,
         "NAD83(HARN) / Ohio South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Ohio South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-82.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",40.0333333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",38.7333333333333],PARAMETER[\"false_easting\",19");
-    add_srs_wkt (p, 11,
-        "68500],PARAMETER[\"false_northing\",0],UNIT[\"US survey ");
-    add_srs_wkt (p, 12,
-        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"3754\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3755, "epsg", 3755,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333"
+        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS"
+        "80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Ohio South (ftUS)\",GEOGCS[\"NAD8"
+        "3(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38],PARA"
+        "METER[\"central_meridian\",-82.5],PARAMETER[\"standard_p"
+        "arallel_1\",40.0333333333333],PARAMETER[\"standard_paral"
+        "lel_2\",38.7333333333333],PARAMETER[\"false_easting\",19"
+        "68500],PARAMETER[\"false_northing\",0],UNIT[\"US survey "
+        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"3754\"]]"},
+    {3755, "epsg", 3755,
         "NAD83(HARN) / Wyoming East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wyoming East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-105.166666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",65");
-    add_srs_wkt (p, 10,
-        "6166.6667],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 11,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"3755\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3756, "epsg", 3756,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9"
+        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +towgs84"
+        "=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wyoming East (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM"
+        "ETER[\"central_meridian\",-105.166666666667],PARAMETER[\""
+        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",65"
+        "6166.6667],PARAMETER[\"false_northing\",0],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"3755\"]]"},
+    {3756, "epsg", 3756,
         "NAD83(HARN) / Wyoming East Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wyoming East Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc");
-    add_srs_wkt (p, 2,
-        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-107.333333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",1312333.3333],PARAMETER[\"false_northing\",328083.");
-    add_srs_wkt (p, 11,
-        "3333],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3756\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3757, "epsg", 3757,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9"
+        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp"
+        "s=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wyoming East Central (ftUS)\",GEO"
+        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc"
+        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5"
+        "],PARAMETER[\"central_meridian\",-107.333333333333],PARA"
+        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east"
+        "ing\",1312333.3333],PARAMETER[\"false_northing\",328083."
+        "3333],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"3756\"]]"},
+    {3757, "epsg", 3757,
         "NAD83(HARN) / Wyoming West Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wyoming West Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc");
-    add_srs_wkt (p, 2,
-        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-108.75],PARAMETER[\"sc");
-    add_srs_wkt (p, 9,
-        "ale_factor\",0.9999375],PARAMETER[\"false_easting\",1968");
-    add_srs_wkt (p, 10,
-        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 11,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"3757\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3758, "epsg", 3758,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0"
+        "=600000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wyoming West Central (ftUS)\",GEO"
+        "GCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Referenc"
+        "e_Network\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5"
+        "],PARAMETER[\"central_meridian\",-108.75],PARAMETER[\"sc"
+        "ale_factor\",0.9999375],PARAMETER[\"false_easting\",1968"
+        "500],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3757\"]]"},
+    {3758, "epsg", 3758,
         "NAD83(HARN) / Wyoming West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Wyoming West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ");
-    add_srs_wkt (p, 2,
-        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-110.083333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",26");
-    add_srs_wkt (p, 10,
-        "24666.6667],PARAMETER[\"false_northing\",328083.3333],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"3758\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3759, "epsg", 3759,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9"
+        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el"
+        "lps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Wyoming West (ftUS)\",GEOGCS[\"NA"
+        "D83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Networ"
+        "k\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM"
+        "ETER[\"central_meridian\",-110.083333333333],PARAMETER[\""
+        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",26"
+        "24666.6667],PARAMETER[\"false_northing\",328083.3333],UN"
+        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG"
+        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"3758\"]]"},
+    {3759, "epsg", 3759,
         "NAD83 / Hawaii zone 3 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99");
-    add_proj4text (p, 1,
-        "999 +x_0=500000.00001016 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Hawaii zone 3 (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",21.1666666666667],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-158],PARAMETER[\"scale_factor\",0.99999],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",1640416.6667],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 11,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3759\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3760, "epsg", 3760,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99"
+        "999 +x_0=500000.00001016 +y_0=0 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / Hawaii zone 3 (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",21.1666666666667],PARAMETER[\"centr"
+        "al_meridian\",-158],PARAMETER[\"scale_factor\",0.99999],"
+        "PARAMETER[\"false_easting\",1640416.6667],PARAMETER[\"fa"
+        "lse_northing\",0],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3759\"]]"},
+    {3760, "epsg", 3760,
         "NAD83(HARN) / Hawaii zone 3 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99");
-    add_proj4text (p, 1,
-        "999 +x_0=500000.00001016 +y_0=0 +ellps=GRS80 +towgs84=0,");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Hawaii zone 3 (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo");
-    add_srs_wkt (p, 2,
-        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",21.16666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-158],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.99999],PARAMETER[\"false_easting\",1640");
-    add_srs_wkt (p, 10,
-        "416.6667],PARAMETER[\"false_northing\",0],UNIT[\"US surv");
-    add_srs_wkt (p, 11,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"3760\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3761, "epsg", 3761,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99"
+        "999 +x_0=500000.00001016 +y_0=0 +ellps=GRS80 +towgs84=0,"
+        "0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(HARN) / Hawaii zone 3 (ftUS)\",GEOGCS[\"N"
+        "AD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Netwo"
+        "rk\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",21.16666666"
+        "66667],PARAMETER[\"central_meridian\",-158],PARAMETER[\""
+        "scale_factor\",0.99999],PARAMETER[\"false_easting\",1640"
+        "416.6667],PARAMETER[\"false_northing\",0],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3760\"]]"},
+    {3761, "epsg", 3761,
         "NAD83(CSRS) / UTM zone 22N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / UTM zone 22N\",GEOGCS[\"NAD83(CSR");
-    add_srs_wkt (p, 1,
-        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-51],PARAMETER[\"scale_factor\",0.9996");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3761\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3762, "epsg", 3762,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / UTM zone 22N\",GEOGCS[\"NAD83(CSR"
+        "S)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",-51],PARAMETER[\"scale_factor\",0.9996"
+        "],PARAMETER[\"false_easting\",500000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3761\"]]"},
+    {3762, "epsg", 3762,
         "WGS 84 / South Georgia Lambert", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-54 +lat_2=-54.75 +lat_0=-55 +lon_0=-37");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / South Georgia Lambert\",GEOGCS[\"WGS 8");
-    add_srs_wkt (p, 1,
-        "4\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2");
-    add_srs_wkt (p, 2,
-        "57223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",-55],PARAMETER[\"central_meridian\",-37],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"standard_parallel_1\",-54],PARAMETER[\"standar");
-    add_srs_wkt (p, 9,
-        "d_parallel_2\",-54.75],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3762\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3763, "epsg", 3763,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-54 +lat_2=-54.75 +lat_0=-55 +lon_0=-37"
+        " +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / South Georgia Lambert\",GEOGCS[\"WGS 8"
+        "4\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2"
+        "57223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\""
+        ",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",-55],PARAMETER[\"central_meridian\",-37],PA"
+        "RAMETER[\"standard_parallel_1\",-54],PARAMETER[\"standar"
+        "d_parallel_2\",-54.75],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"3762\"]]"},
+    {3763, "epsg", 3763,
         "ETRS89 / Portugal TM06", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=39.66825833333333 +lon_0=-8.133108333");
-    add_proj4text (p, 1,
-        "333334 +k=1 +x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / Portugal TM06\",GEOGCS[\"ETRS89\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"European_Terrestrial_Reference_System_1989\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"latitude_of_origin\",39.6682583333333],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-8.13310833333333],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",0],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"3763\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3764, "epsg", 3764,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=39.66825833333333 +lon_0=-8.133108333"
+        "333334 +k=1 +x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / Portugal TM06\",GEOGCS[\"ETRS89\",DATU"
+        "M[\"European_Terrestrial_Reference_System_1989\",SPHEROI"
+        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\","
+        "\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"]"
+        ",PARAMETER[\"latitude_of_origin\",39.6682583333333],PARA"
+        "METER[\"central_meridian\",-8.13310833333333],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",0],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"3763\"]]"},
+    {3764, "epsg", 3764,
         "NZGD2000 / Chatham Island Circuit 2000", 0, 1,
         "GRS 1980", "Greenwich",
         "New_Zealand_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-44 +lon_0=-176.5 +k=1 +x_0=400000 +y");
-    add_proj4text (p, 1,
-        "_0=800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NZGD2000 / Chatham Island Circuit 2000\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",-44],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-176.5],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",400000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",800000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"3764\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3765, "epsg", 3765,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-44 +lon_0=-176.5 +k=1 +x_0=400000 +y"
+        "_0=800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +"
+        "no_defs",
+        "PROJCS[\"NZGD2000 / Chatham Island Circuit 2000\",GEOGCS"
+        "[\"NZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",-44],PARAMETER[\""
+        "central_meridian\",-176.5],PARAMETER[\"scale_factor\",1]"
+        ",PARAMETER[\"false_easting\",400000],PARAMETER[\"false_n"
+        "orthing\",800000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"3764\"]]"},
+    {3765, "epsg", 3765,
         "HTRS96 / Croatia TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Croatian_Terrestrial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.5 +k=0.9999 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"HTRS96 / Croatia TM\",GEOGCS[\"HTRS96\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Croatian_Terrestrial_Reference_System\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4761\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",16.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3765\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3766, "epsg", 3766,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=16.5 +k=0.9999 +x_0=500000 +"
+        "y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"HTRS96 / Croatia TM\",GEOGCS[\"HTRS96\",DATUM[\""
+        "Croatian_Terrestrial_Reference_System\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4761\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",16.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3765\"]]"},
+    {3766, "epsg", 3766,
         "HTRS96 / Croatia LCC", 0, 0,
         "GRS 1980", "Greenwich",
         "Croatian_Terrestrial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.91666666666666 +lat_2=43.08333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=0 +lon_0=16.5 +x_0=0 +y_0=0 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"HTRS96 / Croatia LCC\",GEOGCS[\"HTRS96\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"Croatian_Terrestrial_Reference_System\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4761\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",16.5],PARAMETER[\"standard_parallel_1\",45.91");
-    add_srs_wkt (p, 9,
-        "66666666667],PARAMETER[\"standard_parallel_2\",43.083333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"false_easting\",0],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"3766\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3767, "epsg", 3767,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.91666666666666 +lat_2=43.08333333333"
+        "334 +lat_0=0 +lon_0=16.5 +x_0=0 +y_0=0 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"HTRS96 / Croatia LCC\",GEOGCS[\"HTRS96\",DATUM["
+        "\"Croatian_Terrestrial_Reference_System\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4761\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_"
+        "meridian\",16.5],PARAMETER[\"standard_parallel_1\",45.91"
+        "66666666667],PARAMETER[\"standard_parallel_2\",43.083333"
+        "3333333],PARAMETER[\"false_easting\",0],PARAMETER[\"fals"
+        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90"
+        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"3766\"]]"},
+    {3767, "epsg", 3767,
         "HTRS96 / UTM zone 33N", 0, 0,
         "GRS 1980", "Greenwich",
         "Croatian_Terrestrial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"HTRS96 / UTM zone 33N\",GEOGCS[\"HTRS96\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Croatian_Terrestrial_Reference_System\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4761\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3767\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3768, "epsg", 3768,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"HTRS96 / UTM zone 33N\",GEOGCS[\"HTRS96\",DATUM"
+        "[\"Croatian_Terrestrial_Reference_System\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4761\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3767\"]]"},
+    {3768, "epsg", 3768,
         "HTRS96 / UTM zone 34N", 0, 0,
         "GRS 1980", "Greenwich",
         "Croatian_Terrestrial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"HTRS96 / UTM zone 34N\",GEOGCS[\"HTRS96\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Croatian_Terrestrial_Reference_System\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4761\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",21],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3768\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3769, "epsg", 3769,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=34 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"HTRS96 / UTM zone 34N\",GEOGCS[\"HTRS96\",DATUM"
+        "[\"Croatian_Terrestrial_Reference_System\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6761\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4761\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",21],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\""
+        "false_easting\",500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3768\"]]"},
+    {3769, "epsg", 3769,
         "Bermuda 1957 / UTM zone 20N", 0, 0,
         "Clarke 1866", "Greenwich",
         "Bermuda_1957", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=clrk66 +towgs84=-73,213,296,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bermuda 1957 / UTM zone 20N\",GEOGCS[\"Bermuda ");
-    add_srs_wkt (p, 1,
-        "1957\",DATUM[\"Bermuda_1957\",SPHEROID[\"Clarke 1866\",6");
-    add_srs_wkt (p, 2,
-        "378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6216\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4216\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3");
-    add_srs_wkt (p, 12,
-        "769\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3770, "epsg", 3770,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=clrk66 +towgs84=-73,213,296,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bermuda 1957 / UTM zone 20N\",GEOGCS[\"Bermuda "
+        "1957\",DATUM[\"Bermuda_1957\",SPHEROID[\"Clarke 1866\",6"
+        "378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],"
+        "AUTHORITY[\"EPSG\",\"6216\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4216\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-"
+        "63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false"
+        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3"
+        "769\"]]"},
+    {3770, "epsg", 3770,
         "BDA2000 / Bermuda 2000 National Grid", 0, 0,
         "WGS 84", "Greenwich",
         "Bermuda_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=32 +lon_0=-64.75 +k=1 +x_0=550000 +y_");
-    add_proj4text (p, 1,
-        "0=100000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"BDA2000 / Bermuda 2000 National Grid\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "BDA2000\",DATUM[\"Bermuda_2000\",SPHEROID[\"WGS 84\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6762\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4762\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",32],PARAMETER[\"central_meridian\",-64.7");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",550000],PARAMETER[\"false_northing\",100000],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"377");
-    add_srs_wkt (p, 12,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3771, "epsg", 3771,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=32 +lon_0=-64.75 +k=1 +x_0=550000 +y_"
+        "0=100000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"BDA2000 / Bermuda 2000 National Grid\",GEOGCS[\""
+        "BDA2000\",DATUM[\"Bermuda_2000\",SPHEROID[\"WGS 84\",637"
+        "8137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORI"
+        "TY[\"EPSG\",\"6762\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4762\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",32],PARAMETER[\"central_meridian\",-64.7"
+        "5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easti"
+        "ng\",550000],PARAMETER[\"false_northing\",100000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"377"
+        "0\"]]"},
+    {3771, "epsg", 3771,
         "NAD27 / Alberta 3TM ref merid 111 W", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-111 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Alberta 3TM ref merid 111 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C");
-    add_srs_wkt (p, 2,
-        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-111],PARAMETER[\"scale_factor\",0.9999],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"3771\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3772, "epsg", 3772,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-111 +k=0.9999 +x_0=0 +y_0=0"
+        " +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / Alberta 3TM ref merid 111 W\",GEOGCS[\""
+        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C"
+        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG"
+        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-111],PARAMETER[\"scale_factor\",0.9999],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3771\"]]"},
+    {3772, "epsg", 3772,
         "NAD27 / Alberta 3TM ref merid 114 W", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-114 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Alberta 3TM ref merid 114 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C");
-    add_srs_wkt (p, 2,
-        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-114],PARAMETER[\"scale_factor\",0.9999],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"3772\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3773, "epsg", 3773,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-114 +k=0.9999 +x_0=0 +y_0=0"
+        " +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / Alberta 3TM ref merid 114 W\",GEOGCS[\""
+        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C"
+        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG"
+        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-114],PARAMETER[\"scale_factor\",0.9999],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3772\"]]"},
+    {3773, "epsg", 3773,
         "NAD27 / Alberta 3TM ref merid 117 W", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-117 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Alberta 3TM ref merid 117 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C");
-    add_srs_wkt (p, 2,
-        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-117],PARAMETER[\"scale_factor\",0.9999],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"3773\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3774, "epsg", 3774,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-117 +k=0.9999 +x_0=0 +y_0=0"
+        " +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / Alberta 3TM ref merid 117 W\",GEOGCS[\""
+        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C"
+        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG"
+        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-117],PARAMETER[\"scale_factor\",0.9999],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3773\"]]"},
+    {3774, "epsg", 3774,
         "NAD27 / Alberta 3TM ref merid 120 W", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Alberta 3TM ref merid 120 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C");
-    add_srs_wkt (p, 2,
-        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-120],PARAMETER[\"scale_factor\",0.9999],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"3800\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3775, "epsg", 3775,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0"
+        " +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / Alberta 3TM ref merid 120 W\",GEOGCS[\""
+        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C"
+        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG"
+        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-120],PARAMETER[\"scale_factor\",0.9999],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3800\"]]"},
+    {3775, "epsg", 3775,
         "NAD83 / Alberta 3TM ref merid 111 W", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-111 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Alberta 3TM ref merid 111 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-111],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3775\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3776, "epsg", 3776,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-111 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Alberta 3TM ref merid 111 W\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-111],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3775\"]]"},
+    {3776, "epsg", 3776,
         "NAD83 / Alberta 3TM ref merid 114 W", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-114 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Alberta 3TM ref merid 114 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-114],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3776\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3777, "epsg", 3777,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-114 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Alberta 3TM ref merid 114 W\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-114],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3776\"]]"},
+    {3777, "epsg", 3777,
         "NAD83 / Alberta 3TM ref merid 117 W", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-117 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Alberta 3TM ref merid 117 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-117],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3777\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3778, "epsg", 3778,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-117 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Alberta 3TM ref merid 117 W\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-117],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3777\"]]"},
+    {3778, "epsg", 3778,
         "NAD83 / Alberta 3TM ref merid 120 W", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Alberta 3TM ref merid 120 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-120],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3801\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3779, "epsg", 3779,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Alberta 3TM ref merid 120 W\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-120],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3801\"]]"},
+    {3779, "epsg", 3779,
         "NAD83(CSRS) / Alberta 3TM ref merid 111 W", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-111 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 111 W\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-111],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3779\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3780, "epsg", 3780,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-111 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 111 W\",GEO"
+        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer"
+        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614"
+        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",-111],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET"
+        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3779\"]]"},
+    {3780, "epsg", 3780,
         "NAD83(CSRS) / Alberta 3TM ref merid 114 W", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-114 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 114 W\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-114],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3780\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3781, "epsg", 3781,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-114 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 114 W\",GEO"
+        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer"
+        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614"
+        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",-114],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET"
+        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3780\"]]"},
+    {3781, "epsg", 3781,
         "NAD83(CSRS) / Alberta 3TM ref merid 117 W", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-117 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 117 W\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-117],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3781\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3782, "epsg", 3782,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-117 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 117 W\",GEO"
+        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer"
+        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614"
+        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",-117],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET"
+        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3781\"]]"},
+    {3782, "epsg", 3782,
         "NAD83(CSRS) / Alberta 3TM ref merid 120 W", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 120 W\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-120],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3802\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3783, "epsg", 3783,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 120 W\",GEO"
+        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer"
+        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614"
+        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",-120],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET"
+        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3802\"]]"},
+    {3783, "epsg", 3783,
         "Pitcairn 2006 / Pitcairn TM 2006", 0, 0,
         "WGS 84", "Greenwich",
         "Pitcairn_2006", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-25.06855261111111 +lon_0=-130.112967");
-    add_proj4text (p, 1,
-        "1111111 +k=1 +x_0=14200 +y_0=15500 +ellps=WGS84 +towgs84");
-    add_proj4text (p, 2,
-        "=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pitcairn 2006 / Pitcairn TM 2006\",GEOGCS[\"Pit");
-    add_srs_wkt (p, 1,
-        "cairn 2006\",DATUM[\"Pitcairn_2006\",SPHEROID[\"WGS 84\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6763\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"47");
-    add_srs_wkt (p, 6,
-        "63\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",-25.0685526111111],PARAMETER[\"centr");
-    add_srs_wkt (p, 8,
-        "al_meridian\",-130.112967111111],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",1],PARAMETER[\"false_easting\",14200],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",15500],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"3783\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3784, "epsg", 3784,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-25.06855261111111 +lon_0=-130.112967"
+        "1111111 +k=1 +x_0=14200 +y_0=15500 +ellps=WGS84 +towgs84"
+        "=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Pitcairn 2006 / Pitcairn TM 2006\",GEOGCS[\"Pit"
+        "cairn 2006\",DATUM[\"Pitcairn_2006\",SPHEROID[\"WGS 84\""
+        ",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUT"
+        "HORITY[\"EPSG\",\"6763\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"47"
+        "63\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",-25.0685526111111],PARAMETER[\"centr"
+        "al_meridian\",-130.112967111111],PARAMETER[\"scale_facto"
+        "r\",1],PARAMETER[\"false_easting\",14200],PARAMETER[\"fa"
+        "lse_northing\",15500],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"3783\"]]"},
+    {3784, "epsg", 3784,
         "Pitcairn 1967 / UTM zone 9S", 0, 0,
         "International 1924", "Greenwich",
         "Pitcairn_1967", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=9 +south +ellps=intl +towgs84=185,165,42");
-    add_proj4text (p, 1,
-        ",0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pitcairn 1967 / UTM zone 9S\",GEOGCS[\"Pitcairn");
-    add_srs_wkt (p, 1,
-        " 1967\",DATUM[\"Pitcairn_1967\",SPHEROID[\"International");
-    add_srs_wkt (p, 2,
-        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6729\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4729\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-129],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",500000],PARAMETER[\"false_northing\",10000000],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3784\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3785, "epsg", 3785,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=9 +south +ellps=intl +towgs84=185,165,42"
+        ",0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Pitcairn 1967 / UTM zone 9S\",GEOGCS[\"Pitcairn"
+        " 1967\",DATUM[\"Pitcairn_1967\",SPHEROID[\"International"
+        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6729\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4729\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",-129],"
+        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",10000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"3784\"]]"},
+    {3785, "epsg", 3785,
         "WGS 84 / Pseudo-Mercator", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 +lon_0=0.0 ");
-    add_proj4text (p, 1,
-        "+x_0=0.0 +y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Pseudo-Mercator\",GEOGCS[\"WGS 84\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2572235");
-    add_srs_wkt (p, 2,
-        "63,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"63");
-    add_srs_wkt (p, 3,
-        "26\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"M");
-    add_srs_wkt (p, 6,
-        "ercator_1SP\"],PARAMETER[\"central_meridian\",0],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 9,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 10,
-        "ing\",NORTH],EXTENSION[\"PROJ4\",\"+proj=merc +a=6378137");
-    add_srs_wkt (p, 11,
-        " +b=6378137 +lat_ts=0 +lon_0=0 +x_0=0 +y_0=0 +k=1 +units");
-    add_srs_wkt (p, 12,
-        "=m +nadgrids=@null +wktext +no_defs\"],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"3857\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3786, "epsg", 3786,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 +lon_0=0.0 "
+        "+x_0=0.0 +y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext "
+        "+no_defs",
+        "PROJCS[\"WGS 84 / Pseudo-Mercator\",GEOGCS[\"WGS 84\",DA"
+        "TUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2572235"
+        "63,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"63"
+        "26\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"M"
+        "ercator_1SP\"],PARAMETER[\"central_meridian\",0],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],EXTENSION[\"PROJ4\",\"+proj=merc +a=6378137"
+        " +b=6378137 +lat_ts=0 +lon_0=0 +x_0=0 +y_0=0 +k=1 +units"
+        "=m +nadgrids=@null +wktext +no_defs\"],AUTHORITY[\"EPSG\""
+        ",\"3857\"]]"},
+    {3786, "epsg", 3786,
         "World Equidistant Cylindrical (Sphere) (deprecated)", 0, 0,
         "GRS 1980 Authalic Sphere", "Greenwich",
         "Not_specified_based_on_GRS_1980_Authalic_Sphere", "Equirectangular", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=eqc +lat_ts=0 +lat_0=0 +lon_0=0 +x_0=0 +y_0=0 +a=6");
-    add_proj4text (p, 1,
-        "371007 +b=6371007 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"World Equidistant Cylindrical (Sphere) (depreca");
-    add_srs_wkt (p, 1,
-        "ted)\",GEOGCS[\"Unspecified datum based upon the GRS 198");
-    add_srs_wkt (p, 2,
-        "0 Authalic Sphere (deprecated)\",DATUM[\"Not_specified_b");
-    add_srs_wkt (p, 3,
-        "ased_on_GRS_1980_Authalic_Sphere\",SPHEROID[\"GRS 1980 A");
-    add_srs_wkt (p, 4,
-        "uthalic Sphere\",6371007,0,AUTHORITY[\"EPSG\",\"7048\"]]");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"6047\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 6,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 7,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 8,
-        "\"4047\"]],PROJECTION[\"Equirectangular\"],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",0],PARAMETER[\"central_meridian\",0");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",0],PARAMETER[\"false_north");
-    add_srs_wkt (p, 11,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"4088\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3787, "epsg", 3787,
+        "Easting", "East", "Northing", "North",
+        "+proj=eqc +lat_ts=0 +lat_0=0 +lon_0=0 +x_0=0 +y_0=0 +a=6"
+        "371007 +b=6371007 +units=m +no_defs",
+        "PROJCS[\"World Equidistant Cylindrical (Sphere) (depreca"
+        "ted)\",GEOGCS[\"Unspecified datum based upon the GRS 198"
+        "0 Authalic Sphere (deprecated)\",DATUM[\"Not_specified_b"
+        "ased_on_GRS_1980_Authalic_Sphere\",SPHEROID[\"GRS 1980 A"
+        "uthalic Sphere\",6371007,0,AUTHORITY[\"EPSG\",\"7048\"]]"
+        ",AUTHORITY[\"EPSG\",\"6047\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4047\"]],PROJECTION[\"Equirectangular\"],PARAMETER[\"s"
+        "tandard_parallel_1\",0],PARAMETER[\"central_meridian\",0"
+        "],PARAMETER[\"false_easting\",0],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"4088\"]]"},
+    {3787, "epsg", 3787,
         "MGI 1901 / Slovene National Grid", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=-5000000 +ellps=bessel +towgs84=577.326,90.129,463.919");
-    add_proj4text (p, 2,
-        ",5.137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI 1901 / Slovene National Grid\",GEOGCS[\"MGI");
-    add_srs_wkt (p, 1,
-        " 1901\",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",15],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",500000],PARAMETER[\"false_northing\",-5000000],UNIT");
-    add_srs_wkt (p, 10,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 11,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3912\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3788, "epsg", 3788,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=500000 +y_"
+        "0=-5000000 +ellps=bessel +towgs84=577.326,90.129,463.919"
+        ",5.137,1.474,5.297,2.4232 +units=m +no_defs",
+        "PROJCS[\"MGI 1901 / Slovene National Grid\",GEOGCS[\"MGI"
+        " 1901\",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377"
+        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR"
+        "ITY[\"EPSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",15],PA"
+        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti"
+        "ng\",500000],PARAMETER[\"false_northing\",-5000000],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3912\"]]"},
+    {3788, "epsg", 3788,
         "NZGD2000 / Auckland Islands TM 2000", 0, 1,
         "GRS 1980", "Greenwich",
         "New_Zealand_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=166 +k=1 +x_0=3500000 +y_0=1");
-    add_proj4text (p, 1,
-        "0000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NZGD2000 / Auckland Islands TM 2000\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",166],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",3500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3788\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3789, "epsg", 3789,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=166 +k=1 +x_0=3500000 +y_0=1"
+        "0000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"NZGD2000 / Auckland Islands TM 2000\",GEOGCS[\""
+        "NZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",166],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",3500000],PARAMETER[\"false_northin"
+        "g\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT"
+        "HORITY[\"EPSG\",\"3788\"]]"},
+    {3789, "epsg", 3789,
         "NZGD2000 / Campbell Island TM 2000", 0, 1,
         "GRS 1980", "Greenwich",
         "New_Zealand_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=169 +k=1 +x_0=3500000 +y_0=1");
-    add_proj4text (p, 1,
-        "0000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NZGD2000 / Campbell Island TM 2000\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "ZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",169],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",3500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3789\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3790, "epsg", 3790,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=169 +k=1 +x_0=3500000 +y_0=1"
+        "0000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"NZGD2000 / Campbell Island TM 2000\",GEOGCS[\"N"
+        "ZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPHE"
+        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG"
+        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",169],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",3500000],PARAMETER[\"false_northin"
+        "g\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT"
+        "HORITY[\"EPSG\",\"3789\"]]"},
+    {3790, "epsg", 3790,
         "NZGD2000 / Antipodes Islands TM 2000", 0, 1,
         "GRS 1980", "Greenwich",
         "New_Zealand_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=179 +k=1 +x_0=3500000 +y_0=1");
-    add_proj4text (p, 1,
-        "0000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NZGD2000 / Antipodes Islands TM 2000\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",179],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",3500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3790\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3791, "epsg", 3791,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=179 +k=1 +x_0=3500000 +y_0=1"
+        "0000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"NZGD2000 / Antipodes Islands TM 2000\",GEOGCS[\""
+        "NZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",179],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",3500000],PARAMETER[\"false_northin"
+        "g\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT"
+        "HORITY[\"EPSG\",\"3790\"]]"},
+    {3791, "epsg", 3791,
         "NZGD2000 / Raoul Island TM 2000", 0, 1,
         "GRS 1980", "Greenwich",
         "New_Zealand_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-178 +k=1 +x_0=3500000 +y_0=");
-    add_proj4text (p, 1,
-        "10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NZGD2000 / Raoul Island TM 2000\",GEOGCS[\"NZGD");
-    add_srs_wkt (p, 1,
-        "2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPHEROI");
-    add_srs_wkt (p, 2,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-178],PARAMETER[\"scale_factor\",1],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",3500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"3791\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3793, "epsg", 3793,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-178 +k=1 +x_0=3500000 +y_0="
+        "10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"NZGD2000 / Raoul Island TM 2000\",GEOGCS[\"NZGD"
+        "2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPHEROI"
+        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\","
+        "\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator\"]"
+        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central"
+        "_meridian\",-178],PARAMETER[\"scale_factor\",1],PARAMETE"
+        "R[\"false_easting\",3500000],PARAMETER[\"false_northing\""
+        ",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHOR"
+        "ITY[\"EPSG\",\"3791\"]]"},
+    {3793, "epsg", 3793,
         "NZGD2000 / Chatham Islands TM 2000", 0, 1,
         "GRS 1980", "Greenwich",
         "New_Zealand_Geodetic_Datum_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-176.5 +k=1 +x_0=3500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NZGD2000 / Chatham Islands TM 2000\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "ZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-176.5],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",3500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 11,
-        "001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"3793\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3794, "epsg", 3794,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-176.5 +k=1 +x_0=3500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NZGD2000 / Chatham Islands TM 2000\",GEOGCS[\"N"
+        "ZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2000\",SPHE"
+        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG"
+        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4167\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-176.5],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",3500000],PARAMETER[\"false_nort"
+        "hing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9"
+        "001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],"
+        "AUTHORITY[\"EPSG\",\"3793\"]]"},
+    {3794, "epsg", 3794,
         "Slovenia 1996 / Slovene National Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "Slovenia_Geodetic_Datum_1996", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Slovenia 1996 / Slovene National Grid\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Slovenia 1996\",DATUM[\"Slovenia_Geodetic_Datum_1996\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6765\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4765\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",15],PARAMETER[\"scale_factor\",0.9999]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",-5000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"3794\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3795, "epsg", 3795,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=500000 +y_"
+        "0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"Slovenia 1996 / Slovene National Grid\",GEOGCS["
+        "\"Slovenia 1996\",DATUM[\"Slovenia_Geodetic_Datum_1996\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6765\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4765\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",15],PARAMETER[\"scale_factor\",0.9999]"
+        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n"
+        "orthing\",-5000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"3794\"]]"},
+    {3795, "epsg", 3795,
         "NAD27 / Cuba Norte", 0, 1,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=23 +lat_2=21.7 +lat_0=22.35 +lon_0=-81 ");
-    add_proj4text (p, 1,
-        "+x_0=500000 +y_0=280296.016 +datum=NAD27 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Cuba Norte\",GEOGCS[\"NAD27\",DATUM[\"N");
-    add_srs_wkt (p, 1,
-        "orth_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6378");
-    add_srs_wkt (p, 2,
-        "206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "67\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",22.35],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",-81],PARAMETER[\"standard_parallel_1\",23],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_2\",21.7],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",500000],PARAMETER[\"false_northing\",280296.016");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"3795\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3796, "epsg", 3796,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=23 +lat_2=21.7 +lat_0=22.35 +lon_0=-81 "
+        "+x_0=500000 +y_0=280296.016 +datum=NAD27 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD27 / Cuba Norte\",GEOGCS[\"NAD27\",DATUM[\"N"
+        "orth_American_Datum_1927\",SPHEROID[\"Clarke 1866\",6378"
+        "206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUT"
+        "HORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "67\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAM"
+        "ETER[\"latitude_of_origin\",22.35],PARAMETER[\"central_m"
+        "eridian\",-81],PARAMETER[\"standard_parallel_1\",23],PAR"
+        "AMETER[\"standard_parallel_2\",21.7],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",280296.016"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"3795\"]]"},
+    {3796, "epsg", 3796,
         "NAD27 / Cuba Sur", 0, 1,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=21.3 +lat_2=20.13333333333333 +lat_0=20");
-    add_proj4text (p, 1,
-        ".71666666666667 +lon_0=-76.83333333333333 +x_0=500000 +y");
-    add_proj4text (p, 2,
-        "_0=229126.939 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Cuba Sur\",GEOGCS[\"NAD27\",DATUM[\"Nor");
-    add_srs_wkt (p, 1,
-        "th_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637820");
-    add_srs_wkt (p, 2,
-        "6.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4267");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"latitude_of_origin\",20.7166666666667],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-76.8333333333333],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",21.3],PARAMETER[\"standard_parallel_2\",");
-    add_srs_wkt (p, 10,
-        "20.1333333333333],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_northing\",229126.939],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3796\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3797, "epsg", 3797,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=21.3 +lat_2=20.13333333333333 +lat_0=20"
+        ".71666666666667 +lon_0=-76.83333333333333 +x_0=500000 +y"
+        "_0=229126.939 +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / Cuba Sur\",GEOGCS[\"NAD27\",DATUM[\"Nor"
+        "th_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637820"
+        "6.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHO"
+        "RITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4267"
+        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET"
+        "ER[\"latitude_of_origin\",20.7166666666667],PARAMETER[\""
+        "central_meridian\",-76.8333333333333],PARAMETER[\"standa"
+        "rd_parallel_1\",21.3],PARAMETER[\"standard_parallel_2\","
+        "20.1333333333333],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",229126.939],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A"
+        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3796\"]]"},
+    {3797, "epsg", 3797,
         "NAD27 / MTQ Lambert", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=50 +lat_2=46 +lat_0=44 +lon_0=-70 +x_0=");
-    add_proj4text (p, 1,
-        "800000 +y_0=0 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / MTQ Lambert\",GEOGCS[\"NAD27\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637");
-    add_srs_wkt (p, 2,
-        "8206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "267\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",44],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",-70],PARAMETER[\"standard_parallel_1\",50],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_2\",46],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",800000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3797\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 3798, "epsg", 3798,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=50 +lat_2=46 +lat_0=44 +lon_0=-70 +x_0="
+        "800000 +y_0=0 +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / MTQ Lambert\",GEOGCS[\"NAD27\",DATUM[\""
+        "North_American_Datum_1927\",SPHEROID[\"Clarke 1866\",637"
+        "8206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AU"
+        "THORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "267\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARA"
+        "METER[\"latitude_of_origin\",44],PARAMETER[\"central_mer"
+        "idian\",-70],PARAMETER[\"standard_parallel_1\",50],PARAM"
+        "ETER[\"standard_parallel_2\",46],PARAMETER[\"false_easti"
+        "ng\",800000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3797\"]"
+        "]"},
+    {3798, "epsg", 3798,
         "NAD83 / MTQ Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=50 +lat_2=46 +lat_0=44 +lon_0=-70 +x_0=");
-    add_proj4text (p, 1,
-        "800000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / MTQ Lambert\",GEOGCS[\"NAD83\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",44],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 8,
-        "-70],PARAMETER[\"standard_parallel_1\",50],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_2\",46],PARAMETER[\"false_easting\",800");
-    add_srs_wkt (p, 10,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3798\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3799, "epsg", 3799,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=50 +lat_2=46 +lat_0=44 +lon_0=-70 +x_0="
+        "800000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"NAD83 / MTQ Lambert\",GEOGCS[\"NAD83\",DATUM[\""
+        "North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]],"
+        "PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",44],PARAMETER[\"central_meridian\","
+        "-70],PARAMETER[\"standard_parallel_1\",50],PARAMETER[\"s"
+        "tandard_parallel_2\",46],PARAMETER[\"false_easting\",800"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3798\"]]"},
+    {3799, "epsg", 3799,
         "NAD83(CSRS) / MTQ Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=50 +lat_2=46 +lat_0=44 +lon_0=-70 +x_0=");
-    add_proj4text (p, 1,
-        "800000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / MTQ Lambert\",GEOGCS[\"NAD83(CSRS");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_Conformal");
-    add_srs_wkt (p, 7,
-        "_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-70],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 9,
-        "llel_1\",50],PARAMETER[\"standard_parallel_2\",46],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",800000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"3799\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3800, "epsg", 3800,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=50 +lat_2=46 +lat_0=44 +lon_0=-70 +x_0="
+        "800000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / MTQ Lambert\",GEOGCS[\"NAD83(CSRS"
+        ")\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_Conformal"
+        "_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44],PARAM"
+        "ETER[\"central_meridian\",-70],PARAMETER[\"standard_para"
+        "llel_1\",50],PARAMETER[\"standard_parallel_2\",46],PARAM"
+        "ETER[\"false_easting\",800000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3799\"]]"},
+    {3800, "epsg", 3800,
         "NAD27 / Alberta 3TM ref merid 120 W", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / Alberta 3TM ref merid 120 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C");
-    add_srs_wkt (p, 2,
-        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-120],PARAMETER[\"scale_factor\",0.9999],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"3800\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3801, "epsg", 3801,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0"
+        " +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / Alberta 3TM ref merid 120 W\",GEOGCS[\""
+        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C"
+        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG"
+        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-120],PARAMETER[\"scale_factor\",0.9999],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3800\"]]"},
+    {3801, "epsg", 3801,
         "NAD83 / Alberta 3TM ref merid 120 W", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Alberta 3TM ref merid 120 W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-120],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3801\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3802, "epsg", 3802,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83 / Alberta 3TM ref merid 120 W\",GEOGCS[\""
+        "NAD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-120],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3801\"]]"},
+    {3802, "epsg", 3802,
         "NAD83(CSRS) / Alberta 3TM ref merid 120 W", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 120 W\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614");
-    add_srs_wkt (p, 4,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-120],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"3802\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3812, "epsg", 3812,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-120 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Alberta 3TM ref merid 120 W\",GEO"
+        "GCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Refer"
+        "ence_System\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"614"
+        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",-120],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",0],PARAMET"
+        "ER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"3802\"]]"},
+    {3812, "epsg", 3812,
         "ETRS89 / Belgian Lambert 2008", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49.83333333333334 +lat_2=51.16666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=50.797815 +lon_0=4.359215833333333 +x_0=64932");
-    add_proj4text (p, 2,
-        "8 +y_0=665262 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units");
-    add_proj4text (p, 3,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / Belgian Lambert 2008\",GEOGCS[\"ETRS89");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"European_Terrestrial_Reference_System_1989\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",50.79781");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"central_meridian\",4.35921583333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",49.8333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",51.1666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",649328],PARAMETER[\"false_northing\",665");
-    add_srs_wkt (p, 12,
-        "262],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"3812\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3814, "epsg", 3814,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49.83333333333334 +lat_2=51.16666666666"
+        "666 +lat_0=50.797815 +lon_0=4.359215833333333 +x_0=64932"
+        "8 +y_0=665262 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"ETRS89 / Belgian Lambert 2008\",GEOGCS[\"ETRS89"
+        "\",DATUM[\"European_Terrestrial_Reference_System_1989\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",50.79781"
+        "5],PARAMETER[\"central_meridian\",4.35921583333333],PARA"
+        "METER[\"standard_parallel_1\",49.8333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",51.1666666666667],PARAMETER[\""
+        "false_easting\",649328],PARAMETER[\"false_northing\",665"
+        "262],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3812\"]]"},
+    {3814, "epsg", 3814,
         "NAD83 / Mississippi TM", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0=");
-    add_proj4text (p, 1,
-        "500000 +y_0=1300000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Mississippi TM\",GEOGCS[\"NAD83\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",32.5],PARAMETER[\"central_meridian\",-89");
-    add_srs_wkt (p, 8,
-        ".75],PARAMETER[\"scale_factor\",0.9998335],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1300");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"3814\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3815, "epsg", 3815,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0="
+        "500000 +y_0=1300000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"NAD83 / Mississippi TM\",GEOGCS[\"NAD83\",DATUM"
+        "[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",637"
+        "8137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORI"
+        "TY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",32.5],PARAMETER[\"central_meridian\",-89"
+        ".75],PARAMETER[\"scale_factor\",0.9998335],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1300"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3814\"]]"},
+    {3815, "epsg", 3815,
         "NAD83(HARN) / Mississippi TM", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0=");
-    add_proj4text (p, 1,
-        "500000 +y_0=1300000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Mississippi TM\",GEOGCS[\"NAD83(H");
-    add_srs_wkt (p, 1,
-        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",32.5],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-89.75],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.9998335],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_northing\",1300000],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3815\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3816, "epsg", 3816,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0="
+        "500000 +y_0=1300000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Mississippi TM\",GEOGCS[\"NAD83(H"
+        "ARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",32.5],PARAMETER["
+        "\"central_meridian\",-89.75],PARAMETER[\"scale_factor\","
+        "0.9998335],PARAMETER[\"false_easting\",500000],PARAMETER"
+        "[\"false_northing\",1300000],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3815\"]]"},
+    {3816, "epsg", 3816,
         "NAD83(NSRS2007) / Mississippi TM", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0=");
-    add_proj4text (p, 1,
-        "500000 +y_0=1300000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Mississippi TM\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_");
-    add_srs_wkt (p, 2,
-        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 3,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675");
-    add_srs_wkt (p, 4,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 8,
-        "2.5],PARAMETER[\"central_meridian\",-89.75],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9998335],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",1300000],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3816\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3819, "epsg", 3819,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0="
+        "500000 +y_0=1300000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Mississippi TM\",GEOGCS[\"NAD"
+        "83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference_"
+        "System_2007\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"675"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3"
+        "2.5],PARAMETER[\"central_meridian\",-89.75],PARAMETER[\""
+        "scale_factor\",0.9998335],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",1300000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3816\"]]"},
+    {3819, "epsg", 3819,
         "HD1909", 1, 1,
         "Bessel 1841", "Greenwich",
         "Hungarian_Datum_1909", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=595.48,121.69,515.3");
-    add_proj4text (p, 1,
-        "5,4.115,-2.9383,0.853,-3.408 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"HD1909\",DATUM[\"Hungarian_Datum_1909\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EP");
-    add_srs_wkt (p, 2,
-        "SG\",\"7004\"]],AUTHORITY[\"EPSG\",\"1024\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 3,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 4,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 5,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"3819\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3821, "epsg", 3821,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=595.48,121.69,515.3"
+        "5,4.115,-2.9383,0.853,-3.408 +no_defs",
+        "GEOGCS[\"HD1909\",DATUM[\"Hungarian_Datum_1909\",SPHEROI"
+        "D[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EP"
+        "SG\",\"7004\"]],AUTHORITY[\"EPSG\",\"1024\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS"
+        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY["
+        "\"EPSG\",\"3819\"]]"},
+    {3821, "epsg", 3821,
         "TWD67", 1, 1,
         "GRS 1967 Modified", "Greenwich",
         "Taiwan_Datum_1967", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=aust_SA +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"TWD67\",DATUM[\"Taiwan_Datum_1967\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "GRS 1967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7050\"]],AUTHORITY[\"EPSG\",\"1025\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 3,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 4,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 5,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"3821\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3823, "epsg", 3823,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=aust_SA +no_defs",
+        "GEOGCS[\"TWD67\",DATUM[\"Taiwan_Datum_1967\",SPHEROID[\""
+        "GRS 1967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\""
+        "7050\"]],AUTHORITY[\"EPSG\",\"1025\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati"
+        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3821\"]]"},
+    {3823, "epsg", 3823,
         "TWD97", 1, 1,
         "GRS 1980", "Greenwich",
         "Taiwan_Datum_1997", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"TWD97\",DATUM[\"Taiwan Datum 1997\",ELLIPSOID[");
-    add_srs_wkt (p, 1,
-        "\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\",");
-    add_srs_wkt (p, 2,
-        "1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 3,
-        "32925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude");
-    add_srs_wkt (p, 4,
-        " (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2");
-    add_srs_wkt (p, 6,
-        "],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellip");
-    add_srs_wkt (p, 7,
-        "soidal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]]");
-    add_srs_wkt (p, 8,
-        ",USAGE[SCOPE[\"Geodesy.\"],AREA[\"Taiwan, Republic of Ch");
-    add_srs_wkt (p, 9,
-        "ina - onshore and offshore - Taiwan Island, Penghu (Pesc");
-    add_srs_wkt (p, 10,
-        "adores) Islands.\"],BBOX[17.36,114.32,26.96,123.61]],ID[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",3823]]");
-    p = add_epsg_def_ex (filter, first, last, 3824, "epsg", 3824,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"TWD97\",DATUM[\"Taiwan Datum 1997\",ELLIPSOID["
+        "\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\","
+        "1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.01745"
+        "32925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude"
+        " (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.017453292"
+        "5199433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2"
+        "],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellip"
+        "soidal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]]"
+        ",USAGE[SCOPE[\"Geodesy.\"],AREA[\"Taiwan, Republic of Ch"
+        "ina - onshore and offshore - Taiwan Island, Penghu (Pesc"
+        "adores) Islands.\"],BBOX[17.36,114.32,26.96,123.61]],ID["
+        "\"EPSG\",3823]]"},
+    {3824, "epsg", 3824,
         "TWD97", 1, 1,
         "GRS 1980", "Greenwich",
         "Taiwan_Datum_1997", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"TWD97\",DATUM[\"Taiwan_Datum_1997\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "19\"]],AUTHORITY[\"EPSG\",\"1026\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "3824\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3825, "epsg", 3825,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"TWD97\",DATUM[\"Taiwan_Datum_1997\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"1026\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "3824\"]]"},
+    {3825, "epsg", 3825,
         "TWD97 / TM2 zone 119", 0, 0,
         "GRS 1980", "Greenwich",
         "Taiwan_Datum_1997", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=119 +k=0.9999 +x_0=250000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TWD97 / TM2 zone 119\",GEOGCS[\"TWD97\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Taiwan_Datum_1997\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 2,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"1026\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3824\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",119],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",25000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3825\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3826, "epsg", 3826,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=119 +k=0.9999 +x_0=250000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"TWD97 / TM2 zone 119\",GEOGCS[\"TWD97\",DATUM[\""
+        "Taiwan_Datum_1997\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1026\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3824\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",119],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",25000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3825\"]]"},
+    {3826, "epsg", 3826,
         "TWD97 / TM2 zone 121", 0, 0,
         "GRS 1980", "Greenwich",
         "Taiwan_Datum_1997", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=121 +k=0.9999 +x_0=250000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TWD97 / TM2 zone 121\",GEOGCS[\"TWD97\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Taiwan_Datum_1997\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 2,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"1026\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3824\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",121],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",25000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3826\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3827, "epsg", 3827,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=121 +k=0.9999 +x_0=250000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"TWD97 / TM2 zone 121\",GEOGCS[\"TWD97\",DATUM[\""
+        "Taiwan_Datum_1997\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1026\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3824\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",121],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",25000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"3826\"]]"},
+    {3827, "epsg", 3827,
         "TWD67 / TM2 zone 119", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "Taiwan_Datum_1967", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=119 +k=0.9999 +x_0=250000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=aust_SA +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TWD67 / TM2 zone 119\",GEOGCS[\"TWD67\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Taiwan_Datum_1967\",SPHEROID[\"GRS 1967 Modified\",63781");
-    add_srs_wkt (p, 2,
-        "60,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"1025\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3821\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",119],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9999],PARAMETER[\"false_easting\",250");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3827\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3828, "epsg", 3828,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=119 +k=0.9999 +x_0=250000 +y"
+        "_0=0 +ellps=aust_SA +units=m +no_defs",
+        "PROJCS[\"TWD67 / TM2 zone 119\",GEOGCS[\"TWD67\",DATUM[\""
+        "Taiwan_Datum_1967\",SPHEROID[\"GRS 1967 Modified\",63781"
+        "60,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORITY[\"EPSG"
+        "\",\"1025\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3821\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",119],PARAMETER["
+        "\"scale_factor\",0.9999],PARAMETER[\"false_easting\",250"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3827\"]]"},
+    {3828, "epsg", 3828,
         "TWD67 / TM2 zone 121", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "Taiwan_Datum_1967", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=121 +k=0.9999 +x_0=250000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=aust_SA +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TWD67 / TM2 zone 121\",GEOGCS[\"TWD67\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Taiwan_Datum_1967\",SPHEROID[\"GRS 1967 Modified\",63781");
-    add_srs_wkt (p, 2,
-        "60,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"1025\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3821\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",121],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9999],PARAMETER[\"false_easting\",250");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3828\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3829, "epsg", 3829,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=121 +k=0.9999 +x_0=250000 +y"
+        "_0=0 +ellps=aust_SA +units=m +no_defs",
+        "PROJCS[\"TWD67 / TM2 zone 121\",GEOGCS[\"TWD67\",DATUM[\""
+        "Taiwan_Datum_1967\",SPHEROID[\"GRS 1967 Modified\",63781"
+        "60,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORITY[\"EPSG"
+        "\",\"1025\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3821\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",121],PARAMETER["
+        "\"scale_factor\",0.9999],PARAMETER[\"false_easting\",250"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3828\"]]"},
+    {3829, "epsg", 3829,
         "Hu Tzu Shan 1950 / UTM zone 51N", 0, 0,
         "International 1924", "Greenwich",
         "Hu_Tzu_Shan_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=51 +ellps=intl +towgs84=-637,-549,-203,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hu Tzu Shan 1950 / UTM zone 51N\",GEOGCS[\"Hu T");
-    add_srs_wkt (p, 1,
-        "zu Shan 1950\",DATUM[\"Hu_Tzu_Shan_1950\",SPHEROID[\"Int");
-    add_srs_wkt (p, 2,
-        "ernational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6236\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4236\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",123],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3829\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3832, "epsg", 3832,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=51 +ellps=intl +towgs84=-637,-549,-203,0"
+        ",0,0,0 +units=m +no_defs",
+        "PROJCS[\"Hu Tzu Shan 1950 / UTM zone 51N\",GEOGCS[\"Hu T"
+        "zu Shan 1950\",DATUM[\"Hu_Tzu_Shan_1950\",SPHEROID[\"Int"
+        "ernational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\""
+        "]],AUTHORITY[\"EPSG\",\"6236\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4236\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",123],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3829\"]]"},
+    {3832, "epsg", 3832,
         "WGS 84 / PDC Mercator", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=150 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +u");
-    add_proj4text (p, 1,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / PDC Mercator\",GEOGCS[\"WGS 84\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Merc");
-    add_srs_wkt (p, 6,
-        "ator_1SP\"],PARAMETER[\"central_meridian\",150],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 9,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 10,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3832\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3833, "epsg", 3833,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=150 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"WGS 84 / PDC Mercator\",GEOGCS[\"WGS 84\",DATUM"
+        "[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,"
+        "AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Merc"
+        "ator_1SP\"],PARAMETER[\"central_meridian\",150],PARAMETE"
+        "R[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"3832\"]]"},
+    {3833, "epsg", 3833,
         "Pulkovo 1942(58) / Gauss-Kruger zone 2", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=2500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.8");
-    add_proj4text (p, 2,
-        "44,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / Gauss-Kruger zone 2\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4179\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",9],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",2500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3833\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3834, "epsg", 3834,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=2500000 +y_0=0 +"
+        "ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.8"
+        "44,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / Gauss-Kruger zone 2\",GEOGCS"
+        "[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID"
+        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\""
+        "7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4179\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",9],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa"
+        "lse_easting\",2500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3833\"]]"},
+    {3834, "epsg", 3834,
         "Pulkovo 1942(83) / Gauss-Kruger zone 2", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=2500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / Gauss-Kruger zone 2\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4178\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",9],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",2500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3834\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3835, "epsg", 3835,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=2500000 +y_0=0 +"
+        "ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"Pulkovo 1942(83) / Gauss-Kruger zone 2\",GEOGCS"
+        "[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\",SPHEROID"
+        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\""
+        "7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4178\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",9],PARAMETER[\"scale_factor\",1],PARAMETER[\"fa"
+        "lse_easting\",2500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3834\"]]"},
+    {3835, "epsg", 3835,
         "Pulkovo 1942(83) / Gauss-Kruger zone 3", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=3500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / Gauss-Kruger zone 3\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4178\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",3500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3835\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3836, "epsg", 3836,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=3500000 +y_0=0 "
+        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"Pulkovo 1942(83) / Gauss-Kruger zone 3\",GEOGCS"
+        "[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\",SPHEROID"
+        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\""
+        "7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4178\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",3500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3835\"]]"},
+    {3836, "epsg", 3836,
         "Pulkovo 1942(83) / Gauss-Kruger zone 4", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / Gauss-Kruger zone 4\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4178\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",4500000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3836\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3837, "epsg", 3837,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=4500000 +y_0=0 "
+        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"Pulkovo 1942(83) / Gauss-Kruger zone 4\",GEOGCS"
+        "[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\",SPHEROID"
+        "[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\""
+        "7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4178\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_me"
+        "ridian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"f"
+        "alse_easting\",4500000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"No"
+        "rthing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"3836\"]]"},
+    {3837, "epsg", 3837,
         "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 3", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.8");
-    add_proj4text (p, 2,
-        "44,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 3");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",9],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",3500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"3837\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3838, "epsg", 3838,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=3500000 +y_0=0 +"
+        "ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.8"
+        "44,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 3"
+        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",9],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",3500000],PARAMETER[\"false_northi"
+        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY"
+        "[\"EPSG\",\"3837\"]]"},
+    {3838, "epsg", 3838,
         "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 4", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 4");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",12],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",4500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"3838\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3839, "epsg", 3839,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=1 +x_0=4500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 4"
+        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",12],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",4500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"3838\"]]"},
+    {3839, "epsg", 3839,
         "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 9", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=9500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0.");
-    add_proj4text (p, 2,
-        "844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 9");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",27],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",9500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"3839\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3840, "epsg", 3840,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=9500000 +y_0=0 "
+        "+ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0."
+        "844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 9"
+        "\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",27],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",9500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"3839\"]]"},
+    {3840, "epsg", 3840,
         "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 10", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=10500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0");
-    add_proj4text (p, 2,
-        ".844,-0.84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 1");
-    add_srs_wkt (p, 1,
-        "0\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",30],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",10500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"3840\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3841, "epsg", 3841,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=10500000 +y_0=0"
+        " +ellps=krass +towgs84=33.4,-146.6,-76.3,-0.359,-0.053,0"
+        ".844,-0.84 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 1"
+        "0\",GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4179\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",30],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",10500000],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORI"
+        "TY[\"EPSG\",\"3840\"]]"},
+    {3841, "epsg", 3841,
         "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 6", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 6");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",18],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",6500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"3841\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3842, "epsg", 3842,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 "
+        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 6"
+        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",18],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",6500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"3841\"]]"},
+    {3842, "epsg", 3842,
         "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 7", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 7");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",21],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",7500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"4417\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3843, "epsg", 3843,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 "
+        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 7"
+        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",21],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",7500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"4417\"]]"},
+    {3843, "epsg", 3843,
         "Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 8", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 8");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",24],PARAMETER[\"scale_factor\",1],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",8500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"4434\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3844, "epsg", 3844,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=1 +x_0=6500000 +y_0=0 "
+        "+ellps=krass +towgs84=26,-121,-78,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"Pulkovo 1942(83) / 3-degree Gauss-Kruger zone 8"
+        "\",GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\""
+        ",SPHEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\""
+        "EPSG\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4178\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"c"
+        "entral_meridian\",24],PARAMETER[\"scale_factor\",1],PARA"
+        "METER[\"false_easting\",8500000],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORIT"
+        "Y[\"EPSG\",\"4434\"]]"},
+    {3844, "epsg", 3844,
         "Pulkovo 1942(58) / Stereo70", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "Oblique_Stereographic", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=46 +lon_0=25 +k=0.99975 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=500000 +ellps=krass +towgs84=2.329,-147.042,-92.08,");
-    add_proj4text (p, 2,
-        "0.309,-0.325,-0.497,5.69 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942(58) / Stereo70\",GEOGCS[\"Pulkovo ");
-    add_srs_wkt (p, 1,
-        "1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID[\"Krassows");
-    add_srs_wkt (p, 2,
-        "ky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "179\"]],PROJECTION[\"Oblique_Stereographic\"],PARAMETER[");
-    add_srs_wkt (p, 7,
-        "\"latitude_of_origin\",46],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",25],PARAMETER[\"scale_factor\",0.99975],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",500000");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"3844\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3845, "epsg", 3845,
+        "Northing", "North", "Easting", "East",
+        "+proj=sterea +lat_0=46 +lon_0=25 +k=0.99975 +x_0=500000 "
+        "+y_0=500000 +ellps=krass +towgs84=2.329,-147.042,-92.08,"
+        "0.309,-0.325,-0.497,5.69 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942(58) / Stereo70\",GEOGCS[\"Pulkovo "
+        "1942(58)\",DATUM[\"Pulkovo_1942_58\",SPHEROID[\"Krassows"
+        "ky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AU"
+        "THORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "179\"]],PROJECTION[\"Oblique_Stereographic\"],PARAMETER["
+        "\"latitude_of_origin\",46],PARAMETER[\"central_meridian\""
+        ",25],PARAMETER[\"scale_factor\",0.99975],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",500000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"3844\"]]"},
+    {3845, "epsg", 3845,
         "SWEREF99 / RT90 7.5 gon V emulation", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.30625 +k=1.000006 +x_0=15");
-    add_proj4text (p, 1,
-        "00025.141 +y_0=-667.282 +ellps=GRS80 +towgs84=0,0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 / RT90 7.5 gon V emulation\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "SWEREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",11.30625");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",1.000006],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",1500025.141],PARAMETER[\"false_northing\",-66");
-    add_srs_wkt (p, 10,
-        "7.282],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"3845\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3846, "epsg", 3846,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=11.30625 +k=1.000006 +x_0=15"
+        "00025.141 +y_0=-667.282 +ellps=GRS80 +towgs84=0,0,0,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 / RT90 7.5 gon V emulation\",GEOGCS[\""
+        "SWEREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",11.30625"
+        "],PARAMETER[\"scale_factor\",1.000006],PARAMETER[\"false"
+        "_easting\",1500025.141],PARAMETER[\"false_northing\",-66"
+        "7.282],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"3845\"]]"},
+    {3846, "epsg", 3846,
         "SWEREF99 / RT90 5 gon V emulation", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.55626666666667 +k=1.00000");
-    add_proj4text (p, 1,
-        "58 +x_0=1500044.695 +y_0=-667.13 +ellps=GRS80 +towgs84=0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 / RT90 5 gon V emulation\",GEOGCS[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",13.556266");
-    add_srs_wkt (p, 8,
-        "6666667],PARAMETER[\"scale_factor\",1.0000058],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",1500044.695],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",-667.13],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"3846\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3847, "epsg", 3847,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=13.55626666666667 +k=1.00000"
+        "58 +x_0=1500044.695 +y_0=-667.13 +ellps=GRS80 +towgs84=0"
+        ",0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 / RT90 5 gon V emulation\",GEOGCS[\"SW"
+        "EREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",13.556266"
+        "6666667],PARAMETER[\"scale_factor\",1.0000058],PARAMETER"
+        "[\"false_easting\",1500044.695],PARAMETER[\"false_northi"
+        "ng\",-667.13],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUT"
+        "HORITY[\"EPSG\",\"3846\"]]"},
+    {3847, "epsg", 3847,
         "SWEREF99 / RT90 2.5 gon V emulation", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.80628452944445 +k=1.00000");
-    add_proj4text (p, 1,
-        "561024 +x_0=1500064.274 +y_0=-667.711 +ellps=GRS80 +towg");
-    add_proj4text (p, 2,
-        "s84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 / RT90 2.5 gon V emulation\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "SWEREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",15.80628");
-    add_srs_wkt (p, 8,
-        "45294444],PARAMETER[\"scale_factor\",1.00000561024],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",1500064.274],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",-667.711],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AUTHORITY[\"EPSG\",\"3847\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3848, "epsg", 3848,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15.80628452944445 +k=1.00000"
+        "561024 +x_0=1500064.274 +y_0=-667.711 +ellps=GRS80 +towg"
+        "s84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 / RT90 2.5 gon V emulation\",GEOGCS[\""
+        "SWEREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",15.80628"
+        "45294444],PARAMETER[\"scale_factor\",1.00000561024],PARA"
+        "METER[\"false_easting\",1500064.274],PARAMETER[\"false_n"
+        "orthing\",-667.711],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"3847\"]]"},
+    {3848, "epsg", 3848,
         "SWEREF99 / RT90 0 gon emulation", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.0563 +k=1.0000054 +x_0=15");
-    add_proj4text (p, 1,
-        "00083.521 +y_0=-668.8440000000001 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 / RT90 0 gon emulation\",GEOGCS[\"SWER");
-    add_srs_wkt (p, 1,
-        "EF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",18.0563],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",1.0000054],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",1500083.521],PARAMETER[\"false_northing\",-668.8");
-    add_srs_wkt (p, 10,
-        "44],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"3848\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3849, "epsg", 3849,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18.0563 +k=1.0000054 +x_0=15"
+        "00083.521 +y_0=-668.8440000000001 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 / RT90 0 gon emulation\",GEOGCS[\"SWER"
+        "EF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",6378137,"
+        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",18.0563],PA"
+        "RAMETER[\"scale_factor\",1.0000054],PARAMETER[\"false_ea"
+        "sting\",1500083.521],PARAMETER[\"false_northing\",-668.8"
+        "44],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"E"
+        "PSG\",\"3848\"]]"},
+    {3849, "epsg", 3849,
         "SWEREF99 / RT90 2.5 gon O emulation", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20.30631666666667 +k=1.00000");
-    add_proj4text (p, 1,
-        "52 +x_0=1500102.765 +y_0=-670.706 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 / RT90 2.5 gon O emulation\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "SWEREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",20.30631");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"scale_factor\",1.0000052],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",1500102.765],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",-670.706],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 11,
-        "01\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"3849\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3850, "epsg", 3850,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=20.30631666666667 +k=1.00000"
+        "52 +x_0=1500102.765 +y_0=-670.706 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 / RT90 2.5 gon O emulation\",GEOGCS[\""
+        "SWEREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",20.30631"
+        "66666667],PARAMETER[\"scale_factor\",1.0000052],PARAMETE"
+        "R[\"false_easting\",1500102.765],PARAMETER[\"false_north"
+        "ing\",-670.706],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90"
+        "01\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],A"
+        "UTHORITY[\"EPSG\",\"3849\"]]"},
+    {3850, "epsg", 3850,
         "SWEREF99 / RT90 5 gon O emulation", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22.55633333333333 +k=1.00000");
-    add_proj4text (p, 1,
-        "49 +x_0=1500121.846 +y_0=-672.557 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SWEREF99 / RT90 5 gon O emulation\",GEOGCS[\"SW");
-    add_srs_wkt (p, 1,
-        "EREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",22.556333");
-    add_srs_wkt (p, 8,
-        "3333333],PARAMETER[\"scale_factor\",1.0000049],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",1500121.846],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",-672.557],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"3850\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3851, "epsg", 3851,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=22.55633333333333 +k=1.00000"
+        "49 +x_0=1500121.846 +y_0=-672.557 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SWEREF99 / RT90 5 gon O emulation\",GEOGCS[\"SW"
+        "EREF99\",DATUM[\"SWEREF99\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6619\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4619\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",22.556333"
+        "3333333],PARAMETER[\"scale_factor\",1.0000049],PARAMETER"
+        "[\"false_easting\",1500121.846],PARAMETER[\"false_northi"
+        "ng\",-672.557],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AU"
+        "THORITY[\"EPSG\",\"3850\"]]"},
+    {3851, "epsg", 3851,
         "NZGD2000 / NZCS2000", 0, 1,
         "GRS 1980", "Greenwich",
         "New_Zealand_Geodetic_Datum_2000", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-37.5 +lat_2=-44.5 +lat_0=-41 +lon_0=17");
-    add_proj4text (p, 1,
-        "3 +x_0=3000000 +y_0=7000000 +ellps=GRS80 +towgs84=0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NZGD2000 / NZCS2000\",GEOGCS[\"NZGD2000\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"New_Zealand_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4167\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",-41],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",173],PARAMETER[\"standard_parallel_1\",-37.5],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_2\",-44.5],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",3000000],PARAMETER[\"false_northing\",70000");
-    add_srs_wkt (p, 11,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"3851\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3852, "epsg", 3852,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=-37.5 +lat_2=-44.5 +lat_0=-41 +lon_0=17"
+        "3 +x_0=3000000 +y_0=7000000 +ellps=GRS80 +towgs84=0,0,0,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NZGD2000 / NZCS2000\",GEOGCS[\"NZGD2000\",DATUM"
+        "[\"New_Zealand_Geodetic_Datum_2000\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6167\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4167\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",-41],PARAMETER[\"central_m"
+        "eridian\",173],PARAMETER[\"standard_parallel_1\",-37.5],"
+        "PARAMETER[\"standard_parallel_2\",-44.5],PARAMETER[\"fal"
+        "se_easting\",3000000],PARAMETER[\"false_northing\",70000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"E"
+        "PSG\",\"3851\"]]"},
+    {3852, "epsg", 3852,
         "RSRGD2000 / DGLC2000", 0, 1,
         "GRS 1980", "Greenwich",
         "Ross_Sea_Region_Geodetic_Datum_2000", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-90 +lon_0=157 +x_0=500000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSRGD2000 / DGLC2000\",GEOGCS[\"RSRGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4764\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",157],PARAMETER[\"standard_parallel_1\",-7");
-    add_srs_wkt (p, 9,
-        "6.6666666666667],PARAMETER[\"standard_parallel_2\",-79.3");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting");
-    add_srs_wkt (p, 13,
-        "\",EAST],AUTHORITY[\"EPSG\",\"3852\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3854, "epsg", 3854,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-90 +lon_0=157 +x_0=500000 +y_0=0 +ellps=GR"
+        "S80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"RSRGD2000 / DGLC2000\",GEOGCS[\"RSRGD2000\",DAT"
+        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4764\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent"
+        "ral_meridian\",157],PARAMETER[\"standard_parallel_1\",-7"
+        "6.6666666666667],PARAMETER[\"standard_parallel_2\",-79.3"
+        "333333333333],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting"
+        "\",EAST],AUTHORITY[\"EPSG\",\"3852\"]]"},
+    {3854, "epsg", 3854,
         "County ST74", 0, 1,
         "GRS 1980", "Greenwich",
         "SWEREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18.05787 +k=0.99999506 +x_0=");
-    add_proj4text (p, 1,
-        "100182.7406 +y_0=-6500620.1207 +ellps=GRS80 +towgs84=0,0");
-    add_proj4text (p, 2,
-        ",0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"County ST74\",GEOGCS[\"SWEREF99\",DATUM[\"SWERE");
-    add_srs_wkt (p, 1,
-        "F99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 6,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"central_meridian\",18.05787],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 8,
-        "or\",0.99999506],PARAMETER[\"false_easting\",100182.7406");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",-6500620.1207],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3854\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3857, "epsg", 3857,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=18.05787 +k=0.99999506 +x_0="
+        "100182.7406 +y_0=-6500620.1207 +ellps=GRS80 +towgs84=0,0"
+        ",0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"County ST74\",GEOGCS[\"SWEREF99\",DATUM[\"SWERE"
+        "F99\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6619\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4619\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET"
+        "ER[\"central_meridian\",18.05787],PARAMETER[\"scale_fact"
+        "or\",0.99999506],PARAMETER[\"false_easting\",100182.7406"
+        "],PARAMETER[\"false_northing\",-6500620.1207],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3854\""
+        "]]"},
+    {3857, "epsg", 3857,
         "WGS 84 / Pseudo-Mercator", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 +lon_0=0.0 ");
-    add_proj4text (p, 1,
-        "+x_0=0.0 +y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Pseudo-Mercator\",GEOGCS[\"WGS 84\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2572235");
-    add_srs_wkt (p, 2,
-        "63,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"63");
-    add_srs_wkt (p, 3,
-        "26\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"M");
-    add_srs_wkt (p, 6,
-        "ercator_1SP\"],PARAMETER[\"central_meridian\",0],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 9,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 10,
-        "ing\",NORTH],EXTENSION[\"PROJ4\",\"+proj=merc +a=6378137");
-    add_srs_wkt (p, 11,
-        " +b=6378137 +lat_ts=0 +lon_0=0 +x_0=0 +y_0=0 +k=1 +units");
-    add_srs_wkt (p, 12,
-        "=m +nadgrids=@null +wktext +no_defs\"],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"3857\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3873, "epsg", 3873,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 +lon_0=0.0 "
+        "+x_0=0.0 +y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext "
+        "+no_defs",
+        "PROJCS[\"WGS 84 / Pseudo-Mercator\",GEOGCS[\"WGS 84\",DA"
+        "TUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.2572235"
+        "63,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"63"
+        "26\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"M"
+        "ercator_1SP\"],PARAMETER[\"central_meridian\",0],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],EXTENSION[\"PROJ4\",\"+proj=merc +a=6378137"
+        " +b=6378137 +lat_ts=0 +lon_0=0 +x_0=0 +y_0=0 +k=1 +units"
+        "=m +nadgrids=@null +wktext +no_defs\"],AUTHORITY[\"EPSG\""
+        ",\"3857\"]]"},
+    {3873, "epsg", 3873,
         "ETRS89 / GK19FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=19 +k=1 +x_0=19500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK19FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",19],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",19500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3873\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3874, "epsg", 3874,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=19 +k=1 +x_0=19500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK19FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",19],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",19500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3873\"]]"},
+    {3874, "epsg", 3874,
         "ETRS89 / GK20FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20 +k=1 +x_0=20500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK20FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",20],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",20500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3874\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3875, "epsg", 3875,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=20 +k=1 +x_0=20500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK20FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",20],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",20500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3874\"]]"},
+    {3875, "epsg", 3875,
         "ETRS89 / GK21FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=21500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK21FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",21500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3875\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3876, "epsg", 3876,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=21500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK21FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",21],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",21500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3875\"]]"},
+    {3876, "epsg", 3876,
         "ETRS89 / GK22FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22 +k=1 +x_0=22500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK22FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",22],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",22500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3876\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3877, "epsg", 3877,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=22 +k=1 +x_0=22500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK22FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",22],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",22500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3876\"]]"},
+    {3877, "epsg", 3877,
         "ETRS89 / GK23FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23 +k=1 +x_0=23500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK23FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",23],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",23500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3877\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3878, "epsg", 3878,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=23 +k=1 +x_0=23500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK23FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",23],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",23500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3877\"]]"},
+    {3878, "epsg", 3878,
         "ETRS89 / GK24FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=24500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK24FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",24],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",24500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3878\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3879, "epsg", 3879,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=24500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK24FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",24],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",24500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3878\"]]"},
+    {3879, "epsg", 3879,
         "ETRS89 / GK25FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=25 +k=1 +x_0=25500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK25FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",25],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",25500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3879\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3880, "epsg", 3880,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=25 +k=1 +x_0=25500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK25FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",25],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",25500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3879\"]]"},
+    {3880, "epsg", 3880,
         "ETRS89 / GK26FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=26 +k=1 +x_0=26500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK26FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",26],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",26500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3880\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3881, "epsg", 3881,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=26 +k=1 +x_0=26500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK26FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",26],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",26500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3880\"]]"},
+    {3881, "epsg", 3881,
         "ETRS89 / GK27FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=27500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK27FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",27500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3881\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3882, "epsg", 3882,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=27500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK27FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",27],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",27500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3881\"]]"},
+    {3882, "epsg", 3882,
         "ETRS89 / GK28FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28 +k=1 +x_0=28500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK28FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",28],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",28500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3882\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3883, "epsg", 3883,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=28 +k=1 +x_0=28500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK28FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",28],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",28500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3882\"]]"},
+    {3883, "epsg", 3883,
         "ETRS89 / GK29FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=29 +k=1 +x_0=29500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK29FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",29],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",29500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3883\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3884, "epsg", 3884,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=29 +k=1 +x_0=29500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK29FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",29],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",29500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3883\"]]"},
+    {3884, "epsg", 3884,
         "ETRS89 / GK30FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=30500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK30FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",30500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3884\"]]");
-}
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=30500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK30FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",30500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3884\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_17 = {
+    epsg_defs_17, sizeof (epsg_defs_17) / sizeof (epsg_defs_17[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3129 +53,1823 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_18 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 3885, "epsg", 3885,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_18[] = {
+    {3885, "epsg", 3885,
         "ETRS89 / GK31FIN", 0, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=31500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / GK31FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu");
-    add_srs_wkt (p, 1,
-        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 8,
-        "ian\",31],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",31500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"3885\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3888, "epsg", 3888,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=31500000 +y_0=0"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / GK31FIN\",GEOGCS[\"ETRS89\",DATUM[\"Eu"
+        "ropean_Terrestrial_Reference_System_1989\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",0],PARAMETER[\"central_merid"
+        "ian\",31],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",31500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"3885\"]]"},
+    {3888, "epsg", 3888,
         "IGRS", 1, 1,
         "GRS 1980", "Greenwich",
         "Iraqi_Geospatial_Reference_System", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"IGRS\",DATUM[\"Iraqi Geospatial Reference Syst");
-    add_srs_wkt (p, 1,
-        "em\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTH");
-    add_srs_wkt (p, 2,
-        "UNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"d");
-    add_srs_wkt (p, 3,
-        "egree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"ge");
-    add_srs_wkt (p, 4,
-        "odetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)");
-    add_srs_wkt (p, 6,
-        "\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 7,
-        "]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNI");
-    add_srs_wkt (p, 8,
-        "T[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Iraq - ");
-    add_srs_wkt (p, 9,
-        "onshore and offshore.\"],BBOX[29.06,38.79,37.39,48.75]],");
-    add_srs_wkt (p, 10,
-        "ID[\"EPSG\",3888]]");
-    p = add_epsg_def_ex (filter, first, last, 3889, "epsg", 3889,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"IGRS\",DATUM[\"Iraqi Geospatial Reference Syst"
+        "em\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTH"
+        "UNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"d"
+        "egree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"ge"
+        "odetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degre"
+        "e\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)"
+        "\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433"
+        "]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNI"
+        "T[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Iraq - "
+        "onshore and offshore.\"],BBOX[29.06,38.79,37.39,48.75]],"
+        "ID[\"EPSG\",3888]]"},
+    {3889, "epsg", 3889,
         "IGRS", 1, 1,
         "GRS 1980", "Greenwich",
         "Iraqi_Geospatial_Reference_System", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGRS\",DATUM[\"Iraqi_Geospatial_Reference_Syste");
-    add_srs_wkt (p, 1,
-        "m\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1029\"]],PRIM");
-    add_srs_wkt (p, 3,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"3889\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3890, "epsg", 3890,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"IGRS\",DATUM[\"Iraqi_Geospatial_Reference_Syste"
+        "m\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1029\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH"
+        "ORITY[\"EPSG\",\"3889\"]]"},
+    {3890, "epsg", 3890,
         "IGRS / UTM zone 37N", 0, 0,
         "GRS 1980", "Greenwich",
         "Iraqi_Geospatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=37 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGRS / UTM zone 37N\",GEOGCS[\"IGRS\",DATUM[\"I");
-    add_srs_wkt (p, 1,
-        "raqi_Geospatial_Reference_System\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"1029\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"38");
-    add_srs_wkt (p, 6,
-        "89\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",39");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"389");
-    add_srs_wkt (p, 12,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3891, "epsg", 3891,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=37 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"IGRS / UTM zone 37N\",GEOGCS[\"IGRS\",DATUM[\"I"
+        "raqi_Geospatial_Reference_System\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"1029\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"38"
+        "89\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",39"
+        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"389"
+        "0\"]]"},
+    {3891, "epsg", 3891,
         "IGRS / UTM zone 38N", 0, 0,
         "GRS 1980", "Greenwich",
         "Iraqi_Geospatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGRS / UTM zone 38N\",GEOGCS[\"IGRS\",DATUM[\"I");
-    add_srs_wkt (p, 1,
-        "raqi_Geospatial_Reference_System\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"1029\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"38");
-    add_srs_wkt (p, 6,
-        "89\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",45");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"389");
-    add_srs_wkt (p, 12,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3892, "epsg", 3892,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=38 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"IGRS / UTM zone 38N\",GEOGCS[\"IGRS\",DATUM[\"I"
+        "raqi_Geospatial_Reference_System\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"1029\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"38"
+        "89\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",45"
+        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"389"
+        "1\"]]"},
+    {3892, "epsg", 3892,
         "IGRS / UTM zone 39N", 0, 0,
         "GRS 1980", "Greenwich",
         "Iraqi_Geospatial_Reference_System", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"IGRS / UTM zone 39N\",GEOGCS[\"IGRS\",DATUM[\"I");
-    add_srs_wkt (p, 1,
-        "raqi_Geospatial_Reference_System\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"1029\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"38");
-    add_srs_wkt (p, 6,
-        "89\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",51");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"389");
-    add_srs_wkt (p, 12,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3893, "epsg", 3893,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=39 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"IGRS / UTM zone 39N\",GEOGCS[\"IGRS\",DATUM[\"I"
+        "raqi_Geospatial_Reference_System\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"1029\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"38"
+        "89\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",51"
+        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"389"
+        "2\"]]"},
+    {3893, "epsg", 3893,
         "ED50 / Iraq National Grid", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.02626833333333 +lon_0=46.5 +k=0.99");
-    add_proj4text (p, 1,
-        "94 +x_0=800000 +y_0=0 +ellps=intl +towgs84=-87,-98,-121,");
-    add_proj4text (p, 2,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / Iraq National Grid\",GEOGCS[\"ED50\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"European_Datum_1950\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",29.0262683333333],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 8,
-        "n\",46.5],PARAMETER[\"scale_factor\",0.9994],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",800000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"3893\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3901, "epsg", 3901,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.02626833333333 +lon_0=46.5 +k=0.99"
+        "94 +x_0=800000 +y_0=0 +ellps=intl +towgs84=-87,-98,-121,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / Iraq National Grid\",GEOGCS[\"ED50\",DAT"
+        "UM[\"European_Datum_1950\",SPHEROID[\"International 1924"
+        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\""
+        "EPSG\",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",29.0262683333333],PARAMETER[\"central_meridia"
+        "n\",46.5],PARAMETER[\"scale_factor\",0.9994],PARAMETER[\""
+        "false_easting\",800000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"3893\"]]"},
+    {3901, "epsg", 3901,
         "KKJ / Finland Uniform Coordinate System", 0, 0,
         "International 1924", "Greenwich",
         "Kartastokoordinaattijarjestelma_1966", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=3500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34");
-    add_proj4text (p, 2,
-        "5,-1.376,1.496 +units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"KKJ / Finland Uniform Coordinate System + N60");
-    add_srs_wkt (p, 1,
-        " height\",PROJCS[\"KKJ / Finland Uniform Coordinate Syst");
-    add_srs_wkt (p, 2,
-        "em\",GEOGCS[\"KKJ\",DATUM[\"Kartastokoordinaattijarjeste");
-    add_srs_wkt (p, 3,
-        "lma_1966\",SPHEROID[\"International 1924\",6378388,297,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6123\"");
-    add_srs_wkt (p, 5,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 6,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 7,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4123\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 8,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"central_meridian\",27],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 10,
-        "or\",1],PARAMETER[\"false_easting\",3500000],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AUTHORITY[\"EPSG\",\"2393\"]],VERT_CS[\"N60 height\",");
-    add_srs_wkt (p, 14,
-        "VERT_DATUM[\"Helsinki 1960\",2005,AUTHORITY[\"EPSG\",\"5");
-    add_srs_wkt (p, 15,
-        "116\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 16,
-        "XIS[\"Gravity-related height\",UP],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 17,
-        "5717\"]],AUTHORITY[\"EPSG\",\"3901\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3902, "epsg", 3902,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=3500000 +y_0=0 "
+        "+ellps=intl +towgs84=-96.062,-82.428,-121.753,4.801,0.34"
+        "5,-1.376,1.496 +units=m +vunits=m +no_defs",
+        "COMPD_CS[\"KKJ / Finland Uniform Coordinate System + N60"
+        " height\",PROJCS[\"KKJ / Finland Uniform Coordinate Syst"
+        "em\",GEOGCS[\"KKJ\",DATUM[\"Kartastokoordinaattijarjeste"
+        "lma_1966\",SPHEROID[\"International 1924\",6378388,297,A"
+        "UTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6123\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4123\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",27],PARAMETER[\"scale_fact"
+        "or\",1],PARAMETER[\"false_easting\",3500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"2393\"]],VERT_CS[\"N60 height\","
+        "VERT_DATUM[\"Helsinki 1960\",2005,AUTHORITY[\"EPSG\",\"5"
+        "116\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Gravity-related height\",UP],AUTHORITY[\"EPSG\",\""
+        "5717\"]],AUTHORITY[\"EPSG\",\"3901\"]]"},
+    {3902, "epsg", 3902,
         "ETRS89 / TM35FIN(N,E)", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 / TM35FIN(N,E) + N60 height\",PROJCS[\"");
-    add_srs_wkt (p, 1,
-        "ETRS89 / TM35FIN(N,E)\",GEOGCS[\"ETRS89\",DATUM[\"Europe");
-    add_srs_wkt (p, 2,
-        "an_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 3,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 7,
-        "\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",27],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "5048\"]],VERT_CS[\"N60 height\",VERT_DATUM[\"Helsinki 19");
-    add_srs_wkt (p, 14,
-        "60\",2005,AUTHORITY[\"EPSG\",\"5116\"]],UNIT[\"metre\",1");
-    add_srs_wkt (p, 15,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related he");
-    add_srs_wkt (p, 16,
-        "ight\",UP],AUTHORITY[\"EPSG\",\"5717\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 17,
-        "G\",\"3902\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3903, "epsg", 3903,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +vunits=m +no_defs",
+        "COMPD_CS[\"ETRS89 / TM35FIN(N,E) + N60 height\",PROJCS[\""
+        "ETRS89 / TM35FIN(N,E)\",GEOGCS[\"ETRS89\",DATUM[\"Europe"
+        "an_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",27],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northi"
+        "ng\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "5048\"]],VERT_CS[\"N60 height\",VERT_DATUM[\"Helsinki 19"
+        "60\",2005,AUTHORITY[\"EPSG\",\"5116\"]],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related he"
+        "ight\",UP],AUTHORITY[\"EPSG\",\"5717\"]],AUTHORITY[\"EPS"
+        "G\",\"3902\"]]"},
+    {3903, "epsg", 3903,
         "ETRS89 / TM35FIN(N,E)", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 / TM35FIN(N,E) + N2000 height\",PROJCS");
-    add_srs_wkt (p, 1,
-        "[\"ETRS89 / TM35FIN(N,E)\",GEOGCS[\"ETRS89\",DATUM[\"Eur");
-    add_srs_wkt (p, 2,
-        "opean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 3,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 4,
-        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 6,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",27],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"5048\"]],VERT_CS[\"N2000 height\",VERT_DATUM[\"N2000\"");
-    add_srs_wkt (p, 14,
-        ",2005,AUTHORITY[\"EPSG\",\"1030\"]],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 15,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related height");
-    add_srs_wkt (p, 16,
-        "\",UP],AUTHORITY[\"EPSG\",\"3900\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 17,
-        "\"3903\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3906, "epsg", 3906,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=35 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +vunits=m +no_defs",
+        "COMPD_CS[\"ETRS89 / TM35FIN(N,E) + N2000 height\",PROJCS"
+        "[\"ETRS89 / TM35FIN(N,E)\",GEOGCS[\"ETRS89\",DATUM[\"Eur"
+        "opean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",27],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"5048\"]],VERT_CS[\"N2000 height\",VERT_DATUM[\"N2000\""
+        ",2005,AUTHORITY[\"EPSG\",\"1030\"]],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related height"
+        "\",UP],AUTHORITY[\"EPSG\",\"3900\"]],AUTHORITY[\"EPSG\","
+        "\"3903\"]]"},
+    {3906, "epsg", 3906,
         "MGI 1901", 1, 1,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=682,-203,480,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MGI 1901\",DATUM[\"MGI_1901\",SPHEROID[\"Bessel");
-    add_srs_wkt (p, 1,
-        " 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"700");
-    add_srs_wkt (p, 2,
-        "4\"]],AUTHORITY[\"EPSG\",\"1031\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "3906\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3907, "epsg", 3907,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=682,-203,480,0,0,0,"
+        "0 +no_defs",
+        "GEOGCS[\"MGI 1901\",DATUM[\"MGI_1901\",SPHEROID[\"Bessel"
+        " 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"700"
+        "4\"]],AUTHORITY[\"EPSG\",\"1031\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "3906\"]]"},
+    {3907, "epsg", 3907,
         "MGI 1901 / Balkans zone 5", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=5500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI 1901 / Balkans zone 5\",GEOGCS[\"MGI 1901\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155");
-    add_srs_wkt (p, 2,
-        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",15],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",5");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8677\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3908, "epsg", 3908,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=5500000 +y"
+        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"MGI 1901 / Balkans zone 5\",GEOGCS[\"MGI 1901\""
+        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155"
+        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E"
+        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",15],PARAMETE"
+        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",5"
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8677\"]]"},
+    {3908, "epsg", 3908,
         "MGI 1901 / Balkans zone 6", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=0.9999 +x_0=6500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI 1901 / Balkans zone 6\",GEOGCS[\"MGI 1901\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155");
-    add_srs_wkt (p, 2,
-        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",18],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",6");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8678\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3909, "epsg", 3909,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=0.9999 +x_0=6500000 +y"
+        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"MGI 1901 / Balkans zone 6\",GEOGCS[\"MGI 1901\""
+        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155"
+        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E"
+        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",18],PARAMETE"
+        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",6"
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8678\"]]"},
+    {3909, "epsg", 3909,
         "MGI 1901 / Balkans zone 7", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=7500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI 1901 / Balkans zone 7\",GEOGCS[\"MGI 1901\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155");
-    add_srs_wkt (p, 2,
-        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",21],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",7");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6316\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3910, "epsg", 3910,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=7500000 +y"
+        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"MGI 1901 / Balkans zone 7\",GEOGCS[\"MGI 1901\""
+        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155"
+        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E"
+        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",21],PARAMETE"
+        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",7"
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6316\"]]"},
+    {3910, "epsg", 3910,
         "MGI 1901 / Balkans zone 8", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=8500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI 1901 / Balkans zone 8\",GEOGCS[\"MGI 1901\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155");
-    add_srs_wkt (p, 2,
-        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",24],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",8");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8679\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3911, "epsg", 3911,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=8500000 +y"
+        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"MGI 1901 / Balkans zone 8\",GEOGCS[\"MGI 1901\""
+        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155"
+        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E"
+        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",24],PARAMETE"
+        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",8"
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8679\"]]"},
+    {3911, "epsg", 3911,
         "MGI 1901 / Slovenia Grid", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI 1901 / Slovenia Grid\",GEOGCS[\"MGI 1901\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155,");
-    add_srs_wkt (p, 2,
-        "299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",15],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9999],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8686\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3912, "epsg", 3912,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=500000 +y_"
+        "0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"MGI 1901 / Slovenia Grid\",GEOGCS[\"MGI 1901\","
+        "DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155,"
+        "299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EP"
+        "SG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",15],PARAMETER["
+        "\"scale_factor\",0.9999],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8686\"]]"},
+    {3912, "epsg", 3912,
         "MGI 1901 / Slovene National Grid", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=-5000000 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +");
-    add_proj4text (p, 2,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI 1901 / Slovene National Grid\",GEOGCS[\"MGI");
-    add_srs_wkt (p, 1,
-        " 1901\",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",15],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 9,
-        "ng\",500000],PARAMETER[\"false_northing\",-5000000],UNIT");
-    add_srs_wkt (p, 10,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 11,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "3912\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3920, "epsg", 3920,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9999 +x_0=500000 +y_"
+        "0=-5000000 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"MGI 1901 / Slovene National Grid\",GEOGCS[\"MGI"
+        " 1901\",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377"
+        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR"
+        "ITY[\"EPSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",15],PA"
+        "RAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_easti"
+        "ng\",500000],PARAMETER[\"false_northing\",-5000000],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "3912\"]]"},
+    {3920, "epsg", 3920,
         "Puerto Rico / UTM zone 20N", 0, 0,
         "Clarke 1866", "Greenwich",
         "Puerto_Rico", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=clrk66 +towgs84=11,72,-101,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Puerto Rico / UTM zone 20N\",GEOGCS[\"Puerto Ri");
-    add_srs_wkt (p, 1,
-        "co\",DATUM[\"Puerto_Rico\",SPHEROID[\"Clarke 1866\",6378");
-    add_srs_wkt (p, 2,
-        "206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6139\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 6,
-        "39\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-6");
-    add_srs_wkt (p, 8,
-        "3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"392");
-    add_srs_wkt (p, 12,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3942, "epsg", 3942,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=clrk66 +towgs84=11,72,-101,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Puerto Rico / UTM zone 20N\",GEOGCS[\"Puerto Ri"
+        "co\",DATUM[\"Puerto_Rico\",SPHEROID[\"Clarke 1866\",6378"
+        "206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUT"
+        "HORITY[\"EPSG\",\"6139\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"41"
+        "39\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",-6"
+        "3],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"392"
+        "0\"]]"},
+    {3942, "epsg", 3942,
         "RGF93 / CC42", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.25 +lat_2=42.75 +lat_0=42 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=1200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC42\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",42],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",41.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",42.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",1200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3942\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3943, "epsg", 3943,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.25 +lat_2=42.75 +lat_0=42 +lon_0=3 +"
+        "x_0=1700000 +y_0=1200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC42\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",42],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",41.25],PARAMETER[\"st"
+        "andard_parallel_2\",42.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",1200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3942\""
+        "]]"},
+    {3943, "epsg", 3943,
         "RGF93 / CC43", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.25 +lat_2=43.75 +lat_0=43 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=2200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC43\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",43],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",42.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",43.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",2200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3943\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3944, "epsg", 3944,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.25 +lat_2=43.75 +lat_0=43 +lon_0=3 +"
+        "x_0=1700000 +y_0=2200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC43\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",43],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",42.25],PARAMETER[\"st"
+        "andard_parallel_2\",43.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",2200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3943\""
+        "]]"},
+    {3944, "epsg", 3944,
         "RGF93 / CC44", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.25 +lat_2=44.75 +lat_0=44 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=3200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC44\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",44],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",43.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",44.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",3200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3944\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3945, "epsg", 3945,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.25 +lat_2=44.75 +lat_0=44 +lon_0=3 +"
+        "x_0=1700000 +y_0=3200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC44\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",44],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",43.25],PARAMETER[\"st"
+        "andard_parallel_2\",44.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",3200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3944\""
+        "]]"},
+    {3945, "epsg", 3945,
         "RGF93 / CC45", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.25 +lat_2=45.75 +lat_0=45 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=4200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC45\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",45],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",44.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",45.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",4200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3945\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3946, "epsg", 3946,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.25 +lat_2=45.75 +lat_0=45 +lon_0=3 +"
+        "x_0=1700000 +y_0=4200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC45\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",45],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",44.25],PARAMETER[\"st"
+        "andard_parallel_2\",45.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",4200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3945\""
+        "]]"},
+    {3946, "epsg", 3946,
         "RGF93 / CC46", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.25 +lat_2=46.75 +lat_0=46 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=5200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC46\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",46],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",45.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",46.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",5200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3946\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3947, "epsg", 3947,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.25 +lat_2=46.75 +lat_0=46 +lon_0=3 +"
+        "x_0=1700000 +y_0=5200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC46\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",46],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",45.25],PARAMETER[\"st"
+        "andard_parallel_2\",46.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",5200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3946\""
+        "]]"},
+    {3947, "epsg", 3947,
         "RGF93 / CC47", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.25 +lat_2=47.75 +lat_0=47 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=6200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC47\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",47],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",46.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",47.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",6200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3947\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3948, "epsg", 3948,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.25 +lat_2=47.75 +lat_0=47 +lon_0=3 +"
+        "x_0=1700000 +y_0=6200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC47\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",47],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",46.25],PARAMETER[\"st"
+        "andard_parallel_2\",47.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",6200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3947\""
+        "]]"},
+    {3948, "epsg", 3948,
         "RGF93 / CC48", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.25 +lat_2=48.75 +lat_0=48 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=7200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC48\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",48],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",47.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",48.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",7200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3948\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3949, "epsg", 3949,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.25 +lat_2=48.75 +lat_0=48 +lon_0=3 +"
+        "x_0=1700000 +y_0=7200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC48\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",48],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",47.25],PARAMETER[\"st"
+        "andard_parallel_2\",48.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",7200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3948\""
+        "]]"},
+    {3949, "epsg", 3949,
         "RGF93 / CC49", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.25 +lat_2=49.75 +lat_0=49 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=8200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC49\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",49],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",48.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",49.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",8200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3949\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3950, "epsg", 3950,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.25 +lat_2=49.75 +lat_0=49 +lon_0=3 +"
+        "x_0=1700000 +y_0=8200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC49\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",49],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",48.25],PARAMETER[\"st"
+        "andard_parallel_2\",49.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",8200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3949\""
+        "]]"},
+    {3950, "epsg", 3950,
         "RGF93 / CC50", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49.25 +lat_2=50.75 +lat_0=50 +lon_0=3 +");
-    add_proj4text (p, 1,
-        "x_0=1700000 +y_0=9200000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGF93 / CC50\",GEOGCS[\"RGF93\",DATUM[\"Reseau_");
-    add_srs_wkt (p, 1,
-        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",50],PARAMETER[\"central_meridian\",3]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",49.25],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_2\",50.75],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "700000],PARAMETER[\"false_northing\",9200000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3950\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 3968, "epsg", 3968,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49.25 +lat_2=50.75 +lat_0=50 +lon_0=3 +"
+        "x_0=1700000 +y_0=9200000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RGF93 / CC50\",GEOGCS[\"RGF93\",DATUM[\"Reseau_"
+        "Geodesique_Francais_1993\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"6171\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4171\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"la"
+        "titude_of_origin\",50],PARAMETER[\"central_meridian\",3]"
+        ",PARAMETER[\"standard_parallel_1\",49.25],PARAMETER[\"st"
+        "andard_parallel_2\",50.75],PARAMETER[\"false_easting\",1"
+        "700000],PARAMETER[\"false_northing\",9200000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3950\""
+        "]]"},
+    {3968, "epsg", 3968,
         "NAD83 / Virginia Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Virginia Lambert\",GEOGCS[\"NAD83\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"latitude_of_origin\",36],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 8,
-        "an\",-79.5],PARAMETER[\"standard_parallel_1\",37],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_2\",39.5],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3968\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3969, "epsg", 3969,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +"
+        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83 / Virginia Lambert\",GEOGCS[\"NAD83\",DAT"
+        "UM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269"
+        "\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMET"
+        "ER[\"latitude_of_origin\",36],PARAMETER[\"central_meridi"
+        "an\",-79.5],PARAMETER[\"standard_parallel_1\",37],PARAME"
+        "TER[\"standard_parallel_2\",39.5],PARAMETER[\"false_east"
+        "ing\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3968\"]]"},
+    {3969, "epsg", 3969,
         "NAD83(HARN) / Virginia Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(HARN) / Virginia Lambert\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-79.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",37],PARAMETER[\"standard_parallel_2\",39.5],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"3969\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3970, "epsg", 3970,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +"
+        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(HARN) / Virginia Lambert\",GEOGCS[\"NAD83"
+        "(HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4152\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36],PARA"
+        "METER[\"central_meridian\",-79.5],PARAMETER[\"standard_p"
+        "arallel_1\",37],PARAMETER[\"standard_parallel_2\",39.5],"
+        "PARAMETER[\"false_easting\",0],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"3969\"]]"},
+    {3970, "epsg", 3970,
         "NAD83(NSRS2007) / Virginia Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(NSRS2007) / Virginia Lambert\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",36],PARAMETER[\"central_meridian\",-79.5],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",37],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",39.5],PARAMETER[\"false_easting\",0],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"3970\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3973, "epsg", 3973,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +"
+        "x_0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(NSRS2007) / Virginia Lambert\",GEOGCS[\"N"
+        "AD83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "759\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4759\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",36],PARAMETER[\"central_meridian\",-79.5],PARAME"
+        "TER[\"standard_parallel_1\",37],PARAMETER[\"standard_par"
+        "allel_2\",39.5],PARAMETER[\"false_easting\",0],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"3970\"]]"},
+    {3973, "epsg", 3973,
         "WGS 84 / NSIDC EASE-Grid 2.0 North", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=90 +lon_0=0 +x_0=0 +y_0=0 +datum=WGS84");
-    add_proj4text (p, 1,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 North\",GEOGCS[\"W");
-    add_srs_wkt (p, 1,
-        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2");
-    add_srs_wkt (p, 2,
-        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_center\",90],PARAMETER[\"longitude_of_center\"");
-    add_srs_wkt (p, 8,
-        ",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 9,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 10,
-        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"6931\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3974, "epsg", 3974,
+        "Easting", "South", "Northing", "South",
+        "+proj=laea +lat_0=90 +lon_0=0 +x_0=0 +y_0=0 +datum=WGS84"
+        " +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 North\",GEOGCS[\"W"
+        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2"
+        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E"
+        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO"
+        "JECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"la"
+        "titude_of_center\",90],PARAMETER[\"longitude_of_center\""
+        ",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHO"
+        "RITY[\"EPSG\",\"6931\"]]"},
+    {3974, "epsg", 3974,
         "WGS 84 / NSIDC EASE-Grid 2.0 South", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=-90 +lon_0=0 +x_0=0 +y_0=0 +datum=WGS8");
-    add_proj4text (p, 1,
-        "4 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 South\",GEOGCS[\"W");
-    add_srs_wkt (p, 1,
-        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2");
-    add_srs_wkt (p, 2,
-        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_center\",-90],PARAMETER[\"longitude_of_center\"");
-    add_srs_wkt (p, 8,
-        ",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 9,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 10,
-        "],AXIS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"6932\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3975, "epsg", 3975,
+        "Easting", "North", "Northing", "North",
+        "+proj=laea +lat_0=-90 +lon_0=0 +x_0=0 +y_0=0 +datum=WGS8"
+        "4 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 South\",GEOGCS[\"W"
+        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2"
+        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E"
+        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO"
+        "JECTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"la"
+        "titude_of_center\",-90],PARAMETER[\"longitude_of_center\""
+        ",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"6932\"]]"},
+    {3975, "epsg", 3975,
         "WGS 84 / NSIDC EASE-Grid 2.0 Global", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Cylindrical_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cea +lon_0=0 +lat_ts=30 +x_0=0 +y_0=0 +datum=WGS84");
-    add_proj4text (p, 1,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 Global\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Cylindrical_Equal_Area\"],PARAMETER[\"standar");
-    add_srs_wkt (p, 7,
-        "d_parallel_1\",30],PARAMETER[\"central_meridian\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 9,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 10,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"6933\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3976, "epsg", 3976,
+        "Easting", "East", "Northing", "North",
+        "+proj=cea +lon_0=0 +lat_ts=30 +x_0=0 +y_0=0 +datum=WGS84"
+        " +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC EASE-Grid 2.0 Global\",GEOGCS[\""
+        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,"
+        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\""
+        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PR"
+        "OJECTION[\"Cylindrical_Equal_Area\"],PARAMETER[\"standar"
+        "d_parallel_1\",30],PARAMETER[\"central_meridian\",0],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"6933\"]]"},
+    {3976, "epsg", 3976,
         "WGS 84 / NSIDC Sea Ice Polar Stereographic South", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-70 +lon_0=0 +k=1 +x_0=0 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NSIDC Sea Ice Polar Stereographic Sout");
-    add_srs_wkt (p, 1,
-        "h\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS ");
-    add_srs_wkt (p, 2,
-        "84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",-70],PARAMETER[\"central_meridia");
-    add_srs_wkt (p, 8,
-        "n\",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 10,
-        "\"]],AXIS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"3976\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3978, "epsg", 3978,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-70 +lon_0=0 +k=1 +x_0=0 "
+        "+y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NSIDC Sea Ice Polar Stereographic Sout"
+        "h\",GEOGCS[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS "
+        "84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]]"
+        ",AUTHORITY[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4326\"]],PROJECTION[\"Polar_Stereographic\"],PARAMETER"
+        "[\"latitude_of_origin\",-70],PARAMETER[\"central_meridia"
+        "n\",0],PARAMETER[\"false_easting\",0],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",NORTH],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"3976\"]]"},
+    {3978, "epsg", 3978,
         "NAD83 / Canada Atlas Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=77 +lat_0=49 +lon_0=-95 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Canada Atlas Lambert\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",49],PARAMETER[\"central_me");
-    add_srs_wkt (p, 8,
-        "ridian\",-95],PARAMETER[\"standard_parallel_1\",49],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_2\",77],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3978\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3979, "epsg", 3979,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=77 +lat_0=49 +lon_0=-95 +x_0="
+        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"NAD83 / Canada Atlas Lambert\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PAR"
+        "AMETER[\"latitude_of_origin\",49],PARAMETER[\"central_me"
+        "ridian\",-95],PARAMETER[\"standard_parallel_1\",49],PARA"
+        "METER[\"standard_parallel_2\",77],PARAMETER[\"false_east"
+        "ing\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3978\"]]"},
+    {3979, "epsg", 3979,
         "NAD83(CSRS) / Canada Atlas Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=77 +lat_0=49 +lon_0=-95 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Canada Atlas Lambert\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "49],PARAMETER[\"central_meridian\",-95],PARAMETER[\"stan");
-    add_srs_wkt (p, 9,
-        "dard_parallel_1\",49],PARAMETER[\"standard_parallel_2\",");
-    add_srs_wkt (p, 10,
-        "77],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"3979\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3985, "epsg", 3985,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=77 +lat_0=49 +lon_0=-95 +x_0="
+        "0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"NAD83(CSRS) / Canada Atlas Lambert\",GEOGCS[\"N"
+        "AD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_Sy"
+        "stem\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "49],PARAMETER[\"central_meridian\",-95],PARAMETER[\"stan"
+        "dard_parallel_1\",49],PARAMETER[\"standard_parallel_2\","
+        "77],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"3979\"]]"},
+    {3985, "epsg", 3985,
         "Katanga 1955 / Katanga Lambert", 0, 0,
         "Clarke 1866", "Greenwich",
         "Katanga_1955", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-6.5 +lat_2=-11.5 +lat_0=9 +lon_0=26 +x");
-    add_proj4text (p, 1,
-        "_0=500000 +y_0=500000 +ellps=clrk66 +towgs84=-103.746,-9");
-    add_proj4text (p, 2,
-        ".614,-255.95,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Katanga 1955 / Katanga Lambert\",GEOGCS[\"Katan");
-    add_srs_wkt (p, 1,
-        "ga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke 1866\"");
-    add_srs_wkt (p, 2,
-        ",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4695\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",26],PARAMETER[\"standard_parallel_1\",-6.5],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_2\",-11.5],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",500000],PARAMETER[\"false_northing\",500000");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"4415\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3986, "epsg", 3986,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=-6.5 +lat_2=-11.5 +lat_0=9 +lon_0=26 +x"
+        "_0=500000 +y_0=500000 +ellps=clrk66 +towgs84=-103.746,-9"
+        ".614,-255.95,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Katanga 1955 / Katanga Lambert\",GEOGCS[\"Katan"
+        "ga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke 1866\""
+        ",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]"
+        "],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4695\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central"
+        "_meridian\",26],PARAMETER[\"standard_parallel_1\",-6.5],"
+        "PARAMETER[\"standard_parallel_2\",-11.5],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",500000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"4415\"]]"},
+    {3986, "epsg", 3986,
         "Katanga 1955 / Katanga Gauss zone A", 0, 0,
         "Clarke 1866", "Greenwich",
         "Katanga_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-9 +lon_0=30 +k=1 +x_0=200000 +y_0=50");
-    add_proj4text (p, 1,
-        "0000 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Katanga 1955 / Katanga Gauss zone A\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 2,
-        "1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",500");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"3986\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3987, "epsg", 3987,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-9 +lon_0=30 +k=1 +x_0=200000 +y_0=50"
+        "0000 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Katanga 1955 / Katanga Gauss zone A\",GEOGCS[\""
+        "Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke "
+        "1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7"
+        "008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central_m"
+        "eridian\",30],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",500"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3986\"]]"},
+    {3987, "epsg", 3987,
         "Katanga 1955 / Katanga Gauss zone B", 0, 0,
         "Clarke 1866", "Greenwich",
         "Katanga_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-9 +lon_0=28 +k=1 +x_0=200000 +y_0=50");
-    add_proj4text (p, 1,
-        "0000 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Katanga 1955 / Katanga Gauss zone B\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 2,
-        "1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",28],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",500");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"3987\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3988, "epsg", 3988,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-9 +lon_0=28 +k=1 +x_0=200000 +y_0=50"
+        "0000 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Katanga 1955 / Katanga Gauss zone B\",GEOGCS[\""
+        "Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke "
+        "1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7"
+        "008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central_m"
+        "eridian\",28],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",500"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3987\"]]"},
+    {3988, "epsg", 3988,
         "Katanga 1955 / Katanga Gauss zone C", 0, 0,
         "Clarke 1866", "Greenwich",
         "Katanga_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-9 +lon_0=26 +k=1 +x_0=200000 +y_0=50");
-    add_proj4text (p, 1,
-        "0000 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Katanga 1955 / Katanga Gauss zone C\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 2,
-        "1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",26],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",500");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"3988\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3989, "epsg", 3989,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-9 +lon_0=26 +k=1 +x_0=200000 +y_0=50"
+        "0000 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Katanga 1955 / Katanga Gauss zone C\",GEOGCS[\""
+        "Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke "
+        "1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7"
+        "008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central_m"
+        "eridian\",26],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",500"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3988\"]]"},
+    {3989, "epsg", 3989,
         "Katanga 1955 / Katanga Gauss zone D", 0, 0,
         "Clarke 1866", "Greenwich",
         "Katanga_1955", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-9 +lon_0=24 +k=1 +x_0=200000 +y_0=50");
-    add_proj4text (p, 1,
-        "0000 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Katanga 1955 / Katanga Gauss zone D\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 2,
-        "1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",24],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",500");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"3989\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3991, "epsg", 3991,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=-9 +lon_0=24 +k=1 +x_0=200000 +y_0=50"
+        "0000 +ellps=clrk66 +towgs84=-103.746,-9.614,-255.95,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Katanga 1955 / Katanga Gauss zone D\",GEOGCS[\""
+        "Katanga 1955\",DATUM[\"Katanga_1955\",SPHEROID[\"Clarke "
+        "1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7"
+        "008\"]],AUTHORITY[\"EPSG\",\"6695\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4695\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-9],PARAMETER[\"central_m"
+        "eridian\",24],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",500"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"3989\"]]"},
+    {3991, "epsg", 3991,
         "Puerto Rico State Plane CS of 1927", 0, 0,
         "Clarke 1866", "Greenwich",
         "Puerto_Rico", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +");
-    add_proj4text (p, 2,
-        "x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +towgs84=11,7");
-    add_proj4text (p, 3,
-        "2,-101,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Puerto Rico State Plane CS of 1927\",GEOGCS[\"P");
-    add_srs_wkt (p, 1,
-        "uerto Rico\",DATUM[\"Puerto_Rico\",SPHEROID[\"Clarke 186");
-    add_srs_wkt (p, 2,
-        "6\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6139\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4139\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",17.8333333333333],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-66.4333333333333],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",18.4333333333333],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",18.0333333333333],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"3991\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3992, "epsg", 3992,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333"
+        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +"
+        "x_0=152400.3048006096 +y_0=0 +ellps=clrk66 +towgs84=11,7"
+        "2,-101,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"Puerto Rico State Plane CS of 1927\",GEOGCS[\"P"
+        "uerto Rico\",DATUM[\"Puerto_Rico\",SPHEROID[\"Clarke 186"
+        "6\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008"
+        "\"]],AUTHORITY[\"EPSG\",\"6139\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4139\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",17.8333333333333],PAR"
+        "AMETER[\"central_meridian\",-66.4333333333333],PARAMETER"
+        "[\"standard_parallel_1\",18.4333333333333],PARAMETER[\"s"
+        "tandard_parallel_2\",18.0333333333333],PARAMETER[\"false"
+        "_easting\",500000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\","
+        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"3991\"]]"},
+    {3992, "epsg", 3992,
         "Puerto Rico / St. Croix", 0, 0,
         "Clarke 1866", "Greenwich",
         "Puerto_Rico", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +");
-    add_proj4text (p, 2,
-        "x_0=152400.3048006096 +y_0=30480.06096012192 +ellps=clrk");
-    add_proj4text (p, 3,
-        "66 +towgs84=11,72,-101,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Puerto Rico / St. Croix\",GEOGCS[\"Puerto Rico\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Puerto_Rico\",SPHEROID[\"Clarke 1866\",6378206.");
-    add_srs_wkt (p, 2,
-        "4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6139\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4139\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",17.8333333333333],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",-66.4333333333333],PARAMETER[\"standard");
-    add_srs_wkt (p, 9,
-        "_parallel_1\",18.4333333333333],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",18.0333333333333],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "500000],PARAMETER[\"false_northing\",100000],UNIT[\"US s");
-    add_srs_wkt (p, 12,
-        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"3992\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3994, "epsg", 3994,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333"
+        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +"
+        "x_0=152400.3048006096 +y_0=30480.06096012192 +ellps=clrk"
+        "66 +towgs84=11,72,-101,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"Puerto Rico / St. Croix\",GEOGCS[\"Puerto Rico\""
+        ",DATUM[\"Puerto_Rico\",SPHEROID[\"Clarke 1866\",6378206."
+        "4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHORI"
+        "TY[\"EPSG\",\"6139\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4139\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER"
+        "[\"latitude_of_origin\",17.8333333333333],PARAMETER[\"ce"
+        "ntral_meridian\",-66.4333333333333],PARAMETER[\"standard"
+        "_parallel_1\",18.4333333333333],PARAMETER[\"standard_par"
+        "allel_2\",18.0333333333333],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",100000],UNIT[\"US s"
+        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"3992\"]]"},
+    {3994, "epsg", 3994,
         "WGS 84 / Mercator 41", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Mercator_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=100 +lat_ts=-41 +x_0=0 +y_0=0 +datum=W");
-    add_proj4text (p, 1,
-        "GS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Mercator 41\",GEOGCS[\"WGS 84\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Merc");
-    add_srs_wkt (p, 6,
-        "ator_2SP\"],PARAMETER[\"standard_parallel_1\",-41],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"central_meridian\",100],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 8,
-        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 9,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 10,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3994\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3995, "epsg", 3995,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=100 +lat_ts=-41 +x_0=0 +y_0=0 +datum=W"
+        "GS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / Mercator 41\",GEOGCS[\"WGS 84\",DATUM["
+        "\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,A"
+        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Merc"
+        "ator_2SP\"],PARAMETER[\"standard_parallel_1\",-41],PARAM"
+        "ETER[\"central_meridian\",100],PARAMETER[\"false_easting"
+        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3994\"]]"},
+    {3995, "epsg", 3995,
         "WGS 84 / Arctic Polar Stereographic", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=90 +lat_ts=71 +lon_0=0 +k=1 +x_0=0 +y");
-    add_proj4text (p, 1,
-        "_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Arctic Polar Stereographic\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Polar_Stereographic\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",71],PARAMETER[\"central_meridian\",0],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 9,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 10,
-        "sting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"3995\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3996, "epsg", 3996,
+        "Easting", "South", "Northing", "South",
+        "+proj=stere +lat_0=90 +lat_ts=71 +lon_0=0 +k=1 +x_0=0 +y"
+        "_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / Arctic Polar Stereographic\",GEOGCS[\""
+        "WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,"
+        "298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\""
+        "EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PR"
+        "OJECTION[\"Polar_Stereographic\"],PARAMETER[\"latitude_o"
+        "f_origin\",71],PARAMETER[\"central_meridian\",0],PARAMET"
+        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHORITY[\"EPSG"
+        "\",\"3995\"]]"},
+    {3996, "epsg", 3996,
         "WGS 84 / IBCAO Polar Stereographic", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "South", "Northing", "South");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=90 +lat_ts=75 +lon_0=0 +k=1 +x_0=0 +y");
-    add_proj4text (p, 1,
-        "_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / IBCAO Polar Stereographic\",GEOGCS[\"W");
-    add_srs_wkt (p, 1,
-        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2");
-    add_srs_wkt (p, 2,
-        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Polar_Stereographic\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",75],PARAMETER[\"central_meridian\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 9,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 10,
-        "ting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"3996\"]]");
-    p = add_epsg_def_ex (filter, first, last, 3997, "epsg", 3997,
+        "Easting", "South", "Northing", "South",
+        "+proj=stere +lat_0=90 +lat_ts=75 +lon_0=0 +k=1 +x_0=0 +y"
+        "_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / IBCAO Polar Stereographic\",GEOGCS[\"W"
+        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2"
+        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E"
+        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO"
+        "JECTION[\"Polar_Stereographic\"],PARAMETER[\"latitude_of"
+        "_origin\",75],PARAMETER[\"central_meridian\",0],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",SOUTH],AXIS[\"Northing\",SOUTH],AUTHORITY[\"EPSG\""
+        ",\"3996\"]]"},
+    {3997, "epsg", 3997,
         "WGS 84 / Dubai Local TM", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=55.33333333333334 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "500000 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Dubai Local TM\",GEOGCS[\"WGS 84\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.25722356");
-    add_srs_wkt (p, 2,
-        "3,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"632");
-    add_srs_wkt (p, 3,
-        "6\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 6,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",55.3333333333333],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3997\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4001, "epsg", 4001,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=55.33333333333334 +k=1 +x_0="
+        "500000 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / Dubai Local TM\",GEOGCS[\"WGS 84\",DAT"
+        "UM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.25722356"
+        "3,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"632"
+        "6\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",55.3333333333333],PARAM"
+        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"3997\"]]"},
+    {4001, "epsg", 4001,
         "Unknown datum based upon the Airy 1830 ellipsoid (deprecated)", 1, 1,
         "Airy 1830", "Greenwich",
         "Not_specified_based_on_Airy_1830_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=airy +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Airy 1830 ellipsoi");
-    add_srs_wkt (p, 1,
-        "d (deprecated)\",DATUM[\"Not_specified_based_on_Airy_183");
-    add_srs_wkt (p, 2,
-        "0_ellipsoid\",SPHEROID[\"Airy 1830\",6377563.396,299.324");
-    add_srs_wkt (p, 3,
-        "9646,AUTHORITY[\"EPSG\",\"7001\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6001\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4001\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4002, "epsg", 4002,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=airy +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Airy 1830 ellipsoi"
+        "d (deprecated)\",DATUM[\"Not_specified_based_on_Airy_183"
+        "0_ellipsoid\",SPHEROID[\"Airy 1830\",6377563.396,299.324"
+        "9646,AUTHORITY[\"EPSG\",\"7001\"]],AUTHORITY[\"EPSG\",\""
+        "6001\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude"
+        "\",EAST],AUTHORITY[\"EPSG\",\"4001\"]]"},
+    {4002, "epsg", 4002,
         "Unknown datum based upon the Airy Modified 1849 ellipsoid (deprecated)", 1, 1,
         "Airy Modified 1849", "Greenwich",
         "Not_specified_based_on_Airy_Modified_1849_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=mod_airy +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Airy Modified 1849");
-    add_srs_wkt (p, 1,
-        " ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on");
-    add_srs_wkt (p, 2,
-        "_Airy_Modified_1849_ellipsoid\",SPHEROID[\"Airy Modified");
-    add_srs_wkt (p, 3,
-        " 1849\",6377340.189,299.3249646,AUTHORITY[\"EPSG\",\"700");
-    add_srs_wkt (p, 4,
-        "2\"]],AUTHORITY[\"EPSG\",\"6002\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4002\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4003, "epsg", 4003,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=mod_airy +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Airy Modified 1849"
+        " ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on"
+        "_Airy_Modified_1849_ellipsoid\",SPHEROID[\"Airy Modified"
+        " 1849\",6377340.189,299.3249646,AUTHORITY[\"EPSG\",\"700"
+        "2\"]],AUTHORITY[\"EPSG\",\"6002\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "4002\"]]"},
+    {4003, "epsg", 4003,
         "Unknown datum based upon the Australian National Spheroid (deprecated)", 1, 1,
         "Australian National Spheroid", "Greenwich",
         "Not_specified_based_on_Australian_National_Spheroid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=aust_SA +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Australian Nationa");
-    add_srs_wkt (p, 1,
-        "l Spheroid (deprecated)\",DATUM[\"Not_specified_based_on");
-    add_srs_wkt (p, 2,
-        "_Australian_National_Spheroid\",SPHEROID[\"Australian Na");
-    add_srs_wkt (p, 3,
-        "tional Spheroid\",6378160,298.25,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 4,
-        "03\"]],AUTHORITY[\"EPSG\",\"6003\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 5,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 6,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 7,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 8,
-        "4003\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4004, "epsg", 4004,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=aust_SA +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Australian Nationa"
+        "l Spheroid (deprecated)\",DATUM[\"Not_specified_based_on"
+        "_Australian_National_Spheroid\",SPHEROID[\"Australian Na"
+        "tional Spheroid\",6378160,298.25,AUTHORITY[\"EPSG\",\"70"
+        "03\"]],AUTHORITY[\"EPSG\",\"6003\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "4003\"]]"},
+    {4004, "epsg", 4004,
         "Unknown datum based upon the Bessel 1841 ellipsoid (deprecated)", 1, 1,
         "Bessel 1841", "Greenwich",
         "Not_specified_based_on_Bessel_1841_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Bessel 1841 ellips");
-    add_srs_wkt (p, 1,
-        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Bessel");
-    add_srs_wkt (p, 2,
-        "_1841_ellipsoid\",SPHEROID[\"Bessel 1841\",6377397.155,2");
-    add_srs_wkt (p, 3,
-        "99.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"6004\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 7,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4004\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4005, "epsg", 4005,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Bessel 1841 ellips"
+        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Bessel"
+        "_1841_ellipsoid\",SPHEROID[\"Bessel 1841\",6377397.155,2"
+        "99.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPS"
+        "G\",\"6004\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon"
+        "gitude\",EAST],AUTHORITY[\"EPSG\",\"4004\"]]"},
+    {4005, "epsg", 4005,
         "Unknown datum based upon the Bessel Modified ellipsoid (deprecated)", 1, 1,
         "Bessel Modified", "Greenwich",
         "Not_specified_based_on_Bessel_Modified_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377492.018 +b=6356173.508712696 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Bessel Modified el");
-    add_srs_wkt (p, 1,
-        "lipsoid (deprecated)\",DATUM[\"Not_specified_based_on_Be");
-    add_srs_wkt (p, 2,
-        "ssel_Modified_ellipsoid\",SPHEROID[\"Bessel Modified\",6");
-    add_srs_wkt (p, 3,
-        "377492.018,299.1528128,AUTHORITY[\"EPSG\",\"7005\"]],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6005\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4005\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4006, "epsg", 4006,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377492.018 +b=6356173.508712696 +no_de"
+        "fs",
+        "GEOGCS[\"Unknown datum based upon the Bessel Modified el"
+        "lipsoid (deprecated)\",DATUM[\"Not_specified_based_on_Be"
+        "ssel_Modified_ellipsoid\",SPHEROID[\"Bessel Modified\",6"
+        "377492.018,299.1528128,AUTHORITY[\"EPSG\",\"7005\"]],AUT"
+        "HORITY[\"EPSG\",\"6005\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH"
+        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4005\"]]"},
+    {4006, "epsg", 4006,
         "Unknown datum based upon the Bessel Namibia ellipsoid (deprecated)", 1, 1,
         "Bessel Namibia (GLM)", "Greenwich",
         "Not_specified_based_on_Bessel_Namibia_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bess_nam +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Bessel Namibia ell");
-    add_srs_wkt (p, 1,
-        "ipsoid (deprecated)\",DATUM[\"Not_specified_based_on_Bes");
-    add_srs_wkt (p, 2,
-        "sel_Namibia_ellipsoid\",SPHEROID[\"Bessel Namibia (GLM)\"");
-    add_srs_wkt (p, 3,
-        ",6377483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"");
-    add_srs_wkt (p, 4,
-        "]],AUTHORITY[\"EPSG\",\"6006\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 6,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"40");
-    add_srs_wkt (p, 8,
-        "06\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4007, "epsg", 4007,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bess_nam +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Bessel Namibia ell"
+        "ipsoid (deprecated)\",DATUM[\"Not_specified_based_on_Bes"
+        "sel_Namibia_ellipsoid\",SPHEROID[\"Bessel Namibia (GLM)\""
+        ",6377483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\""
+        "]],AUTHORITY[\"EPSG\",\"6006\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"40"
+        "06\"]]"},
+    {4007, "epsg", 4007,
         "Unknown datum based upon the Clarke 1858 ellipsoid (deprecated)", 1, 1,
         "Clarke 1858", "Greenwich",
         "Not_specified_based_on_Clarke_1858_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378293.645208759 +b=6356617.987679838 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1858 ellips");
-    add_srs_wkt (p, 1,
-        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Clarke");
-    add_srs_wkt (p, 2,
-        "_1858_ellipsoid\",SPHEROID[\"Clarke 1858\",6378293.64520");
-    add_srs_wkt (p, 3,
-        "876,294.260676369261,AUTHORITY[\"EPSG\",\"7007\"]],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6007\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4007\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4008, "epsg", 4008,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378293.645208759 +b=6356617.987679838 "
+        "+no_defs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1858 ellips"
+        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Clarke"
+        "_1858_ellipsoid\",SPHEROID[\"Clarke 1858\",6378293.64520"
+        "876,294.260676369261,AUTHORITY[\"EPSG\",\"7007\"]],AUTHO"
+        "RITY[\"EPSG\",\"6007\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4007\"]]"},
+    {4008, "epsg", 4008,
         "Unknown datum based upon the Clarke 1866 ellipsoid (deprecated)", 1, 1,
         "Clarke 1866", "Greenwich",
         "Not_specified_based_on_Clarke_1866_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1866 ellips");
-    add_srs_wkt (p, 1,
-        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Clarke");
-    add_srs_wkt (p, 2,
-        "_1866_ellipsoid\",SPHEROID[\"Clarke 1866\",6378206.4,294");
-    add_srs_wkt (p, 3,
-        ".978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"6008\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4008\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4009, "epsg", 4009,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1866 ellips"
+        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Clarke"
+        "_1866_ellipsoid\",SPHEROID[\"Clarke 1866\",6378206.4,294"
+        ".978698213898,AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\""
+        "EPSG\",\"6008\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\""
+        "Longitude\",EAST],AUTHORITY[\"EPSG\",\"4008\"]]"},
+    {4009, "epsg", 4009,
         "Unknown datum based upon the Clarke 1866 Michigan ellipsoid (deprecated)", 1, 1,
         "Clarke 1866 Michigan", "Greenwich",
         "Not_specified_based_on_Clarke_1866_Michigan_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378450.047548896 +b=6356826.621488444 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1866 Michig");
-    add_srs_wkt (p, 1,
-        "an ellipsoid (deprecated)\",DATUM[\"Not_specified_based_");
-    add_srs_wkt (p, 2,
-        "on_Clarke_1866_Michigan_ellipsoid\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 3,
-        "66 Michigan\",6378450.0475489,294.978697164677,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"7009\"]],AUTHORITY[\"EPSG\",\"6009\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 8,
-        "RITY[\"EPSG\",\"4009\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4010, "epsg", 4010,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378450.047548896 +b=6356826.621488444 "
+        "+no_defs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1866 Michig"
+        "an ellipsoid (deprecated)\",DATUM[\"Not_specified_based_"
+        "on_Clarke_1866_Michigan_ellipsoid\",SPHEROID[\"Clarke 18"
+        "66 Michigan\",6378450.0475489,294.978697164677,AUTHORITY"
+        "[\"EPSG\",\"7009\"]],AUTHORITY[\"EPSG\",\"6009\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"4009\"]]"},
+    {4010, "epsg", 4010,
         "Unknown datum based upon the Clarke 1880 (Benoit) ellipsoid (deprecated)", 1, 1,
         "Clarke 1880 (Benoit)", "Greenwich",
         "Not_specified_based_on_Clarke_1880_Benoit_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378300.789 +b=6356566.435 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (Benoi");
-    add_srs_wkt (p, 1,
-        "t) ellipsoid (deprecated)\",DATUM[\"Not_specified_based_");
-    add_srs_wkt (p, 2,
-        "on_Clarke_1880_Benoit_ellipsoid\",SPHEROID[\"Clarke 1880");
-    add_srs_wkt (p, 3,
-        " (Benoit)\",6378300.789,293.466315538981,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"7010\"]],AUTHORITY[\"EPSG\",\"6010\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 5,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 6,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 7,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 8,
-        "PSG\",\"4010\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4011, "epsg", 4011,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378300.789 +b=6356566.435 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (Benoi"
+        "t) ellipsoid (deprecated)\",DATUM[\"Not_specified_based_"
+        "on_Clarke_1880_Benoit_ellipsoid\",SPHEROID[\"Clarke 1880"
+        " (Benoit)\",6378300.789,293.466315538981,AUTHORITY[\"EPS"
+        "G\",\"7010\"]],AUTHORITY[\"EPSG\",\"6010\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4010\"]]"},
+    {4011, "epsg", 4011,
         "Unknown datum based upon the Clarke 1880 (IGN) ellipsoid (deprecated)", 1, 1,
         "Clarke 1880 (IGN)", "Greenwich",
         "Not_specified_based_on_Clarke_1880_IGN_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (IGN) ");
-    add_srs_wkt (p, 1,
-        "ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on_");
-    add_srs_wkt (p, 2,
-        "Clarke_1880_IGN_ellipsoid\",SPHEROID[\"Clarke 1880 (IGN)");
-    add_srs_wkt (p, 3,
-        "\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"");
-    add_srs_wkt (p, 4,
-        "]],AUTHORITY[\"EPSG\",\"6011\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 6,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"40");
-    add_srs_wkt (p, 8,
-        "11\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4012, "epsg", 4012,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378249.2 +b=6356515 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (IGN) "
+        "ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on_"
+        "Clarke_1880_IGN_ellipsoid\",SPHEROID[\"Clarke 1880 (IGN)"
+        "\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\""
+        "]],AUTHORITY[\"EPSG\",\"6011\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"40"
+        "11\"]]"},
+    {4012, "epsg", 4012,
         "Unknown datum based upon the Clarke 1880 (RGS) ellipsoid (deprecated)", 1, 1,
         "Clarke 1880 (RGS)", "Greenwich",
         "Not_specified_based_on_Clarke_1880_RGS_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (RGS) ");
-    add_srs_wkt (p, 1,
-        "ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on_");
-    add_srs_wkt (p, 2,
-        "Clarke_1880_RGS_ellipsoid\",SPHEROID[\"Clarke 1880 (RGS)");
-    add_srs_wkt (p, 3,
-        "\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"6012\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 6,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 7,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4012\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4013, "epsg", 4013,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk80 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (RGS) "
+        "ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on_"
+        "Clarke_1880_RGS_ellipsoid\",SPHEROID[\"Clarke 1880 (RGS)"
+        "\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUT"
+        "HORITY[\"EPSG\",\"6012\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH"
+        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4012\"]]"},
+    {4013, "epsg", 4013,
         "Unknown datum based upon the Clarke 1880 (Arc) ellipsoid (deprecated)", 1, 1,
         "Clarke 1880 (Arc)", "Greenwich",
         "Not_specified_based_on_Clarke_1880_Arc_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.145 +b=6356514.966398753 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (Arc) ");
-    add_srs_wkt (p, 1,
-        "ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on_");
-    add_srs_wkt (p, 2,
-        "Clarke_1880_Arc_ellipsoid\",SPHEROID[\"Clarke 1880 (Arc)");
-    add_srs_wkt (p, 3,
-        "\",6378249.145,293.4663077,AUTHORITY[\"EPSG\",\"7013\"]]");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"6013\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 5,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 6,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 7,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4013");
-    add_srs_wkt (p, 8,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4014, "epsg", 4014,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378249.145 +b=6356514.966398753 +no_de"
+        "fs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (Arc) "
+        "ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on_"
+        "Clarke_1880_Arc_ellipsoid\",SPHEROID[\"Clarke 1880 (Arc)"
+        "\",6378249.145,293.4663077,AUTHORITY[\"EPSG\",\"7013\"]]"
+        ",AUTHORITY[\"EPSG\",\"6013\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N"
+        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4013"
+        "\"]]"},
+    {4014, "epsg", 4014,
         "Unknown datum based upon the Clarke 1880 (SGA 1922) ellipsoid (deprecated)", 1, 1,
         "Clarke 1880 (SGA 1922)", "Greenwich",
         "Not_specified_based_on_Clarke_1880_SGA_1922_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356514.996941779 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (SGA 1");
-    add_srs_wkt (p, 1,
-        "922) ellipsoid (deprecated)\",DATUM[\"Not_specified_base");
-    add_srs_wkt (p, 2,
-        "d_on_Clarke_1880_SGA_1922_ellipsoid\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 3,
-        "1880 (SGA 1922)\",6378249.2,293.46598,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"7014\"]],AUTHORITY[\"EPSG\",\"6014\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 5,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 6,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 8,
-        "SG\",\"4014\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4015, "epsg", 4015,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378249.2 +b=6356514.996941779 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1880 (SGA 1"
+        "922) ellipsoid (deprecated)\",DATUM[\"Not_specified_base"
+        "d_on_Clarke_1880_SGA_1922_ellipsoid\",SPHEROID[\"Clarke "
+        "1880 (SGA 1922)\",6378249.2,293.46598,AUTHORITY[\"EPSG\""
+        ",\"7014\"]],AUTHORITY[\"EPSG\",\"6014\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L"
+        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP"
+        "SG\",\"4014\"]]"},
+    {4015, "epsg", 4015,
         "Unknown datum based upon the Everest 1830 (1937 Adjustment) ellipsoid (deprecated)", 1, 1,
         "Everest 1830 (1937 Adjustment)", "Greenwich",
         "Not_specified_based_on_Everest_1830_1937_Adjustment_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377276.345 +b=6356075.41314024 +no_def");
-    add_proj4text (p, 1,
-        "s");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Everest 1830 (1937");
-    add_srs_wkt (p, 1,
-        " Adjustment) ellipsoid (deprecated)\",DATUM[\"Not_specif");
-    add_srs_wkt (p, 2,
-        "ied_based_on_Everest_1830_1937_Adjustment_ellipsoid\",SP");
-    add_srs_wkt (p, 3,
-        "HEROID[\"Everest 1830 (1937 Adjustment)\",6377276.345,30");
-    add_srs_wkt (p, 4,
-        "0.8017,AUTHORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"6015\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 6,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 8,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4015\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4016, "epsg", 4016,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377276.345 +b=6356075.41314024 +no_def"
+        "s",
+        "GEOGCS[\"Unknown datum based upon the Everest 1830 (1937"
+        " Adjustment) ellipsoid (deprecated)\",DATUM[\"Not_specif"
+        "ied_based_on_Everest_1830_1937_Adjustment_ellipsoid\",SP"
+        "HEROID[\"Everest 1830 (1937 Adjustment)\",6377276.345,30"
+        "0.8017,AUTHORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\","
+        "\"6015\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu"
+        "de\",EAST],AUTHORITY[\"EPSG\",\"4015\"]]"},
+    {4016, "epsg", 4016,
         "Unknown datum based upon the Everest 1830 (1967 Definition) ellipsoid (deprecated)", 1, 1,
         "Everest 1830 (1967 Definition)", "Greenwich",
         "Not_specified_based_on_Everest_1830_1967_Definition_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=evrstSS +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Everest 1830 (1967");
-    add_srs_wkt (p, 1,
-        " Definition) ellipsoid (deprecated)\",DATUM[\"Not_specif");
-    add_srs_wkt (p, 2,
-        "ied_based_on_Everest_1830_1967_Definition_ellipsoid\",SP");
-    add_srs_wkt (p, 3,
-        "HEROID[\"Everest 1830 (1967 Definition)\",6377298.556,30");
-    add_srs_wkt (p, 4,
-        "0.8017,AUTHORITY[\"EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"6016\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 6,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 7,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 8,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4016\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4017, "epsg", 4017,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=evrstSS +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Everest 1830 (1967"
+        " Definition) ellipsoid (deprecated)\",DATUM[\"Not_specif"
+        "ied_based_on_Everest_1830_1967_Definition_ellipsoid\",SP"
+        "HEROID[\"Everest 1830 (1967 Definition)\",6377298.556,30"
+        "0.8017,AUTHORITY[\"EPSG\",\"7016\"]],AUTHORITY[\"EPSG\","
+        "\"6016\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu"
+        "de\",EAST],AUTHORITY[\"EPSG\",\"4016\"]]"},
+    {4017, "epsg", 4017,
         "MOLDREF99", 1, 1,
         "GRS 1980", "Greenwich",
         "MOLDREF99", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"MOLDREF99\",DATUM[\"MOLDREF99\",ELLIPSOID[\"GR");
-    add_srs_wkt (p, 1,
-        "S 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\",1]]]");
-    add_srs_wkt (p, 2,
-        ",PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 3,
-        "5199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (La");
-    add_srs_wkt (p, 4,
-        "t)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],AN");
-    add_srs_wkt (p, 6,
-        "GLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellipsoid");
-    add_srs_wkt (p, 7,
-        "al height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USA");
-    add_srs_wkt (p, 8,
-        "GE[SCOPE[\"Geodesy.\"],AREA[\"Moldova.\"],BBOX[45.44,26.");
-    add_srs_wkt (p, 9,
-        "63,48.47,30.13]],ID[\"EPSG\",4017]]");
-    p = add_epsg_def_ex (filter, first, last, 4018, "epsg", 4018,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"MOLDREF99\",DATUM[\"MOLDREF99\",ELLIPSOID[\"GR"
+        "S 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\",1]]]"
+        ",PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.017453292"
+        "5199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (La"
+        "t)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.0174532925199"
+        "433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],AN"
+        "GLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellipsoid"
+        "al height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USA"
+        "GE[SCOPE[\"Geodesy.\"],AREA[\"Moldova.\"],BBOX[45.44,26."
+        "63,48.47,30.13]],ID[\"EPSG\",4017]]"},
+    {4018, "epsg", 4018,
         "Unknown datum based upon the Everest 1830 Modified ellipsoid (deprecated)", 1, 1,
         "Everest 1830 Modified", "Greenwich",
         "Not_specified_based_on_Everest_1830_Modified_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377304.063 +b=6356103.038993155 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Everest 1830 Modif");
-    add_srs_wkt (p, 1,
-        "ied ellipsoid (deprecated)\",DATUM[\"Not_specified_based");
-    add_srs_wkt (p, 2,
-        "_on_Everest_1830_Modified_ellipsoid\",SPHEROID[\"Everest");
-    add_srs_wkt (p, 3,
-        " 1830 Modified\",6377304.063,300.8017,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"7018\"]],AUTHORITY[\"EPSG\",\"6018\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 5,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 6,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 8,
-        "SG\",\"4018\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4019, "epsg", 4019,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377304.063 +b=6356103.038993155 +no_de"
+        "fs",
+        "GEOGCS[\"Unknown datum based upon the Everest 1830 Modif"
+        "ied ellipsoid (deprecated)\",DATUM[\"Not_specified_based"
+        "_on_Everest_1830_Modified_ellipsoid\",SPHEROID[\"Everest"
+        " 1830 Modified\",6377304.063,300.8017,AUTHORITY[\"EPSG\""
+        ",\"7018\"]],AUTHORITY[\"EPSG\",\"6018\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L"
+        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP"
+        "SG\",\"4018\"]]"},
+    {4019, "epsg", 4019,
         "Unknown datum based upon the GRS 1980 ellipsoid (deprecated)", 1, 1,
         "GRS 1980", "Greenwich",
         "Not_specified_based_on_GRS_1980_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the GRS 1980 ellipsoid");
-    add_srs_wkt (p, 1,
-        " (deprecated)\",DATUM[\"Not_specified_based_on_GRS_1980_");
-    add_srs_wkt (p, 2,
-        "ellipsoid\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6019\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4019\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4020, "epsg", 4020,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the GRS 1980 ellipsoid"
+        " (deprecated)\",DATUM[\"Not_specified_based_on_GRS_1980_"
+        "ellipsoid\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6019\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"4019\"]]"},
+    {4020, "epsg", 4020,
         "Unknown datum based upon the Helmert 1906 ellipsoid (deprecated)", 1, 1,
         "Helmert 1906", "Greenwich",
         "Not_specified_based_on_Helmert_1906_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=helmert +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Helmert 1906 ellip");
-    add_srs_wkt (p, 1,
-        "soid (deprecated)\",DATUM[\"Not_specified_based_on_Helme");
-    add_srs_wkt (p, 2,
-        "rt_1906_ellipsoid\",SPHEROID[\"Helmert 1906\",6378200,29");
-    add_srs_wkt (p, 3,
-        "8.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "020\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4020\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4021, "epsg", 4021,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=helmert +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Helmert 1906 ellip"
+        "soid (deprecated)\",DATUM[\"Not_specified_based_on_Helme"
+        "rt_1906_ellipsoid\",SPHEROID[\"Helmert 1906\",6378200,29"
+        "8.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"6"
+        "020\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\""
+        ",EAST],AUTHORITY[\"EPSG\",\"4020\"]]"},
+    {4021, "epsg", 4021,
         "Unknown datum based upon the Indonesian National Spheroid (deprecated)", 1, 1,
         "Indonesian National Spheroid", "Greenwich",
         "Not_specified_based_on_Indonesian_National_Spheroid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378160 +b=6356774.50408554 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Indonesian Nationa");
-    add_srs_wkt (p, 1,
-        "l Spheroid (deprecated)\",DATUM[\"Not_specified_based_on");
-    add_srs_wkt (p, 2,
-        "_Indonesian_National_Spheroid\",SPHEROID[\"Indonesian Na");
-    add_srs_wkt (p, 3,
-        "tional Spheroid\",6378160,298.247,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 4,
-        "021\"]],AUTHORITY[\"EPSG\",\"6021\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 5,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 6,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 7,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 8,
-        ",\"4021\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4022, "epsg", 4022,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378160 +b=6356774.50408554 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Indonesian Nationa"
+        "l Spheroid (deprecated)\",DATUM[\"Not_specified_based_on"
+        "_Indonesian_National_Spheroid\",SPHEROID[\"Indonesian Na"
+        "tional Spheroid\",6378160,298.247,AUTHORITY[\"EPSG\",\"7"
+        "021\"]],AUTHORITY[\"EPSG\",\"6021\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit"
+        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\""
+        ",\"4021\"]]"},
+    {4022, "epsg", 4022,
         "Unknown datum based upon the International 1924 ellipsoid (deprecated)", 1, 1,
         "International 1924", "Greenwich",
         "Not_specified_based_on_International_1924_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the International 1924");
-    add_srs_wkt (p, 1,
-        " ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on");
-    add_srs_wkt (p, 2,
-        "_International_1924_ellipsoid\",SPHEROID[\"International");
-    add_srs_wkt (p, 3,
-        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"6022\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 7,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4022\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4023, "epsg", 4023,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +no_defs",
+        "GEOGCS[\"Unknown datum based upon the International 1924"
+        " ellipsoid (deprecated)\",DATUM[\"Not_specified_based_on"
+        "_International_1924_ellipsoid\",SPHEROID[\"International"
+        " 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6022\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A"
+        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4022\"]]"},
+    {4023, "epsg", 4023,
         "MOLDREF99", 1, 1,
         "GRS 1980", "Greenwich",
         "MOLDREF99", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MOLDREF99\",DATUM[\"MOLDREF99\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 1,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 2,
-        "]],AUTHORITY[\"EPSG\",\"1032\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 4,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 5,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"40");
-    add_srs_wkt (p, 6,
-        "23\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4024, "epsg", 4024,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"MOLDREF99\",DATUM[\"MOLDREF99\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1032\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"40"
+        "23\"]]"},
+    {4024, "epsg", 4024,
         "Unknown datum based upon the Krassowsky 1940 ellipsoid (deprecated)", 1, 1,
         "Krassowsky 1940", "Greenwich",
         "Not_specified_based_on_Krassowsky_1940_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Krassowsky 1940 el");
-    add_srs_wkt (p, 1,
-        "lipsoid (deprecated)\",DATUM[\"Not_specified_based_on_Kr");
-    add_srs_wkt (p, 2,
-        "assowsky_1940_ellipsoid\",SPHEROID[\"Krassowsky 1940\",6");
-    add_srs_wkt (p, 3,
-        "378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"6024\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 7,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4024\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4025, "epsg", 4025,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=krass +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Krassowsky 1940 el"
+        "lipsoid (deprecated)\",DATUM[\"Not_specified_based_on_Kr"
+        "assowsky_1940_ellipsoid\",SPHEROID[\"Krassowsky 1940\",6"
+        "378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"E"
+        "PSG\",\"6024\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L"
+        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4024\"]]"},
+    {4025, "epsg", 4025,
         "Unknown datum based upon the NWL 9D ellipsoid (deprecated)", 1, 1,
         "NWL 9D", "Greenwich",
         "Not_specified_based_on_NWL_9D_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS66 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the NWL 9D ellipsoid (");
-    add_srs_wkt (p, 1,
-        "deprecated)\",DATUM[\"Not_specified_based_on_NWL_9D_elli");
-    add_srs_wkt (p, 2,
-        "psoid\",SPHEROID[\"NWL 9D\",6378145,298.25,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7025\"]],AUTHORITY[\"EPSG\",\"6025\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4025\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4026, "epsg", 4026,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS66 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the NWL 9D ellipsoid ("
+        "deprecated)\",DATUM[\"Not_specified_based_on_NWL_9D_elli"
+        "psoid\",SPHEROID[\"NWL 9D\",6378145,298.25,AUTHORITY[\"E"
+        "PSG\",\"7025\"]],AUTHORITY[\"EPSG\",\"6025\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4025\"]]"},
+    {4026, "epsg", 4026,
         "MOLDREF99 / Moldova TM", 0, 1,
         "GRS 1980", "Greenwich",
         "MOLDREF99", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28.4 +k=0.9999400000000001 +");
-    add_proj4text (p, 1,
-        "x_0=200000 +y_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MOLDREF99 / Moldova TM\",GEOGCS[\"MOLDREF99\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"MOLDREF99\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 2,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"1032\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4023\"]],PROJECTIO");
-    add_srs_wkt (p, 6,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 7,
-        "n\",0],PARAMETER[\"central_meridian\",28.4],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.99994],PARAMETER[\"false_easting\",2000");
-    add_srs_wkt (p, 9,
-        "00],PARAMETER[\"false_northing\",-5000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4026\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4027, "epsg", 4027,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=28.4 +k=0.9999400000000001 +"
+        "x_0=200000 +y_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"MOLDREF99 / Moldova TM\",GEOGCS[\"MOLDREF99\",D"
+        "ATUM[\"MOLDREF99\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"1032\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4023\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",0],PARAMETER[\"central_meridian\",28.4],PARAMETER[\""
+        "scale_factor\",0.99994],PARAMETER[\"false_easting\",2000"
+        "00],PARAMETER[\"false_northing\",-5000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"4026\"]]"},
+    {4027, "epsg", 4027,
         "Unknown datum based upon the Plessis 1817 ellipsoid (deprecated)", 1, 1,
         "Plessis 1817", "Greenwich",
         "Not_specified_based_on_Plessis_1817_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6376523 +b=6355862.933255573 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Plessis 1817 ellip");
-    add_srs_wkt (p, 1,
-        "soid (deprecated)\",DATUM[\"Not_specified_based_on_Pless");
-    add_srs_wkt (p, 2,
-        "is_1817_ellipsoid\",SPHEROID[\"Plessis 1817\",6376523,30");
-    add_srs_wkt (p, 3,
-        "8.64,AUTHORITY[\"EPSG\",\"7027\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "6027\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 7,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4027\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4028, "epsg", 4028,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6376523 +b=6355862.933255573 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Plessis 1817 ellip"
+        "soid (deprecated)\",DATUM[\"Not_specified_based_on_Pless"
+        "is_1817_ellipsoid\",SPHEROID[\"Plessis 1817\",6376523,30"
+        "8.64,AUTHORITY[\"EPSG\",\"7027\"]],AUTHORITY[\"EPSG\",\""
+        "6027\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude"
+        "\",EAST],AUTHORITY[\"EPSG\",\"4027\"]]"},
+    {4028, "epsg", 4028,
         "Unknown datum based upon the Struve 1860 ellipsoid (deprecated)", 1, 1,
         "Struve 1860", "Greenwich",
         "Not_specified_based_on_Struve_1860_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378298.3 +b=6356657.142669561 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Struve 1860 ellips");
-    add_srs_wkt (p, 1,
-        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Struve");
-    add_srs_wkt (p, 2,
-        "_1860_ellipsoid\",SPHEROID[\"Struve 1860\",6378298.3,294");
-    add_srs_wkt (p, 3,
-        ".73,AUTHORITY[\"EPSG\",\"7028\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "028\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 7,
-        ",EAST],AUTHORITY[\"EPSG\",\"4028\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4029, "epsg", 4029,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378298.3 +b=6356657.142669561 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Struve 1860 ellips"
+        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Struve"
+        "_1860_ellipsoid\",SPHEROID[\"Struve 1860\",6378298.3,294"
+        ".73,AUTHORITY[\"EPSG\",\"7028\"]],AUTHORITY[\"EPSG\",\"6"
+        "028\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\""
+        ",EAST],AUTHORITY[\"EPSG\",\"4028\"]]"},
+    {4029, "epsg", 4029,
         "Unknown datum based upon the War Office ellipsoid (deprecated)", 1, 1,
         "War Office", "Greenwich",
         "Not_specified_based_on_War_Office_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378300 +b=6356751.689189189 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the War Office ellipso");
-    add_srs_wkt (p, 1,
-        "id (deprecated)\",DATUM[\"Not_specified_based_on_War_Off");
-    add_srs_wkt (p, 2,
-        "ice_ellipsoid\",SPHEROID[\"War Office\",6378300,296,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7029\"]],AUTHORITY[\"EPSG\",\"6029\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4029\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4030, "epsg", 4030,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378300 +b=6356751.689189189 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the War Office ellipso"
+        "id (deprecated)\",DATUM[\"Not_specified_based_on_War_Off"
+        "ice_ellipsoid\",SPHEROID[\"War Office\",6378300,296,AUTH"
+        "ORITY[\"EPSG\",\"7029\"]],AUTHORITY[\"EPSG\",\"6029\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],"
+        "AUTHORITY[\"EPSG\",\"4029\"]]"},
+    {4030, "epsg", 4030,
         "Unknown datum based upon the WGS 84 ellipsoid (deprecated)", 1, 1,
         "WGS 84", "Greenwich",
         "Not_specified_based_on_WGS_84_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the WGS 84 ellipsoid (");
-    add_srs_wkt (p, 1,
-        "deprecated)\",DATUM[\"Not_specified_based_on_WGS_84_elli");
-    add_srs_wkt (p, 2,
-        "psoid\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6030\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 7,
-        "HORITY[\"EPSG\",\"4030\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4031, "epsg", 4031,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the WGS 84 ellipsoid ("
+        "deprecated)\",DATUM[\"Not_specified_based_on_WGS_84_elli"
+        "psoid\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHOR"
+        "ITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6030\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"4030\"]]"},
+    {4031, "epsg", 4031,
         "Unknown datum based upon the GEM 10C ellipsoid (deprecated)", 1, 1,
         "GEM 10C", "Greenwich",
         "Not_specified_based_on_GEM_10C_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the GEM 10C ellipsoid ");
-    add_srs_wkt (p, 1,
-        "(deprecated)\",DATUM[\"Not_specified_based_on_GEM_10C_el");
-    add_srs_wkt (p, 2,
-        "lipsoid\",SPHEROID[\"GEM 10C\",6378137,298.257223563,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7031\"]],AUTHORITY[\"EPSG\",\"6031\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"4031\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4032, "epsg", 4032,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the GEM 10C ellipsoid "
+        "(deprecated)\",DATUM[\"Not_specified_based_on_GEM_10C_el"
+        "lipsoid\",SPHEROID[\"GEM 10C\",6378137,298.257223563,AUT"
+        "HORITY[\"EPSG\",\"7031\"]],AUTHORITY[\"EPSG\",\"6031\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"4031\"]]"},
+    {4032, "epsg", 4032,
         "Unknown datum based upon the OSU86F ellipsoid (deprecated)", 1, 1,
         "OSU86F", "Greenwich",
         "Not_specified_based_on_OSU86F_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378136.2 +b=6356751.516927429 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the OSU86F ellipsoid (");
-    add_srs_wkt (p, 1,
-        "deprecated)\",DATUM[\"Not_specified_based_on_OSU86F_elli");
-    add_srs_wkt (p, 2,
-        "psoid\",SPHEROID[\"OSU86F\",6378136.2,298.257223563,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7032\"]],AUTHORITY[\"EPSG\",\"6032\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4032\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4033, "epsg", 4033,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378136.2 +b=6356751.516927429 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the OSU86F ellipsoid ("
+        "deprecated)\",DATUM[\"Not_specified_based_on_OSU86F_elli"
+        "psoid\",SPHEROID[\"OSU86F\",6378136.2,298.257223563,AUTH"
+        "ORITY[\"EPSG\",\"7032\"]],AUTHORITY[\"EPSG\",\"6032\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],"
+        "AUTHORITY[\"EPSG\",\"4032\"]]"},
+    {4033, "epsg", 4033,
         "Unknown datum based upon the OSU91A ellipsoid (deprecated)", 1, 1,
         "OSU91A", "Greenwich",
         "Not_specified_based_on_OSU91A_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378136.3 +b=6356751.616592146 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the OSU91A ellipsoid (");
-    add_srs_wkt (p, 1,
-        "deprecated)\",DATUM[\"Not_specified_based_on_OSU91A_elli");
-    add_srs_wkt (p, 2,
-        "psoid\",SPHEROID[\"OSU91A\",6378136.3,298.257223563,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7033\"]],AUTHORITY[\"EPSG\",\"6033\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 7,
-        "AUTHORITY[\"EPSG\",\"4033\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4034, "epsg", 4034,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378136.3 +b=6356751.616592146 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the OSU91A ellipsoid ("
+        "deprecated)\",DATUM[\"Not_specified_based_on_OSU91A_elli"
+        "psoid\",SPHEROID[\"OSU91A\",6378136.3,298.257223563,AUTH"
+        "ORITY[\"EPSG\",\"7033\"]],AUTHORITY[\"EPSG\",\"6033\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],"
+        "AUTHORITY[\"EPSG\",\"4033\"]]"},
+    {4034, "epsg", 4034,
         "Unknown datum based upon the Clarke 1880 ellipsoid (deprecated)", 1, 1,
         "Clarke 1880", "Greenwich",
         "Not_specified_based_on_Clarke_1880_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.144808011 +b=6356514.966204134 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Clarke 1880 ellips");
-    add_srs_wkt (p, 1,
-        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Clarke");
-    add_srs_wkt (p, 2,
-        "_1880_ellipsoid\",SPHEROID[\"Clarke 1880\",6378249.14480");
-    add_srs_wkt (p, 3,
-        "801,293.466307655636,AUTHORITY[\"EPSG\",\"7034\"]],AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"6034\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 5,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4034\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4035, "epsg", 4035,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378249.144808011 +b=6356514.966204134 "
+        "+no_defs",
+        "GEOGCS[\"Unknown datum based upon the Clarke 1880 ellips"
+        "oid (deprecated)\",DATUM[\"Not_specified_based_on_Clarke"
+        "_1880_ellipsoid\",SPHEROID[\"Clarke 1880\",6378249.14480"
+        "801,293.466307655636,AUTHORITY[\"EPSG\",\"7034\"]],AUTHO"
+        "RITY[\"EPSG\",\"6034\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4034\"]]"},
+    {4035, "epsg", 4035,
         "Unspecified datum based upon the GRS 1980 Authalic Sphere (deprecated)", 1, 1,
         "GRS 1980 Authalic Sphere", "Greenwich",
         "Not_specified_based_on_GRS_1980_Authalic_Sphere", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6371000 +b=6371000 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unspecified datum based upon the GRS 1980 Autha");
-    add_srs_wkt (p, 1,
-        "lic Sphere (deprecated)\",DATUM[\"Not_specified_based_on");
-    add_srs_wkt (p, 2,
-        "_GRS_1980_Authalic_Sphere\",SPHEROID[\"GRS 1980 Authalic");
-    add_srs_wkt (p, 3,
-        " Sphere\",6371007,0,AUTHORITY[\"EPSG\",\"7048\"]],AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"6047\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 7,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4047\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4036, "epsg", 4036,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6371000 +b=6371000 +no_defs",
+        "GEOGCS[\"Unspecified datum based upon the GRS 1980 Autha"
+        "lic Sphere (deprecated)\",DATUM[\"Not_specified_based_on"
+        "_GRS_1980_Authalic_Sphere\",SPHEROID[\"GRS 1980 Authalic"
+        " Sphere\",6371007,0,AUTHORITY[\"EPSG\",\"7048\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6047\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A"
+        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4047\"]]"},
+    {4036, "epsg", 4036,
         "Unknown datum based upon the GRS 1967 ellipsoid (deprecated)", 1, 1,
         "GRS 1967", "Greenwich",
         "Not_specified_based_on_GRS_1967_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS67 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the GRS 1967 ellipsoid");
-    add_srs_wkt (p, 1,
-        " (deprecated)\",DATUM[\"Not_specified_based_on_GRS_1967_");
-    add_srs_wkt (p, 2,
-        "ellipsoid\",SPHEROID[\"GRS 1967\",6378160,298.247167427,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7036\"]],AUTHORITY[\"EPSG\",\"6036\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 7,
-        "T],AUTHORITY[\"EPSG\",\"4036\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4037, "epsg", 4037,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS67 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the GRS 1967 ellipsoid"
+        " (deprecated)\",DATUM[\"Not_specified_based_on_GRS_1967_"
+        "ellipsoid\",SPHEROID[\"GRS 1967\",6378160,298.247167427,"
+        "AUTHORITY[\"EPSG\",\"7036\"]],AUTHORITY[\"EPSG\",\"6036\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"4036\"]]"},
+    {4037, "epsg", 4037,
         "WGS 84 / TMzn35N", 0, 1,
         "WGS 84", "Greenwich",
         "WGS_1984", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / TMzn35N\",GEOGCS[\"WGS 84\",DATUM[\"WG");
-    add_srs_wkt (p, 1,
-        "S_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]],P");
-    add_srs_wkt (p, 3,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 4,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 5,
-        "\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 6,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"central_meridian\",27],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 8,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"4037\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4038, "epsg", 4038,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=35 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / TMzn35N\",GEOGCS[\"WGS 84\",DATUM[\"WG"
+        "S_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHO"
+        "RITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transver"
+        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAM"
+        "ETER[\"central_meridian\",27],PARAMETER[\"scale_factor\""
+        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"4037\"]]"},
+    {4038, "epsg", 4038,
         "WGS 84 / TMzn36N", 0, 1,
         "WGS 84", "Greenwich",
         "WGS_1984", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / TMzn36N\",GEOGCS[\"WGS 84\",DATUM[\"WG");
-    add_srs_wkt (p, 1,
-        "S_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]],P");
-    add_srs_wkt (p, 3,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 4,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 5,
-        "\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 6,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"central_meridian\",33],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 8,
-        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 11,
-        "T],AUTHORITY[\"EPSG\",\"4038\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4040, "epsg", 4040,
+        "Northing", "North", "Easting", "East",
+        "+proj=utm +zone=36 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / TMzn36N\",GEOGCS[\"WGS 84\",DATUM[\"WG"
+        "S_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHO"
+        "RITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Transver"
+        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAM"
+        "ETER[\"central_meridian\",33],PARAMETER[\"scale_factor\""
+        ",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"4038\"]]"},
+    {4040, "epsg", 4040,
         "RGRDC 2005", 1, 1,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"RGRDC 2005\",DATUM[\"Reseau Geodesique de la R");
-    add_srs_wkt (p, 1,
-        "DC 2005\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,L");
-    add_srs_wkt (p, 2,
-        "ENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNI");
-    add_srs_wkt (p, 3,
-        "T[\"degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS");
-    add_srs_wkt (p, 4,
-        "[\"geodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433]],AXIS[\"geodetic longitude ");
-    add_srs_wkt (p, 6,
-        "(Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 7,
-        "99433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENG");
-    add_srs_wkt (p, 8,
-        "THUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Th");
-    add_srs_wkt (p, 9,
-        "e Democratic Republic of the Congo (Zaire) - south of a ");
-    add_srs_wkt (p, 10,
-        "line through Bandundu, Seke and Pweto - onshore and offs");
-    add_srs_wkt (p, 11,
-        "hore.\"],BBOX[-13.46,11.79,-3.41,29.81]],ID[\"EPSG\",404");
-    add_srs_wkt (p, 12,
-        "0]]");
-    p = add_epsg_def_ex (filter, first, last, 4041, "epsg", 4041,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"RGRDC 2005\",DATUM[\"Reseau Geodesique de la R"
+        "DC 2005\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,L"
+        "ENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNI"
+        "T[\"degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS"
+        "[\"geodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\""
+        "degree\",0.0174532925199433]],AXIS[\"geodetic longitude "
+        "(Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.01745329251"
+        "99433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENG"
+        "THUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Th"
+        "e Democratic Republic of the Congo (Zaire) - south of a "
+        "line through Bandundu, Seke and Pweto - onshore and offs"
+        "hore.\"],BBOX[-13.46,11.79,-3.41,29.81]],ID[\"EPSG\",404"
+        "0]]"},
+    {4041, "epsg", 4041,
         "Unknown datum based upon the Average Terrestrial System 1977 ellipsoid (deprecated)", 1, 1,
         "Average Terrestrial System 1977", "Greenwich",
         "Not_specified_based_on_Average_Terrestrial_System_1977_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378135 +b=6356750.304921594 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Average Terrestria");
-    add_srs_wkt (p, 1,
-        "l System 1977 ellipsoid (deprecated)\",DATUM[\"Not_speci");
-    add_srs_wkt (p, 2,
-        "fied_based_on_Average_Terrestrial_System_1977_ellipsoid\"");
-    add_srs_wkt (p, 3,
-        ",SPHEROID[\"Average Terrestrial System 1977\",6378135,29");
-    add_srs_wkt (p, 4,
-        "8.257,AUTHORITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "6041\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 6,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 8,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4041\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4042, "epsg", 4042,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378135 +b=6356750.304921594 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the Average Terrestria"
+        "l System 1977 ellipsoid (deprecated)\",DATUM[\"Not_speci"
+        "fied_based_on_Average_Terrestrial_System_1977_ellipsoid\""
+        ",SPHEROID[\"Average Terrestrial System 1977\",6378135,29"
+        "8.257,AUTHORITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\",\""
+        "6041\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude"
+        "\",EAST],AUTHORITY[\"EPSG\",\"4041\"]]"},
+    {4042, "epsg", 4042,
         "Unknown datum based upon the Everest (1830 Definition) ellipsoid (deprecated)", 1, 1,
         "Everest (1830 Definition)", "Greenwich",
         "Not_specified_based_on_Everest_1830_Definition_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377299.36559538 +b=6356098.359005156 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Everest (1830 Defi");
-    add_srs_wkt (p, 1,
-        "nition) ellipsoid (deprecated)\",DATUM[\"Not_specified_b");
-    add_srs_wkt (p, 2,
-        "ased_on_Everest_1830_Definition_ellipsoid\",SPHEROID[\"E");
-    add_srs_wkt (p, 3,
-        "verest (1830 Definition)\",6377299.36559538,300.80172554");
-    add_srs_wkt (p, 4,
-        "3355,AUTHORITY[\"EPSG\",\"7042\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "6042\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 6,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 8,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4042\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4043, "epsg", 4043,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377299.36559538 +b=6356098.359005156 +"
+        "no_defs",
+        "GEOGCS[\"Unknown datum based upon the Everest (1830 Defi"
+        "nition) ellipsoid (deprecated)\",DATUM[\"Not_specified_b"
+        "ased_on_Everest_1830_Definition_ellipsoid\",SPHEROID[\"E"
+        "verest (1830 Definition)\",6377299.36559538,300.80172554"
+        "3355,AUTHORITY[\"EPSG\",\"7042\"]],AUTHORITY[\"EPSG\",\""
+        "6042\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude"
+        "\",EAST],AUTHORITY[\"EPSG\",\"4042\"]]"},
+    {4043, "epsg", 4043,
         "Unknown datum based upon the WGS 72 ellipsoid (deprecated)", 1, 1,
         "WGS 72", "Greenwich",
         "Not_specified_based_on_WGS_72_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS72 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the WGS 72 ellipsoid (");
-    add_srs_wkt (p, 1,
-        "deprecated)\",DATUM[\"Not_specified_based_on_WGS_72_elli");
-    add_srs_wkt (p, 2,
-        "psoid\",SPHEROID[\"WGS 72\",6378135,298.26,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7043\"]],AUTHORITY[\"EPSG\",\"6043\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4043\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4044, "epsg", 4044,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS72 +no_defs",
+        "GEOGCS[\"Unknown datum based upon the WGS 72 ellipsoid ("
+        "deprecated)\",DATUM[\"Not_specified_based_on_WGS_72_elli"
+        "psoid\",SPHEROID[\"WGS 72\",6378135,298.26,AUTHORITY[\"E"
+        "PSG\",\"7043\"]],AUTHORITY[\"EPSG\",\"6043\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4043\"]]"},
+    {4044, "epsg", 4044,
         "Unknown datum based upon the Everest 1830 (1962 Definition) ellipsoid (deprecated)", 1, 1,
         "Everest 1830 (1962 Definition)", "Greenwich",
         "Not_specified_based_on_Everest_1830_1962_Definition_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377301.243 +b=6356100.230165384 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Everest 1830 (1962");
-    add_srs_wkt (p, 1,
-        " Definition) ellipsoid (deprecated)\",DATUM[\"Not_specif");
-    add_srs_wkt (p, 2,
-        "ied_based_on_Everest_1830_1962_Definition_ellipsoid\",SP");
-    add_srs_wkt (p, 3,
-        "HEROID[\"Everest 1830 (1962 Definition)\",6377301.243,30");
-    add_srs_wkt (p, 4,
-        "0.8017255,AUTHORITY[\"EPSG\",\"7044\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"6044\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 8,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4044\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4045, "epsg", 4045,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377301.243 +b=6356100.230165384 +no_de"
+        "fs",
+        "GEOGCS[\"Unknown datum based upon the Everest 1830 (1962"
+        " Definition) ellipsoid (deprecated)\",DATUM[\"Not_specif"
+        "ied_based_on_Everest_1830_1962_Definition_ellipsoid\",SP"
+        "HEROID[\"Everest 1830 (1962 Definition)\",6377301.243,30"
+        "0.8017255,AUTHORITY[\"EPSG\",\"7044\"]],AUTHORITY[\"EPSG"
+        "\",\"6044\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long"
+        "itude\",EAST],AUTHORITY[\"EPSG\",\"4044\"]]"},
+    {4045, "epsg", 4045,
         "Unknown datum based upon the Everest 1830 (1975 Definition) ellipsoid (deprecated)", 1, 1,
         "Everest 1830 (1975 Definition)", "Greenwich",
         "Not_specified_based_on_Everest_1830_1975_Definition_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377299.151 +b=6356098.145120132 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unknown datum based upon the Everest 1830 (1975");
-    add_srs_wkt (p, 1,
-        " Definition) ellipsoid (deprecated)\",DATUM[\"Not_specif");
-    add_srs_wkt (p, 2,
-        "ied_based_on_Everest_1830_1975_Definition_ellipsoid\",SP");
-    add_srs_wkt (p, 3,
-        "HEROID[\"Everest 1830 (1975 Definition)\",6377299.151,30");
-    add_srs_wkt (p, 4,
-        "0.8017255,AUTHORITY[\"EPSG\",\"7045\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"6045\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 7,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 8,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"4045\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4046, "epsg", 4046,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377299.151 +b=6356098.145120132 +no_de"
+        "fs",
+        "GEOGCS[\"Unknown datum based upon the Everest 1830 (1975"
+        " Definition) ellipsoid (deprecated)\",DATUM[\"Not_specif"
+        "ied_based_on_Everest_1830_1975_Definition_ellipsoid\",SP"
+        "HEROID[\"Everest 1830 (1975 Definition)\",6377299.151,30"
+        "0.8017255,AUTHORITY[\"EPSG\",\"7045\"]],AUTHORITY[\"EPSG"
+        "\",\"6045\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long"
+        "itude\",EAST],AUTHORITY[\"EPSG\",\"4045\"]]"},
+    {4046, "epsg", 4046,
         "RGRDC 2005", 1, 1,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RGRDC 2005\",DATUM[\"Reseau_Geodesique_de_la_RD");
-    add_srs_wkt (p, 1,
-        "C_2005\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4046\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4047, "epsg", 4047,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"RGRDC 2005\",DATUM[\"Reseau_Geodesique_de_la_RD"
+        "C_2005\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"4046\"]]"},
+    {4047, "epsg", 4047,
         "Unspecified datum based upon the GRS 1980 Authalic Sphere (deprecated)", 1, 1,
         "GRS 1980 Authalic Sphere", "Greenwich",
         "Not_specified_based_on_GRS_1980_Authalic_Sphere", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6371007 +b=6371007 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unspecified datum based upon the GRS 1980 Autha");
-    add_srs_wkt (p, 1,
-        "lic Sphere (deprecated)\",DATUM[\"Not_specified_based_on");
-    add_srs_wkt (p, 2,
-        "_GRS_1980_Authalic_Sphere\",SPHEROID[\"GRS 1980 Authalic");
-    add_srs_wkt (p, 3,
-        " Sphere\",6371007,0,AUTHORITY[\"EPSG\",\"7048\"]],AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"6047\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 7,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4047\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4048, "epsg", 4048,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6371007 +b=6371007 +no_defs",
+        "GEOGCS[\"Unspecified datum based upon the GRS 1980 Autha"
+        "lic Sphere (deprecated)\",DATUM[\"Not_specified_based_on"
+        "_GRS_1980_Authalic_Sphere\",SPHEROID[\"GRS 1980 Authalic"
+        " Sphere\",6371007,0,AUTHORITY[\"EPSG\",\"7048\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6047\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A"
+        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4047\"]]"},
+    {4048, "epsg", 4048,
         "RGRDC 2005 / Congo TM zone 12", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 12\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",12],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4048\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4049, "epsg", 4049,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 12\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",12],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4048\"]]"},
+    {4049, "epsg", 4049,
         "RGRDC 2005 / Congo TM zone 14", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=14 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 14\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",14],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4049\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4050, "epsg", 4050,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=14 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 14\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",14],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4049\"]]"},
+    {4050, "epsg", 4050,
         "RGRDC 2005 / Congo TM zone 16", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 16\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",16],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4050\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4051, "epsg", 4051,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=16 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 16\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",16],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4050\"]]"},
+    {4051, "epsg", 4051,
         "RGRDC 2005 / Congo TM zone 18", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=18 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 18\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",18],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4051\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4052, "epsg", 4052,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=18 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 18\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",18],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4051\"]]"},
+    {4052, "epsg", 4052,
         "Unspecified datum based upon the Clarke 1866 Authalic Sphere (deprecated)", 1, 1,
         "Clarke 1866 Authalic Sphere", "Greenwich",
         "Not_specified_based_on_Clarke_1866_Authalic_Sphere", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6370997 +b=6370997 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unspecified datum based upon the Clarke 1866 Au");
-    add_srs_wkt (p, 1,
-        "thalic Sphere (deprecated)\",DATUM[\"Not_specified_based");
-    add_srs_wkt (p, 2,
-        "_on_Clarke_1866_Authalic_Sphere\",SPHEROID[\"Clarke 1866");
-    add_srs_wkt (p, 3,
-        " Authalic Sphere\",6370997,0,AUTHORITY[\"EPSG\",\"7052\"");
-    add_srs_wkt (p, 4,
-        "]],AUTHORITY[\"EPSG\",\"6052\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 6,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 7,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"40");
-    add_srs_wkt (p, 8,
-        "52\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4053, "epsg", 4053,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6370997 +b=6370997 +no_defs",
+        "GEOGCS[\"Unspecified datum based upon the Clarke 1866 Au"
+        "thalic Sphere (deprecated)\",DATUM[\"Not_specified_based"
+        "_on_Clarke_1866_Authalic_Sphere\",SPHEROID[\"Clarke 1866"
+        " Authalic Sphere\",6370997,0,AUTHORITY[\"EPSG\",\"7052\""
+        "]],AUTHORITY[\"EPSG\",\"6052\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"40"
+        "52\"]]"},
+    {4053, "epsg", 4053,
         "Unspecified datum based upon the International 1924 Authalic Sphere (deprecated)", 1, 1,
         "International 1924 Authalic Sphere", "Greenwich",
         "Not_specified_based_on_International_1924_Authalic_Sphere", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6371228 +b=6371228 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unspecified datum based upon the International ");
-    add_srs_wkt (p, 1,
-        "1924 Authalic Sphere (deprecated)\",DATUM[\"Not_specifie");
-    add_srs_wkt (p, 2,
-        "d_based_on_International_1924_Authalic_Sphere\",SPHEROID");
-    add_srs_wkt (p, 3,
-        "[\"International 1924 Authalic Sphere\",6371228,0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"7057\"]],AUTHORITY[\"EPSG\",\"6053\"]],PR");
-    add_srs_wkt (p, 5,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 6,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 7,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 8,
-        "HORITY[\"EPSG\",\"4053\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4054, "epsg", 4054,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6371228 +b=6371228 +no_defs",
+        "GEOGCS[\"Unspecified datum based upon the International "
+        "1924 Authalic Sphere (deprecated)\",DATUM[\"Not_specifie"
+        "d_based_on_International_1924_Authalic_Sphere\",SPHEROID"
+        "[\"International 1924 Authalic Sphere\",6371228,0,AUTHOR"
+        "ITY[\"EPSG\",\"7057\"]],AUTHORITY[\"EPSG\",\"6053\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"4053\"]]"},
+    {4054, "epsg", 4054,
         "Unspecified datum based upon the Hughes 1980 ellipsoid (deprecated)", 1, 1,
         "Hughes 1980", "Greenwich",
         "Not_specified_based_on_Hughes_1980_ellipsoid", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378273 +b=6356889.449 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Unspecified datum based upon the Hughes 1980 el");
-    add_srs_wkt (p, 1,
-        "lipsoid (deprecated)\",DATUM[\"Not_specified_based_on_Hu");
-    add_srs_wkt (p, 2,
-        "ghes_1980_ellipsoid\",SPHEROID[\"Hughes 1980\",6378273,2");
-    add_srs_wkt (p, 3,
-        "98.279411123064,AUTHORITY[\"EPSG\",\"7058\"]],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6054\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[");
-    add_srs_wkt (p, 7,
-        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4054\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4055, "epsg", 4055,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378273 +b=6356889.449 +no_defs",
+        "GEOGCS[\"Unspecified datum based upon the Hughes 1980 el"
+        "lipsoid (deprecated)\",DATUM[\"Not_specified_based_on_Hu"
+        "ghes_1980_ellipsoid\",SPHEROID[\"Hughes 1980\",6378273,2"
+        "98.279411123064,AUTHORITY[\"EPSG\",\"7058\"]],AUTHORITY["
+        "\"EPSG\",\"6054\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS["
+        "\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4054\"]]"},
+    {4055, "epsg", 4055,
         "Popular Visualisation CRS (deprecated)", 1, 1,
         "Popular Visualisation Sphere", "Greenwich",
         "Popular_Visualisation_Datum", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378137 +b=6378137 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Popular Visualisation CRS (deprecated)\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"Popular_Visualisation_Datum\",SPHEROID[\"Popular Visua");
-    add_srs_wkt (p, 2,
-        "lisation Sphere\",6378137,0,AUTHORITY[\"EPSG\",\"7059\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6055\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 6,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"405");
-    add_srs_wkt (p, 7,
-        "5\"]]");
-}
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378137 +b=6378137 +towgs84=0,0,0,0,0,0"
+        ",0 +no_defs",
+        "GEOGCS[\"Popular Visualisation CRS (deprecated)\",DATUM["
+        "\"Popular_Visualisation_Datum\",SPHEROID[\"Popular Visua"
+        "lisation Sphere\",6378137,0,AUTHORITY[\"EPSG\",\"7059\"]"
+        "],AUTHORITY[\"EPSG\",\"6055\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\","
+        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"405"
+        "5\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_18 = {
+    epsg_defs_18, sizeof (epsg_defs_18) / sizeof (epsg_defs_18[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,2637 +53,1577 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_19 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 4056, "epsg", 4056,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_19[] = {
+    {4056, "epsg", 4056,
         "RGRDC 2005 / Congo TM zone 20", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=20 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 20\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",20],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4056\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4057, "epsg", 4057,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=20 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 20\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",20],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4056\"]]"},
+    {4057, "epsg", 4057,
         "RGRDC 2005 / Congo TM zone 22", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=22 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 22\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",22],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4057\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4058, "epsg", 4058,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=22 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 22\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",22],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4057\"]]"},
+    {4058, "epsg", 4058,
         "RGRDC 2005 / Congo TM zone 24", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 24\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",24],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4058\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4059, "epsg", 4059,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 24\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",24],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4058\"]]"},
+    {4059, "epsg", 4059,
         "RGRDC 2005 / Congo TM zone 26", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=26 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 26\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",26],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4059\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4060, "epsg", 4060,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=26 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 26\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",26],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4059\"]]"},
+    {4060, "epsg", 4060,
         "RGRDC 2005 / Congo TM zone 28", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=28 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / Congo TM zone 28\",GEOGCS[\"RGRDC ");
-    add_srs_wkt (p, 1,
-        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",28],PARAMETER[\"scale_factor\",0.9999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",500000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 11,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"4060\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4061, "epsg", 4061,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=28 +k=0.9999 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RGRDC 2005 / Congo TM zone 28\",GEOGCS[\"RGRDC "
+        "2005\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",28],PARAMETER[\"scale_factor\",0.9999],PARA"
+        "METER[\"false_easting\",500000],PARAMETER[\"false_northi"
+        "ng\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"4060\"]]"},
+    {4061, "epsg", 4061,
         "RGRDC 2005 / UTM zone 33S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / UTM zone 33S\",GEOGCS[\"RGRDC 2005");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",1");
-    add_srs_wkt (p, 10,
-        "0000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"4061\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4062, "epsg", 4062,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGRDC 2005 / UTM zone 33S\",GEOGCS[\"RGRDC 2005"
+        "\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER["
+        "\"false_easting\",500000],PARAMETER[\"false_northing\",1"
+        "0000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"4061\"]]"},
+    {4062, "epsg", 4062,
         "RGRDC 2005 / UTM zone 34S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / UTM zone 34S\",GEOGCS[\"RGRDC 2005");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",21],PARAMETER[\"scale_factor\",0.9996],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",1");
-    add_srs_wkt (p, 10,
-        "0000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"4062\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4063, "epsg", 4063,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=34 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGRDC 2005 / UTM zone 34S\",GEOGCS[\"RGRDC 2005"
+        "\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",21],PARAMETER[\"scale_factor\",0.9996],PARAMETER["
+        "\"false_easting\",500000],PARAMETER[\"false_northing\",1"
+        "0000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"4062\"]]"},
+    {4063, "epsg", 4063,
         "RGRDC 2005 / UTM zone 35S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_de_la_RDC_2005", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGRDC 2005 / UTM zone 35S\",GEOGCS[\"RGRDC 2005");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",27],PARAMETER[\"scale_factor\",0.9996],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",500000],PARAMETER[\"false_northing\",1");
-    add_srs_wkt (p, 10,
-        "0000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"4063\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4071, "epsg", 4071,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=35 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RGRDC 2005 / UTM zone 35S\",GEOGCS[\"RGRDC 2005"
+        "\",DATUM[\"Reseau_Geodesique_de_la_RDC_2005\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"1033\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4046\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",27],PARAMETER[\"scale_factor\",0.9996],PARAMETER["
+        "\"false_easting\",500000],PARAMETER[\"false_northing\",1"
+        "0000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"4063\"]]"},
+    {4071, "epsg", 4071,
         "Chua / UTM zone 23S", 0, 0,
         "International 1924", "Greenwich",
         "Chua", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +south +ellps=intl +towgs84=-143.87,2");
-    add_proj4text (p, 1,
-        "43.37,-33.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Chua / UTM zone 23S\",GEOGCS[\"Chua\",DATUM[\"C");
-    add_srs_wkt (p, 1,
-        "hua\",SPHEROID[\"International 1924\",6378388,297,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6224\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AUTHORITY[\"EPSG\",\"4224\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 6,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET");
-    add_srs_wkt (p, 7,
-        "ER[\"central_meridian\",-45],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 8,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"4071\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4074, "epsg", 4074,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=23 +south +ellps=intl +towgs84=-143.87,2"
+        "43.37,-33.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Chua / UTM zone 23S\",GEOGCS[\"Chua\",DATUM[\"C"
+        "hua\",SPHEROID[\"International 1924\",6378388,297,AUTHOR"
+        "ITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6224\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"4224\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMET"
+        "ER[\"central_meridian\",-45],PARAMETER[\"scale_factor\","
+        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"4071\"]]"},
+    {4074, "epsg", 4074,
         "SREF98", 1, 1,
         "GRS 1980", "Greenwich",
         "Serbian_Reference_Network_1998", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"SREF98\",DATUM[\"Serbian Reference Network 199");
-    add_srs_wkt (p, 1,
-        "8\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU");
-    add_srs_wkt (p, 2,
-        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de");
-    add_srs_wkt (p, 3,
-        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo");
-    add_srs_wkt (p, 4,
-        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\"");
-    add_srs_wkt (p, 6,
-        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[");
-    add_srs_wkt (p, 8,
-        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Serbia in");
-    add_srs_wkt (p, 9,
-        "cluding Vojvodina.\"],BBOX[42.232494354248,18.8170204162");
-    add_srs_wkt (p, 10,
-        "6,46.18111038208,23.004997253418]],ID[\"EPSG\",4074]]");
-    p = add_epsg_def_ex (filter, first, last, 4075, "epsg", 4075,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"SREF98\",DATUM[\"Serbian Reference Network 199"
+        "8\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU"
+        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de"
+        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo"
+        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\""
+        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]"
+        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT["
+        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Serbia in"
+        "cluding Vojvodina.\"],BBOX[42.232494354248,18.8170204162"
+        "6,46.18111038208,23.004997253418]],ID[\"EPSG\",4074]]"},
+    {4075, "epsg", 4075,
         "SREF98", 1, 1,
         "GRS 1980", "Greenwich",
         "Serbian_Reference_Network_1998", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SREF98\",DATUM[\"Serbian_Reference_Network_1998");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1034\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 4,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 5,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 6,
-        "RITY[\"EPSG\",\"4075\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4080, "epsg", 4080,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"SREF98\",DATUM[\"Serbian_Reference_Network_1998"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1034\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"4075\"]]"},
+    {4080, "epsg", 4080,
         "REGCAN95", 1, 1,
         "GRS 1980", "Greenwich",
         "Red_Geodesica_de_Canarias_1995", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"REGCAN95\",DATUM[\"Red Geodesica de Canarias 1");
-    add_srs_wkt (p, 1,
-        "995\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGT");
-    add_srs_wkt (p, 2,
-        "HUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"");
-    add_srs_wkt (p, 3,
-        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g");
-    add_srs_wkt (p, 4,
-        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr");
-    add_srs_wkt (p, 5,
-        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon");
-    add_srs_wkt (p, 6,
-        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 7,
-        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN");
-    add_srs_wkt (p, 8,
-        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Spain ");
-    add_srs_wkt (p, 9,
-        "- Canary Islands onshore and offshore.\"],BBOX[24.6,-21.");
-    add_srs_wkt (p, 10,
-        "93,32.76,-11.75]],ID[\"EPSG\",4080]]");
-    p = add_epsg_def_ex (filter, first, last, 4081, "epsg", 4081,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"REGCAN95\",DATUM[\"Red Geodesica de Canarias 1"
+        "995\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGT"
+        "HUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\""
+        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g"
+        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr"
+        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon"
+        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943"
+        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN"
+        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Spain "
+        "- Canary Islands onshore and offshore.\"],BBOX[24.6,-21."
+        "93,32.76,-11.75]],ID[\"EPSG\",4080]]"},
+    {4081, "epsg", 4081,
         "REGCAN95", 1, 1,
         "GRS 1980", "Greenwich",
         "Red_Geodesica_de_Canarias_1995", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"REGCAN95\",DATUM[\"Red_Geodesica_de_Canarias_19");
-    add_srs_wkt (p, 1,
-        "95\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 2,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1035\"]],PRI");
-    add_srs_wkt (p, 3,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4081\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4082, "epsg", 4082,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"REGCAN95\",DATUM[\"Red_Geodesica_de_Canarias_19"
+        "95\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1035\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH"
+        "ORITY[\"EPSG\",\"4081\"]]"},
+    {4082, "epsg", 4082,
         "REGCAN95 / UTM zone 27N", 0, 0,
         "GRS 1980", "Greenwich",
         "Red_Geodesica_de_Canarias_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=27 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"REGCAN95 / UTM zone 27N\",GEOGCS[\"REGCAN95\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Red_Geodesica_de_Canarias_1995\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"1035\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4081\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-21],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"4082\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4083, "epsg", 4083,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=27 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"REGCAN95 / UTM zone 27N\",GEOGCS[\"REGCAN95\",D"
+        "ATUM[\"Red_Geodesica_de_Canarias_1995\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"1035\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4081\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-21],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"4082\"]]"},
+    {4083, "epsg", 4083,
         "REGCAN95 / UTM zone 28N", 0, 0,
         "GRS 1980", "Greenwich",
         "Red_Geodesica_de_Canarias_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"REGCAN95 / UTM zone 28N\",GEOGCS[\"REGCAN95\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Red_Geodesica_de_Canarias_1995\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"1035\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4081\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"4083\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4087, "epsg", 4087,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"REGCAN95 / UTM zone 28N\",GEOGCS[\"REGCAN95\",D"
+        "ATUM[\"Red_Geodesica_de_Canarias_1995\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"1035\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4081\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"4083\"]]"},
+    {4087, "epsg", 4087,
         "WGS 84 / World Equidistant Cylindrical", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Equirectangular", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=eqc +lat_ts=0 +lat_0=0 +lon_0=0 +x_0=0 +y_0=0 +dat");
-    add_proj4text (p, 1,
-        "um=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / World Equidistant Cylindrical\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781");
-    add_srs_wkt (p, 2,
-        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Equirectangular\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 7,
-        "rallel_1\",0],PARAMETER[\"central_meridian\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 9,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 10,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"4087\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4088, "epsg", 4088,
+        "Easting", "East", "Northing", "North",
+        "+proj=eqc +lat_ts=0 +lat_0=0 +lon_0=0 +x_0=0 +y_0=0 +dat"
+        "um=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / World Equidistant Cylindrical\",GEOGCS"
+        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781"
+        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY"
+        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]]"
+        ",PROJECTION[\"Equirectangular\"],PARAMETER[\"standard_pa"
+        "rallel_1\",0],PARAMETER[\"central_meridian\",0],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"4087\"]]"},
+    {4088, "epsg", 4088,
         "WGS 84 / World Equidistant Cylindrical", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Equirectangular", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=eqc +lat_ts=0 +lat_0=0 +lon_0=0 +x_0=0 +y_0=0 +a=6");
-    add_proj4text (p, 1,
-        "371007 +b=6371007 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / World Equidistant Cylindrical\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781");
-    add_srs_wkt (p, 2,
-        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Equirectangular\"],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 7,
-        "rallel_1\",0],PARAMETER[\"central_meridian\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 9,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 10,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"4087\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4093, "epsg", 4093,
+        "Easting", "East", "Northing", "North",
+        "+proj=eqc +lat_ts=0 +lat_0=0 +lon_0=0 +x_0=0 +y_0=0 +a=6"
+        "371007 +b=6371007 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / World Equidistant Cylindrical\",GEOGCS"
+        "[\"WGS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",63781"
+        "37,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY"
+        "[\"EPSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]]"
+        ",PROJECTION[\"Equirectangular\"],PARAMETER[\"standard_pa"
+        "rallel_1\",0],PARAMETER[\"central_meridian\",0],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"4087\"]]"},
+    {4093, "epsg", 4093,
         "ETRS89 / DKTM1", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.99998 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / DKTM1\",GEOGCS[\"ETRS89\",DATUM[\"Euro");
-    add_srs_wkt (p, 1,
-        "pean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",9],PARAMETER[\"scale_factor\",0.99998],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",200000],PARAMETER[\"false_northing\",-5000");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"4093\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4094, "epsg", 4094,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.99998 +x_0=200000 +y_"
+        "0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"ETRS89 / DKTM1\",GEOGCS[\"ETRS89\",DATUM[\"Euro"
+        "pean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",9],PARAMETER[\"scale_factor\",0.99998],PARAMETER[\"fa"
+        "lse_easting\",200000],PARAMETER[\"false_northing\",-5000"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"4093\"]]"},
+    {4094, "epsg", 4094,
         "ETRS89 / DKTM2", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10 +k=0.99998 +x_0=400000 +y");
-    add_proj4text (p, 1,
-        "_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / DKTM2\",GEOGCS[\"ETRS89\",DATUM[\"Euro");
-    add_srs_wkt (p, 1,
-        "pean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",10],PARAMETER[\"scale_factor\",0.99998],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",400000],PARAMETER[\"false_northing\",-500");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"4094\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4095, "epsg", 4095,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=10 +k=0.99998 +x_0=400000 +y"
+        "_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"ETRS89 / DKTM2\",GEOGCS[\"ETRS89\",DATUM[\"Euro"
+        "pean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",10],PARAMETER[\"scale_factor\",0.99998],PARAMETER[\"f"
+        "alse_easting\",400000],PARAMETER[\"false_northing\",-500"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"4094\"]]"},
+    {4095, "epsg", 4095,
         "ETRS89 / DKTM3", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.75 +k=0.99998 +x_0=600000");
-    add_proj4text (p, 1,
-        " +y_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / DKTM3\",GEOGCS[\"ETRS89\",DATUM[\"Euro");
-    add_srs_wkt (p, 1,
-        "pean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",11.75],PARAMETER[\"scale_factor\",0.99998],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",600000],PARAMETER[\"false_northing\",-");
-    add_srs_wkt (p, 10,
-        "5000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"4095\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4096, "epsg", 4096,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=11.75 +k=0.99998 +x_0=600000"
+        " +y_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"ETRS89 / DKTM3\",GEOGCS[\"ETRS89\",DATUM[\"Euro"
+        "pean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",11.75],PARAMETER[\"scale_factor\",0.99998],PARAMETER["
+        "\"false_easting\",600000],PARAMETER[\"false_northing\",-"
+        "5000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"4095\"]]"},
+    {4096, "epsg", 4096,
         "ETRS89 / DKTM4", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=800000 +y_0=-50");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / DKTM4\",GEOGCS[\"ETRS89\",DATUM[\"Euro");
-    add_srs_wkt (p, 1,
-        "pean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",800000],PARAMETER[\"false_northing\",-5000000],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"4096\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4097, "epsg", 4097,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=800000 +y_0=-50"
+        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"ETRS89 / DKTM4\",GEOGCS[\"ETRS89\",DATUM[\"Euro"
+        "pean_Terrestrial_Reference_System_1989\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",15],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_e"
+        "asting\",800000],PARAMETER[\"false_northing\",-5000000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"4096\"]]"},
+    {4097, "epsg", 4097,
         "ETRS89 / DKTM1", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.99998 +x_0=200000 +y_");
-    add_proj4text (p, 1,
-        "0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 / DKTM1 + DVR90 height\",PROJCS[\"ETRS");
-    add_srs_wkt (p, 1,
-        "89 / DKTM1\",GEOGCS[\"ETRS89\",DATUM[\"European_Terrestr");
-    add_srs_wkt (p, 2,
-        "ial_Reference_System_1989\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 3,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4258\"]],");
-    add_srs_wkt (p, 7,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",9],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.99998],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",200000],PARAMETER[\"false_northing\",-5000000],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"4093");
-    add_srs_wkt (p, 13,
-        "\"]],VERT_CS[\"DVR90 height\",VERT_DATUM[\"Dansk Vertika");
-    add_srs_wkt (p, 14,
-        "l Reference 1990\",2005,AUTHORITY[\"EPSG\",\"5206\"]],UN");
-    add_srs_wkt (p, 15,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Grav");
-    add_srs_wkt (p, 16,
-        "ity-related height\",UP],AUTHORITY[\"EPSG\",\"5799\"]],A");
-    add_srs_wkt (p, 17,
-        "UTHORITY[\"EPSG\",\"4097\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4098, "epsg", 4098,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=0.99998 +x_0=200000 +y_"
+        "0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+vunits=m +no_defs",
+        "COMPD_CS[\"ETRS89 / DKTM1 + DVR90 height\",PROJCS[\"ETRS"
+        "89 / DKTM1\",GEOGCS[\"ETRS89\",DATUM[\"European_Terrestr"
+        "ial_Reference_System_1989\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4258\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",9],PARAME"
+        "TER[\"scale_factor\",0.99998],PARAMETER[\"false_easting\""
+        ",200000],PARAMETER[\"false_northing\",-5000000],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"4093"
+        "\"]],VERT_CS[\"DVR90 height\",VERT_DATUM[\"Dansk Vertika"
+        "l Reference 1990\",2005,AUTHORITY[\"EPSG\",\"5206\"]],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Grav"
+        "ity-related height\",UP],AUTHORITY[\"EPSG\",\"5799\"]],A"
+        "UTHORITY[\"EPSG\",\"4097\"]]"},
+    {4098, "epsg", 4098,
         "ETRS89 / DKTM2", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10 +k=0.99998 +x_0=400000 +y");
-    add_proj4text (p, 1,
-        "_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 / DKTM2 + DVR90 height\",PROJCS[\"ETRS");
-    add_srs_wkt (p, 1,
-        "89 / DKTM2\",GEOGCS[\"ETRS89\",DATUM[\"European_Terrestr");
-    add_srs_wkt (p, 2,
-        "ial_Reference_System_1989\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 3,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4258\"]],");
-    add_srs_wkt (p, 7,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",10],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",0.99998],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",400000],PARAMETER[\"false_northing\",-5000000],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"409");
-    add_srs_wkt (p, 13,
-        "4\"]],VERT_CS[\"DVR90 height\",VERT_DATUM[\"Dansk Vertik");
-    add_srs_wkt (p, 14,
-        "al Reference 1990\",2005,AUTHORITY[\"EPSG\",\"5206\"]],U");
-    add_srs_wkt (p, 15,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gra");
-    add_srs_wkt (p, 16,
-        "vity-related height\",UP],AUTHORITY[\"EPSG\",\"5799\"]],");
-    add_srs_wkt (p, 17,
-        "AUTHORITY[\"EPSG\",\"4098\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4099, "epsg", 4099,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=10 +k=0.99998 +x_0=400000 +y"
+        "_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +vunits=m +no_defs",
+        "COMPD_CS[\"ETRS89 / DKTM2 + DVR90 height\",PROJCS[\"ETRS"
+        "89 / DKTM2\",GEOGCS[\"ETRS89\",DATUM[\"European_Terrestr"
+        "ial_Reference_System_1989\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4258\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",10],PARAM"
+        "ETER[\"scale_factor\",0.99998],PARAMETER[\"false_easting"
+        "\",400000],PARAMETER[\"false_northing\",-5000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"409"
+        "4\"]],VERT_CS[\"DVR90 height\",VERT_DATUM[\"Dansk Vertik"
+        "al Reference 1990\",2005,AUTHORITY[\"EPSG\",\"5206\"]],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gra"
+        "vity-related height\",UP],AUTHORITY[\"EPSG\",\"5799\"]],"
+        "AUTHORITY[\"EPSG\",\"4098\"]]"},
+    {4099, "epsg", 4099,
         "ETRS89 / DKTM3", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.75 +k=0.99998 +x_0=600000");
-    add_proj4text (p, 1,
-        " +y_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 / DKTM3 + DVR90 height\",PROJCS[\"ETRS");
-    add_srs_wkt (p, 1,
-        "89 / DKTM3\",GEOGCS[\"ETRS89\",DATUM[\"European_Terrestr");
-    add_srs_wkt (p, 2,
-        "ial_Reference_System_1989\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 3,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4258\"]],");
-    add_srs_wkt (p, 7,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",11.75],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",0.99998],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",600000],PARAMETER[\"false_northing\",-5000000],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "4095\"]],VERT_CS[\"DVR90 height\",VERT_DATUM[\"Dansk Ver");
-    add_srs_wkt (p, 14,
-        "tikal Reference 1990\",2005,AUTHORITY[\"EPSG\",\"5206\"]");
-    add_srs_wkt (p, 15,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 16,
-        "Gravity-related height\",UP],AUTHORITY[\"EPSG\",\"5799\"");
-    add_srs_wkt (p, 17,
-        "]],AUTHORITY[\"EPSG\",\"4099\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4100, "epsg", 4100,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=11.75 +k=0.99998 +x_0=600000"
+        " +y_0=-5000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +unit"
+        "s=m +vunits=m +no_defs",
+        "COMPD_CS[\"ETRS89 / DKTM3 + DVR90 height\",PROJCS[\"ETRS"
+        "89 / DKTM3\",GEOGCS[\"ETRS89\",DATUM[\"European_Terrestr"
+        "ial_Reference_System_1989\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4258\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",11.75],PA"
+        "RAMETER[\"scale_factor\",0.99998],PARAMETER[\"false_east"
+        "ing\",600000],PARAMETER[\"false_northing\",-5000000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "4095\"]],VERT_CS[\"DVR90 height\",VERT_DATUM[\"Dansk Ver"
+        "tikal Reference 1990\",2005,AUTHORITY[\"EPSG\",\"5206\"]"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Gravity-related height\",UP],AUTHORITY[\"EPSG\",\"5799\""
+        "]],AUTHORITY[\"EPSG\",\"4099\"]]"},
+    {4100, "epsg", 4100,
         "ETRS89 / DKTM4", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=800000 +y_0=-50");
-    add_proj4text (p, 1,
-        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +vuni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 / DKTM4 + DVR90 height\",PROJCS[\"ETRS");
-    add_srs_wkt (p, 1,
-        "89 / DKTM4\",GEOGCS[\"ETRS89\",DATUM[\"European_Terrestr");
-    add_srs_wkt (p, 2,
-        "ial_Reference_System_1989\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 3,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4258\"]],");
-    add_srs_wkt (p, 7,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",15],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",800");
-    add_srs_wkt (p, 10,
-        "000],PARAMETER[\"false_northing\",-5000000],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"4096\"]]");
-    add_srs_wkt (p, 13,
-        ",VERT_CS[\"DVR90 height\",VERT_DATUM[\"Dansk Vertikal Re");
-    add_srs_wkt (p, 14,
-        "ference 1990\",2005,AUTHORITY[\"EPSG\",\"5206\"]],UNIT[\"");
-    add_srs_wkt (p, 15,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-r");
-    add_srs_wkt (p, 16,
-        "elated height\",UP],AUTHORITY[\"EPSG\",\"5799\"]],AUTHOR");
-    add_srs_wkt (p, 17,
-        "ITY[\"EPSG\",\"4100\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4120, "epsg", 4120,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=800000 +y_0=-50"
+        "00000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +vuni"
+        "ts=m +no_defs",
+        "COMPD_CS[\"ETRS89 / DKTM4 + DVR90 height\",PROJCS[\"ETRS"
+        "89 / DKTM4\",GEOGCS[\"ETRS89\",DATUM[\"European_Terrestr"
+        "ial_Reference_System_1989\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4258\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",15],PARAM"
+        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",800"
+        "000],PARAMETER[\"false_northing\",-5000000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"4096\"]]"
+        ",VERT_CS[\"DVR90 height\",VERT_DATUM[\"Dansk Vertikal Re"
+        "ference 1990\",2005,AUTHORITY[\"EPSG\",\"5206\"]],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-r"
+        "elated height\",UP],AUTHORITY[\"EPSG\",\"5799\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4100\"]]"},
+    {4120, "epsg", 4120,
         "Greek", 1, 1,
         "Bessel 1841", "Greenwich",
         "Greek", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Greek\",DATUM[\"Greek\",SPHEROID[\"Bessel 1841\"");
-    add_srs_wkt (p, 1,
-        ",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"6120\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 4,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 5,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4120\"");
-    add_srs_wkt (p, 6,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4121, "epsg", 4121,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +no_defs",
+        "GEOGCS[\"Greek\",DATUM[\"Greek\",SPHEROID[\"Bessel 1841\""
+        ",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],A"
+        "UTHORITY[\"EPSG\",\"6120\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR"
+        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4120\""
+        "]]"},
+    {4121, "epsg", 4121,
         "GGRS87", 1, 1,
         "GRS 1980", "Greenwich",
         "Greek_Geodetic_Reference_System_1987", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=-199.87,74.79,246.62");
-    add_proj4text (p, 1,
-        ",0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"GGRS87\",DATUM[\"Greek_Geodetic_Reference_Syste");
-    add_srs_wkt (p, 1,
-        "m_1987\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6121\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4121\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4122, "epsg", 4122,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=-199.87,74.79,246.62"
+        ",0,0,0,0 +no_defs",
+        "GEOGCS[\"GGRS87\",DATUM[\"Greek_Geodetic_Reference_Syste"
+        "m_1987\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6121\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"4121\"]]"},
+    {4122, "epsg", 4122,
         "ATS77", 1, 1,
         "Average Terrestrial System 1977", "Greenwich",
         "Average_Terrestrial_System_1977", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378135 +b=6356750.304921594 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ATS77\",DATUM[\"Average_Terrestrial_System_1977");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"Average Terrestrial System 1977\",6378135,");
-    add_srs_wkt (p, 2,
-        "298.257,AUTHORITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6122\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4122\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4123, "epsg", 4123,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378135 +b=6356750.304921594 +no_defs",
+        "GEOGCS[\"ATS77\",DATUM[\"Average_Terrestrial_System_1977"
+        "\",SPHEROID[\"Average Terrestrial System 1977\",6378135,"
+        "298.257,AUTHORITY[\"EPSG\",\"7041\"]],AUTHORITY[\"EPSG\""
+        ",\"6122\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit"
+        "ude\",EAST],AUTHORITY[\"EPSG\",\"4122\"]]"},
+    {4123, "epsg", 4123,
         "KKJ", 1, 1,
         "International 1924", "Greenwich",
         "Kartastokoordinaattijarjestelma_1966", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-96.062,-82.428,-121.");
-    add_proj4text (p, 1,
-        "753,4.801,0.345,-1.376,1.496 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"KKJ\",DATUM[\"Kartastokoordinaattijarjestelma_1");
-    add_srs_wkt (p, 1,
-        "966\",SPHEROID[\"International 1924\",6378388,297,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6123\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4123\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4124, "epsg", 4124,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-96.062,-82.428,-121."
+        "753,4.801,0.345,-1.376,1.496 +no_defs",
+        "GEOGCS[\"KKJ\",DATUM[\"Kartastokoordinaattijarjestelma_1"
+        "966\",SPHEROID[\"International 1924\",6378388,297,AUTHOR"
+        "ITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6123\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"4123\"]]"},
+    {4124, "epsg", 4124,
         "RT90", 1, 1,
         "Bessel 1841", "Greenwich",
         "Rikets_koordinatsystem_1990", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=414.1,41.3,603.1,-0");
-    add_proj4text (p, 1,
-        ".855,2.141,-7.023,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RT90\",DATUM[\"Rikets_koordinatsystem_1990\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6124\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 4,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 5,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 6,
-        "RITY[\"EPSG\",\"4124\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4125, "epsg", 4125,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=414.1,41.3,603.1,-0"
+        ".855,2.141,-7.023,0 +no_defs",
+        "GEOGCS[\"RT90\",DATUM[\"Rikets_koordinatsystem_1990\",SP"
+        "HEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY"
+        "[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6124\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"4124\"]]"},
+    {4125, "epsg", 4125,
         "Segara", 1, 1,
         "Bessel 1841", "Greenwich",
         "Gunung_Segara", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=-404.78,685.68,45.4");
-    add_proj4text (p, 1,
-        "7,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Segara\",DATUM[\"Gunung_Segara\",SPHEROID[\"Bes");
-    add_srs_wkt (p, 1,
-        "sel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7004\"]],AUTHORITY[\"EPSG\",\"6613\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 3,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 4,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 5,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4613\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4126, "epsg", 4126,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=-404.78,685.68,45.4"
+        "7,0,0,0,0 +no_defs",
+        "GEOGCS[\"Segara\",DATUM[\"Gunung_Segara\",SPHEROID[\"Bes"
+        "sel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\""
+        "7004\"]],AUTHORITY[\"EPSG\",\"6613\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati"
+        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\""
+        ",\"4613\"]]"},
+    {4126, "epsg", 4126,
         "LKS94", 1, 1,
         "GRS 1980", "Greenwich",
         "Lithuania_1994_ETRS89", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"LKS94\",DATUM[\"Lithuania_1994_ETRS89\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7019\"]],AUTHORITY[\"EPSG\",\"6126\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 4,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 5,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4669\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4127, "epsg", 4127,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"LKS94\",DATUM[\"Lithuania_1994_ETRS89\",SPHEROI"
+        "D[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\","
+        "\"7019\"]],AUTHORITY[\"EPSG\",\"6126\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La"
+        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS"
+        "G\",\"4669\"]]"},
+    {4127, "epsg", 4127,
         "Tete", 1, 1,
         "Clarke 1866", "Greenwich",
         "Tete", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=-80,-100,-228,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Tete\",DATUM[\"Tete\",SPHEROID[\"Clarke 1866\",");
-    add_srs_wkt (p, 1,
-        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"6127\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 4,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 5,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4127");
-    add_srs_wkt (p, 6,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4128, "epsg", 4128,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +towgs84=-80,-100,-228,0,0,0"
+        ",0 +no_defs",
+        "GEOGCS[\"Tete\",DATUM[\"Tete\",SPHEROID[\"Clarke 1866\","
+        "6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"7008\"]]"
+        ",AUTHORITY[\"EPSG\",\"6127\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N"
+        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4127"
+        "\"]]"},
+    {4128, "epsg", 4128,
         "Madzansua", 1, 1,
         "Clarke 1866", "Greenwich",
         "Madzansua", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Madzansua\",DATUM[\"Madzansua\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 1,
-        "ke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7008\"]],AUTHORITY[\"EPSG\",\"6128\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 4,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 5,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4128\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4129, "epsg", 4129,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +no_defs",
+        "GEOGCS[\"Madzansua\",DATUM[\"Madzansua\",SPHEROID[\"Clar"
+        "ke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\","
+        "\"7008\"]],AUTHORITY[\"EPSG\",\"6128\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La"
+        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS"
+        "G\",\"4128\"]]"},
+    {4129, "epsg", 4129,
         "Observatario", 1, 1,
         "Clarke 1866", "Greenwich",
         "Observatario", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=-132,-110,-335,0,0,");
-    add_proj4text (p, 1,
-        "0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Observatario\",DATUM[\"Observatario\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"E");
-    add_srs_wkt (p, 2,
-        "PSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6129\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4129\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4130, "epsg", 4130,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +towgs84=-132,-110,-335,0,0,"
+        "0,0 +no_defs",
+        "GEOGCS[\"Observatario\",DATUM[\"Observatario\",SPHEROID["
+        "\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"E"
+        "PSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6129\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4129\"]]"},
+    {4130, "epsg", 4130,
         "Moznet", 1, 1,
         "WGS 84", "Greenwich",
         "Moznet_ITRF94", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Moznet\",DATUM[\"Moznet_ITRF94\",SPHEROID[\"WGS");
-    add_srs_wkt (p, 1,
-        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]");
-    add_srs_wkt (p, 2,
-        "],AUTHORITY[\"EPSG\",\"6130\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 4,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 5,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"413");
-    add_srs_wkt (p, 6,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4131, "epsg", 4131,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Moznet\",DATUM[\"Moznet_ITRF94\",SPHEROID[\"WGS"
+        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]"
+        "],AUTHORITY[\"EPSG\",\"6130\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\","
+        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"413"
+        "0\"]]"},
+    {4131, "epsg", 4131,
         "Indian 1960", 1, 1,
         "Everest 1830 (1937 Adjustment)", "Greenwich",
         "Indian_1960", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377276.345 +b=6356075.41314024 +towgs8");
-    add_proj4text (p, 1,
-        "4=198,881,317,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Indian 1960\",DATUM[\"Indian_1960\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Everest 1830 (1937 Adjustment)\",6377276.345,300.8017,AU");
-    add_srs_wkt (p, 2,
-        "THORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",\"6131\"]");
-    add_srs_wkt (p, 3,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 4,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 5,
-        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4131\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4132, "epsg", 4132,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377276.345 +b=6356075.41314024 +towgs8"
+        "4=198,881,317,0,0,0,0 +no_defs",
+        "GEOGCS[\"Indian 1960\",DATUM[\"Indian_1960\",SPHEROID[\""
+        "Everest 1830 (1937 Adjustment)\",6377276.345,300.8017,AU"
+        "THORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",\"6131\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST"
+        "],AUTHORITY[\"EPSG\",\"4131\"]]"},
+    {4132, "epsg", 4132,
         "FD58", 1, 1,
         "Clarke 1880 (RGS)", "Greenwich",
         "Final_Datum_1958", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-241.54,-163.64,396");
-    add_proj4text (p, 1,
-        ".06,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"FD58\",DATUM[\"Final_Datum_1958\",SPHEROID[\"Cl");
-    add_srs_wkt (p, 1,
-        "arke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7012\"]],AUTHORITY[\"EPSG\",\"6132\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 3,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 4,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 5,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4132\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4133, "epsg", 4133,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk80 +towgs84=-241.54,-163.64,396"
+        ".06,0,0,0,0 +no_defs",
+        "GEOGCS[\"FD58\",DATUM[\"Final_Datum_1958\",SPHEROID[\"Cl"
+        "arke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\""
+        ",\"7012\"]],AUTHORITY[\"EPSG\",\"6132\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L"
+        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP"
+        "SG\",\"4132\"]]"},
+    {4133, "epsg", 4133,
         "EST92", 1, 1,
         "GRS 1980", "Greenwich",
         "Estonia_1992", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0.055,-0.541,-0.185,");
-    add_proj4text (p, 1,
-        "0.0183,-0.0003,-0.007,-0.014 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"EST92\",DATUM[\"Estonia_1992\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 1,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 2,
-        "],AUTHORITY[\"EPSG\",\"6133\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 4,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 5,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"413");
-    add_srs_wkt (p, 6,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4134, "epsg", 4134,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0.055,-0.541,-0.185,"
+        "0.0183,-0.0003,-0.007,-0.014 +no_defs",
+        "GEOGCS[\"EST92\",DATUM[\"Estonia_1992\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6133\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\","
+        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"413"
+        "3\"]]"},
+    {4134, "epsg", 4134,
         "PSD93", 1, 1,
         "Clarke 1880 (RGS)", "Greenwich",
         "PDO_Survey_Datum_1993", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-180.624,-225.516,1");
-    add_proj4text (p, 1,
-        "73.919,-0.81,-1.898,8.336,16.71006 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"PSD93\",DATUM[\"PDO_Survey_Datum_1993\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6134\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4134\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4135, "epsg", 4135,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk80 +towgs84=-180.624,-225.516,1"
+        "73.919,-0.81,-1.898,8.336,16.71006 +no_defs",
+        "GEOGCS[\"PSD93\",DATUM[\"PDO_Survey_Datum_1993\",SPHEROI"
+        "D[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\""
+        "EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6134\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4134\"]]"},
+    {4135, "epsg", 4135,
         "Old Hawaiian", 1, 1,
         "Clarke 1866", "Greenwich",
         "Old_Hawaiian", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=61,-285,-181,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Old Hawaiian\",DATUM[\"Old_Hawaiian\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"E");
-    add_srs_wkt (p, 2,
-        "PSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4135\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4136, "epsg", 4136,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +towgs84=61,-285,-181,0,0,0,"
+        "0 +no_defs",
+        "GEOGCS[\"Old Hawaiian\",DATUM[\"Old_Hawaiian\",SPHEROID["
+        "\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"E"
+        "PSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6135\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4135\"]]"},
+    {4136, "epsg", 4136,
         "St. Lawrence Island", 1, 1,
         "Clarke 1866", "Greenwich",
         "St_Lawrence_Island", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"St. Lawrence Island\",DATUM[\"St_Lawrence_Islan");
-    add_srs_wkt (p, 1,
-        "d\",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6136\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"4136\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4137, "epsg", 4137,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +no_defs",
+        "GEOGCS[\"St. Lawrence Island\",DATUM[\"St_Lawrence_Islan"
+        "d\",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898,"
+        "AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6136\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"4136\"]]"},
+    {4137, "epsg", 4137,
         "St. Paul Island", 1, 1,
         "Clarke 1866", "Greenwich",
         "St_Paul_Island", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"St. Paul Island\",DATUM[\"St_Paul_Island\",SPHE");
-    add_srs_wkt (p, 1,
-        "ROID[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6137\"]],PRIM");
-    add_srs_wkt (p, 3,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4137\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4138, "epsg", 4138,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +no_defs",
+        "GEOGCS[\"St. Paul Island\",DATUM[\"St_Paul_Island\",SPHE"
+        "ROID[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORIT"
+        "Y[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6137\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH"
+        "ORITY[\"EPSG\",\"4137\"]]"},
+    {4138, "epsg", 4138,
         "St. George Island", 1, 1,
         "Clarke 1866", "Greenwich",
         "St_George_Island", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"St. George Island\",DATUM[\"St_George_Island\",");
-    add_srs_wkt (p, 1,
-        "SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6138\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4138\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4139, "epsg", 4139,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +no_defs",
+        "GEOGCS[\"St. George Island\",DATUM[\"St_George_Island\","
+        "SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898,AUTH"
+        "ORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6138\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],"
+        "AUTHORITY[\"EPSG\",\"4138\"]]"},
+    {4139, "epsg", 4139,
         "Puerto Rico", 1, 1,
         "Clarke 1866", "Greenwich",
         "Puerto_Rico", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=11,72,-101,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Puerto Rico\",DATUM[\"Puerto_Rico\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7008\"]],AUTHORITY[\"EPSG\",\"6139\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4139\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4140, "epsg", 4140,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +towgs84=11,72,-101,0,0,0,0 "
+        "+no_defs",
+        "GEOGCS[\"Puerto Rico\",DATUM[\"Puerto_Rico\",SPHEROID[\""
+        "Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPS"
+        "G\",\"7008\"]],AUTHORITY[\"EPSG\",\"6139\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4139\"]]"},
+    {4140, "epsg", 4140,
         "NAD83(CSRS)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Re");
-    add_srs_wkt (p, 1,
-        "ference_System\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4617\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4141, "epsg", 4141,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Re"
+        "ference_System\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6140\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude"
+        "\",EAST],AUTHORITY[\"EPSG\",\"4617\"]]"},
+    {4141, "epsg", 4141,
         "Israel 1993", 1, 1,
         "GRS 1980", "Greenwich",
         "Israel_1993", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=-48,55,52,0,0,0,0 +n");
-    add_proj4text (p, 1,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Israel 1993\",DATUM[\"Israel_1993\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "19\"]],AUTHORITY[\"EPSG\",\"6141\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4141\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4142, "epsg", 4142,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=-48,55,52,0,0,0,0 +n"
+        "o_defs",
+        "GEOGCS[\"Israel 1993\",DATUM[\"Israel_1993\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"6141\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "4141\"]]"},
+    {4142, "epsg", 4142,
         "Locodjo 1965", 1, 1,
         "Clarke 1880 (RGS)", "Greenwich",
         "Locodjo_1965", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-125,53,467,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Locodjo 1965\",DATUM[\"Locodjo_1965\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EP");
-    add_srs_wkt (p, 2,
-        "SG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6142\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 3,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 4,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 5,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"4142\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4143, "epsg", 4143,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk80 +towgs84=-125,53,467,0,0,0,0"
+        " +no_defs",
+        "GEOGCS[\"Locodjo 1965\",DATUM[\"Locodjo_1965\",SPHEROID["
+        "\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EP"
+        "SG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6142\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS"
+        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY["
+        "\"EPSG\",\"4142\"]]"},
+    {4143, "epsg", 4143,
         "Abidjan 1987", 1, 1,
         "Clarke 1880 (RGS)", "Greenwich",
         "Abidjan_1987", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-124.76,53,466.79,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Abidjan 1987\",DATUM[\"Abidjan_1987\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EP");
-    add_srs_wkt (p, 2,
-        "SG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6143\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 3,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 4,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 5,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"4143\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4144, "epsg", 4144,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk80 +towgs84=-124.76,53,466.79,0"
+        ",0,0,0 +no_defs",
+        "GEOGCS[\"Abidjan 1987\",DATUM[\"Abidjan_1987\",SPHEROID["
+        "\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EP"
+        "SG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6143\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS"
+        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY["
+        "\"EPSG\",\"4143\"]]"},
+    {4144, "epsg", 4144,
         "Kalianpur 1937", 1, 1,
         "Everest 1830 (1937 Adjustment)", "Greenwich",
         "Kalianpur_1937", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377276.345 +b=6356075.41314024 +towgs8");
-    add_proj4text (p, 1,
-        "4=214,804,268,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Kalianpur 1937\",DATUM[\"Kalianpur_1937\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Everest 1830 (1937 Adjustment)\",6377276.345,300.8");
-    add_srs_wkt (p, 2,
-        "017,AUTHORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "144\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"4144\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4145, "epsg", 4145,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377276.345 +b=6356075.41314024 +towgs8"
+        "4=214,804,268,0,0,0,0 +no_defs",
+        "GEOGCS[\"Kalianpur 1937\",DATUM[\"Kalianpur_1937\",SPHER"
+        "OID[\"Everest 1830 (1937 Adjustment)\",6377276.345,300.8"
+        "017,AUTHORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",\"6"
+        "144\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\""
+        ",EAST],AUTHORITY[\"EPSG\",\"4144\"]]"},
+    {4145, "epsg", 4145,
         "Kalianpur 1962", 1, 1,
         "Everest 1830 (1962 Definition)", "Greenwich",
         "Kalianpur_1962", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377301.243 +b=6356100.230165384 +towgs");
-    add_proj4text (p, 1,
-        "84=283,682,231,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Kalianpur 1962\",DATUM[\"Kalianpur_1962\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Everest 1830 (1962 Definition)\",6377301.243,300.8");
-    add_srs_wkt (p, 2,
-        "017255,AUTHORITY[\"EPSG\",\"7044\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6145\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 6,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4145\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4146, "epsg", 4146,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377301.243 +b=6356100.230165384 +towgs"
+        "84=283,682,231,0,0,0,0 +no_defs",
+        "GEOGCS[\"Kalianpur 1962\",DATUM[\"Kalianpur_1962\",SPHER"
+        "OID[\"Everest 1830 (1962 Definition)\",6377301.243,300.8"
+        "017255,AUTHORITY[\"EPSG\",\"7044\"]],AUTHORITY[\"EPSG\","
+        "\"6145\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu"
+        "de\",EAST],AUTHORITY[\"EPSG\",\"4145\"]]"},
+    {4146, "epsg", 4146,
         "Kalianpur 1975", 1, 1,
         "Everest 1830 (1975 Definition)", "Greenwich",
         "Kalianpur_1975", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377299.151 +b=6356098.145120132 +towgs");
-    add_proj4text (p, 1,
-        "84=295,736,257,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Kalianpur 1975\",DATUM[\"Kalianpur_1975\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Everest 1830 (1975 Definition)\",6377299.151,300.8");
-    add_srs_wkt (p, 2,
-        "017255,AUTHORITY[\"EPSG\",\"7045\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6146\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 6,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4146\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4147, "epsg", 4147,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377299.151 +b=6356098.145120132 +towgs"
+        "84=295,736,257,0,0,0,0 +no_defs",
+        "GEOGCS[\"Kalianpur 1975\",DATUM[\"Kalianpur_1975\",SPHER"
+        "OID[\"Everest 1830 (1975 Definition)\",6377299.151,300.8"
+        "017255,AUTHORITY[\"EPSG\",\"7045\"]],AUTHORITY[\"EPSG\","
+        "\"6146\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu"
+        "de\",EAST],AUTHORITY[\"EPSG\",\"4146\"]]"},
+    {4147, "epsg", 4147,
         "Hanoi 1972", 1, 1,
         "Krassowsky 1940", "Greenwich",
         "Hanoi_1972", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +towgs84=-17.51,-108.32,-62.3");
-    add_proj4text (p, 1,
-        "9,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Hanoi 1972\",DATUM[\"Hanoi_1972\",SPHEROID[\"Kr");
-    add_srs_wkt (p, 1,
-        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"");
-    add_srs_wkt (p, 2,
-        "]],AUTHORITY[\"EPSG\",\"6147\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 4,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 5,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 6,
-        "47\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4148, "epsg", 4148,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=krass +towgs84=-17.51,-108.32,-62.3"
+        "9,0,0,0,0 +no_defs",
+        "GEOGCS[\"Hanoi 1972\",DATUM[\"Hanoi_1972\",SPHEROID[\"Kr"
+        "assowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\""
+        "]],AUTHORITY[\"EPSG\",\"6147\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41"
+        "47\"]]"},
+    {4148, "epsg", 4148,
         "Hartebeesthoek94", 1, 1,
         "WGS 84", "Greenwich",
         "Hartebeesthoek94", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Hartebeesthoek94\",DATUM[\"Hartebeesthoek94\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7030\"]],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4148\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4149, "epsg", 4149,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Hartebeesthoek94\",DATUM[\"Hartebeesthoek94\",S"
+        "PHEROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPS"
+        "G\",\"7030\"]],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4148\"]]"},
+    {4149, "epsg", 4149,
         "CH1903", 1, 1,
         "Bessel 1841", "Greenwich",
         "CH1903", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=674.374,15.056,405.");
-    add_proj4text (p, 1,
-        "346,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"CH1903\",DATUM[\"CH1903\",SPHEROID[\"Bessel 184");
-    add_srs_wkt (p, 1,
-        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]");
-    add_srs_wkt (p, 2,
-        "],AUTHORITY[\"EPSG\",\"6149\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 4,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 5,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"414");
-    add_srs_wkt (p, 6,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4150, "epsg", 4150,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=674.374,15.056,405."
+        "346,0,0,0,0 +no_defs",
+        "GEOGCS[\"CH1903\",DATUM[\"CH1903\",SPHEROID[\"Bessel 184"
+        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]"
+        "],AUTHORITY[\"EPSG\",\"6149\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\","
+        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"414"
+        "9\"]]"},
+    {4150, "epsg", 4150,
         "CH1903+", 1, 1,
         "Bessel 1841", "Greenwich",
         "CH1903+", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=674.374,15.056,405.");
-    add_proj4text (p, 1,
-        "346,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"CH1903+\",DATUM[\"CH1903+\",SPHEROID[\"Bessel 1");
-    add_srs_wkt (p, 1,
-        "841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"");
-    add_srs_wkt (p, 2,
-        "]],AUTHORITY[\"EPSG\",\"6150\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 4,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 5,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 6,
-        "50\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4151, "epsg", 4151,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=674.374,15.056,405."
+        "346,0,0,0,0 +no_defs",
+        "GEOGCS[\"CH1903+\",DATUM[\"CH1903+\",SPHEROID[\"Bessel 1"
+        "841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\""
+        "]],AUTHORITY[\"EPSG\",\"6150\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41"
+        "50\"]]"},
+    {4151, "epsg", 4151,
         "CHTRF95", 1, 1,
         "GRS 1980", "Greenwich",
         "Swiss_Terrestrial_Reference_Frame_1995", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"CHTRF95\",DATUM[\"Swiss_Terrestrial_Reference_F");
-    add_srs_wkt (p, 1,
-        "rame_1995\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6151\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"4151\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4152, "epsg", 4152,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"CHTRF95\",DATUM[\"Swiss_Terrestrial_Reference_F"
+        "rame_1995\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6151\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"4151\"]]"},
+    {4152, "epsg", 4152,
         "NAD83(HARN)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refer");
-    add_srs_wkt (p, 1,
-        "ence_Network\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 2,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"61");
-    add_srs_wkt (p, 3,
-        "52\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4152\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4153, "epsg", 4153,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"NAD83(HARN)\",DATUM[\"NAD83_High_Accuracy_Refer"
+        "ence_Network\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"61"
+        "52\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"4152\"]]"},
+    {4153, "epsg", 4153,
         "Rassadiran", 1, 1,
         "International 1924", "Greenwich",
         "Rassadiran", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-133.63,-157.5,-158.6");
-    add_proj4text (p, 1,
-        "2,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Rassadiran\",DATUM[\"Rassadiran\",SPHEROID[\"In");
-    add_srs_wkt (p, 1,
-        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022");
-    add_srs_wkt (p, 2,
-        "\"]],AUTHORITY[\"EPSG\",\"6153\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 3,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 4,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 5,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4153\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4154, "epsg", 4154,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-133.63,-157.5,-158.6"
+        "2,0,0,0,0 +no_defs",
+        "GEOGCS[\"Rassadiran\",DATUM[\"Rassadiran\",SPHEROID[\"In"
+        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022"
+        "\"]],AUTHORITY[\"EPSG\",\"6153\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude"
+        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "4153\"]]"},
+    {4154, "epsg", 4154,
         "ED50(ED77)", 1, 1,
         "International 1924", "Greenwich",
         "European_Datum_1950_1977", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-117,-132,-164,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ED50(ED77)\",DATUM[\"European_Datum_1950_1977\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6154\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4154\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4155, "epsg", 4155,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-117,-132,-164,0,0,0,"
+        "0 +no_defs",
+        "GEOGCS[\"ED50(ED77)\",DATUM[\"European_Datum_1950_1977\""
+        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\""
+        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6154\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4154\"]]"},
+    {4155, "epsg", 4155,
         "Dabola 1981", 1, 1,
         "Clarke 1880 (IGN)", "Greenwich",
         "Dabola_1981", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +towgs84=-83,37,12");
-    add_proj4text (p, 1,
-        "4,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Dabola 1981\",DATUM[\"Dabola_1981\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Clarke 1880 (IGN)\",6378249.2,293.466021293627,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\",\"6155\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 4,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 5,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 6,
-        "RITY[\"EPSG\",\"4155\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4156, "epsg", 4156,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378249.2 +b=6356515 +towgs84=-83,37,12"
+        "4,0,0,0,0 +no_defs",
+        "GEOGCS[\"Dabola 1981\",DATUM[\"Dabola_1981\",SPHEROID[\""
+        "Clarke 1880 (IGN)\",6378249.2,293.466021293627,AUTHORITY"
+        "[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\",\"6155\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"4155\"]]"},
+    {4156, "epsg", 4156,
         "S-JTSK", 1, 1,
         "Bessel 1841", "Greenwich",
         "System_of_the_Unified_Trigonometrical_Cadastral_Network", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=589,76,480,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"S-JTSK\",DATUM[\"System_of_the_Unified_Trigonom");
-    add_srs_wkt (p, 1,
-        "etrical_Cadastral_Network\",SPHEROID[\"Bessel 1841\",637");
-    add_srs_wkt (p, 2,
-        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6156\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 6,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4156\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4157, "epsg", 4157,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=589,76,480,0,0,0,0 "
+        "+no_defs",
+        "GEOGCS[\"S-JTSK\",DATUM[\"System_of_the_Unified_Trigonom"
+        "etrical_Cadastral_Network\",SPHEROID[\"Bessel 1841\",637"
+        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO"
+        "RITY[\"EPSG\",\"6156\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4156\"]]"},
+    {4157, "epsg", 4157,
         "Mount Dillon", 1, 1,
         "Clarke 1858", "Greenwich",
         "Mount_Dillon", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378293.645208759 +b=6356617.987679838 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Mount Dillon\",DATUM[\"Mount_Dillon\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"Clarke 1858\",6378293.64520876,294.260676369261,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"6157\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4157\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4158, "epsg", 4158,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378293.645208759 +b=6356617.987679838 "
+        "+no_defs",
+        "GEOGCS[\"Mount Dillon\",DATUM[\"Mount_Dillon\",SPHEROID["
+        "\"Clarke 1858\",6378293.64520876,294.260676369261,AUTHOR"
+        "ITY[\"EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"6157\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"4157\"]]"},
+    {4158, "epsg", 4158,
         "Naparima 1955", 1, 1,
         "International 1924", "Greenwich",
         "Naparima_1955", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-0.465,372.095,171.73");
-    add_proj4text (p, 1,
-        "6,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Naparima 1955\",DATUM[\"Naparima_1955\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7022\"]],AUTHORITY[\"EPSG\",\"6158\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 4,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 5,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4158\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4159, "epsg", 4159,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-0.465,372.095,171.73"
+        "6,0,0,0,0 +no_defs",
+        "GEOGCS[\"Naparima 1955\",DATUM[\"Naparima_1955\",SPHEROI"
+        "D[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\","
+        "\"7022\"]],AUTHORITY[\"EPSG\",\"6158\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La"
+        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS"
+        "G\",\"4158\"]]"},
+    {4159, "epsg", 4159,
         "ELD79", 1, 1,
         "International 1924", "Greenwich",
         "European_Libyan_Datum_1979", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-115.8543,-99.0583,-1");
-    add_proj4text (p, 1,
-        "52.4616,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ELD79\",DATUM[\"European_Libyan_Datum_1979\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"International 1924\",6378388,297,AUTHORITY[\"EP");
-    add_srs_wkt (p, 2,
-        "SG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6159\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 3,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 4,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS");
-    add_srs_wkt (p, 5,
-        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"4159\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4160, "epsg", 4160,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-115.8543,-99.0583,-1"
+        "52.4616,0,0,0,0 +no_defs",
+        "GEOGCS[\"ELD79\",DATUM[\"European_Libyan_Datum_1979\",SP"
+        "HEROID[\"International 1924\",6378388,297,AUTHORITY[\"EP"
+        "SG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6159\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS"
+        "[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY["
+        "\"EPSG\",\"4159\"]]"},
+    {4160, "epsg", 4160,
         "Chos Malal 1914", 1, 1,
         "International 1924", "Greenwich",
         "Chos_Malal_1914", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Chos Malal 1914\",DATUM[\"Chos_Malal_1914\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"International 1924\",6378388,297,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7022\"]],AUTHORITY[\"EPSG\",\"6160\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4160\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4161, "epsg", 4161,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +no_defs",
+        "GEOGCS[\"Chos Malal 1914\",DATUM[\"Chos_Malal_1914\",SPH"
+        "EROID[\"International 1924\",6378388,297,AUTHORITY[\"EPS"
+        "G\",\"7022\"]],AUTHORITY[\"EPSG\",\"6160\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4160\"]]"},
+    {4161, "epsg", 4161,
         "Pampa del Castillo", 1, 1,
         "International 1924", "Greenwich",
         "Pampa_del_Castillo", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=27.5,14,186.4,0,0,0,0");
-    add_proj4text (p, 1,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Pampa del Castillo\",DATUM[\"Pampa_del_Castillo");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6161\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 4,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 5,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 6,
-        "RITY[\"EPSG\",\"4161\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4162, "epsg", 4162,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=27.5,14,186.4,0,0,0,0"
+        " +no_defs",
+        "GEOGCS[\"Pampa del Castillo\",DATUM[\"Pampa_del_Castillo"
+        "\",SPHEROID[\"International 1924\",6378388,297,AUTHORITY"
+        "[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6161\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"4161\"]]"},
+    {4162, "epsg", 4162,
         "Korean 1985", 1, 1,
         "Bessel 1841", "Greenwich",
         "Korean_Datum_1985", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Korean 1985\",DATUM[\"Korean_Datum_1985\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4162\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4163, "epsg", 4163,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +no_defs",
+        "GEOGCS[\"Korean 1985\",DATUM[\"Korean_Datum_1985\",SPHER"
+        "OID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\""
+        "EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6162\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4162\"]]"},
+    {4163, "epsg", 4163,
         "Yemen NGN96", 1, 1,
         "WGS 84", "Greenwich",
         "Yemen_National_Geodetic_Network_1996", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Yemen NGN96\",DATUM[\"Yemen_National_Geodetic_N");
-    add_srs_wkt (p, 1,
-        "etwork_1996\",SPHEROID[\"WGS 84\",6378137,298.257223563,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6163\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"4163\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4164, "epsg", 4164,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Yemen NGN96\",DATUM[\"Yemen_National_Geodetic_N"
+        "etwork_1996\",SPHEROID[\"WGS 84\",6378137,298.257223563,"
+        "AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6163\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"4163\"]]"},
+    {4164, "epsg", 4164,
         "South Yemen", 1, 1,
         "Krassowsky 1940", "Greenwich",
         "South_Yemen", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +towgs84=-76,-138,67,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"South Yemen\",DATUM[\"South_Yemen\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702");
-    add_srs_wkt (p, 2,
-        "4\"]],AUTHORITY[\"EPSG\",\"6164\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4164\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4165, "epsg", 4165,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=krass +towgs84=-76,-138,67,0,0,0,0 "
+        "+no_defs",
+        "GEOGCS[\"South Yemen\",DATUM[\"South_Yemen\",SPHEROID[\""
+        "Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"702"
+        "4\"]],AUTHORITY[\"EPSG\",\"6164\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "4164\"]]"},
+    {4165, "epsg", 4165,
         "Bissau", 1, 1,
         "International 1924", "Greenwich",
         "Bissau", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-173,253,27,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Bissau\",DATUM[\"Bissau\",SPHEROID[\"Internatio");
-    add_srs_wkt (p, 1,
-        "nal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"6165\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 4,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4165\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4166, "epsg", 4166,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-173,253,27,0,0,0,0 +"
+        "no_defs",
+        "GEOGCS[\"Bissau\",DATUM[\"Bissau\",SPHEROID[\"Internatio"
+        "nal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUT"
+        "HORITY[\"EPSG\",\"6165\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH"
+        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4165\"]]"},
+    {4166, "epsg", 4166,
         "Korean 1995", 1, 1,
         "WGS 84", "Greenwich",
         "Korean_Datum_1995", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Korean 1995\",DATUM[\"Korean_Datum_1995\",SPHER");
-    add_srs_wkt (p, 1,
-        "OID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 2,
-        "\"7030\"]],AUTHORITY[\"EPSG\",\"6166\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 4,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 5,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4166\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4167, "epsg", 4167,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Korean 1995\",DATUM[\"Korean_Datum_1995\",SPHER"
+        "OID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\","
+        "\"7030\"]],AUTHORITY[\"EPSG\",\"6166\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La"
+        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS"
+        "G\",\"4166\"]]"},
+    {4167, "epsg", 4167,
         "NZGD2000", 1, 1,
         "GRS 1980", "Greenwich",
         "New_Zealand_Geodetic_Datum_2000", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2");
-    add_srs_wkt (p, 1,
-        "000\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4167\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4168, "epsg", 4168,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"NZGD2000\",DATUM[\"New_Zealand_Geodetic_Datum_2"
+        "000\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6167\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"4167\"]]"},
+    {4168, "epsg", 4168,
         "Accra", 1, 1,
         "War Office", "Greenwich",
         "Accra", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378300 +b=6356751.689189189 +towgs84=-");
-    add_proj4text (p, 1,
-        "199,32,322,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Accra\",DATUM[\"Accra\",SPHEROID[\"War Office\"");
-    add_srs_wkt (p, 1,
-        ",6378300,296,AUTHORITY[\"EPSG\",\"7029\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 2,
-        "PSG\",\"6168\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L");
-    add_srs_wkt (p, 5,
-        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4168\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4169, "epsg", 4169,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378300 +b=6356751.689189189 +towgs84=-"
+        "199,32,322,0,0,0,0 +no_defs",
+        "GEOGCS[\"Accra\",DATUM[\"Accra\",SPHEROID[\"War Office\""
+        ",6378300,296,AUTHORITY[\"EPSG\",\"7029\"]],AUTHORITY[\"E"
+        "PSG\",\"6168\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"L"
+        "ongitude\",EAST],AUTHORITY[\"EPSG\",\"4168\"]]"},
+    {4169, "epsg", 4169,
         "American Samoa 1962", 1, 1,
         "Clarke 1866", "Greenwich",
         "American_Samoa_1962", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=-115,118,426,0,0,0,");
-    add_proj4text (p, 1,
-        "0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"American Samoa 1962\",DATUM[\"American_Samoa_19");
-    add_srs_wkt (p, 1,
-        "62\",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6169");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 6,
-        "AST],AUTHORITY[\"EPSG\",\"4169\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4170, "epsg", 4170,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +towgs84=-115,118,426,0,0,0,"
+        "0 +no_defs",
+        "GEOGCS[\"American Samoa 1962\",DATUM[\"American_Samoa_19"
+        "62\",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898"
+        ",AUTHORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"6169"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E"
+        "AST],AUTHORITY[\"EPSG\",\"4169\"]]"},
+    {4170, "epsg", 4170,
         "SIRGAS 1995", 1, 1,
         "GRS 1980", "Greenwich",
         "Sistema_de_Referencia_Geocentrico_para_America_del_Sur_1995", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIRGAS 1995\",DATUM[\"Sistema_de_Referencia_Geo");
-    add_srs_wkt (p, 1,
-        "centrico_para_America_del_Sur_1995\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6170\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 6,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4170\"");
-    add_srs_wkt (p, 7,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 4171, "epsg", 4171,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"SIRGAS 1995\",DATUM[\"Sistema_de_Referencia_Geo"
+        "centrico_para_America_del_Sur_1995\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6170\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR"
+        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4170\""
+        "]]"},
+    {4171, "epsg", 4171,
         "RGF93", 1, 1,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_Francais_1993", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RGF93\",DATUM[\"Reseau_Geodesique_Francais_1993");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6171\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 4,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 5,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 6,
-        "RITY[\"EPSG\",\"4171\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4172, "epsg", 4172,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"RGF93\",DATUM[\"Reseau_Geodesique_Francais_1993"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6171\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"4171\"]]"},
+    {4172, "epsg", 4172,
         "POSGAR (deprecated)", 1, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas", "none", "degree minute second hemisphere",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"POSGAR (deprecated)\",DATUM[\"Posiciones_Geodes");
-    add_srs_wkt (p, 1,
-        "icas_Argentinas\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6172\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree minute second hemisphere\",0.0174532");
-    add_srs_wkt (p, 5,
-        "925199433,AUTHORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 6,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 7,
-        "72\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4173, "epsg", 4173,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"POSGAR (deprecated)\",DATUM[\"Posiciones_Geodes"
+        "icas_Argentinas\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6172\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree minute second hemisphere\",0.0174532"
+        "925199433,AUTHORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41"
+        "72\"]]"},
+    {4173, "epsg", 4173,
         "IRENET95", 1, 1,
         "GRS 1980", "Greenwich",
         "IRENET95", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IRENET95\",DATUM[\"IRENET95\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 1,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"6173\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 4,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N");
-    add_srs_wkt (p, 5,
-        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4173");
-    add_srs_wkt (p, 6,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4174, "epsg", 4174,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"IRENET95\",DATUM[\"IRENET95\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"6173\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",N"
+        "ORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4173"
+        "\"]]"},
+    {4174, "epsg", 4174,
         "Sierra Leone 1924", 1, 1,
         "War Office", "Greenwich",
         "Sierra_Leone_Colony_1924", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378300 +b=6356751.689189189 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Sierra Leone 1924\",DATUM[\"Sierra_Leone_Colony");
-    add_srs_wkt (p, 1,
-        "_1924\",SPHEROID[\"War Office\",6378300,296,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7029\"]],AUTHORITY[\"EPSG\",\"6174\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4174\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4175, "epsg", 4175,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378300 +b=6356751.689189189 +no_defs",
+        "GEOGCS[\"Sierra Leone 1924\",DATUM[\"Sierra_Leone_Colony"
+        "_1924\",SPHEROID[\"War Office\",6378300,296,AUTHORITY[\""
+        "EPSG\",\"7029\"]],AUTHORITY[\"EPSG\",\"6174\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4174\"]]"},
+    {4175, "epsg", 4175,
         "Sierra Leone 1968", 1, 1,
         "Clarke 1880 (RGS)", "Greenwich",
         "Sierra_Leone_1968", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +towgs84=-88,4,101,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Sierra Leone 1968\",DATUM[\"Sierra_Leone_1968\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6175\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4175\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4176, "epsg", 4176,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk80 +towgs84=-88,4,101,0,0,0,0 +"
+        "no_defs",
+        "GEOGCS[\"Sierra Leone 1968\",DATUM[\"Sierra_Leone_1968\""
+        ",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.465,AUTH"
+        "ORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"6175\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],"
+        "AUTHORITY[\"EPSG\",\"4175\"]]"},
+    {4176, "epsg", 4176,
         "Australian Antarctic", 1, 1,
         "GRS 1980", "Greenwich",
         "Australian_Antarctic_Datum_1998", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Australian Antarctic\",DATUM[\"Australian_Antar");
-    add_srs_wkt (p, 1,
-        "ctic_Datum_1998\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6176\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"4176\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4178, "epsg", 4178,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Australian Antarctic\",DATUM[\"Australian_Antar"
+        "ctic_Datum_1998\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "6176\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude"
+        "\",EAST],AUTHORITY[\"EPSG\",\"4176\"]]"},
+    {4178, "epsg", 4178,
         "Pulkovo 1942(83)", 1, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_83", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +towgs84=26,-121,-78,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4178\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4179, "epsg", 4179,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=krass +towgs84=26,-121,-78,0,0,0,0 "
+        "+no_defs",
+        "GEOGCS[\"Pulkovo 1942(83)\",DATUM[\"Pulkovo_1942_83\",SP"
+        "HEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPS"
+        "G\",\"7024\"]],AUTHORITY[\"EPSG\",\"6178\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4178\"]]"},
+    {4179, "epsg", 4179,
         "Pulkovo 1942(58)", 1, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942_58", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +towgs84=33.4,-146.6,-76.3,-0");
-    add_proj4text (p, 1,
-        ".359,-0.053,0.844,-0.84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4179\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4180, "epsg", 4180,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=krass +towgs84=33.4,-146.6,-76.3,-0"
+        ".359,-0.053,0.844,-0.84 +no_defs",
+        "GEOGCS[\"Pulkovo 1942(58)\",DATUM[\"Pulkovo_1942_58\",SP"
+        "HEROID[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPS"
+        "G\",\"7024\"]],AUTHORITY[\"EPSG\",\"6179\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4179\"]]"},
+    {4180, "epsg", 4180,
         "EST97", 1, 1,
         "GRS 1980", "Greenwich",
         "Estonia_1997", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"EST97\",DATUM[\"Estonia_1997\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 1,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 2,
-        "],AUTHORITY[\"EPSG\",\"6180\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 4,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 5,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"418");
-    add_srs_wkt (p, 6,
-        "0\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4181, "epsg", 4181,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"EST97\",DATUM[\"Estonia_1997\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6180\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\","
+        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"418"
+        "0\"]]"},
+    {4181, "epsg", 4181,
         "Luxembourg 1930", 1, 1,
         "International 1924", "Greenwich",
         "Luxembourg_1930", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-189.6806,18.3463,-42");
-    add_proj4text (p, 1,
-        ".7695,-0.33746,-3.09264,2.53861,0.4598 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Luxembourg 1930\",DATUM[\"Luxembourg_1930\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"International 1924\",6378388,297,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7022\"]],AUTHORITY[\"EPSG\",\"6181\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4181\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4182, "epsg", 4182,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-189.6806,18.3463,-42"
+        ".7695,-0.33746,-3.09264,2.53861,0.4598 +no_defs",
+        "GEOGCS[\"Luxembourg 1930\",DATUM[\"Luxembourg_1930\",SPH"
+        "EROID[\"International 1924\",6378388,297,AUTHORITY[\"EPS"
+        "G\",\"7022\"]],AUTHORITY[\"EPSG\",\"6181\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4181\"]]"},
+    {4182, "epsg", 4182,
         "Azores Occidental 1939", 1, 1,
         "International 1924", "Greenwich",
         "Azores_Occidental_Islands_1939", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-425,-169,81,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Azores Occidental 1939\",DATUM[\"Azores_Occiden");
-    add_srs_wkt (p, 1,
-        "tal_Islands_1939\",SPHEROID[\"International 1924\",63783");
-    add_srs_wkt (p, 2,
-        "88,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6182\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 6,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"4182\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4183, "epsg", 4183,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-425,-169,81,0,0,0,0 "
+        "+no_defs",
+        "GEOGCS[\"Azores Occidental 1939\",DATUM[\"Azores_Occiden"
+        "tal_Islands_1939\",SPHEROID[\"International 1924\",63783"
+        "88,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\","
+        "\"6182\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu"
+        "de\",EAST],AUTHORITY[\"EPSG\",\"4182\"]]"},
+    {4183, "epsg", 4183,
         "Azores Central 1948", 1, 1,
         "International 1924", "Greenwich",
         "Azores_Central_Islands_1948", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-104,167,-38,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Azores Central 1948\",DATUM[\"Azores_Central_Is");
-    add_srs_wkt (p, 1,
-        "lands_1948\",SPHEROID[\"International 1924\",6378388,297");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6183");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 6,
-        "AST],AUTHORITY[\"EPSG\",\"4183\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4184, "epsg", 4184,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-104,167,-38,0,0,0,0 "
+        "+no_defs",
+        "GEOGCS[\"Azores Central 1948\",DATUM[\"Azores_Central_Is"
+        "lands_1948\",SPHEROID[\"International 1924\",6378388,297"
+        ",AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6183"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E"
+        "AST],AUTHORITY[\"EPSG\",\"4183\"]]"},
+    {4184, "epsg", 4184,
         "Azores Oriental 1940", 1, 1,
         "International 1924", "Greenwich",
         "Azores_Oriental_Islands_1940", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-203,141,53,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Azores Oriental 1940\",DATUM[\"Azores_Oriental_");
-    add_srs_wkt (p, 1,
-        "Islands_1940\",SPHEROID[\"International 1924\",6378388,2");
-    add_srs_wkt (p, 2,
-        "97,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"61");
-    add_srs_wkt (p, 3,
-        "84\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"4184\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4185, "epsg", 4185,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-203,141,53,0,0,0,0 +"
+        "no_defs",
+        "GEOGCS[\"Azores Oriental 1940\",DATUM[\"Azores_Oriental_"
+        "Islands_1940\",SPHEROID[\"International 1924\",6378388,2"
+        "97,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"61"
+        "84\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"4184\"]]"},
+    {4185, "epsg", 4185,
         "Madeira 1936 (deprecated)", 1, 1,
         "International 1924", "Greenwich",
         "Madeira_1936", "none", "degree minute second hemisphere",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Madeira 1936 (deprecated)\",DATUM[\"Madeira_193");
-    add_srs_wkt (p, 1,
-        "6\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6185\"]],PRIM");
-    add_srs_wkt (p, 3,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree minute second hemisphere\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4185\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4188, "epsg", 4188,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +no_defs",
+        "GEOGCS[\"Madeira 1936 (deprecated)\",DATUM[\"Madeira_193"
+        "6\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT"
+        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6185\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree minute second hemisphere\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9108\"]],AXIS[\"Latitude\",NORTH],AXIS"
+        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4185\"]]"},
+    {4188, "epsg", 4188,
         "OSNI 1952", 1, 1,
         "Airy 1830", "Greenwich",
         "OSNI_1952", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=airy +towgs84=482.5,-130.6,564.6,-1");
-    add_proj4text (p, 1,
-        ".042,-0.214,-0.631,8.15 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"OSNI 1952\",DATUM[\"OSNI_1952\",SPHEROID[\"Airy");
-    add_srs_wkt (p, 1,
-        " 1830\",6377563.396,299.3249646,AUTHORITY[\"EPSG\",\"700");
-    add_srs_wkt (p, 2,
-        "1\"]],AUTHORITY[\"EPSG\",\"6188\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4188\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4189, "epsg", 4189,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=airy +towgs84=482.5,-130.6,564.6,-1"
+        ".042,-0.214,-0.631,8.15 +no_defs",
+        "GEOGCS[\"OSNI 1952\",DATUM[\"OSNI_1952\",SPHEROID[\"Airy"
+        " 1830\",6377563.396,299.3249646,AUTHORITY[\"EPSG\",\"700"
+        "1\"]],AUTHORITY[\"EPSG\",\"6188\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "4188\"]]"},
+    {4189, "epsg", 4189,
         "REGVEN", 1, 1,
         "GRS 1980", "Greenwich",
         "Red_Geodesica_Venezolana", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"REGVEN\",DATUM[\"Red_Geodesica_Venezolana\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6189\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4189\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4190, "epsg", 4190,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"REGVEN\",DATUM[\"Red_Geodesica_Venezolana\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"6189\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4189\"]]"},
+    {4190, "epsg", 4190,
         "POSGAR 98", 1, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1998", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"POSGAR 98\",DATUM[\"Posiciones_Geodesicas_Argen");
-    add_srs_wkt (p, 1,
-        "tinas_1998\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6190");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 6,
-        "AST],AUTHORITY[\"EPSG\",\"4190\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4191, "epsg", 4191,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"POSGAR 98\",DATUM[\"Posiciones_Geodesicas_Argen"
+        "tinas_1998\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6190"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E"
+        "AST],AUTHORITY[\"EPSG\",\"4190\"]]"},
+    {4191, "epsg", 4191,
         "Albanian 1987", 1, 1,
         "Krassowsky 1940", "Greenwich",
         "Albanian_1987", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=krass +towgs84=-44.183,-0.58,-38.48");
-    add_proj4text (p, 1,
-        "9,2.3867,2.7072,-3.5196,-8.2703 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Albanian 1987\",DATUM[\"Albanian_1987\",SPHEROI");
-    add_srs_wkt (p, 1,
-        "D[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 2,
-        "7024\"]],AUTHORITY[\"EPSG\",\"6191\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 3,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 4,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 5,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4191\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4192, "epsg", 4192,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=krass +towgs84=-44.183,-0.58,-38.48"
+        "9,2.3867,2.7072,-3.5196,-8.2703 +no_defs",
+        "GEOGCS[\"Albanian 1987\",DATUM[\"Albanian_1987\",SPHEROI"
+        "D[\"Krassowsky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\""
+        "7024\"]],AUTHORITY[\"EPSG\",\"6191\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati"
+        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\""
+        ",\"4191\"]]"},
+    {4192, "epsg", 4192,
         "Douala 1948", 1, 1,
         "International 1924", "Greenwich",
         "Douala_1948", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-206.1,-174.7,-87.7,0");
-    add_proj4text (p, 1,
-        ",0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Douala 1948\",DATUM[\"Douala_1948\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "22\"]],AUTHORITY[\"EPSG\",\"6192\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4192\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4193, "epsg", 4193,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-206.1,-174.7,-87.7,0"
+        ",0,0,0 +no_defs",
+        "GEOGCS[\"Douala 1948\",DATUM[\"Douala_1948\",SPHEROID[\""
+        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70"
+        "22\"]],AUTHORITY[\"EPSG\",\"6192\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "4192\"]]"},
+    {4193, "epsg", 4193,
         "Manoca 1962", 1, 1,
         "Clarke 1880 (IGN)", "Greenwich",
         "Manoca_1962", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378249.2 +b=6356515 +towgs84=-70.9,-15");
-    add_proj4text (p, 1,
-        "1.8,-41.4,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Manoca 1962\",DATUM[\"Manoca_1962\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "Clarke 1880 (IGN)\",6378249.2,293.466021293627,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\",\"6193\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 4,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 5,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 6,
-        "RITY[\"EPSG\",\"4193\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4194, "epsg", 4194,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378249.2 +b=6356515 +towgs84=-70.9,-15"
+        "1.8,-41.4,0,0,0,0 +no_defs",
+        "GEOGCS[\"Manoca 1962\",DATUM[\"Manoca_1962\",SPHEROID[\""
+        "Clarke 1880 (IGN)\",6378249.2,293.466021293627,AUTHORITY"
+        "[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\",\"6193\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"4193\"]]"},
+    {4194, "epsg", 4194,
         "Qornoq 1927", 1, 1,
         "International 1924", "Greenwich",
         "Qornoq_1927", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=164,138,-189,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Qornoq 1927\",DATUM[\"Qornoq_1927\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "22\"]],AUTHORITY[\"EPSG\",\"6194\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4194\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4195, "epsg", 4195,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=164,138,-189,0,0,0,0 "
+        "+no_defs",
+        "GEOGCS[\"Qornoq 1927\",DATUM[\"Qornoq_1927\",SPHEROID[\""
+        "International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"70"
+        "22\"]],AUTHORITY[\"EPSG\",\"6194\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "4194\"]]"},
+    {4195, "epsg", 4195,
         "Scoresbysund 1952", 1, 1,
         "International 1924", "Greenwich",
         "Scoresbysund_1952", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=105,326,-102.5,0,0,0.");
-    add_proj4text (p, 1,
-        "814,-0.6 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Scoresbysund 1952\",DATUM[\"Scoresbysund_1952\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6195\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4195\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4196, "epsg", 4196,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=105,326,-102.5,0,0,0."
+        "814,-0.6 +no_defs",
+        "GEOGCS[\"Scoresbysund 1952\",DATUM[\"Scoresbysund_1952\""
+        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\""
+        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6195\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4195\"]]"},
+    {4196, "epsg", 4196,
         "Ammassalik 1958", 1, 1,
         "International 1924", "Greenwich",
         "Ammassalik_1958", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-45,417,-3.5,0,0,0.81");
-    add_proj4text (p, 1,
-        "4,-0.6 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Ammassalik 1958\",DATUM[\"Ammassalik_1958\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"International 1924\",6378388,297,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7022\"]],AUTHORITY[\"EPSG\",\"6196\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4196\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4197, "epsg", 4197,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-45,417,-3.5,0,0,0.81"
+        "4,-0.6 +no_defs",
+        "GEOGCS[\"Ammassalik 1958\",DATUM[\"Ammassalik_1958\",SPH"
+        "EROID[\"International 1924\",6378388,297,AUTHORITY[\"EPS"
+        "G\",\"7022\"]],AUTHORITY[\"EPSG\",\"6196\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"4196\"]]"},
+    {4197, "epsg", 4197,
         "Garoua", 1, 1,
         "Clarke 1880 (RGS)", "Greenwich",
         "Garoua", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Garoua\",DATUM[\"Garoua\",SPHEROID[\"Clarke 188");
-    add_srs_wkt (p, 1,
-        "0 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"");
-    add_srs_wkt (p, 2,
-        "]],AUTHORITY[\"EPSG\",\"6197\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 4,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 5,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41");
-    add_srs_wkt (p, 6,
-        "97\"]]");
-    p = add_epsg_def_ex (filter, first, last, 4198, "epsg", 4198,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk80 +no_defs",
+        "GEOGCS[\"Garoua\",DATUM[\"Garoua\",SPHEROID[\"Clarke 188"
+        "0 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\""
+        "]],AUTHORITY[\"EPSG\",\"6197\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"41"
+        "97\"]]"},
+    {4198, "epsg", 4198,
         "Kousseri", 1, 1,
         "Clarke 1880 (RGS)", "Greenwich",
         "Kousseri", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Kousseri\",DATUM[\"Kousseri\",SPHEROID[\"Clarke");
-    add_srs_wkt (p, 1,
-        " 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 2,
-        "012\"]],AUTHORITY[\"EPSG\",\"6198\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 3,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 4,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit");
-    add_srs_wkt (p, 5,
-        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4198\"]]");
-}
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk80 +no_defs",
+        "GEOGCS[\"Kousseri\",DATUM[\"Kousseri\",SPHEROID[\"Clarke"
+        " 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7"
+        "012\"]],AUTHORITY[\"EPSG\",\"6198\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latit"
+        "ude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\""
+        ",\"4198\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_19 = {
+    epsg_defs_19, sizeof (epsg_defs_19) / sizeof (epsg_defs_19[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
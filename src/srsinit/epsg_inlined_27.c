@@ -53,3455 +53,1986 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_27 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 5295, "epsg", 5295,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_27[] = {
+    {5295, "epsg", 5295,
         "DRUKREF 03 / Gasa TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.03333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Gasa TM\",GEOGCS[\"DRUKREF 03\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",90.0333333333333],PARAMETER[\"scale_factor\",1],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"false_easting\",250000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"5295\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5296, "epsg", 5296,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=90.03333333333333 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Gasa TM\",GEOGCS[\"DRUKREF 03\",DA"
+        "TUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",90.0333333333333],PARAMETER[\"scale_factor\",1],PARAMET"
+        "ER[\"false_easting\",250000],PARAMETER[\"false_northing\""
+        ",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"5295\"]]"},
+    {5296, "epsg", 5296,
         "DRUKREF 03 / Ha TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.15000000000001 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Ha TM\",GEOGCS[\"DRUKREF 03\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 8,
-        "0.15],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",250000],PARAMETER[\"false_northing\",-2500000],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"5296\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5297, "epsg", 5297,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=90.15000000000001 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Ha TM\",GEOGCS[\"DRUKREF 03\",DATU"
+        "M[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9"
+        "0.15],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",250000],PARAMETER[\"false_northing\",-2500000],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"5296\"]]"},
+    {5297, "epsg", 5297,
         "DRUKREF 03 / Lhuentse TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=91.13333333333334 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Lhuentse TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",91.1333333333333],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"5297\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5298, "epsg", 5298,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=91.13333333333334 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Lhuentse TM\",GEOGCS[\"DRUKREF 03\""
+        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",91.1333333333333],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin"
+        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"5297\"]]"},
+    {5298, "epsg", 5298,
         "DRUKREF 03 / Mongar TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=91.23333333333333 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Mongar TM\",GEOGCS[\"DRUKREF 03\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",91.2333333333333],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"5298\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5299, "epsg", 5299,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=91.23333333333333 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Mongar TM\",GEOGCS[\"DRUKREF 03\","
+        "DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",91.2333333333333],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin"
+        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"5298\"]]"},
+    {5299, "epsg", 5299,
         "DRUKREF 03 / Paro TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=89.34999999999999 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Paro TM\",GEOGCS[\"DRUKREF 03\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",89.35],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",250000],PARAMETER[\"false_northing\",-2500000]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 11,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"5299\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5300, "epsg", 5300,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=89.34999999999999 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Paro TM\",GEOGCS[\"DRUKREF 03\",DA"
+        "TUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",89.35],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_"
+        "easting\",250000],PARAMETER[\"false_northing\",-2500000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"5299\"]]"},
+    {5300, "epsg", 5300,
         "DRUKREF 03 / Pemagatshel TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=91.34999999999999 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Pemagatshel TM\",GEOGCS[\"DRUKREF ");
-    add_srs_wkt (p, 1,
-        "03\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",91.35],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",250000],PARAMETER[\"false_northing\",-25");
-    add_srs_wkt (p, 10,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5300\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5301, "epsg", 5301,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=91.34999999999999 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Pemagatshel TM\",GEOGCS[\"DRUKREF "
+        "03\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",91.35],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",250000],PARAMETER[\"false_northing\",-25"
+        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"5300\"]]"},
+    {5301, "epsg", 5301,
         "DRUKREF 03 / Punakha TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=89.84999999999999 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Punakha TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",89.85],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",250000],PARAMETER[\"false_northing\",-250000");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"5301\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5302, "epsg", 5302,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=89.84999999999999 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Punakha TM\",GEOGCS[\"DRUKREF 03\""
+        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",89.85],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",250000],PARAMETER[\"false_northing\",-250000"
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"5301\"]]"},
+    {5302, "epsg", 5302,
         "DRUKREF 03 / Samdrup Jongkhar TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=91.56666666666666 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Samdrup Jongkhar TM\",GEOGCS[\"DRU");
-    add_srs_wkt (p, 1,
-        "KREF 03\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",91.5666666666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",1],PARAMETER[\"false_easting\",250000],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_northing\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 12,
-        "ORTH],AUTHORITY[\"EPSG\",\"5302\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5303, "epsg", 5303,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=91.56666666666666 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Samdrup Jongkhar TM\",GEOGCS[\"DRU"
+        "KREF 03\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",91.5666666666667],PARAMETER[\"scale_factor\""
+        ",1],PARAMETER[\"false_easting\",250000],PARAMETER[\"fals"
+        "e_northing\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"5302\"]]"},
+    {5303, "epsg", 5303,
         "DRUKREF 03 / Samtse TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=89.06666666666666 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Samtse TM\",GEOGCS[\"DRUKREF 03\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",89.0666666666667],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"5303\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5304, "epsg", 5304,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=89.06666666666666 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Samtse TM\",GEOGCS[\"DRUKREF 03\","
+        "DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",89.0666666666667],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin"
+        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"5303\"]]"},
+    {5304, "epsg", 5304,
         "DRUKREF 03 / Sarpang TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.26666666666667 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Sarpang TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",90.2666666666667],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"5304\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5305, "epsg", 5305,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=90.26666666666667 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Sarpang TM\",GEOGCS[\"DRUKREF 03\""
+        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",90.2666666666667],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin"
+        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"5304\"]]"},
+    {5305, "epsg", 5305,
         "DRUKREF 03 / Thimphu TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=89.55 +k=1 +x_0=250000 +y_0=");
-    add_proj4text (p, 1,
-        "-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Thimphu TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",89.55],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",250000],PARAMETER[\"false_northing\",-250000");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"5305\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5306, "epsg", 5306,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=89.55 +k=1 +x_0=250000 +y_0="
+        "-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"DRUKREF 03 / Thimphu TM\",GEOGCS[\"DRUKREF 03\""
+        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",89.55],PARAMETER[\"scale_factor\",1],PARAMETER[\"fals"
+        "e_easting\",250000],PARAMETER[\"false_northing\",-250000"
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"5305\"]]"},
+    {5306, "epsg", 5306,
         "DRUKREF 03 / Trashigang TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=91.75 +k=1 +x_0=250000 +y_0=");
-    add_proj4text (p, 1,
-        "-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Trashigang TM\",GEOGCS[\"DRUKREF 0");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",91.75],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",250000],PARAMETER[\"false_northing\",-25");
-    add_srs_wkt (p, 10,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5306\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5307, "epsg", 5307,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=91.75 +k=1 +x_0=250000 +y_0="
+        "-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"DRUKREF 03 / Trashigang TM\",GEOGCS[\"DRUKREF 0"
+        "3\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",91.75],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",250000],PARAMETER[\"false_northing\",-25"
+        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"5306\"]]"},
+    {5307, "epsg", 5307,
         "DRUKREF 03 / Trongsa TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.5 +k=1 +x_0=250000 +y_0=-");
-    add_proj4text (p, 1,
-        "2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Trongsa TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",90.5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",250000],PARAMETER[\"false_northing\",-2500000");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"5307\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5308, "epsg", 5308,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=90.5 +k=1 +x_0=250000 +y_0=-"
+        "2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"DRUKREF 03 / Trongsa TM\",GEOGCS[\"DRUKREF 03\""
+        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",90.5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false"
+        "_easting\",250000],PARAMETER[\"false_northing\",-2500000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"5307\"]]"},
+    {5308, "epsg", 5308,
         "DRUKREF 03 / Tsirang TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.16666666666667 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Tsirang TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",90.1666666666667],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"5308\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5309, "epsg", 5309,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=90.16666666666667 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Tsirang TM\",GEOGCS[\"DRUKREF 03\""
+        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",90.1666666666667],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin"
+        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"5308\"]]"},
+    {5309, "epsg", 5309,
         "DRUKREF 03 / Wangdue Phodrang TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.11666666666666 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Wangdue Phodrang TM\",GEOGCS[\"DRU");
-    add_srs_wkt (p, 1,
-        "KREF 03\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",90.1166666666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",1],PARAMETER[\"false_easting\",250000],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_northing\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 12,
-        "ORTH],AUTHORITY[\"EPSG\",\"5309\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5310, "epsg", 5310,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=90.11666666666666 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Wangdue Phodrang TM\",GEOGCS[\"DRU"
+        "KREF 03\",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHER"
+        "OID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5264\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",90.1166666666667],PARAMETER[\"scale_factor\""
+        ",1],PARAMETER[\"false_easting\",250000],PARAMETER[\"fals"
+        "e_northing\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"5309\"]]"},
+    {5310, "epsg", 5310,
         "DRUKREF 03 / Yangtse TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=91.56666666666666 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Yangtse TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",91.5666666666667],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"5310\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5311, "epsg", 5311,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=91.56666666666666 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Yangtse TM\",GEOGCS[\"DRUKREF 03\""
+        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",91.5666666666667],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin"
+        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"5310\"]]"},
+    {5311, "epsg", 5311,
         "DRUKREF 03 / Zhemgang TM", 0, 0,
         "GRS 1980", "Greenwich",
         "Bhutan_National_Geodetic_Datum", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=90.86666666666666 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DRUKREF 03 / Zhemgang TM\",GEOGCS[\"DRUKREF 03\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS");
-    add_srs_wkt (p, 2,
-        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",90.8666666666667],PARAMETER[\"scale_factor\",1],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 11,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"5311\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5316, "epsg", 5316,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=90.86666666666666 +k=1 +x_0="
+        "250000 +y_0=-2500000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"DRUKREF 03 / Zhemgang TM\",GEOGCS[\"DRUKREF 03\""
+        ",DATUM[\"Bhutan_National_Geodetic_Datum\",SPHEROID[\"GRS"
+        " 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1058\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5264\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",90.8666666666667],PARAMETER[\"scale_factor\",1],PARAM"
+        "ETER[\"false_easting\",250000],PARAMETER[\"false_northin"
+        "g\",-2500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"5311\"]]"},
+    {5316, "epsg", 5316,
         "ETRS89 / Faroe TM", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-7 +k=0.999997 +x_0=200000 +");
-    add_proj4text (p, 1,
-        "y_0=-6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / Faroe TM\",GEOGCS[\"ETRS89\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Terrestrial_Reference_System_1989\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701");
-    add_srs_wkt (p, 3,
-        "9\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-7],PARAMETER[\"scale_factor\",0.999997],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",200000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",-6000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"5316\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5318, "epsg", 5318,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-7 +k=0.999997 +x_0=200000 +"
+        "y_0=-6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"ETRS89 / Faroe TM\",GEOGCS[\"ETRS89\",DATUM[\"E"
+        "uropean_Terrestrial_Reference_System_1989\",SPHEROID[\"G"
+        "RS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"701"
+        "9\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"4258\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",-7],PARAMETER[\"scale_factor\",0.999997],PARAMETE"
+        "R[\"false_easting\",200000],PARAMETER[\"false_northing\""
+        ",-6000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"5316\"]]"},
+    {5318, "epsg", 5318,
         "ETRS89 / Faroe TM", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-7 +k=0.999997 +x_0=200000 +");
-    add_proj4text (p, 1,
-        "y_0=-6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 / Faroe TM + FVR09 height\",PROJCS[\"E");
-    add_srs_wkt (p, 1,
-        "TRS89 / Faroe TM\",GEOGCS[\"ETRS89\",DATUM[\"European_Te");
-    add_srs_wkt (p, 2,
-        "rrestrial_Reference_System_1989\",SPHEROID[\"GRS 1980\",");
-    add_srs_wkt (p, 3,
-        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 6,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"425");
-    add_srs_wkt (p, 7,
-        "8\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",0],PARAMETER[\"central_meridian\",-7]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.999997],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",200000],PARAMETER[\"false_northing\",-6000000]");
-    add_srs_wkt (p, 11,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 12,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"5316\"]],VERT_CS[\"FVR09 height\",VERT_DATUM[\"Faro");
-    add_srs_wkt (p, 14,
-        "e Islands Vertical Reference 2009\",2005,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 15,
-        "G\",\"1059\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 16,
-        "1\"]],AXIS[\"Gravity-related height\",UP],AUTHORITY[\"EP");
-    add_srs_wkt (p, 17,
-        "SG\",\"5317\"]],AUTHORITY[\"EPSG\",\"5318\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5320, "epsg", 5320,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-7 +k=0.999997 +x_0=200000 +"
+        "y_0=-6000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +vunits=m +no_defs",
+        "COMPD_CS[\"ETRS89 / Faroe TM + FVR09 height\",PROJCS[\"E"
+        "TRS89 / Faroe TM\",GEOGCS[\"ETRS89\",DATUM[\"European_Te"
+        "rrestrial_Reference_System_1989\",SPHEROID[\"GRS 1980\","
+        "6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTH"
+        "ORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"425"
+        "8\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",0],PARAMETER[\"central_meridian\",-7]"
+        ",PARAMETER[\"scale_factor\",0.999997],PARAMETER[\"false_"
+        "easting\",200000],PARAMETER[\"false_northing\",-6000000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"5316\"]],VERT_CS[\"FVR09 height\",VERT_DATUM[\"Faro"
+        "e Islands Vertical Reference 2009\",2005,AUTHORITY[\"EPS"
+        "G\",\"1059\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Gravity-related height\",UP],AUTHORITY[\"EP"
+        "SG\",\"5317\"]],AUTHORITY[\"EPSG\",\"5318\"]]"},
+    {5320, "epsg", 5320,
         "NAD83 / Teranet Ontario Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.5 +lat_2=54.5 +lat_0=0 +lon_0=-84 +x");
-    add_proj4text (p, 1,
-        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Teranet Ontario Lambert\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-84],PARAMETER[\"standard_parallel_1\",44.5],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_2\",54.5],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",1000000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "5320\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5321, "epsg", 5321,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.5 +lat_2=54.5 +lat_0=0 +lon_0=-84 +x"
+        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83 / Teranet Ontario Lambert\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"],"
+        "PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central_"
+        "meridian\",-84],PARAMETER[\"standard_parallel_1\",44.5],"
+        "PARAMETER[\"standard_parallel_2\",54.5],PARAMETER[\"fals"
+        "e_easting\",1000000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "5320\"]]"},
+    {5321, "epsg", 5321,
         "NAD83(CSRS) / Teranet Ontario Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.5 +lat_2=54.5 +lat_0=0 +lon_0=-84 +x");
-    add_proj4text (p, 1,
-        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Teranet Ontario Lambert\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",0],PARAMETER[\"central_meridian\",-84],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_1\",44.5],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",54.5],PARAMETER[\"false_easting\",1000000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"5321\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5323, "epsg", 5323,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.5 +lat_2=54.5 +lat_0=0 +lon_0=-84 +x"
+        "_0=1000000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(CSRS) / Teranet Ontario Lambert\",GEOGCS["
+        "\"NAD83(CSRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference"
+        "_System\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",0],PARAMETER[\"central_meridian\",-84],PARAMETER[\"st"
+        "andard_parallel_1\",44.5],PARAMETER[\"standard_parallel_"
+        "2\",54.5],PARAMETER[\"false_easting\",1000000],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"5321\"]]"},
+    {5323, "epsg", 5323,
         "ISN2004", 1, 1,
         "GRS 1980", "Greenwich",
         "Islands_Net_2004", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"ISN2004\",DATUM[\"Islands Net 2004\",ELLIPSOID");
-    add_srs_wkt (p, 1,
-        "[\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\"");
-    add_srs_wkt (p, 2,
-        ",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174");
-    add_srs_wkt (p, 3,
-        "532925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitud");
-    add_srs_wkt (p, 4,
-        "e (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[");
-    add_srs_wkt (p, 6,
-        "2],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"elli");
-    add_srs_wkt (p, 7,
-        "psoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]");
-    add_srs_wkt (p, 8,
-        "],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Iceland - onshore and");
-    add_srs_wkt (p, 9,
-        " offshore.\"],BBOX[59.96,-30.87,69.59,-5.55]],ID[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",5323]]");
-    p = add_epsg_def_ex (filter, first, last, 5324, "epsg", 5324,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"ISN2004\",DATUM[\"Islands Net 2004\",ELLIPSOID"
+        "[\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\""
+        ",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174"
+        "532925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitud"
+        "e (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.01745329"
+        "25199433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER["
+        "2],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"elli"
+        "psoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]"
+        "],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Iceland - onshore and"
+        " offshore.\"],BBOX[59.96,-30.87,69.59,-5.55]],ID[\"EPSG\""
+        ",5323]]"},
+    {5324, "epsg", 5324,
         "ISN2004", 1, 1,
         "GRS 1980", "Greenwich",
         "Islands_Net_2004", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ISN2004\",DATUM[\"Islands_Net_2004\",SPHEROID[\"");
-    add_srs_wkt (p, 1,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "19\"]],AUTHORITY[\"EPSG\",\"1060\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "5324\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5325, "epsg", 5325,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"ISN2004\",DATUM[\"Islands_Net_2004\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"1060\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "5324\"]]"},
+    {5325, "epsg", 5325,
         "ISN2004 / Lambert 2004", 0, 0,
         "GRS 1980", "Greenwich",
         "Islands_Net_2004", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=64.25 +lat_2=65.75 +lat_0=65 +lon_0=-19");
-    add_proj4text (p, 1,
-        " +x_0=1700000 +y_0=300000 +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ISN2004 / Lambert 2004\",GEOGCS[\"ISN2004\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Islands_Net_2004\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 2,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"1060\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5324\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",65],PARAMETER[\"central_meridian\",-19],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"standard_parallel_1\",64.25],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_2\",65.75],PARAMETER[\"false_easting\",17");
-    add_srs_wkt (p, 10,
-        "00000],PARAMETER[\"false_northing\",300000],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5325\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5329, "epsg", 5329,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=64.25 +lat_2=65.75 +lat_0=65 +lon_0=-19"
+        " +x_0=1700000 +y_0=300000 +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"ISN2004 / Lambert 2004\",GEOGCS[\"ISN2004\",DAT"
+        "UM[\"Islands_Net_2004\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"1060\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5324\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",65],PARAMETER[\"central_meridian\",-19],"
+        "PARAMETER[\"standard_parallel_1\",64.25],PARAMETER[\"sta"
+        "ndard_parallel_2\",65.75],PARAMETER[\"false_easting\",17"
+        "00000],PARAMETER[\"false_northing\",300000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5325\"]]"},
+    {5329, "epsg", 5329,
         "Segara (Jakarta) / NEIEZ", 0, 0,
         "Bessel 1841", "Jakarta",
         "Gunung_Segara_Jakarta", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=3.192280555555556 +k=0.997 +x_0=390000");
-    add_proj4text (p, 1,
-        "0 +y_0=900000 +ellps=bessel +towgs84=-403,684,41,0,0,0,0");
-    add_proj4text (p, 2,
-        " +pm=jakarta +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Segara (Jakarta) / NEIEZ\",GEOGCS[\"Segara (Jak");
-    add_srs_wkt (p, 1,
-        "arta)\",DATUM[\"Gunung_Segara_Jakarta\",SPHEROID[\"Besse");
-    add_srs_wkt (p, 2,
-        "l 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "04\"]],AUTHORITY[\"EPSG\",\"6820\"]],PRIMEM[\"Jakarta\",");
-    add_srs_wkt (p, 4,
-        "106.807719444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"de");
-    add_srs_wkt (p, 5,
-        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"4820\"]],PROJECTION[\"Mercator_1SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",3.19228055555556],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"scale_factor\",0.997],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",3900000],PARAMETER[\"false_northing\",900000],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 11,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5329\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 5330, "epsg", 5330,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=3.192280555555556 +k=0.997 +x_0=390000"
+        "0 +y_0=900000 +ellps=bessel +towgs84=-403,684,41,0,0,0,0"
+        " +pm=jakarta +units=m +no_defs",
+        "PROJCS[\"Segara (Jakarta) / NEIEZ\",GEOGCS[\"Segara (Jak"
+        "arta)\",DATUM[\"Gunung_Segara_Jakarta\",SPHEROID[\"Besse"
+        "l 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"70"
+        "04\"]],AUTHORITY[\"EPSG\",\"6820\"]],PRIMEM[\"Jakarta\","
+        "106.807719444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"de"
+        "gree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],"
+        "AUTHORITY[\"EPSG\",\"4820\"]],PROJECTION[\"Mercator_1SP\""
+        "],PARAMETER[\"central_meridian\",3.19228055555556],PARAM"
+        "ETER[\"scale_factor\",0.997],PARAMETER[\"false_easting\""
+        ",3900000],PARAMETER[\"false_northing\",900000],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5329\""
+        "]]"},
+    {5330, "epsg", 5330,
         "Batavia (Jakarta) / NEIEZ", 0, 0,
         "Bessel 1841", "Jakarta",
         "Batavia_Jakarta", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=3.192280555555556 +k=0.997 +x_0=390000");
-    add_proj4text (p, 1,
-        "0 +y_0=900000 +ellps=bessel +towgs84=-377,681,-50,0,0,0,");
-    add_proj4text (p, 2,
-        "0 +pm=jakarta +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Batavia (Jakarta) / NEIEZ\",GEOGCS[\"Batavia (J");
-    add_srs_wkt (p, 1,
-        "akarta)\",DATUM[\"Batavia_Jakarta\",SPHEROID[\"Bessel 18");
-    add_srs_wkt (p, 2,
-        "41\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6813\"]],PRIMEM[\"Jakarta\",106.");
-    add_srs_wkt (p, 4,
-        "807719444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4813\"]],PROJECTION[\"Mercator_1SP\"],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"central_meridian\",3.19228055555556],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.997],PARAMETER[\"false_easting\",39");
-    add_srs_wkt (p, 9,
-        "00000],PARAMETER[\"false_northing\",900000],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5330\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5331, "epsg", 5331,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=3.192280555555556 +k=0.997 +x_0=390000"
+        "0 +y_0=900000 +ellps=bessel +towgs84=-377,681,-50,0,0,0,"
+        "0 +pm=jakarta +units=m +no_defs",
+        "PROJCS[\"Batavia (Jakarta) / NEIEZ\",GEOGCS[\"Batavia (J"
+        "akarta)\",DATUM[\"Batavia_Jakarta\",SPHEROID[\"Bessel 18"
+        "41\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\""
+        "]],AUTHORITY[\"EPSG\",\"6813\"]],PRIMEM[\"Jakarta\",106."
+        "807719444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4813\"]],PROJECTION[\"Mercator_1SP\"],P"
+        "ARAMETER[\"central_meridian\",3.19228055555556],PARAMETE"
+        "R[\"scale_factor\",0.997],PARAMETER[\"false_easting\",39"
+        "00000],PARAMETER[\"false_northing\",900000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5330\"]]"},
+    {5331, "epsg", 5331,
         "Makassar (Jakarta) / NEIEZ", 0, 0,
         "Bessel 1841", "Jakarta",
         "Makassar_Jakarta", "Mercator_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=merc +lon_0=3.192280555555556 +k=0.997 +x_0=390000");
-    add_proj4text (p, 1,
-        "0 +y_0=900000 +ellps=bessel +towgs84=-587.8,519.75,145.7");
-    add_proj4text (p, 2,
-        "6,0,0,0,0 +pm=jakarta +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Makassar (Jakarta) / NEIEZ\",GEOGCS[\"Makassar ");
-    add_srs_wkt (p, 1,
-        "(Jakarta)\",DATUM[\"Makassar_Jakarta\",SPHEROID[\"Bessel");
-    add_srs_wkt (p, 2,
-        " 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"700");
-    add_srs_wkt (p, 3,
-        "4\"]],AUTHORITY[\"EPSG\",\"6804\"]],PRIMEM[\"Jakarta\",1");
-    add_srs_wkt (p, 4,
-        "06.807719444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"deg");
-    add_srs_wkt (p, 5,
-        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A");
-    add_srs_wkt (p, 6,
-        "UTHORITY[\"EPSG\",\"4804\"]],PROJECTION[\"Mercator_1SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",3.19228055555556],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"scale_factor\",0.997],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",3900000],PARAMETER[\"false_northing\",900000],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 11,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5331\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 5337, "epsg", 5337,
+        "Easting", "East", "Northing", "North",
+        "+proj=merc +lon_0=3.192280555555556 +k=0.997 +x_0=390000"
+        "0 +y_0=900000 +ellps=bessel +towgs84=-587.8,519.75,145.7"
+        "6,0,0,0,0 +pm=jakarta +units=m +no_defs",
+        "PROJCS[\"Makassar (Jakarta) / NEIEZ\",GEOGCS[\"Makassar "
+        "(Jakarta)\",DATUM[\"Makassar_Jakarta\",SPHEROID[\"Bessel"
+        " 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"700"
+        "4\"]],AUTHORITY[\"EPSG\",\"6804\"]],PRIMEM[\"Jakarta\",1"
+        "06.807719444444,AUTHORITY[\"EPSG\",\"8908\"]],UNIT[\"deg"
+        "ree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],A"
+        "UTHORITY[\"EPSG\",\"4804\"]],PROJECTION[\"Mercator_1SP\""
+        "],PARAMETER[\"central_meridian\",3.19228055555556],PARAM"
+        "ETER[\"scale_factor\",0.997],PARAMETER[\"false_easting\""
+        ",3900000],PARAMETER[\"false_northing\",900000],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5331\""
+        "]]"},
+    {5337, "epsg", 5337,
         "Aratu / UTM zone 25S", 0, 0,
         "International 1924", "Greenwich",
         "Aratu", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +south +ellps=intl +towgs84=-151.99,2");
-    add_proj4text (p, 1,
-        "87.04,-147.45,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Aratu / UTM zone 25S\",GEOGCS[\"Aratu\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Aratu\",SPHEROID[\"International 1924\",6378388,297,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6208\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AUTHORITY[\"EPSG\",\"4208\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 6,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"central_meridian\",-33],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 8,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"5337\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5340, "epsg", 5340,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=25 +south +ellps=intl +towgs84=-151.99,2"
+        "87.04,-147.45,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Aratu / UTM zone 25S\",GEOGCS[\"Aratu\",DATUM[\""
+        "Aratu\",SPHEROID[\"International 1924\",6378388,297,AUTH"
+        "ORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6208\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"4208\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARA"
+        "METER[\"central_meridian\",-33],PARAMETER[\"scale_factor"
+        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER"
+        "[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"5337\"]]"},
+    {5340, "epsg", 5340,
         "POSGAR 2007", 1, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"POSGAR 2007\",DATUM[\"Posiciones_Geodesicas_Arg");
-    add_srs_wkt (p, 1,
-        "entinas_2007\",SPHEROID[\"WGS 84\",6378137,298.257223563");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1062");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E");
-    add_srs_wkt (p, 6,
-        "AST],AUTHORITY[\"EPSG\",\"5340\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5342, "epsg", 5342,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"POSGAR 2007\",DATUM[\"Posiciones_Geodesicas_Arg"
+        "entinas_2007\",SPHEROID[\"WGS 84\",6378137,298.257223563"
+        ",AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1062"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",E"
+        "AST],AUTHORITY[\"EPSG\",\"5340\"]]"},
+    {5342, "epsg", 5342,
         "POSGAR 2007", 1, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"POSGAR 2007\",DATUM[\"Posiciones Geodesicas Ar");
-    add_srs_wkt (p, 1,
-        "gentinas 2007\",ELLIPSOID[\"WGS 84\",6378137,298.2572235");
-    add_srs_wkt (p, 2,
-        "63,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGL");
-    add_srs_wkt (p, 3,
-        "EUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal,3],");
-    add_srs_wkt (p, 4,
-        "AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGLEUNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433]],AXIS[\"geodetic longit");
-    add_srs_wkt (p, 6,
-        "ude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 7,
-        "925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],");
-    add_srs_wkt (p, 8,
-        "LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[");
-    add_srs_wkt (p, 9,
-        "\"Argentina - onshore and offshore.\"],BBOX[-58.41,-73.5");
-    add_srs_wkt (p, 10,
-        "9,-21.78,-52.63]],ID[\"EPSG\",5342]]");
-    p = add_epsg_def_ex (filter, first, last, 5343, "epsg", 5343,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCRS[\"POSGAR 2007\",DATUM[\"Posiciones Geodesicas Ar"
+        "gentinas 2007\",ELLIPSOID[\"WGS 84\",6378137,298.2572235"
+        "63,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGL"
+        "EUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal,3],"
+        "AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGLEUNI"
+        "T[\"degree\",0.0174532925199433]],AXIS[\"geodetic longit"
+        "ude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532"
+        "925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],"
+        "LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA["
+        "\"Argentina - onshore and offshore.\"],BBOX[-58.41,-73.5"
+        "9,-21.78,-52.63]],ID[\"EPSG\",5342]]"},
+    {5343, "epsg", 5343,
         "POSGAR 2007 / Argentina 1", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 2007 / Argentina 1\",GEOGCS[\"POSGAR 200");
-    add_srs_wkt (p, 1,
-        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-72],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",1500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5343\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5344, "epsg", 5344,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 2007 / Argentina 1\",GEOGCS[\"POSGAR 200"
+        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE"
+        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\""
+        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent"
+        "ral_meridian\",-72],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",1500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"5343\"]]"},
+    {5344, "epsg", 5344,
         "POSGAR 2007 / Argentina 2", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 2007 / Argentina 2\",GEOGCS[\"POSGAR 200");
-    add_srs_wkt (p, 1,
-        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-69],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",2500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5344\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5345, "epsg", 5345,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 2007 / Argentina 2\",GEOGCS[\"POSGAR 200"
+        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE"
+        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\""
+        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent"
+        "ral_meridian\",-69],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",2500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"5344\"]]"},
+    {5345, "epsg", 5345,
         "POSGAR 2007 / Argentina 3", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 2007 / Argentina 3\",GEOGCS[\"POSGAR 200");
-    add_srs_wkt (p, 1,
-        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-66],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",3500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5345\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5346, "epsg", 5346,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 2007 / Argentina 3\",GEOGCS[\"POSGAR 200"
+        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE"
+        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\""
+        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent"
+        "ral_meridian\",-66],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",3500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"5345\"]]"},
+    {5346, "epsg", 5346,
         "POSGAR 2007 / Argentina 4", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 2007 / Argentina 4\",GEOGCS[\"POSGAR 200");
-    add_srs_wkt (p, 1,
-        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-63],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",4500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5346\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5347, "epsg", 5347,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 2007 / Argentina 4\",GEOGCS[\"POSGAR 200"
+        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE"
+        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\""
+        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent"
+        "ral_meridian\",-63],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",4500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"5346\"]]"},
+    {5347, "epsg", 5347,
         "POSGAR 2007 / Argentina 5", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 2007 / Argentina 5\",GEOGCS[\"POSGAR 200");
-    add_srs_wkt (p, 1,
-        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-60],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",5500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5347\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5348, "epsg", 5348,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 2007 / Argentina 5\",GEOGCS[\"POSGAR 200"
+        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE"
+        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\""
+        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent"
+        "ral_meridian\",-60],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",5500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"5347\"]]"},
+    {5348, "epsg", 5348,
         "POSGAR 2007 / Argentina 6", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 2007 / Argentina 6\",GEOGCS[\"POSGAR 200");
-    add_srs_wkt (p, 1,
-        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-57],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",6500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5348\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5349, "epsg", 5349,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 2007 / Argentina 6\",GEOGCS[\"POSGAR 200"
+        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE"
+        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\""
+        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent"
+        "ral_meridian\",-57],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",6500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"5348\"]]"},
+    {5349, "epsg", 5349,
         "POSGAR 2007 / Argentina 7", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 2007 / Argentina 7\",GEOGCS[\"POSGAR 200");
-    add_srs_wkt (p, 1,
-        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-54],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",7500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"5349\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5353, "epsg", 5353,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 2007 / Argentina 7\",GEOGCS[\"POSGAR 200"
+        "7\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPHE"
+        "ROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\""
+        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",-90],PARAMETER[\"cent"
+        "ral_meridian\",-54],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",7500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"5349\"]]"},
+    {5353, "epsg", 5353,
         "MARGEN", 1, 1,
         "GRS 1980", "Greenwich",
         "Marco_Geodesico_Nacional_de_Bolivia", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"MARGEN\",DATUM[\"Marco Geodesico Nacional de B");
-    add_srs_wkt (p, 1,
-        "olivia\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LE");
-    add_srs_wkt (p, 2,
-        "NGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT");
-    add_srs_wkt (p, 3,
-        "[\"degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[");
-    add_srs_wkt (p, 4,
-        "\"geodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433]],AXIS[\"geodetic longitude (");
-    add_srs_wkt (p, 6,
-        "Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 7,
-        "9433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGT");
-    add_srs_wkt (p, 8,
-        "HUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Bol");
-    add_srs_wkt (p, 9,
-        "ivia.\"],BBOX[-22.91,-69.66,-9.67,-57.52]],ID[\"EPSG\",5");
-    add_srs_wkt (p, 10,
-        "353]]");
-    p = add_epsg_def_ex (filter, first, last, 5354, "epsg", 5354,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"MARGEN\",DATUM[\"Marco Geodesico Nacional de B"
+        "olivia\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LE"
+        "NGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT"
+        "[\"degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS["
+        "\"geodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"d"
+        "egree\",0.0174532925199433]],AXIS[\"geodetic longitude ("
+        "Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519"
+        "9433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGT"
+        "HUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Bol"
+        "ivia.\"],BBOX[-22.91,-69.66,-9.67,-57.52]],ID[\"EPSG\",5"
+        "353]]"},
+    {5354, "epsg", 5354,
         "MARGEN", 1, 1,
         "GRS 1980", "Greenwich",
         "Marco_Geodesico_Nacional_de_Bolivia", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MARGEN\",DATUM[\"Marco_Geodesico_Nacional_de_Bo");
-    add_srs_wkt (p, 1,
-        "livia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1063\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"5354\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5355, "epsg", 5355,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"MARGEN\",DATUM[\"Marco_Geodesico_Nacional_de_Bo"
+        "livia\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1063\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],"
+        "AUTHORITY[\"EPSG\",\"5354\"]]"},
+    {5355, "epsg", 5355,
         "MARGEN / UTM zone 20S", 0, 0,
         "GRS 1980", "Greenwich",
         "Marco_Geodesico_Nacional_de_Bolivia", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MARGEN / UTM zone 20S\",GEOGCS[\"MARGEN\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Marco_Geodesico_Nacional_de_Bolivia\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1063\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5354\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"5355\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5356, "epsg", 5356,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"MARGEN / UTM zone 20S\",GEOGCS[\"MARGEN\",DATUM"
+        "[\"Marco_Geodesico_Nacional_de_Bolivia\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1063\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5354\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5355\"]]"},
+    {5356, "epsg", 5356,
         "MARGEN / UTM zone 19S", 0, 0,
         "GRS 1980", "Greenwich",
         "Marco_Geodesico_Nacional_de_Bolivia", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MARGEN / UTM zone 19S\",GEOGCS[\"MARGEN\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Marco_Geodesico_Nacional_de_Bolivia\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1063\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5354\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-69],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"5356\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5357, "epsg", 5357,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"MARGEN / UTM zone 19S\",GEOGCS[\"MARGEN\",DATUM"
+        "[\"Marco_Geodesico_Nacional_de_Bolivia\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1063\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5354\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-69],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5356\"]]"},
+    {5357, "epsg", 5357,
         "MARGEN / UTM zone 21S", 0, 0,
         "GRS 1980", "Greenwich",
         "Marco_Geodesico_Nacional_de_Bolivia", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MARGEN / UTM zone 21S\",GEOGCS[\"MARGEN\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Marco_Geodesico_Nacional_de_Bolivia\",SPHEROID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1063\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5354\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"5357\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5359, "epsg", 5359,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"MARGEN / UTM zone 21S\",GEOGCS[\"MARGEN\",DATUM"
+        "[\"Marco_Geodesico_Nacional_de_Bolivia\",SPHEROID[\"GRS "
+        "1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\""
+        "]],AUTHORITY[\"EPSG\",\"1063\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5354\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5357\"]]"},
+    {5359, "epsg", 5359,
         "SIRGAS-Chile 2002", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_1_epoch_2002", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"SIRGAS-Chile 2002\",DATUM[\"SIRGAS-Chile reali");
-    add_srs_wkt (p, 1,
-        "zation 1 epoch 2002\",ELLIPSOID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoi");
-    add_srs_wkt (p, 4,
-        "dal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],A");
-    add_srs_wkt (p, 5,
-        "NGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic");
-    add_srs_wkt (p, 6,
-        " longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.");
-    add_srs_wkt (p, 7,
-        "0174532925199433]],AXIS[\"ellipsoidal height (h)\",up,OR");
-    add_srs_wkt (p, 8,
-        "DER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"");
-    add_srs_wkt (p, 9,
-        "],AREA[\"Chile - onshore and offshore. Includes Easter I");
-    add_srs_wkt (p, 10,
-        "sland, Juan Fernandez Islands, San Felix, and Sala y Gom");
-    add_srs_wkt (p, 11,
-        "ez.\"],BBOX[-59.87,-113.21,-17.5,-65.72]],ID[\"EPSG\",53");
-    add_srs_wkt (p, 12,
-        "59]]");
-    p = add_epsg_def_ex (filter, first, last, 5360, "epsg", 5360,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"SIRGAS-Chile 2002\",DATUM[\"SIRGAS-Chile reali"
+        "zation 1 epoch 2002\",ELLIPSOID[\"GRS 1980\",6378137,298"
+        ".257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\""
+        ",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoi"
+        "dal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],A"
+        "NGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic"
+        " longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0."
+        "0174532925199433]],AXIS[\"ellipsoidal height (h)\",up,OR"
+        "DER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\""
+        "],AREA[\"Chile - onshore and offshore. Includes Easter I"
+        "sland, Juan Fernandez Islands, San Felix, and Sala y Gom"
+        "ez.\"],BBOX[-59.87,-113.21,-17.5,-65.72]],ID[\"EPSG\",53"
+        "59]]"},
+    {5360, "epsg", 5360,
         "SIRGAS-Chile 2002", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_1_epoch_2002", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIRGAS-Chile 2002\",DATUM[\"SIRGAS-Chile_realiz");
-    add_srs_wkt (p, 1,
-        "ation_1_epoch_2002\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 2,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"1064\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"5360\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5361, "epsg", 5361,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"SIRGAS-Chile 2002\",DATUM[\"SIRGAS-Chile_realiz"
+        "ation_1_epoch_2002\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1064\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit"
+        "ude\",EAST],AUTHORITY[\"EPSG\",\"5360\"]]"},
+    {5361, "epsg", 5361,
         "SIRGAS-Chile 2002 / UTM zone 19S", 0, 0,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_1_epoch_2002", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS-Chile 2002 / UTM zone 19S\",GEOGCS[\"SIR");
-    add_srs_wkt (p, 1,
-        "GAS-Chile 2002\",DATUM[\"SIRGAS-Chile_realization_1_epoc");
-    add_srs_wkt (p, 2,
-        "h_2002\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1064\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"5360\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-69],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"5361\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5362, "epsg", 5362,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"SIRGAS-Chile 2002 / UTM zone 19S\",GEOGCS[\"SIR"
+        "GAS-Chile 2002\",DATUM[\"SIRGAS-Chile_realization_1_epoc"
+        "h_2002\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1064\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"5360\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",-69],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"5361\"]]"},
+    {5362, "epsg", 5362,
         "SIRGAS-Chile 2002 / UTM zone 18S", 0, 0,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_1_epoch_2002", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS-Chile 2002 / UTM zone 18S\",GEOGCS[\"SIR");
-    add_srs_wkt (p, 1,
-        "GAS-Chile 2002\",DATUM[\"SIRGAS-Chile_realization_1_epoc");
-    add_srs_wkt (p, 2,
-        "h_2002\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1064\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"5360\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-75],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"5362\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5364, "epsg", 5364,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"SIRGAS-Chile 2002 / UTM zone 18S\",GEOGCS[\"SIR"
+        "GAS-Chile 2002\",DATUM[\"SIRGAS-Chile_realization_1_epoc"
+        "h_2002\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1064\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"5360\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",-75],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"5362\"]]"},
+    {5364, "epsg", 5364,
         "CR05", 1, 1,
         "WGS 84", "Greenwich",
         "Costa_Rica_2005", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"CR05\",DATUM[\"Costa Rica 2005\",ELLIPSOID[\"W");
-    add_srs_wkt (p, 1,
-        "GS 84\",6378137,298.257223563,LENGTHUNIT[\"metre\",1]]],");
-    add_srs_wkt (p, 2,
-        "PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 3,
-        "199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (Lat");
-    add_srs_wkt (p, 4,
-        ")\",north,ORDER[1],ANGLEUNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],ANG");
-    add_srs_wkt (p, 6,
-        "LEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellipsoida");
-    add_srs_wkt (p, 7,
-        "l height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAG");
-    add_srs_wkt (p, 8,
-        "E[SCOPE[\"Geodesy.\"],AREA[\"Costa Rica - onshore and of");
-    add_srs_wkt (p, 9,
-        "fshore.\"],BBOX[2.15,-90.45,11.77,-81.43]],ID[\"EPSG\",5");
-    add_srs_wkt (p, 10,
-        "364]]");
-    p = add_epsg_def_ex (filter, first, last, 5365, "epsg", 5365,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCRS[\"CR05\",DATUM[\"Costa Rica 2005\",ELLIPSOID[\"W"
+        "GS 84\",6378137,298.257223563,LENGTHUNIT[\"metre\",1]]],"
+        "PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174532925"
+        "199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (Lat"
+        ")\",north,ORDER[1],ANGLEUNIT[\"degree\",0.01745329251994"
+        "33]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],ANG"
+        "LEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellipsoida"
+        "l height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAG"
+        "E[SCOPE[\"Geodesy.\"],AREA[\"Costa Rica - onshore and of"
+        "fshore.\"],BBOX[2.15,-90.45,11.77,-81.43]],ID[\"EPSG\",5"
+        "364]]"},
+    {5365, "epsg", 5365,
         "CR05", 1, 1,
         "WGS 84", "Greenwich",
         "Costa_Rica_2005", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"CR05\",DATUM[\"Costa_Rica_2005\",SPHEROID[\"WGS");
-    add_srs_wkt (p, 1,
-        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]");
-    add_srs_wkt (p, 2,
-        "],AUTHORITY[\"EPSG\",\"1065\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 4,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",");
-    add_srs_wkt (p, 5,
-        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"536");
-    add_srs_wkt (p, 6,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5367, "epsg", 5367,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"CR05\",DATUM[\"Costa_Rica_2005\",SPHEROID[\"WGS"
+        " 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]"
+        "],AUTHORITY[\"EPSG\",\"1065\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\","
+        "NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"536"
+        "5\"]]"},
+    {5367, "epsg", 5367,
         "CR05 / CRTM05", 0, 1,
         "WGS 84", "Greenwich",
         "Costa_Rica_2005", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-84 +k=0.9999 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CR05 / CRTM05\",GEOGCS[\"CR05\",DATUM[\"Costa_R");
-    add_srs_wkt (p, 1,
-        "ica_2005\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1065\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"5365\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"central_meridian\",-84],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 8,
-        "r\",0.9999],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 10,
-        "G\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AUTHORITY[\"EPSG\",\"5367\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5370, "epsg", 5370,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-84 +k=0.9999 +x_0=500000 +y"
+        "_0=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"CR05 / CRTM05\",GEOGCS[\"CR05\",DATUM[\"Costa_R"
+        "ica_2005\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT"
+        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1065\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"5365\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",-84],PARAMETER[\"scale_facto"
+        "r\",0.9999],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS"
+        "G\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\""
+        ",EAST],AUTHORITY[\"EPSG\",\"5367\"]]"},
+    {5370, "epsg", 5370,
         "MACARIO SOLIS", 1, 1,
         "GRS 1980", "Greenwich",
         "Sistema_Geodesico_Nacional_de_Panama_MACARIO_SOLIS", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"MACARIO SOLIS\",DATUM[\"Sistema Geodesico Naci");
-    add_srs_wkt (p, 1,
-        "onal de Panama MACARIO SOLIS\",ELLIPSOID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"G");
-    add_srs_wkt (p, 3,
-        "reenwich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],C");
-    add_srs_wkt (p, 4,
-        "S[ellipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,");
-    add_srs_wkt (p, 5,
-        "ORDER[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[");
-    add_srs_wkt (p, 6,
-        "\"geodetic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"d");
-    add_srs_wkt (p, 7,
-        "egree\",0.0174532925199433]],AXIS[\"ellipsoidal height (");
-    add_srs_wkt (p, 8,
-        "h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"");
-    add_srs_wkt (p, 9,
-        "Geodesy.\"],AREA[\"Panama - onshore and offshore.\"],BBO");
-    add_srs_wkt (p, 10,
-        "X[5,-84.32,12.51,-77.04]],ID[\"EPSG\",5370]]");
-    p = add_epsg_def_ex (filter, first, last, 5371, "epsg", 5371,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"MACARIO SOLIS\",DATUM[\"Sistema Geodesico Naci"
+        "onal de Panama MACARIO SOLIS\",ELLIPSOID[\"GRS 1980\",63"
+        "78137,298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"G"
+        "reenwich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],C"
+        "S[ellipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,"
+        "ORDER[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS["
+        "\"geodetic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"d"
+        "egree\",0.0174532925199433]],AXIS[\"ellipsoidal height ("
+        "h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\""
+        "Geodesy.\"],AREA[\"Panama - onshore and offshore.\"],BBO"
+        "X[5,-84.32,12.51,-77.04]],ID[\"EPSG\",5370]]"},
+    {5371, "epsg", 5371,
         "MACARIO SOLIS", 1, 1,
         "GRS 1980", "Greenwich",
         "Sistema_Geodesico_Nacional_de_Panama_MACARIO_SOLIS", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MACARIO SOLIS\",DATUM[\"Sistema_Geodesico_Nacio");
-    add_srs_wkt (p, 1,
-        "nal_de_Panama_MACARIO_SOLIS\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"1066\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5371\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5372, "epsg", 5372,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"MACARIO SOLIS\",DATUM[\"Sistema_Geodesico_Nacio"
+        "nal_de_Panama_MACARIO_SOLIS\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"1066\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS"
+        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5371\"]]"},
+    {5372, "epsg", 5372,
         "Peru96", 1, 1,
         "GRS 1980", "Greenwich",
         "Peru96", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"Peru96\",DATUM[\"Peru96\",ELLIPSOID[\"GRS 1980");
-    add_srs_wkt (p, 1,
-        "\",6378137,298.257222101,LENGTHUNIT[\"metre\",1]]],PRIME");
-    add_srs_wkt (p, 2,
-        "M[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 3,
-        "3]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (Lat)\",n");
-    add_srs_wkt (p, 4,
-        "orth,ORDER[1],ANGLEUNIT[\"degree\",0.0174532925199433]],");
-    add_srs_wkt (p, 5,
-        "AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],ANGLEUNI");
-    add_srs_wkt (p, 6,
-        "T[\"degree\",0.0174532925199433]],AXIS[\"ellipsoidal hei");
-    add_srs_wkt (p, 7,
-        "ght (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCO");
-    add_srs_wkt (p, 8,
-        "PE[\"Geodesy.\"],AREA[\"Peru - onshore and offshore.\"],");
-    add_srs_wkt (p, 9,
-        "BBOX[-21.05,-84.68,-0.03,-68.67]],ID[\"EPSG\",5372]]");
-    p = add_epsg_def_ex (filter, first, last, 5373, "epsg", 5373,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"Peru96\",DATUM[\"Peru96\",ELLIPSOID[\"GRS 1980"
+        "\",6378137,298.257222101,LENGTHUNIT[\"metre\",1]]],PRIME"
+        "M[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.017453292519943"
+        "3]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (Lat)\",n"
+        "orth,ORDER[1],ANGLEUNIT[\"degree\",0.0174532925199433]],"
+        "AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],ANGLEUNI"
+        "T[\"degree\",0.0174532925199433]],AXIS[\"ellipsoidal hei"
+        "ght (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCO"
+        "PE[\"Geodesy.\"],AREA[\"Peru - onshore and offshore.\"],"
+        "BBOX[-21.05,-84.68,-0.03,-68.67]],ID[\"EPSG\",5372]]"},
+    {5373, "epsg", 5373,
         "Peru96", 1, 1,
         "GRS 1980", "Greenwich",
         "Peru96", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Peru96\",DATUM[\"Peru96\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 1,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"1067\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 4,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5373\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5380, "epsg", 5380,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Peru96\",DATUM[\"Peru96\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"1067\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH"
+        "],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"5373\"]]"},
+    {5380, "epsg", 5380,
         "SIRGAS-ROU98", 1, 1,
         "WGS 84", "Greenwich",
         "SIRGAS-ROU98", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"SIRGAS-ROU98\",DATUM[\"SIRGAS-ROU98\",ELLIPSOI");
-    add_srs_wkt (p, 1,
-        "D[\"WGS 84\",6378137,298.257223563,LENGTHUNIT[\"metre\",");
-    add_srs_wkt (p, 2,
-        "1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 3,
-        "32925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude");
-    add_srs_wkt (p, 4,
-        " (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2");
-    add_srs_wkt (p, 6,
-        "],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellip");
-    add_srs_wkt (p, 7,
-        "soidal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]]");
-    add_srs_wkt (p, 8,
-        ",USAGE[SCOPE[\"Geodesy.\"],AREA[\"Uruguay - onshore and ");
-    add_srs_wkt (p, 9,
-        "offshore.\"],BBOX[-37.77,-58.49,-30.09,-50.01]],ID[\"EPS");
-    add_srs_wkt (p, 10,
-        "G\",5380]]");
-    p = add_epsg_def_ex (filter, first, last, 5381, "epsg", 5381,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"SIRGAS-ROU98\",DATUM[\"SIRGAS-ROU98\",ELLIPSOI"
+        "D[\"WGS 84\",6378137,298.257223563,LENGTHUNIT[\"metre\","
+        "1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.01745"
+        "32925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude"
+        " (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.017453292"
+        "5199433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2"
+        "],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellip"
+        "soidal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]]"
+        ",USAGE[SCOPE[\"Geodesy.\"],AREA[\"Uruguay - onshore and "
+        "offshore.\"],BBOX[-37.77,-58.49,-30.09,-50.01]],ID[\"EPS"
+        "G\",5380]]"},
+    {5381, "epsg", 5381,
         "SIRGAS-ROU98", 1, 1,
         "WGS 84", "Greenwich",
         "SIRGAS-ROU98", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIRGAS-ROU98\",DATUM[\"SIRGAS-ROU98\",SPHEROID[");
-    add_srs_wkt (p, 1,
-        "\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 2,
-        "30\"]],AUTHORITY[\"EPSG\",\"1068\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 4,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud");
-    add_srs_wkt (p, 5,
-        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "5381\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5382, "epsg", 5382,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"SIRGAS-ROU98\",DATUM[\"SIRGAS-ROU98\",SPHEROID["
+        "\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"70"
+        "30\"]],AUTHORITY[\"EPSG\",\"1068\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitud"
+        "e\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "5381\"]]"},
+    {5382, "epsg", 5382,
         "SIRGAS-ROU98 / UTM zone 21S", 0, 0,
         "WGS 84", "Greenwich",
         "SIRGAS-ROU98", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=WGS84 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS-ROU98 / UTM zone 21S\",GEOGCS[\"SIRGAS-R");
-    add_srs_wkt (p, 1,
-        "OU98\",DATUM[\"SIRGAS-ROU98\",SPHEROID[\"WGS 84\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"1068\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5381\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",-57],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"538");
-    add_srs_wkt (p, 12,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5383, "epsg", 5383,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +south +ellps=WGS84 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"SIRGAS-ROU98 / UTM zone 21S\",GEOGCS[\"SIRGAS-R"
+        "OU98\",DATUM[\"SIRGAS-ROU98\",SPHEROID[\"WGS 84\",637813"
+        "7,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY["
+        "\"EPSG\",\"1068\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5381\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",-57],PARA"
+        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"538"
+        "2\"]]"},
+    {5383, "epsg", 5383,
         "SIRGAS-ROU98 / UTM zone 22S", 0, 0,
         "WGS 84", "Greenwich",
         "SIRGAS-ROU98", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +south +ellps=WGS84 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS-ROU98 / UTM zone 22S\",GEOGCS[\"SIRGAS-R");
-    add_srs_wkt (p, 1,
-        "OU98\",DATUM[\"SIRGAS-ROU98\",SPHEROID[\"WGS 84\",637813");
-    add_srs_wkt (p, 2,
-        "7,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[");
-    add_srs_wkt (p, 3,
-        "\"EPSG\",\"1068\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 5,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5381\"]],");
-    add_srs_wkt (p, 6,
-        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_origin\",0],PARAMETER[\"central_meridian\",-51],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"538");
-    add_srs_wkt (p, 12,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5387, "epsg", 5387,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +south +ellps=WGS84 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"SIRGAS-ROU98 / UTM zone 22S\",GEOGCS[\"SIRGAS-R"
+        "OU98\",DATUM[\"SIRGAS-ROU98\",SPHEROID[\"WGS 84\",637813"
+        "7,298.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY["
+        "\"EPSG\",\"1068\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5381\"]],"
+        "PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude"
+        "_of_origin\",0],PARAMETER[\"central_meridian\",-51],PARA"
+        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"538"
+        "3\"]]"},
+    {5387, "epsg", 5387,
         "Peru96 / UTM zone 18S", 0, 0,
         "GRS 1980", "Greenwich",
         "Peru96", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Peru96 / UTM zone 18S\",GEOGCS[\"Peru96\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Peru96\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1067\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"5373\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 6,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"central_meridian\",-75],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"5387\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5388, "epsg", 5388,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Peru96 / UTM zone 18S\",GEOGCS[\"Peru96\",DATUM"
+        "[\"Peru96\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1067\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"5373\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-75],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"5387\"]]"},
+    {5388, "epsg", 5388,
         "Peru96 / UTM zone 17S", 0, 0,
         "GRS 1980", "Greenwich",
         "Peru96", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Peru96 / UTM zone 17S\",GEOGCS[\"Peru96\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Peru96\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1067\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"5373\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 6,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"central_meridian\",-81],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"5839\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5389, "epsg", 5389,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Peru96 / UTM zone 17S\",GEOGCS[\"Peru96\",DATUM"
+        "[\"Peru96\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1067\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"5373\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-81],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"5839\"]]"},
+    {5389, "epsg", 5389,
         "Peru96 / UTM zone 19S", 0, 0,
         "GRS 1980", "Greenwich",
         "Peru96", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Peru96 / UTM zone 19S\",GEOGCS[\"Peru96\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Peru96\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1067\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"5373\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 6,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"central_meridian\",-69],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 8,
-        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"5389\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5392, "epsg", 5392,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Peru96 / UTM zone 19S\",GEOGCS[\"Peru96\",DATUM"
+        "[\"Peru96\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1067\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"5373\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],P"
+        "ARAMETER[\"central_meridian\",-69],PARAMETER[\"scale_fac"
+        "tor\",0.9996],PARAMETER[\"false_easting\",500000],PARAME"
+        "TER[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"5389\"]]"},
+    {5392, "epsg", 5392,
         "SIRGAS_ES2007.8", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS_ES2007_8", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"SIRGAS_ES2007.8\",DATUM[\"SIRGAS_ES2007.8\",EL");
-    add_srs_wkt (p, 1,
-        "LIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"");
-    add_srs_wkt (p, 2,
-        "metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\"");
-    add_srs_wkt (p, 3,
-        ",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geodetic ");
-    add_srs_wkt (p, 4,
-        "latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.0");
-    add_srs_wkt (p, 5,
-        "174532925199433]],AXIS[\"geodetic longitude (Lon)\",east");
-    add_srs_wkt (p, 6,
-        ",ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS");
-    add_srs_wkt (p, 7,
-        "[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"met");
-    add_srs_wkt (p, 8,
-        "re\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"El Salvador - ");
-    add_srs_wkt (p, 9,
-        "onshore and offshore.\"],BBOX[9.97,-91.43,14.44,-87.65]]");
-    add_srs_wkt (p, 10,
-        ",ID[\"EPSG\",5392]]");
-    p = add_epsg_def_ex (filter, first, last, 5393, "epsg", 5393,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"SIRGAS_ES2007.8\",DATUM[\"SIRGAS_ES2007.8\",EL"
+        "LIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\""
+        "metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\""
+        ",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geodetic "
+        "latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.0"
+        "174532925199433]],AXIS[\"geodetic longitude (Lon)\",east"
+        ",ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS"
+        "[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"met"
+        "re\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"El Salvador - "
+        "onshore and offshore.\"],BBOX[9.97,-91.43,14.44,-87.65]]"
+        ",ID[\"EPSG\",5392]]"},
+    {5393, "epsg", 5393,
         "SIRGAS_ES2007.8", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS_ES2007_8", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIRGAS_ES2007.8\",DATUM[\"SIRGAS_ES2007_8\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"1069\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"5393\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5396, "epsg", 5396,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"SIRGAS_ES2007.8\",DATUM[\"SIRGAS_ES2007_8\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"1069\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"5393\"]]"},
+    {5396, "epsg", 5396,
         "SIRGAS 2000 / UTM zone 26S", 0, 0,
         "GRS 1980", "Greenwich",
         "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=26 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 26S\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "674\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4674\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"central_meridian\",-27],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5396\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5451, "epsg", 5451,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=26 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"SIRGAS 2000 / UTM zone 26S\",GEOGCS[\"SIRGAS 20"
+        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_"
+        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "674\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4674\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-27],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5396\"]]"},
+    {5451, "epsg", 5451,
         "Ocotepeque 1935", 1, 1,
         "Clarke 1866", "Greenwich",
         "Ocotepeque_1935", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +towgs84=205,96,-98,0,0,0,0 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Ocotepeque 1935\",DATUM[\"Ocotepeque_1935\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORI");
-    add_srs_wkt (p, 2,
-        "TY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRI");
-    add_srs_wkt (p, 3,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"5451\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5456, "epsg", 5456,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +towgs84=205,96,-98,0,0,0,0 "
+        "+no_defs",
+        "GEOGCS[\"Ocotepeque 1935\",DATUM[\"Ocotepeque_1935\",SPH"
+        "EROID[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORI"
+        "TY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH"
+        "ORITY[\"EPSG\",\"5451\"]]"},
+    {5456, "epsg", 5456,
         "Ocotepeque 1935 / Costa Rica Norte", 0, 0,
         "Clarke 1866", "Greenwich",
         "Ocotepeque_1935", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=10.46666666666667 +lat_0=10.46666666666");
-    add_proj4text (p, 1,
-        "667 +lon_0=-84.33333333333333 +k_0=0.99995696 +x_0=50000");
-    add_proj4text (p, 2,
-        "0 +y_0=271820.522 +ellps=clrk66 +towgs84=205,96,-98,0,0,");
-    add_proj4text (p, 3,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ocotepeque 1935 / Costa Rica Norte\",GEOGCS[\"O");
-    add_srs_wkt (p, 1,
-        "cotepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Cl");
-    add_srs_wkt (p, 2,
-        "arke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",10.4666666666");
-    add_srs_wkt (p, 8,
-        "667],PARAMETER[\"central_meridian\",-84.3333333333333],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",0.99995696],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",500000],PARAMETER[\"false_northing\",271820.52");
-    add_srs_wkt (p, 11,
-        "2],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"5456\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5457, "epsg", 5457,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=10.46666666666667 +lat_0=10.46666666666"
+        "667 +lon_0=-84.33333333333333 +k_0=0.99995696 +x_0=50000"
+        "0 +y_0=271820.522 +ellps=clrk66 +towgs84=205,96,-98,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Ocotepeque 1935 / Costa Rica Norte\",GEOGCS[\"O"
+        "cotepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Cl"
+        "arke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\""
+        ",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",10.4666666666"
+        "667],PARAMETER[\"central_meridian\",-84.3333333333333],P"
+        "ARAMETER[\"scale_factor\",0.99995696],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",271820.52"
+        "2],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"5456\"]]"},
+    {5457, "epsg", 5457,
         "Ocotepeque 1935 / Costa Rica Sur", 0, 0,
         "Clarke 1866", "Greenwich",
         "Ocotepeque_1935", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=9 +lat_0=9 +lon_0=-83.66666666666667 +k");
-    add_proj4text (p, 1,
-        "_0=0.99995696 +x_0=500000 +y_0=327987.436 +ellps=clrk66 ");
-    add_proj4text (p, 2,
-        "+towgs84=205,96,-98,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ocotepeque 1935 / Costa Rica Sur\",GEOGCS[\"Oco");
-    add_srs_wkt (p, 1,
-        "tepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 7,
-        "c_1SP\"],PARAMETER[\"latitude_of_origin\",9],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-83.6666666666667],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.99995696],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_northing\",327987.436],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5457\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5458, "epsg", 5458,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=9 +lat_0=9 +lon_0=-83.66666666666667 +k"
+        "_0=0.99995696 +x_0=500000 +y_0=327987.436 +ellps=clrk66 "
+        "+towgs84=205,96,-98,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Ocotepeque 1935 / Costa Rica Sur\",GEOGCS[\"Oco"
+        "tepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Clar"
+        "ke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\","
+        "\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Coni"
+        "c_1SP\"],PARAMETER[\"latitude_of_origin\",9],PARAMETER[\""
+        "central_meridian\",-83.6666666666667],PARAMETER[\"scale_"
+        "factor\",0.99995696],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",327987.436],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5457\"]]"},
+    {5458, "epsg", 5458,
         "Ocotepeque 1935 / Guatemala Norte", 0, 0,
         "Clarke 1866", "Greenwich",
         "Ocotepeque_1935", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=16.81666666666667 +lat_0=16.81666666666");
-    add_proj4text (p, 1,
-        "667 +lon_0=-90.33333333333333 +k_0=0.99992226 +x_0=50000");
-    add_proj4text (p, 2,
-        "0 +y_0=292209.579 +datum=NAD27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ocotepeque 1935 / Guatemala Norte\",GEOGCS[\"Oc");
-    add_srs_wkt (p, 1,
-        "otepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",16.8166666666");
-    add_srs_wkt (p, 8,
-        "667],PARAMETER[\"central_meridian\",-90.3333333333333],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",0.99992226],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",500000],PARAMETER[\"false_northing\",292209.57");
-    add_srs_wkt (p, 11,
-        "9],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"5559\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5459, "epsg", 5459,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=16.81666666666667 +lat_0=16.81666666666"
+        "667 +lon_0=-90.33333333333333 +k_0=0.99992226 +x_0=50000"
+        "0 +y_0=292209.579 +datum=NAD27 +units=m +no_defs",
+        "PROJCS[\"Ocotepeque 1935 / Guatemala Norte\",GEOGCS[\"Oc"
+        "otepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Cla"
+        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\""
+        ",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",16.8166666666"
+        "667],PARAMETER[\"central_meridian\",-90.3333333333333],P"
+        "ARAMETER[\"scale_factor\",0.99992226],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",292209.57"
+        "9],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"5559\"]]"},
+    {5459, "epsg", 5459,
         "Ocotepeque 1935 / Guatemala Sur", 0, 0,
         "Clarke 1866", "Greenwich",
         "Ocotepeque_1935", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=14.9 +lat_0=14.9 +lon_0=-90.33333333333");
-    add_proj4text (p, 1,
-        "333 +k_0=0.99989906 +x_0=500000 +y_0=325992.681 +ellps=c");
-    add_proj4text (p, 2,
-        "lrk66 +towgs84=205,96,-98,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ocotepeque 1935 / Guatemala Sur\",GEOGCS[\"Ocot");
-    add_srs_wkt (p, 1,
-        "epeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Clark");
-    add_srs_wkt (p, 2,
-        "e 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Conic_1");
-    add_srs_wkt (p, 7,
-        "SP\"],PARAMETER[\"latitude_of_origin\",14.9],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-90.3333333333333],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.99989906],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_northing\",325992.681],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5459\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5460, "epsg", 5460,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=14.9 +lat_0=14.9 +lon_0=-90.33333333333"
+        "333 +k_0=0.99989906 +x_0=500000 +y_0=325992.681 +ellps=c"
+        "lrk66 +towgs84=205,96,-98,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Ocotepeque 1935 / Guatemala Sur\",GEOGCS[\"Ocot"
+        "epeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Clark"
+        "e 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\""
+        "7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Conic_1"
+        "SP\"],PARAMETER[\"latitude_of_origin\",14.9],PARAMETER[\""
+        "central_meridian\",-90.3333333333333],PARAMETER[\"scale_"
+        "factor\",0.99989906],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",325992.681],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5459\"]]"},
+    {5460, "epsg", 5460,
         "Ocotepeque 1935 / El Salvador Lambert", 0, 0,
         "Clarke 1866", "Greenwich",
         "Ocotepeque_1935", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=13.78333333333333 +lat_0=13.78333333333");
-    add_proj4text (p, 1,
-        "333 +lon_0=-89 +k_0=0.99996704 +x_0=500000 +y_0=295809.1");
-    add_proj4text (p, 2,
-        "84 +ellps=clrk66 +towgs84=205,96,-98,0,0,0,0 +units=m +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ocotepeque 1935 / El Salvador Lambert\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Ocotepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 4,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_1SP\"],PARAMETER[\"latitude_of_origin\",13.78333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-89],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.99996704],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",295809.184],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5460\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 5461, "epsg", 5461,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=13.78333333333333 +lat_0=13.78333333333"
+        "333 +lon_0=-89 +k_0=0.99996704 +x_0=500000 +y_0=295809.1"
+        "84 +ellps=clrk66 +towgs84=205,96,-98,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"Ocotepeque 1935 / El Salvador Lambert\",GEOGCS["
+        "\"Ocotepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\""
+        "Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPS"
+        "G\",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_1SP\"],PARAMETER[\"latitude_of_origin\",13.78333333"
+        "33333],PARAMETER[\"central_meridian\",-89],PARAMETER[\"s"
+        "cale_factor\",0.99996704],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",295809.184],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5460\""
+        "]]"},
+    {5461, "epsg", 5461,
         "Ocotepeque 1935 / Nicaragua Norte", 0, 0,
         "Clarke 1866", "Greenwich",
         "Ocotepeque_1935", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=13.86666666666667 +lat_0=13.86666666666");
-    add_proj4text (p, 1,
-        "667 +lon_0=-85.5 +k_0=0.99990314 +x_0=500000 +y_0=359891");
-    add_proj4text (p, 2,
-        ".816 +ellps=clrk66 +towgs84=205,96,-98,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ocotepeque 1935 / Nicaragua Norte\",GEOGCS[\"Oc");
-    add_srs_wkt (p, 1,
-        "otepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",13.8666666666");
-    add_srs_wkt (p, 8,
-        "667],PARAMETER[\"central_meridian\",-85.5],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.99990314],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",359891.816],UNIT[\"me");
-    add_srs_wkt (p, 11,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5461\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 5462, "epsg", 5462,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=13.86666666666667 +lat_0=13.86666666666"
+        "667 +lon_0=-85.5 +k_0=0.99990314 +x_0=500000 +y_0=359891"
+        ".816 +ellps=clrk66 +towgs84=205,96,-98,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"Ocotepeque 1935 / Nicaragua Norte\",GEOGCS[\"Oc"
+        "otepeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Cla"
+        "rke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\""
+        ",\"7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",13.8666666666"
+        "667],PARAMETER[\"central_meridian\",-85.5],PARAMETER[\"s"
+        "cale_factor\",0.99990314],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",359891.816],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5461\""
+        "]]"},
+    {5462, "epsg", 5462,
         "Ocotepeque 1935 / Nicaragua Sur", 0, 0,
         "Clarke 1866", "Greenwich",
         "Ocotepeque_1935", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=11.73333333333333 +lat_0=11.73333333333");
-    add_proj4text (p, 1,
-        "333 +lon_0=-85.5 +k_0=0.9999222800000001 +x_0=500000 +y_");
-    add_proj4text (p, 2,
-        "0=288876.327 +ellps=clrk66 +towgs84=205,96,-98,0,0,0,0 +");
-    add_proj4text (p, 3,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Ocotepeque 1935 / Nicaragua Sur\",GEOGCS[\"Ocot");
-    add_srs_wkt (p, 1,
-        "epeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Clark");
-    add_srs_wkt (p, 2,
-        "e 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Conic_1");
-    add_srs_wkt (p, 7,
-        "SP\"],PARAMETER[\"latitude_of_origin\",11.7333333333333]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"central_meridian\",-85.5],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.99992228],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",288876.327],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5462\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5463, "epsg", 5463,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=11.73333333333333 +lat_0=11.73333333333"
+        "333 +lon_0=-85.5 +k_0=0.9999222800000001 +x_0=500000 +y_"
+        "0=288876.327 +ellps=clrk66 +towgs84=205,96,-98,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Ocotepeque 1935 / Nicaragua Sur\",GEOGCS[\"Ocot"
+        "epeque 1935\",DATUM[\"Ocotepeque_1935\",SPHEROID[\"Clark"
+        "e 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG\",\""
+        "7008\"]],AUTHORITY[\"EPSG\",\"1070\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"5451\"]],PROJECTION[\"Lambert_Conformal_Conic_1"
+        "SP\"],PARAMETER[\"latitude_of_origin\",11.7333333333333]"
+        ",PARAMETER[\"central_meridian\",-85.5],PARAMETER[\"scale"
+        "_factor\",0.99992228],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",288876.327],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5462\"]]"},
+    {5463, "epsg", 5463,
         "SAD69 / UTM zone 17N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=aust_SA +towgs84=-66.87,4.37,-");
-    add_proj4text (p, 1,
-        "38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 17N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-81],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5463\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5464, "epsg", 5464,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=aust_SA +towgs84=-66.87,4.37,-"
+        "38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 17N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-81],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"5463\"]]"},
+    {5464, "epsg", 5464,
         "Sibun Gorge 1922", 1, 1,
         "Clarke 1858", "Greenwich",
         "Sibun_Gorge_1922", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6378293.645208759 +b=6356617.987679838 ");
-    add_proj4text (p, 1,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Sibun Gorge 1922\",DATUM[\"Sibun_Gorge_1922\",S");
-    add_srs_wkt (p, 1,
-        "PHEROID[\"Clarke 1858\",6378293.64520876,294.26067636926");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"107");
-    add_srs_wkt (p, 3,
-        "1\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"5464\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5466, "epsg", 5466,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6378293.645208759 +b=6356617.987679838 "
+        "+no_defs",
+        "GEOGCS[\"Sibun Gorge 1922\",DATUM[\"Sibun_Gorge_1922\",S"
+        "PHEROID[\"Clarke 1858\",6378293.64520876,294.26067636926"
+        "1,AUTHORITY[\"EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"107"
+        "1\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"5464\"]]"},
+    {5466, "epsg", 5466,
         "Sibun Gorge 1922 / Colony Grid", 0, 0,
         "Clarke 1858", "Greenwich",
         "Sibun_Gorge_1922", "Transverse_Mercator", "Clarke's foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=17.06124194444444 +lon_0=-88.6318575 ");
-    add_proj4text (p, 1,
-        "+k=1 +x_0=66220.02833082761 +y_0=135779.5099885299 +a=63");
-    add_proj4text (p, 2,
-        "78293.645208759 +b=6356617.987679838 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Sibun Gorge 1922 / Colony Grid\",GEOGCS[\"Sibun");
-    add_srs_wkt (p, 1,
-        " Gorge 1922\",DATUM[\"Sibun_Gorge_1922\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1858\",6378293.64520876,294.260676369261,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"1071\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"5464\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",17.0612419444444");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-88.6318575],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",217259.2");
-    add_srs_wkt (p, 10,
-        "6],PARAMETER[\"false_northing\",445474.83],UNIT[\"Clarke");
-    add_srs_wkt (p, 11,
-        "'s foot\",0.3047972654,AUTHORITY[\"EPSG\",\"9005\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"5589\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5467, "epsg", 5467,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=17.06124194444444 +lon_0=-88.6318575 "
+        "+k=1 +x_0=66220.02833082761 +y_0=135779.5099885299 +a=63"
+        "78293.645208759 +b=6356617.987679838 +units=m +no_defs",
+        "PROJCS[\"Sibun Gorge 1922 / Colony Grid\",GEOGCS[\"Sibun"
+        " Gorge 1922\",DATUM[\"Sibun_Gorge_1922\",SPHEROID[\"Clar"
+        "ke 1858\",6378293.64520876,294.260676369261,AUTHORITY[\""
+        "EPSG\",\"7007\"]],AUTHORITY[\"EPSG\",\"1071\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"5464\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",17.0612419444444"
+        "],PARAMETER[\"central_meridian\",-88.6318575],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",217259.2"
+        "6],PARAMETER[\"false_northing\",445474.83],UNIT[\"Clarke"
+        "'s foot\",0.3047972654,AUTHORITY[\"EPSG\",\"9005\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5589\"]]"},
+    {5467, "epsg", 5467,
         "Panama-Colon 1911", 1, 1,
         "Clarke 1866", "Greenwich",
         "Panama-Colon_1911", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=clrk66 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Panama-Colon 1911\",DATUM[\"Panama-Colon_1911\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"1072\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"5467\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5469, "epsg", 5469,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=clrk66 +no_defs",
+        "GEOGCS[\"Panama-Colon 1911\",DATUM[\"Panama-Colon_1911\""
+        ",SPHEROID[\"Clarke 1866\",6378206.4,294.978698213898,AUT"
+        "HORITY[\"EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"1072\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"5467\"]]"},
+    {5469, "epsg", 5469,
         "Panama-Colon 1911 / Panama Lambert", 0, 0,
         "Clarke 1866", "Greenwich",
         "Panama-Colon_1911", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=8.416666666666666 +lat_0=8.416666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-80 +k_0=0.99989909 +x_0=500000 +y_0=294865.3");
-    add_proj4text (p, 2,
-        "03 +ellps=clrk66 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Panama-Colon 1911 / Panama Lambert\",GEOGCS[\"P");
-    add_srs_wkt (p, 1,
-        "anama-Colon 1911\",DATUM[\"Panama-Colon_1911\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"1072\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"5467\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",8.416666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-80],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",0.99989909],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",500000],PARAMETER[\"false_northing\",294865.303],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"546");
-    add_srs_wkt (p, 13,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5472, "epsg", 5472,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=8.416666666666666 +lat_0=8.416666666666"
+        "666 +lon_0=-80 +k_0=0.99989909 +x_0=500000 +y_0=294865.3"
+        "03 +ellps=clrk66 +units=m +no_defs",
+        "PROJCS[\"Panama-Colon 1911 / Panama Lambert\",GEOGCS[\"P"
+        "anama-Colon 1911\",DATUM[\"Panama-Colon_1911\",SPHEROID["
+        "\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"E"
+        "PSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"1072\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"5467\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",8.416666"
+        "66666667],PARAMETER[\"central_meridian\",-80],PARAMETER["
+        "\"scale_factor\",0.99989909],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",294865.303],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"546"
+        "9\"]]"},
+    {5472, "epsg", 5472,
         "Panama-Colon 1911 / Panama Polyconic", 0, 0,
         "Clarke 1866", "Greenwich",
         "Panama-Colon_1911", "Polyconic", "Clarke's yard",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=poly +lat_0=8.25 +lon_0=-81 +x_0=914391.7962 +y_0=");
-    add_proj4text (p, 1,
-        "999404.7217154861 +ellps=clrk66 +to_meter=0.9143917962 +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Panama-Colon 1911 / Panama Polyconic\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Panama-Colon 1911\",DATUM[\"Panama-Colon_1911\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"1072\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"5467\"]],PROJECTION[\"Polyconic\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",8.25],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-81],PARAMETER[\"false_easting\",1000000],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_northing\",1092972.1],UNIT[\"Clarke's yar");
-    add_srs_wkt (p, 10,
-        "d\",0.9143917962,AUTHORITY[\"EPSG\",\"9037\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"5472\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5479, "epsg", 5479,
+        "Easting", "East", "Northing", "North",
+        "+proj=poly +lat_0=8.25 +lon_0=-81 +x_0=914391.7962 +y_0="
+        "999404.7217154861 +ellps=clrk66 +to_meter=0.9143917962 +"
+        "no_defs",
+        "PROJCS[\"Panama-Colon 1911 / Panama Polyconic\",GEOGCS[\""
+        "Panama-Colon 1911\",DATUM[\"Panama-Colon_1911\",SPHEROID"
+        "[\"Clarke 1866\",6378206.4,294.978698213898,AUTHORITY[\""
+        "EPSG\",\"7008\"]],AUTHORITY[\"EPSG\",\"1072\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"5467\"]],PROJECTION[\"Polyconic\"],PAR"
+        "AMETER[\"latitude_of_origin\",8.25],PARAMETER[\"central_"
+        "meridian\",-81],PARAMETER[\"false_easting\",1000000],PAR"
+        "AMETER[\"false_northing\",1092972.1],UNIT[\"Clarke's yar"
+        "d\",0.9143917962,AUTHORITY[\"EPSG\",\"9037\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"5472\"]]"},
+    {5479, "epsg", 5479,
         "RSRGD2000 / MSLC2000", 0, 1,
         "GRS 1980", "Greenwich",
         "Ross_Sea_Region_Geodetic_Datum_2000", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-78 +lon_0=163 +x_0=7000000 +y_0=5000000 +e");
-    add_proj4text (p, 2,
-        "llps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSRGD2000 / MSLC2000\",GEOGCS[\"RSRGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4764\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-78],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",163],PARAMETER[\"standard_parallel_1\",-7");
-    add_srs_wkt (p, 9,
-        "6.6666666666667],PARAMETER[\"standard_parallel_2\",-79.3");
-    add_srs_wkt (p, 10,
-        "333333333333],PARAMETER[\"false_easting\",7000000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",5000000],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"5479\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5480, "epsg", 5480,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=-76.66666666666667 +lat_2=-79.333333333"
+        "33333 +lat_0=-78 +lon_0=163 +x_0=7000000 +y_0=5000000 +e"
+        "llps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"RSRGD2000 / MSLC2000\",GEOGCS[\"RSRGD2000\",DAT"
+        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4764\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",-78],PARAMETER[\"cent"
+        "ral_meridian\",163],PARAMETER[\"standard_parallel_1\",-7"
+        "6.6666666666667],PARAMETER[\"standard_parallel_2\",-79.3"
+        "333333333333],PARAMETER[\"false_easting\",7000000],PARAM"
+        "ETER[\"false_northing\",5000000],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"5479\"]]"},
+    {5480, "epsg", 5480,
         "RSRGD2000 / BCLC2000", 0, 1,
         "GRS 1980", "Greenwich",
         "Ross_Sea_Region_Geodetic_Datum_2000", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-73.66666666666667 +lat_2=-75.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-74.5 +lon_0=165 +x_0=5000000 +y_0=3000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSRGD2000 / BCLC2000\",GEOGCS[\"RSRGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4764\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-74.5],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",165],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 9,
-        "-73.6666666666667],PARAMETER[\"standard_parallel_2\",-75");
-    add_srs_wkt (p, 10,
-        ".3333333333333],PARAMETER[\"false_easting\",5000000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",3000000],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"5480\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5481, "epsg", 5481,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=-73.66666666666667 +lat_2=-75.333333333"
+        "33333 +lat_0=-74.5 +lon_0=165 +x_0=5000000 +y_0=3000000 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"RSRGD2000 / BCLC2000\",GEOGCS[\"RSRGD2000\",DAT"
+        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4764\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",-74.5],PARAMETER[\"ce"
+        "ntral_meridian\",165],PARAMETER[\"standard_parallel_1\","
+        "-73.6666666666667],PARAMETER[\"standard_parallel_2\",-75"
+        ".3333333333333],PARAMETER[\"false_easting\",5000000],PAR"
+        "AMETER[\"false_northing\",3000000],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"5480\"]]"},
+    {5481, "epsg", 5481,
         "RSRGD2000 / PCLC2000", 0, 1,
         "GRS 1980", "Greenwich",
         "Ross_Sea_Region_Geodetic_Datum_2000", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=-70.66666666666667 +lat_2=-72.333333333");
-    add_proj4text (p, 1,
-        "33333 +lat_0=-71.5 +lon_0=166 +x_0=3000000 +y_0=1000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSRGD2000 / PCLC2000\",GEOGCS[\"RSRGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4764\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",-71.5],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",166],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 9,
-        "-70.6666666666667],PARAMETER[\"standard_parallel_2\",-72");
-    add_srs_wkt (p, 10,
-        ".3333333333333],PARAMETER[\"false_easting\",3000000],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"5481\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5482, "epsg", 5482,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=-70.66666666666667 +lat_2=-72.333333333"
+        "33333 +lat_0=-71.5 +lon_0=166 +x_0=3000000 +y_0=1000000 "
+        "+ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"RSRGD2000 / PCLC2000\",GEOGCS[\"RSRGD2000\",DAT"
+        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4764\"]],PROJECTION[\"Lambert_Conformal_Conic_2SP\""
+        "],PARAMETER[\"latitude_of_origin\",-71.5],PARAMETER[\"ce"
+        "ntral_meridian\",166],PARAMETER[\"standard_parallel_1\","
+        "-70.6666666666667],PARAMETER[\"standard_parallel_2\",-72"
+        ".3333333333333],PARAMETER[\"false_easting\",3000000],PAR"
+        "AMETER[\"false_northing\",1000000],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"5481\"]]"},
+    {5482, "epsg", 5482,
         "RSRGD2000 / RSPS2000", 0, 1,
         "GRS 1980", "Greenwich",
         "Ross_Sea_Region_Geodetic_Datum_2000", "Polar_Stereographic", "metre",
-        "Northing", "North", "Easting", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-90 +lon_0=180 +k=0.994 +");
-    add_proj4text (p, 1,
-        "x_0=5000000 +y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSRGD2000 / RSPS2000\",GEOGCS[\"RSRGD2000\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4764\"]],PROJECTION[\"Polar_Stereographic\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",-90],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 8,
-        "idian\",180],PARAMETER[\"scale_factor\",0.994],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",5000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Northing\",NORTH],AXIS[\"Easting\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"5482\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5488, "epsg", 5488,
+        "Northing", "North", "Easting", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-90 +lon_0=180 +k=0.994 +"
+        "x_0=5000000 +y_0=1000000 +ellps=GRS80 +towgs84=0,0,0,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"RSRGD2000 / RSPS2000\",GEOGCS[\"RSRGD2000\",DAT"
+        "UM[\"Ross_Sea_Region_Geodetic_Datum_2000\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6764\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4764\"]],PROJECTION[\"Polar_Stereographic\"],PARAM"
+        "ETER[\"latitude_of_origin\",-90],PARAMETER[\"central_mer"
+        "idian\",180],PARAMETER[\"scale_factor\",0.994],PARAMETER"
+        "[\"false_easting\",5000000],PARAMETER[\"false_northing\""
+        ",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Northing\",NORTH],AXIS[\"Easting\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"5482\"]]"},
+    {5488, "epsg", 5488,
         "RGAF09", 1, 1,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_des_Antilles_Francaises_2009", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"RGAF09\",DATUM[\"Reseau Geodesique des Antille");
-    add_srs_wkt (p, 1,
-        "s Francaises 2009\",ELLIPSOID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 2,
-        "57222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 3,
-        "0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoid");
-    add_srs_wkt (p, 4,
-        "al,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],AN");
-    add_srs_wkt (p, 5,
-        "GLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic ");
-    add_srs_wkt (p, 6,
-        "longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0");
-    add_srs_wkt (p, 7,
-        "174532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORD");
-    add_srs_wkt (p, 8,
-        "ER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy; ai");
-    add_srs_wkt (p, 9,
-        "r, land and sea navigation and safety of life purposes.\"");
-    add_srs_wkt (p, 10,
-        "],AREA[\"French Antilles onshore and offshore - Guadelou");
-    add_srs_wkt (p, 11,
-        "pe (including Grande Terre, Basse Terre, Marie Galante, ");
-    add_srs_wkt (p, 12,
-        "Les Saintes, Iles de la Petite Terre, La Desirade, St Ba");
-    add_srs_wkt (p, 13,
-        "rthélemy, and northern St Martin) and Martinique.\"],BB");
-    add_srs_wkt (p, 14,
-        "OX[14.08,-63.66,18.54,-57.52]],ID[\"EPSG\",5488]]");
-    p = add_epsg_def_ex (filter, first, last, 5489, "epsg", 5489,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"RGAF09\",DATUM[\"Reseau Geodesique des Antille"
+        "s Francaises 2009\",ELLIPSOID[\"GRS 1980\",6378137,298.2"
+        "57222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\","
+        "0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoid"
+        "al,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],AN"
+        "GLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic "
+        "longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0"
+        "174532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORD"
+        "ER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy; ai"
+        "r, land and sea navigation and safety of life purposes.\""
+        "],AREA[\"French Antilles onshore and offshore - Guadelou"
+        "pe (including Grande Terre, Basse Terre, Marie Galante, "
+        "Les Saintes, Iles de la Petite Terre, La Desirade, St Ba"
+        "rthélemy, and northern St Martin) and Martinique.\"],BB"
+        "OX[14.08,-63.66,18.54,-57.52]],ID[\"EPSG\",5488]]"},
+    {5489, "epsg", 5489,
         "RGAF09", 1, 1,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_des_Antilles_Francaises_2009", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"RGAF09\",DATUM[\"Reseau_Geodesique_des_Antilles");
-    add_srs_wkt (p, 1,
-        "_Francaises_2009\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 2,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"1073\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu");
-    add_srs_wkt (p, 6,
-        "de\",EAST],AUTHORITY[\"EPSG\",\"5489\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5490, "epsg", 5490,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"RGAF09\",DATUM[\"Reseau_Geodesique_des_Antilles"
+        "_Francaises_2009\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"1073\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitu"
+        "de\",EAST],AUTHORITY[\"EPSG\",\"5489\"]]"},
+    {5490, "epsg", 5490,
         "RGAF09 / UTM zone 20N", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_des_Antilles_Francaises_2009", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGAF09 / UTM zone 20N\",GEOGCS[\"RGAF09\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Reseau_Geodesique_des_Antilles_Francaises_2009\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"1073\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"5489\"]],PROJECTION[\"Transverse_Mercator");
-    add_srs_wkt (p, 7,
-        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",-63],PARAMETER[\"scale_factor\",0.9996],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"5490\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5498, "epsg", 5498,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"RGAF09 / UTM zone 20N\",GEOGCS[\"RGAF09\",DATUM"
+        "[\"Reseau_Geodesique_des_Antilles_Francaises_2009\",SPHE"
+        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG"
+        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"1073\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"5489\"]],PROJECTION[\"Transverse_Mercator"
+        "\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"cent"
+        "ral_meridian\",-63],PARAMETER[\"scale_factor\",0.9996],P"
+        "ARAMETER[\"false_easting\",500000],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"5490\"]]"},
+    {5498, "epsg", 5498,
         "NAD83", 1, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid");
-    add_proj4text (p, 1,
-        "grids=g2012a_conus.gtx,g2012a_alaska.gtx,g2012a_guam.gtx");
-    add_proj4text (p, 2,
-        ",g2012a_hawaii.gtx,g2012a_puertorico.gtx,g2012a_samoa.gt");
-    add_proj4text (p, 3,
-        "x +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83 + NAVD88 height\",GEOGCS[\"NAD83\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63");
-    add_srs_wkt (p, 2,
-        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A");
-    add_srs_wkt (p, 6,
-        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4269\"]],VE");
-    add_srs_wkt (p, 7,
-        "RT_CS[\"NAVD88 height\",VERT_DATUM[\"North American Vert");
-    add_srs_wkt (p, 8,
-        "ical Datum 1988\",2005,AUTHORITY[\"EPSG\",\"5103\"]],UNI");
-    add_srs_wkt (p, 9,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravi");
-    add_srs_wkt (p, 10,
-        "ty-related height\",UP],AUTHORITY[\"EPSG\",\"5703\"]],AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"5498\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5499, "epsg", 5499,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid"
+        "grids=g2012a_conus.gtx,g2012a_alaska.gtx,g2012a_guam.gtx"
+        ",g2012a_hawaii.gtx,g2012a_puertorico.gtx,g2012a_samoa.gt"
+        "x +vunits=m +no_defs",
+        "COMPD_CS[\"NAD83 + NAVD88 height\",GEOGCS[\"NAD83\",DATU"
+        "M[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",63"
+        "78137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],A"
+        "XIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"4269\"]],VE"
+        "RT_CS[\"NAVD88 height\",VERT_DATUM[\"North American Vert"
+        "ical Datum 1988\",2005,AUTHORITY[\"EPSG\",\"5103\"]],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravi"
+        "ty-related height\",UP],AUTHORITY[\"EPSG\",\"5703\"]],AU"
+        "THORITY[\"EPSG\",\"5498\"]]"},
+    {5499, "epsg", 5499,
         "NAD83(HARN)", 1, 0,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid");
-    add_proj4text (p, 1,
-        "grids=g2012a_conus.gtx,g2012a_alaska.gtx,g2012a_guam.gtx");
-    add_proj4text (p, 2,
-        ",g2012a_hawaii.gtx,g2012a_puertorico.gtx,g2012a_samoa.gt");
-    add_proj4text (p, 3,
-        "x +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(HARN) + NAVD88 height\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4152\"]],VERT_CS[\"NAVD88 height\",VERT_DATU");
-    add_srs_wkt (p, 8,
-        "M[\"North American Vertical Datum 1988\",2005,AUTHORITY[");
-    add_srs_wkt (p, 9,
-        "\"EPSG\",\"5103\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 10,
-        "\"9001\"]],AXIS[\"Gravity-related height\",UP],AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"5703\"]],AUTHORITY[\"EPSG\",\"5499\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5500, "epsg", 5500,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid"
+        "grids=g2012a_conus.gtx,g2012a_alaska.gtx,g2012a_guam.gtx"
+        ",g2012a_hawaii.gtx,g2012a_puertorico.gtx,g2012a_samoa.gt"
+        "x +vunits=m +no_defs",
+        "COMPD_CS[\"NAD83(HARN) + NAVD88 height\",GEOGCS[\"NAD83("
+        "HARN)\",DATUM[\"NAD83_High_Accuracy_Reference_Network\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6152\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4152\"]],VERT_CS[\"NAVD88 height\",VERT_DATU"
+        "M[\"North American Vertical Datum 1988\",2005,AUTHORITY["
+        "\"EPSG\",\"5103\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Gravity-related height\",UP],AUTHORITY"
+        "[\"EPSG\",\"5703\"]],AUTHORITY[\"EPSG\",\"5499\"]]"},
+    {5500, "epsg", 5500,
         "NAD83(NSRS2007)", 1, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2007", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid");
-    add_proj4text (p, 1,
-        "grids=g2012a_conus.gtx,g2012a_alaska.gtx,g2012a_guam.gtx");
-    add_proj4text (p, 2,
-        ",g2012a_hawaii.gtx,g2012a_puertorico.gtx,g2012a_samoa.gt");
-    add_proj4text (p, 3,
-        "x +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(NSRS2007) + NAVD88 height\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67");
-    add_srs_wkt (p, 4,
-        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 7,
-        "EAST],AUTHORITY[\"EPSG\",\"4759\"]],VERT_CS[\"NAVD88 hei");
-    add_srs_wkt (p, 8,
-        "ght\",VERT_DATUM[\"North American Vertical Datum 1988\",");
-    add_srs_wkt (p, 9,
-        "2005,AUTHORITY[\"EPSG\",\"5103\"]],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related height\"");
-    add_srs_wkt (p, 11,
-        ",UP],AUTHORITY[\"EPSG\",\"5703\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "5500\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5513, "epsg", 5513,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid"
+        "grids=g2012a_conus.gtx,g2012a_alaska.gtx,g2012a_guam.gtx"
+        ",g2012a_hawaii.gtx,g2012a_puertorico.gtx,g2012a_samoa.gt"
+        "x +vunits=m +no_defs",
+        "COMPD_CS[\"NAD83(NSRS2007) + NAVD88 height\",GEOGCS[\"NA"
+        "D83(NSRS2007)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2007\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"67"
+        "59\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"4759\"]],VERT_CS[\"NAVD88 hei"
+        "ght\",VERT_DATUM[\"North American Vertical Datum 1988\","
+        "2005,AUTHORITY[\"EPSG\",\"5103\"]],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related height\""
+        ",UP],AUTHORITY[\"EPSG\",\"5703\"]],AUTHORITY[\"EPSG\",\""
+        "5500\"]]"},
+    {5513, "epsg", 5513,
         "S-JTSK / Krovak", 0, 0,
         "Bessel 1841", "Greenwich",
         "System_of_the_Unified_Trigonometrical_Cadastral_Network", "Krovak", "metre",
-        "Southing", "South", "Westing", "West");
-    add_proj4text (p, 0,
-        "+proj=krovak +lat_0=49.5 +lon_0=24.83333333333333 +alpha");
-    add_proj4text (p, 1,
-        "=30.28813972222222 +k=0.9999 +x_0=0 +y_0=0 +ellps=bessel");
-    add_proj4text (p, 2,
-        " +towgs84=589,76,480,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"S-JTSK / Krovak\",GEOGCS[\"S-JTSK\",DATUM[\"Sys");
-    add_srs_wkt (p, 1,
-        "tem_of_the_Unified_Trigonometrical_Cadastral_Network\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6156\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4156\"]],PROJECTION[\"Krovak\"],P");
-    add_srs_wkt (p, 7,
-        "ARAMETER[\"latitude_of_center\",49.5],PARAMETER[\"longit");
-    add_srs_wkt (p, 8,
-        "ude_of_center\",24.8333333333333],PARAMETER[\"azimuth\",");
-    add_srs_wkt (p, 9,
-        "30.2881397527778],PARAMETER[\"pseudo_standard_parallel_1");
-    add_srs_wkt (p, 10,
-        "\",78.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Southin");
-    add_srs_wkt (p, 13,
-        "g\",SOUTH],AXIS[\"Westing\",WEST],AUTHORITY[\"EPSG\",\"5");
-    add_srs_wkt (p, 14,
-        "513\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5514, "epsg", 5514,
+        "Southing", "South", "Westing", "West",
+        "+proj=krovak +lat_0=49.5 +lon_0=24.83333333333333 +alpha"
+        "=30.28813972222222 +k=0.9999 +x_0=0 +y_0=0 +ellps=bessel"
+        " +towgs84=589,76,480,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"S-JTSK / Krovak\",GEOGCS[\"S-JTSK\",DATUM[\"Sys"
+        "tem_of_the_Unified_Trigonometrical_Cadastral_Network\",S"
+        "PHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUTHORIT"
+        "Y[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6156\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4156\"]],PROJECTION[\"Krovak\"],P"
+        "ARAMETER[\"latitude_of_center\",49.5],PARAMETER[\"longit"
+        "ude_of_center\",24.8333333333333],PARAMETER[\"azimuth\","
+        "30.2881397527778],PARAMETER[\"pseudo_standard_parallel_1"
+        "\",78.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",0],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Southin"
+        "g\",SOUTH],AXIS[\"Westing\",WEST],AUTHORITY[\"EPSG\",\"5"
+        "513\"]]"},
+    {5514, "epsg", 5514,
         "S-JTSK / Krovak East North", 0, 0,
         "Bessel 1841", "Greenwich",
         "System_of_the_Unified_Trigonometrical_Cadastral_Network", "Krovak", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=krovak +lat_0=49.5 +lon_0=24.83333333333333 +alpha");
-    add_proj4text (p, 1,
-        "=30.28813972222222 +k=0.9999 +x_0=0 +y_0=0 +ellps=bessel");
-    add_proj4text (p, 2,
-        " +towgs84=589,76,480,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"S-JTSK / Krovak East North\",GEOGCS[\"S-JTSK\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"System_of_the_Unified_Trigonometrical_Cadastral_");
-    add_srs_wkt (p, 2,
-        "Network\",SPHEROID[\"Bessel 1841\",6377397.155,299.15281");
-    add_srs_wkt (p, 3,
-        "28,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"61");
-    add_srs_wkt (p, 4,
-        "56\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4156\"]],PROJECTION[\"K");
-    add_srs_wkt (p, 7,
-        "rovak\"],PARAMETER[\"latitude_of_center\",49.5],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"longitude_of_center\",24.8333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "azimuth\",30.2881397527778],PARAMETER[\"pseudo_standard_");
-    add_srs_wkt (p, 10,
-        "parallel_1\",78.5],PARAMETER[\"scale_factor\",0.9999],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"5514\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5518, "epsg", 5518,
+        "Easting", "East", "Northing", "North",
+        "+proj=krovak +lat_0=49.5 +lon_0=24.83333333333333 +alpha"
+        "=30.28813972222222 +k=0.9999 +x_0=0 +y_0=0 +ellps=bessel"
+        " +towgs84=589,76,480,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"S-JTSK / Krovak East North\",GEOGCS[\"S-JTSK\","
+        "DATUM[\"System_of_the_Unified_Trigonometrical_Cadastral_"
+        "Network\",SPHEROID[\"Bessel 1841\",6377397.155,299.15281"
+        "28,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"61"
+        "56\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4156\"]],PROJECTION[\"K"
+        "rovak\"],PARAMETER[\"latitude_of_center\",49.5],PARAMETE"
+        "R[\"longitude_of_center\",24.8333333333333],PARAMETER[\""
+        "azimuth\",30.2881397527778],PARAMETER[\"pseudo_standard_"
+        "parallel_1\",78.5],PARAMETER[\"scale_factor\",0.9999],PA"
+        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"5514\"]]"},
+    {5518, "epsg", 5518,
         "CI1971 / Chatham Islands Map Grid", 0, 1,
         "International 1924", "Greenwich",
         "Chatham_Islands_Datum_1971", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-44 +lon_0=-176.5 +k=1 +x_0=350000 +y");
-    add_proj4text (p, 1,
-        "_0=650000 +ellps=intl +towgs84=175,-38,113,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CI1971 / Chatham Islands Map Grid\",GEOGCS[\"Ch");
-    add_srs_wkt (p, 1,
-        "atham Islands 1971\",DATUM[\"Chatham_Islands_Datum_1971\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6672\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4672\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",-44],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-176.5],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",350000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",650000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"5518\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5519, "epsg", 5519,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-44 +lon_0=-176.5 +k=1 +x_0=350000 +y"
+        "_0=650000 +ellps=intl +towgs84=175,-38,113,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"CI1971 / Chatham Islands Map Grid\",GEOGCS[\"Ch"
+        "atham Islands 1971\",DATUM[\"Chatham_Islands_Datum_1971\""
+        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\""
+        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6672\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4672\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",-44],PARAMETER[\""
+        "central_meridian\",-176.5],PARAMETER[\"scale_factor\",1]"
+        ",PARAMETER[\"false_easting\",350000],PARAMETER[\"false_n"
+        "orthing\",650000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"5518\"]]"},
+    {5519, "epsg", 5519,
         "CI1979 / Chatham Islands Map Grid", 0, 1,
         "International 1924", "Greenwich",
         "Chatham_Islands_Datum_1979", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-44 +lon_0=-176.5 +k=1 +x_0=350000 +y");
-    add_proj4text (p, 1,
-        "_0=650000 +ellps=intl +towgs84=174.05,-25.49,112.57,0,0,");
-    add_proj4text (p, 2,
-        "0.554,0.2263 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CI1979 / Chatham Islands Map Grid\",GEOGCS[\"Ch");
-    add_srs_wkt (p, 1,
-        "atham Islands 1979\",DATUM[\"Chatham_Islands_Datum_1979\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6673\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4673\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",-44],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-176.5],PARAMETER[\"scale_factor\",1]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",350000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",650000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"5519\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5520, "epsg", 5520,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-44 +lon_0=-176.5 +k=1 +x_0=350000 +y"
+        "_0=650000 +ellps=intl +towgs84=174.05,-25.49,112.57,0,0,"
+        "0.554,0.2263 +units=m +no_defs",
+        "PROJCS[\"CI1979 / Chatham Islands Map Grid\",GEOGCS[\"Ch"
+        "atham Islands 1979\",DATUM[\"Chatham_Islands_Datum_1979\""
+        ",SPHEROID[\"International 1924\",6378388,297,AUTHORITY[\""
+        "EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6673\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4673\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",-44],PARAMETER[\""
+        "central_meridian\",-176.5],PARAMETER[\"scale_factor\",1]"
+        ",PARAMETER[\"false_easting\",350000],PARAMETER[\"false_n"
+        "orthing\",650000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"5519\"]]"},
+    {5520, "epsg", 5520,
         "DHDN / 3-degree Gauss-Kruger zone 1", 0, 1,
         "Bessel 1841", "Greenwich",
         "Deutsches_Hauptdreiecksnetz", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=3 +k=1 +x_0=1500000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.45");
-    add_proj4text (p, 2,
-        "5,6.7 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DHDN / 3-degree Gauss-Kruger zone 1\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7004\"]],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4314\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",3],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",1500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"5520\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5523, "epsg", 5523,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=3 +k=1 +x_0=1500000 +y_0=0 +"
+        "ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.45"
+        "5,6.7 +units=m +no_defs",
+        "PROJCS[\"DHDN / 3-degree Gauss-Kruger zone 1\",GEOGCS[\""
+        "DHDN\",DATUM[\"Deutsches_Hauptdreiecksnetz\",SPHEROID[\""
+        "Bessel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\""
+        ",\"7004\"]],AUTHORITY[\"EPSG\",\"6314\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4314\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",3],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",1500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"5520\"]]"},
+    {5523, "epsg", 5523,
         "WGS 84 / Gabon TM 2011", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.5 +k=0.9996 +x_0=1500000 ");
-    add_proj4text (p, 1,
-        "+y_0=5500000 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / Gabon TM 2011\",GEOGCS[\"WGS 84\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 6,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"central_meridian\",11.5],PARAMETER[\"scale_");
-    add_srs_wkt (p, 8,
-        "factor\",0.9996],PARAMETER[\"false_easting\",1500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",5500000],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 10,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"5523\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5524, "epsg", 5524,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=11.5 +k=0.9996 +x_0=1500000 "
+        "+y_0=5500000 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / Gabon TM 2011\",GEOGCS[\"WGS 84\",DATU"
+        "M[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563"
+        ",AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0]"
+        ",PARAMETER[\"central_meridian\",11.5],PARAMETER[\"scale_"
+        "factor\",0.9996],PARAMETER[\"false_easting\",1500000],PA"
+        "RAMETER[\"false_northing\",5500000],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"5523\"]]"},
+    {5524, "epsg", 5524,
         "Corrego Alegre 1961", 1, 1,
         "International 1924", "Greenwich",
         "Corrego_Alegre_1961", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Corrego Alegre 1961\",DATUM[\"Corrego_Alegre_19");
-    add_srs_wkt (p, 1,
-        "61\",SPHEROID[\"International 1924\",6378388,297,AUTHORI");
-    add_srs_wkt (p, 2,
-        "TY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"1074\"]],PRI");
-    add_srs_wkt (p, 3,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"5524\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5527, "epsg", 5527,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +no_defs",
+        "GEOGCS[\"Corrego Alegre 1961\",DATUM[\"Corrego_Alegre_19"
+        "61\",SPHEROID[\"International 1924\",6378388,297,AUTHORI"
+        "TY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"1074\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH"
+        "ORITY[\"EPSG\",\"5524\"]]"},
+    {5527, "epsg", 5527,
         "SAD69(96)", 1, 1,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969_96", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=aust_SA +towgs84=-67.35,3.88,-38.22");
-    add_proj4text (p, 1,
-        ",0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SAD69(96)\",DATUM[\"South_American_Datum_1969_9");
-    add_srs_wkt (p, 1,
-        "6\",SPHEROID[\"GRS 1967 Modified\",6378160,298.25,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7050\"]],AUTHORITY[\"EPSG\",\"1075\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"5527\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5530, "epsg", 5530,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=aust_SA +towgs84=-67.35,3.88,-38.22"
+        ",0,0,0,0 +no_defs",
+        "GEOGCS[\"SAD69(96)\",DATUM[\"South_American_Datum_1969_9"
+        "6\",SPHEROID[\"GRS 1967 Modified\",6378160,298.25,AUTHOR"
+        "ITY[\"EPSG\",\"7050\"]],AUTHORITY[\"EPSG\",\"1075\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"5527\"]]"},
+    {5530, "epsg", 5530,
         "SAD69(96) / Brazil Polyconic", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969_96", "Polyconic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=poly +lat_0=0 +lon_0=-54 +x_0=5000000 +y_0=1000000");
-    add_proj4text (p, 1,
-        "0 +ellps=aust_SA +towgs84=-67.35,3.88,-38.22,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69(96) / Brazil Polyconic\",GEOGCS[\"SAD69(9");
-    add_srs_wkt (p, 1,
-        "6)\",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"G");
-    add_srs_wkt (p, 2,
-        "RS 1967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "050\"]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"5527\"]],PROJECTION[\"Polyconic\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "54],PARAMETER[\"false_easting\",5000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 10,
-        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 11,
-        "NORTH],AUTHORITY[\"EPSG\",\"5530\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5531, "epsg", 5531,
+        "Easting", "East", "Northing", "North",
+        "+proj=poly +lat_0=0 +lon_0=-54 +x_0=5000000 +y_0=1000000"
+        "0 +ellps=aust_SA +towgs84=-67.35,3.88,-38.22,0,0,0,0 +un"
+        "its=m +no_defs",
+        "PROJCS[\"SAD69(96) / Brazil Polyconic\",GEOGCS[\"SAD69(9"
+        "6)\",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"G"
+        "RS 1967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7"
+        "050\"]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"5527\"]],PROJECTION[\"Polyconic\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-"
+        "54],PARAMETER[\"false_easting\",5000000],PARAMETER[\"fal"
+        "se_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPS"
+        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"5530\"]]"},
+    {5531, "epsg", 5531,
         "SAD69(96) / UTM zone 21S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969_96", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=aust_SA +towgs84=-67.35");
-    add_proj4text (p, 1,
-        ",3.88,-38.22,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69(96) / UTM zone 21S\",GEOGCS[\"SAD69(96)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"5531\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5532, "epsg", 5532,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +south +ellps=aust_SA +towgs84=-67.35"
+        ",3.88,-38.22,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69(96) / UTM zone 21S\",GEOGCS[\"SAD69(96)\""
+        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1"
+        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\""
+        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5531\"]]"},
+    {5532, "epsg", 5532,
         "SAD69(96) / UTM zone 22S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969_96", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69(96) / UTM zone 22S\",GEOGCS[\"SAD69(96)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-51],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"5858\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5533, "epsg", 5533,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69(96) / UTM zone 22S\",GEOGCS[\"SAD69(96)\""
+        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1"
+        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\""
+        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-51],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5858\"]]"},
+    {5533, "epsg", 5533,
         "SAD69(96) / UTM zone 23S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969_96", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +south +ellps=aust_SA +towgs84=-67.35");
-    add_proj4text (p, 1,
-        ",3.88,-38.22,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69(96) / UTM zone 23S\",GEOGCS[\"SAD69(96)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-45],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"5533\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5534, "epsg", 5534,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=23 +south +ellps=aust_SA +towgs84=-67.35"
+        ",3.88,-38.22,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69(96) / UTM zone 23S\",GEOGCS[\"SAD69(96)\""
+        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1"
+        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\""
+        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-45],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5533\"]]"},
+    {5534, "epsg", 5534,
         "SAD69(96) / UTM zone 24S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969_96", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=24 +south +ellps=aust_SA +towgs84=-67.35");
-    add_proj4text (p, 1,
-        ",3.88,-38.22,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69(96) / UTM zone 24S\",GEOGCS[\"SAD69(96)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-39],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"5534\"]]");
-    p = add_epsg_def_ex (filter, first, last, 5535, "epsg", 5535,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=24 +south +ellps=aust_SA +towgs84=-67.35"
+        ",3.88,-38.22,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69(96) / UTM zone 24S\",GEOGCS[\"SAD69(96)\""
+        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1"
+        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\""
+        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-39],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5534\"]]"},
+    {5535, "epsg", 5535,
         "SAD69(96) / UTM zone 25S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969_96", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +south +ellps=aust_SA +towgs84=-67.35");
-    add_proj4text (p, 1,
-        ",3.88,-38.22,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69(96) / UTM zone 25S\",GEOGCS[\"SAD69(96)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-33],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"5535\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=25 +south +ellps=aust_SA +towgs84=-67.35"
+        ",3.88,-38.22,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69(96) / UTM zone 25S\",GEOGCS[\"SAD69(96)\""
+        ",DATUM[\"South_American_Datum_1969_96\",SPHEROID[\"GRS 1"
+        "967 Modified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\""
+        "]],AUTHORITY[\"EPSG\",\"1075\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"5527\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-33],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"5535\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_27 = {
+    epsg_defs_27, sizeof (epsg_defs_27) / sizeof (epsg_defs_27[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3645 +53,2081 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_31 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 6190, "epsg", 6190,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_31[] = {
+    {6190, "epsg", 6190,
         "Belge 1972 / Belgian Lambert 72", 0, 0,
         "International 1924", "Greenwich",
         "Reseau_National_Belge_1972", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=51.16666723333333 +lat_2=49.8333339 +la");
-    add_proj4text (p, 1,
-        "t_0=90 +lon_0=4.367486666666666 +x_0=150000.013 +y_0=540");
-    add_proj4text (p, 2,
-        "0088.438 +ellps=intl +towgs84=-106.8686,52.2978,-103.723");
-    add_proj4text (p, 3,
-        "9,0.3366,-0.457,1.8422,-1.2747 +units=m +vunits=m +no_de");
-    add_proj4text (p, 4,
-        "fs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"Belge 1972 / Belgian Lambert 72 + Ostend heig");
-    add_srs_wkt (p, 1,
-        "ht\",PROJCS[\"Belge 1972 / Belgian Lambert 72\",GEOGCS[\"");
-    add_srs_wkt (p, 2,
-        "Belge 1972\",DATUM[\"Reseau_National_Belge_1972\",SPHERO");
-    add_srs_wkt (p, 3,
-        "ID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"7022\"]],AUTHORITY[\"EPSG\",\"6313\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 5,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 6,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 7,
-        "Y[\"EPSG\",\"4313\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 8,
-        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",90],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"central_meridian\",4.36748666666667],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_1\",51.1666672333333],PARAMETER[\"standard");
-    add_srs_wkt (p, 11,
-        "_parallel_2\",49.8333339],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 12,
-        "0000.013],PARAMETER[\"false_northing\",5400088.438],UNIT");
-    add_srs_wkt (p, 13,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 14,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "31370\"]],VERT_CS[\"Ostend height\",VERT_DATUM[\"Ostend\"");
-    add_srs_wkt (p, 16,
-        ",2005,AUTHORITY[\"EPSG\",\"5110\"]],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 17,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related height");
-    add_srs_wkt (p, 18,
-        "\",UP],AUTHORITY[\"EPSG\",\"5710\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 19,
-        "\"6190\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6204, "epsg", 6204,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=51.16666723333333 +lat_2=49.8333339 +la"
+        "t_0=90 +lon_0=4.367486666666666 +x_0=150000.013 +y_0=540"
+        "0088.438 +ellps=intl +towgs84=-106.8686,52.2978,-103.723"
+        "9,0.3366,-0.457,1.8422,-1.2747 +units=m +vunits=m +no_de"
+        "fs",
+        "COMPD_CS[\"Belge 1972 / Belgian Lambert 72 + Ostend heig"
+        "ht\",PROJCS[\"Belge 1972 / Belgian Lambert 72\",GEOGCS[\""
+        "Belge 1972\",DATUM[\"Reseau_National_Belge_1972\",SPHERO"
+        "ID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\""
+        ",\"7022\"]],AUTHORITY[\"EPSG\",\"6313\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4313\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_2SP\"],PARAMETER[\"latitude_of_origin\",90],PARAMETER"
+        "[\"central_meridian\",4.36748666666667],PARAMETER[\"stan"
+        "dard_parallel_1\",51.1666672333333],PARAMETER[\"standard"
+        "_parallel_2\",49.8333339],PARAMETER[\"false_easting\",15"
+        "0000.013],PARAMETER[\"false_northing\",5400088.438],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "31370\"]],VERT_CS[\"Ostend height\",VERT_DATUM[\"Ostend\""
+        ",2005,AUTHORITY[\"EPSG\",\"5110\"]],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related height"
+        "\",UP],AUTHORITY[\"EPSG\",\"5710\"]],AUTHORITY[\"EPSG\","
+        "\"6190\"]]"},
+    {6204, "epsg", 6204,
         "Macedonia State Coordinate System", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Macedonia State Coordinate System\",GEOGCS[\"MG");
-    add_srs_wkt (p, 1,
-        "I 1901\",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",637");
-    add_srs_wkt (p, 2,
-        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",21],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 11,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6204\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6207, "epsg", 6207,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=500000 +y_"
+        "0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"Macedonia State Coordinate System\",GEOGCS[\"MG"
+        "I 1901\",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",637"
+        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO"
+        "RITY[\"EPSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",0],PARAMETER[\"central_meridian\",21],"
+        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6204\""
+        "]]"},
+    {6207, "epsg", 6207,
         "Nepal 1981", 1, 1,
         "Everest 1830 (1937 Adjustment)", "Greenwich",
         "Nepal_1981", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +a=6377276.345 +b=6356075.41314024 +towgs8");
-    add_proj4text (p, 1,
-        "4=293.17,726.18,245.36,0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Nepal 1981\",DATUM[\"Nepal_1981\",SPHEROID[\"Ev");
-    add_srs_wkt (p, 1,
-        "erest 1830 (1937 Adjustment)\",6377276.345,300.8017,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",\"1111\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"6207\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6210, "epsg", 6210,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +a=6377276.345 +b=6356075.41314024 +towgs8"
+        "4=293.17,726.18,245.36,0,0,0,0 +no_defs",
+        "GEOGCS[\"Nepal 1981\",DATUM[\"Nepal_1981\",SPHEROID[\"Ev"
+        "erest 1830 (1937 Adjustment)\",6377276.345,300.8017,AUTH"
+        "ORITY[\"EPSG\",\"7015\"]],AUTHORITY[\"EPSG\",\"1111\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],"
+        "AUTHORITY[\"EPSG\",\"6207\"]]"},
+    {6210, "epsg", 6210,
         "SIRGAS 2000 / UTM zone 23N", 0, 0,
         "GRS 1980", "Greenwich",
         "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 23N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "674\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4674\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"central_meridian\",-45],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6210\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6211, "epsg", 6211,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=23 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"SIRGAS 2000 / UTM zone 23N\",GEOGCS[\"SIRGAS 20"
+        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_"
+        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "674\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4674\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-45],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6210\"]]"},
+    {6211, "epsg", 6211,
         "SIRGAS 2000 / UTM zone 24N", 0, 0,
         "GRS 1980", "Greenwich",
         "Sistema_de_Referencia_Geocentrico_para_las_AmericaS_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=24 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS 2000 / UTM zone 24N\",GEOGCS[\"SIRGAS 20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_");
-    add_srs_wkt (p, 2,
-        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 4,
-        "674\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4674\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"central_meridian\",-39],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6211\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6307, "epsg", 6307,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=24 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"SIRGAS 2000 / UTM zone 24N\",GEOGCS[\"SIRGAS 20"
+        "00\",DATUM[\"Sistema_de_Referencia_Geocentrico_para_las_"
+        "AmericaS_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6"
+        "674\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4674\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",-39],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6211\"]]"},
+    {6307, "epsg", 6307,
         "NAD83(CORS96) / Puerto Rico and Virgin Is.", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Continuously_Operating_Reference_Station_1996", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +");
-    add_proj4text (p, 2,
-        "x_0=200000 +y_0=200000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CORS96) / Puerto Rico and Virgin Is.\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(CORS96)\",DATUM[\"NAD83_Continuously_Operat");
-    add_srs_wkt (p, 2,
-        "ing_Reference_Station_1996\",SPHEROID[\"GRS 1980\",63781");
-    add_srs_wkt (p, 3,
-        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"1133\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6783\"]]");
-    add_srs_wkt (p, 7,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",17.8333333333333],PARAMETER[\"centr");
-    add_srs_wkt (p, 9,
-        "al_meridian\",-66.4333333333333],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 10,
-        "rallel_1\",18.4333333333333],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 11,
-        "el_2\",18.0333333333333],PARAMETER[\"false_easting\",200");
-    add_srs_wkt (p, 12,
-        "000],PARAMETER[\"false_northing\",200000],UNIT[\"metre\"");
-    add_srs_wkt (p, 13,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6307\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6310, "epsg", 6310,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333"
+        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +"
+        "x_0=200000 +y_0=200000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(CORS96) / Puerto Rico and Virgin Is.\",GE"
+        "OGCS[\"NAD83(CORS96)\",DATUM[\"NAD83_Continuously_Operat"
+        "ing_Reference_Station_1996\",SPHEROID[\"GRS 1980\",63781"
+        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY"
+        "[\"EPSG\",\"1133\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6783\"]]"
+        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",17.8333333333333],PARAMETER[\"centr"
+        "al_meridian\",-66.4333333333333],PARAMETER[\"standard_pa"
+        "rallel_1\",18.4333333333333],PARAMETER[\"standard_parall"
+        "el_2\",18.0333333333333],PARAMETER[\"false_easting\",200"
+        "000],PARAMETER[\"false_northing\",200000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6307\"]]"},
+    {6310, "epsg", 6310,
         "CGRS93", 1, 1,
         "WGS 84", "Greenwich",
         "Cyprus_Geodetic_Reference_System_1993", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=8.846,-4.394,-1.122,");
-    add_proj4text (p, 1,
-        "-0.00237,-0.146528,0.130428,0.783926 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"CGRS93\",DATUM[\"Cyprus Geodetic Reference Sys");
-    add_srs_wkt (p, 1,
-        "tem 1993\",ELLIPSOID[\"WGS 84\",6378137,298.257223563,LE");
-    add_srs_wkt (p, 2,
-        "NGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT");
-    add_srs_wkt (p, 3,
-        "[\"degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[");
-    add_srs_wkt (p, 4,
-        "\"geodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433]],AXIS[\"geodetic longitude (");
-    add_srs_wkt (p, 6,
-        "Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 7,
-        "9433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGT");
-    add_srs_wkt (p, 8,
-        "HUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Cyp");
-    add_srs_wkt (p, 9,
-        "rus - onshore.\"],BBOX[34.59,32.2,35.74,34.65]],ID[\"EPS");
-    add_srs_wkt (p, 10,
-        "G\",6310]]");
-    p = add_epsg_def_ex (filter, first, last, 6311, "epsg", 6311,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=8.846,-4.394,-1.122,"
+        "-0.00237,-0.146528,0.130428,0.783926 +no_defs",
+        "GEOGCRS[\"CGRS93\",DATUM[\"Cyprus Geodetic Reference Sys"
+        "tem 1993\",ELLIPSOID[\"WGS 84\",6378137,298.257223563,LE"
+        "NGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT"
+        "[\"degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS["
+        "\"geodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"d"
+        "egree\",0.0174532925199433]],AXIS[\"geodetic longitude ("
+        "Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519"
+        "9433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGT"
+        "HUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Cyp"
+        "rus - onshore.\"],BBOX[34.59,32.2,35.74,34.65]],ID[\"EPS"
+        "G\",6310]]"},
+    {6311, "epsg", 6311,
         "CGRS93", 1, 1,
         "WGS 84", "Greenwich",
         "Cyprus_Geodetic_Reference_System_1993", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +towgs84=8.846,-4.394,-1.122,");
-    add_proj4text (p, 1,
-        "-0.00237,-0.146528,0.130428,0.783926 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"CGRS93\",DATUM[\"Cyprus_Geodetic_Reference_Syst");
-    add_srs_wkt (p, 1,
-        "em_1993\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTH");
-    add_srs_wkt (p, 2,
-        "ORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1112\"]],");
-    add_srs_wkt (p, 3,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 4,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 5,
-        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],");
-    add_srs_wkt (p, 6,
-        "AUTHORITY[\"EPSG\",\"6311\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6312, "epsg", 6312,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +towgs84=8.846,-4.394,-1.122,"
+        "-0.00237,-0.146528,0.130428,0.783926 +no_defs",
+        "GEOGCS[\"CGRS93\",DATUM[\"Cyprus_Geodetic_Reference_Syst"
+        "em_1993\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTH"
+        "ORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1112\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],"
+        "AUTHORITY[\"EPSG\",\"6311\"]]"},
+    {6312, "epsg", 6312,
         "CGRS93 / Cyprus Local Transverse Mercator", 0, 0,
         "WGS 84", "Greenwich",
         "Cyprus_Geodetic_Reference_System_1993", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=0.99995 +x_0=200000 +y");
-    add_proj4text (p, 1,
-        "_0=-3500000 +ellps=WGS84 +towgs84=8.846,-4.394,-1.122,-0");
-    add_proj4text (p, 2,
-        ".00237,-0.146528,0.130428,0.783926 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CGRS93 / Cyprus Local Transverse Mercator\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"CGRS93\",DATUM[\"Cyprus_Geodetic_Reference_System_");
-    add_srs_wkt (p, 2,
-        "1993\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1112\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6311\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",33],PARAMETER[\"scale_factor\",0.");
-    add_srs_wkt (p, 9,
-        "99995],PARAMETER[\"false_easting\",200000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",-3500000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6312\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6316, "epsg", 6316,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=33 +k=0.99995 +x_0=200000 +y"
+        "_0=-3500000 +ellps=WGS84 +towgs84=8.846,-4.394,-1.122,-0"
+        ".00237,-0.146528,0.130428,0.783926 +units=m +no_defs",
+        "PROJCS[\"CGRS93 / Cyprus Local Transverse Mercator\",GEO"
+        "GCS[\"CGRS93\",DATUM[\"Cyprus_Geodetic_Reference_System_"
+        "1993\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUTHORI"
+        "TY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1112\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6311\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",33],PARAMETER[\"scale_factor\",0."
+        "99995],PARAMETER[\"false_easting\",200000],PARAMETER[\"f"
+        "alse_northing\",-3500000],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"6312\"]]"},
+    {6316, "epsg", 6316,
         "MGI 1901 / Balkans zone 7", 0, 0,
         "Bessel 1841", "Greenwich",
         "MGI_1901", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=7500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI 1901 / Balkans zone 7\",GEOGCS[\"MGI 1901\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155");
-    add_srs_wkt (p, 2,
-        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",21],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",7");
-    add_srs_wkt (p, 9,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 10,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6316\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6318, "epsg", 6318,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=7500000 +y"
+        "_0=0 +ellps=bessel +towgs84=682,-203,480,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"MGI 1901 / Balkans zone 7\",GEOGCS[\"MGI 1901\""
+        ",DATUM[\"MGI_1901\",SPHEROID[\"Bessel 1841\",6377397.155"
+        ",299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"E"
+        "PSG\",\"1031\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"3906\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",21],PARAMETE"
+        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",7"
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6316\"]]"},
+    {6318, "epsg", 6318,
         "NAD83(2011)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 1,
-        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"6318\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6319, "epsg", 6319,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long"
+        "itude\",EAST],AUTHORITY[\"EPSG\",\"6318\"]]"},
+    {6319, "epsg", 6319,
         "NAD83(2011)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(2011)\",DATUM[\"NAD83 (National Spatial ");
-    add_srs_wkt (p, 1,
-        "Reference System 2011)\",ELLIPSOID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwi");
-    add_srs_wkt (p, 3,
-        "ch\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[elli");
-    add_srs_wkt (p, 4,
-        "psoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[");
-    add_srs_wkt (p, 5,
-        "1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geod");
-    add_srs_wkt (p, 6,
-        "etic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\"");
-    add_srs_wkt (p, 7,
-        ",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",up");
-    add_srs_wkt (p, 8,
-        ",ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy");
-    add_srs_wkt (p, 9,
-        ".\"],AREA[\"Puerto Rico - onshore and offshore. United S");
-    add_srs_wkt (p, 10,
-        "tates (USA) onshore and offshore - Alabama; Alaska; Ariz");
-    add_srs_wkt (p, 11,
-        "ona; Arkansas; California; Colorado; Connecticut; Delawa");
-    add_srs_wkt (p, 12,
-        "re; Florida; Georgia; Idaho; Illinois; Indiana; Iowa; Ka");
-    add_srs_wkt (p, 13,
-        "nsas; Kentucky; Louisiana; Maine; Maryland; Massachusett");
-    add_srs_wkt (p, 14,
-        "s; Michigan; Minnesota; Mississippi; Missouri; Montana; ");
-    add_srs_wkt (p, 15,
-        "Nebraska; Nevada; New Hampshire; New Jersey; New Mexico;");
-    add_srs_wkt (p, 16,
-        " New York; North Carolina; North Dakota; Ohio; Oklahoma;");
-    add_srs_wkt (p, 17,
-        " Oregon; Pennsylvania; Rhode Island; South Carolina; Sou");
-    add_srs_wkt (p, 18,
-        "th Dakota; Tennessee; Texas; Utah; Vermont; Virginia; Wa");
-    add_srs_wkt (p, 19,
-        "shington; West Virginia; Wisconsin; Wyoming. US Virgin I");
-    add_srs_wkt (p, 20,
-        "slands - onshore and offshore.\"],BBOX[14.92,167.65,74.7");
-    add_srs_wkt (p, 21,
-        "1,-63.88]],ID[\"EPSG\",6319]]");
-    p = add_epsg_def_ex (filter, first, last, 6321, "epsg", 6321,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(2011)\",DATUM[\"NAD83 (National Spatial "
+        "Reference System 2011)\",ELLIPSOID[\"GRS 1980\",6378137,"
+        "298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwi"
+        "ch\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[elli"
+        "psoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER["
+        "1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geod"
+        "etic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\""
+        ",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",up"
+        ",ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy"
+        ".\"],AREA[\"Puerto Rico - onshore and offshore. United S"
+        "tates (USA) onshore and offshore - Alabama; Alaska; Ariz"
+        "ona; Arkansas; California; Colorado; Connecticut; Delawa"
+        "re; Florida; Georgia; Idaho; Illinois; Indiana; Iowa; Ka"
+        "nsas; Kentucky; Louisiana; Maine; Maryland; Massachusett"
+        "s; Michigan; Minnesota; Mississippi; Missouri; Montana; "
+        "Nebraska; Nevada; New Hampshire; New Jersey; New Mexico;"
+        " New York; North Carolina; North Dakota; Ohio; Oklahoma;"
+        " Oregon; Pennsylvania; Rhode Island; South Carolina; Sou"
+        "th Dakota; Tennessee; Texas; Utah; Vermont; Virginia; Wa"
+        "shington; West Virginia; Wisconsin; Wyoming. US Virgin I"
+        "slands - onshore and offshore.\"],BBOX[14.92,167.65,74.7"
+        "1,-63.88]],ID[\"EPSG\",6319]]"},
+    {6321, "epsg", 6321,
         "NAD83(PA11)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_PA11", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(PA11)\",DATUM[\"NAD83 (National Spatial ");
-    add_srs_wkt (p, 1,
-        "Reference System PA11)\",ELLIPSOID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwi");
-    add_srs_wkt (p, 3,
-        "ch\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[elli");
-    add_srs_wkt (p, 4,
-        "psoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[");
-    add_srs_wkt (p, 5,
-        "1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geod");
-    add_srs_wkt (p, 6,
-        "etic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\"");
-    add_srs_wkt (p, 7,
-        ",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",up");
-    add_srs_wkt (p, 8,
-        ",ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy");
-    add_srs_wkt (p, 9,
-        ".\"],AREA[\"American Samoa, Marshall Islands, United Sta");
-    add_srs_wkt (p, 10,
-        "tes (USA) - Hawaii, United States minor outlying islands");
-    add_srs_wkt (p, 11,
-        "; onshore and offshore.\"],BBOX[-17.56,157.47,31.8,-151.");
-    add_srs_wkt (p, 12,
-        "27]],ID[\"EPSG\",6321]]");
-    p = add_epsg_def_ex (filter, first, last, 6322, "epsg", 6322,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(PA11)\",DATUM[\"NAD83 (National Spatial "
+        "Reference System PA11)\",ELLIPSOID[\"GRS 1980\",6378137,"
+        "298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwi"
+        "ch\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[elli"
+        "psoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER["
+        "1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geod"
+        "etic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\""
+        ",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",up"
+        ",ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy"
+        ".\"],AREA[\"American Samoa, Marshall Islands, United Sta"
+        "tes (USA) - Hawaii, United States minor outlying islands"
+        "; onshore and offshore.\"],BBOX[-17.56,157.47,31.8,-151."
+        "27]],ID[\"EPSG\",6321]]"},
+    {6322, "epsg", 6322,
         "NAD83(PA11)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_PA11", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(PA11)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 1,
-        "ference_System_PA11\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"1117\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"6322\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6324, "epsg", 6324,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(PA11)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_PA11\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1117\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long"
+        "itude\",EAST],AUTHORITY[\"EPSG\",\"6322\"]]"},
+    {6324, "epsg", 6324,
         "NAD83(MA11)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_MA11", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(MA11)\",DATUM[\"NAD83 (National Spatial ");
-    add_srs_wkt (p, 1,
-        "Reference System MA11)\",ELLIPSOID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 2,
-        "298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwi");
-    add_srs_wkt (p, 3,
-        "ch\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[elli");
-    add_srs_wkt (p, 4,
-        "psoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[");
-    add_srs_wkt (p, 5,
-        "1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geod");
-    add_srs_wkt (p, 6,
-        "etic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\"");
-    add_srs_wkt (p, 7,
-        ",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",up");
-    add_srs_wkt (p, 8,
-        ",ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy");
-    add_srs_wkt (p, 9,
-        ".\"],AREA[\"Guam, Northern Mariana Islands and Palau; on");
-    add_srs_wkt (p, 10,
-        "shore and offshore.\"],BBOX[1.64,129.48,23.9,149.55]],ID");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",6324]]");
-    p = add_epsg_def_ex (filter, first, last, 6325, "epsg", 6325,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(MA11)\",DATUM[\"NAD83 (National Spatial "
+        "Reference System MA11)\",ELLIPSOID[\"GRS 1980\",6378137,"
+        "298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwi"
+        "ch\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[elli"
+        "psoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER["
+        "1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geod"
+        "etic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\""
+        ",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",up"
+        ",ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy"
+        ".\"],AREA[\"Guam, Northern Mariana Islands and Palau; on"
+        "shore and offshore.\"],BBOX[1.64,129.48,23.9,149.55]],ID"
+        "[\"EPSG\",6324]]"},
+    {6325, "epsg", 6325,
         "NAD83(MA11)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_MA11", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(MA11)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 1,
-        "ference_System_MA11\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"1118\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long");
-    add_srs_wkt (p, 6,
-        "itude\",EAST],AUTHORITY[\"EPSG\",\"6325\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6328, "epsg", 6328,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(MA11)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_MA11\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1118\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Long"
+        "itude\",EAST],AUTHORITY[\"EPSG\",\"6325\"]]"},
+    {6328, "epsg", 6328,
         "NAD83(2011) / UTM zone 59N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=59 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 59N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",171],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6328\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6329, "epsg", 6329,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=59 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 59N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",171],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6328\"]]"},
+    {6329, "epsg", 6329,
         "NAD83(2011) / UTM zone 60N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=60 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 60N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",177],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6329\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6330, "epsg", 6330,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=60 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 60N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",177],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6329\"]]"},
+    {6330, "epsg", 6330,
         "NAD83(2011) / UTM zone 1N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=1 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 1N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-177],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6330\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6331, "epsg", 6331,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=1 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 1N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-177],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6330\"]]"},
+    {6331, "epsg", 6331,
         "NAD83(2011) / UTM zone 2N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=2 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 2N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-171],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6331\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6332, "epsg", 6332,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=2 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 2N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-171],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6331\"]]"},
+    {6332, "epsg", 6332,
         "NAD83(2011) / UTM zone 3N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=3 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 3N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-165],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6332\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6333, "epsg", 6333,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=3 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 3N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-165],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6332\"]]"},
+    {6333, "epsg", 6333,
         "NAD83(2011) / UTM zone 4N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=4 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 4N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-159],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6333\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6334, "epsg", 6334,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=4 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 4N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-159],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6333\"]]"},
+    {6334, "epsg", 6334,
         "NAD83(2011) / UTM zone 5N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=5 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 5N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-153],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6334\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6335, "epsg", 6335,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=5 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 5N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-153],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6334\"]]"},
+    {6335, "epsg", 6335,
         "NAD83(2011) / UTM zone 6N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=6 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 6N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-147],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6335\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6336, "epsg", 6336,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=6 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 6N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-147],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6335\"]]"},
+    {6336, "epsg", 6336,
         "NAD83(2011) / UTM zone 7N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=7 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 7N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-141],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6336\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6337, "epsg", 6337,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=7 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 7N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-141],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6336\"]]"},
+    {6337, "epsg", 6337,
         "NAD83(2011) / UTM zone 8N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=8 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 8N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-135],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6337\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6338, "epsg", 6338,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=8 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 8N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-135],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6337\"]]"},
+    {6338, "epsg", 6338,
         "NAD83(2011) / UTM zone 9N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=9 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 9N\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"central_meridian\",-129],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6338\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6339, "epsg", 6339,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=9 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 9N\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER"
+        "[\"central_meridian\",-129],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6338\"]]"},
+    {6339, "epsg", 6339,
         "NAD83(2011) / UTM zone 10N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=10 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 10N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-123],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6339\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6340, "epsg", 6340,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=10 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 10N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-123],PARAMETER[\"scale_factor\","
+        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6339\"]]"},
+    {6340, "epsg", 6340,
         "NAD83(2011) / UTM zone 11N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 11N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-117],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6340\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6341, "epsg", 6341,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=11 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 11N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-117],PARAMETER[\"scale_factor\","
+        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6340\"]]"},
+    {6341, "epsg", 6341,
         "NAD83(2011) / UTM zone 12N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 12N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-111],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6341\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6342, "epsg", 6342,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=12 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 12N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-111],PARAMETER[\"scale_factor\","
+        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6341\"]]"},
+    {6342, "epsg", 6342,
         "NAD83(2011) / UTM zone 13N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 13N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-105],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6342\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6343, "epsg", 6343,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=13 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 13N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-105],PARAMETER[\"scale_factor\","
+        "0.9996],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6342\"]]"},
+    {6343, "epsg", 6343,
         "NAD83(2011) / UTM zone 14N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=14 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 14N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-99],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6343\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6344, "epsg", 6344,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=14 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 14N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-99],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6343\"]]"},
+    {6344, "epsg", 6344,
         "NAD83(2011) / UTM zone 15N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 15N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-93],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6344\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6345, "epsg", 6345,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=15 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 15N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-93],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6344\"]]"},
+    {6345, "epsg", 6345,
         "NAD83(2011) / UTM zone 16N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 16N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-87],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6345\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6346, "epsg", 6346,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=16 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 16N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-87],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6345\"]]"},
+    {6346, "epsg", 6346,
         "NAD83(2011) / UTM zone 17N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 17N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-81],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6346\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6347, "epsg", 6347,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 17N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-81],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6346\"]]"},
+    {6347, "epsg", 6347,
         "NAD83(2011) / UTM zone 18N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 18N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-75],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6347\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6348, "epsg", 6348,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 18N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-75],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6347\"]]"},
+    {6348, "epsg", 6348,
         "NAD83(2011) / UTM zone 19N", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / UTM zone 19N\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-69],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 11,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"6348\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6349, "epsg", 6349,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / UTM zone 19N\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-69],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6348\"]]"},
+    {6349, "epsg", 6349,
         "NAD83(2011)", 1, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +geoidgrids=g2012a_conus.gtx,");
-    add_proj4text (p, 1,
-        "g2012a_alaska.gtx,g2012a_guam.gtx,g2012a_hawaii.gtx,g201");
-    add_proj4text (p, 2,
-        "2a_puertorico.gtx,g2012a_samoa.gtx +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"NAD83(2011) + NAVD88 height\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A");
-    add_srs_wkt (p, 7,
-        "UTHORITY[\"EPSG\",\"6318\"]],VERT_CS[\"NAVD88 height\",V");
-    add_srs_wkt (p, 8,
-        "ERT_DATUM[\"North American Vertical Datum 1988\",2005,AU");
-    add_srs_wkt (p, 9,
-        "THORITY[\"EPSG\",\"5103\"]],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Gravity-related height\",UP],AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"5703\"]],AUTHORITY[\"EPSG\",\"6349\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6350, "epsg", 6350,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +geoidgrids=g2012a_conus.gtx,"
+        "g2012a_alaska.gtx,g2012a_guam.gtx,g2012a_hawaii.gtx,g201"
+        "2a_puertorico.gtx,g2012a_samoa.gtx +vunits=m +no_defs",
+        "COMPD_CS[\"NAD83(2011) + NAVD88 height\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],A"
+        "UTHORITY[\"EPSG\",\"6318\"]],VERT_CS[\"NAVD88 height\",V"
+        "ERT_DATUM[\"North American Vertical Datum 1988\",2005,AU"
+        "THORITY[\"EPSG\",\"5103\"]],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Gravity-related height\",UP],AU"
+        "THORITY[\"EPSG\",\"5703\"]],AUTHORITY[\"EPSG\",\"6349\"]"
+        "]"},
+    {6350, "epsg", 6350,
         "NAD83(2011) / Conus Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=29.5 +lat_2=45.5 +lat_0=23 +lon_0=-96 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Conus Albers\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Albers_Coni");
-    add_srs_wkt (p, 7,
-        "c_Equal_Area\"],PARAMETER[\"latitude_of_center\",23],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"longitude_of_center\",-96],PARAMETER[\"standard");
-    add_srs_wkt (p, 9,
-        "_parallel_1\",29.5],PARAMETER[\"standard_parallel_2\",45");
-    add_srs_wkt (p, 10,
-        ".5],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"6350\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6351, "epsg", 6351,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=29.5 +lat_2=45.5 +lat_0=23 +lon_0=-96 +"
+        "x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Conus Albers\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Albers_Coni"
+        "c_Equal_Area\"],PARAMETER[\"latitude_of_center\",23],PAR"
+        "AMETER[\"longitude_of_center\",-96],PARAMETER[\"standard"
+        "_parallel_1\",29.5],PARAMETER[\"standard_parallel_2\",45"
+        ".5],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"6350\"]]"},
+    {6351, "epsg", 6351,
         "NAD83(2011) / EPSG Arctic zone 5-29", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=73.66666666666667 +lat_2=70.33333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=72.02500919444445 +lon_0=-163 +x_0=29500000 +");
-    add_proj4text (p, 2,
-        "y_0=5500000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / EPSG Arctic zone 5-29\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",72.0250091944445],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "163],PARAMETER[\"standard_parallel_1\",73.6666666666667]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",70.3333333333333],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",29500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",5500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 13,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 14,
-        "AUTHORITY[\"EPSG\",\"6351\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6352, "epsg", 6352,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=73.66666666666667 +lat_2=70.33333333333"
+        "333 +lat_0=72.02500919444445 +lon_0=-163 +x_0=29500000 +"
+        "y_0=5500000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / EPSG Arctic zone 5-29\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",72.0250091944445],PARAMETER[\"central_meridian\",-"
+        "163],PARAMETER[\"standard_parallel_1\",73.6666666666667]"
+        ",PARAMETER[\"standard_parallel_2\",70.3333333333333],PAR"
+        "AMETER[\"false_easting\",29500000],PARAMETER[\"false_nor"
+        "thing\",5500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9"
+        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"6351\"]]"},
+    {6352, "epsg", 6352,
         "NAD83(2011) / EPSG Arctic zone 5-31", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=73.66666666666667 +lat_2=70.33333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=72.02500919444445 +lon_0=-147 +x_0=31500000 +");
-    add_proj4text (p, 2,
-        "y_0=5500000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / EPSG Arctic zone 5-31\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",72.0250091944445],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "147],PARAMETER[\"standard_parallel_1\",73.6666666666667]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",70.3333333333333],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",31500000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",5500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 13,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 14,
-        "AUTHORITY[\"EPSG\",\"6352\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6353, "epsg", 6353,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=73.66666666666667 +lat_2=70.33333333333"
+        "333 +lat_0=72.02500919444445 +lon_0=-147 +x_0=31500000 +"
+        "y_0=5500000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / EPSG Arctic zone 5-31\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",72.0250091944445],PARAMETER[\"central_meridian\",-"
+        "147],PARAMETER[\"standard_parallel_1\",73.6666666666667]"
+        ",PARAMETER[\"standard_parallel_2\",70.3333333333333],PAR"
+        "AMETER[\"false_easting\",31500000],PARAMETER[\"false_nor"
+        "thing\",5500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9"
+        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"6352\"]]"},
+    {6353, "epsg", 6353,
         "NAD83(2011) / EPSG Arctic zone 6-14", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=70.33333333333333 +lat_2=67 +lat_0=68.6");
-    add_proj4text (p, 1,
-        "8747555555557 +lon_0=-165 +x_0=14500000 +y_0=6500000 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / EPSG Arctic zone 6-14\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",68.6874755555556],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "165],PARAMETER[\"standard_parallel_1\",70.3333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",67],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",14500000],PARAMETER[\"false_northing\",650000");
-    add_srs_wkt (p, 12,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"6353\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6354, "epsg", 6354,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=70.33333333333333 +lat_2=67 +lat_0=68.6"
+        "8747555555557 +lon_0=-165 +x_0=14500000 +y_0=6500000 +el"
+        "lps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / EPSG Arctic zone 6-14\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",68.6874755555556],PARAMETER[\"central_meridian\",-"
+        "165],PARAMETER[\"standard_parallel_1\",70.3333333333333]"
+        ",PARAMETER[\"standard_parallel_2\",67],PARAMETER[\"false"
+        "_easting\",14500000],PARAMETER[\"false_northing\",650000"
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"6353\"]]"},
+    {6354, "epsg", 6354,
         "NAD83(2011) / EPSG Arctic zone 6-16", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=70.33333333333333 +lat_2=67 +lat_0=68.6");
-    add_proj4text (p, 1,
-        "8747555555557 +lon_0=-147 +x_0=16500000 +y_0=6500000 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / EPSG Arctic zone 6-16\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",68.6874755555556],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "147],PARAMETER[\"standard_parallel_1\",70.3333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",67],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",16500000],PARAMETER[\"false_northing\",650000");
-    add_srs_wkt (p, 12,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"6354\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6355, "epsg", 6355,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=70.33333333333333 +lat_2=67 +lat_0=68.6"
+        "8747555555557 +lon_0=-147 +x_0=16500000 +y_0=6500000 +el"
+        "lps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / EPSG Arctic zone 6-16\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",68.6874755555556],PARAMETER[\"central_meridian\",-"
+        "147],PARAMETER[\"standard_parallel_1\",70.3333333333333]"
+        ",PARAMETER[\"standard_parallel_2\",67],PARAMETER[\"false"
+        "_easting\",16500000],PARAMETER[\"false_northing\",650000"
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"6354\"]]"},
+    {6355, "epsg", 6355,
         "NAD83(2011) / Alabama East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30.5 +lon_0=-85.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9996 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alabama East\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",30.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-85.8333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.99996],PARAMETER[\"false_easting\",2000");
-    add_srs_wkt (p, 10,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 11,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6355\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6356, "epsg", 6356,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30.5 +lon_0=-85.83333333333333 +k=0.9"
+        "9996 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alabama East\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",30.5],PARAM"
+        "ETER[\"central_meridian\",-85.8333333333333],PARAMETER[\""
+        "scale_factor\",0.99996],PARAMETER[\"false_easting\",2000"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6355\"]]"},
+    {6356, "epsg", 6356,
         "NAD83(2011) / Alabama West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-87.5 +k=0.999933333 +x_0=6");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alabama West\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-87.5],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.999933333],PARAMETER[\"false_easting\",600000],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6356\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6362, "epsg", 6362,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-87.5 +k=0.999933333 +x_0=6"
+        "00000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alabama West\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET"
+        "ER[\"central_meridian\",-87.5],PARAMETER[\"scale_factor\""
+        ",0.999933333],PARAMETER[\"false_easting\",600000],PARAME"
+        "TER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"6356\"]]"},
+    {6362, "epsg", 6362,
         "Mexico ITRF92 / LCC", 0, 1,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF92", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=17.5 +lat_2=29.5 +lat_0=12 +lon_0=-102 ");
-    add_proj4text (p, 1,
-        "+x_0=2500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF92 / LCC\",GEOGCS[\"Mexico ITRF92\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Mexico_ITRF92\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 2,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"1042\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4483\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",12],PARAMETER[\"central_meridian\",-102]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"standard_parallel_1\",17.5],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_2\",29.5],PARAMETER[\"false_easting\",250");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6362\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6364, "epsg", 6364,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=17.5 +lat_2=29.5 +lat_0=12 +lon_0=-102 "
+        "+x_0=2500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"Mexico ITRF92 / LCC\",GEOGCS[\"Mexico ITRF92\","
+        "DATUM[\"Mexico_ITRF92\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"1042\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4483\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",12],PARAMETER[\"central_meridian\",-102]"
+        ",PARAMETER[\"standard_parallel_1\",17.5],PARAMETER[\"sta"
+        "ndard_parallel_2\",29.5],PARAMETER[\"false_easting\",250"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX"
+        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6362\"]]"},
+    {6364, "epsg", 6364,
         "Mexico ITRF2008", 1, 1,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"Mexico ITRF2008\",DATUM[\"Mexico ITRF2008\",EL");
-    add_srs_wkt (p, 1,
-        "LIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"");
-    add_srs_wkt (p, 2,
-        "metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\"");
-    add_srs_wkt (p, 3,
-        ",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geodetic ");
-    add_srs_wkt (p, 4,
-        "latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.0");
-    add_srs_wkt (p, 5,
-        "174532925199433]],AXIS[\"geodetic longitude (Lon)\",east");
-    add_srs_wkt (p, 6,
-        ",ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS");
-    add_srs_wkt (p, 7,
-        "[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"met");
-    add_srs_wkt (p, 8,
-        "re\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Mexico - onsho");
-    add_srs_wkt (p, 9,
-        "re and offshore.\"],BBOX[12.1,-122.19,32.72,-84.64]],ID[");
-    add_srs_wkt (p, 10,
-        "\"EPSG\",6364]]");
-    p = add_epsg_def_ex (filter, first, last, 6365, "epsg", 6365,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"Mexico ITRF2008\",DATUM[\"Mexico ITRF2008\",EL"
+        "LIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\""
+        "metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\""
+        ",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geodetic "
+        "latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.0"
+        "174532925199433]],AXIS[\"geodetic longitude (Lon)\",east"
+        ",ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS"
+        "[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"met"
+        "re\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Mexico - onsho"
+        "re and offshore.\"],BBOX[12.1,-122.19,32.72,-84.64]],ID["
+        "\"EPSG\",6364]]"},
+    {6365, "epsg", 6365,
         "Mexico ITRF2008", 1, 1,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Mexico ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPH");
-    add_srs_wkt (p, 1,
-        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 2,
-        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"6365\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6366, "epsg", 6366,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Mexico ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPH"
+        "EROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPS"
+        "G\",\"7019\"]],AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Gr"
+        "eenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"6365\"]]"},
+    {6366, "epsg", 6366,
         "Mexico ITRF2008 / UTM zone 11N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF2008 / UTM zone 11N\",GEOGCS[\"Mexic");
-    add_srs_wkt (p, 1,
-        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-117],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"6366\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6367, "epsg", 6367,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=11 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mexico ITRF2008 / UTM zone 11N\",GEOGCS[\"Mexic"
+        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-117],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"6366\"]]"},
+    {6367, "epsg", 6367,
         "Mexico ITRF2008 / UTM zone 12N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF2008 / UTM zone 12N\",GEOGCS[\"Mexic");
-    add_srs_wkt (p, 1,
-        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-111],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"6367\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6368, "epsg", 6368,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=12 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mexico ITRF2008 / UTM zone 12N\",GEOGCS[\"Mexic"
+        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-111],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"6367\"]]"},
+    {6368, "epsg", 6368,
         "Mexico ITRF2008 / UTM zone 13N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF2008 / UTM zone 13N\",GEOGCS[\"Mexic");
-    add_srs_wkt (p, 1,
-        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-105],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"6368\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6369, "epsg", 6369,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=13 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mexico ITRF2008 / UTM zone 13N\",GEOGCS[\"Mexic"
+        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-105],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"6368\"]]"},
+    {6369, "epsg", 6369,
         "Mexico ITRF2008 / UTM zone 14N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF2008 / UTM zone 14N\",GEOGCS[\"Mexic");
-    add_srs_wkt (p, 1,
-        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-99],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "6369\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6370, "epsg", 6370,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=14 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mexico ITRF2008 / UTM zone 14N\",GEOGCS[\"Mexic"
+        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-99],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6369\"]]"},
+    {6370, "epsg", 6370,
         "Mexico ITRF2008 / UTM zone 15N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF2008 / UTM zone 15N\",GEOGCS[\"Mexic");
-    add_srs_wkt (p, 1,
-        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-93],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "6370\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6371, "epsg", 6371,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=15 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mexico ITRF2008 / UTM zone 15N\",GEOGCS[\"Mexic"
+        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-93],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6370\"]]"},
+    {6371, "epsg", 6371,
         "Mexico ITRF2008 / UTM zone 16N", 0, 0,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +");
-    add_proj4text (p, 1,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF2008 / UTM zone 16N\",GEOGCS[\"Mexic");
-    add_srs_wkt (p, 1,
-        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-87],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 11,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "6371\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6372, "epsg", 6372,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=16 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Mexico ITRF2008 / UTM zone 16N\",GEOGCS[\"Mexic"
+        "o ITRF2008\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"6365\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",-87],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6371\"]]"},
+    {6372, "epsg", 6372,
         "Mexico ITRF2008 / LCC", 0, 1,
         "GRS 1980", "Greenwich",
         "Mexico_ITRF2008", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=17.5 +lat_2=29.5 +lat_0=12 +lon_0=-102 ");
-    add_proj4text (p, 1,
-        "+x_0=2500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Mexico ITRF2008 / LCC\",GEOGCS[\"Mexico ITRF200");
-    add_srs_wkt (p, 1,
-        "8\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6365\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",12],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 8,
-        "-102],PARAMETER[\"standard_parallel_1\",17.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_2\",29.5],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",2500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6372\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6381, "epsg", 6381,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_1=17.5 +lat_2=29.5 +lat_0=12 +lon_0=-102 "
+        "+x_0=2500000 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"Mexico ITRF2008 / LCC\",GEOGCS[\"Mexico ITRF200"
+        "8\",DATUM[\"Mexico_ITRF2008\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"1120\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6365\"]]"
+        ",PROJECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\""
+        "latitude_of_origin\",12],PARAMETER[\"central_meridian\","
+        "-102],PARAMETER[\"standard_parallel_1\",17.5],PARAMETER["
+        "\"standard_parallel_2\",29.5],PARAMETER[\"false_easting\""
+        ",2500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6372\"]]"},
+    {6381, "epsg", 6381,
         "UCS-2000 / Ukraine TM zone 7", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Ukraine_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=300000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"UCS-2000 / Ukraine TM zone 7\",GEOGCS[\"UCS-200");
-    add_srs_wkt (p, 1,
-        "0\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\",");
-    add_srs_wkt (p, 2,
-        "6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",21],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6381\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6382, "epsg", 6382,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=300000 +y_0=0 +"
+        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"UCS-2000 / Ukraine TM zone 7\",GEOGCS[\"UCS-200"
+        "0\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\","
+        "6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\""
+        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",21],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6381\"]]"},
+    {6382, "epsg", 6382,
         "UCS-2000 / Ukraine TM zone 8", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Ukraine_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=300000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"UCS-2000 / Ukraine TM zone 8\",GEOGCS[\"UCS-200");
-    add_srs_wkt (p, 1,
-        "0\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\",");
-    add_srs_wkt (p, 2,
-        "6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",24],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6382\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6383, "epsg", 6383,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=24 +k=1 +x_0=300000 +y_0=0 +"
+        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"UCS-2000 / Ukraine TM zone 8\",GEOGCS[\"UCS-200"
+        "0\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\","
+        "6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\""
+        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",24],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6382\"]]"},
+    {6383, "epsg", 6383,
         "UCS-2000 / Ukraine TM zone 9", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Ukraine_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=300000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"UCS-2000 / Ukraine TM zone 9\",GEOGCS[\"UCS-200");
-    add_srs_wkt (p, 1,
-        "0\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\",");
-    add_srs_wkt (p, 2,
-        "6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",27],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6383\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6384, "epsg", 6384,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=300000 +y_0=0 +"
+        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"UCS-2000 / Ukraine TM zone 9\",GEOGCS[\"UCS-200"
+        "0\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\","
+        "6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\""
+        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",27],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6383\"]]"},
+    {6384, "epsg", 6384,
         "UCS-2000 / Ukraine TM zone 10", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Ukraine_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=300000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"UCS-2000 / Ukraine TM zone 10\",GEOGCS[\"UCS-20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\"");
-    add_srs_wkt (p, 2,
-        ",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",30],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6384\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6385, "epsg", 6385,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=30 +k=1 +x_0=300000 +y_0=0 +"
+        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"UCS-2000 / Ukraine TM zone 10\",GEOGCS[\"UCS-20"
+        "00\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\""
+        ",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\""
+        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",30],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6384\"]]"},
+    {6385, "epsg", 6385,
         "UCS-2000 / Ukraine TM zone 11", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Ukraine_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=300000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"UCS-2000 / Ukraine TM zone 11\",GEOGCS[\"UCS-20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\"");
-    add_srs_wkt (p, 2,
-        ",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",33],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6385\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6386, "epsg", 6386,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=300000 +y_0=0 +"
+        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"UCS-2000 / Ukraine TM zone 11\",GEOGCS[\"UCS-20"
+        "00\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\""
+        ",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\""
+        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",33],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6385\"]]"},
+    {6386, "epsg", 6386,
         "UCS-2000 / Ukraine TM zone 12", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Ukraine_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=300000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"UCS-2000 / Ukraine TM zone 12\",GEOGCS[\"UCS-20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\"");
-    add_srs_wkt (p, 2,
-        ",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",36],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6386\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6387, "epsg", 6387,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=36 +k=1 +x_0=300000 +y_0=0 +"
+        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"UCS-2000 / Ukraine TM zone 12\",GEOGCS[\"UCS-20"
+        "00\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\""
+        ",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\""
+        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",36],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6386\"]]"},
+    {6387, "epsg", 6387,
         "UCS-2000 / Ukraine TM zone 13", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Ukraine_2000", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=300000 +y_0=0 +");
-    add_proj4text (p, 1,
-        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"UCS-2000 / Ukraine TM zone 13\",GEOGCS[\"UCS-20");
-    add_srs_wkt (p, 1,
-        "00\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\"");
-    add_srs_wkt (p, 2,
-        ",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",39],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6387\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6391, "epsg", 6391,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=39 +k=1 +x_0=300000 +y_0=0 +"
+        "ellps=krass +towgs84=25,-141,-78.5,0,0.35,0.736,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"UCS-2000 / Ukraine TM zone 13\",GEOGCS[\"UCS-20"
+        "00\",DATUM[\"Ukraine_2000\",SPHEROID[\"Krassowsky 1940\""
+        ",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],AUTHORITY[\""
+        "EPSG\",\"1077\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"5561\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",39],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",30000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS["
+        "\"Easting\",EAST],AUTHORITY[\"EPSG\",\"6387\"]]"},
+    {6391, "epsg", 6391,
         "Cayman Islands National Grid 2011", 0, 0,
         "GRS 1980", "Greenwich",
         "Cayman_Islands_Geodetic_Datum_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=19.33333333333333 +lat_2=19.7 +lat_0=19");
-    add_proj4text (p, 1,
-        ".33333333333333 +lon_0=-80.56666666666666 +x_0=899160 +y");
-    add_proj4text (p, 2,
-        "_0=579120 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cayman Islands National Grid 2011\",GEOGCS[\"CI");
-    add_srs_wkt (p, 1,
-        "GD11\",DATUM[\"Cayman_Islands_Geodetic_Datum_2011\",SPHE");
-    add_srs_wkt (p, 2,
-        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"1100\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"6135\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",19.33333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-80.5666666666667]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_1\",19.3333333333333],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"standard_parallel_2\",19.7],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",2950000],PARAMETER[\"false_northing\",1900000],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"6391\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6393, "epsg", 6393,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=19.33333333333333 +lat_2=19.7 +lat_0=19"
+        ".33333333333333 +lon_0=-80.56666666666666 +x_0=899160 +y"
+        "_0=579120 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=ft "
+        "+no_defs",
+        "PROJCS[\"Cayman Islands National Grid 2011\",GEOGCS[\"CI"
+        "GD11\",DATUM[\"Cayman_Islands_Geodetic_Datum_2011\",SPHE"
+        "ROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG"
+        "\",\"7019\"]],AUTHORITY[\"EPSG\",\"1100\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6135\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_2SP\"],PARAMETER[\"latitude_of_origin\",19.33333333"
+        "33333],PARAMETER[\"central_meridian\",-80.5666666666667]"
+        ",PARAMETER[\"standard_parallel_1\",19.3333333333333],PAR"
+        "AMETER[\"standard_parallel_2\",19.7],PARAMETER[\"false_e"
+        "asting\",2950000],PARAMETER[\"false_northing\",1900000],"
+        "UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"6391\"]]"},
+    {6393, "epsg", 6393,
         "NAD83(2011) / Alaska Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0");
-    add_proj4text (p, 1,
-        "=0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska Albers\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Albers_Coni");
-    add_srs_wkt (p, 7,
-        "c_Equal_Area\"],PARAMETER[\"latitude_of_center\",50],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"longitude_of_center\",-154],PARAMETER[\"standar");
-    add_srs_wkt (p, 9,
-        "d_parallel_1\",55],PARAMETER[\"standard_parallel_2\",65]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_easting\",0],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 11,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"6393\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6394, "epsg", 6394,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=55 +lat_2=65 +lat_0=50 +lon_0=-154 +x_0"
+        "=0 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska Albers\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Albers_Coni"
+        "c_Equal_Area\"],PARAMETER[\"latitude_of_center\",50],PAR"
+        "AMETER[\"longitude_of_center\",-154],PARAMETER[\"standar"
+        "d_parallel_1\",55],PARAMETER[\"standard_parallel_2\",65]"
+        ",PARAMETER[\"false_easting\",0],PARAMETER[\"false_northi"
+        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"6393\"]]"},
+    {6394, "epsg", 6394,
         "NAD83(2011) / Alaska zone 1", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=57 +lonc=-133.6666666666667 +alpha=32");
-    add_proj4text (p, 1,
-        "3.1301023611111 +k=0.9999 +x_0=5000000 +y_0=-5000000 +no");
-    add_proj4text (p, 2,
-        "_uoff +gamma=323.1301023611111 +ellps=GRS80 +units=m +no");
-    add_proj4text (p, 3,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 1\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Hotine_Obli");
-    add_srs_wkt (p, 7,
-        "que_Mercator\"],PARAMETER[\"latitude_of_center\",57],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"longitude_of_center\",-133.666666666667],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"azimuth\",323.130102361111],PARAMETER[\"rectified_");
-    add_srs_wkt (p, 10,
-        "grid_angle\",323.130102361111],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 11,
-        ",0.9999],PARAMETER[\"false_easting\",5000000],PARAMETER[");
-    add_srs_wkt (p, 12,
-        "\"false_northing\",-5000000],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6394\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6395, "epsg", 6395,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=57 +lonc=-133.6666666666667 +alpha=32"
+        "3.1301023611111 +k=0.9999 +x_0=5000000 +y_0=-5000000 +no"
+        "_uoff +gamma=323.1301023611111 +ellps=GRS80 +units=m +no"
+        "_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 1\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Hotine_Obli"
+        "que_Mercator\"],PARAMETER[\"latitude_of_center\",57],PAR"
+        "AMETER[\"longitude_of_center\",-133.666666666667],PARAME"
+        "TER[\"azimuth\",323.130102361111],PARAMETER[\"rectified_"
+        "grid_angle\",323.130102361111],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",5000000],PARAMETER["
+        "\"false_northing\",-5000000],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6394\"]]"},
+    {6395, "epsg", 6395,
         "NAD83(2011) / Alaska zone 2", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-142 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 2\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-142],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6395\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6396, "epsg", 6396,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-142 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 2\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET"
+        "ER[\"central_meridian\",-142],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6395\"]]"},
+    {6396, "epsg", 6396,
         "NAD83(2011) / Alaska zone 3", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-146 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 3\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-146],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6396\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6397, "epsg", 6397,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-146 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 3\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET"
+        "ER[\"central_meridian\",-146],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6396\"]]"},
+    {6397, "epsg", 6397,
         "NAD83(2011) / Alaska zone 4", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-150 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 4\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-150],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6397\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6398, "epsg", 6398,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-150 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 4\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET"
+        "ER[\"central_meridian\",-150],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6397\"]]"},
+    {6398, "epsg", 6398,
         "NAD83(2011) / Alaska zone 5", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-154 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 5\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-154],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6398\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6399, "epsg", 6399,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-154 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 5\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET"
+        "ER[\"central_meridian\",-154],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6398\"]]"},
+    {6399, "epsg", 6399,
         "NAD83(2011) / Alaska zone 6", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-158 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 6\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-158],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6399\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6400, "epsg", 6400,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-158 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 6\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET"
+        "ER[\"central_meridian\",-158],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6399\"]]"},
+    {6400, "epsg", 6400,
         "NAD83(2011) / Alaska zone 7", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-162 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 7\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-162],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6400\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6401, "epsg", 6401,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-162 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 7\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET"
+        "ER[\"central_meridian\",-162],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6400\"]]"},
+    {6401, "epsg", 6401,
         "NAD83(2011) / Alaska zone 8", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-166 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 8\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-166],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6401\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6402, "epsg", 6402,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-166 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 8\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET"
+        "ER[\"central_meridian\",-166],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6401\"]]"},
+    {6402, "epsg", 6402,
         "NAD83(2011) / Alaska zone 9", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=54 +lon_0=-170 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 9\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-170],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"6402\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6403, "epsg", 6403,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=54 +lon_0=-170 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 9\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",54],PARAMET"
+        "ER[\"central_meridian\",-170],PARAMETER[\"scale_factor\""
+        ",0.9999],PARAMETER[\"false_easting\",500000],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6402\"]]"},
+    {6403, "epsg", 6403,
         "NAD83(2011) / Alaska zone 10", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=53.83333333333334 +lat_2=51.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=51 +lon_0=-176 +x_0=1000000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Alaska zone 10\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",51");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-176],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_1\",53.8333333333333],PARAMETER[\"standard_");
-    add_srs_wkt (p, 10,
-        "parallel_2\",51.8333333333333],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6403\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6404, "epsg", 6404,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=53.83333333333334 +lat_2=51.83333333333"
+        "334 +lat_0=51 +lon_0=-176 +x_0=1000000 +y_0=0 +ellps=GRS"
+        "80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Alaska zone 10\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",51"
+        "],PARAMETER[\"central_meridian\",-176],PARAMETER[\"stand"
+        "ard_parallel_1\",53.8333333333333],PARAMETER[\"standard_"
+        "parallel_2\",51.8333333333333],PARAMETER[\"false_easting"
+        "\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6403\"]]"},
+    {6404, "epsg", 6404,
         "NAD83(2011) / Arizona Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arizona Central\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 7,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-111.916666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",0.9999],PARAMETER[\"false_easting\",213");
-    add_srs_wkt (p, 10,
-        "360],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6404\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6405, "epsg", 6405,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Arizona Central\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver"
+        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARA"
+        "METER[\"central_meridian\",-111.916666666667],PARAMETER["
+        "\"scale_factor\",0.9999],PARAMETER[\"false_easting\",213"
+        "360],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6404\"]]"},
+    {6405, "epsg", 6405,
         "NAD83(2011) / Arizona Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arizona Central (ft)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-111.916666666667],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",700000],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0");
-    add_srs_wkt (p, 11,
-        ".3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6405\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6406, "epsg", 6406,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-111.9166666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Arizona Central (ft)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],"
+        "PARAMETER[\"central_meridian\",-111.916666666667],PARAME"
+        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",700000],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0"
+        ".3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6405\"]"
+        "]"},
+    {6406, "epsg", 6406,
         "NAD83(2011) / Arizona East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arizona East\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-110.166666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",213360");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6406\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6407, "epsg", 6407,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Arizona East\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAMET"
+        "ER[\"central_meridian\",-110.166666666667],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",213360"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6406\"]]"},
+    {6407, "epsg", 6407,
         "NAD83(2011) / Arizona East (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arizona East (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"central_meridian\",-110.166666666667],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",7");
-    add_srs_wkt (p, 10,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3");
-    add_srs_wkt (p, 11,
-        "048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6407\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6408, "epsg", 6408,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-110.1666666666667 +k=0.999"
+        "9 +x_0=213360 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Arizona East (ft)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PA"
+        "RAMETER[\"central_meridian\",-110.166666666667],PARAMETE"
+        "R[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",7"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3"
+        "048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6407\"]]"},
+    {6408, "epsg", 6408,
         "NAD83(2011) / Arizona West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0");
-    add_proj4text (p, 1,
-        "=213360 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arizona West\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-113.75],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.999933333],PARAMETER[\"false_easting\",213360],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 12,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6408\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6409, "epsg", 6409,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0"
+        "=213360 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Arizona West\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARAMET"
+        "ER[\"central_meridian\",-113.75],PARAMETER[\"scale_facto"
+        "r\",0.999933333],PARAMETER[\"false_easting\",213360],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6408\"]]"},
+    {6409, "epsg", 6409,
         "NAD83(2011) / Arizona West (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0");
-    add_proj4text (p, 1,
-        "=213360 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arizona West (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"central_meridian\",-113.75],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.999933333],PARAMETER[\"false_easting\",700000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6409\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6410, "epsg", 6410,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-113.75 +k=0.999933333 +x_0"
+        "=213360 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Arizona West (ft)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PA"
+        "RAMETER[\"central_meridian\",-113.75],PARAMETER[\"scale_"
+        "factor\",0.999933333],PARAMETER[\"false_easting\",700000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048,A"
+        "UTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6409\"]]"},
+    {6410, "epsg", 6410,
         "NAD83(2011) / Arkansas North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=400000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arkansas North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-92],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",36.2333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",34.9333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",400000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"6410\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6411, "epsg", 6411,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333"
+        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=400000 +y_0"
+        "=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Arkansas North\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34"
+        ".3333333333333],PARAMETER[\"central_meridian\",-92],PARA"
+        "METER[\"standard_parallel_1\",36.2333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",34.9333333333333],PARAMETER[\""
+        "false_easting\",400000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"6410\"]]"},
+    {6411, "epsg", 6411,
         "NAD83(2011) / Arkansas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arkansas North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",34.3333333333333],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "92],PARAMETER[\"standard_parallel_1\",36.2333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",34.9333333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",1312333.3333],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6411\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6412, "epsg", 6412,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.23333333333333 +lat_2=34.93333333333"
+        "333 +lat_0=34.33333333333334 +lon_0=-92 +x_0=399999.9999"
+        "8984 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Arkansas North (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",34.3333333333333],PARAMETER[\"central_meridian\",-"
+        "92],PARAMETER[\"standard_parallel_1\",36.2333333333333],"
+        "PARAMETER[\"standard_parallel_2\",34.9333333333333],PARA"
+        "METER[\"false_easting\",1312333.3333],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6411\"]]"},
+    {6412, "epsg", 6412,
         "NAD83(2011) / Arkansas South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-92 +x_0=400000 +y_0=400000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arkansas South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",32");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-92],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",34.7666666666667],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",33.3],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",400000],PARAMETER[\"false_northing\",400000],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"641");
-    add_srs_wkt (p, 14,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6413, "epsg", 6413,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32"
+        ".66666666666666 +lon_0=-92 +x_0=400000 +y_0=400000 +ellp"
+        "s=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Arkansas South\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",32"
+        ".6666666666667],PARAMETER[\"central_meridian\",-92],PARA"
+        "METER[\"standard_parallel_1\",34.7666666666667],PARAMETE"
+        "R[\"standard_parallel_2\",33.3],PARAMETER[\"false_eastin"
+        "g\",400000],PARAMETER[\"false_northing\",400000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"641"
+        "2\"]]"},
+    {6413, "epsg", 6413,
         "NAD83(2011) / Arkansas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-92 +x_0=399999.99998984 +y_0=399");
-    add_proj4text (p, 2,
-        "999.99998984 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Arkansas South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",32.6666666666667],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "92],PARAMETER[\"standard_parallel_1\",34.7666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",33.3],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",1312333.3333],PARAMETER[\"false_northing\",1");
-    add_srs_wkt (p, 12,
-        "312333.3333],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6413\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6414, "epsg", 6414,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.76666666666667 +lat_2=33.3 +lat_0=32"
+        ".66666666666666 +lon_0=-92 +x_0=399999.99998984 +y_0=399"
+        "999.99998984 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Arkansas South (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",32.6666666666667],PARAMETER[\"central_meridian\",-"
+        "92],PARAMETER[\"standard_parallel_1\",34.7666666666667],"
+        "PARAMETER[\"standard_parallel_2\",33.3],PARAMETER[\"fals"
+        "e_easting\",1312333.3333],PARAMETER[\"false_northing\",1"
+        "312333.3333],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6413\"]]"},
+    {6414, "epsg", 6414,
         "NAD83(2011) / California Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=-4000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California Albers\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Albers");
-    add_srs_wkt (p, 7,
-        "_Conic_Equal_Area\"],PARAMETER[\"latitude_of_center\",0]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"longitude_of_center\",-120],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",34],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",40.5],PARAMETER[\"false_easting\",0],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",-4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"6414\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6415, "epsg", 6415,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=34 +lat_2=40.5 +lat_0=0 +lon_0=-120 +x_"
+        "0=0 +y_0=-4000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / California Albers\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Albers"
+        "_Conic_Equal_Area\"],PARAMETER[\"latitude_of_center\",0]"
+        ",PARAMETER[\"longitude_of_center\",-120],PARAMETER[\"sta"
+        "ndard_parallel_1\",34],PARAMETER[\"standard_parallel_2\""
+        ",40.5],PARAMETER[\"false_easting\",0],PARAMETER[\"false_"
+        "northing\",-4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6414\"]]"},
+    {6415, "epsg", 6415,
         "NAD83(2011) / California zone 1", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3");
-    add_proj4text (p, 1,
-        "3333333333334 +lon_0=-122 +x_0=2000000 +y_0=500000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 1\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",39.3333333333333],PARAMETER[\"central_meridian\",-122],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",41.6666666666667],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",40],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",2000000],PARAMETER[\"false_northing\",500000],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 13,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "6415\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6416, "epsg", 6416,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3"
+        "3333333333334 +lon_0=-122 +x_0=2000000 +y_0=500000 +ellp"
+        "s=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 1\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",39.3333333333333],PARAMETER[\"central_meridian\",-122],"
+        "PARAMETER[\"standard_parallel_1\",41.6666666666667],PARA"
+        "METER[\"standard_parallel_2\",40],PARAMETER[\"false_east"
+        "ing\",2000000],PARAMETER[\"false_northing\",500000],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6415\"]]"},
+    {6416, "epsg", 6416,
         "NAD83(2011) / California zone 1 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3");
-    add_proj4text (p, 1,
-        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000");
-    add_proj4text (p, 2,
-        "00.0001016001 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 1 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",39.3333333333333],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-122],PARAMETER[\"standard_parallel_1\",41.666666666666");
-    add_srs_wkt (p, 10,
-        "7],PARAMETER[\"standard_parallel_2\",40],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_easting\",6561666.667],PARAMETER[\"false_northing\",1");
-    add_srs_wkt (p, 12,
-        "640416.667],UNIT[\"US survey foot\",0.304800609601219,AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 14,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6416\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6417, "epsg", 6417,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.66666666666666 +lat_2=40 +lat_0=39.3"
+        "3333333333334 +lon_0=-122 +x_0=2000000.0001016 +y_0=5000"
+        "00.0001016001 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 1 (ftUS)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",39.3333333333333],PARAMETER[\"central_meridian\""
+        ",-122],PARAMETER[\"standard_parallel_1\",41.666666666666"
+        "7],PARAMETER[\"standard_parallel_2\",40],PARAMETER[\"fal"
+        "se_easting\",6561666.667],PARAMETER[\"false_northing\",1"
+        "640416.667],UNIT[\"US survey foot\",0.304800609601219,AU"
+        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6416\"]]"},
+    {6417, "epsg", 6417,
         "NAD83(2011) / California zone 2", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000 +y");
-    add_proj4text (p, 2,
-        "_0=500000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 2\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",37.6666666666667],PARAMETER[\"central_meridian\",-122],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",39.8333333333333],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",38.3333333333333],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",2000000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"6417\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6418, "epsg", 6418,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333"
+        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000 +y"
+        "_0=500000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 2\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",37.6666666666667],PARAMETER[\"central_meridian\",-122],"
+        "PARAMETER[\"standard_parallel_1\",39.8333333333333],PARA"
+        "METER[\"standard_parallel_2\",38.3333333333333],PARAMETE"
+        "R[\"false_easting\",2000000],PARAMETER[\"false_northing\""
+        ",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"6417\"]]"},
+    {6418, "epsg", 6418,
         "NAD83(2011) / California zone 2 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00");
-    add_proj4text (p, 2,
-        "01016 +y_0=500000.0001016001 +ellps=GRS80 +units=us-ft +");
-    add_proj4text (p, 3,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 2 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",37.6666666666667],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-122],PARAMETER[\"standard_parallel_1\",39.833333333333");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"standard_parallel_2\",38.3333333333333],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",6561666.667],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_northing\",1640416.667],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 13,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 15,
-        "418\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6419, "epsg", 6419,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.83333333333334 +lat_2=38.33333333333"
+        "334 +lat_0=37.66666666666666 +lon_0=-122 +x_0=2000000.00"
+        "01016 +y_0=500000.0001016001 +ellps=GRS80 +units=us-ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 2 (ftUS)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",37.6666666666667],PARAMETER[\"central_meridian\""
+        ",-122],PARAMETER[\"standard_parallel_1\",39.833333333333"
+        "3],PARAMETER[\"standard_parallel_2\",38.3333333333333],P"
+        "ARAMETER[\"false_easting\",6561666.667],PARAMETER[\"fals"
+        "e_northing\",1640416.667],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6"
+        "418\"]]"},
+    {6419, "epsg", 6419,
         "NAD83(2011) / California zone 3", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000 +y_0=500000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 3\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",36.5],PARAMETER[\"central_meridian\",-120.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",38.4333333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",37.0666666666667],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",2000000],PARAMETER[\"false_northing\",500000],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"6419\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6420, "epsg", 6420,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666"
+        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000 +y_0=500000 +"
+        "ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 3\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",36.5],PARAMETER[\"central_meridian\",-120.5],PARAMETER["
+        "\"standard_parallel_1\",38.4333333333333],PARAMETER[\"st"
+        "andard_parallel_2\",37.0666666666667],PARAMETER[\"false_"
+        "easting\",2000000],PARAMETER[\"false_northing\",500000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"6419\"]]"},
+    {6420, "epsg", 6420,
         "NAD83(2011) / California zone 3 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0=");
-    add_proj4text (p, 2,
-        "500000.0001016001 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 3 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",36.5],PARAMETER[\"central_meridian\",-120.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",38.4333333333333],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",37.0666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",6561666.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",1640416.667],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6420\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6421, "epsg", 6421,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.06666666666"
+        "667 +lat_0=36.5 +lon_0=-120.5 +x_0=2000000.0001016 +y_0="
+        "500000.0001016001 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 3 (ftUS)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",36.5],PARAMETER[\"central_meridian\",-120.5],PAR"
+        "AMETER[\"standard_parallel_1\",38.4333333333333],PARAMET"
+        "ER[\"standard_parallel_2\",37.0666666666667],PARAMETER[\""
+        "false_easting\",6561666.667],PARAMETER[\"false_northing\""
+        ",1640416.667],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6420\"]]"},
+    {6421, "epsg", 6421,
         "NAD83(2011) / California zone 4", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333");
-    add_proj4text (p, 1,
-        "4 +lon_0=-119 +x_0=2000000 +y_0=500000 +ellps=GRS80 +uni");
-    add_proj4text (p, 2,
-        "ts=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 4\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",35.3333333333333],PARAMETER[\"central_meridian\",-119],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",37.25],PARAMETER[\"sta");
-    add_srs_wkt (p, 10,
-        "ndard_parallel_2\",36],PARAMETER[\"false_easting\",20000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",500000],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6421\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6422, "epsg", 6422,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333"
+        "4 +lon_0=-119 +x_0=2000000 +y_0=500000 +ellps=GRS80 +uni"
+        "ts=m +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 4\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",35.3333333333333],PARAMETER[\"central_meridian\",-119],"
+        "PARAMETER[\"standard_parallel_1\",37.25],PARAMETER[\"sta"
+        "ndard_parallel_2\",36],PARAMETER[\"false_easting\",20000"
+        "00],PARAMETER[\"false_northing\",500000],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6421\"]]"},
+    {6422, "epsg", 6422,
         "NAD83(2011) / California zone 4 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333");
-    add_proj4text (p, 1,
-        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600");
-    add_proj4text (p, 2,
-        "1 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 4 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",35.3333333333333],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-119],PARAMETER[\"standard_parallel_1\",37.25],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",36],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",6561666.667],PARAMETER[\"false_northing\",1640416.667],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP");
-    add_srs_wkt (p, 13,
-        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 14,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6422\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6423, "epsg", 6423,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.25 +lat_2=36 +lat_0=35.3333333333333"
+        "4 +lon_0=-119 +x_0=2000000.0001016 +y_0=500000.000101600"
+        "1 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 4 (ftUS)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",35.3333333333333],PARAMETER[\"central_meridian\""
+        ",-119],PARAMETER[\"standard_parallel_1\",37.25],PARAMETE"
+        "R[\"standard_parallel_2\",36],PARAMETER[\"false_easting\""
+        ",6561666.667],PARAMETER[\"false_northing\",1640416.667],"
+        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP"
+        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"6422\"]]"},
+    {6423, "epsg", 6423,
         "NAD83(2011) / California zone 5", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000 +y_0=500000 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 5\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",33.5],PARAMETER[\"central_meridian\",-118],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",35.4666666666667],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",34.0333333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",2000000],PARAMETER[\"false_northing\",500000],UN");
-    add_srs_wkt (p, 12,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 13,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 14,
-        "\"6423\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6424, "epsg", 6424,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333"
+        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000 +y_0=500000 +el"
+        "lps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 5\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",33.5],PARAMETER[\"central_meridian\",-118],PARAMETER[\""
+        "standard_parallel_1\",35.4666666666667],PARAMETER[\"stan"
+        "dard_parallel_2\",34.0333333333333],PARAMETER[\"false_ea"
+        "sting\",2000000],PARAMETER[\"false_northing\",500000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"6423\"]]"},
+    {6424, "epsg", 6424,
         "NAD83(2011) / California zone 5 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50");
-    add_proj4text (p, 2,
-        "0000.0001016001 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 5 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",33.5],PARAMETER[\"central_meridian\",-118],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",35.4666666666667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",34.0333333333333],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",6561666.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",1640416.667],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6424\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6425, "epsg", 6425,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.46666666666667 +lat_2=34.03333333333"
+        "333 +lat_0=33.5 +lon_0=-118 +x_0=2000000.0001016 +y_0=50"
+        "0000.0001016001 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 5 (ftUS)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",33.5],PARAMETER[\"central_meridian\",-118],PARAM"
+        "ETER[\"standard_parallel_1\",35.4666666666667],PARAMETER"
+        "[\"standard_parallel_2\",34.0333333333333],PARAMETER[\"f"
+        "alse_easting\",6561666.667],PARAMETER[\"false_northing\""
+        ",1640416.667],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6424\"]]"},
+    {6425, "epsg", 6425,
         "NAD83(2011) / California zone 6", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000");
-    add_proj4text (p, 2,
-        " +y_0=500000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 6\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",32.1666666666667],PARAMETER[\"central_meridian\",-116.2");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_1\",33.8833333333333],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",32.7833333333333],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",2000000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"6425\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6426, "epsg", 6426,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333"
+        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000"
+        " +y_0=500000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 6\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",32.1666666666667],PARAMETER[\"central_meridian\",-116.2"
+        "5],PARAMETER[\"standard_parallel_1\",33.8833333333333],P"
+        "ARAMETER[\"standard_parallel_2\",32.7833333333333],PARAM"
+        "ETER[\"false_easting\",2000000],PARAMETER[\"false_northi"
+        "ng\",500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"6425\"]]"},
+    {6426, "epsg", 6426,
         "NAD83(2011) / California zone 6 (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000");
-    add_proj4text (p, 2,
-        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / California zone 6 (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",32.1666666666667],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-116.25],PARAMETER[\"standard_parallel_1\",33.883333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"standard_parallel_2\",32.7833333333333");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",6561666.667],PARAMETER[\"f");
-    add_srs_wkt (p, 12,
-        "alse_northing\",1640416.667],UNIT[\"US survey foot\",0.3");
-    add_srs_wkt (p, 13,
-        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East");
-    add_srs_wkt (p, 14,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 15,
-        "\"6426\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6427, "epsg", 6427,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.88333333333333 +lat_2=32.78333333333"
+        "333 +lat_0=32.16666666666666 +lon_0=-116.25 +x_0=2000000"
+        ".0001016 +y_0=500000.0001016001 +ellps=GRS80 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(2011) / California zone 6 (ftUS)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",32.1666666666667],PARAMETER[\"central_meridian\""
+        ",-116.25],PARAMETER[\"standard_parallel_1\",33.883333333"
+        "3333],PARAMETER[\"standard_parallel_2\",32.7833333333333"
+        "],PARAMETER[\"false_easting\",6561666.667],PARAMETER[\"f"
+        "alse_northing\",1640416.667],UNIT[\"US survey foot\",0.3"
+        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"6426\"]]"},
+    {6427, "epsg", 6427,
         "NAD83(2011) / Colorado Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333");
-    add_proj4text (p, 1,
-        "3334 +lon_0=-105.5 +x_0=914401.8289 +y_0=304800.6096 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Colorado Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",37.8333333333333],PARAMETER[\"central_meridian\",-105.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",39.75],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",38.45],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "914401.8289],PARAMETER[\"false_northing\",304800.6096],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"6427\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6428, "epsg", 6428,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333"
+        "3334 +lon_0=-105.5 +x_0=914401.8289 +y_0=304800.6096 +el"
+        "lps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Colorado Central\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",37.8333333333333],PARAMETER[\"central_meridian\",-105.5"
+        "],PARAMETER[\"standard_parallel_1\",39.75],PARAMETER[\"s"
+        "tandard_parallel_2\",38.45],PARAMETER[\"false_easting\","
+        "914401.8289],PARAMETER[\"false_northing\",304800.6096],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"6427\"]]"},
+    {6428, "epsg", 6428,
         "NAD83(2011) / Colorado Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333");
-    add_proj4text (p, 1,
-        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60");
-    add_proj4text (p, 2,
-        "96012192 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Colorado Central (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",37.8333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-105.5],PARAMETER[\"standard_parallel_1\",39.75],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",38.45],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",3000000],PARAMETER[\"false_northing\",1000000],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"6428\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6429, "epsg", 6429,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.75 +lat_2=38.45 +lat_0=37.8333333333"
+        "3334 +lon_0=-105.5 +x_0=914401.8288036576 +y_0=304800.60"
+        "96012192 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Colorado Central (ftUS)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",37.8333333333333],PARAMETER[\"central_meridian\","
+        "-105.5],PARAMETER[\"standard_parallel_1\",39.75],PARAMET"
+        "ER[\"standard_parallel_2\",38.45],PARAMETER[\"false_east"
+        "ing\",3000000],PARAMETER[\"false_northing\",1000000],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6428\"]]"},
+    {6429, "epsg", 6429,
         "NAD83(2011) / Colorado North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "289 +y_0=304800.6096 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Colorado North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-105.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",40.7833333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",39.7166666666667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",914401.8289],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",304800.6096],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"6429\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6430, "epsg", 6430,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666"
+        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8"
+        "289 +y_0=304800.6096 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Colorado North\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39"
+        ".3333333333333],PARAMETER[\"central_meridian\",-105.5],P"
+        "ARAMETER[\"standard_parallel_1\",40.7833333333333],PARAM"
+        "ETER[\"standard_parallel_2\",39.7166666666667],PARAMETER"
+        "[\"false_easting\",914401.8289],PARAMETER[\"false_northi"
+        "ng\",304800.6096],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6429\"]]"},
+    {6430, "epsg", 6430,
         "NAD83(2011) / Colorado North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +units=us-");
-    add_proj4text (p, 3,
-        "ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Colorado North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",39.3333333333333],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "105.5],PARAMETER[\"standard_parallel_1\",40.783333333333");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"standard_parallel_2\",39.7166666666667],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",3000000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",1000000],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 13,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6430\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.78333333333333 +lat_2=39.71666666666"
+        "667 +lat_0=39.33333333333334 +lon_0=-105.5 +x_0=914401.8"
+        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +units=us-"
+        "ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Colorado North (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",39.3333333333333],PARAMETER[\"central_meridian\",-"
+        "105.5],PARAMETER[\"standard_parallel_1\",40.783333333333"
+        "3],PARAMETER[\"standard_parallel_2\",39.7166666666667],P"
+        "ARAMETER[\"false_easting\",3000000],PARAMETER[\"false_no"
+        "rthing\",1000000],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6430\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_31 = {
+    epsg_defs_31, sizeof (epsg_defs_31) / sizeof (epsg_defs_31[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
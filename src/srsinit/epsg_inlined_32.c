@@ -53,3963 +53,2240 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_32 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 6431, "epsg", 6431,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_32[] = {
+    {6431, "epsg", 6431,
         "NAD83(2011) / Colorado South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "289 +y_0=304800.6096 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Colorado South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-105.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",38.4333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",37.2333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",914401.8289],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",304800.6096],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"6431\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6432, "epsg", 6432,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333"
+        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8"
+        "289 +y_0=304800.6096 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Colorado South\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36"
+        ".6666666666667],PARAMETER[\"central_meridian\",-105.5],P"
+        "ARAMETER[\"standard_parallel_1\",38.4333333333333],PARAM"
+        "ETER[\"standard_parallel_2\",37.2333333333333],PARAMETER"
+        "[\"false_easting\",914401.8289],PARAMETER[\"false_northi"
+        "ng\",304800.6096],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6431\"]]"},
+    {6432, "epsg", 6432,
         "NAD83(2011) / Colorado South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8");
-    add_proj4text (p, 2,
-        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +units=us-");
-    add_proj4text (p, 3,
-        "ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Colorado South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",36.6666666666667],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "105.5],PARAMETER[\"standard_parallel_1\",38.433333333333");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"standard_parallel_2\",37.2333333333333],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",3000000],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",1000000],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 13,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6432\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6433, "epsg", 6433,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.43333333333333 +lat_2=37.23333333333"
+        "333 +lat_0=36.66666666666666 +lon_0=-105.5 +x_0=914401.8"
+        "288036576 +y_0=304800.6096012192 +ellps=GRS80 +units=us-"
+        "ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Colorado South (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",36.6666666666667],PARAMETER[\"central_meridian\",-"
+        "105.5],PARAMETER[\"standard_parallel_1\",38.433333333333"
+        "3],PARAMETER[\"standard_parallel_2\",37.2333333333333],P"
+        "ARAMETER[\"false_easting\",3000000],PARAMETER[\"false_no"
+        "rthing\",1000000],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6432\"]]"},
+    {6433, "epsg", 6433,
         "NAD83(2011) / Connecticut", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40");
-    add_proj4text (p, 1,
-        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096 +y_0=1524");
-    add_proj4text (p, 2,
-        "00.3048 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Connecticut\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.8");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-72.75],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",41.8666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",41.2],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",304800.6096],PARAMETER[\"false_northing\",152400.30");
-    add_srs_wkt (p, 12,
-        "48],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 14,
-        "PSG\",\"6433\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6434, "epsg", 6434,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40"
+        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096 +y_0=1524"
+        "00.3048 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Connecticut\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.8"
+        "333333333333],PARAMETER[\"central_meridian\",-72.75],PAR"
+        "AMETER[\"standard_parallel_1\",41.8666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",41.2],PARAMETER[\"false_easti"
+        "ng\",304800.6096],PARAMETER[\"false_northing\",152400.30"
+        "48],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"6433\"]]"},
+    {6434, "epsg", 6434,
         "NAD83(2011) / Connecticut (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40");
-    add_proj4text (p, 1,
-        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_");
-    add_proj4text (p, 2,
-        "0=152400.3048006096 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Connecticut (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",40.8333333333333],PARAMETER[\"central_meridian\",-72.");
-    add_srs_wkt (p, 9,
-        "75],PARAMETER[\"standard_parallel_1\",41.8666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",41.2],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",1000000],PARAMETER[\"false_northing\",500000");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6434\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6435, "epsg", 6435,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.86666666666667 +lat_2=41.2 +lat_0=40"
+        ".83333333333334 +lon_0=-72.75 +x_0=304800.6096012192 +y_"
+        "0=152400.3048006096 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Connecticut (ftUS)\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",40.8333333333333],PARAMETER[\"central_meridian\",-72."
+        "75],PARAMETER[\"standard_parallel_1\",41.8666666666667],"
+        "PARAMETER[\"standard_parallel_2\",41.2],PARAMETER[\"fals"
+        "e_easting\",1000000],PARAMETER[\"false_northing\",500000"
+        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"6434\"]]"},
+    {6435, "epsg", 6435,
         "NAD83(2011) / Delaware", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "995 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Delaware\",GEOGCS[\"NAD83(2011)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",-75.4166666666667],PARAMETER[\"scale_");
-    add_srs_wkt (p, 9,
-        "factor\",0.999995],PARAMETER[\"false_easting\",200000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6435\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6436, "epsg", 6436,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999"
+        "995 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Delaware\",GEOGCS[\"NAD83(2011)\""
+        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",38],PARAMETER[\""
+        "central_meridian\",-75.4166666666667],PARAMETER[\"scale_"
+        "factor\",0.999995],PARAMETER[\"false_easting\",200000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6435\"]]"},
+    {6436, "epsg", 6436,
         "NAD83(2011) / Delaware (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Delaware (ftUS)\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 7,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",38],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-75.4166666666667],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",0.999995],PARAMETER[\"false_easting\",6");
-    add_srs_wkt (p, 10,
-        "56166.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 11,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"6436\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6437, "epsg", 6437,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38 +lon_0=-75.41666666666667 +k=0.999"
+        "995 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +units=us"
+        "-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Delaware (ftUS)\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver"
+        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",38],PARA"
+        "METER[\"central_meridian\",-75.4166666666667],PARAMETER["
+        "\"scale_factor\",0.999995],PARAMETER[\"false_easting\",6"
+        "56166.667],PARAMETER[\"false_northing\",0],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"6436\"]]"},
+    {6437, "epsg", 6437,
         "NAD83(2011) / Florida East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Florida East\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",24.33333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-81],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.999941177],PARAMETER[\"false_easting\",2");
-    add_srs_wkt (p, 10,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 11,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6437\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6438, "epsg", 6438,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999"
+        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Florida East\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",24.33333333"
+        "33333],PARAMETER[\"central_meridian\",-81],PARAMETER[\"s"
+        "cale_factor\",0.999941177],PARAMETER[\"false_easting\",2"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6437\"]]"},
+    {6438, "epsg", 6438,
         "NAD83(2011) / Florida East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +units");
-    add_proj4text (p, 2,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Florida East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",24.3");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-81],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.999941177],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",656166.667],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"6438\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6439, "epsg", 6439,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-81 +k=0.999"
+        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Florida East (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",24.3"
+        "333333333333],PARAMETER[\"central_meridian\",-81],PARAME"
+        "TER[\"scale_factor\",0.999941177],PARAMETER[\"false_east"
+        "ing\",656166.667],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6438\"]]"},
+    {6439, "epsg", 6439,
         "NAD83(2011) / Florida GDL Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=24 +lat_2=31.5 +lat_0=24 +lon_0=-84 +x_");
-    add_proj4text (p, 1,
-        "0=400000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Florida GDL Albers\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Alber");
-    add_srs_wkt (p, 7,
-        "s_Conic_Equal_Area\"],PARAMETER[\"latitude_of_center\",2");
-    add_srs_wkt (p, 8,
-        "4],PARAMETER[\"longitude_of_center\",-84],PARAMETER[\"st");
-    add_srs_wkt (p, 9,
-        "andard_parallel_1\",24],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",31.5],PARAMETER[\"false_easting\",400000],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"6439\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6440, "epsg", 6440,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=24 +lat_2=31.5 +lat_0=24 +lon_0=-84 +x_"
+        "0=400000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Florida GDL Albers\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Alber"
+        "s_Conic_Equal_Area\"],PARAMETER[\"latitude_of_center\",2"
+        "4],PARAMETER[\"longitude_of_center\",-84],PARAMETER[\"st"
+        "andard_parallel_1\",24],PARAMETER[\"standard_parallel_2\""
+        ",31.5],PARAMETER[\"false_easting\",400000],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6439\"]]"},
+    {6440, "epsg", 6440,
         "NAD83(2011) / Florida North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2");
-    add_proj4text (p, 1,
-        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Florida North\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"central_meridian\",-84.5],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_1\",30.75],PARAMETER[\"standard_parallel_2\"");
-    add_srs_wkt (p, 10,
-        ",29.5833333333333],PARAMETER[\"false_easting\",600000],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6440\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6441, "epsg", 6441,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2"
+        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(2011) / Florida North\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29]"
+        ",PARAMETER[\"central_meridian\",-84.5],PARAMETER[\"stand"
+        "ard_parallel_1\",30.75],PARAMETER[\"standard_parallel_2\""
+        ",29.5833333333333],PARAMETER[\"false_easting\",600000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6440\"]]"},
+    {6441, "epsg", 6441,
         "NAD83(2011) / Florida North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2");
-    add_proj4text (p, 1,
-        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Florida North (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",29],PARAMETER[\"central_meridian\",-84.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",30.75],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",29.5833333333333],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 11,
-        "968500],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 12,
-        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"6441\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6442, "epsg", 6442,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.75 +lat_2=29.58333333333333 +lat_0=2"
+        "9 +lon_0=-84.5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=us"
+        "-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Florida North (ftUS)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",29],PARAMETER[\"central_meridian\",-84.5],PARAMETER["
+        "\"standard_parallel_1\",30.75],PARAMETER[\"standard_para"
+        "llel_2\",29.5833333333333],PARAMETER[\"false_easting\",1"
+        "968500],PARAMETER[\"false_northing\",0],UNIT[\"US survey"
+        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"6441\"]]"},
+    {6442, "epsg", 6442,
         "NAD83(2011) / Florida West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Florida West\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",24.33333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-82],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.999941177],PARAMETER[\"false_easting\",2");
-    add_srs_wkt (p, 10,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 11,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6442\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6443, "epsg", 6443,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999"
+        "941177 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Florida West\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",24.33333333"
+        "33333],PARAMETER[\"central_meridian\",-82],PARAMETER[\"s"
+        "cale_factor\",0.999941177],PARAMETER[\"false_easting\",2"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6442\"]]"},
+    {6443, "epsg", 6443,
         "NAD83(2011) / Florida West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999");
-    add_proj4text (p, 1,
-        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +units");
-    add_proj4text (p, 2,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Florida West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",24.3");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-82],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.999941177],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",656166.667],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"6443\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6444, "epsg", 6444,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.33333333333333 +lon_0=-82 +k=0.999"
+        "941177 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Florida West (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",24.3"
+        "333333333333],PARAMETER[\"central_meridian\",-82],PARAME"
+        "TER[\"scale_factor\",0.999941177],PARAMETER[\"false_east"
+        "ing\",656166.667],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6443\"]]"},
+    {6444, "epsg", 6444,
         "NAD83(2011) / Georgia East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Georgia East\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-82.1666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",200000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6444\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6445, "epsg", 6445,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999"
+        "9 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Georgia East\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET"
+        "ER[\"central_meridian\",-82.1666666666667],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",200000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6444\"]]"},
+    {6445, "epsg", 6445,
         "NAD83(2011) / Georgia East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +units=us-f");
-    add_proj4text (p, 2,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Georgia East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-82.1666666666667],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",656166.667],PARAMETER[\"false_northing\",0],UNIT[\"US s");
-    add_srs_wkt (p, 11,
-        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"6445\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6446, "epsg", 6446,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-82.16666666666667 +k=0.999"
+        "9 +x_0=200000.0001016002 +y_0=0 +ellps=GRS80 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(2011) / Georgia East (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],"
+        "PARAMETER[\"central_meridian\",-82.1666666666667],PARAME"
+        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",656166.667],PARAMETER[\"false_northing\",0],UNIT[\"US s"
+        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"6445\"]]"},
+    {6446, "epsg", 6446,
         "NAD83(2011) / Georgia West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=700000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Georgia West\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-84.1666666666667],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",700000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6446\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6447, "epsg", 6447,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999"
+        "9 +x_0=700000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Georgia West\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",30],PARAMET"
+        "ER[\"central_meridian\",-84.1666666666667],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",700000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6446\"]]"},
+    {6447, "epsg", 6447,
         "NAD83(2011) / Georgia West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999");
-    add_proj4text (p, 1,
-        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +units=us-f");
-    add_proj4text (p, 2,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Georgia West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-84.1666666666667],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",2296583.333],PARAMETER[\"false_northing\",0],UNIT[\"US ");
-    add_srs_wkt (p, 11,
-        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"6447\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6448, "epsg", 6448,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=-84.16666666666667 +k=0.999"
+        "9 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(2011) / Georgia West (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",30],"
+        "PARAMETER[\"central_meridian\",-84.1666666666667],PARAME"
+        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",2296583.333],PARAMETER[\"false_northing\",0],UNIT[\"US "
+        "survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"900"
+        "3\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"6447\"]]"},
+    {6448, "epsg", 6448,
         "NAD83(2011) / Idaho Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99");
-    add_proj4text (p, 1,
-        "99473679999999 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Idaho Central\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",41.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-114],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999947368],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6448\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6449, "epsg", 6449,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99"
+        "99473679999999 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(2011) / Idaho Central\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",41.66666666"
+        "66667],PARAMETER[\"central_meridian\",-114],PARAMETER[\""
+        "scale_factor\",0.999947368],PARAMETER[\"false_easting\","
+        "500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6448\"]]"},
+    {6449, "epsg", 6449,
         "NAD83(2011) / Idaho Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99");
-    add_proj4text (p, 1,
-        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Idaho Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.6");
-    add_srs_wkt (p, 8,
-        "666666666667],PARAMETER[\"central_meridian\",-114],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",0.999947368],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",1640416.667],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"6449\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6450, "epsg", 6450,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-114 +k=0.99"
+        "99473679999999 +x_0=500000.0001016001 +y_0=0 +ellps=GRS8"
+        "0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Idaho Central (ftUS)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.6"
+        "666666666667],PARAMETER[\"central_meridian\",-114],PARAM"
+        "ETER[\"scale_factor\",0.999947368],PARAMETER[\"false_eas"
+        "ting\",1640416.667],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6449\"]]"},
+    {6450, "epsg", 6450,
         "NAD83(2011) / Idaho East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.9999473679999999 +x_0=200000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Idaho East\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",41.6666666666667");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-112.166666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999947368],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",200000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6450");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6451, "epsg", 6451,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666"
+        "666667 +k=0.9999473679999999 +x_0=200000 +y_0=0 +ellps=G"
+        "RS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Idaho East\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",41.6666666666667"
+        "],PARAMETER[\"central_meridian\",-112.166666666667],PARA"
+        "METER[\"scale_factor\",0.999947368],PARAMETER[\"false_ea"
+        "sting\",200000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6450"
+        "\"]]"},
+    {6451, "epsg", 6451,
         "NAD83(2011) / Idaho East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Idaho East (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.666");
-    add_srs_wkt (p, 8,
-        "6666666667],PARAMETER[\"central_meridian\",-112.16666666");
-    add_srs_wkt (p, 9,
-        "6667],PARAMETER[\"scale_factor\",0.999947368],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",656166.667],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 11,
-        "\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6451\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6452, "epsg", 6452,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-112.1666666"
+        "666667 +k=0.9999473679999999 +x_0=200000.0001016002 +y_0"
+        "=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Idaho East (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.666"
+        "6666666667],PARAMETER[\"central_meridian\",-112.16666666"
+        "6667],PARAMETER[\"scale_factor\",0.999947368],PARAMETER["
+        "\"false_easting\",656166.667],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6451\"]]"},
+    {6452, "epsg", 6452,
         "NAD83(2011) / Idaho West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0");
-    add_proj4text (p, 1,
-        ".999933333 +x_0=800000 +y_0=0 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Idaho West\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",41.6666666666667");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-115.75],PARAMETER[\"sc");
-    add_srs_wkt (p, 9,
-        "ale_factor\",0.999933333],PARAMETER[\"false_easting\",80");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6452\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6453, "epsg", 6453,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0"
+        ".999933333 +x_0=800000 +y_0=0 +ellps=GRS80 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(2011) / Idaho West\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",41.6666666666667"
+        "],PARAMETER[\"central_meridian\",-115.75],PARAMETER[\"sc"
+        "ale_factor\",0.999933333],PARAMETER[\"false_easting\",80"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6452\"]]"},
+    {6453, "epsg", 6453,
         "NAD83(2011) / Idaho West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0");
-    add_proj4text (p, 1,
-        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Idaho West (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.666");
-    add_srs_wkt (p, 8,
-        "6666666667],PARAMETER[\"central_meridian\",-115.75],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999933333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",2624666.667],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"6453\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6454, "epsg", 6454,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.66666666666666 +lon_0=-115.75 +k=0"
+        ".999933333 +x_0=800000.0001016001 +y_0=0 +ellps=GRS80 +u"
+        "nits=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Idaho West (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.666"
+        "6666666667],PARAMETER[\"central_meridian\",-115.75],PARA"
+        "METER[\"scale_factor\",0.999933333],PARAMETER[\"false_ea"
+        "sting\",2624666.667],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6453\"]]"},
+    {6454, "epsg", 6454,
         "NAD83(2011) / Illinois East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333");
-    add_proj4text (p, 1,
-        "333333 +k=0.9999749999999999 +x_0=300000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Illinois East\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-88.3333333333333]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.999975],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",300000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"645");
-    add_srs_wkt (p, 13,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6455, "epsg", 6455,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333"
+        "333333 +k=0.9999749999999999 +x_0=300000 +y_0=0 +ellps=G"
+        "RS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Illinois East\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.66666666"
+        "66667],PARAMETER[\"central_meridian\",-88.3333333333333]"
+        ",PARAMETER[\"scale_factor\",0.999975],PARAMETER[\"false_"
+        "easting\",300000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"645"
+        "4\"]]"},
+    {6455, "epsg", 6455,
         "NAD83(2011) / Illinois East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333");
-    add_proj4text (p, 1,
-        "333333 +k=0.9999749999999999 +x_0=300000.0000000001 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Illinois East (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36.6");
-    add_srs_wkt (p, 8,
-        "666666666667],PARAMETER[\"central_meridian\",-88.3333333");
-    add_srs_wkt (p, 9,
-        "333333],PARAMETER[\"scale_factor\",0.999975],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",984250],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 11,
-        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP");
-    add_srs_wkt (p, 12,
-        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"6455\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6456, "epsg", 6456,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-88.33333333"
+        "333333 +k=0.9999749999999999 +x_0=300000.0000000001 +y_0"
+        "=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Illinois East (ftUS)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36.6"
+        "666666666667],PARAMETER[\"central_meridian\",-88.3333333"
+        "333333],PARAMETER[\"scale_factor\",0.999975],PARAMETER[\""
+        "false_easting\",984250],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EP"
+        "SG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"6455\"]]"},
+    {6456, "epsg", 6456,
         "NAD83(2011) / Illinois West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999941177 +x_0=700000 +y_0=0 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Illinois West\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-90.1666666666667]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",700000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "6456\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6457, "epsg", 6457,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666"
+        "666667 +k=0.999941177 +x_0=700000 +y_0=0 +ellps=GRS80 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Illinois West\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.66666666"
+        "66667],PARAMETER[\"central_meridian\",-90.1666666666667]"
+        ",PARAMETER[\"scale_factor\",0.999941177],PARAMETER[\"fal"
+        "se_easting\",700000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6456\"]]"},
+    {6457, "epsg", 6457,
         "NAD83(2011) / Illinois West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999941177 +x_0=699999.9999898402 +y_0=0 +ell");
-    add_proj4text (p, 2,
-        "ps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Illinois West (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36.6");
-    add_srs_wkt (p, 8,
-        "666666666667],PARAMETER[\"central_meridian\",-90.1666666");
-    add_srs_wkt (p, 9,
-        "666667],PARAMETER[\"scale_factor\",0.999941177],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_easting\",2296583.3333],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 11,
-        "hing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 12,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6457\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6458, "epsg", 6458,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.66666666666666 +lon_0=-90.16666666"
+        "666667 +k=0.999941177 +x_0=699999.9999898402 +y_0=0 +ell"
+        "ps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Illinois West (ftUS)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36.6"
+        "666666666667],PARAMETER[\"central_meridian\",-90.1666666"
+        "666667],PARAMETER[\"scale_factor\",0.999941177],PARAMETE"
+        "R[\"false_easting\",2296583.3333],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6457\"]]"},
+    {6458, "epsg", 6458,
         "NAD83(2011) / Indiana East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=100000 +y_0=250000 +ellps=GRS80 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Indiana East\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-85.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999966667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "100000],PARAMETER[\"false_northing\",250000],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6458\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6459, "epsg", 6459,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9"
+        "99966667 +x_0=100000 +y_0=250000 +ellps=GRS80 +units=m +"
+        "no_defs",
+        "PROJCS[\"NAD83(2011) / Indiana East\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-85.6666666666667],PARAMETER[\""
+        "scale_factor\",0.999966667],PARAMETER[\"false_easting\","
+        "100000],PARAMETER[\"false_northing\",250000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6458\"]"
+        "]"},
+    {6459, "epsg", 6459,
         "NAD83(2011) / Indiana East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Indiana East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-85.6666666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",328083.333],PARAMETER[\"false_northing\",820208.");
-    add_srs_wkt (p, 11,
-        "333],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6459\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6460, "epsg", 6460,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-85.66666666666667 +k=0.9"
+        "99966667 +x_0=99999.99989839978 +y_0=249999.9998983998 +"
+        "ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Indiana East (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5"
+        "],PARAMETER[\"central_meridian\",-85.6666666666667],PARA"
+        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea"
+        "sting\",328083.333],PARAMETER[\"false_northing\",820208."
+        "333],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY"
+        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6459\"]]"},
+    {6460, "epsg", 6460,
         "NAD83(2011) / Indiana West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=250000 +ellps=GRS80 +units=m +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Indiana West\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-87.0833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999966667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "900000],PARAMETER[\"false_northing\",250000],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6460\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6461, "epsg", 6461,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9"
+        "99966667 +x_0=900000 +y_0=250000 +ellps=GRS80 +units=m +"
+        "no_defs",
+        "PROJCS[\"NAD83(2011) / Indiana West\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-87.0833333333333],PARAMETER[\""
+        "scale_factor\",0.999966667],PARAMETER[\"false_easting\","
+        "900000],PARAMETER[\"false_northing\",250000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6460\"]"
+        "]"},
+    {6461, "epsg", 6461,
         "NAD83(2011) / Indiana West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Indiana West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-87.0833333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",2952750],PARAMETER[\"false_northing\",820208.333");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6461\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6462, "epsg", 6462,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-87.08333333333333 +k=0.9"
+        "99966667 +x_0=900000 +y_0=249999.9998983998 +ellps=GRS80"
+        " +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Indiana West (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",37.5"
+        "],PARAMETER[\"central_meridian\",-87.0833333333333],PARA"
+        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea"
+        "sting\",2952750],PARAMETER[\"false_northing\",820208.333"
+        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"6461\"]]"},
+    {6462, "epsg", 6462,
         "NAD83(2011) / Iowa North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=1000000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Iowa North\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.5],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"central_meridian\",-93.5],PARAMETER[\"standard");
-    add_srs_wkt (p, 9,
-        "_parallel_1\",43.2666666666667],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",42.0666666666667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "1500000],PARAMETER[\"false_northing\",1000000],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6462\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6463, "epsg", 6463,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666"
+        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=1000000 +"
+        "ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Iowa North\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.5],PA"
+        "RAMETER[\"central_meridian\",-93.5],PARAMETER[\"standard"
+        "_parallel_1\",43.2666666666667],PARAMETER[\"standard_par"
+        "allel_2\",42.0666666666667],PARAMETER[\"false_easting\","
+        "1500000],PARAMETER[\"false_northing\",1000000],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6462\""
+        "]]"},
+    {6463, "epsg", 6463,
         "NAD83(2011) / Iowa North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99");
-    add_proj4text (p, 2,
-        "99898402 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Iowa North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",41.5],PARAMETER[\"central_meridian\",-93.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",43.2666666666667],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",42.0666666666667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",4921250],PARAMETER[\"false_northing\",3280833.33");
-    add_srs_wkt (p, 12,
-        "33],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6463\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6464, "epsg", 6464,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.26666666666667 +lat_2=42.06666666666"
+        "667 +lat_0=41.5 +lon_0=-93.5 +x_0=1500000 +y_0=999999.99"
+        "99898402 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Iowa North (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",41.5],PARAMETER[\"central_meridian\",-93.5],PARAMETER[\""
+        "standard_parallel_1\",43.2666666666667],PARAMETER[\"stan"
+        "dard_parallel_2\",42.0666666666667],PARAMETER[\"false_ea"
+        "sting\",4921250],PARAMETER[\"false_northing\",3280833.33"
+        "33],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6463\"]]"},
+    {6464, "epsg", 6464,
         "NAD83(2011) / Iowa South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Iowa South\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-93.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",41.7833333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",40.6166666666667],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6464\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6465, "epsg", 6465,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666"
+        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000 +y_0=0 +ellps=GRS"
+        "80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Iowa South\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40],PARA"
+        "METER[\"central_meridian\",-93.5],PARAMETER[\"standard_p"
+        "arallel_1\",41.7833333333333],PARAMETER[\"standard_paral"
+        "lel_2\",40.6166666666667],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6464\"]]"},
+    {6465, "epsg", 6465,
         "NAD83(2011) / Iowa South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Iowa South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",40],PARAMETER[\"central_meridian\",-93.5],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",41.7833333333333],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",40.6166666666667],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",1640416.6667],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"6465\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6466, "epsg", 6466,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.61666666666"
+        "667 +lat_0=40 +lon_0=-93.5 +x_0=500000.00001016 +y_0=0 +"
+        "ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Iowa South (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",40],PARAMETER[\"central_meridian\",-93.5],PARAMETER[\"s"
+        "tandard_parallel_1\",41.7833333333333],PARAMETER[\"stand"
+        "ard_parallel_2\",40.6166666666667],PARAMETER[\"false_eas"
+        "ting\",1640416.6667],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6465\"]]"},
+    {6466, "epsg", 6466,
         "NAD83(2011) / Kansas North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=400000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kansas North\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38.");
-    add_srs_wkt (p, 8,
-        "3333333333333],PARAMETER[\"central_meridian\",-98],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",39.7833333333333],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",38.7166666666667],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",400000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"6466\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6467, "epsg", 6467,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666"
+        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=400000 +y_0"
+        "=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Kansas North\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38."
+        "3333333333333],PARAMETER[\"central_meridian\",-98],PARAM"
+        "ETER[\"standard_parallel_1\",39.7833333333333],PARAMETER"
+        "[\"standard_parallel_2\",38.7166666666667],PARAMETER[\"f"
+        "alse_easting\",400000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"6466\"]]"},
+    {6467, "epsg", 6467,
         "NAD83(2011) / Kansas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999");
-    add_proj4text (p, 2,
-        "8984 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kansas North (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",38.3333333333333],PARAMETER[\"central_meridian\",-98");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",39.7833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",38.7166666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1312333.3333],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",0],UNIT[\"US survey foot\",0.304800609601219,AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 14,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6467\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6468, "epsg", 6468,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.78333333333333 +lat_2=38.71666666666"
+        "667 +lat_0=38.33333333333334 +lon_0=-98 +x_0=399999.9999"
+        "8984 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Kansas North (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",38.3333333333333],PARAMETER[\"central_meridian\",-98"
+        "],PARAMETER[\"standard_parallel_1\",39.7833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",38.7166666666667],PARAME"
+        "TER[\"false_easting\",1312333.3333],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"US survey foot\",0.304800609601219,AU"
+        "THORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6467\"]]"},
+    {6468, "epsg", 6468,
         "NAD83(2011) / Kansas South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=400000 +y");
-    add_proj4text (p, 2,
-        "_0=400000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kansas South\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.");
-    add_srs_wkt (p, 8,
-        "6666666666667],PARAMETER[\"central_meridian\",-98.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",38.5666666666667],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"standard_parallel_2\",37.2666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",400000],PARAMETER[\"false_northing\",400");
-    add_srs_wkt (p, 12,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6468\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6469, "epsg", 6469,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666"
+        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=400000 +y"
+        "_0=400000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Kansas South\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36."
+        "6666666666667],PARAMETER[\"central_meridian\",-98.5],PAR"
+        "AMETER[\"standard_parallel_1\",38.5666666666667],PARAMET"
+        "ER[\"standard_parallel_2\",37.2666666666667],PARAMETER[\""
+        "false_easting\",400000],PARAMETER[\"false_northing\",400"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6468\"]]"},
+    {6469, "epsg", 6469,
         "NAD83(2011) / Kansas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99");
-    add_proj4text (p, 2,
-        "998984 +y_0=399999.99998984 +ellps=GRS80 +units=us-ft +n");
-    add_proj4text (p, 3,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kansas South (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",36.6666666666667],PARAMETER[\"central_meridian\",-98");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"standard_parallel_1\",38.5666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",37.2666666666667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",1312333.3333],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",1312333.3333],UNIT[\"US survey foot\",0.30480");
-    add_srs_wkt (p, 13,
-        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"646");
-    add_srs_wkt (p, 15,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6470, "epsg", 6470,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.56666666666667 +lat_2=37.26666666666"
+        "667 +lat_0=36.66666666666666 +lon_0=-98.5 +x_0=399999.99"
+        "998984 +y_0=399999.99998984 +ellps=GRS80 +units=us-ft +n"
+        "o_defs",
+        "PROJCS[\"NAD83(2011) / Kansas South (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",36.6666666666667],PARAMETER[\"central_meridian\",-98"
+        ".5],PARAMETER[\"standard_parallel_1\",38.5666666666667],"
+        "PARAMETER[\"standard_parallel_2\",37.2666666666667],PARA"
+        "METER[\"false_easting\",1312333.3333],PARAMETER[\"false_"
+        "northing\",1312333.3333],UNIT[\"US survey foot\",0.30480"
+        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"646"
+        "9\"]]"},
+    {6470, "epsg", 6470,
         "NAD83(2011) / Kentucky North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37");
-    add_srs_wkt (p, 8,
-        ".5],PARAMETER[\"central_meridian\",-84.25],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",37.9666666666667],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",38.9666666666667],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6470\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6471, "epsg", 6471,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666"
+        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000 +y_0=0 +ellps="
+        "GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Kentucky North\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37"
+        ".5],PARAMETER[\"central_meridian\",-84.25],PARAMETER[\"s"
+        "tandard_parallel_1\",37.9666666666667],PARAMETER[\"stand"
+        "ard_parallel_2\",38.9666666666667],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6470\""
+        "]]"},
+    {6471, "epsg", 6471,
         "NAD83(2011) / Kentucky North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",37.5],PARAMETER[\"central_meridian\",-84.25],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",37.9666666666667],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"standard_parallel_2\",38.9666666666667],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_easting\",1640416.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6471\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6472, "epsg", 6472,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=38.96666666666"
+        "667 +lat_0=37.5 +lon_0=-84.25 +x_0=500000.0001016001 +y_"
+        "0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Kentucky North (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",37.5],PARAMETER[\"central_meridian\",-84.25],PARAM"
+        "ETER[\"standard_parallel_1\",37.9666666666667],PARAMETER"
+        "[\"standard_parallel_2\",38.9666666666667],PARAMETER[\"f"
+        "alse_easting\",1640416.667],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6471\"]]"},
+    {6472, "epsg", 6472,
         "NAD83(2011) / Kentucky Single Zone", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=1000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky Single Zone\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",36.3333333333333],PARAMETER[\"central_meridian\",-85");
-    add_srs_wkt (p, 9,
-        ".75],PARAMETER[\"standard_parallel_1\",37.0833333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",38.6666666666667],PAR");
-    add_srs_wkt (p, 11,
-        "AMETER[\"false_easting\",1500000],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 12,
-        "hing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 14,
-        "UTHORITY[\"EPSG\",\"6472\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6473, "epsg", 6473,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666"
+        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 "
+        "+y_0=1000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Kentucky Single Zone\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",36.3333333333333],PARAMETER[\"central_meridian\",-85"
+        ".75],PARAMETER[\"standard_parallel_1\",37.0833333333333]"
+        ",PARAMETER[\"standard_parallel_2\",38.6666666666667],PAR"
+        "AMETER[\"false_easting\",1500000],PARAMETER[\"false_nort"
+        "hing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90"
+        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"6472\"]]"},
+    {6473, "epsg", 6473,
         "NAD83(2011) / Kentucky Single Zone (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 ");
-    add_proj4text (p, 2,
-        "+y_0=999999.9998983998 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 3,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky Single Zone (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",36.3333333333333],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-85.75],PARAMETER[\"standard_parallel_1\",37.083333");
-    add_srs_wkt (p, 10,
-        "3333333],PARAMETER[\"standard_parallel_2\",38.6666666666");
-    add_srs_wkt (p, 11,
-        "667],PARAMETER[\"false_easting\",4921250],PARAMETER[\"fa");
-    add_srs_wkt (p, 12,
-        "lse_northing\",3280833.333],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 13,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 14,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 15,
-        "6473\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6474, "epsg", 6474,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.08333333333334 +lat_2=38.66666666666"
+        "666 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=1500000 "
+        "+y_0=999999.9998983998 +ellps=GRS80 +units=us-ft +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / Kentucky Single Zone (ftUS)\",GEO"
+        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",36.3333333333333],PARAMETER[\"central_meridi"
+        "an\",-85.75],PARAMETER[\"standard_parallel_1\",37.083333"
+        "3333333],PARAMETER[\"standard_parallel_2\",38.6666666666"
+        "667],PARAMETER[\"false_easting\",4921250],PARAMETER[\"fa"
+        "lse_northing\",3280833.333],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6473\"]]"},
+    {6474, "epsg", 6474,
         "NAD83(2011) / Kentucky South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=500000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-85.75],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",37.9333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",36.7333333333333],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"6474\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6475, "epsg", 6475,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333"
+        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000 +"
+        "y_0=500000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Kentucky South\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36"
+        ".3333333333333],PARAMETER[\"central_meridian\",-85.75],P"
+        "ARAMETER[\"standard_parallel_1\",37.9333333333333],PARAM"
+        "ETER[\"standard_parallel_2\",36.7333333333333],PARAMETER"
+        "[\"false_easting\",500000],PARAMETER[\"false_northing\","
+        "500000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"6474\"]]"},
+    {6475, "epsg", 6475,
         "NAD83(2011) / Kentucky South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +units=us-");
-    add_proj4text (p, 3,
-        "ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Kentucky South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",36.3333333333333],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "85.75],PARAMETER[\"standard_parallel_1\",37.933333333333");
-    add_srs_wkt (p, 10,
-        "3],PARAMETER[\"standard_parallel_2\",36.7333333333333],P");
-    add_srs_wkt (p, 11,
-        "ARAMETER[\"false_easting\",1640416.667],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_northing\",1640416.667],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 13,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 15,
-        "475\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6476, "epsg", 6476,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.93333333333333 +lat_2=36.73333333333"
+        "333 +lat_0=36.33333333333334 +lon_0=-85.75 +x_0=500000.0"
+        "001016001 +y_0=500000.0001016001 +ellps=GRS80 +units=us-"
+        "ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Kentucky South (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",36.3333333333333],PARAMETER[\"central_meridian\",-"
+        "85.75],PARAMETER[\"standard_parallel_1\",37.933333333333"
+        "3],PARAMETER[\"standard_parallel_2\",36.7333333333333],P"
+        "ARAMETER[\"false_easting\",1640416.667],PARAMETER[\"fals"
+        "e_northing\",1640416.667],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6"
+        "475\"]]"},
+    {6476, "epsg", 6476,
         "NAD83(2011) / Louisiana North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=1000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Louisiana North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "30.5],PARAMETER[\"central_meridian\",-92.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",32.6666666666667],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",31.1666666666667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",1000000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"647");
-    add_srs_wkt (p, 14,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6477, "epsg", 6477,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666"
+        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=1000000 +y_0=0 +ellps="
+        "GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Louisiana North\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "30.5],PARAMETER[\"central_meridian\",-92.5],PARAMETER[\""
+        "standard_parallel_1\",32.6666666666667],PARAMETER[\"stan"
+        "dard_parallel_2\",31.1666666666667],PARAMETER[\"false_ea"
+        "sting\",1000000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"647"
+        "6\"]]"},
+    {6477, "epsg", 6477,
         "NAD83(2011) / Louisiana North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Louisiana North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",30.5],PARAMETER[\"central_meridian\",-92.5],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",32.6666666666667],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",31.1666666666667],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",3280833.3333],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6477\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6478, "epsg", 6478,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=32.66666666666666 +lat_2=31.16666666666"
+        "667 +lat_0=30.5 +lon_0=-92.5 +x_0=999999.9999898402 +y_0"
+        "=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Louisiana North (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",30.5],PARAMETER[\"central_meridian\",-92.5],PARAME"
+        "TER[\"standard_parallel_1\",32.6666666666667],PARAMETER["
+        "\"standard_parallel_2\",31.1666666666667],PARAMETER[\"fa"
+        "lse_easting\",3280833.3333],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6477\"]]"},
+    {6478, "epsg", 6478,
         "NAD83(2011) / Louisiana South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=1000000 +y_0=0 +ellps=GRS80 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Louisiana South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "28.5],PARAMETER[\"central_meridian\",-91.3333333333333],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",30.7],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",29.3],PARAMETER[\"false_easting\",1000");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6478\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6479, "epsg", 6479,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91"
+        ".33333333333333 +x_0=1000000 +y_0=0 +ellps=GRS80 +units="
+        "m +no_defs",
+        "PROJCS[\"NAD83(2011) / Louisiana South\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "28.5],PARAMETER[\"central_meridian\",-91.3333333333333],"
+        "PARAMETER[\"standard_parallel_1\",30.7],PARAMETER[\"stan"
+        "dard_parallel_2\",29.3],PARAMETER[\"false_easting\",1000"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6478\"]]"},
+    {6479, "epsg", 6479,
         "NAD83(2011) / Louisiana South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91");
-    add_proj4text (p, 1,
-        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Louisiana South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",28.5],PARAMETER[\"central_meridian\",-91.333333333");
-    add_srs_wkt (p, 9,
-        "3333],PARAMETER[\"standard_parallel_1\",30.7],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",29.3],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",3280833.3333],PARAMETER[\"false_northing\",0],UNIT[\"US");
-    add_srs_wkt (p, 12,
-        " survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 13,
-        "03\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 14,
-        "UTHORITY[\"EPSG\",\"6479\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6480, "epsg", 6480,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.7 +lat_2=29.3 +lat_0=28.5 +lon_0=-91"
+        ".33333333333333 +x_0=999999.9999898402 +y_0=0 +ellps=GRS"
+        "80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Louisiana South (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",28.5],PARAMETER[\"central_meridian\",-91.333333333"
+        "3333],PARAMETER[\"standard_parallel_1\",30.7],PARAMETER["
+        "\"standard_parallel_2\",29.3],PARAMETER[\"false_easting\""
+        ",3280833.3333],PARAMETER[\"false_northing\",0],UNIT[\"US"
+        " survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"90"
+        "03\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"6479\"]]"},
+    {6480, "epsg", 6480,
         "NAD83(2011) / Maine CS2000 Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5");
-    add_proj4text (p, 1,
-        "00000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine CS2000 Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-69.125],PARAMETER[\"sc");
-    add_srs_wkt (p, 9,
-        "ale_factor\",0.99998],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 12,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6480\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6481, "epsg", 6481,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.5 +lon_0=-69.125 +k=0.99998 +x_0=5"
+        "00000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Maine CS2000 Central\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.5"
+        "],PARAMETER[\"central_meridian\",-69.125],PARAMETER[\"sc"
+        "ale_factor\",0.99998],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6480\"]]"},
+    {6481, "epsg", 6481,
         "NAD83(2011) / Maine CS2000 East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine CS2000 East\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.833");
-    add_srs_wkt (p, 8,
-        "3333333333],PARAMETER[\"central_meridian\",-67.875],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.99998],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",700000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6481\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6482, "epsg", 6482,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.83333333333334 +lon_0=-67.875 +k=0"
+        ".99998 +x_0=700000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Maine CS2000 East\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.833"
+        "3333333333],PARAMETER[\"central_meridian\",-67.875],PARA"
+        "METER[\"scale_factor\",0.99998],PARAMETER[\"false_eastin"
+        "g\",700000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6481\"]]"},
+    {6482, "epsg", 6482,
         "NAD83(2011) / Maine CS2000 West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0");
-    add_proj4text (p, 1,
-        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine CS2000 West\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.833");
-    add_srs_wkt (p, 8,
-        "3333333333],PARAMETER[\"central_meridian\",-70.375],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.99998],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",300000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6482\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6483, "epsg", 6483,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.375 +k=0"
+        ".99998 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Maine CS2000 West\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.833"
+        "3333333333],PARAMETER[\"central_meridian\",-70.375],PARA"
+        "METER[\"scale_factor\",0.99998],PARAMETER[\"false_eastin"
+        "g\",300000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6482\"]]"},
+    {6483, "epsg", 6483,
         "NAD83(2011) / Maine East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine East\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",43.6666666666667");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-68.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 9,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",300000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6483\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6484, "epsg", 6484,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9"
+        "999 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Maine East\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",43.6666666666667"
+        "],PARAMETER[\"central_meridian\",-68.5],PARAMETER[\"scal"
+        "e_factor\",0.9999],PARAMETER[\"false_easting\",300000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6483\"]]"},
+    {6484, "epsg", 6484,
         "NAD83(2011) / Maine East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine East (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.666");
-    add_srs_wkt (p, 8,
-        "6666666667],PARAMETER[\"central_meridian\",-68.5],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",984250],PARAMETER[\"false_northing\",0],UNIT[\"US surve");
-    add_srs_wkt (p, 11,
-        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"6484\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6485, "epsg", 6485,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.66666666666666 +lon_0=-68.5 +k=0.9"
+        "999 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +units=us"
+        "-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Maine East (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",43.666"
+        "6666666667],PARAMETER[\"central_meridian\",-68.5],PARAME"
+        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",984250],PARAMETER[\"false_northing\",0],UNIT[\"US surve"
+        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"6484\"]]"},
+    {6485, "epsg", 6485,
         "NAD83(2011) / Maine West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine West\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",42.8333333333333");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-70.1666666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",900000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6485");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6486, "epsg", 6486,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666"
+        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Maine West\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",42.8333333333333"
+        "],PARAMETER[\"central_meridian\",-70.1666666666667],PARA"
+        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea"
+        "sting\",900000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6485"
+        "\"]]"},
+    {6486, "epsg", 6486,
         "NAD83(2011) / Maine West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maine West (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.833");
-    add_srs_wkt (p, 8,
-        "3333333333],PARAMETER[\"central_meridian\",-70.166666666");
-    add_srs_wkt (p, 9,
-        "6667],PARAMETER[\"scale_factor\",0.999966667],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",2952750],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6486\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6487, "epsg", 6487,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.83333333333334 +lon_0=-70.16666666"
+        "666667 +k=0.999966667 +x_0=900000 +y_0=0 +ellps=GRS80 +u"
+        "nits=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Maine West (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.833"
+        "3333333333],PARAMETER[\"central_meridian\",-70.166666666"
+        "6667],PARAMETER[\"scale_factor\",0.999966667],PARAMETER["
+        "\"false_easting\",2952750],PARAMETER[\"false_northing\","
+        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"6486\"]]"},
+    {6487, "epsg", 6487,
         "NAD83(2011) / Maryland", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=400000 +y_0=0 +ellps=GRS80 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maryland\",GEOGCS[\"NAD83(2011)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-77],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",39.45],PARAMETER[\"standard_para");
-    add_srs_wkt (p, 10,
-        "llel_2\",38.3],PARAMETER[\"false_easting\",400000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6487\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6488, "epsg", 6488,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666"
+        "666 +lon_0=-77 +x_0=400000 +y_0=0 +ellps=GRS80 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(2011) / Maryland\",GEOGCS[\"NAD83(2011)\""
+        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37.66666"
+        "66666667],PARAMETER[\"central_meridian\",-77],PARAMETER["
+        "\"standard_parallel_1\",39.45],PARAMETER[\"standard_para"
+        "llel_2\",38.3],PARAMETER[\"false_easting\",400000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"6487\"]]"},
+    {6488, "epsg", 6488,
         "NAD83(2011) / Maryland (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666");
-    add_proj4text (p, 1,
-        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Maryland (ftUS)\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "37.6666666666667],PARAMETER[\"central_meridian\",-77],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",39.45],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",38.3],PARAMETER[\"false_easting\",13123");
-    add_srs_wkt (p, 11,
-        "33.333],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 12,
-        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"6488\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6489, "epsg", 6489,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.45 +lat_2=38.3 +lat_0=37.66666666666"
+        "666 +lon_0=-77 +x_0=399999.9998983998 +y_0=0 +ellps=GRS8"
+        "0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Maryland (ftUS)\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "37.6666666666667],PARAMETER[\"central_meridian\",-77],PA"
+        "RAMETER[\"standard_parallel_1\",39.45],PARAMETER[\"stand"
+        "ard_parallel_2\",38.3],PARAMETER[\"false_easting\",13123"
+        "33.333],PARAMETER[\"false_northing\",0],UNIT[\"US survey"
+        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"6488\"]]"},
+    {6489, "epsg", 6489,
         "NAD83(2011) / Massachusetts Island", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Massachusetts Island\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",41],PARAMETER[\"central_meridian\",-70.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",41.4833333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",41.2833333333333],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"648");
-    add_srs_wkt (p, 14,
-        "9\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6490, "epsg", 6490,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333"
+        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000 +y_0=0 +ellps=GRS"
+        "80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Massachusetts Island\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",41],PARAMETER[\"central_meridian\",-70.5],PARAMETER["
+        "\"standard_parallel_1\",41.4833333333333],PARAMETER[\"st"
+        "andard_parallel_2\",41.2833333333333],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"648"
+        "9\"]]"},
+    {6490, "epsg", 6490,
         "NAD83(2011) / Massachusetts Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Massachusetts Island (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",41],PARAMETER[\"central_meridian\",-70.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",41.4833333333333],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",41.2833333333333],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",1640416.667],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"6490\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6491, "epsg", 6491,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.48333333333333 +lat_2=41.28333333333"
+        "333 +lat_0=41 +lon_0=-70.5 +x_0=500000.0001016001 +y_0=0"
+        " +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Massachusetts Island (ftUS)\",GEO"
+        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",41],PARAMETER[\"central_meridian\",-70.5],PA"
+        "RAMETER[\"standard_parallel_1\",41.4833333333333],PARAME"
+        "TER[\"standard_parallel_2\",41.2833333333333],PARAMETER["
+        "\"false_easting\",1640416.667],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORI"
+        "TY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"6490\"]]"},
+    {6491, "epsg", 6491,
         "NAD83(2011) / Massachusetts Mainland", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000 +y_0=750000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Massachusetts Mainland\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",41],PARAMETER[\"central_meridian\",-71.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",42.6833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",41.7166666666667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",200000],PARAMETER[\"false_northing\",750000]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"6491\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6492, "epsg", 6492,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666"
+        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000 +y_0=750000 +ellp"
+        "s=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Massachusetts Mainland\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",41],PARAMETER[\"central_meridian\",-71.5],PARAMETE"
+        "R[\"standard_parallel_1\",42.6833333333333],PARAMETER[\""
+        "standard_parallel_2\",41.7166666666667],PARAMETER[\"fals"
+        "e_easting\",200000],PARAMETER[\"false_northing\",750000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"6491\"]]"},
+    {6492, "epsg", 6492,
         "NAD83(2011) / Massachusetts Mainland (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7");
-    add_proj4text (p, 2,
-        "50000 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Massachusetts Mainland (ftUS)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",41],PARAMETER[\"central_meridian\",-71.5],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",42.6833333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",41.7166666666667],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_easting\",656166.667],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",2460625],UNIT[\"US survey foot\",0.304800609601219,A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 14,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6492\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6493, "epsg", 6493,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.68333333333333 +lat_2=41.71666666666"
+        "667 +lat_0=41 +lon_0=-71.5 +x_0=200000.0001016002 +y_0=7"
+        "50000 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Massachusetts Mainland (ftUS)\",G"
+        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude"
+        "_of_origin\",41],PARAMETER[\"central_meridian\",-71.5],P"
+        "ARAMETER[\"standard_parallel_1\",42.6833333333333],PARAM"
+        "ETER[\"standard_parallel_2\",41.7166666666667],PARAMETER"
+        "[\"false_easting\",656166.667],PARAMETER[\"false_northin"
+        "g\",2460625],UNIT[\"US survey foot\",0.304800609601219,A"
+        "UTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6492\"]]"},
+    {6493, "epsg", 6493,
         "NAD83(2011) / Michigan Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=6000000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",43.3166666666667],PARAMETER[\"central_meridian\",-84.36");
-    add_srs_wkt (p, 9,
-        "66666666667],PARAMETER[\"standard_parallel_1\",45.7],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"standard_parallel_2\",44.1833333333333],PARAMET");
-    add_srs_wkt (p, 11,
-        "ER[\"false_easting\",6000000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6493\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6494, "epsg", 6494,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43"
+        ".31666666666667 +lon_0=-84.36666666666666 +x_0=6000000 +"
+        "y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Michigan Central\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",43.3166666666667],PARAMETER[\"central_meridian\",-84.36"
+        "66666666667],PARAMETER[\"standard_parallel_1\",45.7],PAR"
+        "AMETER[\"standard_parallel_2\",44.1833333333333],PARAMET"
+        "ER[\"false_easting\",6000000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6493\"]]"},
+    {6494, "epsg", 6494,
         "NAD83(2011) / Michigan Central (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43");
-    add_proj4text (p, 1,
-        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9");
-    add_proj4text (p, 2,
-        "99976001 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan Central (ft)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",43.3166666666667],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "84.3666666666667],PARAMETER[\"standard_parallel_1\",45.7");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"standard_parallel_2\",44.1833333333333],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_easting\",19685039.37],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"6494\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6495, "epsg", 6495,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.7 +lat_2=44.18333333333333 +lat_0=43"
+        ".31666666666667 +lon_0=-84.36666666666666 +x_0=5999999.9"
+        "99976001 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Michigan Central (ft)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",43.3166666666667],PARAMETER[\"central_meridian\",-"
+        "84.3666666666667],PARAMETER[\"standard_parallel_1\",45.7"
+        "],PARAMETER[\"standard_parallel_2\",44.1833333333333],PA"
+        "RAMETER[\"false_easting\",19685039.37],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\""
+        "9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6494\"]]"},
+    {6495, "epsg", 6495,
         "NAD83(2011) / Michigan North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=8000000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44");
-    add_srs_wkt (p, 8,
-        ".7833333333333],PARAMETER[\"central_meridian\",-87],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",47.0833333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",45.4833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",8000000],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"6495\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6496, "epsg", 6496,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333"
+        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=8000000 +y_"
+        "0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Michigan North\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44"
+        ".7833333333333],PARAMETER[\"central_meridian\",-87],PARA"
+        "METER[\"standard_parallel_1\",47.0833333333333],PARAMETE"
+        "R[\"standard_parallel_2\",45.4833333333333],PARAMETER[\""
+        "false_easting\",8000000],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"6495\"]]"},
+    {6496, "epsg", 6496,
         "NAD83(2011) / Michigan North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999");
-    add_proj4text (p, 2,
-        "968001 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan North (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",44.7833333333333],PARAMETER[\"central_meridian\",-87");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",47.0833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",45.4833333333333],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",26246719.16],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 12,
-        "thing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"6496\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6497, "epsg", 6497,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.08333333333334 +lat_2=45.48333333333"
+        "333 +lat_0=44.78333333333333 +lon_0=-87 +x_0=7999999.999"
+        "968001 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Michigan North (ft)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",44.7833333333333],PARAMETER[\"central_meridian\",-87"
+        "],PARAMETER[\"standard_parallel_1\",47.0833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",45.4833333333333],PARAME"
+        "TER[\"false_easting\",26246719.16],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900"
+        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"6496\"]]"},
+    {6497, "epsg", 6497,
         "NAD83(2011) / Michigan Oblique Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33");
-    add_proj4text (p, 1,
-        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no");
-    add_proj4text (p, 2,
-        "_uoff +gamma=337.25556 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan Oblique Mercator\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Hotine_Oblique_Mercator\"],PARAMETER[\"latitude_of_cen");
-    add_srs_wkt (p, 8,
-        "ter\",45.3091666666667],PARAMETER[\"longitude_of_center\"");
-    add_srs_wkt (p, 9,
-        ",-86],PARAMETER[\"azimuth\",337.25556],PARAMETER[\"recti");
-    add_srs_wkt (p, 10,
-        "fied_grid_angle\",337.25556],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 11,
-        "0.9996],PARAMETER[\"false_easting\",2546731.496],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_northing\",-4354009.816],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6497\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6498, "epsg", 6498,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=45.30916666666666 +lonc=-86 +alpha=33"
+        "7.25556 +k=0.9996 +x_0=2546731.496 +y_0=-4354009.816 +no"
+        "_uoff +gamma=337.25556 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Michigan Oblique Mercator\",GEOGC"
+        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Hotine_Oblique_Mercator\"],PARAMETER[\"latitude_of_cen"
+        "ter\",45.3091666666667],PARAMETER[\"longitude_of_center\""
+        ",-86],PARAMETER[\"azimuth\",337.25556],PARAMETER[\"recti"
+        "fied_grid_angle\",337.25556],PARAMETER[\"scale_factor\","
+        "0.9996],PARAMETER[\"false_easting\",2546731.496],PARAMET"
+        "ER[\"false_northing\",-4354009.816],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6497\"]]"},
+    {6498, "epsg", 6498,
         "NAD83(2011) / Michigan South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=4000000 +y_0=0 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41");
-    add_srs_wkt (p, 8,
-        ".5],PARAMETER[\"central_meridian\",-84.3666666666667],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",43.6666666666667],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",42.1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",4000000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6498\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6499, "epsg", 6499,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41"
+        ".5 +lon_0=-84.36666666666666 +x_0=4000000 +y_0=0 +ellps="
+        "GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Michigan South\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41"
+        ".5],PARAMETER[\"central_meridian\",-84.3666666666667],PA"
+        "RAMETER[\"standard_parallel_1\",43.6666666666667],PARAME"
+        "TER[\"standard_parallel_2\",42.1],PARAMETER[\"false_east"
+        "ing\",4000000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6498\""
+        "]]"},
+    {6499, "epsg", 6499,
         "NAD83(2011) / Michigan South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41");
-    add_proj4text (p, 1,
-        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Michigan South (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",41.5],PARAMETER[\"central_meridian\",-84.36666666666");
-    add_srs_wkt (p, 9,
-        "67],PARAMETER[\"standard_parallel_1\",43.6666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",42.1],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",13123359.58],PARAMETER[\"false_northing\",0]");
-    add_srs_wkt (p, 12,
-        ",UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6499\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6500, "epsg", 6500,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.66666666666666 +lat_2=42.1 +lat_0=41"
+        ".5 +lon_0=-84.36666666666666 +x_0=3999999.999984 +y_0=0 "
+        "+ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Michigan South (ft)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",41.5],PARAMETER[\"central_meridian\",-84.36666666666"
+        "67],PARAMETER[\"standard_parallel_1\",43.6666666666667],"
+        "PARAMETER[\"standard_parallel_2\",42.1],PARAMETER[\"fals"
+        "e_easting\",13123359.58],PARAMETER[\"false_northing\",0]"
+        ",UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6499\"]]"},
+    {6500, "epsg", 6500,
         "NAD83(2011) / Minnesota Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4");
-    add_proj4text (p, 1,
-        "5 +lon_0=-94.25 +x_0=800000 +y_0=100000 +ellps=GRS80 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota Central\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",45],PARAMETER[\"central_meridian\",-94.25],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",47.05],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 10,
-        "el_2\",45.6166666666667],PARAMETER[\"false_easting\",800");
-    add_srs_wkt (p, 11,
-        "000],PARAMETER[\"false_northing\",100000],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6500\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6501, "epsg", 6501,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4"
+        "5 +lon_0=-94.25 +x_0=800000 +y_0=100000 +ellps=GRS80 +un"
+        "its=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Minnesota Central\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",45],PARAMETER[\"central_meridian\",-94.25],PARAMETER[\""
+        "standard_parallel_1\",47.05],PARAMETER[\"standard_parall"
+        "el_2\",45.6166666666667],PARAMETER[\"false_easting\",800"
+        "000],PARAMETER[\"false_northing\",100000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6500\"]]"},
+    {6501, "epsg", 6501,
         "NAD83(2011) / Minnesota Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4");
-    add_proj4text (p, 1,
-        "5 +lon_0=-94.25 +x_0=800000.0000101599 +y_0=99999.999989");
-    add_proj4text (p, 2,
-        "83997 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota Central (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",45],PARAMETER[\"central_meridian\",-94.25],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"standard_parallel_1\",47.05],PARAMETER[\"standard");
-    add_srs_wkt (p, 10,
-        "_parallel_2\",45.6166666666667],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",2624666.6667],PARAMETER[\"false_northing\",328083.33");
-    add_srs_wkt (p, 12,
-        "33],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6501\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6502, "epsg", 6502,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.05 +lat_2=45.61666666666667 +lat_0=4"
+        "5 +lon_0=-94.25 +x_0=800000.0000101599 +y_0=99999.999989"
+        "83997 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Minnesota Central (ftUS)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",45],PARAMETER[\"central_meridian\",-94.25],PARAM"
+        "ETER[\"standard_parallel_1\",47.05],PARAMETER[\"standard"
+        "_parallel_2\",45.6166666666667],PARAMETER[\"false_eastin"
+        "g\",2624666.6667],PARAMETER[\"false_northing\",328083.33"
+        "33],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6501\"]]"},
+    {6502, "epsg", 6502,
         "NAD83(2011) / Minnesota North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000 +y");
-    add_proj4text (p, 2,
-        "_0=100000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "46.5],PARAMETER[\"central_meridian\",-93.1],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",48.6333333333333],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",47.0333333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",800000],PARAMETER[\"false_northing\",100000],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "6502\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6503, "epsg", 6503,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333"
+        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000 +y"
+        "_0=100000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Minnesota North\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "46.5],PARAMETER[\"central_meridian\",-93.1],PARAMETER[\""
+        "standard_parallel_1\",48.6333333333333],PARAMETER[\"stan"
+        "dard_parallel_2\",47.0333333333333],PARAMETER[\"false_ea"
+        "sting\",800000],PARAMETER[\"false_northing\",100000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6502\"]]"},
+    {6503, "epsg", 6503,
         "NAD83(2011) / Minnesota North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000.00");
-    add_proj4text (p, 2,
-        "00101599 +y_0=99999.99998983997 +ellps=GRS80 +units=us-f");
-    add_proj4text (p, 3,
-        "t +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",46.5],PARAMETER[\"central_meridian\",-93.1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",48.6333333333333],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",47.0333333333333],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",2624666.6667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",328083.3333],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6503\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6504, "epsg", 6504,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.63333333333333 +lat_2=47.03333333333"
+        "333 +lat_0=46.5 +lon_0=-93.09999999999999 +x_0=800000.00"
+        "00101599 +y_0=99999.99998983997 +ellps=GRS80 +units=us-f"
+        "t +no_defs",
+        "PROJCS[\"NAD83(2011) / Minnesota North (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",46.5],PARAMETER[\"central_meridian\",-93.1],PARAME"
+        "TER[\"standard_parallel_1\",48.6333333333333],PARAMETER["
+        "\"standard_parallel_2\",47.0333333333333],PARAMETER[\"fa"
+        "lse_easting\",2624666.6667],PARAMETER[\"false_northing\""
+        ",328083.3333],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6503\"]]"},
+    {6504, "epsg", 6504,
         "NAD83(2011) / Minnesota South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=43 +lon_0=-94 +x_0=800000 +y_0=100000 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "43],PARAMETER[\"central_meridian\",-94],PARAMETER[\"stan");
-    add_srs_wkt (p, 9,
-        "dard_parallel_1\",45.2166666666667],PARAMETER[\"standard");
-    add_srs_wkt (p, 10,
-        "_parallel_2\",43.7833333333333],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",800000],PARAMETER[\"false_northing\",100000],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"650");
-    add_srs_wkt (p, 14,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6505, "epsg", 6505,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333"
+        "333 +lat_0=43 +lon_0=-94 +x_0=800000 +y_0=100000 +ellps="
+        "GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Minnesota South\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "43],PARAMETER[\"central_meridian\",-94],PARAMETER[\"stan"
+        "dard_parallel_1\",45.2166666666667],PARAMETER[\"standard"
+        "_parallel_2\",43.7833333333333],PARAMETER[\"false_eastin"
+        "g\",800000],PARAMETER[\"false_northing\",100000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"650"
+        "4\"]]"},
+    {6505, "epsg", 6505,
         "NAD83(2011) / Minnesota South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=43 +lon_0=-94 +x_0=800000.0000101599 +y_0=999");
-    add_proj4text (p, 2,
-        "99.99998983997 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Minnesota South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",43],PARAMETER[\"central_meridian\",-94],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",45.2166666666667],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",43.7833333333333],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",2624666.6667],PARAMETER[\"false_northing\",328");
-    add_srs_wkt (p, 12,
-        "083.3333],UNIT[\"US survey foot\",0.304800609601219,AUTH");
-    add_srs_wkt (p, 13,
-        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 14,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6505\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6506, "epsg", 6506,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.21666666666667 +lat_2=43.78333333333"
+        "333 +lat_0=43 +lon_0=-94 +x_0=800000.0000101599 +y_0=999"
+        "99.99998983997 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Minnesota South (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",43],PARAMETER[\"central_meridian\",-94],PARAMETER["
+        "\"standard_parallel_1\",45.2166666666667],PARAMETER[\"st"
+        "andard_parallel_2\",43.7833333333333],PARAMETER[\"false_"
+        "easting\",2624666.6667],PARAMETER[\"false_northing\",328"
+        "083.3333],UNIT[\"US survey foot\",0.304800609601219,AUTH"
+        "ORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6505\"]]"},
+    {6506, "epsg", 6506,
         "NAD83(2011) / Mississippi East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi East\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-88.8333333333333],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",300000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6506\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6507, "epsg", 6507,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9"
+        "9995 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Mississippi East\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P"
+        "ARAMETER[\"central_meridian\",-88.8333333333333],PARAMET"
+        "ER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\""
+        ",300000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6506\"]]"},
+    {6507, "epsg", 6507,
         "NAD83(2011) / Mississippi East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi East (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2");
-    add_srs_wkt (p, 8,
-        "9.5],PARAMETER[\"central_meridian\",-88.8333333333333],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",984250],PARAMETER[\"false_northing\",0],UNIT[\"US");
-    add_srs_wkt (p, 11,
-        " survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "03\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"6507\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6508, "epsg", 6508,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-88.83333333333333 +k=0.9"
+        "9995 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Mississippi East (ftUS)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2"
+        "9.5],PARAMETER[\"central_meridian\",-88.8333333333333],P"
+        "ARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_eas"
+        "ting\",984250],PARAMETER[\"false_northing\",0],UNIT[\"US"
+        " survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"90"
+        "03\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"6507\"]]"},
+    {6508, "epsg", 6508,
         "NAD83(2011) / Mississippi TM", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0=");
-    add_proj4text (p, 1,
-        "500000 +y_0=1300000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi TM\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",32.5],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-89.75],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",0.9998335],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",1300000],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 11,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6508\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6509, "epsg", 6509,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=32.5 +lon_0=-89.75 +k=0.9998335 +x_0="
+        "500000 +y_0=1300000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Mississippi TM\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",32.5],PARA"
+        "METER[\"central_meridian\",-89.75],PARAMETER[\"scale_fac"
+        "tor\",0.9998335],PARAMETER[\"false_easting\",500000],PAR"
+        "AMETER[\"false_northing\",1300000],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6508\"]]"},
+    {6509, "epsg", 6509,
         "NAD83(2011) / Mississippi West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=700000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi West\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-90.3333333333333],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",700000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6509\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6510, "epsg", 6510,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9"
+        "9995 +x_0=700000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Mississippi West\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",29.5],P"
+        "ARAMETER[\"central_meridian\",-90.3333333333333],PARAMET"
+        "ER[\"scale_factor\",0.99995],PARAMETER[\"false_easting\""
+        ",700000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6509\"]]"},
+    {6510, "epsg", 6510,
         "NAD83(2011) / Mississippi West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Mississippi West (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2");
-    add_srs_wkt (p, 8,
-        "9.5],PARAMETER[\"central_meridian\",-90.3333333333333],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",2296583.333],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"6510\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6511, "epsg", 6511,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=29.5 +lon_0=-90.33333333333333 +k=0.9"
+        "9995 +x_0=699999.9998983998 +y_0=0 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Mississippi West (ftUS)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",2"
+        "9.5],PARAMETER[\"central_meridian\",-90.3333333333333],P"
+        "ARAMETER[\"scale_factor\",0.99995],PARAMETER[\"false_eas"
+        "ting\",2296583.333],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6510\"]]"},
+    {6511, "epsg", 6511,
         "NAD83(2011) / Missouri Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-92.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Missouri Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",35.8333");
-    add_srs_wkt (p, 8,
-        "333333333],PARAMETER[\"central_meridian\",-92.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",0.999933333],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6511\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6512, "epsg", 6512,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-92.5 +k=0.9"
+        "99933333 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / Missouri Central\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",35.8333"
+        "333333333],PARAMETER[\"central_meridian\",-92.5],PARAMET"
+        "ER[\"scale_factor\",0.999933333],PARAMETER[\"false_easti"
+        "ng\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6511\"]"
+        "]"},
+    {6512, "epsg", 6512,
         "NAD83(2011) / Missouri East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-90.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99933333 +x_0=250000 +y_0=0 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Missouri East\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",35.83333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-90.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999933333],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "250000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6512\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6513, "epsg", 6513,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=35.83333333333334 +lon_0=-90.5 +k=0.9"
+        "99933333 +x_0=250000 +y_0=0 +ellps=GRS80 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / Missouri East\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",35.83333333"
+        "33333],PARAMETER[\"central_meridian\",-90.5],PARAMETER[\""
+        "scale_factor\",0.999933333],PARAMETER[\"false_easting\","
+        "250000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6512\"]]"},
+    {6513, "epsg", 6513,
         "NAD83(2011) / Missouri West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.16666666666666 +lon_0=-94.5 +k=0.9");
-    add_proj4text (p, 1,
-        "99941177 +x_0=850000 +y_0=0 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Missouri West\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.16666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-94.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999941177],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "850000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6513\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6514, "epsg", 6514,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.16666666666666 +lon_0=-94.5 +k=0.9"
+        "99941177 +x_0=850000 +y_0=0 +ellps=GRS80 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / Missouri West\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",36.16666666"
+        "66667],PARAMETER[\"central_meridian\",-94.5],PARAMETER[\""
+        "scale_factor\",0.999941177],PARAMETER[\"false_easting\","
+        "850000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6513\"]]"},
+    {6514, "epsg", 6514,
         "NAD83(2011) / Montana", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Montana\",GEOGCS[\"NAD83(2011)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"NAD83_National_Spatial_Reference_System_2011\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44.25],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-109.5],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",49],PARAMETER[\"standard_parallel_2\",45");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_easting\",600000],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"6514\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6515, "epsg", 6515,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5"
+        " +x_0=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Montana\",GEOGCS[\"NAD83(2011)\","
+        "DATUM[\"NAD83_National_Spatial_Reference_System_2011\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44.25],P"
+        "ARAMETER[\"central_meridian\",-109.5],PARAMETER[\"standa"
+        "rd_parallel_1\",49],PARAMETER[\"standard_parallel_2\",45"
+        "],PARAMETER[\"false_easting\",600000],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"6514\"]]"},
+    {6515, "epsg", 6515,
         "NAD83(2011) / Montana (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5");
-    add_proj4text (p, 1,
-        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +units=ft +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Montana (ft)\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44.");
-    add_srs_wkt (p, 8,
-        "25],PARAMETER[\"central_meridian\",-109.5],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",49],PARAMETER[\"standard_parallel_2");
-    add_srs_wkt (p, 10,
-        "\",45],PARAMETER[\"false_easting\",1968503.937],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6515\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6516, "epsg", 6516,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49 +lat_2=45 +lat_0=44.25 +lon_0=-109.5"
+        " +x_0=599999.9999976 +y_0=0 +ellps=GRS80 +units=ft +no_d"
+        "efs",
+        "PROJCS[\"NAD83(2011) / Montana (ft)\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44."
+        "25],PARAMETER[\"central_meridian\",-109.5],PARAMETER[\"s"
+        "tandard_parallel_1\",49],PARAMETER[\"standard_parallel_2"
+        "\",45],PARAMETER[\"false_easting\",1968503.937],PARAMETE"
+        "R[\"false_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\""
+        "EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"6515\"]]"},
+    {6516, "epsg", 6516,
         "NAD83(2011) / Nebraska", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +");
-    add_proj4text (p, 1,
-        "lon_0=-100 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nebraska\",GEOGCS[\"NAD83(2011)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39.83333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-100],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"standard_parallel_1\",43],PARAMETER[\"standard_parall");
-    add_srs_wkt (p, 10,
-        "el_2\",40],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 11,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"6516\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6517, "epsg", 6517,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +"
+        "lon_0=-100 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(2011) / Nebraska\",GEOGCS[\"NAD83(2011)\""
+        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39.83333"
+        "33333333],PARAMETER[\"central_meridian\",-100],PARAMETER"
+        "[\"standard_parallel_1\",43],PARAMETER[\"standard_parall"
+        "el_2\",40],PARAMETER[\"false_easting\",500000],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"6516\"]]"},
+    {6517, "epsg", 6517,
         "NAD83(2011) / Nebraska (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +");
-    add_proj4text (p, 1,
-        "lon_0=-100 +x_0=500000.00001016 +y_0=0 +ellps=GRS80 +tow");
-    add_proj4text (p, 2,
-        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nebraska (ftUS)\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "39.8333333333333],PARAMETER[\"central_meridian\",-100],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",43],PARAMETER[\"standar");
-    add_srs_wkt (p, 10,
-        "d_parallel_2\",40],PARAMETER[\"false_easting\",1640416.6");
-    add_srs_wkt (p, 11,
-        "667],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo");
-    add_srs_wkt (p, 12,
-        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6880\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6518, "epsg", 6518,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=40 +lat_0=39.83333333333334 +"
+        "lon_0=-100 +x_0=500000.00001016 +y_0=0 +ellps=GRS80 +tow"
+        "gs84=0,0,0,0,0,0,0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Nebraska (ftUS)\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "39.8333333333333],PARAMETER[\"central_meridian\",-100],P"
+        "ARAMETER[\"standard_parallel_1\",43],PARAMETER[\"standar"
+        "d_parallel_2\",40],PARAMETER[\"false_easting\",1640416.6"
+        "667],PARAMETER[\"false_northing\",0],UNIT[\"US survey fo"
+        "ot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6880\"]]"},
+    {6518, "epsg", 6518,
         "NAD83(2011) / Nevada Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000 +y_0=6000000 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada Central\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-116.666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",6000000],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6518\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6519, "epsg", 6519,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0."
+        "9999 +x_0=500000 +y_0=6000000 +ellps=GRS80 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(2011) / Nevada Central\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75],PAR"
+        "AMETER[\"central_meridian\",-116.666666666667],PARAMETER"
+        "[\"scale_factor\",0.9999],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",6000000],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6518\"]]"},
+    {6519, "epsg", 6519,
         "NAD83(2011) / Nevada Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada Central (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",34");
-    add_srs_wkt (p, 8,
-        ".75],PARAMETER[\"central_meridian\",-116.666666666667],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",1640416.6667],PARAMETER[\"false_northing\",1968500");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6519\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6520, "epsg", 6520,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-116.6666666666667 +k=0."
+        "9999 +x_0=500000.00001016 +y_0=6000000 +ellps=GRS80 +uni"
+        "ts=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Nevada Central (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",34"
+        ".75],PARAMETER[\"central_meridian\",-116.666666666667],P"
+        "ARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_east"
+        "ing\",1640416.6667],PARAMETER[\"false_northing\",1968500"
+        "0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"6519\"]]"},
+    {6520, "epsg", 6520,
         "NAD83(2011) / Nevada East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000 +y_0=8000000 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada East\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-115.583333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",20000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",8000000],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6520\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6521, "epsg", 6521,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0."
+        "9999 +x_0=200000 +y_0=8000000 +ellps=GRS80 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(2011) / Nevada East\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARAM"
+        "ETER[\"central_meridian\",-115.583333333333],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",20000"
+        "0],PARAMETER[\"false_northing\",8000000],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6520\"]]"},
+    {6521, "epsg", 6521,
         "NAD83(2011) / Nevada East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada East (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-115.583333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",656166.6667],PARAMETER[\"false_northing\",26246666.66");
-    add_srs_wkt (p, 11,
-        "67],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6521\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6522, "epsg", 6522,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-115.5833333333333 +k=0."
+        "9999 +x_0=200000.00001016 +y_0=8000000.000010163 +ellps="
+        "GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Nevada East (ftUS)\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75"
+        "],PARAMETER[\"central_meridian\",-115.583333333333],PARA"
+        "METER[\"scale_factor\",0.9999],PARAMETER[\"false_easting"
+        "\",656166.6667],PARAMETER[\"false_northing\",26246666.66"
+        "67],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6521\"]]"},
+    {6522, "epsg", 6522,
         "NAD83(2011) / Nevada West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000 +y_0=4000000 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada West\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M");
-    add_srs_wkt (p, 7,
-        "ercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-118.583333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",80000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",4000000],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6522\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6523, "epsg", 6523,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0."
+        "9999 +x_0=800000 +y_0=4000000 +ellps=GRS80 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(2011) / Nevada West\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_M"
+        "ercator\"],PARAMETER[\"latitude_of_origin\",34.75],PARAM"
+        "ETER[\"central_meridian\",-118.583333333333],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",80000"
+        "0],PARAMETER[\"false_northing\",4000000],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6522\"]]"},
+    {6523, "epsg", 6523,
         "NAD83(2011) / Nevada West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0.");
-    add_proj4text (p, 1,
-        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Nevada West (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-118.583333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",2624666.6667],PARAMETER[\"false_northing\",13123333.3");
-    add_srs_wkt (p, 11,
-        "333],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6523\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6524, "epsg", 6524,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=34.75 +lon_0=-118.5833333333333 +k=0."
+        "9999 +x_0=800000.0000101599 +y_0=3999999.99998984 +ellps"
+        "=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Nevada West (ftUS)\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",34.75"
+        "],PARAMETER[\"central_meridian\",-118.583333333333],PARA"
+        "METER[\"scale_factor\",0.9999],PARAMETER[\"false_easting"
+        "\",2624666.6667],PARAMETER[\"false_northing\",13123333.3"
+        "333],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY"
+        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6523\"]]"},
+    {6524, "epsg", 6524,
         "NAD83(2011) / New Hampshire", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Hampshire\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-71.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.999966667],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "300000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6524\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6525, "epsg", 6525,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9"
+        "99966667 +x_0=300000 +y_0=0 +ellps=GRS80 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / New Hampshire\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PARAM"
+        "ETER[\"central_meridian\",-71.6666666666667],PARAMETER[\""
+        "scale_factor\",0.999966667],PARAMETER[\"false_easting\","
+        "300000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6524\"]]"},
+    {6525, "epsg", 6525,
         "NAD83(2011) / New Hampshire (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Hampshire (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-71.6666666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",984250],PARAMETER[\"false_northing\",0],UNIT[\"U");
-    add_srs_wkt (p, 11,
-        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 12,
-        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"6525\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6526, "epsg", 6526,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-71.66666666666667 +k=0.9"
+        "99966667 +x_0=300000.0000000001 +y_0=0 +ellps=GRS80 +uni"
+        "ts=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / New Hampshire (ftUS)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",42.5"
+        "],PARAMETER[\"central_meridian\",-71.6666666666667],PARA"
+        "METER[\"scale_factor\",0.999966667],PARAMETER[\"false_ea"
+        "sting\",984250],PARAMETER[\"false_northing\",0],UNIT[\"U"
+        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9"
+        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"6525\"]]"},
+    {6526, "epsg", 6526,
         "NAD83(2011) / New Jersey", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Jersey\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",38.8333333333333");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"scal");
-    add_srs_wkt (p, 9,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",150000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6526\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6527, "epsg", 6527,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / New Jersey\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",38.8333333333333"
+        "],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"scal"
+        "e_factor\",0.9999],PARAMETER[\"false_easting\",150000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6526\"]]"},
+    {6527, "epsg", 6527,
         "NAD83(2011) / New Jersey (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Jersey (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",38.833");
-    add_srs_wkt (p, 8,
-        "3333333333],PARAMETER[\"central_meridian\",-74.5],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",492125],PARAMETER[\"false_northing\",0],UNIT[\"US surve");
-    add_srs_wkt (p, 11,
-        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"6527\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6528, "epsg", 6528,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=us-ft +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / New Jersey (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",38.833"
+        "3333333333],PARAMETER[\"central_meridian\",-74.5],PARAME"
+        "TER[\"scale_factor\",0.9999],PARAMETER[\"false_easting\""
+        ",492125],PARAMETER[\"false_northing\",0],UNIT[\"US surve"
+        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"6527\"]]"},
+    {6528, "epsg", 6528,
         "NAD83(2011) / New Mexico Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico Central\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],P");
-    add_srs_wkt (p, 8,
-        "ARAMETER[\"central_meridian\",-106.25],PARAMETER[\"scale");
-    add_srs_wkt (p, 9,
-        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6528\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6529, "epsg", 6529,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000"
+        "00 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / New Mexico Central\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",31],P"
+        "ARAMETER[\"central_meridian\",-106.25],PARAMETER[\"scale"
+        "_factor\",0.9999],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"6528\"]]"},
+    {6529, "epsg", 6529,
         "NAD83(2011) / New Mexico Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000");
-    add_proj4text (p, 1,
-        "00.0001016001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico Central (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",31],PARAMETER[\"central_meridian\",-106.25],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",16404");
-    add_srs_wkt (p, 10,
-        "16.667],PARAMETER[\"false_northing\",0],UNIT[\"US survey");
-    add_srs_wkt (p, 11,
-        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"6529\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6530, "epsg", 6530,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-106.25 +k=0.9999 +x_0=5000"
+        "00.0001016001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / New Mexico Central (ftUS)\",GEOGC"
+        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",31],PARAMETER[\"central_meridian\",-106.25],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",16404"
+        "16.667],PARAMETER[\"false_northing\",0],UNIT[\"US survey"
+        " foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"6529\"]]"},
+    {6530, "epsg", 6530,
         "NAD83(2011) / New Mexico East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico East\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 7,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-104.333333333333],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",0.999909091],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",165000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6530\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6531, "epsg", 6531,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999"
+        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / New Mexico East\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver"
+        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARA"
+        "METER[\"central_meridian\",-104.333333333333],PARAMETER["
+        "\"scale_factor\",0.999909091],PARAMETER[\"false_easting\""
+        ",165000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6530\"]]"},
+    {6531, "epsg", 6531,
         "NAD83(2011) / New Mexico East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +units=us-ft +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico East (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-104.333333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999909091],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",541337.5],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"6531\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-104.3333333333333 +k=0.999"
+        "909091 +x_0=165000 +y_0=0 +ellps=GRS80 +units=us-ft +no_"
+        "defs",
+        "PROJCS[\"NAD83(2011) / New Mexico East (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31"
+        "],PARAMETER[\"central_meridian\",-104.333333333333],PARA"
+        "METER[\"scale_factor\",0.999909091],PARAMETER[\"false_ea"
+        "sting\",541337.5],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6531\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_32 = {
+    epsg_defs_32, sizeof (epsg_defs_32) / sizeof (epsg_defs_32[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,4021 +53,2269 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_33 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 6532, "epsg", 6532,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_33[] = {
+    {6532, "epsg", 6532,
         "NAD83(2011) / New Mexico West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico West\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver");
-    add_srs_wkt (p, 7,
-        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-107.833333333333],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",0.999916667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",830000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6532\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6533, "epsg", 6533,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999"
+        "916667 +x_0=830000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / New Mexico West\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transver"
+        "se_Mercator\"],PARAMETER[\"latitude_of_origin\",31],PARA"
+        "METER[\"central_meridian\",-107.833333333333],PARAMETER["
+        "\"scale_factor\",0.999916667],PARAMETER[\"false_easting\""
+        ",830000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6532\"]]"},
+    {6533, "epsg", 6533,
         "NAD83(2011) / New Mexico West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +units");
-    add_proj4text (p, 2,
-        "=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New Mexico West (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-107.833333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.999916667],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",2723091.667],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"6533\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6534, "epsg", 6534,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=31 +lon_0=-107.8333333333333 +k=0.999"
+        "916667 +x_0=830000.0001016001 +y_0=0 +ellps=GRS80 +units"
+        "=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / New Mexico West (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",31"
+        "],PARAMETER[\"central_meridian\",-107.833333333333],PARA"
+        "METER[\"scale_factor\",0.999916667],PARAMETER[\"false_ea"
+        "sting\",2723091.667],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6533\"]]"},
+    {6534, "epsg", 6534,
         "NAD83(2011) / New York Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=250000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York Central\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve");
-    add_srs_wkt (p, 7,
-        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",40],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-76.5833333333333],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",0.9999375],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",250000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6534\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6535, "epsg", 6535,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999"
+        "9375 +x_0=250000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / New York Central\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transve"
+        "rse_Mercator\"],PARAMETER[\"latitude_of_origin\",40],PAR"
+        "AMETER[\"central_meridian\",-76.5833333333333],PARAMETER"
+        "[\"scale_factor\",0.9999375],PARAMETER[\"false_easting\""
+        ",250000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6534\"]]"},
+    {6535, "epsg", 6535,
         "NAD83(2011) / New York Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York Central (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"central_meridian\",-76.5833333333333],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",0.9999375],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",820208.333],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"6535\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6536, "epsg", 6536,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-76.58333333333333 +k=0.999"
+        "9375 +x_0=249999.9998983998 +y_0=0 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / New York Central (ftUS)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4"
+        "0],PARAMETER[\"central_meridian\",-76.5833333333333],PAR"
+        "AMETER[\"scale_factor\",0.9999375],PARAMETER[\"false_eas"
+        "ting\",820208.333],PARAMETER[\"false_northing\",0],UNIT["
+        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\","
+        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6535\"]]"},
+    {6536, "epsg", 6536,
         "NAD83(2011) / New York East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York East\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",38.83333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",15000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 11,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6536\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6537, "epsg", 6537,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / New York East\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",38.83333333"
+        "33333],PARAMETER[\"central_meridian\",-74.5],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",15000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6536\"]]"},
+    {6537, "epsg", 6537,
         "NAD83(2011) / New York East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9");
-    add_proj4text (p, 1,
-        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York East (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",38.8");
-    add_srs_wkt (p, 8,
-        "333333333333],PARAMETER[\"central_meridian\",-74.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",492125],PARAMETER[\"false_northing\",0],UNIT[\"US sur");
-    add_srs_wkt (p, 11,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"6537\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6538, "epsg", 6538,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=38.83333333333334 +lon_0=-74.5 +k=0.9"
+        "999 +x_0=150000 +y_0=0 +ellps=GRS80 +units=us-ft +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / New York East (ftUS)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",38.8"
+        "333333333333],PARAMETER[\"central_meridian\",-74.5],PARA"
+        "METER[\"scale_factor\",0.9999],PARAMETER[\"false_easting"
+        "\",492125],PARAMETER[\"false_northing\",0],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"6537\"]]"},
+    {6538, "epsg", 6538,
         "NAD83(2011) / New York Long Island", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York Long Island\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",40.1666666666667],PARAMETER[\"central_meridian\",-74");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",41.0333333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",40.6666666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",300000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6538\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6539, "epsg", 6539,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666"
+        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000 +y_0"
+        "=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / New York Long Island\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",40.1666666666667],PARAMETER[\"central_meridian\",-74"
+        "],PARAMETER[\"standard_parallel_1\",41.0333333333333],PA"
+        "RAMETER[\"standard_parallel_2\",40.6666666666667],PARAME"
+        "TER[\"false_easting\",300000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6538\"]]"},
+    {6539, "epsg", 6539,
         "NAD83(2011) / New York Long Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000");
-    add_proj4text (p, 2,
-        "000001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York Long Island (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_origin\",40.1666666666667],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 9,
-        "an\",-74],PARAMETER[\"standard_parallel_1\",41.033333333");
-    add_srs_wkt (p, 10,
-        "3333],PARAMETER[\"standard_parallel_2\",40.6666666666667");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",984250],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6539\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6540, "epsg", 6540,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.03333333333333 +lat_2=40.66666666666"
+        "666 +lat_0=40.16666666666666 +lon_0=-74 +x_0=300000.0000"
+        "000001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / New York Long Island (ftUS)\",GEO"
+        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO"
+        "N[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_"
+        "of_origin\",40.1666666666667],PARAMETER[\"central_meridi"
+        "an\",-74],PARAMETER[\"standard_parallel_1\",41.033333333"
+        "3333],PARAMETER[\"standard_parallel_2\",40.6666666666667"
+        "],PARAMETER[\"false_easting\",984250],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6539\"]]"},
+    {6540, "epsg", 6540,
         "NAD83(2011) / New York West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York West\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",40],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",-78.5833333333333],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",0.9999375],PARAMETER[\"false_easting\",350");
-    add_srs_wkt (p, 10,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6540\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6541, "epsg", 6541,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999"
+        "9375 +x_0=350000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / New York West\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",40],PARAMET"
+        "ER[\"central_meridian\",-78.5833333333333],PARAMETER[\"s"
+        "cale_factor\",0.9999375],PARAMETER[\"false_easting\",350"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6540\"]]"},
+    {6541, "epsg", 6541,
         "NAD83(2011) / New York West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999");
-    add_proj4text (p, 1,
-        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / New York West (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-78.5833333333333],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999375],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",1148291.667],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"6541\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6542, "epsg", 6542,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40 +lon_0=-78.58333333333333 +k=0.999"
+        "9375 +x_0=350000.0001016001 +y_0=0 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / New York West (ftUS)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40],"
+        "PARAMETER[\"central_meridian\",-78.5833333333333],PARAME"
+        "TER[\"scale_factor\",0.9999375],PARAMETER[\"false_eastin"
+        "g\",1148291.667],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6541\"]]"},
+    {6542, "epsg", 6542,
         "NAD83(2011) / North Carolina", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.22 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Carolina\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33");
-    add_srs_wkt (p, 8,
-        ".75],PARAMETER[\"central_meridian\",-79],PARAMETER[\"sta");
-    add_srs_wkt (p, 9,
-        "ndard_parallel_1\",36.1666666666667],PARAMETER[\"standar");
-    add_srs_wkt (p, 10,
-        "d_parallel_2\",34.3333333333333],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 11,
-        "ng\",609601.22],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6542");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6543, "epsg", 6543,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333"
+        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.22 +y_0=0 +ellps"
+        "=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / North Carolina\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33"
+        ".75],PARAMETER[\"central_meridian\",-79],PARAMETER[\"sta"
+        "ndard_parallel_1\",36.1666666666667],PARAMETER[\"standar"
+        "d_parallel_2\",34.3333333333333],PARAMETER[\"false_easti"
+        "ng\",609601.22],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6542"
+        "\"]]"},
+    {6543, "epsg", 6543,
         "NAD83(2011) / North Carolina (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0=");
-    add_proj4text (p, 2,
-        "0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Carolina (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",33.75],PARAMETER[\"central_meridian\",-79],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",36.1666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",34.3333333333333],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",2000000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"6543\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6544, "epsg", 6544,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.16666666666666 +lat_2=34.33333333333"
+        "334 +lat_0=33.75 +lon_0=-79 +x_0=609601.2192024384 +y_0="
+        "0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / North Carolina (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",33.75],PARAMETER[\"central_meridian\",-79],PARAMET"
+        "ER[\"standard_parallel_1\",36.1666666666667],PARAMETER[\""
+        "standard_parallel_2\",34.3333333333333],PARAMETER[\"fals"
+        "e_easting\",2000000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6543\"]]"},
+    {6544, "epsg", 6544,
         "NAD83(2011) / North Dakota North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Dakota North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",47],PARAMETER[\"central_meridian\",-100.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",48.7333333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",47.4333333333333],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 13,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"654");
-    add_srs_wkt (p, 14,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6545, "epsg", 6545,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333"
+        "333 +lat_0=47 +lon_0=-100.5 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / North Dakota North\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",47],PARAMETER[\"central_meridian\",-100.5],PARAMETER["
+        "\"standard_parallel_1\",48.7333333333333],PARAMETER[\"st"
+        "andard_parallel_2\",47.4333333333333],PARAMETER[\"false_"
+        "easting\",600000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"654"
+        "4\"]]"},
+    {6545, "epsg", 6545,
         "NAD83(2011) / North Dakota North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Dakota North (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",47],PARAMETER[\"central_meridian\",-100.5],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",48.7333333333333],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",47.4333333333333],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",1968503.937],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"6545\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6546, "epsg", 6546,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.43333333333"
+        "333 +lat_0=47 +lon_0=-100.5 +x_0=599999.9999976 +y_0=0 +"
+        "ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / North Dakota North (ft)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",47],PARAMETER[\"central_meridian\",-100.5],PARAME"
+        "TER[\"standard_parallel_1\",48.7333333333333],PARAMETER["
+        "\"standard_parallel_2\",47.4333333333333],PARAMETER[\"fa"
+        "lse_easting\",1968503.937],PARAMETER[\"false_northing\","
+        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"6545\"]]"},
+    {6546, "epsg", 6546,
         "NAD83(2011) / North Dakota South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Dakota South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",45.6666666666667],PARAMETER[\"central_meridian\",-100");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"standard_parallel_1\",47.4833333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",46.1833333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",600000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"6546\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6547, "epsg", 6547,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333"
+        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / North Dakota South\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",45.6666666666667],PARAMETER[\"central_meridian\",-100"
+        ".5],PARAMETER[\"standard_parallel_1\",47.4833333333333],"
+        "PARAMETER[\"standard_parallel_2\",46.1833333333333],PARA"
+        "METER[\"false_easting\",600000],PARAMETER[\"false_northi"
+        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"6546\"]]"},
+    {6547, "epsg", 6547,
         "NAD83(2011) / North Dakota South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9");
-    add_proj4text (p, 2,
-        "999976 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / North Dakota South (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",45.6666666666667],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-100.5],PARAMETER[\"standard_parallel_1\",47.48333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"standard_parallel_2\",46.1833333333333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",1968503.937],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"6547\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6548, "epsg", 6548,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.48333333333333 +lat_2=46.18333333333"
+        "333 +lat_0=45.66666666666666 +lon_0=-100.5 +x_0=599999.9"
+        "999976 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / North Dakota South (ft)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",45.6666666666667],PARAMETER[\"central_meridian\","
+        "-100.5],PARAMETER[\"standard_parallel_1\",47.48333333333"
+        "33],PARAMETER[\"standard_parallel_2\",46.1833333333333],"
+        "PARAMETER[\"false_easting\",1968503.937],PARAMETER[\"fal"
+        "se_northing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\""
+        ",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6547\"]]"},
+    {6548, "epsg", 6548,
         "NAD83(2011) / Ohio North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Ohio North\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-82.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",41.7],PARAMETER[\"standard_par");
-    add_srs_wkt (p, 10,
-        "allel_2\",40.4333333333333],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 11,
-        "600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6548\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6549, "epsg", 6549,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39"
+        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G"
+        "RS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Ohio North\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",39.66666"
+        "66666667],PARAMETER[\"central_meridian\",-82.5],PARAMETE"
+        "R[\"standard_parallel_1\",41.7],PARAMETER[\"standard_par"
+        "allel_2\",40.4333333333333],PARAMETER[\"false_easting\","
+        "600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6548\"]]"},
+    {6549, "epsg", 6549,
         "NAD83(2011) / Ohio North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Ohio North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",39.6666666666667],PARAMETER[\"central_meridian\",-82.5]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_1\",41.7],PARAMETER[\"sta");
-    add_srs_wkt (p, 10,
-        "ndard_parallel_2\",40.4333333333333],PARAMETER[\"false_e");
-    add_srs_wkt (p, 11,
-        "asting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"6549\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6550, "epsg", 6550,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.7 +lat_2=40.43333333333333 +lat_0=39"
+        ".66666666666666 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=G"
+        "RS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Ohio North (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",39.6666666666667],PARAMETER[\"central_meridian\",-82.5]"
+        ",PARAMETER[\"standard_parallel_1\",41.7],PARAMETER[\"sta"
+        "ndard_parallel_2\",40.4333333333333],PARAMETER[\"false_e"
+        "asting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6549\"]]"},
+    {6550, "epsg", 6550,
         "NAD83(2011) / Ohio South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Ohio South\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-82.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",40.0333333333333],PARAMETER[\"standard_paral");
-    add_srs_wkt (p, 10,
-        "lel_2\",38.7333333333333],PARAMETER[\"false_easting\",60");
-    add_srs_wkt (p, 11,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6550\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6551, "epsg", 6551,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333"
+        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS"
+        "80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Ohio South\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38],PARA"
+        "METER[\"central_meridian\",-82.5],PARAMETER[\"standard_p"
+        "arallel_1\",40.0333333333333],PARAMETER[\"standard_paral"
+        "lel_2\",38.7333333333333],PARAMETER[\"false_easting\",60"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6550\"]]"},
+    {6551, "epsg", 6551,
         "NAD83(2011) / Ohio South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Ohio South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",38],PARAMETER[\"central_meridian\",-82.5],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",40.0333333333333],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",38.7333333333333],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"U");
-    add_srs_wkt (p, 12,
-        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 13,
-        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 14,
-        "AUTHORITY[\"EPSG\",\"6551\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6552, "epsg", 6552,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.03333333333333 +lat_2=38.73333333333"
+        "333 +lat_0=38 +lon_0=-82.5 +x_0=600000 +y_0=0 +ellps=GRS"
+        "80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Ohio South (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",38],PARAMETER[\"central_meridian\",-82.5],PARAMETER[\"s"
+        "tandard_parallel_1\",40.0333333333333],PARAMETER[\"stand"
+        "ard_parallel_2\",38.7333333333333],PARAMETER[\"false_eas"
+        "ting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"U"
+        "S survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9"
+        "003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"6551\"]]"},
+    {6552, "epsg", 6552,
         "NAD83(2011) / Oklahoma North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oklahoma North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",35");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-98],PARAMETER[\"standa");
-    add_srs_wkt (p, 9,
-        "rd_parallel_1\",36.7666666666667],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 10,
-        "arallel_2\",35.5666666666667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6552\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6553, "epsg", 6553,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666"
+        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oklahoma North\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",35"
+        "],PARAMETER[\"central_meridian\",-98],PARAMETER[\"standa"
+        "rd_parallel_1\",36.7666666666667],PARAMETER[\"standard_p"
+        "arallel_2\",35.5666666666667],PARAMETER[\"false_easting\""
+        ",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6552\"]]"},
+    {6553, "epsg", 6553,
         "NAD83(2011) / Oklahoma North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oklahoma North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",35],PARAMETER[\"central_meridian\",-98],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",36.7666666666667],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",35.5666666666667],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",1968500],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"6553\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6554, "epsg", 6554,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.76666666666667 +lat_2=35.56666666666"
+        "667 +lat_0=35 +lon_0=-98 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oklahoma North (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",35],PARAMETER[\"central_meridian\",-98],PARAMETER["
+        "\"standard_parallel_1\",36.7666666666667],PARAMETER[\"st"
+        "andard_parallel_2\",35.5666666666667],PARAMETER[\"false_"
+        "easting\",1968500],PARAMETER[\"false_northing\",0],UNIT["
+        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\","
+        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6553\"]]"},
+    {6554, "epsg", 6554,
         "NAD83(2011) / Oklahoma South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oklahoma South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-98],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",35.2333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",33.9333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",600000],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 12,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 13,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"6554\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6555, "epsg", 6555,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333"
+        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oklahoma South\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",33"
+        ".3333333333333],PARAMETER[\"central_meridian\",-98],PARA"
+        "METER[\"standard_parallel_1\",35.2333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",33.9333333333333],PARAMETER[\""
+        "false_easting\",600000],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"6554\"]]"},
+    {6555, "epsg", 6555,
         "NAD83(2011) / Oklahoma South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oklahoma South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",33.3333333333333],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "98],PARAMETER[\"standard_parallel_1\",35.2333333333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",33.9333333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",1968500],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 14,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6555\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6556, "epsg", 6556,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=35.23333333333333 +lat_2=33.93333333333"
+        "333 +lat_0=33.33333333333334 +lon_0=-98 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oklahoma South (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",33.3333333333333],PARAMETER[\"central_meridian\",-"
+        "98],PARAMETER[\"standard_parallel_1\",35.2333333333333],"
+        "PARAMETER[\"standard_parallel_2\",33.9333333333333],PARA"
+        "METER[\"false_easting\",1968500],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHO"
+        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6555\"]]"},
+    {6556, "epsg", 6556,
         "NAD83(2011) / Oregon LCC (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon LCC (m)\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41");
-    add_srs_wkt (p, 8,
-        ".75],PARAMETER[\"central_meridian\",-120.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",43],PARAMETER[\"standard_parallel_");
-    add_srs_wkt (p, 10,
-        "2\",45.5],PARAMETER[\"false_easting\",400000],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"6556\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6557, "epsg", 6557,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120"
+        ".5 +x_0=400000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon LCC (m)\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41"
+        ".75],PARAMETER[\"central_meridian\",-120.5],PARAMETER[\""
+        "standard_parallel_1\",43],PARAMETER[\"standard_parallel_"
+        "2\",45.5],PARAMETER[\"false_easting\",400000],PARAMETER["
+        "\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6556\"]]"},
+    {6557, "epsg", 6557,
         "NAD83(2011) / Oregon GIC Lambert (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120");
-    add_proj4text (p, 1,
-        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +units=ft +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon GIC Lambert (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",41.75],PARAMETER[\"central_meridian\",-120.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"standard_parallel_1\",43],PARAMETER[\"standard_");
-    add_srs_wkt (p, 10,
-        "parallel_2\",45.5],PARAMETER[\"false_easting\",1312335.9");
-    add_srs_wkt (p, 11,
-        "58],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6557\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6558, "epsg", 6558,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43 +lat_2=45.5 +lat_0=41.75 +lon_0=-120"
+        ".5 +x_0=399999.9999984 +y_0=0 +ellps=GRS80 +units=ft +no"
+        "_defs",
+        "PROJCS[\"NAD83(2011) / Oregon GIC Lambert (ft)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",41.75],PARAMETER[\"central_meridian\",-120.5],PAR"
+        "AMETER[\"standard_parallel_1\",43],PARAMETER[\"standard_"
+        "parallel_2\",45.5],PARAMETER[\"false_easting\",1312335.9"
+        "58],PARAMETER[\"false_northing\",0],UNIT[\"foot\",0.3048"
+        ",AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6557\"]]"},
+    {6558, "epsg", 6558,
         "NAD83(2011) / Oregon North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon North\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43.");
-    add_srs_wkt (p, 8,
-        "6666666666667],PARAMETER[\"central_meridian\",-120.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",46],PARAMETER[\"standard");
-    add_srs_wkt (p, 10,
-        "_parallel_2\",44.3333333333333],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",2500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6558\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6559, "epsg", 6559,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6"
+        "6666666666666 +lon_0=-120.5 +x_0=2500000 +y_0=0 +ellps=G"
+        "RS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon North\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",43."
+        "6666666666667],PARAMETER[\"central_meridian\",-120.5],PA"
+        "RAMETER[\"standard_parallel_1\",46],PARAMETER[\"standard"
+        "_parallel_2\",44.3333333333333],PARAMETER[\"false_eastin"
+        "g\",2500000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6558\"]"
+        "]"},
+    {6559, "epsg", 6559,
         "NAD83(2011) / Oregon North (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon North (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",43.6666666666667],PARAMETER[\"central_meridian\",-120.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",46],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",44.3333333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",8202099.738],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"6559\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6560, "epsg", 6560,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46 +lat_2=44.33333333333334 +lat_0=43.6"
+        "6666666666666 +lon_0=-120.5 +x_0=2500000.0001424 +y_0=0 "
+        "+ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon North (ft)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",43.6666666666667],PARAMETER[\"central_meridian\",-120.5"
+        "],PARAMETER[\"standard_parallel_1\",46],PARAMETER[\"stan"
+        "dard_parallel_2\",44.3333333333333],PARAMETER[\"false_ea"
+        "sting\",8202099.738],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"6559\"]]"},
+    {6560, "epsg", 6560,
         "NAD83(2011) / Oregon South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000 +y_0=0 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon South\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41.");
-    add_srs_wkt (p, 8,
-        "6666666666667],PARAMETER[\"central_meridian\",-120.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",44],PARAMETER[\"standard");
-    add_srs_wkt (p, 10,
-        "_parallel_2\",42.3333333333333],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 12,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 13,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6560\"]");
-    add_srs_wkt (p, 14,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 6561, "epsg", 6561,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6"
+        "6666666666666 +lon_0=-120.5 +x_0=1500000 +y_0=0 +ellps=G"
+        "RS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon South\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",41."
+        "6666666666667],PARAMETER[\"central_meridian\",-120.5],PA"
+        "RAMETER[\"standard_parallel_1\",44],PARAMETER[\"standard"
+        "_parallel_2\",42.3333333333333],PARAMETER[\"false_eastin"
+        "g\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6560\"]"
+        "]"},
+    {6561, "epsg", 6561,
         "NAD83(2011) / Oregon South (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6");
-    add_proj4text (p, 1,
-        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon South (ft)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",41.6666666666667],PARAMETER[\"central_meridian\",-120.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",44],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",42.3333333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",4921259.843],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"E");
-    add_srs_wkt (p, 13,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 14,
-        "\",\"6561\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6562, "epsg", 6562,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_2=42.33333333333334 +lat_0=41.6"
+        "6666666666666 +lon_0=-120.5 +x_0=1500000.0001464 +y_0=0 "
+        "+ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon South (ft)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",41.6666666666667],PARAMETER[\"central_meridian\",-120.5"
+        "],PARAMETER[\"standard_parallel_1\",44],PARAMETER[\"stan"
+        "dard_parallel_2\",42.3333333333333],PARAMETER[\"false_ea"
+        "sting\",4921259.843],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"6561\"]]"},
+    {6562, "epsg", 6562,
         "NAD83(2011) / Pennsylvania North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Pennsylvania North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",40.1666666666667],PARAMETER[\"central_meridian\",-77.");
-    add_srs_wkt (p, 9,
-        "75],PARAMETER[\"standard_parallel_1\",41.95],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",40.8833333333333],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",600000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 12,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 13,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "6562\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6563, "epsg", 6563,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4"
+        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps"
+        "=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Pennsylvania North\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",40.1666666666667],PARAMETER[\"central_meridian\",-77."
+        "75],PARAMETER[\"standard_parallel_1\",41.95],PARAMETER[\""
+        "standard_parallel_2\",40.8833333333333],PARAMETER[\"fals"
+        "e_easting\",600000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6562\"]]"},
+    {6563, "epsg", 6563,
         "NAD83(2011) / Pennsylvania North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4");
-    add_proj4text (p, 1,
-        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Pennsylvania North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",40.1666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-77.75],PARAMETER[\"standard_parallel_1\",41.95],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",40.8833333333333],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",1968500],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 14,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6563\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6564, "epsg", 6564,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.95 +lat_2=40.88333333333333 +lat_0=4"
+        "0.16666666666666 +lon_0=-77.75 +x_0=600000 +y_0=0 +ellps"
+        "=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Pennsylvania North (ftUS)\",GEOGC"
+        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",40.1666666666667],PARAMETER[\"central_meridian"
+        "\",-77.75],PARAMETER[\"standard_parallel_1\",41.95],PARA"
+        "METER[\"standard_parallel_2\",40.8833333333333],PARAMETE"
+        "R[\"false_easting\",1968500],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY["
+        "\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"6563\"]]"},
+    {6564, "epsg", 6564,
         "NAD83(2011) / Pennsylvania South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Pennsylvania South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",39.3333333333333],PARAMETER[\"central_meridian\",-77.");
-    add_srs_wkt (p, 9,
-        "75],PARAMETER[\"standard_parallel_1\",40.9666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",39.9333333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",600000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 14,
-        "[\"EPSG\",\"6564\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6565, "epsg", 6565,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333"
+        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Pennsylvania South\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",39.3333333333333],PARAMETER[\"central_meridian\",-77."
+        "75],PARAMETER[\"standard_parallel_1\",40.9666666666667],"
+        "PARAMETER[\"standard_parallel_2\",39.9333333333333],PARA"
+        "METER[\"false_easting\",600000],PARAMETER[\"false_northi"
+        "ng\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"6564\"]]"},
+    {6565, "epsg", 6565,
         "NAD83(2011) / Pennsylvania South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Pennsylvania South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",39.3333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-77.75],PARAMETER[\"standard_parallel_1\",40.96666666");
-    add_srs_wkt (p, 10,
-        "66667],PARAMETER[\"standard_parallel_2\",39.933333333333");
-    add_srs_wkt (p, 11,
-        "3],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_northing\",0],UNIT[\"US survey foot\",0.30480060960121");
-    add_srs_wkt (p, 13,
-        "9,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 14,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6565\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6566, "epsg", 6566,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.96666666666667 +lat_2=39.93333333333"
+        "333 +lat_0=39.33333333333334 +lon_0=-77.75 +x_0=600000 +"
+        "y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Pennsylvania South (ftUS)\",GEOGC"
+        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",39.3333333333333],PARAMETER[\"central_meridian"
+        "\",-77.75],PARAMETER[\"standard_parallel_1\",40.96666666"
+        "66667],PARAMETER[\"standard_parallel_2\",39.933333333333"
+        "3],PARAMETER[\"false_easting\",1968500],PARAMETER[\"fals"
+        "e_northing\",0],UNIT[\"US survey foot\",0.30480060960121"
+        "9,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6565\"]]"},
+    {6566, "epsg", 6566,
         "NAD83(2011) / Puerto Rico and Virgin Is.", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +");
-    add_proj4text (p, 2,
-        "x_0=200000 +y_0=200000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Puerto Rico and Virgin Is.\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",17.8333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-66.4333333333333],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 10,
-        "18.4333333333333],PARAMETER[\"standard_parallel_2\",18.0");
-    add_srs_wkt (p, 11,
-        "333333333333],PARAMETER[\"false_easting\",200000],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_northing\",200000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 13,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 14,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6566\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6567, "epsg", 6567,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=18.43333333333333 +lat_2=18.03333333333"
+        "333 +lat_0=17.83333333333333 +lon_0=-66.43333333333334 +"
+        "x_0=200000 +y_0=200000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Puerto Rico and Virgin Is.\",GEOG"
+        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere"
+        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",17.8333333333333],PARAMETER[\"central_meridian"
+        "\",-66.4333333333333],PARAMETER[\"standard_parallel_1\","
+        "18.4333333333333],PARAMETER[\"standard_parallel_2\",18.0"
+        "333333333333],PARAMETER[\"false_easting\",200000],PARAME"
+        "TER[\"false_northing\",200000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6566\"]]"},
+    {6567, "epsg", 6567,
         "NAD83(2011) / Rhode Island", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=100000 +y_0=0 +ellps=GRS80 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Rhode Island\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",41.08333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-71.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.99999375],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 11,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6567\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6568, "epsg", 6568,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9"
+        "9999375 +x_0=100000 +y_0=0 +ellps=GRS80 +units=m +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / Rhode Island\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",41.08333333"
+        "33333],PARAMETER[\"central_meridian\",-71.5],PARAMETER[\""
+        "scale_factor\",0.99999375],PARAMETER[\"false_easting\",1"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6567\"]]"},
+    {6568, "epsg", 6568,
         "NAD83(2011) / Rhode Island (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9");
-    add_proj4text (p, 1,
-        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +unit");
-    add_proj4text (p, 2,
-        "s=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Rhode Island (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.0");
-    add_srs_wkt (p, 8,
-        "833333333333],PARAMETER[\"central_meridian\",-71.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.99999375],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",328083.3333],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"6568\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6569, "epsg", 6569,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.08333333333334 +lon_0=-71.5 +k=0.9"
+        "9999375 +x_0=99999.99998983997 +y_0=0 +ellps=GRS80 +unit"
+        "s=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Rhode Island (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41.0"
+        "833333333333],PARAMETER[\"central_meridian\",-71.5],PARA"
+        "METER[\"scale_factor\",0.99999375],PARAMETER[\"false_eas"
+        "ting\",328083.3333],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6568\"]]"},
+    {6569, "epsg", 6569,
         "NAD83(2011) / South Carolina", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Carolina\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",31");
-    add_srs_wkt (p, 8,
-        ".8333333333333],PARAMETER[\"central_meridian\",-81],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",34.8333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",32.5],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",609600],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6569\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6570, "epsg", 6570,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31"
+        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS"
+        "80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / South Carolina\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",31"
+        ".8333333333333],PARAMETER[\"central_meridian\",-81],PARA"
+        "METER[\"standard_parallel_1\",34.8333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",32.5],PARAMETER[\"false_eastin"
+        "g\",609600],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6569\"]]"},
+    {6570, "epsg", 6570,
         "NAD83(2011) / South Carolina (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31");
-    add_proj4text (p, 1,
-        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Carolina (ft)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",31.8333333333333],PARAMETER[\"central_meridian\",-81");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",34.8333333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",32.5],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",2000000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 13,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 14,
-        ",\"6570\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6571, "epsg", 6571,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.83333333333334 +lat_2=32.5 +lat_0=31"
+        ".83333333333333 +lon_0=-81 +x_0=609600 +y_0=0 +ellps=GRS"
+        "80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / South Carolina (ft)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",31.8333333333333],PARAMETER[\"central_meridian\",-81"
+        "],PARAMETER[\"standard_parallel_1\",34.8333333333333],PA"
+        "RAMETER[\"standard_parallel_2\",32.5],PARAMETER[\"false_"
+        "easting\",2000000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"6570\"]]"},
+    {6571, "epsg", 6571,
         "NAD83(2011) / South Dakota North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Dakota North\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",43.8333333333333],PARAMETER[\"central_meridian\",-100");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",45.6833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",44.4166666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",600000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6571\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6572, "epsg", 6572,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666"
+        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_"
+        "0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / South Dakota North\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",43.8333333333333],PARAMETER[\"central_meridian\",-100"
+        "],PARAMETER[\"standard_parallel_1\",45.6833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",44.4166666666667],PARAME"
+        "TER[\"false_easting\",600000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6571\"]]"},
+    {6572, "epsg", 6572,
         "NAD83(2011) / South Dakota North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_");
-    add_proj4text (p, 2,
-        "0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Dakota North (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",43.8333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-100],PARAMETER[\"standard_parallel_1\",45.6833333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"standard_parallel_2\",44.4166666666667]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_");
-    add_srs_wkt (p, 12,
-        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6572\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6573, "epsg", 6573,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.68333333333333 +lat_2=44.41666666666"
+        "666 +lat_0=43.83333333333334 +lon_0=-100 +x_0=600000 +y_"
+        "0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / South Dakota North (ftUS)\",GEOGC"
+        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",43.8333333333333],PARAMETER[\"central_meridian"
+        "\",-100],PARAMETER[\"standard_parallel_1\",45.6833333333"
+        "333],PARAMETER[\"standard_parallel_2\",44.4166666666667]"
+        ",PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_"
+        "northing\",0],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6572\"]]"},
+    {6573, "epsg", 6573,
         "NAD83(2011) / South Dakota South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Dakota South\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",42.3333333333333],PARAMETER[\"central_meridian\",-100");
-    add_srs_wkt (p, 9,
-        ".333333333333],PARAMETER[\"standard_parallel_1\",44.4],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",42.8333333333333],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",600000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"6573\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6574, "epsg", 6574,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42"
+        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y"
+        "_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / South Dakota South\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",42.3333333333333],PARAMETER[\"central_meridian\",-100"
+        ".333333333333],PARAMETER[\"standard_parallel_1\",44.4],P"
+        "ARAMETER[\"standard_parallel_2\",42.8333333333333],PARAM"
+        "ETER[\"false_easting\",600000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"6573\"]]"},
+    {6574, "epsg", 6574,
         "NAD83(2011) / South Dakota South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42");
-    add_proj4text (p, 1,
-        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / South Dakota South (ftUS)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",42.3333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-100.333333333333],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 10,
-        "44.4],PARAMETER[\"standard_parallel_2\",42.8333333333333");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",1968500],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",0],UNIT[\"US survey foot\",0.304800609601219");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6574\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6575, "epsg", 6575,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.4 +lat_2=42.83333333333334 +lat_0=42"
+        ".33333333333334 +lon_0=-100.3333333333333 +x_0=600000 +y"
+        "_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / South Dakota South (ftUS)\",GEOGC"
+        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",42.3333333333333],PARAMETER[\"central_meridian"
+        "\",-100.333333333333],PARAMETER[\"standard_parallel_1\","
+        "44.4],PARAMETER[\"standard_parallel_2\",42.8333333333333"
+        "],PARAMETER[\"false_easting\",1968500],PARAMETER[\"false"
+        "_northing\",0],UNIT[\"US survey foot\",0.304800609601219"
+        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6574\"]]"},
+    {6575, "epsg", 6575,
         "NAD83(2011) / Tennessee", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Tennessee\",GEOGCS[\"NAD83(2011)\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-86],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",36.4166666666667],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",35.25],PARAMETER[\"false_easting\",6");
-    add_srs_wkt (p, 11,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6575\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6576, "epsg", 6576,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3"
+        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Tennessee\",GEOGCS[\"NAD83(2011)\""
+        ",DATUM[\"NAD83_National_Spatial_Reference_System_2011\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34.33333"
+        "33333333],PARAMETER[\"central_meridian\",-86],PARAMETER["
+        "\"standard_parallel_1\",36.4166666666667],PARAMETER[\"st"
+        "andard_parallel_2\",35.25],PARAMETER[\"false_easting\",6"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6575\"]]"},
+    {6576, "epsg", 6576,
         "NAD83(2011) / Tennessee (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3");
-    add_proj4text (p, 1,
-        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Tennessee (ftUS)\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",34.3333333333333],PARAMETER[\"central_meridian\",-86],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",36.4166666666667],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",35.25],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 12,
-        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"6576\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6577, "epsg", 6577,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.41666666666666 +lat_2=35.25 +lat_0=3"
+        "4.33333333333334 +lon_0=-86 +x_0=600000 +y_0=0 +ellps=GR"
+        "S80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Tennessee (ftUS)\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",34.3333333333333],PARAMETER[\"central_meridian\",-86],P"
+        "ARAMETER[\"standard_parallel_1\",36.4166666666667],PARAM"
+        "ETER[\"standard_parallel_2\",35.25],PARAMETER[\"false_ea"
+        "sting\",1968500],PARAMETER[\"false_northing\",0],UNIT[\""
+        "US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\""
+        "9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6576\"]]"},
+    {6577, "epsg", 6577,
         "NAD83(2011) / Texas Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=700000 +y_0=3000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas Central\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29.");
-    add_srs_wkt (p, 8,
-        "6666666666667],PARAMETER[\"central_meridian\",-100.33333");
-    add_srs_wkt (p, 9,
-        "3333333],PARAMETER[\"standard_parallel_1\",31.8833333333");
-    add_srs_wkt (p, 10,
-        "333],PARAMETER[\"standard_parallel_2\",30.1166666666667]");
-    add_srs_wkt (p, 11,
-        ",PARAMETER[\"false_easting\",700000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 12,
-        "orthing\",3000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 14,
-        ",AUTHORITY[\"EPSG\",\"6577\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6578, "epsg", 6578,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666"
+        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +"
+        "x_0=700000 +y_0=3000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas Central\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",29."
+        "6666666666667],PARAMETER[\"central_meridian\",-100.33333"
+        "3333333],PARAMETER[\"standard_parallel_1\",31.8833333333"
+        "333],PARAMETER[\"standard_parallel_2\",30.1166666666667]"
+        ",PARAMETER[\"false_easting\",700000],PARAMETER[\"false_n"
+        "orthing\",3000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"6577\"]]"},
+    {6578, "epsg", 6578,
         "NAD83(2011) / Texas Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +");
-    add_proj4text (p, 2,
-        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +units=u");
-    add_proj4text (p, 3,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas Central (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",29.6666666666667],PARAMETER[\"central_meridian\",-10");
-    add_srs_wkt (p, 9,
-        "0.333333333333],PARAMETER[\"standard_parallel_1\",31.883");
-    add_srs_wkt (p, 10,
-        "3333333333],PARAMETER[\"standard_parallel_2\",30.1166666");
-    add_srs_wkt (p, 11,
-        "666667],PARAMETER[\"false_easting\",2296583.333],PARAMET");
-    add_srs_wkt (p, 12,
-        "ER[\"false_northing\",9842500],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 13,
-        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 14,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 15,
-        ",\"6578\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6579, "epsg", 6579,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=31.88333333333333 +lat_2=30.11666666666"
+        "667 +lat_0=29.66666666666667 +lon_0=-100.3333333333333 +"
+        "x_0=699999.9998983998 +y_0=3000000 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas Central (ftUS)\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",29.6666666666667],PARAMETER[\"central_meridian\",-10"
+        "0.333333333333],PARAMETER[\"standard_parallel_1\",31.883"
+        "3333333333],PARAMETER[\"standard_parallel_2\",30.1166666"
+        "666667],PARAMETER[\"false_easting\",2296583.333],PARAMET"
+        "ER[\"false_northing\",9842500],UNIT[\"US survey foot\",0"
+        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"6578\"]]"},
+    {6579, "epsg", 6579,
         "NAD83(2011) / Texas Centric Albers Equal Area", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=6000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas Centric Albers Equal Area\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_center\",18],PARAMETER[\"longitude_of_center\",-100],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",27.5],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",35],PARAMETER[\"false_easting\",150000");
-    add_srs_wkt (p, 11,
-        "0],PARAMETER[\"false_northing\",6000000],UNIT[\"metre\",");
-    add_srs_wkt (p, 12,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 13,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6579\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6580, "epsg", 6580,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x"
+        "_0=1500000 +y_0=6000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas Centric Albers Equal Area\""
+        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE"
+        "CTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"latitude_"
+        "of_center\",18],PARAMETER[\"longitude_of_center\",-100],"
+        "PARAMETER[\"standard_parallel_1\",27.5],PARAMETER[\"stan"
+        "dard_parallel_2\",35],PARAMETER[\"false_easting\",150000"
+        "0],PARAMETER[\"false_northing\",6000000],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6579\"]]"},
+    {6580, "epsg", 6580,
         "NAD83(2011) / Texas Centric Lambert Conformal", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x");
-    add_proj4text (p, 1,
-        "_0=1500000 +y_0=5000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas Centric Lambert Conformal\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",18],PARAMETER[\"central_meridian\",-100]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"standard_parallel_1\",27.5],PARAMETER[\"sta");
-    add_srs_wkt (p, 10,
-        "ndard_parallel_2\",35],PARAMETER[\"false_easting\",15000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",5000000],UNIT[\"metre\"");
-    add_srs_wkt (p, 12,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6580\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6581, "epsg", 6581,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.5 +lat_2=35 +lat_0=18 +lon_0=-100 +x"
+        "_0=1500000 +y_0=5000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas Centric Lambert Conformal\""
+        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",18],PARAMETER[\"central_meridian\",-100]"
+        ",PARAMETER[\"standard_parallel_1\",27.5],PARAMETER[\"sta"
+        "ndard_parallel_2\",35],PARAMETER[\"false_easting\",15000"
+        "00],PARAMETER[\"false_northing\",5000000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6580\"]]"},
+    {6581, "epsg", 6581,
         "NAD83(2011) / Texas North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000 +y_0=1000000 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas North\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"central_meridian\",-101.5],PARAMETER[\"stand");
-    add_srs_wkt (p, 9,
-        "ard_parallel_1\",36.1833333333333],PARAMETER[\"standard_");
-    add_srs_wkt (p, 10,
-        "parallel_2\",34.65],PARAMETER[\"false_easting\",200000],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6581\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6582, "epsg", 6582,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3"
+        "4 +lon_0=-101.5 +x_0=200000 +y_0=1000000 +ellps=GRS80 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas North\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",34],"
+        "PARAMETER[\"central_meridian\",-101.5],PARAMETER[\"stand"
+        "ard_parallel_1\",36.1833333333333],PARAMETER[\"standard_"
+        "parallel_2\",34.65],PARAMETER[\"false_easting\",200000],"
+        "PARAMETER[\"false_northing\",1000000],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6581\"]]"},
+    {6582, "epsg", 6582,
         "NAD83(2011) / Texas North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3");
-    add_proj4text (p, 1,
-        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989");
-    add_proj4text (p, 2,
-        "83998 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas North (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",34],PARAMETER[\"central_meridian\",-101.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",36.1833333333333],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",34.65],PARAMETER[\"false_easting\",6");
-    add_srs_wkt (p, 11,
-        "56166.667],PARAMETER[\"false_northing\",3280833.333],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 14,
-        "TH],AUTHORITY[\"EPSG\",\"6582\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6583, "epsg", 6583,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36.18333333333333 +lat_2=34.65 +lat_0=3"
+        "4 +lon_0=-101.5 +x_0=200000.0001016002 +y_0=999999.99989"
+        "83998 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas North (ftUS)\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",34],PARAMETER[\"central_meridian\",-101.5],PARAMETER["
+        "\"standard_parallel_1\",36.1833333333333],PARAMETER[\"st"
+        "andard_parallel_2\",34.65],PARAMETER[\"false_easting\",6"
+        "56166.667],PARAMETER[\"false_northing\",3280833.333],UNI"
+        "T[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"6582\"]]"},
+    {6583, "epsg", 6583,
         "NAD83(2011) / Texas North Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas North Central\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",31.6666666666667],PARAMETER[\"central_meridian\",-98");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"standard_parallel_1\",33.9666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",32.1333333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",600000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 12,
-        "ng\",2000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001");
-    add_srs_wkt (p, 13,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 14,
-        "HORITY[\"EPSG\",\"6583\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6584, "epsg", 6584,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333"
+        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y"
+        "_0=2000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas North Central\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",31.6666666666667],PARAMETER[\"central_meridian\",-98"
+        ".5],PARAMETER[\"standard_parallel_1\",33.9666666666667],"
+        "PARAMETER[\"standard_parallel_2\",32.1333333333333],PARA"
+        "METER[\"false_easting\",600000],PARAMETER[\"false_northi"
+        "ng\",2000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"6583\"]]"},
+    {6584, "epsg", 6584,
         "NAD83(2011) / Texas North Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y");
-    add_proj4text (p, 2,
-        "_0=2000000.0001016 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas North Central (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",31.6666666666667],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-98.5],PARAMETER[\"standard_parallel_1\",33.966666666");
-    add_srs_wkt (p, 10,
-        "6667],PARAMETER[\"standard_parallel_2\",32.1333333333333");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_easting\",1968500],PARAMETER[\"false");
-    add_srs_wkt (p, 12,
-        "_northing\",6561666.667],UNIT[\"US survey foot\",0.30480");
-    add_srs_wkt (p, 13,
-        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"658");
-    add_srs_wkt (p, 15,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6585, "epsg", 6585,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.96666666666667 +lat_2=32.13333333333"
+        "333 +lat_0=31.66666666666667 +lon_0=-98.5 +x_0=600000 +y"
+        "_0=2000000.0001016 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas North Central (ftUS)\",GEOG"
+        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere"
+        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",31.6666666666667],PARAMETER[\"central_meridian"
+        "\",-98.5],PARAMETER[\"standard_parallel_1\",33.966666666"
+        "6667],PARAMETER[\"standard_parallel_2\",32.1333333333333"
+        "],PARAMETER[\"false_easting\",1968500],PARAMETER[\"false"
+        "_northing\",6561666.667],UNIT[\"US survey foot\",0.30480"
+        "0609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"658"
+        "4\"]]"},
+    {6585, "epsg", 6585,
         "NAD83(2011) / Texas South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000 +y");
-    add_proj4text (p, 2,
-        "_0=5000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas South\",GEOGCS[\"NAD83(2011");
-    add_srs_wkt (p, 1,
-        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011");
-    add_srs_wkt (p, 2,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 7,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",25.6");
-    add_srs_wkt (p, 8,
-        "666666666667],PARAMETER[\"central_meridian\",-98.5],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"standard_parallel_1\",27.8333333333333],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"standard_parallel_2\",26.1666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",300000],PARAMETER[\"false_northing\",500");
-    add_srs_wkt (p, 12,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6585\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6586, "epsg", 6586,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666"
+        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000 +y"
+        "_0=5000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas South\",GEOGCS[\"NAD83(2011"
+        ")\",DATUM[\"NAD83_National_Spatial_Reference_System_2011"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",25.6"
+        "666666666667],PARAMETER[\"central_meridian\",-98.5],PARA"
+        "METER[\"standard_parallel_1\",27.8333333333333],PARAMETE"
+        "R[\"standard_parallel_2\",26.1666666666667],PARAMETER[\""
+        "false_easting\",300000],PARAMETER[\"false_northing\",500"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6585\"]]"},
+    {6586, "epsg", 6586,
         "NAD83(2011) / Texas South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00");
-    add_proj4text (p, 2,
-        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +units=us-ft ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas South (ftUS)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe");
-    add_srs_wkt (p, 7,
-        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin");
-    add_srs_wkt (p, 8,
-        "\",25.6666666666667],PARAMETER[\"central_meridian\",-98.");
-    add_srs_wkt (p, 9,
-        "5],PARAMETER[\"standard_parallel_1\",27.8333333333333],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"standard_parallel_2\",26.1666666666667],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_easting\",984250],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 12,
-        "g\",16404166.667],UNIT[\"US survey foot\",0.304800609601");
-    add_srs_wkt (p, 13,
-        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]");
-    add_srs_wkt (p, 14,
-        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6586\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6587, "epsg", 6587,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=27.83333333333333 +lat_2=26.16666666666"
+        "667 +lat_0=25.66666666666667 +lon_0=-98.5 +x_0=300000.00"
+        "00000001 +y_0=5000000.0001016 +ellps=GRS80 +units=us-ft "
+        "+no_defs",
+        "PROJCS[\"NAD83(2011) / Texas South (ftUS)\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambe"
+        "rt_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin"
+        "\",25.6666666666667],PARAMETER[\"central_meridian\",-98."
+        "5],PARAMETER[\"standard_parallel_1\",27.8333333333333],P"
+        "ARAMETER[\"standard_parallel_2\",26.1666666666667],PARAM"
+        "ETER[\"false_easting\",984250],PARAMETER[\"false_northin"
+        "g\",16404166.667],UNIT[\"US survey foot\",0.304800609601"
+        "219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST]"
+        ",AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6586\"]]"},
+    {6587, "epsg", 6587,
         "NAD83(2011) / Texas South Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=4000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas South Central\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",27.8333333333333],PARAMETER[\"central_meridian\",-99");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",30.2833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",28.3833333333333],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",600000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"6587\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6588, "epsg", 6588,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333"
+        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0"
+        "=4000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas South Central\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",27.8333333333333],PARAMETER[\"central_meridian\",-99"
+        "],PARAMETER[\"standard_parallel_1\",30.2833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",28.3833333333333],PARAME"
+        "TER[\"false_easting\",600000],PARAMETER[\"false_northing"
+        "\",4000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"6587\"]]"},
+    {6588, "epsg", 6588,
         "NAD83(2011) / Texas South Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=3999999.9998984 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Texas South Central (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",27.8333333333333],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 9,
-        "\",-99],PARAMETER[\"standard_parallel_1\",30.28333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"standard_parallel_2\",28.3833333333333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_n");
-    add_srs_wkt (p, 12,
-        "orthing\",13123333.333],UNIT[\"US survey foot\",0.304800");
-    add_srs_wkt (p, 13,
-        "609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 14,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"658");
-    add_srs_wkt (p, 15,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6589, "epsg", 6589,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=30.28333333333333 +lat_2=28.38333333333"
+        "333 +lat_0=27.83333333333333 +lon_0=-99 +x_0=600000 +y_0"
+        "=3999999.9998984 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Texas South Central (ftUS)\",GEOG"
+        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere"
+        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",27.8333333333333],PARAMETER[\"central_meridian"
+        "\",-99],PARAMETER[\"standard_parallel_1\",30.28333333333"
+        "33],PARAMETER[\"standard_parallel_2\",28.3833333333333],"
+        "PARAMETER[\"false_easting\",1968500],PARAMETER[\"false_n"
+        "orthing\",13123333.333],UNIT[\"US survey foot\",0.304800"
+        "609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"658"
+        "8\"]]"},
+    {6589, "epsg", 6589,
         "NAD83(2011) / Vermont", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0");
-    add_proj4text (p, 1,
-        "=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Vermont\",GEOGCS[\"NAD83(2011)\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"NAD83_National_Spatial_Reference_System_2011\",S");
-    add_srs_wkt (p, 2,
-        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca");
-    add_srs_wkt (p, 7,
-        "tor\"],PARAMETER[\"latitude_of_origin\",42.5],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",-72.5],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".999964286],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 11,
-        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AUTHORITY[\"EPSG\",\"6589\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6590, "epsg", 6590,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0"
+        "=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Vermont\",GEOGCS[\"NAD83(2011)\","
+        "DATUM[\"NAD83_National_Spatial_Reference_System_2011\",S"
+        "PHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"E"
+        "PSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_Merca"
+        "tor\"],PARAMETER[\"latitude_of_origin\",42.5],PARAMETER["
+        "\"central_meridian\",-72.5],PARAMETER[\"scale_factor\",0"
+        ".999964286],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPS"
+        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"6589\"]]"},
+    {6590, "epsg", 6590,
         "NAD83(2011) / Vermont (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0");
-    add_proj4text (p, 1,
-        "=500000.00001016 +y_0=0 +ellps=GRS80 +units=us-ft +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Vermont (ftUS)\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-72.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 9,
-        "or\",0.999964286],PARAMETER[\"false_easting\",1640416.66");
-    add_srs_wkt (p, 10,
-        "67],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo");
-    add_srs_wkt (p, 11,
-        "t\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"6590\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6591, "epsg", 6591,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=42.5 +lon_0=-72.5 +k=0.999964286 +x_0"
+        "=500000.00001016 +y_0=0 +ellps=GRS80 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / Vermont (ftUS)\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",42.5],PARA"
+        "METER[\"central_meridian\",-72.5],PARAMETER[\"scale_fact"
+        "or\",0.999964286],PARAMETER[\"false_easting\",1640416.66"
+        "67],PARAMETER[\"false_northing\",0],UNIT[\"US survey foo"
+        "t\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6590\"]]"},
+    {6591, "epsg", 6591,
         "NAD83(2011) / Virginia Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +");
-    add_proj4text (p, 1,
-        "x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia Lambert\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",36],PARAMETER[\"central_meridian\",-79.5],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "tandard_parallel_1\",37],PARAMETER[\"standard_parallel_2");
-    add_srs_wkt (p, 10,
-        "\",39.5],PARAMETER[\"false_easting\",0],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"6591\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6592, "epsg", 6592,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37 +lat_2=39.5 +lat_0=36 +lon_0=-79.5 +"
+        "x_0=0 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Virginia Lambert\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",36],PARAMETER[\"central_meridian\",-79.5],PARAMETER[\"s"
+        "tandard_parallel_1\",37],PARAMETER[\"standard_parallel_2"
+        "\",39.5],PARAMETER[\"false_easting\",0],PARAMETER[\"fals"
+        "e_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90"
+        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"6591\"]]"},
+    {6592, "epsg", 6592,
         "NAD83(2011) / Virginia North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000 +y_0=2000000 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia North\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37");
-    add_srs_wkt (p, 8,
-        ".6666666666667],PARAMETER[\"central_meridian\",-78.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",39.2],PARAMETER[\"standa");
-    add_srs_wkt (p, 10,
-        "rd_parallel_2\",38.0333333333333],PARAMETER[\"false_east");
-    add_srs_wkt (p, 11,
-        "ing\",3500000],PARAMETER[\"false_northing\",2000000],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "6592\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6593, "epsg", 6593,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37"
+        ".66666666666666 +lon_0=-78.5 +x_0=3500000 +y_0=2000000 +"
+        "ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Virginia North\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",37"
+        ".6666666666667],PARAMETER[\"central_meridian\",-78.5],PA"
+        "RAMETER[\"standard_parallel_1\",39.2],PARAMETER[\"standa"
+        "rd_parallel_2\",38.0333333333333],PARAMETER[\"false_east"
+        "ing\",3500000],PARAMETER[\"false_northing\",2000000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6592\"]]"},
+    {6593, "epsg", 6593,
         "NAD83(2011) / Virginia North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37");
-    add_proj4text (p, 1,
-        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2");
-    add_proj4text (p, 2,
-        "000000.0001016 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",37.6666666666667],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "78.5],PARAMETER[\"standard_parallel_1\",39.2],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",38.0333333333333],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",11482916.667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",6561666.667],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 13,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 14,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6593\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6594, "epsg", 6594,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.2 +lat_2=38.03333333333333 +lat_0=37"
+        ".66666666666666 +lon_0=-78.5 +x_0=3500000.0001016 +y_0=2"
+        "000000.0001016 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Virginia North (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",37.6666666666667],PARAMETER[\"central_meridian\",-"
+        "78.5],PARAMETER[\"standard_parallel_1\",39.2],PARAMETER["
+        "\"standard_parallel_2\",38.0333333333333],PARAMETER[\"fa"
+        "lse_easting\",11482916.667],PARAMETER[\"false_northing\""
+        ",6561666.667],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6593\"]]"},
+    {6594, "epsg", 6594,
         "NAD83(2011) / Virginia South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000 +");
-    add_proj4text (p, 2,
-        "y_0=1000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia South\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"central_meridian\",-78.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",37.9666666666667],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",36.7666666666667],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",3500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 12,
-        "1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 13,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 14,
-        "Y[\"EPSG\",\"6594\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6595, "epsg", 6595,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666"
+        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000 +"
+        "y_0=1000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Virginia South\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36"
+        ".3333333333333],PARAMETER[\"central_meridian\",-78.5],PA"
+        "RAMETER[\"standard_parallel_1\",37.9666666666667],PARAME"
+        "TER[\"standard_parallel_2\",36.7666666666667],PARAMETER["
+        "\"false_easting\",3500000],PARAMETER[\"false_northing\","
+        "1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"6594\"]]"},
+    {6595, "epsg", 6595,
         "NAD83(2011) / Virginia South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0");
-    add_proj4text (p, 2,
-        "001016 +y_0=999999.9998983998 +ellps=GRS80 +units=us-ft ");
-    add_proj4text (p, 3,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Virginia South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",36.3333333333333],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "78.5],PARAMETER[\"standard_parallel_1\",37.9666666666667");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"standard_parallel_2\",36.7666666666667],PA");
-    add_srs_wkt (p, 11,
-        "RAMETER[\"false_easting\",11482916.667],PARAMETER[\"fals");
-    add_srs_wkt (p, 12,
-        "e_northing\",3280833.333],UNIT[\"US survey foot\",0.3048");
-    add_srs_wkt (p, 13,
-        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 14,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 15,
-        "595\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6596, "epsg", 6596,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.96666666666667 +lat_2=36.76666666666"
+        "667 +lat_0=36.33333333333334 +lon_0=-78.5 +x_0=3500000.0"
+        "001016 +y_0=999999.9998983998 +ellps=GRS80 +units=us-ft "
+        "+no_defs",
+        "PROJCS[\"NAD83(2011) / Virginia South (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",36.3333333333333],PARAMETER[\"central_meridian\",-"
+        "78.5],PARAMETER[\"standard_parallel_1\",37.9666666666667"
+        "],PARAMETER[\"standard_parallel_2\",36.7666666666667],PA"
+        "RAMETER[\"false_easting\",11482916.667],PARAMETER[\"fals"
+        "e_northing\",3280833.333],UNIT[\"US survey foot\",0.3048"
+        "00609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6"
+        "595\"]]"},
+    {6596, "epsg", 6596,
         "NAD83(2011) / Washington North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000 +y_0=0 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Washington North\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",47],PARAMETER[\"central_meridian\",-120.833333333333],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",48.7333333333333],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"standard_parallel_2\",47.5],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6596\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6597, "epsg", 6597,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47"
+        " +lon_0=-120.8333333333333 +x_0=500000 +y_0=0 +ellps=GRS"
+        "80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Washington North\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",47],PARAMETER[\"central_meridian\",-120.833333333333],P"
+        "ARAMETER[\"standard_parallel_1\",48.7333333333333],PARAM"
+        "ETER[\"standard_parallel_2\",47.5],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6596\""
+        "]]"},
+    {6597, "epsg", 6597,
         "NAD83(2011) / Washington North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47");
-    add_proj4text (p, 1,
-        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0");
-    add_proj4text (p, 2,
-        " +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Washington North (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",47],PARAMETER[\"central_meridian\",-120.833333333");
-    add_srs_wkt (p, 9,
-        "333],PARAMETER[\"standard_parallel_1\",48.7333333333333]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"standard_parallel_2\",47.5],PARAMETER[\"fal");
-    add_srs_wkt (p, 11,
-        "se_easting\",1640416.667],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6597\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6598, "epsg", 6598,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=48.73333333333333 +lat_2=47.5 +lat_0=47"
+        " +lon_0=-120.8333333333333 +x_0=500000.0001016001 +y_0=0"
+        " +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Washington North (ftUS)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",47],PARAMETER[\"central_meridian\",-120.833333333"
+        "333],PARAMETER[\"standard_parallel_1\",48.7333333333333]"
+        ",PARAMETER[\"standard_parallel_2\",47.5],PARAMETER[\"fal"
+        "se_easting\",1640416.667],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY[\""
+        "EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"6597\"]]"},
+    {6598, "epsg", 6598,
         "NAD83(2011) / Washington South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Washington South\",GEOGCS[\"NAD83");
-    add_srs_wkt (p, 1,
-        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System");
-    add_srs_wkt (p, 2,
-        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],");
-    add_srs_wkt (p, 4,
-        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI");
-    add_srs_wkt (p, 5,
-        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912");
-    add_srs_wkt (p, 6,
-        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert");
-    add_srs_wkt (p, 7,
-        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",45.3333333333333],PARAMETER[\"central_meridian\",-120.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",47.3333333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",45.8333333333333],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",500000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 12,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"6598\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6599, "epsg", 6599,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333"
+        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000 +"
+        "y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Washington South\",GEOGCS[\"NAD83"
+        "(2011)\",DATUM[\"NAD83_National_Spatial_Reference_System"
+        "_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTH"
+        "ORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],"
+        "PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNI"
+        "T[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"912"
+        "2\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert"
+        "_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",45.3333333333333],PARAMETER[\"central_meridian\",-120.5"
+        "],PARAMETER[\"standard_parallel_1\",47.3333333333333],PA"
+        "RAMETER[\"standard_parallel_2\",45.8333333333333],PARAME"
+        "TER[\"false_easting\",500000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"6598\"]]"},
+    {6599, "epsg", 6599,
         "NAD83(2011) / Washington South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333");
-    add_proj4text (p, 1,
-        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "001016001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Washington South (ftUS)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",45.3333333333333],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-120.5],PARAMETER[\"standard_parallel_1\",47.33333333333");
-    add_srs_wkt (p, 10,
-        "33],PARAMETER[\"standard_parallel_2\",45.8333333333333],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_easting\",1640416.667],PARAMETER[\"fal");
-    add_srs_wkt (p, 12,
-        "se_northing\",0],UNIT[\"US survey foot\",0.3048006096012");
-    add_srs_wkt (p, 13,
-        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6599\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6600, "epsg", 6600,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47.33333333333334 +lat_2=45.83333333333"
+        "334 +lat_0=45.33333333333334 +lon_0=-120.5 +x_0=500000.0"
+        "001016001 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Washington South (ftUS)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",45.3333333333333],PARAMETER[\"central_meridian\","
+        "-120.5],PARAMETER[\"standard_parallel_1\",47.33333333333"
+        "33],PARAMETER[\"standard_parallel_2\",45.8333333333333],"
+        "PARAMETER[\"false_easting\",1640416.667],PARAMETER[\"fal"
+        "se_northing\",0],UNIT[\"US survey foot\",0.3048006096012"
+        "19,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6599\"]]"},
+    {6600, "epsg", 6600,
         "NAD83(2011) / West Virginia North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79.");
-    add_proj4text (p, 1,
-        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / West Virginia North\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",38.5],PARAMETER[\"central_meridian\",-79.5],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"standard_parallel_1\",40.25],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 10,
-        "rallel_2\",39],PARAMETER[\"false_easting\",600000],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"6600\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6601, "epsg", 6601,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79."
+        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / West Virginia North\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",38.5],PARAMETER[\"central_meridian\",-79.5],PARAMETE"
+        "R[\"standard_parallel_1\",40.25],PARAMETER[\"standard_pa"
+        "rallel_2\",39],PARAMETER[\"false_easting\",600000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"6600\"]]"},
+    {6601, "epsg", 6601,
         "NAD83(2011) / West Virginia North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79.");
-    add_proj4text (p, 1,
-        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / West Virginia North (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",38.5],PARAMETER[\"central_meridian\",-79.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",40.25],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",39],PARAMETER[\"false_easting\",1968500");
-    add_srs_wkt (p, 11,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 12,
-        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"6601\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6602, "epsg", 6602,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.25 +lat_2=39 +lat_0=38.5 +lon_0=-79."
+        "5 +x_0=600000 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / West Virginia North (ftUS)\",GEOG"
+        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere"
+        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",38.5],PARAMETER[\"central_meridian\",-79.5],PA"
+        "RAMETER[\"standard_parallel_1\",40.25],PARAMETER[\"stand"
+        "ard_parallel_2\",39],PARAMETER[\"false_easting\",1968500"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"US survey foot\""
+        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"6601\"]]"},
+    {6602, "epsg", 6602,
         "NAD83(2011) / West Virginia South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / West Virginia South\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",37],PARAMETER[\"central_meridian\",-81],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_1\",38.8833333333333],PARAMETER[\"stan");
-    add_srs_wkt (p, 10,
-        "dard_parallel_2\",37.4833333333333],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 11,
-        "sting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"m");
-    add_srs_wkt (p, 12,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 13,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6602");
-    add_srs_wkt (p, 14,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6603, "epsg", 6603,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333"
+        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / West Virginia South\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",37],PARAMETER[\"central_meridian\",-81],PARAMETER[\""
+        "standard_parallel_1\",38.8833333333333],PARAMETER[\"stan"
+        "dard_parallel_2\",37.4833333333333],PARAMETER[\"false_ea"
+        "sting\",600000],PARAMETER[\"false_northing\",0],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6602"
+        "\"]]"},
+    {6603, "epsg", 6603,
         "NAD83(2011) / West Virginia South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / West Virginia South (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",37],PARAMETER[\"central_meridian\",-81],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"standard_parallel_1\",38.8833333333333],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",37.4833333333333],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",1968500],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 12,
-        "NIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 14,
-        "NORTH],AUTHORITY[\"EPSG\",\"6603\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6604, "epsg", 6604,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.88333333333333 +lat_2=37.48333333333"
+        "333 +lat_0=37 +lon_0=-81 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / West Virginia South (ftUS)\",GEOG"
+        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere"
+        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of"
+        "_origin\",37],PARAMETER[\"central_meridian\",-81],PARAME"
+        "TER[\"standard_parallel_1\",38.8833333333333],PARAMETER["
+        "\"standard_parallel_2\",37.4833333333333],PARAMETER[\"fa"
+        "lse_easting\",1968500],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPS"
+        "G\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"6603\"]]"},
+    {6604, "epsg", 6604,
         "NAD83(2011) / Wisconsin Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84=");
-    add_proj4text (p, 2,
-        "0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin Central\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",43.8333333333333],PARAMETER[\"central_meridian\",-90],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"standard_parallel_1\",45.5],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",44.25],PARAMETER[\"false_easting\",6000");
-    add_srs_wkt (p, 11,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 12,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6879\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6605, "epsg", 6605,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333"
+        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +towgs84="
+        "0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Wisconsin Central\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",43.8333333333333],PARAMETER[\"central_meridian\",-90],P"
+        "ARAMETER[\"standard_parallel_1\",45.5],PARAMETER[\"stand"
+        "ard_parallel_2\",44.25],PARAMETER[\"false_easting\",6000"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6879\"]]"},
+    {6605, "epsg", 6605,
         "NAD83(2011) / Wisconsin Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333");
-    add_proj4text (p, 1,
-        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin Central (ftUS)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",43.8333333333333],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 9,
-        ",-90],PARAMETER[\"standard_parallel_1\",45.5],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",44.25],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US su");
-    add_srs_wkt (p, 12,
-        "rvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 13,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 14,
-        "RITY[\"EPSG\",\"6605\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6606, "epsg", 6606,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5 +lat_2=44.25 +lat_0=43.83333333333"
+        "334 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80 +units=us"
+        "-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Wisconsin Central (ftUS)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",43.8333333333333],PARAMETER[\"central_meridian\""
+        ",-90],PARAMETER[\"standard_parallel_1\",45.5],PARAMETER["
+        "\"standard_parallel_2\",44.25],PARAMETER[\"false_easting"
+        "\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US su"
+        "rvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"6605\"]]"},
+    {6606, "epsg", 6606,
         "NAD83(2011) / Wisconsin North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin North\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "45.1666666666667],PARAMETER[\"central_meridian\",-90],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",46.7666666666667],PARAME");
-    add_srs_wkt (p, 10,
-        "TER[\"standard_parallel_2\",45.5666666666667],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",600000],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"6606\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6607, "epsg", 6607,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666"
+        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Wisconsin North\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "45.1666666666667],PARAMETER[\"central_meridian\",-90],PA"
+        "RAMETER[\"standard_parallel_1\",46.7666666666667],PARAME"
+        "TER[\"standard_parallel_2\",45.5666666666667],PARAMETER["
+        "\"false_easting\",600000],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"6606\"]]"},
+    {6607, "epsg", 6607,
         "NAD83(2011) / Wisconsin North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0");
-    add_proj4text (p, 2,
-        "=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin North (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",45.1666666666667],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 9,
-        "90],PARAMETER[\"standard_parallel_1\",46.7666666666667],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_2\",45.5666666666667],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",1968500],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 14,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6607\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6608, "epsg", 6608,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.76666666666667 +lat_2=45.56666666666"
+        "667 +lat_0=45.16666666666666 +lon_0=-90 +x_0=600000 +y_0"
+        "=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Wisconsin North (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",45.1666666666667],PARAMETER[\"central_meridian\",-"
+        "90],PARAMETER[\"standard_parallel_1\",46.7666666666667],"
+        "PARAMETER[\"standard_parallel_2\",45.5666666666667],PARA"
+        "METER[\"false_easting\",1968500],PARAMETER[\"false_north"
+        "ing\",0],UNIT[\"US survey foot\",0.304800609601219,AUTHO"
+        "RITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"6607\"]]"},
+    {6608, "epsg", 6608,
         "NAD83(2011) / Wisconsin South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin South\",GEOGCS[\"NAD83(");
-    add_srs_wkt (p, 1,
-        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_");
-    add_srs_wkt (p, 2,
-        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT");
-    add_srs_wkt (p, 5,
-        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122");
-    add_srs_wkt (p, 6,
-        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_");
-    add_srs_wkt (p, 7,
-        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "42],PARAMETER[\"central_meridian\",-90],PARAMETER[\"stan");
-    add_srs_wkt (p, 9,
-        "dard_parallel_1\",44.0666666666667],PARAMETER[\"standard");
-    add_srs_wkt (p, 10,
-        "_parallel_2\",42.7333333333333],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 11,
-        "g\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 12,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 13,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6608\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6609, "epsg", 6609,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333"
+        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Wisconsin South\",GEOGCS[\"NAD83("
+        "2011)\",DATUM[\"NAD83_National_Spatial_Reference_System_"
+        "2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHO"
+        "RITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],P"
+        "RIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT"
+        "[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122"
+        "\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_"
+        "Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\","
+        "42],PARAMETER[\"central_meridian\",-90],PARAMETER[\"stan"
+        "dard_parallel_1\",44.0666666666667],PARAMETER[\"standard"
+        "_parallel_2\",42.7333333333333],PARAMETER[\"false_eastin"
+        "g\",600000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6608\"]]"},
+    {6609, "epsg", 6609,
         "NAD83(2011) / Wisconsin South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333");
-    add_proj4text (p, 1,
-        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin South (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La");
-    add_srs_wkt (p, 7,
-        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori");
-    add_srs_wkt (p, 8,
-        "gin\",42],PARAMETER[\"central_meridian\",-90],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"standard_parallel_1\",44.0666666666667],PARAMETER[\"st");
-    add_srs_wkt (p, 10,
-        "andard_parallel_2\",42.7333333333333],PARAMETER[\"false_");
-    add_srs_wkt (p, 11,
-        "easting\",1968500],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 12,
-        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 14,
-        "H],AUTHORITY[\"EPSG\",\"6609\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6610, "epsg", 6610,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44.06666666666667 +lat_2=42.73333333333"
+        "333 +lat_0=42 +lon_0=-90 +x_0=600000 +y_0=0 +ellps=GRS80"
+        " +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Wisconsin South (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"La"
+        "mbert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_ori"
+        "gin\",42],PARAMETER[\"central_meridian\",-90],PARAMETER["
+        "\"standard_parallel_1\",44.0666666666667],PARAMETER[\"st"
+        "andard_parallel_2\",42.7333333333333],PARAMETER[\"false_"
+        "easting\",1968500],PARAMETER[\"false_northing\",0],UNIT["
+        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\","
+        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6609\"]]"},
+    {6610, "epsg", 6610,
         "NAD83(2011) / Wisconsin Transverse Mercator", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y");
-    add_proj4text (p, 1,
-        "_0=-4480000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wisconsin Transverse Mercator\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",0],PARAMETER[\"central_meridian\",-90],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",52000");
-    add_srs_wkt (p, 10,
-        "0],PARAMETER[\"false_northing\",-4480000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6610\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6611, "epsg", 6611,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-90 +k=0.9996 +x_0=520000 +y"
+        "_0=-4480000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Wisconsin Transverse Mercator\",G"
+        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-90],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",52000"
+        "0],PARAMETER[\"false_northing\",-4480000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6610\"]]"},
+    {6611, "epsg", 6611,
         "NAD83(2011) / Wyoming East", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming East\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-105.166666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",20");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6611\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6612, "epsg", 6612,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9"
+        "999375 +x_0=200000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Wyoming East\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM"
+        "ETER[\"central_meridian\",-105.166666666667],PARAMETER[\""
+        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",20"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6611\"]]"},
+    {6612, "epsg", 6612,
         "NAD83(2011) / Wyoming East (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming East (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-105.166666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",656166.6667],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 13,
-        "H],AUTHORITY[\"EPSG\",\"6612\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6613, "epsg", 6613,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-105.1666666666667 +k=0.9"
+        "999375 +x_0=200000.00001016 +y_0=0 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Wyoming East (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5"
+        "],PARAMETER[\"central_meridian\",-105.166666666667],PARA"
+        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east"
+        "ing\",656166.6667],PARAMETER[\"false_northing\",0],UNIT["
+        "\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\","
+        "\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"6612\"]]"},
+    {6613, "epsg", 6613,
         "NAD83(2011) / Wyoming East Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=400000 +y_0=100000 +ellps=GRS80 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming East Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-107.333333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",400000],PARAMETER[\"false_northing\",100000],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 13,
-        "613\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6614, "epsg", 6614,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9"
+        "999375 +x_0=400000 +y_0=100000 +ellps=GRS80 +units=m +no"
+        "_defs",
+        "PROJCS[\"NAD83(2011) / Wyoming East Central\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5"
+        "],PARAMETER[\"central_meridian\",-107.333333333333],PARA"
+        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east"
+        "ing\",400000],PARAMETER[\"false_northing\",100000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6"
+        "613\"]]"},
+    {6614, "epsg", 6614,
         "NAD83(2011) / Wyoming East Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming East Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",40.5],PARAMETER[\"central_meridian\",-107.3333333333");
-    add_srs_wkt (p, 9,
-        "33],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",1312333.3333],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",328083.3333],UNIT[\"US survey foot\",0.304800609601219,");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 13,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6614\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6615, "epsg", 6615,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-107.3333333333333 +k=0.9"
+        "999375 +x_0=399999.99998984 +y_0=99999.99998983997 +ellp"
+        "s=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Wyoming East Central (ftUS)\",GEO"
+        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",40.5],PARAMETER[\"central_meridian\",-107.3333333333"
+        "33],PARAMETER[\"scale_factor\",0.9999375],PARAMETER[\"fa"
+        "lse_easting\",1312333.3333],PARAMETER[\"false_northing\""
+        ",328083.3333],UNIT[\"US survey foot\",0.304800609601219,"
+        "AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6614\"]]"},
+    {6615, "epsg", 6615,
         "NAD83(2011) / Wyoming West", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000 +y_0=100000 +ellps=GRS80 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming West\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-110.083333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",80");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",100000],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6615\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6616, "epsg", 6616,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9"
+        "999375 +x_0=800000 +y_0=100000 +ellps=GRS80 +units=m +no"
+        "_defs",
+        "PROJCS[\"NAD83(2011) / Wyoming West\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",40.5],PARAM"
+        "ETER[\"central_meridian\",-110.083333333333],PARAMETER[\""
+        "scale_factor\",0.9999375],PARAMETER[\"false_easting\",80"
+        "0000],PARAMETER[\"false_northing\",100000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6615\"]]"},
+    {6616, "epsg", 6616,
         "NAD83(2011) / Wyoming West (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9");
-    add_proj4text (p, 1,
-        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el");
-    add_proj4text (p, 2,
-        "lps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming West (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-110.083333333333],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",2624666.6667],PARAMETER[\"false_northing\",328083.");
-    add_srs_wkt (p, 11,
-        "3333],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6616\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6617, "epsg", 6617,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-110.0833333333333 +k=0.9"
+        "999375 +x_0=800000.0000101599 +y_0=99999.99998983997 +el"
+        "lps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Wyoming West (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5"
+        "],PARAMETER[\"central_meridian\",-110.083333333333],PARA"
+        "METER[\"scale_factor\",0.9999375],PARAMETER[\"false_east"
+        "ing\",2624666.6667],PARAMETER[\"false_northing\",328083."
+        "3333],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"6616\"]]"},
+    {6617, "epsg", 6617,
         "NAD83(2011) / Wyoming West Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming West Central\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy");
-    add_srs_wkt (p, 2,
-        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran");
-    add_srs_wkt (p, 7,
-        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-108.75],PARAMETER[\"sc");
-    add_srs_wkt (p, 9,
-        "ale_factor\",0.9999375],PARAMETER[\"false_easting\",6000");
-    add_srs_wkt (p, 10,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 11,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6617\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6618, "epsg", 6618,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0"
+        "=600000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Wyoming West Central\",GEOGCS[\"N"
+        "AD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sy"
+        "stem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,"
+        "AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tran"
+        "sverse_Mercator\"],PARAMETER[\"latitude_of_origin\",40.5"
+        "],PARAMETER[\"central_meridian\",-108.75],PARAMETER[\"sc"
+        "ale_factor\",0.9999375],PARAMETER[\"false_easting\",6000"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6617\"]]"},
+    {6618, "epsg", 6618,
         "NAD83(2011) / Wyoming West Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0");
-    add_proj4text (p, 1,
-        "=600000 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Wyoming West Central (ftUS)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",40.5],PARAMETER[\"central_meridian\",-108.75],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9999375],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US s");
-    add_srs_wkt (p, 11,
-        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003");
-    add_srs_wkt (p, 12,
-        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT");
-    add_srs_wkt (p, 13,
-        "HORITY[\"EPSG\",\"6618\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6619, "epsg", 6619,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=40.5 +lon_0=-108.75 +k=0.9999375 +x_0"
+        "=600000 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Wyoming West Central (ftUS)\",GEO"
+        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",40.5],PARAMETER[\"central_meridian\",-108.75],PARAME"
+        "TER[\"scale_factor\",0.9999375],PARAMETER[\"false_eastin"
+        "g\",1968500],PARAMETER[\"false_northing\",0],UNIT[\"US s"
+        "urvey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003"
+        "\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUT"
+        "HORITY[\"EPSG\",\"6618\"]]"},
+    {6619, "epsg", 6619,
         "NAD83(2011) / Utah Central", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000 +y_0=2000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah Central\",GEOGCS[\"NAD83(201");
-    add_srs_wkt (p, 1,
-        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201");
-    add_srs_wkt (p, 2,
-        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38.");
-    add_srs_wkt (p, 8,
-        "3333333333333],PARAMETER[\"central_meridian\",-111.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"standard_parallel_1\",40.65],PARAMETER[\"stand");
-    add_srs_wkt (p, 10,
-        "ard_parallel_2\",39.0166666666667],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 11,
-        "ting\",500000],PARAMETER[\"false_northing\",2000000],UNI");
-    add_srs_wkt (p, 12,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 13,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 14,
-        "6619\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6620, "epsg", 6620,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000 +y_0=2000000 "
+        "+ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Utah Central\",GEOGCS[\"NAD83(201"
+        "1)\",DATUM[\"NAD83_National_Spatial_Reference_System_201"
+        "1\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",38."
+        "3333333333333],PARAMETER[\"central_meridian\",-111.5],PA"
+        "RAMETER[\"standard_parallel_1\",40.65],PARAMETER[\"stand"
+        "ard_parallel_2\",39.0166666666667],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",2000000],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6619\"]]"},
+    {6620, "epsg", 6620,
         "NAD83(2011) / Utah North", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000 +");
-    add_proj4text (p, 2,
-        "y_0=1000000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah North\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.33333");
-    add_srs_wkt (p, 8,
-        "33333333],PARAMETER[\"central_meridian\",-111.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",41.7833333333333],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "standard_parallel_2\",40.7166666666667],PARAMETER[\"fals");
-    add_srs_wkt (p, 11,
-        "e_easting\",500000],PARAMETER[\"false_northing\",1000000");
-    add_srs_wkt (p, 12,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 13,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 14,
-        "G\",\"6620\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6621, "epsg", 6621,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000 +"
+        "y_0=1000000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Utah North\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",40.33333"
+        "33333333],PARAMETER[\"central_meridian\",-111.5],PARAMET"
+        "ER[\"standard_parallel_1\",41.7833333333333],PARAMETER[\""
+        "standard_parallel_2\",40.7166666666667],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",1000000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"6620\"]]"},
+    {6621, "epsg", 6621,
         "NAD83(2011) / Utah South", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000 +y_0=3000000 ");
-    add_proj4text (p, 2,
-        "+ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah South\",GEOGCS[\"NAD83(2011)");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.66666");
-    add_srs_wkt (p, 8,
-        "66666667],PARAMETER[\"central_meridian\",-111.5],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"standard_parallel_1\",38.35],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 10,
-        "arallel_2\",37.2166666666667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 11,
-        ",500000],PARAMETER[\"false_northing\",3000000],UNIT[\"me");
-    add_srs_wkt (p, 12,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 13,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6621\"");
-    add_srs_wkt (p, 14,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 6622, "epsg", 6622,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000 +y_0=3000000 "
+        "+ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Utah South\",GEOGCS[\"NAD83(2011)"
+        "\",DATUM[\"NAD83_National_Spatial_Reference_System_2011\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",36.66666"
+        "66666667],PARAMETER[\"central_meridian\",-111.5],PARAMET"
+        "ER[\"standard_parallel_1\",38.35],PARAMETER[\"standard_p"
+        "arallel_2\",37.2166666666667],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",3000000],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6621\""
+        "]]"},
+    {6622, "epsg", 6622,
         "NAD83(CSRS) / Quebec Lambert", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Quebec Lambert\",GEOGCS[\"NAD83(C");
-    add_srs_wkt (p, 1,
-        "SRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\"");
-    add_srs_wkt (p, 2,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_Conforma");
-    add_srs_wkt (p, 7,
-        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"central_meridian\",-68.5],PARAMETER[\"standard_p");
-    add_srs_wkt (p, 9,
-        "arallel_1\",60],PARAMETER[\"standard_parallel_2\",46],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"6622\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6623, "epsg", 6623,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_"
+        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(CSRS) / Quebec Lambert\",GEOGCS[\"NAD83(C"
+        "SRS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Lambert_Conforma"
+        "l_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",44],PARA"
+        "METER[\"central_meridian\",-68.5],PARAMETER[\"standard_p"
+        "arallel_1\",60],PARAMETER[\"standard_parallel_2\",46],PA"
+        "RAMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"6622\"]]"},
+    {6623, "epsg", 6623,
         "NAD83 / Quebec Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / Quebec Albers\",GEOGCS[\"NAD83\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 2,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_center\",44],PARAMETER[\"longitude_of_center\",");
-    add_srs_wkt (p, 8,
-        "-68.5],PARAMETER[\"standard_parallel_1\",60],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "standard_parallel_2\",46],PARAMETER[\"false_easting\",0]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 11,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 12,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"6623\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6624, "epsg", 6624,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_"
+        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83 / Quebec Albers\",GEOGCS[\"NAD83\",DATUM["
+        "\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4269\"]]"
+        ",PROJECTION[\"Albers_Conic_Equal_Area\"],PARAMETER[\"lat"
+        "itude_of_center\",44],PARAMETER[\"longitude_of_center\","
+        "-68.5],PARAMETER[\"standard_parallel_1\",60],PARAMETER[\""
+        "standard_parallel_2\",46],PARAMETER[\"false_easting\",0]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"6623\"]]"},
+    {6624, "epsg", 6624,
         "NAD83(CSRS) / Quebec Albers", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_Canadian_Spatial_Reference_System", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_");
-    add_proj4text (p, 1,
-        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(CSRS) / Quebec Albers\",GEOGCS[\"NAD83(CS");
-    add_srs_wkt (p, 1,
-        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Albers_Conic_Equ");
-    add_srs_wkt (p, 7,
-        "al_Area\"],PARAMETER[\"latitude_of_center\",44],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"longitude_of_center\",-68.5],PARAMETER[\"standard_pa");
-    add_srs_wkt (p, 9,
-        "rallel_1\",60],PARAMETER[\"standard_parallel_2\",46],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"6624\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6625, "epsg", 6625,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_1=60 +lat_2=46 +lat_0=44 +lon_0=-68.5 +x_"
+        "0=0 +y_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"NAD83(CSRS) / Quebec Albers\",GEOGCS[\"NAD83(CS"
+        "RS)\",DATUM[\"NAD83_Canadian_Spatial_Reference_System\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6140\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4617\"]],PROJECTION[\"Albers_Conic_Equ"
+        "al_Area\"],PARAMETER[\"latitude_of_center\",44],PARAMETE"
+        "R[\"longitude_of_center\",-68.5],PARAMETER[\"standard_pa"
+        "rallel_1\",60],PARAMETER[\"standard_parallel_2\",46],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"6624\"]]"},
+    {6625, "epsg", 6625,
         "NAD83(2011) / Utah Central (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=2000000.00001016 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah Central (ftUS)\",GEOGCS[\"NA");
-    add_srs_wkt (p, 1,
-        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys");
-    add_srs_wkt (p, 2,
-        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"");
-    add_srs_wkt (p, 4,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb");
-    add_srs_wkt (p, 7,
-        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",38.3333333333333],PARAMETER[\"central_meridian\",-11");
-    add_srs_wkt (p, 9,
-        "1.5],PARAMETER[\"standard_parallel_1\",40.65],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"standard_parallel_2\",39.0166666666667],PARAMETER[\"fa");
-    add_srs_wkt (p, 11,
-        "lse_easting\",1640416.6667],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",6561666.6667],UNIT[\"US survey foot\",0.304800609601219");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 14,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6625\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6626, "epsg", 6626,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=40.65 +lat_2=39.01666666666667 +lat_0=3"
+        "8.33333333333334 +lon_0=-111.5 +x_0=500000.00001016 +y_0"
+        "=2000000.00001016 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Utah Central (ftUS)\",GEOGCS[\"NA"
+        "D83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Sys"
+        "tem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,A"
+        "UTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamb"
+        "ert_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origi"
+        "n\",38.3333333333333],PARAMETER[\"central_meridian\",-11"
+        "1.5],PARAMETER[\"standard_parallel_1\",40.65],PARAMETER["
+        "\"standard_parallel_2\",39.0166666666667],PARAMETER[\"fa"
+        "lse_easting\",1640416.6667],PARAMETER[\"false_northing\""
+        ",6561666.6667],UNIT[\"US survey foot\",0.304800609601219"
+        ",AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6625\"]]"},
+    {6626, "epsg", 6626,
         "NAD83(2011) / Utah North (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666");
-    add_proj4text (p, 1,
-        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0");
-    add_proj4text (p, 2,
-        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +units=us-ft");
-    add_proj4text (p, 3,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah North (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",40.3333333333333],PARAMETER[\"central_meridian\",-111.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",41.7833333333333],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"standard_parallel_2\",40.7166666666667],PARAME");
-    add_srs_wkt (p, 11,
-        "TER[\"false_easting\",1640416.6667],PARAMETER[\"false_no");
-    add_srs_wkt (p, 12,
-        "rthing\",3280833.3333],UNIT[\"US survey foot\",0.3048006");
-    add_srs_wkt (p, 13,
-        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 14,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6626");
-    add_srs_wkt (p, 15,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6627, "epsg", 6627,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=41.78333333333333 +lat_2=40.71666666666"
+        "667 +lat_0=40.33333333333334 +lon_0=-111.5 +x_0=500000.0"
+        "0001016 +y_0=999999.9999898402 +ellps=GRS80 +units=us-ft"
+        " +no_defs",
+        "PROJCS[\"NAD83(2011) / Utah North (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",40.3333333333333],PARAMETER[\"central_meridian\",-111.5"
+        "],PARAMETER[\"standard_parallel_1\",41.7833333333333],PA"
+        "RAMETER[\"standard_parallel_2\",40.7166666666667],PARAME"
+        "TER[\"false_easting\",1640416.6667],PARAMETER[\"false_no"
+        "rthing\",3280833.3333],UNIT[\"US survey foot\",0.3048006"
+        "09601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6626"
+        "\"]]"},
+    {6627, "epsg", 6627,
         "NAD83(2011) / Utah South (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_2SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3");
-    add_proj4text (p, 1,
-        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0");
-    add_proj4text (p, 2,
-        "=3000000 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Utah South (ftUS)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste");
-    add_srs_wkt (p, 2,
-        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber");
-    add_srs_wkt (p, 7,
-        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",36.6666666666667],PARAMETER[\"central_meridian\",-111.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"standard_parallel_1\",38.35],PARAMETER[\"s");
-    add_srs_wkt (p, 10,
-        "tandard_parallel_2\",37.2166666666667],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_easting\",1640416.6667],PARAMETER[\"false_northing\",98");
-    add_srs_wkt (p, 12,
-        "42500],UNIT[\"US survey foot\",0.304800609601219,AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 14,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"6627\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6628, "epsg", 6628,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.35 +lat_2=37.21666666666667 +lat_0=3"
+        "6.66666666666666 +lon_0=-111.5 +x_0=500000.00001016 +y_0"
+        "=3000000 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Utah South (ftUS)\",GEOGCS[\"NAD8"
+        "3(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syste"
+        "m_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lamber"
+        "t_Conformal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\""
+        ",36.6666666666667],PARAMETER[\"central_meridian\",-111.5"
+        "],PARAMETER[\"standard_parallel_1\",38.35],PARAMETER[\"s"
+        "tandard_parallel_2\",37.2166666666667],PARAMETER[\"false"
+        "_easting\",1640416.6667],PARAMETER[\"false_northing\",98"
+        "42500],UNIT[\"US survey foot\",0.304800609601219,AUTHORI"
+        "TY[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"6627\"]]"},
+    {6628, "epsg", 6628,
         "NAD83(PA11) / Hawaii zone 1", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=18.83333333333333 +lon_0=-155.5 +k=0.");
-    add_proj4text (p, 1,
-        "999966667 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 1\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",18.83333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-155.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",0.999966667],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 11,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6628\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6629, "epsg", 6629,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=18.83333333333333 +lon_0=-155.5 +k=0."
+        "999966667 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_d"
+        "efs",
+        "PROJCS[\"NAD83(PA11) / Hawaii zone 1\",GEOGCS[\"NAD83(PA"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",18.83333333"
+        "33333],PARAMETER[\"central_meridian\",-155.5],PARAMETER["
+        "\"scale_factor\",0.999966667],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6628\"]]"},
+    {6629, "epsg", 6629,
         "NAD83(PA11) / Hawaii zone 2", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=20.33333333333333 +lon_0=-156.6666666");
-    add_proj4text (p, 1,
-        "666667 +k=0.999966667 +x_0=500000 +y_0=0 +ellps=GRS80 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 2\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",20.33333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-156.666666666667]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "6629\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6630, "epsg", 6630,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=20.33333333333333 +lon_0=-156.6666666"
+        "666667 +k=0.999966667 +x_0=500000 +y_0=0 +ellps=GRS80 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"NAD83(PA11) / Hawaii zone 2\",GEOGCS[\"NAD83(PA"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",20.33333333"
+        "33333],PARAMETER[\"central_meridian\",-156.666666666667]"
+        ",PARAMETER[\"scale_factor\",0.999966667],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "6629\"]]"},
+    {6630, "epsg", 6630,
         "NAD83(PA11) / Hawaii zone 3", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99");
-    add_proj4text (p, 1,
-        "999 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 3\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",21.16666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-158],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",0.99999],PARAMETER[\"false_easting\",5000");
-    add_srs_wkt (p, 10,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 11,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6630\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6631, "epsg", 6631,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=21.16666666666667 +lon_0=-158 +k=0.99"
+        "999 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(PA11) / Hawaii zone 3\",GEOGCS[\"NAD83(PA"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",21.16666666"
+        "66667],PARAMETER[\"central_meridian\",-158],PARAMETER[\""
+        "scale_factor\",0.99999],PARAMETER[\"false_easting\",5000"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"6630\"]]"},
+    {6631, "epsg", 6631,
         "NAD83(PA11) / Hawaii zone 4", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.83333333333333 +lon_0=-159.5 +k=0.");
-    add_proj4text (p, 1,
-        "99999 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 4\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",21.83333333");
-    add_srs_wkt (p, 8,
-        "33333],PARAMETER[\"central_meridian\",-159.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",0.99999],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 11,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6631\"]]");
-    p = add_epsg_def_ex (filter, first, last, 6632, "epsg", 6632,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=21.83333333333333 +lon_0=-159.5 +k=0."
+        "99999 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(PA11) / Hawaii zone 4\",GEOGCS[\"NAD83(PA"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",21.83333333"
+        "33333],PARAMETER[\"central_meridian\",-159.5],PARAMETER["
+        "\"scale_factor\",0.99999],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6631\"]]"},
+    {6632, "epsg", 6632,
         "NAD83(PA11) / Hawaii zone 5", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_PA11", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=21.66666666666667 +lon_0=-160.1666666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(PA11) / Hawaii zone 5\",GEOGCS[\"NAD83(PA");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",21.66666666");
-    add_srs_wkt (p, 8,
-        "66667],PARAMETER[\"central_meridian\",-160.166666666667]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 11,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 12,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6632\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=21.66666666666667 +lon_0=-160.1666666"
+        "666667 +k=1 +x_0=500000 +y_0=0 +ellps=GRS80 +units=m +no"
+        "_defs",
+        "PROJCS[\"NAD83(PA11) / Hawaii zone 5\",GEOGCS[\"NAD83(PA"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_PA"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1117\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6322\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",21.66666666"
+        "66667],PARAMETER[\"central_meridian\",-160.166666666667]"
+        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"6632\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_33 = {
+    epsg_defs_33, sizeof (epsg_defs_33) / sizeof (epsg_defs_33[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3693 +53,2105 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_42 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 8237, "epsg", 8237,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_42[] = {
+    {8237, "epsg", 8237,
         "NAD83(CSRS)v2", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_2", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(CSRS)v2\",DATUM[\"North_American_Datum_of");
-    add_srs_wkt (p, 1,
-        "_1983_CSRS_version_2\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"1193\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8237\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8239, "epsg", 8239,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(CSRS)v2\",DATUM[\"North_American_Datum_of"
+        "_1983_CSRS_version_2\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1193\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon"
+        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8237\"]]"},
+    {8239, "epsg", 8239,
         "NAD83(CSRS)v3", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_3", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(CSRS)v3\",DATUM[\"North American Datum o");
-    add_srs_wkt (p, 1,
-        "f 1983 (CSRS) version 3\",ELLIPSOID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell");
-    add_srs_wkt (p, 4,
-        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER");
-    add_srs_wkt (p, 5,
-        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo");
-    add_srs_wkt (p, 6,
-        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 7,
-        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",");
-    add_srs_wkt (p, 8,
-        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode");
-    add_srs_wkt (p, 9,
-        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B");
-    add_srs_wkt (p, 10,
-        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a");
-    add_srs_wkt (p, 11,
-        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut");
-    add_srs_wkt (p, 12,
-        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y");
-    add_srs_wkt (p, 13,
-        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8");
-    add_srs_wkt (p, 14,
-        "239]]");
-    p = add_epsg_def_ex (filter, first, last, 8240, "epsg", 8240,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(CSRS)v3\",DATUM[\"North American Datum o"
+        "f 1983 (CSRS) version 3\",ELLIPSOID[\"GRS 1980\",6378137"
+        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw"
+        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell"
+        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER"
+        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo"
+        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\","
+        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode"
+        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B"
+        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a"
+        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut"
+        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y"
+        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8"
+        "239]]"},
+    {8240, "epsg", 8240,
         "NAD83(CSRS)v3", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_3", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(CSRS)v3\",DATUM[\"North_American_Datum_of");
-    add_srs_wkt (p, 1,
-        "_1983_CSRS_version_3\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"1194\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8240\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8244, "epsg", 8244,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(CSRS)v3\",DATUM[\"North_American_Datum_of"
+        "_1983_CSRS_version_3\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1194\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon"
+        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8240\"]]"},
+    {8244, "epsg", 8244,
         "NAD83(CSRS)v4", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_4", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(CSRS)v4\",DATUM[\"North American Datum o");
-    add_srs_wkt (p, 1,
-        "f 1983 (CSRS) version 4\",ELLIPSOID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell");
-    add_srs_wkt (p, 4,
-        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER");
-    add_srs_wkt (p, 5,
-        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo");
-    add_srs_wkt (p, 6,
-        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 7,
-        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",");
-    add_srs_wkt (p, 8,
-        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode");
-    add_srs_wkt (p, 9,
-        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B");
-    add_srs_wkt (p, 10,
-        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a");
-    add_srs_wkt (p, 11,
-        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut");
-    add_srs_wkt (p, 12,
-        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y");
-    add_srs_wkt (p, 13,
-        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8");
-    add_srs_wkt (p, 14,
-        "244]]");
-    p = add_epsg_def_ex (filter, first, last, 8246, "epsg", 8246,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(CSRS)v4\",DATUM[\"North American Datum o"
+        "f 1983 (CSRS) version 4\",ELLIPSOID[\"GRS 1980\",6378137"
+        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw"
+        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell"
+        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER"
+        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo"
+        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\","
+        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode"
+        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B"
+        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a"
+        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut"
+        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y"
+        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8"
+        "244]]"},
+    {8246, "epsg", 8246,
         "NAD83(CSRS)v4", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_4", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(CSRS)v4\",DATUM[\"North_American_Datum_of");
-    add_srs_wkt (p, 1,
-        "_1983_CSRS_version_4\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"1195\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8246\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8248, "epsg", 8248,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(CSRS)v4\",DATUM[\"North_American_Datum_of"
+        "_1983_CSRS_version_4\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1195\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon"
+        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8246\"]]"},
+    {8248, "epsg", 8248,
         "NAD83(CSRS)v5", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_5", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(CSRS)v5\",DATUM[\"North American Datum o");
-    add_srs_wkt (p, 1,
-        "f 1983 (CSRS) version 5\",ELLIPSOID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell");
-    add_srs_wkt (p, 4,
-        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER");
-    add_srs_wkt (p, 5,
-        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo");
-    add_srs_wkt (p, 6,
-        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 7,
-        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",");
-    add_srs_wkt (p, 8,
-        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode");
-    add_srs_wkt (p, 9,
-        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B");
-    add_srs_wkt (p, 10,
-        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a");
-    add_srs_wkt (p, 11,
-        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut");
-    add_srs_wkt (p, 12,
-        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y");
-    add_srs_wkt (p, 13,
-        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8");
-    add_srs_wkt (p, 14,
-        "248]]");
-    p = add_epsg_def_ex (filter, first, last, 8249, "epsg", 8249,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(CSRS)v5\",DATUM[\"North American Datum o"
+        "f 1983 (CSRS) version 5\",ELLIPSOID[\"GRS 1980\",6378137"
+        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw"
+        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell"
+        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER"
+        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo"
+        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\","
+        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode"
+        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B"
+        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a"
+        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut"
+        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y"
+        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8"
+        "248]]"},
+    {8249, "epsg", 8249,
         "NAD83(CSRS)v5", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_5", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(CSRS)v5\",DATUM[\"North_American_Datum_of");
-    add_srs_wkt (p, 1,
-        "_1983_CSRS_version_5\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"1196\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8249\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8251, "epsg", 8251,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(CSRS)v5\",DATUM[\"North_American_Datum_of"
+        "_1983_CSRS_version_5\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1196\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon"
+        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8249\"]]"},
+    {8251, "epsg", 8251,
         "NAD83(CSRS)v6", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_6", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(CSRS)v6\",DATUM[\"North American Datum o");
-    add_srs_wkt (p, 1,
-        "f 1983 (CSRS) version 6\",ELLIPSOID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell");
-    add_srs_wkt (p, 4,
-        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER");
-    add_srs_wkt (p, 5,
-        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo");
-    add_srs_wkt (p, 6,
-        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 7,
-        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",");
-    add_srs_wkt (p, 8,
-        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode");
-    add_srs_wkt (p, 9,
-        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B");
-    add_srs_wkt (p, 10,
-        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a");
-    add_srs_wkt (p, 11,
-        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut");
-    add_srs_wkt (p, 12,
-        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y");
-    add_srs_wkt (p, 13,
-        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8");
-    add_srs_wkt (p, 14,
-        "251]]");
-    p = add_epsg_def_ex (filter, first, last, 8252, "epsg", 8252,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(CSRS)v6\",DATUM[\"North American Datum o"
+        "f 1983 (CSRS) version 6\",ELLIPSOID[\"GRS 1980\",6378137"
+        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw"
+        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell"
+        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER"
+        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo"
+        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\","
+        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode"
+        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B"
+        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a"
+        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut"
+        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y"
+        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8"
+        "251]]"},
+    {8252, "epsg", 8252,
         "NAD83(CSRS)v6", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_6", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(CSRS)v6\",DATUM[\"North_American_Datum_of");
-    add_srs_wkt (p, 1,
-        "_1983_CSRS_version_6\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"1197\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8252\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8254, "epsg", 8254,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(CSRS)v6\",DATUM[\"North_American_Datum_of"
+        "_1983_CSRS_version_6\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1197\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon"
+        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8252\"]]"},
+    {8254, "epsg", 8254,
         "NAD83(CSRS)v7", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_7", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(CSRS)v7\",DATUM[\"North American Datum o");
-    add_srs_wkt (p, 1,
-        "f 1983 (CSRS) version 7\",ELLIPSOID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 2,
-        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 3,
-        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell");
-    add_srs_wkt (p, 4,
-        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER");
-    add_srs_wkt (p, 5,
-        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo");
-    add_srs_wkt (p, 6,
-        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 7,
-        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\",");
-    add_srs_wkt (p, 8,
-        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode");
-    add_srs_wkt (p, 9,
-        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B");
-    add_srs_wkt (p, 10,
-        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a");
-    add_srs_wkt (p, 11,
-        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut");
-    add_srs_wkt (p, 12,
-        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y");
-    add_srs_wkt (p, 13,
-        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8");
-    add_srs_wkt (p, 14,
-        "254]]");
-    p = add_epsg_def_ex (filter, first, last, 8255, "epsg", 8255,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(CSRS)v7\",DATUM[\"North American Datum o"
+        "f 1983 (CSRS) version 7\",ELLIPSOID[\"GRS 1980\",6378137"
+        ",298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenw"
+        "ich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ell"
+        "ipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER"
+        "[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geo"
+        "detic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)\","
+        "up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geode"
+        "sy.\"],AREA[\"Canada - onshore and offshore - Alberta; B"
+        "ritish Columbia; Manitoba; New Brunswick; Newfoundland a"
+        "nd Labrador; Northwest Territories; Nova Scotia; Nunavut"
+        "; Ontario; Prince Edward Island; Quebec; Saskatchewan; Y"
+        "ukon.\"],BBOX[40.04,-141.01,86.46,-47.74]],ID[\"EPSG\",8"
+        "254]]"},
+    {8255, "epsg", 8255,
         "NAD83(CSRS)v7", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_CSRS_version_7", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(CSRS)v7\",DATUM[\"North_American_Datum_of");
-    add_srs_wkt (p, 1,
-        "_1983_CSRS_version_7\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"1198\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon");
-    add_srs_wkt (p, 6,
-        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8255\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8311, "epsg", 8311,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(CSRS)v7\",DATUM[\"North_American_Datum_of"
+        "_1983_CSRS_version_7\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1198\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Lon"
+        "gitude\",EAST],AUTHORITY[\"EPSG\",\"8255\"]]"},
+    {8311, "epsg", 8311,
         "NAD83(2011) / Oregon Burns-Harper zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-117.666666666667 +k=1.00");
-    add_proj4text (p, 1,
-        "014 +x_0=90000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Burns-Harper zone (m)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",43.5],PARAMETER[\"central_meridian\",-117.666666666");
-    add_srs_wkt (p, 9,
-        "667],PARAMETER[\"scale_factor\",1.00014],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",90000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 12,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "8311\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8312, "epsg", 8312,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.5 +lon_0=-117.666666666667 +k=1.00"
+        "014 +x_0=90000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Burns-Harper zone (m)\",GE"
+        "OGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",43.5],PARAMETER[\"central_meridian\",-117.666666666"
+        "667],PARAMETER[\"scale_factor\",1.00014],PARAMETER[\"fal"
+        "se_easting\",90000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "8311\"]]"},
+    {8312, "epsg", 8312,
         "NAD83(2011) / Oregon Burns-Harper zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-117.666666666667 +k=1.00");
-    add_proj4text (p, 1,
-        "014 +x_0=90000.00001488 +y_0=0 +ellps=GRS80 +units=ft +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Burns-Harper zone (ft)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",43.5],PARAMETER[\"central_meridian\",-117.666666666");
-    add_srs_wkt (p, 9,
-        "667],PARAMETER[\"scale_factor\",1.00014],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",295275.5906],PARAMETER[\"false_northing\",0");
-    add_srs_wkt (p, 11,
-        "],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"8312\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8313, "epsg", 8313,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.5 +lon_0=-117.666666666667 +k=1.00"
+        "014 +x_0=90000.00001488 +y_0=0 +ellps=GRS80 +units=ft +n"
+        "o_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Burns-Harper zone (ft)\",G"
+        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",43.5],PARAMETER[\"central_meridian\",-117.666666666"
+        "667],PARAMETER[\"scale_factor\",1.00014],PARAMETER[\"fal"
+        "se_easting\",295275.5906],PARAMETER[\"false_northing\",0"
+        "],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"8312\"]]"},
+    {8313, "epsg", 8313,
         "NAD83(2011) / Oregon Canyon City-Burns zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-119 +k=1.00022 +x_0=2000");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Canyon City-Burns zone (m)");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",43.5],PARAMETER[\"central_meridian\",-119],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",1.00022],PARAMETER[\"false_easti");
-    add_srs_wkt (p, 10,
-        "ng\",20000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 11,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8313\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8314, "epsg", 8314,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.5 +lon_0=-119 +k=1.00022 +x_0=2000"
+        "0 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Canyon City-Burns zone (m)"
+        "\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",43.5],PARAMETER[\"central_meridian\",-119],PAR"
+        "AMETER[\"scale_factor\",1.00022],PARAMETER[\"false_easti"
+        "ng\",20000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8313\"]]"},
+    {8314, "epsg", 8314,
         "NAD83(2011) / Oregon Canyon City-Burns zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43.5 +lon_0=-119 +k=1.00022 +x_0=1999");
-    add_proj4text (p, 1,
-        "9.99999992 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Canyon City-Burns zone (ft");
-    add_srs_wkt (p, 1,
-        ")\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatia");
-    add_srs_wkt (p, 2,
-        "l_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 3,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 8,
-        "f_origin\",43.5],PARAMETER[\"central_meridian\",-119],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",1.00022],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",65616.7979],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "8314\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8315, "epsg", 8315,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43.5 +lon_0=-119 +k=1.00022 +x_0=1999"
+        "9.99999992 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Canyon City-Burns zone (ft"
+        ")\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatia"
+        "l_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,"
+        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",43.5],PARAMETER[\"central_meridian\",-119],PA"
+        "RAMETER[\"scale_factor\",1.00022],PARAMETER[\"false_east"
+        "ing\",65616.7979],PARAMETER[\"false_northing\",0],UNIT[\""
+        "foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "8314\"]]"},
+    {8315, "epsg", 8315,
         "NAD83(2011) / Oregon Coast Range North zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5833333333333 +lat_0=45.583333333333");
-    add_proj4text (p, 1,
-        "3 +lon_0=-123.416666666667 +k_0=1.000045 +x_0=30000 +y_0");
-    add_proj4text (p, 2,
-        "=20000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Coast Range North zone (m)");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",45.5833333333333],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-123.416666666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1.000045],PARAMETER[\"false_easting\",30000],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",20000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 13,
-        ",NORTH],AUTHORITY[\"EPSG\",\"8315\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8316, "epsg", 8316,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5833333333333 +lat_0=45.583333333333"
+        "3 +lon_0=-123.416666666667 +k_0=1.000045 +x_0=30000 +y_0"
+        "=20000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Coast Range North zone (m)"
+        "\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PRO"
+        "JECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"lat"
+        "itude_of_origin\",45.5833333333333],PARAMETER[\"central_"
+        "meridian\",-123.416666666667],PARAMETER[\"scale_factor\""
+        ",1.000045],PARAMETER[\"false_easting\",30000],PARAMETER["
+        "\"false_northing\",20000],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"8315\"]]"},
+    {8316, "epsg", 8316,
         "NAD83(2011) / Oregon Coast Range North zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.5833333333333 +lat_0=45.583333333333");
-    add_proj4text (p, 1,
-        "3 +lon_0=-123.416666666667 +k_0=1.000045 +x_0=30000.0000");
-    add_proj4text (p, 2,
-        "1512 +y_0=19999.99999992 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Coast Range North zone (ft");
-    add_srs_wkt (p, 1,
-        ")\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatia");
-    add_srs_wkt (p, 2,
-        "l_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,");
-    add_srs_wkt (p, 3,
-        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",45.5833333333333],PARAMETER[\"central");
-    add_srs_wkt (p, 9,
-        "_meridian\",-123.416666666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 10,
-        ",1.000045],PARAMETER[\"false_easting\",98425.1969],PARAM");
-    add_srs_wkt (p, 11,
-        "ETER[\"false_northing\",65616.7979],UNIT[\"foot\",0.3048");
-    add_srs_wkt (p, 12,
-        ",AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8316\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8317, "epsg", 8317,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.5833333333333 +lat_0=45.583333333333"
+        "3 +lon_0=-123.416666666667 +k_0=1.000045 +x_0=30000.0000"
+        "1512 +y_0=19999.99999992 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Coast Range North zone (ft"
+        ")\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatia"
+        "l_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,"
+        "298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"la"
+        "titude_of_origin\",45.5833333333333],PARAMETER[\"central"
+        "_meridian\",-123.416666666667],PARAMETER[\"scale_factor\""
+        ",1.000045],PARAMETER[\"false_easting\",98425.1969],PARAM"
+        "ETER[\"false_northing\",65616.7979],UNIT[\"foot\",0.3048"
+        ",AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8316\"]]"},
+    {8317, "epsg", 8317,
         "NAD83(2011) / Oregon Dayville-Prairie City zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=44.25 +lon_0=-119.633333333333 +k=1.0");
-    add_proj4text (p, 1,
-        "0012 +x_0=20000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Dayville-Prairie City zone");
-    add_srs_wkt (p, 1,
-        " (m)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spa");
-    add_srs_wkt (p, 2,
-        "tial_Reference_System_2011\",SPHEROID[\"GRS 1980\",63781");
-    add_srs_wkt (p, 3,
-        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]]");
-    add_srs_wkt (p, 7,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 8,
-        "e_of_origin\",44.25],PARAMETER[\"central_meridian\",-119");
-    add_srs_wkt (p, 9,
-        ".633333333333],PARAMETER[\"scale_factor\",1.00012],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",20000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 11,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"8317\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8318, "epsg", 8318,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=44.25 +lon_0=-119.633333333333 +k=1.0"
+        "0012 +x_0=20000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Dayville-Prairie City zone"
+        " (m)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spa"
+        "tial_Reference_System_2011\",SPHEROID[\"GRS 1980\",63781"
+        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY"
+        "[\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",44.25],PARAMETER[\"central_meridian\",-119"
+        ".633333333333],PARAMETER[\"scale_factor\",1.00012],PARAM"
+        "ETER[\"false_easting\",20000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"8317\"]]"},
+    {8318, "epsg", 8318,
         "NAD83(2011) / Oregon Dayville-Prairie City zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=44.25 +lon_0=-119.633333333333 +k=1.0");
-    add_proj4text (p, 1,
-        "0012 +x_0=19999.99999992 +y_0=0 +ellps=GRS80 +units=ft +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Dayville-Prairie City zone");
-    add_srs_wkt (p, 1,
-        " (ft)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Sp");
-    add_srs_wkt (p, 2,
-        "atial_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378");
-    add_srs_wkt (p, 3,
-        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]]");
-    add_srs_wkt (p, 7,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 8,
-        "e_of_origin\",44.25],PARAMETER[\"central_meridian\",-119");
-    add_srs_wkt (p, 9,
-        ".633333333333],PARAMETER[\"scale_factor\",1.00012],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",65616.7979],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 11,
-        "thing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"8318\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8319, "epsg", 8319,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=44.25 +lon_0=-119.633333333333 +k=1.0"
+        "0012 +x_0=19999.99999992 +y_0=0 +ellps=GRS80 +units=ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Dayville-Prairie City zone"
+        " (ft)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Sp"
+        "atial_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378"
+        "137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORIT"
+        "Y[\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",44.25],PARAMETER[\"central_meridian\",-119"
+        ".633333333333],PARAMETER[\"scale_factor\",1.00012],PARAM"
+        "ETER[\"false_easting\",65616.7979],PARAMETER[\"false_nor"
+        "thing\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900"
+        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"8318\"]]"},
+    {8319, "epsg", 8319,
         "NAD83(2011) / Oregon Denio-Burns zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.75 +lon_0=-118.416666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "0019 +x_0=80000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Denio-Burns zone (m)\",GEO");
-    add_srs_wkt (p, 1,
-        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer");
-    add_srs_wkt (p, 2,
-        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 3,
-        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 5,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO");
-    add_srs_wkt (p, 7,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 8,
-        "n\",41.75],PARAMETER[\"central_meridian\",-118.416666666");
-    add_srs_wkt (p, 9,
-        "667],PARAMETER[\"scale_factor\",1.00019],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_easting\",80000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 12,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "8319\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8320, "epsg", 8320,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.75 +lon_0=-118.416666666667 +k=1.0"
+        "0019 +x_0=80000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Denio-Burns zone (m)\",GEO"
+        "GCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refer"
+        "ence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257"
+        "222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\","
+        "\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",41.75],PARAMETER[\"central_meridian\",-118.416666666"
+        "667],PARAMETER[\"scale_factor\",1.00019],PARAMETER[\"fal"
+        "se_easting\",80000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "8319\"]]"},
+    {8320, "epsg", 8320,
         "NAD83(2011) / Oregon Denio-Burns zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.75 +lon_0=-118.416666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "0019 +x_0=79999.99999968 +y_0=0 +ellps=GRS80 +units=ft +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Denio-Burns zone (ft)\",GE");
-    add_srs_wkt (p, 1,
-        "OGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refe");
-    add_srs_wkt (p, 2,
-        "rence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 3,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 8,
-        "in\",41.75],PARAMETER[\"central_meridian\",-118.41666666");
-    add_srs_wkt (p, 9,
-        "6667],PARAMETER[\"scale_factor\",1.00019],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",262467.1916],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"8320\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8321, "epsg", 8321,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.75 +lon_0=-118.416666666667 +k=1.0"
+        "0019 +x_0=79999.99999968 +y_0=0 +ellps=GRS80 +units=ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Denio-Burns zone (ft)\",GE"
+        "OGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refe"
+        "rence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",41.75],PARAMETER[\"central_meridian\",-118.41666666"
+        "6667],PARAMETER[\"scale_factor\",1.00019],PARAMETER[\"fa"
+        "lse_easting\",262467.1916],PARAMETER[\"false_northing\","
+        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"8320\"]]"},
+    {8321, "epsg", 8321,
         "NAD83(2011) / Oregon Halfway zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.25 +lat_0=45.25 +lon_0=-117.25 +k_0=");
-    add_proj4text (p, 1,
-        "1.000085 +x_0=40000 +y_0=70000 +ellps=GRS80 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Halfway zone (m)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L");
-    add_srs_wkt (p, 7,
-        "ambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",45.25],PARAMETER[\"central_meridian\",-117.25],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",1.000085],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",40000],PARAMETER[\"false_northing\",70000],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"832");
-    add_srs_wkt (p, 13,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8322, "epsg", 8322,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.25 +lat_0=45.25 +lon_0=-117.25 +k_0="
+        "1.000085 +x_0=40000 +y_0=70000 +ellps=GRS80 +units=m +no"
+        "_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Halfway zone (m)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"L"
+        "ambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of_or"
+        "igin\",45.25],PARAMETER[\"central_meridian\",-117.25],PA"
+        "RAMETER[\"scale_factor\",1.000085],PARAMETER[\"false_eas"
+        "ting\",40000],PARAMETER[\"false_northing\",70000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"832"
+        "1\"]]"},
+    {8322, "epsg", 8322,
         "NAD83(2011) / Oregon Halfway zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.25 +lat_0=45.25 +lon_0=-117.25 +k_0=");
-    add_proj4text (p, 1,
-        "1.000085 +x_0=39999.99999984 +y_0=70000.00001496 +ellps=");
-    add_proj4text (p, 2,
-        "GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Halfway zone (ft)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",45.25],PARAMETER[\"central_meridian\",-117.25],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",1.000085],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",131233.5958],PARAMETER[\"false_northing\",229658");
-    add_srs_wkt (p, 11,
-        ".7927],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"8322\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8323, "epsg", 8323,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.25 +lat_0=45.25 +lon_0=-117.25 +k_0="
+        "1.000085 +x_0=39999.99999984 +y_0=70000.00001496 +ellps="
+        "GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Halfway zone (ft)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",45.25],PARAMETER[\"central_meridian\",-117.25],P"
+        "ARAMETER[\"scale_factor\",1.000085],PARAMETER[\"false_ea"
+        "sting\",131233.5958],PARAMETER[\"false_northing\",229658"
+        ".7927],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"8322\"]]"},
+    {8323, "epsg", 8323,
         "NAD83(2011) / Oregon Medford-Diamond Lake zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42 +lat_0=42 +lon_0=-122.25 +k_0=1.0000");
-    add_proj4text (p, 1,
-        "4 +x_0=60000 +y_0=-60000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Medford-Diamond Lake zone ");
-    add_srs_wkt (p, 1,
-        "(m)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spat");
-    add_srs_wkt (p, 2,
-        "ial_Reference_System_2011\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 3,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],");
-    add_srs_wkt (p, 7,
-        "PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",42],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-122.25],PARAMETER[\"scale_factor\",1.00004],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",60000],PARAMETER[\"false_northing\",-600");
-    add_srs_wkt (p, 11,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 12,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 13,
-        "PSG\",\"8323\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8324, "epsg", 8324,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42 +lat_0=42 +lon_0=-122.25 +k_0=1.0000"
+        "4 +x_0=60000 +y_0=-60000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Medford-Diamond Lake zone "
+        "(m)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spat"
+        "ial_Reference_System_2011\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],"
+        "PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\""
+        "latitude_of_origin\",42],PARAMETER[\"central_meridian\","
+        "-122.25],PARAMETER[\"scale_factor\",1.00004],PARAMETER[\""
+        "false_easting\",60000],PARAMETER[\"false_northing\",-600"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"8323\"]]"},
+    {8324, "epsg", 8324,
         "NAD83(2011) / Oregon Medford-Diamond Lake zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42 +lat_0=42 +lon_0=-122.25 +k_0=1.0000");
-    add_proj4text (p, 1,
-        "4 +x_0=59999.99999976 +y_0=-59999.99999976 +ellps=GRS80 ");
-    add_proj4text (p, 2,
-        "+units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Medford-Diamond Lake zone ");
-    add_srs_wkt (p, 1,
-        "(ft)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spa");
-    add_srs_wkt (p, 2,
-        "tial_Reference_System_2011\",SPHEROID[\"GRS 1980\",63781");
-    add_srs_wkt (p, 3,
-        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]]");
-    add_srs_wkt (p, 7,
-        ",PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",42],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-122.25],PARAMETER[\"scale_factor\",1.00004],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",196850.3937],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",-196850.3937],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"8324\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8325, "epsg", 8325,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42 +lat_0=42 +lon_0=-122.25 +k_0=1.0000"
+        "4 +x_0=59999.99999976 +y_0=-59999.99999976 +ellps=GRS80 "
+        "+units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Medford-Diamond Lake zone "
+        "(ft)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spa"
+        "tial_Reference_System_2011\",SPHEROID[\"GRS 1980\",63781"
+        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY"
+        "[\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]]"
+        ",PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\""
+        "latitude_of_origin\",42],PARAMETER[\"central_meridian\","
+        "-122.25],PARAMETER[\"scale_factor\",1.00004],PARAMETER[\""
+        "false_easting\",196850.3937],PARAMETER[\"false_northing\""
+        ",-196850.3937],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\""
+        "9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"8324\"]]"},
+    {8325, "epsg", 8325,
         "NAD83(2011) / Oregon Mitchell zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47 +lat_0=47 +lon_0=-120.25 +k_0=0.9992");
-    add_proj4text (p, 1,
-        "7 +x_0=30000 +y_0=290000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Mitchell zone (m)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",47],PARAMETER[\"central_meridian\",-120.25],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",0.99927],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 10,
-        "g\",30000],PARAMETER[\"false_northing\",290000],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8325");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8326, "epsg", 8326,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47 +lat_0=47 +lon_0=-120.25 +k_0=0.9992"
+        "7 +x_0=30000 +y_0=290000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Mitchell zone (m)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of_o"
+        "rigin\",47],PARAMETER[\"central_meridian\",-120.25],PARA"
+        "METER[\"scale_factor\",0.99927],PARAMETER[\"false_eastin"
+        "g\",30000],PARAMETER[\"false_northing\",290000],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8325"
+        "\"]]"},
+    {8326, "epsg", 8326,
         "NAD83(2011) / Oregon Mitchell zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=47 +lat_0=47 +lon_0=-120.25 +k_0=0.9992");
-    add_proj4text (p, 1,
-        "7 +x_0=30000.00001512 +y_0=290000.00001408 +ellps=GRS80 ");
-    add_proj4text (p, 2,
-        "+units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Mitchell zone (ft)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",47],PARAMETER[\"central_meridian\",-120.25],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",0.99927],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",98425.1969],PARAMETER[\"false_northing\",951443.56");
-    add_srs_wkt (p, 11,
-        "96],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"8326\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8327, "epsg", 8327,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=47 +lat_0=47 +lon_0=-120.25 +k_0=0.9992"
+        "7 +x_0=30000.00001512 +y_0=290000.00001408 +ellps=GRS80 "
+        "+units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Mitchell zone (ft)\",GEOGC"
+        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of"
+        "_origin\",47],PARAMETER[\"central_meridian\",-120.25],PA"
+        "RAMETER[\"scale_factor\",0.99927],PARAMETER[\"false_east"
+        "ing\",98425.1969],PARAMETER[\"false_northing\",951443.56"
+        "96],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"8326\"]]"},
+    {8327, "epsg", 8327,
         "NAD83(2011) / Oregon North Central zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.1666666666667 +lat_0=46.166666666666");
-    add_proj4text (p, 1,
-        "7 +lon_0=-120.5 +k_0=1 +x_0=100000 +y_0=140000 +ellps=GR");
-    add_proj4text (p, 2,
-        "S80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon North Central zone (m)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",46.1666666666667],PARAMETER[\"central_merid");
-    add_srs_wkt (p, 9,
-        "ian\",-120.5],PARAMETER[\"scale_factor\",1],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",100000],PARAMETER[\"false_northing\",140");
-    add_srs_wkt (p, 11,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 12,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"8327\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8328, "epsg", 8328,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.1666666666667 +lat_0=46.166666666666"
+        "7 +lon_0=-120.5 +k_0=1 +x_0=100000 +y_0=140000 +ellps=GR"
+        "S80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon North Central zone (m)\",G"
+        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude"
+        "_of_origin\",46.1666666666667],PARAMETER[\"central_merid"
+        "ian\",-120.5],PARAMETER[\"scale_factor\",1],PARAMETER[\""
+        "false_easting\",100000],PARAMETER[\"false_northing\",140"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"8327\"]]"},
+    {8328, "epsg", 8328,
         "NAD83(2011) / Oregon North Central zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.1666666666667 +lat_0=46.166666666666");
-    add_proj4text (p, 1,
-        "7 +lon_0=-120.5 +k_0=1 +x_0=99999.9999996 +y_0=139999.99");
-    add_proj4text (p, 2,
-        "999944 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon North Central zone (ft)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",46.1666666666667],PARAMETER[\"central_mer");
-    add_srs_wkt (p, 9,
-        "idian\",-120.5],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",328083.9895],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",459317.5853],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"8328\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8329, "epsg", 8329,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.1666666666667 +lat_0=46.166666666666"
+        "7 +lon_0=-120.5 +k_0=1 +x_0=99999.9999996 +y_0=139999.99"
+        "999944 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon North Central zone (ft)\","
+        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",46.1666666666667],PARAMETER[\"central_mer"
+        "idian\",-120.5],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",328083.9895],PARAMETER[\"false_northin"
+        "g\",459317.5853],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\""
+        ",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"8328\"]]"},
+    {8329, "epsg", 8329,
         "NAD83(2011) / Oregon Ochoco Summit zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.5 +lat_0=43.5 +lon_0=-120.5 +k_0=1.0");
-    add_proj4text (p, 1,
-        "0006 +x_0=40000 +y_0=-80000 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Ochoco Summit zone (m)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",43.5],PARAMETER[\"central_meridian\",-120.5");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1.00006],PARAMETER[\"false_");
-    add_srs_wkt (p, 10,
-        "easting\",40000],PARAMETER[\"false_northing\",-80000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"8329\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8330, "epsg", 8330,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.5 +lat_0=43.5 +lon_0=-120.5 +k_0=1.0"
+        "0006 +x_0=40000 +y_0=-80000 +ellps=GRS80 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / Oregon Ochoco Summit zone (m)\",G"
+        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude"
+        "_of_origin\",43.5],PARAMETER[\"central_meridian\",-120.5"
+        "],PARAMETER[\"scale_factor\",1.00006],PARAMETER[\"false_"
+        "easting\",40000],PARAMETER[\"false_northing\",-80000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"8329\"]]"},
+    {8330, "epsg", 8330,
         "NAD83(2011) / Oregon Ochoco Summit zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=43.5 +lat_0=43.5 +lon_0=-120.5 +k_0=1.0");
-    add_proj4text (p, 1,
-        "0006 +x_0=39999.99999984 +y_0=-79999.99999968 +ellps=GRS");
-    add_proj4text (p, 2,
-        "80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Ochoco Summit zone (ft)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",43.5],PARAMETER[\"central_meridian\",-120");
-    add_srs_wkt (p, 9,
-        ".5],PARAMETER[\"scale_factor\",1.00006],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",131233.5958],PARAMETER[\"false_northing\",-2");
-    add_srs_wkt (p, 11,
-        "62467.1916],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 12,
-        "02\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 13,
-        "UTHORITY[\"EPSG\",\"8330\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8331, "epsg", 8331,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=43.5 +lat_0=43.5 +lon_0=-120.5 +k_0=1.0"
+        "0006 +x_0=39999.99999984 +y_0=-79999.99999968 +ellps=GRS"
+        "80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Ochoco Summit zone (ft)\","
+        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",43.5],PARAMETER[\"central_meridian\",-120"
+        ".5],PARAMETER[\"scale_factor\",1.00006],PARAMETER[\"fals"
+        "e_easting\",131233.5958],PARAMETER[\"false_northing\",-2"
+        "62467.1916],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"90"
+        "02\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"8330\"]]"},
+    {8331, "epsg", 8331,
         "NAD83(2011) / Oregon Owyhee zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.75 +lon_0=-117.583333333333 +k=1.0");
-    add_proj4text (p, 1,
-        "0018 +x_0=70000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Owyhee zone (m)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41");
-    add_srs_wkt (p, 8,
-        ".75],PARAMETER[\"central_meridian\",-117.583333333333],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",1.00018],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",70000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 12,
-        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8331\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 8332, "epsg", 8332,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.75 +lon_0=-117.583333333333 +k=1.0"
+        "0018 +x_0=70000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Owyhee zone (m)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",41"
+        ".75],PARAMETER[\"central_meridian\",-117.583333333333],P"
+        "ARAMETER[\"scale_factor\",1.00018],PARAMETER[\"false_eas"
+        "ting\",70000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EA"
+        "ST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8331\""
+        "]]"},
+    {8332, "epsg", 8332,
         "NAD83(2011) / Oregon Owyhee zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.75 +lon_0=-117.583333333333 +k=1.0");
-    add_proj4text (p, 1,
-        "0018 +x_0=70000.00001496 +y_0=0 +ellps=GRS80 +units=ft +");
-    add_proj4text (p, 2,
-        "no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Owyhee zone (ft)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4");
-    add_srs_wkt (p, 8,
-        "1.75],PARAMETER[\"central_meridian\",-117.583333333333],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",1.00018],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 10,
-        "sting\",229658.7927],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 11,
-        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"E");
-    add_srs_wkt (p, 12,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 13,
-        "\",\"8332\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8333, "epsg", 8333,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.75 +lon_0=-117.583333333333 +k=1.0"
+        "0018 +x_0=70000.00001496 +y_0=0 +ellps=GRS80 +units=ft +"
+        "no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Owyhee zone (ft)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4"
+        "1.75],PARAMETER[\"central_meridian\",-117.583333333333],"
+        "PARAMETER[\"scale_factor\",1.00018],PARAMETER[\"false_ea"
+        "sting\",229658.7927],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"8332\"]]"},
+    {8333, "epsg", 8333,
         "NAD83(2011) / Oregon Pilot Rock-Ukiah zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.1666666666667 +lat_0=46.166666666666");
-    add_proj4text (p, 1,
-        "7 +lon_0=-119 +k_0=1.000025 +x_0=50000 +y_0=130000 +ellp");
-    add_proj4text (p, 2,
-        "s=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Pilot Rock-Ukiah zone (m)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",46.1666666666667],PARAMETER[\"central_me");
-    add_srs_wkt (p, 9,
-        "ridian\",-119],PARAMETER[\"scale_factor\",1.000025],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_easting\",50000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",130000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"8333\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8334, "epsg", 8334,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.1666666666667 +lat_0=46.166666666666"
+        "7 +lon_0=-119 +k_0=1.000025 +x_0=50000 +y_0=130000 +ellp"
+        "s=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Pilot Rock-Ukiah zone (m)\""
+        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",46.1666666666667],PARAMETER[\"central_me"
+        "ridian\",-119],PARAMETER[\"scale_factor\",1.000025],PARA"
+        "METER[\"false_easting\",50000],PARAMETER[\"false_northin"
+        "g\",130000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"8333\"]]"},
+    {8334, "epsg", 8334,
         "NAD83(2011) / Oregon Pilot Rock-Ukiah zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=46.1666666666667 +lat_0=46.166666666666");
-    add_proj4text (p, 1,
-        "7 +lon_0=-119 +k_0=1.000025 +x_0=50000.00001504 +y_0=130");
-    add_proj4text (p, 2,
-        "000.00001472 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Pilot Rock-Ukiah zone (ft)");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial");
-    add_srs_wkt (p, 2,
-        "_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,2");
-    add_srs_wkt (p, 3,
-        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 4,
-        "PSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",46.1666666666667],PARAMETER[\"central_");
-    add_srs_wkt (p, 9,
-        "meridian\",-119],PARAMETER[\"scale_factor\",1.000025],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_easting\",164041.9948],PARAMETER[\"false");
-    add_srs_wkt (p, 11,
-        "_northing\",426509.1864],UNIT[\"foot\",0.3048,AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 13,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"8334\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8335, "epsg", 8335,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=46.1666666666667 +lat_0=46.166666666666"
+        "7 +lon_0=-119 +k_0=1.000025 +x_0=50000.00001504 +y_0=130"
+        "000.00001472 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Pilot Rock-Ukiah zone (ft)"
+        "\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial"
+        "_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137,2"
+        "98.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"E"
+        "PSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PRO"
+        "JECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"lat"
+        "itude_of_origin\",46.1666666666667],PARAMETER[\"central_"
+        "meridian\",-119],PARAMETER[\"scale_factor\",1.000025],PA"
+        "RAMETER[\"false_easting\",164041.9948],PARAMETER[\"false"
+        "_northing\",426509.1864],UNIT[\"foot\",0.3048,AUTHORITY["
+        "\"EPSG\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"8334\"]]"},
+    {8335, "epsg", 8335,
         "NAD83(2011) / Oregon Prairie City-Brogan zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_0=44 +lon_0=-118 +k_0=1.00017 +");
-    add_proj4text (p, 1,
-        "x_0=60000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Prairie City-Brogan zone (");
-    add_srs_wkt (p, 1,
-        "m)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spati");
-    add_srs_wkt (p, 2,
-        "al_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137");
-    add_srs_wkt (p, 3,
-        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PR");
-    add_srs_wkt (p, 7,
-        "OJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"la");
-    add_srs_wkt (p, 8,
-        "titude_of_origin\",44],PARAMETER[\"central_meridian\",-1");
-    add_srs_wkt (p, 9,
-        "18],PARAMETER[\"scale_factor\",1.00017],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",60000],PARAMETER[\"false_northing\",0],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 12,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 13,
-        "335\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8336, "epsg", 8336,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_0=44 +lon_0=-118 +k_0=1.00017 +"
+        "x_0=60000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Prairie City-Brogan zone ("
+        "m)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spati"
+        "al_Reference_System_2011\",SPHEROID[\"GRS 1980\",6378137"
+        ",298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\""
+        "EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PR"
+        "OJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"la"
+        "titude_of_origin\",44],PARAMETER[\"central_meridian\",-1"
+        "18],PARAMETER[\"scale_factor\",1.00017],PARAMETER[\"fals"
+        "e_easting\",60000],PARAMETER[\"false_northing\",0],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8"
+        "335\"]]"},
+    {8336, "epsg", 8336,
         "NAD83(2011) / Oregon Prairie City-Brogan zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=44 +lat_0=44 +lon_0=-118 +k_0=1.00017 +");
-    add_proj4text (p, 1,
-        "x_0=59999.99999976 +y_0=0 +ellps=GRS80 +units=ft +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Prairie City-Brogan zone (");
-    add_srs_wkt (p, 1,
-        "ft)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spat");
-    add_srs_wkt (p, 2,
-        "ial_Reference_System_2011\",SPHEROID[\"GRS 1980\",637813");
-    add_srs_wkt (p, 3,
-        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],");
-    add_srs_wkt (p, 7,
-        "PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "latitude_of_origin\",44],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 9,
-        "-118],PARAMETER[\"scale_factor\",1.00017],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_easting\",196850.3937],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"8336\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8337, "epsg", 8337,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=44 +lat_0=44 +lon_0=-118 +k_0=1.00017 +"
+        "x_0=59999.99999976 +y_0=0 +ellps=GRS80 +units=ft +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / Oregon Prairie City-Brogan zone ("
+        "ft)\",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spat"
+        "ial_Reference_System_2011\",SPHEROID[\"GRS 1980\",637813"
+        "7,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY["
+        "\"EPSG\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"E"
+        "PSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTH"
+        "ORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],"
+        "PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\""
+        "latitude_of_origin\",44],PARAMETER[\"central_meridian\","
+        "-118],PARAMETER[\"scale_factor\",1.00017],PARAMETER[\"fa"
+        "lse_easting\",196850.3937],PARAMETER[\"false_northing\","
+        "0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"8336\"]]"},
+    {8337, "epsg", 8337,
         "NAD83(2011) / Oregon Riley-Lakeview zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.75 +lon_0=-120.333333333333 +k=1.0");
-    add_proj4text (p, 1,
-        "00215 +x_0=70000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Riley-Lakeview zone (m)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 8,
-        "igin\",41.75],PARAMETER[\"central_meridian\",-120.333333");
-    add_srs_wkt (p, 9,
-        "333333],PARAMETER[\"scale_factor\",1.000215],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",70000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 11,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 12,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"8337\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8338, "epsg", 8338,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.75 +lon_0=-120.333333333333 +k=1.0"
+        "00215 +x_0=70000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Riley-Lakeview zone (m)\","
+        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",41.75],PARAMETER[\"central_meridian\",-120.333333"
+        "333333],PARAMETER[\"scale_factor\",1.000215],PARAMETER[\""
+        "false_easting\",70000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"8337\"]]"},
+    {8338, "epsg", 8338,
         "NAD83(2011) / Oregon Riley-Lakeview zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=41.75 +lon_0=-120.333333333333 +k=1.0");
-    add_proj4text (p, 1,
-        "00215 +x_0=70000.00001496 +y_0=0 +ellps=GRS80 +units=ft ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Riley-Lakeview zone (ft)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",41.75],PARAMETER[\"central_meridian\",-120.33333");
-    add_srs_wkt (p, 9,
-        "3333333],PARAMETER[\"scale_factor\",1.000215],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_easting\",229658.7927],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 11,
-        "g\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"8338\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8339, "epsg", 8339,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=41.75 +lon_0=-120.333333333333 +k=1.0"
+        "00215 +x_0=70000.00001496 +y_0=0 +ellps=GRS80 +units=ft "
+        "+no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Riley-Lakeview zone (ft)\""
+        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",41.75],PARAMETER[\"central_meridian\",-120.33333"
+        "3333333],PARAMETER[\"scale_factor\",1.000215],PARAMETER["
+        "\"false_easting\",229658.7927],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"8338\"]]"},
+    {8339, "epsg", 8339,
         "NAD83(2011) / Oregon Siskiyou Pass zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.5 +lat_0=42.5 +lon_0=-122.5833333333");
-    add_proj4text (p, 1,
-        "33 +k_0=1.00015 +x_0=10000 +y_0=60000 +ellps=GRS80 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Siskiyou Pass zone (m)\",G");
-    add_srs_wkt (p, 1,
-        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref");
-    add_srs_wkt (p, 2,
-        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 3,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI");
-    add_srs_wkt (p, 7,
-        "ON[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 8,
-        "_of_origin\",42.5],PARAMETER[\"central_meridian\",-122.5");
-    add_srs_wkt (p, 9,
-        "83333333333],PARAMETER[\"scale_factor\",1.00015],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_easting\",10000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 11,
-        ",60000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"8339\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8340, "epsg", 8340,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.5 +lat_0=42.5 +lon_0=-122.5833333333"
+        "33 +k_0=1.00015 +x_0=10000 +y_0=60000 +ellps=GRS80 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Siskiyou Pass zone (m)\",G"
+        "EOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Ref"
+        "erence_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTI"
+        "ON[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude"
+        "_of_origin\",42.5],PARAMETER[\"central_meridian\",-122.5"
+        "83333333333],PARAMETER[\"scale_factor\",1.00015],PARAMET"
+        "ER[\"false_easting\",10000],PARAMETER[\"false_northing\""
+        ",60000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"8339\"]]"},
+    {8340, "epsg", 8340,
         "NAD83(2011) / Oregon Siskiyou Pass zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.5 +lat_0=42.5 +lon_0=-122.5833333333");
-    add_proj4text (p, 1,
-        "33 +k_0=1.00015 +x_0=10000.0000152 +y_0=59999.99999976 +");
-    add_proj4text (p, 2,
-        "ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Siskiyou Pass zone (ft)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",42.5],PARAMETER[\"central_meridian\",-122");
-    add_srs_wkt (p, 9,
-        ".583333333333],PARAMETER[\"scale_factor\",1.00015],PARAM");
-    add_srs_wkt (p, 10,
-        "ETER[\"false_easting\",32808.399],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 11,
-        "hing\",196850.3937],UNIT[\"foot\",0.3048,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 13,
-        "NORTH],AUTHORITY[\"EPSG\",\"8340\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8341, "epsg", 8341,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.5 +lat_0=42.5 +lon_0=-122.5833333333"
+        "33 +k_0=1.00015 +x_0=10000.0000152 +y_0=59999.99999976 +"
+        "ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Siskiyou Pass zone (ft)\","
+        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",42.5],PARAMETER[\"central_meridian\",-122"
+        ".583333333333],PARAMETER[\"scale_factor\",1.00015],PARAM"
+        "ETER[\"false_easting\",32808.399],PARAMETER[\"false_nort"
+        "hing\",196850.3937],UNIT[\"foot\",0.3048,AUTHORITY[\"EPS"
+        "G\",\"9002\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"8340\"]]"},
+    {8341, "epsg", 8341,
         "NAD83(2011) / Oregon Ukiah-Fox zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.25 +lat_0=45.25 +lon_0=-119 +k_0=1.0");
-    add_proj4text (p, 1,
-        "0014 +x_0=30000 +y_0=90000 +ellps=GRS80 +units=m +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Ukiah-Fox zone (m)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen");
-    add_srs_wkt (p, 2,
-        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722");
-    add_srs_wkt (p, 3,
-        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",45.25],PARAMETER[\"central_meridian\",-119],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",1.00014],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",30000],PARAMETER[\"false_northing\",90000],UNIT[\"");
-    add_srs_wkt (p, 11,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"834");
-    add_srs_wkt (p, 13,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8342, "epsg", 8342,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.25 +lat_0=45.25 +lon_0=-119 +k_0=1.0"
+        "0014 +x_0=30000 +y_0=90000 +ellps=GRS80 +units=m +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / Oregon Ukiah-Fox zone (m)\",GEOGC"
+        "S[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referen"
+        "ce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.25722"
+        "2101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of"
+        "_origin\",45.25],PARAMETER[\"central_meridian\",-119],PA"
+        "RAMETER[\"scale_factor\",1.00014],PARAMETER[\"false_east"
+        "ing\",30000],PARAMETER[\"false_northing\",90000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"834"
+        "1\"]]"},
+    {8342, "epsg", 8342,
         "NAD83(2011) / Oregon Ukiah-Fox zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=45.25 +lat_0=45.25 +lon_0=-119 +k_0=1.0");
-    add_proj4text (p, 1,
-        "0014 +x_0=30000.00001512 +y_0=90000.00001488 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Ukiah-Fox zone (ft)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 8,
-        "_origin\",45.25],PARAMETER[\"central_meridian\",-119],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",1.00014],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",98425.1969],PARAMETER[\"false_northing\",295275.59");
-    add_srs_wkt (p, 11,
-        "06],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"8342\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8343, "epsg", 8343,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=45.25 +lat_0=45.25 +lon_0=-119 +k_0=1.0"
+        "0014 +x_0=30000.00001512 +y_0=90000.00001488 +ellps=GRS8"
+        "0 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Ukiah-Fox zone (ft)\",GEOG"
+        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere"
+        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitude_of"
+        "_origin\",45.25],PARAMETER[\"central_meridian\",-119],PA"
+        "RAMETER[\"scale_factor\",1.00014],PARAMETER[\"false_east"
+        "ing\",98425.1969],PARAMETER[\"false_northing\",295275.59"
+        "06],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"8342\"]]"},
+    {8343, "epsg", 8343,
         "NAD83(2011) / Oregon Wallowa zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=45.25 +lon_0=-117.5 +k=1.000195 +x_0=");
-    add_proj4text (p, 1,
-        "60000 +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Wallowa zone (m)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4");
-    add_srs_wkt (p, 8,
-        "5.25],PARAMETER[\"central_meridian\",-117.5],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",1.000195],PARAMETER[\"false_easting\",600");
-    add_srs_wkt (p, 10,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 11,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"8343\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8344, "epsg", 8344,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=45.25 +lon_0=-117.5 +k=1.000195 +x_0="
+        "60000 +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Wallowa zone (m)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",4"
+        "5.25],PARAMETER[\"central_meridian\",-117.5],PARAMETER[\""
+        "scale_factor\",1.000195],PARAMETER[\"false_easting\",600"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"8343\"]]"},
+    {8344, "epsg", 8344,
         "NAD83(2011) / Oregon Wallowa zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=45.25 +lon_0=-117.5 +k=1.000195 +x_0=");
-    add_proj4text (p, 1,
-        "59999.99999976 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Wallowa zone (ft)\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc");
-    add_srs_wkt (p, 2,
-        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 3,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 4,
-        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 5,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 6,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"");
-    add_srs_wkt (p, 7,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 8,
-        "45.25],PARAMETER[\"central_meridian\",-117.5],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"scale_factor\",1.000195],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "96850.3937],PARAMETER[\"false_northing\",0],UNIT[\"foot\"");
-    add_srs_wkt (p, 11,
-        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E");
-    add_srs_wkt (p, 12,
-        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8344\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 8345, "epsg", 8345,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=45.25 +lon_0=-117.5 +k=1.000195 +x_0="
+        "59999.99999976 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Wallowa zone (ft)\",GEOGCS"
+        "[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Referenc"
+        "e_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "45.25],PARAMETER[\"central_meridian\",-117.5],PARAMETER["
+        "\"scale_factor\",1.000195],PARAMETER[\"false_easting\",1"
+        "96850.3937],PARAMETER[\"false_northing\",0],UNIT[\"foot\""
+        ",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\",E"
+        "AST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8344\""
+        "]]"},
+    {8345, "epsg", 8345,
         "NAD83(2011) / Oregon Warner Highway zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.5 +lat_0=42.5 +lon_0=-120 +k_0=1.000");
-    add_proj4text (p, 1,
-        "245 +x_0=40000 +y_0=60000 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Warner Highway zone (m)\",");
-    add_srs_wkt (p, 1,
-        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re");
-    add_srs_wkt (p, 2,
-        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 3,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 6,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC");
-    add_srs_wkt (p, 7,
-        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_origin\",42.5],PARAMETER[\"central_meridian\",-120");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1.000245],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_easting\",40000],PARAMETER[\"false_northing\",60000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"8345\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8346, "epsg", 8346,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.5 +lat_0=42.5 +lon_0=-120 +k_0=1.000"
+        "245 +x_0=40000 +y_0=60000 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Warner Highway zone (m)\","
+        "GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Re"
+        "ference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",42.5],PARAMETER[\"central_meridian\",-120"
+        "],PARAMETER[\"scale_factor\",1.000245],PARAMETER[\"false"
+        "_easting\",40000],PARAMETER[\"false_northing\",60000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"8345\"]]"},
+    {8346, "epsg", 8346,
         "NAD83(2011) / Oregon Warner Highway zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=42.5 +lat_0=42.5 +lon_0=-120 +k_0=1.000");
-    add_proj4text (p, 1,
-        "245 +x_0=39999.99999984 +y_0=59999.99999976 +ellps=GRS80");
-    add_proj4text (p, 2,
-        " +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Warner Highway zone (ft)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 8,
-        "ude_of_origin\",42.5],PARAMETER[\"central_meridian\",-12");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"scale_factor\",1.000245],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_easting\",131233.5958],PARAMETER[\"false_northing\",19");
-    add_srs_wkt (p, 11,
-        "6850.3937],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 12,
-        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 13,
-        "THORITY[\"EPSG\",\"8346\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8347, "epsg", 8347,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=42.5 +lat_0=42.5 +lon_0=-120 +k_0=1.000"
+        "245 +x_0=39999.99999984 +y_0=59999.99999976 +ellps=GRS80"
+        " +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Warner Highway zone (ft)\""
+        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE"
+        "CTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER[\"latit"
+        "ude_of_origin\",42.5],PARAMETER[\"central_meridian\",-12"
+        "0],PARAMETER[\"scale_factor\",1.000245],PARAMETER[\"fals"
+        "e_easting\",131233.5958],PARAMETER[\"false_northing\",19"
+        "6850.3937],UNIT[\"foot\",0.3048,AUTHORITY[\"EPSG\",\"900"
+        "2\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"8346\"]]"},
+    {8347, "epsg", 8347,
         "NAD83(2011) / Oregon Willamette Pass zone (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43 +lon_0=-122 +k=1.000223 +x_0=20000");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Willamette Pass zone (m)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",43],PARAMETER[\"central_meridian\",-122],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",1.000223],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",20000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1");
-    add_srs_wkt (p, 11,
-        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8347\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8348, "epsg", 8348,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43 +lon_0=-122 +k=1.000223 +x_0=20000"
+        " +y_0=0 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Willamette Pass zone (m)\""
+        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",43],PARAMETER[\"central_meridian\",-122],PARAMET"
+        "ER[\"scale_factor\",1.000223],PARAMETER[\"false_easting\""
+        ",20000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1"
+        ",AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AX"
+        "IS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8347\"]]"},
+    {8348, "epsg", 8348,
         "NAD83(2011) / Oregon Willamette Pass zone (ft)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=43 +lon_0=-122 +k=1.000223 +x_0=19999");
-    add_proj4text (p, 1,
-        ".99999992 +y_0=0 +ellps=GRS80 +units=ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / Oregon Willamette Pass zone (ft)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R");
-    add_srs_wkt (p, 2,
-        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",43],PARAMETER[\"central_meridian\",-122],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"scale_factor\",1.000223],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",65616.7979],PARAMETER[\"false_northing\",0],UNIT[\"foot");
-    add_srs_wkt (p, 11,
-        "\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"834");
-    add_srs_wkt (p, 13,
-        "8\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8349, "epsg", 8349,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=43 +lon_0=-122 +k=1.000223 +x_0=19999"
+        ".99999992 +y_0=0 +ellps=GRS80 +units=ft +no_defs",
+        "PROJCS[\"NAD83(2011) / Oregon Willamette Pass zone (ft)\""
+        ",GEOGCS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_R"
+        "eference_System_2011\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",43],PARAMETER[\"central_meridian\",-122],PARAMET"
+        "ER[\"scale_factor\",1.000223],PARAMETER[\"false_easting\""
+        ",65616.7979],PARAMETER[\"false_northing\",0],UNIT[\"foot"
+        "\",0.3048,AUTHORITY[\"EPSG\",\"9002\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"834"
+        "8\"]]"},
+    {8349, "epsg", 8349,
         "GR96", 1, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid");
-    add_proj4text (p, 1,
-        "grids=dk_sdfe_gvr2000.tif +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"GR96 + GVR2000 height\",GEOGCS[\"GR96\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Greenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 2,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4747\"]],VERT_CS[\"GVR2");
-    add_srs_wkt (p, 7,
-        "000 height\",VERT_DATUM[\"Greenland  Vertical Reference ");
-    add_srs_wkt (p, 8,
-        "2000\",2005,AUTHORITY[\"EPSG\",\"1199\"]],UNIT[\"metre\"");
-    add_srs_wkt (p, 9,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related ");
-    add_srs_wkt (p, 10,
-        "height\",UP],AUTHORITY[\"EPSG\",\"8266\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"8349\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8350, "epsg", 8350,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid"
+        "grids=dk_sdfe_gvr2000.tif +vunits=m +no_defs",
+        "COMPD_CS[\"GR96 + GVR2000 height\",GEOGCS[\"GR96\",DATUM"
+        "[\"Greenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit"
+        "ude\",EAST],AUTHORITY[\"EPSG\",\"4747\"]],VERT_CS[\"GVR2"
+        "000 height\",VERT_DATUM[\"Greenland  Vertical Reference "
+        "2000\",2005,AUTHORITY[\"EPSG\",\"1199\"]],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related "
+        "height\",UP],AUTHORITY[\"EPSG\",\"8266\"]],AUTHORITY[\"E"
+        "PSG\",\"8349\"]]"},
+    {8350, "epsg", 8350,
         "GR96", 1, 0,
         "GRS 1980", "Greenwich",
         "Greenland_1996", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid");
-    add_proj4text (p, 1,
-        "grids=dk_sdfe_gvr2016.tif +vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"GR96 + GVR2016 height\",GEOGCS[\"GR96\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Greenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.25");
-    add_srs_wkt (p, 2,
-        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"4747\"]],VERT_CS[\"GVR2");
-    add_srs_wkt (p, 7,
-        "016 height\",VERT_DATUM[\"Greenland Vertical Reference 2");
-    add_srs_wkt (p, 8,
-        "016\",2005,AUTHORITY[\"EPSG\",\"1200\"]],UNIT[\"metre\",");
-    add_srs_wkt (p, 9,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related h");
-    add_srs_wkt (p, 10,
-        "eight\",UP],AUTHORITY[\"EPSG\",\"8267\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"8350\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8351, "epsg", 8351,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +geoid"
+        "grids=dk_sdfe_gvr2016.tif +vunits=m +no_defs",
+        "COMPD_CS[\"GR96 + GVR2016 height\",GEOGCS[\"GR96\",DATUM"
+        "[\"Greenland_1996\",SPHEROID[\"GRS 1980\",6378137,298.25"
+        "7222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"6747\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit"
+        "ude\",EAST],AUTHORITY[\"EPSG\",\"4747\"]],VERT_CS[\"GVR2"
+        "016 height\",VERT_DATUM[\"Greenland Vertical Reference 2"
+        "016\",2005,AUTHORITY[\"EPSG\",\"1200\"]],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-related h"
+        "eight\",UP],AUTHORITY[\"EPSG\",\"8267\"]],AUTHORITY[\"EP"
+        "SG\",\"8350\"]]"},
+    {8351, "epsg", 8351,
         "S-JTSK [JTSK03]", 1, 1,
         "Bessel 1841", "Greenwich",
         "System_of_the_Unified_Trigonometrical_Cadastral_Network_JTSK03", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=485.021,169.465,483");
-    add_proj4text (p, 1,
-        ".839,7.786342,4.397554,4.102655,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"S-JTSK [JTSK03]\",DATUM[\"System_of_the_Unified");
-    add_srs_wkt (p, 1,
-        "_Trigonometrical_Cadastral_Network_JTSK03\",SPHEROID[\"B");
-    add_srs_wkt (p, 2,
-        "essel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7004\"]],AUTHORITY[\"EPSG\",\"1201\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La");
-    add_srs_wkt (p, 6,
-        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 7,
-        "G\",\"8351\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8352, "epsg", 8352,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=485.021,169.465,483"
+        ".839,7.786342,4.397554,4.102655,0 +no_defs",
+        "GEOGCS[\"S-JTSK [JTSK03]\",DATUM[\"System_of_the_Unified"
+        "_Trigonometrical_Cadastral_Network_JTSK03\",SPHEROID[\"B"
+        "essel 1841\",6377397.155,299.1528128,AUTHORITY[\"EPSG\","
+        "\"7004\"]],AUTHORITY[\"EPSG\",\"1201\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"La"
+        "titude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPS"
+        "G\",\"8351\"]]"},
+    {8352, "epsg", 8352,
         "S-JTSK [JTSK03] / Krovak", 0, 0,
         "Bessel 1841", "Greenwich",
         "System_of_the_Unified_Trigonometrical_Cadastral_Network_JTSK03", "Krovak", "metre",
-        "Southing", "South", "Westing", "West");
-    add_proj4text (p, 0,
-        "+proj=krovak +axis=swu +lat_0=49.5 +lon_0=24.83333333333");
-    add_proj4text (p, 1,
-        "33 +alpha=30.2881397527778 +k=0.9999 +x_0=0 +y_0=0 +ellp");
-    add_proj4text (p, 2,
-        "s=bessel +towgs84=485.021,169.465,483.839,7.786342,4.397");
-    add_proj4text (p, 3,
-        "554,4.102655,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"S-JTSK [JTSK03] / Krovak\",GEOGCS[\"S-JTSK [JTS");
-    add_srs_wkt (p, 1,
-        "K03]\",DATUM[\"System_of_the_Unified_Trigonometrical_Cad");
-    add_srs_wkt (p, 2,
-        "astral_Network_JTSK03\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 3,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"1201\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8351\"]]");
-    add_srs_wkt (p, 7,
-        ",PROJECTION[\"Krovak\"],PARAMETER[\"latitude_of_center\"");
-    add_srs_wkt (p, 8,
-        ",49.5],PARAMETER[\"longitude_of_center\",24.833333333333");
-    add_srs_wkt (p, 9,
-        "3],PARAMETER[\"azimuth\",30.2881397527778],PARAMETER[\"p");
-    add_srs_wkt (p, 10,
-        "seudo_standard_parallel_1\",78.5],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 11,
-        "or\",0.9999],PARAMETER[\"false_easting\",0],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"9001\"]],AXIS[\"Southing\",SOUTH],AXIS[\"Westing\",WES");
-    add_srs_wkt (p, 14,
-        "T],AUTHORITY[\"EPSG\",\"8352\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8353, "epsg", 8353,
+        "Southing", "South", "Westing", "West",
+        "+proj=krovak +axis=swu +lat_0=49.5 +lon_0=24.83333333333"
+        "33 +alpha=30.2881397527778 +k=0.9999 +x_0=0 +y_0=0 +ellp"
+        "s=bessel +towgs84=485.021,169.465,483.839,7.786342,4.397"
+        "554,4.102655,0 +units=m +no_defs",
+        "PROJCS[\"S-JTSK [JTSK03] / Krovak\",GEOGCS[\"S-JTSK [JTS"
+        "K03]\",DATUM[\"System_of_the_Unified_Trigonometrical_Cad"
+        "astral_Network_JTSK03\",SPHEROID[\"Bessel 1841\",6377397"
+        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY"
+        "[\"EPSG\",\"1201\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8351\"]]"
+        ",PROJECTION[\"Krovak\"],PARAMETER[\"latitude_of_center\""
+        ",49.5],PARAMETER[\"longitude_of_center\",24.833333333333"
+        "3],PARAMETER[\"azimuth\",30.2881397527778],PARAMETER[\"p"
+        "seudo_standard_parallel_1\",78.5],PARAMETER[\"scale_fact"
+        "or\",0.9999],PARAMETER[\"false_easting\",0],PARAMETER[\""
+        "false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Southing\",SOUTH],AXIS[\"Westing\",WES"
+        "T],AUTHORITY[\"EPSG\",\"8352\"]]"},
+    {8353, "epsg", 8353,
         "S-JTSK [JTSK03] / Krovak East North", 0, 0,
         "Bessel 1841", "Greenwich",
         "System_of_the_Unified_Trigonometrical_Cadastral_Network_JTSK03", "Krovak", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=krovak +lat_0=49.5 +lon_0=24.8333333333333 +alpha=");
-    add_proj4text (p, 1,
-        "30.2881397527778 +k=0.9999 +x_0=0 +y_0=0 +ellps=bessel +");
-    add_proj4text (p, 2,
-        "towgs84=485.021,169.465,483.839,7.786342,4.397554,4.1026");
-    add_proj4text (p, 3,
-        "55,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"S-JTSK [JTSK03] / Krovak East North\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "S-JTSK [JTSK03]\",DATUM[\"System_of_the_Unified_Trigonom");
-    add_srs_wkt (p, 2,
-        "etrical_Cadastral_Network_JTSK03\",SPHEROID[\"Bessel 184");
-    add_srs_wkt (p, 3,
-        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]");
-    add_srs_wkt (p, 4,
-        "],AUTHORITY[\"EPSG\",\"1201\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 6,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"8351\"]],PROJECTION[\"Krovak\"],PARAMETER[\"latitude_");
-    add_srs_wkt (p, 8,
-        "of_center\",49.5],PARAMETER[\"longitude_of_center\",24.8");
-    add_srs_wkt (p, 9,
-        "333333333333],PARAMETER[\"azimuth\",30.2881397527778],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"pseudo_standard_parallel_1\",78.5],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "scale_factor\",0.9999],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 12,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 14,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"8353\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8360, "epsg", 8360,
+        "Easting", "East", "Northing", "North",
+        "+proj=krovak +lat_0=49.5 +lon_0=24.8333333333333 +alpha="
+        "30.2881397527778 +k=0.9999 +x_0=0 +y_0=0 +ellps=bessel +"
+        "towgs84=485.021,169.465,483.839,7.786342,4.397554,4.1026"
+        "55,0 +units=m +no_defs",
+        "PROJCS[\"S-JTSK [JTSK03] / Krovak East North\",GEOGCS[\""
+        "S-JTSK [JTSK03]\",DATUM[\"System_of_the_Unified_Trigonom"
+        "etrical_Cadastral_Network_JTSK03\",SPHEROID[\"Bessel 184"
+        "1\",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]"
+        "],AUTHORITY[\"EPSG\",\"1201\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"8351\"]],PROJECTION[\"Krovak\"],PARAMETER[\"latitude_"
+        "of_center\",49.5],PARAMETER[\"longitude_of_center\",24.8"
+        "333333333333],PARAMETER[\"azimuth\",30.2881397527778],PA"
+        "RAMETER[\"pseudo_standard_parallel_1\",78.5],PARAMETER[\""
+        "scale_factor\",0.9999],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"8353\"]]"},
+    {8360, "epsg", 8360,
         "ETRS89", 1, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 + Baltic 1957 height\",GEOGCS[\"ETRS89");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"European_Terrestrial_Reference_System_1989\",");
-    add_srs_wkt (p, 2,
-        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 6,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 7,
-        "[\"EPSG\",\"4258\"]],VERT_CS[\"Baltic 1957 height\",VERT");
-    add_srs_wkt (p, 8,
-        "_DATUM[\"Baltic 1957\",2005,AUTHORITY[\"EPSG\",\"1202\"]");
-    add_srs_wkt (p, 9,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 10,
-        "Gravity-related height\",UP],AUTHORITY[\"EPSG\",\"8357\"");
-    add_srs_wkt (p, 11,
-        "]],AUTHORITY[\"EPSG\",\"8360\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8370, "epsg", 8370,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit"
+        "s=m +no_defs",
+        "COMPD_CS[\"ETRS89 + Baltic 1957 height\",GEOGCS[\"ETRS89"
+        "\",DATUM[\"European_Terrestrial_Reference_System_1989\","
+        "SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"4258\"]],VERT_CS[\"Baltic 1957 height\",VERT"
+        "_DATUM[\"Baltic 1957\",2005,AUTHORITY[\"EPSG\",\"1202\"]"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Gravity-related height\",UP],AUTHORITY[\"EPSG\",\"8357\""
+        "]],AUTHORITY[\"EPSG\",\"8360\"]]"},
+    {8370, "epsg", 8370,
         "ETRS89 / Belgian Lambert 2008", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_0=50.797815 +lon_0=4.35921583333333 +lat_");
-    add_proj4text (p, 1,
-        "1=49.8333333333333 +lat_2=51.1666666666667 +x_0=649328 +");
-    add_proj4text (p, 2,
-        "y_0=665262 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 3,
-        "+vunits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 / Belgian Lambert 2008 + Ostend height");
-    add_srs_wkt (p, 1,
-        "\",PROJCS[\"ETRS89 / Belgian Lambert 2008\",GEOGCS[\"ETR");
-    add_srs_wkt (p, 2,
-        "S89\",DATUM[\"European_Terrestrial_Reference_System_1989");
-    add_srs_wkt (p, 3,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIME");
-    add_srs_wkt (p, 5,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 6,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 7,
-        ",AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conf");
-    add_srs_wkt (p, 8,
-        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",50.7");
-    add_srs_wkt (p, 9,
-        "97815],PARAMETER[\"central_meridian\",4.35921583333333],");
-    add_srs_wkt (p, 10,
-        "PARAMETER[\"standard_parallel_1\",49.8333333333333],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"standard_parallel_2\",51.1666666666667],PARAMETE");
-    add_srs_wkt (p, 12,
-        "R[\"false_easting\",649328],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 13,
-        ",665262],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 15,
-        "Y[\"EPSG\",\"3812\"]],VERT_CS[\"Ostend height\",VERT_DAT");
-    add_srs_wkt (p, 16,
-        "UM[\"Ostend\",2005,AUTHORITY[\"EPSG\",\"5110\"]],UNIT[\"");
-    add_srs_wkt (p, 17,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-r");
-    add_srs_wkt (p, 18,
-        "elated height\",UP],AUTHORITY[\"EPSG\",\"5710\"]],AUTHOR");
-    add_srs_wkt (p, 19,
-        "ITY[\"EPSG\",\"8370\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8379, "epsg", 8379,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_0=50.797815 +lon_0=4.35921583333333 +lat_"
+        "1=49.8333333333333 +lat_2=51.1666666666667 +x_0=649328 +"
+        "y_0=665262 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+vunits=m +no_defs",
+        "COMPD_CS[\"ETRS89 / Belgian Lambert 2008 + Ostend height"
+        "\",PROJCS[\"ETRS89 / Belgian Lambert 2008\",GEOGCS[\"ETR"
+        "S89\",DATUM[\"European_Terrestrial_Reference_System_1989"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Lambert_Conf"
+        "ormal_Conic_2SP\"],PARAMETER[\"latitude_of_origin\",50.7"
+        "97815],PARAMETER[\"central_meridian\",4.35921583333333],"
+        "PARAMETER[\"standard_parallel_1\",49.8333333333333],PARA"
+        "METER[\"standard_parallel_2\",51.1666666666667],PARAMETE"
+        "R[\"false_easting\",649328],PARAMETER[\"false_northing\""
+        ",665262],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"3812\"]],VERT_CS[\"Ostend height\",VERT_DAT"
+        "UM[\"Ostend\",2005,AUTHORITY[\"EPSG\",\"5110\"]],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravity-r"
+        "elated height\",UP],AUTHORITY[\"EPSG\",\"5710\"]],AUTHOR"
+        "ITY[\"EPSG\",\"8370\"]]"},
+    {8379, "epsg", 8379,
         "NAD83 / NCRS Las Vegas (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "001 +x_0=100000 +y_0=200000 +datum=NAD83 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / NCRS Las Vegas (m)\",GEOGCS[\"NAD83\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\"");
-    add_srs_wkt (p, 2,
-        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",36.25],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-114.966666666667],PARAMETER[\"scale_factor\",1.0001],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_easting\",100000],PARAMETER[\"false_nor");
-    add_srs_wkt (p, 10,
-        "thing\",200000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 11,
-        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"8379\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8380, "epsg", 8380,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0"
+        "001 +x_0=100000 +y_0=200000 +datum=NAD83 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83 / NCRS Las Vegas (m)\",GEOGCS[\"NAD83\",D"
+        "ATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980\""
+        ",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUT"
+        "HORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "69\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",36.25],PARAMETER[\"central_meridian\""
+        ",-114.966666666667],PARAMETER[\"scale_factor\",1.0001],P"
+        "ARAMETER[\"false_easting\",100000],PARAMETER[\"false_nor"
+        "thing\",200000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90"
+        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"8379\"]]"},
+    {8380, "epsg", 8380,
         "NAD83 / NCRS Las Vegas (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "001 +x_0=99999.99998984 +y_0=200000.00001016 +datum=NAD8");
-    add_proj4text (p, 2,
-        "3 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / NCRS Las Vegas (ftUS)\",GEOGCS[\"NAD83\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",36.25],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-114.966666666667],PARAMETER[\"scale_factor\",1.0001]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",328083.3333],PARAMETER[\"fa");
-    add_srs_wkt (p, 10,
-        "lse_northing\",656166.6667],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 11,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "8380\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8381, "epsg", 8381,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0"
+        "001 +x_0=99999.99998984 +y_0=200000.00001016 +datum=NAD8"
+        "3 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83 / NCRS Las Vegas (ftUS)\",GEOGCS[\"NAD83\""
+        ",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",36.25],PARAMETER[\"central_meridian"
+        "\",-114.966666666667],PARAMETER[\"scale_factor\",1.0001]"
+        ",PARAMETER[\"false_easting\",328083.3333],PARAMETER[\"fa"
+        "lse_northing\",656166.6667],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "8380\"]]"},
+    {8381, "epsg", 8381,
         "NAD83 / NCRS Las Vegas high (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "00135 +x_0=300000 +y_0=400000 +datum=NAD83 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / NCRS Las Vegas high (m)\",GEOGCS[\"NAD8");
-    add_srs_wkt (p, 1,
-        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1");
-    add_srs_wkt (p, 2,
-        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",36.25],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",-114.966666666667],PARAMETER[\"scale_factor\",1.0");
-    add_srs_wkt (p, 9,
-        "00135],PARAMETER[\"false_easting\",300000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",400000],UNIT[\"metre\",1,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 11,
-        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AUTHORITY[\"EPSG\",\"8381\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8382, "epsg", 8382,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0"
+        "00135 +x_0=300000 +y_0=400000 +datum=NAD83 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83 / NCRS Las Vegas high (m)\",GEOGCS[\"NAD8"
+        "3\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GRS 1"
+        "980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]"
+        "],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",36.25],PARAMETER[\"central_meri"
+        "dian\",-114.966666666667],PARAMETER[\"scale_factor\",1.0"
+        "00135],PARAMETER[\"false_easting\",300000],PARAMETER[\"f"
+        "alse_northing\",400000],UNIT[\"metre\",1,AUTHORITY[\"EPS"
+        "G\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"8381\"]]"},
+    {8382, "epsg", 8382,
         "NAD83 / NCRS Las Vegas high (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "North_American_Datum_1983", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "00135 +x_0=300000 +y_0=399999.99998984 +datum=NAD83 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83 / NCRS Las Vegas high (ftUS)\",GEOGCS[\"N");
-    add_srs_wkt (p, 1,
-        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR");
-    add_srs_wkt (p, 2,
-        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019");
-    add_srs_wkt (p, 3,
-        "\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 4,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 5,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAM");
-    add_srs_wkt (p, 7,
-        "ETER[\"latitude_of_origin\",36.25],PARAMETER[\"central_m");
-    add_srs_wkt (p, 8,
-        "eridian\",-114.966666666667],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "1.000135],PARAMETER[\"false_easting\",984250],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_northing\",1312333.3333],UNIT[\"US survey foot\"");
-    add_srs_wkt (p, 11,
-        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"8382\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8383, "epsg", 8383,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0"
+        "00135 +x_0=300000 +y_0=399999.99998984 +datum=NAD83 +uni"
+        "ts=us-ft +no_defs",
+        "PROJCS[\"NAD83 / NCRS Las Vegas high (ftUS)\",GEOGCS[\"N"
+        "AD83\",DATUM[\"North_American_Datum_1983\",SPHEROID[\"GR"
+        "S 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019"
+        "\"]],AUTHORITY[\"EPSG\",\"6269\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPS"
+        "G\",\"4269\"]],PROJECTION[\"Transverse_Mercator\"],PARAM"
+        "ETER[\"latitude_of_origin\",36.25],PARAMETER[\"central_m"
+        "eridian\",-114.966666666667],PARAMETER[\"scale_factor\","
+        "1.000135],PARAMETER[\"false_easting\",984250],PARAMETER["
+        "\"false_northing\",1312333.3333],UNIT[\"US survey foot\""
+        ",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"8382\"]]"},
+    {8383, "epsg", 8383,
         "NAD83(2011) / NCRS Las Vegas (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "001 +x_0=100000 +y_0=200000 +ellps=GRS80 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / NCRS Las Vegas (m)\",GEOGCS[\"NAD");
-    add_srs_wkt (p, 1,
-        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst");
-    add_srs_wkt (p, 2,
-        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]");
-    add_srs_wkt (p, 4,
-        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U");
-    add_srs_wkt (p, 5,
-        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Trans");
-    add_srs_wkt (p, 7,
-        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",36.25");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"central_meridian\",-114.966666666667],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"scale_factor\",1.0001],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 10,
-        "\",100000],PARAMETER[\"false_northing\",200000],UNIT[\"m");
-    add_srs_wkt (p, 11,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8383");
-    add_srs_wkt (p, 13,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8384, "epsg", 8384,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0"
+        "001 +x_0=100000 +y_0=200000 +ellps=GRS80 +units=m +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / NCRS Las Vegas (m)\",GEOGCS[\"NAD"
+        "83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_Syst"
+        "em_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AU"
+        "THORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]"
+        "],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],U"
+        "NIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9"
+        "122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Trans"
+        "verse_Mercator\"],PARAMETER[\"latitude_of_origin\",36.25"
+        "],PARAMETER[\"central_meridian\",-114.966666666667],PARA"
+        "METER[\"scale_factor\",1.0001],PARAMETER[\"false_easting"
+        "\",100000],PARAMETER[\"false_northing\",200000],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8383"
+        "\"]]"},
+    {8384, "epsg", 8384,
         "NAD83(2011) / NCRS Las Vegas (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "001 +x_0=99999.99998984 +y_0=200000.00001016 +ellps=GRS8");
-    add_proj4text (p, 2,
-        "0 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / NCRS Las Vegas (ftUS)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S");
-    add_srs_wkt (p, 2,
-        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116");
-    add_srs_wkt (p, 4,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 5,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr");
-    add_srs_wkt (p, 7,
-        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36");
-    add_srs_wkt (p, 8,
-        ".25],PARAMETER[\"central_meridian\",-114.966666666667],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",1.0001],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",328083.3333],PARAMETER[\"false_northing\",656166.6");
-    add_srs_wkt (p, 11,
-        "667],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY");
-    add_srs_wkt (p, 12,
-        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 13,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"8384\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8385, "epsg", 8385,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0"
+        "001 +x_0=99999.99998984 +y_0=200000.00001016 +ellps=GRS8"
+        "0 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / NCRS Las Vegas (ftUS)\",GEOGCS[\""
+        "NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference_S"
+        "ystem_2011\",SPHEROID[\"GRS 1980\",6378137,298.257222101"
+        ",AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Tr"
+        "ansverse_Mercator\"],PARAMETER[\"latitude_of_origin\",36"
+        ".25],PARAMETER[\"central_meridian\",-114.966666666667],P"
+        "ARAMETER[\"scale_factor\",1.0001],PARAMETER[\"false_east"
+        "ing\",328083.3333],PARAMETER[\"false_northing\",656166.6"
+        "667],UNIT[\"US survey foot\",0.304800609601219,AUTHORITY"
+        "[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"8384\"]]"},
+    {8385, "epsg", 8385,
         "NAD83(2011) / NCRS Las Vegas high (m)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "00135 +x_0=300000 +y_0=400000 +ellps=GRS80 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / NCRS Las Vegas high (m)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference");
-    add_srs_wkt (p, 2,
-        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 3,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11");
-    add_srs_wkt (p, 4,
-        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 7,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3");
-    add_srs_wkt (p, 8,
-        "6.25],PARAMETER[\"central_meridian\",-114.966666666667],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"scale_factor\",1.000135],PARAMETER[\"false_e");
-    add_srs_wkt (p, 10,
-        "asting\",300000],PARAMETER[\"false_northing\",400000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"8385\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8387, "epsg", 8387,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0"
+        "00135 +x_0=300000 +y_0=400000 +ellps=GRS80 +units=m +no_"
+        "defs",
+        "PROJCS[\"NAD83(2011) / NCRS Las Vegas high (m)\",GEOGCS["
+        "\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Reference"
+        "_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"11"
+        "16\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",3"
+        "6.25],PARAMETER[\"central_meridian\",-114.966666666667],"
+        "PARAMETER[\"scale_factor\",1.000135],PARAMETER[\"false_e"
+        "asting\",300000],PARAMETER[\"false_northing\",400000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"8385\"]]"},
+    {8387, "epsg", 8387,
         "NAD83(2011) / NCRS Las Vegas high (ftUS)", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "00135 +x_0=300000 +y_0=399999.99998984 +ellps=GRS80 +uni");
-    add_proj4text (p, 2,
-        "ts=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / NCRS Las Vegas high (ftUS)\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere");
-    add_srs_wkt (p, 2,
-        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 3,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 5,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 6,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[");
-    add_srs_wkt (p, 7,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 8,
-        ",36.25],PARAMETER[\"central_meridian\",-114.966666666667");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"scale_factor\",1.000135],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_easting\",984250],PARAMETER[\"false_northing\",1312333.");
-    add_srs_wkt (p, 11,
-        "3333],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 13,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"8387\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8391, "epsg", 8391,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.25 +lon_0=-114.966666666667 +k=1.0"
+        "00135 +x_0=300000 +y_0=399999.99998984 +ellps=GRS80 +uni"
+        "ts=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / NCRS Las Vegas high (ftUS)\",GEOG"
+        "CS[\"NAD83(2011)\",DATUM[\"NAD83_National_Spatial_Refere"
+        "nce_System_2011\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1116\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",36.25],PARAMETER[\"central_meridian\",-114.966666666667"
+        "],PARAMETER[\"scale_factor\",1.000135],PARAMETER[\"false"
+        "_easting\",984250],PARAMETER[\"false_northing\",1312333."
+        "3333],UNIT[\"US survey foot\",0.304800609601219,AUTHORIT"
+        "Y[\"EPSG\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"8387\"]]"},
+    {8391, "epsg", 8391,
         "GDA94 / WEIPA94", 0, 0,
         "GRS 1980", "Greenwich",
         "Geocentric_Datum_of_Australia_1994", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=141 +k=0.999929 +x_0=300000 ");
-    add_proj4text (p, 1,
-        "+y_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"GDA94 / WEIPA94\",GEOGCS[\"GDA94\",DATUM[\"Geoc");
-    add_srs_wkt (p, 1,
-        "entric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4283");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",141]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",0.999929],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",300000],PARAMETER[\"false_northing\",2000000],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"8391\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8395, "epsg", 8395,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=141 +k=0.999929 +x_0=300000 "
+        "+y_0=2000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"GDA94 / WEIPA94\",GEOGCS[\"GDA94\",DATUM[\"Geoc"
+        "entric_Datum_of_Australia_1994\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"6283\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4283"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",0],PARAMETER[\"central_meridian\",141]"
+        ",PARAMETER[\"scale_factor\",0.999929],PARAMETER[\"false_"
+        "easting\",300000],PARAMETER[\"false_northing\",2000000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"8391\"]]"},
+    {8395, "epsg", 8395,
         "ETRS89 / Gauss-Kruger CM 9E", 0, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=500000 +y_0=0 +e");
-    add_proj4text (p, 1,
-        "llps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ETRS89 / Gauss-Kruger CM 9E\",GEOGCS[\"ETRS89\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP");
-    add_srs_wkt (p, 2,
-        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",9],PARAMETER[\"scale_factor\",1],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",500000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 10,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"8395\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8399, "epsg", 8399,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=9 +k=1 +x_0=500000 +y_0=0 +e"
+        "llps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ETRS89 / Gauss-Kruger CM 9E\",GEOGCS[\"ETRS89\""
+        ",DATUM[\"European_Terrestrial_Reference_System_1989\",SP"
+        "HEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EP"
+        "SG\",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4258\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",9],PARAMETER[\"scale_factor\",1],PARAME"
+        "TER[\"false_easting\",500000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"8395\"]]"},
+    {8399, "epsg", 8399,
         "ETRF2005", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_2005", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"ETRF2005\",DATUM[\"European Terrestrial Refere");
-    add_srs_wkt (p, 1,
-        "nce Frame 2005\",ELLIPSOID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "22101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 3,
-        "NGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal,");
-    add_srs_wkt (p, 4,
-        "3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGLE");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic lon");
-    add_srs_wkt (p, 6,
-        "gitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174");
-    add_srs_wkt (p, 7,
-        "532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[");
-    add_srs_wkt (p, 8,
-        "3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AR");
-    add_srs_wkt (p, 9,
-        "EA[\"Europe - onshore and offshore: Albania; Andorra; Au");
-    add_srs_wkt (p, 10,
-        "stria; Belgium; Bosnia and Herzegovina; Bulgaria; Croati");
-    add_srs_wkt (p, 11,
-        "a; Cyprus; Czechia; Denmark; Estonia; Faroe Islands; Fin");
-    add_srs_wkt (p, 12,
-        "land; France; Germany; Gibraltar; Greece; Hungary; Irela");
-    add_srs_wkt (p, 13,
-        "nd; Italy; Kosovo; Latvia; Liechtenstein; Lithuania; Lux");
-    add_srs_wkt (p, 14,
-        "embourg; Malta; Moldova; Monaco; Montenegro; Netherlands");
-    add_srs_wkt (p, 15,
-        "; North Macedonia; Norway including Svalbard and Jan May");
-    add_srs_wkt (p, 16,
-        "en; Poland; Portugal; Romania; San Marino; Serbia; Slova");
-    add_srs_wkt (p, 17,
-        "kia; Slovenia; Spain; Sweden; Switzerland; United Kingdo");
-    add_srs_wkt (p, 18,
-        "m (UK) including Channel Islands and Isle of Man; Vatica");
-    add_srs_wkt (p, 19,
-        "n City State.\"],BBOX[32.88,-16.1,84.17,40.18]],ID[\"EPS");
-    add_srs_wkt (p, 20,
-        "G\",8399]]");
-    p = add_epsg_def_ex (filter, first, last, 8403, "epsg", 8403,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"ETRF2005\",DATUM[\"European Terrestrial Refere"
+        "nce Frame 2005\",ELLIPSOID[\"GRS 1980\",6378137,298.2572"
+        "22101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,A"
+        "NGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal,"
+        "3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGLE"
+        "UNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic lon"
+        "gitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174"
+        "532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER["
+        "3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AR"
+        "EA[\"Europe - onshore and offshore: Albania; Andorra; Au"
+        "stria; Belgium; Bosnia and Herzegovina; Bulgaria; Croati"
+        "a; Cyprus; Czechia; Denmark; Estonia; Faroe Islands; Fin"
+        "land; France; Germany; Gibraltar; Greece; Hungary; Irela"
+        "nd; Italy; Kosovo; Latvia; Liechtenstein; Lithuania; Lux"
+        "embourg; Malta; Moldova; Monaco; Montenegro; Netherlands"
+        "; North Macedonia; Norway including Svalbard and Jan May"
+        "en; Poland; Portugal; Romania; San Marino; Serbia; Slova"
+        "kia; Slovenia; Spain; Sweden; Switzerland; United Kingdo"
+        "m (UK) including Channel Islands and Isle of Man; Vatica"
+        "n City State.\"],BBOX[32.88,-16.1,84.17,40.18]],ID[\"EPS"
+        "G\",8399]]"},
+    {8403, "epsg", 8403,
         "ETRF2014", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_2014", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"ETRF2014\",DATUM[\"European Terrestrial Refere");
-    add_srs_wkt (p, 1,
-        "nce Frame 2014\",ELLIPSOID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "22101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 3,
-        "NGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal,");
-    add_srs_wkt (p, 4,
-        "3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGLE");
-    add_srs_wkt (p, 5,
-        "UNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic lon");
-    add_srs_wkt (p, 6,
-        "gitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174");
-    add_srs_wkt (p, 7,
-        "532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER[");
-    add_srs_wkt (p, 8,
-        "3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AR");
-    add_srs_wkt (p, 9,
-        "EA[\"Europe - onshore and offshore: Albania; Andorra; Au");
-    add_srs_wkt (p, 10,
-        "stria; Belgium; Bosnia and Herzegovina; Bulgaria; Croati");
-    add_srs_wkt (p, 11,
-        "a; Cyprus; Czechia; Denmark; Estonia; Faroe Islands; Fin");
-    add_srs_wkt (p, 12,
-        "land; France; Germany; Gibraltar; Greece; Hungary; Irela");
-    add_srs_wkt (p, 13,
-        "nd; Italy; Kosovo; Latvia; Liechtenstein; Lithuania; Lux");
-    add_srs_wkt (p, 14,
-        "embourg; Malta; Moldova; Monaco; Montenegro; Netherlands");
-    add_srs_wkt (p, 15,
-        "; North Macedonia; Norway including Svalbard and Jan May");
-    add_srs_wkt (p, 16,
-        "en; Poland; Portugal; Romania; San Marino; Serbia; Slova");
-    add_srs_wkt (p, 17,
-        "kia; Slovenia; Spain; Sweden; Switzerland; United Kingdo");
-    add_srs_wkt (p, 18,
-        "m (UK) including Channel Islands and Isle of Man; Vatica");
-    add_srs_wkt (p, 19,
-        "n City State.\"],BBOX[32.88,-16.1,84.17,40.18]],ID[\"EPS");
-    add_srs_wkt (p, 20,
-        "G\",8403]]");
-    p = add_epsg_def_ex (filter, first, last, 8426, "epsg", 8426,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"ETRF2014\",DATUM[\"European Terrestrial Refere"
+        "nce Frame 2014\",ELLIPSOID[\"GRS 1980\",6378137,298.2572"
+        "22101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,A"
+        "NGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal,"
+        "3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGLE"
+        "UNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic lon"
+        "gitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174"
+        "532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER["
+        "3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AR"
+        "EA[\"Europe - onshore and offshore: Albania; Andorra; Au"
+        "stria; Belgium; Bosnia and Herzegovina; Bulgaria; Croati"
+        "a; Cyprus; Czechia; Denmark; Estonia; Faroe Islands; Fin"
+        "land; France; Germany; Gibraltar; Greece; Hungary; Irela"
+        "nd; Italy; Kosovo; Latvia; Liechtenstein; Lithuania; Lux"
+        "embourg; Malta; Moldova; Monaco; Montenegro; Netherlands"
+        "; North Macedonia; Norway including Svalbard and Jan May"
+        "en; Poland; Portugal; Romania; San Marino; Serbia; Slova"
+        "kia; Slovenia; Spain; Sweden; Switzerland; United Kingdo"
+        "m (UK) including Channel Islands and Isle of Man; Vatica"
+        "n City State.\"],BBOX[32.88,-16.1,84.17,40.18]],ID[\"EPS"
+        "G\",8403]]"},
+    {8426, "epsg", 8426,
         "Hong Kong Geodetic CS", 1, 1,
         "GRS 1980", "Greenwich",
         "Hong_Kong_Geodetic", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"Hong Kong Geodetic CS\",DATUM[\"Hong Kong Geod");
-    add_srs_wkt (p, 1,
-        "etic\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENG");
-    add_srs_wkt (p, 2,
-        "THUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"");
-    add_srs_wkt (p, 3,
-        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g");
-    add_srs_wkt (p, 4,
-        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr");
-    add_srs_wkt (p, 5,
-        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon");
-    add_srs_wkt (p, 6,
-        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 7,
-        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN");
-    add_srs_wkt (p, 8,
-        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"China ");
-    add_srs_wkt (p, 9,
-        "- Hong Kong - onshore and offshore.\"],BBOX[22.13,113.76");
-    add_srs_wkt (p, 10,
-        ",22.58,114.51]],ID[\"EPSG\",8426]]");
-    p = add_epsg_def_ex (filter, first, last, 8427, "epsg", 8427,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"Hong Kong Geodetic CS\",DATUM[\"Hong Kong Geod"
+        "etic\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENG"
+        "THUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\""
+        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g"
+        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr"
+        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon"
+        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943"
+        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN"
+        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"China "
+        "- Hong Kong - onshore and offshore.\"],BBOX[22.13,113.76"
+        ",22.58,114.51]],ID[\"EPSG\",8426]]"},
+    {8427, "epsg", 8427,
         "Hong Kong Geodetic CS", 1, 1,
         "GRS 1980", "Greenwich",
         "Hong_Kong_Geodetic", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Hong Kong Geodetic CS\",DATUM[\"Hong_Kong_Geode");
-    add_srs_wkt (p, 1,
-        "tic\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1209\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"8427\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8428, "epsg", 8428,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Hong Kong Geodetic CS\",DATUM[\"Hong_Kong_Geode"
+        "tic\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1209\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"8427\"]]"},
+    {8428, "epsg", 8428,
         "Macao 1920", 1, 1,
         "International 1924", "Greenwich",
         "Macao_1920", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Macao 1920\",DATUM[\"Macao_1920\",SPHEROID[\"In");
-    add_srs_wkt (p, 1,
-        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022");
-    add_srs_wkt (p, 2,
-        "\"]],AUTHORITY[\"EPSG\",\"1207\"]],PRIMEM[\"Greenwich\",");
-    add_srs_wkt (p, 3,
-        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453");
-    add_srs_wkt (p, 4,
-        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude");
-    add_srs_wkt (p, 5,
-        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "8428\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8430, "epsg", 8430,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +no_defs",
+        "GEOGCS[\"Macao 1920\",DATUM[\"Macao_1920\",SPHEROID[\"In"
+        "ternational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022"
+        "\"]],AUTHORITY[\"EPSG\",\"1207\"]],PRIMEM[\"Greenwich\","
+        "0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453"
+        "2925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude"
+        "\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\""
+        "8428\"]]"},
+    {8430, "epsg", 8430,
         "Macao 2008", 1, 1,
         "GRS 1980", "Greenwich",
         "Macao_Geodetic_Datum_2008", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"Macao 2008\",DATUM[\"Macao Geodetic Datum 2008");
-    add_srs_wkt (p, 1,
-        "\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHUN");
-    add_srs_wkt (p, 2,
-        "IT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"deg");
-    add_srs_wkt (p, 3,
-        "ree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geod");
-    add_srs_wkt (p, 4,
-        "etic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\",");
-    add_srs_wkt (p, 6,
-        "east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]],");
-    add_srs_wkt (p, 7,
-        "AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"");
-    add_srs_wkt (p, 8,
-        "metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"China - Mac");
-    add_srs_wkt (p, 9,
-        "ao - onshore and offshore.\"],BBOX[22.06,113.52,22.23,11");
-    add_srs_wkt (p, 10,
-        "3.68]],ID[\"EPSG\",8430]]");
-    p = add_epsg_def_ex (filter, first, last, 8431, "epsg", 8431,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"Macao 2008\",DATUM[\"Macao Geodetic Datum 2008"
+        "\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHUN"
+        "IT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"deg"
+        "ree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geod"
+        "etic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\""
+        ",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\","
+        "east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]],"
+        "AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[\""
+        "metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"China - Mac"
+        "ao - onshore and offshore.\"],BBOX[22.06,113.52,22.23,11"
+        "3.68]],ID[\"EPSG\",8430]]"},
+    {8431, "epsg", 8431,
         "Macao 2008", 1, 1,
         "GRS 1980", "Greenwich",
         "Macao_Geodetic_Datum_2008", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Macao 2008\",DATUM[\"Macao_Geodetic_Datum_2008\"");
-    add_srs_wkt (p, 1,
-        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"");
-    add_srs_wkt (p, 2,
-        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1208\"]],PRIMEM[\"");
-    add_srs_wkt (p, 3,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 4,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI");
-    add_srs_wkt (p, 5,
-        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"8431\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8433, "epsg", 8433,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"Macao 2008\",DATUM[\"Macao_Geodetic_Datum_2008\""
+        ",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\""
+        "EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1208\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXI"
+        "S[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY"
+        "[\"EPSG\",\"8431\"]]"},
+    {8433, "epsg", 8433,
         "Macao 1920 / Macao Grid", 0, 1,
         "International 1924", "Greenwich",
         "Macao_1920", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=22.2123972222222 +lon_0=113.536469444");
-    add_proj4text (p, 1,
-        "444 +k=1 +x_0=20000 +y_0=20000 +ellps=intl +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Macao 1920 / Macao Grid\",GEOGCS[\"Macao 1920\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Macao_1920\",SPHEROID[\"International 1924\",63");
-    add_srs_wkt (p, 2,
-        "78388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"1207\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8428\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",22.2123972222222],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 8,
-        "113.536469444444],PARAMETER[\"scale_factor\",1],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",20000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "20000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"8433\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8441, "epsg", 8441,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=22.2123972222222 +lon_0=113.536469444"
+        "444 +k=1 +x_0=20000 +y_0=20000 +ellps=intl +units=m +no_"
+        "defs",
+        "PROJCS[\"Macao 1920 / Macao Grid\",GEOGCS[\"Macao 1920\""
+        ",DATUM[\"Macao_1920\",SPHEROID[\"International 1924\",63"
+        "78388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG"
+        "\",\"1207\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8428\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",22.2123972222222],PARAMETER[\"central_meridian\","
+        "113.536469444444],PARAMETER[\"scale_factor\",1],PARAMETE"
+        "R[\"false_easting\",20000],PARAMETER[\"false_northing\","
+        "20000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"8433\"]]"},
+    {8441, "epsg", 8441,
         "Tananarive / Laborde Grid", 0, 1,
         "International 1924", "Greenwich",
         "Tananarive_1925", "Laborde_Oblique_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=labrd +lat_0=-18.9 +lon_0=46.4372291666667 +azi=18");
-    add_proj4text (p, 1,
-        ".9 +k=0.9995 +x_0=400000 +y_0=800000 +ellps=intl +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tananarive / Laborde Grid\",GEOGCS[\"Tananarive");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Tananarive_1925\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6297\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4297\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Laborde_Oblique_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_center\",-18.9],PARAMETER[\"longitude_of_cente");
-    add_srs_wkt (p, 8,
-        "r\",46.4372291666667],PARAMETER[\"azimuth\",18.9],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"scale_factor\",0.9995],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 10,
-        ",400000],PARAMETER[\"false_northing\",800000],UNIT[\"met");
-    add_srs_wkt (p, 11,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 12,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"8441\"");
-    add_srs_wkt (p, 13,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 8449, "epsg", 8449,
+        "Northing", "North", "Easting", "East",
+        "+proj=labrd +lat_0=-18.9 +lon_0=46.4372291666667 +azi=18"
+        ".9 +k=0.9995 +x_0=400000 +y_0=800000 +ellps=intl +units="
+        "m +no_defs",
+        "PROJCS[\"Tananarive / Laborde Grid\",GEOGCS[\"Tananarive"
+        "\",DATUM[\"Tananarive_1925\",SPHEROID[\"International 19"
+        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY"
+        "[\"EPSG\",\"6297\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4297\"]]"
+        ",PROJECTION[\"Laborde_Oblique_Mercator\"],PARAMETER[\"la"
+        "titude_of_center\",-18.9],PARAMETER[\"longitude_of_cente"
+        "r\",46.4372291666667],PARAMETER[\"azimuth\",18.9],PARAME"
+        "TER[\"scale_factor\",0.9995],PARAMETER[\"false_easting\""
+        ",400000],PARAMETER[\"false_northing\",800000],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"8441\""
+        "]]"},
+    {8449, "epsg", 8449,
         "NAD83(FBN)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_Federal_Base_Network", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(FBN)\",DATUM[\"NAD83_Federal_Base_Network");
-    add_srs_wkt (p, 1,
-        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY");
-    add_srs_wkt (p, 2,
-        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1211\"]],PRIME");
-    add_srs_wkt (p, 3,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 4,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 5,
-        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO");
-    add_srs_wkt (p, 6,
-        "RITY[\"EPSG\",\"8860\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8455, "epsg", 8455,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(FBN)\",DATUM[\"NAD83_Federal_Base_Network"
+        "\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORITY"
+        "[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1211\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHO"
+        "RITY[\"EPSG\",\"8860\"]]"},
+    {8455, "epsg", 8455,
         "RGTAAF07 / UTM zone 53S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_des_Terres_Australes_et_Antarctiques_Francaises_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=53 +south +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGTAAF07 / UTM zone 53S\",GEOGCS[\"RGTAAF07\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Reseau_Geodesique_des_Terres_Australes_et_Antarct");
-    add_srs_wkt (p, 2,
-        "iques_Francaises_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"1113\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"7073\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",0],PARAMETER[\"central_meridian\",135],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8455\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 8456, "epsg", 8456,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=53 +south +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"RGTAAF07 / UTM zone 53S\",GEOGCS[\"RGTAAF07\",D"
+        "ATUM[\"Reseau_Geodesique_des_Terres_Australes_et_Antarct"
+        "iques_Francaises_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"1113\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"7073\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",135],PARAMETER"
+        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8455\"]"
+        "]"},
+    {8456, "epsg", 8456,
         "RGTAAF07 / UTM zone 54S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reseau_Geodesique_des_Terres_Australes_et_Antarctiques_Francaises_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=54 +south +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RGTAAF07 / UTM zone 54S\",GEOGCS[\"RGTAAF07\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Reseau_Geodesique_des_Terres_Australes_et_Antarct");
-    add_srs_wkt (p, 2,
-        "iques_Francaises_2007\",SPHEROID[\"GRS 1980\",6378137,29");
-    add_srs_wkt (p, 3,
-        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 4,
-        "SG\",\"1113\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"7073\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",0],PARAMETER[\"central_meridian\",141],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr");
-    add_srs_wkt (p, 11,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS");
-    add_srs_wkt (p, 12,
-        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8456\"]");
-    add_srs_wkt (p, 13,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 8518, "epsg", 8518,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=54 +south +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"RGTAAF07 / UTM zone 54S\",GEOGCS[\"RGTAAF07\",D"
+        "ATUM[\"Reseau_Geodesique_des_Terres_Australes_et_Antarct"
+        "iques_Francaises_2007\",SPHEROID[\"GRS 1980\",6378137,29"
+        "8.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EP"
+        "SG\",\"1113\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"7073\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",141],PARAMETER"
+        "[\"scale_factor\",0.9996],PARAMETER[\"false_easting\",50"
+        "0000],PARAMETER[\"false_northing\",10000000],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAS"
+        "T],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"8456\"]"
+        "]"},
+    {8518, "epsg", 8518,
         "NAD83(2011) / KS RCS zone 1", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-101.6 +k=1.000156 +x_0=4");
-    add_proj4text (p, 1,
-        "57200.914401829 +y_0=0 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 1\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-101.6],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 9,
-        "or\",1.000156],PARAMETER[\"false_easting\",1500000],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 11,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "8518\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8519, "epsg", 8519,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-101.6 +k=1.000156 +x_0=4"
+        "57200.914401829 +y_0=0 +ellps=GRS80 +units=us-ft +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 1\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-101.6],PARAMETER[\"scale_fact"
+        "or\",1.000156],PARAMETER[\"false_easting\",1500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "8518\"]]"},
+    {8519, "epsg", 8519,
         "NAD83(2011) / KS RCS zone 2", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-100.95 +k=1.000134 +x_0=");
-    add_proj4text (p, 1,
-        "762001.524003048 +y_0=0 +ellps=GRS80 +units=us-ft +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 2\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-100.95],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",1.000134],PARAMETER[\"false_easting\",2500000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.3");
-    add_srs_wkt (p, 11,
-        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"8519\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8520, "epsg", 8520,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-100.95 +k=1.000134 +x_0="
+        "762001.524003048 +y_0=0 +ellps=GRS80 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 2\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-100.95],PARAMETER[\"scale_fac"
+        "tor\",1.000134],PARAMETER[\"false_easting\",2500000],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.3"
+        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"8519\"]]"},
+    {8520, "epsg", 8520,
         "NAD83(2011) / KS RCS zone 3", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-100.35 +k=1.000116 +x_0=");
-    add_proj4text (p, 1,
-        "1066802.13360427 +y_0=0 +ellps=GRS80 +units=us-ft +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 3\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-100.35],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",1.000116],PARAMETER[\"false_easting\",3500000],PAR");
-    add_srs_wkt (p, 10,
-        "AMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.3");
-    add_srs_wkt (p, 11,
-        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East");
-    add_srs_wkt (p, 12,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 13,
-        "\"8520\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8521, "epsg", 8521,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-100.35 +k=1.000116 +x_0="
+        "1066802.13360427 +y_0=0 +ellps=GRS80 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 3\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-100.35],PARAMETER[\"scale_fac"
+        "tor\",1.000116],PARAMETER[\"false_easting\",3500000],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.3"
+        "04800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"8520\"]]"},
+    {8521, "epsg", 8521,
         "NAD83(2011) / KS RCS zone 4", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-99.45 +k=1.000082 +x_0=1");
-    add_proj4text (p, 1,
-        "371602.74320549 +y_0=0 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 4\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-99.45],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 9,
-        "or\",1.000082],PARAMETER[\"false_easting\",4500000],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 11,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "8521\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8522, "epsg", 8522,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-99.45 +k=1.000082 +x_0=1"
+        "371602.74320549 +y_0=0 +ellps=GRS80 +units=us-ft +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 4\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-99.45],PARAMETER[\"scale_fact"
+        "or\",1.000082],PARAMETER[\"false_easting\",4500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "8521\"]]"},
+    {8522, "epsg", 8522,
         "NAD83(2011) / KS RCS zone 5", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-98.6666666666667 +k=1.00");
-    add_proj4text (p, 1,
-        "0078 +x_0=1676403.35280671 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 5\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-98.6666666666667],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",1.000078],PARAMETER[\"false_easting\",550");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"US survey f");
-    add_srs_wkt (p, 11,
-        "oot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"8522\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8523, "epsg", 8523,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-98.6666666666667 +k=1.00"
+        "0078 +x_0=1676403.35280671 +y_0=0 +ellps=GRS80 +units=us"
+        "-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 5\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-98.6666666666667],PARAMETER[\""
+        "scale_factor\",1.000078],PARAMETER[\"false_easting\",550"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"US survey f"
+        "oot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"8522\"]]"},
+    {8523, "epsg", 8523,
         "NAD83(2011) / KS RCS zone 6", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-98.15 +k=1.000068 +x_0=1");
-    add_proj4text (p, 1,
-        "981203.96240793 +y_0=0 +ellps=GRS80 +units=us-ft +no_def");
-    add_proj4text (p, 2,
-        "s");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 6\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-98.15],PARAMETER[\"scale_fact");
-    add_srs_wkt (p, 9,
-        "or\",1.000068],PARAMETER[\"false_easting\",6500000],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30");
-    add_srs_wkt (p, 11,
-        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti");
-    add_srs_wkt (p, 12,
-        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "8523\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8524, "epsg", 8524,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-98.15 +k=1.000068 +x_0=1"
+        "981203.96240793 +y_0=0 +ellps=GRS80 +units=us-ft +no_def"
+        "s",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 6\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-98.15],PARAMETER[\"scale_fact"
+        "or\",1.000068],PARAMETER[\"false_easting\",6500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"US survey foot\",0.30"
+        "4800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Easti"
+        "ng\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "8523\"]]"},
+    {8524, "epsg", 8524,
         "NAD83(2011) / KS RCS zone 7", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=37.5 +lon_0=-97.3333333333333 +k=1.00");
-    add_proj4text (p, 1,
-        "0049 +x_0=2286004.57200914 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 7\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"central_meridian\",-97.3333333333333],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "scale_factor\",1.000049],PARAMETER[\"false_easting\",750");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"US survey f");
-    add_srs_wkt (p, 11,
-        "oot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"8524\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8525, "epsg", 8525,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=37.5 +lon_0=-97.3333333333333 +k=1.00"
+        "0049 +x_0=2286004.57200914 +y_0=0 +ellps=GRS80 +units=us"
+        "-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 7\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",37.5],PARAM"
+        "ETER[\"central_meridian\",-97.3333333333333],PARAMETER[\""
+        "scale_factor\",1.000049],PARAMETER[\"false_easting\",750"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"US survey f"
+        "oot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"8524\"]]"},
+    {8525, "epsg", 8525,
         "NAD83(2011) / KS RCS zone 8", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.1666666666667 +lat_0=39.166666666666");
-    add_proj4text (p, 1,
-        "7 +lon_0=-96.5 +k_0=1.000044 +x_0=2590805.18161036 +y_0=");
-    add_proj4text (p, 2,
-        "182880.365760732 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 8\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",39.");
-    add_srs_wkt (p, 8,
-        "1666666666667],PARAMETER[\"central_meridian\",-96.5],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"scale_factor\",1.000044],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",8500000],PARAMETER[\"false_northing\",600000],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 13,
-        "TH],AUTHORITY[\"EPSG\",\"8525\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8526, "epsg", 8526,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.1666666666667 +lat_0=39.166666666666"
+        "7 +lon_0=-96.5 +k_0=1.000044 +x_0=2590805.18161036 +y_0="
+        "182880.365760732 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 8\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",39."
+        "1666666666667],PARAMETER[\"central_meridian\",-96.5],PAR"
+        "AMETER[\"scale_factor\",1.000044],PARAMETER[\"false_east"
+        "ing\",8500000],PARAMETER[\"false_northing\",600000],UNIT"
+        "[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG\""
+        ",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"8525\"]]"},
+    {8526, "epsg", 8526,
         "NAD83(2011) / KS RCS zone 9", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=38.5 +lat_0=38.5 +lon_0=-96.5 +k_0=1.00");
-    add_proj4text (p, 1,
-        "005 +x_0=2895605.79121158 +y_0=91440.1828803658 +ellps=G");
-    add_proj4text (p, 2,
-        "RS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 9\",GEOGCS[\"NAD83(20");
-    add_srs_wkt (p, 1,
-        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20");
-    add_srs_wkt (p, 2,
-        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con");
-    add_srs_wkt (p, 7,
-        "formal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",38.");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"central_meridian\",-96.5],PARAMETER[\"sca");
-    add_srs_wkt (p, 9,
-        "le_factor\",1.00005],PARAMETER[\"false_easting\",9500000");
-    add_srs_wkt (p, 10,
-        "],PARAMETER[\"false_northing\",300000],UNIT[\"US survey ");
-    add_srs_wkt (p, 11,
-        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A");
-    add_srs_wkt (p, 12,
-        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY");
-    add_srs_wkt (p, 13,
-        "[\"EPSG\",\"8526\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8527, "epsg", 8527,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=38.5 +lat_0=38.5 +lon_0=-96.5 +k_0=1.00"
+        "005 +x_0=2895605.79121158 +y_0=91440.1828803658 +ellps=G"
+        "RS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 9\",GEOGCS[\"NAD83(20"
+        "11)\",DATUM[\"NAD83_National_Spatial_Reference_System_20"
+        "11\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORI"
+        "TY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Con"
+        "formal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",38."
+        "5],PARAMETER[\"central_meridian\",-96.5],PARAMETER[\"sca"
+        "le_factor\",1.00005],PARAMETER[\"false_easting\",9500000"
+        "],PARAMETER[\"false_northing\",300000],UNIT[\"US survey "
+        "foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],A"
+        "XIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY"
+        "[\"EPSG\",\"8526\"]]"},
+    {8527, "epsg", 8527,
         "NAD83(2011) / KS RCS zone 10", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.6333333333333 +lat_0=39.633333333333");
-    add_proj4text (p, 1,
-        "3 +lon_0=-95.75 +k_0=1.00004 +x_0=3200406.4008128 +y_0=2");
-    add_proj4text (p, 2,
-        "13360.426720853 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 10\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",39");
-    add_srs_wkt (p, 8,
-        ".6333333333333],PARAMETER[\"central_meridian\",-95.75],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",1.00004],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",10500000],PARAMETER[\"false_northing\",700000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"8527\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8528, "epsg", 8528,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.6333333333333 +lat_0=39.633333333333"
+        "3 +lon_0=-95.75 +k_0=1.00004 +x_0=3200406.4008128 +y_0=2"
+        "13360.426720853 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 10\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",39"
+        ".6333333333333],PARAMETER[\"central_meridian\",-95.75],P"
+        "ARAMETER[\"scale_factor\",1.00004],PARAMETER[\"false_eas"
+        "ting\",10500000],PARAMETER[\"false_northing\",700000],UN"
+        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG"
+        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"8527\"]]"},
+    {8528, "epsg", 8528,
         "NAD83(2011) / KS RCS zone 11", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=39.1 +lat_0=39.1 +lon_0=-95.25 +k_0=1.0");
-    add_proj4text (p, 1,
-        "00033 +x_0=3505207.01041402 +y_0=182880.365760732 +ellps");
-    add_proj4text (p, 2,
-        "=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 11\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",39");
-    add_srs_wkt (p, 8,
-        ".1],PARAMETER[\"central_meridian\",-95.25],PARAMETER[\"s");
-    add_srs_wkt (p, 9,
-        "cale_factor\",1.000033],PARAMETER[\"false_easting\",1150");
-    add_srs_wkt (p, 10,
-        "0000],PARAMETER[\"false_northing\",600000],UNIT[\"US sur");
-    add_srs_wkt (p, 11,
-        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"");
-    add_srs_wkt (p, 12,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 13,
-        "RITY[\"EPSG\",\"8528\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8529, "epsg", 8529,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=39.1 +lat_0=39.1 +lon_0=-95.25 +k_0=1.0"
+        "00033 +x_0=3505207.01041402 +y_0=182880.365760732 +ellps"
+        "=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 11\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",39"
+        ".1],PARAMETER[\"central_meridian\",-95.25],PARAMETER[\"s"
+        "cale_factor\",1.000033],PARAMETER[\"false_easting\",1150"
+        "0000],PARAMETER[\"false_northing\",600000],UNIT[\"US sur"
+        "vey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"8528\"]]"},
+    {8529, "epsg", 8529,
         "NAD83(2011) / KS RCS zone 12", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.75 +lon_0=-101.416666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "0014 +x_0=3810007.62001524 +y_0=0 +ellps=GRS80 +units=us");
-    add_proj4text (p, 2,
-        "-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 12\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-101.416666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",1.00014],PARAMETER[\"false_easting\",1");
-    add_srs_wkt (p, 10,
-        "2500000],PARAMETER[\"false_northing\",0],UNIT[\"US surve");
-    add_srs_wkt (p, 11,
-        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]");
-    add_srs_wkt (p, 12,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 13,
-        "TY[\"EPSG\",\"8529\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8531, "epsg", 8531,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.75 +lon_0=-101.416666666667 +k=1.0"
+        "0014 +x_0=3810007.62001524 +y_0=0 +ellps=GRS80 +units=us"
+        "-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 12\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR"
+        "AMETER[\"central_meridian\",-101.416666666667],PARAMETER"
+        "[\"scale_factor\",1.00014],PARAMETER[\"false_easting\",1"
+        "2500000],PARAMETER[\"false_northing\",0],UNIT[\"US surve"
+        "y foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"8529\"]]"},
+    {8531, "epsg", 8531,
         "NAD83(2011) / KS RCS zone 13", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.75 +lon_0=-100.4 +k=1.000109 +x_0=");
-    add_proj4text (p, 1,
-        "4114808.22961646 +y_0=0 +ellps=GRS80 +units=us-ft +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 13\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-100.4],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",1.000109],PARAMETER[\"false_easting\",13500000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 11,
-        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 12,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"8531\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8533, "epsg", 8533,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.75 +lon_0=-100.4 +k=1.000109 +x_0="
+        "4114808.22961646 +y_0=0 +ellps=GRS80 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 13\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR"
+        "AMETER[\"central_meridian\",-100.4],PARAMETER[\"scale_fa"
+        "ctor\",1.000109],PARAMETER[\"false_easting\",13500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0"
+        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"8531\"]]"},
+    {8533, "epsg", 8533,
         "NAD83(2011) / KS RCS zone 14", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.75 +lon_0=-99.6666666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "00097 +x_0=4419608.83921768 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 14\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-99.6666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",1.000097],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "14500000],PARAMETER[\"false_northing\",0],UNIT[\"US surv");
-    add_srs_wkt (p, 11,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"8533\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8534, "epsg", 8534,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.75 +lon_0=-99.6666666666667 +k=1.0"
+        "00097 +x_0=4419608.83921768 +y_0=0 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 14\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR"
+        "AMETER[\"central_meridian\",-99.6666666666667],PARAMETER"
+        "[\"scale_factor\",1.000097],PARAMETER[\"false_easting\","
+        "14500000],PARAMETER[\"false_northing\",0],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"8533\"]]"},
+    {8534, "epsg", 8534,
         "NAD83(2011) / KS RCS zone 15", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.75 +lon_0=-99.2 +k=1.000087 +x_0=4");
-    add_proj4text (p, 1,
-        "724409.4488189 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 15\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-99.2],PARAMETER[\"scale_fac");
-    add_srs_wkt (p, 9,
-        "tor\",1.000087],PARAMETER[\"false_easting\",15500000],PA");
-    add_srs_wkt (p, 10,
-        "RAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0.");
-    add_srs_wkt (p, 11,
-        "304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 12,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"8534\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8535, "epsg", 8535,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.75 +lon_0=-99.2 +k=1.000087 +x_0=4"
+        "724409.4488189 +y_0=0 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 15\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR"
+        "AMETER[\"central_meridian\",-99.2],PARAMETER[\"scale_fac"
+        "tor\",1.000087],PARAMETER[\"false_easting\",15500000],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0."
+        "304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"8534\"]]"},
+    {8535, "epsg", 8535,
         "NAD83(2011) / KS RCS zone 16", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.75 +lon_0=-98.55 +k=1.000069 +x_0=");
-    add_proj4text (p, 1,
-        "5029210.05842012 +y_0=0 +ellps=GRS80 +units=us-ft +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 16\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-98.55],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 9,
-        "ctor\",1.000069],PARAMETER[\"false_easting\",16500000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0");
-    add_srs_wkt (p, 11,
-        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 12,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 13,
-        ",\"8535\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8536, "epsg", 8536,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.75 +lon_0=-98.55 +k=1.000069 +x_0="
+        "5029210.05842012 +y_0=0 +ellps=GRS80 +units=us-ft +no_de"
+        "fs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 16\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR"
+        "AMETER[\"central_meridian\",-98.55],PARAMETER[\"scale_fa"
+        "ctor\",1.000069],PARAMETER[\"false_easting\",16500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"US survey foot\",0"
+        ".304800609601219,AUTHORITY[\"EPSG\",\"9003\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"8535\"]]"},
+    {8536, "epsg", 8536,
         "NAD83(2011) / KS RCS zone 17", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.7666666666667 +lat_0=37.766666666666");
-    add_proj4text (p, 1,
-        "7 +lon_0=-97.5 +k_0=1.000059 +x_0=5334010.66802134 +y_0=");
-    add_proj4text (p, 2,
-        "121920.243840488 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 17\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",37");
-    add_srs_wkt (p, 8,
-        ".7666666666667],PARAMETER[\"central_meridian\",-97.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",1.000059],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",17500000],PARAMETER[\"false_northing\",400000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"8536\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8538, "epsg", 8538,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.7666666666667 +lat_0=37.766666666666"
+        "7 +lon_0=-97.5 +k_0=1.000059 +x_0=5334010.66802134 +y_0="
+        "121920.243840488 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 17\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",37"
+        ".7666666666667],PARAMETER[\"central_meridian\",-97.5],PA"
+        "RAMETER[\"scale_factor\",1.000059],PARAMETER[\"false_eas"
+        "ting\",17500000],PARAMETER[\"false_northing\",400000],UN"
+        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG"
+        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"8536\"]]"},
+    {8538, "epsg", 8538,
         "NAD83(2011) / KS RCS zone 18", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Lambert_Conformal_Conic_1SP", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=37.1833333333333 +lat_0=37.183333333333");
-    add_proj4text (p, 1,
-        "3 +lon_0=-97.5 +k_0=1.000055 +x_0=5638811.27762256 +y_0=");
-    add_proj4text (p, 2,
-        "60960.1219202439 +ellps=GRS80 +units=us-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 18\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co");
-    add_srs_wkt (p, 7,
-        "nformal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",37");
-    add_srs_wkt (p, 8,
-        ".1833333333333],PARAMETER[\"central_meridian\",-97.5],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"scale_factor\",1.000055],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 10,
-        "ting\",18500000],PARAMETER[\"false_northing\",200000],UN");
-    add_srs_wkt (p, 11,
-        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 13,
-        "ORTH],AUTHORITY[\"EPSG\",\"8538\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8539, "epsg", 8539,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=37.1833333333333 +lat_0=37.183333333333"
+        "3 +lon_0=-97.5 +k_0=1.000055 +x_0=5638811.27762256 +y_0="
+        "60960.1219202439 +ellps=GRS80 +units=us-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 18\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Lambert_Co"
+        "nformal_Conic_1SP\"],PARAMETER[\"latitude_of_origin\",37"
+        ".1833333333333],PARAMETER[\"central_meridian\",-97.5],PA"
+        "RAMETER[\"scale_factor\",1.000055],PARAMETER[\"false_eas"
+        "ting\",18500000],PARAMETER[\"false_northing\",200000],UN"
+        "IT[\"US survey foot\",0.304800609601219,AUTHORITY[\"EPSG"
+        "\",\"9003\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"8538\"]]"},
+    {8539, "epsg", 8539,
         "NAD83(2011) / KS RCS zone 19", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.75 +lon_0=-95.9666666666667 +k=1.0");
-    add_proj4text (p, 1,
-        "00034 +x_0=5943611.88722378 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 19\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-95.9666666666667],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",1.000034],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "19500000],PARAMETER[\"false_northing\",0],UNIT[\"US surv");
-    add_srs_wkt (p, 11,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"8539\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8540, "epsg", 8540,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.75 +lon_0=-95.9666666666667 +k=1.0"
+        "00034 +x_0=5943611.88722378 +y_0=0 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 19\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR"
+        "AMETER[\"central_meridian\",-95.9666666666667],PARAMETER"
+        "[\"scale_factor\",1.000034],PARAMETER[\"false_easting\","
+        "19500000],PARAMETER[\"false_northing\",0],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"8539\"]]"},
+    {8540, "epsg", 8540,
         "NAD83(2011) / KS RCS zone 20", 0, 0,
         "GRS 1980", "Greenwich",
         "NAD83_National_Spatial_Reference_System_2011", "Transverse_Mercator", "US survey foot",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36.75 +lon_0=-95.0833333333333 +k=1.0");
-    add_proj4text (p, 1,
-        "00031 +x_0=6248412.49682499 +y_0=0 +ellps=GRS80 +units=u");
-    add_proj4text (p, 2,
-        "s-ft +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD83(2011) / KS RCS zone 20\",GEOGCS[\"NAD83(2");
-    add_srs_wkt (p, 1,
-        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2");
-    add_srs_wkt (p, 2,
-        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR");
-    add_srs_wkt (p, 4,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 5,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 6,
-        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse");
-    add_srs_wkt (p, 7,
-        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-95.0833333333333],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"scale_factor\",1.000031],PARAMETER[\"false_easting\",");
-    add_srs_wkt (p, 10,
-        "20500000],PARAMETER[\"false_northing\",0],UNIT[\"US surv");
-    add_srs_wkt (p, 11,
-        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]");
-    add_srs_wkt (p, 12,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 13,
-        "ITY[\"EPSG\",\"8540\"]]");
-    p = add_epsg_def_ex (filter, first, last, 8542, "epsg", 8542,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=36.75 +lon_0=-95.0833333333333 +k=1.0"
+        "00031 +x_0=6248412.49682499 +y_0=0 +ellps=GRS80 +units=u"
+        "s-ft +no_defs",
+        "PROJCS[\"NAD83(2011) / KS RCS zone 20\",GEOGCS[\"NAD83(2"
+        "011)\",DATUM[\"NAD83_National_Spatial_Reference_System_2"
+        "011\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1116\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AUTHORITY[\"EPSG\",\"6318\"]],PROJECTION[\"Transverse"
+        "_Mercator\"],PARAMETER[\"latitude_of_origin\",36.75],PAR"
+        "AMETER[\"central_meridian\",-95.0833333333333],PARAMETER"
+        "[\"scale_factor\",1.000031],PARAMETER[\"false_easting\","
+        "20500000],PARAMETER[\"false_northing\",0],UNIT[\"US surv"
+        "ey foot\",0.304800609601219,AUTHORITY[\"EPSG\",\"9003\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"8540\"]]"},
+    {8542, "epsg", 8542,
         "NAD83(FBN)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_Federal_Base_Network", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(FBN)\",DATUM[\"NAD83 (Federal Base Netwo");
-    add_srs_wkt (p, 1,
-        "rk)\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGT");
-    add_srs_wkt (p, 2,
-        "HUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"");
-    add_srs_wkt (p, 3,
-        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g");
-    add_srs_wkt (p, 4,
-        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr");
-    add_srs_wkt (p, 5,
-        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon");
-    add_srs_wkt (p, 6,
-        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 7,
-        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN");
-    add_srs_wkt (p, 8,
-        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Americ");
-    add_srs_wkt (p, 9,
-        "an Samoa - Tutuila, Aunu'u, Ofu, Olesega, Ta'u and Rose ");
-    add_srs_wkt (p, 10,
-        "islands - onshore. Guam - onshore. Northern Mariana Isla");
-    add_srs_wkt (p, 11,
-        "nds - onshore. Puerto Rico - onshore. United States (USA");
-    add_srs_wkt (p, 12,
-        ") - CONUS - Alabama; Arizona; Arkansas; California; Colo");
-    add_srs_wkt (p, 13,
-        "rado; Connecticut; Delaware; Florida; Georgia; Idaho; Il");
-    add_srs_wkt (p, 14,
-        "linois; Indiana; Iowa; Kansas; Kentucky; Louisiana; Main");
-    add_srs_wkt (p, 15,
-        "e; Maryland; Massachusetts; Michigan; Minnesota; Mississ");
-    add_srs_wkt (p, 16,
-        "ippi; Missouri; Montana; Nebraska; Nevada; New Hampshire");
-    add_srs_wkt (p, 17,
-        "; New Jersey; New Mexico; New York; North Carolina; Nort");
-    add_srs_wkt (p, 18,
-        "h Dakota; Ohio; Oklahoma; Oregon; Pennsylvania; Rhode Is");
-    add_srs_wkt (p, 19,
-        "land; South Carolina; South Dakota; Tennessee; Texas; Ut");
-    add_srs_wkt (p, 20,
-        "ah; Vermont; Virginia; Washington; West Virginia; Wiscon");
-    add_srs_wkt (p, 21,
-        "sin; Wyoming - onshore plus Gulf of Mexico offshore cont");
-    add_srs_wkt (p, 22,
-        "inental shelf (GoM OCS). US Virgin Islands - onshore.\"]");
-    add_srs_wkt (p, 23,
-        ",BBOX[-14.59,144.58,49.38,-64.51]],ID[\"EPSG\",8542]]");
-    p = add_epsg_def_ex (filter, first, last, 8544, "epsg", 8544,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(FBN)\",DATUM[\"NAD83 (Federal Base Netwo"
+        "rk)\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGT"
+        "HUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\""
+        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g"
+        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr"
+        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon"
+        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943"
+        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN"
+        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Americ"
+        "an Samoa - Tutuila, Aunu'u, Ofu, Olesega, Ta'u and Rose "
+        "islands - onshore. Guam - onshore. Northern Mariana Isla"
+        "nds - onshore. Puerto Rico - onshore. United States (USA"
+        ") - CONUS - Alabama; Arizona; Arkansas; California; Colo"
+        "rado; Connecticut; Delaware; Florida; Georgia; Idaho; Il"
+        "linois; Indiana; Iowa; Kansas; Kentucky; Louisiana; Main"
+        "e; Maryland; Massachusetts; Michigan; Minnesota; Mississ"
+        "ippi; Missouri; Montana; Nebraska; Nevada; New Hampshire"
+        "; New Jersey; New Mexico; New York; North Carolina; Nort"
+        "h Dakota; Ohio; Oklahoma; Oregon; Pennsylvania; Rhode Is"
+        "land; South Carolina; South Dakota; Tennessee; Texas; Ut"
+        "ah; Vermont; Virginia; Washington; West Virginia; Wiscon"
+        "sin; Wyoming - onshore plus Gulf of Mexico offshore cont"
+        "inental shelf (GoM OCS). US Virgin Islands - onshore.\"]"
+        ",BBOX[-14.59,144.58,49.38,-64.51]],ID[\"EPSG\",8542]]"},
+    {8544, "epsg", 8544,
         "NAD83(HARN Corrected)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network_-_Corrected", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(HARN Corrected)\",DATUM[\"NAD83 (High Ac");
-    add_srs_wkt (p, 1,
-        "curacy Reference Network - Corrected)\",ELLIPSOID[\"GRS ");
-    add_srs_wkt (p, 2,
-        "1980\",6378137,298.257222101,LENGTHUNIT[\"metre\",1]]],P");
-    add_srs_wkt (p, 3,
-        "RIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 4,
-        "99433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (Lat)");
-    add_srs_wkt (p, 5,
-        "\",north,ORDER[1],ANGLEUNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 6,
-        "3]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],ANGL");
-    add_srs_wkt (p, 7,
-        "EUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellipsoidal");
-    add_srs_wkt (p, 8,
-        " height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE");
-    add_srs_wkt (p, 9,
-        "[SCOPE[\"Geodesy.\"],AREA[\"Puerto Rico and US Virgin Is");
-    add_srs_wkt (p, 10,
-        "lands - onshore.\"],BBOX[17.62,-67.97,18.57,-64.51]],ID[");
-    add_srs_wkt (p, 11,
-        "\"EPSG\",8544]]");
-    p = add_epsg_def_ex (filter, first, last, 8545, "epsg", 8545,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(HARN Corrected)\",DATUM[\"NAD83 (High Ac"
+        "curacy Reference Network - Corrected)\",ELLIPSOID[\"GRS "
+        "1980\",6378137,298.257222101,LENGTHUNIT[\"metre\",1]]],P"
+        "RIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.01745329251"
+        "99433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (Lat)"
+        "\",north,ORDER[1],ANGLEUNIT[\"degree\",0.017453292519943"
+        "3]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],ANGL"
+        "EUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellipsoidal"
+        " height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE"
+        "[SCOPE[\"Geodesy.\"],AREA[\"Puerto Rico and US Virgin Is"
+        "lands - onshore.\"],BBOX[17.62,-67.97,18.57,-64.51]],ID["
+        "\"EPSG\",8544]]"},
+    {8545, "epsg", 8545,
         "NAD83(HARN Corrected)", 1, 1,
         "GRS 1980", "Greenwich",
         "NAD83_High_Accuracy_Reference_Network_-_Corrected", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(HARN Corrected)\",DATUM[\"NAD83_High_Accu");
-    add_srs_wkt (p, 1,
-        "racy_Reference_Network_-_Corrected\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"1212\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR");
-    add_srs_wkt (p, 6,
-        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"8545\"");
-    add_srs_wkt (p, 7,
-        "]]");
-}
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(HARN Corrected)\",DATUM[\"NAD83_High_Accu"
+        "racy_Reference_Network_-_Corrected\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"1212\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NOR"
+        "TH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"8545\""
+        "]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_42 = {
+    epsg_defs_42, sizeof (epsg_defs_42) / sizeof (epsg_defs_42[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -53,3015 +53,1766 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_45 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 9006, "epsg", 9006,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_45[] = {
+    {9006, "epsg", 9006,
         "IGS00", 1, 1,
         "GRS 1980", "Greenwich",
         "IGS00", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGS00\",DATUM[\"IGS00\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 1,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"1245\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 5,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9006\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9008, "epsg", 9008,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"IGS00\",DATUM[\"IGS00\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"1245\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9006\"]]"},
+    {9008, "epsg", 9008,
         "IGb00", 1, 1,
         "GRS 1980", "Greenwich",
         "IGb00", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"IGb00\",DYNAMIC[FRAMEEPOCH[1998]],DATUM[\"IGb0");
-    add_srs_wkt (p, 1,
-        "0\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU");
-    add_srs_wkt (p, 2,
-        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de");
-    add_srs_wkt (p, 3,
-        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo");
-    add_srs_wkt (p, 4,
-        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\"");
-    add_srs_wkt (p, 6,
-        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[");
-    add_srs_wkt (p, 8,
-        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]");
-    add_srs_wkt (p, 9,
-        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9008]]");
-    p = add_epsg_def_ex (filter, first, last, 9009, "epsg", 9009,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"IGb00\",DYNAMIC[FRAMEEPOCH[1998]],DATUM[\"IGb0"
+        "0\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU"
+        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de"
+        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo"
+        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\""
+        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]"
+        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT["
+        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]"
+        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9008]]"},
+    {9009, "epsg", 9009,
         "IGb00", 1, 1,
         "GRS 1980", "Greenwich",
         "IGb00", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGb00\",DATUM[\"IGb00\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 1,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"1246\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 5,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9009\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9011, "epsg", 9011,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"IGb00\",DATUM[\"IGb00\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"1246\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9009\"]]"},
+    {9011, "epsg", 9011,
         "IGS05", 1, 1,
         "GRS 1980", "Greenwich",
         "IGS05", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"IGS05\",DYNAMIC[FRAMEEPOCH[2000]],DATUM[\"IGS0");
-    add_srs_wkt (p, 1,
-        "5\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU");
-    add_srs_wkt (p, 2,
-        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de");
-    add_srs_wkt (p, 3,
-        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo");
-    add_srs_wkt (p, 4,
-        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\"");
-    add_srs_wkt (p, 6,
-        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[");
-    add_srs_wkt (p, 8,
-        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]");
-    add_srs_wkt (p, 9,
-        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9011]]");
-    p = add_epsg_def_ex (filter, first, last, 9012, "epsg", 9012,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"IGS05\",DYNAMIC[FRAMEEPOCH[2000]],DATUM[\"IGS0"
+        "5\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU"
+        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de"
+        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo"
+        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\""
+        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]"
+        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT["
+        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]"
+        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9011]]"},
+    {9012, "epsg", 9012,
         "IGS05", 1, 1,
         "GRS 1980", "Greenwich",
         "IGS05", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGS05\",DATUM[\"IGS05\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 1,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"1247\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 5,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9012\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9013, "epsg", 9013,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"IGS05\",DATUM[\"IGS05\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"1247\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9012\"]]"},
+    {9013, "epsg", 9013,
         "IGS08", 1, 1,
         "GRS 1980", "Greenwich",
         "IGS08", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"IGS08\",DYNAMIC[FRAMEEPOCH[2005]],DATUM[\"IGS0");
-    add_srs_wkt (p, 1,
-        "8\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU");
-    add_srs_wkt (p, 2,
-        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de");
-    add_srs_wkt (p, 3,
-        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo");
-    add_srs_wkt (p, 4,
-        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\"");
-    add_srs_wkt (p, 6,
-        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[");
-    add_srs_wkt (p, 8,
-        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]");
-    add_srs_wkt (p, 9,
-        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9013]]");
-    p = add_epsg_def_ex (filter, first, last, 9014, "epsg", 9014,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"IGS08\",DYNAMIC[FRAMEEPOCH[2005]],DATUM[\"IGS0"
+        "8\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU"
+        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de"
+        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo"
+        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\""
+        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]"
+        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT["
+        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]"
+        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9013]]"},
+    {9014, "epsg", 9014,
         "IGS08", 1, 1,
         "GRS 1980", "Greenwich",
         "IGS08", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGS08\",DATUM[\"IGS08\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 1,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"1141\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 5,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9014\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9016, "epsg", 9016,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"IGS08\",DATUM[\"IGS08\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"1141\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9014\"]]"},
+    {9016, "epsg", 9016,
         "IGb08", 1, 1,
         "GRS 1980", "Greenwich",
         "IGb08", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"IGb08\",DYNAMIC[FRAMEEPOCH[2005]],DATUM[\"IGb0");
-    add_srs_wkt (p, 1,
-        "8\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU");
-    add_srs_wkt (p, 2,
-        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de");
-    add_srs_wkt (p, 3,
-        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo");
-    add_srs_wkt (p, 4,
-        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\"");
-    add_srs_wkt (p, 6,
-        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[");
-    add_srs_wkt (p, 8,
-        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]");
-    add_srs_wkt (p, 9,
-        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9016]]");
-    p = add_epsg_def_ex (filter, first, last, 9017, "epsg", 9017,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"IGb08\",DYNAMIC[FRAMEEPOCH[2005]],DATUM[\"IGb0"
+        "8\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU"
+        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de"
+        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo"
+        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\""
+        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]"
+        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT["
+        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]"
+        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9016]]"},
+    {9017, "epsg", 9017,
         "IGb08", 1, 1,
         "GRS 1980", "Greenwich",
         "IGb08", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGb08\",DATUM[\"IGb08\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 1,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"1248\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 5,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9017\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9018, "epsg", 9018,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"IGb08\",DATUM[\"IGb08\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"1248\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9017\"]]"},
+    {9018, "epsg", 9018,
         "IGS14", 1, 1,
         "GRS 1980", "Greenwich",
         "IGS14", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"IGS14\",DYNAMIC[FRAMEEPOCH[2010]],DATUM[\"IGS1");
-    add_srs_wkt (p, 1,
-        "4\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU");
-    add_srs_wkt (p, 2,
-        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de");
-    add_srs_wkt (p, 3,
-        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo");
-    add_srs_wkt (p, 4,
-        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\"");
-    add_srs_wkt (p, 6,
-        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]");
-    add_srs_wkt (p, 7,
-        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT[");
-    add_srs_wkt (p, 8,
-        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]");
-    add_srs_wkt (p, 9,
-        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9018]]");
-    p = add_epsg_def_ex (filter, first, last, 9019, "epsg", 9019,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"IGS14\",DYNAMIC[FRAMEEPOCH[2010]],DATUM[\"IGS1"
+        "4\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENGTHU"
+        "NIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"de"
+        "gree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"geo"
+        "detic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree"
+        "\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon)\""
+        ",east,ORDER[2],ANGLEUNIT[\"degree\",0.0174532925199433]]"
+        ",AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUNIT["
+        "\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"World.\"]"
+        ",BBOX[-90,-180,90,180]],ID[\"EPSG\",9018]]"},
+    {9019, "epsg", 9019,
         "IGS14", 1, 1,
         "GRS 1980", "Greenwich",
         "IGS14", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"IGS14\",DATUM[\"IGS14\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 1,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 2,
-        "RITY[\"EPSG\",\"1191\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 4,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],");
-    add_srs_wkt (p, 5,
-        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9019\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9039, "epsg", 9039,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"IGS14\",DATUM[\"IGS14\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"1191\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],"
+        "AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9019\"]]"},
+    {9039, "epsg", 9039,
         "ISN2016 / LAEA Europe", 0, 1,
         "GRS 1980", "Greenwich",
         "Islands_Net_2016", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000");
-    add_proj4text (p, 1,
-        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ISN2016 / LAEA Europe\",GEOGCS[\"ISN2016\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Islands_Net_2016\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"1187\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8086\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"lati");
-    add_srs_wkt (p, 7,
-        "tude_of_center\",52],PARAMETER[\"longitude_of_center\",1");
-    add_srs_wkt (p, 8,
-        "0],PARAMETER[\"false_easting\",4321000],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_northing\",3210000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 10,
-        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA");
-    add_srs_wkt (p, 11,
-        "ST],AUTHORITY[\"EPSG\",\"9039\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9040, "epsg", 9040,
+        "Northing", "North", "Easting", "East",
+        "+proj=laea +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000"
+        " +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"ISN2016 / LAEA Europe\",GEOGCS[\"ISN2016\",DATU"
+        "M[\"Islands_Net_2016\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1187\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8086\"]],PROJE"
+        "CTION[\"Lambert_Azimuthal_Equal_Area\"],PARAMETER[\"lati"
+        "tude_of_center\",52],PARAMETER[\"longitude_of_center\",1"
+        "0],PARAMETER[\"false_easting\",4321000],PARAMETER[\"fals"
+        "e_northing\",3210000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",EA"
+        "ST],AUTHORITY[\"EPSG\",\"9039\"]]"},
+    {9040, "epsg", 9040,
         "ISN2016 / LCC Europe", 0, 1,
         "GRS 1980", "Greenwich",
         "Islands_Net_2016", "Lambert_Conformal_Conic_2SP", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_0=52 +lon_0=10 +lat_1=35 +lat_2=65 +x_0=4");
-    add_proj4text (p, 1,
-        "000000 +y_0=2800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 ");
-    add_proj4text (p, 2,
-        "+units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ISN2016 / LCC Europe\",GEOGCS[\"ISN2016\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Islands_Net_2016\",SPHEROID[\"GRS 1980\",6378137,298.");
-    add_srs_wkt (p, 2,
-        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"1187\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8086\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 7,
-        "de_of_origin\",52],PARAMETER[\"central_meridian\",10],PA");
-    add_srs_wkt (p, 8,
-        "RAMETER[\"standard_parallel_1\",35],PARAMETER[\"standard");
-    add_srs_wkt (p, 9,
-        "_parallel_2\",65],PARAMETER[\"false_easting\",4000000],P");
-    add_srs_wkt (p, 10,
-        "ARAMETER[\"false_northing\",2800000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI");
-    add_srs_wkt (p, 12,
-        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"9040\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9053, "epsg", 9053,
+        "Northing", "North", "Easting", "East",
+        "+proj=lcc +lat_0=52 +lon_0=10 +lat_1=35 +lat_2=65 +x_0=4"
+        "000000 +y_0=2800000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 "
+        "+units=m +no_defs",
+        "PROJCS[\"ISN2016 / LCC Europe\",GEOGCS[\"ISN2016\",DATUM"
+        "[\"Islands_Net_2016\",SPHEROID[\"GRS 1980\",6378137,298."
+        "257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG"
+        "\",\"1187\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8086\"]],PROJEC"
+        "TION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"latitu"
+        "de_of_origin\",52],PARAMETER[\"central_meridian\",10],PA"
+        "RAMETER[\"standard_parallel_1\",35],PARAMETER[\"standard"
+        "_parallel_2\",65],PARAMETER[\"false_easting\",4000000],P"
+        "ARAMETER[\"false_northing\",2800000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXI"
+        "S[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"9040\"]]"},
+    {9053, "epsg", 9053,
         "WGS 84 (G730)", 1, 1,
         "WGS 84", "Greenwich",
         "World_Geodetic_System_1984_G730", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"WGS 84 (G730)\",DATUM[\"World_Geodetic_System_1");
-    add_srs_wkt (p, 1,
-        "984_G730\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1152\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9053\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9054, "epsg", 9054,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCS[\"WGS 84 (G730)\",DATUM[\"World_Geodetic_System_1"
+        "984_G730\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT"
+        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1152\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"9053\"]]"},
+    {9054, "epsg", 9054,
         "WGS 84 (G873)", 1, 1,
         "WGS 84", "Greenwich",
         "World_Geodetic_System_1984_G873", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"WGS 84 (G873)\",DATUM[\"World_Geodetic_System_1");
-    add_srs_wkt (p, 1,
-        "984_G873\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1153\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"9054\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9055, "epsg", 9055,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCS[\"WGS 84 (G873)\",DATUM[\"World_Geodetic_System_1"
+        "984_G873\",SPHEROID[\"WGS 84\",6378137,298.257223563,AUT"
+        "HORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1153\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST]"
+        ",AUTHORITY[\"EPSG\",\"9054\"]]"},
+    {9055, "epsg", 9055,
         "WGS 84 (G1150)", 1, 1,
         "WGS 84", "Greenwich",
         "World_Geodetic_System_1984_G1150", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"WGS 84 (G1150)\",DATUM[\"World_Geodetic_System_");
-    add_srs_wkt (p, 1,
-        "1984_G1150\",SPHEROID[\"WGS 84\",6378137,298.257223563,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1154\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"9055\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9056, "epsg", 9056,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCS[\"WGS 84 (G1150)\",DATUM[\"World_Geodetic_System_"
+        "1984_G1150\",SPHEROID[\"WGS 84\",6378137,298.257223563,A"
+        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1154\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"9055\"]]"},
+    {9056, "epsg", 9056,
         "WGS 84 (G1674)", 1, 1,
         "WGS 84", "Greenwich",
         "World_Geodetic_System_1984_G1674", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"WGS 84 (G1674)\",DATUM[\"World_Geodetic_System_");
-    add_srs_wkt (p, 1,
-        "1984_G1674\",SPHEROID[\"WGS 84\",6378137,298.257223563,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1155\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"9056\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9057, "epsg", 9057,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCS[\"WGS 84 (G1674)\",DATUM[\"World_Geodetic_System_"
+        "1984_G1674\",SPHEROID[\"WGS 84\",6378137,298.257223563,A"
+        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1155\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"9056\"]]"},
+    {9057, "epsg", 9057,
         "WGS 84 (G1762)", 1, 1,
         "WGS 84", "Greenwich",
         "World_Geodetic_System_1984_G1762", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=WGS84 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"WGS 84 (G1762)\",DATUM[\"World_Geodetic_System_");
-    add_srs_wkt (p, 1,
-        "1984_G1762\",SPHEROID[\"WGS 84\",6378137,298.257223563,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1156\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS");
-    add_srs_wkt (p, 6,
-        "T],AUTHORITY[\"EPSG\",\"9057\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9059, "epsg", 9059,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=WGS84 +no_defs",
+        "GEOGCS[\"WGS 84 (G1762)\",DATUM[\"World_Geodetic_System_"
+        "1984_G1762\",SPHEROID[\"WGS 84\",6378137,298.257223563,A"
+        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"1156\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAS"
+        "T],AUTHORITY[\"EPSG\",\"9057\"]]"},
+    {9059, "epsg", 9059,
         "ETRF89", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_1989", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF89\",DATUM[\"European_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_Frame_1989\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"117");
-    add_srs_wkt (p, 3,
-        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9059\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9060, "epsg", 9060,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF89\",DATUM[\"European_Terrestrial_Reference"
+        "_Frame_1989\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"117"
+        "8\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9059\"]]"},
+    {9060, "epsg", 9060,
         "ETRF90", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_1990", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF90\",DATUM[\"European_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_Frame_1990\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"117");
-    add_srs_wkt (p, 3,
-        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9060\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9061, "epsg", 9061,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF90\",DATUM[\"European_Terrestrial_Reference"
+        "_Frame_1990\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"117"
+        "9\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9060\"]]"},
+    {9061, "epsg", 9061,
         "ETRF91", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_1991", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF91\",DATUM[\"European_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_Frame_1991\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118");
-    add_srs_wkt (p, 3,
-        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9061\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9062, "epsg", 9062,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF91\",DATUM[\"European_Terrestrial_Reference"
+        "_Frame_1991\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118"
+        "0\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9061\"]]"},
+    {9062, "epsg", 9062,
         "ETRF92", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_1992", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF92\",DATUM[\"European_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_Frame_1992\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118");
-    add_srs_wkt (p, 3,
-        "1\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9062\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9063, "epsg", 9063,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF92\",DATUM[\"European_Terrestrial_Reference"
+        "_Frame_1992\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118"
+        "1\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9062\"]]"},
+    {9063, "epsg", 9063,
         "ETRF93", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_1993", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF93\",DATUM[\"European_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_Frame_1993\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118");
-    add_srs_wkt (p, 3,
-        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9063\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9064, "epsg", 9064,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF93\",DATUM[\"European_Terrestrial_Reference"
+        "_Frame_1993\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118"
+        "2\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9063\"]]"},
+    {9064, "epsg", 9064,
         "ETRF94", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_1994", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF94\",DATUM[\"European_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_Frame_1994\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118");
-    add_srs_wkt (p, 3,
-        "3\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9064\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9065, "epsg", 9065,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF94\",DATUM[\"European_Terrestrial_Reference"
+        "_Frame_1994\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118"
+        "3\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9064\"]]"},
+    {9065, "epsg", 9065,
         "ETRF96", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_1996", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF96\",DATUM[\"European_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_Frame_1996\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118");
-    add_srs_wkt (p, 3,
-        "4\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9065\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9066, "epsg", 9066,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF96\",DATUM[\"European_Terrestrial_Reference"
+        "_Frame_1996\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118"
+        "4\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9065\"]]"},
+    {9066, "epsg", 9066,
         "ETRF97", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_1997", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF97\",DATUM[\"European_Terrestrial_Reference");
-    add_srs_wkt (p, 1,
-        "_Frame_1997\",SPHEROID[\"GRS 1980\",6378137,298.25722210");
-    add_srs_wkt (p, 2,
-        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118");
-    add_srs_wkt (p, 3,
-        "5\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9066\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9067, "epsg", 9067,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF97\",DATUM[\"European_Terrestrial_Reference"
+        "_Frame_1997\",SPHEROID[\"GRS 1980\",6378137,298.25722210"
+        "1,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"118"
+        "5\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9066\"]]"},
+    {9067, "epsg", 9067,
         "ETRF2000", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_2000", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF2000\",DATUM[\"European_Terrestrial_Referen");
-    add_srs_wkt (p, 1,
-        "ce_Frame_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 3,
-        "186\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"9067\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9068, "epsg", 9068,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF2000\",DATUM[\"European_Terrestrial_Referen"
+        "ce_Frame_2000\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "186\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\""
+        ",EAST],AUTHORITY[\"EPSG\",\"9067\"]]"},
+    {9068, "epsg", 9068,
         "ETRF2005", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_2005", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF2005\",DATUM[\"European_Terrestrial_Referen");
-    add_srs_wkt (p, 1,
-        "ce_Frame_2005\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 3,
-        "204\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"9068\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9069, "epsg", 9069,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF2005\",DATUM[\"European_Terrestrial_Referen"
+        "ce_Frame_2005\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "204\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\""
+        ",EAST],AUTHORITY[\"EPSG\",\"9068\"]]"},
+    {9069, "epsg", 9069,
         "ETRF2014", 1, 1,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_Frame_2014", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ETRF2014\",DATUM[\"European_Terrestrial_Referen");
-    add_srs_wkt (p, 1,
-        "ce_Frame_2014\",SPHEROID[\"GRS 1980\",6378137,298.257222");
-    add_srs_wkt (p, 2,
-        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1");
-    add_srs_wkt (p, 3,
-        "206\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\"");
-    add_srs_wkt (p, 6,
-        ",EAST],AUTHORITY[\"EPSG\",\"9069\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9071, "epsg", 9071,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ETRF2014\",DATUM[\"European_Terrestrial_Referen"
+        "ce_Frame_2014\",SPHEROID[\"GRS 1980\",6378137,298.257222"
+        "101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1"
+        "206\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\""
+        ",EAST],AUTHORITY[\"EPSG\",\"9069\"]]"},
+    {9071, "epsg", 9071,
         "NAD83(MARP00)", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_MARP00", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(MARP00)\",DATUM[\"North American Datum o");
-    add_srs_wkt (p, 1,
-        "f 1983 (MARP00)\",ELLIPSOID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 2,
-        "222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 3,
-        "ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal");
-    add_srs_wkt (p, 4,
-        ",3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGL");
-    add_srs_wkt (p, 5,
-        "EUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic lo");
-    add_srs_wkt (p, 6,
-        "ngitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017");
-    add_srs_wkt (p, 7,
-        "4532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER");
-    add_srs_wkt (p, 8,
-        "[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],A");
-    add_srs_wkt (p, 9,
-        "REA[\"Guam, Northern Mariana Islands and Palau; onshore ");
-    add_srs_wkt (p, 10,
-        "and offshore.\"],BBOX[1.64,129.48,23.9,149.55]],ID[\"EPS");
-    add_srs_wkt (p, 11,
-        "G\",9071]]");
-    p = add_epsg_def_ex (filter, first, last, 9072, "epsg", 9072,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(MARP00)\",DATUM[\"North American Datum o"
+        "f 1983 (MARP00)\",ELLIPSOID[\"GRS 1980\",6378137,298.257"
+        "222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,"
+        "ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal"
+        ",3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGL"
+        "EUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic lo"
+        "ngitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017"
+        "4532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER"
+        "[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],A"
+        "REA[\"Guam, Northern Mariana Islands and Palau; onshore "
+        "and offshore.\"],BBOX[1.64,129.48,23.9,149.55]],ID[\"EPS"
+        "G\",9071]]"},
+    {9072, "epsg", 9072,
         "NAD83(MARP00)", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_MARP00", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(MARP00)\",DATUM[\"North_American_Datum_of");
-    add_srs_wkt (p, 1,
-        "_1983_MARP00\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 2,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"12");
-    add_srs_wkt (p, 3,
-        "21\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9072\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9074, "epsg", 9074,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(MARP00)\",DATUM[\"North_American_Datum_of"
+        "_1983_MARP00\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"12"
+        "21\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9072\"]]"},
+    {9074, "epsg", 9074,
         "NAD83(PACP00)", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_PACP00", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"NAD83(PACP00)\",DATUM[\"North American Datum o");
-    add_srs_wkt (p, 1,
-        "f 1983 (PACP00)\",ELLIPSOID[\"GRS 1980\",6378137,298.257");
-    add_srs_wkt (p, 2,
-        "222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 3,
-        "ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal");
-    add_srs_wkt (p, 4,
-        ",3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGL");
-    add_srs_wkt (p, 5,
-        "EUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic lo");
-    add_srs_wkt (p, 6,
-        "ngitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017");
-    add_srs_wkt (p, 7,
-        "4532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER");
-    add_srs_wkt (p, 8,
-        "[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],A");
-    add_srs_wkt (p, 9,
-        "REA[\"American Samoa, Marshall Islands, United States (U");
-    add_srs_wkt (p, 10,
-        "SA) - Hawaii, United States minor outlying islands; onsh");
-    add_srs_wkt (p, 11,
-        "ore and offshore.\"],BBOX[-17.56,157.47,31.8,-151.27]],I");
-    add_srs_wkt (p, 12,
-        "D[\"EPSG\",9074]]");
-    p = add_epsg_def_ex (filter, first, last, 9075, "epsg", 9075,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"NAD83(PACP00)\",DATUM[\"North American Datum o"
+        "f 1983 (PACP00)\",ELLIPSOID[\"GRS 1980\",6378137,298.257"
+        "222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,"
+        "ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoidal"
+        ",3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],ANGL"
+        "EUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic lo"
+        "ngitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017"
+        "4532925199433]],AXIS[\"ellipsoidal height (h)\",up,ORDER"
+        "[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],A"
+        "REA[\"American Samoa, Marshall Islands, United States (U"
+        "SA) - Hawaii, United States minor outlying islands; onsh"
+        "ore and offshore.\"],BBOX[-17.56,157.47,31.8,-151.27]],I"
+        "D[\"EPSG\",9074]]"},
+    {9075, "epsg", 9075,
         "NAD83(PACP00)", 1, 1,
         "GRS 1980", "Greenwich",
         "North_American_Datum_of_1983_PACP00", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"NAD83(PACP00)\",DATUM[\"North_American_Datum_of");
-    add_srs_wkt (p, 1,
-        "_1983_PACP00\",SPHEROID[\"GRS 1980\",6378137,298.2572221");
-    add_srs_wkt (p, 2,
-        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"12");
-    add_srs_wkt (p, 3,
-        "49\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",");
-    add_srs_wkt (p, 6,
-        "EAST],AUTHORITY[\"EPSG\",\"9075\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9139, "epsg", 9139,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"NAD83(PACP00)\",DATUM[\"North_American_Datum_of"
+        "_1983_PACP00\",SPHEROID[\"GRS 1980\",6378137,298.2572221"
+        "01,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"12"
+        "49\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\","
+        "EAST],AUTHORITY[\"EPSG\",\"9075\"]]"},
+    {9139, "epsg", 9139,
         "KOSOVAREF01", 1, 1,
         "GRS 1980", "Greenwich",
         "Kosovo_Reference_System_2001", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"KOSOVAREF01\",DATUM[\"Kosovo Reference System ");
-    add_srs_wkt (p, 1,
-        "2001\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENG");
-    add_srs_wkt (p, 2,
-        "THUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"");
-    add_srs_wkt (p, 3,
-        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g");
-    add_srs_wkt (p, 4,
-        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr");
-    add_srs_wkt (p, 5,
-        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon");
-    add_srs_wkt (p, 6,
-        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 7,
-        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN");
-    add_srs_wkt (p, 8,
-        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Kosovo");
-    add_srs_wkt (p, 9,
-        ".\"],BBOX[41.85,19.97,43.25,21.8]],ID[\"EPSG\",9139]]");
-    p = add_epsg_def_ex (filter, first, last, 9140, "epsg", 9140,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCRS[\"KOSOVAREF01\",DATUM[\"Kosovo Reference System "
+        "2001\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENG"
+        "THUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\""
+        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g"
+        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr"
+        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon"
+        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943"
+        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN"
+        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Kosovo"
+        ".\"],BBOX[41.85,19.97,43.25,21.8]],ID[\"EPSG\",9139]]"},
+    {9140, "epsg", 9140,
         "KOSOVAREF01", 1, 1,
         "GRS 1980", "Greenwich",
         "Kosovo_Reference_System_2001", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de");
-    add_proj4text (p, 1,
-        "fs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"KOSOVAREF01\",DATUM[\"Kosovo_Reference_System_2");
-    add_srs_wkt (p, 1,
-        "001\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1251\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9140\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9141, "epsg", 9141,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +no_de"
+        "fs",
+        "GEOGCS[\"KOSOVAREF01\",DATUM[\"Kosovo_Reference_System_2"
+        "001\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1251\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"9140\"]]"},
+    {9141, "epsg", 9141,
         "KOSOVAREF01 / Balkans zone 7", 0, 0,
         "GRS 1980", "Greenwich",
         "Kosovo_Reference_System_2001", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=7500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de");
-    add_proj4text (p, 2,
-        "fs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KOSOVAREF01 / Balkans zone 7\",GEOGCS[\"KOSOVAR");
-    add_srs_wkt (p, 1,
-        "EF01\",DATUM[\"Kosovo_Reference_System_2001\",SPHEROID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70");
-    add_srs_wkt (p, 3,
-        "19\"]],AUTHORITY[\"EPSG\",\"1251\"]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 4,
-        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745");
-    add_srs_wkt (p, 5,
-        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"9140\"]],PROJECTION[\"Transverse_Mercator\"],PARA");
-    add_srs_wkt (p, 7,
-        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri");
-    add_srs_wkt (p, 8,
-        "dian\",21],PARAMETER[\"scale_factor\",0.9999],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",7500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9141\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9147, "epsg", 9147,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=0.9999 +x_0=7500000 +y"
+        "_0=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_de"
+        "fs",
+        "PROJCS[\"KOSOVAREF01 / Balkans zone 7\",GEOGCS[\"KOSOVAR"
+        "EF01\",DATUM[\"Kosovo_Reference_System_2001\",SPHEROID[\""
+        "GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"70"
+        "19\"]],AUTHORITY[\"EPSG\",\"1251\"]],PRIMEM[\"Greenwich\""
+        ",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745"
+        "32925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EP"
+        "SG\",\"9140\"]],PROJECTION[\"Transverse_Mercator\"],PARA"
+        "METER[\"latitude_of_origin\",0],PARAMETER[\"central_meri"
+        "dian\",21],PARAMETER[\"scale_factor\",0.9999],PARAMETER["
+        "\"false_easting\",7500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"9141\"]]"},
+    {9147, "epsg", 9147,
         "SIRGAS-Chile 2013", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_3_epoch_2013", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"SIRGAS-Chile 2013\",DATUM[\"SIRGAS-Chile reali");
-    add_srs_wkt (p, 1,
-        "zation 3 epoch 2013\",ELLIPSOID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoi");
-    add_srs_wkt (p, 4,
-        "dal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],A");
-    add_srs_wkt (p, 5,
-        "NGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic");
-    add_srs_wkt (p, 6,
-        " longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.");
-    add_srs_wkt (p, 7,
-        "0174532925199433]],AXIS[\"ellipsoidal height (h)\",up,OR");
-    add_srs_wkt (p, 8,
-        "DER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"");
-    add_srs_wkt (p, 9,
-        "],AREA[\"Chile - onshore and offshore. Includes Easter I");
-    add_srs_wkt (p, 10,
-        "sland, Juan Fernandez Islands, San Felix, and Sala y Gom");
-    add_srs_wkt (p, 11,
-        "ez.\"],BBOX[-59.87,-113.21,-17.5,-65.72]],ID[\"EPSG\",91");
-    add_srs_wkt (p, 12,
-        "47]]");
-    p = add_epsg_def_ex (filter, first, last, 9148, "epsg", 9148,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"SIRGAS-Chile 2013\",DATUM[\"SIRGAS-Chile reali"
+        "zation 3 epoch 2013\",ELLIPSOID[\"GRS 1980\",6378137,298"
+        ".257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\""
+        ",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoi"
+        "dal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],A"
+        "NGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic"
+        " longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0."
+        "0174532925199433]],AXIS[\"ellipsoidal height (h)\",up,OR"
+        "DER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\""
+        "],AREA[\"Chile - onshore and offshore. Includes Easter I"
+        "sland, Juan Fernandez Islands, San Felix, and Sala y Gom"
+        "ez.\"],BBOX[-59.87,-113.21,-17.5,-65.72]],ID[\"EPSG\",91"
+        "47]]"},
+    {9148, "epsg", 9148,
         "SIRGAS-Chile 2013", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_3_epoch_2013", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIRGAS-Chile 2013\",DATUM[\"SIRGAS-Chile_realiz");
-    add_srs_wkt (p, 1,
-        "ation_3_epoch_2013\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 2,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"1252\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"9148\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9149, "epsg", 9149,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"SIRGAS-Chile 2013\",DATUM[\"SIRGAS-Chile_realiz"
+        "ation_3_epoch_2013\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1252\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit"
+        "ude\",EAST],AUTHORITY[\"EPSG\",\"9148\"]]"},
+    {9149, "epsg", 9149,
         "SIRGAS-Chile 2013 / UTM zone 18S", 0, 0,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_3_epoch_2013", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +south +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS-Chile 2013 / UTM zone 18S\",GEOGCS[\"SIR");
-    add_srs_wkt (p, 1,
-        "GAS-Chile 2013\",DATUM[\"SIRGAS-Chile_realization_3_epoc");
-    add_srs_wkt (p, 2,
-        "h_2013\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1252\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"9148\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-75],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9149\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9150, "epsg", 9150,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +south +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"SIRGAS-Chile 2013 / UTM zone 18S\",GEOGCS[\"SIR"
+        "GAS-Chile 2013\",DATUM[\"SIRGAS-Chile_realization_3_epoc"
+        "h_2013\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1252\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"9148\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",-75],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9149\"]]"},
+    {9150, "epsg", 9150,
         "SIRGAS-Chile 2013 / UTM zone 19S", 0, 0,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_3_epoch_2013", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS-Chile 2013 / UTM zone 19S\",GEOGCS[\"SIR");
-    add_srs_wkt (p, 1,
-        "GAS-Chile 2013\",DATUM[\"SIRGAS-Chile_realization_3_epoc");
-    add_srs_wkt (p, 2,
-        "h_2013\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1252\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"9148\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-69],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9150\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9152, "epsg", 9152,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"SIRGAS-Chile 2013 / UTM zone 19S\",GEOGCS[\"SIR"
+        "GAS-Chile 2013\",DATUM[\"SIRGAS-Chile_realization_3_epoc"
+        "h_2013\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1252\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"9148\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",-69],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9150\"]]"},
+    {9152, "epsg", 9152,
         "SIRGAS-Chile 2016", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_4_epoch_2016", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"SIRGAS-Chile 2016\",DATUM[\"SIRGAS-Chile reali");
-    add_srs_wkt (p, 1,
-        "zation 4 epoch 2016\",ELLIPSOID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 2,
-        ".257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\"");
-    add_srs_wkt (p, 3,
-        ",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoi");
-    add_srs_wkt (p, 4,
-        "dal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],A");
-    add_srs_wkt (p, 5,
-        "NGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic");
-    add_srs_wkt (p, 6,
-        " longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0.");
-    add_srs_wkt (p, 7,
-        "0174532925199433]],AXIS[\"ellipsoidal height (h)\",up,OR");
-    add_srs_wkt (p, 8,
-        "DER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"");
-    add_srs_wkt (p, 9,
-        "],AREA[\"Chile - onshore and offshore. Includes Easter I");
-    add_srs_wkt (p, 10,
-        "sland, Juan Fernandez Islands, San Felix, and Sala y Gom");
-    add_srs_wkt (p, 11,
-        "ez.\"],BBOX[-59.87,-113.21,-17.5,-65.72]],ID[\"EPSG\",91");
-    add_srs_wkt (p, 12,
-        "52]]");
-    p = add_epsg_def_ex (filter, first, last, 9153, "epsg", 9153,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"SIRGAS-Chile 2016\",DATUM[\"SIRGAS-Chile reali"
+        "zation 4 epoch 2016\",ELLIPSOID[\"GRS 1980\",6378137,298"
+        ".257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\""
+        ",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS[ellipsoi"
+        "dal,3],AXIS[\"geodetic latitude (Lat)\",north,ORDER[1],A"
+        "NGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"geodetic"
+        " longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"degree\",0."
+        "0174532925199433]],AXIS[\"ellipsoidal height (h)\",up,OR"
+        "DER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\""
+        "],AREA[\"Chile - onshore and offshore. Includes Easter I"
+        "sland, Juan Fernandez Islands, San Felix, and Sala y Gom"
+        "ez.\"],BBOX[-59.87,-113.21,-17.5,-65.72]],ID[\"EPSG\",91"
+        "52]]"},
+    {9153, "epsg", 9153,
         "SIRGAS-Chile 2016", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_4_epoch_2016", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIRGAS-Chile 2016\",DATUM[\"SIRGAS-Chile_realiz");
-    add_srs_wkt (p, 1,
-        "ation_4_epoch_2016\",SPHEROID[\"GRS 1980\",6378137,298.2");
-    add_srs_wkt (p, 2,
-        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"1253\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit");
-    add_srs_wkt (p, 6,
-        "ude\",EAST],AUTHORITY[\"EPSG\",\"9153\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9154, "epsg", 9154,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"SIRGAS-Chile 2016\",DATUM[\"SIRGAS-Chile_realiz"
+        "ation_4_epoch_2016\",SPHEROID[\"GRS 1980\",6378137,298.2"
+        "57222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\""
+        ",\"1253\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longit"
+        "ude\",EAST],AUTHORITY[\"EPSG\",\"9153\"]]"},
+    {9154, "epsg", 9154,
         "SIRGAS-Chile 2016 / UTM zone 18S", 0, 0,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_4_epoch_2016", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +south +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS-Chile 2016 / UTM zone 18S\",GEOGCS[\"SIR");
-    add_srs_wkt (p, 1,
-        "GAS-Chile 2016\",DATUM[\"SIRGAS-Chile_realization_4_epoc");
-    add_srs_wkt (p, 2,
-        "h_2016\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1253\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"9153\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-75],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9154\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9155, "epsg", 9155,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +south +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"SIRGAS-Chile 2016 / UTM zone 18S\",GEOGCS[\"SIR"
+        "GAS-Chile 2016\",DATUM[\"SIRGAS-Chile_realization_4_epoc"
+        "h_2016\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1253\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"9153\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",-75],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9154\"]]"},
+    {9155, "epsg", 9155,
         "SIRGAS-Chile 2016 / UTM zone 19S", 0, 0,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile_realization_4_epoch_2016", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SIRGAS-Chile 2016 / UTM zone 19S\",GEOGCS[\"SIR");
-    add_srs_wkt (p, 1,
-        "GAS-Chile 2016\",DATUM[\"SIRGAS-Chile_realization_4_epoc");
-    add_srs_wkt (p, 2,
-        "h_2016\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1253\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"9153\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",-69],PARAMETER[\"scale_facto");
-    add_srs_wkt (p, 9,
-        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 12,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9155\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9156, "epsg", 9156,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"SIRGAS-Chile 2016 / UTM zone 19S\",GEOGCS[\"SIR"
+        "GAS-Chile 2016\",DATUM[\"SIRGAS-Chile_realization_4_epoc"
+        "h_2016\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1253\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"9153\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",-69],PARAMETER[\"scale_facto"
+        "r\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETE"
+        "R[\"false_northing\",10000000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9155\"]]"},
+    {9156, "epsg", 9156,
         "RSAO13 / UTM zone 32S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reference_System_de_Angola_2013", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSAO13 / UTM zone 32S\",GEOGCS[\"RSAO13\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Reference_System_de_Angola_2013\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"1220\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "8699\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",10000000],");
-    add_srs_wkt (p, 10,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 11,
-        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"9156\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9157, "epsg", 9157,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RSAO13 / UTM zone 32S\",GEOGCS[\"RSAO13\",DATUM"
+        "[\"Reference_System_de_Angola_2013\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"1220\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "8699\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",9"
+        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",10000000],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"9156\"]]"},
+    {9157, "epsg", 9157,
         "RSAO13 / UTM zone 33S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reference_System_de_Angola_2013", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSAO13 / UTM zone 33S\",GEOGCS[\"RSAO13\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Reference_System_de_Angola_2013\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"1220\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "8699\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",10000000]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 11,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9157\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9158, "epsg", 9158,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RSAO13 / UTM zone 33S\",GEOGCS[\"RSAO13\",DATUM"
+        "[\"Reference_System_de_Angola_2013\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"1220\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "8699\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",10000000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"9157\"]]"},
+    {9158, "epsg", 9158,
         "RSAO13 / UTM zone 34S", 0, 0,
         "GRS 1980", "Greenwich",
         "Reference_System_de_Angola_2013", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +south +ellps=GRS80 +towgs84=0,0,0,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSAO13 / UTM zone 34S\",GEOGCS[\"RSAO13\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Reference_System_de_Angola_2013\",SPHEROID[\"GRS 1980");
-    add_srs_wkt (p, 2,
-        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"1220\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "8699\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2");
-    add_srs_wkt (p, 8,
-        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",10000000]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 11,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"9158\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9159, "epsg", 9159,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=34 +south +ellps=GRS80 +towgs84=0,0,0,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"RSAO13 / UTM zone 34S\",GEOGCS[\"RSAO13\",DATUM"
+        "[\"Reference_System_de_Angola_2013\",SPHEROID[\"GRS 1980"
+        "\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],A"
+        "UTHORITY[\"EPSG\",\"1220\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "8699\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",2"
+        "1],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",10000000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"9158\"]]"},
+    {9159, "epsg", 9159,
         "RSAO13 / TM 12 SE", 0, 0,
         "GRS 1980", "Greenwich",
         "Reference_System_de_Angola_2013", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RSAO13 / TM 12 SE\",GEOGCS[\"RSAO13\",DATUM[\"R");
-    add_srs_wkt (p, 1,
-        "eference_System_de_Angola_2013\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"1220\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8699");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",0],PARAMETER[\"central_meridian\",12],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",500000],PARAMETER[\"false_northing\",10000000],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East");
-    add_srs_wkt (p, 11,
-        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9159\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9183, "epsg", 9183,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9996 +x_0=500000 +y_"
+        "0=10000000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m "
+        "+no_defs",
+        "PROJCS[\"RSAO13 / TM 12 SE\",GEOGCS[\"RSAO13\",DATUM[\"R"
+        "eference_System_de_Angola_2013\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"1220\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"8699"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",0],PARAMETER[\"central_meridian\",12],"
+        "PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",10000000],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"East"
+        "ing\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\","
+        "\"9159\"]]"},
+    {9183, "epsg", 9183,
         "SIRGAS-Chile (deprecated)", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"SIRGAS-Chile\",DATUM[\"SIRGAS-Chile\",ELLIPSOI");
-    add_srs_wkt (p, 1,
-        "D[\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\"");
-    add_srs_wkt (p, 2,
-        ",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174");
-    add_srs_wkt (p, 3,
-        "532925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitud");
-    add_srs_wkt (p, 4,
-        "e (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[");
-    add_srs_wkt (p, 6,
-        "2],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"elli");
-    add_srs_wkt (p, 7,
-        "psoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]");
-    add_srs_wkt (p, 8,
-        "],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Chile - onshore and o");
-    add_srs_wkt (p, 9,
-        "ffshore. Includes Easter Island, Juan Fernandez Islands,");
-    add_srs_wkt (p, 10,
-        " San Felix, and Sala y Gomez.\"],BBOX[-59.87,-113.21,-17");
-    add_srs_wkt (p, 11,
-        ".5,-65.72]],ID[\"EPSG\",9183]]");
-    p = add_epsg_def_ex (filter, first, last, 9184, "epsg", 9184,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"SIRGAS-Chile\",DATUM[\"SIRGAS-Chile\",ELLIPSOI"
+        "D[\"GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\""
+        ",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174"
+        "532925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitud"
+        "e (Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.01745329"
+        "25199433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER["
+        "2],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"elli"
+        "psoidal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]"
+        "],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Chile - onshore and o"
+        "ffshore. Includes Easter Island, Juan Fernandez Islands,"
+        " San Felix, and Sala y Gomez.\"],BBOX[-59.87,-113.21,-17"
+        ".5,-65.72]],ID[\"EPSG\",9183]]"},
+    {9184, "epsg", 9184,
         "SIRGAS-Chile (deprecated)", 1, 1,
         "GRS 1980", "Greenwich",
         "SIRGAS-Chile", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"SIRGAS-Chile (deprecated)\",DATUM[\"SIRGAS-Chil");
-    add_srs_wkt (p, 1,
-        "e\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT");
-    add_srs_wkt (p, 2,
-        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1254\"]],PRIM");
-    add_srs_wkt (p, 3,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 4,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 5,
-        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"9184\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9191, "epsg", 9191,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"SIRGAS-Chile (deprecated)\",DATUM[\"SIRGAS-Chil"
+        "e\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHORIT"
+        "Y[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1254\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTH"
+        "ORITY[\"EPSG\",\"9184\"]]"},
+    {9191, "epsg", 9191,
         "WGS 84 / NIWA Albers", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Albers_Conic_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_0=-40 +lon_0=175 +lat_1=-30 +lat_2=-50 +x");
-    add_proj4text (p, 1,
-        "_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / NIWA Albers\",GEOGCS[\"WGS 84\",DATUM[");
-    add_srs_wkt (p, 1,
-        "\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,A");
-    add_srs_wkt (p, 2,
-        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Albe");
-    add_srs_wkt (p, 6,
-        "rs_Conic_Equal_Area\"],PARAMETER[\"latitude_of_center\",");
-    add_srs_wkt (p, 7,
-        "-40],PARAMETER[\"longitude_of_center\",175],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "standard_parallel_1\",-30],PARAMETER[\"standard_parallel");
-    add_srs_wkt (p, 9,
-        "_2\",-50],PARAMETER[\"false_easting\",0],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 11,
-        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],");
-    add_srs_wkt (p, 12,
-        "AUTHORITY[\"EPSG\",\"9191\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9205, "epsg", 9205,
+        "Easting", "East", "Northing", "North",
+        "+proj=aea +lat_0=-40 +lon_0=175 +lat_1=-30 +lat_2=-50 +x"
+        "_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / NIWA Albers\",GEOGCS[\"WGS 84\",DATUM["
+        "\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,298.257223563,A"
+        "UTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"6326\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PROJECTION[\"Albe"
+        "rs_Conic_Equal_Area\"],PARAMETER[\"latitude_of_center\","
+        "-40],PARAMETER[\"longitude_of_center\",175],PARAMETER[\""
+        "standard_parallel_1\",-30],PARAMETER[\"standard_parallel"
+        "_2\",-50],PARAMETER[\"false_easting\",0],PARAMETER[\"fal"
+        "se_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9"
+        "001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],"
+        "AUTHORITY[\"EPSG\",\"9191\"]]"},
+    {9205, "epsg", 9205,
         "VN-2000 / TM-3 103-00", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=103 +k=0.9999 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,-1");
-    add_proj4text (p, 2,
-        "11.45032835,0.00928836,-0.01975479,0.00427372,0.25290627");
-    add_proj4text (p, 3,
-        "8 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 103-00\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",103],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9205\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9206, "epsg", 9206,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=103 +k=0.9999 +x_0=500000 +y"
+        "_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,-1"
+        "11.45032835,0.00928836,-0.01975479,0.00427372,0.25290627"
+        "8 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 103-00\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",103],PARAMETER[\"scal"
+        "e_factor\",0.9999],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9205\"]]"},
+    {9206, "epsg", 9206,
         "VN-2000 / TM-3 104-00", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=104 +k=0.9999 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,-1");
-    add_proj4text (p, 2,
-        "11.45032835,0.00928836,-0.01975479,0.00427372,0.25290627");
-    add_proj4text (p, 3,
-        "8 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 104-00\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",104],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9206\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9207, "epsg", 9207,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=104 +k=0.9999 +x_0=500000 +y"
+        "_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,-1"
+        "11.45032835,0.00928836,-0.01975479,0.00427372,0.25290627"
+        "8 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 104-00\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",104],PARAMETER[\"scal"
+        "e_factor\",0.9999],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9206\"]]"},
+    {9207, "epsg", 9207,
         "VN-2000 / TM-3 104-30", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=104.5 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,");
-    add_proj4text (p, 2,
-        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906");
-    add_proj4text (p, 3,
-        "278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 104-30\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",104.5],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9207\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9208, "epsg", 9208,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=104.5 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,"
+        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906"
+        "278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 104-30\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",104.5],PARAMETER[\"sc"
+        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9207\"]]"},
+    {9208, "epsg", 9208,
         "VN-2000 / TM-3 104-45", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=104.75 +k=0.9999 +x_0=500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279");
-    add_proj4text (p, 2,
-        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290");
-    add_proj4text (p, 3,
-        "6278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 104-45\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",104.75],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9208\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9209, "epsg", 9209,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=104.75 +k=0.9999 +x_0=500000"
+        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279"
+        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290"
+        "6278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 104-45\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",104.75],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9208\"]]"},
+    {9209, "epsg", 9209,
         "VN-2000 / TM-3 105-30", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105.5 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,");
-    add_proj4text (p, 2,
-        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906");
-    add_proj4text (p, 3,
-        "278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 105-30\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",105.5],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9209\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9210, "epsg", 9210,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=105.5 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,"
+        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906"
+        "278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 105-30\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",105.5],PARAMETER[\"sc"
+        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9209\"]]"},
+    {9210, "epsg", 9210,
         "VN-2000 / TM-3 105-45", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=105.75 +k=0.9999 +x_0=500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279");
-    add_proj4text (p, 2,
-        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290");
-    add_proj4text (p, 3,
-        "6278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 105-45\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",105.75],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9210\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9211, "epsg", 9211,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=105.75 +k=0.9999 +x_0=500000"
+        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279"
+        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290"
+        "6278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 105-45\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",105.75],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9210\"]]"},
+    {9211, "epsg", 9211,
         "VN-2000 / TM-3 106-00", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=106 +k=0.9999 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,-1");
-    add_proj4text (p, 2,
-        "11.45032835,0.00928836,-0.01975479,0.00427372,0.25290627");
-    add_proj4text (p, 3,
-        "8 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 106-00\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",106],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9211\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9212, "epsg", 9212,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=106 +k=0.9999 +x_0=500000 +y"
+        "_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,-1"
+        "11.45032835,0.00928836,-0.01975479,0.00427372,0.25290627"
+        "8 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 106-00\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",106],PARAMETER[\"scal"
+        "e_factor\",0.9999],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9211\"]]"},
+    {9212, "epsg", 9212,
         "VN-2000 / TM-3 106-15", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=106.25 +k=0.9999 +x_0=500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279");
-    add_proj4text (p, 2,
-        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290");
-    add_proj4text (p, 3,
-        "6278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 106-15\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",106.25],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9212\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9213, "epsg", 9213,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=106.25 +k=0.9999 +x_0=500000"
+        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279"
+        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290"
+        "6278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 106-15\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",106.25],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9212\"]]"},
+    {9213, "epsg", 9213,
         "VN-2000 / TM-3 106-30", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=106.5 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,");
-    add_proj4text (p, 2,
-        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906");
-    add_proj4text (p, 3,
-        "278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 106-30\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",106.5],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9213\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9214, "epsg", 9214,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=106.5 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,"
+        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906"
+        "278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 106-30\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",106.5],PARAMETER[\"sc"
+        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9213\"]]"},
+    {9214, "epsg", 9214,
         "VN-2000 / TM-3 107-00", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=107 +k=0.9999 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,-1");
-    add_proj4text (p, 2,
-        "11.45032835,0.00928836,-0.01975479,0.00427372,0.25290627");
-    add_proj4text (p, 3,
-        "8 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 107-00\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",107],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9999],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9214\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9215, "epsg", 9215,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=107 +k=0.9999 +x_0=500000 +y"
+        "_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,-1"
+        "11.45032835,0.00928836,-0.01975479,0.00427372,0.25290627"
+        "8 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 107-00\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",107],PARAMETER[\"scal"
+        "e_factor\",0.9999],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"9214\"]]"},
+    {9215, "epsg", 9215,
         "VN-2000 / TM-3 107-15", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=107.25 +k=0.9999 +x_0=500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279");
-    add_proj4text (p, 2,
-        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290");
-    add_proj4text (p, 3,
-        "6278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 107-15\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",107.25],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9215\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9216, "epsg", 9216,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=107.25 +k=0.9999 +x_0=500000"
+        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279"
+        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290"
+        "6278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 107-15\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",107.25],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9215\"]]"},
+    {9216, "epsg", 9216,
         "VN-2000 / TM-3 107-30", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=107.5 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,");
-    add_proj4text (p, 2,
-        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906");
-    add_proj4text (p, 3,
-        "278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 107-30\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",107.5],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9216\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9217, "epsg", 9217,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=107.5 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,"
+        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906"
+        "278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 107-30\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",107.5],PARAMETER[\"sc"
+        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9216\"]]"},
+    {9217, "epsg", 9217,
         "VN-2000 / TM-3 108-15", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108.25 +k=0.9999 +x_0=500000");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279");
-    add_proj4text (p, 2,
-        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290");
-    add_proj4text (p, 3,
-        "6278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 108-15\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",108.25],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9217\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9218, "epsg", 9218,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=108.25 +k=0.9999 +x_0=500000"
+        " +y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279"
+        ",-111.45032835,0.00928836,-0.01975479,0.00427372,0.25290"
+        "6278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 108-15\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",108.25],PARAMETER[\"s"
+        "cale_factor\",0.9999],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"9217\"]]"},
+    {9218, "epsg", 9218,
         "VN-2000 / TM-3 108-30", 0, 0,
         "WGS 84", "Greenwich",
         "Vietnam_2000", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=108.5 +k=0.9999 +x_0=500000 ");
-    add_proj4text (p, 1,
-        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,");
-    add_proj4text (p, 2,
-        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906");
-    add_proj4text (p, 3,
-        "278 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"VN-2000 / TM-3 108-30\",GEOGCS[\"VN-2000\",DATU");
-    add_srs_wkt (p, 1,
-        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722");
-    add_srs_wkt (p, 2,
-        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",108.5],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9218\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9221, "epsg", 9221,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=108.5 +k=0.9999 +x_0=500000 "
+        "+y_0=0 +ellps=WGS84 +towgs84=-191.90441429,-39.30318279,"
+        "-111.45032835,0.00928836,-0.01975479,0.00427372,0.252906"
+        "278 +units=m +no_defs",
+        "PROJCS[\"VN-2000 / TM-3 108-30\",GEOGCS[\"VN-2000\",DATU"
+        "M[\"Vietnam_2000\",SPHEROID[\"WGS 84\",6378137,298.25722"
+        "3563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"EPSG\",\""
+        "6756\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4756\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",108.5],PARAMETER[\"sc"
+        "ale_factor\",0.9999],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"9218\"]]"},
+    {9221, "epsg", 9221,
         "Hartebeesthoek94 / ZAF BSU Albers 25E", 0, 1,
         "WGS 84", "Greenwich",
         "Hartebeesthoek94", "Albers_Conic_Equal_Area", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_0=-30 +lon_0=25 +lat_1=-22 +lat_2=-38 +x_");
-    add_proj4text (p, 1,
-        "0=1400000 +y_0=1300000 +ellps=WGS84 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / ZAF BSU Albers 25E\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Hartebeesthoek94\",DATUM[\"Hartebeesthoek94\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4148\"]],PROJECTION[\"Albers_Conic_Equal_Area\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_center\",-30],PARAMETER[\"long");
-    add_srs_wkt (p, 8,
-        "itude_of_center\",25],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 9,
-        "-22],PARAMETER[\"standard_parallel_2\",-38],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",1400000],PARAMETER[\"false_northing\",13");
-    add_srs_wkt (p, 11,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9221\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9222, "epsg", 9222,
+        "Northing", "North", "Easting", "East",
+        "+proj=aea +lat_0=-30 +lon_0=25 +lat_1=-22 +lat_2=-38 +x_"
+        "0=1400000 +y_0=1300000 +ellps=WGS84 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Hartebeesthoek94 / ZAF BSU Albers 25E\",GEOGCS["
+        "\"Hartebeesthoek94\",DATUM[\"Hartebeesthoek94\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4148\"]],PROJECTION[\"Albers_Conic_Equal_Area\""
+        "],PARAMETER[\"latitude_of_center\",-30],PARAMETER[\"long"
+        "itude_of_center\",25],PARAMETER[\"standard_parallel_1\","
+        "-22],PARAMETER[\"standard_parallel_2\",-38],PARAMETER[\""
+        "false_easting\",1400000],PARAMETER[\"false_northing\",13"
+        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"9221\"]]"},
+    {9222, "epsg", 9222,
         "Hartebeesthoek94 / ZAF BSU Albers 44E", 0, 1,
         "WGS 84", "Greenwich",
         "Hartebeesthoek94", "Albers_Conic_Equal_Area", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=aea +lat_0=-42 +lon_0=44 +lat_1=-34 +lat_2=-50 +x_");
-    add_proj4text (p, 1,
-        "0=1200000 +y_0=1300000 +ellps=WGS84 +towgs84=0,0,0,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Hartebeesthoek94 / ZAF BSU Albers 44E\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Hartebeesthoek94\",DATUM[\"Hartebeesthoek94\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4148\"]],PROJECTION[\"Albers_Conic_Equal_Area\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_center\",-42],PARAMETER[\"long");
-    add_srs_wkt (p, 8,
-        "itude_of_center\",44],PARAMETER[\"standard_parallel_1\",");
-    add_srs_wkt (p, 9,
-        "-34],PARAMETER[\"standard_parallel_2\",-50],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_easting\",1200000],PARAMETER[\"false_northing\",13");
-    add_srs_wkt (p, 11,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 12,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 13,
-        "\"EPSG\",\"9222\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9248, "epsg", 9248,
+        "Northing", "North", "Easting", "East",
+        "+proj=aea +lat_0=-42 +lon_0=44 +lat_1=-34 +lat_2=-50 +x_"
+        "0=1200000 +y_0=1300000 +ellps=WGS84 +towgs84=0,0,0,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Hartebeesthoek94 / ZAF BSU Albers 44E\",GEOGCS["
+        "\"Hartebeesthoek94\",DATUM[\"Hartebeesthoek94\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6148\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4148\"]],PROJECTION[\"Albers_Conic_Equal_Area\""
+        "],PARAMETER[\"latitude_of_center\",-42],PARAMETER[\"long"
+        "itude_of_center\",44],PARAMETER[\"standard_parallel_1\","
+        "-34],PARAMETER[\"standard_parallel_2\",-50],PARAMETER[\""
+        "false_easting\",1200000],PARAMETER[\"false_northing\",13"
+        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"9222\"]]"},
+    {9248, "epsg", 9248,
         "Tapi Aike", 1, 1,
         "International 1924", "Greenwich",
         "Tapi_Aike", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-192.26,65.72,132.08,");
-    add_proj4text (p, 1,
-        "0,0,0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"Tapi Aike\",DATUM[\"Tapi_Aike\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 1,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 2,
-        "]],AUTHORITY[\"EPSG\",\"1257\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 4,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\"");
-    add_srs_wkt (p, 5,
-        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"92");
-    add_srs_wkt (p, 6,
-        "48\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9249, "epsg", 9249,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-192.26,65.72,132.08,"
+        "0,0,0,0 +no_defs",
+        "GEOGCS[\"Tapi Aike\",DATUM[\"Tapi_Aike\",SPHEROID[\"Inte"
+        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\""
+        "]],AUTHORITY[\"EPSG\",\"1257\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\""
+        ",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"92"
+        "48\"]]"},
+    {9249, "epsg", 9249,
         "Tapi Aike / Argentina 1", 0, 1,
         "International 1924", "Greenwich",
         "Tapi_Aike", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-192.26,65.72,132.08,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tapi Aike / Argentina 1\",GEOGCS[\"Tapi Aike\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Tapi_Aike\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"1257\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9248\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",-90],PARAMETER[\"central_meridian\",-72],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",1500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"9249\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9250, "epsg", 9250,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0"
+        "=0 +ellps=intl +towgs84=-192.26,65.72,132.08,0,0,0,0 +un"
+        "its=m +no_defs",
+        "PROJCS[\"Tapi Aike / Argentina 1\",GEOGCS[\"Tapi Aike\","
+        "DATUM[\"Tapi_Aike\",SPHEROID[\"International 1924\",6378"
+        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"1257\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9248\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",-90],PARAMETER[\"central_meridian\",-72],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",1500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"9249\"]]"},
+    {9250, "epsg", 9250,
         "Tapi Aike / Argentina 2", 0, 1,
         "International 1924", "Greenwich",
         "Tapi_Aike", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-192.26,65.72,132.08,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tapi Aike / Argentina 2\",GEOGCS[\"Tapi Aike\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Tapi_Aike\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"1257\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9248\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",-90],PARAMETER[\"central_meridian\",-69],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",1],PARAMETER[\"false_easting\",2500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AUTHORITY[\"EPSG\",\"9250\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9251, "epsg", 9251,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0"
+        "=0 +ellps=intl +towgs84=-192.26,65.72,132.08,0,0,0,0 +un"
+        "its=m +no_defs",
+        "PROJCS[\"Tapi Aike / Argentina 2\",GEOGCS[\"Tapi Aike\","
+        "DATUM[\"Tapi_Aike\",SPHEROID[\"International 1924\",6378"
+        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"1257\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9248\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",-90],PARAMETER[\"central_meridian\",-69],PARAMETER["
+        "\"scale_factor\",1],PARAMETER[\"false_easting\",2500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\""
+        "Easting\",EAST],AUTHORITY[\"EPSG\",\"9250\"]]"},
+    {9251, "epsg", 9251,
         "MMN", 1, 1,
         "International 1924", "Greenwich",
         "Ministerio_de_Marina_Norte", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-9.5,122.9,138.2,0,0,");
-    add_proj4text (p, 1,
-        "0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MMN\",DATUM[\"Ministerio_de_Marina_Norte\",SPHE");
-    add_srs_wkt (p, 1,
-        "ROID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 2,
-        "\",\"7022\"]],AUTHORITY[\"EPSG\",\"1258\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 3,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 4,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"");
-    add_srs_wkt (p, 5,
-        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"9251\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9252, "epsg", 9252,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-9.5,122.9,138.2,0,0,"
+        "0,0 +no_defs",
+        "GEOGCS[\"MMN\",DATUM[\"Ministerio_de_Marina_Norte\",SPHE"
+        "ROID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG"
+        "\",\"7022\"]],AUTHORITY[\"EPSG\",\"1258\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\""
+        "Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"E"
+        "PSG\",\"9251\"]]"},
+    {9252, "epsg", 9252,
         "MMN / Argentina 2", 0, 1,
         "International 1924", "Greenwich",
         "Ministerio_de_Marina_Norte", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-9.5,122.9,138.2,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MMN / Argentina 2\",GEOGCS[\"MMN\",DATUM[\"Mini");
-    add_srs_wkt (p, 1,
-        "sterio_de_Marina_Norte\",SPHEROID[\"International 1924\"");
-    add_srs_wkt (p, 2,
-        ",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"1258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9251\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",-90],PARAMETER[\"central_meridian\",-69],PARAM");
-    add_srs_wkt (p, 8,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",250");
-    add_srs_wkt (p, 9,
-        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 10,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"9252\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9253, "epsg", 9253,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0"
+        "=0 +ellps=intl +towgs84=-9.5,122.9,138.2,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"MMN / Argentina 2\",GEOGCS[\"MMN\",DATUM[\"Mini"
+        "sterio_de_Marina_Norte\",SPHEROID[\"International 1924\""
+        ",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"E"
+        "PSG\",\"1258\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9251\"]],PRO"
+        "JECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of"
+        "_origin\",-90],PARAMETER[\"central_meridian\",-69],PARAM"
+        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",250"
+        "0000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AX"
+        "IS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"9252\"]]"},
+    {9253, "epsg", 9253,
         "MMS", 1, 1,
         "International 1924", "Greenwich",
         "Ministerio_de_Marina_Sur", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=intl +towgs84=-78.1,101.6,133.3,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"MMS\",DATUM[\"Ministerio_de_Marina_Sur\",SPHERO");
-    add_srs_wkt (p, 1,
-        "ID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 2,
-        ",\"7022\"]],AUTHORITY[\"EPSG\",\"1259\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 3,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 4,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 5,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 6,
-        "SG\",\"9253\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9254, "epsg", 9254,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=intl +towgs84=-78.1,101.6,133.3,0,0"
+        ",0,0 +no_defs",
+        "GEOGCS[\"MMS\",DATUM[\"Ministerio_de_Marina_Sur\",SPHERO"
+        "ID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\""
+        ",\"7022\"]],AUTHORITY[\"EPSG\",\"1259\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L"
+        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP"
+        "SG\",\"9253\"]]"},
+    {9254, "epsg", 9254,
         "MMS / Argentina 2", 0, 1,
         "International 1924", "Greenwich",
         "Ministerio_de_Marina_Sur", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-78.1,101.6,133.3,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MMS / Argentina 2\",GEOGCS[\"MMS\",DATUM[\"Mini");
-    add_srs_wkt (p, 1,
-        "sterio_de_Marina_Sur\",SPHEROID[\"International 1924\",6");
-    add_srs_wkt (p, 2,
-        "378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"1259\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9253\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",-90],PARAMETER[\"central_meridian\",-69],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",25000");
-    add_srs_wkt (p, 9,
-        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT");
-    add_srs_wkt (p, 10,
-        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"9254\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9265, "epsg", 9265,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0"
+        "=0 +ellps=intl +towgs84=-78.1,101.6,133.3,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"MMS / Argentina 2\",GEOGCS[\"MMS\",DATUM[\"Mini"
+        "sterio_de_Marina_Sur\",SPHEROID[\"International 1924\",6"
+        "378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPS"
+        "G\",\"1259\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9253\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",-90],PARAMETER[\"central_meridian\",-69],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",25000"
+        "00],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUT"
+        "HORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS"
+        "[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"9254\"]]"},
+    {9265, "epsg", 9265,
         "POSGAR 2007 / UTM zone 19S", 0, 0,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_2007", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 2007 / UTM zone 19S\",GEOGCS[\"POSGAR 20");
-    add_srs_wkt (p, 1,
-        "07\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPH");
-    add_srs_wkt (p, 2,
-        "EROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-69],PARAMETER[\"scale_factor\",0.9996],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 10,
-        "ing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 11,
-        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9265\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9267, "epsg", 9267,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=WGS84 +units=m +no_defs",
+        "PROJCS[\"POSGAR 2007 / UTM zone 19S\",GEOGCS[\"POSGAR 20"
+        "07\",DATUM[\"Posiciones_Geodesicas_Argentinas_2007\",SPH"
+        "EROID[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\""
+        ",\"7030\"]],AUTHORITY[\"EPSG\",\"1062\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"5340\"]],PROJECTION[\"Transverse_Mercator\""
+        "],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"centra"
+        "l_meridian\",-69],PARAMETER[\"scale_factor\",0.9996],PAR"
+        "AMETER[\"false_easting\",500000],PARAMETER[\"false_north"
+        "ing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90"
+        "01\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],A"
+        "UTHORITY[\"EPSG\",\"9265\"]]"},
+    {9267, "epsg", 9267,
         "MGI", 1, 1,
         "Bessel 1841", "Greenwich",
         "Militar-Geographische_Institut", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=bessel +towgs84=577.326,90.129,463.");
-    add_proj4text (p, 1,
-        "919,5.137,1.474,5.297,2.4232 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"MGI\",DATUM[\"Militar-Geographische Institut\"");
-    add_srs_wkt (p, 1,
-        ",ELLIPSOID[\"Bessel 1841\",6377397.155,299.1528128,LENGT");
-    add_srs_wkt (p, 2,
-        "HUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"");
-    add_srs_wkt (p, 3,
-        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g");
-    add_srs_wkt (p, 4,
-        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr");
-    add_srs_wkt (p, 5,
-        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon");
-    add_srs_wkt (p, 6,
-        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 7,
-        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN");
-    add_srs_wkt (p, 8,
-        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Austri");
-    add_srs_wkt (p, 9,
-        "a.\"],BBOX[46.4,9.53,49.02,17.17]],ID[\"EPSG\",9267]]");
-    p = add_epsg_def_ex (filter, first, last, 9271, "epsg", 9271,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=bessel +towgs84=577.326,90.129,463."
+        "919,5.137,1.474,5.297,2.4232 +no_defs",
+        "GEOGCRS[\"MGI\",DATUM[\"Militar-Geographische Institut\""
+        ",ELLIPSOID[\"Bessel 1841\",6377397.155,299.1528128,LENGT"
+        "HUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\""
+        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g"
+        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr"
+        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon"
+        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943"
+        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN"
+        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Austri"
+        "a.\"],BBOX[46.4,9.53,49.02,17.17]],ID[\"EPSG\",9267]]"},
+    {9271, "epsg", 9271,
         "MGI / Austria West", 0, 1,
         "Bessel 1841", "Greenwich",
         "Militar-Geographische_Institut", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=10.3333333333333 +k=1 +x_0=0");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5.");
-    add_proj4text (p, 2,
-        "137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria West\",GEOGCS[\"MGI\",DATUM[\"Mil");
-    add_srs_wkt (p, 1,
-        "itar-Geographische_Institut\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"43");
-    add_srs_wkt (p, 6,
-        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",10");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",0],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9271\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9272, "epsg", 9272,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=10.3333333333333 +k=1 +x_0=0"
+        " +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5."
+        "137,1.474,5.297,2.4232 +units=m +no_defs",
+        "PROJCS[\"MGI / Austria West\",GEOGCS[\"MGI\",DATUM[\"Mil"
+        "itar-Geographische_Institut\",SPHEROID[\"Bessel 1841\",6"
+        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT"
+        "HORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"43"
+        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",10"
+        ".3333333333333],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",0],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "9271\"]]"},
+    {9272, "epsg", 9272,
         "MGI / Austria Central", 0, 1,
         "Bessel 1841", "Greenwich",
         "Militar-Geographische_Institut", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=13.3333333333333 +k=1 +x_0=0");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5.");
-    add_proj4text (p, 2,
-        "137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria Central\",GEOGCS[\"MGI\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Militar-Geographische_Institut\",SPHEROID[\"Bessel 1841\"");
-    add_srs_wkt (p, 2,
-        ",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4312\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "3.3333333333333],PARAMETER[\"scale_factor\",1],PARAMETER");
-    add_srs_wkt (p, 9,
-        "[\"false_easting\",0],PARAMETER[\"false_northing\",0],UN");
-    add_srs_wkt (p, 10,
-        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 12,
-        "\"9272\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9273, "epsg", 9273,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=13.3333333333333 +k=1 +x_0=0"
+        " +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5."
+        "137,1.474,5.297,2.4232 +units=m +no_defs",
+        "PROJCS[\"MGI / Austria Central\",GEOGCS[\"MGI\",DATUM[\""
+        "Militar-Geographische_Institut\",SPHEROID[\"Bessel 1841\""
+        ",6377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],A"
+        "UTHORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4312\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "3.3333333333333],PARAMETER[\"scale_factor\",1],PARAMETER"
+        "[\"false_easting\",0],PARAMETER[\"false_northing\",0],UN"
+        "IT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nort"
+        "hing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\","
+        "\"9272\"]]"},
+    {9273, "epsg", 9273,
         "MGI / Austria East", 0, 1,
         "Bessel 1841", "Greenwich",
         "Militar-Geographische_Institut", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=16.3333333333333 +k=1 +x_0=0");
-    add_proj4text (p, 1,
-        " +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5.");
-    add_proj4text (p, 2,
-        "137,1.474,5.297,2.4232 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"MGI / Austria East\",GEOGCS[\"MGI\",DATUM[\"Mil");
-    add_srs_wkt (p, 1,
-        "itar-Geographische_Institut\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"43");
-    add_srs_wkt (p, 6,
-        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",16");
-    add_srs_wkt (p, 8,
-        ".3333333333333],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",0],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9273\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9284, "epsg", 9284,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=16.3333333333333 +k=1 +x_0=0"
+        " +y_0=0 +ellps=bessel +towgs84=577.326,90.129,463.919,5."
+        "137,1.474,5.297,2.4232 +units=m +no_defs",
+        "PROJCS[\"MGI / Austria East\",GEOGCS[\"MGI\",DATUM[\"Mil"
+        "itar-Geographische_Institut\",SPHEROID[\"Bessel 1841\",6"
+        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT"
+        "HORITY[\"EPSG\",\"6312\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"43"
+        "12\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",0],PARAMETER[\"central_meridian\",16"
+        ".3333333333333],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",0],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "9273\"]]"},
+    {9284, "epsg", 9284,
         "Pampa del Castillo / Argentina 1", 0, 1,
         "International 1924", "Greenwich",
         "Pampa_del_Castillo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pampa del Castillo / Argentina 1\",GEOGCS[\"Pam");
-    add_srs_wkt (p, 1,
-        "pa del Castillo\",DATUM[\"Pampa_del_Castillo\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7022\"]],AUTHORITY[\"EPSG\",\"6161\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4161\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-72],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",1500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9284\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9285, "epsg", 9285,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0"
+        "=0 +ellps=intl +units=m +no_defs",
+        "PROJCS[\"Pampa del Castillo / Argentina 1\",GEOGCS[\"Pam"
+        "pa del Castillo\",DATUM[\"Pampa_del_Castillo\",SPHEROID["
+        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\""
+        "7022\"]],AUTHORITY[\"EPSG\",\"6161\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4161\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-72],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",1500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"9284\"]]"},
+    {9285, "epsg", 9285,
         "Pampa del Castillo / Argentina 3", 0, 1,
         "International 1924", "Greenwich",
         "Pampa_del_Castillo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pampa del Castillo / Argentina 3\",GEOGCS[\"Pam");
-    add_srs_wkt (p, 1,
-        "pa del Castillo\",DATUM[\"Pampa_del_Castillo\",SPHEROID[");
-    add_srs_wkt (p, 2,
-        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7022\"]],AUTHORITY[\"EPSG\",\"6161\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4161\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-66],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",3500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"9285\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9286, "epsg", 9286,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0"
+        "=0 +ellps=intl +units=m +no_defs",
+        "PROJCS[\"Pampa del Castillo / Argentina 3\",GEOGCS[\"Pam"
+        "pa del Castillo\",DATUM[\"Pampa_del_Castillo\",SPHEROID["
+        "\"International 1924\",6378388,297,AUTHORITY[\"EPSG\",\""
+        "7022\"]],AUTHORITY[\"EPSG\",\"6161\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4161\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-66],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",3500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"9285\"]]"},
+    {9286, "epsg", 9286,
         "ETRS89", 1, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 + NAP height\",GEOGCS[\"ETRS89\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati");
-    add_srs_wkt (p, 6,
-        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 7,
-        ",\"4258\"]],VERT_CS[\"NAP height\",VERT_DATUM[\"Normaal ");
-    add_srs_wkt (p, 8,
-        "Amsterdams Peil\",2005,AUTHORITY[\"EPSG\",\"5109\"]],UNI");
-    add_srs_wkt (p, 9,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravi");
-    add_srs_wkt (p, 10,
-        "ty-related height\",UP],AUTHORITY[\"EPSG\",\"5709\"]],AU");
-    add_srs_wkt (p, 11,
-        "THORITY[\"EPSG\",\"9286\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9289, "epsg", 9289,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit"
+        "s=m +no_defs",
+        "COMPD_CS[\"ETRS89 + NAP height\",GEOGCS[\"ETRS89\",DATUM"
+        "[\"European_Terrestrial_Reference_System_1989\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"Lati"
+        "tude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EPSG\""
+        ",\"4258\"]],VERT_CS[\"NAP height\",VERT_DATUM[\"Normaal "
+        "Amsterdams Peil\",2005,AUTHORITY[\"EPSG\",\"5109\"]],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Gravi"
+        "ty-related height\",UP],AUTHORITY[\"EPSG\",\"5709\"]],AU"
+        "THORITY[\"EPSG\",\"9286\"]]"},
+    {9289, "epsg", 9289,
         "ETRS89", 1, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 + LAT NL depth\",GEOGCS[\"ETRS89\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"European_Terrestrial_Reference_System_1989\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4258\"]],VERT_CS[\"LAT NL depth\",VERT_DATUM[\"Lo");
-    add_srs_wkt (p, 8,
-        "west Astronomical Tide Netherlands\",2005,AUTHORITY[\"EP");
-    add_srs_wkt (p, 9,
-        "SG\",\"1290\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90");
-    add_srs_wkt (p, 10,
-        "01\"]],AXIS[\"Depth\",DOWN],AUTHORITY[\"EPSG\",\"9287\"]");
-    add_srs_wkt (p, 11,
-        "],AUTHORITY[\"EPSG\",\"9289\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9290, "epsg", 9290,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit"
+        "s=m +no_defs",
+        "COMPD_CS[\"ETRS89 + LAT NL depth\",GEOGCS[\"ETRS89\",DAT"
+        "UM[\"European_Terrestrial_Reference_System_1989\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L"
+        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP"
+        "SG\",\"4258\"]],VERT_CS[\"LAT NL depth\",VERT_DATUM[\"Lo"
+        "west Astronomical Tide Netherlands\",2005,AUTHORITY[\"EP"
+        "SG\",\"1290\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"90"
+        "01\"]],AXIS[\"Depth\",DOWN],AUTHORITY[\"EPSG\",\"9287\"]"
+        "],AUTHORITY[\"EPSG\",\"9289\"]]"},
+    {9290, "epsg", 9290,
         "ETRS89", 1, 0,
         "GRS 1980", "Greenwich",
         "European_Terrestrial_Reference_System_1989", "none", "degree",
-        "Latitude", "North", "Longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit");
-    add_proj4text (p, 1,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"ETRS89 + MSL NL depth\",GEOGCS[\"ETRS89\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"European_Terrestrial_Reference_System_1989\",SPHERO");
-    add_srs_wkt (p, 2,
-        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L");
-    add_srs_wkt (p, 6,
-        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP");
-    add_srs_wkt (p, 7,
-        "SG\",\"4258\"]],VERT_CS[\"MSL NL depth\",VERT_DATUM[\"Me");
-    add_srs_wkt (p, 8,
-        "an Sea Level Netherlands\",2005,AUTHORITY[\"EPSG\",\"127");
-    add_srs_wkt (p, 9,
-        "0\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 10,
-        "S[\"Depth\",DOWN],AUTHORITY[\"EPSG\",\"9288\"]],AUTHORIT");
-    add_srs_wkt (p, 11,
-        "Y[\"EPSG\",\"9290\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9293, "epsg", 9293,
+        "Latitude", "North", "Longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +vunit"
+        "s=m +no_defs",
+        "COMPD_CS[\"ETRS89 + MSL NL depth\",GEOGCS[\"ETRS89\",DAT"
+        "UM[\"European_Terrestrial_Reference_System_1989\",SPHERO"
+        "ID[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\""
+        ",\"7019\"]],AUTHORITY[\"EPSG\",\"6258\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AXIS[\"L"
+        "atitude\",NORTH],AXIS[\"Longitude\",EAST],AUTHORITY[\"EP"
+        "SG\",\"4258\"]],VERT_CS[\"MSL NL depth\",VERT_DATUM[\"Me"
+        "an Sea Level Netherlands\",2005,AUTHORITY[\"EPSG\",\"127"
+        "0\"]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Depth\",DOWN],AUTHORITY[\"EPSG\",\"9288\"]],AUTHORIT"
+        "Y[\"EPSG\",\"9290\"]]"},
+    {9293, "epsg", 9293,
         "ONGD17", 1, 1,
         "GRS 1980", "Greenwich",
         "Oman_National_Geodetic_Datum_2017", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"ONGD17\",DATUM[\"Oman National Geodetic Datum ");
-    add_srs_wkt (p, 1,
-        "2017\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENG");
-    add_srs_wkt (p, 2,
-        "THUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"");
-    add_srs_wkt (p, 3,
-        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g");
-    add_srs_wkt (p, 4,
-        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr");
-    add_srs_wkt (p, 5,
-        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon");
-    add_srs_wkt (p, 6,
-        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 7,
-        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN");
-    add_srs_wkt (p, 8,
-        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Oman -");
-    add_srs_wkt (p, 9,
-        " onshore and offshore.\"],BBOX[14.33,51.99,26.74,63.38]]");
-    add_srs_wkt (p, 10,
-        ",ID[\"EPSG\",9293]]");
-    p = add_epsg_def_ex (filter, first, last, 9294, "epsg", 9294,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"ONGD17\",DATUM[\"Oman National Geodetic Datum "
+        "2017\",ELLIPSOID[\"GRS 1980\",6378137,298.257222101,LENG"
+        "THUNIT[\"metre\",1]]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\""
+        "degree\",0.0174532925199433]],CS[ellipsoidal,3],AXIS[\"g"
+        "eodetic latitude (Lat)\",north,ORDER[1],ANGLEUNIT[\"degr"
+        "ee\",0.0174532925199433]],AXIS[\"geodetic longitude (Lon"
+        ")\",east,ORDER[2],ANGLEUNIT[\"degree\",0.017453292519943"
+        "3]],AXIS[\"ellipsoidal height (h)\",up,ORDER[3],LENGTHUN"
+        "IT[\"metre\",1]],USAGE[SCOPE[\"Geodesy.\"],AREA[\"Oman -"
+        " onshore and offshore.\"],BBOX[14.33,51.99,26.74,63.38]]"
+        ",ID[\"EPSG\",9293]]"},
+    {9294, "epsg", 9294,
         "ONGD17", 1, 1,
         "GRS 1980", "Greenwich",
         "Oman_National_Geodetic_Datum_2017", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ONGD17\",DATUM[\"Oman_National_Geodetic_Datum_2");
-    add_srs_wkt (p, 1,
-        "017\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1263\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9294\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9295, "epsg", 9295,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ONGD17\",DATUM[\"Oman_National_Geodetic_Datum_2"
+        "017\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1263\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"9294\"]]"},
+    {9295, "epsg", 9295,
         "ONGD17 / UTM zone 39N", 0, 0,
         "GRS 1980", "Greenwich",
         "Oman_National_Geodetic_Datum_2017", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ONGD17 / UTM zone 39N\",GEOGCS[\"ONGD17\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Oman_National_Geodetic_Datum_2017\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1263\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9294\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",51],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 10,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 11,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9295\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9296, "epsg", 9296,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=39 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"ONGD17 / UTM zone 39N\",GEOGCS[\"ONGD17\",DATUM"
+        "[\"Oman_National_Geodetic_Datum_2017\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1263\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"9294\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",51],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "9295\"]]"},
+    {9296, "epsg", 9296,
         "ONGD17 / UTM zone 40N", 0, 0,
         "GRS 1980", "Greenwich",
         "Oman_National_Geodetic_Datum_2017", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=40 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ONGD17 / UTM zone 40N\",GEOGCS[\"ONGD17\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Oman_National_Geodetic_Datum_2017\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1263\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9294\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 10,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 11,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9296\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9297, "epsg", 9297,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=40 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"ONGD17 / UTM zone 40N\",GEOGCS[\"ONGD17\",DATUM"
+        "[\"Oman_National_Geodetic_Datum_2017\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1263\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"9294\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "9296\"]]"},
+    {9297, "epsg", 9297,
         "ONGD17 / UTM zone 41N", 0, 0,
         "GRS 1980", "Greenwich",
         "Oman_National_Geodetic_Datum_2017", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=41 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ONGD17 / UTM zone 41N\",GEOGCS[\"ONGD17\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Oman_National_Geodetic_Datum_2017\",SPHEROID[\"GRS 19");
-    add_srs_wkt (p, 2,
-        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"1263\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"9294\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT");
-    add_srs_wkt (p, 10,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 11,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9297\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9299, "epsg", 9299,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=41 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"ONGD17 / UTM zone 41N\",GEOGCS[\"ONGD17\",DATUM"
+        "[\"Oman_National_Geodetic_Datum_2017\",SPHEROID[\"GRS 19"
+        "80\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]]"
+        ",AUTHORITY[\"EPSG\",\"1263\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"9294\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fals"
+        "e_easting\",500000],PARAMETER[\"false_northing\",0],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "9297\"]]"},
+    {9299, "epsg", 9299,
         "HS2-IRF", 1, 1,
         "GRS 1980", "Greenwich",
         "HS2_Intermediate_Reference_Frame", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"HS2-IRF\",DATUM[\"HS2_Intermediate_Reference_Fr");
-    add_srs_wkt (p, 1,
-        "ame\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR");
-    add_srs_wkt (p, 2,
-        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1264\"]],PR");
-    add_srs_wkt (p, 3,
-        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[");
-    add_srs_wkt (p, 4,
-        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"");
-    add_srs_wkt (p, 5,
-        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"9299\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9300, "epsg", 9300,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"HS2-IRF\",DATUM[\"HS2_Intermediate_Reference_Fr"
+        "ame\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUTHOR"
+        "ITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1264\"]],PR"
+        "IMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT["
+        "\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\""
+        "]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude\",EAST],AUT"
+        "HORITY[\"EPSG\",\"9299\"]]"},
+    {9300, "epsg", 9300,
         "HS2 Survey Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "HS2_Intermediate_Reference_Frame", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=52.3 +lon_0=-1.5 +k=1 +x_0=198873.004");
-    add_proj4text (p, 1,
-        "6 +y_0=375064.3871 +ellps=GRS80 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"HS2 Survey Grid\",GEOGCS[\"HS2-IRF\",DATUM[\"HS");
-    add_srs_wkt (p, 1,
-        "2_Intermediate_Reference_Frame\",SPHEROID[\"GRS 1980\",6");
-    add_srs_wkt (p, 2,
-        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"1264\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9299");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",52.3],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "1.5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",198873.0046],PARAMETER[\"false_northing\",375064.");
-    add_srs_wkt (p, 10,
-        "3871],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9300\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9306, "epsg", 9306,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=52.3 +lon_0=-1.5 +k=1 +x_0=198873.004"
+        "6 +y_0=375064.3871 +ellps=GRS80 +units=m +no_defs",
+        "PROJCS[\"HS2 Survey Grid\",GEOGCS[\"HS2-IRF\",DATUM[\"HS"
+        "2_Intermediate_Reference_Frame\",SPHEROID[\"GRS 1980\",6"
+        "378137,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHO"
+        "RITY[\"EPSG\",\"1264\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9299"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",52.3],PARAMETER[\"central_meridian\",-"
+        "1.5],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas"
+        "ting\",198873.0046],PARAMETER[\"false_northing\",375064."
+        "3871],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"9300\"]]"},
+    {9306, "epsg", 9306,
         "HS2 Survey Grid", 0, 0,
         "GRS 1980", "Greenwich",
         "HS2_Intermediate_Reference_Frame", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=52.3 +lon_0=-1.5 +k=1 +x_0=198873.004");
-    add_proj4text (p, 1,
-        "6 +y_0=375064.3871 +ellps=GRS80 +units=m +vunits=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "COMPD_CS[\"HS2 Survey Grid + HS2-VRF height\",PROJCS[\"H");
-    add_srs_wkt (p, 1,
-        "S2 Survey Grid\",GEOGCS[\"HS2-IRF\",DATUM[\"HS2_Intermed");
-    add_srs_wkt (p, 2,
-        "iate_Reference_Frame\",SPHEROID[\"GRS 1980\",6378137,298");
-    add_srs_wkt (p, 3,
-        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"1264\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9299\"]],PROJE");
-    add_srs_wkt (p, 7,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 8,
-        "rigin\",52.3],PARAMETER[\"central_meridian\",-1.5],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",198");
-    add_srs_wkt (p, 10,
-        "873.0046],PARAMETER[\"false_northing\",375064.3871],UNIT");
-    add_srs_wkt (p, 11,
-        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin");
-    add_srs_wkt (p, 12,
-        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 13,
-        "9300\"]],VERT_CS[\"HS2-VRF height\",VERT_DATUM[\"HS2 Ver");
-    add_srs_wkt (p, 14,
-        "tical Reference Frame\",2005,AUTHORITY[\"EPSG\",\"1265\"");
-    add_srs_wkt (p, 15,
-        "]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 16,
-        "Gravity-related height\",UP],AUTHORITY[\"EPSG\",\"9303\"");
-    add_srs_wkt (p, 17,
-        "]],AUTHORITY[\"EPSG\",\"9306\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9308, "epsg", 9308,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=52.3 +lon_0=-1.5 +k=1 +x_0=198873.004"
+        "6 +y_0=375064.3871 +ellps=GRS80 +units=m +vunits=m +no_d"
+        "efs",
+        "COMPD_CS[\"HS2 Survey Grid + HS2-VRF height\",PROJCS[\"H"
+        "S2 Survey Grid\",GEOGCS[\"HS2-IRF\",DATUM[\"HS2_Intermed"
+        "iate_Reference_Frame\",SPHEROID[\"GRS 1980\",6378137,298"
+        ".257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPS"
+        "G\",\"1264\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"9299\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",52.3],PARAMETER[\"central_meridian\",-1.5],PARAM"
+        "ETER[\"scale_factor\",1],PARAMETER[\"false_easting\",198"
+        "873.0046],PARAMETER[\"false_northing\",375064.3871],UNIT"
+        "[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eastin"
+        "g\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\""
+        "9300\"]],VERT_CS[\"HS2-VRF height\",VERT_DATUM[\"HS2 Ver"
+        "tical Reference Frame\",2005,AUTHORITY[\"EPSG\",\"1265\""
+        "]],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Gravity-related height\",UP],AUTHORITY[\"EPSG\",\"9303\""
+        "]],AUTHORITY[\"EPSG\",\"9306\"]]"},
+    {9308, "epsg", 9308,
         "ATRF2014", 1, 1,
         "GRS 1980", "Greenwich",
         "Australian_Terrestrial_Reference_Frame_2014", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"ATRF2014\",DYNAMIC[FRAMEEPOCH[2020]],DATUM[\"A");
-    add_srs_wkt (p, 1,
-        "ustralian Terrestrial Reference Frame 2014\",ELLIPSOID[\"");
-    add_srs_wkt (p, 2,
-        "GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\",1]");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174532");
-    add_srs_wkt (p, 4,
-        "925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude (");
-    add_srs_wkt (p, 5,
-        "Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 6,
-        "99433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],");
-    add_srs_wkt (p, 7,
-        "ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellipso");
-    add_srs_wkt (p, 8,
-        "idal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],U");
-    add_srs_wkt (p, 9,
-        "SAGE[SCOPE[\"Location-based services, Intelligent Transp");
-    add_srs_wkt (p, 10,
-        "ort Services, navigation, positioning.\"],AREA[\"Austral");
-    add_srs_wkt (p, 11,
-        "ia including Lord Howe Island, Macquarie Islands, Ashmor");
-    add_srs_wkt (p, 12,
-        "e and Cartier Islands, Christmas Island, Cocos (Keeling)");
-    add_srs_wkt (p, 13,
-        " Islands, Norfolk Island. All onshore and offshore.\"],B");
-    add_srs_wkt (p, 14,
-        "BOX[-60.56,93.41,-8.47,173.35]],ID[\"EPSG\",9308]]");
-    p = add_epsg_def_ex (filter, first, last, 9309, "epsg", 9309,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCRS[\"ATRF2014\",DYNAMIC[FRAMEEPOCH[2020]],DATUM[\"A"
+        "ustralian Terrestrial Reference Frame 2014\",ELLIPSOID[\""
+        "GRS 1980\",6378137,298.257222101,LENGTHUNIT[\"metre\",1]"
+        "]],PRIMEM[\"Greenwich\",0,ANGLEUNIT[\"degree\",0.0174532"
+        "925199433]],CS[ellipsoidal,3],AXIS[\"geodetic latitude ("
+        "Lat)\",north,ORDER[1],ANGLEUNIT[\"degree\",0.01745329251"
+        "99433]],AXIS[\"geodetic longitude (Lon)\",east,ORDER[2],"
+        "ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"ellipso"
+        "idal height (h)\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],U"
+        "SAGE[SCOPE[\"Location-based services, Intelligent Transp"
+        "ort Services, navigation, positioning.\"],AREA[\"Austral"
+        "ia including Lord Howe Island, Macquarie Islands, Ashmor"
+        "e and Cartier Islands, Christmas Island, Cocos (Keeling)"
+        " Islands, Norfolk Island. All onshore and offshore.\"],B"
+        "BOX[-60.56,93.41,-8.47,173.35]],ID[\"EPSG\",9308]]"},
+    {9309, "epsg", 9309,
         "ATRF2014", 1, 1,
         "GRS 1980", "Greenwich",
         "Australian_Terrestrial_Reference_Frame_2014", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"ATRF2014\",DATUM[\"Australian_Terrestrial_Refer");
-    add_srs_wkt (p, 1,
-        "ence_Frame_2014\",SPHEROID[\"GRS 1980\",6378137,298.2572");
-    add_srs_wkt (p, 2,
-        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "1291\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude");
-    add_srs_wkt (p, 6,
-        "\",EAST],AUTHORITY[\"EPSG\",\"9309\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9311, "epsg", 9311,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +no_defs",
+        "GEOGCS[\"ATRF2014\",DATUM[\"Australian_Terrestrial_Refer"
+        "ence_Frame_2014\",SPHEROID[\"GRS 1980\",6378137,298.2572"
+        "22101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\""
+        "1291\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS[\"Longitude"
+        "\",EAST],AUTHORITY[\"EPSG\",\"9309\"]]"},
+    {9311, "epsg", 9311,
         "NAD27 / US National Atlas Equal Area", 0, 0,
         "Clarke 1866", "Greenwich",
         "North_American_Datum_1927", "Lambert_Azimuthal_Equal_Area", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=laea +lat_0=45 +lon_0=-100 +x_0=0 +y_0=0 +datum=NA");
-    add_proj4text (p, 1,
-        "D27 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"NAD27 / US National Atlas Equal Area\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C");
-    add_srs_wkt (p, 2,
-        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Lambert_Azimuthal_E");
-    add_srs_wkt (p, 7,
-        "qual_Area\"],PARAMETER[\"latitude_of_center\",45],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"longitude_of_center\",-100],PARAMETER[\"false_east");
-    add_srs_wkt (p, 9,
-        "ing\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"9311\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9332, "epsg", 9332,
+        "Easting", "East", "Northing", "North",
+        "+proj=laea +lat_0=45 +lon_0=-100 +x_0=0 +y_0=0 +datum=NA"
+        "D27 +units=m +no_defs",
+        "PROJCS[\"NAD27 / US National Atlas Equal Area\",GEOGCS[\""
+        "NAD27\",DATUM[\"North_American_Datum_1927\",SPHEROID[\"C"
+        "larke 1866\",6378206.4,294.978698213898,AUTHORITY[\"EPSG"
+        "\",\"7008\"]],AUTHORITY[\"EPSG\",\"6267\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4267\"]],PROJECTION[\"Lambert_Azimuthal_E"
+        "qual_Area\"],PARAMETER[\"latitude_of_center\",45],PARAME"
+        "TER[\"longitude_of_center\",-100],PARAMETER[\"false_east"
+        "ing\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"9311\"]]"},
+    {9332, "epsg", 9332,
         "KSA-GRF17", 1, 1,
         "GRS 1980", "Greenwich",
         "Kingdom_of_Saudi_Arabia_Geodetic_Reference_Frame_2017", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,-0.008393,0.00");
-    add_proj4text (p, 1,
-        "0749,-0.010276,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCRS[\"KSA-GRF17\",DATUM[\"Kingdom of Saudi Arabia Ge");
-    add_srs_wkt (p, 1,
-        "odetic Reference Frame 2017\",ELLIPSOID[\"GRS 1980\",637");
-    add_srs_wkt (p, 2,
-        "8137,298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Gr");
-    add_srs_wkt (p, 3,
-        "eenwich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS");
-    add_srs_wkt (p, 4,
-        "[ellipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,O");
-    add_srs_wkt (p, 5,
-        "RDER[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\"");
-    add_srs_wkt (p, 6,
-        "geodetic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"deg");
-    add_srs_wkt (p, 7,
-        "ree\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)");
-    add_srs_wkt (p, 8,
-        "\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Ge");
-    add_srs_wkt (p, 9,
-        "odesy, cadastre, engineering survey, topographic mapping");
-    add_srs_wkt (p, 10,
-        ".\"],AREA[\"Saudi Arabia - onshore and offshore.\"],BBOX");
-    add_srs_wkt (p, 11,
-        "[16.29,34.44,32.16,55.67]],ID[\"EPSG\",9332]]");
-    p = add_epsg_def_ex (filter, first, last, 9333, "epsg", 9333,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,-0.008393,0.00"
+        "0749,-0.010276,0 +no_defs",
+        "GEOGCRS[\"KSA-GRF17\",DATUM[\"Kingdom of Saudi Arabia Ge"
+        "odetic Reference Frame 2017\",ELLIPSOID[\"GRS 1980\",637"
+        "8137,298.257222101,LENGTHUNIT[\"metre\",1]]],PRIMEM[\"Gr"
+        "eenwich\",0,ANGLEUNIT[\"degree\",0.0174532925199433]],CS"
+        "[ellipsoidal,3],AXIS[\"geodetic latitude (Lat)\",north,O"
+        "RDER[1],ANGLEUNIT[\"degree\",0.0174532925199433]],AXIS[\""
+        "geodetic longitude (Lon)\",east,ORDER[2],ANGLEUNIT[\"deg"
+        "ree\",0.0174532925199433]],AXIS[\"ellipsoidal height (h)"
+        "\",up,ORDER[3],LENGTHUNIT[\"metre\",1]],USAGE[SCOPE[\"Ge"
+        "odesy, cadastre, engineering survey, topographic mapping"
+        ".\"],AREA[\"Saudi Arabia - onshore and offshore.\"],BBOX"
+        "[16.29,34.44,32.16,55.67]],ID[\"EPSG\",9332]]"},
+    {9333, "epsg", 9333,
         "KSA-GRF17", 1, 1,
         "GRS 1980", "Greenwich",
         "Kingdom_of_Saudi_Arabia_Geodetic_Reference_Frame_2017", "none", "degree",
-        "Geodetic latitude", "North", "Geodetic longitude", "East");
-    add_proj4text (p, 0,
-        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,-0.008393,0.00");
-    add_proj4text (p, 1,
-        "0749,-0.010276,0 +no_defs");
-    add_srs_wkt (p, 0,
-        "GEOGCS[\"KSA-GRF17\",DATUM[\"Kingdom_of_Saudi_Arabia_Geo");
-    add_srs_wkt (p, 1,
-        "detic_Reference_Frame_2017\",SPHEROID[\"GRS 1980\",63781");
-    add_srs_wkt (p, 2,
-        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"1268\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS");
-    add_srs_wkt (p, 6,
-        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9333\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9354, "epsg", 9354,
+        "Geodetic latitude", "North", "Geodetic longitude", "East",
+        "+proj=longlat +ellps=GRS80 +towgs84=0,0,0,-0.008393,0.00"
+        "0749,-0.010276,0 +no_defs",
+        "GEOGCS[\"KSA-GRF17\",DATUM[\"Kingdom_of_Saudi_Arabia_Geo"
+        "detic_Reference_Frame_2017\",SPHEROID[\"GRS 1980\",63781"
+        "37,298.257222101,AUTHORITY[\"EPSG\",\"7019\"]],AUTHORITY"
+        "[\"EPSG\",\"1268\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AXIS[\"Latitude\",NORTH],AXIS"
+        "[\"Longitude\",EAST],AUTHORITY[\"EPSG\",\"9333\"]]"},
+    {9354, "epsg", 9354,
         "WGS 84 / IBCSO Polar Stereographic", 0, 0,
         "WGS 84", "Greenwich",
         "WGS_1984", "Polar_Stereographic", "metre",
-        "Easting", "North", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=stere +lat_0=-90 +lat_ts=-65 +lon_0=0 +x_0=0 +y_0=");
-    add_proj4text (p, 1,
-        "0 +datum=WGS84 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"WGS 84 / IBCSO Polar Stereographic\",GEOGCS[\"W");
-    add_srs_wkt (p, 1,
-        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2");
-    add_srs_wkt (p, 2,
-        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 3,
-        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 4,
-        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 5,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO");
-    add_srs_wkt (p, 6,
-        "JECTION[\"Polar_Stereographic\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",-65],PARAMETER[\"central_meridian\",0],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],");
-    add_srs_wkt (p, 9,
-        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea");
-    add_srs_wkt (p, 10,
-        "sting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9354\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9356, "epsg", 9356,
+        "Easting", "North", "Northing", "North",
+        "+proj=stere +lat_0=-90 +lat_ts=-65 +lon_0=0 +x_0=0 +y_0="
+        "0 +datum=WGS84 +units=m +no_defs",
+        "PROJCS[\"WGS 84 / IBCSO Polar Stereographic\",GEOGCS[\"W"
+        "GS 84\",DATUM[\"WGS_1984\",SPHEROID[\"WGS 84\",6378137,2"
+        "98.257223563,AUTHORITY[\"EPSG\",\"7030\"]],AUTHORITY[\"E"
+        "PSG\",\"6326\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG"
+        "\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4326\"]],PRO"
+        "JECTION[\"Polar_Stereographic\"],PARAMETER[\"latitude_of"
+        "_origin\",-65],PARAMETER[\"central_meridian\",0],PARAMET"
+        "ER[\"false_easting\",0],PARAMETER[\"false_northing\",0],"
+        "UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Ea"
+        "sting\",NORTH],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"9354\"]]"},
+    {9356, "epsg", 9356,
         "KSA-GRF17 / UTM zone 36N", 0, 0,
         "GRS 1980", "Greenwich",
         "Kingdom_of_Saudi_Arabia_Geodetic_Reference_Frame_2017", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +ellps=GRS80 +towgs84=0,0,0,-0.008393");
-    add_proj4text (p, 1,
-        ",0.000749,-0.010276,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KSA-GRF17 / UTM zone 36N\",GEOGCS[\"KSA-GRF17\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Kingdom_of_Saudi_Arabia_Geodetic_Reference_Fram");
-    add_srs_wkt (p, 2,
-        "e_2017\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1268\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"9333\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",33],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 9,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 12,
-        "ORTH],AUTHORITY[\"EPSG\",\"9356\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9357, "epsg", 9357,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=36 +ellps=GRS80 +towgs84=0,0,0,-0.008393"
+        ",0.000749,-0.010276,0 +units=m +no_defs",
+        "PROJCS[\"KSA-GRF17 / UTM zone 36N\",GEOGCS[\"KSA-GRF17\""
+        ",DATUM[\"Kingdom_of_Saudi_Arabia_Geodetic_Reference_Fram"
+        "e_2017\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1268\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"9333\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",33],PARAMETER[\"scale_factor"
+        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"9356\"]]"},
+    {9357, "epsg", 9357,
         "KSA-GRF17 / UTM zone 37N", 0, 0,
         "GRS 1980", "Greenwich",
         "Kingdom_of_Saudi_Arabia_Geodetic_Reference_Frame_2017", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=37 +ellps=GRS80 +towgs84=0,0,0,-0.008393");
-    add_proj4text (p, 1,
-        ",0.000749,-0.010276,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KSA-GRF17 / UTM zone 37N\",GEOGCS[\"KSA-GRF17\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Kingdom_of_Saudi_Arabia_Geodetic_Reference_Fram");
-    add_srs_wkt (p, 2,
-        "e_2017\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1268\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"9333\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",39],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 9,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 12,
-        "ORTH],AUTHORITY[\"EPSG\",\"9357\"]]");
-    p = add_epsg_def_ex (filter, first, last, 9358, "epsg", 9358,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=37 +ellps=GRS80 +towgs84=0,0,0,-0.008393"
+        ",0.000749,-0.010276,0 +units=m +no_defs",
+        "PROJCS[\"KSA-GRF17 / UTM zone 37N\",GEOGCS[\"KSA-GRF17\""
+        ",DATUM[\"Kingdom_of_Saudi_Arabia_Geodetic_Reference_Fram"
+        "e_2017\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1268\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"9333\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",39],PARAMETER[\"scale_factor"
+        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"9357\"]]"},
+    {9358, "epsg", 9358,
         "KSA-GRF17 / UTM zone 38N", 0, 0,
         "GRS 1980", "Greenwich",
         "Kingdom_of_Saudi_Arabia_Geodetic_Reference_Frame_2017", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=GRS80 +towgs84=0,0,0,-0.008393");
-    add_proj4text (p, 1,
-        ",0.000749,-0.010276,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"KSA-GRF17 / UTM zone 38N\",GEOGCS[\"KSA-GRF17\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Kingdom_of_Saudi_Arabia_Geodetic_Reference_Fram");
-    add_srs_wkt (p, 2,
-        "e_2017\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1268\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 5,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 6,
-        "22\"]],AUTHORITY[\"EPSG\",\"9333\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 7,
-        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"central_meridian\",45],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 9,
-        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER");
-    add_srs_wkt (p, 10,
-        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 12,
-        "ORTH],AUTHORITY[\"EPSG\",\"9358\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=38 +ellps=GRS80 +towgs84=0,0,0,-0.008393"
+        ",0.000749,-0.010276,0 +units=m +no_defs",
+        "PROJCS[\"KSA-GRF17 / UTM zone 38N\",GEOGCS[\"KSA-GRF17\""
+        ",DATUM[\"Kingdom_of_Saudi_Arabia_Geodetic_Reference_Fram"
+        "e_2017\",SPHEROID[\"GRS 1980\",6378137,298.257222101,AUT"
+        "HORITY[\"EPSG\",\"7019\"]],AUTHORITY[\"EPSG\",\"1268\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"9333\"]],PROJECTION[\"Transv"
+        "erse_Mercator\"],PARAMETER[\"latitude_of_origin\",0],PAR"
+        "AMETER[\"central_meridian\",45],PARAMETER[\"scale_factor"
+        "\",0.9996],PARAMETER[\"false_easting\",500000],PARAMETER"
+        "[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",N"
+        "ORTH],AUTHORITY[\"EPSG\",\"9358\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_45 = {
+    epsg_defs_45, sizeof (epsg_defs_45) / sizeof (epsg_defs_45[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
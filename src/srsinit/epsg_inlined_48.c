@@ -53,3613 +53,2065 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_48 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 21481, "epsg", 21481,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_48[] = {
+    {21481, "epsg", 21481,
         "Beijing 1954 / Gauss-Kruger CM 123E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 123E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4214\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "23],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 9,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"21461\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 21482, "epsg", 21482,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=123 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 123E\",GEOGCS[\""
+        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow"
+        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A"
+        "UTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4214\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "23],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east"
+        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"21461\""
+        "]]"},
+    {21482, "epsg", 21482,
         "Beijing 1954 / Gauss-Kruger CM 129E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 129E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4214\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "29],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 9,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"21462\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 21483, "epsg", 21483,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=129 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 129E\",GEOGCS[\""
+        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow"
+        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A"
+        "UTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4214\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "29],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east"
+        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"21462\""
+        "]]"},
+    {21483, "epsg", 21483,
         "Beijing 1954 / Gauss-Kruger CM 135E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Beijing_1954", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 135E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4214\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "35],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 9,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"21463\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 21500, "epsg", 21500,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=135 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=15.8,-154.4,-82.3,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"Beijing 1954 / Gauss-Kruger CM 135E\",GEOGCS[\""
+        "Beijing 1954\",DATUM[\"Beijing_1954\",SPHEROID[\"Krassow"
+        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A"
+        "UTHORITY[\"EPSG\",\"6214\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4214\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "35],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east"
+        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"21463\""
+        "]]"},
+    {21500, "epsg", 21500,
         "Belge 1950 (Brussels) / Belge Lambert 50", 0, 0,
         "International 1924", "Brussels",
         "Reseau_National_Belge_1950_Brussels", "Lambert_Conformal_Conic_2SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=49.83333333333334 +lat_2=51.16666666666");
-    add_proj4text (p, 1,
-        "666 +lat_0=90 +lon_0=0 +x_0=150000 +y_0=5400000 +ellps=i");
-    add_proj4text (p, 2,
-        "ntl +pm=brussels +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Belge 1950 (Brussels) / Belge Lambert 50\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Belge 1950 (Brussels)\",DATUM[\"Reseau_National_Bel");
-    add_srs_wkt (p, 2,
-        "ge_1950_Brussels\",SPHEROID[\"International 1924\",63783");
-    add_srs_wkt (p, 3,
-        "88,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"6809\"]],PRIMEM[\"Brussels\",4.367975,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"8910\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI");
-    add_srs_wkt (p, 6,
-        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4809\"]],PRO");
-    add_srs_wkt (p, 7,
-        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 8,
-        "itude_of_origin\",90],PARAMETER[\"central_meridian\",0],");
-    add_srs_wkt (p, 9,
-        "PARAMETER[\"standard_parallel_1\",49.8333333333333],PARA");
-    add_srs_wkt (p, 10,
-        "METER[\"standard_parallel_2\",51.1666666666667],PARAMETE");
-    add_srs_wkt (p, 11,
-        "R[\"false_easting\",150000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 12,
-        ",5400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 13,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 14,
-        "TY[\"EPSG\",\"21500\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21780, "epsg", 21780,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=49.83333333333334 +lat_2=51.16666666666"
+        "666 +lat_0=90 +lon_0=0 +x_0=150000 +y_0=5400000 +ellps=i"
+        "ntl +pm=brussels +units=m +no_defs",
+        "PROJCS[\"Belge 1950 (Brussels) / Belge Lambert 50\",GEOG"
+        "CS[\"Belge 1950 (Brussels)\",DATUM[\"Reseau_National_Bel"
+        "ge_1950_Brussels\",SPHEROID[\"International 1924\",63783"
+        "88,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\","
+        "\"6809\"]],PRIMEM[\"Brussels\",4.367975,AUTHORITY[\"EPSG"
+        "\",\"8910\"]],UNIT[\"degree\",0.0174532925199433,AUTHORI"
+        "TY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4809\"]],PRO"
+        "JECTION[\"Lambert_Conformal_Conic_2SP\"],PARAMETER[\"lat"
+        "itude_of_origin\",90],PARAMETER[\"central_meridian\",0],"
+        "PARAMETER[\"standard_parallel_1\",49.8333333333333],PARA"
+        "METER[\"standard_parallel_2\",51.1666666666667],PARAMETE"
+        "R[\"false_easting\",150000],PARAMETER[\"false_northing\""
+        ",5400000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"21500\"]]"},
+    {21780, "epsg", 21780,
         "Bern 1898 (Bern) / LV03C", 0, 0,
         "Bessel 1841", "Bern",
         "CH1903_Bern", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=46.95240555555556 +lon_0=0 +k_0=1 +x");
-    add_proj4text (p, 1,
-        "_0=0 +y_0=0 +ellps=bessel +towgs84=674.374,15.056,405.34");
-    add_proj4text (p, 2,
-        "6,0,0,0,0 +pm=bern +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bern 1898 (Bern) / LV03C\",GEOGCS[\"Bern 1898 (");
-    add_srs_wkt (p, 1,
-        "Bern)\",DATUM[\"CH1903_Bern\",SPHEROID[\"Bessel 1841\",6");
-    add_srs_wkt (p, 2,
-        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6801\"]],PRIMEM[\"Bern\",7.43958333333");
-    add_srs_wkt (p, 4,
-        "333,AUTHORITY[\"EPSG\",\"8907\"]],UNIT[\"degree\",0.0174");
-    add_srs_wkt (p, 5,
-        "532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"E");
-    add_srs_wkt (p, 6,
-        "PSG\",\"4801\"]],PROJECTION[\"Hotine_Oblique_Mercator_Az");
-    add_srs_wkt (p, 7,
-        "imuth_Center\"],PARAMETER[\"latitude_of_center\",46.9524");
-    add_srs_wkt (p, 8,
-        "055555556],PARAMETER[\"longitude_of_center\",0],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"azimuth\",90],PARAMETER[\"rectified_grid_angle\",90]");
-    add_srs_wkt (p, 10,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 11,
-        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A");
-    add_srs_wkt (p, 12,
-        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"21780\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21781, "epsg", 21781,
+        "Easting", "East", "Northing", "North",
+        "+proj=somerc +lat_0=46.95240555555556 +lon_0=0 +k_0=1 +x"
+        "_0=0 +y_0=0 +ellps=bessel +towgs84=674.374,15.056,405.34"
+        "6,0,0,0,0 +pm=bern +units=m +no_defs",
+        "PROJCS[\"Bern 1898 (Bern) / LV03C\",GEOGCS[\"Bern 1898 ("
+        "Bern)\",DATUM[\"CH1903_Bern\",SPHEROID[\"Bessel 1841\",6"
+        "377397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUT"
+        "HORITY[\"EPSG\",\"6801\"]],PRIMEM[\"Bern\",7.43958333333"
+        "333,AUTHORITY[\"EPSG\",\"8907\"]],UNIT[\"degree\",0.0174"
+        "532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"E"
+        "PSG\",\"4801\"]],PROJECTION[\"Hotine_Oblique_Mercator_Az"
+        "imuth_Center\"],PARAMETER[\"latitude_of_center\",46.9524"
+        "055555556],PARAMETER[\"longitude_of_center\",0],PARAMETE"
+        "R[\"azimuth\",90],PARAMETER[\"rectified_grid_angle\",90]"
+        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting"
+        "\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,A"
+        "UTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS"
+        "[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"21780\"]]"},
+    {21781, "epsg", 21781,
         "CH1903 / LV03", 0, 0,
         "Bessel 1841", "Greenwich",
         "CH1903", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=46.95240555555556 +lon_0=7.439583333");
-    add_proj4text (p, 1,
-        "333333 +k_0=1 +x_0=600000 +y_0=200000 +ellps=bessel +tow");
-    add_proj4text (p, 2,
-        "gs84=674.374,15.056,405.346,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CH1903 / LV03\",GEOGCS[\"CH1903\",DATUM[\"CH190");
-    add_srs_wkt (p, 1,
-        "3\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6149\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4149\"]],PROJECTION[\"Hotine");
-    add_srs_wkt (p, 6,
-        "_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"latitude");
-    add_srs_wkt (p, 7,
-        "_of_center\",46.9524055555556],PARAMETER[\"longitude_of_");
-    add_srs_wkt (p, 8,
-        "center\",7.43958333333333],PARAMETER[\"azimuth\",90],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"rectified_grid_angle\",90],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 10,
-        "ctor\",1],PARAMETER[\"false_easting\",600000],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_northing\",200000],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 13,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"21781\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21782, "epsg", 21782,
+        "Easting", "East", "Northing", "North",
+        "+proj=somerc +lat_0=46.95240555555556 +lon_0=7.439583333"
+        "333333 +k_0=1 +x_0=600000 +y_0=200000 +ellps=bessel +tow"
+        "gs84=674.374,15.056,405.346,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"CH1903 / LV03\",GEOGCS[\"CH1903\",DATUM[\"CH190"
+        "3\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,AUT"
+        "HORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6149\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4149\"]],PROJECTION[\"Hotine"
+        "_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"latitude"
+        "_of_center\",46.9524055555556],PARAMETER[\"longitude_of_"
+        "center\",7.43958333333333],PARAMETER[\"azimuth\",90],PAR"
+        "AMETER[\"rectified_grid_angle\",90],PARAMETER[\"scale_fa"
+        "ctor\",1],PARAMETER[\"false_easting\",600000],PARAMETER["
+        "\"false_northing\",200000],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"21781\"]]"},
+    {21782, "epsg", 21782,
         "CH1903 / LV03C-G", 0, 0,
         "Bessel 1841", "Greenwich",
         "CH1903", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=46.95240555555556 +lon_0=7.439583333");
-    add_proj4text (p, 1,
-        "333333 +k_0=1 +x_0=0 +y_0=0 +ellps=bessel +towgs84=674.3");
-    add_proj4text (p, 2,
-        "74,15.056,405.346,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"CH1903 / LV03C-G\",GEOGCS[\"CH1903\",DATUM[\"CH");
-    add_srs_wkt (p, 1,
-        "1903\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,");
-    add_srs_wkt (p, 2,
-        "AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6149\"");
-    add_srs_wkt (p, 3,
-        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],");
-    add_srs_wkt (p, 4,
-        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 5,
-        "9122\"]],AUTHORITY[\"EPSG\",\"4149\"]],PROJECTION[\"Hoti");
-    add_srs_wkt (p, 6,
-        "ne_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 7,
-        "de_of_center\",46.9524055555556],PARAMETER[\"longitude_o");
-    add_srs_wkt (p, 8,
-        "f_center\",7.43958333333333],PARAMETER[\"azimuth\",90],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"rectified_grid_angle\",90],PARAMETER[\"scale_");
-    add_srs_wkt (p, 10,
-        "factor\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"f");
-    add_srs_wkt (p, 11,
-        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]");
-    add_srs_wkt (p, 13,
-        ",AUTHORITY[\"EPSG\",\"21782\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21817, "epsg", 21817,
+        "Easting", "East", "Northing", "North",
+        "+proj=somerc +lat_0=46.95240555555556 +lon_0=7.439583333"
+        "333333 +k_0=1 +x_0=0 +y_0=0 +ellps=bessel +towgs84=674.3"
+        "74,15.056,405.346,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"CH1903 / LV03C-G\",GEOGCS[\"CH1903\",DATUM[\"CH"
+        "1903\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528128,"
+        "AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6149\""
+        "]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],"
+        "UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\""
+        "9122\"]],AUTHORITY[\"EPSG\",\"4149\"]],PROJECTION[\"Hoti"
+        "ne_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"latitu"
+        "de_of_center\",46.9524055555556],PARAMETER[\"longitude_o"
+        "f_center\",7.43958333333333],PARAMETER[\"azimuth\",90],P"
+        "ARAMETER[\"rectified_grid_angle\",90],PARAMETER[\"scale_"
+        "factor\",1],PARAMETER[\"false_easting\",0],PARAMETER[\"f"
+        "alse_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\""
+        "9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH]"
+        ",AUTHORITY[\"EPSG\",\"21782\"]]"},
+    {21817, "epsg", 21817,
         "Bogota 1975 / UTM zone 17N (deprecated)", 0, 0,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +ellps=intl +towgs84=307,304,-318,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / UTM zone 17N (deprecated)\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inter");
-    add_srs_wkt (p, 2,
-        "national 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4218\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-81],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas");
-    add_srs_wkt (p, 11,
-        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"21817\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21818, "epsg", 21818,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +ellps=intl +towgs84=307,304,-318,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / UTM zone 17N (deprecated)\",GEOGC"
+        "S[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inter"
+        "national 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]"
+        "],AUTHORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4218\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-81],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Eas"
+        "ting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\""
+        ",\"21817\"]]"},
+    {21818, "epsg", 21818,
         "Bogota 1975 / UTM zone 18N", 0, 0,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=intl +towgs84=307,304,-318,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / UTM zone 18N\",GEOGCS[\"Bogota 19");
-    add_srs_wkt (p, 1,
-        "75\",DATUM[\"Bogota_1975\",SPHEROID[\"International 1924");
-    add_srs_wkt (p, 2,
-        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",-75],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\"");
-    add_srs_wkt (p, 9,
-        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",");
-    add_srs_wkt (p, 10,
-        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"21818\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21891, "epsg", 21891,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=intl +towgs84=307,304,-318,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / UTM zone 18N\",GEOGCS[\"Bogota 19"
+        "75\",DATUM[\"Bogota_1975\",SPHEROID[\"International 1924"
+        "\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\""
+        "EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",-75],PARAME"
+        "TER[\"scale_factor\",0.9996],PARAMETER[\"false_easting\""
+        ",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre\","
+        "1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],A"
+        "XIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"21818\"]]"},
+    {21891, "epsg", 21891,
         "Bogota 1975 / Colombia West zone", 0, 1,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-77.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia West zone\",GEOGCS[\"Bog");
-    add_srs_wkt (p, 1,
-        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",4.59904722222222],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-77.0809166666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AUTHORITY[\"EPSG\",\"21896\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21892, "epsg", 21892,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-77.08091666"
+        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs"
+        "84=307,304,-318,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / Colombia West zone\",GEOGCS[\"Bog"
+        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa"
+        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO"
+        "RITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",4.59904722222222],PARAMETER[\"central_"
+        "meridian\",-77.0809166666667],PARAMETER[\"scale_factor\""
+        ",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal"
+        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\","
+        "EAST],AUTHORITY[\"EPSG\",\"21896\"]]"},
+    {21892, "epsg", 21892,
         "Bogota 1975 / Colombia Bogota zone", 0, 1,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-74.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia Bogota zone\",GEOGCS[\"B");
-    add_srs_wkt (p, 1,
-        "ogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internatio");
-    add_srs_wkt (p, 2,
-        "nal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "18\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",4.59904722222222],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-74.0809166666667],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 9,
-        "\",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AUTHORITY[\"EPSG\",\"21897\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21893, "epsg", 21893,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-74.08091666"
+        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs"
+        "84=307,304,-318,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / Colombia Bogota zone\",GEOGCS[\"B"
+        "ogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internatio"
+        "nal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUT"
+        "HORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "18\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",4.59904722222222],PARAMETER[\"centra"
+        "l_meridian\",-74.0809166666667],PARAMETER[\"scale_factor"
+        "\",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"f"
+        "alse_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\""
+        ",EAST],AUTHORITY[\"EPSG\",\"21897\"]]"},
+    {21893, "epsg", 21893,
         "Bogota 1975 / Colombia East Central zone", 0, 1,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-71.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia East Central zone\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 2,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4218\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",4.59904722222222],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-71.0809166666667],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 9,
-        "actor\",1],PARAMETER[\"false_easting\",1000000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas");
-    add_srs_wkt (p, 12,
-        "ting\",EAST],AUTHORITY[\"EPSG\",\"21898\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21894, "epsg", 21894,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-71.08091666"
+        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs"
+        "84=307,304,-318,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / Colombia East Central zone\",GEOG"
+        "CS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inte"
+        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\""
+        "]],AUTHORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4218\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",4.59904722222222],PARAMETER[\"c"
+        "entral_meridian\",-71.0809166666667],PARAMETER[\"scale_f"
+        "actor\",1],PARAMETER[\"false_easting\",1000000],PARAMETE"
+        "R[\"false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas"
+        "ting\",EAST],AUTHORITY[\"EPSG\",\"21898\"]]"},
+    {21894, "epsg", 21894,
         "Bogota 1975 / Colombia East zone", 0, 1,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-68.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia East zone\",GEOGCS[\"Bog");
-    add_srs_wkt (p, 1,
-        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",4.59904722222222],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-68.0809166666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AUTHORITY[\"EPSG\",\"21899\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21896, "epsg", 21896,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-68.08091666"
+        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs"
+        "84=307,304,-318,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / Colombia East zone\",GEOGCS[\"Bog"
+        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa"
+        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO"
+        "RITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",4.59904722222222],PARAMETER[\"central_"
+        "meridian\",-68.0809166666667],PARAMETER[\"scale_factor\""
+        ",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal"
+        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\","
+        "EAST],AUTHORITY[\"EPSG\",\"21899\"]]"},
+    {21896, "epsg", 21896,
         "Bogota 1975 / Colombia West zone", 0, 1,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-77.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia West zone\",GEOGCS[\"Bog");
-    add_srs_wkt (p, 1,
-        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",4.59904722222222],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-77.0809166666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AUTHORITY[\"EPSG\",\"21896\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21897, "epsg", 21897,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-77.08091666"
+        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs"
+        "84=307,304,-318,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / Colombia West zone\",GEOGCS[\"Bog"
+        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa"
+        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO"
+        "RITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",4.59904722222222],PARAMETER[\"central_"
+        "meridian\",-77.0809166666667],PARAMETER[\"scale_factor\""
+        ",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal"
+        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\","
+        "EAST],AUTHORITY[\"EPSG\",\"21896\"]]"},
+    {21897, "epsg", 21897,
         "Bogota 1975 / Colombia Bogota zone", 0, 1,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-74.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia Bogota zone\",GEOGCS[\"B");
-    add_srs_wkt (p, 1,
-        "ogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internatio");
-    add_srs_wkt (p, 2,
-        "nal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42");
-    add_srs_wkt (p, 6,
-        "18\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l");
-    add_srs_wkt (p, 7,
-        "atitude_of_origin\",4.59904722222222],PARAMETER[\"centra");
-    add_srs_wkt (p, 8,
-        "l_meridian\",-74.0809166666667],PARAMETER[\"scale_factor");
-    add_srs_wkt (p, 9,
-        "\",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\"");
-    add_srs_wkt (p, 12,
-        ",EAST],AUTHORITY[\"EPSG\",\"21897\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21898, "epsg", 21898,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-74.08091666"
+        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs"
+        "84=307,304,-318,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / Colombia Bogota zone\",GEOGCS[\"B"
+        "ogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internatio"
+        "nal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUT"
+        "HORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"42"
+        "18\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"l"
+        "atitude_of_origin\",4.59904722222222],PARAMETER[\"centra"
+        "l_meridian\",-74.0809166666667],PARAMETER[\"scale_factor"
+        "\",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"f"
+        "alse_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\""
+        ",EAST],AUTHORITY[\"EPSG\",\"21897\"]]"},
+    {21898, "epsg", 21898,
         "Bogota 1975 / Colombia East Central zone", 0, 1,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-71.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia East Central zone\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inte");
-    add_srs_wkt (p, 2,
-        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4218\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",4.59904722222222],PARAMETER[\"c");
-    add_srs_wkt (p, 8,
-        "entral_meridian\",-71.0809166666667],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 9,
-        "actor\",1],PARAMETER[\"false_easting\",1000000],PARAMETE");
-    add_srs_wkt (p, 10,
-        "R[\"false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas");
-    add_srs_wkt (p, 12,
-        "ting\",EAST],AUTHORITY[\"EPSG\",\"21898\"]]");
-    p = add_epsg_def_ex (filter, first, last, 21899, "epsg", 21899,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-71.08091666"
+        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs"
+        "84=307,304,-318,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / Colombia East Central zone\",GEOG"
+        "CS[\"Bogota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Inte"
+        "rnational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\""
+        "]],AUTHORITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4218\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",4.59904722222222],PARAMETER[\"c"
+        "entral_meridian\",-71.0809166666667],PARAMETER[\"scale_f"
+        "actor\",1],PARAMETER[\"false_easting\",1000000],PARAMETE"
+        "R[\"false_northing\",1000000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Eas"
+        "ting\",EAST],AUTHORITY[\"EPSG\",\"21898\"]]"},
+    {21899, "epsg", 21899,
         "Bogota 1975 / Colombia East zone", 0, 1,
         "International 1924", "Greenwich",
         "Bogota_1975", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-68.08091666");
-    add_proj4text (p, 1,
-        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs");
-    add_proj4text (p, 2,
-        "84=307,304,-318,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Bogota 1975 / Colombia East zone\",GEOGCS[\"Bog");
-    add_srs_wkt (p, 1,
-        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa");
-    add_srs_wkt (p, 2,
-        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",4.59904722222222],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-68.0809166666667],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 9,
-        ",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal");
-    add_srs_wkt (p, 10,
-        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 11,
-        "\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\",");
-    add_srs_wkt (p, 12,
-        "EAST],AUTHORITY[\"EPSG\",\"21899\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22032, "epsg", 22032,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=4.599047222222222 +lon_0=-68.08091666"
+        "666667 +k=1 +x_0=1000000 +y_0=1000000 +ellps=intl +towgs"
+        "84=307,304,-318,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Bogota 1975 / Colombia East zone\",GEOGCS[\"Bog"
+        "ota 1975\",DATUM[\"Bogota_1975\",SPHEROID[\"Internationa"
+        "l 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHO"
+        "RITY[\"EPSG\",\"6218\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4218"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",4.59904722222222],PARAMETER[\"central_"
+        "meridian\",-68.0809166666667],PARAMETER[\"scale_factor\""
+        ",1],PARAMETER[\"false_easting\",1000000],PARAMETER[\"fal"
+        "se_northing\",1000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG"
+        "\",\"9001\"]],AXIS[\"Northing\",NORTH],AXIS[\"Easting\","
+        "EAST],AUTHORITY[\"EPSG\",\"21899\"]]"},
+    {22032, "epsg", 22032,
         "Camacupa 1948 / UTM zone 32S", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Camacupa_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +south +ellps=clrk80 +towgs84=-50.9,-");
-    add_proj4text (p, 1,
-        "347.6,-231,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Camacupa 1948 / UTM zone 32S\",GEOGCS[\"Camacup");
-    add_srs_wkt (p, 1,
-        "a 1948\",DATUM[\"Camacupa_1948\",SPHEROID[\"Clarke 1880 ");
-    add_srs_wkt (p, 2,
-        "(RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6220\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4220\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",500000],PARAMETER[\"false_northing\",100000");
-    add_srs_wkt (p, 10,
-        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E");
-    add_srs_wkt (p, 12,
-        "PSG\",\"22032\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22033, "epsg", 22033,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +south +ellps=clrk80 +towgs84=-50.9,-"
+        "347.6,-231,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Camacupa 1948 / UTM zone 32S\",GEOGCS[\"Camacup"
+        "a 1948\",DATUM[\"Camacupa_1948\",SPHEROID[\"Clarke 1880 "
+        "(RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]"
+        "],AUTHORITY[\"EPSG\",\"6220\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4220\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",9],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fal"
+        "se_easting\",500000],PARAMETER[\"false_northing\",100000"
+        "00],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS["
+        "\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"E"
+        "PSG\",\"22032\"]]"},
+    {22033, "epsg", 22033,
         "Camacupa 1948 / UTM zone 33S", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Camacupa_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +south +ellps=clrk80 +towgs84=-50.9,-");
-    add_proj4text (p, 1,
-        "347.6,-231,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Camacupa 1948 / UTM zone 33S\",GEOGCS[\"Camacup");
-    add_srs_wkt (p, 1,
-        "a 1948\",DATUM[\"Camacupa_1948\",SPHEROID[\"Clarke 1880 ");
-    add_srs_wkt (p, 2,
-        "(RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6220\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4220\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",10000");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"22033\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22091, "epsg", 22091,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +south +ellps=clrk80 +towgs84=-50.9,-"
+        "347.6,-231,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Camacupa 1948 / UTM zone 33S\",GEOGCS[\"Camacup"
+        "a 1948\",DATUM[\"Camacupa_1948\",SPHEROID[\"Clarke 1880 "
+        "(RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]"
+        "],AUTHORITY[\"EPSG\",\"6220\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4220\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",10000"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"22033\"]]"},
+    {22091, "epsg", 22091,
         "Camacupa 1948 / TM 11.30 SE", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Camacupa_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=11.5 +k=0.9996 +x_0=500000 +");
-    add_proj4text (p, 1,
-        "y_0=10000000 +ellps=clrk80 +towgs84=-50.9,-347.6,-231,0,");
-    add_proj4text (p, 2,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Camacupa 1948 / TM 11.30 SE\",GEOGCS[\"Camacupa");
-    add_srs_wkt (p, 1,
-        " 1948\",DATUM[\"Camacupa_1948\",SPHEROID[\"Clarke 1880 (");
-    add_srs_wkt (p, 2,
-        "RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]]");
-    add_srs_wkt (p, 3,
-        ",AUTHORITY[\"EPSG\",\"6220\"]],PRIMEM[\"Greenwich\",0,AU");
-    add_srs_wkt (p, 4,
-        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925");
-    add_srs_wkt (p, 5,
-        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 6,
-        "\"4220\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",11.5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",10000");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"22091\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22092, "epsg", 22092,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=11.5 +k=0.9996 +x_0=500000 +"
+        "y_0=10000000 +ellps=clrk80 +towgs84=-50.9,-347.6,-231,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Camacupa 1948 / TM 11.30 SE\",GEOGCS[\"Camacupa"
+        " 1948\",DATUM[\"Camacupa_1948\",SPHEROID[\"Clarke 1880 ("
+        "RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]]"
+        ",AUTHORITY[\"EPSG\",\"6220\"]],PRIMEM[\"Greenwich\",0,AU"
+        "THORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925"
+        "199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\","
+        "\"4220\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER"
+        "[\"latitude_of_origin\",0],PARAMETER[\"central_meridian\""
+        ",11.5],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",10000"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"22091\"]]"},
+    {22092, "epsg", 22092,
         "Camacupa 1948 / TM 12 SE", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Camacupa_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9996 +x_0=500000 +y_");
-    add_proj4text (p, 1,
-        "0=10000000 +ellps=clrk80 +towgs84=-50.9,-347.6,-231,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Camacupa 1948 / TM 12 SE\",GEOGCS[\"Camacupa 19");
-    add_srs_wkt (p, 1,
-        "48\",DATUM[\"Camacupa_1948\",SPHEROID[\"Clarke 1880 (RGS");
-    add_srs_wkt (p, 2,
-        ")\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6220\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "220\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "2],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",500000],PARAMETER[\"false_northing\",10000000]");
-    add_srs_wkt (p, 10,
-        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E");
-    add_srs_wkt (p, 11,
-        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 12,
-        "\",\"22092\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22171, "epsg", 22171,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=12 +k=0.9996 +x_0=500000 +y_"
+        "0=10000000 +ellps=clrk80 +towgs84=-50.9,-347.6,-231,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Camacupa 1948 / TM 12 SE\",GEOGCS[\"Camacupa 19"
+        "48\",DATUM[\"Camacupa_1948\",SPHEROID[\"Clarke 1880 (RGS"
+        ")\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AU"
+        "THORITY[\"EPSG\",\"6220\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "220\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "2],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_"
+        "easting\",500000],PARAMETER[\"false_northing\",10000000]"
+        ",UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"E"
+        "asting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG"
+        "\",\"22092\"]]"},
+    {22171, "epsg", 22171,
         "POSGAR 98 / Argentina 1", 0, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 1\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-72],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",1500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22171\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22172, "epsg", 22172,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 98 / Argentina 1\",GEOGCS[\"POSGAR 98\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-72],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",1500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22171\"]]"},
+    {22172, "epsg", 22172,
         "POSGAR 98 / Argentina 2", 0, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 2\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-69],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",2500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22172\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22173, "epsg", 22173,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 98 / Argentina 2\",GEOGCS[\"POSGAR 98\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-69],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",2500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22172\"]]"},
+    {22173, "epsg", 22173,
         "POSGAR 98 / Argentina 3", 0, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 3\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-66],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",3500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22173\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22174, "epsg", 22174,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 98 / Argentina 3\",GEOGCS[\"POSGAR 98\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-66],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",3500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22173\"]]"},
+    {22174, "epsg", 22174,
         "POSGAR 98 / Argentina 4", 0, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 4\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-63],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",4500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22174\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22175, "epsg", 22175,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 98 / Argentina 4\",GEOGCS[\"POSGAR 98\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-63],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",4500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22174\"]]"},
+    {22175, "epsg", 22175,
         "POSGAR 98 / Argentina 5", 0, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 5\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-60],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",5500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22175\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22176, "epsg", 22176,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 98 / Argentina 5\",GEOGCS[\"POSGAR 98\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-60],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",5500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22175\"]]"},
+    {22176, "epsg", 22176,
         "POSGAR 98 / Argentina 6", 0, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 6\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-57],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",6500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22176\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22177, "epsg", 22177,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 98 / Argentina 6\",GEOGCS[\"POSGAR 98\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-57],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",6500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22176\"]]"},
+    {22177, "epsg", 22177,
         "POSGAR 98 / Argentina 7", 0, 1,
         "GRS 1980", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1998", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 98 / Argentina 7\",GEOGCS[\"POSGAR 98\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-54],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",7500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22177\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22181, "epsg", 22181,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0"
+        "=0 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 98 / Argentina 7\",GEOGCS[\"POSGAR 98\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1998\",SPHEROID"
+        "[\"GRS 1980\",6378137,298.257222101,AUTHORITY[\"EPSG\",\""
+        "7019\"]],AUTHORITY[\"EPSG\",\"6190\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4190\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-54],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",7500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22177\"]]"},
+    {22181, "epsg", 22181,
         "POSGAR 94 / Argentina 1", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 1\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-72],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",1500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22181\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22182, "epsg", 22182,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0"
+        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 94 / Argentina 1\",GEOGCS[\"POSGAR 94\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-72],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",1500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22181\"]]"},
+    {22182, "epsg", 22182,
         "POSGAR 94 / Argentina 2", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 2\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-69],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",2500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22182\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22183, "epsg", 22183,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0"
+        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 94 / Argentina 2\",GEOGCS[\"POSGAR 94\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-69],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",2500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22182\"]]"},
+    {22183, "epsg", 22183,
         "POSGAR 94 / Argentina 3", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 3\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-66],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",3500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22183\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22184, "epsg", 22184,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0"
+        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 94 / Argentina 3\",GEOGCS[\"POSGAR 94\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-66],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",3500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22183\"]]"},
+    {22184, "epsg", 22184,
         "POSGAR 94 / Argentina 4", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 4\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-63],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",4500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22184\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22185, "epsg", 22185,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0"
+        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 94 / Argentina 4\",GEOGCS[\"POSGAR 94\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-63],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",4500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22184\"]]"},
+    {22185, "epsg", 22185,
         "POSGAR 94 / Argentina 5", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 5\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-60],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",5500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22185\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22186, "epsg", 22186,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0"
+        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 94 / Argentina 5\",GEOGCS[\"POSGAR 94\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-60],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",5500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22185\"]]"},
+    {22186, "epsg", 22186,
         "POSGAR 94 / Argentina 6", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 6\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-57],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",6500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22186\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22187, "epsg", 22187,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0"
+        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 94 / Argentina 6\",GEOGCS[\"POSGAR 94\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-57],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",6500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22186\"]]"},
+    {22187, "epsg", 22187,
         "POSGAR 94 / Argentina 7", 0, 1,
         "WGS 84", "Greenwich",
         "Posiciones_Geodesicas_Argentinas_1994", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"POSGAR 94 / Argentina 7\",GEOGCS[\"POSGAR 94\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID");
-    add_srs_wkt (p, 2,
-        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7");
-    add_srs_wkt (p, 3,
-        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich");
-    add_srs_wkt (p, 4,
-        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017");
-    add_srs_wkt (p, 5,
-        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA");
-    add_srs_wkt (p, 7,
-        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_");
-    add_srs_wkt (p, 8,
-        "meridian\",-54],PARAMETER[\"scale_factor\",1],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",7500000],PARAMETER[\"false_northing\",");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"22187\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22191, "epsg", 22191,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0"
+        "=0 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"POSGAR 94 / Argentina 7\",GEOGCS[\"POSGAR 94\","
+        "DATUM[\"Posiciones_Geodesicas_Argentinas_1994\",SPHEROID"
+        "[\"WGS 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7"
+        "030\"]],AUTHORITY[\"EPSG\",\"6694\"]],PRIMEM[\"Greenwich"
+        "\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017"
+        "4532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4694\"]],PROJECTION[\"Transverse_Mercator\"],PA"
+        "RAMETER[\"latitude_of_origin\",-90],PARAMETER[\"central_"
+        "meridian\",-54],PARAMETER[\"scale_factor\",1],PARAMETER["
+        "\"false_easting\",7500000],PARAMETER[\"false_northing\","
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPS"
+        "G\",\"22187\"]]"},
+    {22191, "epsg", 22191,
         "Campo Inchauspe / Argentina 1", 0, 1,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 1\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-72],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219");
-    add_srs_wkt (p, 12,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22192, "epsg", 22192,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-72 +k=1 +x_0=1500000 +y_0"
+        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"Campo Inchauspe / Argentina 1\",GEOGCS[\"Campo "
+        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\""
+        ",-72],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",1500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219"
+        "1\"]]"},
+    {22192, "epsg", 22192,
         "Campo Inchauspe / Argentina 2", 0, 1,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 2\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-69],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",2500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219");
-    add_srs_wkt (p, 12,
-        "2\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22193, "epsg", 22193,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-69 +k=1 +x_0=2500000 +y_0"
+        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"Campo Inchauspe / Argentina 2\",GEOGCS[\"Campo "
+        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\""
+        ",-69],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",2500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219"
+        "2\"]]"},
+    {22193, "epsg", 22193,
         "Campo Inchauspe / Argentina 3", 0, 1,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 3\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-66],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",3500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219");
-    add_srs_wkt (p, 12,
-        "3\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22194, "epsg", 22194,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-66 +k=1 +x_0=3500000 +y_0"
+        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"Campo Inchauspe / Argentina 3\",GEOGCS[\"Campo "
+        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\""
+        ",-66],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",3500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219"
+        "3\"]]"},
+    {22194, "epsg", 22194,
         "Campo Inchauspe / Argentina 4", 0, 1,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 4\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-63],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",4500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219");
-    add_srs_wkt (p, 12,
-        "4\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22195, "epsg", 22195,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-63 +k=1 +x_0=4500000 +y_0"
+        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"Campo Inchauspe / Argentina 4\",GEOGCS[\"Campo "
+        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\""
+        ",-63],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",4500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219"
+        "4\"]]"},
+    {22195, "epsg", 22195,
         "Campo Inchauspe / Argentina 5", 0, 1,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 5\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-60],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",5500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219");
-    add_srs_wkt (p, 12,
-        "5\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22196, "epsg", 22196,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-60 +k=1 +x_0=5500000 +y_0"
+        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"Campo Inchauspe / Argentina 5\",GEOGCS[\"Campo "
+        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\""
+        ",-60],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",5500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219"
+        "5\"]]"},
+    {22196, "epsg", 22196,
         "Campo Inchauspe / Argentina 6", 0, 1,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 6\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-57],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",6500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219");
-    add_srs_wkt (p, 12,
-        "6\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22197, "epsg", 22197,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-57 +k=1 +x_0=6500000 +y_0"
+        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"Campo Inchauspe / Argentina 6\",GEOGCS[\"Campo "
+        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\""
+        ",-57],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",6500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219"
+        "6\"]]"},
+    {22197, "epsg", 22197,
         "Campo Inchauspe / Argentina 7", 0, 1,
         "International 1924", "Greenwich",
         "Campo_Inchauspe", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no");
-    add_proj4text (p, 2,
-        "_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Campo Inchauspe / Argentina 7\",GEOGCS[\"Campo ");
-    add_srs_wkt (p, 1,
-        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna");
-    add_srs_wkt (p, 2,
-        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\"");
-    add_srs_wkt (p, 8,
-        ",-54],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea");
-    add_srs_wkt (p, 9,
-        "sting\",7500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\"");
-    add_srs_wkt (p, 11,
-        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219");
-    add_srs_wkt (p, 12,
-        "7\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22234, "epsg", 22234,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=-90 +lon_0=-54 +k=1 +x_0=7500000 +y_0"
+        "=0 +ellps=intl +towgs84=-148,136,90,0,0,0,0 +units=m +no"
+        "_defs",
+        "PROJCS[\"Campo Inchauspe / Argentina 7\",GEOGCS[\"Campo "
+        "Inchauspe\",DATUM[\"Campo_Inchauspe\",SPHEROID[\"Interna"
+        "tional 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],"
+        "AUTHORITY[\"EPSG\",\"6221\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4221\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",-90],PARAMETER[\"central_meridian\""
+        ",-54],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_ea"
+        "sting\",7500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\""
+        ",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2219"
+        "7\"]]"},
+    {22234, "epsg", 22234,
         "Cape / UTM zone 34S", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +south +a=6378249.145 +b=6356514.9663");
-    add_proj4text (p, 1,
-        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / UTM zone 34S\",GEOGCS[\"Cape\",DATUM[\"C");
-    add_srs_wkt (p, 1,
-        "ape\",SPHEROID[\"Clarke 1880 (Arc)\",6378249.145,293.466");
-    add_srs_wkt (p, 2,
-        "3077,AUTHORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6222\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",21],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22234\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22235, "epsg", 22235,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=34 +south +a=6378249.145 +b=6356514.9663"
+        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / UTM zone 34S\",GEOGCS[\"Cape\",DATUM[\"C"
+        "ape\",SPHEROID[\"Clarke 1880 (Arc)\",6378249.145,293.466"
+        "3077,AUTHORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\""
+        "6222\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",21],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22234\"]]"},
+    {22235, "epsg", 22235,
         "Cape / UTM zone 35S", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +south +a=6378249.145 +b=6356514.9663");
-    add_proj4text (p, 1,
-        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / UTM zone 35S\",GEOGCS[\"Cape\",DATUM[\"C");
-    add_srs_wkt (p, 1,
-        "ape\",SPHEROID[\"Clarke 1880 (Arc)\",6378249.145,293.466");
-    add_srs_wkt (p, 2,
-        "3077,AUTHORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6222\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",27],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22235\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22236, "epsg", 22236,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=35 +south +a=6378249.145 +b=6356514.9663"
+        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / UTM zone 35S\",GEOGCS[\"Cape\",DATUM[\"C"
+        "ape\",SPHEROID[\"Clarke 1880 (Arc)\",6378249.145,293.466"
+        "3077,AUTHORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\""
+        "6222\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",27],PARAMETER[\"scale"
+        "_factor\",0.9996],PARAMETER[\"false_easting\",500000],PA"
+        "RAMETER[\"false_northing\",10000000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22235\"]]"},
+    {22236, "epsg", 22236,
         "Cape / UTM zone 36S (deprecated)", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +south +a=6378249.145 +b=6356514.9663");
-    add_proj4text (p, 1,
-        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / UTM zone 36S (deprecated)\",GEOGCS[\"Cap");
-    add_srs_wkt (p, 1,
-        "e\",DATUM[\"Cape\",SPHEROID[\"Clarke 1880 (Arc)\",637824");
-    add_srs_wkt (p, 2,
-        "9.145,293.4663077,AUTHORITY[\"EPSG\",\"7013\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4222\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",33],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"222");
-    add_srs_wkt (p, 12,
-        "36\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22275, "epsg", 22275,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=36 +south +a=6378249.145 +b=6356514.9663"
+        "98753 +towgs84=-136,-108,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / UTM zone 36S (deprecated)\",GEOGCS[\"Cap"
+        "e\",DATUM[\"Cape\",SPHEROID[\"Clarke 1880 (Arc)\",637824"
+        "9.145,293.4663077,AUTHORITY[\"EPSG\",\"7013\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6222\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4222\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",33],PARA"
+        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"222"
+        "36\"]]"},
+    {22275, "epsg", 22275,
         "Cape / Lo15", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo15\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",15],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22275\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22277, "epsg", 22277,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo15\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",15],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22275\"]]"},
+    {22277, "epsg", 22277,
         "Cape / Lo17", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=17 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo17\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",17],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22277\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22279, "epsg", 22279,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=17 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo17\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",17],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22277\"]]"},
+    {22279, "epsg", 22279,
         "Cape / Lo19", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=19 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo19\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",19],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22279\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22281, "epsg", 22281,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=19 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo19\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",19],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22279\"]]"},
+    {22281, "epsg", 22281,
         "Cape / Lo21", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo21\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",21],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22281\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22283, "epsg", 22283,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=21 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo21\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",21],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22281\"]]"},
+    {22283, "epsg", 22283,
         "Cape / Lo23", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=23 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo23\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",23],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22283\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22285, "epsg", 22285,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=23 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo23\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",23],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22283\"]]"},
+    {22285, "epsg", 22285,
         "Cape / Lo25", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=25 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo25\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",25],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22285\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22287, "epsg", 22287,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=25 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo25\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",25],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22285\"]]"},
+    {22287, "epsg", 22287,
         "Cape / Lo27", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo27\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",27],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22287\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22289, "epsg", 22289,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=27 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo27\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",27],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22287\"]]"},
+    {22289, "epsg", 22289,
         "Cape / Lo29", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=29 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo29\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",29],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22289\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22291, "epsg", 22291,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=29 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo29\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",29],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22289\"]]"},
+    {22291, "epsg", 22291,
         "Cape / Lo31", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo31\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",31],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22291\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22293, "epsg", 22293,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=31 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo31\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",31],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22291\"]]"},
+    {22293, "epsg", 22293,
         "Cape / Lo33", 0, 0,
         "Clarke 1880 (Arc)", "Greenwich",
         "Cape", "Transverse_Mercator_South_Orientated", "metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=0 +y_0=0 +axis=");
-    add_proj4text (p, 1,
-        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1");
-    add_proj4text (p, 2,
-        "08,-292,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Cape / Lo33\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP");
-    add_srs_wkt (p, 1,
-        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT");
-    add_srs_wkt (p, 2,
-        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]");
-    add_srs_wkt (p, 3,
-        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN");
-    add_srs_wkt (p, 4,
-        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91");
-    add_srs_wkt (p, 5,
-        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv");
-    add_srs_wkt (p, 6,
-        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",0],PARAMETER[\"central_meridian\",33],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA");
-    add_srs_wkt (p, 9,
-        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South");
-    add_srs_wkt (p, 11,
-        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22293\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22332, "epsg", 22332,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=0 +lon_0=33 +k=1 +x_0=0 +y_0=0 +axis="
+        "wsu +a=6378249.145 +b=6356514.966398753 +towgs84=-136,-1"
+        "08,-292,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Cape / Lo33\",GEOGCS[\"Cape\",DATUM[\"Cape\",SP"
+        "HEROID[\"Clarke 1880 (Arc)\",6378249.145,293.4663077,AUT"
+        "HORITY[\"EPSG\",\"7013\"]],AUTHORITY[\"EPSG\",\"6222\"]]"
+        ",PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UN"
+        "IT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"91"
+        "22\"]],AUTHORITY[\"EPSG\",\"4222\"]],PROJECTION[\"Transv"
+        "erse_Mercator_South_Orientated\"],PARAMETER[\"latitude_o"
+        "f_origin\",0],PARAMETER[\"central_meridian\",33],PARAMET"
+        "ER[\"scale_factor\",1],PARAMETER[\"false_easting\",0],PA"
+        "RAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Westing\",WEST],AXIS[\"South"
+        "ing\",SOUTH],AUTHORITY[\"EPSG\",\"22293\"]]"},
+    {22332, "epsg", 22332,
         "Carthage / UTM zone 32N", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Carthage", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +towgs84=-263");
-    add_proj4text (p, 1,
-        ",6,431,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Carthage / UTM zone 32N\",GEOGCS[\"Carthage\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249");
-    add_srs_wkt (p, 2,
-        ".2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6223\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4223\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",0],PARAMETER[\"central_meridian\",9],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22332\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 22391, "epsg", 22391,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +towgs84=-263"
+        ",6,431,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Carthage / UTM zone 32N\",GEOGCS[\"Carthage\",D"
+        "ATUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249"
+        ".2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6223\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4223\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",0],PARAMETER[\"central_meridian\",9],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22332\"]"
+        "]"},
+    {22391, "epsg", 22391,
         "Carthage / Nord Tunisie", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Carthage", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=9.9 +k_0=0.99962554");
-    add_proj4text (p, 1,
-        "4 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +towgs");
-    add_proj4text (p, 2,
-        "84=-263,6,431,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Carthage / Nord Tunisie\",GEOGCS[\"Carthage\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249");
-    add_srs_wkt (p, 2,
-        ".2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6223\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4223\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",36],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",9.9],PARAMETER[\"scale_factor\",0.999625544],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",500000],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 12,
-        "Y[\"EPSG\",\"22391\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22392, "epsg", 22392,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=9.9 +k_0=0.99962554"
+        "4 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +towgs"
+        "84=-263,6,431,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Carthage / Nord Tunisie\",GEOGCS[\"Carthage\",D"
+        "ATUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249"
+        ".2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6223\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4223\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER"
+        "[\"latitude_of_origin\",36],PARAMETER[\"central_meridian"
+        "\",9.9],PARAMETER[\"scale_factor\",0.999625544],PARAMETE"
+        "R[\"false_easting\",500000],PARAMETER[\"false_northing\""
+        ",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"22391\"]]"},
+    {22392, "epsg", 22392,
         "Carthage / Sud Tunisie", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Carthage", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=9.9 +k_0=0.9996");
-    add_proj4text (p, 1,
-        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +t");
-    add_proj4text (p, 2,
-        "owgs84=-263,6,431,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Carthage / Sud Tunisie\",GEOGCS[\"Carthage\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.");
-    add_srs_wkt (p, 2,
-        "2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6223\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4223\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER");
-    add_srs_wkt (p, 7,
-        "[\"latitude_of_origin\",33.3],PARAMETER[\"central_meridi");
-    add_srs_wkt (p, 8,
-        "an\",9.9],PARAMETER[\"scale_factor\",0.999625769],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",500000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 10,
-        "\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR");
-    add_srs_wkt (p, 12,
-        "ITY[\"EPSG\",\"22392\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22521, "epsg", 22521,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=9.9 +k_0=0.9996"
+        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +t"
+        "owgs84=-263,6,431,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Carthage / Sud Tunisie\",GEOGCS[\"Carthage\",DA"
+        "TUM[\"Carthage\",SPHEROID[\"Clarke 1880 (IGN)\",6378249."
+        "2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHORI"
+        "TY[\"EPSG\",\"6223\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4223\""
+        "]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],PARAMETER"
+        "[\"latitude_of_origin\",33.3],PARAMETER[\"central_meridi"
+        "an\",9.9],PARAMETER[\"scale_factor\",0.999625769],PARAME"
+        "TER[\"false_easting\",500000],PARAMETER[\"false_northing"
+        "\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]"
+        "],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHOR"
+        "ITY[\"EPSG\",\"22392\"]]"},
+    {22521, "epsg", 22521,
         "Corrego Alegre 1970-72 / UTM zone 21S", 0, 0,
         "International 1924", "Greenwich",
         "Corrego_Alegre_1970-72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 21S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-57],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"22521\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22522, "epsg", 22522,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +south +ellps=intl +towgs84=-205.57,1"
+        "68.77,-4.12,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 21S\",GEOGCS["
+        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7"
+        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT"
+        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-57],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"22521\"]]"},
+    {22522, "epsg", 22522,
         "Corrego Alegre 1970-72 / UTM zone 22S", 0, 0,
         "International 1924", "Greenwich",
         "Corrego_Alegre_1970-72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 22S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-51],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"22522\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22523, "epsg", 22523,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +south +ellps=intl +towgs84=-205.57,1"
+        "68.77,-4.12,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 22S\",GEOGCS["
+        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7"
+        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT"
+        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-51],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"22522\"]]"},
+    {22523, "epsg", 22523,
         "Corrego Alegre 1970-72 / UTM zone 23S", 0, 0,
         "International 1924", "Greenwich",
         "Corrego_Alegre_1970-72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 23S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-45],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"22523\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22524, "epsg", 22524,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=23 +south +ellps=intl +towgs84=-205.57,1"
+        "68.77,-4.12,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 23S\",GEOGCS["
+        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7"
+        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT"
+        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-45],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"22523\"]]"},
+    {22524, "epsg", 22524,
         "Corrego Alegre 1970-72 / UTM zone 24S", 0, 0,
         "International 1924", "Greenwich",
         "Corrego_Alegre_1970-72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=24 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 24S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-39],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"22524\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22525, "epsg", 22525,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=24 +south +ellps=intl +towgs84=-205.57,1"
+        "68.77,-4.12,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 24S\",GEOGCS["
+        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7"
+        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT"
+        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-39],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"22524\"]]"},
+    {22525, "epsg", 22525,
         "Corrego Alegre 1970-72 / UTM zone 25S", 0, 0,
         "International 1924", "Greenwich",
         "Corrego_Alegre_1970-72", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +south +ellps=intl +towgs84=-205.57,1");
-    add_proj4text (p, 1,
-        "68.77,-4.12,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 25S\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7");
-    add_srs_wkt (p, 2,
-        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM");
-    add_srs_wkt (p, 4,
-        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_");
-    add_srs_wkt (p, 7,
-        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-33],PARAMETER[\"scale_factor\",0");
-    add_srs_wkt (p, 9,
-        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f");
-    add_srs_wkt (p, 10,
-        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E");
-    add_srs_wkt (p, 11,
-        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"22525\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22700, "epsg", 22700,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=25 +south +ellps=intl +towgs84=-205.57,1"
+        "68.77,-4.12,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Corrego Alegre 1970-72 / UTM zone 25S\",GEOGCS["
+        "\"Corrego Alegre 1970-72\",DATUM[\"Corrego_Alegre_1970-7"
+        "2\",SPHEROID[\"International 1924\",6378388,297,AUTHORIT"
+        "Y[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6225\"]],PRIM"
+        "EM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4225\"]],PROJECTION[\"Transverse_"
+        "Mercator\"],PARAMETER[\"latitude_of_origin\",0],PARAMETE"
+        "R[\"central_meridian\",-33],PARAMETER[\"scale_factor\",0"
+        ".9996],PARAMETER[\"false_easting\",500000],PARAMETER[\"f"
+        "alse_northing\",10000000],UNIT[\"metre\",1,AUTHORITY[\"E"
+        "PSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"22525\"]]"},
+    {22700, "epsg", 22700,
         "Deir ez Zor / Levant Zone", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Deir_ez_Zor", "Lambert_Conic_Near-Conformal", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.65 +lat_0=34.65 +lon_0=37.35 +k_0=0.");
-    add_proj4text (p, 1,
-        "9996256 +x_0=300000 +y_0=300000 +a=6378249.2 +b=6356515 ");
-    add_proj4text (p, 2,
-        "+towgs84=-190.421,8.532,238.69,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Deir ez Zor / Levant Zone\",GEOGCS[\"Deir ez Zo");
-    add_srs_wkt (p, 1,
-        "r\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 1880 (IGN)\"");
-    add_srs_wkt (p, 2,
-        ",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]");
-    add_srs_wkt (p, 3,
-        "],AUTHORITY[\"EPSG\",\"6227\"]],PRIMEM[\"Greenwich\",0,A");
-    add_srs_wkt (p, 4,
-        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292");
-    add_srs_wkt (p, 5,
-        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4227\"]],PROJECTION[\"Lambert_Conic_Near-Conformal\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"Latitude of natural origin\",34.65],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"Longitude of natural origin\",37.35],PARAMETER[\"Sc");
-    add_srs_wkt (p, 9,
-        "ale factor at natural origin\",0.9996256],PARAMETER[\"Fa");
-    add_srs_wkt (p, 10,
-        "lse easting\",300000],PARAMETER[\"False northing\",30000");
-    add_srs_wkt (p, 11,
-        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 12,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 13,
-        "G\",\"22700\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22770, "epsg", 22770,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.65 +lat_0=34.65 +lon_0=37.35 +k_0=0."
+        "9996256 +x_0=300000 +y_0=300000 +a=6378249.2 +b=6356515 "
+        "+towgs84=-190.421,8.532,238.69,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Deir ez Zor / Levant Zone\",GEOGCS[\"Deir ez Zo"
+        "r\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 1880 (IGN)\""
+        ",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"]"
+        "],AUTHORITY[\"EPSG\",\"6227\"]],PRIMEM[\"Greenwich\",0,A"
+        "UTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292"
+        "5199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4227\"]],PROJECTION[\"Lambert_Conic_Near-Conformal\"]"
+        ",PARAMETER[\"Latitude of natural origin\",34.65],PARAMET"
+        "ER[\"Longitude of natural origin\",37.35],PARAMETER[\"Sc"
+        "ale factor at natural origin\",0.9996256],PARAMETER[\"Fa"
+        "lse easting\",300000],PARAMETER[\"False northing\",30000"
+        "0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"22700\"]]"},
+    {22770, "epsg", 22770,
         "Deir ez Zor / Syria Lambert", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Deir_ez_Zor", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=34.65 +lat_0=34.65 +lon_0=37.35 +k_0=0.");
-    add_proj4text (p, 1,
-        "9996256 +x_0=300000 +y_0=300000 +a=6378249.2 +b=6356515 ");
-    add_proj4text (p, 2,
-        "+towgs84=-190.421,8.532,238.69,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Deir ez Zor / Syria Lambert\",GEOGCS[\"Deir ez ");
-    add_srs_wkt (p, 1,
-        "Zor\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 1880 (IGN)");
-    add_srs_wkt (p, 2,
-        "\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6227\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4227\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],");
-    add_srs_wkt (p, 7,
-        "PARAMETER[\"latitude_of_origin\",34.65],PARAMETER[\"cent");
-    add_srs_wkt (p, 8,
-        "ral_meridian\",37.35],PARAMETER[\"scale_factor\",0.99962");
-    add_srs_wkt (p, 9,
-        "56],PARAMETER[\"false_easting\",300000],PARAMETER[\"fals");
-    add_srs_wkt (p, 10,
-        "e_northing\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 11,
-        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 12,
-        "TH],AUTHORITY[\"EPSG\",\"22770\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22780, "epsg", 22780,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=34.65 +lat_0=34.65 +lon_0=37.35 +k_0=0."
+        "9996256 +x_0=300000 +y_0=300000 +a=6378249.2 +b=6356515 "
+        "+towgs84=-190.421,8.532,238.69,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Deir ez Zor / Syria Lambert\",GEOGCS[\"Deir ez "
+        "Zor\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 1880 (IGN)"
+        "\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",\"7011\""
+        "]],AUTHORITY[\"EPSG\",\"6227\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4227\"]],PROJECTION[\"Lambert_Conformal_Conic_1SP\"],"
+        "PARAMETER[\"latitude_of_origin\",34.65],PARAMETER[\"cent"
+        "ral_meridian\",37.35],PARAMETER[\"scale_factor\",0.99962"
+        "56],PARAMETER[\"false_easting\",300000],PARAMETER[\"fals"
+        "e_northing\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\""
+        ",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NOR"
+        "TH],AUTHORITY[\"EPSG\",\"22770\"]]"},
+    {22780, "epsg", 22780,
         "Deir ez Zor / Levant Stereographic", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Deir_ez_Zor", "Oblique_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=34.2 +lon_0=39.15 +k=0.9995341 +x_0=");
-    add_proj4text (p, 1,
-        "0 +y_0=0 +a=6378249.2 +b=6356515 +towgs84=-190.421,8.532");
-    add_proj4text (p, 2,
-        ",238.69,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Deir ez Zor / Levant Stereographic\",GEOGCS[\"D");
-    add_srs_wkt (p, 1,
-        "eir ez Zor\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 188");
-    add_srs_wkt (p, 2,
-        "0 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7011\"]],AUTHORITY[\"EPSG\",\"6227\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4227\"]],PROJECTION[\"Oblique_Stereographic\"");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"latitude_of_origin\",34.2],PARAMETER[\"cen");
-    add_srs_wkt (p, 8,
-        "tral_meridian\",39.15],PARAMETER[\"scale_factor\",0.9995");
-    add_srs_wkt (p, 9,
-        "341],PARAMETER[\"false_easting\",0],PARAMETER[\"false_no");
-    add_srs_wkt (p, 10,
-        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"22780\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22832, "epsg", 22832,
+        "Easting", "East", "Northing", "North",
+        "+proj=sterea +lat_0=34.2 +lon_0=39.15 +k=0.9995341 +x_0="
+        "0 +y_0=0 +a=6378249.2 +b=6356515 +towgs84=-190.421,8.532"
+        ",238.69,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Deir ez Zor / Levant Stereographic\",GEOGCS[\"D"
+        "eir ez Zor\",DATUM[\"Deir_ez_Zor\",SPHEROID[\"Clarke 188"
+        "0 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\","
+        "\"7011\"]],AUTHORITY[\"EPSG\",\"6227\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4227\"]],PROJECTION[\"Oblique_Stereographic\""
+        "],PARAMETER[\"latitude_of_origin\",34.2],PARAMETER[\"cen"
+        "tral_meridian\",39.15],PARAMETER[\"scale_factor\",0.9995"
+        "341],PARAMETER[\"false_easting\",0],PARAMETER[\"false_no"
+        "rthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"22780\"]]"},
+    {22832, "epsg", 22832,
         "Douala 1948 / AOF west (deprecated)", 0, 0,
         "International 1924", "Greenwich",
         "Douala_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +units=m +no_");
-    add_proj4text (p, 1,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Douala 1948 / AOF west (deprecated)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Douala 1948\",DATUM[\"Douala_1948\",SPHEROID[\"Internati");
-    add_srs_wkt (p, 2,
-        "onal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AU");
-    add_srs_wkt (p, 3,
-        "THORITY[\"EPSG\",\"6192\"]],PRIMEM[\"Greenwich\",0,AUTHO");
-    add_srs_wkt (p, 4,
-        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199");
-    add_srs_wkt (p, 5,
-        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4");
-    add_srs_wkt (p, 6,
-        "192\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "0.5],PARAMETER[\"scale_factor\",0.999],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",1000000],PARAMETER[\"false_northing\",1000000");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"2214\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22991, "epsg", 22991,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +a=6378249.2 +b=6356515 +units=m +no_"
+        "defs",
+        "PROJCS[\"Douala 1948 / AOF west (deprecated)\",GEOGCS[\""
+        "Douala 1948\",DATUM[\"Douala_1948\",SPHEROID[\"Internati"
+        "onal 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AU"
+        "THORITY[\"EPSG\",\"6192\"]],PRIMEM[\"Greenwich\",0,AUTHO"
+        "RITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199"
+        "433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4"
+        "192\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "0.5],PARAMETER[\"scale_factor\",0.999],PARAMETER[\"false"
+        "_easting\",1000000],PARAMETER[\"false_northing\",1000000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"2214\"]]"},
+    {22991, "epsg", 22991,
         "Egypt 1907 / Blue Belt", 0, 0,
         "Helmert 1906", "Greenwich",
         "Egypt_1907", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=35 +k=1 +x_0=300000 +y_0=11");
-    add_proj4text (p, 1,
-        "00000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt 1907 / Blue Belt\",GEOGCS[\"Egypt 1907\",");
-    add_srs_wkt (p, 1,
-        "DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,2");
-    add_srs_wkt (p, 2,
-        "98.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6229\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4229\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",30],PARAMETER[\"central_meridian\",35],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",1],PARAMETER[\"false_easting\",300000],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_northing\",1100000],UNIT[\"metre\",1,AUTHORI");
-    add_srs_wkt (p, 10,
-        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AUTHORITY[\"EPSG\",\"22991\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22992, "epsg", 22992,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=35 +k=1 +x_0=300000 +y_0=11"
+        "00000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"Egypt 1907 / Blue Belt\",GEOGCS[\"Egypt 1907\","
+        "DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,2"
+        "98.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\""
+        "6229\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4229\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",30],PARAMETER[\"central_meridian\",35],PARAMETER[\"scal"
+        "e_factor\",1],PARAMETER[\"false_easting\",300000],PARAME"
+        "TER[\"false_northing\",1100000],UNIT[\"metre\",1,AUTHORI"
+        "TY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nor"
+        "thing\",NORTH],AUTHORITY[\"EPSG\",\"22991\"]]"},
+    {22992, "epsg", 22992,
         "Egypt 1907 / Red Belt", 0, 0,
         "Helmert 1906", "Greenwich",
         "Egypt_1907", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=31 +k=1 +x_0=615000 +y_0=81");
-    add_proj4text (p, 1,
-        "0000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt 1907 / Red Belt\",GEOGCS[\"Egypt 1907\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,29");
-    add_srs_wkt (p, 2,
-        "8.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "229\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4229\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "30],PARAMETER[\"central_meridian\",31],PARAMETER[\"scale");
-    add_srs_wkt (p, 8,
-        "_factor\",1],PARAMETER[\"false_easting\",615000],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"false_northing\",810000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 10,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"22992\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22993, "epsg", 22993,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=31 +k=1 +x_0=615000 +y_0=81"
+        "0000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Egypt 1907 / Red Belt\",GEOGCS[\"Egypt 1907\",D"
+        "ATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,29"
+        "8.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"6"
+        "229\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4229\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "30],PARAMETER[\"central_meridian\",31],PARAMETER[\"scale"
+        "_factor\",1],PARAMETER[\"false_easting\",615000],PARAMET"
+        "ER[\"false_northing\",810000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"22992\"]]"},
+    {22993, "epsg", 22993,
         "Egypt 1907 / Purple Belt", 0, 0,
         "Helmert 1906", "Greenwich",
         "Egypt_1907", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=27 +k=1 +x_0=700000 +y_0=20");
-    add_proj4text (p, 1,
-        "0000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt 1907 / Purple Belt\",GEOGCS[\"Egypt 1907\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,");
-    add_srs_wkt (p, 2,
-        "298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6229\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4229\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",30],PARAMETER[\"central_meridian\",27],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",1],PARAMETER[\"false_easting\",700000],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_northing\",200000],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"22993\"]]");
-    p = add_epsg_def_ex (filter, first, last, 22994, "epsg", 22994,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=27 +k=1 +x_0=700000 +y_0=20"
+        "0000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +units"
+        "=m +no_defs",
+        "PROJCS[\"Egypt 1907 / Purple Belt\",GEOGCS[\"Egypt 1907\""
+        ",DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\",6378200,"
+        "298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EPSG\",\""
+        "6229\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4229\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",30],PARAMETER[\"central_meridian\",27],PARAMETER[\"scal"
+        "e_factor\",1],PARAMETER[\"false_easting\",700000],PARAME"
+        "TER[\"false_northing\",200000],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"22993\"]]"},
+    {22994, "epsg", 22994,
         "Egypt 1907 / Extended Purple Belt", 0, 0,
         "Helmert 1906", "Greenwich",
         "Egypt_1907", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=30 +lon_0=27 +k=1 +x_0=700000 +y_0=12");
-    add_proj4text (p, 1,
-        "00000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +unit");
-    add_proj4text (p, 2,
-        "s=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Egypt 1907 / Extended Purple Belt\",GEOGCS[\"Eg");
-    add_srs_wkt (p, 1,
-        "ypt 1907\",DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\"");
-    add_srs_wkt (p, 2,
-        ",6378200,298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"6229\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 4,
-        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR");
-    add_srs_wkt (p, 5,
-        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4229\"]],PR");
-    add_srs_wkt (p, 6,
-        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o");
-    add_srs_wkt (p, 7,
-        "f_origin\",30],PARAMETER[\"central_meridian\",27],PARAME");
-    add_srs_wkt (p, 8,
-        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",7000");
-    add_srs_wkt (p, 9,
-        "00],PARAMETER[\"false_northing\",1200000],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],");
-    add_srs_wkt (p, 11,
-        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22994\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23028, "epsg", 23028,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=30 +lon_0=27 +k=1 +x_0=700000 +y_0=12"
+        "00000 +ellps=helmert +towgs84=-130,110,-13,0,0,0,0 +unit"
+        "s=m +no_defs",
+        "PROJCS[\"Egypt 1907 / Extended Purple Belt\",GEOGCS[\"Eg"
+        "ypt 1907\",DATUM[\"Egypt_1907\",SPHEROID[\"Helmert 1906\""
+        ",6378200,298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\""
+        "EPSG\",\"6229\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPS"
+        "G\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHOR"
+        "ITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4229\"]],PR"
+        "OJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_o"
+        "f_origin\",30],PARAMETER[\"central_meridian\",27],PARAME"
+        "TER[\"scale_factor\",1],PARAMETER[\"false_easting\",7000"
+        "00],PARAMETER[\"false_northing\",1200000],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],"
+        "AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"22994\"]]"},
+    {23028, "epsg", 23028,
         "ED50 / UTM zone 28N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 28N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-15],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"23028\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23029, "epsg", 23029,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 28N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-15],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"23028\"]]"},
+    {23029, "epsg", 23029,
         "ED50 / UTM zone 29N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 29N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23029\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23030, "epsg", 23030,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=29 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 29N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-9],PARAMETER[\"s"
+        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23029\"]]"},
+    {23030, "epsg", 23030,
         "ED50 / UTM zone 30N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 30N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-3],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23030\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23031, "epsg", 23031,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=30 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 30N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-3],PARAMETER[\"s"
+        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23030\"]]"},
+    {23031, "epsg", 23031,
         "ED50 / UTM zone 31N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=31 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 31N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",3],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"23031\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23032, "epsg", 23032,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=31 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 31N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",3],PARAMETER[\"sc"
+        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"23031\"]]"},
+    {23032, "epsg", 23032,
         "ED50 / UTM zone 32N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 32N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",9],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"23032\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23033, "epsg", 23033,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 32N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",9],PARAMETER[\"sc"
+        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"23032\"]]"},
+    {23033, "epsg", 23033,
         "ED50 / UTM zone 33N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 33N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",15],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23033\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23034, "epsg", 23034,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 33N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",15],PARAMETER[\"s"
+        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23033\"]]"},
+    {23034, "epsg", 23034,
         "ED50 / UTM zone 34N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=34 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 34N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",21],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23034\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23035, "epsg", 23035,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=34 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 34N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",21],PARAMETER[\"s"
+        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23034\"]]"},
+    {23035, "epsg", 23035,
         "ED50 / UTM zone 35N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 35N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",27],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23035\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23036, "epsg", 23036,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=35 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 35N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",27],PARAMETER[\"s"
+        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23035\"]]"},
+    {23036, "epsg", 23036,
         "ED50 / UTM zone 36N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 36N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",33],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23036\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23037, "epsg", 23037,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=36 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 36N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",33],PARAMETER[\"s"
+        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23036\"]]"},
+    {23037, "epsg", 23037,
         "ED50 / UTM zone 37N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=37 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 37N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",39],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23037\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23038, "epsg", 23038,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=37 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 37N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",39],PARAMETER[\"s"
+        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23037\"]]"},
+    {23038, "epsg", 23038,
         "ED50 / UTM zone 38N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +ellps=intl +towgs84=-87,-98,-121,0,0");
-    add_proj4text (p, 1,
-        ",0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / UTM zone 38N\",GEOGCS[\"ED50\",DATUM[\"E");
-    add_srs_wkt (p, 1,
-        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637");
-    add_srs_wkt (p, 2,
-        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",45],PARAMETER[\"s");
-    add_srs_wkt (p, 8,
-        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO");
-    add_srs_wkt (p, 10,
-        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N");
-    add_srs_wkt (p, 11,
-        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23038\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23090, "epsg", 23090,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=38 +ellps=intl +towgs84=-87,-98,-121,0,0"
+        ",0,0 +units=m +no_defs",
+        "PROJCS[\"ED50 / UTM zone 38N\",GEOGCS[\"ED50\",DATUM[\"E"
+        "uropean_Datum_1950\",SPHEROID[\"International 1924\",637"
+        "8388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",45],PARAMETER[\"s"
+        "cale_factor\",0.9996],PARAMETER[\"false_easting\",500000"
+        "],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHO"
+        "RITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"N"
+        "orthing\",NORTH],AUTHORITY[\"EPSG\",\"23038\"]]"},
+    {23090, "epsg", 23090,
         "ED50 / TM 0 N", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=0 +k=0.9996 +x_0=500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM 0 N\",GEOGCS[\"ED50\",DATUM[\"Europea");
-    add_srs_wkt (p, 1,
-        "n_Datum_1950\",SPHEROID[\"International 1924\",6378388,2");
-    add_srs_wkt (p, 2,
-        "97,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"62");
-    add_srs_wkt (p, 3,
-        "30\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 6,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",0],PARAMETER[\"scale_fa");
-    add_srs_wkt (p, 8,
-        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"23090\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23095, "epsg", 23095,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=0 +k=0.9996 +x_0=500000 +y_0"
+        "=0 +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"ED50 / TM 0 N\",GEOGCS[\"ED50\",DATUM[\"Europea"
+        "n_Datum_1950\",SPHEROID[\"International 1924\",6378388,2"
+        "97,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"62"
+        "30\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",0],PARAMETER[\"scale_fa"
+        "ctor\",0.9996],PARAMETER[\"false_easting\",500000],PARAM"
+        "ETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"23090\"]]"},
+    {23095, "epsg", 23095,
         "ED50 / TM 5 NE", 0, 0,
         "International 1924", "Greenwich",
         "European_Datum_1950", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=5 +k=0.9996 +x_0=500000 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +n");
-    add_proj4text (p, 2,
-        "o_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"ED50 / TM 5 NE\",GEOGCS[\"ED50\",DATUM[\"Europe");
-    add_srs_wkt (p, 1,
-        "an_Datum_1950\",SPHEROID[\"International 1924\",6378388,");
-    add_srs_wkt (p, 2,
-        "297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",5],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 8,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"23095\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23239, "epsg", 23239,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=5 +k=0.9996 +x_0=500000 +y_0"
+        "=0 +ellps=intl +towgs84=-87,-98,-121,0,0,0,0 +units=m +n"
+        "o_defs",
+        "PROJCS[\"ED50 / TM 5 NE\",GEOGCS[\"ED50\",DATUM[\"Europe"
+        "an_Datum_1950\",SPHEROID[\"International 1924\",6378388,"
+        "297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6"
+        "230\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4230\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",5],PARAMETER[\"scale_f"
+        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"23095\"]]"},
+    {23239, "epsg", 23239,
         "Fahud / UTM zone 39N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Fahud", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=clrk80 +towgs84=-333.102,-11.0");
-    add_proj4text (p, 1,
-        "2,230.69,0,0,0.554,0.219 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fahud / UTM zone 39N\",GEOGCS[\"Fahud\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Fahud\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.4");
-    add_srs_wkt (p, 2,
-        "65,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"62");
-    add_srs_wkt (p, 3,
-        "32\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4232\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 6,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",51],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 8,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"23239\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23240, "epsg", 23240,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=39 +ellps=clrk80 +towgs84=-333.102,-11.0"
+        "2,230.69,0,0,0.554,0.219 +units=m +no_defs",
+        "PROJCS[\"Fahud / UTM zone 39N\",GEOGCS[\"Fahud\",DATUM[\""
+        "Fahud\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.4"
+        "65,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"62"
+        "32\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4232\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",51],PARAMETER[\"scale_f"
+        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"23239\"]]"},
+    {23240, "epsg", 23240,
         "Fahud / UTM zone 40N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Fahud", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=40 +ellps=clrk80 +towgs84=-333.102,-11.0");
-    add_proj4text (p, 1,
-        "2,230.69,0,0,0.554,0.219 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Fahud / UTM zone 40N\",GEOGCS[\"Fahud\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "Fahud\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.4");
-    add_srs_wkt (p, 2,
-        "65,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"62");
-    add_srs_wkt (p, 3,
-        "32\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4232\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 6,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",57],PARAMETER[\"scale_f");
-    add_srs_wkt (p, 8,
-        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 10,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 11,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"23240\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23433, "epsg", 23433,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=40 +ellps=clrk80 +towgs84=-333.102,-11.0"
+        "2,230.69,0,0,0.554,0.219 +units=m +no_defs",
+        "PROJCS[\"Fahud / UTM zone 40N\",GEOGCS[\"Fahud\",DATUM[\""
+        "Fahud\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,293.4"
+        "65,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",\"62"
+        "32\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4232\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",57],PARAMETER[\"scale_f"
+        "actor\",0.9996],PARAMETER[\"false_easting\",500000],PARA"
+        "METER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"23240\"]]"},
+    {23433, "epsg", 23433,
         "Garoua / UTM zone 33N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Garoua", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +a=6378249.2 +b=6356515 +units=m +no_");
-    add_proj4text (p, 1,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Garoua / UTM zone 33N\",GEOGCS[\"Garoua\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Garoua\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,2");
-    add_srs_wkt (p, 2,
-        "93.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"6197\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8");
-    add_srs_wkt (p, 4,
-        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E");
-    add_srs_wkt (p, 5,
-        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4197\"]],PROJECTIO");
-    add_srs_wkt (p, 6,
-        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi");
-    add_srs_wkt (p, 7,
-        "n\",0],PARAMETER[\"central_meridian\",15],PARAMETER[\"sc");
-    add_srs_wkt (p, 8,
-        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR");
-    add_srs_wkt (p, 10,
-        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No");
-    add_srs_wkt (p, 11,
-        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2312\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23700, "epsg", 23700,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +a=6378249.2 +b=6356515 +units=m +no_"
+        "defs",
+        "PROJCS[\"Garoua / UTM zone 33N\",GEOGCS[\"Garoua\",DATUM"
+        "[\"Garoua\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.145,2"
+        "93.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG\","
+        "\"6197\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8"
+        "901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"E"
+        "PSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4197\"]],PROJECTIO"
+        "N[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origi"
+        "n\",0],PARAMETER[\"central_meridian\",15],PARAMETER[\"sc"
+        "ale_factor\",0.9996],PARAMETER[\"false_easting\",500000]"
+        ",PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHOR"
+        "ITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"No"
+        "rthing\",NORTH],AUTHORITY[\"EPSG\",\"2312\"]]"},
+    {23700, "epsg", 23700,
         "HD72 / EOV", 0, 0,
         "GRS 1967", "Greenwich",
         "Hungarian_Datum_1972", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=somerc +lat_0=47.14439372222222 +lon_0=19.04857177");
-    add_proj4text (p, 1,
-        "777778 +k_0=0.99993 +x_0=650000 +y_0=200000 +ellps=GRS67");
-    add_proj4text (p, 2,
-        " +towgs84=52.17,-71.82,-14.9,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"HD72 / EOV\",GEOGCS[\"HD72\",DATUM[\"Hungarian_");
-    add_srs_wkt (p, 1,
-        "Datum_1972\",SPHEROID[\"GRS 1967\",6378160,298.247167427");
-    add_srs_wkt (p, 2,
-        ",AUTHORITY[\"EPSG\",\"7036\"]],AUTHORITY[\"EPSG\",\"6237");
-    add_srs_wkt (p, 3,
-        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]");
-    add_srs_wkt (p, 4,
-        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 5,
-        "\"9122\"]],AUTHORITY[\"EPSG\",\"4237\"]],PROJECTION[\"Ho");
-    add_srs_wkt (p, 6,
-        "tine_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"lati");
-    add_srs_wkt (p, 7,
-        "tude_of_center\",47.1443937222222],PARAMETER[\"longitude");
-    add_srs_wkt (p, 8,
-        "_of_center\",19.0485717777778],PARAMETER[\"azimuth\",90]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"rectified_grid_angle\",90],PARAMETER[\"scal");
-    add_srs_wkt (p, 10,
-        "e_factor\",0.99993],PARAMETER[\"false_easting\",650000],");
-    add_srs_wkt (p, 11,
-        "PARAMETER[\"false_northing\",200000],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 12,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 13,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"23700\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23830, "epsg", 23830,
+        "Easting", "East", "Northing", "North",
+        "+proj=somerc +lat_0=47.14439372222222 +lon_0=19.04857177"
+        "777778 +k_0=0.99993 +x_0=650000 +y_0=200000 +ellps=GRS67"
+        " +towgs84=52.17,-71.82,-14.9,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"HD72 / EOV\",GEOGCS[\"HD72\",DATUM[\"Hungarian_"
+        "Datum_1972\",SPHEROID[\"GRS 1967\",6378160,298.247167427"
+        ",AUTHORITY[\"EPSG\",\"7036\"]],AUTHORITY[\"EPSG\",\"6237"
+        "\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]"
+        "],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\","
+        "\"9122\"]],AUTHORITY[\"EPSG\",\"4237\"]],PROJECTION[\"Ho"
+        "tine_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"lati"
+        "tude_of_center\",47.1443937222222],PARAMETER[\"longitude"
+        "_of_center\",19.0485717777778],PARAMETER[\"azimuth\",90]"
+        ",PARAMETER[\"rectified_grid_angle\",90],PARAMETER[\"scal"
+        "e_factor\",0.99993],PARAMETER[\"false_easting\",650000],"
+        "PARAMETER[\"false_northing\",200000],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"23700\"]]"},
+    {23830, "epsg", 23830,
         "DGN95 / Indonesia TM-3 zone 46.2", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=94.5 +k=0.9999 +x_0=200000 +");
-    add_proj4text (p, 1,
-        "y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 46.2\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",94.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23830\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23831, "epsg", 23831,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=94.5 +k=0.9999 +x_0=200000 +"
+        "y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 46.2\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",94.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23830\"]]"},
+    {23831, "epsg", 23831,
         "DGN95 / Indonesia TM-3 zone 47.1", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=97.5 +k=0.9999 +x_0=200000 +");
-    add_proj4text (p, 1,
-        "y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 47.1\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",97.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23831\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23832, "epsg", 23832,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=97.5 +k=0.9999 +x_0=200000 +"
+        "y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 47.1\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",97.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23831\"]]"},
+    {23832, "epsg", 23832,
         "DGN95 / Indonesia TM-3 zone 47.2", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=100.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 47.2\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",100.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23832\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23833, "epsg", 23833,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=100.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 47.2\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",100.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23832\"]]"},
+    {23833, "epsg", 23833,
         "DGN95 / Indonesia TM-3 zone 48.1", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=103.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 48.1\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",103.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23833\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23834, "epsg", 23834,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=103.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 48.1\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",103.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23833\"]]"},
+    {23834, "epsg", 23834,
         "DGN95 / Indonesia TM-3 zone 48.2", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=106.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 48.2\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",106.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23834\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23835, "epsg", 23835,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=106.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 48.2\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",106.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23834\"]]"},
+    {23835, "epsg", 23835,
         "DGN95 / Indonesia TM-3 zone 49.1", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=109.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 49.1\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",109.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23835\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23836, "epsg", 23836,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=109.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 49.1\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",109.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23835\"]]"},
+    {23836, "epsg", 23836,
         "DGN95 / Indonesia TM-3 zone 49.2", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=112.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 49.2\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",112.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23836\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23837, "epsg", 23837,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=112.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 49.2\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",112.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23836\"]]"},
+    {23837, "epsg", 23837,
         "DGN95 / Indonesia TM-3 zone 50.1", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=115.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 50.1\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",115.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23837\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23838, "epsg", 23838,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=115.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 50.1\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",115.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23837\"]]"},
+    {23838, "epsg", 23838,
         "DGN95 / Indonesia TM-3 zone 50.2", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=118.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 50.2\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",118.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23838\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23839, "epsg", 23839,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=118.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 50.2\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",118.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23838\"]]"},
+    {23839, "epsg", 23839,
         "DGN95 / Indonesia TM-3 zone 51.1", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=121.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 51.1\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",121.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23839\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23840, "epsg", 23840,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=121.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 51.1\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",121.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23839\"]]"},
+    {23840, "epsg", 23840,
         "DGN95 / Indonesia TM-3 zone 51.2", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=124.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 51.2\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",124.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23840\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23841, "epsg", 23841,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=124.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 51.2\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",124.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23840\"]]"},
+    {23841, "epsg", 23841,
         "DGN95 / Indonesia TM-3 zone 52.1", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=127.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 52.1\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",127.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23841\"]]");
-    p = add_epsg_def_ex (filter, first, last, 23842, "epsg", 23842,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=127.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 52.1\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",127.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23841\"]]"},
+    {23842, "epsg", 23842,
         "DGN95 / Indonesia TM-3 zone 52.2", 0, 0,
         "WGS 84", "Greenwich",
         "Datum_Geodesi_Nasional_1995", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=130.5 +k=0.9999 +x_0=200000 ");
-    add_proj4text (p, 1,
-        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units=");
-    add_proj4text (p, 2,
-        "m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"DGN95 / Indonesia TM-3 zone 52.2\",GEOGCS[\"DGN");
-    add_srs_wkt (p, 1,
-        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG");
-    add_srs_wkt (p, 2,
-        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",130.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "false_easting\",200000],PARAMETER[\"false_northing\",150");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"23842\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=130.5 +k=0.9999 +x_0=200000 "
+        "+y_0=1500000 +ellps=WGS84 +towgs84=0,0,0,0,0,0,0 +units="
+        "m +no_defs",
+        "PROJCS[\"DGN95 / Indonesia TM-3 zone 52.2\",GEOGCS[\"DGN"
+        "95\",DATUM[\"Datum_Geodesi_Nasional_1995\",SPHEROID[\"WG"
+        "S 84\",6378137,298.257223563,AUTHORITY[\"EPSG\",\"7030\""
+        "]],AUTHORITY[\"EPSG\",\"6755\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4755\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",130.5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\""
+        "false_easting\",200000],PARAMETER[\"false_northing\",150"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"23842\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_48 = {
+    epsg_defs_48, sizeof (epsg_defs_48) / sizeof (epsg_defs_48[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
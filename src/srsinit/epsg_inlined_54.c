@@ -53,3677 +53,2097 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifndef OMIT_EPSG    /* full EPSG initialization enabled */
 
-SPATIALITE_PRIVATE void
-initialize_epsg_54 (int filter, struct epsg_defs **first, struct epsg_defs **last)
-{
-/* initializing the EPSG defs list */
-    struct epsg_defs *p;
-    p = add_epsg_def_ex (filter, first, last, 28490, "epsg", 28490,
+/* EPSG defs - sorted by SRID */
+static const struct epsg_catalog_def epsg_defs_54[] = {
+    {28490, "epsg", 28490,
         "Pulkovo 1942 / Gauss-Kruger CM 177E", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=177 +k=1 +x_0=500000 +y_0=0 ");
-    add_proj4text (p, 1,
-        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0");
-    add_proj4text (p, 2,
-        ".12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / Gauss-Kruger CM 177E\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4284\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1");
-    add_srs_wkt (p, 8,
-        "77],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east");
-    add_srs_wkt (p, 9,
-        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2520\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 28491, "epsg", 28491,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=177 +k=1 +x_0=500000 +y_0=0 "
+        "+ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-0"
+        ".12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / Gauss-Kruger CM 177E\",GEOGCS[\""
+        "Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassow"
+        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A"
+        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4284\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",1"
+        "77],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_east"
+        "ing\",500000],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2520\""
+        "]]"},
+    {28491, "epsg", 28491,
         "Pulkovo 1942 / Gauss-Kruger CM 177W", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / Gauss-Kruger CM 177W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4284\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "177],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",");
-    add_srs_wkt (p, 11,
-        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2521\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 28492, "epsg", 28492,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-177 +k=1 +x_0=500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / Gauss-Kruger CM 177W\",GEOGCS[\""
+        "Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassow"
+        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A"
+        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4284\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-"
+        "177],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\","
+        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2521\""
+        "]]"},
+    {28492, "epsg", 28492,
         "Pulkovo 1942 / Gauss-Kruger CM 171W", 0, 1,
         "Krassowsky 1940", "Greenwich",
         "Pulkovo_1942", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=1 +x_0=500000 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-");
-    add_proj4text (p, 2,
-        "0.12 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Pulkovo 1942 / Gauss-Kruger CM 171W\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassow");
-    add_srs_wkt (p, 2,
-        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A");
-    add_srs_wkt (p, 3,
-        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH");
-    add_srs_wkt (p, 4,
-        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519");
-    add_srs_wkt (p, 5,
-        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4284\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"");
-    add_srs_wkt (p, 7,
-        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-");
-    add_srs_wkt (p, 8,
-        "171],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",");
-    add_srs_wkt (p, 11,
-        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2522\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 28600, "epsg", 28600,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=-171 +k=1 +x_0=500000 +y_0=0"
+        " +ellps=krass +towgs84=23.92,-141.27,-80.9,0,0.35,0.82,-"
+        "0.12 +units=m +no_defs",
+        "PROJCS[\"Pulkovo 1942 / Gauss-Kruger CM 171W\",GEOGCS[\""
+        "Pulkovo 1942\",DATUM[\"Pulkovo_1942\",SPHEROID[\"Krassow"
+        "sky 1940\",6378245,298.3,AUTHORITY[\"EPSG\",\"7024\"]],A"
+        "UTHORITY[\"EPSG\",\"6284\"]],PRIMEM[\"Greenwich\",0,AUTH"
+        "ORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519"
+        "9433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4284\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\""
+        "latitude_of_origin\",0],PARAMETER[\"central_meridian\",-"
+        "171],PARAMETER[\"scale_factor\",1],PARAMETER[\"false_eas"
+        "ting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\","
+        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2522\""
+        "]]"},
+    {28600, "epsg", 28600,
         "Qatar 1974 / Qatar National Grid", 0, 0,
         "International 1924", "Greenwich",
         "Qatar_1974", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=24.45 +lon_0=51.21666666666667 +k=0.9");
-    add_proj4text (p, 1,
-        "9999 +x_0=200000 +y_0=300000 +ellps=intl +towgs84=-128.1");
-    add_proj4text (p, 2,
-        "6,-282.42,21.93,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Qatar 1974 / Qatar National Grid\",GEOGCS[\"Qat");
-    add_srs_wkt (p, 1,
-        "ar 1974\",DATUM[\"Qatar_1974\",SPHEROID[\"International ");
-    add_srs_wkt (p, 2,
-        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6285\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4285\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",24.45],PARAMETER[\"central_meridian\",51");
-    add_srs_wkt (p, 8,
-        ".2166666666667],PARAMETER[\"scale_factor\",0.99999],PARA");
-    add_srs_wkt (p, 9,
-        "METER[\"false_easting\",200000],PARAMETER[\"false_northi");
-    add_srs_wkt (p, 10,
-        "ng\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"28600\"]]");
-    p = add_epsg_def_ex (filter, first, last, 28991, "epsg", 28991,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=24.45 +lon_0=51.21666666666667 +k=0.9"
+        "9999 +x_0=200000 +y_0=300000 +ellps=intl +towgs84=-128.1"
+        "6,-282.42,21.93,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Qatar 1974 / Qatar National Grid\",GEOGCS[\"Qat"
+        "ar 1974\",DATUM[\"Qatar_1974\",SPHEROID[\"International "
+        "1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORI"
+        "TY[\"EPSG\",\"6285\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4285\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",24.45],PARAMETER[\"central_meridian\",51"
+        ".2166666666667],PARAMETER[\"scale_factor\",0.99999],PARA"
+        "METER[\"false_easting\",200000],PARAMETER[\"false_northi"
+        "ng\",300000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"28600\"]]"},
+    {28991, "epsg", 28991,
         "Amersfoort / RD Old", 0, 0,
         "Bessel 1841", "Greenwich",
         "Amersfoort", "Oblique_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=52.15616055555555 +lon_0=5.387638888");
-    add_proj4text (p, 1,
-        "88889 +k=0.9999079 +x_0=0 +y_0=0 +ellps=bessel +towgs84=");
-    add_proj4text (p, 2,
-        "565.2369,50.0087,465.658,-0.406857,0.350733,-1.87035,4.0");
-    add_proj4text (p, 3,
-        "812 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Amersfoort / RD Old\",GEOGCS[\"Amersfoort\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Amersfoort\",SPHEROID[\"Bessel 1841\",6377397.155,2");
-    add_srs_wkt (p, 2,
-        "99.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6289\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4289\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",52.1561605555556],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",5.38763888888889],PARAMETER[\"scale_factor\",0.999907");
-    add_srs_wkt (p, 9,
-        "9],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nort");
-    add_srs_wkt (p, 10,
-        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]");
-    add_srs_wkt (p, 11,
-        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI");
-    add_srs_wkt (p, 12,
-        "TY[\"EPSG\",\"28991\"]]");
-    p = add_epsg_def_ex (filter, first, last, 28992, "epsg", 28992,
+        "Easting", "East", "Northing", "North",
+        "+proj=sterea +lat_0=52.15616055555555 +lon_0=5.387638888"
+        "88889 +k=0.9999079 +x_0=0 +y_0=0 +ellps=bessel +towgs84="
+        "565.2369,50.0087,465.658,-0.406857,0.350733,-1.87035,4.0"
+        "812 +units=m +no_defs",
+        "PROJCS[\"Amersfoort / RD Old\",GEOGCS[\"Amersfoort\",DAT"
+        "UM[\"Amersfoort\",SPHEROID[\"Bessel 1841\",6377397.155,2"
+        "99.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPS"
+        "G\",\"6289\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4289\"]],PROJE"
+        "CTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude_of"
+        "_origin\",52.1561605555556],PARAMETER[\"central_meridian"
+        "\",5.38763888888889],PARAMETER[\"scale_factor\",0.999907"
+        "9],PARAMETER[\"false_easting\",0],PARAMETER[\"false_nort"
+        "hing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]]"
+        ",AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORI"
+        "TY[\"EPSG\",\"28991\"]]"},
+    {28992, "epsg", 28992,
         "Amersfoort / RD New", 0, 0,
         "Bessel 1841", "Greenwich",
         "Amersfoort", "Oblique_Stereographic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=sterea +lat_0=52.15616055555555 +lon_0=5.387638888");
-    add_proj4text (p, 1,
-        "88889 +k=0.9999079 +x_0=155000 +y_0=463000 +ellps=bessel");
-    add_proj4text (p, 2,
-        " +towgs84=565.2369,50.0087,465.658,-0.406857,0.350733,-1");
-    add_proj4text (p, 3,
-        ".87035,4.0812 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Amersfoort / RD New\",GEOGCS[\"Amersfoort\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Amersfoort\",SPHEROID[\"Bessel 1841\",6377397.155,2");
-    add_srs_wkt (p, 2,
-        "99.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 3,
-        "G\",\"6289\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4289\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",52.1561605555556],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",5.38763888888889],PARAMETER[\"scale_factor\",0.999907");
-    add_srs_wkt (p, 9,
-        "9],PARAMETER[\"false_easting\",155000],PARAMETER[\"false");
-    add_srs_wkt (p, 10,
-        "_northing\",463000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 11,
-        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT");
-    add_srs_wkt (p, 12,
-        "H],AUTHORITY[\"EPSG\",\"28992\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29100, "epsg", 29100,
+        "Easting", "East", "Northing", "North",
+        "+proj=sterea +lat_0=52.15616055555555 +lon_0=5.387638888"
+        "88889 +k=0.9999079 +x_0=155000 +y_0=463000 +ellps=bessel"
+        " +towgs84=565.2369,50.0087,465.658,-0.406857,0.350733,-1"
+        ".87035,4.0812 +units=m +no_defs",
+        "PROJCS[\"Amersfoort / RD New\",GEOGCS[\"Amersfoort\",DAT"
+        "UM[\"Amersfoort\",SPHEROID[\"Bessel 1841\",6377397.155,2"
+        "99.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPS"
+        "G\",\"6289\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4289\"]],PROJE"
+        "CTION[\"Oblique_Stereographic\"],PARAMETER[\"latitude_of"
+        "_origin\",52.1561605555556],PARAMETER[\"central_meridian"
+        "\",5.38763888888889],PARAMETER[\"scale_factor\",0.999907"
+        "9],PARAMETER[\"false_easting\",155000],PARAMETER[\"false"
+        "_northing\",463000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\","
+        "\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORT"
+        "H],AUTHORITY[\"EPSG\",\"28992\"]]"},
+    {29100, "epsg", 29100,
         "SAD69 / Brazil Polyconic", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Polyconic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=poly +lat_0=0 +lon_0=-54 +x_0=5000000 +y_0=1000000");
-    add_proj4text (p, 1,
-        "0 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0,0 +units=m +no_d");
-    add_proj4text (p, 2,
-        "efs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / Brazil Polyconic\",GEOGCS[\"SAD69\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"South_American_Datum_1969\",SPHEROID[\"GRS 1967 Mod");
-    add_srs_wkt (p, 2,
-        "ified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "18\"]],PROJECTION[\"Polyconic\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",-54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"false_easting\",5000000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 10,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"29101\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29101, "epsg", 29101,
+        "Easting", "East", "Northing", "North",
+        "+proj=poly +lat_0=0 +lon_0=-54 +x_0=5000000 +y_0=1000000"
+        "0 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0,0 +units=m +no_d"
+        "efs",
+        "PROJCS[\"SAD69 / Brazil Polyconic\",GEOGCS[\"SAD69\",DAT"
+        "UM[\"South_American_Datum_1969\",SPHEROID[\"GRS 1967 Mod"
+        "ified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUT"
+        "HORITY[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "18\"]],PROJECTION[\"Polyconic\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",-54],PARAMET"
+        "ER[\"false_easting\",5000000],PARAMETER[\"false_northing"
+        "\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"29101\"]]"},
+    {29101, "epsg", 29101,
         "SAD69 / Brazil Polyconic", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Polyconic", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=poly +lat_0=0 +lon_0=-54 +x_0=5000000 +y_0=1000000");
-    add_proj4text (p, 1,
-        "0 +ellps=aust_SA +towgs84=-66.87,4.37,-38.52,0,0,0,0 +un");
-    add_proj4text (p, 2,
-        "its=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / Brazil Polyconic\",GEOGCS[\"SAD69\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"South_American_Datum_1969\",SPHEROID[\"GRS 1967 Mod");
-    add_srs_wkt (p, 2,
-        "ified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHOR");
-    add_srs_wkt (p, 4,
-        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994");
-    add_srs_wkt (p, 5,
-        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46");
-    add_srs_wkt (p, 6,
-        "18\"]],PROJECTION[\"Polyconic\"],PARAMETER[\"latitude_of");
-    add_srs_wkt (p, 7,
-        "_origin\",0],PARAMETER[\"central_meridian\",-54],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"false_easting\",5000000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 9,
-        "\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 10,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 11,
-        "RITY[\"EPSG\",\"29101\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29118, "epsg", 29118,
+        "Easting", "East", "Northing", "North",
+        "+proj=poly +lat_0=0 +lon_0=-54 +x_0=5000000 +y_0=1000000"
+        "0 +ellps=aust_SA +towgs84=-66.87,4.37,-38.52,0,0,0,0 +un"
+        "its=m +no_defs",
+        "PROJCS[\"SAD69 / Brazil Polyconic\",GEOGCS[\"SAD69\",DAT"
+        "UM[\"South_American_Datum_1969\",SPHEROID[\"GRS 1967 Mod"
+        "ified\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUT"
+        "HORITY[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHOR"
+        "ITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251994"
+        "33,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"46"
+        "18\"]],PROJECTION[\"Polyconic\"],PARAMETER[\"latitude_of"
+        "_origin\",0],PARAMETER[\"central_meridian\",-54],PARAMET"
+        "ER[\"false_easting\",5000000],PARAMETER[\"false_northing"
+        "\",10000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"29101\"]]"},
+    {29118, "epsg", 29118,
         "SAD69 / UTM zone 18N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 18N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29168\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29119, "epsg", 29119,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 18N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-75],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29168\"]"
+        "]"},
+    {29119, "epsg", 29119,
         "SAD69 / UTM zone 19N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 19N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-69],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29169\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29120, "epsg", 29120,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 19N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-69],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29169\"]"
+        "]"},
+    {29120, "epsg", 29120,
         "SAD69 / UTM zone 20N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 20N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29170\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29121, "epsg", 29121,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 20N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29170\"]"
+        "]"},
+    {29121, "epsg", 29121,
         "SAD69 / UTM zone 21N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 21N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-57],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29171\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29122, "epsg", 29122,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 21N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-57],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29171\"]"
+        "]"},
+    {29122, "epsg", 29122,
         "SAD69 / UTM zone 22N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0");
-    add_proj4text (p, 1,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 22N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-51],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29172\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29168, "epsg", 29168,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +ellps=GRS67 +towgs84=-57,1,-41,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 22N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-51],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29172\"]"
+        "]"},
+    {29168, "epsg", 29168,
         "SAD69 / UTM zone 18N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +ellps=aust_SA +towgs84=-66.87,4.37,-");
-    add_proj4text (p, 1,
-        "38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 18N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29168\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29169, "epsg", 29169,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +ellps=aust_SA +towgs84=-66.87,4.37,-"
+        "38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 18N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-75],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29168\"]"
+        "]"},
+    {29169, "epsg", 29169,
         "SAD69 / UTM zone 19N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +ellps=aust_SA +towgs84=-66.87,4.37,-");
-    add_proj4text (p, 1,
-        "38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 19N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-69],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29169\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29170, "epsg", 29170,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +ellps=aust_SA +towgs84=-66.87,4.37,-"
+        "38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 19N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-69],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29169\"]"
+        "]"},
+    {29170, "epsg", 29170,
         "SAD69 / UTM zone 20N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +ellps=aust_SA +towgs84=-66.87,4.37,-");
-    add_proj4text (p, 1,
-        "38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 20N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29170\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29171, "epsg", 29171,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +ellps=aust_SA +towgs84=-66.87,4.37,-"
+        "38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 20N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29170\"]"
+        "]"},
+    {29171, "epsg", 29171,
         "SAD69 / UTM zone 21N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=aust_SA +towgs84=-66.87,4.37,-");
-    add_proj4text (p, 1,
-        "38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 21N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-57],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29171\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29172, "epsg", 29172,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +ellps=aust_SA +towgs84=-66.87,4.37,-"
+        "38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 21N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-57],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29171\"]"
+        "]"},
+    {29172, "epsg", 29172,
         "SAD69 / UTM zone 22N", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +ellps=aust_SA +towgs84=-66.87,4.37,-");
-    add_proj4text (p, 1,
-        "38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 22N\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-51],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29172\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 29177, "epsg", 29177,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +ellps=aust_SA +towgs84=-66.87,4.37,-"
+        "38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 22N\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-51],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST"
+        "],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29172\"]"
+        "]"},
+    {29177, "epsg", 29177,
         "SAD69 / UTM zone 17S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 17S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-81],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9187\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29178, "epsg", 29178,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 17S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-81],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9187\"]]"},
+    {29178, "epsg", 29178,
         "SAD69 / UTM zone 18S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 18S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9188\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29179, "epsg", 29179,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 18S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-75],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9188\"]]"},
+    {29179, "epsg", 29179,
         "SAD69 / UTM zone 19S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 19S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-69],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9189\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29180, "epsg", 29180,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 19S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-69],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9189\"]]"},
+    {29180, "epsg", 29180,
         "SAD69 / UTM zone 20S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 20S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9190\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29181, "epsg", 29181,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 20S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9190\"]]"},
+    {29181, "epsg", 29181,
         "SAD69 / UTM zone 21S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 21S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-57],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9191\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29182, "epsg", 29182,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 21S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-57],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9191\"]]"},
+    {29182, "epsg", 29182,
         "SAD69 / UTM zone 22S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 22S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-51],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9192\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29183, "epsg", 29183,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 22S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-51],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9192\"]]"},
+    {29183, "epsg", 29183,
         "SAD69 / UTM zone 23S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 23S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-45],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9193\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29184, "epsg", 29184,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=23 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 23S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-45],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9193\"]]"},
+    {29184, "epsg", 29184,
         "SAD69 / UTM zone 24S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=24 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 24S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-39],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9194\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29185, "epsg", 29185,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=24 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 24S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-39],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9194\"]]"},
+    {29185, "epsg", 29185,
         "SAD69 / UTM zone 25S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +south +ellps=GRS67 +towgs84=-57,1,-4");
-    add_proj4text (p, 1,
-        "1,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 25S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-33],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9195\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29187, "epsg", 29187,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=25 +south +ellps=GRS67 +towgs84=-57,1,-4"
+        "1,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 25S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-33],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9195\"]]"},
+    {29187, "epsg", 29187,
         "SAD69 / UTM zone 17S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=17 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 17S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-81],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9187\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29188, "epsg", 29188,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=17 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 17S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-81],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9187\"]]"},
+    {29188, "epsg", 29188,
         "SAD69 / UTM zone 18S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=18 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 18S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-75],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9188\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29189, "epsg", 29189,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=18 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 18S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-75],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9188\"]]"},
+    {29189, "epsg", 29189,
         "SAD69 / UTM zone 19S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=19 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 19S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-69],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9189\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29190, "epsg", 29190,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=19 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 19S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-69],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9189\"]]"},
+    {29190, "epsg", 29190,
         "SAD69 / UTM zone 20S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 20S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9190\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29191, "epsg", 29191,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 20S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-63],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9190\"]]"},
+    {29191, "epsg", 29191,
         "SAD69 / UTM zone 21S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 21S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-57],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9191\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29192, "epsg", 29192,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 21S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-57],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9191\"]]"},
+    {29192, "epsg", 29192,
         "SAD69 / UTM zone 22S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=22 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 22S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-51],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9192\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29193, "epsg", 29193,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=22 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 22S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-51],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9192\"]]"},
+    {29193, "epsg", 29193,
         "SAD69 / UTM zone 23S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=23 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 23S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-45],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9193\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29194, "epsg", 29194,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=23 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 23S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-45],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9193\"]]"},
+    {29194, "epsg", 29194,
         "SAD69 / UTM zone 24S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=24 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 24S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-39],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9194\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29195, "epsg", 29195,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=24 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 24S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-39],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9194\"]]"},
+    {29195, "epsg", 29195,
         "SAD69 / UTM zone 25S", 0, 0,
         "GRS 1967 Modified", "Greenwich",
         "South_American_Datum_1969", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=25 +south +ellps=aust_SA +towgs84=-66.87");
-    add_proj4text (p, 1,
-        ",4.37,-38.52,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"SAD69 / UTM zone 25S\",GEOGCS[\"SAD69\",DATUM[\"");
-    add_srs_wkt (p, 1,
-        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified");
-    add_srs_wkt (p, 2,
-        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT");
-    add_srs_wkt (p, 3,
-        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",-33],PAR");
-    add_srs_wkt (p, 8,
-        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin");
-    add_srs_wkt (p, 9,
-        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT[");
-    add_srs_wkt (p, 10,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting");
-    add_srs_wkt (p, 11,
-        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 12,
-        "9195\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29220, "epsg", 29220,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=25 +south +ellps=aust_SA +towgs84=-66.87"
+        ",4.37,-38.52,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"SAD69 / UTM zone 25S\",GEOGCS[\"SAD69\",DATUM[\""
+        "South_American_Datum_1969\",SPHEROID[\"GRS 1967 Modified"
+        "\",6378160,298.25,AUTHORITY[\"EPSG\",\"7050\"]],AUTHORIT"
+        "Y[\"EPSG\",\"6618\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4618\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",-33],PAR"
+        "AMETER[\"scale_factor\",0.9996],PARAMETER[\"false_eastin"
+        "g\",500000],PARAMETER[\"false_northing\",10000000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting"
+        "\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2"
+        "9195\"]]"},
+    {29220, "epsg", 29220,
         "Sapper Hill 1943 / UTM zone 20S", 0, 0,
         "International 1924", "Greenwich",
         "Sapper_Hill_1943", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=20 +south +ellps=intl +towgs84=-355,21,7");
-    add_proj4text (p, 1,
-        "2,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Sapper Hill 1943 / UTM zone 20S\",GEOGCS[\"Sapp");
-    add_srs_wkt (p, 1,
-        "er Hill 1943\",DATUM[\"Sapper_Hill_1943\",SPHEROID[\"Int");
-    add_srs_wkt (p, 2,
-        "ernational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6292\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4292\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"29220\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29221, "epsg", 29221,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=20 +south +ellps=intl +towgs84=-355,21,7"
+        "2,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Sapper Hill 1943 / UTM zone 20S\",GEOGCS[\"Sapp"
+        "er Hill 1943\",DATUM[\"Sapper_Hill_1943\",SPHEROID[\"Int"
+        "ernational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\""
+        "]],AUTHORITY[\"EPSG\",\"6292\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4292\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-63],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"29220\"]]"},
+    {29221, "epsg", 29221,
         "Sapper Hill 1943 / UTM zone 21S", 0, 0,
         "International 1924", "Greenwich",
         "Sapper_Hill_1943", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +south +ellps=intl +towgs84=-355,21,7");
-    add_proj4text (p, 1,
-        "2,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Sapper Hill 1943 / UTM zone 21S\",GEOGCS[\"Sapp");
-    add_srs_wkt (p, 1,
-        "er Hill 1943\",DATUM[\"Sapper_Hill_1943\",SPHEROID[\"Int");
-    add_srs_wkt (p, 2,
-        "ernational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6292\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4292\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f");
-    add_srs_wkt (p, 9,
-        "alse_easting\",500000],PARAMETER[\"false_northing\",1000");
-    add_srs_wkt (p, 10,
-        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"29221\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29333, "epsg", 29333,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +south +ellps=intl +towgs84=-355,21,7"
+        "2,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Sapper Hill 1943 / UTM zone 21S\",GEOGCS[\"Sapp"
+        "er Hill 1943\",DATUM[\"Sapper_Hill_1943\",SPHEROID[\"Int"
+        "ernational 1924\",6378388,297,AUTHORITY[\"EPSG\",\"7022\""
+        "]],AUTHORITY[\"EPSG\",\"6292\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4292\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",-57],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"f"
+        "alse_easting\",500000],PARAMETER[\"false_northing\",1000"
+        "0000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"29221\"]]"},
+    {29333, "epsg", 29333,
         "Schwarzeck / UTM zone 33S", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=33 +south +ellps=bess_nam +towgs84=616,9");
-    add_proj4text (p, 1,
-        "7,-251,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / UTM zone 33S\",GEOGCS[\"Schwarzeck");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\"");
-    add_srs_wkt (p, 2,
-        ",6377483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"");
-    add_srs_wkt (p, 3,
-        "]],AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,");
-    add_srs_wkt (p, 4,
-        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329");
-    add_srs_wkt (p, 5,
-        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 6,
-        ",\"4293\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE");
-    add_srs_wkt (p, 7,
-        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian");
-    add_srs_wkt (p, 8,
-        "\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",500000],PARAMETER[\"false_northing\",10000");
-    add_srs_wkt (p, 10,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 11,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"29333\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29371, "epsg", 29371,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=33 +south +ellps=bess_nam +towgs84=616,9"
+        "7,-251,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Schwarzeck / UTM zone 33S\",GEOGCS[\"Schwarzeck"
+        "\",DATUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\""
+        ",6377483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\""
+        "]],AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,"
+        "AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329"
+        "25199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\""
+        ",\"4293\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETE"
+        "R[\"latitude_of_origin\",0],PARAMETER[\"central_meridian"
+        "\",15],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"fa"
+        "lse_easting\",500000],PARAMETER[\"false_northing\",10000"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"29333\"]]"},
+    {29371, "epsg", 29371,
         "Schwarzeck / Lo22/11", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator_South_Orientated", "German legal metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-22 +lon_0=11 +k=1 +x_0=0 +y_0=0 +axi");
-    add_proj4text (p, 1,
-        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m");
-    add_proj4text (p, 2,
-        "eter=1.0000135965 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / Lo22/11\",GEOGCS[\"Schwarzeck\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637");
-    add_srs_wkt (p, 2,
-        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat");
-    add_srs_wkt (p, 7,
-        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",11],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing");
-    add_srs_wkt (p, 12,
-        "\",SOUTH],AUTHORITY[\"EPSG\",\"29371\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29373, "epsg", 29373,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=-22 +lon_0=11 +k=1 +x_0=0 +y_0=0 +axi"
+        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m"
+        "eter=1.0000135965 +no_defs",
+        "PROJCS[\"Schwarzeck / Lo22/11\",GEOGCS[\"Schwarzeck\",DA"
+        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637"
+        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],"
+        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat"
+        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\""
+        "central_meridian\",11],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\""
+        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing"
+        "\",SOUTH],AUTHORITY[\"EPSG\",\"29371\"]]"},
+    {29373, "epsg", 29373,
         "Schwarzeck / Lo22/13", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator_South_Orientated", "German legal metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-22 +lon_0=13 +k=1 +x_0=0 +y_0=0 +axi");
-    add_proj4text (p, 1,
-        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m");
-    add_proj4text (p, 2,
-        "eter=1.0000135965 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / Lo22/13\",GEOGCS[\"Schwarzeck\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637");
-    add_srs_wkt (p, 2,
-        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat");
-    add_srs_wkt (p, 7,
-        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",13],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing");
-    add_srs_wkt (p, 12,
-        "\",SOUTH],AUTHORITY[\"EPSG\",\"29373\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29375, "epsg", 29375,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=-22 +lon_0=13 +k=1 +x_0=0 +y_0=0 +axi"
+        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m"
+        "eter=1.0000135965 +no_defs",
+        "PROJCS[\"Schwarzeck / Lo22/13\",GEOGCS[\"Schwarzeck\",DA"
+        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637"
+        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],"
+        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat"
+        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\""
+        "central_meridian\",13],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\""
+        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing"
+        "\",SOUTH],AUTHORITY[\"EPSG\",\"29373\"]]"},
+    {29375, "epsg", 29375,
         "Schwarzeck / Lo22/15", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator_South_Orientated", "German legal metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-22 +lon_0=15 +k=1 +x_0=0 +y_0=0 +axi");
-    add_proj4text (p, 1,
-        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m");
-    add_proj4text (p, 2,
-        "eter=1.0000135965 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / Lo22/15\",GEOGCS[\"Schwarzeck\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637");
-    add_srs_wkt (p, 2,
-        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat");
-    add_srs_wkt (p, 7,
-        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",15],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing");
-    add_srs_wkt (p, 12,
-        "\",SOUTH],AUTHORITY[\"EPSG\",\"29375\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29377, "epsg", 29377,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=-22 +lon_0=15 +k=1 +x_0=0 +y_0=0 +axi"
+        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m"
+        "eter=1.0000135965 +no_defs",
+        "PROJCS[\"Schwarzeck / Lo22/15\",GEOGCS[\"Schwarzeck\",DA"
+        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637"
+        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],"
+        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat"
+        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\""
+        "central_meridian\",15],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\""
+        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing"
+        "\",SOUTH],AUTHORITY[\"EPSG\",\"29375\"]]"},
+    {29377, "epsg", 29377,
         "Schwarzeck / Lo22/17", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator_South_Orientated", "German legal metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-22 +lon_0=17 +k=1 +x_0=0 +y_0=0 +axi");
-    add_proj4text (p, 1,
-        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m");
-    add_proj4text (p, 2,
-        "eter=1.0000135965 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / Lo22/17\",GEOGCS[\"Schwarzeck\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637");
-    add_srs_wkt (p, 2,
-        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat");
-    add_srs_wkt (p, 7,
-        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",17],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing");
-    add_srs_wkt (p, 12,
-        "\",SOUTH],AUTHORITY[\"EPSG\",\"29377\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29379, "epsg", 29379,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=-22 +lon_0=17 +k=1 +x_0=0 +y_0=0 +axi"
+        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m"
+        "eter=1.0000135965 +no_defs",
+        "PROJCS[\"Schwarzeck / Lo22/17\",GEOGCS[\"Schwarzeck\",DA"
+        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637"
+        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],"
+        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat"
+        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\""
+        "central_meridian\",17],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\""
+        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing"
+        "\",SOUTH],AUTHORITY[\"EPSG\",\"29377\"]]"},
+    {29379, "epsg", 29379,
         "Schwarzeck / Lo22/19", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator_South_Orientated", "German legal metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-22 +lon_0=19 +k=1 +x_0=0 +y_0=0 +axi");
-    add_proj4text (p, 1,
-        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m");
-    add_proj4text (p, 2,
-        "eter=1.0000135965 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / Lo22/19\",GEOGCS[\"Schwarzeck\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637");
-    add_srs_wkt (p, 2,
-        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat");
-    add_srs_wkt (p, 7,
-        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",19],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing");
-    add_srs_wkt (p, 12,
-        "\",SOUTH],AUTHORITY[\"EPSG\",\"29379\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29381, "epsg", 29381,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=-22 +lon_0=19 +k=1 +x_0=0 +y_0=0 +axi"
+        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m"
+        "eter=1.0000135965 +no_defs",
+        "PROJCS[\"Schwarzeck / Lo22/19\",GEOGCS[\"Schwarzeck\",DA"
+        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637"
+        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],"
+        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat"
+        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\""
+        "central_meridian\",19],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\""
+        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing"
+        "\",SOUTH],AUTHORITY[\"EPSG\",\"29379\"]]"},
+    {29381, "epsg", 29381,
         "Schwarzeck / Lo22/21", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator_South_Orientated", "German legal metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-22 +lon_0=21 +k=1 +x_0=0 +y_0=0 +axi");
-    add_proj4text (p, 1,
-        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m");
-    add_proj4text (p, 2,
-        "eter=1.0000135965 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / Lo22/21\",GEOGCS[\"Schwarzeck\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637");
-    add_srs_wkt (p, 2,
-        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat");
-    add_srs_wkt (p, 7,
-        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",21],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing");
-    add_srs_wkt (p, 12,
-        "\",SOUTH],AUTHORITY[\"EPSG\",\"29381\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29383, "epsg", 29383,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=-22 +lon_0=21 +k=1 +x_0=0 +y_0=0 +axi"
+        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m"
+        "eter=1.0000135965 +no_defs",
+        "PROJCS[\"Schwarzeck / Lo22/21\",GEOGCS[\"Schwarzeck\",DA"
+        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637"
+        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],"
+        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat"
+        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\""
+        "central_meridian\",21],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\""
+        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing"
+        "\",SOUTH],AUTHORITY[\"EPSG\",\"29381\"]]"},
+    {29383, "epsg", 29383,
         "Schwarzeck / Lo22/23", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator_South_Orientated", "German legal metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-22 +lon_0=23 +k=1 +x_0=0 +y_0=0 +axi");
-    add_proj4text (p, 1,
-        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m");
-    add_proj4text (p, 2,
-        "eter=1.0000135965 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / Lo22/23\",GEOGCS[\"Schwarzeck\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637");
-    add_srs_wkt (p, 2,
-        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat");
-    add_srs_wkt (p, 7,
-        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",23],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing");
-    add_srs_wkt (p, 12,
-        "\",SOUTH],AUTHORITY[\"EPSG\",\"29383\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29385, "epsg", 29385,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=-22 +lon_0=23 +k=1 +x_0=0 +y_0=0 +axi"
+        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m"
+        "eter=1.0000135965 +no_defs",
+        "PROJCS[\"Schwarzeck / Lo22/23\",GEOGCS[\"Schwarzeck\",DA"
+        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637"
+        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],"
+        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat"
+        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\""
+        "central_meridian\",23],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\""
+        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing"
+        "\",SOUTH],AUTHORITY[\"EPSG\",\"29383\"]]"},
+    {29385, "epsg", 29385,
         "Schwarzeck / Lo22/25", 0, 0,
         "Bessel Namibia (GLM)", "Greenwich",
         "Schwarzeck", "Transverse_Mercator_South_Orientated", "German legal metre",
-        "Westing", "West", "Southing", "South");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=-22 +lon_0=25 +k=1 +x_0=0 +y_0=0 +axi");
-    add_proj4text (p, 1,
-        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m");
-    add_proj4text (p, 2,
-        "eter=1.0000135965 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Schwarzeck / Lo22/25\",GEOGCS[\"Schwarzeck\",DA");
-    add_srs_wkt (p, 1,
-        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637");
-    add_srs_wkt (p, 2,
-        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],");
-    add_srs_wkt (p, 3,
-        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT");
-    add_srs_wkt (p, 4,
-        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251");
-    add_srs_wkt (p, 5,
-        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat");
-    add_srs_wkt (p, 7,
-        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",25],PARAMETER[\"scale_factor\",1],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\"");
-    add_srs_wkt (p, 10,
-        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing");
-    add_srs_wkt (p, 12,
-        "\",SOUTH],AUTHORITY[\"EPSG\",\"29385\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29635, "epsg", 29635,
+        "Westing", "West", "Southing", "South",
+        "+proj=tmerc +lat_0=-22 +lon_0=25 +k=1 +x_0=0 +y_0=0 +axi"
+        "s=wsu +ellps=bess_nam +towgs84=616,97,-251,0,0,0,0 +to_m"
+        "eter=1.0000135965 +no_defs",
+        "PROJCS[\"Schwarzeck / Lo22/25\",GEOGCS[\"Schwarzeck\",DA"
+        "TUM[\"Schwarzeck\",SPHEROID[\"Bessel Namibia (GLM)\",637"
+        "7483.86528042,299.1528128,AUTHORITY[\"EPSG\",\"7046\"]],"
+        "AUTHORITY[\"EPSG\",\"6293\"]],PRIMEM[\"Greenwich\",0,AUT"
+        "HORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01745329251"
+        "99433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\""
+        "4293\"]],PROJECTION[\"Transverse_Mercator_South_Orientat"
+        "ed\"],PARAMETER[\"latitude_of_origin\",-22],PARAMETER[\""
+        "central_meridian\",25],PARAMETER[\"scale_factor\",1],PAR"
+        "AMETER[\"false_easting\",0],PARAMETER[\"false_northing\""
+        ",0],UNIT[\"German legal metre\",1.0000135965,AUTHORITY[\""
+        "EPSG\",\"9031\"]],AXIS[\"Westing\",WEST],AXIS[\"Southing"
+        "\",SOUTH],AUTHORITY[\"EPSG\",\"29385\"]]"},
+    {29635, "epsg", 29635,
         "Adindan / UTM zone 35N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Adindan", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=35 +a=6378249.2 +b=6356515 +units=m +no_");
-    add_proj4text (p, 1,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Adindan / UTM zone 35N\",GEOGCS[\"Adindan\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Adindan\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 2,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6201\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4201\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",27],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"20135\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29636, "epsg", 29636,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=35 +a=6378249.2 +b=6356515 +units=m +no_"
+        "defs",
+        "PROJCS[\"Adindan / UTM zone 35N\",GEOGCS[\"Adindan\",DAT"
+        "UM[\"Adindan\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6201\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4201\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",27],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"20135\"]]"},
+    {29636, "epsg", 29636,
         "Adindan / UTM zone 36N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Adindan", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=36 +a=6378249.2 +b=6356515 +units=m +no_");
-    add_proj4text (p, 1,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Adindan / UTM zone 36N\",GEOGCS[\"Adindan\",DAT");
-    add_srs_wkt (p, 1,
-        "UM[\"Adindan\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14");
-    add_srs_wkt (p, 2,
-        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"6201\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 4,
-        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[");
-    add_srs_wkt (p, 5,
-        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4201\"]],PROJEC");
-    add_srs_wkt (p, 6,
-        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or");
-    add_srs_wkt (p, 7,
-        "igin\",0],PARAMETER[\"central_meridian\",33],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"20136\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29700, "epsg", 29700,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=36 +a=6378249.2 +b=6356515 +units=m +no_"
+        "defs",
+        "PROJCS[\"Adindan / UTM zone 36N\",GEOGCS[\"Adindan\",DAT"
+        "UM[\"Adindan\",SPHEROID[\"Clarke 1880 (RGS)\",6378249.14"
+        "5,293.465,AUTHORITY[\"EPSG\",\"7012\"]],AUTHORITY[\"EPSG"
+        "\",\"6201\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\","
+        "\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY["
+        "\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4201\"]],PROJEC"
+        "TION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_or"
+        "igin\",0],PARAMETER[\"central_meridian\",33],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"20136\"]]"},
+    {29700, "epsg", 29700,
         "Tananarive (Paris) / Laborde Grid (deprecated)", 0, 0,
         "International 1924", "Paris",
         "Tananarive_1925_Paris", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=-18.9 +lonc=44.10000000000001 +alpha=");
-    add_proj4text (p, 1,
-        "18.9 +k=0.9995000000000001 +x_0=400000 +y_0=800000 +gamm");
-    add_proj4text (p, 2,
-        "a=18.9 +ellps=intl +towgs84=-189,-242,-91,0,0,0,0 +pm=pa");
-    add_proj4text (p, 3,
-        "ris +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tananarive (Paris) / Laborde Grid (deprecated)\"");
-    add_srs_wkt (p, 1,
-        ",GEOGCS[\"Tananarive (Paris)\",DATUM[\"Tananarive_1925_P");
-    add_srs_wkt (p, 2,
-        "aris\",SPHEROID[\"International 1924\",6378388,297,AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6810\"]],P");
-    add_srs_wkt (p, 4,
-        "RIMEM[\"Paris\",2.33722917,AUTHORITY[\"EPSG\",\"8903\"]]");
-    add_srs_wkt (p, 5,
-        ",UNIT[\"grad\",0.0157079632679489,AUTHORITY[\"EPSG\",\"9");
-    add_srs_wkt (p, 6,
-        "105\"]],AUTHORITY[\"EPSG\",\"4810\"]],PROJECTION[\"Hotin");
-    add_srs_wkt (p, 7,
-        "e_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 8,
-        "e_of_center\",-21],PARAMETER[\"longitude_of_center\",49]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"azimuth\",21],PARAMETER[\"rectified_grid_an");
-    add_srs_wkt (p, 10,
-        "gle\",21],PARAMETER[\"scale_factor\",0.9995],PARAMETER[\"");
-    add_srs_wkt (p, 11,
-        "false_easting\",400000],PARAMETER[\"false_northing\",800");
-    add_srs_wkt (p, 12,
-        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS");
-    add_srs_wkt (p, 13,
-        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 14,
-        "EPSG\",\"29700\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29701, "epsg", 29701,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=-18.9 +lonc=44.10000000000001 +alpha="
+        "18.9 +k=0.9995000000000001 +x_0=400000 +y_0=800000 +gamm"
+        "a=18.9 +ellps=intl +towgs84=-189,-242,-91,0,0,0,0 +pm=pa"
+        "ris +units=m +no_defs",
+        "PROJCS[\"Tananarive (Paris) / Laborde Grid (deprecated)\""
+        ",GEOGCS[\"Tananarive (Paris)\",DATUM[\"Tananarive_1925_P"
+        "aris\",SPHEROID[\"International 1924\",6378388,297,AUTHO"
+        "RITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6810\"]],P"
+        "RIMEM[\"Paris\",2.33722917,AUTHORITY[\"EPSG\",\"8903\"]]"
+        ",UNIT[\"grad\",0.0157079632679489,AUTHORITY[\"EPSG\",\"9"
+        "105\"]],AUTHORITY[\"EPSG\",\"4810\"]],PROJECTION[\"Hotin"
+        "e_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"latitud"
+        "e_of_center\",-21],PARAMETER[\"longitude_of_center\",49]"
+        ",PARAMETER[\"azimuth\",21],PARAMETER[\"rectified_grid_an"
+        "gle\",21],PARAMETER[\"scale_factor\",0.9995],PARAMETER[\""
+        "false_easting\",400000],PARAMETER[\"false_northing\",800"
+        "000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS"
+        "[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"29700\"]]"},
+    {29701, "epsg", 29701,
         "Tananarive (Paris) / Laborde Grid", 0, 1,
         "International 1924", "Paris",
         "Tananarive_1925_Paris", "Laborde_Oblique_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=labrd +lat_0=-18.9 +lon_0=44.1 +azi=18.9 +k=0.9995");
-    add_proj4text (p, 1,
-        " +x_0=400000 +y_0=800000 +ellps=intl +pm=paris +units=m ");
-    add_proj4text (p, 2,
-        "+no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tananarive (Paris) / Laborde Grid\",GEOGCS[\"Ta");
-    add_srs_wkt (p, 1,
-        "nanarive (Paris)\",DATUM[\"Tananarive_1925_Paris\",SPHER");
-    add_srs_wkt (p, 2,
-        "OID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7022\"]],AUTHORITY[\"EPSG\",\"6810\"]],PRIMEM[\"Paris");
-    add_srs_wkt (p, 4,
-        "\",2.33722917,AUTHORITY[\"EPSG\",\"8903\"]],UNIT[\"grad\"");
-    add_srs_wkt (p, 5,
-        ",0.0157079632679489,AUTHORITY[\"EPSG\",\"9105\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4810\"]],PROJECTION[\"Laborde_Oblique_Mer");
-    add_srs_wkt (p, 7,
-        "cator\"],PARAMETER[\"latitude_of_center\",-21],PARAMETER");
-    add_srs_wkt (p, 8,
-        "[\"longitude_of_center\",49],PARAMETER[\"azimuth\",21],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"scale_factor\",0.9995],PARAMETER[\"false_east");
-    add_srs_wkt (p, 10,
-        "ing\",400000],PARAMETER[\"false_northing\",800000],UNIT[");
-    add_srs_wkt (p, 11,
-        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northin");
-    add_srs_wkt (p, 12,
-        "g\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2");
-    add_srs_wkt (p, 13,
-        "9701\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29702, "epsg", 29702,
+        "Northing", "North", "Easting", "East",
+        "+proj=labrd +lat_0=-18.9 +lon_0=44.1 +azi=18.9 +k=0.9995"
+        " +x_0=400000 +y_0=800000 +ellps=intl +pm=paris +units=m "
+        "+no_defs",
+        "PROJCS[\"Tananarive (Paris) / Laborde Grid\",GEOGCS[\"Ta"
+        "nanarive (Paris)\",DATUM[\"Tananarive_1925_Paris\",SPHER"
+        "OID[\"International 1924\",6378388,297,AUTHORITY[\"EPSG\""
+        ",\"7022\"]],AUTHORITY[\"EPSG\",\"6810\"]],PRIMEM[\"Paris"
+        "\",2.33722917,AUTHORITY[\"EPSG\",\"8903\"]],UNIT[\"grad\""
+        ",0.0157079632679489,AUTHORITY[\"EPSG\",\"9105\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4810\"]],PROJECTION[\"Laborde_Oblique_Mer"
+        "cator\"],PARAMETER[\"latitude_of_center\",-21],PARAMETER"
+        "[\"longitude_of_center\",49],PARAMETER[\"azimuth\",21],P"
+        "ARAMETER[\"scale_factor\",0.9995],PARAMETER[\"false_east"
+        "ing\",400000],PARAMETER[\"false_northing\",800000],UNIT["
+        "\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northin"
+        "g\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"2"
+        "9701\"]]"},
+    {29702, "epsg", 29702,
         "Tananarive (Paris) / Laborde Grid approximation", 0, 1,
         "International 1924", "Paris",
         "Tananarive_1925_Paris", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=-18.9 +lonc=44.10000000000001 +alpha=");
-    add_proj4text (p, 1,
-        "18.9 +k=0.9995000000000001 +x_0=400000 +y_0=800000 +gamm");
-    add_proj4text (p, 2,
-        "a=18.9 +ellps=intl +towgs84=-189,-242,-91,0,0,0,0 +pm=pa");
-    add_proj4text (p, 3,
-        "ris +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tananarive (Paris) / Laborde Grid approximation");
-    add_srs_wkt (p, 1,
-        "\",GEOGCS[\"Tananarive (Paris)\",DATUM[\"Tananarive_1925");
-    add_srs_wkt (p, 2,
-        "_Paris\",SPHEROID[\"International 1924\",6378388,297,AUT");
-    add_srs_wkt (p, 3,
-        "HORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6810\"]]");
-    add_srs_wkt (p, 4,
-        ",PRIMEM[\"Paris\",2.33722917,AUTHORITY[\"EPSG\",\"8903\"");
-    add_srs_wkt (p, 5,
-        "]],UNIT[\"grad\",0.0157079632679489,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 6,
-        "9105\"]],AUTHORITY[\"EPSG\",\"4810\"]],PROJECTION[\"Hoti");
-    add_srs_wkt (p, 7,
-        "ne_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"latitu");
-    add_srs_wkt (p, 8,
-        "de_of_center\",-21],PARAMETER[\"longitude_of_center\",49");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"azimuth\",21],PARAMETER[\"rectified_grid_a");
-    add_srs_wkt (p, 10,
-        "ngle\",21],PARAMETER[\"scale_factor\",0.9995],PARAMETER[");
-    add_srs_wkt (p, 11,
-        "\"false_easting\",400000],PARAMETER[\"false_northing\",8");
-    add_srs_wkt (p, 12,
-        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 13,
-        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[");
-    add_srs_wkt (p, 14,
-        "\"EPSG\",\"29702\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29738, "epsg", 29738,
+        "Northing", "North", "Easting", "East",
+        "+proj=omerc +lat_0=-18.9 +lonc=44.10000000000001 +alpha="
+        "18.9 +k=0.9995000000000001 +x_0=400000 +y_0=800000 +gamm"
+        "a=18.9 +ellps=intl +towgs84=-189,-242,-91,0,0,0,0 +pm=pa"
+        "ris +units=m +no_defs",
+        "PROJCS[\"Tananarive (Paris) / Laborde Grid approximation"
+        "\",GEOGCS[\"Tananarive (Paris)\",DATUM[\"Tananarive_1925"
+        "_Paris\",SPHEROID[\"International 1924\",6378388,297,AUT"
+        "HORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"6810\"]]"
+        ",PRIMEM[\"Paris\",2.33722917,AUTHORITY[\"EPSG\",\"8903\""
+        "]],UNIT[\"grad\",0.0157079632679489,AUTHORITY[\"EPSG\",\""
+        "9105\"]],AUTHORITY[\"EPSG\",\"4810\"]],PROJECTION[\"Hoti"
+        "ne_Oblique_Mercator_Azimuth_Center\"],PARAMETER[\"latitu"
+        "de_of_center\",-21],PARAMETER[\"longitude_of_center\",49"
+        "],PARAMETER[\"azimuth\",21],PARAMETER[\"rectified_grid_a"
+        "ngle\",21],PARAMETER[\"scale_factor\",0.9995],PARAMETER["
+        "\"false_easting\",400000],PARAMETER[\"false_northing\",8"
+        "00000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Northing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY["
+        "\"EPSG\",\"29702\"]]"},
+    {29738, "epsg", 29738,
         "Tananarive / UTM zone 38S", 0, 0,
         "International 1924", "Greenwich",
         "Tananarive_1925", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-189,-242");
-    add_proj4text (p, 1,
-        ",-91,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tananarive / UTM zone 38S\",GEOGCS[\"Tananarive");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Tananarive_1925\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6297\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4297\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",45],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"297");
-    add_srs_wkt (p, 12,
-        "38\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29739, "epsg", 29739,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=38 +south +ellps=intl +towgs84=-189,-242"
+        ",-91,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tananarive / UTM zone 38S\",GEOGCS[\"Tananarive"
+        "\",DATUM[\"Tananarive_1925\",SPHEROID[\"International 19"
+        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY"
+        "[\"EPSG\",\"6297\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4297\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",45],PARA"
+        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"297"
+        "38\"]]"},
+    {29739, "epsg", 29739,
         "Tananarive / UTM zone 39S", 0, 0,
         "International 1924", "Greenwich",
         "Tananarive_1925", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +south +ellps=intl +towgs84=-189,-242");
-    add_proj4text (p, 1,
-        ",-91,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tananarive / UTM zone 39S\",GEOGCS[\"Tananarive");
-    add_srs_wkt (p, 1,
-        "\",DATUM[\"Tananarive_1925\",SPHEROID[\"International 19");
-    add_srs_wkt (p, 2,
-        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6297\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4297\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",0],PARAMETER[\"central_meridian\",51],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"297");
-    add_srs_wkt (p, 12,
-        "39\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29849, "epsg", 29849,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=39 +south +ellps=intl +towgs84=-189,-242"
+        ",-91,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tananarive / UTM zone 39S\",GEOGCS[\"Tananarive"
+        "\",DATUM[\"Tananarive_1925\",SPHEROID[\"International 19"
+        "24\",6378388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY"
+        "[\"EPSG\",\"6297\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4297\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",0],PARAMETER[\"central_meridian\",51],PARA"
+        "METER[\"scale_factor\",0.9996],PARAMETER[\"false_easting"
+        "\",500000],PARAMETER[\"false_northing\",10000000],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"297"
+        "39\"]]"},
+    {29849, "epsg", 29849,
         "Timbalai 1948 / UTM zone 49N", 0, 0,
         "Everest 1830 (1967 Definition)", "Greenwich",
         "Timbalai_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=49 +ellps=evrstSS +towgs84=-679,669,-48,");
-    add_proj4text (p, 1,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Timbalai 1948 / UTM zone 49N\",GEOGCS[\"Timbala");
-    add_srs_wkt (p, 1,
-        "i 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest 1830");
-    add_srs_wkt (p, 2,
-        " (1967 Definition)\",6377298.556,300.8017,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",111],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"29849\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29850, "epsg", 29850,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=49 +ellps=evrstSS +towgs84=-679,669,-48,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Timbalai 1948 / UTM zone 49N\",GEOGCS[\"Timbala"
+        "i 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest 1830"
+        " (1967 Definition)\",6377298.556,300.8017,AUTHORITY[\"EP"
+        "SG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",111],PARAMETER[\"scale_factor\",0.9996]"
+        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"29849\"]]"},
+    {29850, "epsg", 29850,
         "Timbalai 1948 / UTM zone 50N", 0, 0,
         "Everest 1830 (1967 Definition)", "Greenwich",
         "Timbalai_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=50 +ellps=evrstSS +towgs84=-679,669,-48,");
-    add_proj4text (p, 1,
-        "0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Timbalai 1948 / UTM zone 50N\",GEOGCS[\"Timbala");
-    add_srs_wkt (p, 1,
-        "i 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest 1830");
-    add_srs_wkt (p, 2,
-        " (1967 Definition)\",6377298.556,300.8017,AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIMEM[\"G");
-    add_srs_wkt (p, 4,
-        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree");
-    add_srs_wkt (p, 5,
-        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH");
-    add_srs_wkt (p, 6,
-        "ORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Transverse_Mercat");
-    add_srs_wkt (p, 7,
-        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce");
-    add_srs_wkt (p, 8,
-        "ntral_meridian\",117],PARAMETER[\"scale_factor\",0.9996]");
-    add_srs_wkt (p, 9,
-        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n");
-    add_srs_wkt (p, 10,
-        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"");
-    add_srs_wkt (p, 11,
-        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO");
-    add_srs_wkt (p, 12,
-        "RITY[\"EPSG\",\"29850\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29871, "epsg", 29871,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=50 +ellps=evrstSS +towgs84=-679,669,-48,"
+        "0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Timbalai 1948 / UTM zone 50N\",GEOGCS[\"Timbala"
+        "i 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest 1830"
+        " (1967 Definition)\",6377298.556,300.8017,AUTHORITY[\"EP"
+        "SG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIMEM[\"G"
+        "reenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree"
+        "\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTH"
+        "ORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Transverse_Mercat"
+        "or\"],PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"ce"
+        "ntral_meridian\",117],PARAMETER[\"scale_factor\",0.9996]"
+        ",PARAMETER[\"false_easting\",500000],PARAMETER[\"false_n"
+        "orthing\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\""
+        "]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHO"
+        "RITY[\"EPSG\",\"29850\"]]"},
+    {29871, "epsg", 29871,
         "Timbalai 1948 / RSO Borneo (ch)", 0, 0,
         "Everest 1830 (1967 Definition)", "Greenwich",
         "Timbalai_1948", "Hotine_Oblique_Mercator_Azimuth_Center", "British chain (Sears 1922)",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31582047222222 ");
-    add_proj4text (p, 1,
-        "+k=0.99984 +x_0=590476.8714630401 +y_0=442857.653094361 ");
-    add_proj4text (p, 2,
-        "+gamma=53.13010236111111 +ellps=evrstSS +towgs84=-679,66");
-    add_proj4text (p, 3,
-        "9,-48,0,0,0,0 +to_meter=20.11676512155263 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Timbalai 1948 / RSO Borneo (ch)\",GEOGCS[\"Timb");
-    add_srs_wkt (p, 1,
-        "alai 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest 1");
-    add_srs_wkt (p, 2,
-        "830 (1967 Definition)\",6377298.556,300.8017,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Hotine_Oblique_M");
-    add_srs_wkt (p, 7,
-        "ercator_Azimuth_Center\"],PARAMETER[\"latitude_of_center");
-    add_srs_wkt (p, 8,
-        "\",4],PARAMETER[\"longitude_of_center\",115],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "azimuth\",53.3158204722222],PARAMETER[\"rectified_grid_a");
-    add_srs_wkt (p, 10,
-        "ngle\",53.1301023611111],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 11,
-        "984],PARAMETER[\"false_easting\",29352.4763],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",22014.3572],UNIT[\"British chain (Sears");
-    add_srs_wkt (p, 13,
-        " 1922)\",20.1167651215526,AUTHORITY[\"EPSG\",\"9042\"]],");
-    add_srs_wkt (p, 14,
-        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT");
-    add_srs_wkt (p, 15,
-        "Y[\"EPSG\",\"29871\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29872, "epsg", 29872,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31582047222222 "
+        "+k=0.99984 +x_0=590476.8714630401 +y_0=442857.653094361 "
+        "+gamma=53.13010236111111 +ellps=evrstSS +towgs84=-679,66"
+        "9,-48,0,0,0,0 +to_meter=20.11676512155263 +no_defs",
+        "PROJCS[\"Timbalai 1948 / RSO Borneo (ch)\",GEOGCS[\"Timb"
+        "alai 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest 1"
+        "830 (1967 Definition)\",6377298.556,300.8017,AUTHORITY[\""
+        "EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Hotine_Oblique_M"
+        "ercator_Azimuth_Center\"],PARAMETER[\"latitude_of_center"
+        "\",4],PARAMETER[\"longitude_of_center\",115],PARAMETER[\""
+        "azimuth\",53.3158204722222],PARAMETER[\"rectified_grid_a"
+        "ngle\",53.1301023611111],PARAMETER[\"scale_factor\",0.99"
+        "984],PARAMETER[\"false_easting\",29352.4763],PARAMETER[\""
+        "false_northing\",22014.3572],UNIT[\"British chain (Sears"
+        " 1922)\",20.1167651215526,AUTHORITY[\"EPSG\",\"9042\"]],"
+        "AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORIT"
+        "Y[\"EPSG\",\"29871\"]]"},
+    {29872, "epsg", 29872,
         "Timbalai 1948 / RSO Borneo (ftSe)", 0, 0,
         "Everest 1830 (1967 Definition)", "Greenwich",
         "Timbalai_1948", "Hotine_Oblique_Mercator_Azimuth_Center", "British foot (Sears 1922)",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31582047222222 ");
-    add_proj4text (p, 1,
-        "+k=0.99984 +x_0=590476.8727431979 +y_0=442857.6545573985");
-    add_proj4text (p, 2,
-        " +gamma=53.13010236111111 +ellps=evrstSS +towgs84=-679,6");
-    add_proj4text (p, 3,
-        "69,-48,0,0,0,0 +to_meter=0.3047994715386762 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Timbalai 1948 / RSO Borneo (ftSe)\",GEOGCS[\"Ti");
-    add_srs_wkt (p, 1,
-        "mbalai 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest");
-    add_srs_wkt (p, 2,
-        " 1830 (1967 Definition)\",6377298.556,300.8017,AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIME");
-    add_srs_wkt (p, 4,
-        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d");
-    add_srs_wkt (p, 5,
-        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]");
-    add_srs_wkt (p, 6,
-        ",AUTHORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Hotine_Obliq");
-    add_srs_wkt (p, 7,
-        "ue_Mercator_Azimuth_Center\"],PARAMETER[\"latitude_of_ce");
-    add_srs_wkt (p, 8,
-        "nter\",4],PARAMETER[\"longitude_of_center\",115],PARAMET");
-    add_srs_wkt (p, 9,
-        "ER[\"azimuth\",53.3158204722222],PARAMETER[\"rectified_g");
-    add_srs_wkt (p, 10,
-        "rid_angle\",53.1301023611111],PARAMETER[\"scale_factor\"");
-    add_srs_wkt (p, 11,
-        ",0.99984],PARAMETER[\"false_easting\",1937263.44],PARAME");
-    add_srs_wkt (p, 12,
-        "TER[\"false_northing\",1452947.58],UNIT[\"British foot (");
-    add_srs_wkt (p, 13,
-        "Sears 1922)\",0.304799471538676,AUTHORITY[\"EPSG\",\"904");
-    add_srs_wkt (p, 14,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 15,
-        "THORITY[\"EPSG\",\"29872\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29873, "epsg", 29873,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31582047222222 "
+        "+k=0.99984 +x_0=590476.8727431979 +y_0=442857.6545573985"
+        " +gamma=53.13010236111111 +ellps=evrstSS +towgs84=-679,6"
+        "69,-48,0,0,0,0 +to_meter=0.3047994715386762 +no_defs",
+        "PROJCS[\"Timbalai 1948 / RSO Borneo (ftSe)\",GEOGCS[\"Ti"
+        "mbalai 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest"
+        " 1830 (1967 Definition)\",6377298.556,300.8017,AUTHORITY"
+        "[\"EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIME"
+        "M[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"d"
+        "egree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]]"
+        ",AUTHORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Hotine_Obliq"
+        "ue_Mercator_Azimuth_Center\"],PARAMETER[\"latitude_of_ce"
+        "nter\",4],PARAMETER[\"longitude_of_center\",115],PARAMET"
+        "ER[\"azimuth\",53.3158204722222],PARAMETER[\"rectified_g"
+        "rid_angle\",53.1301023611111],PARAMETER[\"scale_factor\""
+        ",0.99984],PARAMETER[\"false_easting\",1937263.44],PARAME"
+        "TER[\"false_northing\",1452947.58],UNIT[\"British foot ("
+        "Sears 1922)\",0.304799471538676,AUTHORITY[\"EPSG\",\"904"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"29872\"]]"},
+    {29873, "epsg", 29873,
         "Timbalai 1948 / RSO Borneo (m)", 0, 0,
         "Everest 1830 (1967 Definition)", "Greenwich",
         "Timbalai_1948", "Hotine_Oblique_Mercator_Azimuth_Center", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31582047222222 ");
-    add_proj4text (p, 1,
-        "+k=0.99984 +x_0=590476.87 +y_0=442857.65 +gamma=53.13010");
-    add_proj4text (p, 2,
-        "236111111 +ellps=evrstSS +towgs84=-679,669,-48,0,0,0,0 +");
-    add_proj4text (p, 3,
-        "units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Timbalai 1948 / RSO Borneo (m)\",GEOGCS[\"Timba");
-    add_srs_wkt (p, 1,
-        "lai 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest 18");
-    add_srs_wkt (p, 2,
-        "30 (1967 Definition)\",6377298.556,300.8017,AUTHORITY[\"");
-    add_srs_wkt (p, 3,
-        "EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIMEM[\"");
-    add_srs_wkt (p, 4,
-        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre");
-    add_srs_wkt (p, 5,
-        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT");
-    add_srs_wkt (p, 6,
-        "HORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Hotine_Oblique_M");
-    add_srs_wkt (p, 7,
-        "ercator_Azimuth_Center\"],PARAMETER[\"latitude_of_center");
-    add_srs_wkt (p, 8,
-        "\",4],PARAMETER[\"longitude_of_center\",115],PARAMETER[\"");
-    add_srs_wkt (p, 9,
-        "azimuth\",53.3158204722222],PARAMETER[\"rectified_grid_a");
-    add_srs_wkt (p, 10,
-        "ngle\",53.1301023611111],PARAMETER[\"scale_factor\",0.99");
-    add_srs_wkt (p, 11,
-        "984],PARAMETER[\"false_easting\",590476.87],PARAMETER[\"");
-    add_srs_wkt (p, 12,
-        "false_northing\",442857.65],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 13,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 14,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"29873\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29874, "epsg", 29874,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +lat_0=4 +lonc=115 +alpha=53.31582047222222 "
+        "+k=0.99984 +x_0=590476.87 +y_0=442857.65 +gamma=53.13010"
+        "236111111 +ellps=evrstSS +towgs84=-679,669,-48,0,0,0,0 +"
+        "units=m +no_defs",
+        "PROJCS[\"Timbalai 1948 / RSO Borneo (m)\",GEOGCS[\"Timba"
+        "lai 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Everest 18"
+        "30 (1967 Definition)\",6377298.556,300.8017,AUTHORITY[\""
+        "EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRIMEM[\""
+        "Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degre"
+        "e\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUT"
+        "HORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Hotine_Oblique_M"
+        "ercator_Azimuth_Center\"],PARAMETER[\"latitude_of_center"
+        "\",4],PARAMETER[\"longitude_of_center\",115],PARAMETER[\""
+        "azimuth\",53.3158204722222],PARAMETER[\"rectified_grid_a"
+        "ngle\",53.1301023611111],PARAMETER[\"scale_factor\",0.99"
+        "984],PARAMETER[\"false_easting\",590476.87],PARAMETER[\""
+        "false_northing\",442857.65],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"29873\"]]"},
+    {29874, "epsg", 29874,
         "Timbalai 1948 / RSO Sarawak LSD (m)", 0, 0,
         "Everest 1830 (1967 Definition)", "Greenwich",
         "Timbalai_1948", "Hotine_Oblique_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=omerc +no_uoff +lat_0=4 +lonc=115 +alpha=53.315820");
-    add_proj4text (p, 1,
-        "4722222 +gamma=53.1301023611111 +k=0.99984 +x_0=2000000 ");
-    add_proj4text (p, 2,
-        "+y_0=5000000 +ellps=evrstSS +towgs84=-679,669,-48,0,0,0,");
-    add_proj4text (p, 3,
-        "0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Timbalai 1948 / RSO Sarawak LSD (m)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Timbalai 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Evere");
-    add_srs_wkt (p, 2,
-        "st 1830 (1967 Definition)\",6377298.556,300.8017,AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRI");
-    add_srs_wkt (p, 4,
-        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"");
-    add_srs_wkt (p, 5,
-        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]");
-    add_srs_wkt (p, 6,
-        "],AUTHORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Hotine_Obli");
-    add_srs_wkt (p, 7,
-        "que_Mercator\"],PARAMETER[\"latitude_of_center\",4],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"longitude_of_center\",115],PARAMETER[\"azimuth\"");
-    add_srs_wkt (p, 9,
-        ",53.3158204722222],PARAMETER[\"rectified_grid_angle\",53");
-    add_srs_wkt (p, 10,
-        ".1301023611111],PARAMETER[\"scale_factor\",0.99984],PARA");
-    add_srs_wkt (p, 11,
-        "METER[\"false_easting\",2000000],PARAMETER[\"false_north");
-    add_srs_wkt (p, 12,
-        "ing\",5000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900");
-    add_srs_wkt (p, 13,
-        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU");
-    add_srs_wkt (p, 14,
-        "THORITY[\"EPSG\",\"29874\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29900, "epsg", 29900,
+        "Easting", "East", "Northing", "North",
+        "+proj=omerc +no_uoff +lat_0=4 +lonc=115 +alpha=53.315820"
+        "4722222 +gamma=53.1301023611111 +k=0.99984 +x_0=2000000 "
+        "+y_0=5000000 +ellps=evrstSS +towgs84=-679,669,-48,0,0,0,"
+        "0 +units=m +no_defs",
+        "PROJCS[\"Timbalai 1948 / RSO Sarawak LSD (m)\",GEOGCS[\""
+        "Timbalai 1948\",DATUM[\"Timbalai_1948\",SPHEROID[\"Evere"
+        "st 1830 (1967 Definition)\",6377298.556,300.8017,AUTHORI"
+        "TY[\"EPSG\",\"7016\"]],AUTHORITY[\"EPSG\",\"6298\"]],PRI"
+        "MEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\""
+        "degree\",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]"
+        "],AUTHORITY[\"EPSG\",\"4298\"]],PROJECTION[\"Hotine_Obli"
+        "que_Mercator\"],PARAMETER[\"latitude_of_center\",4],PARA"
+        "METER[\"longitude_of_center\",115],PARAMETER[\"azimuth\""
+        ",53.3158204722222],PARAMETER[\"rectified_grid_angle\",53"
+        ".1301023611111],PARAMETER[\"scale_factor\",0.99984],PARA"
+        "METER[\"false_easting\",2000000],PARAMETER[\"false_north"
+        "ing\",5000000],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"900"
+        "1\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AU"
+        "THORITY[\"EPSG\",\"29874\"]]"},
+    {29900, "epsg", 29900,
         "TM65 / Irish Grid", 0, 0,
         "Airy Modified 1849", "Greenwich",
         "TM65", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=53.5 +lon_0=-8 +k=1.000035 +x_0=20000");
-    add_proj4text (p, 1,
-        "0 +y_0=250000 +ellps=mod_airy +towgs84=482.5,-130.6,564.");
-    add_proj4text (p, 2,
-        "6,-1.042,-0.214,-0.631,8.15 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TM65 / Irish Grid\",GEOGCS[\"TM65\",DATUM[\"TM6");
-    add_srs_wkt (p, 1,
-        "5\",SPHEROID[\"Airy Modified 1849\",6377340.189,299.3249");
-    add_srs_wkt (p, 2,
-        "646,AUTHORITY[\"EPSG\",\"7002\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "299\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4299\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "53.5],PARAMETER[\"central_meridian\",-8],PARAMETER[\"sca");
-    add_srs_wkt (p, 8,
-        "le_factor\",1.000035],PARAMETER[\"false_easting\",200000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",250000],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 10,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29902\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29901, "epsg", 29901,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=53.5 +lon_0=-8 +k=1.000035 +x_0=20000"
+        "0 +y_0=250000 +ellps=mod_airy +towgs84=482.5,-130.6,564."
+        "6,-1.042,-0.214,-0.631,8.15 +units=m +no_defs",
+        "PROJCS[\"TM65 / Irish Grid\",GEOGCS[\"TM65\",DATUM[\"TM6"
+        "5\",SPHEROID[\"Airy Modified 1849\",6377340.189,299.3249"
+        "646,AUTHORITY[\"EPSG\",\"7002\"]],AUTHORITY[\"EPSG\",\"6"
+        "299\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4299\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "53.5],PARAMETER[\"central_meridian\",-8],PARAMETER[\"sca"
+        "le_factor\",1.000035],PARAMETER[\"false_easting\",200000"
+        "],PARAMETER[\"false_northing\",250000],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29902\"]]"},
+    {29901, "epsg", 29901,
         "OSNI 1952 / Irish National Grid", 0, 0,
         "Airy 1830", "Greenwich",
         "OSNI_1952", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=53.5 +lon_0=-8 +k=1 +x_0=200000 +y_0=");
-    add_proj4text (p, 1,
-        "250000 +ellps=airy +towgs84=482.5,-130.6,564.6,-1.042,-0");
-    add_proj4text (p, 2,
-        ".214,-0.631,8.15 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"OSNI 1952 / Irish National Grid\",GEOGCS[\"OSNI");
-    add_srs_wkt (p, 1,
-        " 1952\",DATUM[\"OSNI_1952\",SPHEROID[\"Airy 1830\",63775");
-    add_srs_wkt (p, 2,
-        "63.396,299.3249646,AUTHORITY[\"EPSG\",\"7001\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6188\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4188\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",53.5],PARAMETER[\"central_meridian\",-8]");
-    add_srs_wkt (p, 8,
-        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting");
-    add_srs_wkt (p, 9,
-        "\",200000],PARAMETER[\"false_northing\",250000],UNIT[\"m");
-    add_srs_wkt (p, 10,
-        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",");
-    add_srs_wkt (p, 11,
-        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2990");
-    add_srs_wkt (p, 12,
-        "1\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29902, "epsg", 29902,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=53.5 +lon_0=-8 +k=1 +x_0=200000 +y_0="
+        "250000 +ellps=airy +towgs84=482.5,-130.6,564.6,-1.042,-0"
+        ".214,-0.631,8.15 +units=m +no_defs",
+        "PROJCS[\"OSNI 1952 / Irish National Grid\",GEOGCS[\"OSNI"
+        " 1952\",DATUM[\"OSNI_1952\",SPHEROID[\"Airy 1830\",63775"
+        "63.396,299.3249646,AUTHORITY[\"EPSG\",\"7001\"]],AUTHORI"
+        "TY[\"EPSG\",\"6188\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4188\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",53.5],PARAMETER[\"central_meridian\",-8]"
+        ",PARAMETER[\"scale_factor\",1],PARAMETER[\"false_easting"
+        "\",200000],PARAMETER[\"false_northing\",250000],UNIT[\"m"
+        "etre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\","
+        "EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"2990"
+        "1\"]]"},
+    {29902, "epsg", 29902,
         "TM65 / Irish Grid", 0, 0,
         "Airy Modified 1849", "Greenwich",
         "TM65", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=53.5 +lon_0=-8 +k=1.000035 +x_0=20000");
-    add_proj4text (p, 1,
-        "0 +y_0=250000 +ellps=mod_airy +towgs84=482.5,-130.6,564.");
-    add_proj4text (p, 2,
-        "6,-1.042,-0.214,-0.631,8.15 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TM65 / Irish Grid\",GEOGCS[\"TM65\",DATUM[\"TM6");
-    add_srs_wkt (p, 1,
-        "5\",SPHEROID[\"Airy Modified 1849\",6377340.189,299.3249");
-    add_srs_wkt (p, 2,
-        "646,AUTHORITY[\"EPSG\",\"7002\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "299\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4299\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "53.5],PARAMETER[\"central_meridian\",-8],PARAMETER[\"sca");
-    add_srs_wkt (p, 8,
-        "le_factor\",1.000035],PARAMETER[\"false_easting\",200000");
-    add_srs_wkt (p, 9,
-        "],PARAMETER[\"false_northing\",250000],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 10,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29902\"]]");
-    p = add_epsg_def_ex (filter, first, last, 29903, "epsg", 29903,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=53.5 +lon_0=-8 +k=1.000035 +x_0=20000"
+        "0 +y_0=250000 +ellps=mod_airy +towgs84=482.5,-130.6,564."
+        "6,-1.042,-0.214,-0.631,8.15 +units=m +no_defs",
+        "PROJCS[\"TM65 / Irish Grid\",GEOGCS[\"TM65\",DATUM[\"TM6"
+        "5\",SPHEROID[\"Airy Modified 1849\",6377340.189,299.3249"
+        "646,AUTHORITY[\"EPSG\",\"7002\"]],AUTHORITY[\"EPSG\",\"6"
+        "299\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4299\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "53.5],PARAMETER[\"central_meridian\",-8],PARAMETER[\"sca"
+        "le_factor\",1.000035],PARAMETER[\"false_easting\",200000"
+        "],PARAMETER[\"false_northing\",250000],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXI"
+        "S[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"29902\"]]"},
+    {29903, "epsg", 29903,
         "TM75 / Irish Grid", 0, 0,
         "Airy Modified 1849", "Greenwich",
         "Geodetic_Datum_of_1965", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=53.5 +lon_0=-8 +k=1.000035 +x_0=20000");
-    add_proj4text (p, 1,
-        "0 +y_0=250000 +ellps=mod_airy +towgs84=482.5,-130.6,564.");
-    add_proj4text (p, 2,
-        "6,-1.042,-0.214,-0.631,8.15 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TM75 / Irish Grid\",GEOGCS[\"TM75\",DATUM[\"Geo");
-    add_srs_wkt (p, 1,
-        "detic_Datum_of_1965\",SPHEROID[\"Airy Modified 1849\",63");
-    add_srs_wkt (p, 2,
-        "77340.189,299.3249646,AUTHORITY[\"EPSG\",\"7002\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6300\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"430");
-    add_srs_wkt (p, 6,
-        "0\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",53.5],PARAMETER[\"central_meridian\",");
-    add_srs_wkt (p, 8,
-        "-8],PARAMETER[\"scale_factor\",1.000035],PARAMETER[\"fal");
-    add_srs_wkt (p, 9,
-        "se_easting\",200000],PARAMETER[\"false_northing\",250000");
-    add_srs_wkt (p, 10,
-        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS");
-    add_srs_wkt (p, 12,
-        "G\",\"29903\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30161, "epsg", 30161,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=53.5 +lon_0=-8 +k=1.000035 +x_0=20000"
+        "0 +y_0=250000 +ellps=mod_airy +towgs84=482.5,-130.6,564."
+        "6,-1.042,-0.214,-0.631,8.15 +units=m +no_defs",
+        "PROJCS[\"TM75 / Irish Grid\",GEOGCS[\"TM75\",DATUM[\"Geo"
+        "detic_Datum_of_1965\",SPHEROID[\"Airy Modified 1849\",63"
+        "77340.189,299.3249646,AUTHORITY[\"EPSG\",\"7002\"]],AUTH"
+        "ORITY[\"EPSG\",\"6300\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"430"
+        "0\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",53.5],PARAMETER[\"central_meridian\","
+        "-8],PARAMETER[\"scale_factor\",1.000035],PARAMETER[\"fal"
+        "se_easting\",200000],PARAMETER[\"false_northing\",250000"
+        "],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\""
+        "Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPS"
+        "G\",\"29903\"]]"},
+    {30161, "epsg", 30161,
         "Tokyo / Japan Plane Rectangular CS I", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=33 +lon_0=129.5 +k=0.9999 +x_0=0 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS I\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",33],PARAMETER[\"central_meridian\",129.5],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30161\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30162, "epsg", 30162,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=33 +lon_0=129.5 +k=0.9999 +x_0=0 +y_0"
+        "=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS I\",GEOGCS[\""
+        "Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377397"
+        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY"
+        "[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",33],PARAMETER[\"central_meridian\",129.5],"
+        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas"
+        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30161\"]]"},
+    {30162, "epsg", 30162,
         "Tokyo / Japan Plane Rectangular CS II", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=33 +lon_0=131 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS II\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773");
-    add_srs_wkt (p, 2,
-        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",33],PARAMETER[\"central_meridian\",131],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30162\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30163, "epsg", 30163,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=33 +lon_0=131 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS II\",GEOGCS["
+        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773"
+        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI"
+        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",33],PARAMETER[\"central_meridian\",131],"
+        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas"
+        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30162\"]]"},
+    {30163, "epsg", 30163,
         "Tokyo / Japan Plane Rectangular CS III", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=132.1666666666667 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6");
-    add_proj4text (p, 2,
-        "80.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS III\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",36],PARAMETER[\"central_meridian\",132.1");
-    add_srs_wkt (p, 8,
-        "66666666667],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"30163\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30164, "epsg", 30164,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=36 +lon_0=132.1666666666667 +k=0.9999"
+        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6"
+        "80.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS III\",GEOGCS"
+        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377"
+        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",36],PARAMETER[\"central_meridian\",132.1"
+        "66666666667],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"30163\"]]"},
+    {30164, "epsg", 30164,
         "Tokyo / Japan Plane Rectangular CS IV", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=33 +lon_0=133.5 +k=0.9999 +x_0=0 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS IV\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773");
-    add_srs_wkt (p, 2,
-        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",33],PARAMETER[\"central_meridian\",133.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 11,
-        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30164\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 30165, "epsg", 30165,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=33 +lon_0=133.5 +k=0.9999 +x_0=0 +y_0"
+        "=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS IV\",GEOGCS["
+        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773"
+        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI"
+        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",33],PARAMETER[\"central_meridian\",133.5"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR"
+        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30164\"]"
+        "]"},
+    {30165, "epsg", 30165,
         "Tokyo / Japan Plane Rectangular CS V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=134.3333333333333 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6");
-    add_proj4text (p, 2,
-        "80.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS V\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",36],PARAMETER[\"central_meridian\",134.333");
-    add_srs_wkt (p, 8,
-        "333333333],PARAMETER[\"scale_factor\",0.9999],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",0],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "30165\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30166, "epsg", 30166,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=36 +lon_0=134.3333333333333 +k=0.9999"
+        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6"
+        "80.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS V\",GEOGCS[\""
+        "Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377397"
+        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY"
+        "[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",36],PARAMETER[\"central_meridian\",134.333"
+        "333333333],PARAMETER[\"scale_factor\",0.9999],PARAMETER["
+        "\"false_easting\",0],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "30165\"]]"},
+    {30166, "epsg", 30166,
         "Tokyo / Japan Plane Rectangular CS VI", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=136 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS VI\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773");
-    add_srs_wkt (p, 2,
-        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",36],PARAMETER[\"central_meridian\",136],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30166\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30167, "epsg", 30167,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=36 +lon_0=136 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS VI\",GEOGCS["
+        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773"
+        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI"
+        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",36],PARAMETER[\"central_meridian\",136],"
+        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas"
+        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30166\"]]"},
+    {30167, "epsg", 30167,
         "Tokyo / Japan Plane Rectangular CS VII", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=137.1666666666667 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6");
-    add_proj4text (p, 2,
-        "80.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS VII\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",36],PARAMETER[\"central_meridian\",137.1");
-    add_srs_wkt (p, 8,
-        "66666666667],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"30167\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30168, "epsg", 30168,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=36 +lon_0=137.1666666666667 +k=0.9999"
+        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6"
+        "80.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS VII\",GEOGCS"
+        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377"
+        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",36],PARAMETER[\"central_meridian\",137.1"
+        "66666666667],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"30167\"]]"},
+    {30168, "epsg", 30168,
         "Tokyo / Japan Plane Rectangular CS VIII", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=138.5 +k=0.9999 +x_0=0 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS VIII\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",637");
-    add_srs_wkt (p, 2,
-        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",36],PARAMETER[\"central_meridian\",138");
-    add_srs_wkt (p, 8,
-        ".5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false");
-    add_srs_wkt (p, 9,
-        "_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"met");
-    add_srs_wkt (p, 10,
-        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N");
-    add_srs_wkt (p, 11,
-        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30168\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 30169, "epsg", 30169,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=36 +lon_0=138.5 +k=0.9999 +x_0=0 +y_0"
+        "=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS VIII\",GEOGC"
+        "S[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",637"
+        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO"
+        "RITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",36],PARAMETER[\"central_meridian\",138"
+        ".5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false"
+        "_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"met"
+        "re\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",N"
+        "ORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30168\""
+        "]]"},
+    {30169, "epsg", 30169,
         "Tokyo / Japan Plane Rectangular CS IX", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=36 +lon_0=139.8333333333333 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6");
-    add_proj4text (p, 2,
-        "80.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS IX\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773");
-    add_srs_wkt (p, 2,
-        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",36],PARAMETER[\"central_meridian\",139.8");
-    add_srs_wkt (p, 8,
-        "33333333333],PARAMETER[\"scale_factor\",0.9999],PARAMETE");
-    add_srs_wkt (p, 9,
-        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U");
-    add_srs_wkt (p, 10,
-        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor");
-    add_srs_wkt (p, 11,
-        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 12,
-        ",\"30169\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30170, "epsg", 30170,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=36 +lon_0=139.8333333333333 +k=0.9999"
+        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6"
+        "80.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS IX\",GEOGCS["
+        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773"
+        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI"
+        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",36],PARAMETER[\"central_meridian\",139.8"
+        "33333333333],PARAMETER[\"scale_factor\",0.9999],PARAMETE"
+        "R[\"false_easting\",0],PARAMETER[\"false_northing\",0],U"
+        "NIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Nor"
+        "thing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\""
+        ",\"30169\"]]"},
+    {30170, "epsg", 30170,
         "Tokyo / Japan Plane Rectangular CS X", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=40 +lon_0=140.8333333333333 +k=0.9999");
-    add_proj4text (p, 1,
-        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6");
-    add_proj4text (p, 2,
-        "80.507,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS X\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377397");
-    add_srs_wkt (p, 2,
-        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY");
-    add_srs_wkt (p, 3,
-        "[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"");
-    add_srs_wkt (p, 4,
-        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT");
-    add_srs_wkt (p, 5,
-        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]]");
-    add_srs_wkt (p, 6,
-        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud");
-    add_srs_wkt (p, 7,
-        "e_of_origin\",40],PARAMETER[\"central_meridian\",140.833");
-    add_srs_wkt (p, 8,
-        "333333333],PARAMETER[\"scale_factor\",0.9999],PARAMETER[");
-    add_srs_wkt (p, 9,
-        "\"false_easting\",0],PARAMETER[\"false_northing\",0],UNI");
-    add_srs_wkt (p, 10,
-        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North");
-    add_srs_wkt (p, 11,
-        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 12,
-        "30170\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30171, "epsg", 30171,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=40 +lon_0=140.8333333333333 +k=0.9999"
+        " +x_0=0 +y_0=0 +ellps=bessel +towgs84=-146.414,507.337,6"
+        "80.507,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS X\",GEOGCS[\""
+        "Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377397"
+        ".155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY"
+        "[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\""
+        "EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUT"
+        "HORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"]]"
+        ",PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latitud"
+        "e_of_origin\",40],PARAMETER[\"central_meridian\",140.833"
+        "333333333],PARAMETER[\"scale_factor\",0.9999],PARAMETER["
+        "\"false_easting\",0],PARAMETER[\"false_northing\",0],UNI"
+        "T[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"North"
+        "ing\",NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\""
+        "30170\"]]"},
+    {30171, "epsg", 30171,
         "Tokyo / Japan Plane Rectangular CS XI", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=44 +lon_0=140.25 +k=0.9999 +x_0=0 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XI\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773");
-    add_srs_wkt (p, 2,
-        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",44],PARAMETER[\"central_meridian\",140.2");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NO");
-    add_srs_wkt (p, 11,
-        "RTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30171\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 30172, "epsg", 30172,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=44 +lon_0=140.25 +k=0.9999 +x_0=0 +y_"
+        "0=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XI\",GEOGCS["
+        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773"
+        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI"
+        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",44],PARAMETER[\"central_meridian\",140.2"
+        "5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_"
+        "easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NO"
+        "RTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30171\""
+        "]]"},
+    {30172, "epsg", 30172,
         "Tokyo / Japan Plane Rectangular CS XII", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=44 +lon_0=142.25 +k=0.9999 +x_0=0 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XII\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",44],PARAMETER[\"central_meridian\",142.2");
-    add_srs_wkt (p, 8,
-        "5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NO");
-    add_srs_wkt (p, 11,
-        "RTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30172\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 30173, "epsg", 30173,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=44 +lon_0=142.25 +k=0.9999 +x_0=0 +y_"
+        "0=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XII\",GEOGCS"
+        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377"
+        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",44],PARAMETER[\"central_meridian\",142.2"
+        "5],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_"
+        "easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NO"
+        "RTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30172\""
+        "]]"},
+    {30173, "epsg", 30173,
         "Tokyo / Japan Plane Rectangular CS XIII", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=44 +lon_0=144.25 +k=0.9999 +x_0=0 +y_");
-    add_proj4text (p, 1,
-        "0=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,");
-    add_proj4text (p, 2,
-        "0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XIII\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",637");
-    add_srs_wkt (p, 2,
-        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",44],PARAMETER[\"central_meridian\",144");
-    add_srs_wkt (p, 8,
-        ".25],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"fals");
-    add_srs_wkt (p, 9,
-        "e_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"me");
-    add_srs_wkt (p, 10,
-        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",");
-    add_srs_wkt (p, 11,
-        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30173");
-    add_srs_wkt (p, 12,
-        "\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30174, "epsg", 30174,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=44 +lon_0=144.25 +k=0.9999 +x_0=0 +y_"
+        "0=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,"
+        "0,0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XIII\",GEOGC"
+        "S[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",637"
+        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO"
+        "RITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",44],PARAMETER[\"central_meridian\",144"
+        ".25],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"fals"
+        "e_easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"me"
+        "tre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\","
+        "NORTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30173"
+        "\"]]"},
+    {30174, "epsg", 30174,
         "Tokyo / Japan Plane Rectangular CS XIV", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=26 +lon_0=142 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XIV\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",26],PARAMETER[\"central_meridian\",142],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30174\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30175, "epsg", 30175,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=26 +lon_0=142 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XIV\",GEOGCS"
+        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377"
+        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",26],PARAMETER[\"central_meridian\",142],"
+        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas"
+        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30174\"]]"},
+    {30175, "epsg", 30175,
         "Tokyo / Japan Plane Rectangular CS XV", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=26 +lon_0=127.5 +k=0.9999 +x_0=0 +y_0");
-    add_proj4text (p, 1,
-        "=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0");
-    add_proj4text (p, 2,
-        ",0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XV\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773");
-    add_srs_wkt (p, 2,
-        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI");
-    add_srs_wkt (p, 3,
-        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[");
-    add_srs_wkt (p, 4,
-        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A");
-    add_srs_wkt (p, 5,
-        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",26],PARAMETER[\"central_meridian\",127.5");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 11,
-        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30175\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 30176, "epsg", 30176,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=26 +lon_0=127.5 +k=0.9999 +x_0=0 +y_0"
+        "=0 +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0"
+        ",0 +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XV\",GEOGCS["
+        "\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63773"
+        "97.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORI"
+        "TY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY["
+        "\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,A"
+        "UTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",26],PARAMETER[\"central_meridian\",127.5"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR"
+        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30175\"]"
+        "]"},
+    {30176, "epsg", 30176,
         "Tokyo / Japan Plane Rectangular CS XVI", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=26 +lon_0=124 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XVI\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",26],PARAMETER[\"central_meridian\",124],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30176\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30177, "epsg", 30177,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=26 +lon_0=124 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XVI\",GEOGCS"
+        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377"
+        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",26],PARAMETER[\"central_meridian\",124],"
+        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas"
+        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30176\"]]"},
+    {30177, "epsg", 30177,
         "Tokyo / Japan Plane Rectangular CS XVII", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=26 +lon_0=131 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XVII\",GEOGC");
-    add_srs_wkt (p, 1,
-        "S[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",637");
-    add_srs_wkt (p, 2,
-        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO");
-    add_srs_wkt (p, 3,
-        "RITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORIT");
-    add_srs_wkt (p, 4,
-        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433");
-    add_srs_wkt (p, 5,
-        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301");
-    add_srs_wkt (p, 6,
-        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat");
-    add_srs_wkt (p, 7,
-        "itude_of_origin\",26],PARAMETER[\"central_meridian\",131");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre");
-    add_srs_wkt (p, 10,
-        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR");
-    add_srs_wkt (p, 11,
-        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30177\"]");
-    add_srs_wkt (p, 12,
-        "]");
-    p = add_epsg_def_ex (filter, first, last, 30178, "epsg", 30178,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=26 +lon_0=131 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XVII\",GEOGC"
+        "S[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",637"
+        "7397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHO"
+        "RITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORIT"
+        "Y[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433"
+        ",AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301"
+        "\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"lat"
+        "itude_of_origin\",26],PARAMETER[\"central_meridian\",131"
+        "],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_e"
+        "asting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre"
+        "\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NOR"
+        "TH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30177\"]"
+        "]"},
+    {30178, "epsg", 30178,
         "Tokyo / Japan Plane Rectangular CS XVIII", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=20 +lon_0=136 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XVIII\",GEOG");
-    add_srs_wkt (p, 1,
-        "CS[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63");
-    add_srs_wkt (p, 2,
-        "77397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTH");
-    add_srs_wkt (p, 3,
-        "ORITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORI");
-    add_srs_wkt (p, 4,
-        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943");
-    add_srs_wkt (p, 5,
-        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"430");
-    add_srs_wkt (p, 6,
-        "1\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la");
-    add_srs_wkt (p, 7,
-        "titude_of_origin\",20],PARAMETER[\"central_meridian\",13");
-    add_srs_wkt (p, 8,
-        "6],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_");
-    add_srs_wkt (p, 9,
-        "easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metr");
-    add_srs_wkt (p, 10,
-        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NO");
-    add_srs_wkt (p, 11,
-        "RTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30178\"");
-    add_srs_wkt (p, 12,
-        "]]");
-    p = add_epsg_def_ex (filter, first, last, 30179, "epsg", 30179,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=20 +lon_0=136 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XVIII\",GEOG"
+        "CS[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",63"
+        "77397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTH"
+        "ORITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORI"
+        "TY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.017453292519943"
+        "3,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"430"
+        "1\"]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"la"
+        "titude_of_origin\",20],PARAMETER[\"central_meridian\",13"
+        "6],PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_"
+        "easting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metr"
+        "e\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NO"
+        "RTH],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30178\""
+        "]]"},
+    {30179, "epsg", 30179,
         "Tokyo / Japan Plane Rectangular CS XIX", 0, 1,
         "Bessel 1841", "Greenwich",
         "Tokyo", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=26 +lon_0=154 +k=0.9999 +x_0=0 +y_0=0");
-    add_proj4text (p, 1,
-        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0");
-    add_proj4text (p, 2,
-        " +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XIX\",GEOGCS");
-    add_srs_wkt (p, 1,
-        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377");
-    add_srs_wkt (p, 2,
-        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR");
-    add_srs_wkt (p, 3,
-        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY");
-    add_srs_wkt (p, 4,
-        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,");
-    add_srs_wkt (p, 5,
-        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\"");
-    add_srs_wkt (p, 6,
-        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit");
-    add_srs_wkt (p, 7,
-        "ude_of_origin\",26],PARAMETER[\"central_meridian\",154],");
-    add_srs_wkt (p, 8,
-        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas");
-    add_srs_wkt (p, 9,
-        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\"");
-    add_srs_wkt (p, 10,
-        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH");
-    add_srs_wkt (p, 11,
-        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30179\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30200, "epsg", 30200,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=26 +lon_0=154 +k=0.9999 +x_0=0 +y_0=0"
+        " +ellps=bessel +towgs84=-146.414,507.337,680.507,0,0,0,0"
+        " +units=m +no_defs",
+        "PROJCS[\"Tokyo / Japan Plane Rectangular CS XIX\",GEOGCS"
+        "[\"Tokyo\",DATUM[\"Tokyo\",SPHEROID[\"Bessel 1841\",6377"
+        "397.155,299.1528128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHOR"
+        "ITY[\"EPSG\",\"6301\"]],PRIMEM[\"Greenwich\",0,AUTHORITY"
+        "[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.0174532925199433,"
+        "AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4301\""
+        "]],PROJECTION[\"Transverse_Mercator\"],PARAMETER[\"latit"
+        "ude_of_origin\",26],PARAMETER[\"central_meridian\",154],"
+        "PARAMETER[\"scale_factor\",0.9999],PARAMETER[\"false_eas"
+        "ting\",0],PARAMETER[\"false_northing\",0],UNIT[\"metre\""
+        ",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH"
+        "],AXIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"30179\"]]"},
+    {30200, "epsg", 30200,
         "Trinidad 1903 / Trinidad Grid", 0, 0,
         "Clarke 1858", "Greenwich",
         "Trinidad_1903", "Cassini_Soldner", "Clarke's link",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=cass +lat_0=10.44166666666667 +lon_0=-61.333333333");
-    add_proj4text (p, 1,
-        "33334 +x_0=86501.46392051999 +y_0=65379.0134283 +a=63782");
-    add_proj4text (p, 2,
-        "93.645208759 +b=6356617.987679838 +towgs84=-61.702,284.4");
-    add_proj4text (p, 3,
-        "88,472.052,0,0,0,0 +to_meter=0.201166195164 +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Trinidad 1903 / Trinidad Grid\",GEOGCS[\"Trinid");
-    add_srs_wkt (p, 1,
-        "ad 1903\",DATUM[\"Trinidad_1903\",SPHEROID[\"Clarke 1858");
-    add_srs_wkt (p, 2,
-        "\",6378293.64520876,294.260676369261,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7007\"]],AUTHORITY[\"EPSG\",\"6302\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4302\"]],PROJECTION[\"Cassini_Soldner\"],PAR");
-    add_srs_wkt (p, 7,
-        "AMETER[\"latitude_of_origin\",10.4416666666667],PARAMETE");
-    add_srs_wkt (p, 8,
-        "R[\"central_meridian\",-61.3333333333333],PARAMETER[\"fa");
-    add_srs_wkt (p, 9,
-        "lse_easting\",430000],PARAMETER[\"false_northing\",32500");
-    add_srs_wkt (p, 10,
-        "0],UNIT[\"Clarke's link\",0.201166195164,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 11,
-        "G\",\"9039\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\",");
-    add_srs_wkt (p, 12,
-        "NORTH],AUTHORITY[\"EPSG\",\"30200\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30339, "epsg", 30339,
+        "Easting", "East", "Northing", "North",
+        "+proj=cass +lat_0=10.44166666666667 +lon_0=-61.333333333"
+        "33334 +x_0=86501.46392051999 +y_0=65379.0134283 +a=63782"
+        "93.645208759 +b=6356617.987679838 +towgs84=-61.702,284.4"
+        "88,472.052,0,0,0,0 +to_meter=0.201166195164 +no_defs",
+        "PROJCS[\"Trinidad 1903 / Trinidad Grid\",GEOGCS[\"Trinid"
+        "ad 1903\",DATUM[\"Trinidad_1903\",SPHEROID[\"Clarke 1858"
+        "\",6378293.64520876,294.260676369261,AUTHORITY[\"EPSG\","
+        "\"7007\"]],AUTHORITY[\"EPSG\",\"6302\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4302\"]],PROJECTION[\"Cassini_Soldner\"],PAR"
+        "AMETER[\"latitude_of_origin\",10.4416666666667],PARAMETE"
+        "R[\"central_meridian\",-61.3333333333333],PARAMETER[\"fa"
+        "lse_easting\",430000],PARAMETER[\"false_northing\",32500"
+        "0],UNIT[\"Clarke's link\",0.201166195164,AUTHORITY[\"EPS"
+        "G\",\"9039\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\","
+        "NORTH],AUTHORITY[\"EPSG\",\"30200\"]]"},
+    {30339, "epsg", 30339,
         "TC(1948) / UTM zone 39N", 0, 0,
         "Helmert 1906", "Greenwich",
         "Trucial_Coast_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=39 +ellps=helmert +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TC(1948) / UTM zone 39N\",GEOGCS[\"TC(1948)\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Trucial_Coast_1948\",SPHEROID[\"Helmert 1906\",63");
-    add_srs_wkt (p, 2,
-        "78200,298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6303\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4303\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",51],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"30339\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30340, "epsg", 30340,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=39 +ellps=helmert +units=m +no_defs",
+        "PROJCS[\"TC(1948) / UTM zone 39N\",GEOGCS[\"TC(1948)\",D"
+        "ATUM[\"Trucial_Coast_1948\",SPHEROID[\"Helmert 1906\",63"
+        "78200,298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EP"
+        "SG\",\"6303\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4303\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",51],PARAMETER["
+        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"30339\"]]"},
+    {30340, "epsg", 30340,
         "TC(1948) / UTM zone 40N", 0, 0,
         "Helmert 1906", "Greenwich",
         "Trucial_Coast_1948", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=40 +ellps=helmert +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"TC(1948) / UTM zone 40N\",GEOGCS[\"TC(1948)\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Trucial_Coast_1948\",SPHEROID[\"Helmert 1906\",63");
-    add_srs_wkt (p, 2,
-        "78200,298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EP");
-    add_srs_wkt (p, 3,
-        "SG\",\"6303\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 4,
-        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY");
-    add_srs_wkt (p, 5,
-        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4303\"]],PROJE");
-    add_srs_wkt (p, 6,
-        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o");
-    add_srs_wkt (p, 7,
-        "rigin\",0],PARAMETER[\"central_meridian\",57],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500");
-    add_srs_wkt (p, 9,
-        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU");
-    add_srs_wkt (p, 10,
-        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[");
-    add_srs_wkt (p, 11,
-        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"30340\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30491, "epsg", 30491,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=40 +ellps=helmert +units=m +no_defs",
+        "PROJCS[\"TC(1948) / UTM zone 40N\",GEOGCS[\"TC(1948)\",D"
+        "ATUM[\"Trucial_Coast_1948\",SPHEROID[\"Helmert 1906\",63"
+        "78200,298.3,AUTHORITY[\"EPSG\",\"7020\"]],AUTHORITY[\"EP"
+        "SG\",\"6303\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\""
+        ",\"8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY"
+        "[\"EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4303\"]],PROJE"
+        "CTION[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_o"
+        "rigin\",0],PARAMETER[\"central_meridian\",57],PARAMETER["
+        "\"scale_factor\",0.9996],PARAMETER[\"false_easting\",500"
+        "000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AU"
+        "THORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS["
+        "\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"30340\"]]"},
+    {30491, "epsg", 30491,
         "Voirol 1875 / Nord Algerie (ancienne)", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Voirol_1875", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=2.7 +k_0=0.99962554");
-    add_proj4text (p, 1,
-        "4 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +towgs");
-    add_proj4text (p, 2,
-        "84=-73,-247,227,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Voirol 1875 / Nord Algerie (ancienne)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Voirol 1875\",DATUM[\"Voirol_1875\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 2,
-        "1880 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7011\"]],AUTHORITY[\"EPSG\",\"6304\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4304\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_1SP\"],PARAMETER[\"latitude_of_origin\",36],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.999625544],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"30491\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30492, "epsg", 30492,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=2.7 +k_0=0.99962554"
+        "4 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +towgs"
+        "84=-73,-247,227,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Voirol 1875 / Nord Algerie (ancienne)\",GEOGCS["
+        "\"Voirol 1875\",DATUM[\"Voirol_1875\",SPHEROID[\"Clarke "
+        "1880 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG"
+        "\",\"7011\"]],AUTHORITY[\"EPSG\",\"6304\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4304\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_1SP\"],PARAMETER[\"latitude_of_origin\",36],PARAMET"
+        "ER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\","
+        "0.999625544],PARAMETER[\"false_easting\",500000],PARAMET"
+        "ER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"30491\"]]"},
+    {30492, "epsg", 30492,
         "Voirol 1875 / Sud Algerie (ancienne)", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Voirol_1875", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996");
-    add_proj4text (p, 1,
-        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +t");
-    add_proj4text (p, 2,
-        "owgs84=-73,-247,227,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Voirol 1875 / Sud Algerie (ancienne)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Voirol 1875\",DATUM[\"Voirol_1875\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 2,
-        "80 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7011\"]],AUTHORITY[\"EPSG\",\"6304\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4304\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",33.3],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.999625769],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"30492\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30493, "epsg", 30493,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996"
+        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +t"
+        "owgs84=-73,-247,227,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Voirol 1875 / Sud Algerie (ancienne)\",GEOGCS[\""
+        "Voirol 1875\",DATUM[\"Voirol_1875\",SPHEROID[\"Clarke 18"
+        "80 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\""
+        ",\"7011\"]],AUTHORITY[\"EPSG\",\"6304\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4304\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",33.3],PARAMET"
+        "ER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\","
+        "0.999625769],PARAMETER[\"false_easting\",500000],PARAMET"
+        "ER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"30492\"]]"},
+    {30493, "epsg", 30493,
         "Voirol 1879 / Nord Algerie (ancienne)", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Voirol_1879", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=2.7 +k_0=0.99962554");
-    add_proj4text (p, 1,
-        "4 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +units");
-    add_proj4text (p, 2,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Voirol 1879 / Nord Algerie (ancienne)\",GEOGCS[");
-    add_srs_wkt (p, 1,
-        "\"Voirol 1879\",DATUM[\"Voirol_1879\",SPHEROID[\"Clarke ");
-    add_srs_wkt (p, 2,
-        "1880 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 3,
-        "\",\"7011\"]],AUTHORITY[\"EPSG\",\"6671\"]],PRIMEM[\"Gre");
-    add_srs_wkt (p, 4,
-        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\"");
-    add_srs_wkt (p, 5,
-        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR");
-    add_srs_wkt (p, 6,
-        "ITY[\"EPSG\",\"4671\"]],PROJECTION[\"Lambert_Conformal_C");
-    add_srs_wkt (p, 7,
-        "onic_1SP\"],PARAMETER[\"latitude_of_origin\",36],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.999625544],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"30493\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30494, "epsg", 30494,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=2.7 +k_0=0.99962554"
+        "4 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +units"
+        "=m +no_defs",
+        "PROJCS[\"Voirol 1879 / Nord Algerie (ancienne)\",GEOGCS["
+        "\"Voirol 1879\",DATUM[\"Voirol_1879\",SPHEROID[\"Clarke "
+        "1880 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG"
+        "\",\"7011\"]],AUTHORITY[\"EPSG\",\"6671\"]],PRIMEM[\"Gre"
+        "enwich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\""
+        ",0.0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHOR"
+        "ITY[\"EPSG\",\"4671\"]],PROJECTION[\"Lambert_Conformal_C"
+        "onic_1SP\"],PARAMETER[\"latitude_of_origin\",36],PARAMET"
+        "ER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\","
+        "0.999625544],PARAMETER[\"false_easting\",500000],PARAMET"
+        "ER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"30493\"]]"},
+    {30494, "epsg", 30494,
         "Voirol 1879 / Sud Algerie (ancienne)", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Voirol_1879", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996");
-    add_proj4text (p, 1,
-        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +u");
-    add_proj4text (p, 2,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Voirol 1879 / Sud Algerie (ancienne)\",GEOGCS[\"");
-    add_srs_wkt (p, 1,
-        "Voirol 1879\",DATUM[\"Voirol_1879\",SPHEROID[\"Clarke 18");
-    add_srs_wkt (p, 2,
-        "80 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"7011\"]],AUTHORITY[\"EPSG\",\"6671\"]],PRIMEM[\"Green");
-    add_srs_wkt (p, 4,
-        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0");
-    add_srs_wkt (p, 5,
-        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT");
-    add_srs_wkt (p, 6,
-        "Y[\"EPSG\",\"4671\"]],PROJECTION[\"Lambert_Conformal_Con");
-    add_srs_wkt (p, 7,
-        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",33.3],PARAMET");
-    add_srs_wkt (p, 8,
-        "ER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\",");
-    add_srs_wkt (p, 9,
-        "0.999625769],PARAMETER[\"false_easting\",500000],PARAMET");
-    add_srs_wkt (p, 10,
-        "ER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY");
-    add_srs_wkt (p, 11,
-        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North");
-    add_srs_wkt (p, 12,
-        "ing\",NORTH],AUTHORITY[\"EPSG\",\"30494\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30729, "epsg", 30729,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996"
+        "25769 +x_0=500000 +y_0=300000 +a=6378249.2 +b=6356515 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"Voirol 1879 / Sud Algerie (ancienne)\",GEOGCS[\""
+        "Voirol 1879\",DATUM[\"Voirol_1879\",SPHEROID[\"Clarke 18"
+        "80 (IGN)\",6378249.2,293.466021293627,AUTHORITY[\"EPSG\""
+        ",\"7011\"]],AUTHORITY[\"EPSG\",\"6671\"]],PRIMEM[\"Green"
+        "wich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0"
+        ".0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORIT"
+        "Y[\"EPSG\",\"4671\"]],PROJECTION[\"Lambert_Conformal_Con"
+        "ic_1SP\"],PARAMETER[\"latitude_of_origin\",33.3],PARAMET"
+        "ER[\"central_meridian\",2.7],PARAMETER[\"scale_factor\","
+        "0.999625769],PARAMETER[\"false_easting\",500000],PARAMET"
+        "ER[\"false_northing\",300000],UNIT[\"metre\",1,AUTHORITY"
+        "[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"North"
+        "ing\",NORTH],AUTHORITY[\"EPSG\",\"30494\"]]"},
+    {30729, "epsg", 30729,
         "Nord Sahara 1959 / UTM zone 29N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Nord_Sahara_1959", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=29 +ellps=clrk80 +towgs84=-209.3622,-87.");
-    add_proj4text (p, 1,
-        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / UTM zone 29N\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-9],PARAMETER[\"scale_factor\",0.9996],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"30729\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30730, "epsg", 30730,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=29 +ellps=clrk80 +towgs84=-209.3622,-87."
+        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_"
+        "defs",
+        "PROJCS[\"Nord Sahara 1959 / UTM zone 29N\",GEOGCS[\"Nord"
+        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla"
+        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\","
+        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercator\"]"
+        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central"
+        "_meridian\",-9],PARAMETER[\"scale_factor\",0.9996],PARAM"
+        "ETER[\"false_easting\",500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"30729\"]]"},
+    {30730, "epsg", 30730,
         "Nord Sahara 1959 / UTM zone 30N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Nord_Sahara_1959", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=30 +ellps=clrk80 +towgs84=-209.3622,-87.");
-    add_proj4text (p, 1,
-        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / UTM zone 30N\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",-3],PARAMETER[\"scale_factor\",0.9996],PARAM");
-    add_srs_wkt (p, 9,
-        "ETER[\"false_easting\",500000],PARAMETER[\"false_northin");
-    add_srs_wkt (p, 10,
-        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX");
-    add_srs_wkt (p, 11,
-        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[");
-    add_srs_wkt (p, 12,
-        "\"EPSG\",\"30730\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30731, "epsg", 30731,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=30 +ellps=clrk80 +towgs84=-209.3622,-87."
+        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_"
+        "defs",
+        "PROJCS[\"Nord Sahara 1959 / UTM zone 30N\",GEOGCS[\"Nord"
+        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla"
+        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\","
+        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercator\"]"
+        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central"
+        "_meridian\",-3],PARAMETER[\"scale_factor\",0.9996],PARAM"
+        "ETER[\"false_easting\",500000],PARAMETER[\"false_northin"
+        "g\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AX"
+        "IS[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY["
+        "\"EPSG\",\"30730\"]]"},
+    {30731, "epsg", 30731,
         "Nord Sahara 1959 / UTM zone 31N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Nord_Sahara_1959", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=31 +ellps=clrk80 +towgs84=-209.3622,-87.");
-    add_proj4text (p, 1,
-        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / UTM zone 31N\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",3],PARAMETER[\"scale_factor\",0.9996],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",500000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 10,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"30731\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30732, "epsg", 30732,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=31 +ellps=clrk80 +towgs84=-209.3622,-87."
+        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_"
+        "defs",
+        "PROJCS[\"Nord Sahara 1959 / UTM zone 31N\",GEOGCS[\"Nord"
+        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla"
+        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\","
+        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercator\"]"
+        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central"
+        "_meridian\",3],PARAMETER[\"scale_factor\",0.9996],PARAME"
+        "TER[\"false_easting\",500000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"30731\"]]"},
+    {30732, "epsg", 30732,
         "Nord Sahara 1959 / UTM zone 32N", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Nord_Sahara_1959", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=32 +ellps=clrk80 +towgs84=-209.3622,-87.");
-    add_proj4text (p, 1,
-        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_");
-    add_proj4text (p, 2,
-        "defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / UTM zone 32N\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercator\"]");
-    add_srs_wkt (p, 7,
-        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central");
-    add_srs_wkt (p, 8,
-        "_meridian\",9],PARAMETER[\"scale_factor\",0.9996],PARAME");
-    add_srs_wkt (p, 9,
-        "TER[\"false_easting\",500000],PARAMETER[\"false_northing");
-    add_srs_wkt (p, 10,
-        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI");
-    add_srs_wkt (p, 11,
-        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"");
-    add_srs_wkt (p, 12,
-        "EPSG\",\"30732\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30791, "epsg", 30791,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=32 +ellps=clrk80 +towgs84=-209.3622,-87."
+        "8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units=m +no_"
+        "defs",
+        "PROJCS[\"Nord Sahara 1959 / UTM zone 32N\",GEOGCS[\"Nord"
+        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla"
+        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\","
+        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4307\"]],PROJECTION[\"Transverse_Mercator\"]"
+        ",PARAMETER[\"latitude_of_origin\",0],PARAMETER[\"central"
+        "_meridian\",9],PARAMETER[\"scale_factor\",0.9996],PARAME"
+        "TER[\"false_easting\",500000],PARAMETER[\"false_northing"
+        "\",0],UNIT[\"metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXI"
+        "S[\"Easting\",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\""
+        "EPSG\",\"30732\"]]"},
+    {30791, "epsg", 30791,
         "Nord Sahara 1959 / Nord Algerie", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Nord_Sahara_1959", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=2.7 +k_0=0.99962554");
-    add_proj4text (p, 1,
-        "4 +x_0=500135 +y_0=300090 +ellps=clrk80 +towgs84=-209.36");
-    add_proj4text (p, 2,
-        "22,-87.8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units");
-    add_proj4text (p, 3,
-        "=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / Nord Algerie\",GEOGCS[\"Nord");
-    add_srs_wkt (p, 1,
-        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla");
-    add_srs_wkt (p, 2,
-        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",");
-    add_srs_wkt (p, 3,
-        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw");
-    add_srs_wkt (p, 4,
-        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.");
-    add_srs_wkt (p, 5,
-        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY");
-    add_srs_wkt (p, 6,
-        "[\"EPSG\",\"4307\"]],PROJECTION[\"Lambert_Conformal_Coni");
-    add_srs_wkt (p, 7,
-        "c_1SP\"],PARAMETER[\"latitude_of_origin\",36],PARAMETER[");
-    add_srs_wkt (p, 8,
-        "\"central_meridian\",2.7],PARAMETER[\"scale_factor\",0.9");
-    add_srs_wkt (p, 9,
-        "99625544],PARAMETER[\"false_easting\",500135],PARAMETER[");
-    add_srs_wkt (p, 10,
-        "\"false_northing\",300090],UNIT[\"metre\",1,AUTHORITY[\"");
-    add_srs_wkt (p, 11,
-        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing");
-    add_srs_wkt (p, 12,
-        "\",NORTH],AUTHORITY[\"EPSG\",\"30791\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30792, "epsg", 30792,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=36 +lat_0=36 +lon_0=2.7 +k_0=0.99962554"
+        "4 +x_0=500135 +y_0=300090 +ellps=clrk80 +towgs84=-209.36"
+        "22,-87.8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +units"
+        "=m +no_defs",
+        "PROJCS[\"Nord Sahara 1959 / Nord Algerie\",GEOGCS[\"Nord"
+        " Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Cla"
+        "rke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\","
+        "\"7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenw"
+        "ich\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0."
+        "0174532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY"
+        "[\"EPSG\",\"4307\"]],PROJECTION[\"Lambert_Conformal_Coni"
+        "c_1SP\"],PARAMETER[\"latitude_of_origin\",36],PARAMETER["
+        "\"central_meridian\",2.7],PARAMETER[\"scale_factor\",0.9"
+        "99625544],PARAMETER[\"false_easting\",500135],PARAMETER["
+        "\"false_northing\",300090],UNIT[\"metre\",1,AUTHORITY[\""
+        "EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing"
+        "\",NORTH],AUTHORITY[\"EPSG\",\"30791\"]]"},
+    {30792, "epsg", 30792,
         "Nord Sahara 1959 / Sud Algerie", 0, 0,
         "Clarke 1880 (RGS)", "Greenwich",
         "Nord_Sahara_1959", "Lambert_Conformal_Conic_1SP", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996");
-    add_proj4text (p, 1,
-        "25769 +x_0=500135 +y_0=300090 +ellps=clrk80 +towgs84=-20");
-    add_proj4text (p, 2,
-        "9.3622,-87.8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +u");
-    add_proj4text (p, 3,
-        "nits=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Nord Sahara 1959 / Sud Algerie\",GEOGCS[\"Nord ");
-    add_srs_wkt (p, 1,
-        "Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Clar");
-    add_srs_wkt (p, 2,
-        "ke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenwic");
-    add_srs_wkt (p, 4,
-        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01");
-    add_srs_wkt (p, 5,
-        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\"");
-    add_srs_wkt (p, 6,
-        "EPSG\",\"4307\"]],PROJECTION[\"Lambert_Conformal_Conic_1");
-    add_srs_wkt (p, 7,
-        "SP\"],PARAMETER[\"latitude_of_origin\",33.3],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "central_meridian\",2.7],PARAMETER[\"scale_factor\",0.999");
-    add_srs_wkt (p, 9,
-        "625769],PARAMETER[\"false_easting\",500135],PARAMETER[\"");
-    add_srs_wkt (p, 10,
-        "false_northing\",300090],UNIT[\"metre\",1,AUTHORITY[\"EP");
-    add_srs_wkt (p, 11,
-        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\"");
-    add_srs_wkt (p, 12,
-        ",NORTH],AUTHORITY[\"EPSG\",\"30792\"]]");
-    p = add_epsg_def_ex (filter, first, last, 30800, "epsg", 30800,
+        "Easting", "East", "Northing", "North",
+        "+proj=lcc +lat_1=33.3 +lat_0=33.3 +lon_0=2.7 +k_0=0.9996"
+        "25769 +x_0=500135 +y_0=300090 +ellps=clrk80 +towgs84=-20"
+        "9.3622,-87.8162,404.6198,0.0046,3.4784,0.5805,-1.4547 +u"
+        "nits=m +no_defs",
+        "PROJCS[\"Nord Sahara 1959 / Sud Algerie\",GEOGCS[\"Nord "
+        "Sahara 1959\",DATUM[\"Nord_Sahara_1959\",SPHEROID[\"Clar"
+        "ke 1880 (RGS)\",6378249.145,293.465,AUTHORITY[\"EPSG\",\""
+        "7012\"]],AUTHORITY[\"EPSG\",\"6307\"]],PRIMEM[\"Greenwic"
+        "h\",0,AUTHORITY[\"EPSG\",\"8901\"]],UNIT[\"degree\",0.01"
+        "74532925199433,AUTHORITY[\"EPSG\",\"9122\"]],AUTHORITY[\""
+        "EPSG\",\"4307\"]],PROJECTION[\"Lambert_Conformal_Conic_1"
+        "SP\"],PARAMETER[\"latitude_of_origin\",33.3],PARAMETER[\""
+        "central_meridian\",2.7],PARAMETER[\"scale_factor\",0.999"
+        "625769],PARAMETER[\"false_easting\",500135],PARAMETER[\""
+        "false_northing\",300090],UNIT[\"metre\",1,AUTHORITY[\"EP"
+        "SG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northing\""
+        ",NORTH],AUTHORITY[\"EPSG\",\"30792\"]]"},
+    {30800, "epsg", 30800,
         "RT38 2.5 gon V", 0, 1,
         "Bessel 1841", "Greenwich",
         "Stockholm_1938", "Transverse_Mercator", "metre",
-        "Northing", "North", "Easting", "East");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0=");
-    add_proj4text (p, 1,
-        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"RT38 2.5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockh");
-    add_srs_wkt (p, 1,
-        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528");
-    add_srs_wkt (p, 2,
-        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6");
-    add_srs_wkt (p, 3,
-        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901");
-    add_srs_wkt (p, 4,
-        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG");
-    add_srs_wkt (p, 5,
-        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\"");
-    add_srs_wkt (p, 6,
-        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\",");
-    add_srs_wkt (p, 7,
-        "0],PARAMETER[\"central_meridian\",15.8082777777778],PARA");
-    add_srs_wkt (p, 8,
-        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15");
-    add_srs_wkt (p, 9,
-        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,");
-    add_srs_wkt (p, 10,
-        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A");
-    add_srs_wkt (p, 11,
-        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3027\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31028, "epsg", 31028,
+        "Northing", "North", "Easting", "East",
+        "+proj=tmerc +lat_0=0 +lon_0=15.80827777777778 +k=1 +x_0="
+        "1500000 +y_0=0 +ellps=bessel +units=m +no_defs",
+        "PROJCS[\"RT38 2.5 gon V\",GEOGCS[\"RT38\",DATUM[\"Stockh"
+        "olm_1938\",SPHEROID[\"Bessel 1841\",6377397.155,299.1528"
+        "128,AUTHORITY[\"EPSG\",\"7004\"]],AUTHORITY[\"EPSG\",\"6"
+        "308\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901"
+        "\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG"
+        "\",\"9122\"]],AUTHORITY[\"EPSG\",\"4308\"]],PROJECTION[\""
+        "Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\","
+        "0],PARAMETER[\"central_meridian\",15.8082777777778],PARA"
+        "METER[\"scale_factor\",1],PARAMETER[\"false_easting\",15"
+        "00000],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,"
+        "AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Northing\",NORTH],A"
+        "XIS[\"Easting\",EAST],AUTHORITY[\"EPSG\",\"3027\"]]"},
+    {31028, "epsg", 31028,
         "Yoff / UTM zone 28N", 0, 0,
         "Clarke 1880 (IGN)", "Greenwich",
         "Yoff", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=28 +a=6378249.2 +b=6356515 +towgs84=-30,");
-    add_proj4text (p, 1,
-        "190,89,0,0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Yoff / UTM zone 28N\",GEOGCS[\"Yoff\",DATUM[\"Y");
-    add_srs_wkt (p, 1,
-        "off\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,293.46602");
-    add_srs_wkt (p, 2,
-        "1293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6310\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4310\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-15],PARAMETER[\"");
-    add_srs_wkt (p, 8,
-        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000");
-    add_srs_wkt (p, 9,
-        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH");
-    add_srs_wkt (p, 10,
-        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"");
-    add_srs_wkt (p, 11,
-        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"31028\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31121, "epsg", 31121,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=28 +a=6378249.2 +b=6356515 +towgs84=-30,"
+        "190,89,0,0,0,0 +units=m +no_defs",
+        "PROJCS[\"Yoff / UTM zone 28N\",GEOGCS[\"Yoff\",DATUM[\"Y"
+        "off\",SPHEROID[\"Clarke 1880 (IGN)\",6378249.2,293.46602"
+        "1293627,AUTHORITY[\"EPSG\",\"7011\"]],AUTHORITY[\"EPSG\""
+        ",\"6310\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4310\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-15],PARAMETER[\""
+        "scale_factor\",0.9996],PARAMETER[\"false_easting\",50000"
+        "0],PARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTH"
+        "ORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\""
+        "Northing\",NORTH],AUTHORITY[\"EPSG\",\"31028\"]]"},
+    {31121, "epsg", 31121,
         "Zanderij / UTM zone 21N", 0, 0,
         "International 1924", "Greenwich",
         "Zanderij", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=utm +zone=21 +ellps=intl +towgs84=-265,120,-358,0,");
-    add_proj4text (p, 1,
-        "0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Zanderij / UTM zone 21N\",GEOGCS[\"Zanderij\",D");
-    add_srs_wkt (p, 1,
-        "ATUM[\"Zanderij\",SPHEROID[\"International 1924\",637838");
-    add_srs_wkt (p, 2,
-        "8,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 3,
-        "6311\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890");
-    add_srs_wkt (p, 4,
-        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS");
-    add_srs_wkt (p, 5,
-        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4311\"]],PROJECTION[");
-    add_srs_wkt (p, 6,
-        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\"");
-    add_srs_wkt (p, 7,
-        ",0],PARAMETER[\"central_meridian\",-57],PARAMETER[\"scal");
-    add_srs_wkt (p, 8,
-        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P");
-    add_srs_wkt (p, 9,
-        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT");
-    add_srs_wkt (p, 10,
-        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort");
-    add_srs_wkt (p, 11,
-        "hing\",NORTH],AUTHORITY[\"EPSG\",\"31121\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31154, "epsg", 31154,
+        "Easting", "East", "Northing", "North",
+        "+proj=utm +zone=21 +ellps=intl +towgs84=-265,120,-358,0,"
+        "0,0,0 +units=m +no_defs",
+        "PROJCS[\"Zanderij / UTM zone 21N\",GEOGCS[\"Zanderij\",D"
+        "ATUM[\"Zanderij\",SPHEROID[\"International 1924\",637838"
+        "8,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\""
+        "6311\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"890"
+        "1\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPS"
+        "G\",\"9122\"]],AUTHORITY[\"EPSG\",\"4311\"]],PROJECTION["
+        "\"Transverse_Mercator\"],PARAMETER[\"latitude_of_origin\""
+        ",0],PARAMETER[\"central_meridian\",-57],PARAMETER[\"scal"
+        "e_factor\",0.9996],PARAMETER[\"false_easting\",500000],P"
+        "ARAMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORIT"
+        "Y[\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Nort"
+        "hing\",NORTH],AUTHORITY[\"EPSG\",\"31121\"]]"},
+    {31154, "epsg", 31154,
         "Zanderij / TM 54 NW", 0, 0,
         "International 1924", "Greenwich",
         "Zanderij", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-54 +k=0.9996 +x_0=500000 +y");
-    add_proj4text (p, 1,
-        "_0=0 +ellps=intl +towgs84=-265,120,-358,0,0,0,0 +units=m");
-    add_proj4text (p, 2,
-        " +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Zanderij / TM 54 NW\",GEOGCS[\"Zanderij\",DATUM");
-    add_srs_wkt (p, 1,
-        "[\"Zanderij\",SPHEROID[\"International 1924\",6378388,29");
-    add_srs_wkt (p, 2,
-        "7,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"631");
-    add_srs_wkt (p, 3,
-        "1\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\"");
-    add_srs_wkt (p, 4,
-        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 5,
-        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4311\"]],PROJECTION[\"T");
-    add_srs_wkt (p, 6,
-        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0");
-    add_srs_wkt (p, 7,
-        "],PARAMETER[\"central_meridian\",-54],PARAMETER[\"scale_");
-    add_srs_wkt (p, 8,
-        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR");
-    add_srs_wkt (p, 9,
-        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY[");
-    add_srs_wkt (p, 10,
-        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi");
-    add_srs_wkt (p, 11,
-        "ng\",NORTH],AUTHORITY[\"EPSG\",\"31154\"]]");
-    p = add_epsg_def_ex (filter, first, last, 31170, "epsg", 31170,
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-54 +k=0.9996 +x_0=500000 +y"
+        "_0=0 +ellps=intl +towgs84=-265,120,-358,0,0,0,0 +units=m"
+        " +no_defs",
+        "PROJCS[\"Zanderij / TM 54 NW\",GEOGCS[\"Zanderij\",DATUM"
+        "[\"Zanderij\",SPHEROID[\"International 1924\",6378388,29"
+        "7,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\",\"631"
+        "1\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"8901\""
+        "]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"EPSG\""
+        ",\"9122\"]],AUTHORITY[\"EPSG\",\"4311\"]],PROJECTION[\"T"
+        "ransverse_Mercator\"],PARAMETER[\"latitude_of_origin\",0"
+        "],PARAMETER[\"central_meridian\",-54],PARAMETER[\"scale_"
+        "factor\",0.9996],PARAMETER[\"false_easting\",500000],PAR"
+        "AMETER[\"false_northing\",0],UNIT[\"metre\",1,AUTHORITY["
+        "\"EPSG\",\"9001\"]],AXIS[\"Easting\",EAST],AXIS[\"Northi"
+        "ng\",NORTH],AUTHORITY[\"EPSG\",\"31154\"]]"},
+    {31170, "epsg", 31170,
         "Zanderij / Suriname Old TM", 0, 0,
         "International 1924", "Greenwich",
         "Zanderij", "Transverse_Mercator", "metre",
-        "Easting", "East", "Northing", "North");
-    add_proj4text (p, 0,
-        "+proj=tmerc +lat_0=0 +lon_0=-55.68333333333333 +k=0.9996");
-    add_proj4text (p, 1,
-        " +x_0=500000 +y_0=0 +ellps=intl +towgs84=-265,120,-358,0");
-    add_proj4text (p, 2,
-        ",0,0,0 +units=m +no_defs");
-    add_srs_wkt (p, 0,
-        "PROJCS[\"Zanderij / Suriname Old TM\",GEOGCS[\"Zanderij\"");
-    add_srs_wkt (p, 1,
-        ",DATUM[\"Zanderij\",SPHEROID[\"International 1924\",6378");
-    add_srs_wkt (p, 2,
-        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\"");
-    add_srs_wkt (p, 3,
-        ",\"6311\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\"");
-    add_srs_wkt (p, 4,
-        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\"");
-    add_srs_wkt (p, 5,
-        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4311\"]],PROJECTI");
-    add_srs_wkt (p, 6,
-        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig");
-    add_srs_wkt (p, 7,
-        "in\",0],PARAMETER[\"central_meridian\",-55.6833333333333");
-    add_srs_wkt (p, 8,
-        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e");
-    add_srs_wkt (p, 9,
-        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\"");
-    add_srs_wkt (p, 10,
-        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\"");
-    add_srs_wkt (p, 11,
-        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"311");
-    add_srs_wkt (p, 12,
-        "70\"]]");
-}
+        "Easting", "East", "Northing", "North",
+        "+proj=tmerc +lat_0=0 +lon_0=-55.68333333333333 +k=0.9996"
+        " +x_0=500000 +y_0=0 +ellps=intl +towgs84=-265,120,-358,0"
+        ",0,0,0 +units=m +no_defs",
+        "PROJCS[\"Zanderij / Suriname Old TM\",GEOGCS[\"Zanderij\""
+        ",DATUM[\"Zanderij\",SPHEROID[\"International 1924\",6378"
+        "388,297,AUTHORITY[\"EPSG\",\"7022\"]],AUTHORITY[\"EPSG\""
+        ",\"6311\"]],PRIMEM[\"Greenwich\",0,AUTHORITY[\"EPSG\",\""
+        "8901\"]],UNIT[\"degree\",0.0174532925199433,AUTHORITY[\""
+        "EPSG\",\"9122\"]],AUTHORITY[\"EPSG\",\"4311\"]],PROJECTI"
+        "ON[\"Transverse_Mercator\"],PARAMETER[\"latitude_of_orig"
+        "in\",0],PARAMETER[\"central_meridian\",-55.6833333333333"
+        "],PARAMETER[\"scale_factor\",0.9996],PARAMETER[\"false_e"
+        "asting\",500000],PARAMETER[\"false_northing\",0],UNIT[\""
+        "metre\",1,AUTHORITY[\"EPSG\",\"9001\"]],AXIS[\"Easting\""
+        ",EAST],AXIS[\"Northing\",NORTH],AUTHORITY[\"EPSG\",\"311"
+        "70\"]]"},
+};
 
-#endif /* full EPSG initialization enabled/disabled */
+SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_54 = {
+    epsg_defs_54, sizeof (epsg_defs_54) / sizeof (epsg_defs_54[0])
+};
 
+#endif /* full EPSG initialization enabled/disabled */
@@ -410,1392 +410,1513 @@ do_prussian (FILE * out)
 {
 /* writing the "prussian" body */
     fprintf (out,
-	     "SPATIALITE_PRIVATE void\ninitialize_epsg_prussian(int filter,struct epsg_defs **first, struct epsg_defs **last)\n");
+	     "/* EPSG defs - sorted by SRID [old Prussian based on Cassini-Soldner - kindly contributed by Mark Johnson] */\n");
     fprintf (out,
-	     "{\n/* old Prussian based on Cassini-Soldner - kindly contributed by Mark Johnson */\n");
-    fprintf (out, "    struct epsg_defs *p;\n");
+	     "static const struct epsg_catalog_def epsg_defs_prussian[] = {\n");
+    fprintf (out, "    {187900, \"mj10777.de\", 187900,\n");
+    fprintf (out, "        \"DHDN / Soldner Rathausnetz 660\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187900,\"mj10777.de\",187900,\"DHDN / Soldner Rathausnetz 660\");\n");
+	     "        \"+proj=cass +lat_0=52.41864827777778 +lon_0=13.62720366666667 \"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.41864827777778 +lon_0=13.62720366666667 \");\n");
+	     "        \"+x_0=14741.77 +y_0=-11288.28 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=14741.77 +y_0=-11288.28 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner Rathausnetz 660\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner Rathausnetz 660\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.41864827777778],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",13.62720366666667],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.41864827777778],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",14741.77],PARAMETER[\\\"false_northing\\\",-11288.28],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",13.62720366666667],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187900\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187901, \"mj10777.de\", 187901,\n");
+    fprintf (out, "        \"DHDN / Soldner 1 Kucklinsberg\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",14741.77],PARAMETER[\\\"false_northing\\\",-11288.28],\");\n");
+	     "        \"+proj=cass +lat_0=54.46022375 +lon_0=21.95509736 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187900\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 1 Kucklinsberg\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187901,\"mj10777.de\",187901,\"DHDN / Soldner 1 Kucklinsberg\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=54.46022375 +lon_0=21.95509736 \");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 1 Kucklinsberg\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",54.46022375],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",21.95509736],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187901\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187902, \"mj10777.de\", 187902,\n");
+    fprintf (out, "        \"DHDN / Soldner 2 Paulinen\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"+proj=cass +lat_0=54.28921067 +lon_0=20.73315431 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",54.46022375],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 2 Paulinen\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",21.95509736],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187901\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187902,\"mj10777.de\",187902,\"DHDN / Soldner 2 Paulinen\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=54.28921067 +lon_0=20.73315431 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 2 Paulinen\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",54.28921067],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",20.73315431],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187902\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187903, \"mj10777.de\", 187903,\n");
+    fprintf (out, "        \"DHDN / Soldner 3 Markushof I\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"+proj=cass +lat_0=54.05881333 +lon_0=19.37343583 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 3 Markushof I\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",54.28921067],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",20.73315431],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187902\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187903,\"mj10777.de\",187903,\"DHDN / Soldner 3 Markushof I\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",54.05881333],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=54.05881333 +lon_0=19.37343583 \");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",19.37343583],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 3 Markushof I\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187903\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187904, \"mj10777.de\", 187904,\n");
+    fprintf (out, "        \"DHDN / Soldner 4 Thurmberg\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"+proj=cass +lat_0=54.22552092 +lon_0=18.12569375 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 4 Thurmberg\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",54.05881333],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",19.37343583],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",54.22552092],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",18.12569375],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187903\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187904,\"mj10777.de\",187904,\"DHDN / Soldner 4 Thurmberg\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187904\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187905, \"mj10777.de\", 187905,\n");
+    fprintf (out, "        \"DHDN / Soldner 5 Kauernick I\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=54.22552092 +lon_0=18.12569375 \");\n");
+	     "        \"+proj=cass +lat_0=53.38933197 +lon_0=19.59810438 \"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 5 Kauernick I\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 4 Thurmberg\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",53.38933197],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",19.59810438],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",54.22552092],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",18.12569375],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187905\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187906, \"mj10777.de\", 187906,\n");
+    fprintf (out, "        \"DHDN / Soldner 6 Thorn, Rathausturm\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"+proj=cass +lat_0=53.01181586 +lon_0=18.60725428 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187904\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187905,\"mj10777.de\",187905,\"DHDN / Soldner 5 Kauernick I\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 6 Thorn, Rathausturm\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=53.38933197 +lon_0=19.59810438 \");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 5 Kauernick I\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",53.01181586],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",18.60725428],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187906\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187907, \"mj10777.de\", 187907,\n");
+    fprintf (out, "        \"DHDN / Soldner 7 Heinrichsthal\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",53.38933197],\");\n");
+	     "        \"+proj=cass +lat_0=53.71289217 +lon_0=17.49676781 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",19.59810438],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 7 Heinrichsthal\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187905\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187906,\"mj10777.de\",187906,\"DHDN / Soldner 6 Thorn, Rathausturm\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=53.01181586 +lon_0=18.60725428 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 6 Thorn, Rathausturm\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",53.71289217],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",17.49676781],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187907\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187908, \"mj10777.de\", 187908,\n");
+    fprintf (out, "        \"DHDN / Soldner 8 Gollenberg, Denkmal\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=54.20857178 +lon_0=16.22956781 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",53.01181586],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 8 Gollenberg, Denkmal\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",18.60725428],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187906\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187907,\"mj10777.de\",187907,\"DHDN / Soldner 7 Heinrichsthal\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=53.71289217 +lon_0=17.49676781 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 7 Heinrichsthal\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",54.20857178],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",16.22956781],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187908\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187909, \"mj10777.de\", 187909,\n");
+    fprintf (out, "        \"DHDN / Soldner 9 Gnesen\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"+proj=cass +lat_0=52.53820406 +lon_0=17.59450500 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 9 Gnesen\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",53.71289217],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",17.49676781],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187907\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187908,\"mj10777.de\",187908,\"DHDN / Soldner 8 Gollenberg, Denkmal\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.53820406],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=54.20857178 +lon_0=16.22956781 \");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",17.59450500],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 8 Gollenberg, Denkmal\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187909\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187910, \"mj10777.de\", 187910,\n");
+    fprintf (out, "        \"DHDN / Soldner 10 Josefsberg\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"+proj=cass +lat_0=51.98768806 +lon_0=16.20044389 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 10 Josefsberg\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",54.20857178],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",16.22956781],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.98768806],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",16.20044389],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187908\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187909,\"mj10777.de\",187909,\"DHDN / Soldner 9 Gnesen\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187910\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187911, \"mj10777.de\", 187911,\n");
+    fprintf (out, "        \"DHDN / Soldner 11 Schroda\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.53820406 +lon_0=17.59450500 \");\n");
+	     "        \"+proj=cass +lat_0=52.23137372 +lon_0=17.27795372 \"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 11 Schroda\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 9 Gnesen\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.23137372],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",17.27795372],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.53820406],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",17.59450500],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187911\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187912, \"mj10777.de\", 187912,\n");
+    fprintf (out, "        \"DHDN / Soldner 12 Pschow\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"+proj=cass +lat_0=50.04206544 +lon_0=18.39610692 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187909\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 12 Pschow\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187910,\"mj10777.de\",187910,\"DHDN / Soldner 10 Josefsberg\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.98768806 +lon_0=16.20044389 \");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 10 Josefsberg\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",50.04206544],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",18.39610692],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187912\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187913, \"mj10777.de\", 187913,\n");
+    fprintf (out, "        \"DHDN / Soldner 13 Rummelsberg\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"+proj=cass +lat_0=50.70352314 +lon_0=17.11233917 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.98768806],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 13 Rummelsberg\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",16.20044389],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187910\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187911,\"mj10777.de\",187911,\"DHDN / Soldner 11 Schroda\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.23137372 +lon_0=17.27795372 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 11 Schroda\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",50.70352314],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",17.11233917],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187913\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187914, \"mj10777.de\", 187914,\n");
+    fprintf (out, "        \"DHDN / Soldner 14 Gröditzberg I\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"+proj=cass +lat_0=51.17819342 +lon_0=15.76127086 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 14 Gröditzberg I\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.23137372],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",17.27795372],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187911\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187912,\"mj10777.de\",187912,\"DHDN / Soldner 12 Pschow\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=50.04206544 +lon_0=18.39610692 \");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.17819342],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",15.76127086],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 12 Pschow\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187914\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187915, \"mj10777.de\", 187915,\n");
+    fprintf (out, "        \"DHDN / Soldner 15 Kaltenborn\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=51.92903708 +lon_0=14.66212942 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 15 Kaltenborn\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",50.04206544],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",18.39610692],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.92903708],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187912\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",14.66212942],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187913,\"mj10777.de\",187913,\"DHDN / Soldner 13 Rummelsberg\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=50.70352314 +lon_0=17.11233917 \");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187915\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187916, \"mj10777.de\", 187916,\n");
+    fprintf (out, "        \"DHDN / Soldner 16 Bahn I\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"+proj=cass +lat_0=53.10184583 +lon_0=14.70144539 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 13 Rummelsberg\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 16 Bahn I\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",53.10184583],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",50.70352314],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",14.70144539],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",17.11233917],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187916\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187917, \"mj10777.de\", 187917,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187913\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"DHDN / Soldner 17 Greifswald, Nikolaikirche\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187914,\"mj10777.de\",187914,\"DHDN / Soldner 14 Gröditzberg I\");\n");
+	     "        \"+proj=cass +lat_0=54.09698872 +lon_0=13.37880703 \"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.17819342 +lon_0=15.76127086 \");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 17 Greifswald, Nikolaikirche\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 14 Gröditzberg I\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",54.09698872],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",13.37880703],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.17819342],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",15.76127086],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187917\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187918, \"mj10777.de\", 187918,\n");
+    fprintf (out, "        \"DHDN / Soldner 18 Müggelberg 600\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"+proj=cass +lat_0=52.41864827777778 +lon_0=13.62720366666667 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187914\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187915,\"mj10777.de\",187915,\"DHDN / Soldner 15 Kaltenborn\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 18 Müggelberg 600\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.92903708 +lon_0=14.66212942 \");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 15 Kaltenborn\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.41864827777778],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",13.62720366666667],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187918\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187919, \"mj10777.de\", 187919,\n");
+    fprintf (out, "        \"DHDN / Soldner 19 Götzer Berg 650\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.92903708],\");\n");
+	     "        \"+proj=cass +lat_0=52.43725961111112 +lon_0=12.72882972222223 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",14.66212942],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 19 Götzer Berg 650\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187915\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187917,\"mj10777.de\",187917,\"DHDN / Soldner 17 Greifswald, Nikolaikirche\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=54.09698872 +lon_0=13.37880703 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 17 Greifswald, Nikolaikirche\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.43725961111112],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",12.72882972222223],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187919\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187920, \"mj10777.de\", 187920,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"DHDN / Soldner 20 Torgau, Stadtkirche\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"+proj=cass +lat_0=51.56136217 +lon_0=13.00760264 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",54.09698872],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",13.37880703],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 20 Torgau, Stadtkirche\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187917\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187916,\"mj10777.de\",187916,\"DHDN / Soldner 16 Bahn I\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=53.10184583 +lon_0=14.70144539 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 16 Bahn I\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.56136217],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",13.00760264],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187920\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187921, \"mj10777.de\", 187921,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"DHDN / Soldner 21 Burkersroda, Kirchturm\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=51.17656322 +lon_0=11.64139367 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",53.10184583],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 21 Burkersroda, Kirchturm\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",14.70144539],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187916\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187918,\"mj10777.de\",187918,\"DHDN / Soldner 18 Müggelberg 600\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.41864827777778 +lon_0=13.62720366666667 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 18 Müggelberg 600\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.17656322],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",11.64139367],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187921\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187922, \"mj10777.de\", 187922,\n");
+    fprintf (out, "        \"DHDN / Soldner 22 Inselsberg\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"+proj=cass +lat_0=50.85237983 +lon_0=10.46776506 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 22 Inselsberg\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.41864827777778],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",13.62720366666667],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187918\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187919,\"mj10777.de\",187919,\"DHDN / Soldner 19 Götzer Berg 650\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",50.85237983],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.43725961111112 +lon_0=12.72882972222223 \");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",10.46776506],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 19 Götzer Berg 650\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187922\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187923, \"mj10777.de\", 187923,\n");
+    fprintf (out, "        \"DHDN / Soldner 23 Magdeburg\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"+proj=cass +lat_0=52.12625311 +lon_0=11.63550325 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 23 Magdeburg\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.43725961111112],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",12.72882972222223],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.12625311],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",11.63550325],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187919\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187920,\"mj10777.de\",187920,\"DHDN / Soldner 20 Torgau, Stadtkirche\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187923\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187924, \"mj10777.de\", 187924,\n");
+    fprintf (out, "        \"DHDN / Soldner 24 Ostenfeld I\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.56136217 +lon_0=13.00760264 \");\n");
+	     "        \"+proj=cass +lat_0=54.47018733 +lon_0=9.23411097 \"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 24 Ostenfeld I\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 20 Torgau, Stadtkirche\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",54.47018733],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",9.23411097],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.56136217],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",13.00760264],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187924\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187925, \"mj10777.de\", 187925,\n");
+    fprintf (out, "        \"DHDN / Soldner 25 Rathkrügen\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"+proj=cass +lat_0=53.81839364 +lon_0=10.04220189 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187920\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 25 Rathkrügen\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187921,\"mj10777.de\",187921,\"DHDN / Soldner 21 Burkersroda, Kirchturm\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.17656322 +lon_0=11.64139367 \");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 21 Burkersroda, Kirchturm\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",53.81839364],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",10.04220189],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187925\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187926, \"mj10777.de\", 187926,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"DHDN / Soldner 26 Bungsberg, Aussichtsturm\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.17656322],\");\n");
+	     "        \"+proj=cass +lat_0=54.21110653 +lon_0=10.72636431 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",11.64139367],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 26 Bungsberg, Aussichtsturm\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187921\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187922,\"mj10777.de\",187922,\"DHDN / Soldner 22 Inselsberg\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=50.85237983 +lon_0=10.46776506 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 22 Inselsberg\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",54.21110653],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",10.72636431],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187926\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187927, \"mj10777.de\", 187927,\n");
+    fprintf (out, "        \"DHDN / Soldner 27 Celle, Stadtkirche\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=52.62574192 +lon_0=10.08190214 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",50.85237983],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 27 Celle, Stadtkirche\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",10.46776506],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187922\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187923,\"mj10777.de\",187923,\"DHDN / Soldner 23 Magdeburg\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.12625311 +lon_0=11.63550325 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 23 Magdeburg\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.62574192],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",10.08190214],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187927\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187928, \"mj10777.de\", 187928,\n");
+    fprintf (out, "        \"DHDN / Soldner 28 Kaltenborn\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"+proj=cass +lat_0=51.79646722 +lon_0=10.27322494 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 28 Kaltenborn\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.12625311],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",11.63550325],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187923\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187924,\"mj10777.de\",187924,\"DHDN / Soldner 24 Ostenfeld I\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.79646722],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=54.47018733 +lon_0=9.23411097 \");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",10.27322494],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 24 Ostenfeld I\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187928\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187929, \"mj10777.de\", 187929,\n");
+    fprintf (out, "        \"DHDN / Soldner 29 Silberberg\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"+proj=cass +lat_0=53.73123461 +lon_0=9.05774925 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 29 Silberberg\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",54.47018733],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",9.23411097],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",53.73123461],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",9.05774925],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187924\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187925,\"mj10777.de\",187925,\"DHDN / Soldner 25 Rathkrügen\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187929\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187930, \"mj10777.de\", 187930,\n");
+    fprintf (out, "        \"DHDN / Soldner 30 Windberg\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=53.81839364 +lon_0=10.04220189 \");\n");
+	     "        \"+proj=cass +lat_0=52.88088372 +lon_0=7.53062114 \"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 30 Windberg\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 25 Rathkrügen\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.88088372],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",7.53062114],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",53.81839364],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",10.04220189],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187930\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187931, \"mj10777.de\", 187931,\n");
+    fprintf (out, "        \"DHDN / Soldner 31 Hermannsdenkmal\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"+proj=cass +lat_0=51.91301647 +lon_0=8.84051853 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187925\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187926,\"mj10777.de\",187926,\"DHDN / Soldner 26 Bungsberg, Aussichtsturm\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 31 Hermannsdenkmal\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=54.21110653 +lon_0=10.72636431 \");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 26 Bungsberg, Aussichtsturm\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.91301647],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",8.84051853],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187931\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187932, \"mj10777.de\", 187932,\n");
+    fprintf (out, "        \"DHDN / Soldner 32 Münster\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",54.21110653],\");\n");
+	     "        \"+proj=cass +lat_0=51.96547642 +lon_0=7.62334994 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",10.72636431],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 32 Münster\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187926\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187927,\"mj10777.de\",187927,\"DHDN / Soldner 27 Celle, Stadtkirche\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.62574192 +lon_0=10.08190214 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 27 Celle, Stadtkirche\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.96547642],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",7.62334994],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187932\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187933, \"mj10777.de\", 187933,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"DHDN / Soldner 33 Bochum, Peter-Paul-Kirche\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=51.48373533 +lon_0=7.22115822 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.62574192],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 33 Bochum, Peter-Paul-Kirche\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",10.08190214],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187927\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187928,\"mj10777.de\",187928,\"DHDN / Soldner 28 Kaltenborn\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.79646722 +lon_0=10.27322494 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 28 Kaltenborn\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.48373533],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",7.22115822],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187933\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187934, \"mj10777.de\", 187934,\n");
+    fprintf (out, "        \"DHDN / Soldner 34 Homert\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"+proj=cass +lat_0=51.26480147 +lon_0=8.10687050 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 34 Homert\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.79646722],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",10.27322494],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187928\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187929,\"mj10777.de\",187929,\"DHDN / Soldner 29 Silberberg\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.26480147],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=53.73123461 +lon_0=9.05774925 \");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",8.10687050],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 29 Silberberg\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187934\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187935, \"mj10777.de\", 187935,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"DHDN / Soldner 35 Kassel, Martinskirche\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=51.31846489 +lon_0=9.50203072 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 35 Kassel, Martinskirche\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",53.73123461],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",9.05774925],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187929\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",51.31846489],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187930,\"mj10777.de\",187930,\"DHDN / Soldner 30 Windberg\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",9.50203072],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.88088372 +lon_0=7.53062114 \");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187935\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187936, \"mj10777.de\", 187936,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 30 Windberg\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"DHDN / Soldner 36 Schaumburg, Schloßturm\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"+proj=cass +lat_0=50.34048964 +lon_0=7.97808156 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner 36 Schaumburg, Schloßturm\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.88088372],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",7.53062114],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",50.34048964],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187930\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",7.97808156],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187931,\"mj10777.de\",187931,\"DHDN / Soldner 31 Hermannsdenkmal\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.91301647 +lon_0=8.84051853 \");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187936\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187937, \"mj10777.de\", 187937,\n");
+    fprintf (out, "        \"DHDN / Soldner 37 Fleckert\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"+proj=cass +lat_0=50.18762544 +lon_0=7.60594289 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 31 Hermannsdenkmal\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 37 Fleckert\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",50.18762544],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.91301647],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",7.60594289],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",8.84051853],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187937\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187938, \"mj10777.de\", 187938,\n");
+    fprintf (out, "        \"DHDN / Soldner 38 Cöln, Dom\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187931\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"+proj=cass +lat_0=50.94257242 +lon_0=6.95897600 \"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187932,\"mj10777.de\",187932,\"DHDN / Soldner 32 Münster\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 38 Cöln, Dom\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.96547642 +lon_0=7.62334994 \");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 32 Münster\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",50.94257242],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",6.95897600],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187938\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187939, \"mj10777.de\", 187939,\n");
+    fprintf (out, "        \"DHDN / Soldner 39 Langschoß\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.96547642],\");\n");
+	     "        \"+proj=cass +lat_0=50.66738711 +lon_0=6.28935703 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",7.62334994],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 39 Langschoß\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187932\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187933,\"mj10777.de\",187933,\"DHDN / Soldner 33 Bochum, Peter-Paul-Kirche\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.48373533 +lon_0=7.22115822 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 33 Bochum, Peter-Paul-Kirche\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",50.66738711],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",6.28935703],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187939\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187940, \"mj10777.de\", 187940,\n");
+    fprintf (out, "        \"DHDN / Soldner 40 Rissenthal\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=49.47801819 +lon_0=6.75864339 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner 40 Rissenthal\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.48373533],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",7.22115822],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187933\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187934,\"mj10777.de\",187934,\"DHDN / Soldner 34 Homert\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.26480147 +lon_0=8.10687050 \");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",49.47801819],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",6.75864339],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 34 Homert\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187940\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187941, \"mj10777.de\", 187941,\n");
+    fprintf (out, "        \"DHDN / Soldner Bayern\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=48.13959111 +lon_0=11.57437083 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
+    fprintf (out, "        \"PROJCS[\\\"DHDN / Soldner Bayern\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.26480147],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",8.10687050],\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",48.13959111],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187934\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",11.57437083],\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187935,\"mj10777.de\",187935,\"DHDN / Soldner 35 Kassel, Martinskirche\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=51.31846489 +lon_0=9.50203072 \");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187941\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {187998, \"mj10777.de\", 187998,\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"DHDN / Ferro / Deutsches_Hauptdreiecksnetz\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 35 Kassel, Martinskirche\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"+proj=longlat +ellps=bessel +datum=potsdam +pm=ferro +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PROJCS[\\\"DHDN / Ferro / Deutsches_Hauptdreiecksnetz\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
+    fprintf (out, "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"SPHEROID[\\\"Bessel 1841\\\",6377397.155,299.1528128,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]], AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"PRIMEM[\\\"ferro\\\",-17.66666666666667],UNIT[\\\"Degree\\\",0.017453292519943295,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187998\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]]]\"},\n");
+    fprintf (out, "    {187999, \"mj10777.de\", 187999,\n");
+    fprintf (out, "        \"DHDN / Brandenburger Tor\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"+proj=cass +lat_0=52.41864827777778 +lon_0=13.62720366666667 \"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"+x_0=16816.615499858 +y_0=-11047.322499366 +ellps=bessel +datum=potsdam +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",51.31846489],\");\n");
+	     "        \"PROJCS[\\\"DHDN / Soldner Brandenburger Tor\\\",\"\n");
+    fprintf (out, "        \"GEOGCS[\\\"DHDN\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",9.50203072],\");\n");
+	     "        \"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187935\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187936,\"mj10777.de\",187936,\"DHDN / Soldner 36 Schaumburg, Schloßturm\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=50.34048964 +lon_0=7.97808156 \");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\"\n");
+    fprintf (out, "        \"PROJECTION[\\\"Cassini_Soldner\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 36 Schaumburg, Schloßturm\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
+	     "        \"PARAMETER[\\\"latitude_of_origin\\\",52.41864827777778],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",13.62720366666667],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",16816.615499858],PARAMETER[\\\"false_northing\\\",-11047.322499366],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
+	     "        \"AUTHORITY[\\\"mj10777.de\\\",\\\"187999\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\"},\n");
+    fprintf (out, "    {325833, \"mj10777.de\", 325833,\n");
+    fprintf (out, "        \"ETRS89 / UTM zone 33N (Brandenburg)\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
     fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
+	     "        \"+proj=utm +zone=33 +ellps=GRS80 +units=m +no_defs\",\n");
     fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
+	     "        \"PROJCS[\\\"ETRS89 / UTM zone 33N (Brandenburg)\\\",GEOGCS[\\\"ETRS89\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
+	     "        \"DATUM[\\\"European_Terrestrial_Reference_System_1989\\\",\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
+	     "        \"SPHEROID[\\\"GRS 1980\\\",6378137,298.257222101,\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",50.34048964],\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"7019\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"6258\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",7.97808156],\");\n");
+	     "        \"PRIMEM[\\\"Greenwich\\\",0,AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
+	     "        \"UNIT[\\\"degree\\\",0.01745329251994328,AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187936\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"4258\\\"]],UNIT[\\\"metre\\\",1,\"\n");
     fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187937,\"mj10777.de\",187937,\"DHDN / Soldner 37 Fleckert\");\n");
+	     "        \"AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],PROJECTION[\\\"Transverse_Mercator\\\"],\"\n");
+    fprintf (out, "        \"PARAMETER[\\\"latitude_of_origin\\\",0],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=50.18762544 +lon_0=7.60594289 \");\n");
+	     "        \"PARAMETER[\\\"central_meridian\\\",15],PARAMETER[\\\"scale_factor\\\",0.9996],\"\n");
     fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
+	     "        \"PARAMETER[\\\"false_easting\\\",3500000],PARAMETER[\\\"false_northing\\\",0],\"\n");
+    fprintf (out, "        \"AUTHORITY[\\\"EPSG\\\",\\\"325833\\\"],\"\n");
     fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 37 Fleckert\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",50.18762544],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",7.60594289],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187937\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187938,\"mj10777.de\",187938,\"DHDN / Soldner 38 Cöln, Dom\");\n");
-    fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=50.94257242 +lon_0=6.95897600 \");\n");
-    fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 38 Cöln, Dom\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",50.94257242],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",6.95897600],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187938\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187939,\"mj10777.de\",187939,\"DHDN / Soldner 39 Langschoß\");\n");
-    fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=50.66738711 +lon_0=6.28935703 \");\n");
-    fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 39 Langschoß\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",50.66738711],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",6.28935703],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187939\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187940,\"mj10777.de\",187940,\"DHDN / Soldner 40 Rissenthal\");\n");
-    fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=49.47801819 +lon_0=6.75864339 \");\n");
-    fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner 40 Rissenthal\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",49.47801819],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",6.75864339],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187940\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187941,\"mj10777.de\",187941,\"DHDN / Soldner Bayern\");\n");
-    fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=48.13959111 +lon_0=11.57437083 \");\n");
-    fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=0 +y_0=0 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner Bayern\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",48.13959111],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",11.57437083],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",0],PARAMETER[\\\"false_northing\\\",0],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187941\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def (filter,first, last, 187998, \"mj10777.de\", 187998,\"DHDN / Ferro / Deutsches_Hauptdreiecksnetz\");\n");
-    fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=longlat +ellps=bessel +datum=potsdam +pm=ferro +no_defs\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Ferro / Deutsches_Hauptdreiecksnetz\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,3,\"SPHEROID[\\\"Bessel 1841\\\",6377397.155,299.1528128,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]], AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,5,\"PRIMEM[\\\"ferro\\\",-17.66666666666667],UNIT[\\\"Degree\\\",0.017453292519943295,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187998\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]]]\");\n");
-    fprintf (out,
-	     "/* mj10777: Not existing System, used for testing purposes. */\n");
-    fprintf (out,
-	     "    p = add_epsg_def(filter,first,last,187999,\"mj10777.de\",187999,\"DHDN / Brandenburger Tor\");\n");
-    fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=cass +lat_0=52.41864827777778 +lon_0=13.62720366666667 \");\n");
-    fprintf (out,
-	     "    add_proj4text(p,1,\"+x_0=16816.615499858 +y_0=-11047.322499366 +ellps=bessel +datum=potsdam +units=m +no_defs\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"DHDN / Soldner Brandenburger Tor\\\",\");\n");
-    fprintf (out, "    add_srs_wkt(p,1,\"GEOGCS[\\\"DHDN\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,2,\"DATUM[\\\"Deutsches_Hauptdreiecksnetz\\\",SPHEROID[\\\"Bessel 1841\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,3,\"6377397.155,299.1528128,AUTHORITY[\\\"EPSG\\\",\\\"7004\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,4,\"AUTHORITY[\\\"EPSG\\\",\\\"6314\\\"]],PRIMEM[\\\"Greenwich\\\",0,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,5,\"AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],UNIT[\\\"degree\\\",0.01745329251994328,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"4314\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,7,\"UNIT[\\\"metre\\\",1,AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,8,\"PROJECTION[\\\"Cassini_Soldner\\\"],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"latitude_of_origin\\\",52.41864827777778],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"central_meridian\\\",13.62720366666667],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,11,\"PARAMETER[\\\"false_easting\\\",16816.615499858],PARAMETER[\\\"false_northing\\\",-11047.322499366],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,12,\"AUTHORITY[\\\"mj10777.de\\\",\\\"187999\\\"],AXIS[\\\"x\\\",NORTH],AXIS[\\\"y\\\",EAST]]\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def (filter,first, last, 325833, \"mj10777.de\", 325833,\"ETRS89 / UTM zone 33N (Brandenburg)\");\n");
-    fprintf (out,
-	     "    add_proj4text(p,0,\"+proj=utm +zone=33 +ellps=GRS80 +units=m +no_defs\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,0,\"PROJCS[\\\"ETRS89 / UTM zone 33N (Brandenburg)\\\",GEOGCS[\\\"ETRS89\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,1,\"DATUM[\\\"European_Terrestrial_Reference_System_1989\\\",\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,2,\"SPHEROID[\\\"GRS 1980\\\",6378137,298.257222101,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,3,\"AUTHORITY[\\\"EPSG\\\",\\\"7019\\\"]],AUTHORITY[\\\"EPSG\\\",\\\"6258\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,4,\"PRIMEM[\\\"Greenwich\\\",0,AUTHORITY[\\\"EPSG\\\",\\\"8901\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,5,\"UNIT[\\\"degree\\\",0.01745329251994328,AUTHORITY[\\\"EPSG\\\",\\\"9122\\\"]],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,6,\"AUTHORITY[\\\"EPSG\\\",\\\"4258\\\"]],UNIT[\\\"metre\\\",1,\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,7,\"AUTHORITY[\\\"EPSG\\\",\\\"9001\\\"]],PROJECTION[\\\"Transverse_Mercator\\\"],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,8,\"PARAMETER[\\\"latitude_of_origin\\\",0],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,9,\"PARAMETER[\\\"central_meridian\\\",15],PARAMETER[\\\"scale_factor\\\",0.9996],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,10,\"PARAMETER[\\\"false_easting\\\",3500000],PARAMETER[\\\"false_northing\\\",0],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,11,\"AUTHORITY[\\\"EPSG\\\",\\\"325833\\\"],\");\n");
-    fprintf (out,
-	     "    add_srs_wkt(p,12,\"AXIS[\\\"Easting\\\",EAST],AXIS[\\\"Northing\\\",NORTH]]\");\n");
+	     "        \"AXIS[\\\"Easting\\\",EAST],AXIS[\\\"Northing\\\",NORTH]]\"},\n");
+}
+
+static void
+do_extra (FILE * out)
+{
+/* writing the "extra" body */
+    fprintf (out, "/* EPSG defs - sorted by SRID [EXTRA] */\n");
+    fprintf (out,
+	     "static const struct epsg_catalog_def epsg_defs_extra[] = {\n");
+    fprintf (out, "    {40000, \"gfoss.it\", 1,\n");
+    fprintf (out, "        \"Italy mainland zone 1 GB Roma40\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
+    fprintf (out,
+	     "        \"+proj=tmerc+lat_0=0 +lon_0=9  +k=0.9996 +x_0=1500000 +y_\"\n");
+    fprintf (out,
+	     "        \"0=0 +ellps=intl +units=m +towgs84=-104.1,-49.1,-9.9,0.97\"\n");
+    fprintf (out, "        \"1,-2.917,0.714,-11.68 +no_defs\",\n");
+    fprintf (out, "        \"\"},\n");
+    fprintf (out, "    {40001, \"gfoss.it\", 2,\n");
+    fprintf (out, "        \"Italy mainland zone 2 GB Roma40\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
+    fprintf (out,
+	     "        \"+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9996 +x_0=2520000 +y\"\n");
+    fprintf (out,
+	     "        \"_0=0 +ellps=intl +units=m +towgs84=-104.1,-49.1,-9.9,0.9\"\n");
+    fprintf (out, "        \"71,-2.917,0.714,-11.68 +no_defs\",\n");
+    fprintf (out, "        \"\"},\n");
+    fprintf (out, "    {40002, \"gfoss.it\", 3,\n");
+    fprintf (out, "        \"Italy Sardinia GB Roma40\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
+    fprintf (out,
+	     "        \"+proj=tmerc +lat_0=0 +lon_0=9  +k=0.9996 +x_0=1500000 +y\"\n");
+    fprintf (out,
+	     "        \"_0=0 +ellps=intl +units=m +towgs84=-168.6,-34.0,38.6,-0.\"\n");
+    fprintf (out, "        \"374,-0.679,-1.379,-9.48 +no_defs\",\n");
+    fprintf (out, "        \"\"},\n");
+    fprintf (out, "    {40003, \"gfoss.it\", 4,\n");
+    fprintf (out, "        \"Italy Sicily GB Roma40\", -1, -1,\n");
+    fprintf (out, "        NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL,\n");
+    fprintf (out, "        NULL, NULL, NULL, NULL,\n");
+    fprintf (out,
+	     "        \"+proj=tmerc +lat_0=0 +lon_0=9  +k=0.9996 +x_0=1500000 +y\"\n");
+    fprintf (out,
+	     "        \"_0=0 +ellps=intl +units=m +towgs84=-50.2,-50.4,84.8,-0.6\"\n");
+    fprintf (out, "        \"90,-2.012,0.459,-28.08  +no_defs\",\n");
+    fprintf (out, "        \"\"},\n");
 }
 
 static void
@@ -1867,13 +1988,69 @@ do_header (FILE * out, int macro)
 
 
 static void
-do_footer (FILE * out, int macro)
+do_footer (FILE * out, const char *name, int macro)
 {
 /* writing a file footer */
-    fprintf (out, "}\n\n");
+    fprintf (out, "};\n\n");
+    fprintf (out,
+	     "SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_%s = {\n",
+	     name);
+    fprintf (out,
+	     "    epsg_defs_%s, sizeof (epsg_defs_%s) / sizeof (epsg_defs_%s[0])\n",
+	     name, name, name);
+    fprintf (out, "};\n");
     if (macro)
 	fprintf (out,
-		 "#endif /* full EPSG initialization enabled/disabled */\n\n");
+		 "\n#endif /* full EPSG initialization enabled/disabled */\n");
+}
+
+static void
+do_string (FILE * out, const char *in, const char *terminator)
+{
+/* writing a string as a sequence of short C literals */
+    int out_cnt;
+    if (in == NULL || *in == '\0')
+      {
+	  fprintf (out, "        \"\"%s\n", terminator);
+	  return;
+      }
+    while (*in != '\0')
+      {
+	  fprintf (out, "        \"");
+	  out_cnt = 0;
+	  while (*in != '\0')
+	    {
+		if (*in == '"')
+		  {
+		      fprintf (out, "\\%c", *in++);
+		      out_cnt += 2;
+		  }
+		else
+		  {
+		      fprintf (out, "%c", *in++);
+		      out_cnt++;
+		  }
+		if (out_cnt >= 56)
+		    break;
+	    }
+	  fprintf (out, "\"%s\n", (*in == '\0') ? terminator : "");
+      }
+}
+
+static void
+do_def (FILE * out, struct epsg_entry *p)
+{
+/* writing a single EPSG def */
+    fprintf (out, "    {%d, \"epsg\", %d,\n", p->srid, p->srid);
+    fprintf (out, "        \"%s\", %d, %d,\n",
+	     p->ref_sys_name, p->is_geographic, p->flipped_axes);
+    fprintf (out, "        \"%s\", \"%s\",\n", p->spheroid, p->prime_meridian);
+    fprintf (out, "        \"%s\", \"%s\", \"%s\",\n",
+	     p->datum, p->projection, p->unit);
+    fprintf (out, "        \"%s\", \"%s\", \"%s\", \"%s\",\n",
+	     p->axis_1, p->orientation_1, p->axis_2, p->orientation_2);
+    do_string (out, p->proj4text, ",");
+    do_string (out, p->srtext, "},");
 }
 
 static void
@@ -1881,13 +2058,11 @@ output_c_code (FILE * out, struct epsg_dict *epsg)
 {
 /* generating the C code supporting spatial_ref_sys self-initialization */
     struct epsg_entry *p = epsg->first;
-    int n;
     int sect = 0;
     int wgs84_sect = 0;
     int def_cnt = 1000;
-    int out_cnt;
-    const char *in;
     int i;
+    char name[64];
     int pending_footer = 0;
 
     for (i = 0; i < epsg->count; i++)
@@ -1905,7 +2080,7 @@ output_c_code (FILE * out, struct epsg_dict *epsg)
 		  {
 		      if (pending_footer)
 			{
-			    do_footer (out, 1);
+			    do_footer (out, name, 1);
 			    pending_footer = 0;
 			}
 
@@ -1919,98 +2094,27 @@ output_c_code (FILE * out, struct epsg_dict *epsg)
 		if (out == NULL)
 		    return;
 
-		/* function header */
+		/* block header */
+		sprintf (name, "%02d", sect++);
 		do_header (out, 1);
-		fprintf (out, "SPATIALITE_PRIVATE void\n");
+		fprintf (out, "/* EPSG defs - sorted by SRID */\n");
 		fprintf (out,
-			 "initialize_epsg_%02d (int filter, struct epsg_defs **first, struct epsg_defs **last)\n",
-			 sect++);
-		fprintf (out, "{\n/* initializing the EPSG defs list */\n");
-		fprintf (out, "    struct epsg_defs *p;\n");
+			 "static const struct epsg_catalog_def epsg_defs_%s[] = {\n",
+			 name);
 		def_cnt = 0;
 	    }
 	  pending_footer = 1;
 
-	  /* inserting the main EPSG def */
+	  /* inserting the EPSG def */
 	  def_cnt++;
-	  fprintf (out,
-		   "    p = add_epsg_def_ex (filter, first, last, %d, \"epsg\", %d,\n",
-		   p->srid, p->srid);
-	  fprintf (out,
-		   "        \"%s\", %d, %d,\n",
-		   p->ref_sys_name, p->is_geographic, p->flipped_axes);
-	  fprintf (out,
-		   "        \"%s\", \"%s\",\n", p->spheroid, p->prime_meridian);
-	  fprintf (out,
-		   "        \"%s\", \"%s\", \"%s\",\n",
-		   p->datum, p->projection, p->unit);
-	  fprintf (out,
-		   "        \"%s\", \"%s\", \"%s\", \"%s\");\n",
-		   p->axis_1, p->orientation_1, p->axis_2, p->orientation_2);
-
-	  /* inserting the proj4text string */
-	  n = 0;
-	  in = p->proj4text;
-	  while (*in != '\0')
-	    {
-		fprintf (out, "    add_proj4text (p, %d,\n        \"", n);
-		out_cnt = 0;
-		while (*in != '\0')
-		  {
-		      if (*in == '"')
-			{
-			    fprintf (out, "\\%c", *in++);
-			    out_cnt += 2;
-			}
-		      else
-			{
-			    fprintf (out, "%c", *in++);
-			    out_cnt++;
-			}
-		      if (out_cnt >= 56)
-			  break;
-		  }
-		fprintf (out, "\");\n");
-		n++;
-	    }
-
-	  if (p->srtext != NULL)
-	    {
-		/* inserting the srs_wkt string */
-		n = 0;
-		in = p->srtext;
-		while (*in != '\0')
-		  {
-		      fprintf (out, "    add_srs_wkt (p, %d,\n        \"", n);
-		      out_cnt = 0;
-		      while (*in != '\0')
-			{
-			    if (*in == '"')
-			      {
-				  fprintf (out, "\\%c", *in++);
-				  out_cnt += 2;
-			      }
-			    else
-			      {
-				  fprintf (out, "%c", *in++);
-				  out_cnt++;
-			      }
-			    if (out_cnt >= 56)
-				break;
-			}
-		      fprintf (out, "\");\n");
-		      n++;
-		  }
-	    }
-	  else
-	      fprintf (out, "    add_srs_wkt (p, 0, \"\");\n");
+	  do_def (out, p);
       }
     if (out != NULL)
       {
 	  /* closing the output file */
 	  if (pending_footer)
 	    {
-		do_footer (out, 1);
+		do_footer (out, name, 1);
 		pending_footer = 0;
 	    }
 
@@ -2038,7 +2142,7 @@ output_c_code (FILE * out, struct epsg_dict *epsg)
 		  {
 		      if (pending_footer)
 			{
-			    do_footer (out, 0);
+			    do_footer (out, name, 0);
 			    pending_footer = 0;
 			}
 
@@ -2052,99 +2156,27 @@ output_c_code (FILE * out, struct epsg_dict *epsg)
 		if (out == NULL)
 		    return;
 
-		/* function header */
+		/* block header */
+		sprintf (name, "wgs84_%02d", wgs84_sect++);
 		do_header (out, 0);
-		fprintf (out, "SPATIALITE_PRIVATE void\n");
+		fprintf (out, "/* EPSG defs - sorted by SRID [WGS84] */\n");
 		fprintf (out,
-			 "initialize_epsg_wgs84_%02d (int filter, struct epsg_defs **first, struct epsg_defs **last)\n",
-			 wgs84_sect++);
-		fprintf (out,
-			 "{\n/* initializing the EPSG defs list [WGS84] */\n");
-		fprintf (out, "    struct epsg_defs *p;\n");
+			 "static const struct epsg_catalog_def epsg_defs_%s[] = {\n",
+			 name);
 		def_cnt = 0;
 	    }
 	  pending_footer = 1;
 
-	  /* inserting the main EPSG def */
+	  /* inserting the EPSG def */
 	  def_cnt++;
-	  fprintf (out,
-		   "    p = add_epsg_def_ex (filter, first, last, %d, \"epsg\", %d,\n",
-		   p->srid, p->srid);
-	  fprintf (out,
-		   "        \"%s\", %d, %d,\n",
-		   p->ref_sys_name, p->is_geographic, p->flipped_axes);
-	  fprintf (out,
-		   "        \"%s\", \"%s\",\n", p->spheroid, p->prime_meridian);
-	  fprintf (out,
-		   "        \"%s\", \"%s\", \"%s\",\n",
-		   p->datum, p->projection, p->unit);
-	  fprintf (out,
-		   "        \"%s\", \"%s\", \"%s\", \"%s\");\n",
-		   p->axis_1, p->orientation_1, p->axis_2, p->orientation_2);
-
-	  /* inserting the proj4text string */
-	  n = 0;
-	  in = p->proj4text;
-	  while (*in != '\0')
-	    {
-		fprintf (out, "    add_proj4text (p, %d,\n        \"", n);
-		out_cnt = 0;
-		while (*in != '\0')
-		  {
-		      if (*in == '"')
-			{
-			    fprintf (out, "\\%c", *in++);
-			    out_cnt += 2;
-			}
-		      else
-			{
-			    fprintf (out, "%c", *in++);
-			    out_cnt++;
-			}
-		      if (out_cnt >= 56)
-			  break;
-		  }
-		fprintf (out, "\");\n");
-		n++;
-	    }
-
-	  if (p->srtext != NULL)
-	    {
-		/* inserting the srs_wkt string */
-		n = 0;
-		in = p->srtext;
-		while (*in != '\0')
-		  {
-		      fprintf (out, "    add_srs_wkt (p, %d,\n        \"", n);
-		      out_cnt = 0;
-		      while (*in != '\0')
-			{
-			    if (*in == '"')
-			      {
-				  fprintf (out, "\\%c", *in++);
-				  out_cnt += 2;
-			      }
-			    else
-			      {
-				  fprintf (out, "%c", *in++);
-				  out_cnt++;
-			      }
-			    if (out_cnt >= 56)
-				break;
-			}
-		      fprintf (out, "\");\n");
-		      n++;
-		  }
-	    }
-	  else
-	      fprintf (out, "    add_srs_wkt (p, 0, \"\");\n");
+	  do_def (out, p);
       }
     if (out != NULL)
       {
 	  /* closing the output file */
 	  if (pending_footer)
 	    {
-		do_footer (out, 0);
+		do_footer (out, name, 0);
 		pending_footer = 0;
 	    }
 
@@ -2157,15 +2189,9 @@ output_c_code (FILE * out, struct epsg_dict *epsg)
     out = open_file3 ();
     if (out == NULL)
 	return;
-
-/* function header */
     do_header (out, 1);
     do_prussian (out);
-
-/* function footer */
-    do_footer (out, 1);
-
-/* closing the "prussian" output file */
+    do_footer (out, "prussian", 1);
     fclose (out);
     out = NULL;
 
@@ -2173,115 +2199,22 @@ output_c_code (FILE * out, struct epsg_dict *epsg)
     out = open_file2 ();
     if (out == NULL)
 	return;
-
-/* function header */
-    do_header (out, 0);
-    fprintf (out, "/* declaring prototypes */\n");
-    for (i = 0; i < sect; i++)
-	fprintf (out,
-		 "SPATIALITE_PRIVATE void initialize_epsg_%02d (\n\tint filter, struct epsg_defs **first, struct epsg_defs **last);\n",
-		 i);
-    for (i = 0; i < wgs84_sect; i++)
-	fprintf (out,
-		 "SPATIALITE_PRIVATE void initialize_epsg_wgs84_%02d (\n\tint filter, struct epsg_defs **first, struct epsg_defs **last);\n",
-		 i);
-    fprintf (out,
-	     "SPATIALITE_PRIVATE void initialize_epsg_prussian (\n\tint filter, struct epsg_defs **first, struct epsg_defs **last);\n");
-    fprintf (out,
-	     "SPATIALITE_PRIVATE void initialize_epsg_extra (\n\tint filter, struct epsg_defs **first, struct epsg_defs **last);\n\n");
-
-    fprintf (out, "SPATIALITE_PRIVATE void\n");
-    fprintf (out,
-	     "initialize_epsg_extra (int filter, struct epsg_defs **first, struct epsg_defs **last)\n\n");
-    fprintf (out, "{\n/* initializing the EPSG defs list [EXTRA] */\n");
-    fprintf (out, "    struct epsg_defs *p;\n");
-
-    fprintf (out,
-	     "    p = add_epsg_def (filter, first, last, 40000, \"gfoss.it\", 1,\n");
-    fprintf (out, "        \"Italy mainland zone 1 GB Roma40\");\n");
-    fprintf (out, "    add_proj4text (p, 0,\n");
-    fprintf (out,
-	     "        \"+proj=tmerc+lat_0=0 +lon_0=9  +k=0.9996 +x_0=1500000 +y_\");\n");
-    fprintf (out, "    add_proj4text (p, 1,\n");
-    fprintf (out,
-	     "        \"0=0 +ellps=intl +units=m +towgs84=-104.1,-49.1,-9.9,0.97\");\n");
-    fprintf (out,
-	     "    add_proj4text (p, 2, \"1,-2.917,0.714,-11.68 +no_defs\");\n");
-    fprintf (out, "    add_srs_wkt (p, 0, \"\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def (filter, first, last, 40001, \"gfoss.it\", 2,\n");
-    fprintf (out, "        \"Italy mainland zone 2 GB Roma40\");\n");
-    fprintf (out, "    add_proj4text (p, 0,\n");
-    fprintf (out,
-	     "        \"+proj=tmerc +lat_0=0 +lon_0=15 +k=0.9996 +x_0=2520000 +y\");\n");
-    fprintf (out, "    add_proj4text (p, 1,\n");
-    fprintf (out,
-	     "        \"_0=0 +ellps=intl +units=m +towgs84=-104.1,-49.1,-9.9,0.9\");\n");
-    fprintf (out,
-	     "    add_proj4text (p, 2, \"71,-2.917,0.714,-11.68 +no_defs\");\n");
-    fprintf (out, "    add_srs_wkt (p, 0, \"\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def (filter, first, last, 40002, \"gfoss.it\", 3,\n");
-    fprintf (out, "        \"Italy Sardinia GB Roma40\");\n");
-    fprintf (out, "    add_proj4text (p, 0,\n");
-    fprintf (out,
-	     "        \"+proj=tmerc +lat_0=0 +lon_0=9  +k=0.9996 +x_0=1500000 +y\");\n");
-    fprintf (out, "    add_proj4text (p, 1,\n");
-    fprintf (out,
-	     "        \"_0=0 +ellps=intl +units=m +towgs84=-168.6,-34.0,38.6,-0.\");\n");
-    fprintf (out,
-	     "    add_proj4text (p, 2, \"374,-0.679,-1.379,-9.48 +no_defs\");\n");
-    fprintf (out, "    add_srs_wkt (p, 0, \"\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def (filter, first, last, 40003, \"gfoss.it\", 4,\n");
-    fprintf (out, "        \"Italy Sicily GB Roma40\");\n");
-    fprintf (out, "    add_proj4text (p, 0,\n");
-    fprintf (out,
-	     "        \"+proj=tmerc +lat_0=0 +lon_0=9  +k=0.9996 +x_0=1500000 +y\");\n");
-    fprintf (out, "    add_proj4text (p, 1,\n");
-    fprintf (out,
-	     "        \"_0=0 +ellps=intl +units=m +towgs84=-50.2,-50.4,84.8,-0.6\");\n");
-    fprintf (out,
-	     "    add_proj4text (p, 2, \"90,-2.012,0.459,-28.08  +no_defs\");\n");
-    fprintf (out, "    add_srs_wkt (p, 0, \"\");\n");
-
-/* function footer */
-    do_footer (out, 0);
-
-/* inserting the pilot function */
-    fprintf (out, "SPATIALITE_PRIVATE void\n");
-    fprintf (out,
-	     "initialize_epsg (int filter, struct epsg_defs **first, struct epsg_defs **last)\n");
-    fprintf (out, "{\n/* initializing the EPSG defs list */\n");
-    fprintf (out, "    struct epsg_defs *p;\n ");
-    fprintf (out, "/* initializing the EPSG UNKNOWN def [-1] */\n");
-    fprintf (out,
-	     "    p = add_epsg_def (filter, first, last, -1, \"NONE\", -1, \"Undefined - Cartesian\");\n");
-    fprintf (out, "    add_proj4text (p, 0, \"\");\n");
-    fprintf (out, "    add_srs_wkt (p, 0, \"\");\n");
-    fprintf (out,
-	     "    p = add_epsg_def (filter, first, last, 0, \"NONE\", 0, \"Undefined - Geographic Long/Lat\");\n");
-    fprintf (out, "    add_proj4text (p, 0, \"\");\n");
-    fprintf (out, "    add_srs_wkt (p, 0, \"\");\n\n");
-    fprintf (out, "    if (filter != GAIA_EPSG_WGS84_ONLY)\n    {\n");
-    fprintf (out,
-	     "#ifndef OMIT_EPSG    /* full EPSG initialization enabled */\n");
-    for (i = 0; i < sect; i++)
-	fprintf (out,
-		 "        initialize_epsg_%02d (filter, first, last);\n", i);
-    fprintf (out, "        initialize_epsg_prussian (filter, first, last);\n");
-    fprintf (out, "        initialize_epsg_extra (filter, first, last);\n");
-    fprintf (out, "#endif /* full EPSG initialization enabled/disabled */\n");
-
-    fprintf (out, "    }\n");
-    for (i = 0; i < wgs84_sect; i++)
-	fprintf (out,
-		 "    initialize_epsg_wgs84_%02d (filter, first, last);\n", i);
-    fprintf (out, "}\n");
-
-/* closing the "extra" output file */
+    do_header (out, 1);
+    do_extra (out);
+    do_footer (out, "extra", 1);
     fclose (out);
     out = NULL;
+
+/*
+/ please note: the -1 and 0 "Undefined" defs and the block
+/ directories live in srs_init.c; if the number of generated
+/ epsg_inlined_NN.c files changes they must be updated there
+/ (and in the Makefiles) accordingly
+*/
+    if (sect != 60 || wgs84_sect != 2)
+	fprintf (stderr,
+		 "WARNING: %d EPSG blocks + %d WGS84 blocks: please update srs_init.c\n",
+		 sect, wgs84_sect);
 }
 
 int
@@ -47,6 +47,12 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <stdio.h>
 #include <string.h>
 
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "config-msvc.h"
+#else
+#include "config.h"
+#endif
+
 #include <spatialite/sqlite.h>
 #include <spatialite/debug.h>
 
@@ -57,323 +63,311 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include <spatialite.h>
 #include <spatialite_private.h>
 
-static void
-free_epsg_def (struct epsg_defs *ptr)
-{
-/* memory cleanup - destroying an EPSG def item */
-    if (ptr->auth_name)
-	free (ptr->auth_name);
-    if (ptr->ref_sys_name)
-	free (ptr->ref_sys_name);
-    if (ptr->proj4text)
-	free (ptr->proj4text);
-    if (ptr->srs_wkt)
-	free (ptr->srs_wkt);
-    if (ptr->spheroid)
-	free (ptr->spheroid);
-    if (ptr->prime_meridian)
-	free (ptr->prime_meridian);
-    if (ptr->datum)
-	free (ptr->datum);
-    if (ptr->projection)
-	free (ptr->projection);
-    if (ptr->unit)
-	free (ptr->unit);
-    if (ptr->axis_1)
-	free (ptr->axis_1);
-    if (ptr->orientation_1)
-	free (ptr->orientation_1);
-    if (ptr->axis_2)
-	free (ptr->axis_2);
-    if (ptr->orientation_2)
-	free (ptr->orientation_2);
-    free (ptr);
-}
-
-SPATIALITE_PRIVATE struct epsg_defs *
-add_epsg_def (int filter_srid, struct epsg_defs **first,
-	      struct epsg_defs **last, int srid, const char *auth_name,
-	      int auth_srid, const char *ref_sys_name)
+/* the read-only EPSG catalog - see epsg_inlined_*.c */
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_wgs84_00;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_wgs84_01;
+#ifndef OMIT_EPSG		/* full EPSG initialization enabled */
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_00;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_01;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_02;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_03;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_04;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_05;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_06;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_07;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_08;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_09;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_10;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_11;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_12;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_13;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_14;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_15;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_16;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_17;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_18;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_19;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_20;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_21;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_22;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_23;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_24;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_25;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_26;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_27;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_28;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_29;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_30;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_31;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_32;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_33;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_34;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_35;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_36;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_37;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_38;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_39;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_40;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_41;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_42;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_43;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_44;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_45;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_46;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_47;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_48;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_49;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_50;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_51;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_52;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_53;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_54;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_55;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_56;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_57;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_58;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_59;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_extra;
+extern SPATIALITE_PRIVATE const struct epsg_catalog epsg_catalog_prussian;
+#endif /* full EPSG initialization enabled/disabled */
+
+static const struct epsg_catalog_def epsg_defs_undefined[] = {
+    {-1, "NONE", -1, "Undefined - Cartesian", -1, -1,
+     NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, "", ""},
+    {0, "NONE", 0, "Undefined - Geographic Long/Lat", -1, -1,
+     NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, "", ""}
+};
+
+static const struct epsg_catalog epsg_catalog_undefined = {
+    epsg_defs_undefined,
+    sizeof (epsg_defs_undefined) / sizeof (epsg_defs_undefined[0])
+};
+
+/* WGS84 blocks: always available */
+static const struct epsg_catalog *const epsg_catalog_wgs84[] = {
+    &epsg_catalog_wgs84_00,
+    &epsg_catalog_wgs84_01
+};
+
+#ifndef OMIT_EPSG		/* full EPSG initialization enabled */
+/* all other blocks: disjoint SRID ranges, in ascending order */
+static const struct epsg_catalog *const epsg_catalog_full[] = {
+    &epsg_catalog_00,
+    &epsg_catalog_01,
+    &epsg_catalog_02,
+    &epsg_catalog_03,
+    &epsg_catalog_04,
+    &epsg_catalog_05,
+    &epsg_catalog_06,
+    &epsg_catalog_07,
+    &epsg_catalog_08,
+    &epsg_catalog_09,
+    &epsg_catalog_10,
+    &epsg_catalog_11,
+    &epsg_catalog_12,
+    &epsg_catalog_13,
+    &epsg_catalog_14,
+    &epsg_catalog_15,
+    &epsg_catalog_16,
+    &epsg_catalog_17,
+    &epsg_catalog_18,
+    &epsg_catalog_19,
+    &epsg_catalog_20,
+    &epsg_catalog_21,
+    &epsg_catalog_22,
+    &epsg_catalog_23,
+    &epsg_catalog_24,
+    &epsg_catalog_25,
+    &epsg_catalog_26,
+    &epsg_catalog_27,
+    &epsg_catalog_28,
+    &epsg_catalog_29,
+    &epsg_catalog_30,
+    &epsg_catalog_31,
+    &epsg_catalog_32,
+    &epsg_catalog_33,
+    &epsg_catalog_34,
+    &epsg_catalog_35,
+    &epsg_catalog_36,
+    &epsg_catalog_37,
+    &epsg_catalog_38,
+    &epsg_catalog_39,
+    &epsg_catalog_40,
+    &epsg_catalog_41,
+    &epsg_catalog_42,
+    &epsg_catalog_43,
+    &epsg_catalog_44,
+    &epsg_catalog_45,
+    &epsg_catalog_46,
+    &epsg_catalog_47,
+    &epsg_catalog_48,
+    &epsg_catalog_49,
+    &epsg_catalog_50,
+    &epsg_catalog_51,
+    &epsg_catalog_52,
+    &epsg_catalog_53,
+    &epsg_catalog_54,
+    &epsg_catalog_55,
+    &epsg_catalog_56,
+    &epsg_catalog_57,
+    &epsg_catalog_58,
+    &epsg_catalog_59,
+    &epsg_catalog_extra,
+    &epsg_catalog_prussian
+};
+#endif /* full EPSG initialization enabled/disabled */
+
+/* the whole catalog, in spatial_ref_sys insertion order */
+static const struct epsg_catalog *const epsg_catalog_all[] = {
+    &epsg_catalog_undefined,
+#ifndef OMIT_EPSG		/* full EPSG initialization enabled */
+    &epsg_catalog_00,
+    &epsg_catalog_01,
+    &epsg_catalog_02,
+    &epsg_catalog_03,
+    &epsg_catalog_04,
+    &epsg_catalog_05,
+    &epsg_catalog_06,
+    &epsg_catalog_07,
+    &epsg_catalog_08,
+    &epsg_catalog_09,
+    &epsg_catalog_10,
+    &epsg_catalog_11,
+    &epsg_catalog_12,
+    &epsg_catalog_13,
+    &epsg_catalog_14,
+    &epsg_catalog_15,
+    &epsg_catalog_16,
+    &epsg_catalog_17,
+    &epsg_catalog_18,
+    &epsg_catalog_19,
+    &epsg_catalog_20,
+    &epsg_catalog_21,
+    &epsg_catalog_22,
+    &epsg_catalog_23,
+    &epsg_catalog_24,
+    &epsg_catalog_25,
+    &epsg_catalog_26,
+    &epsg_catalog_27,
+    &epsg_catalog_28,
+    &epsg_catalog_29,
+    &epsg_catalog_30,
+    &epsg_catalog_31,
+    &epsg_catalog_32,
+    &epsg_catalog_33,
+    &epsg_catalog_34,
+    &epsg_catalog_35,
+    &epsg_catalog_36,
+    &epsg_catalog_37,
+    &epsg_catalog_38,
+    &epsg_catalog_39,
+    &epsg_catalog_40,
+    &epsg_catalog_41,
+    &epsg_catalog_42,
+    &epsg_catalog_43,
+    &epsg_catalog_44,
+    &epsg_catalog_45,
+    &epsg_catalog_46,
+    &epsg_catalog_47,
+    &epsg_catalog_48,
+    &epsg_catalog_49,
+    &epsg_catalog_50,
+    &epsg_catalog_51,
+    &epsg_catalog_52,
+    &epsg_catalog_53,
+    &epsg_catalog_54,
+    &epsg_catalog_55,
+    &epsg_catalog_56,
+    &epsg_catalog_57,
+    &epsg_catalog_58,
+    &epsg_catalog_59,
+    &epsg_catalog_extra,
+    &epsg_catalog_prussian,
+#endif /* full EPSG initialization enabled/disabled */
+    &epsg_catalog_wgs84_00,
+    &epsg_catalog_wgs84_01
+};
+
+static const struct epsg_catalog *const epsg_catalog_wgs84_only[] = {
+    &epsg_catalog_undefined,
+    &epsg_catalog_wgs84_00,
+    &epsg_catalog_wgs84_01
+};
+
+SPATIALITE_PRIVATE const struct epsg_catalog *const *
+get_epsg_catalog (int filter, int *count)
 {
-/* appending an EPSG def to the list */
-    int len;
-    struct epsg_defs *p;
-    if (filter_srid == GAIA_EPSG_NONE)
-	return NULL;
-    if (filter_srid == GAIA_EPSG_ANY || filter_srid == GAIA_EPSG_WGS84_ONLY)
-	;
-    else if (srid != filter_srid)
-	return NULL;
-    p = malloc (sizeof (struct epsg_defs));
-    if (!p)
-	return NULL;
-    p->srid = srid;
-    p->auth_name = NULL;
-    p->auth_srid = auth_srid;
-    p->ref_sys_name = NULL;
-    p->proj4text = NULL;
-    p->srs_wkt = NULL;
-    p->next = NULL;
-    if (auth_name)
-      {
-	  len = strlen (auth_name);
-	  if (len > 0)
-	    {
-		p->auth_name = malloc (len + 1);
-		if (p->auth_name == NULL)
-		    goto error;
-		strcpy (p->auth_name, auth_name);
-	    }
-      }
-    if (ref_sys_name)
+/* returning the EPSG blocks to be inserted for the given mode */
+    if (filter == GAIA_EPSG_WGS84_ONLY)
       {
-	  len = strlen (ref_sys_name);
-	  if (len > 0)
-	    {
-		p->ref_sys_name = malloc (len + 1);
-		if (p->ref_sys_name == NULL)
-		    goto error;
-		strcpy (p->ref_sys_name, ref_sys_name);
-	    }
+	  *count =
+	      sizeof (epsg_catalog_wgs84_only) /
+	      sizeof (epsg_catalog_wgs84_only[0]);
+	  return epsg_catalog_wgs84_only;
       }
-    p->is_geographic = -1;
-    p->flipped_axes = -1;
-    p->spheroid = NULL;
-    p->prime_meridian = NULL;
-    p->datum = NULL;
-    p->projection = NULL;
-    p->unit = NULL;
-    p->axis_1 = NULL;
-    p->orientation_1 = NULL;
-    p->axis_2 = NULL;
-    p->orientation_2 = NULL;
-    if (*first == NULL)
-	*first = p;
-    if (*last != NULL)
-	(*last)->next = p;
-    *last = p;
-    return p;
-  error:
-    free_epsg_def (p);
-    return NULL;
+    *count = sizeof (epsg_catalog_all) / sizeof (epsg_catalog_all[0]);
+    return epsg_catalog_all;
 }
 
-SPATIALITE_PRIVATE struct epsg_defs *
-add_epsg_def_ex (int filter_srid, struct epsg_defs **first,
-		 struct epsg_defs **last, int srid, const char *auth_name,
-		 int auth_srid, const char *ref_sys_name, int is_geographic,
-		 int flipped_axes, const char *spheroid,
-		 const char *prime_meridian, const char *datum,
-		 const char *projection, const char *unit, const char *axis_1,
-		 const char *orientation_1, const char *axis_2,
-		 const char *orientation_2)
+static const struct epsg_catalog_def *
+find_epsg_def_block (const struct epsg_catalog *block, int srid)
 {
-/* appending an EPSG def to the list */
-    int len;
-    struct epsg_defs *p;
-    if (filter_srid == GAIA_EPSG_NONE)
-	return NULL;
-    if (filter_srid == GAIA_EPSG_ANY || filter_srid == GAIA_EPSG_WGS84_ONLY)
-	;
-    else if (srid != filter_srid)
-	return NULL;
-    p = malloc (sizeof (struct epsg_defs));
-    if (!p)
-	return NULL;
-    p->srid = srid;
-    p->auth_name = NULL;
-    p->auth_srid = auth_srid;
-    p->ref_sys_name = NULL;
-    p->proj4text = NULL;
-    p->srs_wkt = NULL;
-    p->spheroid = NULL;
-    p->prime_meridian = NULL;
-    p->datum = NULL;
-    p->unit = NULL;
-    p->axis_1 = NULL;
-    p->orientation_1 = NULL;
-    p->axis_2 = NULL;
-    p->orientation_2 = NULL;
-    p->next = NULL;
-    if (auth_name)
-      {
-	  len = strlen (auth_name);
-	  if (len > 0)
-	    {
-		p->auth_name = malloc (len + 1);
-		if (p->auth_name == NULL)
-		    goto error;
-		strcpy (p->auth_name, auth_name);
-	    }
-      }
-    if (ref_sys_name)
-      {
-	  len = strlen (ref_sys_name);
-	  if (len > 0)
-	    {
-		p->ref_sys_name = malloc (len + 1);
-		if (p->ref_sys_name == NULL)
-		    goto error;
-		strcpy (p->ref_sys_name, ref_sys_name);
-	    }
-      }
-    p->is_geographic = is_geographic;
-    p->flipped_axes = flipped_axes;
-    if (spheroid)
-      {
-	  len = strlen (spheroid);
-	  p->spheroid = malloc (len + 1);
-	  if (p->spheroid == NULL)
-	      goto error;
-	  strcpy (p->spheroid, spheroid);
-      }
-    if (prime_meridian)
-      {
-	  len = strlen (prime_meridian);
-	  p->prime_meridian = malloc (len + 1);
-	  if (p->prime_meridian == NULL)
-	      goto error;
-	  strcpy (p->prime_meridian, prime_meridian);
-      }
-    if (datum)
-      {
-	  len = strlen (datum);
-	  p->datum = malloc (len + 1);
-	  if (p->datum == NULL)
-	      goto error;
-	  strcpy (p->datum, datum);
-      }
-    if (projection)
-      {
-	  len = strlen (projection);
-	  p->projection = malloc (len + 1);
-	  if (p->projection == NULL)
-	      goto error;
-	  strcpy (p->projection, projection);
-      }
-    if (unit)
-      {
-	  len = strlen (unit);
-	  p->unit = malloc (len + 1);
-	  if (p->unit == NULL)
-	      goto error;
-	  strcpy (p->unit, unit);
-      }
-    if (axis_1)
-      {
-	  len = strlen (axis_1);
-	  p->axis_1 = malloc (len + 1);
-	  if (p->axis_1 == NULL)
-	      goto error;
-	  strcpy (p->axis_1, axis_1);
-      }
-    if (orientation_1)
-      {
-	  len = strlen (orientation_1);
-	  p->orientation_1 = malloc (len + 1);
-	  if (p->orientation_1 == NULL)
-	      goto error;
-	  strcpy (p->orientation_1, orientation_1);
-      }
-    if (axis_2)
-      {
-	  len = strlen (axis_2);
-	  p->axis_2 = malloc (len + 1);
-	  if (p->axis_2 == NULL)
-	      goto error;
-	  strcpy (p->axis_2, axis_2);
-      }
-    if (orientation_2)
-      {
-	  len = strlen (orientation_2);
-	  p->orientation_2 = malloc (len + 1);
-	  if (p->orientation_2 == NULL)
-	      goto error;
-	  strcpy (p->orientation_2, orientation_2);
+/* binary search within a single sorted block */
+    int lo = 0;
+    int hi = block->count - 1;
+    while (lo <= hi)
+      {
+	  int mid = (lo + hi) / 2;
+	  const struct epsg_catalog_def *p = block->defs + mid;
+	  if (p->srid == srid)
+	      return p;
+	  if (p->srid < srid)
+	      lo = mid + 1;
+	  else
+	      hi = mid - 1;
       }
-    if (*first == NULL)
-	*first = p;
-    if (*last != NULL)
-	(*last)->next = p;
-    *last = p;
-    return p;
-  error:
-    free_epsg_def (p);
     return NULL;
 }
 
-SPATIALITE_PRIVATE void
-add_proj4text (struct epsg_defs *p, int count, const char *text)
-{
-/* creating the PROJ4TEXT string */
-    int len;
-    int olen;
-    char *string;
-    if (p == NULL || text == NULL)
-	return;
-    len = strlen (text);
-    if (!count)
-      {
-	  p->proj4text = malloc (len + 1);
-	  if (p->proj4text == NULL)
-	      return;
-	  strcpy (p->proj4text, text);
-	  return;
-      }
-    if (p->proj4text == NULL)
-	return;
-    olen = strlen (p->proj4text);
-    string = malloc (len + olen + 1);
-    if (string == NULL)
-	return;
-    strcpy (string, p->proj4text);
-    free (p->proj4text);
-    p->proj4text = string;
-    strcat (p->proj4text, text);
-}
-
-SPATIALITE_PRIVATE void
-add_srs_wkt (struct epsg_defs *p, int count, const char *text)
+static const struct epsg_catalog_def *
+find_epsg_def_blocks (const struct epsg_catalog *const *blocks, int count,
+		      int srid)
 {
-/* creating the SRS_WKT string */
-    int len;
-    int olen;
-    char *string;
-    if (p == NULL || text == NULL)
-	return;
-    len = strlen (text);
-    if (!count)
-      {
-	  p->srs_wkt = malloc (len + 1);
-	  if (p->srs_wkt == NULL)
-	      return;
-	  strcpy (p->srs_wkt, text);
-	  return;
+/* binary search across sorted blocks with disjoint SRID ranges */
+    int lo = 0;
+    int hi = count - 1;
+    while (lo <= hi)
+      {
+	  int mid = (lo + hi) / 2;
+	  const struct epsg_catalog *block = blocks[mid];
+	  if (srid < block->defs[0].srid)
+	      hi = mid - 1;
+	  else if (srid > block->defs[block->count - 1].srid)
+	      lo = mid + 1;
+	  else
+	      return find_epsg_def_block (block, srid);
       }
-    if (p->srs_wkt == NULL)
-	return;
-    olen = strlen (p->srs_wkt);
-    string = malloc (len + olen + 1);
-    if (string == NULL)
-	return;
-    strcpy (string, p->srs_wkt);
-    free (p->srs_wkt);
-    p->srs_wkt = string;
-    strcat (p->srs_wkt, text);
+    return NULL;
 }
 
-SPATIALITE_PRIVATE void
-free_epsg (struct epsg_defs *first)
+SPATIALITE_PRIVATE const struct epsg_catalog_def *
+find_epsg_def (int srid)
 {
-/* memory cleanup - destroying the EPSG list */
-    struct epsg_defs *p = first;
-    struct epsg_defs *pn;
-    while (p)
-      {
-	  pn = p->next;
-	  free_epsg_def (p);
-	  p = pn;
-      }
+/* looking up a single EPSG def - O(log n), no allocations */
+    const struct epsg_catalog_def *p;
+    p = find_epsg_def_block (&epsg_catalog_undefined, srid);
+    if (p != NULL)
+	return p;
+#ifndef OMIT_EPSG		/* full EPSG initialization enabled */
+    p = find_epsg_def_blocks (epsg_catalog_full,
+			      sizeof (epsg_catalog_full) /
+			      sizeof (epsg_catalog_full[0]), srid);
+    if (p != NULL)
+	return p;
+#endif /* full EPSG initialization enabled/disabled */
+    return find_epsg_def_blocks (epsg_catalog_wgs84,
+				 sizeof (epsg_catalog_wgs84) /
+				 sizeof (epsg_catalog_wgs84[0]), srid);
 }
 
 SPATIALITE_PRIVATE int
@@ -421,22 +415,17 @@ create_spatial_ref_sys_aux (sqlite3 * handle)
 }
 
 static int
-populate_spatial_ref_sys (sqlite3 * handle, int mode, int metadata)
+prepare_epsg_insert (sqlite3 * handle, int metadata, sqlite3_stmt ** xstmt,
+		     sqlite3_stmt ** xstmt_aux)
 {
-/* populating the EPSG dataset into the SPATIAL_REF_SYS table */
-    struct epsg_defs *first = NULL;
-    struct epsg_defs *last = NULL;
-    struct epsg_defs *p;
+/* preparing the SQL parameterized statements (main and aux) */
     char sql[1024];
     int ret;
     sqlite3_stmt *stmt = NULL;
     sqlite3_stmt *stmt_aux = NULL;
-    int ok_aux;
-
-/* initializing the EPSG defs list */
-    initialize_epsg (mode, &first, &last);
 
-/* preparing the SQL parameterized statement (main) */
+    *xstmt = NULL;
+    *xstmt_aux = NULL;
     strcpy (sql, "INSERT INTO spatial_ref_sys ");
 
 /*
@@ -467,10 +456,9 @@ populate_spatial_ref_sys (sqlite3 * handle, int mode, int metadata)
     if (ret != SQLITE_OK)
       {
 	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
-	  goto error;
+	  return 0;
       }
 
-/* preparing the SQL parameterized statement (aux) */
     if (metadata >= 3)
       {
 	  /*  SpatiaLite 4.0.0 - present */
@@ -485,160 +473,161 @@ populate_spatial_ref_sys (sqlite3 * handle, int mode, int metadata)
 	  if (ret != SQLITE_OK)
 	    {
 		spatialite_e ("%s\n", sqlite3_errmsg (handle));
-		goto error;
+		sqlite3_finalize (stmt);
+		return 0;
 	    }
       }
+/* end Mark Johnson 2019-01-27 */
+
+    *xstmt = stmt;
+    *xstmt_aux = stmt_aux;
+    return 1;
+}
+
+static void
+bind_epsg_aux_text (sqlite3_stmt * stmt, int pos, const char *value,
+		    int *ok_aux)
+{
+/* binding an optional SPATIAL_REF_SYS_AUX text value */
+    if (value == NULL)
+	sqlite3_bind_null (stmt, pos);
+    else
+      {
+	  sqlite3_bind_text (stmt, pos, value, strlen (value), SQLITE_STATIC);
+	  *ok_aux = 1;
+      }
+}
 
-    p = first;
-    while (p)
+static int
+insert_epsg_def (sqlite3 * handle, sqlite3_stmt * stmt,
+		 sqlite3_stmt * stmt_aux, int metadata,
+		 const struct epsg_catalog_def *p)
+{
+/* inserting a single EPSG def into SPATIAL_REF_SYS (and _AUX) */
+    int ret;
+    int ok_aux;
+
+/* inserting into SPATIAL_REF_SYS */
+    sqlite3_reset (stmt);
+    sqlite3_clear_bindings (stmt);
+    sqlite3_bind_int (stmt, 1, p->srid);
+    sqlite3_bind_text (stmt, 2, p->auth_name, strlen (p->auth_name),
+		       SQLITE_STATIC);
+    sqlite3_bind_int (stmt, 3, p->auth_srid);
+    sqlite3_bind_text (stmt, 4, p->ref_sys_name, strlen (p->ref_sys_name),
+		       SQLITE_STATIC);
+    sqlite3_bind_text (stmt, 5, p->proj4text, strlen (p->proj4text),
+		       SQLITE_STATIC);
+    if (metadata >= 2)
       {
-	  if (p->auth_name == NULL)
-	      break;
-	  /* inserting into SPATIAL_REF_SYS */
-	  sqlite3_reset (stmt);
-	  sqlite3_clear_bindings (stmt);
-	  sqlite3_bind_int (stmt, 1, p->srid);
-	  sqlite3_bind_text (stmt, 2, p->auth_name, strlen (p->auth_name),
-			     SQLITE_STATIC);
-	  sqlite3_bind_int (stmt, 3, p->auth_srid);
-	  sqlite3_bind_text (stmt, 4, p->ref_sys_name, strlen (p->ref_sys_name),
-			     SQLITE_STATIC);
-	  sqlite3_bind_text (stmt, 5, p->proj4text, strlen (p->proj4text),
-			     SQLITE_STATIC);
-	  if (metadata >= 2)
-	    {
-		/*  SpatiaLite-Legacy 2.4.0 - 3.0.1 and SpatiaLite 4.0.0 - present */
-		if (strlen (p->srs_wkt) == 0)
-		    sqlite3_bind_text (stmt, 6, "Undefined", 9, SQLITE_STATIC);
-		else
-		    sqlite3_bind_text (stmt, 6, p->srs_wkt, strlen (p->srs_wkt),
-				       SQLITE_STATIC);
-		ret = sqlite3_step (stmt);
-		if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-		    ;
-		else
-		  {
-		      spatialite_e ("%s\n", sqlite3_errmsg (handle));
-		      goto error;
-		  }
-	    }
+	  /*  SpatiaLite-Legacy 2.4.0 - 3.0.1 and SpatiaLite 4.0.0 - present */
+	  if (strlen (p->srs_wkt) == 0)
+	      sqlite3_bind_text (stmt, 6, "Undefined", 9, SQLITE_STATIC);
+	  else
+	      sqlite3_bind_text (stmt, 6, p->srs_wkt, strlen (p->srs_wkt),
+				 SQLITE_STATIC);
+      }
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_DONE || ret == SQLITE_ROW)
+	;
+    else
+      {
+	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
+	  return 0;
+      }
+    if (metadata < 3)
+	return 1;
+
+/* inserting into SPATIAL_REF_SYS_AUX - SpatiaLite 4.0.0 - present */
+    ok_aux = 0;
+    sqlite3_reset (stmt_aux);
+    sqlite3_clear_bindings (stmt_aux);
+    sqlite3_bind_int (stmt_aux, 1, p->srid);
+    if (p->is_geographic < 0)
+	sqlite3_bind_null (stmt_aux, 2);
+    else
+      {
+	  sqlite3_bind_int (stmt_aux, 2, p->is_geographic);
+	  ok_aux = 1;
+      }
+    if (p->flipped_axes < 0)
+	sqlite3_bind_null (stmt_aux, 3);
+    else
+      {
+	  sqlite3_bind_int (stmt_aux, 3, p->flipped_axes);
+	  ok_aux = 1;
+      }
+    bind_epsg_aux_text (stmt_aux, 4, p->spheroid, &ok_aux);
+    bind_epsg_aux_text (stmt_aux, 5, p->prime_meridian, &ok_aux);
+    bind_epsg_aux_text (stmt_aux, 6, p->datum, &ok_aux);
+    bind_epsg_aux_text (stmt_aux, 7, p->projection, &ok_aux);
+    bind_epsg_aux_text (stmt_aux, 8, p->unit, &ok_aux);
+    bind_epsg_aux_text (stmt_aux, 9, p->axis_1, &ok_aux);
+    bind_epsg_aux_text (stmt_aux, 10, p->orientation_1, &ok_aux);
+    bind_epsg_aux_text (stmt_aux, 11, p->axis_2, &ok_aux);
+    bind_epsg_aux_text (stmt_aux, 12, p->orientation_2, &ok_aux);
+    if (!ok_aux)
+	return 1;
+    ret = sqlite3_step (stmt_aux);
+    if (ret == SQLITE_DONE || ret == SQLITE_ROW)
+	;
+    else
+      {
+	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+populate_spatial_ref_sys (sqlite3 * handle, int mode, int metadata)
+{
+/* populating the EPSG dataset into the SPATIAL_REF_SYS table */
+    const struct epsg_catalog *const *blocks;
+    int n_blocks;
+    int ib;
+    int i;
+    int ret;
+    sqlite3_stmt *stmt = NULL;
+    sqlite3_stmt *stmt_aux = NULL;
+
+/* 
+/ a single batch: the savepoint works both inside and outside 
+/ of any transaction already started by the caller
+*/
+    ret =
+	sqlite3_exec (handle, "SAVEPOINT populate_spatial_ref_sys", NULL, NULL,
+		      NULL);
+    if (ret != SQLITE_OK)
+      {
+	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
+	  return 0;
+      }
+    if (!prepare_epsg_insert (handle, metadata, &stmt, &stmt_aux))
+	goto error;
 
-/* inserting into SPATIAL_REF_SYS_AUX */
-	  if (metadata >= 3)
-	    {			/*  SpatiaLite 4.0.0 - present */
-		ok_aux = 0;
-		sqlite3_reset (stmt_aux);
-		sqlite3_clear_bindings (stmt_aux);
-		sqlite3_bind_int (stmt_aux, 1, p->srid);
-		if (p->is_geographic < 0)
-		    sqlite3_bind_null (stmt_aux, 2);
-		else
-		  {
-		      sqlite3_bind_int (stmt_aux, 2, p->is_geographic);
-		      ok_aux = 1;
-		  }
-		if (p->flipped_axes < 0)
-		    sqlite3_bind_null (stmt_aux, 3);
-		else
-		  {
-		      sqlite3_bind_int (stmt_aux, 3, p->flipped_axes);
-		      ok_aux = 1;
-		  }
-		if (p->spheroid == NULL)
-		    sqlite3_bind_null (stmt_aux, 4);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 4, p->spheroid,
-					 strlen (p->spheroid), SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (p->prime_meridian == NULL)
-		    sqlite3_bind_null (stmt_aux, 5);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 5, p->prime_meridian,
-					 strlen (p->prime_meridian),
-					 SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (p->datum == NULL)
-		    sqlite3_bind_null (stmt_aux, 6);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 6, p->datum,
-					 strlen (p->datum), SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (p->projection == NULL)
-		    sqlite3_bind_null (stmt_aux, 7);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 7, p->projection,
-					 strlen (p->projection), SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (p->unit == NULL)
-		    sqlite3_bind_null (stmt_aux, 8);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 8, p->unit, strlen (p->unit),
-					 SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (p->axis_1 == NULL)
-		    sqlite3_bind_null (stmt_aux, 9);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 9, p->axis_1,
-					 strlen (p->axis_1), SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (p->orientation_1 == NULL)
-		    sqlite3_bind_null (stmt_aux, 10);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 10, p->orientation_1,
-					 strlen (p->orientation_1),
-					 SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (p->axis_2 == NULL)
-		    sqlite3_bind_null (stmt_aux, 11);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 11, p->axis_2,
-					 strlen (p->axis_2), SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (p->orientation_2 == NULL)
-		    sqlite3_bind_null (stmt_aux, 12);
-		else
-		  {
-		      sqlite3_bind_text (stmt_aux, 12, p->orientation_2,
-					 strlen (p->orientation_2),
-					 SQLITE_STATIC);
-		      ok_aux = 1;
-		  }
-		if (ok_aux)
-		  {
-		      ret = sqlite3_step (stmt_aux);
-		      if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-			  ;
-		      else
-			{
-			    spatialite_e ("%s\n", sqlite3_errmsg (handle));
-			    goto error;
-			}
-		  }
+    blocks = get_epsg_catalog (mode, &n_blocks);
+    for (ib = 0; ib < n_blocks; ib++)
+      {
+	  const struct epsg_catalog *block = blocks[ib];
+	  for (i = 0; i < block->count; i++)
+	    {
+		if (!insert_epsg_def
+		    (handle, stmt, stmt_aux, metadata, block->defs + i))
+		    goto error;
 	    }
-	  /* end Mark Johnson 2019-01-27 */
-	  p = p->next;
       }
     sqlite3_finalize (stmt);
-    sqlite3_finalize (stmt_aux);
-
-/* freeing the EPSG defs list */
-    free_epsg (first);
+    if (stmt_aux != NULL)
+	sqlite3_finalize (stmt_aux);
+    ret =
+	sqlite3_exec (handle, "RELEASE SAVEPOINT populate_spatial_ref_sys",
+		      NULL, NULL, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
+	  return 0;
+      }
     return 1;
 
   error:
@@ -646,9 +635,10 @@ populate_spatial_ref_sys (sqlite3 * handle, int mode, int metadata)
 	sqlite3_finalize (stmt);
     if (stmt_aux)
 	sqlite3_finalize (stmt_aux);
-/* freeing the EPSG defs list */
-    free_epsg (first);
-
+    sqlite3_exec (handle, "ROLLBACK TO SAVEPOINT populate_spatial_ref_sys",
+		  NULL, NULL, NULL);
+    sqlite3_exec (handle, "RELEASE SAVEPOINT populate_spatial_ref_sys", NULL,
+		  NULL, NULL);
     return 0;
 }
 
@@ -859,15 +849,11 @@ SPATIALITE_DECLARE int
 insert_epsg_srid (sqlite3 * handle, int srid)
 {
 /* inserting a single EPSG definition into the SPATIAL_REF_SYS table */
-    struct epsg_defs *first = NULL;
-    struct epsg_defs *last = NULL;
-    char sql[1024];
-    int ret;
-    int error = 0;
+    const struct epsg_catalog_def *p;
     int metadata = 0;
+    int ok;
     sqlite3_stmt *stmt = NULL;
     sqlite3_stmt *stmt_aux = NULL;
-    int ok_aux;
 
     if (!exists_spatial_ref_sys (handle))
       {
@@ -886,215 +872,20 @@ insert_epsg_srid (sqlite3 * handle, int srid)
 	  return 0;
       }
 
-/* initializing the EPSG defs list */
-    initialize_epsg (srid, &first, &last);
-    if (first == NULL)
+/* looking up the EPSG def */
+    p = find_epsg_def (srid);
+    if (p == NULL)
       {
 	  spatialite_e ("SRID=%d isn't defined in the EPSG inlined dataset\n",
 			srid);
 	  return 0;
       }
 
-/* preparing the SQL parameterized statement */
-
-/*
- * the following code has been contributed by Mark Johnson <mj10777@googlemail.com>
- * on 2019-01-27
-*/
-    strcpy (sql, "INSERT INTO spatial_ref_sys ");
-    switch (metadata)
-      {
-      case 1:			/* SpatiaLite-Pre-Legacy Versions 2.0 to 2.3.0 */
-	  strcat (sql,
-		  "(srid, auth_name, auth_srid, ref_sys_name, proj4text) ");
-	  strcat (sql, "VALUES (?, ?, ?, ?, ?)");
-	  break;
-      case 2:			/*  SpatiaLite-Legacy 2.4.0 - 3.0.1 */
-	  strcat (sql,
-		  "(srid, auth_name, auth_srid, ref_sys_name, proj4text, srs_wkt) ");
-	  strcat (sql, "VALUES (?, ?, ?, ?, ?, ?)");
-	  break;
-      case 3:			/*  SpatiaLite 4.0.0 - present */
-	  strcat (sql,
-		  "(srid, auth_name, auth_srid, ref_sys_name, proj4text, srtext) ");
-	  strcat (sql, "VALUES (?, ?, ?, ?, ?, ?)");
-	  create_spatial_ref_sys_aux (handle);
-	  break;
-      }
-    ret = sqlite3_prepare_v2 (handle, sql, strlen (sql), &stmt, NULL);
-    if (ret != SQLITE_OK)
-      {
-	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
-	  error = 1;
-	  goto stop;
-      }
-    if (metadata >= 3)
-      {				/*  SpatiaLite 4.0.0 - present */
-	  /* preparing the SQL parameterized statement (aux) */
-	  strcpy (sql, "INSERT INTO spatial_ref_sys_aux ");
-	  strcat (sql,
-		  "(srid, is_geographic, has_flipped_axes, spheroid, prime_meridian, ");
-	  strcat (sql,
-		  "datum, projection, unit, axis_1_name, axis_1_orientation, ");
-	  strcat (sql, "axis_2_name, axis_2_orientation) ");
-	  strcat (sql, "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
-	  ret = sqlite3_prepare_v2 (handle, sql, strlen (sql), &stmt_aux, NULL);
-	  if (ret != SQLITE_OK)
-	    {
-		spatialite_e ("%s\n", sqlite3_errmsg (handle));
-		error = 1;
-		goto stop;
-	    }
-      }
-
-    /* inserting into SPATIAL_REF_SYS */
-    sqlite3_reset (stmt);
-    sqlite3_clear_bindings (stmt);
-    sqlite3_bind_int (stmt, 1, first->srid);
-    sqlite3_bind_text (stmt, 2, first->auth_name, strlen (first->auth_name),
-		       SQLITE_STATIC);
-    sqlite3_bind_int (stmt, 3, first->auth_srid);
-    sqlite3_bind_text (stmt, 4, first->ref_sys_name,
-		       strlen (first->ref_sys_name), SQLITE_STATIC);
-    sqlite3_bind_text (stmt, 5, first->proj4text, strlen (first->proj4text),
-		       SQLITE_STATIC);
-    if (metadata >= 2)
-      {
-	  /*  SpatiaLite-Legacy 2.4.0 - 3.0.1 and SpatiaLite 4.0.0 - present */
-	  if (strlen (first->srs_wkt) == 0)
-	      sqlite3_bind_text (stmt, 6, "Undefined", 9, SQLITE_STATIC);
-	  else
-	      sqlite3_bind_text (stmt, 6, first->srs_wkt,
-				 strlen (first->srs_wkt), SQLITE_STATIC);
-      }
-    ret = sqlite3_step (stmt);
-    if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-	;
-    else
-      {
-	  spatialite_e ("%s\n", sqlite3_errmsg (handle));
-	  error = 1;
-	  goto stop;
-      }
-
-    if (metadata >= 3)
-      {				/*  SpatiaLite 4.0.0 - present */
-	  /* inserting into SPATIAL_REF_SYS_AUX */
-	  ok_aux = 0;
-	  sqlite3_reset (stmt_aux);
-	  sqlite3_clear_bindings (stmt_aux);
-	  sqlite3_bind_int (stmt_aux, 1, first->srid);
-	  if (first->is_geographic < 0)
-	      sqlite3_bind_null (stmt_aux, 2);
-	  else
-	    {
-		sqlite3_bind_int (stmt_aux, 2, first->is_geographic);
-		ok_aux = 1;
-	    }
-	  if (first->flipped_axes < 0)
-	      sqlite3_bind_null (stmt_aux, 3);
-	  else
-	    {
-		sqlite3_bind_int (stmt_aux, 3, first->flipped_axes);
-		ok_aux = 1;
-	    }
-	  if (first->spheroid == NULL)
-	      sqlite3_bind_null (stmt_aux, 4);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 4, first->spheroid,
-				   strlen (first->spheroid), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (first->prime_meridian == NULL)
-	      sqlite3_bind_null (stmt_aux, 5);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 5, first->prime_meridian,
-				   strlen (first->prime_meridian),
-				   SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (first->datum == NULL)
-	      sqlite3_bind_null (stmt_aux, 6);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 6, first->datum,
-				   strlen (first->datum), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (first->projection == NULL)
-	      sqlite3_bind_null (stmt_aux, 7);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 7, first->projection,
-				   strlen (first->projection), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (first->unit == NULL)
-	      sqlite3_bind_null (stmt_aux, 8);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 8, first->unit,
-				   strlen (first->unit), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (first->axis_1 == NULL)
-	      sqlite3_bind_null (stmt_aux, 9);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 9, first->axis_1,
-				   strlen (first->axis_1), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (first->orientation_1 == NULL)
-	      sqlite3_bind_null (stmt_aux, 10);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 10, first->orientation_1,
-				   strlen (first->orientation_1),
-				   SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (first->axis_2 == NULL)
-	      sqlite3_bind_null (stmt_aux, 11);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 11, first->axis_2,
-				   strlen (first->axis_2), SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (first->orientation_2 == NULL)
-	      sqlite3_bind_null (stmt_aux, 11);
-	  else
-	    {
-		sqlite3_bind_text (stmt_aux, 11, first->orientation_2,
-				   strlen (first->orientation_2),
-				   SQLITE_STATIC);
-		ok_aux = 1;
-	    }
-	  if (ok_aux)
-	    {
-		ret = sqlite3_step (stmt_aux);
-		if (ret == SQLITE_DONE || ret == SQLITE_ROW)
-		    ;
-		else
-		  {
-		      spatialite_e ("%s\n", sqlite3_errmsg (handle));
-		      goto stop;
-		  }
-	    }
-      }
-/* end Mark Johnson 2019-01-27 */
-  stop:
-    if (stmt != NULL)
-	sqlite3_finalize (stmt);
+    if (!prepare_epsg_insert (handle, metadata, &stmt, &stmt_aux))
+	return 0;
+    ok = insert_epsg_def (handle, stmt, stmt_aux, metadata, p);
+    sqlite3_finalize (stmt);
     if (stmt_aux != NULL)
 	sqlite3_finalize (stmt_aux);
-
-/* freeing the EPSG defs list */
-    free_epsg (first);
-    if (error)
-	return 0;
-    return 1;
+    return ok;
 }
@@ -65,6 +65,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
 
 #ifdef _WIN32
 #define strcasecmp	_stricmp
+#define strncasecmp	_strnicmp
 #endif /* not WIN32 */
 
 /* 64 bit integer: portable format for printf() */
@@ -325,29 +326,6 @@ free_var_list (struct sp_var_list *list)
     free (list);
 }
 
-static void
-add_variable_ex (struct sp_var_list *list, char *varname, short ref_count)
-{
-/* adding a Variable to the List */
-    struct sp_var_item *item;
-
-    if (list == NULL)
-	return;
-    if (varname == NULL)
-	return;
-
-/* inserting a new variable */
-    item = malloc (sizeof (struct sp_var_item));
-    item->varname = varname;
-    item->count = ref_count;
-    item->next = NULL;
-    if (list->first == NULL)
-	list->first = item;
-    if (list->last != NULL)
-	list->last->next = item;
-    list->last = item;
-}
-
 #ifndef OMIT_ICONV		/* ICONV is supported */
 
 static void
@@ -879,44 +857,6 @@ gaia_sql_proc_raw_sql (const unsigned char *blob, int blob_sz)
     return sql;
 }
 
-static struct sp_var_list *
-build_var_list (const unsigned char *blob, int blob_sz)
-{
-/* building a list of Variables with Values and reference count */
-    const unsigned char *p_out = blob;
-    int endian;
-    int endian_arch = gaiaEndianArch ();
-    short size;
-    short ref_count;
-    short num_vars;
-    short i_vars;
-    char *varname;
-    struct sp_var_list *list = NULL;
-    if (!gaia_sql_proc_is_valid (blob, blob_sz))
-	return NULL;
-
-    list = alloc_var_list ();
-    p_out += 2;
-    endian = *p_out++;
-    p_out++;
-    num_vars = gaiaImport16 (p_out, endian, endian_arch);	/* Variables Count */
-    p_out += 3;
-    for (i_vars = 0; i_vars < num_vars; i_vars++)
-      {
-	  size = gaiaImport16 (p_out, endian, endian_arch);	/* Variable Name Length */
-	  p_out += 3;
-	  varname = malloc (size + 1);
-	  memcpy (varname, p_out, size);
-	  *(varname + size) = '\0';
-	  p_out += size;	/* skipping the variable name */
-	  p_out++;
-	  ref_count = gaiaImport16 (p_out, endian, endian_arch);	/* Variable reference count */
-	  p_out += 3;		/* skipping the reference count */
-	  add_variable_ex (list, varname, ref_count);
-      }
-    return list;
-}
-
 static const char *
 search_replacement_value (SqlProc_VarListPtr variables, const char *varname)
 {
@@ -971,41 +911,94 @@ search_stored_var (sqlite3 * handle, const char *varname)
     return var_with_value;
 }
 
+struct sp_compiled_segment
+{
+/* a compiled SQL Body segment: a literal text chunk optionally followed by a Variable */
+    int text_len;
+    int var_index;
+};
+
+struct sp_compiled_sql
+{
+/* a compiled SQL Body (literal text and Variable references) */
+    char *text;
+    int text_len;
+    int n_segments;
+    struct sp_compiled_segment *segments;
+    int n_vars;
+    char **varnames;
+};
+
+static void
+free_compiled_sql (struct sp_compiled_sql *compiled)
+{
+/* memory cleanup - destroying a compiled SQL Body */
+    int i;
+    if (compiled == NULL)
+	return;
+    if (compiled->text != NULL)
+	free (compiled->text);
+    if (compiled->segments != NULL)
+	free (compiled->segments);
+    for (i = 0; i < compiled->n_vars; i++)
+	free (*(compiled->varnames + i));
+    if (compiled->varnames != NULL)
+	free (compiled->varnames);
+    free (compiled);
+}
+
 static int
-get_value_length (sqlite3 * handle, SqlProc_VarListPtr variables,
-		  const char *varname)
+compiled_var_index (struct sp_compiled_sql *compiled, const char *raw,
+		    int start, int end)
 {
-/* retieving a Variable replacement Value length */
-    char *stored_var;
-    SqlProc_VariablePtr var = variables->First;
-    while (var != NULL)
-      {
-	  if (strcasecmp (var->Name, varname) == 0)
-	    {
-		/* found a replacement value */
-		return strlen (var->Value);
-	    }
-	  var = var->Next;
-      }
+/* returning the index of some Variable, adding it if not already defined */
+    int i;
+    int sz = end - start;
+    char *varname;
+    for (i = 0; i < compiled->n_vars; i++)
+      {
+	  const char *name = *(compiled->varnames + i);
+	  if ((int) strlen (name) == sz
+	      && strncasecmp (name, raw + start, sz) == 0)
+	      return i;
+      }
+    varname = malloc (sz + 1);
+    memcpy (varname, raw + start, sz);
+    *(varname + sz) = '\0';
+    compiled->varnames =
+	realloc (compiled->varnames, sizeof (char *) * (compiled->n_vars + 1));
+    *(compiled->varnames + compiled->n_vars) = varname;
+    compiled->n_vars += 1;
+    return compiled->n_vars - 1;
+}
 
-/* attempting to get a Stored Variable */
-    stored_var = search_stored_var (handle, varname);
-    if (stored_var != NULL)
-      {
-	  int len = strlen (stored_var);
-	  sqlite3_free (stored_var);
-	  return len;
-      }
-    return 4;			/* undefined; defaults to NULL */
+static void
+compiled_add_segment (struct sp_compiled_sql *compiled, int *max_segments,
+		      int text_len, int var_index)
+{
+/* appending a further segment to a compiled SQL Body */
+    struct sp_compiled_segment *seg;
+    if (compiled->n_segments >= *max_segments)
+      {
+	  *max_segments = (*max_segments == 0) ? 16 : *max_segments * 2;
+	  compiled->segments =
+	      realloc (compiled->segments,
+		       sizeof (struct sp_compiled_segment) * *max_segments);
+      }
+    seg = compiled->segments + compiled->n_segments;
+    seg->text_len = text_len;
+    seg->var_index = var_index;
+    compiled->n_segments += 1;
 }
 
-SQLPROC_DECLARE int
-gaia_sql_proc_cooked_sql (sqlite3 * handle, const void *cache,
-			  const unsigned char *blob, int blob_sz,
-			  SqlProc_VarListPtr variables, char **sql)
+static struct sp_compiled_sql *
+compile_raw_sql (const char *raw, int len)
 {
-/* return the cooked SQL body from a raw SQL body by replacing Variable Values */
-    int len;
+/* 
+/ compiling a Raw SQL body into a sequence of literal text chunks
+/ and Variable references, so that any further cooking will simply
+/ require to splice the current Variable Values
+*/
     int i;
     int start_line;
     int macro;
@@ -1013,59 +1006,18 @@ gaia_sql_proc_cooked_sql (sqlite3 * handle, const void *cache,
     int variable;
     char varMark;
     int varStart;
-    char *raw = NULL;
-    char *cooked = NULL;
     char *p_out;
-    int buf_size;
-    struct sp_var_list *list = NULL;
-    struct sp_var_item *item;
-    stored_proc_reset_error (cache);
-
-    *sql = NULL;
-    if (variables == NULL)
-      {
-	  const char *errmsg = "NULL Variables List (Arguments)\n";
-	  gaia_sql_proc_set_error (cache, errmsg);
-	  goto err;
-      }
-
-/* retrieving the Raw SQL Body */
-    raw = gaia_sql_proc_raw_sql (blob, blob_sz);
-    if (raw == NULL)
-      {
-	  const char *errmsg = "NULL Raw SQL body\n";
-	  gaia_sql_proc_set_error (cache, errmsg);
-	  goto err;
-      }
-    len = strlen (raw);
-    if (len == 0)
-      {
-	  const char *errmsg = "Empty Raw SQL body\n";
-	  gaia_sql_proc_set_error (cache, errmsg);
-	  goto err;
-      }
-
-/* building the Variables List from the BLOB */
-    list = build_var_list (blob, blob_sz);
-    if (list == NULL)
-      {
-	  const char *errmsg = "NULL Variables List (Raw SQL)\n";
-	  gaia_sql_proc_set_error (cache, errmsg);
-	  goto err;
-      }
-
-/* allocating the Cooked buffer */
-    buf_size = strlen (raw);
-    item = list->first;
-    while (item != NULL)
-      {
-	  int value_len = get_value_length (handle, variables, item->varname);
-	  buf_size -= (strlen (item->varname) + 2) * item->count;
-	  buf_size += value_len * item->count;
-	  item = item->next;
-      }
-    cooked = malloc (buf_size + 1);
-    p_out = cooked;
+    int seg_start;
+    int max_segments = 0;
+    struct sp_compiled_sql *compiled = malloc (sizeof (struct sp_compiled_sql));
+    compiled->text = malloc (len + 1);
+    compiled->text_len = 0;
+    compiled->n_segments = 0;
+    compiled->segments = NULL;
+    compiled->n_vars = 0;
+    compiled->varnames = NULL;
+    p_out = compiled->text;
+    seg_start = 0;
 
 /* parsing the Raw SQL body */
     start_line = 1;
@@ -1111,30 +1063,12 @@ gaia_sql_proc_cooked_sql (sqlite3 * handle, const void *cache,
 		if (variable && raw[i] == varMark)
 		  {
 		      /* a variable name ends here */
-		      int sz = i - varStart;
-		      int j;
-		      int k;
-		      char *stored_var = NULL;
-		      const char *replacement_value;
-		      char *varname = malloc (sz);
-		      for (k = 0, j = varStart + 1; j < i; j++, k++)
-			  *(varname + k) = raw[j];
-		      *(varname + k) = '\0';
-		      replacement_value =
-			  search_replacement_value (variables, varname);
-		      if (replacement_value == NULL)
-			{
-			    /* attempting to get a Stored Variable */
-			    stored_var = search_stored_var (handle, varname);
-			    replacement_value = stored_var;
-			}
-		      free (varname);
-		      if (replacement_value == NULL)
-			  replacement_value = "NULL";
-		      for (k = 0; k < (int) strlen (replacement_value); k++)
-			  *p_out++ = replacement_value[k];
-		      if (stored_var != NULL)
-			  sqlite3_free (stored_var);
+		      int out_len = p_out - compiled->text;
+		      int var_index =
+			  compiled_var_index (compiled, raw, varStart + 1, i);
+		      compiled_add_segment (compiled, &max_segments,
+					    out_len - seg_start, var_index);
+		      seg_start = out_len;
 		      variable = 0;
 		  }
 		else
@@ -1150,19 +1084,308 @@ gaia_sql_proc_cooked_sql (sqlite3 * handle, const void *cache,
 	      *p_out++ = raw[i];
       }
     *p_out = '\0';
+    compiled->text_len = p_out - compiled->text;
+    if (compiled->text_len > seg_start)
+	compiled_add_segment (compiled, &max_segments,
+			      compiled->text_len - seg_start, -1);
+    return compiled;
+}
 
-    free (raw);
-    free_var_list (list);
+SPATIALITE_PRIVATE void
+free_internal_cache_sqlproc (struct splite_sqlproc_cache_item *item)
+{
+/* freeing an SQL Procedures cache item */
+    if (item == NULL)
+	return;
+    if (item->blob != NULL)
+	free (item->blob);
+    free_compiled_sql ((struct sp_compiled_sql *) (item->compiled));
+    if (item->stats != NULL)
+	free (item->stats);
+    item->last_access = 0;
+    item->blob = NULL;
+    item->blob_sz = 0;
+    item->compiled = NULL;
+    item->executions = 0;
+    item->n_stats = 0;
+    item->stats = NULL;
+}
+
+static struct sp_compiled_sql *
+sqlproc_cache_find (struct splite_internal_cache *cache,
+		    const unsigned char *blob, int blob_sz)
+{
+/* attempting to retrieve an already compiled SQL Body from within the Cache */
+    int i;
+    struct splite_sqlproc_cache_item *p;
+    if (cache == NULL)
+	return NULL;
+    for (i = 0; i < MAX_SQLPROC_CACHE; i++)
+      {
+	  p = &(cache->sqlProcCache[i]);
+	  if (p->blob != NULL && p->blob_sz == blob_sz
+	      && memcmp (p->blob, blob, blob_sz) == 0)
+	    {
+		/* found a matching cache-item */
+		p->last_access = ++(cache->sqlProcCacheClock);
+		cache->sqlProcCacheActive = i;
+		return (struct sp_compiled_sql *) (p->compiled);
+	    }
+      }
+    return NULL;
+}
+
+static int
+sqlproc_cache_insert (struct splite_internal_cache *cache,
+		      const unsigned char *blob, int blob_sz,
+		      struct sp_compiled_sql *compiled)
+{
+/* inserting a compiled SQL Body into the Cache */
+    int i;
+    int iSlot = 0;
+    sqlite3_int64 oldest;
+    struct splite_sqlproc_cache_item *pSlot;
+    struct splite_sqlproc_cache_item *p;
+    if (cache == NULL)
+	return 0;
+    oldest = cache->sqlProcCacheClock + 1;
+    for (i = 0; i < MAX_SQLPROC_CACHE; i++)
+      {
+	  p = &(cache->sqlProcCache[i]);
+	  if (p->blob == NULL)
+	    {
+		/* found an empty slot */
+		iSlot = i;
+		break;
+	    }
+	  if (p->last_access < oldest)
+	    {
+		/* saving the least recently used slot */
+		iSlot = i;
+		oldest = p->last_access;
+	    }
+      }
+    pSlot = &(cache->sqlProcCache[iSlot]);
+/* inserting into the Cache Slot */
+    free_internal_cache_sqlproc (pSlot);
+    pSlot->last_access = ++(cache->sqlProcCacheClock);
+    pSlot->blob = malloc (blob_sz);
+    memcpy (pSlot->blob, blob, blob_sz);
+    pSlot->blob_sz = blob_sz;
+    pSlot->compiled = compiled;
+    cache->sqlProcCacheActive = iSlot;
+    return 1;
+}
+
+static void
+sqlproc_cache_add_stats (struct splite_internal_cache *cache, int index,
+			 double seconds)
+{
+/* updating the statistics of the Nth statement of the active cache-item */
+    struct splite_sqlproc_cache_item *p;
+    if (cache == NULL)
+	return;
+    if (cache->sqlProcCacheActive < 0)
+	return;
+    p = &(cache->sqlProcCache[cache->sqlProcCacheActive]);
+    if (index >= p->n_stats)
+      {
+	  /* growing the statistics array */
+	  int i;
+	  struct splite_sqlproc_stmt_stats *stats =
+	      realloc (p->stats,
+		       sizeof (struct splite_sqlproc_stmt_stats) * (index + 1));
+	  if (stats == NULL)
+	      return;
+	  for (i = p->n_stats; i <= index; i++)
+	    {
+		(stats + i)->count = 0;
+		(stats + i)->seconds = 0.0;
+	    }
+	  p->stats = stats;
+	  p->n_stats = index + 1;
+      }
+    (p->stats + index)->count += 1;
+    (p->stats + index)->seconds += seconds;
+}
+
+SQLPROC_DECLARE int
+gaia_sql_proc_cache_stats (const void *ctx, const unsigned char *blob,
+			   int blob_sz, int statement,
+			   sqlite3_int64 * executions, int *statements,
+			   double *seconds)
+{
+/* retrieving the execution statistics of a cached SQL Body */
+    int i;
+    int j;
+    struct splite_sqlproc_cache_item *p;
+    struct splite_internal_cache *cache = (struct splite_internal_cache *) ctx;
+    *executions = 0;
+    *statements = 0;
+    *seconds = 0.0;
+    if (cache == NULL)
+	return 0;
+    if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
+	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
+	return 0;
+    for (i = 0; i < MAX_SQLPROC_CACHE; i++)
+      {
+	  p = &(cache->sqlProcCache[i]);
+	  if (p->blob != NULL && p->blob_sz == blob_sz
+	      && memcmp (p->blob, blob, blob_sz) == 0)
+	    {
+		/* found a matching cache-item */
+		*statements = p->n_stats;
+		if (statement <= 0)
+		  {
+		      /* the whole SQL Body */
+		      *executions = p->executions;
+		      for (j = 0; j < p->n_stats; j++)
+			  *seconds += (p->stats + j)->seconds;
+		      return 1;
+		  }
+		if (statement > p->n_stats)
+		    return 0;
+		*executions = (p->stats + statement - 1)->count;
+		*seconds = (p->stats + statement - 1)->seconds;
+		return 1;
+	    }
+      }
+    return 0;
+}
+
+SQLPROC_DECLARE int
+gaia_sql_proc_cooked_sql (sqlite3 * handle, const void *ctx,
+			  const unsigned char *blob, int blob_sz,
+			  SqlProc_VarListPtr variables, char **sql)
+{
+/* return the cooked SQL body from a raw SQL body by replacing Variable Values */
+    int len;
+    int i;
+    char *raw = NULL;
+    char *cooked = NULL;
+    char *p_out;
+    const char *p_in;
+    int buf_size;
+    struct sp_compiled_sql *compiled = NULL;
+    int cached = 0;
+    char **values = NULL;
+    char **stored_vars = NULL;
+    struct splite_internal_cache *cache = (struct splite_internal_cache *) ctx;
+    if (cache != NULL)
+      {
+	  if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
+	      || cache->magic2 != SPATIALITE_CACHE_MAGIC2)
+	      cache = NULL;
+      }
+    stored_proc_reset_error (ctx);
+    if (cache != NULL)
+	cache->sqlProcCacheActive = -1;
+
+    *sql = NULL;
+    if (variables == NULL)
+      {
+	  const char *errmsg = "NULL Variables List (Arguments)\n";
+	  gaia_sql_proc_set_error (ctx, errmsg);
+	  goto err;
+      }
+
+/* searching an already compiled SQL Body */
+    compiled = sqlproc_cache_find (cache, blob, blob_sz);
+    if (compiled != NULL)
+	cached = 1;
+    else
+      {
+	  /* retrieving the Raw SQL Body */
+	  raw = gaia_sql_proc_raw_sql (blob, blob_sz);
+	  if (raw == NULL)
+	    {
+		const char *errmsg = "NULL Raw SQL body\n";
+		gaia_sql_proc_set_error (ctx, errmsg);
+		goto err;
+	    }
+	  len = strlen (raw);
+	  if (len == 0)
+	    {
+		const char *errmsg = "Empty Raw SQL body\n";
+		gaia_sql_proc_set_error (ctx, errmsg);
+		goto err;
+	    }
+
+	  /* compiling the Raw SQL Body */
+	  compiled = compile_raw_sql (raw, len);
+	  free (raw);
+	  raw = NULL;
+	  cached = sqlproc_cache_insert (cache, blob, blob_sz, compiled);
+      }
+
+/* resolving each Variable Value just once */
+    buf_size = compiled->text_len;
+    if (compiled->n_vars > 0)
+      {
+	  values = malloc (sizeof (char *) * compiled->n_vars);
+	  stored_vars = malloc (sizeof (char *) * compiled->n_vars);
+      }
+    for (i = 0; i < compiled->n_vars; i++)
+      {
+	  const char *varname = *(compiled->varnames + i);
+	  const char *replacement_value =
+	      search_replacement_value (variables, varname);
+	  *(stored_vars + i) = NULL;
+	  if (replacement_value == NULL)
+	    {
+		/* attempting to get a Stored Variable */
+		*(stored_vars + i) = search_stored_var (handle, varname);
+		replacement_value = *(stored_vars + i);
+	    }
+	  if (replacement_value == NULL)
+	      replacement_value = "NULL";
+	  *(values + i) = (char *) replacement_value;
+      }
+    for (i = 0; i < compiled->n_segments; i++)
+      {
+	  struct sp_compiled_segment *seg = compiled->segments + i;
+	  if (seg->var_index >= 0)
+	      buf_size += strlen (*(values + seg->var_index));
+      }
+
+/* splicing literal text chunks and Variable Values */
+    cooked = malloc (buf_size + 1);
+    p_out = cooked;
+    p_in = compiled->text;
+    for (i = 0; i < compiled->n_segments; i++)
+      {
+	  struct sp_compiled_segment *seg = compiled->segments + i;
+	  memcpy (p_out, p_in, seg->text_len);
+	  p_out += seg->text_len;
+	  p_in += seg->text_len;
+	  if (seg->var_index >= 0)
+	    {
+		const char *value = *(values + seg->var_index);
+		int value_len = strlen (value);
+		memcpy (p_out, value, value_len);
+		p_out += value_len;
+	    }
+      }
+    *p_out = '\0';
+
+    for (i = 0; i < compiled->n_vars; i++)
+      {
+	  if (*(stored_vars + i) != NULL)
+	      sqlite3_free (*(stored_vars + i));
+      }
+    if (values != NULL)
+	free (values);
+    if (stored_vars != NULL)
+	free (stored_vars);
+    if (!cached)
+	free_compiled_sql (compiled);
     *sql = cooked;
     return 1;
 
   err:
     if (raw != NULL)
 	free (raw);
-    if (cooked != NULL)
-	free (cooked);
-    if (list != NULL)
-	free_var_list (list);
     return 0;
 }
 
@@ -2160,6 +2383,12 @@ gaia_sql_proc_execute (sqlite3 * main_handle, const void *ctx, const char *sql)
     if (!do_attach_all (main_handle, handle))
 	return 0;
 
+    if (main_cache != NULL && main_cache->sqlProcCacheActive >= 0)
+      {
+	  /* counting one more execution of the cached SQL Body */
+	  main_cache->sqlProcCache[main_cache->sqlProcCacheActive].
+	      executions += 1;
+      }
     if (cache != NULL)
       {
 	  gaia_sql_proc_logfile (cache, main_cache->SqlProcLogfile,
@@ -2357,6 +2586,7 @@ gaia_sql_proc_execute (sqlite3 * main_handle, const void *ctx, const char *sql)
 	  clock_end = clock ();
 	  seconds =
 	      (double) (clock_end - clock_start) / (double) CLOCKS_PER_SEC;
+	  sqlproc_cache_add_stats (main_cache, n_stmts - 1, seconds);
 	  if (log != NULL)
 	    {
 		if (rs)
@@ -2386,6 +2616,8 @@ gaia_sql_proc_execute (sqlite3 * main_handle, const void *ctx, const char *sql)
 		   "--=========================================================================================\n\n\n");
 	  fflush (log);
       }
+    if (main_cache != NULL)
+	main_cache->sqlProcCacheActive = -1;
 /* updating the actual MEMORY DB (if any) */
     do_clone_memory_db (main_handle, handle, "main");
 
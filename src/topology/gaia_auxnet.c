@@ -1319,7 +1319,7 @@ gaiaNetworkFromDBMS (sqlite3 * handle, const void *p_cache,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
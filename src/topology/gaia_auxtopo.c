@@ -2254,7 +2254,7 @@ gaiaTopologyFromDBMS (sqlite3 * handle, const void *p_cache,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2669,7 +2669,7 @@ gaiaAddIsoNode (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2714,7 +2714,7 @@ gaiaMoveIsoNode (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2782,7 +2782,7 @@ gaiaAddIsoEdge (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2842,7 +2842,7 @@ gaiaChangeEdgeGeom (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -3187,7 +3187,7 @@ gaiaModEdgeSplit (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -3236,7 +3236,7 @@ gaiaNewEdgesSplit (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -3279,7 +3279,7 @@ gaiaAddEdgeModFace (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -3315,7 +3315,7 @@ gaiaAddEdgeNewFaces (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -3459,7 +3459,7 @@ gaiaGetFaceGeometry (GaiaTopologyAccessorPtr accessor, sqlite3_int64 face)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -3751,7 +3751,7 @@ gaiaGetFaceEdges (GaiaTopologyAccessorPtr accessor, sqlite3_int64 face)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5222,7 +5222,7 @@ gaiaGetNodeByPoint (GaiaTopologyAccessorPtr accessor, gaiaPointPtr pt,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5270,7 +5270,7 @@ gaiaGetEdgeByPoint (GaiaTopologyAccessorPtr accessor, gaiaPointPtr pt,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5318,7 +5318,7 @@ gaiaGetFaceByPoint (GaiaTopologyAccessorPtr accessor, gaiaPointPtr pt,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5366,7 +5366,7 @@ gaiaTopoGeo_AddPoint (GaiaTopologyAccessorPtr accessor, gaiaPointPtr pt,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5417,7 +5417,7 @@ gaiaTopoGeo_AddLineString (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5472,7 +5472,7 @@ gaiaTopoGeo_AddLineStringNoFace (GaiaTopologyAccessorPtr accessor,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5517,7 +5517,7 @@ gaiaTopoGeo_Polygonize (GaiaTopologyAccessorPtr accessor)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5547,7 +5547,7 @@ gaiaTopoSnap (GaiaTopologyAccessorPtr accessor, gaiaGeomCollPtr geom,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
     if (!geom)
@@ -5598,7 +5598,7 @@ gaiaTopoGeo_AddPolygon (GaiaTopologyAccessorPtr accessor, gaiaPolygonPtr pg,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2336,7 +2336,7 @@ netcallback_netGetGEOS (const LWN_BE_NETWORK * lwn_net)
 	return NULL;
 
     cache = (const struct splite_internal_cache *) (accessor->cache);
-    return cache->GEOS_handle;
+    return splite_get_geos_handle (cache);
 }
 
 #endif /* end RTTOPO conditionals */
@@ -1541,7 +1541,7 @@ callback_getNodeById (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -1663,7 +1663,7 @@ callback_getNodeWithinDistance2D (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -1843,7 +1843,7 @@ callback_insertNodes (const RTT_BE_TOPOLOGY * rtt_topo, RTT_ISO_NODE * nodes,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -1942,7 +1942,7 @@ callback_getEdgeById (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2067,7 +2067,7 @@ callback_getEdgeWithinDistance2D (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2077,7 +2077,7 @@ callback_getEdgeWithinDistance2D (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -2251,7 +2251,7 @@ callback_getNextEdgeId (const RTT_BE_TOPOLOGY * rtt_topo)
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return -1;
 
@@ -2336,7 +2336,7 @@ callback_insertEdges (const RTT_BE_TOPOLOGY * rtt_topo, RTT_ISO_EDGE * edges,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2433,7 +2433,7 @@ callback_updateEdges (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -2979,7 +2979,7 @@ callback_getFaceById (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -3132,7 +3132,7 @@ callback_getFaceContainingPoint (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return -1;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return -1;
 
@@ -3473,7 +3473,7 @@ callback_getNodeWithinBox2D (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -3653,7 +3653,7 @@ callback_getEdgeWithinBox2D (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -3832,7 +3832,7 @@ callback_getAllEdges (const RTT_BE_TOPOLOGY * rtt_topo, int *numelems,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -3998,7 +3998,7 @@ callback_getEdgeByNode (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -4206,7 +4206,7 @@ callback_updateNodes (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -4703,7 +4703,7 @@ callback_getRingEdges (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -4813,7 +4813,7 @@ callback_updateEdgesById (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5040,7 +5040,7 @@ callback_getEdgeByFace (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -5260,7 +5260,7 @@ callback_getNodeByFace (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -5428,7 +5428,7 @@ callback_updateNodesById (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return 0;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return 0;
 
@@ -5602,7 +5602,7 @@ callback_getFaceWithinBox2D (const RTT_BE_TOPOLOGY * rtt_topo,
     if (cache->magic1 != SPATIALITE_CACHE_MAGIC1
 	|| cache->magic2 != SPATIALITE_CACHE_MAGIC2)
 	return NULL;
-    ctx = cache->RTTOPO_handle;
+    ctx = splite_get_rttopo_handle (cache);
     if (ctx == NULL)
 	return NULL;
 
@@ -76,10 +76,14 @@ Regione Toscana - Settore Sistema Informativo Territoriale ed Ambientale
 #ifdef ENABLE_LIBXML2		/* LIBXML2 enabled: supporting XML documents */
 
 #include <libxml/parser.h>
+#include <libxml/xmlreader.h>
 #include <libxml/nanohttp.h>
 
 #define MAX_GTYPES	28
 
+/* max number of WFS pages concurrently fetched */
+#define WFS_MAX_THREADS	16
+
 #ifdef _WIN32
 #define atoll	_atoi64
 #endif /* not WIN32 */
@@ -195,6 +199,36 @@ struct wfs_feature
     struct wfs_geometry *last_geo;
 };
 
+struct wfs_page_job
+{
+/* a WFS page being fetched and parsed by a worker thread */
+    char *url;
+    struct wfs_layer_schema *schema;	/* private copy of the layer schema */
+    struct wfs_feature **features;
+    int count;
+    int max;
+    int error;
+    char *err_msg;
+};
+
+struct wfs_page_batch
+{
+/* a batch of consecutive WFS pages */
+    int num_jobs;
+    struct wfs_page_job jobs[WFS_MAX_THREADS];
+    void *threads[WFS_MAX_THREADS];	/* NULL if not running */
+};
+
+struct wfs_stream
+{
+/* a GML payload being parsed one feature at a time */
+    xmlTextReaderPtr reader;
+    int is_wfs;			/* the root element is a FeatureCollection */
+    char *schema_location;	/* the root "schemaLocation" attribute */
+    int skip;			/* the current feature has been consumed */
+    int error;			/* a parsing error occurred */
+};
+
 static struct wfs_column_def *
 alloc_wfs_column (const char *name, int type, int is_nullable)
 {
@@ -929,85 +963,48 @@ wfsParsingError (void *ctx, const char *msg, ...)
 }
 
 static int
-find_describe_uri (xmlNodePtr node, char **describe_uri)
+find_describe_uri (const char *schema_location, char **describe_uri)
 {
 /* parsing the "schemaLocation" string */
-    if (node != NULL)
+    if (schema_location != NULL)
       {
-	  if (node->type == XML_TEXT_NODE)
+	  char *p_base;
+	  int len = strlen (schema_location);
+	  char *string = malloc (len + 1);
+	  strcpy (string, schema_location);
+	  p_base = string;
+	  while (1)
 	    {
-		char *p_base;
-		int len = strlen ((const char *) (node->content));
-		char *string = malloc (len + 1);
-		strcpy (string, (char *) (node->content));
-		p_base = string;
+		char *p = p_base;
 		while (1)
 		  {
-		      char *p = p_base;
-		      while (1)
+		      if (*p == ' ' || *p == '\0')
 			{
-			    if (*p == ' ' || *p == '\0')
+			    int next = 1;
+			    if (*p == '\0')
+				next = 0;
+			    *p = '\0';
+			    if (strstr (p_base, "DescribeFeatureType") != NULL)
 			      {
-				  int next = 1;
-				  if (*p == '\0')
-				      next = 0;
-				  *p = '\0';
-				  if (strstr (p_base, "DescribeFeatureType") !=
-				      NULL)
-				    {
-					len = strlen (p_base);
-					*describe_uri = malloc (len + 1);
-					strcpy (*describe_uri, p_base);
-					free (string);
-					return 1;
-				    }
-				  if (next)
-				      p_base = p + 1;
-				  else
-				      p_base = p;
-				  break;
+				  len = strlen (p_base);
+				  *describe_uri = malloc (len + 1);
+				  strcpy (*describe_uri, p_base);
+				  free (string);
+				  return 1;
 			      }
-			    p++;
+			    if (next)
+				p_base = p + 1;
+			    else
+				p_base = p;
+			    break;
 			}
-		      if (*p_base == '\0')
-			  break;
+		      p++;
 		  }
-		free (string);
-	    }
-      }
-    return 0;
-}
-
-static int
-get_DescribeFeatureType_uri (xmlDocPtr xml_doc, char **describe_uri)
-{
-/*
-/ attempting to retrieve the URI identifying the DescribeFeatureType service
-*/
-    const char *name;
-    xmlNodePtr root = xmlDocGetRootElement (xml_doc);
-    struct _xmlAttr *attr;
-    if (root == NULL)
-	return 0;
-
-    name = (const char *) (root->name);
-    if (name != NULL)
-      {
-	  if (strcmp (name, "FeatureCollection") != 0)
-	      return 0;		/* for sure, it's not a WFS answer */
-      }
-
-    attr = root->properties;
-    while (attr != NULL)
-      {
-	  if (attr->name != NULL)
-	    {
-		if (strcmp ((const char *) (attr->name), "schemaLocation") == 0)
-		    return find_describe_uri (attr->children, describe_uri);
+		if (*p_base == '\0')
+		    break;
 	    }
-	  attr = attr->next;
+	  free (string);
       }
-
     return 0;
 }
 
@@ -2007,71 +2004,139 @@ do_save_feature (struct wfs_layer_schema *schema, struct wfs_feature *feature)
 }
 
 static void
-parse_wfs_features (xmlNodePtr node, struct wfs_layer_schema *schema, int *rows,
-		    char **err_msg)
+wfs_stream_close (struct wfs_stream *stream)
 {
-/* recursively parsing the GML payload */
-    xmlNodePtr cur_node = NULL;
+/* memory cleanup: destroying a streaming parser */
+    if (stream->reader != NULL)
+	xmlFreeTextReader (stream->reader);
+    if (stream->schema_location != NULL)
+	free (stream->schema_location);
+    stream->reader = NULL;
+    stream->schema_location = NULL;
+}
 
-    for (cur_node = node; cur_node; cur_node = cur_node->next)
+static int
+wfs_stream_open (const char *path_or_url, struct wfs_stream *stream)
+{
+/* opening a streaming parser positioned on the root element */
+    const char *name;
+    int len;
+    stream->reader = NULL;
+    stream->is_wfs = 0;
+    stream->schema_location = NULL;
+    stream->skip = 0;
+    stream->error = 0;
+
+    stream->reader = xmlReaderForFile (path_or_url, NULL, 0);
+    if (stream->reader == NULL)
+	return 0;
+    while (1)
       {
-	  if (cur_node->type == XML_ELEMENT_NODE)
+	  if (xmlTextReaderRead (stream->reader) != 1)
 	    {
-		char *entity_name;
-		if (cur_node->ns != NULL)
-		    entity_name =
-			sqlite3_mprintf ("%s:%s", cur_node->ns->prefix,
-					 cur_node->name);
-		else
-		    entity_name = sqlite3_mprintf ("%s", cur_node->name);
-		if (strcmp (schema->layer_name, entity_name) == 0
-		    || strcmp (schema->layer_name,
-			       (const char *) (cur_node->name)) == 0)
+		/* empty or not well-formed XML */
+		wfs_stream_close (stream);
+		return 0;
+	    }
+	  if (xmlTextReaderNodeType (stream->reader) ==
+	      XML_READER_TYPE_ELEMENT)
+	      break;
+      }
+
+    name = (const char *) xmlTextReaderConstLocalName (stream->reader);
+    if (name != NULL && strcmp (name, "FeatureCollection") == 0)
+	stream->is_wfs = 1;
+    while (xmlTextReaderMoveToNextAttribute (stream->reader) == 1)
+      {
+	  name = (const char *) xmlTextReaderConstLocalName (stream->reader);
+	  if (name != NULL && strcmp (name, "schemaLocation") == 0)
+	    {
+		const char *value =
+		    (const char *) xmlTextReaderConstValue (stream->reader);
+		if (value != NULL)
 		  {
-		      if (parse_wfs_single_feature (cur_node->children, schema))
-			{
-			    if (schema->error == 0)
-			      {
-				  if (do_insert (schema, err_msg))
-				      *rows += 1;
-			      }
-			}
+		      len = strlen (value);
+		      stream->schema_location = malloc (len + 1);
+		      strcpy (stream->schema_location, value);
 		  }
-		else
-		    parse_wfs_features (cur_node->children, schema, rows,
-					err_msg);
-		sqlite3_free (entity_name);
+		break;
 	    }
       }
+    xmlTextReaderMoveToElement (stream->reader);
+    return 1;
 }
 
-static void
-parse_wfs_last_feature (xmlNodePtr node, struct wfs_layer_schema *schema,
-			struct wfs_feature *feature, int *rows)
+static xmlNodePtr
+wfs_stream_next_feature (struct wfs_stream *stream, const char *layer_name)
 {
-/* recursively parsing the GML payload */
-    xmlNodePtr cur_node = NULL;
+/*
+/ advancing to the next feature; only the subtree of the current
+/ feature is ever expanded, and it will be released as soon as
+/ the parser moves on
+*/
+    const char *qname;
+    const char *name;
+    xmlNodePtr node;
+    int ret;
 
-    for (cur_node = node; cur_node; cur_node = cur_node->next)
+    if (stream->reader == NULL)
+	return NULL;
+    while (1)
       {
-	  if (cur_node->type == XML_ELEMENT_NODE)
+	  if (stream->skip)
+	      ret = xmlTextReaderNext (stream->reader);
+	  else
+	      ret = xmlTextReaderRead (stream->reader);
+	  stream->skip = 0;
+	  if (ret != 1)
+	    {
+		if (ret < 0)
+		    stream->error = 1;
+		return NULL;
+	    }
+	  if (xmlTextReaderNodeType (stream->reader) != XML_READER_TYPE_ELEMENT)
+	      continue;
+	  qname = (const char *) xmlTextReaderConstName (stream->reader);
+	  name = (const char *) xmlTextReaderConstLocalName (stream->reader);
+	  if ((qname != NULL && strcmp (layer_name, qname) == 0)
+	      || (name != NULL && strcmp (layer_name, name) == 0))
 	    {
-		if (parse_wfs_single_feature (cur_node, schema))
+		node = xmlTextReaderExpand (stream->reader);
+		if (node == NULL)
 		  {
-		      if (schema->error == 0)
-			{
-			    if (do_save_feature (schema, feature))
-				*rows += 1;
-			}
-		      return;
+		      stream->error = 1;
+		      return NULL;
 		  }
-		else
-		    parse_wfs_last_feature (cur_node->children, schema, feature,
-					    rows);
+		stream->skip = 1;
+		return node;
 	    }
       }
 }
 
+static int
+load_wfs_single_feature (const char *path_or_url,
+			 struct wfs_layer_schema *schema,
+			 struct wfs_feature *feature)
+{
+/* loading the first feature from some WFS payload */
+    struct wfs_stream stream;
+    xmlNodePtr node;
+
+    if (!wfs_stream_open (path_or_url, &stream))
+	return 0;
+    node = wfs_stream_next_feature (&stream, schema->layer_name);
+    if (node != NULL)
+      {
+	  if (parse_wfs_single_feature (node->children, schema))
+	    {
+		if (schema->error == 0)
+		    do_save_feature (schema, feature);
+	    }
+      }
+    wfs_stream_close (&stream);
+    return 1;
+}
+
 static int
 sniff_feature_value (xmlNodePtr node, struct wfs_layer_schema *schema,
 		     xmlNodePtr * geom, char **geometry_name)
@@ -2213,29 +2278,6 @@ sniff_wfs_single_feature (xmlNodePtr node, struct wfs_layer_schema *schema)
     return 0;
 }
 
-static void
-sniff_geometries (xmlNodePtr node, struct wfs_layer_schema *schema,
-		  int *sniffed)
-{
-/* recursively parsing the GML payload so to sniff the first geometry */
-    xmlNodePtr cur_node = NULL;
-    for (cur_node = node; cur_node; cur_node = cur_node->next)
-      {
-	  if (cur_node->type == XML_ELEMENT_NODE)
-	    {
-		if (*sniffed)
-		    return;
-		if (sniff_wfs_single_feature (cur_node, schema))
-		  {
-		      *sniffed = 1;
-		      return;
-		  }
-		else
-		    sniff_geometries (cur_node->children, schema, sniffed);
-	    }
-      }
-}
-
 static int
 check_pk_name (struct wfs_layer_schema *schema, const char *pk_column_name,
 	       char *auto_pk_name)
@@ -2640,6 +2682,318 @@ do_rollback (sqlite3 * sqlite, struct wfs_layer_schema *schema)
       }
 }
 
+static struct wfs_layer_schema *
+clone_wfs_layer_schema (struct wfs_layer_schema *schema)
+{
+/* creating a private copy of a WFS schema (columns only, no values) */
+    struct wfs_column_def *col;
+    struct wfs_geometry_def *geo;
+    struct wfs_layer_schema *clone =
+	alloc_wfs_layer_schema (schema->layer_name, schema->swap_axes);
+    clone->sqlite = NULL;
+    col = schema->first;
+    while (col != NULL)
+      {
+	  add_wfs_column_to_schema (clone, col->name, col->type,
+				    col->is_nullable);
+	  col = col->next;
+      }
+    geo = schema->first_geo;
+    while (geo != NULL)
+      {
+	  add_wfs_geometry (clone, geo->geometry_name, geo->geometry_type,
+			    geo->is_nullable);
+	  geo = geo->next;
+      }
+    return clone;
+}
+
+static void
+wfs_fetch_page (struct wfs_page_job *job)
+{
+/* fetching and parsing a whole WFS page [worker thread] */
+    struct wfs_stream stream;
+    xmlNodePtr node;
+    struct wfs_feature *feature;
+    int retry;
+    int len;
+    gaiaOutBuffer errBuf;
+    xmlGenericErrorFunc parsingError = (xmlGenericErrorFunc) wfsParsingError;
+
+    gaiaOutBufferInitialize (&errBuf);
+    xmlSetGenericErrorFunc (&errBuf, parsingError);
+    retry = 0;
+    while (1)
+      {
+	  /* retry loop */
+	  if (wfs_stream_open (job->url, &stream))
+	      break;
+	  retry++;
+	  if (retry > 5)
+	      break;
+	  sqlite3_sleep (10000 * retry);
+      }
+    if (stream.reader == NULL)
+      {
+	  /* parsing error; not a well-formed XML */
+	  job->error = 1;
+	  goto end;
+      }
+
+    node = wfs_stream_next_feature (&stream, job->schema->layer_name);
+    while (node != NULL && job->schema->error == 0)
+      {
+	  if (parse_wfs_single_feature (node->children, job->schema))
+	    {
+		feature = create_feature (job->schema);
+		do_save_feature (job->schema, feature);
+		if (job->count >= job->max)
+		  {
+		      job->max += 256;
+		      job->features =
+			  realloc (job->features,
+				   sizeof (struct wfs_feature *) * job->max);
+		  }
+		job->features[job->count++] = feature;
+	    }
+	  node = wfs_stream_next_feature (&stream, job->schema->layer_name);
+      }
+    if (stream.error || job->schema->error)
+	job->error = 1;
+    wfs_stream_close (&stream);
+    reset_wfs_values (job->schema);
+
+  end:
+    if (job->error)
+      {
+	  const char *msg = "loadwfs: unable to fetch a WFS page";
+	  if (errBuf.Buffer != NULL)
+	      msg = errBuf.Buffer;
+	  len = strlen (msg);
+	  job->err_msg = malloc (len + 1);
+	  strcpy (job->err_msg, msg);
+      }
+    gaiaOutBufferReset (&errBuf);
+    xmlSetGenericErrorFunc ((void *) stderr, NULL);
+}
+
+static void
+wfs_page_thread (void *arg)
+{
+/* the worker thread */
+    wfs_fetch_page ((struct wfs_page_job *) arg);
+}
+
+static struct wfs_page_batch *
+wfs_start_batch (struct wfs_layer_schema *schema, const char *wfs_version,
+		 const char *path_or_url, int page_size, int start_index,
+		 int num_jobs)
+{
+/* starting to fetch a batch of consecutive WFS pages in parallel */
+    int i;
+    const char *max;
+    struct wfs_page_batch *batch = malloc (sizeof (struct wfs_page_batch));
+    if (strcmp (wfs_version, "1.0.0") == 0
+	|| strcmp (wfs_version, "1.1.0") == 0)
+	max = "maxFeatures";
+    else
+	max = "count";
+    batch->num_jobs = num_jobs;
+    for (i = 0; i < num_jobs; i++)
+      {
+	  struct wfs_page_job *job = batch->jobs + i;
+	  job->url =
+	      sqlite3_mprintf ("%s&%s=%d&startIndex=%d", path_or_url, max,
+			       page_size, start_index + (i * page_size));
+	  job->schema = clone_wfs_layer_schema (schema);
+	  job->features = NULL;
+	  job->count = 0;
+	  job->max = 0;
+	  job->error = 0;
+	  job->err_msg = NULL;
+	  batch->threads[i] = splite_thread_start (wfs_page_thread, job);
+      }
+    return batch;
+}
+
+static void
+wfs_join_batch (struct wfs_page_batch *batch)
+{
+/* waiting until all pages in the batch have been fetched */
+    int i;
+    for (i = 0; i < batch->num_jobs; i++)
+      {
+	  if (batch->threads[i] == NULL)
+	    {
+		/* no thread available: running on this thread */
+		wfs_fetch_page (batch->jobs + i);
+		continue;
+	    }
+	  splite_thread_join (batch->threads[i]);
+	  batch->threads[i] = NULL;
+      }
+}
+
+static void
+wfs_free_batch (struct wfs_page_batch *batch)
+{
+/* memory cleanup: destroying a batch of WFS pages */
+    int i;
+    int k;
+    for (i = 0; i < batch->num_jobs; i++)
+      {
+	  struct wfs_page_job *job = batch->jobs + i;
+	  for (k = 0; k < job->count; k++)
+	      free_feature (job->features[k]);
+	  if (job->features != NULL)
+	      free (job->features);
+	  if (job->err_msg != NULL)
+	      free (job->err_msg);
+	  free_wfs_layer_schema (job->schema);
+	  sqlite3_free (job->url);
+      }
+    free (batch);
+}
+
+static int
+wfs_batch_is_full (struct wfs_page_batch *batch, int page_size)
+{
+/* testing if further pages are expected after this batch */
+    int i;
+    for (i = 0; i < batch->num_jobs; i++)
+      {
+	  struct wfs_page_job *job = batch->jobs + i;
+	  if (job->error || job->count < page_size)
+	      return 0;
+      }
+    return 1;
+}
+
+static int
+wfs_insert_feature (struct wfs_layer_schema *schema,
+		    struct wfs_feature *feature, char **err_msg)
+{
+/* inserting a feature parsed by some worker thread */
+    int ret;
+    struct wfs_column_def *col = schema->first;
+    struct wfs_attribute *attr = feature->first;
+    struct wfs_geometry_def *geo = schema->first_geo;
+    struct wfs_geometry *geometry = feature->first_geo;
+
+    /* both schemas list their columns exactly in the same order */
+    reset_wfs_values (schema);
+    while (col != NULL && attr != NULL)
+      {
+	  col->pValue = attr->value;
+	  col = col->next;
+	  attr = attr->next;
+      }
+    while (geo != NULL && geometry != NULL)
+      {
+	  geo->geometry_value = geometry->geometry_value;
+	  geometry->geometry_value = NULL;
+	  geo = geo->next;
+	  geometry = geometry->next;
+      }
+    if (!count_wfs_values (schema))
+	return 0;
+    ret = do_insert (schema, err_msg);
+    reset_wfs_values (schema);
+    return ret;
+}
+
+static int
+wfs_pipeline_load (sqlite3 * sqlite, struct wfs_layer_schema *schema,
+		   const char *wfs_version, const char *path_or_url,
+		   int page_size, int start_index, int max_threads, int *rows,
+		   char **err_msg, void (*progress_callback) (int, void *),
+		   void *callback_ptr)
+{
+/*
+/ loading all the remaining WFS pages
+/
+/ pages are fetched and parsed in batches of max_threads by
+/ background threads, the next batch being prefetched while the
+/ current one is still being inserted; the target table is only
+/ ever written by this thread, strictly following the page order
+*/
+    struct wfs_page_batch *current;
+    struct wfs_page_batch *next;
+    int done = 0;
+    int nRows;
+    int len;
+    int i;
+    int k;
+
+    xmlInitParser ();
+    xmlNanoHTTPInit ();
+    current =
+	wfs_start_batch (schema, wfs_version, path_or_url, page_size,
+			 start_index, max_threads);
+    start_index += max_threads * page_size;
+    while (current != NULL)
+      {
+	  wfs_join_batch (current);
+	  next = NULL;
+	  if (wfs_batch_is_full (current, page_size))
+	    {
+		/* prefetching the next batch */
+		next =
+		    wfs_start_batch (schema, wfs_version, path_or_url,
+				     page_size, start_index, max_threads);
+		start_index += max_threads * page_size;
+	    }
+	  for (i = 0; i < current->num_jobs && !done; i++)
+	    {
+		struct wfs_page_job *job = current->jobs + i;
+		if (job->error)
+		  {
+		      schema->error = 1;
+		      if (job->err_msg != NULL && err_msg != NULL
+			  && *err_msg == NULL)
+			{
+			    len = strlen (job->err_msg);
+			    *err_msg = malloc (len + 1);
+			    strcpy (*err_msg, job->err_msg);
+			}
+		      done = 1;
+		      break;
+		  }
+		nRows = 0;
+		for (k = 0; k < job->count && schema->error == 0; k++)
+		  {
+		      if (wfs_insert_feature (schema, job->features[k], err_msg))
+			  nRows++;
+		  }
+		*rows += nRows;
+		if (progress_callback != NULL)
+		  {
+		      /* invoking the progress callback */
+		      int ext_rows = *rows;
+		      progress_callback (ext_rows, callback_ptr);
+		  }
+		if (schema->error)
+		    done = 1;
+		else if (nRows >= page_size)
+		    restart_transaction (sqlite);
+		else
+		    done = 1;
+	    }
+	  wfs_free_batch (current);
+	  current = next;
+	  if (done && current != NULL)
+	    {
+		/* discarding any page beyond the last one */
+		wfs_join_batch (current);
+		wfs_free_batch (current);
+		current = NULL;
+	    }
+      }
+    if (schema->error)
+	return 0;
+    return 1;
+}
+
 SPATIALITE_DECLARE int
 load_from_wfs (sqlite3 * sqlite, const char *path_or_url,
 	       const char *alt_describe_uri, const char *layer_name,
@@ -2672,70 +3026,68 @@ test_wfs_paging (const char *path_or_url, int page_size, xmlNodePtr node,
  * be effectively supported by the current WFS server
  * 
  */
-    xmlDocPtr xml_doc = NULL;
-    xmlNodePtr root;
     char *page_url;
     int nRows = 0;
     struct wfs_feature *feature_1 = create_feature (schema);
     struct wfs_feature *feature_2 = create_feature (schema);
     *shift_index = 0;
-    parse_wfs_last_feature (node, schema, feature_1, &nRows);
+    if (node != NULL)
+      {
+	  /* the first feature of the first page */
+	  if (parse_wfs_single_feature (node->children, schema))
+	    {
+		if (schema->error == 0)
+		  {
+		      if (do_save_feature (schema, feature_1))
+			  nRows++;
+		  }
+	    }
+      }
     if (nRows < page_size)
       {
 	  /* a single page is required: this means no-paging at all */
 	  free_feature (feature_1);
+	  free_feature (feature_2);
 	  return 1;
       }
 
 /* loading the feature to be tested */
     page_url = sqlite3_mprintf ("%s&maxFeatures=1&startIndex=%d",
 				path_or_url, page_size - 1);
-    xml_doc = xmlReadFile (page_url, NULL, 0);
+    if (!load_wfs_single_feature (page_url, schema, feature_2))
+      {
+	  sqlite3_free (page_url);
+	  goto error;
+      }
     sqlite3_free (page_url);
-    if (xml_doc == NULL)
-	goto error;
-    /* parsing the WFS payload */
-    root = xmlDocGetRootElement (xml_doc);
-    nRows = 0;
-    parse_wfs_last_feature (root, schema, feature_2, &nRows);
     if (!compare_features (feature_1, feature_2))
       {
 	  reset_feature (feature_2);
-	  if (xml_doc != NULL)
-	      xmlFreeDoc (xml_doc);
 	  goto second_chance;
       }
     free_feature (feature_1);
     free_feature (feature_2);
-    if (xml_doc != NULL)
-	xmlFreeDoc (xml_doc);
     return 1;
 
 /* for some MapServer version the first Index is 1, not 0 */
   second_chance:
     page_url = sqlite3_mprintf ("%s&maxFeatures=1&startIndex=%d",
 				path_or_url, page_size);
-    xml_doc = xmlReadFile (page_url, NULL, 0);
+    if (!load_wfs_single_feature (page_url, schema, feature_2))
+      {
+	  sqlite3_free (page_url);
+	  goto error;
+      }
     sqlite3_free (page_url);
-    if (xml_doc == NULL)
-	goto error;
-    /* parsing the WFS payload */
-    root = xmlDocGetRootElement (xml_doc);
-    nRows = 0;
-    parse_wfs_last_feature (root, schema, feature_2, &nRows);
     if (!compare_features (feature_1, feature_2))
 	goto error;
     free_feature (feature_1);
     free_feature (feature_2);
-    if (xml_doc != NULL)
-	xmlFreeDoc (xml_doc);
     *shift_index = 1;
     return 1;
   error:
     free_feature (feature_1);
     free_feature (feature_2);
-    if (xml_doc != NULL)
-	xmlFreeDoc (xml_doc);
     return 0;
 }
 
@@ -3426,8 +3778,26 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 			void *callback_ptr)
 {
 /* attempting to load data from some WFS source [paged]*/
-    xmlDocPtr xml_doc = NULL;
-    xmlNodePtr root;
+    return load_from_wfs_paged_mt (sqlite, wfs_version, path_or_url,
+				   alt_describe_uri, layer_name, swap_axes,
+				   table, pk_column_name, spatial_index,
+				   page_size, 1, rows, err_msg,
+				   progress_callback, callback_ptr);
+}
+
+SPATIALITE_DECLARE int
+load_from_wfs_paged_mt (sqlite3 * sqlite, const char *wfs_version,
+			const char *path_or_url, const char *alt_describe_uri,
+			const char *layer_name, int swap_axes,
+			const char *table, const char *pk_column_name,
+			int spatial_index, int page_size, int max_threads,
+			int *rows, char **err_msg,
+			void (*progress_callback) (int, void *),
+			void *callback_ptr)
+{
+/* attempting to load data from some WFS source [paged, multithreaded] */
+    struct wfs_stream stream;
+    xmlNodePtr feature;
     struct wfs_layer_schema *schema = NULL;
     struct wfs_geometry_def *geo;
     int len;
@@ -3435,7 +3805,6 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
     char *describe_uri = NULL;
     gaiaOutBuffer errBuf;
     int ok = 0;
-    int sniffed = 0;
     int pageNo = 0;
     int startIdx = 0;
     int nRows;
@@ -3449,6 +3818,14 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 	*err_msg = NULL;
     if (path_or_url == NULL)
 	return 0;
+    stream.reader = NULL;
+    stream.schema_location = NULL;
+    gaiaOutBufferInitialize (&errBuf);
+#ifndef LIBXML_THREAD_ENABLED
+    max_threads = 1;		/* libxml2 isn't thread safe */
+#endif
+    if (max_threads > WFS_MAX_THREADS)
+	max_threads = WFS_MAX_THREADS;
 
     while (1)
       {
@@ -3468,16 +3845,15 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 		p_page_url = page_url;
 	    }
 
-	  /* loading the WFS payload from URL (or file) */
-	  gaiaOutBufferInitialize (&errBuf);
+	  /* opening the WFS payload from URL (or file) */
+	  gaiaOutBufferReset (&errBuf);
 	  xmlSetGenericErrorFunc (&errBuf, parsingError);
 
 	  retry = 0;
 	  while (1)
 	    {
 		/* retry loop */
-		xml_doc = xmlReadFile (p_page_url, NULL, 0);
-		if (xml_doc != NULL)
+		if (wfs_stream_open (p_page_url, &stream))
 		    break;
 		retry++;
 		if (retry > 5)
@@ -3487,7 +3863,8 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 
 	  if (page_url != NULL)
 	      sqlite3_free (page_url);
-	  if (xml_doc == NULL)
+	  page_url = NULL;
+	  if (stream.reader == NULL)
 	    {
 		/* parsing error; not a well-formed XML */
 		if (errBuf.Buffer != NULL && err_msg != NULL)
@@ -3499,8 +3876,12 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 		goto end;
 	    }
 
+	  /* positioning on the first feature */
+	  feature = wfs_stream_next_feature (&stream, layer_name);
+
 	  if (pageNo == 0)
 	    {
+		ret = 0;
 		if (alt_describe_uri != NULL)
 		  {
 		      /* using the DescribeFeatureType URI from GetCapabilities */
@@ -3509,11 +3890,12 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 		      strcpy (describe_uri, alt_describe_uri);
 		      ret = 1;
 		  }
-		else
+		else if (stream.is_wfs)
 		  {
 		      /* attempting to extract the DescribeFeatureType from the GetFeature document */
 		      ret =
-			  get_DescribeFeatureType_uri (xml_doc, &describe_uri);
+			  find_describe_uri (stream.schema_location,
+					     &describe_uri);
 		  }
 		if (ret == 0)
 		  {
@@ -3532,13 +3914,13 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 		schema =
 		    load_wfs_schema (describe_uri, layer_name, swap_axes,
 				     err_msg);
+		xmlSetGenericErrorFunc (&errBuf, parsingError);
 		if (schema == NULL)
 		    goto end;
 
 		/* creating the output table */
-		root = xmlDocGetRootElement (xml_doc);
-		sniffed = 0;
-		sniff_geometries (root, schema, &sniffed);
+		if (feature != NULL)
+		    sniff_wfs_single_feature (feature->children, schema);
 
 		if (page_size > 0)
 		  {
@@ -3559,9 +3941,8 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 			     * be effectively supported by the current WFS server
 			     * 
 			     */
-			    root = xmlDocGetRootElement (xml_doc);
 			    if (!test_wfs_paging
-				(path_or_url, page_size, root, schema,
+				(path_or_url, page_size, feature, schema,
 				 &shift_index))
 			      {
 				  const char *err =
@@ -3585,10 +3966,30 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 		    goto end;
 	    }
 
-	  /* parsing the WFS payload */
-	  root = xmlDocGetRootElement (xml_doc);
+	  /* parsing the WFS payload, one feature at a time */
 	  nRows = 0;
-	  parse_wfs_features (root, schema, &nRows, err_msg);
+	  while (feature != NULL && schema->error == 0)
+	    {
+		if (parse_wfs_single_feature (feature->children, schema))
+		  {
+		      if (do_insert (schema, err_msg))
+			  nRows++;
+		  }
+		feature = wfs_stream_next_feature (&stream, layer_name);
+	    }
+	  if (stream.error && schema->error == 0)
+	    {
+		/* parsing error; not a well-formed XML */
+		schema->error = 1;
+		if (errBuf.Buffer != NULL && err_msg != NULL
+		    && *err_msg == NULL)
+		  {
+		      len = strlen (errBuf.Buffer);
+		      *err_msg = malloc (len + 1);
+		      strcpy (*err_msg, errBuf.Buffer);
+		  }
+	    }
+	  wfs_stream_close (&stream);
 	  *rows += nRows;
 	  if (progress_callback != NULL)
 	    {
@@ -3619,11 +4020,31 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 	  if (nRows < page_size)
 	      break;
 
-	  if (xml_doc != NULL)
-	      xmlFreeDoc (xml_doc);
-	  xml_doc = NULL;
 	  pageNo++;
 	  startIdx += nRows;
+	  if (max_threads > 1)
+	    {
+		/* concurrently fetching all the following pages */
+		ret =
+		    wfs_pipeline_load (sqlite, schema, wfs_version,
+				       path_or_url, page_size, startIdx,
+				       max_threads, rows, err_msg,
+				       progress_callback, callback_ptr);
+		xmlSetGenericErrorFunc (&errBuf, parsingError);
+		if (!ret)
+		  {
+		      *rows = 0;
+		      do_rollback (sqlite, schema);
+		      goto end;
+		  }
+		do_commit (sqlite, schema);
+		if (schema->error)
+		  {
+		      *rows = 0;
+		      goto end;
+		  }
+		break;
+	    }
       }
 
     geo = schema->first_geo;
@@ -3649,10 +4070,9 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
 	free_wfs_layer_schema (schema);
     if (describe_uri != NULL)
 	free (describe_uri);
+    wfs_stream_close (&stream);
     gaiaOutBufferReset (&errBuf);
     xmlSetGenericErrorFunc ((void *) stderr, NULL);
-    if (xml_doc != NULL)
-	xmlFreeDoc (xml_doc);
     return ok;
 }
 
@@ -4703,6 +5123,26 @@ load_from_wfs_paged_ex (sqlite3 * sqlite, const char *wfs_version,
     return 0;
 }
 
+SPATIALITE_DECLARE int
+load_from_wfs_paged_mt (sqlite3 * sqlite, const char *wfs_version,
+			const char *path_or_url, const char *alt_describe_uri,
+			const char *layer_name, int swap_axes,
+			const char *table, const char *pk_column_name,
+			int spatial_index, int page_size, int max_threads,
+			int *rows, char **err_msg,
+			void (*progress_callback) (int, void *),
+			void *callback_ptr)
+{
+/* LIBXML2 isn't enabled: always returning an error */
+    if (max_threads == 0)
+	max_threads = 1;	/* silencing stupid compiler warnings */
+    return load_from_wfs_paged_ex (sqlite, wfs_version, path_or_url,
+				   alt_describe_uri, layer_name, swap_axes,
+				   table, pk_column_name, spatial_index,
+				   page_size, rows, err_msg, progress_callback,
+				   callback_ptr);
+}
+
 SPATIALITE_DECLARE gaiaWFScatalogPtr
 create_wfs_catalog (const char *path_or_url, char **err_msg)
 {
@@ -621,6 +621,16 @@ check_cutter_main (sqlite3 * handle, int *retcode)
 	  return 0;
       }
 
+/* cutting invalid Polygons - Blade XY (several Blades for each Input) */
+    sql =
+	"SELECT ST_Cutter(NULL, 'polygs_invalid', NULL, NULL, 'blades_xy', NULL, 'out_polygs_invalid_xy', 1, 1)";
+    ret = test_query (handle, sql);
+    if (!ret)
+      {
+	  *retcode -= 49;
+	  return 0;
+      }
+
     return 1;
 }
 
@@ -2502,6 +2512,121 @@ create_blades_xy (sqlite3 * handle, int *retcode)
     return 1;
 }
 
+static int
+create_polygs_invalid (sqlite3 * handle, int *retcode)
+{
+/* creating and populating a test table - invalid POLYGONs */
+    int ret;
+    char *err_msg = NULL;
+
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE polygs_invalid (pk_id INTEGER PRIMARY KEY)",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE polygs_invalid error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  *retcode -= 1;
+	  return 0;
+      }
+    ret = sqlite3_exec (handle, "SELECT AddGeometryColumn("
+			"'polygs_invalid', 'geometry', 4326, 'MULTIPOLYGON', 'XY')",
+			NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE polygs_invalid Geometry error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  *retcode -= 2;
+	  return 0;
+      }
+    ret =
+	sqlite3_exec (handle,
+		      "INSERT INTO polygs_invalid VALUES (1, "
+		      "GeomFromText('MULTIPOLYGON(((1 1, 9 1, 9 9, 1 9, 1 1)), "
+		      "((2 2, 8 8, 8 2, 2 8, 2 2)), ((22 2, 28 8, 28 2, 22 8, 22 2)))', 4326))",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "INSERT INTO polygs_invalid Geometry error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  *retcode -= 3;
+	  return 0;
+      }
+    ret =
+	sqlite3_exec (handle,
+		      "INSERT INTO polygs_invalid VALUES (2, "
+		      "GeomFromText('MULTIPOLYGON(((-5 -5, 15 15, 15 -5, -5 15, -5 -5)))', 4326))",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "INSERT INTO polygs_invalid Geometry error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  *retcode -= 4;
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+check_cutter_threads (sqlite3 * handle, int *retcode)
+{
+/* testing ST_Cutter - multithreaded vs single threaded */
+    const char *sql;
+    int ret;
+
+/* cutting Lines XY - Blade XY - 4 threads */
+    sql =
+	"SELECT ST_Cutter(NULL, 'lines_xy', NULL, NULL, 'blades_xy', NULL, 'out_lines_xy_xy_mt', 1, 1, 4)";
+    ret = test_query (handle, sql);
+    if (!ret)
+      {
+	  *retcode -= 1;
+	  return 0;
+      }
+
+/* checking Lines XY - the same identical Output */
+    sql =
+	"SELECT (SELECT Count(*) FROM out_lines_xy_xy) = (SELECT Count(*) FROM out_lines_xy_xy_mt) "
+	"AND NOT EXISTS (SELECT * FROM out_lines_xy_xy EXCEPT SELECT * FROM out_lines_xy_xy_mt)";
+    ret = test_query (handle, sql);
+    if (!ret)
+      {
+	  *retcode -= 2;
+	  return 0;
+      }
+
+/* cutting Polygons XY - Blade XY - all CPU cores */
+    sql =
+	"SELECT ST_Cutter(NULL, 'polygs_xy', NULL, NULL, 'blades_xy', NULL, 'out_polygs_xy_xy_mt', 1, 1, 0)";
+    ret = test_query (handle, sql);
+    if (!ret)
+      {
+	  *retcode -= 3;
+	  return 0;
+      }
+
+/* checking Polygons XY - the same identical Output */
+    sql =
+	"SELECT (SELECT Count(*) FROM out_polygs_xy_xy) = (SELECT Count(*) FROM out_polygs_xy_xy_mt) "
+	"AND NOT EXISTS (SELECT * FROM out_polygs_xy_xy EXCEPT SELECT * FROM out_polygs_xy_xy_mt)";
+    ret = test_query (handle, sql);
+    if (!ret)
+      {
+	  *retcode -= 4;
+	  return 0;
+      }
+
+    return 1;
+}
+
 static int
 check_cutter_attached (int *retcode)
 {
@@ -2729,6 +2854,11 @@ main (int argc, char *argv[])
     if (!create_blades_xy (handle, &retcode))
 	return retcode;
 
+/* creating and populating a test table - invalid POLYGONs */
+    retcode = -720;
+    if (!create_polygs_invalid (handle, &retcode))
+	return retcode;
+
     ret = sqlite3_exec (handle, "COMMIT", NULL, NULL, &err_msg);
     if (ret != SQLITE_OK)
       {
@@ -2743,6 +2873,11 @@ main (int argc, char *argv[])
     if (!check_cutter_main (handle, &retcode))
 	return retcode;
 
+/* testing ST_Cutter - multithreaded */
+    retcode = -780;
+    if (!check_cutter_threads (handle, &retcode))
+	return retcode;
+
     ret = sqlite3_close (handle);
     if (ret != SQLITE_OK)
       {
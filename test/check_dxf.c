@@ -41,6 +41,7 @@ the terms of any one of the MPL, the GPL or the LGPL.
  
 */
 #include <unistd.h>
+#include <unistd.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -1395,6 +1396,263 @@ check_symbol_legacy (int cache_mode)
     return 0;
 }
 
+static int
+write_stream_dxf (const char *path)
+{
+/* generating a DXF drawing too big to be streamed as a single chunk */
+    int i;
+    FILE *out = fopen (path, "wb");
+    if (out == NULL)
+	return 0;
+    fprintf (out, "  0\nSECTION\n  2\nTABLES\n  0\nTABLE\n  2\nLAYER\n");
+    fprintf (out, " 70\n     2\n");
+    fprintf (out, "  0\nLAYER\n  2\nPOINTS\n 70\n    64\n 62\n     7\n");
+    fprintf (out, "  0\nLAYER\n  2\nLINES\n 70\n    64\n 62\n     7\n");
+    fprintf (out, "  0\nENDTAB\n  0\nENDSEC\n");
+    fprintf (out, "  0\nSECTION\n  2\nBLOCKS\n");
+    fprintf (out, "  0\nBLOCK\n  8\nLINES\n  2\nSQ\n");
+    fprintf (out, " 70\n    64\n 10\n0.0\n 20\n0.0\n 30\n0.0\n");
+    fprintf (out, "  0\nLINE\n  8\nLINES\n");
+    fprintf (out, " 10\n0.0\n 20\n0.0\n 30\n0.0\n 11\n1.0\n 21\n1.0\n 31\n0.0\n");
+    fprintf (out, "  0\nENDBLK\n  8\nLINES\n  0\nENDSEC\n");
+    fprintf (out, "  0\nSECTION\n  2\nENTITIES\n");
+    for (i = 0; i < 9000; i++)
+      {
+	  fprintf (out, "  0\nPOINT\n  8\nPOINTS\n");
+	  fprintf (out, " 10\n%d.5\n 20\n%d.25\n 30\n0.0\n", i, i % 100);
+      }
+    for (i = 0; i < 200; i++)
+      {
+	  fprintf (out, "  0\nTEXT\n  8\nPOINTS\n");
+	  fprintf (out, " 10\n%d.0\n 20\n1.0\n 30\n0.0\n 40\n2.5\n", i);
+	  fprintf (out, "  1\nlabel %d\n 50\n0.0\n", i);
+      }
+    for (i = 0; i < 500; i++)
+      {
+	  fprintf (out, "  0\nINSERT\n  8\nLINES\n  2\nSQ\n");
+	  fprintf (out, " 10\n%d.0\n 20\n%d.0\n 30\n0.0\n", i * 2, i % 50);
+      }
+    for (i = 0; i < 9000; i++)
+      {
+	  /* the very last Line is 3D: only the first pass can know it */
+	  fprintf (out, "  0\nLINE\n  8\nLINES\n");
+	  fprintf (out, " 10\n%d.0\n 20\n0.0\n 30\n0.0\n", i);
+	  fprintf (out, " 11\n%d.0\n 21\n3.0\n 31\n%s\n", i + 1,
+		   (i == 8999) ? "5.0" : "0.0");
+      }
+    fprintf (out, "  0\nENDSEC\n  0\nEOF\n");
+    fclose (out);
+    return 1;
+}
+
+static int
+compare_dxf_table (sqlite3 * handle, const char *table1, const char *table2)
+{
+/* both tables must contain exactly the same rows (feature_id apart) */
+    int ret;
+    int i;
+    int rows;
+    int columns;
+    char **results;
+    char *sql;
+    char *cols = NULL;
+    char *prev;
+    int count = -1;
+
+    sql = sqlite3_mprintf ("PRAGMA table_info(\"%s\")", table1);
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    for (i = 1; i <= rows; i++)
+      {
+	  const char *name = results[(i * columns) + 1];
+	  if (strcmp (name, "feature_id") == 0)
+	      continue;
+	  prev = cols;
+	  if (prev == NULL)
+	      cols = sqlite3_mprintf ("\"%s\"", name);
+	  else
+	      cols = sqlite3_mprintf ("%s, \"%s\"", prev, name);
+	  sqlite3_free (prev);
+      }
+    sqlite3_free_table (results);
+    if (cols == NULL)
+	return 0;
+
+    sql =
+	sqlite3_mprintf
+	("SELECT (SELECT Count(*) FROM \"%s\") - (SELECT Count(*) FROM \"%s\") + "
+	 "(SELECT Count(*) FROM (SELECT %s FROM \"%s\" EXCEPT SELECT %s FROM \"%s\")) + "
+	 "(SELECT Count(*) FROM (SELECT %s FROM \"%s\" EXCEPT SELECT %s FROM \"%s\"))",
+	 table1, table2, cols, table1, cols, table2, cols, table2, cols,
+	 table1);
+    sqlite3_free (cols);
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (rows == 1 && results[1] != NULL)
+	count = atoi (results[1]);
+    sqlite3_free_table (results);
+    if (count != 0)
+      {
+	  fprintf (stderr, "mismatching DXF tables: %s %s\n", table1, table2);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+compare_dxf_import (sqlite3 * handle, const char *prefix1, const char *prefix2)
+{
+/* comparing all the tables created by two DXF imports */
+    int ret;
+    int i;
+    int rows;
+    int columns;
+    char **results;
+    char *sql;
+    char *table2;
+    int count;
+    int len = strlen (prefix1);
+
+    sql =
+	sqlite3_mprintf
+	("SELECT name FROM sqlite_master WHERE type = 'table' AND "
+	 "substr(name, 1, %d) = %Q", len, prefix1);
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    if (rows == 0)
+      {
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    for (i = 1; i <= rows; i++)
+      {
+	  const char *table1 = results[(i * columns) + 0];
+	  table2 = sqlite3_mprintf ("%s%s", prefix2, table1 + len);
+	  ret = compare_dxf_table (handle, table1, table2);
+	  sqlite3_free (table2);
+	  if (!ret)
+	    {
+		sqlite3_free_table (results);
+		return 0;
+	    }
+      }
+    sqlite3_free_table (results);
+
+/* the second import must not have created any further table */
+    sql =
+	sqlite3_mprintf
+	("SELECT Count(*) FROM sqlite_master WHERE type = 'table' AND "
+	 "substr(name, 1, %d) = %Q", (int) strlen (prefix2), prefix2);
+    ret = sqlite3_get_table (handle, sql, &results, &i, &columns, NULL);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+	return 0;
+    count = (i == 1 && results[1] != NULL) ? atoi (results[1]) : -1;
+    sqlite3_free_table (results);
+    return (count == rows) ? 1 : 0;
+}
+
+static int
+check_stream (void)
+{
+/* streaming a big DXF in many chunks vs a single pass import */
+    int ret;
+    int i;
+    sqlite3 *handle;
+    char *err_msg = NULL;
+    gaiaDxfParserPtr dxf;
+    const char *path = "./check_dxf_stream.dxf";
+    int modes[] = { GAIA_DXF_IMPORT_BY_LAYER, GAIA_DXF_IMPORT_MIXED };
+    const char *single[] = { "sl_", "sm_" };
+    const char *stream[] = { "cl_", "cm_" };
+    void *cache = spatialite_alloc_connection ();
+
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory database: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  return -1;
+      }
+    spatialite_init_ex (handle, cache, 0);
+
+    ret =
+	sqlite3_exec (handle, "SELECT InitSpatialMetadataFull(1)", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "InitSpatialMetadataFull() error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  return -2;
+      }
+
+    if (!write_stream_dxf (path))
+      {
+	  fprintf (stderr, "unable to create \"%s\"\n", path);
+	  return -3;
+      }
+
+    for (i = 0; i < 2; i++)
+      {
+	  dxf =
+	      gaiaCreateDxfParser (-2, GAIA_DXF_AUTO_2D_3D, single[i], NULL,
+				   GAIA_DXF_RING_NONE);
+	  ret = gaiaParseDxfFile_r (cache, dxf, path);
+	  if (ret)
+	      ret = gaiaLoadFromDxfParser (handle, dxf, modes[i], 0);
+	  gaiaDestroyDxfParser (dxf);
+	  if (ret == 0)
+	    {
+		fprintf (stderr, "Unable to load \"%s\" (single pass)\n",
+			 path);
+		unlink (path);
+		return -4;
+	    }
+
+	  dxf =
+	      gaiaCreateDxfParser (-2, GAIA_DXF_AUTO_2D_3D, stream[i], NULL,
+				   GAIA_DXF_RING_NONE);
+	  ret = gaiaStreamDxfFile_r (cache, handle, dxf, path, modes[i], 0);
+	  gaiaDestroyDxfParser (dxf);
+	  if (ret == 0)
+	    {
+		fprintf (stderr, "Unable to stream \"%s\"\n", path);
+		unlink (path);
+		return -5;
+	    }
+
+	  if (!compare_dxf_import (handle, single[i], stream[i]))
+	    {
+		fprintf (stderr, "Unexpected result: streaming \"%s\"\n",
+			 path);
+		unlink (path);
+		return -6;
+	    }
+      }
+    unlink (path);
+
+    ret = sqlite3_close (handle);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "sqlite3_close() error: %s\n",
+		   sqlite3_errmsg (handle));
+	  return -7;
+      }
+
+    spatialite_cleanup_ex (cache);
+    return 0;
+}
+
 #endif /* GEOS enabled */
 
 int
@@ -1453,6 +1711,9 @@ main (int argc, char *argv[])
 	      return -12;
       }
 
+    if (check_stream () != 0)
+	return -13;
+
 #endif /* GEOS enabled */
 
     spatialite_shutdown ();
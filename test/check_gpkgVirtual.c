@@ -465,6 +465,99 @@ test_vtable_out (sqlite3 * handle)
     return 1;
 }
 
+static int
+test_count (sqlite3 * handle, const char *sql, int expected)
+{
+/* checking the number of rows returned by some query */
+    int ret;
+    char **results;
+    int rows;
+    int columns;
+    char *err_msg = NULL;
+
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n%s\n", sql, err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows != 1 || results[1] == NULL || atoi (results[1]) != expected)
+      {
+	  fprintf (stderr, "Unexpected result: %s\n(expected %d, got %s)\n",
+		   sql, expected, (rows == 1
+				   && results[1] != NULL) ? results[1] : "?");
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    sqlite3_free_table (results);
+    return 1;
+}
+
+static int
+test_vtable_pushdown (sqlite3 * handle)
+{
+/* testing constraints passed down to the GPKG table */
+    const char *sql;
+    int ret;
+    char *sql_err = NULL;
+
+    if (!test_count
+	(handle, "SELECT Count(*) FROM vgpkg_pt2d WHERE ROWID = 3", 1))
+	return 0;
+    if (!test_count
+	(handle, "SELECT id FROM vgpkg_pt2d WHERE ROWID = 3", 3))
+	return 0;
+    if (!test_count
+	(handle,
+	 "SELECT Count(*) FROM vgpkg_pt2d WHERE ROWID >= 2 AND ROWID < 4",
+	 2))
+	return 0;
+    if (!test_count
+	(handle,
+	 "SELECT Count(*) FROM vgpkg_test_pk WHERE first_name = 'gamma'", 1))
+	return 0;
+    if (!test_count
+	(handle,
+	 "SELECT Count(*) FROM vgpkg_test_pk WHERE first_name LIKE 'G%'", 1))
+	return 0;
+    if (!test_count
+	(handle,
+	 "SELECT Count(*) FROM vgpkg_test_pk AS a, vgpkg_test_pk AS b "
+	 "WHERE a.ROWID = b.ROWID AND a.first_name = b.first_name", 5))
+	return 0;
+    if (!test_count
+	(handle,
+	 "SELECT Count(*) FROM vgpkg_pt2d AS a, vgpkg_pt2d AS b "
+	 "WHERE b.ROWID > a.ROWID", 6))
+	return 0;
+
+/* spatial filtering based on the GPKG R*Tree */
+    sql = "CREATE VIRTUAL TABLE SpatialIndex USING VirtualSpatialIndex()";
+    ret = sqlite3_exec (handle, sql, NULL, NULL, &sql_err);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE SpatialIndex error: %s\n", sql_err);
+	  sqlite3_free (sql_err);
+	  return 0;
+      }
+    if (!test_count
+	(handle,
+	 "SELECT id FROM vgpkg_pt2d WHERE ROWID IN (SELECT ROWID "
+	 "FROM SpatialIndex WHERE f_table_name = 'pt2d' AND "
+	 "search_frame = BuildMbr(1.5, 2.0, 1.7, 2.2))", 2))
+	return 0;
+    if (!test_count
+	(handle,
+	 "SELECT Count(*) FROM vgpkg_ln3dz WHERE ROWID IN (SELECT ROWID "
+	 "FROM SpatialIndex WHERE f_table_name = 'ln3dz' AND "
+	 "f_geometry_column = 'geom' AND "
+	 "search_frame = BuildMbr(3.0, 4.0, 4.5, 5.5))", 2))
+	return 0;
+
+    return 1;
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -652,6 +745,15 @@ main (int argc, char *argv[])
 	  return -1;
       }
 
+    if (!test_vtable_pushdown (db_handle))
+      {
+	  do_unlink_all ();
+	  sqlite3_close (db_handle);
+	  spatialite_cleanup_ex (cache);
+	  spatialite_shutdown ();
+	  return -1;
+      }
+
     if (!test_vtable_out (db_handle))
       {
 	  do_unlink_all ();
@@ -50,6 +50,98 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "sqlite3.h"
 #include "spatialite.h"
 
+static int
+count_advanced_tables (sqlite3 * handle, int *count)
+{
+/* counting the advanced MetaData tables currently defined */
+    int ret;
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT Count(*) FROM sqlite_master WHERE name IN "
+			   "('views_geometry_columns', 'geometry_columns_auth', "
+			   "'geometry_columns_statistics', 'sql_statements_log')",
+			   &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows != 1 || columns != 1)
+      {
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    *count = atoi (results[1]);
+    sqlite3_free_table (results);
+    return 1;
+}
+
+static int
+check_lazy_on_demand (const char *title, const char *sql)
+{
+/* the advanced MetaData tables must be created by the first use of SQL */
+    int ret;
+    sqlite3 *handle;
+    char *err_msg = NULL;
+    int count;
+    void *cache = spatialite_alloc_connection ();
+
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory db: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  spatialite_cleanup_ex (cache);
+	  return 0;
+      }
+    spatialite_init_ex (handle, cache, 0);
+
+    ret =
+	sqlite3_exec (handle, "SELECT InitSpatialMetadataLazy(1, 'WGS84')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "InitSpatialMetadataLazy error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  goto error;
+      }
+    if (!count_advanced_tables (handle, &count) || count != 0)
+      {
+	  fprintf (stderr, "%s: unexpected advanced tables before\n", title);
+	  goto error;
+      }
+    ret = sqlite3_exec (handle, sql, NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "%s error: %s\n", title, err_msg);
+	  sqlite3_free (err_msg);
+	  goto error;
+      }
+    if (!count_advanced_tables (handle, &count) || count != 4)
+      {
+	  fprintf (stderr, "%s: advanced tables not created\n", title);
+	  goto error;
+      }
+
+    sqlite3_close (handle);
+    spatialite_cleanup_ex (cache);
+    return 1;
+
+  error:
+    sqlite3_close (handle);
+    spatialite_cleanup_ex (cache);
+    return 0;
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -420,5 +512,138 @@ main (int argc, char *argv[])
 
     spatialite_cleanup_ex (cache);
 
+    cache = spatialite_alloc_connection ();
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory db: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  return -37;
+      }
+
+    spatialite_init_ex (handle, cache, 0);
+
+    ret =
+	sqlite3_get_table (handle, "SELECT InitSpatialMetadataLazy(1, 'WGS84')",
+			   &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -38;
+      }
+    if ((rows != 1) || (columns != 1) || strcmp (results[1], "1") != 0)
+      {
+	  fprintf (stderr,
+		   "Unexpected result InitSpatialMetadataLazy(1, 'WGS84'): %s.\n",
+		   (rows == 1 && columns == 1) ? results[1] : "bad result");
+	  return -39;
+      }
+    sqlite3_free_table (results);
+
+/* the advanced MetaData tables must not exist yet */
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT Count(*) FROM sqlite_master WHERE name IN "
+			   "('views_geometry_columns', 'geometry_columns_auth', "
+			   "'geometry_columns_statistics', 'sql_statements_log')",
+			   &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -40;
+      }
+    if (strcmp (results[1], "0") != 0)
+      {
+	  fprintf (stderr,
+		   "Unexpected result: InitSpatialMetadataLazy() created %s advanced tables.\n",
+		   results[1]);
+	  return -41;
+      }
+    sqlite3_free_table (results);
+
+/* the first AddGeometryColumn() is expected to create them */
+    ret =
+	sqlite3_exec (handle,
+		      "CREATE TABLE lazy_pts (id INTEGER PRIMARY KEY)", NULL,
+		      NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE TABLE lazy_pts error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -42;
+      }
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT AddGeometryColumn('lazy_pts', 'geom', 4326, 'POINT', 'XY')",
+			   &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -43;
+      }
+    if ((rows != 1) || (columns != 1) || strcmp (results[1], "1") != 0)
+      {
+	  fprintf (stderr,
+		   "Unexpected result: AddGeometryColumn() on lazy MetaData failed.\n");
+	  return -44;
+      }
+    sqlite3_free_table (results);
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT Count(*) FROM geometry_columns_auth AS a "
+			   "JOIN geometry_columns_statistics AS s USING "
+			   "(f_table_name, f_geometry_column) "
+			   "WHERE f_table_name = 'lazy_pts'", &results, &rows,
+			   &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -45;
+      }
+    if (strcmp (results[1], "1") != 0)
+      {
+	  fprintf (stderr,
+		   "Unexpected result: lazy advanced MetaData rows: %s.\n",
+		   results[1]);
+	  return -46;
+      }
+    sqlite3_free_table (results);
+
+    ret = sqlite3_close (handle);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "sqlite3_close() error: %s\n",
+		   sqlite3_errmsg (handle));
+	  return -47;
+      }
+
+    spatialite_cleanup_ex (cache);
+
+/* any other first use is expected to create them as well */
+    if (!check_lazy_on_demand
+	("RecoverGeometryColumn",
+	 "CREATE TABLE lazy_pts (id INTEGER PRIMARY KEY, geom BLOB); "
+	 "INSERT INTO lazy_pts VALUES (1, MakePoint(1, 2, 4326)); "
+	 "SELECT RecoverGeometryColumn('lazy_pts', 'geom', 4326, 'POINT', 'XY')"))
+	return -48;
+    if (!check_lazy_on_demand
+	("CreateRasterCoveragesTable", "SELECT CreateRasterCoveragesTable()"))
+	return -49;
+    if (!check_lazy_on_demand ("WMS_CreateTables", "SELECT WMS_CreateTables()"))
+	return -50;
+#ifdef ENABLE_RTTOPO		/* only if RTTOPO is enabled */
+    if (!check_lazy_on_demand
+	("CreateVectorCoveragesTables",
+	 "SELECT CreateVectorCoveragesTables()"))
+	return -51;
+#endif /* end RTTOPO conditional */
+
     return 0;
 }
@@ -41,6 +41,7 @@ the provisions above, a recipient may use your version of this file under
 the terms of any one of the MPL, the GPL or the LGPL.
  
 */
+#include <unistd.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -50,6 +51,365 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "sqlite3.h"
 #include "spatialite.h"
 
+static int
+do_count (sqlite3 * handle, const char *sql, int *count)
+{
+/* executing a SQL query returning a single Integer value */
+    int ret;
+    char **results;
+    int rows;
+    int columns;
+    char *err_msg = NULL;
+
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows != 1 || columns != 1 || results[1] == NULL)
+      {
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    *count = atoi (results[1]);
+    sqlite3_free_table (results);
+    return 1;
+}
+
+static int
+do_test_shared (void)
+{
+/* two connections sharing the same MbrCache */
+    int ret;
+    int count;
+    int usage1;
+    int usage2;
+    sqlite3 *handle1 = NULL;
+    sqlite3 *handle2 = NULL;
+    char *err_msg = NULL;
+    const char *path = "./mbrcache_shared.sqlite";
+    void *cache1 = spatialite_alloc_connection ();
+    void *cache2 = spatialite_alloc_connection ();
+    int retcode = 0;
+
+    unlink (path);
+    ret =
+	sqlite3_open_v2 (path, &handle1,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open \"%s\": %s\n", path,
+		   sqlite3_errmsg (handle1));
+	  retcode = -70;
+	  goto stop;
+      }
+    spatialite_init_ex (handle1, cache1, 0);
+    ret =
+	sqlite3_exec (handle1,
+		      "CREATE TABLE pts (id INTEGER PRIMARY KEY, geom BLOB);"
+		      "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL "
+		      "SELECT i + 1 FROM n WHERE i < 100) "
+		      "INSERT INTO pts SELECT i, MakePoint(i, i) FROM n;"
+		      "CREATE VIRTUAL TABLE cache_pts USING MbrCache(pts, geom);",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "shared MbrCache error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  retcode = -71;
+	  goto stop;
+      }
+
+    ret =
+	sqlite3_open_v2 (path, &handle2, SQLITE_OPEN_READWRITE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open \"%s\": %s\n", path,
+		   sqlite3_errmsg (handle2));
+	  retcode = -72;
+	  goto stop;
+      }
+    spatialite_init_ex (handle2, cache2, 0);
+
+/* the cache is loaded by the second connection */
+    if (!do_count
+	(handle2,
+	 "SELECT Count(*) FROM cache_pts WHERE mbr = FilterMbrWithin(0, 0, 10.5, 10.5)",
+	 &count) || count != 10)
+      {
+	  fprintf (stderr, "unexpected shared MbrCache count (1): %d\n", count);
+	  retcode = -73;
+	  goto stop;
+      }
+    if (!do_count
+	(handle1, "SELECT MbrCacheMemoryUsage('pts', 'geom')", &usage1)
+	|| !do_count (handle2, "SELECT MbrCacheMemoryUsage('pts', 'geom')",
+		      &usage2) || usage1 <= 0 || usage1 != usage2)
+      {
+	  fprintf (stderr, "unexpected MbrCacheMemoryUsage: %d %d\n", usage1,
+		   usage2);
+	  retcode = -74;
+	  goto stop;
+      }
+    if (!do_count (handle1, "SELECT MbrCacheMemoryUsage()", &usage2)
+	|| usage2 < usage1)
+      {
+	  fprintf (stderr, "unexpected MbrCacheMemoryUsage(): %d\n", usage2);
+	  retcode = -75;
+	  goto stop;
+      }
+
+/* changes made by the first connection are seen by the second one */
+    ret =
+	sqlite3_exec (handle1,
+		      "INSERT INTO cache_pts (rowid, mbr) VALUES (1000, BuildMbrFilter(5, 5, 6, 6))",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "shared MbrCache INSERT error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  retcode = -76;
+	  goto stop;
+      }
+    if (!do_count
+	(handle2,
+	 "SELECT Count(*) FROM cache_pts WHERE mbr = FilterMbrWithin(0, 0, 10.5, 10.5)",
+	 &count) || count != 11)
+      {
+	  fprintf (stderr, "unexpected shared MbrCache count (2): %d\n", count);
+	  retcode = -77;
+	  goto stop;
+      }
+
+/* the cache survives the first connection */
+    sqlite3_close (handle1);
+    handle1 = NULL;
+    if (!do_count
+	(handle2, "SELECT Count(*) FROM cache_pts WHERE rowid = 1000", &count)
+	|| count != 1)
+      {
+	  fprintf (stderr, "unexpected shared MbrCache count (3): %d\n", count);
+	  retcode = -78;
+	  goto stop;
+      }
+
+  stop:
+    if (handle1 != NULL)
+	sqlite3_close (handle1);
+    if (handle2 != NULL)
+	sqlite3_close (handle2);
+    spatialite_cleanup_ex (cache1);
+    spatialite_cleanup_ex (cache2);
+    unlink (path);
+    return retcode;
+}
+
+static int
+do_check_cache (sqlite3 * handle, int *count)
+{
+/* checking that the MbrCache exactly matches the main table */
+    int cached;
+    if (!do_count
+	(handle,
+	 "SELECT Count(*) FROM cache_t_g WHERE mbr = FilterMbrIntersects(-1000, -1000, 1000, 1000)",
+	 &cached))
+	return 0;
+    if (!do_count (handle, "SELECT Count(*) FROM t", count))
+	return 0;
+    if (cached != *count)
+      {
+	  fprintf (stderr, "MbrCache count mismatch: %d (expected %d)\n",
+		   cached, *count);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+do_test_rollback (void)
+{
+/* uncommitted changes must never be seen by another connection */
+    int ret;
+    int count;
+    sqlite3 *handle1 = NULL;
+    sqlite3 *handle2 = NULL;
+    char *err_msg = NULL;
+    const char *path = "./mbrcache_rollback.sqlite";
+    void *cache1 = spatialite_alloc_connection ();
+    void *cache2 = spatialite_alloc_connection ();
+    int retcode = 0;
+
+    unlink (path);
+    ret =
+	sqlite3_open_v2 (path, &handle1,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open \"%s\": %s\n", path,
+		   sqlite3_errmsg (handle1));
+	  retcode = -80;
+	  goto stop;
+      }
+    spatialite_init_ex (handle1, cache1, 0);
+    ret =
+	sqlite3_exec (handle1,
+		      "SELECT InitSpatialMetadata(1, 'WGS84');"
+		      "CREATE TABLE t (id INTEGER PRIMARY KEY);"
+		      "SELECT AddGeometryColumn('t', 'g', 4326, 'POINT', 'XY');"
+		      "SELECT CreateMbrCache('t', 'g');"
+		      "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL "
+		      "SELECT i + 1 FROM n WHERE i < 100) "
+		      "INSERT INTO t SELECT i, MakePoint(i, i, 4326) FROM n;",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "MbrCache rollback setup error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  retcode = -81;
+	  goto stop;
+      }
+
+    ret = sqlite3_open_v2 (path, &handle2, SQLITE_OPEN_READWRITE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open \"%s\": %s\n", path,
+		   sqlite3_errmsg (handle2));
+	  retcode = -82;
+	  goto stop;
+      }
+    spatialite_init_ex (handle2, cache2, 0);
+    if (!do_check_cache (handle2, &count) || count != 100)
+      {
+	  retcode = -83;
+	  goto stop;
+      }
+
+/* the first connection starts a transaction */
+    ret =
+	sqlite3_exec (handle1,
+		      "BEGIN;"
+		      "INSERT INTO t VALUES (101, MakePoint(101, 101, 4326));"
+		      "INSERT INTO t VALUES (102, MakePoint(102, 102, 4326));"
+		      "UPDATE t SET g = MakePoint(-5, -5, 4326) WHERE id = 5;"
+		      "DELETE FROM t WHERE id = 10;", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "MbrCache transaction error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  retcode = -84;
+	  goto stop;
+      }
+    if (!do_check_cache (handle1, &count) || count != 101)
+      {
+	  retcode = -85;
+	  goto stop;
+      }
+    if (!do_check_cache (handle2, &count) || count != 100)
+      {
+	  retcode = -86;
+	  goto stop;
+      }
+    if (!do_count
+	(handle2,
+	 "SELECT Count(*) FROM cache_t_g WHERE mbr = FilterMbrWithin(-6, -6, -4, -4)",
+	 &count) || count != 0)
+      {
+	  fprintf (stderr, "uncommitted MbrCache UPDATE is visible\n");
+	  retcode = -87;
+	  goto stop;
+      }
+
+/* rolling back to a savepoint */
+    ret =
+	sqlite3_exec (handle1,
+		      "SAVEPOINT sp;"
+		      "INSERT INTO t VALUES (103, MakePoint(103, 103, 4326));"
+		      "DELETE FROM t WHERE id = 101;"
+		      "UPDATE t SET g = MakePoint(-7, -7, 4326) WHERE id = 5;"
+		      "ROLLBACK TO sp;", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "MbrCache savepoint error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  retcode = -88;
+	  goto stop;
+      }
+    if (!do_check_cache (handle1, &count) || count != 101)
+      {
+	  retcode = -89;
+	  goto stop;
+      }
+    if (!do_count
+	(handle1,
+	 "SELECT Count(*) FROM cache_t_g WHERE mbr = FilterMbrWithin(-6, -6, -4, -4)",
+	 &count) || count != 1)
+      {
+	  fprintf (stderr, "unexpected MbrCache after ROLLBACK TO\n");
+	  retcode = -90;
+	  goto stop;
+      }
+
+/* rolling back the whole transaction */
+    ret = sqlite3_exec (handle1, "ROLLBACK", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "MbrCache ROLLBACK error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  retcode = -91;
+	  goto stop;
+      }
+    if (!do_check_cache (handle2, &count) || count != 100)
+      {
+	  retcode = -92;
+	  goto stop;
+      }
+    if (!do_check_cache (handle1, &count) || count != 100)
+      {
+	  retcode = -93;
+	  goto stop;
+      }
+
+/* committed changes are seen by every connection */
+    ret =
+	sqlite3_exec (handle1,
+		      "BEGIN;"
+		      "INSERT INTO t VALUES (101, MakePoint(101, 101, 4326));"
+		      "DELETE FROM t WHERE id = 10;"
+		      "COMMIT;", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "MbrCache COMMIT error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  retcode = -94;
+	  goto stop;
+      }
+    if (!do_check_cache (handle2, &count) || count != 100)
+      {
+	  retcode = -95;
+	  goto stop;
+      }
+    if (!do_count
+	(handle2, "SELECT Count(*) FROM cache_t_g WHERE rowid = 101", &count)
+	|| count != 1)
+      {
+	  fprintf (stderr, "committed MbrCache INSERT is not visible\n");
+	  retcode = -96;
+	  goto stop;
+      }
+
+  stop:
+    if (handle1 != NULL)
+	sqlite3_close (handle1);
+    if (handle2 != NULL)
+	sqlite3_close (handle2);
+    spatialite_cleanup_ex (cache1);
+    spatialite_cleanup_ex (cache2);
+    unlink (path);
+    return retcode;
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -606,6 +966,14 @@ main (int argc, char *argv[])
 	  return -61;
       }
 
+    ret = do_test_shared ();
+    if (ret != 0)
+	return ret;
+
+    ret = do_test_rollback ();
+    if (ret != 0)
+	return ret;
+
     ret = sqlite3_close (handle);
     if (ret != SQLITE_OK)
       {
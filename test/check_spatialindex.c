@@ -1634,6 +1634,397 @@ do_test_rowid (sqlite3 * handle)
     return 0;
 }
 
+static int
+get_spidx_count (sqlite3 * handle, int *count)
+{
+/* counting the points within the test frame via VirtualSpatialIndex */
+    int ret;
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT Count(*) FROM SpatialIndex WHERE "
+			   "f_table_name = 'cache_pts' AND search_frame = "
+			   "BuildMbr(0, 0, 10, 10)", &results, &rows, &columns,
+			   &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualSpatialIndex (cache) error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows != 1 || columns != 1)
+      {
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    *count = atoi (results[1]);
+    sqlite3_free_table (results);
+    return 1;
+}
+
+static int
+get_spidx_batch_count (sqlite3 * handle, const char *frame, int batch,
+		       int *count)
+{
+/* counting the points within some test frame, eventually in batch mode */
+    int ret;
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+    char *sql;
+
+    if (batch < 0)
+	sql =
+	    sqlite3_mprintf
+	    ("SELECT Count(*) FROM SpatialIndex WHERE f_table_name = 'cache_pts' "
+	     "AND search_frame = GeomFromText(%Q, 4326)", frame);
+    else
+	sql =
+	    sqlite3_mprintf
+	    ("SELECT Count(*) FROM SpatialIndex WHERE batch_probe = %d "
+	     "AND search_frame = GeomFromText(%Q, 4326) "
+	     "AND f_table_name = 'cache_pts'", batch, frame);
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, &err_msg);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualSpatialIndex (batch) error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows != 1 || columns != 1)
+      {
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    *count = atoi (results[1]);
+    sqlite3_free_table (results);
+    return 1;
+}
+
+static int
+do_test_cache (sqlite3 * handle)
+{
+/* the cached R*Tree query must survive data changes but not schema changes */
+    int ret;
+    char *err_msg = NULL;
+    int count;
+    int i;
+    const char *sql[] = {
+	"CREATE TABLE cache_pts (id INTEGER PRIMARY KEY)",
+	"SELECT AddGeometryColumn('cache_pts', 'geom', 4326, 'POINT', 'XY')",
+	"INSERT INTO cache_pts VALUES (1, MakePoint(1, 1, 4326))",
+	"INSERT INTO cache_pts VALUES (2, MakePoint(5, 5, 4326))",
+	"INSERT INTO cache_pts VALUES (3, MakePoint(50, 50, 4326))",
+	"SELECT CreateSpatialIndex('cache_pts', 'geom')",
+	NULL
+    };
+
+    for (i = 0; sql[i] != NULL; i++)
+      {
+	  ret = sqlite3_exec (handle, sql[i], NULL, NULL, &err_msg);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "%s error: %s\n", sql[i], err_msg);
+		sqlite3_free (err_msg);
+		return -301;
+	    }
+      }
+    if (!get_spidx_count (handle, &count) || count != 2)
+      {
+	  fprintf (stderr, "SpatialIndex (cache #1): unexpected count\n");
+	  return -302;
+      }
+
+/* plain data changes: the cached R*Tree is still valid */
+    ret =
+	sqlite3_exec (handle,
+		      "INSERT INTO cache_pts VALUES (4, MakePoint(7, 7, 4326))",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "INSERT cache_pts error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -303;
+      }
+    if (!get_spidx_count (handle, &count) || count != 3)
+      {
+	  fprintf (stderr, "SpatialIndex (cache #2): unexpected count\n");
+	  return -304;
+      }
+    ret =
+	sqlite3_exec (handle, "DELETE FROM cache_pts WHERE id = 1", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "DELETE cache_pts error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -305;
+      }
+    if (!get_spidx_count (handle, &count) || count != 2)
+      {
+	  fprintf (stderr, "SpatialIndex (cache #3): unexpected count\n");
+	  return -306;
+      }
+
+/* batch probe: each item of the search frame is probed on its own */
+    if (!get_spidx_batch_count (handle, "MULTIPOINT(5 5, 50 50)", -1, &count)
+	|| count != 3)
+      {
+	  fprintf (stderr, "SpatialIndex (batch #1): unexpected count\n");
+	  return -351;
+      }
+    if (!get_spidx_batch_count (handle, "MULTIPOINT(5 5, 50 50)", 0, &count)
+	|| count != 3)
+      {
+	  fprintf (stderr, "SpatialIndex (batch #2): unexpected count\n");
+	  return -352;
+      }
+    if (!get_spidx_batch_count (handle, "MULTIPOINT(5 5, 50 50)", 1, &count)
+	|| count != 2)
+      {
+	  fprintf (stderr, "SpatialIndex (batch #3): unexpected count\n");
+	  return -353;
+      }
+    if (!get_spidx_batch_count
+	(handle, "GEOMETRYCOLLECTION(POINT(7 7), LINESTRING(4 4, 8 8), "
+	 "POLYGON((49 49, 51 49, 51 51, 49 51, 49 49)))", 1, &count)
+	|| count != 3)
+      {
+	  fprintf (stderr, "SpatialIndex (batch #4): unexpected count\n");
+	  return -354;
+      }
+    if (!get_spidx_batch_count
+	(handle, "MULTIPOINT(20 20, 30 30)", 1, &count) || count != 0)
+      {
+	  fprintf (stderr, "SpatialIndex (batch #5): unexpected count\n");
+	  return -355;
+      }
+
+/* disabling the R*Tree: the cache must be invalidated */
+    ret =
+	sqlite3_exec (handle, "SELECT DisableSpatialIndex('cache_pts', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "DisableSpatialIndex cache_pts error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return -307;
+      }
+    if (!get_spidx_count (handle, &count) || count != 0)
+      {
+	  fprintf (stderr, "SpatialIndex (cache #4): unexpected count\n");
+	  return -308;
+      }
+
+/* re-enabling the R*Tree */
+    ret =
+	sqlite3_exec (handle,
+		      "DROP TABLE idx_cache_pts_geom; "
+		      "SELECT CreateSpatialIndex('cache_pts', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CreateSpatialIndex cache_pts error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return -309;
+      }
+    if (!get_spidx_count (handle, &count) || count != 2)
+      {
+	  fprintf (stderr, "SpatialIndex (cache #5): unexpected count\n");
+	  return -310;
+      }
+
+/* dropping the whole table */
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT DropGeoTable('cache_pts')", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "DropGeoTable cache_pts error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -311;
+      }
+    if (!get_spidx_count (handle, &count) || count != 0)
+      {
+	  fprintf (stderr, "SpatialIndex (cache #6): unexpected count\n");
+	  return -312;
+      }
+
+    return 0;
+}
+
+static int
+get_layer_stats (sqlite3 * handle, int *row_count, double *min_x,
+		 double *min_y, double *max_x, double *max_y, int *verified)
+{
+/* fetching the current Layer Statistics of 'stats_pts' */
+    int ret;
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT row_count, extent_min_x, extent_min_y, "
+			   "extent_max_x, extent_max_y, last_verified IS NOT NULL "
+			   "FROM geometry_columns_statistics WHERE "
+			   "f_table_name = 'stats_pts' AND f_geometry_column = 'geom'",
+			   &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "geometry_columns_statistics error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows != 1 || columns != 6 || results[6] == NULL
+	|| results[7] == NULL || results[10] == NULL)
+      {
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    *row_count = atoi (results[6]);
+    *min_x = atof (results[7]);
+    *min_y = atof (results[8]);
+    *max_x = atof (results[9]);
+    *max_y = atof (results[10]);
+    *verified = atoi (results[11]);
+    sqlite3_free_table (results);
+    return 1;
+}
+
+static int
+do_test_incremental_stats (sqlite3 * handle)
+{
+/* the statistics triggers must grow the Layer and invalidate on shrink */
+    int ret;
+    char *err_msg = NULL;
+    int row_count;
+    double min_x;
+    double min_y;
+    double max_x;
+    double max_y;
+    int verified;
+    int i;
+    const char *sql[] = {
+	"CREATE TABLE stats_pts (id INTEGER PRIMARY KEY, val INTEGER)",
+	"SELECT AddGeometryColumn('stats_pts', 'geom', 4326, 'POINT', 'XY')",
+	"INSERT INTO stats_pts VALUES (1, 10, MakePoint(1, 1, 4326))",
+	"INSERT INTO stats_pts VALUES (2, 20, MakePoint(5, 5, 4326))",
+	"SELECT EnableIncrementalStatistics('stats_pts', 'geom')",
+	NULL
+    };
+
+    for (i = 0; sql[i] != NULL; i++)
+      {
+	  ret = sqlite3_exec (handle, sql[i], NULL, NULL, &err_msg);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "%s error: %s\n", sql[i], err_msg);
+		sqlite3_free (err_msg);
+		return -341;
+	    }
+      }
+    if (!get_layer_stats
+	(handle, &row_count, &min_x, &min_y, &max_x, &max_y, &verified)
+	|| row_count != 2 || min_x != 1.0 || min_y != 1.0 || max_x != 5.0
+	|| max_y != 5.0 || !verified)
+      {
+	  fprintf (stderr, "IncrementalStatistics #1: unexpected stats\n");
+	  return -342;
+      }
+
+/* INSERT: row_count and extent grow, still valid */
+    ret =
+	sqlite3_exec (handle,
+		      "INSERT INTO stats_pts VALUES (3, 30, MakePoint(50, -7, 4326))",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "INSERT stats_pts error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -343;
+      }
+    if (!get_layer_stats
+	(handle, &row_count, &min_x, &min_y, &max_x, &max_y, &verified)
+	|| row_count != 3 || min_x != 1.0 || min_y != -7.0 || max_x != 50.0
+	|| max_y != 5.0 || !verified)
+      {
+	  fprintf (stderr, "IncrementalStatistics #2: unexpected stats\n");
+	  return -344;
+      }
+
+/* UPDATE leaving the extent-touching geometry unchanged: still valid */
+    ret =
+	sqlite3_exec (handle, "UPDATE stats_pts SET val = 25 WHERE id = 2",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "UPDATE stats_pts error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -345;
+      }
+    if (!get_layer_stats
+	(handle, &row_count, &min_x, &min_y, &max_x, &max_y, &verified)
+	|| row_count != 3 || !verified)
+      {
+	  fprintf (stderr, "IncrementalStatistics #3: unexpected stats\n");
+	  return -346;
+      }
+
+/* DELETE of the row defining the extent: invalidated */
+    ret =
+	sqlite3_exec (handle, "DELETE FROM stats_pts WHERE id = 3", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "DELETE stats_pts error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -347;
+      }
+    if (!get_layer_stats
+	(handle, &row_count, &min_x, &min_y, &max_x, &max_y, &verified)
+	|| row_count != 2 || verified)
+      {
+	  fprintf (stderr, "IncrementalStatistics #4: unexpected stats\n");
+	  return -348;
+      }
+
+/* the next UpdateLayerStatistics() shrinks the extent */
+    ret =
+	sqlite3_exec (handle,
+		      "SELECT UpdateLayerStatistics('stats_pts', 'geom')",
+		      NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "UpdateLayerStatistics stats_pts error: %s\n",
+		   err_msg);
+	  sqlite3_free (err_msg);
+	  return -349;
+      }
+    if (!get_layer_stats
+	(handle, &row_count, &min_x, &min_y, &max_x, &max_y, &verified)
+	|| row_count != 2 || min_x != 1.0 || min_y != 1.0 || max_x != 5.0
+	|| max_y != 5.0 || !verified)
+      {
+	  fprintf (stderr, "IncrementalStatistics #5: unexpected stats\n");
+	  return -350;
+      }
+
+    return 0;
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -1761,6 +2152,22 @@ main (int argc, char *argv[])
 	  return ret;
       }
 
+    ret = do_test_cache (handle);
+    if (ret != 0)
+      {
+	  fprintf (stderr,
+		   "error while testing the VirtualSpatialIndex cache\n");
+	  return ret;
+      }
+
+    ret = do_test_incremental_stats (handle);
+    if (ret != 0)
+      {
+	  fprintf (stderr,
+		   "error while testing the incremental Layer Statistics\n");
+	  return ret;
+      }
+
     ret = sqlite3_close (handle);
     if (ret != SQLITE_OK)
       {
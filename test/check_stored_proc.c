@@ -1903,6 +1903,48 @@ do_level9_tests (sqlite3 * handle, int *retcode)
       }
     sqlite3_free_table (results);
 
+/* checking the execution statistics of the cached SQL Body
+/ (shared with Level 8: 125 + 250 executions) */
+    sql = "SELECT SqlProc_CacheStats(sql_proc), "
+	"SqlProc_CacheStats(sql_proc, 'statements'), "
+	"SqlProc_CacheStats(sql_proc, 'executions', 2), "
+	"SqlProc_CacheStats(sql_proc, 'seconds') >= "
+	"SqlProc_CacheStats(sql_proc, 'seconds', 2), "
+	"SqlProc_CacheStats(sql_proc, 'executions', 4) IS NULL, "
+	"SqlProc_CacheStats(SqlProc_FromText('SELECT 1;')) IS NULL "
+	"FROM stored_procedures WHERE name = 'proc_loop'";
+    ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "SqlProc_CacheStats() #1 error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  *retcode = -156;
+	  return 0;
+      }
+    if (rows != 1 || columns != 6)
+      {
+	  fprintf (stderr,
+		   "SqlProc_CacheStats() #1 error: rows=%d columns=%d\n",
+		   rows, columns);
+	  sqlite3_free_table (results);
+	  *retcode = -157;
+	  return 0;
+      }
+    if (*(results + 6) == NULL || atoi (*(results + 6)) != 375
+	|| atoi (*(results + 7)) != 3 || *(results + 8) == NULL
+	|| atoi (*(results + 8)) != 375 || atoi (*(results + 9)) != 1
+	|| atoi (*(results + 10)) != 1 || atoi (*(results + 11)) != 1)
+      {
+	  fprintf (stderr,
+		   "SqlProc_CacheStats() #1 unexpected result: %s|%s|%s|%s|%s|%s\n",
+		   *(results + 6), *(results + 7), *(results + 8),
+		   *(results + 9), *(results + 10), *(results + 11));
+	  sqlite3_free_table (results);
+	  *retcode = -158;
+	  return 0;
+      }
+    sqlite3_free_table (results);
+
     return 1;
 }
 
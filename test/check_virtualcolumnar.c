@@ -0,0 +1,285 @@
+/*
+
+ check_virtualcolumnar.c -- SpatiaLite Test Case
+
+ Author: Sandro Furieri <a.furieri@lqt.it>
+
+ ------------------------------------------------------------------------------
+ 
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+ 
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+ 
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+ 
+Portions created by the Initial Developer are Copyright (C) 2026
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+ 
+*/
+#define _GNU_SOURCE
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <spatialite/gaiaconfig.h>
+
+#include "sqlite3.h"
+#include "spatialite.h"
+
+#ifndef OMIT_ICONV		/* only if ICONV is supported */
+static int
+create_table (sqlite3 * handle)
+{
+/* creating and populating the test table */
+    int ret;
+    char *err_msg = NULL;
+    const char *sql =
+	"CREATE TABLE test (id INTEGER PRIMARY KEY, num INTEGER, "
+	"val DOUBLE, name TEXT, data BLOB, geom BLOB);"
+	"INSERT INTO test VALUES (1, 10, 1.5, 'alpha', x'0102', "
+	"GeomFromText('POINT(1.5 2.25)', 4326));"
+	"INSERT INTO test VALUES (2, NULL, -0.125, 'Citt\xc3\xa0', NULL, "
+	"GeomFromText('LINESTRING(0 0, 10.5 -3.25, 20 7.125)', 4326));"
+	"INSERT INTO test VALUES (3, -3, NULL, NULL, x'', "
+	"GeomFromText('POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), "
+	"(2 2, 3 2, 3 3, 2 3, 2 2))', 4326));"
+	"INSERT INTO test VALUES (4, 9007199254740993, 1e300, '', x'ff', NULL);"
+	"INSERT INTO test VALUES (5, 0, 0.0, 'multi', NULL, "
+	"GeomFromText('MULTIPOINT(1 1, -2.5 3.75)', 4326));"
+	"INSERT INTO test VALUES (6, 6, 6.5, 'multi line', NULL, "
+	"GeomFromText('MULTILINESTRING((1 1, 2 2), (3 3, 4 4, 5 5))', 4326));"
+	"INSERT INTO test VALUES (7, 7, 7.5, 'collection', NULL, "
+	"GeomFromText('GEOMETRYCOLLECTION(POINT(1 2), LINESTRING(3 4, 5 6), "
+	"POLYGON((0 0, 1 0, 1 1, 0 0)))', 4326));"
+	"INSERT INTO test VALUES (8, 8, 8.5, 'xyz', NULL, "
+	"GeomFromText('LINESTRINGZ(1 2 3, 4 5 6.5)', 4326));"
+	"INSERT INTO test VALUES (9, 9, 9.5, 'xyzm', NULL, "
+	"GeomFromText('POINTZM(1 2 3 4)', 4326));";
+
+    ret = sqlite3_exec (handle, sql, NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE TABLE test error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+check_columnar (sqlite3 * handle, const char *path, int compressed,
+		int chunk_rows)
+{
+/* exporting a Columnar file and reading it back via VirtualColumnar */
+    int ret;
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+    int row_count;
+    char *sql;
+
+    ret =
+	dump_columnar (handle, "test", "geom", (char *) path, compressed, 6,
+		       chunk_rows, &row_count);
+    if (!ret || row_count != 9)
+      {
+	  fprintf (stderr, "dump_columnar error: %d\n", row_count);
+	  return -10;
+      }
+
+    sql =
+	sqlite3_mprintf
+	("CREATE VIRTUAL TABLE col USING VirtualColumnar('%q')", path);
+    ret = sqlite3_exec (handle, sql, NULL, NULL, &err_msg);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE VIRTUAL TABLE col error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -11;
+      }
+
+/* every row, attribute and Geometry should survive the round trip */
+    ret =
+	sqlite3_get_table (handle,
+			   "SELECT Count(*), Sum(b.ROWID), "
+			   "Sum(typeof(b.num) = typeof(a.num)) "
+			   "FROM test AS a JOIN col AS b ON (a.id = b.id "
+			   "AND a.num IS b.num AND a.val IS b.val "
+			   "AND a.name IS b.name AND a.data IS b.data "
+			   "AND ST_AsText(a.geom) IS ST_AsText(b.geom) "
+			   "AND ST_Srid(a.geom) IS ST_Srid(b.geom) "
+			   "AND GeometryType(a.geom) IS GeometryType(b.geom))",
+			   &results, &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualColumnar SELECT error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -12;
+      }
+    if (rows != 1 || strcmp (results[3], "9") != 0
+	|| strcmp (results[4], "45") != 0 || strcmp (results[5], "9") != 0)
+      {
+	  fprintf (stderr,
+		   "unexpected VirtualColumnar result (%d/%d): %s %s %s\n",
+		   compressed, chunk_rows, results[3], results[4], results[5]);
+	  sqlite3_free_table (results);
+	  return -13;
+      }
+    sqlite3_free_table (results);
+
+/* a VirtualColumnar table is always read-only */
+    ret =
+	sqlite3_exec (handle, "DELETE FROM col WHERE id = 1", NULL, NULL,
+		      &err_msg);
+    if (ret == SQLITE_OK)
+      {
+	  fprintf (stderr, "VirtualColumnar DELETE unexpected success\n");
+	  return -14;
+      }
+    sqlite3_free (err_msg);
+
+    ret = sqlite3_exec (handle, "DROP TABLE col", NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "DROP TABLE col error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -15;
+      }
+    unlink (path);
+    return 0;
+}
+
+static int
+check_invalid (sqlite3 * handle, const char *path)
+{
+/* a corrupted Columnar file must never be accepted */
+    int ret;
+    char *err_msg = NULL;
+    char **results;
+    int rows;
+    int columns;
+    char *sql;
+    FILE *out = fopen (path, "wb");
+    if (out == NULL)
+	return -20;
+    fwrite ("SPLCOL01\x01\x00", 1, 10, out);
+    fclose (out);
+
+    sql =
+	sqlite3_mprintf
+	("CREATE VIRTUAL TABLE bad USING VirtualColumnar('%q')", path);
+    ret = sqlite3_exec (handle, sql, NULL, NULL, &err_msg);
+    sqlite3_free (sql);
+    unlink (path);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE VIRTUAL TABLE bad error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -21;
+      }
+    ret =
+	sqlite3_get_table (handle, "SELECT Count(*) FROM bad", &results, &rows,
+			   &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "SELECT FROM bad error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -22;
+      }
+    if (rows != 1 || strcmp (results[1], "0") != 0)
+      {
+	  fprintf (stderr, "unexpected invalid VirtualColumnar result: %s\n",
+		   results[1]);
+	  sqlite3_free_table (results);
+	  return -23;
+      }
+    sqlite3_free_table (results);
+    sqlite3_exec (handle, "DROP TABLE bad", NULL, NULL, NULL);
+    return 0;
+}
+#endif
+
+int
+main (int argc, char *argv[])
+{
+    int ret;
+    sqlite3 *handle;
+    void *cache = spatialite_alloc_connection ();
+
+    if (argc > 1 || argv[0] == NULL)
+	argc = 1;		/* silencing stupid compiler warnings */
+
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory db: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  return -1;
+      }
+
+    spatialite_init_ex (handle, cache, 0);
+
+#ifndef OMIT_ICONV		/* only if ICONV is supported */
+    if (!create_table (handle))
+      {
+	  sqlite3_close (handle);
+	  return -2;
+      }
+
+/* plain doubles, a single chunk */
+    ret = check_columnar (handle, "columnar_test.col", 0, 0);
+    if (ret != 0)
+	goto end;
+/* plain doubles, many chunks */
+    ret = check_columnar (handle, "columnar_test.col", 0, 2);
+    if (ret != 0)
+	goto end;
+/* quantized deltas, a single chunk */
+    ret = check_columnar (handle, "columnar_test.col", 1, 0);
+    if (ret != 0)
+	goto end;
+/* quantized deltas, many chunks */
+    ret = check_columnar (handle, "columnar_test.col", 1, 3);
+    if (ret != 0)
+	goto end;
+/* corrupted file */
+    ret = check_invalid (handle, "columnar_bad.col");
+
+  end:
+#endif /* end ICONV conditional */
+
+    sqlite3_close (handle);
+    spatialite_cleanup_ex (cache);
+    spatialite_shutdown ();
+    return ret;
+}
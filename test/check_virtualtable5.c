@@ -86,6 +86,9 @@ struct test_step steps[] = {
     {"select Length, HOEHE from dbftest WHERE HOEHE > -1;", 18},
     {"select Length, HOEHE from dbftest WHERE HOEHE < -1;", 0},
     {"select Length, HOEHE from dbftest WHERE HOEHE <= -1;", 0},
+    {"select PKUID from dbftest WHERE Length > 0.1;", 10},
+    {"select TEXT_DIL from dbftest WHERE TEXT_DIL = 'VIA DANTE ALIGHIERI -STRASSE';", 18},
+    {"select a.PKUID from dbftest AS a, dbftest AS b WHERE a.PKUID = b.PKUID AND a.TEXT_DIL = b.TEXT_DIL AND a.Length = b.Length;", 18},
     {NULL, 0}
 };
 
@@ -51,6 +51,182 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "spatialite.h"
 #include "spatialite/gg_wfs.h"
 
+#ifdef ENABLE_LIBXML2		/* only if LIBXML2 is supported */
+#include <libxml/xmlversion.h>
+#if defined(LIBXML_HTTP_ENABLED) && !defined(_WIN32)
+#define TEST_WFS_HTTP
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+static const char *
+find_query_arg (const char *query, const char *name)
+{
+/* searching a query argument */
+    const char *p = query;
+    int len = strlen (name);
+    while (p != NULL)
+      {
+	  if (strncmp (p, name, len) == 0 && p[len] == '=')
+	      return p + len + 1;
+	  p = strchr (p, '&');
+	  if (p != NULL)
+	      p++;
+      }
+    return NULL;
+}
+
+static void
+serve_http_request (int sock)
+{
+/*
+/ a minimal HTTP stand-in: serving a local file for each GET request
+/
+/ when "startIndex" and "count" (or "maxFeatures") are requested
+/ only the corresponding slice of <gml:featureMember> elements
+/ will be returned, and later pages will be served faster than
+/ earlier ones so to shuffle the order of completion
+*/
+    char request[4096];
+    char path[1024];
+    char buf[8192];
+    char *query = NULL;
+    char *doc;
+    char *first;
+    char *last;
+    char *p;
+    const char *arg;
+    const char *member = "<gml:featureMember>";
+    const char *member_end = "</gml:featureMember>";
+    int start_index = -1;
+    int count = -1;
+    int index;
+    int len;
+    FILE *in;
+    long size;
+
+    len = recv (sock, request, sizeof (request) - 1, 0);
+    if (len <= 0)
+	return;
+    request[len] = '\0';
+    if (sscanf (request, "GET /%1000s", path) != 1)
+	return;
+    p = strchr (path, '?');
+    if (p != NULL)
+      {
+	  *p = '\0';
+	  query = p + 1;
+	  arg = find_query_arg (query, "startIndex");
+	  if (arg != NULL)
+	      start_index = atoi (arg);
+	  arg = find_query_arg (query, "count");
+	  if (arg == NULL)
+	      arg = find_query_arg (query, "maxFeatures");
+	  if (arg != NULL)
+	      count = atoi (arg);
+      }
+    in = fopen (path, "rb");
+    if (in == NULL)
+      {
+	  const char *msg = "HTTP/1.0 404 Not Found\r\n\r\n";
+	  send (sock, msg, strlen (msg), 0);
+	  return;
+      }
+    fseek (in, 0, SEEK_END);
+    size = ftell (in);
+    fseek (in, 0, SEEK_SET);
+    doc = malloc (size + 1);
+    size = fread (doc, 1, size, in);
+    doc[size] = '\0';
+    fclose (in);
+
+    first = strstr (doc, member);
+    if (start_index >= 0 && count > 0 && first != NULL)
+      {
+	  /* slicing the requested page */
+	  char *tail = first;
+	  char *out = first;
+	  usleep ((10 - start_index % 10) * 20000);
+	  p = first;
+	  index = 0;
+	  while ((p = strstr (p, member)) != NULL)
+	    {
+		last = strstr (p, member_end);
+		if (last == NULL)
+		    break;
+		last += strlen (member_end);
+		if (index >= start_index && index < start_index + count)
+		  {
+		      memmove (out, p, last - p);
+		      out += last - p;
+		  }
+		index++;
+		p = last;
+		tail = last;
+	    }
+	  memmove (out, tail, strlen (tail) + 1);
+	  size = strlen (doc);
+      }
+
+    len = sprintf (buf, "HTTP/1.0 200 OK\r\nContent-Type: text/xml\r\n"
+		   "Content-Length: %ld\r\n\r\n", size);
+    send (sock, buf, len, 0);
+    send (sock, doc, size, 0);
+    free (doc);
+}
+
+static pid_t
+start_http_server (int *port)
+{
+/* starting the HTTP stand-in server on some free local port */
+    struct sockaddr_in addr;
+    socklen_t addr_len = sizeof (addr);
+    pid_t pid;
+    int sock = socket (AF_INET, SOCK_STREAM, 0);
+    if (sock < 0)
+	return -1;
+    memset (&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = inet_addr ("127.0.0.1");
+    addr.sin_port = 0;
+    if (bind (sock, (struct sockaddr *) &addr, sizeof (addr)) != 0
+	|| listen (sock, 8) != 0
+	|| getsockname (sock, (struct sockaddr *) &addr, &addr_len) != 0)
+      {
+	  close (sock);
+	  return -1;
+      }
+    *port = ntohs (addr.sin_port);
+    pid = fork ();
+    if (pid == 0)
+      {
+	  /* child process: serving requests until killed */
+	  signal (SIGCHLD, SIG_IGN);
+	  while (1)
+	    {
+		int conn = accept (sock, NULL, NULL);
+		if (conn < 0)
+		    continue;
+		if (fork () == 0)
+		  {
+		      /* each request is served by its own process */
+		      close (sock);
+		      serve_http_request (conn);
+		      close (conn);
+		      _exit (0);
+		  }
+		close (conn);
+	    }
+      }
+    close (sock);
+    return pid;
+}
+#endif
+#endif /* end LIBXML2 conditional */
+
 int
 main (int argc, char *argv[])
 {
@@ -70,6 +246,10 @@ main (int argc, char *argv[])
     int type;
     int dims;
     int nillable;
+#endif
+#ifdef TEST_WFS_HTTP
+    pid_t http_pid;
+    int http_port;
 #endif
     void *cache = spatialite_alloc_connection ();
 
@@ -811,6 +991,96 @@ main (int argc, char *argv[])
       }
     destroy_wfs_schema (NULL);
 
+#ifdef TEST_WFS_HTTP
+/* streaming the very same payload from an HTTP server */
+    setenv ("no_proxy", "*", 1);
+    http_pid = start_http_server (&http_port);
+    if (http_pid > 0)
+      {
+	  char *url =
+	      sqlite3_mprintf ("http://127.0.0.1:%d/test.wfs", http_port);
+	  ret =
+	      load_from_wfs (handle, url, NULL, "topp:p02", 0, "test_wfs3",
+			     "objectid", 1, &row_count, &err_msg, NULL, NULL);
+	  sqlite3_free (url);
+	  kill (http_pid, SIGTERM);
+	  waitpid (http_pid, NULL, 0);
+	  if (!ret)
+	    {
+		fprintf (stderr, "load_from_wfs() error for HTTP: %s\n",
+			 err_msg);
+		free (err_msg);
+		sqlite3_close (handle);
+		return -78;
+	    }
+	  if (row_count != 3)
+	    {
+		fprintf (stderr, "unexpected row count for HTTP: %i\n",
+			 row_count);
+		sqlite3_close (handle);
+		return -79;
+	    }
+      }
+
+/* concurrently fetching one feature per page */
+    http_pid = start_http_server (&http_port);
+    if (http_pid > 0)
+      {
+	  char **results;
+	  int rows;
+	  int columns;
+	  char *url = sqlite3_mprintf ("http://127.0.0.1:%d/test.wfs?"
+				       "service=WFS&request=GetFeature",
+				       http_port);
+	  ret =
+	      load_from_wfs_paged_mt (handle, "2.0.0", url, NULL, "topp:p02", 0,
+				      "test_wfs4", NULL, 1, 1, 2, &row_count,
+				      &err_msg, NULL, NULL);
+	  sqlite3_free (url);
+	  kill (http_pid, SIGTERM);
+	  waitpid (http_pid, NULL, 0);
+	  if (!ret)
+	    {
+		fprintf (stderr, "load_from_wfs_paged_mt() error: %s\n",
+			 err_msg);
+		free (err_msg);
+		sqlite3_close (handle);
+		return -80;
+	    }
+	  if (row_count != 3)
+	    {
+		fprintf (stderr,
+			 "unexpected row count for load_from_wfs_paged_mt: %i\n",
+			 row_count);
+		sqlite3_close (handle);
+		return -81;
+	    }
+	  /* pages must be inserted following the document order */
+	  ret =
+	      sqlite3_get_table (handle,
+				 "SELECT group_concat(objectid) FROM "
+				 "(SELECT objectid FROM test_wfs4 ORDER BY PK_UID)",
+				 &results, &rows, &columns, &err_msg);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "Error: %s\n", err_msg);
+		sqlite3_free (err_msg);
+		sqlite3_close (handle);
+		return -82;
+	    }
+	  if (rows != 1 || results[1] == NULL
+	      || strcmp (results[1], "400041,401591,401672") != 0)
+	    {
+		fprintf (stderr, "unexpected page order: %s\n",
+			 rows == 1 ? results[1] : "?");
+		sqlite3_free_table (results);
+		sqlite3_close (handle);
+		return -83;
+	    }
+	  sqlite3_free_table (results);
+      }
+#endif
+
 #endif /* end LIBXML2 conditional */
 
     ret = sqlite3_close (handle);
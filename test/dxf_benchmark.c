@@ -0,0 +1,275 @@
+/*
+
+ dxf_benchmark.c -- SpatiaLite DXF import benchmark
+
+ Author: Sandro Furieri <a.furieri@lqt.it>
+
+ ------------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2013
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+
+/*
+/ generating a synthetic DXF drawing of arbitrary size, then measuring
+/ the time required in order to import it into an in-memory DB
+/
+/ usage: dxf_benchmark output.dxf [blocks [inserts [hatches]]]
+/
+/ - blocks:  number of Block definitions (default 1000)
+/ - inserts: number of INSERT entities referencing some Block (default 50000)
+/ - hatches: number of pattern filled HATCH entities (default 2000)
+/
+/ doubling the figures should roughly double the timings; any
+/ quadratic behaviour will become immediately evident.
+/ this program is not run by "make check"; use "make dxf_benchmark"
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if !defined(_WIN32) || defined(__MINGW32__)
+#include <sys/time.h>
+#endif
+
+#include <spatialite/gaiaconfig.h>
+
+#include "sqlite3.h"
+#include "spatialite.h"
+#include "spatialite/gg_dxf.h"
+
+static void
+write_square (FILE * out, const char *layer, double x, double y, double side)
+{
+/* a square made of four LINE entities */
+    double x1 = x + side;
+    double y1 = y + side;
+    fprintf (out, "  0\nLINE\n  8\n%s\n", layer);
+    fprintf (out, " 10\n%1.3f\n 20\n%1.3f\n 30\n0.0\n", x, y);
+    fprintf (out, " 11\n%1.3f\n 21\n%1.3f\n 31\n0.0\n", x1, y);
+    fprintf (out, "  0\nLINE\n  8\n%s\n", layer);
+    fprintf (out, " 10\n%1.3f\n 20\n%1.3f\n 30\n0.0\n", x1, y);
+    fprintf (out, " 11\n%1.3f\n 21\n%1.3f\n 31\n0.0\n", x1, y1);
+    fprintf (out, "  0\nLINE\n  8\n%s\n", layer);
+    fprintf (out, " 10\n%1.3f\n 20\n%1.3f\n 30\n0.0\n", x1, y1);
+    fprintf (out, " 11\n%1.3f\n 21\n%1.3f\n 31\n0.0\n", x, y1);
+    fprintf (out, "  0\nLINE\n  8\n%s\n", layer);
+    fprintf (out, " 10\n%1.3f\n 20\n%1.3f\n 30\n0.0\n", x, y1);
+    fprintf (out, " 11\n%1.3f\n 21\n%1.3f\n 31\n0.0\n", x, y);
+}
+
+static void
+write_hatch_edge (FILE * out, double x0, double y0, double x1, double y1)
+{
+/* a single straight edge of some Hatch boundary */
+    fprintf (out, " 72\n     1\n");
+    fprintf (out, " 10\n%1.3f\n 20\n%1.3f\n", x0, y0);
+    fprintf (out, " 11\n%1.3f\n 21\n%1.3f\n", x1, y1);
+}
+
+static void
+write_hatch (FILE * out, const char *layer, double x, double y, double side)
+{
+/* a square Hatch filled by slant pattern lines */
+    double x1 = x + side;
+    double y1 = y + side;
+    fprintf (out, "  0\nHATCH\n  8\n%s\n", layer);
+    fprintf (out, " 10\n0.0\n 20\n0.0\n 30\n0.0\n");
+    fprintf (out, "  2\nANSI31\n 70\n     0\n 71\n     0\n 91\n     1\n");
+    fprintf (out, " 92\n         1\n 93\n         4\n");
+    write_hatch_edge (out, x, y, x1, y);
+    write_hatch_edge (out, x1, y, x1, y1);
+    write_hatch_edge (out, x1, y1, x, y1);
+    write_hatch_edge (out, x, y1, x, y);
+    fprintf (out, " 97\n         0\n 75\n     0\n 76\n     1\n");
+    fprintf (out, " 52\n0.0\n 41\n1.0\n 77\n     0\n 78\n     1\n");
+    fprintf (out, " 53\n45.0\n 43\n0.0\n 44\n0.0\n");
+    fprintf (out, " 45\n-0.7071067811865475\n 46\n0.7071067811865476\n");
+    fprintf (out, " 79\n     0\n 98\n         0\n");
+}
+
+static int
+write_dxf (const char *path, int blocks, int inserts, int hatches)
+{
+/* generating the synthetic DXF drawing */
+    int i;
+    FILE *out = fopen (path, "wb");
+    if (out == NULL)
+      {
+	  fprintf (stderr, "unable to create \"%s\"\n", path);
+	  return 0;
+      }
+
+/* the Layers table */
+    fprintf (out, "  0\nSECTION\n  2\nTABLES\n  0\nTABLE\n  2\nLAYER\n");
+    fprintf (out, " 70\n     2\n");
+    fprintf (out, "  0\nLAYER\n  2\nBENCH_BLOCK\n 70\n    64\n 62\n     7\n");
+    fprintf (out, "  0\nLAYER\n  2\nBENCH_HATCH\n 70\n    64\n 62\n     7\n");
+    fprintf (out, "  0\nENDTAB\n  0\nENDSEC\n");
+
+/* the Block definitions */
+    fprintf (out, "  0\nSECTION\n  2\nBLOCKS\n");
+    for (i = 0; i < blocks; i++)
+      {
+	  fprintf (out, "  0\nBLOCK\n  8\nBENCH_BLOCK\n  2\nBLK%06d\n", i);
+	  fprintf (out, " 70\n    64\n 10\n0.0\n 20\n0.0\n 30\n0.0\n");
+	  write_square (out, "BENCH_BLOCK", 0.0, 0.0, 1.0 + (i % 10));
+	  fprintf (out, "  0\nENDBLK\n  8\nBENCH_BLOCK\n");
+      }
+    fprintf (out, "  0\nENDSEC\n");
+
+/* the Entities */
+    fprintf (out, "  0\nSECTION\n  2\nENTITIES\n");
+    for (i = 0; i < inserts; i++)
+      {
+	  fprintf (out, "  0\nINSERT\n  8\nBENCH_BLOCK\n  2\nBLK%06d\n",
+		   (blocks > 0) ? (i * 7919) % blocks : 0);
+	  fprintf (out, " 10\n%1.3f\n 20\n%1.3f\n 30\n0.0\n",
+		   (double) ((i % 1000) * 20), (double) ((i / 1000) * 20));
+      }
+    for (i = 0; i < hatches; i++)
+	write_hatch (out, "BENCH_HATCH", (double) ((i % 100) * 200),
+		     (double) ((i / 100) * 200), 50.0 + (i % 100));
+    fprintf (out, "  0\nENDSEC\n  0\nEOF\n");
+    fclose (out);
+    return 1;
+}
+
+#ifndef OMIT_GEOS		/* only if GEOS is enabled */
+
+static double
+now (void)
+{
+/* wall-clock time in seconds */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return (double) clock () / (double) CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday (&tv, NULL);
+    return (double) tv.tv_sec + ((double) tv.tv_usec / 1000000.0);
+#endif
+}
+
+static int
+load_dxf (const char *path)
+{
+/* importing the DXF drawing into an in-memory DB */
+    int ret;
+    sqlite3 *handle;
+    gaiaDxfParserPtr dxf;
+    double start;
+    void *cache = spatialite_alloc_connection ();
+
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory database: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  return 0;
+      }
+    spatialite_init_ex (handle, cache, 0);
+    sqlite3_exec (handle, "SELECT InitSpatialMetadata(1)", NULL, NULL, NULL);
+
+/* parsing only */
+    dxf =
+	gaiaCreateDxfParser (-2, GAIA_DXF_AUTO_2D_3D, NULL, NULL,
+			     GAIA_DXF_RING_NONE);
+    start = now ();
+    ret = gaiaParseDxfFile_r (cache, dxf, path);
+    fprintf (stderr, "parse: %1.3f sec\n", now () - start);
+    gaiaDestroyDxfParser (dxf);
+    if (!ret)
+      {
+	  fprintf (stderr, "unable to parse \"%s\"\n", path);
+	  goto stop;
+      }
+
+/* parsing and loading */
+    dxf =
+	gaiaCreateDxfParser (-2, GAIA_DXF_AUTO_2D_3D, NULL, NULL,
+			     GAIA_DXF_RING_NONE);
+    start = now ();
+    ret =
+	gaiaStreamDxfFile_r (cache, handle, dxf, path,
+			     GAIA_DXF_IMPORT_BY_LAYER, 0);
+    fprintf (stderr, "parse+load: %1.3f sec\n", now () - start);
+    gaiaDestroyDxfParser (dxf);
+    if (!ret)
+	fprintf (stderr, "unable to load \"%s\"\n", path);
+
+  stop:
+    sqlite3_close (handle);
+    spatialite_cleanup_ex (cache);
+    return ret;
+}
+
+#endif /* GEOS enabled */
+
+int
+main (int argc, char *argv[])
+{
+    int blocks = 1000;
+    int inserts = 50000;
+    int hatches = 2000;
+    if (argc < 2)
+      {
+	  fprintf (stderr,
+		   "usage: %s output.dxf [blocks [inserts [hatches]]]\n",
+		   argv[0]);
+	  return -1;
+      }
+    if (argc > 2)
+	blocks = atoi (argv[2]);
+    if (argc > 3)
+	inserts = atoi (argv[3]);
+    if (argc > 4)
+	hatches = atoi (argv[4]);
+
+    if (!write_dxf (argv[1], blocks, inserts, hatches))
+	return -2;
+    fprintf (stderr, "%s: %d blocks, %d inserts, %d hatches\n", argv[1],
+	     blocks, inserts, hatches);
+
+#ifndef OMIT_GEOS		/* only if GEOS is enabled */
+    if (!load_dxf (argv[1]))
+	return -3;
+#endif /* GEOS enabled */
+
+    spatialite_shutdown ();
+    return 0;
+}
@@ -0,0 +1,234 @@
+/*
+
+ gpkg_benchmark.c -- SpatiaLite GeoPackage Binary decoding benchmark
+
+ Author: Sandro Furieri <a.furieri@lqt.it>
+
+ ------------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2013
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+
+
+/*
+/ building a table of Linestrings stored both as native SpatiaLite BLOBs
+/ and as GeoPackage Binary (GPB) BLOBs, then comparing the time required
+/ in order to retrieve their MBRs and to fully decode them
+/
+/ usage: gpkg_benchmark [rows [vertices]]
+/
+/ - rows:     number of Linestrings (default 100000)
+/ - vertices: number of vertices for each Linestring (default 16)
+/
+/ the GPB MBRs are directly read from the header Envelope, so they
+/ should be about as fast as the native ones whatever the vertex count.
+/ this program is not run by "make check"; use "make gpkg_benchmark"
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if !defined(_WIN32) || defined(__MINGW32__)
+#include <sys/time.h>
+#endif
+
+#include <spatialite/gaiaconfig.h>
+
+#include "sqlite3.h"
+#include "spatialite.h"
+
+#ifdef ENABLE_GEOPACKAGE	/* only if GEOPACKAGE is enabled */
+
+static double
+now (void)
+{
+/* wall-clock time in seconds */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return (double) clock () / (double) CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday (&tv, NULL);
+    return (double) tv.tv_sec + ((double) tv.tv_usec / 1000000.0);
+#endif
+}
+
+static int
+timed_query (sqlite3 * handle, const char *title, const char *sql,
+	     double *value)
+{
+/* timing a query returning a single numeric value */
+    int ret;
+    sqlite3_stmt *stmt;
+    double start;
+
+    ret = sqlite3_prepare_v2 (handle, sql, -1, &stmt, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "%s error: %s\n", title, sqlite3_errmsg (handle));
+	  return 0;
+      }
+    start = now ();
+    ret = sqlite3_step (stmt);
+    if (ret == SQLITE_ROW)
+	*value = sqlite3_column_double (stmt, 0);
+    fprintf (stderr, "%s: %1.3f sec\n", title, now () - start);
+    sqlite3_finalize (stmt);
+    if (ret != SQLITE_ROW)
+      {
+	  fprintf (stderr, "%s error: %s\n", title, sqlite3_errmsg (handle));
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+gpkg_benchmark (int rows, int vertices)
+{
+/* native vs GPB: MBR retrieval and full decoding */
+    int ret;
+    sqlite3 *handle;
+    char *err_msg = NULL;
+    char *sql;
+    double native;
+    double gpb;
+    void *cache = spatialite_alloc_connection ();
+
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory db: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  spatialite_cleanup_ex (cache);
+	  return 0;
+      }
+    spatialite_init_ex (handle, cache, 0);
+
+/* the same Linestrings in both formats */
+    sql =
+	sqlite3_mprintf
+	("CREATE TABLE bench AS WITH RECURSIVE "
+	 "r(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM r WHERE i < %d), "
+	 "v(j) AS (SELECT 1 UNION ALL SELECT j + 1 FROM v WHERE j < %d) "
+	 "SELECT i AS id, MakeLine(MakePoint(i + j * 0.001, "
+	 "i - j * 0.002, 4326)) AS geom FROM r, v GROUP BY i", rows,
+	 vertices);
+    ret = sqlite3_exec (handle, sql, NULL, NULL, &err_msg);
+    sqlite3_free (sql);
+    if (ret == SQLITE_OK)
+	ret =
+	    sqlite3_exec (handle,
+			  "ALTER TABLE bench ADD COLUMN gpb BLOB; "
+			  "UPDATE bench SET gpb = AsGPB(geom)", NULL, NULL,
+			  &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE TABLE bench error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  goto error;
+      }
+
+/* MBR retrieval */
+    if (!timed_query
+	(handle, "native MBR",
+	 "SELECT Sum(MbrMinX(geom) + MbrMaxX(geom) + MbrMinY(geom) + "
+	 "MbrMaxY(geom)) FROM bench", &native))
+	goto error;
+    if (!timed_query
+	(handle, "GPB MBR",
+	 "SELECT Sum(MbrMinX(gpb) + MbrMaxX(gpb) + MbrMinY(gpb) + "
+	 "MbrMaxY(gpb)) FROM bench", &gpb))
+	goto error;
+    if (native != gpb)
+      {
+	  fprintf (stderr, "mismatching MBRs: %1.6f %1.6f\n", native, gpb);
+	  goto error;
+      }
+
+/* full decoding */
+    if (!timed_query
+	(handle, "native decode",
+	 "SELECT Sum(ST_NumPoints(geom)) FROM bench", &native))
+	goto error;
+    if (!timed_query
+	(handle, "GPB decode",
+	 "SELECT Sum(ST_NumPoints(GeomFromGPB(gpb))) FROM bench", &gpb))
+	goto error;
+    if (native != gpb)
+      {
+	  fprintf (stderr, "mismatching vertex counts: %1.0f %1.0f\n", native,
+		   gpb);
+	  goto error;
+      }
+
+    sqlite3_close (handle);
+    spatialite_cleanup_ex (cache);
+    return 1;
+
+  error:
+    sqlite3_close (handle);
+    spatialite_cleanup_ex (cache);
+    return 0;
+}
+
+#endif /* end GEOPACKAGE conditional */
+
+int
+main (int argc, char *argv[])
+{
+    int rows = 100000;
+    int vertices = 16;
+    if (argc > 1)
+	rows = atoi (argv[1]);
+    if (argc > 2)
+	vertices = atoi (argv[2]);
+    if (rows < 1 || vertices < 2)
+      {
+	  fprintf (stderr, "usage: %s [rows [vertices]]\n", argv[0]);
+	  return -1;
+      }
+    fprintf (stderr, "%d Linestrings, %d vertices each\n", rows, vertices);
+
+#ifdef ENABLE_GEOPACKAGE	/* only if GEOPACKAGE is enabled */
+    if (!gpkg_benchmark (rows, vertices))
+	return -2;
+#endif /* end GEOPACKAGE conditional */
+
+    spatialite_shutdown ();
+    return 0;
+}
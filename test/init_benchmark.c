@@ -0,0 +1,241 @@
+/*
+
+ init_benchmark.c -- SpatiaLite connection initialization benchmark
+
+ Author: Sandro Furieri <a.furieri@lqt.it>
+
+ ------------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2013
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+
+
+/*
+/ measuring the average time required in order to open a connection
+/ (alloc + open + init + close + cleanup), then comparing full and lazy
+/ MetaData initialization on real DB-files: creation time and size
+/
+/ usage: init_benchmark [loops]
+/
+/ - loops: number of repetitions being averaged (default 64)
+/
+/ this program is not run by "make check"; use "make init_benchmark"
+*/
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if !defined(_WIN32) || defined(__MINGW32__)
+#include <sys/time.h>
+#endif
+
+#include "sqlite3.h"
+#include "spatialite.h"
+
+static double
+now (void)
+{
+/* wall-clock time in seconds */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return (double) clock () / (double) CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday (&tv, NULL);
+    return (double) tv.tv_sec + ((double) tv.tv_usec / 1000000.0);
+#endif
+}
+
+static int
+open_benchmark (int loops)
+{
+/* connection-open latency */
+    int i;
+    int ret;
+    sqlite3 *handle;
+    void *cache;
+    double start;
+
+    start = now ();
+    for (i = 0; i < loops; i++)
+      {
+	  cache = spatialite_alloc_connection ();
+	  ret =
+	      sqlite3_open_v2 (":memory:", &handle,
+			       SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
+			       NULL);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "cannot open in-memory db: %s\n",
+			 sqlite3_errmsg (handle));
+		sqlite3_close (handle);
+		spatialite_cleanup_ex (cache);
+		return 0;
+	    }
+	  spatialite_init_ex (handle, cache, 0);
+	  ret = sqlite3_close (handle);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "sqlite3_close() error: %s\n",
+			 sqlite3_errmsg (handle));
+		return 0;
+	    }
+	  spatialite_cleanup_ex (cache);
+      }
+    fprintf (stderr, "connection open: %1.3f ms (average of %d)\n",
+	     (now () - start) * 1000.0 / (double) loops, loops);
+    return 1;
+}
+
+static long
+file_size (const char *path)
+{
+/* the current size (in bytes) of some file */
+    long size;
+    FILE *in = fopen (path, "rb");
+    if (in == NULL)
+	return -1;
+    if (fseek (in, 0, SEEK_END) != 0)
+      {
+	  fclose (in);
+	  return -1;
+      }
+    size = ftell (in);
+    fclose (in);
+    return size;
+}
+
+static int
+metadata_benchmark_run (const char *sql, int loops)
+{
+/* creating a DB-file by some InitSpatialMetaData() flavour */
+    int i;
+    int ret;
+    sqlite3 *handle;
+    void *cache;
+    char **results;
+    int rows;
+    int columns;
+    int objects = 0;
+    long size = 0;
+    double start;
+    double elapsed = 0.0;
+    const char *path = "init_benchmark.sqlite";
+
+    for (i = 0; i < loops; i++)
+      {
+	  unlink (path);
+	  cache = spatialite_alloc_connection ();
+	  ret =
+	      sqlite3_open_v2 (path, &handle,
+			       SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
+			       NULL);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "cannot open \"%s\": %s\n", path,
+			 sqlite3_errmsg (handle));
+		sqlite3_close (handle);
+		spatialite_cleanup_ex (cache);
+		return 0;
+	    }
+	  spatialite_init_ex (handle, cache, 0);
+	  start = now ();
+	  ret = sqlite3_get_table (handle, sql, &results, &rows, &columns, NULL);
+	  elapsed += now () - start;
+	  if (ret == SQLITE_OK)
+	    {
+		if (rows != 1 || results[1] == NULL || atoi (results[1]) != 1)
+		    ret = SQLITE_ERROR;
+		sqlite3_free_table (results);
+	    }
+	  if (ret == SQLITE_OK)
+	      ret =
+		  sqlite3_get_table (handle,
+				     "SELECT Count(*) FROM sqlite_master",
+				     &results, &rows, &columns, NULL);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "%s: failed\n", sql);
+		sqlite3_close (handle);
+		spatialite_cleanup_ex (cache);
+		unlink (path);
+		return 0;
+	    }
+	  objects = atoi (results[1]);
+	  sqlite3_free_table (results);
+	  sqlite3_close (handle);
+	  spatialite_cleanup_ex (cache);
+	  size = file_size (path);
+      }
+    unlink (path);
+    fprintf (stderr, "%s: %1.3f ms, %d objects, %ld bytes (average of %d)\n",
+	     sql, elapsed * 1000.0 / (double) loops, objects, size, loops);
+    return 1;
+}
+
+static int
+metadata_benchmark (int loops)
+{
+/* full vs lazy MetaData initialization */
+    if (!metadata_benchmark_run
+	("SELECT InitSpatialMetadata(1, 'WGS84')", loops))
+	return 0;
+    if (!metadata_benchmark_run
+	("SELECT InitSpatialMetadataLazy(1, 'WGS84')", loops))
+	return 0;
+    return 1;
+}
+
+int
+main (int argc, char *argv[])
+{
+    int loops = 64;
+    if (argc > 1)
+	loops = atoi (argv[1]);
+    if (loops < 1)
+      {
+	  fprintf (stderr, "usage: %s [loops]\n", argv[0]);
+	  return -1;
+      }
+
+    if (!open_benchmark (loops))
+	return -2;
+    if (!metadata_benchmark (loops))
+	return -3;
+
+    spatialite_shutdown ();
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+
+ output_benchmark.c -- SpatiaLite text output benchmark
+
+ Author: Sandro Furieri <a.furieri@lqt.it>
+
+ ------------------------------------------------------------------------------
+
+ Version: MPL 1.1/GPL 2.0/LGPL 2.1
+
+ The contents of this file are subject to the Mozilla Public License Version
+ 1.1 (the "License"); you may not use this file except in compliance with
+ the License. You may obtain a copy of the License at
+ http://www.mozilla.org/MPL/
+
+Software distributed under the License is distributed on an "AS IS" basis,
+WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+for the specific language governing rights and limitations under the
+License.
+
+The Original Code is the SpatiaLite library
+
+The Initial Developer of the Original Code is Alessandro Furieri
+
+Portions created by the Initial Developer are Copyright (C) 2013
+the Initial Developer. All Rights Reserved.
+
+Contributor(s):
+
+Alternatively, the contents of this file may be used under the terms of
+either the GNU General Public License Version 2 or later (the "GPL"), or
+the GNU Lesser General Public License Version 2.1 or later (the "LGPL"),
+in which case the provisions of the GPL or the LGPL are applicable instead
+of those above. If you wish to allow use of your version of this file only
+under the terms of either the GPL or the LGPL, and not to allow others to
+use your version of this file under the terms of the MPL, indicate your
+decision by deleting the provisions above and replace them with the notice
+and other provisions required by the GPL or the LGPL. If you do not delete
+the provisions above, a recipient may use your version of this file under
+the terms of any one of the MPL, the GPL or the LGPL.
+
+*/
+
+
+/*
+/ building a single Linestring of arbitrary size, then measuring the
+/ time required in order to format it as WKT, GeoJSON, KML, GML and SVG
+/
+/ usage: output_benchmark [vertices]
+/
+/ - vertices: number of Linestring vertices (default 100000)
+/
+/ doubling the figure should roughly double the timings; any
+/ quadratic behaviour will become immediately evident.
+/ this program is not run by "make check"; use "make output_benchmark"
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if !defined(_WIN32) || defined(__MINGW32__)
+#include <sys/time.h>
+#endif
+
+#include "sqlite3.h"
+#include "spatialite.h"
+
+static double
+now (void)
+{
+/* wall-clock time in seconds */
+#if defined(_WIN32) && !defined(__MINGW32__)
+    return (double) clock () / (double) CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday (&tv, NULL);
+    return (double) tv.tv_sec + ((double) tv.tv_usec / 1000000.0);
+#endif
+}
+
+static int
+output_benchmark (int points)
+{
+/* text output throughput: WKT, GeoJSON, KML, GML and SVG */
+    int i;
+    int ret;
+    sqlite3 *handle;
+    sqlite3_stmt *stmt;
+    void *cache;
+    char *err_msg = NULL;
+    char *sql;
+    int length;
+    double start;
+    double elapsed;
+    const char *formats[] = {
+	"AsText", "AsGeoJSON", "AsKml", "AsGml", "AsSVG", NULL
+    };
+
+    cache = spatialite_alloc_connection ();
+    ret =
+	sqlite3_open_v2 (":memory:", &handle,
+			 SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "cannot open in-memory db: %s\n",
+		   sqlite3_errmsg (handle));
+	  sqlite3_close (handle);
+	  spatialite_cleanup_ex (cache);
+	  return 0;
+      }
+    spatialite_init_ex (handle, cache, 0);
+
+/* a single long Linestring */
+    sql =
+	sqlite3_mprintf
+	("CREATE TABLE bench AS WITH RECURSIVE s(i) AS (SELECT 0 UNION ALL "
+	 "SELECT i + 1 FROM s WHERE i < %d) SELECT MakeLine(MakePoint("
+	 "i * 0.001, i * 0.002 + 0.123456789, 4326)) AS geom FROM s",
+	 points - 1);
+    ret = sqlite3_exec (handle, sql, NULL, NULL, &err_msg);
+    sqlite3_free (sql);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CREATE TABLE bench error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  sqlite3_close (handle);
+	  spatialite_cleanup_ex (cache);
+	  return 0;
+      }
+
+    for (i = 0; formats[i] != NULL; i++)
+      {
+	  sql = sqlite3_mprintf ("SELECT Length(%s(geom)) FROM bench",
+				 formats[i]);
+	  ret = sqlite3_prepare_v2 (handle, sql, -1, &stmt, NULL);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	    {
+		/* e.g. AsKml() requires PROJ */
+		fprintf (stderr, "%s: not available\n", formats[i]);
+		continue;
+	    }
+	  length = 0;
+	  start = now ();
+	  if (sqlite3_step (stmt) == SQLITE_ROW)
+	      length = sqlite3_column_int (stmt, 0);
+	  elapsed = now () - start;
+	  sqlite3_finalize (stmt);
+	  if (length <= 0)
+	    {
+		fprintf (stderr, "%s: unexpected empty output\n", formats[i]);
+		sqlite3_close (handle);
+		spatialite_cleanup_ex (cache);
+		return 0;
+	    }
+	  fprintf (stderr, "%s: %1.3f sec (%d vertices, %d bytes)\n",
+		   formats[i], elapsed, points, length);
+      }
+
+    sqlite3_close (handle);
+    spatialite_cleanup_ex (cache);
+    return 1;
+}
+
+int
+main (int argc, char *argv[])
+{
+    int points = 100000;
+    if (argc > 1)
+	points = atoi (argv[1]);
+    if (points < 2)
+      {
+	  fprintf (stderr, "usage: %s [vertices]\n", argv[0]);
+	  return -1;
+      }
+
+    if (!output_benchmark (points))
+	return -2;
+
+    spatialite_shutdown ();
+    return 0;
+}
@@ -1141,6 +1141,262 @@ do_test (sqlite3 * handle, const char *base_name, int srid, int has_z,
     return 0;
 }
 
+static int
+do_turns_exec (sqlite3 * handle, const char *sql)
+{
+/* executing a single SQL statement */
+    char *err_msg = NULL;
+    int ret = sqlite3_exec (handle, sql, NULL, NULL, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Turns SQL error: %s\n%s\n", sql, err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+do_turns_value (sqlite3 * handle, const char *sql, double expected)
+{
+/* checking a single numeric value returned by a query */
+    char **results;
+    int rows;
+    int columns;
+    char *err_msg = NULL;
+    double value;
+    int ret = sqlite3_get_table (handle, sql, &results, &rows, &columns,
+				 &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "Turns SQL error: %s\n%s\n", sql, err_msg);
+	  sqlite3_free (err_msg);
+	  return 0;
+      }
+    if (rows != 1 || columns != 1 || results[1] == NULL)
+      {
+	  fprintf (stderr, "Turns unexpected result: %s\n", sql);
+	  sqlite3_free_table (results);
+	  return 0;
+      }
+    value = atof (results[1]);
+    sqlite3_free_table (results);
+    if (value < expected - 0.0001 || value > expected + 0.0001)
+      {
+	  fprintf (stderr, "Turns: %s\nexpected %1.4f, got %1.4f\n", sql,
+		   expected, value);
+	  return 0;
+      }
+    return 1;
+}
+
+static int
+do_turns_route (sqlite3 * handle, const char *table, const char *algorithm,
+		const char *departure, double cost, int first_link)
+{
+/* checking a Shortest Path 1 -> 3 */
+    char *sql;
+    int ok;
+    sql = sqlite3_mprintf ("UPDATE \"%s\" SET Algorithm = '%s', "
+			   "Request = 'Shortest Path', DepartureTime = %s",
+			   table, algorithm, departure);
+    ok = do_turns_exec (handle, sql);
+    sqlite3_free (sql);
+    if (!ok)
+	return 0;
+    sql = sqlite3_mprintf ("SELECT Sum(CASE WHEN Role = 'Route' THEN Cost END) "
+			   "FROM \"%s\" WHERE NodeFrom = 1 AND NodeTo = 3",
+			   table);
+    ok = do_turns_value (handle, sql, cost);
+    sqlite3_free (sql);
+    if (!ok)
+	return 0;
+    sql = sqlite3_mprintf ("SELECT Sum(CASE WHEN RouteRow = 1 THEN LinkRowid "
+			   "END) FROM \"%s\" WHERE NodeFrom = 1 AND NodeTo = 3",
+			   table);
+    ok = do_turns_value (handle, sql, first_link);
+    sqlite3_free (sql);
+    return ok;
+}
+
+static int
+do_turns_range (sqlite3 * handle, const char *table, double total)
+{
+/* checking that every reached node is returned only once */
+    char *sql;
+    int ok;
+    sql = sqlite3_mprintf ("UPDATE \"%s\" SET Algorithm = 'Dijkstra', "
+			   "Request = 'Shortest Path', DepartureTime = NULL",
+			   table);
+    ok = do_turns_exec (handle, sql);
+    sqlite3_free (sql);
+    if (!ok)
+	return 0;
+    sql = sqlite3_mprintf ("SELECT Count(*) FROM \"%s\" WHERE NodeFrom = 1 "
+			   "AND Cost <= 100", table);
+    ok = do_turns_value (handle, sql, 3.0);
+    sqlite3_free (sql);
+    if (!ok)
+	return 0;
+    sql = sqlite3_mprintf ("SELECT Count(DISTINCT NodeTo) FROM \"%s\" "
+			   "WHERE NodeFrom = 1 AND Cost <= 100", table);
+    ok = do_turns_value (handle, sql, 3.0);
+    sqlite3_free (sql);
+    if (!ok)
+	return 0;
+    sql = sqlite3_mprintf ("SELECT Sum(Cost) FROM \"%s\" WHERE NodeFrom = 1 "
+			   "AND Cost <= 100", table);
+    ok = do_turns_value (handle, sql, total);
+    sqlite3_free (sql);
+    return ok;
+}
+
+static int
+do_turns_tsp (sqlite3 * handle, const char *table, const char *request)
+{
+/* checking a TSP 1 -> (2, 4) -> 1; legs order may vary */
+    char *sql;
+    int ok;
+    sql = sqlite3_mprintf ("UPDATE \"%s\" SET Algorithm = 'Dijkstra', "
+			   "Request = '%s', DepartureTime = NULL", table,
+			   request);
+    ok = do_turns_exec (handle, sql);
+    sqlite3_free (sql);
+    if (!ok)
+	return 0;
+    sql = sqlite3_mprintf ("SELECT Sum(CASE WHEN Role = 'TSP Solution' "
+			   "THEN Cost END) FROM \"%s\" WHERE NodeFrom = 1 "
+			   "AND NodeTo = '2,4'", table);
+    ok = do_turns_value (handle, sql, 60.0);
+    sqlite3_free (sql);
+    if (!ok)
+	return 0;
+    sql = sqlite3_mprintf ("SELECT Sum(Role = 'Route') FROM \"%s\" "
+			   "WHERE NodeFrom = 1 AND NodeTo = '2,4'", table);
+    ok = do_turns_value (handle, sql, 3.0);
+    sqlite3_free (sql);
+    if (!ok)
+	return 0;
+    sql = sqlite3_mprintf ("SELECT Count(DISTINCT CASE WHEN Role = 'Route' "
+			   "THEN NodeTo END) FROM \"%s\" WHERE NodeFrom = 1 "
+			   "AND NodeTo = '2,4'", table);
+    ok = do_turns_value (handle, sql, 3.0);
+    sqlite3_free (sql);
+    return ok;
+}
+
+static int
+do_test_turns (sqlite3 * handle)
+{
+/* testing turn restrictions, turn penalties and speed profiles */
+    if (!do_turns_exec
+	(handle,
+	 "CREATE TABLE turns_net (id INTEGER PRIMARY KEY, nfrom INTEGER, "
+	 "nto INTEGER, cost DOUBLE, name TEXT)"))
+	return -1;
+    if (!do_turns_exec
+	(handle,
+	 "SELECT AddGeometryColumn('turns_net', 'geom', 3003, 'LINESTRING', 'XY')"))
+	return -2;
+    if (!do_turns_exec
+	(handle,
+	 "INSERT INTO turns_net VALUES "
+	 "(1, 1, 2, 10, 'a', GeomFromText('LINESTRING(0 0, 10 0)', 3003)), "
+	 "(2, 2, 3, 10, 'b', GeomFromText('LINESTRING(10 0, 10 10)', 3003)), "
+	 "(3, 1, 4, 15, 'c', GeomFromText('LINESTRING(0 0, 0 10)', 3003)), "
+	 "(4, 4, 3, 15, 'd', GeomFromText('LINESTRING(0 10, 10 10)', 3003)), "
+	 "(5, 3, 1, 5, 'e', GeomFromText('LINESTRING(10 10, 0 0)', 3003))"))
+	return -3;
+    if (!do_turns_exec
+	(handle,
+	 "CREATE TABLE turns_forbid (from_link INTEGER, to_link INTEGER, "
+	 "penalty DOUBLE)"))
+	return -4;
+    if (!do_turns_exec
+	(handle, "INSERT INTO turns_forbid VALUES (1, 2, NULL)"))
+	return -5;
+    if (!do_turns_exec
+	(handle,
+	 "CREATE TABLE turns_penalty (from_link INTEGER, to_link INTEGER, "
+	 "penalty DOUBLE)"))
+	return -6;
+    if (!do_turns_exec (handle, "INSERT INTO turns_penalty VALUES (1, 2, 7)"))
+	return -7;
+    if (!do_turns_exec
+	(handle,
+	 "CREATE TABLE turns_speed (link_id INTEGER, hour INTEGER, "
+	 "factor DOUBLE)"))
+	return -8;
+    if (!do_turns_exec
+	(handle, "INSERT INTO turns_speed VALUES (3, 8, 3.0), (1, 8, 2.0)"))
+	return -9;
+    if (!do_turns_exec
+	(handle,
+	 "SELECT CreateRouting('turns_f_data', 'turns_f', 'turns_net', "
+	 "'nfrom', 'nto', 'geom', 'cost', 'name', 1, 0, NULL, NULL, 0, "
+	 "'turns_speed', 'turns_forbid')"))
+	return -10;
+    if (!do_turns_exec
+	(handle,
+	 "SELECT CreateRouting('turns_p_data', 'turns_p', 'turns_net', "
+	 "'nfrom', 'nto', 'geom', 'cost', 'name', 1, 0, NULL, NULL, 0, "
+	 "'turns_speed', 'turns_penalty')"))
+	return -11;
+
+/* forbidden turn 1 -> 2: the route must go 1 -> 4 -> 3 */
+    if (!do_turns_route (handle, "turns_f", "Dijkstra", "NULL", 30.0, 3))
+	return -12;
+    if (!do_turns_route (handle, "turns_f", "A*", "NULL", 30.0, 3))
+	return -13;
+    if (!do_turns_route (handle, "turns_f", "Dijkstra", "'08:00'", 60.0, 3))
+	return -14;
+    if (!do_turns_route (handle, "turns_f", "A*", "'08:00'", 60.0, 3))
+	return -15;
+    if (!do_turns_route (handle, "turns_f", "Dijkstra", "36000", 30.0, 3))
+	return -16;
+    if (!do_turns_range (handle, "turns_f", 55.0))
+	return -17;
+    if (!do_turns_tsp (handle, "turns_f", "TSP NN"))
+	return -18;
+    if (!do_turns_tsp (handle, "turns_f", "TSP GA"))
+	return -19;
+
+/* penalized turn 1 -> 2: still cheaper than 1 -> 4 -> 3 */
+    if (!do_turns_route (handle, "turns_p", "Dijkstra", "NULL", 27.0, 1))
+	return -20;
+    if (!do_turns_route (handle, "turns_p", "A*", "NULL", 27.0, 1))
+	return -21;
+    if (!do_turns_route (handle, "turns_p", "Dijkstra", "'08:00'", 37.0, 1))
+	return -22;
+    if (!do_turns_route (handle, "turns_p", "A*", "'08:00'", 37.0, 1))
+	return -23;
+    if (!do_turns_route (handle, "turns_p", "Dijkstra", "36000", 27.0, 1))
+	return -24;
+    if (!do_turns_range (handle, "turns_p", 52.0))
+	return -25;
+    if (!do_turns_tsp (handle, "turns_p", "TSP NN"))
+	return -26;
+    if (!do_turns_tsp (handle, "turns_p", "TSP GA"))
+	return -27;
+
+/* a TSP whose circular path can't be closed back to FROM */
+    if (!do_turns_exec (handle, "DELETE FROM turns_net WHERE id = 5"))
+	return -28;
+    if (!do_turns_exec
+	(handle,
+	 "SELECT CreateRouting('turns_o_data', 'turns_o', 'turns_net', "
+	 "'nfrom', 'nto', 'geom', 'cost', 'name', 1, 0)"))
+	return -29;
+    if (!do_turns_exec (handle, "UPDATE turns_o SET Request = 'TSP NN'"))
+	return -30;
+    if (!do_turns_value
+	(handle,
+	 "SELECT Sum(Role = 'Unreachable NodeTo') > 0 FROM turns_o "
+	 "WHERE NodeFrom = 1 AND NodeTo = '2,4'", 1.0))
+	return -31;
+    return 0;
+}
+
 #endif
 
 int
@@ -1513,6 +1769,14 @@ main (int argc, char *argv[])
 	  return -4;
       }
 
+/* testing turn restrictions, penalties and speed profiles */
+    ret = do_test_turns (handle);
+    if (ret != 0)
+      {
+	  fprintf (stderr, "Test Turns error (%d)\n", ret);
+	  return -48;
+      }
+
 #endif /* end GEOS conditional */
 
     sqlite3_close (handle);
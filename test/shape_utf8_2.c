@@ -52,6 +52,220 @@ the terms of any one of the MPL, the GPL or the LGPL.
 #include "sqlite3.h"
 #include "spatialite.h"
 
+#ifndef OMIT_ICONV		/* only if ICONV is supported */
+static void
+cleanup_shapefile (const char *filename)
+{
+    char nam[1000];
+
+    snprintf (nam, 1000, "%s.dbf", filename);
+    unlink (nam);
+    snprintf (nam, 1000, "%s.prj", filename);
+    unlink (nam);
+    snprintf (nam, 1000, "%s.shp", filename);
+    unlink (nam);
+    snprintf (nam, 1000, "%s.shx", filename);
+    unlink (nam);
+}
+
+static int
+get_dbf_field_length (const char *filename, const char *field)
+{
+/* reading the declared length of some DBF field */
+    char nam[1000];
+    unsigned char buf[32];
+    int length = -1;
+    FILE *in;
+    snprintf (nam, 1000, "%s.dbf", filename);
+    in = fopen (nam, "rb");
+    if (in == NULL)
+	return -1;
+    if (fread (buf, 1, 32, in) != 32)
+      {
+	  fclose (in);
+	  return -1;
+      }
+    while (fread (buf, 1, 32, in) == 32)
+      {
+	  if (buf[0] == 0x0d)
+	      break;
+	  if (strncmp ((const char *) buf, field, 11) == 0)
+	    {
+		length = buf[16];
+		break;
+	    }
+      }
+    fclose (in);
+    return length;
+}
+
+static int
+do_test_batch (sqlite3 * handle)
+{
+/* exporting a Shapefile spanning several decoding batches */
+    int ret;
+    int i;
+    int registered;
+    char *err_msg = NULL;
+    int row_count;
+    char **results;
+    int rows;
+    int columns;
+    char *sql;
+    char *charsets[] = { "UTF-8", "CP1252" };
+/* 'Citta n.2500' is 12 characters, but 13 bytes once encoded as UTF-8 */
+    int widths[] = { 13, 12 };
+    char dumpname[1024];
+
+/* registering a true Geometry column only when metadata are usable */
+    ret =
+	sqlite3_get_table (handle, "SELECT CheckSpatialMetadata()", &results,
+			   &rows, &columns, &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "CheckSpatialMetadata error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -30;
+      }
+    registered = (rows == 1 && results[1] != NULL
+		  && atoi (results[1]) == 3) ? 1 : 0;
+    sqlite3_free_table (results);
+    if (registered)
+      {
+	  ret =
+	      sqlite3_exec (handle,
+			    "CREATE TABLE batch (id INTEGER PRIMARY KEY, name TEXT)",
+			    NULL, NULL, &err_msg);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "CREATE TABLE batch error: %s\n", err_msg);
+		sqlite3_free (err_msg);
+		return -30;
+	    }
+	  ret =
+	      sqlite3_get_table (handle,
+				 "SELECT AddGeometryColumn('batch', 'geom', 4326, 'POINT', 'XY')",
+				 &results, &rows, &columns, &err_msg);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "AddGeometryColumn batch error: %s\n",
+			 err_msg);
+		sqlite3_free (err_msg);
+		return -30;
+	    }
+	  ret = (rows == 1 && results[1] != NULL) ? atoi (results[1]) : 0;
+	  sqlite3_free_table (results);
+	  if (ret != 1)
+	    {
+		fprintf (stderr,
+			 "AddGeometryColumn batch: unexpected result\n");
+		return -30;
+	    }
+      }
+    else
+      {
+	  ret =
+	      sqlite3_exec (handle,
+			    "CREATE TABLE batch (id INTEGER PRIMARY KEY, name TEXT, geom BLOB)",
+			    NULL, NULL, &err_msg);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "CREATE TABLE batch error: %s\n", err_msg);
+		sqlite3_free (err_msg);
+		return -30;
+	    }
+      }
+    ret =
+	sqlite3_exec (handle,
+		      "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL "
+		      "SELECT i + 1 FROM n WHERE i < 2500) "
+		      "INSERT INTO batch (id, name, geom) "
+		      "SELECT i, 'Citt\xc3\xa0 n.' || i, "
+		      "MakePoint(i, i / 2.0, 4326) FROM n", NULL, NULL,
+		      &err_msg);
+    if (ret != SQLITE_OK)
+      {
+	  fprintf (stderr, "INSERT INTO batch error: %s\n", err_msg);
+	  sqlite3_free (err_msg);
+	  return -31;
+      }
+    if (registered)
+      {
+	  /* the DBF text widths will be taken from the layer statistics */
+	  ret =
+	      sqlite3_exec (handle,
+			    "SELECT UpdateLayerStatistics('batch', 'geom')",
+			    NULL, NULL, &err_msg);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "UpdateLayerStatistics batch error: %s\n",
+			 err_msg);
+		sqlite3_free (err_msg);
+		return -31;
+	    }
+      }
+
+    for (i = 0; i < 2; i++)
+      {
+	  sprintf (dumpname, "%s_batch_%d", __FILE__, i);
+	  ret =
+	      dump_shapefile (handle, "batch", "geom", dumpname, charsets[i],
+			      "POINT", 0, &row_count, err_msg);
+	  if (!ret || row_count != 2500)
+	    {
+		fprintf (stderr, "dump_shapefile (%s) error: %d\n",
+			 charsets[i], row_count);
+		return -32;
+	    }
+	  ret = get_dbf_field_length (dumpname, "name");
+	  if (ret != widths[i])
+	    {
+		fprintf (stderr, "unexpected DBF width (%s): %d\n",
+			 charsets[i], ret);
+		cleanup_shapefile (dumpname);
+		return -36;
+	    }
+	  sql = sqlite3_mprintf ("batch_%d", i);
+	  ret =
+	      load_shapefile (handle, dumpname, sql, charsets[i], 4326, "geom",
+			      0, 0, 0, 0, &row_count, err_msg);
+	  sqlite3_free (sql);
+	  cleanup_shapefile (dumpname);
+	  if (!ret || row_count != 2500)
+	    {
+		fprintf (stderr, "load_shapefile (%s) error: %d\n",
+			 charsets[i], row_count);
+		return -33;
+	    }
+	  sql =
+	      sqlite3_mprintf ("SELECT Count(*) FROM batch AS a "
+			       "JOIN batch_%d AS b ON (a.id = b.id AND "
+			       "a.name = b.name AND "
+			       "ST_X(a.geom) = ST_X(b.geom) AND "
+			       "ST_Y(a.geom) = ST_Y(b.geom))", i);
+	  ret =
+	      sqlite3_get_table (handle, sql, &results, &rows, &columns,
+				 &err_msg);
+	  sqlite3_free (sql);
+	  if (ret != SQLITE_OK)
+	    {
+		fprintf (stderr, "batch check error: %s\n", err_msg);
+		sqlite3_free (err_msg);
+		return -34;
+	    }
+	  if (rows != 1 || atoi (results[1]) != 2500)
+	    {
+		fprintf (stderr, "unexpected batch check (%s): %s\n",
+			 charsets[i], results[1]);
+		sqlite3_free_table (results);
+		return -35;
+	    }
+	  sqlite3_free_table (results);
+      }
+    return 0;
+}
+#endif /* end ICONV conditional */
+
 int
 main (int argc, char *argv[])
 {
@@ -206,6 +420,13 @@ main (int argc, char *argv[])
     unlink (kmlname);
 #endif /* end PROJ conditional */
 
+    ret = do_test_batch (handle);
+    if (ret != 0)
+      {
+	  sqlite3_close (handle);
+	  return ret;
+      }
+
     ret = dump_geojson (handle, "route", "col1", geojsonname, 10, 5);
     if (!ret)
       {